@@ -24,7 +24,9 @@ LOCAL_SRC_FILES := \
     Animation.cpp \
     AnimationClip.cpp \
     AnimationController.cpp \
+    AnimationPose.cpp \
     AnimationTarget.cpp \
+    AnimationTexture.cpp \
     AnimationValue.cpp \
     AudioBuffer.cpp \
     AudioController.cpp \
@@ -32,10 +34,12 @@ LOCAL_SRC_FILES := \
     AudioSource.cpp \
     BoundingBox.cpp \
     BoundingSphere.cpp \
+    BoundingVolumeTree.cpp \
     Bundle.cpp \
     Button.cpp \
     Camera.cpp \
     CheckBox.cpp \
+    ClusteredLighting.cpp \
     Container.cpp \
     Control.cpp \
     ControlFactory.cpp \
@@ -43,35 +47,61 @@ LOCAL_SRC_FILES := \
     DebugNew.cpp \
     DepthStencilTarget.cpp \
     Drawable.cpp \
+    DynamicBuffer.cpp \
+    DynamicResolution.cpp \
     Effect.cpp \
     FileSystem.cpp \
     FlowLayout.cpp \
     Font.cpp \
     Form.cpp \
     FrameBuffer.cpp \
+    FramePacer.cpp \
+    RenderThread.cpp \
+    UploadThread.cpp \
+    FrameStats.cpp \
+    FrameCapture.cpp \
+    ResourceStats.cpp \
     Frustum.cpp \
     Game.cpp \
     Gamepad.cpp \
+    InputRecorder.cpp \
+    GLStateCache.cpp \
     HeightField.cpp \
     Image.cpp \
     ImageControl.cpp \
+    JobSystem.cpp \
     Joint.cpp \
+    JointTexture.cpp \
     JoystickControl.cpp \
     Label.cpp \
     Layout.cpp \
     Light.cpp \
+    ListView.cpp \
+    LoadingScreen.cpp \
     Logger.cpp \
     Material.cpp \
     MaterialParameter.cpp \
+    MaterialParameterBlock.cpp \
     MathUtil.cpp \
     Matrix.cpp \
+    MemoryArena.cpp \
     Mesh.cpp \
     MeshBatch.cpp \
+    MeshBufferPool.cpp \
     MeshPart.cpp \
     MeshSkin.cpp \
     Model.cpp \
+    NavigationMesh.cpp \
     Node.cpp \
+    ObjectPool.cpp \
+    OcclusionCuller.cpp \
     ParticleEmitter.cpp \
+    ParticleEmitterPool.cpp \
+    ParticleRenderer.cpp \
+    ParticleSimulator.cpp \
+    ParticleSystem.cpp \
+    PerformanceHud.cpp \
+    PerformanceGovernor.cpp \
     Pass.cpp \
     PhysicsCharacter.cpp \
     PhysicsCollisionObject.cpp \
@@ -88,31 +118,43 @@ LOCAL_SRC_FILES := \
     PhysicsVehicle.cpp \
     PhysicsVehicleWheel.cpp \
     Plane.cpp \
+    Prefab.cpp \
     Platform.cpp \
     PlatformAndroid.cpp \
+    Profiler.cpp \
     Properties.cpp \
     Quaternion.cpp \
     RadioButton.cpp \
     Ray.cpp \
     Rectangle.cpp \
     Ref.cpp \
+    RenderQueue.cpp \
     RenderState.cpp \
     RenderTarget.cpp \
+    RenderTargetPool.cpp \
+    ResourceManager.cpp \
     Scene.cpp \
     SceneLoader.cpp \
+    SceneSnapshot.cpp \
     ScreenDisplayer.cpp \
     Script.cpp \
     ScriptController.cpp \
+    ScriptFunction.cpp \
     ScriptTarget.cpp \
+    ShadowMap.cpp \
     Slider.cpp \
     Sprite.cpp \
     SpriteBatch.cpp \
+    StreamingTerrain.cpp \
+    StringTable.cpp \
     Technique.cpp \
     Terrain.cpp \
     TerrainPatch.cpp \
+    TerrainFoliage.cpp \
     Text.cpp \
     TextBox.cpp \
     Texture.cpp \
+    TextureAtlas.cpp \
     Theme.cpp \
     ThemeStyle.cpp \
     TileSet.cpp \
@@ -123,6 +165,8 @@ LOCAL_SRC_FILES := \
     VertexAttributeBinding.cpp \
     VertexFormat.cpp \
     VerticalLayout.cpp \
+    ViewUniformBuffer.cpp \
+    WorldStreamer.cpp \
     lua/lua_AbsoluteLayout.cpp \
     lua/lua_AIAgent.cpp \
     lua/lua_AIAgentListener.cpp \
@@ -222,6 +266,7 @@ LOCAL_SRC_FILES := \
     lua/lua_RenderState.cpp \
     lua/lua_RenderStateStateBlock.cpp \
     lua/lua_RenderTarget.cpp \
+    lua/lua_ResourceStats.cpp \
     lua/lua_Scene.cpp \
     lua/lua_ScreenDisplayer.cpp \
     lua/lua_Script.cpp \
@@ -20,7 +20,9 @@ SOURCES += src/AbsoluteLayout.cpp \
     src/Animation.cpp \
     src/AnimationClip.cpp \
     src/AnimationController.cpp \
+    src/AnimationPose.cpp \
     src/AnimationTarget.cpp \
+    src/AnimationTexture.cpp \
     src/AnimationValue.cpp \
     src/AudioBuffer.cpp \
     src/AudioController.cpp \
@@ -30,51 +32,84 @@ SOURCES += src/AbsoluteLayout.cpp \
     src/BoundingBox.inl \
     src/BoundingSphere.cpp \
     src/BoundingSphere.inl \
+    src/BoundingVolumeTree.cpp \
     src/Bundle.cpp \
     src/Button.cpp \
     src/Camera.cpp \
     src/CheckBox.cpp \
+    src/ClusteredLighting.cpp \
     src/Container.cpp \
     src/Control.cpp \
     src/ControlFactory.cpp \
     src/Curve.cpp \
     src/DepthStencilTarget.cpp \
     src/Drawable.cpp \
+    src/DynamicBuffer.cpp \
+    src/DynamicResolution.cpp \
     src/Effect.cpp \
     src/FileSystem.cpp \
     src/FlowLayout.cpp \
     src/Font.cpp \
     src/Form.cpp \
     src/FrameBuffer.cpp \
+    src/FramePacer.cpp \
+    src/RenderThread.cpp \
+    src/UploadThread.cpp \
+    src/FrameStats.cpp \
+    src/FrameCapture.cpp \
+    src/ResourceStats.cpp \
+    src/FrameStats.inl \
+    src/FrameCapture.inl \
     src/Frustum.cpp \
     src/Game.cpp \
     src/Game.inl \
     src/Gamepad.cpp \
+    src/InputRecorder.cpp \
+    src/GLStateCache.cpp \
+    src/GLStateCache.inl \
     src/HeightField.cpp \
+    src/HeightField.inl \
     src/Image.cpp \
     src/Image.inl \
     src/ImageControl.cpp \
+    src/JobSystem.cpp \
     src/Joint.cpp \
+    src/JointTexture.cpp \
     src/JoystickControl.cpp \
     src/Label.cpp \
     src/Layout.cpp \
     src/Light.cpp \
+    src/ListView.cpp \
+    src/LoadingScreen.cpp \
     src/Logger.cpp \
     src/Material.cpp \
     src/MaterialParameter.cpp \
+    src/MaterialParameterBlock.cpp \
     src/MathUtil.cpp \
     src/MathUtil.inl \
     src/MathUtilNeon.inl \
     src/Matrix.cpp \
     src/Matrix.inl \
+    src/MemoryArena.cpp \
+    src/MemoryArena.inl \
     src/Mesh.cpp \
     src/MeshBatch.cpp \
+    src/MeshBufferPool.cpp \
     src/MeshBatch.inl \
     src/MeshPart.cpp \
     src/MeshSkin.cpp \
     src/Model.cpp \
+    src/NavigationMesh.cpp \
     src/Node.cpp \
+    src/ObjectPool.cpp \
+    src/OcclusionCuller.cpp \
     src/ParticleEmitter.cpp \
+    src/ParticleEmitterPool.cpp \
+    src/ParticleRenderer.cpp \
+    src/ParticleSimulator.cpp \
+    src/ParticleSystem.cpp \
+    src/PerformanceHud.cpp \
+    src/PerformanceGovernor.cpp \
     src/Pass.cpp \
     src/PhysicsCharacter.cpp \
     src/PhysicsCollisionObject.cpp \
@@ -96,8 +131,10 @@ SOURCES += src/AbsoluteLayout.cpp \
     src/PhysicsVehicle.cpp \
     src/PhysicsVehicleWheel.cpp \
     src/Plane.cpp \
+    src/Prefab.cpp \
     src/Plane.inl \
     src/Platform.cpp \
+    src/Profiler.cpp \
     src/Properties.cpp \
     src/Quaternion.cpp \
     src/Quaternion.inl \
@@ -106,24 +143,34 @@ SOURCES += src/AbsoluteLayout.cpp \
     src/Ray.inl \
     src/Rectangle.cpp \
     src/Ref.cpp \
+    src/RenderQueue.cpp \
     src/RenderState.cpp \
     src/RenderTarget.cpp \
+    src/RenderTargetPool.cpp \
+    src/ResourceManager.cpp \
     src/Scene.cpp \
     src/SceneLoader.cpp \
+    src/SceneSnapshot.cpp \
     src/ScreenDisplayer.cpp \
     src/Script.cpp \
     src/ScriptController.cpp \
     src/ScriptController.inl \
+    src/ScriptFunction.cpp \
     src/ScriptTarget.cpp \
+    src/ShadowMap.cpp \
     src/Slider.cpp \
     src/Sprite.cpp \
     src/SpriteBatch.cpp \
+    src/StreamingTerrain.cpp \
+    src/StringTable.cpp \
     src/Technique.cpp \
     src/Terrain.cpp \
     src/TerrainPatch.cpp \
+    src/TerrainFoliage.cpp \
     src/Text.cpp \
     src/TextBox.cpp \
     src/Texture.cpp \
+    src/TextureAtlas.cpp \
     src/Theme.cpp \
     src/ThemeStyle.cpp \
     src/TileSet.cpp \
@@ -236,6 +283,7 @@ SOURCES += src/AbsoluteLayout.cpp \
     src/lua/lua_RenderState.cpp \
     src/lua/lua_RenderStateStateBlock.cpp \
     src/lua/lua_RenderTarget.cpp \
+    src/lua/lua_ResourceStats.cpp \
     src/lua/lua_Scene.cpp \
     src/lua/lua_ScreenDisplayer.cpp \
     src/lua/lua_Script.cpp \
@@ -270,7 +318,9 @@ SOURCES += src/AbsoluteLayout.cpp \
     src/lua/lua_VertexAttributeBinding.cpp \
     src/lua/lua_VertexFormat.cpp \
     src/lua/lua_VertexFormatElement.cpp \
-    src/lua/lua_VerticalLayout.cpp
+    src/lua/lua_VerticalLayout.cpp \
+    src/ViewUniformBuffer.cpp \
+    src/WorldStreamer.cpp
 
 HEADERS += src/AbsoluteLayout.h \
     src/AIAgent.h \
@@ -281,7 +331,9 @@ HEADERS += src/AbsoluteLayout.h \
     src/Animation.h \
     src/AnimationClip.h \
     src/AnimationController.h \
+    src/AnimationPose.h \
     src/AnimationTarget.h \
+    src/AnimationTexture.h \
     src/AnimationValue.h \
     src/AudioBuffer.h \
     src/AudioController.h \
@@ -290,49 +342,77 @@ HEADERS += src/AbsoluteLayout.h \
     src/Base.h \
     src/BoundingBox.h \
     src/BoundingSphere.h \
+    src/BoundingVolumeTree.h \
     src/Bundle.h \
     src/Button.h \
     src/Camera.h \
     src/CheckBox.h \
+    src/ClusteredLighting.h \
     src/Container.h \
     src/Control.h \
     src/ControlFactory.h \
     src/Curve.h \
     src/DepthStencilTarget.h \
     src/Drawable.h \
+    src/DynamicBuffer.h \
+    src/DynamicResolution.h \
     src/Effect.h \
     src/FileSystem.h \
     src/FlowLayout.h \
     src/Font.h \
     src/Form.h \
     src/FrameBuffer.h \
+    src/FramePacer.h \
+    src/RenderThread.h \
+    src/UploadThread.h \
+    src/FrameStats.h \
+    src/FrameCapture.h \
+    src/ResourceStats.h \
     src/Frustum.h \
     src/Game.h \
     src/Gamepad.h \
+    src/InputRecorder.h \
     src/gameplay.h \
     src/Gesture.h \
+    src/GLStateCache.h \
     src/HeightField.h \
     src/Image.h \
     src/ImageControl.h \
+    src/JobSystem.h \
     src/Joint.h \
+    src/JointTexture.h \
     src/JoystickControl.h \
     src/Keyboard.h \
     src/Label.h \
     src/Layout.h \
     src/Light.h \
+    src/ListView.h \
+    src/LoadingScreen.h \
     src/Logger.h \
     src/Material.h \
     src/MaterialParameter.h \
+    src/MaterialParameterBlock.h \
     src/MathUtil.h \
     src/Matrix.h \
+    src/MemoryArena.h \
     src/Mesh.h \
     src/MeshBatch.h \
+    src/MeshBufferPool.h \
     src/MeshPart.h \
     src/MeshSkin.h \
     src/Model.h \
     src/Mouse.h \
+    src/NavigationMesh.h \
     src/Node.h \
+    src/ObjectPool.h \
+    src/OcclusionCuller.h \
     src/ParticleEmitter.h \
+    src/ParticleEmitterPool.h \
+    src/ParticleRenderer.h \
+    src/ParticleSimulator.h \
+    src/ParticleSystem.h \
+    src/PerformanceHud.h \
+    src/PerformanceGovernor.h \
     src/Pass.h \
     src/PhysicsCharacter.h \
     src/PhysicsCollisionObject.h \
@@ -349,31 +429,43 @@ HEADERS += src/AbsoluteLayout.h \
     src/PhysicsVehicle.h \
     src/PhysicsVehicleWheel.h \
     src/Plane.h \
+    src/Prefab.h \
     src/Platform.h \
+    src/Profiler.h \
     src/Properties.h \
     src/Quaternion.h \
     src/RadioButton.h \
     src/Ray.h \
     src/Rectangle.h \
     src/Ref.h \
+    src/RenderQueue.h \
     src/RenderState.h \
     src/RenderTarget.h \
+    src/RenderTargetPool.h \
+    src/ResourceManager.h \
     src/Scene.h \
     src/SceneLoader.h \
+    src/SceneSnapshot.h \
     src/ScreenDisplayer.h \
     src/Script.h \
     src/ScriptController.h \
+    src/ScriptFunction.h \
     src/ScriptTarget.h \
+    src/ShadowMap.h \
     src/Slider.h \
     src/Sprite.h \
     src/SpriteBatch.h \
     src/Stream.h \
+    src/StreamingTerrain.h \
+    src/StringTable.h \
     src/Technique.h \
     src/Terrain.h \
     src/TerrainPatch.h \
+    src/TerrainFoliage.h \
     src/Text.h \
     src/TextBox.h \
     src/Texture.h \
+    src/TextureAtlas.h \
     src/Theme.h \
     src/ThemeStyle.h \
     src/TileSet.h \
@@ -486,6 +578,7 @@ HEADERS += src/AbsoluteLayout.h \
     src/lua/lua_Ref.h \
     src/lua/lua_RenderState.h \
     src/lua/lua_RenderTarget.h \
+    src/lua/lua_ResourceStats.h \
     src/lua/lua_Scene.h \
     src/lua/lua_ScreenDisplayer.h \
     src/lua/lua_Script.h \
@@ -521,7 +614,9 @@ HEADERS += src/AbsoluteLayout.h \
     src/lua/lua_VertexAttributeBinding.h \
     src/lua/lua_VertexFormat.h \
     src/lua/lua_VertexFormatElement.h \
-    src/lua/lua_VerticalLayout.h
+    src/lua/lua_VerticalLayout.h \
+    src/ViewUniformBuffer.h \
+    src/WorldStreamer.h
 
 INCLUDEPATH += $$PWD/../gameplay/src
 INCLUDEPATH += $$PWD/../external-deps/include
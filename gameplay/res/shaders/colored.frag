@@ -15,12 +15,14 @@ precision mediump float;
 #ifndef POINT_LIGHT_COUNT
 #define POINT_LIGHT_COUNT 0
 #endif
-#if (DIRECTIONAL_LIGHT_COUNT > 0) || (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0)
+#if (DIRECTIONAL_LIGHT_COUNT > 0) || (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0) || defined(CLUSTERED_LIGHTING)
 #define LIGHTING
 #endif
 
 ///////////////////////////////////////////////////////////
 // Uniforms
+#include "view-uniforms.glsl"
+
 uniform vec3 u_ambientColor;
 uniform vec4 u_diffuseColor;
 
@@ -49,6 +51,27 @@ uniform float u_spotLightInnerAngleCos[SPOT_LIGHT_COUNT];
 uniform float u_spotLightOuterAngleCos[SPOT_LIGHT_COUNT];
 #endif
 
+#if defined(CLUSTERED_LIGHTING)
+uniform sampler2D u_clusterLightTexture;
+uniform sampler2D u_clusterTexture;
+uniform sampler2D u_clusterIndexTexture;
+uniform vec4 u_clusterGrid;
+uniform vec4 u_clusterDepth;
+uniform vec4 u_clusterScreen;
+uniform vec4 u_clusterTextureScale;
+#endif
+
+#if defined(SHADOW)
+#ifndef SHADOW_CASCADE_COUNT
+#define SHADOW_CASCADE_COUNT 1
+#endif
+uniform sampler2D u_shadowMap;
+uniform sampler2D u_shadowDynamicMap;
+uniform mat4 u_shadowMatrix[SHADOW_CASCADE_COUNT];
+uniform vec4 u_shadowCascadeSplits;
+uniform vec4 u_shadowParameters;
+#endif
+
 #if defined(SPECULAR)
 uniform float u_specularExponent;
 #endif
@@ -93,6 +116,10 @@ varying vec3 v_vertexToSpotLightDirection[SPOT_LIGHT_COUNT];
 varying vec3 v_cameraDirection; 
 #endif
 
+#if defined(CLUSTERED_LIGHTING) || defined(SHADOW)
+varying vec3 v_positionWorldViewSpace;
+#endif
+
 #include "lighting.frag"
 
 #endif
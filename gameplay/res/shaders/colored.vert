@@ -7,7 +7,7 @@
 #ifndef POINT_LIGHT_COUNT
 #define POINT_LIGHT_COUNT 0
 #endif
-#if (DIRECTIONAL_LIGHT_COUNT > 0) || (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0)
+#if (DIRECTIONAL_LIGHT_COUNT > 0) || (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0) || defined(CLUSTERED_LIGHTING)
 #define LIGHTING
 #endif
 
@@ -15,9 +15,16 @@
 // Attributes
 attribute vec4 a_position;
 
+#if defined(INSTANCED)
+attribute mat4 a_instanceMatrix;
+#endif
+
 #if defined(SKINNING)
 attribute vec4 a_blendWeights;
 attribute vec4 a_blendIndices;
+#if defined(SKINNING_ANIMATION_TEXTURE)
+attribute vec4 a_instanceData;
+#endif
 #endif
 
 #if defined(LIGHTMAP)
@@ -34,18 +41,43 @@ attribute vec3 a_color;
 
 ///////////////////////////////////////////////////////////
 // Uniforms
+#include "view-uniforms.glsl"
+
+#if defined(INSTANCED)
+#if !defined(UNIFORM_BUFFERS)
+uniform mat4 u_viewProjectionMatrix;
+#endif
+#else
 uniform mat4 u_worldViewProjectionMatrix;
+#endif
 
 #if defined(SKINNING)
+#if defined(SKINNING_ANIMATION_TEXTURE)
+uniform vec4 u_animationParameters;
+uniform sampler2D u_animationTexture;
+#elif defined(SKINNING_TEXTURE)
+uniform vec4 u_jointPaletteOffset;
+uniform sampler2D u_jointTexture;
+#elif defined(SKINNING_DUAL_QUATERNION)
+uniform vec4 u_dualQuaternionPalette[SKINNING_JOINT_COUNT * 2];
+#else
 uniform vec4 u_matrixPalette[SKINNING_JOINT_COUNT * 3];
 #endif
+#endif
 
 #if defined(LIGHTING)
+#if defined(INSTANCED)
+// Instances build their view space transforms from their world matrix and the view matrix.
+#if !defined(UNIFORM_BUFFERS)
+uniform mat4 u_viewMatrix;
+#endif
+#else
 uniform mat4 u_inverseTransposeWorldViewMatrix;
 
-#if (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0) || defined(SPECULAR)
+#if (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0) || defined(SPECULAR) || defined(CLUSTERED_LIGHTING) || defined(SHADOW)
 uniform mat4 u_worldViewMatrix;
 #endif
+#endif
 
 #if (DIRECTIONAL_LIGHT_COUNT > 0)
 uniform vec3 u_directionalLightDirection[DIRECTIONAL_LIGHT_COUNT];
@@ -67,7 +99,9 @@ uniform vec3 u_cameraPosition;
 #endif
 
 #if defined(CLIP_PLANE)
+#if !defined(INSTANCED)
 uniform mat4 u_worldMatrix;
+#endif
 uniform vec4 u_clipPlane;
 #endif
 
@@ -101,6 +135,10 @@ varying vec3 v_vertexToSpotLightDirection[SPOT_LIGHT_COUNT];
 varying vec3 v_cameraDirection;
 #endif
 
+#if defined(CLUSTERED_LIGHTING) || defined(SHADOW)
+varying vec3 v_positionWorldViewSpace;
+#endif
+
 #include "lighting.vert"
 
 #endif
@@ -118,14 +156,22 @@ varying float v_clipDistance;
 void main()
 {
     vec4 position = getPosition();
+    #if defined(INSTANCED)
+    gl_Position = u_viewProjectionMatrix * (a_instanceMatrix * position);
+    #else
     gl_Position = u_worldViewProjectionMatrix * position;
+    #endif
 
     #if defined (LIGHTING)
 
     vec3 normal = getNormal();
 
     // Transform normal to view space.
+    #if defined(INSTANCED)
+    mat3 inverseTransposeWorldViewMatrix = getInverseTransposeWorldViewMatrix();
+    #else
     mat3 inverseTransposeWorldViewMatrix = mat3(u_inverseTransposeWorldViewMatrix[0].xyz, u_inverseTransposeWorldViewMatrix[1].xyz, u_inverseTransposeWorldViewMatrix[2].xyz);
+    #endif
     v_normalVector = inverseTransposeWorldViewMatrix * normal;
 
     // Apply light.
@@ -144,6 +190,10 @@ void main()
     #endif
     
     #if defined(CLIP_PLANE)
+    #if defined(INSTANCED)
+    v_clipDistance = dot(a_instanceMatrix * position, u_clipPlane);
+    #else
     v_clipDistance = dot(u_worldMatrix * position, u_clipPlane);
+    #endif
     #endif    
 }
@@ -0,0 +1,35 @@
+#ifdef OPENGL_ES
+precision mediump float;
+#endif
+
+///////////////////////////////////////////////////////////
+// Uniforms
+#if defined(TEXTURE_DISCARD_ALPHA)
+uniform sampler2D u_diffuseTexture;
+#endif
+
+///////////////////////////////////////////////////////////
+// Varyings
+#if defined(TEXTURE_DISCARD_ALPHA)
+varying vec2 v_texCoord;
+#endif
+#if defined(CLIP_PLANE)
+varying float v_clipDistance;
+#endif
+
+
+void main()
+{
+    #if defined(CLIP_PLANE)
+    if(v_clipDistance < 0.0) discard;
+    #endif
+
+    // Alpha tested pixels are left out of the depth, as they are when shaded.
+    #if defined(TEXTURE_DISCARD_ALPHA)
+    if (texture2D(u_diffuseTexture, v_texCoord).a < 0.5)
+        discard;
+    #endif
+
+    // Only the depth is written, with writes to the color buffer disabled.
+    gl_FragColor = vec4(1.0);
+}
@@ -26,6 +26,75 @@ vec3 computeLighting(vec3 normalVector, vec3 lightDirection, vec3 lightColor, fl
     #endif
 }
 
+#if defined(CLUSTERED_LIGHTING) && !defined(BUMPED)
+#ifndef CLUSTER_MAX_LIGHTS
+#define CLUSTER_MAX_LIGHTS 64
+#endif
+
+vec3 computeClusteredLighting(vec3 normalVector)
+{
+    // Find the cluster of the pixel from its tile on the screen and its depth slice.
+    vec2 tile = clamp(floor((gl_FragCoord.xy - u_clusterScreen.zw) * u_clusterScreen.xy), vec2(0.0), u_clusterGrid.xy - 1.0);
+    float slice = clamp(floor(log(-v_positionWorldViewSpace.z / u_clusterDepth.x) * u_clusterDepth.y), 0.0, u_clusterGrid.z - 1.0);
+    vec4 cluster = texture2D(u_clusterTexture, vec2((tile.y * u_clusterGrid.x + tile.x + 0.5) / (u_clusterGrid.x * u_clusterGrid.y), (slice + 0.5) / u_clusterGrid.z));
+
+    vec3 combinedColor = vec3(0.0);
+    for (int i = 0; i < CLUSTER_MAX_LIGHTS; ++i)
+    {
+        if (float(i) >= cluster.y)
+            break;
+
+        // Each index texel holds one light, and each light is three texels of the light texture.
+        float index = cluster.x + float(i);
+        vec2 indexCoord = vec2((mod(index, 1.0 / u_clusterTextureScale.x) + 0.5) * u_clusterTextureScale.x, (floor(index * u_clusterTextureScale.x) + 0.5) * u_clusterTextureScale.y);
+        float light = (texture2D(u_clusterIndexTexture, indexCoord).x + 0.5) * u_clusterTextureScale.z;
+        vec4 lightPosition = texture2D(u_clusterLightTexture, vec2(0.5 / 3.0, light));
+        vec4 lightColor = texture2D(u_clusterLightTexture, vec2(1.5 / 3.0, light));
+        vec4 lightDirection = texture2D(u_clusterLightTexture, vec2(2.5 / 3.0, light));
+
+        // Range attenuation, then spot attenuation between the outer (w of the color) and inner (w of the direction) cone angle cosines.
+        vec3 vertexToLight = lightPosition.xyz - v_positionWorldViewSpace;
+        vec3 ldir = vertexToLight * lightPosition.w;
+        float attenuation = clamp(1.0 - dot(ldir, ldir), 0.0, 1.0);
+        vec3 vertexToLightDirection = normalize(vertexToLight);
+        attenuation *= smoothstep(lightColor.w, lightDirection.w, dot(lightDirection.xyz, -vertexToLightDirection));
+        combinedColor += computeLighting(normalVector, vertexToLightDirection, lightColor.rgb, attenuation);
+    }
+    return combinedColor;
+}
+#endif
+
+#if defined(SHADOW) && !defined(BUMPED)
+float sampleShadow(vec3 coord)
+{
+    // The nearer of the static and dynamic caster depths occludes the pixel.
+    float depth = min(texture2D(u_shadowMap, coord.xy).r, texture2D(u_shadowDynamicMap, coord.xy).r);
+    return step(coord.z - u_shadowParameters.z, depth);
+}
+
+float computeShadow()
+{
+    // Pick the first cascade whose split is beyond the depth of the pixel.
+    float depth = -v_positionWorldViewSpace.z;
+    vec4 coord = u_shadowMatrix[0] * vec4(v_positionWorldViewSpace, 1.0);
+    for (int i = 1; i < SHADOW_CASCADE_COUNT; ++i)
+    {
+        if (depth > u_shadowCascadeSplits[i - 1])
+            coord = u_shadowMatrix[i] * vec4(v_positionWorldViewSpace, 1.0);
+    }
+    coord.xyz /= coord.w;
+    if (depth > u_shadowCascadeSplits[SHADOW_CASCADE_COUNT - 1] || coord.z > 1.0)
+        return 1.0;
+
+    // Average four taps around the pixel to soften the edges of the shadow.
+    vec2 texel = u_shadowParameters.xy * 0.5;
+    return (sampleShadow(vec3(coord.x - texel.x, coord.y - texel.y, coord.z)) +
+            sampleShadow(vec3(coord.x + texel.x, coord.y - texel.y, coord.z)) +
+            sampleShadow(vec3(coord.x - texel.x, coord.y + texel.y, coord.z)) +
+            sampleShadow(vec3(coord.x + texel.x, coord.y + texel.y, coord.z))) * 0.25;
+}
+#endif
+
 vec3 getLitPixel()
 {
     #if defined(BUMPED)
@@ -41,6 +110,13 @@ vec3 getLitPixel()
     vec3 ambientColor = _baseColor.rgb * u_ambientColor;
     vec3 combinedColor = ambientColor;
 
+    // The shadow darkens the first directional light, or the first spot light when there is none.
+    #if defined(SHADOW) && !defined(BUMPED)
+    float shadow = computeShadow();
+    #else
+    float shadow = 1.0;
+    #endif
+
     // Directional light contribution
     #if (DIRECTIONAL_LIGHT_COUNT > 0)
     for (int i = 0; i < DIRECTIONAL_LIGHT_COUNT; ++i)
@@ -50,7 +126,7 @@ vec3 getLitPixel()
         #else
         vec3 lightDirection = normalize(u_directionalLightDirection[i] * 2.0);
         #endif 
-        combinedColor += computeLighting(normalVector, -lightDirection, u_directionalLightColor[i], 1.0);
+        combinedColor += computeLighting(normalVector, -lightDirection, u_directionalLightColor[i], i == 0 ? shadow : 1.0);
     }
     #endif
 
@@ -84,9 +160,18 @@ vec3 getLitPixel()
 
 		// Apply spot attenuation
         attenuation *= smoothstep(u_spotLightOuterAngleCos[i], u_spotLightInnerAngleCos[i], spotCurrentAngleCos);
+        #if (DIRECTIONAL_LIGHT_COUNT == 0)
+        if (i == 0)
+            attenuation *= shadow;
+        #endif
         combinedColor += computeLighting(normalVector, vertexToSpotLightDirection, u_spotLightColor[i], attenuation);
     }
     #endif
 
+    // Point and spot lights of the cluster of the pixel
+    #if defined(CLUSTERED_LIGHTING) && !defined(BUMPED)
+    combinedColor += computeClusteredLighting(normalVector);
+    #endif
+
     return combinedColor;
 }
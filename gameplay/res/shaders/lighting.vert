@@ -1,9 +1,34 @@
 
+#if defined(INSTANCED)
+// Gets the inverse transpose of the world view matrix of the instance, as the cofactors of its
+// upper 3x3, which only differ from it by the determinant that normalizing the normals removes.
+mat3 getInverseTransposeWorldViewMatrix()
+{
+    mat4 worldViewMatrix = u_viewMatrix * a_instanceMatrix;
+    vec3 x = worldViewMatrix[0].xyz;
+    vec3 y = worldViewMatrix[1].xyz;
+    vec3 z = worldViewMatrix[2].xyz;
+    return mat3(cross(y, z), cross(z, x), cross(x, y)) * sign(dot(x, cross(y, z)));
+}
+#endif
+
+#if defined(SPECULAR) || (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0) || defined(CLUSTERED_LIGHTING) || defined(SHADOW)
+// Gets the position of the vertex in view space.
+vec4 getPositionWorldViewSpace(vec4 position)
+{
+    #if defined(INSTANCED)
+    return u_viewMatrix * (a_instanceMatrix * position);
+    #else
+    return u_worldViewMatrix * position;
+    #endif
+}
+#endif
+
 #if defined(BUMPED)
 void applyLight(vec4 position, mat3 tangentSpaceTransformMatrix)
 {
     #if (defined(SPECULAR) || (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0))
-    vec4 positionWorldViewSpace = u_worldViewMatrix * position;
+    vec4 positionWorldViewSpace = getPositionWorldViewSpace(position);
     #endif
     
     #if (DIRECTIONAL_LIGHT_COUNT > 0)
@@ -39,8 +64,12 @@ void applyLight(vec4 position, mat3 tangentSpaceTransformMatrix)
 #else
 void applyLight(vec4 position)
 {
-    #if defined(SPECULAR) || (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0)
-	vec4 positionWorldViewSpace = u_worldViewMatrix * position;
+    #if defined(SPECULAR) || (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0) || defined(CLUSTERED_LIGHTING) || defined(SHADOW)
+	vec4 positionWorldViewSpace = getPositionWorldViewSpace(position);
+    #endif
+
+    #if defined(CLUSTERED_LIGHTING) || defined(SHADOW)
+    v_positionWorldViewSpace = positionWorldViewSpace.xyz;
     #endif
 
     #if (POINT_LIGHT_COUNT > 0)
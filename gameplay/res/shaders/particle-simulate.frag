@@ -0,0 +1,9 @@
+#ifdef OPENGL_ES
+precision mediump float;
+#endif
+
+// Particles are simulated with rasterization discarded, so nothing is ever shaded.
+void main()
+{
+    gl_FragColor = vec4(0.0);
+}
@@ -0,0 +1,164 @@
+///////////////////////////////////////////////////////////
+// Attributes
+attribute vec4 a_position;                      // xyz: position, w: energy left (ms)
+attribute vec4 a_velocity;                      // xyz: velocity, w: energy at emission (ms)
+attribute vec4 a_acceleration;                  // xyz: acceleration, w: angle
+attribute vec4 a_rotation;                      // xyz: rotation axis, w: rotation speed
+attribute vec4 a_colorStart;
+attribute vec4 a_colorEnd;
+attribute vec4 a_size;                          // x: start size, y: end size, z: angular speed, w: first sprite frame
+attribute float a_index;                        // The slot of the particle
+
+///////////////////////////////////////////////////////////
+// Uniforms
+uniform vec2 u_elapsedTime;                     // The time since the last update, in milliseconds and in seconds
+uniform vec3 u_emission;                        // The first slot emitted into, the number of slots emitted into and the number of slots
+uniform float u_seed;
+uniform mat4 u_emitterRotation;
+uniform vec3 u_emitterTranslation;
+uniform vec3 u_orbit;                           // Whether positions, velocities and accelerations orbit the emitter
+uniform float u_ellipsoid;
+uniform vec3 u_positionBase;
+uniform vec3 u_positionVar;
+uniform vec3 u_velocityBase;
+uniform vec3 u_velocityVar;
+uniform vec3 u_accelerationBase;
+uniform vec3 u_accelerationVar;
+uniform vec3 u_rotationAxisBase;
+uniform vec3 u_rotationAxisVar;
+uniform vec2 u_rotationSpeed;
+uniform vec2 u_rotationPerParticleSpeed;
+uniform vec2 u_energy;
+uniform vec2 u_sizeStart;
+uniform vec2 u_sizeEnd;
+uniform vec4 u_colorStartBase;
+uniform vec4 u_colorStartVar;
+uniform vec4 u_colorEndBase;
+uniform vec4 u_colorEndVar;
+uniform float u_frameRandomOffset;
+
+///////////////////////////////////////////////////////////
+// Varyings
+varying vec4 v_position;
+varying vec4 v_velocity;
+varying vec4 v_acceleration;
+varying vec4 v_rotation;
+varying vec4 v_colorStart;
+varying vec4 v_colorEnd;
+varying vec4 v_size;
+
+float _randomCount = 0.0;
+
+// Returns a random number between 0 and 1, different for each slot, update and call.
+float random()
+{
+    _randomCount += 1.0;
+    return fract(sin(dot(vec2(a_index * 0.0137 + u_seed, _randomCount), vec2(12.9898, 78.233))) * 43758.5453);
+}
+
+// Returns a random number between -1 and 1.
+float randomSigned()
+{
+    return random() * 2.0 - 1.0;
+}
+
+vec3 generateVector(vec3 base, vec3 variance)
+{
+    return base + variance * vec3(randomSigned(), randomSigned(), randomSigned());
+}
+
+vec3 orbit(vec3 vector, float enabled)
+{
+    return enabled > 0.5 ? (u_emitterRotation * vec4(vector, 0.0)).xyz : vector;
+}
+
+void emit()
+{
+    vec3 position;
+    if (u_ellipsoid > 0.5)
+    {
+        // A point uniformly distributed in the unit sphere, scaled by the variance.
+        float z = randomSigned();
+        float phi = random() * 6.2831853;
+        float radius = pow(random(), 1.0 / 3.0);
+        float r = sqrt(1.0 - z * z) * radius;
+        position = u_positionBase + u_positionVar * vec3(r * cos(phi), r * sin(phi), z * radius);
+    }
+    else
+    {
+        position = generateVector(u_positionBase, u_positionVar);
+    }
+    vec3 velocity = generateVector(u_velocityBase, u_velocityVar);
+    vec3 acceleration = generateVector(u_accelerationBase, u_accelerationVar);
+    vec3 rotationAxis = generateVector(u_rotationAxisBase, u_rotationAxisVar);
+    float rotationSpeed = mix(u_rotationSpeed.x, u_rotationSpeed.y, random());
+
+    // The rotation axis always orbits the emitter.
+    position = orbit(position, u_orbit.x) + u_emitterTranslation;
+    velocity = orbit(velocity, u_orbit.y);
+    acceleration = orbit(acceleration, u_orbit.z);
+    rotationAxis = orbit(rotationAxis, 1.0);
+
+    float energy = mix(u_energy.x, u_energy.y, random());
+    float angularSpeed = mix(u_rotationPerParticleSpeed.x, u_rotationPerParticleSpeed.y, random());
+
+    v_position = vec4(position, energy);
+    v_velocity = vec4(velocity, energy);
+    v_acceleration = vec4(acceleration, angularSpeed * random());
+    v_rotation = vec4(rotationAxis, rotationSpeed);
+    v_colorStart = u_colorStartBase + u_colorStartVar * vec4(randomSigned(), randomSigned(), randomSigned(), randomSigned());
+    v_colorEnd = u_colorEndBase + u_colorEndVar * vec4(randomSigned(), randomSigned(), randomSigned(), randomSigned());
+    v_size = vec4(mix(u_sizeStart.x, u_sizeStart.y, random()), mix(u_sizeEnd.x, u_sizeEnd.y, random()), angularSpeed, floor(random() * u_frameRandomOffset));
+}
+
+// Rotates a vector about a unit axis.
+vec3 rotate(vec3 vector, vec3 axis, float angle)
+{
+    float c = cos(angle);
+    return vector * c + cross(axis, vector) * sin(angle) + axis * dot(axis, vector) * (1.0 - c);
+}
+
+void simulate()
+{
+    float energy = a_position.w - u_elapsedTime.x;
+    vec3 position = a_position.xyz;
+    vec3 velocity = a_velocity.xyz;
+    vec3 acceleration = a_acceleration.xyz;
+    float angle = a_acceleration.w;
+    if (energy > 0.0)
+    {
+        if (a_rotation.w != 0.0 && dot(a_rotation.xyz, a_rotation.xyz) > 0.0)
+        {
+            vec3 axis = normalize(a_rotation.xyz);
+            float rotationAngle = a_rotation.w * u_elapsedTime.y;
+            velocity = rotate(velocity, axis, rotationAngle);
+            acceleration = rotate(acceleration, axis, rotationAngle);
+        }
+        velocity += acceleration * u_elapsedTime.y;
+        position += velocity * u_elapsedTime.y;
+        angle += a_size.z * u_elapsedTime.y;
+    }
+    else
+    {
+        energy = 0.0;
+    }
+
+    v_position = vec4(position, energy);
+    v_velocity = vec4(velocity, a_velocity.w);
+    v_acceleration = vec4(acceleration, angle);
+    v_rotation = a_rotation;
+    v_colorStart = a_colorStart;
+    v_colorEnd = a_colorEnd;
+    v_size = a_size;
+}
+
+void main()
+{
+    // The slots emitted into this update are respawned, and all others are aged.
+    if (mod(a_index - u_emission.x + u_emission.z, u_emission.z) < u_emission.y)
+        emit();
+    else
+        simulate();
+
+    gl_Position = vec4(0.0, 0.0, 0.0, 1.0);
+}
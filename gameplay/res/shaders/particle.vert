@@ -0,0 +1,78 @@
+///////////////////////////////////////////////////////////
+// Attributes
+attribute vec2 a_corner;                        // The corner of the quad, from -0.5 to 0.5
+#if defined(CPU_SIMULATION)
+attribute vec4 a_position;                      // xyz: position, w: size
+attribute vec4 a_color;
+attribute vec2 a_frame;                         // x: angle, y: sprite frame
+#else
+attribute vec4 a_position;                      // xyz: position, w: energy left (ms)
+attribute vec4 a_velocity;                      // w: energy at emission (ms)
+attribute vec4 a_acceleration;                  // w: angle
+attribute vec4 a_colorStart;
+attribute vec4 a_colorEnd;
+attribute vec4 a_size;                          // x: start size, y: end size, w: first sprite frame
+#endif
+
+///////////////////////////////////////////////////////////
+// Uniforms
+uniform mat4 u_viewProjectionMatrix;
+uniform vec3 u_cameraRight;
+uniform vec3 u_cameraUp;
+uniform vec4 u_spriteAnimation;                 // The frame count, 0 if still, 1 if animated once or 2 if looped, the frame duration (s) and the part of a lifetime per frame
+uniform vec4 u_spriteTexCoords[SPRITE_FRAME_COUNT_MAX];
+
+///////////////////////////////////////////////////////////
+// Varyings
+varying vec2 v_texCoord;
+varying vec4 v_color;
+
+void main()
+{
+#if defined(CPU_SIMULATION)
+
+    // Particles simulated on the CPU are uploaded with their current size, color, angle and frame.
+    float size = a_position.w;
+    float angle = a_frame.x;
+    float frame = a_frame.y;
+    v_color = a_color;
+
+#else
+
+    // Dead particles are moved out of the clip volume.
+    if (a_position.w <= 0.0)
+    {
+        gl_Position = vec4(2.0, 2.0, 2.0, 1.0);
+        v_texCoord = vec2(0.0);
+        v_color = vec4(0.0);
+        return;
+    }
+
+    float percent = 1.0 - a_position.w / a_velocity.w;
+    float size = mix(a_size.x, a_size.y, percent);
+    float angle = a_acceleration.w;
+    float frame = a_size.w;
+    if (u_spriteAnimation.y > 1.5)
+    {
+        float age = (a_velocity.w - a_position.w) * 0.001;
+        frame = mod(frame + floor(age / u_spriteAnimation.z), u_spriteAnimation.x);
+    }
+    else if (u_spriteAnimation.y > 0.5)
+    {
+        // The last frame finishes just as the particle dies.
+        frame = max(frame, floor(percent / u_spriteAnimation.w));
+    }
+    v_color = mix(a_colorStart, a_colorEnd, percent);
+
+#endif
+
+    // Expand the quad facing the camera, rotated about its center.
+    float c = cos(angle);
+    float s = sin(angle);
+    vec2 corner = vec2(a_corner.x * c - a_corner.y * s, a_corner.x * s + a_corner.y * c) * size;
+    vec3 position = a_position.xyz + u_cameraRight * corner.x + u_cameraUp * corner.y;
+    gl_Position = u_viewProjectionMatrix * vec4(position, 1.0);
+
+    vec4 texCoords = u_spriteTexCoords[int(min(frame, u_spriteAnimation.x - 1.0))];
+    v_texCoord = mix(texCoords.xy, texCoords.zw, a_corner + 0.5);
+}
@@ -0,0 +1,9 @@
+#ifdef OPENGL_ES
+precision mediump float;
+#endif
+
+void main()
+{
+    // Only the depth of the caster is written to the shadow map.
+    gl_FragColor = vec4(1.0);
+}
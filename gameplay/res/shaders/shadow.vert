@@ -0,0 +1,34 @@
+///////////////////////////////////////////////////////////
+// Attributes
+attribute vec4 a_position;
+
+#if defined(SKINNING)
+attribute vec4 a_blendWeights;
+attribute vec4 a_blendIndices;
+#endif
+
+///////////////////////////////////////////////////////////
+// Uniforms
+uniform mat4 u_worldViewProjectionMatrix;
+
+#if defined(SKINNING)
+#if defined(SKINNING_TEXTURE)
+uniform vec4 u_jointPaletteOffset;
+uniform sampler2D u_jointTexture;
+#elif defined(SKINNING_DUAL_QUATERNION)
+uniform vec4 u_dualQuaternionPalette[SKINNING_JOINT_COUNT * 2];
+#else
+uniform vec4 u_matrixPalette[SKINNING_JOINT_COUNT * 3];
+#endif
+#endif
+
+#if defined(SKINNING)
+#include "skinning.vert"
+#else
+#include "skinning-none.vert" 
+#endif
+
+void main()
+{
+    gl_Position = u_worldViewProjectionMatrix * getPosition();
+}
@@ -1,66 +1,138 @@
+#if defined(SKINNING_ANIMATION_TEXTURE)
 
-vec4 _skinnedPosition;
+// Fetches a row of the palette of the clip baked into the animation texture, blending the two frames nearest to the time of the instance.
+// u_animationParameters holds the number of intervals between frames, the frame rate, the time and the reciprocal of the texture width.
+// a_instanceData.x offsets the time of each instance, so that the models of a crowd do not move in step.
+vec4 getPaletteRow(int index)
+{
+    float frame = mod((u_animationParameters.z + a_instanceData.x) * u_animationParameters.y, u_animationParameters.x);
+    float frame0 = floor(frame);
+    float rowHeight = 1.0 / (u_animationParameters.x + 1.0);
+    vec2 texCoord = vec2((float(index) + 0.5) * u_animationParameters.w, (frame0 + 0.5) * rowHeight);
+    vec4 row0 = texture2DLod(u_animationTexture, texCoord, 0.0);
+    vec4 row1 = texture2DLod(u_animationTexture, vec2(texCoord.x, texCoord.y + rowHeight), 0.0);
+    return mix(row0, row1, frame - frame0);
+}
+
+#elif defined(SKINNING_TEXTURE)
+
+// Fetches a row of the palette of the skin from the joint texture.
+// u_jointPaletteOffset holds the first texel of the palette, the width of the texture and the reciprocals of its size.
+vec4 getPaletteRow(int index)
+{
+    float texel = u_jointPaletteOffset.x + float(index);
+    float row = floor(texel * u_jointPaletteOffset.z);
+    vec2 texCoord = vec2(texel - row * u_jointPaletteOffset.y + 0.5, row + 0.5) * u_jointPaletteOffset.zw;
+    return texture2DLod(u_jointTexture, texCoord, 0.0);
+}
 
-void skinPosition(float blendWeight, int matrixIndex)
+#elif defined(SKINNING_DUAL_QUATERNION)
+
+vec4 getPaletteRow(int index)
+{
+    return u_dualQuaternionPalette[index];
+}
+
+#else
+
+vec4 getPaletteRow(int index)
 {
-    vec4 tmp;
-    tmp.x = dot(a_position, u_matrixPalette[matrixIndex]);
-    tmp.y = dot(a_position, u_matrixPalette[matrixIndex + 1]);
-    tmp.z = dot(a_position, u_matrixPalette[matrixIndex + 2]);
-    tmp.w = a_position.w;
-    _skinnedPosition += blendWeight * tmp;
+    return u_matrixPalette[index];
+}
+
+#endif
+
+// Animation textures hold matrix palettes, so they are always skinned linearly.
+#if defined(SKINNING_DUAL_QUATERNION) && !defined(SKINNING_ANIMATION_TEXTURE)
+
+vec4 _skinnedReal;
+vec4 _skinnedDual;
+
+void skinDualQuaternion(float blendWeight, int jointIndex)
+{
+    vec4 real = getPaletteRow(jointIndex);
+    vec4 dual = getPaletteRow(jointIndex + 1);
+
+    // q and -q are the same rotation, so each joint is blended in the hemisphere of the first.
+    if (dot(real, _skinnedReal) < 0.0)
+        blendWeight = -blendWeight;
+    _skinnedReal += blendWeight * real;
+    _skinnedDual += blendWeight * dual;
+}
+
+vec3 rotateVector(vec3 vector)
+{
+    return vector + 2.0 * cross(_skinnedReal.xyz, cross(_skinnedReal.xyz, vector) + _skinnedReal.w * vector);
 }
 
 vec4 getPosition()
 {
-    _skinnedPosition = vec4(0.0);
-    float blendWeight = a_blendWeights[0];
-    int matrixIndex = int (a_blendIndices[0]) * 3;
-    skinPosition(blendWeight, matrixIndex);
-    blendWeight = a_blendWeights[1];
-    matrixIndex = int(a_blendIndices[1]) * 3;
-    skinPosition(blendWeight, matrixIndex);
-    blendWeight = a_blendWeights[2];
-    matrixIndex = int(a_blendIndices[2]) * 3;
-    skinPosition(blendWeight, matrixIndex);
-    blendWeight = a_blendWeights[3];
-    matrixIndex = int(a_blendIndices[3]) * 3;
-    skinPosition(blendWeight, matrixIndex);
-    return _skinnedPosition;    
+    // Blend the dual quaternions of the four joints influencing the vertex.
+    _skinnedReal = a_blendWeights[0] * getPaletteRow(int(a_blendIndices[0]) * 2);
+    _skinnedDual = a_blendWeights[0] * getPaletteRow(int(a_blendIndices[0]) * 2 + 1);
+    skinDualQuaternion(a_blendWeights[1], int(a_blendIndices[1]) * 2);
+    skinDualQuaternion(a_blendWeights[2], int(a_blendIndices[2]) * 2);
+    skinDualQuaternion(a_blendWeights[3], int(a_blendIndices[3]) * 2);
+
+    float scale = 1.0 / length(_skinnedReal);
+    _skinnedReal *= scale;
+    _skinnedDual *= scale;
+
+    vec3 translation = 2.0 * (_skinnedReal.w * _skinnedDual.xyz - _skinnedDual.w * _skinnedReal.xyz + cross(_skinnedReal.xyz, _skinnedDual.xyz));
+    return vec4(rotateVector(a_position.xyz) + translation * a_position.w, a_position.w);
 }
 
 #if defined(LIGHTING)
 
-vec3 _skinnedNormal;
+vec3 getTangentSpaceVector(vec3 vector)
+{
+    return rotateVector(vector);
+}
+
+#endif
+
+#else
+
+// The rows of the blended matrix of the four joints influencing the vertex.
+vec4 _skinnedRow0;
+vec4 _skinnedRow1;
+vec4 _skinnedRow2;
+
+void skinMatrix(float blendWeight, int matrixIndex)
+{
+    _skinnedRow0 += blendWeight * getPaletteRow(matrixIndex);
+    _skinnedRow1 += blendWeight * getPaletteRow(matrixIndex + 1);
+    _skinnedRow2 += blendWeight * getPaletteRow(matrixIndex + 2);
+}
 
-void skinTangentSpaceVector(vec3 vector, float blendWeight, int matrixIndex)
+vec4 getPosition()
 {
-    vec3 tmp;
-    tmp.x = dot(vector, u_matrixPalette[matrixIndex].xyz);
-    tmp.y = dot(vector, u_matrixPalette[matrixIndex + 1].xyz);
-    tmp.z = dot(vector, u_matrixPalette[matrixIndex + 2].xyz);
-    _skinnedNormal += blendWeight * tmp;
+    // Blend the matrices once, so that the normal and tangent space vectors reuse them.
+    _skinnedRow0 = vec4(0.0);
+    _skinnedRow1 = vec4(0.0);
+    _skinnedRow2 = vec4(0.0);
+    skinMatrix(a_blendWeights[0], int(a_blendIndices[0]) * 3);
+    skinMatrix(a_blendWeights[1], int(a_blendIndices[1]) * 3);
+    skinMatrix(a_blendWeights[2], int(a_blendIndices[2]) * 3);
+    skinMatrix(a_blendWeights[3], int(a_blendIndices[3]) * 3);
+
+    float blendWeight = dot(a_blendWeights, vec4(1.0));
+    return vec4(dot(a_position, _skinnedRow0), dot(a_position, _skinnedRow1), dot(a_position, _skinnedRow2), blendWeight * a_position.w);
 }
 
+#if defined(LIGHTING)
+
 vec3 getTangentSpaceVector(vec3 vector)
 {
-    _skinnedNormal = vec3(0.0);
-    // Transform normal to view space using matrix palette with four matrices used to transform a vertex.
-    float blendWeight = a_blendWeights[0];
-    int matrixIndex = int (a_blendIndices[0]) * 3;
-    skinTangentSpaceVector(vector, blendWeight, matrixIndex);
-    blendWeight = a_blendWeights[1];
-    matrixIndex = int(a_blendIndices[1]) * 3;
-    skinTangentSpaceVector(vector, blendWeight, matrixIndex);
-    blendWeight = a_blendWeights[2];
-    matrixIndex = int(a_blendIndices[2]) * 3;
-    skinTangentSpaceVector(vector, blendWeight, matrixIndex);
-    blendWeight = a_blendWeights[3];
-    matrixIndex = int(a_blendIndices[3]) * 3;
-    skinTangentSpaceVector(vector, blendWeight, matrixIndex);
-    return _skinnedNormal;
+    return vec3(dot(vector, _skinnedRow0.xyz), dot(vector, _skinnedRow1.xyz), dot(vector, _skinnedRow2.xyz));
 }
 
+#endif
+
+#endif
+
+#if defined(LIGHTING)
+
 vec3 getNormal()
 {
     return getTangentSpaceVector(a_normal);
@@ -81,4 +153,3 @@ vec3 getBinormal()
 #endif
 
 #endif
-
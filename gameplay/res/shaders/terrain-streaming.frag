@@ -0,0 +1,44 @@
+#ifdef OPENGL_ES
+#ifdef GL_FRAGMENT_PRECISION_HIGH
+precision highp float;
+#else
+precision mediump float;
+#endif
+#endif
+
+///////////////////////////////////////////////////////////
+// Uniforms
+#include "view-uniforms.glsl"
+
+uniform vec3 u_ambientColor;
+
+#if defined(DIFFUSE_TEXTURE)
+uniform sampler2D u_diffuseTexture;
+uniform vec2 u_textureRepeat;
+#endif
+
+#if defined(DIRECTIONAL_LIGHT)
+uniform vec3 u_directionalLightDirection;
+uniform vec3 u_directionalLightColor;
+#endif
+
+///////////////////////////////////////////////////////////
+// Varyings
+varying vec3 v_normalVector;
+varying vec2 v_texCoord0;
+
+void main()
+{
+#if defined(DIFFUSE_TEXTURE)
+    vec3 baseColor = texture2D(u_diffuseTexture, v_texCoord0 * u_textureRepeat).rgb;
+#else
+    vec3 baseColor = vec3(1.0, 1.0, 1.0);
+#endif
+
+    vec3 light = u_ambientColor;
+#if defined(DIRECTIONAL_LIGHT)
+    light += u_directionalLightColor * max(dot(normalize(v_normalVector), -normalize(u_directionalLightDirection)), 0.0);
+#endif
+
+    gl_FragColor = vec4(baseColor * light, 1.0);
+}
@@ -0,0 +1,54 @@
+///////////////////////////////////////////////////////////
+// Attributes
+attribute vec2 a_position;
+
+///////////////////////////////////////////////////////////
+// Uniforms
+uniform mat4 u_worldViewProjectionMatrix;
+uniform mat4 u_normalMatrix;
+uniform sampler2D u_heightMap;
+uniform vec4 u_tileOffset;
+uniform vec2 u_morphRange;
+uniform vec3 u_cameraPosition;
+uniform vec3 u_terrainSize;
+uniform float u_gridSize;
+
+///////////////////////////////////////////////////////////
+// Varyings
+varying vec3 v_normalVector;
+varying vec2 v_texCoord0;
+
+///////////////////////////////////////////////////////////
+// Reads the height of the tile at a position of its grid.
+float sampleHeight(vec2 grid)
+{
+    vec2 uv = (grid * u_gridSize + 0.5) / (u_gridSize + 1.0);
+    return texture2DLod(u_heightMap, uv, 0.0).r * u_terrainSize.y;
+}
+
+void main()
+{
+    // Morph the odd vertices of the grid onto the grid of the parent tile as they near the end of the range.
+    vec2 grid = a_position;
+    vec3 position = vec3(u_tileOffset.x + grid.x * u_tileOffset.z, 0.0, u_tileOffset.y + grid.y * u_tileOffset.w);
+    position.y = sampleHeight(grid);
+    float morph = clamp((distance(position, u_cameraPosition) - u_morphRange.x) / (u_morphRange.y - u_morphRange.x), 0.0, 1.0);
+    vec2 index = floor(grid * u_gridSize + 0.5);
+    vec2 odd = (index - 2.0 * floor(index * 0.5)) / u_gridSize;
+    grid -= odd * morph;
+
+    position.xz = u_tileOffset.xy + grid * u_tileOffset.zw;
+    position.y = sampleHeight(grid);
+    gl_Position = u_worldViewProjectionMatrix * vec4(position, 1.0);
+
+    // The normal from central differences of the heights.
+    vec2 texel = vec2(1.0 / u_gridSize, 0.0);
+    float left = sampleHeight(grid - texel.xy);
+    float right = sampleHeight(grid + texel.xy);
+    float back = sampleHeight(grid - texel.yx);
+    float front = sampleHeight(grid + texel.yx);
+    vec3 normal = normalize(vec3((left - right) / (2.0 * texel.x * u_tileOffset.z), 1.0, (back - front) / (2.0 * texel.x * u_tileOffset.w)));
+    v_normalVector = normalize((u_normalMatrix * vec4(normal, 0.0)).xyz);
+
+    v_texCoord0 = position.xz / u_terrainSize.xz + 0.5;
+}
@@ -1,3 +1,7 @@
+#if defined(SPLATTING)
+#extension GL_EXT_texture_array : enable
+#endif
+
 #ifdef OPENGL_ES
 #ifdef GL_FRAGMENT_PRECISION_HIGH
 precision highp float;
@@ -21,7 +25,9 @@ precision mediump float;
 
 ///////////////////////////////////////////////////////////
 // Uniforms
-uniform vec3 u_ambientColor; 
+#include "view-uniforms.glsl"
+
+uniform vec3 u_ambientColor;
 
 #if defined(LIGHTING)
 
@@ -60,6 +66,13 @@ uniform float u_column;
 uniform sampler2D u_surfaceLayerMaps[SAMPLER_COUNT];
 #endif
 
+#if defined(SPLATTING)
+uniform sampler2DArray u_splatLayerArray;
+uniform sampler2D u_splatMap;
+uniform vec4 u_splatLayers;
+uniform vec2 u_splatRepeat[4];
+#endif
+
 ///////////////////////////////////////////////////////////
 // Variables
 vec4 _baseColor;
@@ -89,6 +102,10 @@ varying vec3 v_vertexToSpotLightDirection[SPOT_LIGHT_COUNT];
 
 varying vec2 v_texCoord0;
 
+#if defined(SPLATTING)
+varying vec2 v_texCoordSplat;
+#endif
+
 #if (LAYER_COUNT > 0)
 varying vec2 v_texCoordLayer0;
 #endif
@@ -113,7 +130,15 @@ void blendLayer(sampler2D textureMap, vec2 texCoord, float alphaBlend)
 
 void main()
 {
-    #if (LAYER_COUNT > 0)
+    #if defined(SPLATTING)
+    // Blend the four layers of this patch from the texture array by the weights in its splat map
+    vec4 weights = texture2D(u_splatMap, v_texCoordSplat);
+    _baseColor.rgb = texture2DArray(u_splatLayerArray, vec3(v_texCoord0 * u_splatRepeat[0], u_splatLayers.x)).rgb * weights.r +
+                     texture2DArray(u_splatLayerArray, vec3(v_texCoord0 * u_splatRepeat[1], u_splatLayers.y)).rgb * weights.g +
+                     texture2DArray(u_splatLayerArray, vec3(v_texCoord0 * u_splatRepeat[2], u_splatLayers.z)).rgb * weights.b +
+                     texture2DArray(u_splatLayerArray, vec3(v_texCoord0 * u_splatRepeat[3], u_splatLayers.w)).rgb * weights.a;
+    _baseColor.a = 1.0;
+    #elif (LAYER_COUNT > 0)
     // Sample base texture
 	_baseColor.rgb = texture2D(u_surfaceLayerMaps[TEXTURE_INDEX_0], mod(v_texCoordLayer0, vec2(1,1))).rgb;
     _baseColor.a = 1.0;
@@ -72,6 +72,10 @@ varying vec3 v_vertexToSpotLightDirection[SPOT_LIGHT_COUNT];
 #endif
 
 varying vec2 v_texCoord0;
+#if defined(SPLATTING)
+uniform vec4 u_splatTransform;
+varying vec2 v_texCoordSplat;
+#endif
 #if LAYER_COUNT > 0
 varying vec2 v_texCoordLayer0;
 #endif
@@ -101,6 +105,11 @@ void main()
     // Pass base texture coord
     v_texCoord0 = a_texCoord0;
 
+    #if defined(SPLATTING)
+    // Map the terrain texture coord onto the splat map of the patch
+    v_texCoordSplat = a_texCoord0 * u_splatTransform.xy + u_splatTransform.zw;
+    #endif
+
     // Pass repeated texture coordinates for each layer
     #if LAYER_COUNT > 0
     v_texCoordLayer0 = a_texCoord0 * TEXTURE_REPEAT_0;
@@ -15,12 +15,14 @@ precision mediump float;
 #ifndef POINT_LIGHT_COUNT
 #define POINT_LIGHT_COUNT 0
 #endif
-#if (DIRECTIONAL_LIGHT_COUNT > 0) || (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0)
+#if (DIRECTIONAL_LIGHT_COUNT > 0) || (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0) || defined(CLUSTERED_LIGHTING)
 #define LIGHTING
 #endif
 
 ///////////////////////////////////////////////////////////
 // Uniforms
+#include "view-uniforms.glsl"
+
 uniform vec3 u_ambientColor;
 
 uniform sampler2D u_diffuseTexture;
@@ -58,6 +60,27 @@ uniform vec3 u_spotLightDirection[SPOT_LIGHT_COUNT];
 #endif
 #endif
 
+#if defined(CLUSTERED_LIGHTING)
+uniform sampler2D u_clusterLightTexture;
+uniform sampler2D u_clusterTexture;
+uniform sampler2D u_clusterIndexTexture;
+uniform vec4 u_clusterGrid;
+uniform vec4 u_clusterDepth;
+uniform vec4 u_clusterScreen;
+uniform vec4 u_clusterTextureScale;
+#endif
+
+#if defined(SHADOW)
+#ifndef SHADOW_CASCADE_COUNT
+#define SHADOW_CASCADE_COUNT 1
+#endif
+uniform sampler2D u_shadowMap;
+uniform sampler2D u_shadowDynamicMap;
+uniform mat4 u_shadowMatrix[SHADOW_CASCADE_COUNT];
+uniform vec4 u_shadowCascadeSplits;
+uniform vec4 u_shadowParameters;
+#endif
+
 #if defined(SPECULAR)
 uniform float u_specularExponent;
 #endif
@@ -109,6 +132,10 @@ varying vec3 v_spotLightDirection[SPOT_LIGHT_COUNT];
 varying vec3 v_cameraDirection; 
 #endif
 
+#if defined(CLUSTERED_LIGHTING) || defined(SHADOW)
+varying vec3 v_positionWorldViewSpace;
+#endif
+
 #include "lighting.frag"
 
 #endif
@@ -117,12 +144,21 @@ varying vec3 v_cameraDirection;
 varying float v_clipDistance;
 #endif
 
+#if defined(INSTANCE_FADE)
+varying float v_instanceFade;
+#endif
 
 void main()
 {
     #if defined(CLIP_PLANE)
     if(v_clipDistance < 0.0) discard;
     #endif
+
+    #if defined(INSTANCE_FADE)
+    // Fading instances are dithered out with interleaved gradient noise, which keeps them opaque
+    if (v_instanceFade < fract(52.9829189 * fract(dot(gl_FragCoord.xy, vec2(0.06711056, 0.00583715)))))
+        discard;
+    #endif
  
     _baseColor = texture2D(u_diffuseTexture, v_texCoord);
  
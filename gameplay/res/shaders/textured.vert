@@ -7,7 +7,7 @@
 #ifndef POINT_LIGHT_COUNT
 #define POINT_LIGHT_COUNT 0
 #endif
-#if (DIRECTIONAL_LIGHT_COUNT > 0) || (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0)
+#if (DIRECTIONAL_LIGHT_COUNT > 0) || (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0) || defined(CLUSTERED_LIGHTING)
 #define LIGHTING
 #endif
 
@@ -15,9 +15,20 @@
 // Atributes
 attribute vec4 a_position;
 
+#if defined(INSTANCED)
+attribute mat4 a_instanceMatrix;
+#endif
+
 #if defined(SKINNING)
 attribute vec4 a_blendWeights;
 attribute vec4 a_blendIndices;
+#if defined(SKINNING_ANIMATION_TEXTURE)
+attribute vec4 a_instanceData;
+#endif
+#endif
+
+#if defined(INSTANCE_FADE) && !(defined(SKINNING) && defined(SKINNING_ANIMATION_TEXTURE))
+attribute vec4 a_instanceData;
 #endif
 
 attribute vec2 a_texCoord;
@@ -38,17 +49,42 @@ attribute vec3 a_binormal;
 
 ///////////////////////////////////////////////////////////
 // Uniforms
+#include "view-uniforms.glsl"
+
+#if defined(INSTANCED)
+#if !defined(UNIFORM_BUFFERS)
+uniform mat4 u_viewProjectionMatrix;
+#endif
+#else
 uniform mat4 u_worldViewProjectionMatrix;
+#endif
 #if defined(SKINNING)
+#if defined(SKINNING_ANIMATION_TEXTURE)
+uniform vec4 u_animationParameters;
+uniform sampler2D u_animationTexture;
+#elif defined(SKINNING_TEXTURE)
+uniform vec4 u_jointPaletteOffset;
+uniform sampler2D u_jointTexture;
+#elif defined(SKINNING_DUAL_QUATERNION)
+uniform vec4 u_dualQuaternionPalette[SKINNING_JOINT_COUNT * 2];
+#else
 uniform vec4 u_matrixPalette[SKINNING_JOINT_COUNT * 3];
 #endif
+#endif
 
 #if defined(LIGHTING)
+#if defined(INSTANCED)
+// Instances build their view space transforms from their world matrix and the view matrix.
+#if !defined(UNIFORM_BUFFERS)
+uniform mat4 u_viewMatrix;
+#endif
+#else
 uniform mat4 u_inverseTransposeWorldViewMatrix;
 
-#if defined(SPECULAR) || (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0)
+#if defined(SPECULAR) || (POINT_LIGHT_COUNT > 0) || (SPOT_LIGHT_COUNT > 0) || defined(CLUSTERED_LIGHTING) || defined(SHADOW)
 uniform mat4 u_worldViewMatrix;
 #endif
+#endif
 
 #if defined(BUMPED) && (DIRECTIONAL_LIGHT_COUNT > 0)
 uniform vec3 u_directionalLightDirection[DIRECTIONAL_LIGHT_COUNT];
@@ -80,7 +116,9 @@ uniform vec2 u_textureOffset;
 #endif
 
 #if defined(CLIP_PLANE)
+#if !defined(INSTANCED)
 uniform mat4 u_worldMatrix;
+#endif
 uniform vec4 u_clipPlane;
 #endif
 
@@ -117,6 +155,10 @@ varying vec3 v_spotLightDirection[SPOT_LIGHT_COUNT];
 varying vec3 v_cameraDirection;
 #endif
 
+#if defined(CLUSTERED_LIGHTING) || defined(SHADOW)
+varying vec3 v_positionWorldViewSpace;
+#endif
+
 #include "lighting.vert"
 
 #endif
@@ -131,15 +173,27 @@ varying vec3 v_cameraDirection;
 varying float v_clipDistance;
 #endif
 
+#if defined(INSTANCE_FADE)
+varying float v_instanceFade;
+#endif
+
 void main()
 {
     vec4 position = getPosition();
+    #if defined(INSTANCED)
+    gl_Position = u_viewProjectionMatrix * (a_instanceMatrix * position);
+    #else
     gl_Position = u_worldViewProjectionMatrix * position;
+    #endif
 
     #if defined(LIGHTING)
     vec3 normal = getNormal();
     // Transform the normal, tangent and binormals to view space.
+    #if defined(INSTANCED)
+    mat3 inverseTransposeWorldViewMatrix = getInverseTransposeWorldViewMatrix();
+    #else
     mat3 inverseTransposeWorldViewMatrix = mat3(u_inverseTransposeWorldViewMatrix[0].xyz, u_inverseTransposeWorldViewMatrix[1].xyz, u_inverseTransposeWorldViewMatrix[2].xyz);
+    #endif
     vec3 normalVector = normalize(inverseTransposeWorldViewMatrix * normal);
     
     #if defined(BUMPED)
@@ -175,6 +229,14 @@ void main()
     #endif
     
     #if defined(CLIP_PLANE)
+    #if defined(INSTANCED)
+    v_clipDistance = dot(a_instanceMatrix * position, u_clipPlane);
+    #else
     v_clipDistance = dot(u_worldMatrix * position, u_clipPlane);
     #endif
+    #endif
+
+    #if defined(INSTANCE_FADE)
+    v_instanceFade = a_instanceData.x;
+    #endif
 }
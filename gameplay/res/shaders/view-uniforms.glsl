@@ -0,0 +1,16 @@
+///////////////////////////////////////////////////////////
+// Per-view uniforms shared by every effect. With UNIFORM_BUFFERS they are
+// read from the ViewUniforms block that the engine updates once per view,
+// otherwise shaders declare the ones they use and materials auto bind them.
+// The ambient color of materials stays a uniform of its own, since materials
+// may set it to a constant rather than bind it to SCENE_AMBIENT_COLOR.
+#if defined(UNIFORM_BUFFERS)
+layout(std140) uniform ViewUniforms
+{
+    mat4 u_viewMatrix;
+    mat4 u_projectionMatrix;
+    mat4 u_viewProjectionMatrix;
+    vec3 u_cameraWorldPosition;
+    vec3 u_sceneAmbientColor;
+};
+#endif
@@ -1,18 +1,21 @@
 #include "Base.h"
 #include "AIAgent.h"
 #include "Node.h"
+#include "Game.h"
 
 namespace gameplay
 {
 
 AIAgent::AIAgent()
-    : _stateMachine(NULL), _node(NULL), _enabled(true), _listener(NULL), _next(NULL)
+    : _stateMachine(NULL), _node(NULL), _enabled(true), _listener(NULL), _next(NULL),
+      _lastUpdateTime(0), _lastUpdateFrame(0), _path(NULL), _pathPoint(0), _moveSpeed(0)
 {
     _stateMachine = new AIStateMachine(this);
 }
 
 AIAgent::~AIAgent()
 {
+    SAFE_RELEASE(_path);
     SAFE_DELETE(_stateMachine);
 }
 
@@ -64,6 +67,77 @@ void AIAgent::update(float elapsedTime)
     _stateMachine->update(elapsedTime);
 }
 
+bool AIAgent::moveTo(NavigationMesh* mesh, const Vector3& target, float speed)
+{
+    GP_ASSERT(mesh);
+
+    if (!_node)
+        return false;
+
+    stopMoving();
+    _path = mesh->findPathAsync(_node->getTranslationWorld(), target);
+    _pathPoint = 0;
+    _moveSpeed = speed;
+    Game::getInstance()->getAIController()->addMovingAgent(this);
+    return true;
+}
+
+void AIAgent::stopMoving()
+{
+    if (_path)
+    {
+        Game::getInstance()->getAIController()->removeMovingAgent(this);
+        SAFE_RELEASE(_path);
+    }
+}
+
+bool AIAgent::isMoving() const
+{
+    return _path != NULL;
+}
+
+bool AIAgent::steer(float elapsedTime)
+{
+    GP_ASSERT(_path);
+
+    if (!_node)
+        return false;
+    if (!_path->isDone())
+        return true;
+
+    // Walk the distance covered this frame along the path, through as many points as it reaches.
+    const std::vector<Vector3>& points = _path->getPoints();
+    Vector3 position = _node->getTranslationWorld();
+    float distance = _moveSpeed * elapsedTime * 0.001f;
+    while (distance > 0.0f && _pathPoint < points.size())
+    {
+        const Vector3& point = points[_pathPoint];
+        const float pointDistance = position.distance(point);
+        if (pointDistance <= distance)
+        {
+            position = point;
+            distance -= pointDistance;
+            ++_pathPoint;
+        }
+        else
+        {
+            position += (point - position) * (distance / pointDistance);
+            distance = 0.0f;
+        }
+    }
+
+    // The node is positioned in the space of its parent.
+    Node* parent = _node->getParent();
+    if (parent)
+    {
+        Matrix inverse;
+        parent->getWorldMatrix().invert(&inverse);
+        inverse.transformPoint(&position);
+    }
+    _node->setTranslation(position);
+    return _pathPoint < points.size();
+}
+
 bool AIAgent::processMessage(AIMessage* message)
 {
     // Handle built-in message types.
@@ -4,6 +4,7 @@
 #include "Ref.h"
 #include "AIStateMachine.h"
 #include "AIMessage.h"
+#include "NavigationMesh.h"
 
 namespace gameplay
 {
@@ -118,6 +119,35 @@ public:
      */
     void setListener(Listener* listener);
 
+    /**
+     * Moves the node of this agent to a target along a path across a navigation mesh.
+     *
+     * The path is found asynchronously, and the agent starts moving once it is found. The
+     * node is then moved along the path by the AIController each frame, at the specified
+     * speed, until it reaches the target. Calling this while the agent is moving replaces
+     * its path.
+     *
+     * @param mesh The navigation mesh to find the path in.
+     * @param target The position to move to.
+     * @param speed The speed to move at, in units per second.
+     *
+     * @return true if the agent is looking for a path, false if it is not bound to a node.
+     * @script{ignore}
+     */
+    bool moveTo(NavigationMesh* mesh, const Vector3& target, float speed);
+
+    /**
+     * Stops moving this agent along its path.
+     */
+    void stopMoving();
+
+    /**
+     * Determines if this agent is moving along a path, or looking for one.
+     *
+     * @return true if the agent is moving, false otherwise.
+     */
+    bool isMoving() const;
+
 private:
 
     /**
@@ -157,15 +187,28 @@ private:
     bool processMessage(AIMessage* message);
 
     /**
-     * Called once per frame by the AIController to update the agent.
+     * Called by the AIController to update the agent, once per frame unless its updates
+     * are sliced by the update budget or reduced by LOD.
      */
     void update(float elapsedTime);
 
+    /**
+     * Called once per frame by the AIController to move the node of the agent along its path.
+     *
+     * @return true if the agent is still moving, false once it has reached the end of its path.
+     */
+    bool steer(float elapsedTime);
+
     AIStateMachine* _stateMachine;
     Node* _node;
     bool _enabled;
     Listener* _listener;
     AIAgent* _next;
+    double _lastUpdateTime;         // Game time of the last update, which the next update's elapsed time is measured from
+    unsigned int _lastUpdateFrame;  // Frame number of the last update, for update LOD
+    NavigationMesh::Path* _path;    // Path the agent moves along, or NULL
+    unsigned int _pathPoint;        // Point of the path the agent moves towards
+    float _moveSpeed;
 
 };
 
@@ -1,12 +1,23 @@
 #include "Base.h"
 #include "AIController.h"
 #include "Game.h"
+#include "Scene.h"
+
+// The minimum number of agents due in a frame for AIController::update() to update them in parallel.
+#define AI_PARALLEL_UPDATE_AGENTS 32
+
+// The number of agents updated between checks of the update budget.
+#define AI_UPDATE_BATCH_SIZE 64
+
+// The default number of frames between updates of agents beyond the LOD distance.
+#define AI_LOD_UPDATE_INTERVAL 4
 
 namespace gameplay
 {
 
 AIController::AIController()
-    : _paused(false), _firstMessage(NULL), _firstAgent(NULL)
+    : _paused(false), _messageOrder(0), _firstAgent(NULL), _nextAgent(NULL), _updating(false), _updateBudget(0.0f),
+      _lodDistance(0.0f), _lodUpdateInterval(AI_LOD_UPDATE_INTERVAL), _parallelUpdate(false), _deferMessages(false)
 {
 }
 
@@ -20,6 +31,10 @@ void AIController::initialize()
 
 void AIController::finalize()
 {
+    // Stop the agents moving along paths, since the paths hold their navigation meshes.
+    while (!_movingAgents.empty())
+        _movingAgents.back()->stopMoving();
+
     // Remove all agents
     AIAgent* agent = _firstAgent;
     while (agent)
@@ -29,16 +44,14 @@ void AIController::finalize()
         SAFE_RELEASE(temp);
     }
     _firstAgent = NULL;
+    _nextAgent = NULL;
+    _agentIndex.clear();
 
     // Remove all messages
-    AIMessage* message = _firstMessage;
-    while (message)
-    {
-        AIMessage* temp = message;
-        message = message->_next;
-        AIMessage::destroy(temp);
-    }
-    _firstMessage = NULL;
+    for (size_t i = 0, count = _messageQueue.size(); i < count; ++i)
+        AIMessage::destroy(_messageQueue[i].message);
+    _messageQueue.clear();
+    AIMessage::clearPool();
 }
 
 void AIController::pause()
@@ -53,88 +66,266 @@ void AIController::resume()
 
 void AIController::sendMessage(AIMessage* message, float delay)
 {
+    if (_deferMessages)
+    {
+        // Agents are being updated on other threads, so the message is sent after they finish.
+        DeferredMessage deferred;
+        deferred.message = message;
+        deferred.delay = delay;
+        std::lock_guard<std::mutex> lock(_deferredMessagesMutex);
+        _deferredMessages.push_back(deferred);
+        return;
+    }
+
     if (delay <= 0)
     {
         // Send instantly
-        if (message->getReceiver() == NULL || strlen(message->getReceiver()) == 0)
-        {
-            // Broadcast message to all agents
-            AIAgent* agent = _firstAgent;
-            while (agent)
-            {
-                if (agent->processMessage(message))
-                    break; // message consumed by this agent - stop bubbling
-                agent = agent->_next;
-            }
-        }
-        else
+        deliverMessage(message);
+    }
+    else
+    {
+        // Queue for later delivery
+        message->_deliveryTime = Game::getGameTime() + delay;
+        QueuedMessage queued;
+        queued.message = message;
+        queued.order = _messageOrder++;
+        _messageQueue.push_back(queued);
+        std::push_heap(_messageQueue.begin(), _messageQueue.end());
+    }
+}
+
+void AIController::deliverMessage(AIMessage* message)
+{
+    if (message->getReceiver() == NULL || strlen(message->getReceiver()) == 0)
+    {
+        // Broadcast message to all agents
+        AIAgent* agent = _firstAgent;
+        while (agent)
         {
-            // Single recipient
-            AIAgent* agent = findAgent(message->getReceiver());
-            if (agent)
-            {
-                agent->processMessage(message);
-            }
-            else
-            {
-                GP_WARN("Failed to locate AIAgent for message recipient: %s", message->getReceiver());
-            }
+            if (agent->processMessage(message))
+                break; // message consumed by this agent - stop bubbling
+            agent = agent->_next;
         }
-
-        // Delete the message, since it is finished being processed
-        AIMessage::destroy(message);
     }
     else
     {
-        // Queue for later delivery
-        if (_firstMessage)
-            message->_next = _firstMessage;
-        _firstMessage = message;
+        // Single recipient
+        AIAgent* agent = findAgent(message->getReceiver());
+        if (agent)
+        {
+            agent->processMessage(message);
+        }
+        else
+        {
+            GP_WARN("Failed to locate AIAgent for message recipient: %s", message->getReceiver());
+        }
     }
+
+    // Delete the message, since it is finished being processed
+    AIMessage::destroy(message);
 }
 
 void AIController::update(float elapsedTime)
 {
+    GP_PROFILE_SCOPE("AIController::update");
+
     if (_paused)
         return;
 
-    static Game* game = Game::getInstance();
+    // Send the pending messages whose delivery time has been reached, earliest first.
+    // Messages sent with a delay during delivery are queued for a later frame.
+    double gameTime = Game::getGameTime();
+    while (!_messageQueue.empty() && _messageQueue.front().message->getDeliveryTime() <= gameTime)
+    {
+        std::pop_heap(_messageQueue.begin(), _messageQueue.end());
+        AIMessage* message = _messageQueue.back().message;
+        _messageQueue.pop_back();
+        deliverMessage(message);
+    }
+
+    // Move agents along their paths every frame, regardless of their update rate.
+    for (size_t i = 0; i < _movingAgents.size(); )
+    {
+        AIAgent* agent = _movingAgents[i];
+        if (agent->isEnabled() && !agent->steer(elapsedTime))
+            agent->stopMoving();
+        else
+            ++i;
+    }
+
+    // Update the agents that are due, in turn from where the budget ran out in the last frame.
+    const double gameTime = Game::getGameTime();
+    gatherUpdatedAgents(gameTime, Game::getInstance()->getFrameNumber());
+
+    _updating = true;
+    const size_t count = _updatedAgents.size();
+    size_t updatedCount = 0;
+    if (_updateBudget <= 0.0f)
+    {
+        updateAgents(0, count);
+        updatedCount = count;
+    }
+    else
+    {
+        const double end = Game::getAbsoluteTime() + _updateBudget;
+        while (updatedCount < count && (updatedCount == 0 || Game::getAbsoluteTime() < end))
+        {
+            size_t last = std::min(updatedCount + AI_UPDATE_BATCH_SIZE, count);
+            updateAgents(updatedCount, last);
+            updatedCount = last;
+        }
+    }
+    _updating = false;
+
+    // The agents left over are updated first in the next frame, with the time they waited.
+    _nextAgent = NULL;
+    for (size_t i = updatedCount; i < count && !_nextAgent; ++i)
+        _nextAgent = _updatedAgents[i].agent;
+    _updatedAgents.clear();
+    GP_PROFILE_COUNTER("AI agents updated", updatedCount);
+}
+
+void AIController::gatherUpdatedAgents(double gameTime, unsigned int frame)
+{
+    _updatedAgents.clear();
 
-    // Send all pending messages that have expired
-    AIMessage* prevMsg = NULL;
-    AIMessage* msg = _firstMessage;
-    while (msg)
+    AIAgent* start = _nextAgent ? _nextAgent : _firstAgent;
+    AIAgent* agent = start;
+    while (agent)
     {
-        // If the message delivery time has expired, send it (this also deletes it)
-        if (msg->getDeliveryTime() >= game->getGameTime())
+        Node* node = agent->_node;
+        if (!agent->isEnabled())
         {
-            // Link the message out of our list
-            if (prevMsg)
-                prevMsg->_next = msg->_next;
-
-            AIMessage* temp = msg;
-            msg = msg->_next;
-            temp->_next = NULL;
-            sendMessage(temp);
+            // Disabled agents do not catch up with the time they were disabled for.
+            agent->_lastUpdateTime = gameTime;
+            agent->_lastUpdateFrame = frame;
         }
         else
         {
-            prevMsg = msg;
-            msg = msg->_next;
+            unsigned int interval = 1;
+            if (_lodDistance > 0.0f)
+            {
+                Scene* scene = node->getScene();
+                Camera* camera = scene ? scene->getActiveCamera() : NULL;
+                Node* cameraNode = camera ? camera->getNode() : NULL;
+                if (cameraNode && node->getTranslationWorld().distanceSquared(cameraNode->getTranslationWorld()) > _lodDistance * _lodDistance)
+                    interval = _lodUpdateInterval;
+            }
+
+            if (interval <= 1 || frame - agent->_lastUpdateFrame >= interval)
+            {
+                UpdatedAgent updated;
+                updated.agent = agent;
+                updated.elapsedTime = (float)(gameTime - agent->_lastUpdateTime);
+                updated.mainThread = node->hasScriptListener(GP_GET_SCRIPT_EVENT(Node, stateUpdate));
+                _updatedAgents.push_back(updated);
+            }
         }
+
+        // Wrap around to the agents before the start.
+        agent = agent->_next ? agent->_next : _firstAgent;
+        if (agent == start)
+            break;
     }
+}
 
-    // Update all enabled agents
-    AIAgent* agent = _firstAgent;
-    while (agent)
+void AIController::updateAgents(size_t first, size_t last)
+{
+    const double gameTime = Game::getGameTime();
+    const unsigned int frame = Game::getInstance()->getFrameNumber();
+    for (size_t i = first; i < last; ++i)
     {
-        if (agent->isEnabled())
-            agent->update(elapsedTime);
+        AIAgent* agent = _updatedAgents[i].agent;
+        if (agent)
+        {
+            agent->_lastUpdateTime = gameTime;
+            agent->_lastUpdateFrame = frame;
+        }
+    }
 
-        agent = agent->_next;
+    JobSystem* jobSystem = _parallelUpdate ? Game::getInstance()->getJobSystem() : NULL;
+    if (jobSystem && last - first >= AI_PARALLEL_UPDATE_AGENTS)
+    {
+        // State updates of different agents only touch their own agent, so they run independently.
+        _deferMessages = true;
+        jobSystem->parallelFor((unsigned int)first, (unsigned int)last, [this](unsigned int begin, unsigned int end)
+        {
+            for (unsigned int i = begin; i < end; ++i)
+            {
+                const UpdatedAgent& updated = _updatedAgents[i];
+                if (updated.agent && !updated.mainThread)
+                    updated.agent->update(updated.elapsedTime);
+            }
+        });
+        _deferMessages = false;
+
+        // Agents with script listeners are updated on this thread, since scripts are not thread safe.
+        for (size_t i = first; i < last; ++i)
+        {
+            const UpdatedAgent& updated = _updatedAgents[i];
+            if (updated.agent && updated.mainThread)
+                updated.agent->update(updated.elapsedTime);
+        }
+
+        // Send the messages of the parallel updates now that the agents are done.
+        std::vector<DeferredMessage> deferredMessages;
+        deferredMessages.swap(_deferredMessages);
+        for (size_t i = 0, count = deferredMessages.size(); i < count; ++i)
+            sendMessage(deferredMessages[i].message, deferredMessages[i].delay);
+    }
+    else
+    {
+        // Agents unregistered by an earlier update in the frame are cleared to NULL.
+        for (size_t i = first; i < last; ++i)
+        {
+            const UpdatedAgent& updated = _updatedAgents[i];
+            if (updated.agent)
+                updated.agent->update(updated.elapsedTime);
+        }
     }
 }
 
+void AIController::setUpdateBudget(float milliseconds)
+{
+    _updateBudget = std::max(milliseconds, 0.0f);
+}
+
+float AIController::getUpdateBudget() const
+{
+    return _updateBudget;
+}
+
+void AIController::setLodDistance(float distance)
+{
+    _lodDistance = std::max(distance, 0.0f);
+}
+
+float AIController::getLodDistance() const
+{
+    return _lodDistance;
+}
+
+void AIController::setLodUpdateInterval(unsigned int frames)
+{
+    GP_ASSERT(frames > 0);
+    _lodUpdateInterval = std::max(frames, 1u);
+}
+
+unsigned int AIController::getLodUpdateInterval() const
+{
+    return _lodUpdateInterval;
+}
+
+void AIController::setParallelUpdateEnabled(bool enabled)
+{
+    _parallelUpdate = enabled;
+}
+
+bool AIController::isParallelUpdateEnabled() const
+{
+    return _parallelUpdate;
+}
+
 void AIController::addAgent(AIAgent* agent)
 {
     agent->addRef();
@@ -143,6 +334,12 @@ void AIController::addAgent(AIAgent* agent)
         agent->_next = _firstAgent;
 
     _firstAgent = agent;
+    addIndexedAgent(agent);
+
+    // Spread agents over the frames of the LOD update interval, so that they are not all updated together.
+    const unsigned int frame = Game::getInstance()->getFrameNumber();
+    agent->_lastUpdateTime = Game::getGameTime();
+    agent->_lastUpdateFrame = frame - (unsigned int)((size_t)agent / sizeof(AIAgent)) % _lodUpdateInterval;
 }
 
 void AIController::removeAgent(AIAgent* agent)
@@ -154,6 +351,21 @@ void AIController::removeAgent(AIAgent* agent)
     {
         if (itr == agent)
         {
+            removeIndexedAgent(agent, agent->getId());
+
+            // Agents gathered for the update in progress, or where the next one starts, must not be left dangling.
+            agent->stopMoving();
+            if (_nextAgent == agent)
+                _nextAgent = agent->_next;
+            if (_updating)
+            {
+                for (size_t i = 0, count = _updatedAgents.size(); i < count; ++i)
+                {
+                    if (_updatedAgents[i].agent == agent)
+                        _updatedAgents[i].agent = NULL;
+                }
+            }
+
             if (prevAgent)
                 prevAgent->_next = agent->_next;
             else
@@ -169,20 +381,56 @@ void AIController::removeAgent(AIAgent* agent)
     }
 }
 
+void AIController::addMovingAgent(AIAgent* agent)
+{
+    _movingAgents.push_back(agent);
+}
+
+void AIController::removeMovingAgent(AIAgent* agent)
+{
+    std::vector<AIAgent*>::iterator itr = std::find(_movingAgents.begin(), _movingAgents.end(), agent);
+    if (itr != _movingAgents.end())
+        _movingAgents.erase(itr);
+}
+
 AIAgent* AIController::findAgent(const char* id) const
 {
     GP_ASSERT(id);
 
-    AIAgent* agent = _firstAgent;
-    while (agent)
-    {
-        if (strcmp(id, agent->getId()) == 0)
-            return agent;
+    // Agents with the same ID are indexed in the order they were registered.
+    std::pair<std::multimap<std::string, AIAgent*>::const_iterator, std::multimap<std::string, AIAgent*>::const_iterator> range = _agentIndex.equal_range(id);
+    if (range.first == range.second)
+        return NULL;
 
-        agent = agent->_next;
+    return (--range.second)->second;
+}
+
+void AIController::addIndexedAgent(AIAgent* agent)
+{
+    _agentIndex.insert(std::make_pair(std::string(agent->getId()), agent));
+}
+
+void AIController::removeIndexedAgent(AIAgent* agent, const char* id)
+{
+    std::pair<std::multimap<std::string, AIAgent*>::iterator, std::multimap<std::string, AIAgent*>::iterator> range = _agentIndex.equal_range(id);
+    for (std::multimap<std::string, AIAgent*>::iterator itr = range.first; itr != range.second; ++itr)
+    {
+        if (itr->second == agent)
+        {
+            _agentIndex.erase(itr);
+            break;
+        }
     }
+}
 
-    return NULL;
+bool AIController::QueuedMessage::operator<(const QueuedMessage& other) const
+{
+    // std::push_heap keeps the greatest element at the front, so later messages compare less.
+    double time = message->getDeliveryTime();
+    double otherTime = other.message->getDeliveryTime();
+    if (time != otherTime)
+        return time > otherTime;
+    return order > other.order;
 }
 
 }
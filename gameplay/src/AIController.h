@@ -14,6 +14,7 @@ namespace gameplay
  */
 class AIController
 {
+    friend class AIAgent;
     friend class Game;
     friend class Node;
 
@@ -30,7 +31,7 @@ public:
      * they are sent through the AIController.
      *
      * @param message The message to send.
-     * @param delay The delay (in milliseconds) to wait before sending the message.
+     * @param delay The delay (in milliseconds) of game time to wait before sending the message.
      */
     void sendMessage(AIMessage* message, float delay = 0);
 
@@ -39,10 +40,88 @@ public:
      *
      * @param id ID of the agent to find.
      *
-     * @return The first agent matching the specified ID, or NULL if no matching agent could be found.
+     * @return The most recently registered agent matching the specified ID, or NULL if no matching
+     *      agent could be found.
      */
     AIAgent* findAgent(const char* id) const;
 
+    /**
+     * Sets the time budget for updating agents in each frame.
+     *
+     * Agents are updated in turn, and once the budget is spent the remaining agents are
+     * updated first in the next frame, so updating many agents spreads over several frames.
+     * The elapsed time an agent is updated with is the game time since its last update, so
+     * agents that wait keep their pace. An agent being updated is never interrupted, so the
+     * budget can be exceeded by the last agents updated.
+     *
+     * @param milliseconds The time budget in milliseconds, or zero to update all agents every frame.
+     */
+    void setUpdateBudget(float milliseconds);
+
+    /**
+     * Gets the time budget for updating agents in each frame.
+     *
+     * @return The time budget in milliseconds, or zero if all agents are updated every frame.
+     */
+    float getUpdateBudget() const;
+
+    /**
+     * Sets the distance from the active camera of their scene beyond which agents are updated less often.
+     *
+     * Agents whose node is further than this from the active camera of its scene are updated
+     * once every LOD update interval frames. Agents of scenes without an active camera are
+     * updated every frame.
+     *
+     * @param distance The LOD distance, or zero to update all agents every frame (the default).
+     */
+    void setLodDistance(float distance);
+
+    /**
+     * Gets the distance from the active camera of their scene beyond which agents are updated less often.
+     *
+     * @return The LOD distance, or zero if LOD is disabled.
+     */
+    float getLodDistance() const;
+
+    /**
+     * Sets the number of frames between updates of agents beyond the LOD distance.
+     *
+     * Agents are spread over the frames of the interval, so that they are not all updated
+     * in the same frame. The default is 4.
+     *
+     * @param frames The LOD update interval, at least 1.
+     */
+    void setLodUpdateInterval(unsigned int frames);
+
+    /**
+     * Gets the number of frames between updates of agents beyond the LOD distance.
+     *
+     * @return The LOD update interval.
+     */
+    unsigned int getLodUpdateInterval() const;
+
+    /**
+     * Sets whether the state updates of agents run in parallel on the job system.
+     *
+     * While agents are updated in parallel, messages sent through sendMessage are deferred
+     * and sent once all agents of the frame have been updated, in no particular order
+     * between agents. The state listeners of agents must then be safe to call from worker
+     * threads and must only change state through messages. Agents whose node has a script
+     * listening to stateUpdate are always updated on the main thread.
+     *
+     * It is disabled by default.
+     *
+     * @param enabled true to update agents in parallel, false to update them in turn on the main thread.
+     */
+    void setParallelUpdateEnabled(bool enabled);
+
+    /**
+     * Determines whether the state updates of agents run in parallel on the job system.
+     *
+     * @return true if agents are updated in parallel, false otherwise.
+     */
+    bool isParallelUpdateEnabled() const;
+
 private:
 
     /**
@@ -92,13 +171,79 @@ private:
      */
     void update(float elapsedTime);
 
+    /**
+     * A message waiting in the queue for its delivery time.
+     */
+    struct QueuedMessage
+    {
+        AIMessage* message;
+        unsigned int order;         // Order of sending, which delivers messages due at the same time in turn
+
+        /**
+         * Orders the queue heap so that the earliest message is at its front.
+         */
+        bool operator<(const QueuedMessage& other) const;
+    };
+
+    /**
+     * A message sent while agents were updated in parallel.
+     */
+    struct DeferredMessage
+    {
+        AIMessage* message;
+        float delay;
+    };
+
+    /**
+     * An agent due for an update in the current frame.
+     */
+    struct UpdatedAgent
+    {
+        AIAgent* agent;
+        float elapsedTime;          // Game time since the agent's last update
+        bool mainThread;            // Whether the agent has script listeners and must be updated on the main thread
+    };
+
+    void deliverMessage(AIMessage* message);
+
+    /**
+     * Gathers the enabled agents that are due for an update, starting with the agents left over by the last frame.
+     */
+    void gatherUpdatedAgents(double gameTime, unsigned int frame);
+
+    /**
+     * Updates a range of the gathered agents, in parallel if enabled.
+     */
+    void updateAgents(size_t first, size_t last);
+
     void addAgent(AIAgent* agent);
 
     void removeAgent(AIAgent* agent);
 
+    void addIndexedAgent(AIAgent* agent);
+
+    void removeIndexedAgent(AIAgent* agent, const char* id);
+
+    void addMovingAgent(AIAgent* agent);
+
+    void removeMovingAgent(AIAgent* agent);
+
     bool _paused;
-    AIMessage* _firstMessage;
+    std::vector<QueuedMessage> _messageQueue;           // Heap of delayed messages, by delivery time
+    unsigned int _messageOrder;
     AIAgent* _firstAgent;
+    std::multimap<std::string, AIAgent*> _agentIndex;   // Registered agents, by ID
+    AIAgent* _nextAgent;                                // Agent the next frame's updates start at, or NULL for the first
+    std::vector<UpdatedAgent> _updatedAgents;           // Agents due for an update in the current frame
+    std::vector<AIAgent*> _movingAgents;                // Agents moving along a path
+    bool _updating;
+    float _updateBudget;
+    float _lodDistance;
+    unsigned int _lodUpdateInterval;
+    bool _parallelUpdate;
+    bool _deferMessages;                                // Whether sendMessage defers messages while agents update in parallel
+    std::vector<DeferredMessage> _deferredMessages;
+    std::mutex _deferredMessagesMutex;
 
 };
 
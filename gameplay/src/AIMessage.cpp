@@ -4,8 +4,15 @@
 namespace gameplay
 {
 
+// Maximum number of destroyed messages kept for reuse by AIMessage::create.
+#define AIMESSAGE_POOL_SIZE 256
+
+// Destroyed messages available for reuse, linked through AIMessage::_next.
+static AIMessage* __freeMessages = NULL;
+static unsigned int __freeMessageCount = 0;
+
 AIMessage::AIMessage()
-    : _id(0), _deliveryTime(0), _parameters(NULL), _parameterCount(0), _messageType(MESSAGE_TYPE_CUSTOM), _next(NULL)
+    : _id(0), _deliveryTime(0), _parameters(NULL), _parameterCount(0), _parameterCapacity(0), _messageType(MESSAGE_TYPE_CUSTOM), _next(NULL)
 {
 }
 
@@ -16,19 +23,63 @@ AIMessage::~AIMessage()
 
 AIMessage* AIMessage::create(unsigned int id, const char* sender, const char* receiver, unsigned int parameterCount)
 {
-    AIMessage* message = new AIMessage();
+    // Reuse a destroyed message if there is one, to avoid allocating for every message sent.
+    AIMessage* message = __freeMessages;
+    if (message)
+    {
+        __freeMessages = message->_next;
+        --__freeMessageCount;
+        message->_next = NULL;
+    }
+    else
+    {
+        message = new AIMessage();
+    }
+
     message->_id = id;
-    message->_sender = sender;
-    message->_receiver = receiver;
+    message->_sender = sender ? sender : "";
+    message->_receiver = receiver ? receiver : "";
     message->_parameterCount = parameterCount;
-    if (parameterCount > 0)
+    if (parameterCount > message->_parameterCapacity)
+    {
+        SAFE_DELETE_ARRAY(message->_parameters);
         message->_parameters = new AIMessage::Parameter[parameterCount];
+        message->_parameterCapacity = parameterCount;
+    }
     return message;
 }
 
 void AIMessage::destroy(AIMessage* message)
 {
-    SAFE_DELETE(message);
+    if (!message)
+        return;
+
+    if (__freeMessageCount >= AIMESSAGE_POOL_SIZE)
+    {
+        SAFE_DELETE(message);
+        return;
+    }
+
+    // Reset the message and keep it, along with its parameter storage, for reuse.
+    for (unsigned int i = 0; i < message->_parameterCount; ++i)
+        message->_parameters[i].clear();
+    message->_parameterCount = 0;
+    message->_deliveryTime = 0;
+    message->_messageType = MESSAGE_TYPE_CUSTOM;
+    message->_next = __freeMessages;
+    __freeMessages = message;
+    ++__freeMessageCount;
+}
+
+void AIMessage::clearPool()
+{
+    while (__freeMessages)
+    {
+        AIMessage* message = __freeMessages;
+        __freeMessages = message->_next;
+        SAFE_DELETE(message);
+    }
+    __freeMessageCount = 0;
 }
 
 unsigned int AIMessage::getId() const
@@ -61,6 +61,9 @@ public:
      * sent. However, in the rare case where an AIMessage is constructed and not
      * passed to AIController::sendMessage, this method should be called to destroy
      * the message.
+     *
+     * Destroyed messages are kept and reused by AIMessage::create, so sending
+     * messages does not allocate memory once the game has warmed up.
      */
     static void destroy(AIMessage* message);
 
@@ -267,12 +270,18 @@ private:
 
     void clearParameter(unsigned int index);
 
+    /**
+     * Frees the destroyed messages kept for reuse.
+     */
+    static void clearPool();
+
     unsigned int _id;
     std::string _sender;
     std::string _receiver;
     double _deliveryTime;
     Parameter* _parameters;
     unsigned int _parameterCount;
+    unsigned int _parameterCapacity;    // Size of the parameter array, which is kept when messages are reused
     MessageType _messageType;
     AIMessage* _next;
 
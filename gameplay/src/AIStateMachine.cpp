@@ -21,9 +21,9 @@ AIStateMachine::AIStateMachine(AIAgent* agent)
 AIStateMachine::~AIStateMachine()
 {
     // Release all states
-    for (std::list<AIState*>::iterator itr = _states.begin(); itr != _states.end(); ++itr)
+    for (size_t i = 0, count = _states.size(); i < count; ++i)
     {
-        (*itr)->release();
+        _states[i]->release();
     }
 
     if (AIState::_empty)
@@ -48,6 +48,7 @@ AIState* AIStateMachine::addState(const char* id)
 {
     AIState* state = AIState::create(id);
     _states.push_back(state);
+    _stateIndex.insert(std::make_pair(state->_id, state));
     return state;
 }
 
@@ -55,14 +56,31 @@ void AIStateMachine::addState(AIState* state)
 {
     state->addRef();
     _states.push_back(state);
+    _stateIndex.insert(std::make_pair(state->_id, state));
 }
 
 void AIStateMachine::removeState(AIState* state)
 {
-    std::list<AIState*>::iterator itr = std::find(_states.begin(), _states.end(), state);
+    std::vector<AIState*>::iterator itr = std::find(_states.begin(), _states.end(), state);
     if (itr != _states.end())
     {
         _states.erase(itr);
+
+        // Index the next state added with the same ID in its place.
+        std::unordered_map<std::string, AIState*>::iterator indexed = _stateIndex.find(state->_id);
+        if (indexed != _stateIndex.end() && indexed->second == state)
+        {
+            _stateIndex.erase(indexed);
+            for (size_t i = 0, count = _states.size(); i < count; ++i)
+            {
+                if (_states[i]->_id == state->_id)
+                {
+                    _stateIndex.insert(std::make_pair(state->_id, _states[i]));
+                    break;
+                }
+            }
+        }
+
         state->release();
     }
 }
@@ -71,15 +89,8 @@ AIState* AIStateMachine::getState(const char* id) const
 {
     GP_ASSERT(id);
 
-    for (std::list<AIState*>::const_iterator itr = _states.begin(); itr != _states.end(); ++itr)
-    {
-        AIState* state = (*itr);
-
-        if (strcmp(id, state->getId()) == 0)
-            return state;
-    }
-
-    return NULL;
+    std::unordered_map<std::string, AIState*>::const_iterator itr = _stateIndex.find(id);
+    return itr != _stateIndex.end() ? itr->second : NULL;
 }
 
 AIState* AIStateMachine::getActiveState() const
@@ -91,7 +102,11 @@ bool AIStateMachine::hasState(AIState* state) const
 {
     GP_ASSERT(state);
 
-    return (std::find(_states.begin(), _states.end(), state) != _states.end());
+    // Only states sharing the ID of another state need to be searched for.
+    std::unordered_map<std::string, AIState*>::const_iterator itr = _stateIndex.find(state->_id);
+    if (itr == _stateIndex.end())
+        return false;
+    return itr->second == state || std::find(_states.begin(), _states.end(), state) != _states.end();
 }
 
 AIState* AIStateMachine::setState(const char* id)
@@ -100,7 +100,8 @@ public:
      * Changes the state of this state machine to the given state.
      *
      * If the given state is not registered with this state machine,
-     * this method does nothing.
+     * this method does nothing. This is faster than changing state by ID,
+     * so callers that change state often should hold on to their states.
      *
      * @param state The new state.
      *
@@ -152,7 +153,8 @@ private:
 
     AIAgent* _agent;
     AIState* _currentState;
-    std::list<AIState*> _states;
+    std::vector<AIState*> _states;
+    std::unordered_map<std::string, AIState*> _stateIndex;    // First state added with each ID
 
 };
 
@@ -134,6 +134,8 @@ void Animation::createClips(const char* url)
         GP_ERROR("The animation's frame count must be greater than 0.");
 
     createClips(pAnimation, (unsigned int)frameCount);
+    if (pAnimation->exists("bakeError"))
+        bake(pAnimation->getFloat("bakeError"));
 
     SAFE_DELETE(properties);
 }
@@ -225,6 +227,24 @@ void Animation::pause(const char * clipId)
     }
 }
 
+unsigned int Animation::bake(float maxError)
+{
+    if (maxError <= 0.0f)
+    {
+        GP_WARN("Invalid bake error %f for animation '%s'.", maxError, _id.c_str());
+        return 0;
+    }
+
+    unsigned int count = 0;
+    for (size_t i = 0, channelCount = _channels.size(); i < channelCount; ++i)
+    {
+        GP_ASSERT(_channels[i] && _channels[i]->_curve);
+        if (_channels[i]->_curve->bake(maxError))
+            ++count;
+    }
+    return count;
+}
+
 bool Animation::targets(AnimationTarget* target) const
 {
     for (std::vector<Animation::Channel*>::const_iterator itr = _channels.begin(); itr != _channels.end(); ++itr)
@@ -282,6 +302,10 @@ void Animation::createClips(Properties* animationProperties, unsigned int frameC
 
         clip->setLoopBlendTime(pClip->getFloat("loopBlendTime")); // returns zero if not specified
 
+        // The curves are shared by the clips, so baking them for a clip bakes them for all of the clips.
+        if (pClip->exists("bakeError"))
+            bake(pClip->getFloat("bakeError"));
+
         pClip = animationProperties->getNextNamespace();
     }
 }
@@ -27,6 +27,8 @@ class Animation : public Ref
     friend class AnimationClip;
     friend class AnimationTarget;
     friend class Bundle;
+    friend class AnimationController;
+    friend class AnimationTexture;
 
 public:
 
@@ -112,6 +114,24 @@ public:
      */
     bool targets(AnimationTarget* target) const;
 
+    /**
+     * Bakes the curves of the channels of this animation into tables of values sampled at a
+     * fixed rate, which are evaluated with a lookup and a linear interpolation.
+     *
+     * The curves are shared by all the clips of the animation. Animations loaded from
+     * .animation files are baked when their namespace, or the namespace of any of their
+     * clips, has a bakeError property.
+     *
+     * @param maxError The largest difference of any component of a curve from its value.
+     *
+     * @return The number of curves baked, which leaves out curves of linear points and
+     *      curves that cannot be baked within the error.
+     *
+     * @see Curve::bake
+     * @script{ignore}
+     */
+    unsigned int bake(float maxError);
+
 private:
 
     /**
@@ -125,6 +145,10 @@ private:
         friend class AnimationClip;
         friend class Animation;
         friend class AnimationTarget;
+        friend class Bundle;
+        friend class AnimationController;
+        friend class AnimationTexture;
+        friend class SceneSnapshot;
 
     private:
 
@@ -1,9 +1,11 @@
 #include "Base.h"
 #include "AnimationClip.h"
 #include "Animation.h"
+#include "ObjectPool.h"
 #include "AnimationTarget.h"
 #include "Game.h"
 #include "Quaternion.h"
+#include "AnimationPose.h"
 #include "ScriptController.h"
 
 namespace gameplay
@@ -15,6 +17,7 @@ AnimationClip::AnimationClip(const char* id, Animation* animation, unsigned long
     : _id(id), _animation(animation), _startTime(startTime), _endTime(endTime), _duration(_endTime - _startTime), 
       _stateBits(0x00), _repeatCount(1.0f), _loopBlendTime(0), _activeDuration(_duration * _repeatCount), _speed(1.0f), _timeStarted(0), 
       _elapsedTime(0), _crossFadeToClip(NULL), _crossFadeOutElapsed(0), _crossFadeOutDuration(0), _blendWeight(1.0f),
+      _percentComplete(0.0f), _evaluatePending(false), _lodTarget(NULL), _layer(0), _poseJoint(NULL), _pose(NULL),
       _beginListeners(NULL), _endListeners(NULL), _listeners(NULL), _listenerItr(NULL)
 {
     GP_REGISTER_SCRIPT_EVENTS();
@@ -27,7 +30,10 @@ AnimationClip::AnimationClip(const char* id, Animation* animation, unsigned long
         GP_ASSERT(_animation->_channels[i]);
         GP_ASSERT(_animation->_channels[i]->getCurve());
         _values.push_back(new AnimationValue(_animation->_channels[i]->getCurve()->getComponentCount()));
+        _curves.push_back(_animation->_channels[i]->getCurve());
+        _valueData.push_back(_values.back()->_value);
     }
+    _cursors.resize(_values.size());
 }
 
 AnimationClip::~AnimationClip()
@@ -39,6 +45,7 @@ AnimationClip::~AnimationClip()
         valueIter++;
     }
     _values.clear();
+    SAFE_DELETE(_pose);
 
     SAFE_RELEASE(_crossFadeToClip);
     SAFE_DELETE(_beginListeners);
@@ -58,6 +65,18 @@ AnimationClip::~AnimationClip()
     SAFE_DELETE(_listenerItr);
 }
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+void* AnimationClip::operator new(size_t size)
+{
+    return ObjectPool::allocate(size);
+}
+
+void AnimationClip::operator delete(void* p)
+{
+    ObjectPool::deallocate(p);
+}
+#endif
+
 AnimationClip::ListenerEvent::ListenerEvent(Listener* listener, unsigned long eventTime)
 {
     _listener = listener;
@@ -170,6 +189,26 @@ float AnimationClip::getBlendWeight() const
     return _blendWeight;
 }
 
+void AnimationClip::setLayer(unsigned int layer)
+{
+    _layer = layer;
+}
+
+unsigned int AnimationClip::getLayer() const
+{
+    return _layer;
+}
+
+void AnimationClip::setBlendMask(const char* jointId)
+{
+    _blendMask = jointId ? jointId : "";
+}
+
+const char* AnimationClip::getBlendMask() const
+{
+    return _blendMask.empty() ? NULL : _blendMask.c_str();
+}
+
 void AnimationClip::setLoopBlendTime(float loopBlendTime)
 {
     if (loopBlendTime < 0.0f)
@@ -399,6 +438,20 @@ void AnimationClip::removeEndListener(AnimationClip::Listener* listener)
 
 bool AnimationClip::update(float elapsedTime)
 {
+    if (advance(elapsedTime))
+        return true;
+
+    if (!_evaluatePending)
+        return false;
+
+    evaluate();
+    return apply();
+}
+
+bool AnimationClip::advance(float elapsedTime)
+{
+    _evaluatePending = false;
+
     if (isClipStateBitSet(CLIP_IS_PAUSED_BIT))
     {
         return false;
@@ -498,10 +551,10 @@ bool AnimationClip::update(float elapsedTime)
     // Compute percentage complete for the current loop (prevent a divide by zero if _duration==0).
     // Note that we don't use (currentTime/(_duration+_loopBlendTime)). That's because we want a
     // % value that is outside the 0-1 range for loop smoothing/blending purposes.
-    float percentComplete = _duration == 0 ? 1 : currentTime / (float)_duration;
+    _percentComplete = _duration == 0 ? 1 : currentTime / (float)_duration;
 
     if (_loopBlendTime == 0.0f)
-        percentComplete = MATH_CLAMP(percentComplete, 0.0f, 1.0f);
+        _percentComplete = MATH_CLAMP(_percentComplete, 0.0f, 1.0f);
 
     // If we're cross fading, compute blend weights
     if (isClipStateBitSet(CLIP_IS_FADING_OUT_BIT))
@@ -551,32 +604,61 @@ bool AnimationClip::update(float elapsedTime)
         }
     }
     
+    _evaluatePending = true;
+    return false;
+}
+
+void AnimationClip::evaluate()
+{
+    GP_ASSERT(_animation);
+    GP_ASSERT(_curves.size() == _animation->_channels.size());
+
     // Evaluate this clip.
-    Animation::Channel* channel = NULL;
-    AnimationValue* value = NULL;
-    AnimationTarget* target = NULL;
-    size_t channelCount = _animation->_channels.size();
+    if (_curves.empty())
+        return;
     float percentageStart = (float)_startTime / (float)_animation->_duration;
     float percentageEnd = (float)_endTime / (float)_animation->_duration;
     float percentageBlend = (float)_loopBlendTime / (float)_animation->_duration;
-    for (size_t i = 0; i < channelCount; i++)
+    Curve::evaluate((unsigned int)_curves.size(), &_curves[0], _percentComplete, percentageStart, percentageEnd, percentageBlend, &_valueData[0], &_cursors[0]);
+
+    // Scatter the values into the pose the clip blends through, whose weights were set when it was bound.
+    if (_poseJoint)
+    {
+        GP_ASSERT(_pose);
+        GP_ASSERT(_poseIndices.size() == _curves.size());
+        for (size_t i = 0, count = _poseIndices.size(); i < count; i++)
+        {
+            _pose->setValue(_poseIndices[i], _animation->_channels[i]->_propertyId, _valueData[i]);
+        }
+    }
+}
+
+bool AnimationClip::apply()
+{
+    _evaluatePending = false;
+    applyValues();
+    return checkEnded();
+}
+
+void AnimationClip::applyValues()
+{
+    GP_ASSERT(_animation);
+
+    for (size_t i = 0, channelCount = _animation->_channels.size(); i < channelCount; i++)
     {
-        channel = _animation->_channels[i];
+        Animation::Channel* channel = _animation->_channels[i];
         GP_ASSERT(channel);
-        target = channel->_target;
+        AnimationTarget* target = channel->_target;
         GP_ASSERT(target);
-        value = _values[i];
-        GP_ASSERT(value);
-
-        // Evaluate the point on Curve
-        GP_ASSERT(channel->getCurve());
-        channel->getCurve()->evaluate(percentComplete, percentageStart, percentageEnd, percentageBlend, value->_value);
 
         // Set the animation value on the target property.
-        target->setAnimationPropertyValue(channel->_propertyId, value, _blendWeight);
+        target->setAnimationPropertyValue(channel->_propertyId, _values[i], _blendWeight);
     }
+}
 
-    // When ended. Probably should move to it's own method so we can call it when the clip is ended early.
+bool AnimationClip::checkEnded()
+{
+    // The clip ends once it has played its active duration or was stopped.
     if (isClipStateBitSet(CLIP_IS_MARKED_FOR_REMOVAL_BIT) || !isClipStateBitSet(CLIP_IS_STARTED_BIT))
     {
         onEnd();
@@ -672,6 +754,8 @@ AnimationClip* AnimationClip::clone(Animation* animation) const
     newClip->setSpeed(getSpeed());
     newClip->setRepeatCount(getRepeatCount());
     newClip->setBlendWeight(getBlendWeight());
+    newClip->_layer = _layer;
+    newClip->_blendMask = _blendMask;
     
     size_t size = _values.size();
     newClip->_values.resize(size, NULL);
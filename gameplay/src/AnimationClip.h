@@ -11,6 +11,9 @@ namespace gameplay
 
 class Animation;
 class AnimationValue;
+class Node;
+class Joint;
+class AnimationPose;
 
 /**
  * Defines the runtime session of an Animation to be played.
@@ -18,7 +21,9 @@ class AnimationValue;
 class AnimationClip : public Ref, public ScriptTarget
 {
     friend class AnimationController;
+    friend class AnimationTexture;
     friend class Animation;
+    friend class SceneSnapshot;
 
     GP_SCRIPT_EVENTS_START();
     GP_SCRIPT_EVENT(clipBegin, "<AnimationClip>");
@@ -191,6 +196,42 @@ public:
      */
     float getBlendWeight() const;
 
+    /**
+     * Sets the layer of the AnimationClip.
+     *
+     * Clips animating the joints of the same skin are blended into its pose in increasing
+     * layer order, and in the order they started within a layer, so that a clip on a higher
+     * layer (such as an upper body action masked with setBlendMask()) blends over the clips
+     * on the layers below it. The default is 0.
+     *
+     * @param layer The layer of the clip.
+     */
+    void setLayer(unsigned int layer);
+
+    /**
+     * Gets the layer of the AnimationClip.
+     *
+     * @return The layer of the clip.
+     */
+    unsigned int getLayer() const;
+
+    /**
+     * Restricts the clip to a joint and its descendants.
+     *
+     * The mask applies to clips whose channels all animate the joints of one skin, which
+     * are blended through an AnimationPose. It takes effect the next time the clip is played.
+     *
+     * @param jointId The ID of the root joint of the mask, or NULL to animate every joint of the clip.
+     */
+    void setBlendMask(const char* jointId);
+
+    /**
+     * Gets the ID of the root joint the clip is restricted to.
+     *
+     * @return The ID of the root joint of the mask, or NULL if the clip is not masked.
+     */
+    const char* getBlendMask() const;
+
     /**
      * Sets the time (in milliseconds) to append to the clip's active duration
      * to use for blending the end points of the clip when looping.
@@ -342,6 +383,18 @@ private:
      */
     ~AnimationClip();
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+    /**
+     * Allocates the memory of a clip from the current ObjectPool.
+     */
+    static void* operator new(size_t size);
+
+    /**
+     * Returns the memory of a clip to the ObjectPool it was allocated from.
+     */
+    static void operator delete(void* p);
+#endif
+
     /**
      * Hidden copy assignment operator.
      */
@@ -352,6 +405,42 @@ private:
      */
     bool update(float elapsedTime);
 
+    /**
+     * Advances the time of the clip by the elapsed time and notifies its listeners.
+     *
+     * When the clip is to be evaluated this frame, _evaluatePending is set and the clip
+     * must be evaluated and applied next.
+     *
+     * @return true if the clip ended and is to be removed from the running clips.
+     */
+    bool advance(float elapsedTime);
+
+    /**
+     * Samples the curves of the clip at its current time into its animation values.
+     *
+     * This only writes to the clip itself, so clips can be evaluated on separate threads.
+     */
+    void evaluate();
+
+    /**
+     * Sets the animation values of an evaluated clip on their targets.
+     *
+     * @return true if the clip ended and is to be removed from the running clips.
+     */
+    bool apply();
+
+    /**
+     * Sets the animation values of an evaluated clip on their targets, one property at a time.
+     */
+    void applyValues();
+
+    /**
+     * Ends the clip if it reached the end of its active duration or was stopped.
+     *
+     * @return true if the clip ended and is to be removed from the running clips.
+     */
+    bool checkEnded();
+
     /**
      * Handles when the AnimationClip begins.
      */
@@ -402,7 +491,18 @@ private:
     float _crossFadeOutElapsed;                         // The amount of time that has elapsed for the crossfade.
     unsigned long _crossFadeOutDuration;                // The duration of the cross fade.
     float _blendWeight;                                 // The clip's blendweight.
+    float _percentComplete;                             // The position within the loop the clip is evaluated at.
+    bool _evaluatePending;                              // Whether the clip was advanced and is waiting to be evaluated.
+    Node* _lodTarget;                                   // A target whose model decides how often the clip is evaluated, or NULL.
+    unsigned int _layer;                                // The layer the clip is blended on.
+    std::string _blendMask;                             // The ID of the root joint the clip is restricted to.
+    Joint* _poseJoint;                                  // A joint of the skin the clip blends into the pose of, or NULL.
+    AnimationPose* _pose;                               // The pose the clip is sampled into when it blends into the pose of a skin.
+    std::vector<unsigned int> _poseIndices;             // The index in the skin of the joint of each channel.
     std::vector<AnimationValue*> _values;               // AnimationValue holder.
+    std::vector<const Curve*> _curves;                  // The curve of each channel of the animation.
+    std::vector<float*> _valueData;                     // The destination of the evaluated value of each channel.
+    std::vector<Curve::Cursor> _cursors;                // Where the curve of each channel was last evaluated.
     std::vector<Listener*>* _beginListeners;            // Collection of begin listeners on the clip.
     std::vector<Listener*>* _endListeners;              // Collection of end listeners on the clip.
     std::list<ListenerEvent*>* _listeners;              // Ordered collection of listeners on the clip.
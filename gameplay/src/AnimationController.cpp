@@ -2,12 +2,27 @@
 #include "AnimationController.h"
 #include "Game.h"
 #include "Curve.h"
+#include "Joint.h"
+#include "AnimationPose.h"
+#include "MeshSkin.h"
+#include "Model.h"
+#include "Scene.h"
+
+// The minimum number of advanced clips for AnimationController::update() to evaluate them in parallel.
+#define ANIMATION_PARALLEL_EVALUATE_CLIPS 32
+
+// The default screen size below which clips are evaluated at the reduced rate.
+#define ANIMATION_LOD_SCREEN_SIZE 0.1f
+
+// The default number of frames between evaluations at the reduced rate.
+#define ANIMATION_LOD_UPDATE_INTERVAL 4
 
 namespace gameplay
 {
 
 AnimationController::AnimationController()
-    : _state(STOPPED)
+    : _state(STOPPED), _updating(false), _updateCount(0), _lodEnabled(false), _lodScreenSize(ANIMATION_LOD_SCREEN_SIZE),
+      _lodUpdateInterval(ANIMATION_LOD_UPDATE_INTERVAL)
 {
 }
 
@@ -17,16 +32,50 @@ AnimationController::~AnimationController()
 
 void AnimationController::stopAllAnimations() 
 {
-    std::list<AnimationClip*>::iterator clipIter = _runningClips.begin();
-    while (clipIter != _runningClips.end())
+    for (size_t i = 0, count = _runningClips.size(); i < count; ++i)
     {
-        AnimationClip* clip = *clipIter;
-        GP_ASSERT(clip);
-        clip->stop();
-        clipIter++;
+        AnimationClip* clip = _runningClips[i];
+        if (clip)
+            clip->stop();
     }
 }
 
+void AnimationController::setLodEnabled(bool enabled)
+{
+    _lodEnabled = enabled;
+}
+
+bool AnimationController::isLodEnabled() const
+{
+    return _lodEnabled;
+}
+
+void AnimationController::setLodScreenSize(float size)
+{
+    _lodScreenSize = size;
+}
+
+float AnimationController::getLodScreenSize() const
+{
+    return _lodScreenSize;
+}
+
+void AnimationController::setLodUpdateInterval(unsigned int frames)
+{
+    GP_ASSERT(frames > 0);
+    _lodUpdateInterval = std::max(frames, 1u);
+}
+
+unsigned int AnimationController::getLodUpdateInterval() const
+{
+    return _lodUpdateInterval;
+}
+
+void AnimationController::advance(float elapsedTime)
+{
+    update(elapsedTime);
+}
+
 AnimationController::State AnimationController::getState() const
 {
     return _state;
@@ -39,10 +88,9 @@ void AnimationController::initialize()
 
 void AnimationController::finalize()
 {
-    std::list<AnimationClip*>::iterator itr = _runningClips.begin();
-    for ( ; itr != _runningClips.end(); itr++)
+    for (size_t i = 0, count = _runningClips.size(); i < count; ++i)
     {
-        AnimationClip* clip = *itr;
+        AnimationClip* clip = _runningClips[i];
         SAFE_RELEASE(clip);
     }
     _runningClips.clear();
@@ -62,6 +110,163 @@ void AnimationController::pause()
     _state = PAUSED;
 }
 
+Node* AnimationController::getVisibilityNode(Node* node)
+{
+    if (node->getType() == Node::JOINT)
+    {
+        // Joints shared by several skins are kept up to date for all of them.
+        const Joint* joint = static_cast<Joint*>(node);
+        if (joint->_skin.next)
+            return NULL;
+        Model* model = joint->_skin.skin ? joint->_skin.skin->getModel() : NULL;
+        return model ? model->getNode() : NULL;
+    }
+    return node->getDrawable() ? node : NULL;
+}
+
+Node* AnimationController::findLodTarget(AnimationClip* clip)
+{
+    const Animation* animation = clip->_animation;
+    GP_ASSERT(animation);
+
+    Node* lodTarget = NULL;
+    Node* visibilityNode = NULL;
+    for (size_t i = 0, count = animation->_channels.size(); i < count; ++i)
+    {
+        Node* target = dynamic_cast<Node*>(animation->_channels[i]->_target);
+        Node* node = target ? getVisibilityNode(target) : NULL;
+        if (!node || (visibilityNode && node != visibilityNode))
+            return NULL;
+        if (!lodTarget)
+        {
+            lodTarget = target;
+            visibilityNode = node;
+        }
+    }
+    return lodTarget;
+}
+
+// Gets the diameter of the bounding sphere of a node as a fraction of the height of the view of a camera.
+static float getScreenSize(Node* node, Camera* camera)
+{
+    const BoundingSphere& sphere = node->getBoundingSphere();
+    if (camera->getCameraType() == Camera::ORTHOGRAPHIC)
+        return 2.0f * sphere.radius / camera->getZoomY();
+
+    Node* cameraNode = camera->getNode();
+    if (!cameraNode)
+        return 1.0f;
+    const float distance = sphere.center.distance(cameraNode->getTranslationWorld());
+    if (distance <= sphere.radius)
+        return 1.0f;
+    return sphere.radius / (distance * tan(MATH_DEG_TO_RAD(camera->getFieldOfView()) * 0.5f));
+}
+
+bool AnimationController::isLodEvaluated(AnimationClip* clip, unsigned int frame) const
+{
+    // Clips that are ending are evaluated so that they rest on their last pose.
+    if (!clip->_lodTarget || !clip->isClipStateBitSet(AnimationClip::CLIP_IS_STARTED_BIT) ||
+        clip->isClipStateBitSet(AnimationClip::CLIP_IS_MARKED_FOR_REMOVAL_BIT))
+        return true;
+
+    Node* node = getVisibilityNode(clip->_lodTarget);
+    Scene* scene = node ? node->getScene() : NULL;
+    if (!scene || scene->getVisibleFrame() + 1 < frame)
+        return true;
+
+    // Visibility is found while drawing, so the last frame tells whether the model is seen.
+    if (node->getVisibleFrame() + 1 < frame)
+        return false;
+
+    Camera* camera = scene->getActiveCamera();
+    if (!node->isOccluded() && (!camera || getScreenSize(node, camera) >= _lodScreenSize))
+        return true;
+
+    // Spread the models over the frames of the interval, keeping the clips of a model in step.
+    const unsigned int phase = (unsigned int)((size_t)node / sizeof(Node));
+    return (frame + phase) % _lodUpdateInterval == 0;
+}
+
+void AnimationController::bindPose(AnimationClip* clip)
+{
+    clip->_poseJoint = NULL;
+    clip->_poseIndices.clear();
+
+    const Animation* animation = clip->_animation;
+    GP_ASSERT(animation);
+
+    // Joints shared by several skins are animated one property at a time, like other targets.
+    MeshSkin* skin = NULL;
+    for (size_t i = 0, count = animation->_channels.size(); i < count; ++i)
+    {
+        Joint* joint = dynamic_cast<Joint*>(animation->_channels[i]->_target);
+        MeshSkin* jointSkin = joint && !joint->_skin.next ? joint->_skin.skin : NULL;
+        const int index = jointSkin ? jointSkin->getJointIndex(joint) : -1;
+        if (index < 0 || (skin && jointSkin != skin))
+        {
+            clip->_poseIndices.clear();
+            return;
+        }
+        skin = jointSkin;
+        clip->_poseIndices.push_back((unsigned int)index);
+    }
+    if (!skin)
+        return;
+
+    if (!clip->_pose)
+        clip->_pose = new AnimationPose();
+    clip->_pose->resize(skin->getJointCount());
+    for (size_t i = 0, count = animation->_channels.size(); i < count; ++i)
+    {
+        // Joints outside of the blend mask keep a zero weight.
+        const Animation::Channel* channel = animation->_channels[i];
+        float weight = 1.0f;
+        if (!clip->_blendMask.empty())
+        {
+            weight = 0.0f;
+            for (Node* node = static_cast<Joint*>(channel->_target); node; node = node->getParent())
+            {
+                if (node->getId() && clip->_blendMask == node->getId())
+                {
+                    weight = 1.0f;
+                    break;
+                }
+            }
+        }
+        clip->_pose->setWeight(clip->_poseIndices[i], channel->_propertyId, weight);
+    }
+    clip->_poseJoint = skin->getJoint(clip->_poseIndices[0]);
+}
+
+MeshSkin* AnimationController::getPoseSkin(AnimationClip* clip)
+{
+    Joint* joint = clip->_poseJoint;
+    if (!joint)
+        return NULL;
+
+    GP_ASSERT(clip->_pose);
+    MeshSkin* skin = joint->_skin.next ? NULL : joint->_skin.skin;
+    if (!skin || skin->getJointCount() != clip->_pose->getTransformCount() || skin->getJoint(clip->_poseIndices[0]) != joint)
+    {
+        bindPose(clip);
+        joint = clip->_poseJoint;
+        skin = joint ? joint->_skin.skin : NULL;
+    }
+    return skin;
+}
+
+Transform* const* AnimationController::getPoseTransforms(MeshSkin* skin)
+{
+    const unsigned int jointCount = skin->getJointCount();
+    _poseTransforms.resize(jointCount);
+    for (unsigned int i = 0; i < jointCount; ++i)
+    {
+        GP_ASSERT(skin->_joints[i]);
+        _poseTransforms[i] = skin->_joints[i];
+    }
+    return jointCount > 0 ? &_poseTransforms[0] : NULL;
+}
+
 void AnimationController::schedule(AnimationClip* clip)
 {
     if (_runningClips.empty())
@@ -71,22 +276,27 @@ void AnimationController::schedule(AnimationClip* clip)
 
     GP_ASSERT(clip);
     clip->addRef();
+    clip->_lodTarget = findLodTarget(clip);
+    bindPose(clip);
     _runningClips.push_back(clip);
 }
 
 void AnimationController::unschedule(AnimationClip* clip)
 {
-    std::list<AnimationClip*>::iterator clipItr = _runningClips.begin();
-    while (clipItr != _runningClips.end())
+    std::vector<AnimationClip*>::iterator clipItr = std::find(_runningClips.begin(), _runningClips.end(), clip);
+    if (clipItr != _runningClips.end())
     {
-        AnimationClip* rClip = (*clipItr);
-        if (rClip == clip)
+        if (_updating)
+        {
+            // The clip may be the one notifying its listeners, so its slot is cleared and it is released after the update.
+            *clipItr = NULL;
+            _removedClips.push_back(clip);
+        }
+        else
         {
             _runningClips.erase(clipItr);
             SAFE_RELEASE(clip);
-            break;
         }
-        clipItr++;
     }
 
     if (_runningClips.empty())
@@ -95,42 +305,170 @@ void AnimationController::unschedule(AnimationClip* clip)
 
 void AnimationController::update(float elapsedTime)
 {
+    GP_PROFILE_SCOPE("AnimationController::update");
+
     if (_state != RUNNING)
         return;
     
     Transform::suspendTransformChanged();
+    _updating = true;
 
-    // Loop through running clips and call update() on them.
-    std::list<AnimationClip*>::iterator clipIter = _runningClips.begin();
-    while (clipIter != _runningClips.end())
+    // Advance the running clips in order, since their listeners may play, stop or restart other clips.
+    // Clips added during the loop are at the back and are advanced in the same update.
+    _evaluatedClips.clear();
+    const unsigned int frame = Game::getInstance()->getFrameNumber();
+    unsigned int skippedCount = 0;
+    bool layered = false;
+    for (size_t i = 0; i < _runningClips.size(); ++i)
     {
-        AnimationClip* clip = (*clipIter);
-        GP_ASSERT(clip);
-        clip->addRef();
+        AnimationClip* clip = _runningClips[i];
+        if (!clip)
+            continue;
+
         if (clip->isClipStateBitSet(AnimationClip::CLIP_IS_RESTARTED_BIT))
         {   // If the CLIP_IS_RESTARTED_BIT is set, we should end the clip and 
-            // move it from where it is in the running clips list to the back.
+            // move it from where it is in the running clips to the back.
             clip->onEnd();
             clip->setClipStateBit(AnimationClip::CLIP_IS_PLAYING_BIT);
+            _runningClips[i] = NULL;
             _runningClips.push_back(clip);
-            clipIter = _runningClips.erase(clipIter);
         }
-        else if (clip->update(elapsedTime))
+        else if (clip->advance(elapsedTime))
+        {
+            if (_runningClips[i] == clip)
+            {
+                _runningClips[i] = NULL;
+                _removedClips.push_back(clip);
+            }
+        }
+        else if (clip->_evaluatePending)
+        {
+            if (!_lodEnabled || isLodEvaluated(clip, frame))
+            {
+                // Binding the clip to a skin whose joints changed must be done before it samples into its pose.
+                if (clip->_poseJoint)
+                    getPoseSkin(clip);
+                layered |= clip->_layer != 0;
+                _evaluatedClips.push_back((unsigned int)i);
+            }
+            else
+            {
+                clip->_evaluatePending = false;
+                ++skippedCount;
+            }
+        }
+    }
+    GP_PROFILE_COUNTER("Animation clips skipped by LOD", skippedCount);
+
+    // Sampling the curves of a clip only writes to its own values, so the clips are evaluated independently.
+    const unsigned int evaluatedCount = (unsigned int)_evaluatedClips.size();
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem && evaluatedCount >= ANIMATION_PARALLEL_EVALUATE_CLIPS)
+    {
+        GP_PROFILE_SCOPE("AnimationController::evaluate");
+        jobSystem->parallelFor(0, evaluatedCount, [this](unsigned int first, unsigned int last)
+        {
+            for (unsigned int i = first; i < last; ++i)
+            {
+                if (AnimationClip* clip = _runningClips[_evaluatedClips[i]])
+                    clip->evaluate();
+            }
+        });
+    }
+    else
+    {
+        for (unsigned int i = 0; i < evaluatedCount; ++i)
+        {
+            if (AnimationClip* clip = _runningClips[_evaluatedClips[i]])
+                clip->evaluate();
+        }
+    }
+
+    // Blend the clips on higher layers after the clips below them.
+    if (layered)
+    {
+        std::stable_sort(_evaluatedClips.begin(), _evaluatedClips.end(), [this](unsigned int a, unsigned int b)
         {
-            clip->release();
-            clipIter = _runningClips.erase(clipIter);
+            const AnimationClip* clipA = _runningClips[a];
+            const AnimationClip* clipB = _runningClips[b];
+            return (clipA ? clipA->_layer : 0) < (clipB ? clipB->_layer : 0);
+        });
+    }
+
+    // Blend the clips animating the joints of a skin into its pose, and set the values of the
+    // other clips on their targets, in order so that blending onto the targets is deterministic.
+    ++_updateCount;
+    _blendedSkins.clear();
+    for (unsigned int i = 0; i < evaluatedCount; ++i)
+    {
+        AnimationClip* clip = _runningClips[_evaluatedClips[i]];
+        if (!clip || !clip->_evaluatePending)
+            continue;
+
+        MeshSkin* skin = getPoseSkin(clip);
+        if (skin)
+        {
+            // The pose of a skin starts from the current transforms of its joints, like the targets of the other clips.
+            if (!skin->_pose || skin->_poseFrame != _updateCount)
+            {
+                if (!skin->_pose)
+                    skin->_pose = new AnimationPose();
+                if (skin->_pose->getTransformCount() != skin->getJointCount())
+                    skin->_pose->resize(skin->getJointCount());
+                skin->_pose->capture(getPoseTransforms(skin));
+                skin->_poseFrame = _updateCount;
+                _blendedSkins.push_back(skin);
+            }
+            skin->_pose->blend(*clip->_pose, clip->_blendWeight);
         }
         else
         {
-            clipIter++;
+            clip->applyValues();
         }
-        clip->release();
     }
 
+    // Write the blended poses to the joints, once per skin.
+    for (size_t i = 0, count = _blendedSkins.size(); i < count; ++i)
+    {
+        _blendedSkins[i]->applyPose();
+    }
+
+    // End the applied clips that finished, in order.
+    for (unsigned int i = 0; i < evaluatedCount; ++i)
+    {
+        const unsigned int slot = _evaluatedClips[i];
+        AnimationClip* clip = _runningClips[slot];
+        if (!clip || !clip->_evaluatePending)
+            continue;
+
+        clip->_evaluatePending = false;
+        if (clip->checkEnded() && _runningClips[slot] == clip)
+        {
+            _runningClips[slot] = NULL;
+            _removedClips.push_back(clip);
+        }
+    }
+
+    _updating = false;
+    compactRunningClips();
+
     Transform::resumeTransformChanged();
 
     if (_runningClips.empty())
         _state = IDLE;
 }
 
+void AnimationController::compactRunningClips()
+{
+    _runningClips.erase(std::remove(_runningClips.begin(), _runningClips.end(), (AnimationClip*)NULL), _runningClips.end());
+
+    // Releasing a clip may destroy it, so this is done once the running clips no longer refer to it.
+    for (size_t i = 0, count = _removedClips.size(); i < count; ++i)
+    {
+        AnimationClip* clip = _removedClips[i];
+        SAFE_RELEASE(clip);
+    }
+    _removedClips.clear();
+}
+
 }
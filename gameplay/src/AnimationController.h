@@ -9,6 +9,9 @@
 namespace gameplay
 {
 
+class MeshSkin;
+class Transform;
+
 /**
  * Defines a class for controlling game animation.
  */
@@ -25,6 +28,83 @@ public:
      * Stops all AnimationClips currently playing on the AnimationController.
      */
     void stopAllAnimations();
+
+    /**
+     * Sets whether running clips on models that are not seen, or seen small, are evaluated less often.
+     *
+     * With animation LOD enabled, a clip whose channels all target the joints of one skinned
+     * model, or one node with a drawable, is evaluated according to how its model was found
+     * by Scene::findVisibleNodes() in the last frame:
+     * <ul>
+     * <li>Models outside the view of every camera and shadow casting light are not evaluated.
+     * <li>Models that are occluded, or smaller on screen than the LOD screen size, are
+     *     evaluated once every LOD update interval frames.
+     * <li>Other models, and the models of scenes that were not culled in the last frame,
+     *     are evaluated every frame.
+     * </ul>
+     * The time of skipped clips still advances and their listeners are still notified, so
+     * a clip catches up with its current time as soon as it is evaluated again, and clips
+     * are always evaluated when they end so they rest on their last pose.
+     *
+     * The joints of a skipped clip do not move, so LOD should not be enabled when animations
+     * move models into view. It is disabled by default.
+     *
+     * @param enabled true to enable animation LOD, false to evaluate all clips every frame.
+     */
+    void setLodEnabled(bool enabled);
+
+    /**
+     * Determines whether animation LOD is enabled.
+     *
+     * @return true if animation LOD is enabled, false otherwise.
+     */
+    bool isLodEnabled() const;
+
+    /**
+     * Sets the screen size below which the clips of a model are evaluated at the reduced rate.
+     *
+     * The size is the diameter of the bounding sphere of the model as a fraction of the
+     * height of the view of the active camera of its scene. The default is 0.1.
+     *
+     * @param size The LOD screen size.
+     */
+    void setLodScreenSize(float size);
+
+    /**
+     * Gets the screen size below which the clips of a model are evaluated at the reduced rate.
+     *
+     * @return The LOD screen size.
+     */
+    float getLodScreenSize() const;
+
+    /**
+     * Sets the number of frames between evaluations of the clips of small or occluded models.
+     *
+     * Models are spread over the frames of the interval, so that their clips are not all
+     * evaluated in the same frame. The default is 4.
+     *
+     * @param frames The LOD update interval, at least 1.
+     */
+    void setLodUpdateInterval(unsigned int frames);
+
+    /**
+     * Gets the number of frames between evaluations of the clips of small or occluded models.
+     *
+     * @return The LOD update interval.
+     */
+    unsigned int getLodUpdateInterval() const;
+
+    /**
+     * Advances the clips that are playing by the given time, as the game does once per frame.
+     *
+     * Games do not need to call this. It is meant for tools and benchmarks that measure or
+     * drive the animations outside of the game loop. Nothing is advanced while the
+     * controller is paused.
+     *
+     * @param elapsedTime The time to advance the clips by, in milliseconds.
+     * @script{ignore}
+     */
+    void advance(float elapsedTime);
        
 private:
 
@@ -93,11 +173,63 @@ private:
     
     /**
      * Callback for when the controller receives a frame update event.
+     *
+     * Running clips are advanced and notify their listeners in order, then the curves of
+     * the advanced clips are sampled, in parallel when there are enough of them, and the
+     * sampled values are finally set on their targets in layer order. Clips animating the
+     * joints of a skin are blended into an AnimationPose of the skin instead, which is
+     * written to its joints once they are all blended.
      */
     void update(float elapsedTime);
+
+    /**
+     * Removes the clips that were unscheduled during an update from the running clips.
+     */
+    void compactRunningClips();
+
+    /**
+     * Gets the node whose visibility decides how often an animated node is evaluated: the
+     * model of the skin of a joint, or the node itself when it has a drawable.
+     */
+    static Node* getVisibilityNode(Node* node);
+
+    /**
+     * Finds a target of a clip whose visibility node is the one of all of its targets, or NULL if there is none.
+     */
+    static Node* findLodTarget(AnimationClip* clip);
+
+    /**
+     * Binds a clip whose channels all animate the joints of one skin to the joints of the skin,
+     * so that it is blended through a pose, or leaves it unbound if it does not.
+     */
+    static void bindPose(AnimationClip* clip);
+
+    /**
+     * Gets the skin that a clip is blended into the pose of, binding the clip again if the skin changed, or NULL if there is none.
+     */
+    static MeshSkin* getPoseSkin(AnimationClip* clip);
+
+    /**
+     * Gets the joints of a skin as transforms, for its pose to be captured from or applied to.
+     */
+    Transform* const* getPoseTransforms(MeshSkin* skin);
+
+    /**
+     * Determines whether an advanced clip is evaluated this frame under animation LOD.
+     */
+    bool isLodEvaluated(AnimationClip* clip, unsigned int frame) const;
     
     State _state;                                 // The current state of the AnimationController.
-    std::list<AnimationClip*> _runningClips;      // A list of running AnimationClips.
+    std::vector<AnimationClip*> _runningClips;    // The running AnimationClips, with NULL slots for clips removed during an update.
+    std::vector<unsigned int> _evaluatedClips;    // Slots of the running clips advanced by the current update.
+    std::vector<AnimationClip*> _removedClips;    // Clips removed during the current update, released once it is done.
+    bool _updating;                               // Whether the running clips are being updated.
+    std::vector<MeshSkin*> _blendedSkins;         // Skins whose poses the clips of the current update are blended into.
+    std::vector<Transform*> _poseTransforms;      // The joints of the skin whose pose is being captured or applied.
+    unsigned int _updateCount;                    // The number of updates, which tells the poses captured by the current one.
+    bool _lodEnabled;                             // Whether clips on models that are not seen or seen small are evaluated less often.
+    float _lodScreenSize;                         // The screen size below which clips are evaluated at the reduced rate.
+    unsigned int _lodUpdateInterval;              // The number of frames between evaluations at the reduced rate.
 };
 
 }
@@ -0,0 +1,268 @@
+#include "Base.h"
+#include "AnimationPose.h"
+#include "Transform.h"
+#include "MathUtil.h"
+
+// The number of transforms that the arrays of a pose are padded to a multiple of.
+#define ANIMATION_POSE_ALIGNMENT 4
+
+namespace gameplay
+{
+
+// The components of the pose written by a Transform animation property, and the index of the value of each.
+struct PropertyComponents
+{
+    unsigned int count;
+    unsigned char components[AnimationPose::COMPONENT_COUNT];
+    unsigned char values[AnimationPose::COMPONENT_COUNT];
+};
+
+static bool getPropertyComponents(int propertyId, PropertyComponents* out)
+{
+    static const PropertyComponents scaleUnit = { 3, { AnimationPose::SCALE_X, AnimationPose::SCALE_Y, AnimationPose::SCALE_Z }, { 0, 0, 0 } };
+    static const PropertyComponents scale = { 3, { AnimationPose::SCALE_X, AnimationPose::SCALE_Y, AnimationPose::SCALE_Z }, { 0, 1, 2 } };
+    static const PropertyComponents scaleX = { 1, { AnimationPose::SCALE_X }, { 0 } };
+    static const PropertyComponents scaleY = { 1, { AnimationPose::SCALE_Y }, { 0 } };
+    static const PropertyComponents scaleZ = { 1, { AnimationPose::SCALE_Z }, { 0 } };
+    static const PropertyComponents rotate = { 4, { AnimationPose::ROTATION_X, AnimationPose::ROTATION_Y, AnimationPose::ROTATION_Z, AnimationPose::ROTATION_W }, { 0, 1, 2, 3 } };
+    static const PropertyComponents translate = { 3, { AnimationPose::TRANSLATION_X, AnimationPose::TRANSLATION_Y, AnimationPose::TRANSLATION_Z }, { 0, 1, 2 } };
+    static const PropertyComponents translateX = { 1, { AnimationPose::TRANSLATION_X }, { 0 } };
+    static const PropertyComponents translateY = { 1, { AnimationPose::TRANSLATION_Y }, { 0 } };
+    static const PropertyComponents translateZ = { 1, { AnimationPose::TRANSLATION_Z }, { 0 } };
+    static const PropertyComponents rotateTranslate = { 7,
+        { AnimationPose::ROTATION_X, AnimationPose::ROTATION_Y, AnimationPose::ROTATION_Z, AnimationPose::ROTATION_W,
+          AnimationPose::TRANSLATION_X, AnimationPose::TRANSLATION_Y, AnimationPose::TRANSLATION_Z },
+        { 0, 1, 2, 3, 4, 5, 6 } };
+    static const PropertyComponents scaleRotate = { 7,
+        { AnimationPose::SCALE_X, AnimationPose::SCALE_Y, AnimationPose::SCALE_Z,
+          AnimationPose::ROTATION_X, AnimationPose::ROTATION_Y, AnimationPose::ROTATION_Z, AnimationPose::ROTATION_W },
+        { 0, 1, 2, 3, 4, 5, 6 } };
+    static const PropertyComponents scaleTranslate = { 6,
+        { AnimationPose::SCALE_X, AnimationPose::SCALE_Y, AnimationPose::SCALE_Z,
+          AnimationPose::TRANSLATION_X, AnimationPose::TRANSLATION_Y, AnimationPose::TRANSLATION_Z },
+        { 0, 1, 2, 3, 4, 5 } };
+    static const PropertyComponents scaleRotateTranslate = { 10,
+        { AnimationPose::SCALE_X, AnimationPose::SCALE_Y, AnimationPose::SCALE_Z,
+          AnimationPose::ROTATION_X, AnimationPose::ROTATION_Y, AnimationPose::ROTATION_Z, AnimationPose::ROTATION_W,
+          AnimationPose::TRANSLATION_X, AnimationPose::TRANSLATION_Y, AnimationPose::TRANSLATION_Z },
+        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 } };
+
+    switch (propertyId)
+    {
+    case Transform::ANIMATE_SCALE_UNIT:
+        *out = scaleUnit;
+        return true;
+    case Transform::ANIMATE_SCALE:
+        *out = scale;
+        return true;
+    case Transform::ANIMATE_SCALE_X:
+        *out = scaleX;
+        return true;
+    case Transform::ANIMATE_SCALE_Y:
+        *out = scaleY;
+        return true;
+    case Transform::ANIMATE_SCALE_Z:
+        *out = scaleZ;
+        return true;
+    case Transform::ANIMATE_ROTATE:
+        *out = rotate;
+        return true;
+    case Transform::ANIMATE_TRANSLATE:
+        *out = translate;
+        return true;
+    case Transform::ANIMATE_TRANSLATE_X:
+        *out = translateX;
+        return true;
+    case Transform::ANIMATE_TRANSLATE_Y:
+        *out = translateY;
+        return true;
+    case Transform::ANIMATE_TRANSLATE_Z:
+        *out = translateZ;
+        return true;
+    case Transform::ANIMATE_ROTATE_TRANSLATE:
+        *out = rotateTranslate;
+        return true;
+    case Transform::ANIMATE_SCALE_ROTATE:
+        *out = scaleRotate;
+        return true;
+    case Transform::ANIMATE_SCALE_TRANSLATE:
+        *out = scaleTranslate;
+        return true;
+    case Transform::ANIMATE_SCALE_ROTATE_TRANSLATE:
+        *out = scaleRotateTranslate;
+        return true;
+    default:
+        return false;
+    }
+}
+
+AnimationPose::AnimationPose(unsigned int transformCount)
+    : _transformCount(0), _stride(0)
+{
+    resize(transformCount);
+}
+
+AnimationPose::~AnimationPose()
+{
+}
+
+unsigned int AnimationPose::getTransformCount() const
+{
+    return _transformCount;
+}
+
+void AnimationPose::resize(unsigned int transformCount)
+{
+    _transformCount = transformCount;
+    _stride = (transformCount + ANIMATION_POSE_ALIGNMENT - 1) / ANIMATION_POSE_ALIGNMENT * ANIMATION_POSE_ALIGNMENT;
+    _data.assign(2 * COMPONENT_COUNT * _stride, 0.0f);
+}
+
+float* AnimationPose::getValues(Component component)
+{
+    GP_ASSERT(component < COMPONENT_COUNT);
+    return _data.empty() ? NULL : &_data[component * _stride];
+}
+
+const float* AnimationPose::getValues(Component component) const
+{
+    GP_ASSERT(component < COMPONENT_COUNT);
+    return _data.empty() ? NULL : &_data[component * _stride];
+}
+
+float* AnimationPose::getWeights(Component component)
+{
+    GP_ASSERT(component < COMPONENT_COUNT);
+    return _data.empty() ? NULL : &_data[(COMPONENT_COUNT + component) * _stride];
+}
+
+const float* AnimationPose::getWeights(Component component) const
+{
+    GP_ASSERT(component < COMPONENT_COUNT);
+    return _data.empty() ? NULL : &_data[(COMPONENT_COUNT + component) * _stride];
+}
+
+void AnimationPose::setValue(unsigned int index, int propertyId, const float* value)
+{
+    GP_ASSERT(index < _transformCount);
+    GP_ASSERT(value);
+
+    PropertyComponents property;
+    if (!getPropertyComponents(propertyId, &property))
+        return;
+    for (unsigned int i = 0; i < property.count; ++i)
+    {
+        _data[property.components[i] * _stride + index] = value[property.values[i]];
+    }
+}
+
+void AnimationPose::setWeight(unsigned int index, int propertyId, float weight)
+{
+    GP_ASSERT(index < _transformCount);
+
+    PropertyComponents property;
+    if (!getPropertyComponents(propertyId, &property))
+        return;
+    for (unsigned int i = 0; i < property.count; ++i)
+    {
+        _data[(COMPONENT_COUNT + property.components[i]) * _stride + index] = weight;
+    }
+}
+
+void AnimationPose::capture(Transform* const* transforms)
+{
+    GP_ASSERT(transforms || _transformCount == 0);
+
+    for (unsigned int i = 0; i < _transformCount; ++i)
+    {
+        const Transform* transform = transforms[i];
+        GP_ASSERT(transform);
+        const Vector3& scale = transform->getScale();
+        const Quaternion& rotation = transform->getRotation();
+        const Vector3& translation = transform->getTranslation();
+        _data[SCALE_X * _stride + i] = scale.x;
+        _data[SCALE_Y * _stride + i] = scale.y;
+        _data[SCALE_Z * _stride + i] = scale.z;
+        _data[ROTATION_X * _stride + i] = rotation.x;
+        _data[ROTATION_Y * _stride + i] = rotation.y;
+        _data[ROTATION_Z * _stride + i] = rotation.z;
+        _data[ROTATION_W * _stride + i] = rotation.w;
+        _data[TRANSLATION_X * _stride + i] = translation.x;
+        _data[TRANSLATION_Y * _stride + i] = translation.y;
+        _data[TRANSLATION_Z * _stride + i] = translation.z;
+    }
+    std::fill(_data.begin() + COMPONENT_COUNT * _stride, _data.end(), 0.0f);
+}
+
+void AnimationPose::blend(const AnimationPose& pose, float blendWeight)
+{
+    GP_ASSERT(pose._transformCount == _transformCount);
+
+    const unsigned int count = _stride;
+    if (count == 0)
+        return;
+
+    // Scales and translations are lerped component by component.
+    static const Component linearComponents[] = { SCALE_X, SCALE_Y, SCALE_Z, TRANSLATION_X, TRANSLATION_Y, TRANSLATION_Z };
+    for (unsigned int c = 0; c < sizeof(linearComponents) / sizeof(linearComponents[0]); ++c)
+    {
+        float* dst = getValues(linearComponents[c]);
+        float* dstWeights = getWeights(linearComponents[c]);
+        const float* src = pose.getValues(linearComponents[c]);
+        const float* srcWeights = pose.getWeights(linearComponents[c]);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            dst[i] += blendWeight * srcWeights[i] * (src[i] - dst[i]);
+            dstWeights[i] = std::max(dstWeights[i], srcWeights[i]);
+        }
+    }
+
+    // Rotations are lerped in the hemisphere of the destination with a corrected interpolation factor, and normalized.
+    float* dstWeights = getWeights(ROTATION_X);
+    const float* srcWeights = pose.getWeights(ROTATION_X);
+    MathUtil::blendQuaternionArray(getValues(ROTATION_X), getValues(ROTATION_Y), getValues(ROTATION_Z), getValues(ROTATION_W),
+                                   pose.getValues(ROTATION_X), pose.getValues(ROTATION_Y), pose.getValues(ROTATION_Z), pose.getValues(ROTATION_W),
+                                   srcWeights, blendWeight, count);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        dstWeights[i] = std::max(dstWeights[i], srcWeights[i]);
+    }
+}
+
+void AnimationPose::apply(Transform* const* transforms) const
+{
+    GP_ASSERT(transforms || _transformCount == 0);
+
+    Vector3 scale;
+    Quaternion rotation;
+    Vector3 translation;
+    for (unsigned int i = 0; i < _transformCount; ++i)
+    {
+        if (!getTransform(i, &scale, &rotation, &translation))
+            continue;
+
+        Transform* transform = transforms[i];
+        GP_ASSERT(transform);
+        transform->set(scale, rotation, translation);
+    }
+}
+
+bool AnimationPose::getTransform(unsigned int index, Vector3* scale, Quaternion* rotation, Vector3* translation) const
+{
+    GP_ASSERT(index < _transformCount);
+    GP_ASSERT(scale && rotation && translation);
+
+    const unsigned int i = index;
+    if (_data[(COMPONENT_COUNT + SCALE_X) * _stride + i] == 0.0f && _data[(COMPONENT_COUNT + SCALE_Y) * _stride + i] == 0.0f &&
+        _data[(COMPONENT_COUNT + SCALE_Z) * _stride + i] == 0.0f && _data[(COMPONENT_COUNT + ROTATION_X) * _stride + i] == 0.0f &&
+        _data[(COMPONENT_COUNT + TRANSLATION_X) * _stride + i] == 0.0f && _data[(COMPONENT_COUNT + TRANSLATION_Y) * _stride + i] == 0.0f &&
+        _data[(COMPONENT_COUNT + TRANSLATION_Z) * _stride + i] == 0.0f)
+        return false;
+
+    scale->set(_data[SCALE_X * _stride + i], _data[SCALE_Y * _stride + i], _data[SCALE_Z * _stride + i]);
+    rotation->set(_data[ROTATION_X * _stride + i], _data[ROTATION_Y * _stride + i], _data[ROTATION_Z * _stride + i], _data[ROTATION_W * _stride + i]);
+    translation->set(_data[TRANSLATION_X * _stride + i], _data[TRANSLATION_Y * _stride + i], _data[TRANSLATION_Z * _stride + i]);
+    return true;
+}
+
+}
@@ -0,0 +1,191 @@
+#ifndef ANIMATIONPOSE_H_
+#define ANIMATIONPOSE_H_
+
+namespace gameplay
+{
+
+class Transform;
+class Vector3;
+class Quaternion;
+
+/**
+ * Defines the local scale, rotation and translation of a set of transforms, such as the
+ * joints of a skin, stored as structures of arrays.
+ *
+ * Each component of the pose (the x of the translations of all transforms, for example) is a
+ * contiguous array, so poses are blended with loops over the transforms that the compiler
+ * vectorizes, rather than property by property on each transform. Each component also has a
+ * weight per transform, which is zero for the components a pose does not animate.
+ *
+ * AnimationController blends the clips animating the joints of a skin through poses: each
+ * clip samples its curves into a pose of its own, the poses of the clips are blended in the
+ * order of their layers into the pose of the skin, and the result is written to the joints
+ * once per frame.
+ *
+ * Rotations are blended with normalized linear interpolation, with the interpolation factor
+ * corrected so that the result stays within about a thousandth of a radian of spherical interpolation.
+ *
+ * @script{ignore}
+ */
+class AnimationPose
+{
+public:
+
+    /**
+     * The components of a pose.
+     */
+    enum Component
+    {
+        SCALE_X,
+        SCALE_Y,
+        SCALE_Z,
+        ROTATION_X,
+        ROTATION_Y,
+        ROTATION_Z,
+        ROTATION_W,
+        TRANSLATION_X,
+        TRANSLATION_Y,
+        TRANSLATION_Z,
+        COMPONENT_COUNT
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param transformCount The number of transforms of the pose.
+     */
+    AnimationPose(unsigned int transformCount = 0);
+
+    /**
+     * Destructor.
+     */
+    ~AnimationPose();
+
+    /**
+     * Gets the number of transforms of the pose.
+     *
+     * @return The transform count.
+     */
+    unsigned int getTransformCount() const;
+
+    /**
+     * Sets the number of transforms of the pose, setting the weights of all components to zero.
+     *
+     * @param transformCount The new transform count.
+     */
+    void resize(unsigned int transformCount);
+
+    /**
+     * Gets the values of a component of the pose, one per transform.
+     *
+     * @param component The component.
+     *
+     * @return The values of the component.
+     */
+    float* getValues(Component component);
+
+    /**
+     * Gets the values of a component of the pose, one per transform.
+     *
+     * @param component The component.
+     *
+     * @return The values of the component.
+     */
+    const float* getValues(Component component) const;
+
+    /**
+     * Gets the weights of a component of the pose, one per transform.
+     *
+     * The four components of a rotation share the weights of ROTATION_X.
+     *
+     * @param component The component.
+     *
+     * @return The weights of the component.
+     */
+    float* getWeights(Component component);
+
+    /**
+     * Gets the weights of a component of the pose, one per transform.
+     *
+     * @param component The component.
+     *
+     * @return The weights of the component.
+     */
+    const float* getWeights(Component component) const;
+
+    /**
+     * Sets the components of a transform written by an animation property from its value.
+     *
+     * @param index The index of the transform.
+     * @param propertyId The Transform animation property, such as Transform::ANIMATE_ROTATE_TRANSLATE.
+     * @param value The value of the property.
+     */
+    void setValue(unsigned int index, int propertyId, const float* value);
+
+    /**
+     * Sets the weights of the components of a transform written by an animation property.
+     *
+     * @param index The index of the transform.
+     * @param propertyId The Transform animation property, such as Transform::ANIMATE_ROTATE_TRANSLATE.
+     * @param weight The weight of the components.
+     */
+    void setWeight(unsigned int index, int propertyId, float weight);
+
+    /**
+     * Sets the values of the pose to the local transforms of a set of transforms and their weights to zero.
+     *
+     * @param transforms The transforms, as many as the pose has.
+     */
+    void capture(Transform* const* transforms);
+
+    /**
+     * Blends another pose into this pose.
+     *
+     * Each component moves towards the one of the other pose by the blend weight multiplied
+     * by the weight of the component in the other pose. The weights of this pose become the
+     * largest of the weights of the two poses.
+     *
+     * @param pose The pose to blend, with the same number of transforms as this pose.
+     * @param blendWeight The weight of the other pose, between 0 and 1.
+     */
+    void blend(const AnimationPose& pose, float blendWeight);
+
+    /**
+     * Sets the local transforms of the transforms that the pose has a weight for.
+     *
+     * @param transforms The transforms, as many as the pose has.
+     */
+    void apply(Transform* const* transforms) const;
+
+    /**
+     * Gets the local transform of a transform of the pose, if the pose has a weight for it.
+     *
+     * @param index The index of the transform.
+     * @param scale Set to the scale of the transform.
+     * @param rotation Set to the rotation of the transform.
+     * @param translation Set to the translation of the transform.
+     *
+     * @return true if the pose has a weight for the transform, false if it leaves it unchanged.
+     */
+    bool getTransform(unsigned int index, Vector3* scale, Quaternion* rotation, Vector3* translation) const;
+
+private:
+
+    /**
+     * Hidden copy constructor.
+     */
+    AnimationPose(const AnimationPose&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    AnimationPose& operator=(const AnimationPose&);
+
+    unsigned int _transformCount;
+    unsigned int _stride;
+    std::vector<float> _data;
+};
+
+}
+
+#endif
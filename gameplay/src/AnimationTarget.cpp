@@ -279,6 +279,9 @@ Animation* AnimationTarget::createAnimation(const char* id, Properties* animatio
         }
     }
     
+    if (animationProperties->exists("bakeError"))
+        animation->bake(animationProperties->getFloat("bakeError"));
+
     SAFE_DELETE_ARRAY(keyOut);
     SAFE_DELETE_ARRAY(keyIn);
     SAFE_DELETE_ARRAY(keyValues);
@@ -19,6 +19,7 @@ class AnimationTarget
 {
     friend class Animation;
     friend class AnimationClip;
+    friend class SceneSnapshot;
 
 public:
 
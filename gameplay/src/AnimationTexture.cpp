@@ -0,0 +1,147 @@
+#include "Base.h"
+#include "AnimationTexture.h"
+#include "AnimationClip.h"
+#include "AnimationPose.h"
+#include "JointTexture.h"
+#include "MeshSkin.h"
+#include "Joint.h"
+#include "Game.h"
+#include "GLStateCache.h"
+
+namespace gameplay
+{
+
+AnimationTexture::AnimationTexture()
+    : _sampler(NULL), _frameCount(0), _jointCount(0), _duration(0.0f), _framesPerSecond(0.0f)
+{
+}
+
+AnimationTexture::~AnimationTexture()
+{
+    SAFE_RELEASE(_sampler);
+}
+
+AnimationTexture* AnimationTexture::create(MeshSkin* skin, AnimationClip* clip, float framesPerSecond)
+{
+    GP_ASSERT(skin);
+    GP_ASSERT(clip && clip->_animation);
+    GP_ASSERT(framesPerSecond > 0.0f);
+
+#ifdef GP_USE_FLOAT_TEXTURES
+    if (!JointTexture::isSupported())
+    {
+        GP_WARN("Animation textures are not supported on this platform.");
+        return NULL;
+    }
+
+    const unsigned int jointCount = skin->getJointCount();
+    const float duration = clip->_duration * 0.001f;
+    if (jointCount == 0 || duration <= 0.0f)
+    {
+        GP_WARN("Failed to bake animation clip '%s': it has no duration or its skin has no joints.", clip->getId());
+        return NULL;
+    }
+
+    // The clip can only be sampled by setting it on the joints of the skin.
+    std::vector<Transform*> joints(jointCount);
+    for (unsigned int i = 0; i < jointCount; ++i)
+    {
+        joints[i] = skin->getJoint(i);
+    }
+    const std::vector<Animation::Channel*>& channels = clip->_animation->_channels;
+    for (size_t i = 0, count = channels.size(); i < count; ++i)
+    {
+        if (std::find(joints.begin(), joints.end(), static_cast<Transform*>(dynamic_cast<Joint*>(channels[i]->_target))) == joints.end())
+        {
+            GP_WARN("Failed to bake animation clip '%s': it animates a target that is not a joint of the skin.", clip->getId());
+            return NULL;
+        }
+    }
+
+    // The frames are spread evenly over the clip, at least as densely as requested.
+    const unsigned int intervals = std::max(1u, (unsigned int)ceil(duration * framesPerSecond));
+    const unsigned int frameCount = intervals + 1;
+    const unsigned int width = skin->getMatrixPaletteSize();
+    GLint maxSize = 0;
+    GL_ASSERT( glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize) );
+    if (width > (unsigned int)maxSize || frameCount > (unsigned int)maxSize)
+    {
+        GP_WARN("Failed to bake animation clip '%s': %u frames of %u joints do not fit in a %dx%d texture.", clip->getId(), frameCount, jointCount, maxSize, maxSize);
+        return NULL;
+    }
+
+    // Keep the current pose of the joints, and the position and weight of the clip, to restore them.
+    AnimationPose pose(jointCount);
+    pose.capture(&joints[0]);
+    for (int component = AnimationPose::SCALE_X; component < AnimationPose::COMPONENT_COUNT; ++component)
+    {
+        float* weights = pose.getWeights((AnimationPose::Component)component);
+        std::fill(weights, weights + jointCount, 1.0f);
+    }
+    const float percentComplete = clip->_percentComplete;
+    const float blendWeight = clip->_blendWeight;
+
+    std::vector<Vector4> texels(width * frameCount);
+    clip->_blendWeight = 1.0f;
+    for (unsigned int frame = 0; frame < frameCount; ++frame)
+    {
+        clip->_percentComplete = (float)frame / (float)intervals;
+        clip->evaluate();
+        clip->applyValues();
+        const Vector4* palette = skin->getMatrixPalette();
+        std::copy(palette, palette + width, texels.begin() + frame * width);
+    }
+    clip->_percentComplete = percentComplete;
+    clip->_blendWeight = blendWeight;
+    pose.apply(&joints[0]);
+
+    TextureHandle handle;
+    GL_ASSERT( glGenTextures(1, &handle) );
+    GLStateCache::bindTexture(GL_TEXTURE_2D, handle);
+    GL_ASSERT( glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, width, frameCount, 0, GL_RGBA, GL_FLOAT, &texels[0]) );
+    Texture* texture = Texture::create(handle, width, frameCount);
+
+    AnimationTexture* animationTexture = new AnimationTexture();
+    animationTexture->_sampler = Texture::Sampler::create(texture);
+    SAFE_RELEASE(texture);
+    animationTexture->_sampler->setFilterMode(Texture::NEAREST, Texture::NEAREST);
+    animationTexture->_sampler->setWrapMode(Texture::CLAMP, Texture::CLAMP);
+    animationTexture->_frameCount = frameCount;
+    animationTexture->_jointCount = jointCount;
+    animationTexture->_duration = duration;
+    animationTexture->_framesPerSecond = intervals / duration;
+    return animationTexture;
+#else
+    GP_WARN("Animation textures are not supported on this platform.");
+    return NULL;
+#endif
+}
+
+Texture::Sampler* AnimationTexture::getSampler() const
+{
+    return _sampler;
+}
+
+unsigned int AnimationTexture::getFrameCount() const
+{
+    return _frameCount;
+}
+
+unsigned int AnimationTexture::getJointCount() const
+{
+    return _jointCount;
+}
+
+float AnimationTexture::getDuration() const
+{
+    return _duration;
+}
+
+Vector4 AnimationTexture::getParameters() const
+{
+    // The time is wrapped in double precision, so that it stays precise however long the game runs.
+    const float time = (float)fmod(Game::getGameTime() * 0.001, (double)_duration);
+    return Vector4((float)(_frameCount - 1), _framesPerSecond, time, 1.0f / _sampler->getTexture()->getWidth());
+}
+
+}
@@ -0,0 +1,131 @@
+#ifndef ANIMATIONTEXTURE_H_
+#define ANIMATIONTEXTURE_H_
+
+#include "Ref.h"
+#include "Texture.h"
+#include "Vector4.h"
+
+namespace gameplay
+{
+
+class MeshSkin;
+class AnimationClip;
+
+/**
+ * Defines a floating point texture that an AnimationClip of a MeshSkin is baked into, so that
+ * crowds of models can play it on the GPU without being animated by the AnimationController.
+ *
+ * Each row of the texture holds the matrix palette of the skin at one frame of the clip,
+ * sampled at a fixed rate. Shaders compiled with SKINNING and SKINNING_ANIMATION_TEXTURE
+ * defined read the palette of the current frame from the texture, interpolating between
+ * the two nearest frames, instead of from the MATRIX_PALETTE of a skin:
+ * <ul>
+ * <li>u_animationTexture is set to getSampler().
+ * <li>u_animationParameters is bound to getParameters(), with MaterialParameter::bindValue().
+ * <li>a_instanceData is bound to RenderState::INSTANCE_DATA, whose x is the time offset in
+ *     seconds at which each model plays the clip, set with Model::setInstanceData().
+ * </ul>
+ * The models of a crowd share the mesh of the skinned model and its material, and have no
+ * skin of their own, so that a RenderQueue draws them with hardware instancing when the
+ * material also binds a_instanceMatrix to RenderState::INSTANCE_WORLD_MATRIX.
+ *
+ * The clip always loops at its own speed, and a baked texture does not follow later changes
+ * to the clip or to the joints of the skin. The texture is as wide as three times the joint
+ * count and as high as its frame count, which must both fit in the maximum texture size.
+ *
+ * Animation textures require floating point textures and texture fetches in vertex shaders
+ * (see JointTexture::isSupported()), which are not available on OpenGL ES 2.0.
+ *
+ * @script{ignore}
+ */
+class AnimationTexture : public Ref
+{
+public:
+
+    /**
+     * Bakes an animation clip of the joints of a skin into a new animation texture.
+     *
+     * The clip is sampled by setting the joints of the skin to each of its frames, and the
+     * joints are restored to their current pose afterwards. All of the channels of the clip
+     * must target joints of the skin.
+     *
+     * @param skin The skin whose joints the clip animates.
+     * @param clip The clip to bake, whose duration must not be zero.
+     * @param framesPerSecond The rate at which the clip is sampled.
+     *
+     * @return The new animation texture, or NULL if the clip could not be baked.
+     */
+    static AnimationTexture* create(MeshSkin* skin, AnimationClip* clip, float framesPerSecond = 30.0f);
+
+    /**
+     * Gets the sampler of the texture, for the u_animationTexture uniform.
+     *
+     * @return The sampler.
+     */
+    Texture::Sampler* getSampler() const;
+
+    /**
+     * Gets the number of frames baked into the texture: one per row.
+     *
+     * @return The frame count.
+     */
+    unsigned int getFrameCount() const;
+
+    /**
+     * Gets the number of joints of the skin that the clip was baked on.
+     *
+     * @return The joint count.
+     */
+    unsigned int getJointCount() const;
+
+    /**
+     * Gets the duration of the clip in seconds.
+     *
+     * @return The duration.
+     */
+    float getDuration() const;
+
+    /**
+     * Gets the parameters that shaders play the texture with, for the u_animationParameters uniform.
+     *
+     * These are the number of intervals between the frames, the number of frames per second
+     * (adjusted to fit a whole number of intervals in the clip), the current game time in
+     * seconds wrapped to the duration of the clip, and the reciprocal of the width of the
+     * texture.
+     *
+     * @return The parameters.
+     */
+    Vector4 getParameters() const;
+
+private:
+
+    /**
+     * Constructor.
+     */
+    AnimationTexture();
+
+    /**
+     * Destructor.
+     */
+    ~AnimationTexture();
+
+    /**
+     * Hidden copy constructor.
+     */
+    AnimationTexture(const AnimationTexture& copy);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    AnimationTexture& operator=(const AnimationTexture&);
+
+    Texture::Sampler* _sampler;
+    unsigned int _frameCount;
+    unsigned int _jointCount;
+    float _duration;
+    float _framesPerSecond;
+};
+
+}
+
+#endif
@@ -1,12 +1,15 @@
 #include "Base.h"
 #include "AudioBuffer.h"
 #include "FileSystem.h"
+#include "AudioController.h"
+#include "Game.h"
 
 namespace gameplay
 {
 
 // Audio buffer cache
 static std::vector<AudioBuffer*> __buffers;
+static unsigned int __bufferUseCount = 0;
 
 // Callbacks for loading an ogg file using Stream
 static size_t readStream(void* ptr, size_t size, size_t nmemb, void* datasource)
@@ -38,17 +41,62 @@ static long tellStream(void* datasource)
     return stream->position();
 }
 
+// Callbacks for decoding an ogg file kept compressed in memory
+struct OggMemory
+{
+    const char* data;
+    size_t size;
+    size_t position;
+};
+
+static size_t readMemory(void* ptr, size_t size, size_t nmemb, void* datasource)
+{
+    GP_ASSERT(datasource);
+    OggMemory* memory = reinterpret_cast<OggMemory*>(datasource);
+    if (size == 0)
+        return 0;
+    size_t count = std::min(nmemb, (memory->size - memory->position) / size);
+    memcpy(ptr, memory->data + memory->position, count * size);
+    memory->position += count * size;
+    return count;
+}
+
+static int seekMemory(void *datasource, ogg_int64_t offset, int whence)
+{
+    GP_ASSERT(datasource);
+    OggMemory* memory = reinterpret_cast<OggMemory*>(datasource);
+    ogg_int64_t position = offset;
+    if (whence == SEEK_CUR)
+        position += memory->position;
+    else if (whence == SEEK_END)
+        position += memory->size;
+    if (position < 0 || position > (ogg_int64_t)memory->size)
+        return -1;
+    memory->position = (size_t)position;
+    return 0;
+}
+
+static long tellMemory(void* datasource)
+{
+    GP_ASSERT(datasource);
+    OggMemory* memory = reinterpret_cast<OggMemory*>(datasource);
+    return (long)memory->position;
+}
+
 AudioBuffer::AudioBuffer(const char* path, ALuint* buffer, bool streamed)
-: _filePath(path), _streamed(streamed), _buffersNeededCount(0)
+: _filePath(path), _streamed(streamed), _buffersNeededCount(0), _prefetchStart(0), _prefetchSize(0), _byteSize(0), _lastUsed(0), _cached(false),
+  _decodeState(DECODED), _decodedFormat(0), _decodedFrequency(0)
 {
     memcpy(_alBufferQueue, buffer, sizeof(_alBufferQueue));
 }
 
 AudioBuffer::~AudioBuffer()
 {
-    // Remove the buffer from the cache.
-    unsigned int bufferCount = (unsigned int)__buffers.size();
+    // The decoding job writes into this buffer so it has to finish first.
+    if (_decodeCounter.get())
+        Game::getInstance()->getJobSystem()->wait(_decodeCounter.get());
 
+    // Remove the buffer from the cache.
     if (!_streamed)
     {
         unsigned int bufferCount = (unsigned int)__buffers.size();
@@ -90,11 +138,16 @@ AudioBuffer* AudioBuffer::create(const char* path, bool streamed)
             GP_ASSERT(buffer);
             if (buffer->_filePath.compare(path) == 0)
             {
+                buffer->_lastUsed = ++__bufferUseCount;
                 buffer->addRef();
                 return buffer;
             }
         }
     }
+    AudioController* audioController = Game::getInstance()->getAudioController();
+    GP_ASSERT(audioController);
+    std::vector<char> compressedData;
+
     ALuint alBuffer[STREAMING_BUFFER_QUEUE_SIZE];
     memset(alBuffer, 0, sizeof(alBuffer));
 
@@ -142,6 +195,16 @@ AudioBuffer* AudioBuffer::create(const char* path, bool streamed)
             goto cleanup;
         }
     }
+    else if (memcmp(header, "OggS", 4) == 0 && !streamed && stream->length() <= audioController->getCompressedBufferLimit())
+    {
+        // Keep short sounds compressed and decode them the first time they are played.
+        compressedData.resize(stream->length());
+        if (!stream->rewind() || stream->read(compressedData.data(), 1, compressedData.size()) != compressedData.size())
+        {
+            GP_ERROR("Failed to read ogg file: %s", path);
+            goto cleanup;
+        }
+    }
     else if (memcmp(header, "OggS", 4) == 0)
     {
         // Fill at least one buffer with sound data.
@@ -168,9 +231,33 @@ AudioBuffer* AudioBuffer::create(const char* path, bool streamed)
     else if (buffer->_streamStateOgg.get())
         buffer->_buffersNeededCount = (buffer->_streamStateOgg->dataSize + STREAMING_BUFFER_SIZE - 1) / STREAMING_BUFFER_SIZE;
 
+    if (!compressedData.empty())
+    {
+        buffer->_compressedData.swap(compressedData);
+        buffer->_decodeState = COMPRESSED;
+        buffer->_byteSize = (unsigned int)buffer->_compressedData.size();
+    }
+    else if (!streamed)
+    {
+        ALint size = 0;
+        AL_CHECK( alGetBufferi(alBuffer[0], AL_SIZE, &size) );
+        buffer->_byteSize = (unsigned int)std::max(size, 0);
+    }
+
     if (!streamed)
+    {
+        buffer->_lastUsed = ++__bufferUseCount;
         __buffers.push_back(buffer);
 
+        // The cache holds its own reference so that the buffer outlives its sources while it fits in the budget.
+        if (audioController->getBufferCacheBudget() > 0)
+        {
+            buffer->_cached = true;
+            buffer->addRef();
+            trimCache(audioController->getBufferCacheBudget());
+        }
+    }
+
     return buffer;
     
 cleanup:
@@ -182,6 +269,95 @@ cleanup:
     return NULL;
 }
 
+unsigned int AudioBuffer::getCacheSize()
+{
+    unsigned int size = 0;
+    for (size_t i = 0, count = __buffers.size(); i < count; ++i)
+    {
+        size += __buffers[i]->_byteSize;
+    }
+    return size;
+}
+
+unsigned int AudioBuffer::getCacheCount()
+{
+    return (unsigned int)__buffers.size();
+}
+
+void AudioBuffer::trimCache(unsigned int budget)
+{
+    unsigned int size = getCacheSize();
+    while (size > budget)
+    {
+        // Find the least recently used buffer that no source holds anymore.
+        AudioBuffer* buffer = NULL;
+        for (size_t i = 0, count = __buffers.size(); i < count; ++i)
+        {
+            AudioBuffer* candidate = __buffers[i];
+            if (candidate->_cached && candidate->getRefCount() == 1 && (buffer == NULL || candidate->_lastUsed < buffer->_lastUsed))
+                buffer = candidate;
+        }
+        if (buffer == NULL)
+            break;
+
+        // Releasing the last reference removes the buffer from the cache.
+        size -= buffer->_byteSize;
+        buffer->_cached = false;
+        buffer->release();
+    }
+}
+
+bool AudioBuffer::decode()
+{
+    switch (_decodeState)
+    {
+    case DECODED:
+        return true;
+
+    case COMPRESSED:
+        {
+            _decodeState = DECODING;
+            _decodeCounter.reset(new JobSystem::Counter());
+            Game::getInstance()->getJobSystem()->run([this]()
+            {
+                if (!decodeOgg(_compressedData, &_decodedData, &_decodedFormat, &_decodedFrequency))
+                    _decodedData.clear();
+            }, _decodeCounter.get());
+        }
+        return false;
+
+    case DECODING:
+        {
+            if (!_decodeCounter->isDone())
+                return false;
+            _decodeCounter.reset();
+
+            if (_decodedData.empty())
+            {
+                GP_ERROR("Invalid ogg file: %s", _filePath.c_str());
+                _decodeState = DECODE_FAILED;
+                return false;
+            }
+
+            AL_CHECK( alBufferData(_alBufferQueue[0], _decodedFormat, _decodedData.data(), (ALsizei)_decodedData.size(), _decodedFrequency) );
+            _byteSize = (unsigned int)_decodedData.size();
+            std::vector<char>().swap(_decodedData);
+            std::vector<char>().swap(_compressedData);
+            _decodeState = DECODED;
+
+            // The decoded sound takes more memory than it did compressed.
+            AudioController* audioController = Game::getInstance()->getAudioController();
+            GP_ASSERT(audioController);
+            if (audioController->getBufferCacheBudget() > 0)
+                trimCache(audioController->getBufferCacheBudget());
+        }
+        return true;
+
+    default:
+        return false;
+    }
+}
+
 bool AudioBuffer::loadWav(Stream* stream, ALuint buffer, bool streamed, AudioStreamStateWav* streamState)
 {
     GP_ASSERT(stream);
@@ -326,6 +502,14 @@ bool AudioBuffer::loadWav(Stream* stream, ALuint buffer, bool streamed, AudioStr
                     dataSize = STREAMING_BUFFER_SIZE;
             }
 
+            // Buffer the samples straight from the file when the stream can map it.
+            const void* mapped = stream->map(dataSize);
+            if (mapped)
+            {
+                AL_CHECK( alBufferData(buffer, format, mapped, dataSize, frequency) );
+                return true;
+            }
+
             char* data = new char[dataSize];
             if (stream->read(data, sizeof(char), dataSize) != dataSize)
             {
@@ -466,51 +650,149 @@ bool AudioBuffer::loadOgg(Stream* stream, ALuint buffer, bool streamed, AudioStr
     return true;
 }
 
+bool AudioBuffer::decodeOgg(const std::vector<char>& oggData, std::vector<char>* data, ALenum* format, ALsizei* frequency)
+{
+    GP_ASSERT(data);
+    GP_ASSERT(format);
+    GP_ASSERT(frequency);
+
+    OggMemory memory;
+    memory.data = oggData.data();
+    memory.size = oggData.size();
+    memory.position = 0;
+
+    ov_callbacks callbacks;
+    callbacks.read_func = readMemory;
+    callbacks.seek_func = seekMemory;
+    callbacks.close_func = NULL;
+    callbacks.tell_func = tellMemory;
+
+    OggVorbis_File oggFile;
+    if (ov_open_callbacks(&memory, &oggFile, NULL, 0, callbacks) < 0)
+        return false;
+
+    vorbis_info* info = ov_info(&oggFile, -1);
+    GP_ASSERT(info);
+    *format = info->channels == 1 ? AL_FORMAT_MONO16 : AL_FORMAT_STEREO16;
+    *frequency = info->rate;
+
+    // size = #samples * #channels * 2 (for 16 bit).
+    long dataSize = ov_pcm_total(&oggFile, -1) * info->channels * 2;
+    data->resize(dataSize > 0 ? dataSize : 0);
+
+    long size = 0;
+    int section;
+    while (size < dataSize)
+    {
+        long result = ov_read(&oggFile, data->data() + size, dataSize - size, 0, 2, 1, &section);
+        if (result <= 0)
+            break;
+        size += result;
+    }
+    ov_clear(&oggFile);
+
+    if (size == 0)
+        return false;
+
+    data->resize(size);
+    return true;
+}
+
 bool AudioBuffer::streamData(ALuint buffer, bool looped)
 {
     static char buffers[STREAMING_BUFFER_SIZE];
-    
+
+    ALenum format;
+    ALsizei frequency;
     if (_streamStateWav.get())
     {
-        ALsizei bytesRead = _fileStream->read(buffers, sizeof(char), STREAMING_BUFFER_SIZE);
-        if (bytesRead != STREAMING_BUFFER_SIZE)
-        {
-            if (looped)
-                _fileStream->seek(_streamStateWav->dataStart, SEEK_SET);
-        }
-        if (bytesRead > 0)
-            AL_CHECK(alBufferData(buffer, _streamStateWav->format, buffers, bytesRead, _streamStateWav->frequency));
-        
-        return bytesRead > 0 || looped;
+        format = _streamStateWav->format;
+        frequency = _streamStateWav->frequency;
     }
     else if (_streamStateOgg.get())
     {
-        int section;
-        int result = 0;
-        ALsizei bytesRead = 0;
+        format = _streamStateOgg->format;
+        frequency = _streamStateOgg->frequency;
+    }
+    else
+    {
+        return false;
+    }
+
+    // Take the data from the prefetch ring, which only decodes on demand when it has run dry.
+    if (_prefetchSize < STREAMING_BUFFER_SIZE)
+        prefetch(looped);
+
+    size_t bytesRead = std::min<size_t>(_prefetchSize, STREAMING_BUFFER_SIZE);
+    if (bytesRead == 0)
+        return false;
+
+    size_t firstSize = std::min(bytesRead, _prefetchData.size() - _prefetchStart);
+    memcpy(buffers, &_prefetchData[_prefetchStart], firstSize);
+    memcpy(buffers + firstSize, &_prefetchData[0], bytesRead - firstSize);
+    _prefetchStart = (_prefetchStart + bytesRead) % _prefetchData.size();
+    _prefetchSize -= bytesRead;
+
+    AL_CHECK(alBufferData(buffer, format, buffers, (ALsizei)bytesRead, frequency));
+    return true;
+}
+
+void AudioBuffer::prefetch(bool looped)
+{
+    if (_prefetchData.empty())
+        _prefetchData.resize(STREAMING_PREFETCH_SIZE);
+
+    while (_prefetchSize < _prefetchData.size())
+    {
+        // Fill the contiguous free space after the data in the ring.
+        size_t end = (_prefetchStart + _prefetchSize) % _prefetchData.size();
+        size_t size = std::min(_prefetchData.size() - _prefetchSize, _prefetchData.size() - end);
+        size_t bytesRead = readData(&_prefetchData[end], size, looped);
+        _prefetchSize += bytesRead;
+        if (bytesRead < size)
+            break;
+    }
+}
 
-        while (bytesRead < STREAMING_BUFFER_SIZE)
+size_t AudioBuffer::readData(char* data, size_t size, bool looped)
+{
+    size_t bytesRead = 0;
+    bool rewound = false;
+    while (bytesRead < size)
+    {
+        size_t result = 0;
+        if (_streamStateWav.get())
         {
-            result = ov_read(&_streamStateOgg->oggFile, buffers + bytesRead, STREAMING_BUFFER_SIZE - bytesRead, 0, 2, 1, &section);
-            if (result > 0)
-            {
-                bytesRead += result;
-            }
-            else
-            {
-                if (looped)
-                    ov_pcm_seek(&_streamStateOgg->oggFile, _streamStateOgg->dataStart);
-                break;
-            }
+            long dataEnd = _streamStateWav->dataStart + (long)_streamStateWav->dataSize;
+            long remaining = dataEnd - _fileStream->position();
+            if (remaining > 0)
+                result = _fileStream->read(data + bytesRead, sizeof(char), std::min<size_t>(size - bytesRead, remaining));
+        }
+        else if (_streamStateOgg.get())
+        {
+            int section;
+            long oggResult = ov_read(&_streamStateOgg->oggFile, data + bytesRead, (int)(size - bytesRead), 0, 2, 1, &section);
+            if (oggResult > 0)
+                result = (size_t)oggResult;
         }
 
-        if (bytesRead > 0)
-            AL_CHECK(alBufferData(buffer, _streamStateOgg->format, buffers, bytesRead, _streamStateOgg->frequency));
-        
-        return (bytesRead > 0) || looped;
+        if (result > 0)
+        {
+            bytesRead += result;
+            rewound = false;
+            continue;
+        }
+
+        // Continue from the start of the stream without a gap so that looped music is seamless.
+        if (!looped || rewound)
+            break;
+        if (_streamStateWav.get())
+            _fileStream->seek(_streamStateWav->dataStart, SEEK_SET);
+        else if (_streamStateOgg.get())
+            ov_pcm_seek(&_streamStateOgg->oggFile, _streamStateOgg->dataStart);
+        rewound = true;
     }
-    
-    return false;
+    return bytesRead;
 }
 
 }
@@ -3,6 +3,7 @@
 
 #include "Ref.h"
 #include "Stream.h"
+#include "JobSystem.h"
 
 namespace gameplay
 {
@@ -17,6 +18,8 @@ class AudioSource;
 class AudioBuffer : public Ref
 {
     friend class AudioSource;
+    friend class AudioController;
+    friend class ResourceManager;
 
 private:
     
@@ -44,6 +47,39 @@ private:
      */
     static AudioBuffer* create(const char* path, bool streamed);
 
+    /**
+     * Gets the number of bytes held in memory by the buffers that are not streamed.
+     *
+     * @return The size of the buffer cache in bytes.
+     */
+    static unsigned int getCacheSize();
+
+    /**
+     * Gets the number of buffers that are not streamed.
+     *
+     * @return The number of buffers in the buffer cache.
+     */
+    static unsigned int getCacheCount();
+
+    /**
+     * Releases the least recently used buffers that are only held by the cache,
+     * until the cache fits in the given budget.
+     *
+     * @param budget The budget of the cache in bytes.
+     */
+    static void trimCache(unsigned int budget);
+
+    /**
+     * Decodes a buffer that was kept compressed in memory.
+     *
+     * The first call starts decoding on the job system and following calls upload
+     * the decoded data to the OpenAL buffer once it is ready. Must be called on
+     * the main thread.
+     *
+     * @return true if the buffer holds its decoded data, false if it is still decoding or failed to.
+     */
+    bool decode();
+
     struct AudioStreamStateWav
     {
         long dataStart;
@@ -61,15 +97,36 @@ private:
         OggVorbis_File oggFile;
     };
 
+    enum DecodeState
+    {
+        DECODED,
+        COMPRESSED,
+        DECODING,
+        DECODE_FAILED
+    };
+
     enum { STREAMING_BUFFER_QUEUE_SIZE = 3 };
     enum { STREAMING_BUFFER_SIZE = 48000 };
+    enum { STREAMING_PREFETCH_SIZE = STREAMING_BUFFER_SIZE * 4 };
 
     static bool loadWav(Stream* stream, ALuint buffer, bool streamed, AudioStreamStateWav* streamState);
     
     static bool loadOgg(Stream* stream, ALuint buffer, bool streamed, AudioStreamStateOgg* streamState);
 
+    static bool decodeOgg(const std::vector<char>& oggData, std::vector<char>* data, ALenum* format, ALsizei* frequency);
+
     bool streamData(ALuint buffer, bool looped);
 
+    /**
+     * Decodes the stream ahead into the prefetch ring until it is full or the stream ends.
+     */
+    void prefetch(bool looped);
+
+    /**
+     * Reads decoded data from the stream, continuing from its start when it ends and is looped.
+     */
+    size_t readData(char* data, size_t size, bool looped);
+
     ALuint _alBufferQueue[STREAMING_BUFFER_QUEUE_SIZE];
     std::string _filePath;
     bool _streamed;
@@ -77,6 +134,18 @@ private:
     std::unique_ptr<AudioStreamStateWav> _streamStateWav;
     std::unique_ptr<AudioStreamStateOgg> _streamStateOgg;
     int _buffersNeededCount;
+    std::vector<char> _prefetchData;
+    size_t _prefetchStart;
+    size_t _prefetchSize;
+    unsigned int _byteSize;
+    unsigned int _lastUsed;
+    bool _cached;
+    DecodeState _decodeState;
+    std::vector<char> _compressedData;
+    std::vector<char> _decodedData;
+    ALenum _decodedFormat;
+    ALsizei _decodedFrequency;
+    std::unique_ptr<JobSystem::Counter> _decodeCounter;
 };
 
 }
@@ -3,12 +3,23 @@
 #include "AudioListener.h"
 #include "AudioBuffer.h"
 #include "AudioSource.h"
+#include "Game.h"
+
+// Sources heard with less gain than this are played virtually even when there are voices to spare.
+#define AUDIO_INAUDIBLE_GAIN 0.001f
+
+// Longest time in milliseconds that the streaming thread sleeps without being woken.
+#define AUDIO_STREAMING_MAX_WAIT 250.0f
+
+// Time in milliseconds between the gain steps of a fading source.
+#define AUDIO_FADE_INTERVAL 10.0f
 
 namespace gameplay
 {
 
 AudioController::AudioController() 
-: _alcDevice(NULL), _alcContext(NULL), _pausingSource(NULL), _streamingThreadActive(true)
+: _alcDevice(NULL), _alcContext(NULL), _pausingSource(NULL), _maxVoices(0),
+  _bufferCacheBudget(0), _compressedBufferLimit(0), _streamingThreadActive(true)
 {
 }
 
@@ -41,6 +52,57 @@ void AudioController::initialize()
         GP_ERROR("Unable to make OpenAL context current. Error: %d\n", alcErr);
     }
     _streamingMutex.reset(new std::mutex());
+    _streamingCondition.reset(new std::condition_variable());
+
+    // Limit the mixed voices to what the device supports, or to the game config.
+    ALCint monoSources = 0;
+    alcGetIntegerv(_alcDevice, ALC_MONO_SOURCES, 1, &monoSources);
+    if (alcGetError(_alcDevice) == ALC_NO_ERROR && monoSources > 0)
+        _maxVoices = (unsigned int)monoSources;
+
+    Properties* config = Game::getInstance()->getConfig()->getNamespace("audio", true);
+    if (config && config->exists("maxVoices"))
+        setMaxVoices((unsigned int)std::max(config->getInt("maxVoices"), 0));
+    if (config && config->exists("bufferCacheBudget"))
+        setBufferCacheBudget((unsigned int)std::max(config->getInt("bufferCacheBudget"), 0));
+    if (config && config->exists("compressedBufferLimit"))
+        setCompressedBufferLimit((unsigned int)std::max(config->getInt("compressedBufferLimit"), 0));
+}
+
+unsigned int AudioController::getMaxVoices() const
+{
+    return _maxVoices;
+}
+
+void AudioController::setMaxVoices(unsigned int maxVoices)
+{
+    _maxVoices = maxVoices;
+}
+
+unsigned int AudioController::getBufferCacheBudget() const
+{
+    return _bufferCacheBudget;
+}
+
+void AudioController::setBufferCacheBudget(unsigned int budget)
+{
+    _bufferCacheBudget = budget;
+    AudioBuffer::trimCache(_bufferCacheBudget);
+}
+
+unsigned int AudioController::getBufferCacheSize() const
+{
+    return AudioBuffer::getCacheSize();
+}
+
+unsigned int AudioController::getCompressedBufferLimit() const
+{
+    return _compressedBufferLimit;
+}
+
+void AudioController::setCompressedBufferLimit(unsigned int limit)
+{
+    _compressedBufferLimit = limit;
 }
 
 void AudioController::finalize()
@@ -48,11 +110,17 @@ void AudioController::finalize()
     GP_ASSERT(_streamingSources.empty());
     if (_streamingThread.get())
     {
+        _streamingMutex->lock();
         _streamingThreadActive = false;
+        _streamingMutex->unlock();
+        _streamingCondition->notify_one();
         _streamingThread->join();
         _streamingThread.reset(NULL);
     }
 
+    // Release the buffers that only the cache still holds while there is a context to delete them in.
+    AudioBuffer::trimCache(0);
+
     alcMakeContextCurrent(NULL);
     if (_alcContext)
     {
@@ -108,13 +176,88 @@ void AudioController::resume()
 
 void AudioController::update(float elapsedTime)
 {
+    GP_PROFILE_SCOPE("AudioController::update");
+
+    // Only the listener and source properties that changed since the last frame are sent.
     AudioListener* listener = AudioListener::getInstance();
     if (listener)
+        listener->update(elapsedTime);
+
+    size_t dirtyCount = 0;
+    for (size_t i = 0, count = _dirtySources.size(); i < count; ++i)
+    {
+        AudioSource* source = _dirtySources[i];
+        GP_ASSERT(source);
+        if (source->updateTransform(elapsedTime))
+            _dirtySources[dirtyCount++] = source;
+    }
+    _dirtySources.resize(dirtyCount);
+
+    updateVoices(elapsedTime);
+}
+
+bool AudioController::compareVoices(const AudioSource* a, const AudioSource* b)
+{
+    if (a->getPriority() != b->getPriority())
+        return a->getPriority() > b->getPriority();
+    return a->_audibility > b->_audibility;
+}
+
+void AudioController::updateVoices(float elapsedTime)
+{
+    // Collect the sources that compete for voices: those playing on a voice or virtually.
+    _voices.clear();
+    unsigned int streamedVoices = 0;
+    bool hasVirtual = false;
+    for (std::set<AudioSource*>::iterator itr = _playingSources.begin(); itr != _playingSources.end(); ++itr)
     {
-        AL_CHECK( alListenerf(AL_GAIN, listener->getGain()) );
-        AL_CHECK( alListenerfv(AL_ORIENTATION, (ALfloat*)listener->getOrientation()) );
-        AL_CHECK( alListenerfv(AL_VELOCITY, (ALfloat*)&listener->getVelocity()) );
-        AL_CHECK( alListenerfv(AL_POSITION, (ALfloat*)&listener->getPosition()) );
+        AudioSource* source = *itr;
+        GP_ASSERT(source);
+        if (source->_pendingPlay)
+        {
+            // Sources waiting on their buffer to decode get a voice once they start playing.
+            source->updatePendingPlay();
+            continue;
+        }
+        else if (source->_virtual)
+        {
+            source->updateVirtual(elapsedTime);
+            if (!source->_virtual)
+                continue;
+            hasVirtual = true;
+        }
+        else if (source->getState() != AudioSource::PLAYING)
+        {
+            continue;
+        }
+        else if (source->isStreamed())
+        {
+            ++streamedVoices;
+            continue;
+        }
+        _voices.push_back(source);
+    }
+
+    unsigned int voiceCount = _maxVoices == 0 ? (unsigned int)_voices.size() : (_maxVoices > streamedVoices ? _maxVoices - streamedVoices : 0);
+    if (!hasVirtual && _voices.size() <= voiceCount)
+        return;
+
+    AudioListener* listener = AudioListener::getInstance();
+    Vector3 listenerPosition = listener ? listener->getPosition() : Vector3::zero();
+    for (size_t i = 0, count = _voices.size(); i < count; ++i)
+    {
+        _voices[i]->_audibility = _voices[i]->getAudibility(listenerPosition);
+    }
+    std::sort(_voices.begin(), _voices.end(), compareVoices);
+
+    // Free voices first so that the promoted sources never run above the limit.
+    for (size_t i = voiceCount, count = _voices.size(); i < count; ++i)
+    {
+        _voices[i]->setVirtual(true);
+    }
+    for (size_t i = 0, count = std::min<size_t>(voiceCount, _voices.size()); i < count; ++i)
+    {
+        _voices[i]->setVirtual(_voices[i]->_audibility < AUDIO_INAUDIBLE_GAIN);
     }
 }
 
@@ -136,6 +279,10 @@ void AudioController::addPlayingSource(AudioSource* source)
                 _streamingThread.reset(new std::thread(&streamingThreadProc, this));
         }
     }
+
+    // Wake the streaming thread to fill the buffers of a source that starts or restarts playing.
+    if (source->isStreamed())
+        _streamingCondition->notify_one();
 }
 
 void AudioController::removePlayingSource(AudioSource* source)
@@ -161,16 +308,31 @@ void AudioController::removePlayingSource(AudioSource* source)
 void AudioController::streamingThreadProc(void* arg)
 {
     AudioController* controller = (AudioController*)arg;
+    std::chrono::steady_clock::time_point lastTime = std::chrono::steady_clock::now();
 
+    std::unique_lock<std::mutex> lock(*controller->_streamingMutex);
     while (controller->_streamingThreadActive)
     {
-        controller->_streamingMutex->lock();
+        std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now();
+        float elapsedTime = std::chrono::duration<float, std::milli>(time - lastTime).count();
+        lastTime = time;
+
+        // Sleep until the first of the buffers being played is processed, unless a source wakes the thread sooner.
+        float waitTime = AUDIO_STREAMING_MAX_WAIT;
+        for (std::set<AudioSource*>::iterator itr = controller->_streamingSources.begin(); itr != controller->_streamingSources.end(); ++itr)
+        {
+            AudioSource* source = *itr;
+            GP_ASSERT(source);
+            if (source->updateFade(elapsedTime))
+                waitTime = std::min(waitTime, AUDIO_FADE_INTERVAL);
+
+            source->streamDataIfNeeded();
+            float sourceWait = source->getStreamingWait();
+            if (sourceWait >= 0.0f)
+                waitTime = std::min(waitTime, sourceWait);
+        }
 
-        std::for_each(controller->_streamingSources.begin(), controller->_streamingSources.end(), std::mem_fn(&AudioSource::streamDataIfNeeded));
-        
-        controller->_streamingMutex->unlock();
-   
-        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        controller->_streamingCondition->wait_for(lock, std::chrono::microseconds((long long)(waitTime * 1000.0f)) + std::chrono::milliseconds(1));
     }
 }
 
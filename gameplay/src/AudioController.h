@@ -22,6 +22,79 @@ public:
      */
     virtual ~AudioController();
 
+    /**
+     * Gets the maximum number of sources that are mixed at once.
+     *
+     * @return The maximum number of voices, or zero if every playing source is mixed.
+     */
+    unsigned int getMaxVoices() const;
+
+    /**
+     * Sets the maximum number of sources that are mixed at once.
+     *
+     * Each update, the playing sources are ranked by priority and then by how loud they are
+     * heard at the listener. Only the top sources keep their voice, and the others play
+     * virtually until they rank among the top again. Streamed sources always keep their
+     * voice and take from the limit first.
+     *
+     * The default is the number of sources that the OpenAL device can mix, when it reports
+     * one. This can also be set with the 'maxVoices' property of the 'audio' namespace in
+     * game.config.
+     *
+     * @param maxVoices The maximum number of voices, or zero to mix every playing source.
+     *
+     * @see AudioSource::setPriority
+     */
+    void setMaxVoices(unsigned int maxVoices);
+
+    /**
+     * Gets the number of bytes that audio buffers which are not streamed are kept in memory for.
+     *
+     * @return The budget of the audio buffer cache in bytes.
+     */
+    unsigned int getBufferCacheBudget() const;
+
+    /**
+     * Sets the number of bytes that audio buffers which are not streamed are kept in memory for.
+     *
+     * Buffers stay in the cache after their last source is released so that playing the
+     * same sound again does not reload it. When the cache grows over its budget, the least
+     * recently used buffers that are not held by any source are released. This can also be
+     * set with the 'bufferCacheBudget' property of the 'audio' namespace in game.config.
+     *
+     * @param budget The budget in bytes, or zero to release buffers with their last source.
+     */
+    void setBufferCacheBudget(unsigned int budget);
+
+    /**
+     * Gets the number of bytes held in memory by the audio buffers which are not streamed.
+     *
+     * @return The size of the audio buffer cache in bytes.
+     */
+    unsigned int getBufferCacheSize() const;
+
+    /**
+     * Gets the largest size of the .ogg files which are kept compressed in memory.
+     *
+     * @return The size limit in bytes.
+     */
+    unsigned int getCompressedBufferLimit() const;
+
+    /**
+     * Sets the largest size of the .ogg files which are kept compressed in memory.
+     *
+     * Audio sources which are not streamed and are loaded from .ogg files of up to this size
+     * keep the compressed file in memory instead of its decoded samples. The file is decoded
+     * on the job system the first time one of its sources is played, which starts playing once
+     * decoding has finished. This can also be set with the 'compressedBufferLimit' property of
+     * the 'audio' namespace in game.config.
+     *
+     * Only buffers loaded after the limit is set are affected.
+     *
+     * @param limit The size limit in bytes, or zero to decode every file when it is loaded.
+     */
+    void setCompressedBufferLimit(unsigned int limit);
+
 private:
     
     /**
@@ -60,15 +133,31 @@ private:
 
     static void streamingThreadProc(void* arg);
 
+    /**
+     * Gives the voices to the highest ranked playing sources and plays the others virtually.
+     */
+    void updateVoices(float elapsedTime);
+
+    /**
+     * Ranks sources by priority first and then by audibility.
+     */
+    static bool compareVoices(const AudioSource* a, const AudioSource* b);
+
     ALCdevice* _alcDevice;
     ALCcontext* _alcContext;
     std::set<AudioSource*> _playingSources;
     std::set<AudioSource*> _streamingSources;
     AudioSource* _pausingSource;
+    unsigned int _maxVoices;
+    std::vector<AudioSource*> _voices;
+    std::vector<AudioSource*> _dirtySources;
+    unsigned int _bufferCacheBudget;
+    unsigned int _compressedBufferLimit;
 
     bool _streamingThreadActive;
     std::unique_ptr<std::thread> _streamingThread;
     std::unique_ptr<std::mutex> _streamingMutex;
+    std::unique_ptr<std::condition_variable> _streamingCondition;
 };
 
 }
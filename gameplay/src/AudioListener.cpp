@@ -7,7 +7,7 @@ namespace gameplay
 {
 
 AudioListener::AudioListener()
-    : _gain(1.0f), _camera(NULL)
+    : _gain(1.0f), _camera(NULL), _dirtyBits(DIRTY_ALL), _trackVelocity(false)
 {
 }
 
@@ -31,6 +31,7 @@ float AudioListener::getGain() const
 void AudioListener::setGain(float gain)
 {
     _gain = gain;
+    _dirtyBits |= DIRTY_GAIN;
 }
 
 const Vector3& AudioListener::getPosition() const 
@@ -41,11 +42,13 @@ const Vector3& AudioListener::getPosition() const
 void AudioListener::setPosition(const Vector3& position)
 {
     _position = position;
+    _dirtyBits |= DIRTY_POSITION;
 }
 
 void AudioListener::setPosition(float x, float y, float z)
 {
     _position.set(x, y, z);
+    _dirtyBits |= DIRTY_POSITION;
 }
 
 const Vector3& AudioListener::getVelocity() const 
@@ -56,11 +59,13 @@ const Vector3& AudioListener::getVelocity() const
 void AudioListener::setVelocity(const Vector3& velocity)
 {
     _velocity = velocity;
+    _trackVelocity = false;
+    _dirtyBits |= DIRTY_VELOCITY;
 }
 
 void AudioListener::setVelocity(float x, float y, float z)
 {
-    _velocity.set(x, y, z);
+    setVelocity(Vector3(x, y, z));
 }
 
 const float* AudioListener::getOrientation() const
@@ -87,12 +92,14 @@ void AudioListener::setOrientation(const Vector3& forward, const Vector3& up)
     _orientation[1].x = up.x;
     _orientation[1].y = up.y;
     _orientation[1].z = up.z;
+    _dirtyBits |= DIRTY_ORIENTATION;
 }
 
 void AudioListener::setOrientation(float forwardX, float forwardY, float forwardZ, float upX, float upY, float upZ)
 {
     _orientation[0].set(forwardX, forwardY, forwardZ);
     _orientation[1].set(upX, upY, upZ);
+    _dirtyBits |= DIRTY_ORIENTATION;
 }
 
 Camera* AudioListener::getCamera() const
@@ -118,6 +125,11 @@ void AudioListener::setCamera(Camera* camera)
     {
         _camera->addRef();
         _camera->addListener(this);
+
+        // Start tracking from where the camera is so that binding it does not read as a jump.
+        _trackVelocity = _camera->getNode() != NULL;
+        if (_trackVelocity)
+            _trackedPosition = _camera->getNode()->getTranslationWorld();
     }
 }
 
@@ -144,4 +156,32 @@ void AudioListener::cameraChanged(Camera* camera)
     }
 }
 
+void AudioListener::update(float elapsedTime)
+{
+    // Derive the velocity from how far the camera moved since the last frame.
+    if (_trackVelocity && _camera && _camera->getNode() && elapsedTime > 0.0f)
+    {
+        Vector3 velocity = (_position - _trackedPosition) * (1000.0f / elapsedTime);
+        _trackedPosition = _position;
+        if (velocity != _velocity)
+        {
+            _velocity = velocity;
+            _dirtyBits |= DIRTY_VELOCITY;
+        }
+    }
+
+    if (_dirtyBits == 0)
+        return;
+
+    if (_dirtyBits & DIRTY_GAIN)
+        AL_CHECK( alListenerf(AL_GAIN, _gain) );
+    if (_dirtyBits & DIRTY_ORIENTATION)
+        AL_CHECK( alListenerfv(AL_ORIENTATION, (ALfloat*)getOrientation()) );
+    if (_dirtyBits & DIRTY_VELOCITY)
+        AL_CHECK( alListenerfv(AL_VELOCITY, (ALfloat*)&_velocity) );
+    if (_dirtyBits & DIRTY_POSITION)
+        AL_CHECK( alListenerfv(AL_POSITION, (ALfloat*)&_position) );
+    _dirtyBits = 0;
+}
+
 }
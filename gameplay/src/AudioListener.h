@@ -77,6 +77,10 @@ public:
     /**
      * Sets the velocity of the audio source
      *
+     * While the listener is bound to a camera that is attached to a node, its velocity is
+     * derived from the motion of the node each frame. Setting the velocity stops that until
+     * the listener is bound to another camera.
+     *
      * @param velocity A vector representing the velocity.
      */
     void setVelocity(const Vector3& velocity);
@@ -164,11 +168,28 @@ private:
     */
     void cameraChanged(Camera* camera);
 
+    /**
+     * Derives the velocity from the motion of the camera and sends the properties that changed to OpenAL.
+     */
+    void update(float elapsedTime);
+
+    enum Dirty
+    {
+        DIRTY_GAIN = 1,
+        DIRTY_POSITION = 2,
+        DIRTY_VELOCITY = 4,
+        DIRTY_ORIENTATION = 8,
+        DIRTY_ALL = DIRTY_GAIN | DIRTY_POSITION | DIRTY_VELOCITY | DIRTY_ORIENTATION
+    };
+
     float _gain;
     Vector3 _position;
     Vector3 _velocity;
     Vector3 _orientation[2];
     Camera* _camera;
+    int _dirtyBits;
+    bool _trackVelocity;
+    Vector3 _trackedPosition;
 };
 
 }
@@ -10,14 +10,23 @@ namespace gameplay
 {
 
 AudioSource::AudioSource(AudioBuffer* buffer, ALuint source) 
-    : _alSource(source), _buffer(buffer), _looped(false), _gain(1.0f), _pitch(1.0f), _node(NULL)
+    : _alSource(source), _buffer(buffer), _looped(false), _gain(1.0f), _pitch(1.0f), _node(NULL),
+      _priority(0), _virtual(false), _virtualOffset(0.0f), _audibility(0.0f),
+      _bufferAttached(false), _pendingPlay(false), _fadeGain(1.0f), _fadeFrom(1.0f), _fadeTo(1.0f),
+      _fadeDuration(0.0f), _fadeTime(0.0f), _fadeStop(false),
+      _transformDirty(false), _trackVelocity(false)
 {
     GP_ASSERT(buffer);
 
     if (isStreamed())
+    {
         AL_CHECK(alSourceQueueBuffers(_alSource, 1, &buffer->_alBufferQueue[0]));
-    else
-        AL_CHECK(alSourcei(_alSource, AL_BUFFER, buffer->_alBufferQueue[0]));
+        _bufferAttached = true;
+    }
+    else if (buffer->_decodeState == AudioBuffer::DECODED)
+    {
+        attachBuffer();
+    }
     
     AL_CHECK(alSourcei(_alSource, AL_LOOPING, _looped && !isStreamed()));
     
@@ -38,6 +47,11 @@ AudioSource::~AudioSource()
         AudioController* audioController = Game::getInstance()->getAudioController();
         GP_ASSERT(audioController);
         audioController->removePlayingSource(this);
+        if (_transformDirty)
+        {
+            std::vector<AudioSource*>& sources = audioController->_dirtySources;
+            sources.erase(std::find(sources.begin(), sources.end(), this));
+        }
 
         AL_CHECK(alDeleteSources(1, &_alSource));
         _alSource = 0;
@@ -126,6 +140,10 @@ AudioSource* AudioSource::create(Properties* properties)
     {
         audio->setPitch(properties->getFloat("pitch"));
     }
+    if (properties->exists("priority"))
+    {
+        audio->setPriority(properties->getInt("priority"));
+    }
     Vector3 v;
     if (properties->getVector3("velocity", &v))
     {
@@ -137,6 +155,11 @@ AudioSource* AudioSource::create(Properties* properties)
 
 AudioSource::State AudioSource::getState() const
 {
+    // Virtual sources are paused on their voice but still playing as far as the game is concerned,
+    // and so are the sources waiting on their buffer to decode.
+    if (_virtual || _pendingPlay)
+        return PLAYING;
+
     ALint state;
     AL_CHECK( alGetSourcei(_alSource, AL_SOURCE_STATE, &state) );
 
@@ -160,9 +183,39 @@ bool AudioSource::isStreamed() const
     return _buffer->_streamed;
 }
 
+int AudioSource::getPriority() const
+{
+    return _priority;
+}
+
+void AudioSource::setPriority(int priority)
+{
+    _priority = priority;
+}
+
+bool AudioSource::isVirtual() const
+{
+    return _virtual;
+}
+
 void AudioSource::play()
 {
-    AL_CHECK( alSourcePlay(_alSource) );
+    // A buffer kept compressed is decoded first, and the controller starts the source when it is.
+    _pendingPlay = !attachBuffer();
+    if (_pendingPlay)
+    {
+        _virtual = false;
+    }
+    else
+    {
+        // Playing a playing source restarts it, which a virtual source does from its paused voice by rewinding.
+        if (_virtual)
+        {
+            _virtual = false;
+            AL_CHECK( alSourceRewind(_alSource) );
+        }
+        AL_CHECK( alSourcePlay(_alSource) );
+    }
 
     // Add the source to the controller's list of currently playing sources.
     AudioController* audioController = Game::getInstance()->getAudioController();
@@ -172,12 +225,30 @@ void AudioSource::play()
 
 void AudioSource::pause()
 {
+    AudioController* audioController = Game::getInstance()->getAudioController();
+    GP_ASSERT(audioController);
+
+    // A source waiting on its buffer keeps waiting while the controller is paused, and stops waiting otherwise.
+    if (_pendingPlay)
+    {
+        if (audioController->_pausingSource != this)
+        {
+            _pendingPlay = false;
+            audioController->removePlayingSource(this);
+        }
+        return;
+    }
+
+    // A virtual source is already paused on its voice, which only needs its playback position.
+    if (_virtual)
+    {
+        _virtual = false;
+        AL_CHECK( alSourcef(_alSource, AL_SEC_OFFSET, _virtualOffset) );
+    }
     AL_CHECK( alSourcePause(_alSource) );
 
     // Remove the source from the controller's set of currently playing sources
     // if the source is being paused by the user and not the controller itself.
-    AudioController* audioController = Game::getInstance()->getAudioController();
-    GP_ASSERT(audioController);
     audioController->removePlayingSource(this);
 }
 
@@ -191,6 +262,10 @@ void AudioSource::resume()
 
 void AudioSource::stop()
 {
+    _virtual = false;
+    _pendingPlay = false;
+    if (isStreamed())
+        fade(1.0f, 1.0f, 0.0f, false);
     AL_CHECK( alSourceStop(_alSource) );
 
     // Remove the source from the controller's set of currently playing sources.
@@ -201,6 +276,11 @@ void AudioSource::stop()
 
 void AudioSource::rewind()
 {
+    if (_virtual)
+    {
+        _virtualOffset = 0.0f;
+        return;
+    }
     AL_CHECK( alSourceRewind(_alSource) );
 }
 
@@ -217,6 +297,14 @@ void AudioSource::setLooped(bool looped)
         GP_ERROR("Failed to set audio source's looped attribute with error: %d", AL_LAST_ERROR());
     }
     _looped = looped;
+
+    // The streaming thread decodes ahead, so it picks up the change right away.
+    if (isStreamed())
+    {
+        AudioController* audioController = Game::getInstance()->getAudioController();
+        GP_ASSERT(audioController);
+        audioController->_streamingCondition->notify_one();
+    }
 }
 
 float AudioSource::getGain() const
@@ -226,6 +314,16 @@ float AudioSource::getGain() const
 
 void AudioSource::setGain(float gain)
 {
+    if (isStreamed())
+    {
+        // The streaming thread applies the fade level on top of the gain.
+        AudioController* audioController = Game::getInstance()->getAudioController();
+        GP_ASSERT(audioController);
+        std::lock_guard<std::mutex> lock(*audioController->_streamingMutex);
+        AL_CHECK( alSourcef(_alSource, AL_GAIN, gain * _fadeGain) );
+        _gain = gain;
+        return;
+    }
     AL_CHECK( alSourcef(_alSource, AL_GAIN, gain) );
     _gain = gain;
 }
@@ -250,6 +348,7 @@ void AudioSource::setVelocity(const Vector3& velocity)
 {
     AL_CHECK( alSourcefv(_alSource, AL_VELOCITY, (ALfloat*)&velocity) );
     _velocity = velocity;
+    _trackVelocity = false;
 }
 
 void AudioSource::setVelocity(float x, float y, float z)
@@ -278,6 +377,11 @@ void AudioSource::setNode(Node* node)
         if (_node)
         {
             _node->addListener(this);
+
+            // Start tracking from where the node is so that attaching it does not read as a jump.
+            _trackVelocity = true;
+            _trackedPosition = _node->getTranslationWorld();
+
             // Update the audio source position.
             transformChanged(_node, 0);
         }
@@ -286,13 +390,42 @@ void AudioSource::setNode(Node* node)
 
 void AudioSource::transformChanged(Transform* transform, long cookie)
 {
-    if (_node)
+    // The position is sent by the controller once per frame, after every transform has changed.
+    if (_node && !_transformDirty)
     {
-        Vector3 translation = _node->getTranslationWorld();
-        AL_CHECK( alSourcefv(_alSource, AL_POSITION, (const ALfloat*)&translation.x) );
+        AudioController* audioController = Game::getInstance()->getAudioController();
+        GP_ASSERT(audioController);
+        audioController->_dirtySources.push_back(this);
+        _transformDirty = true;
     }
 }
 
+bool AudioSource::updateTransform(float elapsedTime)
+{
+    GP_ASSERT(_transformDirty);
+
+    _transformDirty = false;
+    if (!_node)
+        return false;
+
+    Vector3 translation = _node->getTranslationWorld();
+    AL_CHECK( alSourcefv(_alSource, AL_POSITION, (const ALfloat*)&translation.x) );
+
+    // Derive the velocity from how far the node moved since the last frame.
+    if (_trackVelocity && elapsedTime > 0.0f)
+    {
+        Vector3 velocity = (translation - _trackedPosition) * (1000.0f / elapsedTime);
+        _trackedPosition = translation;
+        if (velocity != _velocity)
+        {
+            AL_CHECK( alSourcefv(_alSource, AL_VELOCITY, (const ALfloat*)&velocity.x) );
+            _velocity = velocity;
+        }
+        _transformDirty = !_velocity.isZero();
+    }
+    return _transformDirty;
+}
+
 AudioSource* AudioSource::clone(NodeCloneContext& context)
 {
     GP_ASSERT(_buffer);
@@ -322,6 +455,84 @@ AudioSource* AudioSource::clone(NodeCloneContext& context)
     return audioClone;
 }
 
+void AudioSource::crossFade(AudioSource* source, float duration)
+{
+    if (!isStreamed() || (source && !source->isStreamed()))
+    {
+        GP_WARN("Audio sources can only be cross-faded when they are streamed.");
+        stop();
+        if (source)
+            source->play();
+        return;
+    }
+
+    if (source && source != this)
+    {
+        source->fade(0.0f, 1.0f, duration, false);
+        source->play();
+    }
+    fade(_fadeGain, 0.0f, duration, true);
+}
+
+void AudioSource::fade(float from, float to, float duration, bool stopWhenDone)
+{
+    GP_ASSERT(isStreamed());
+
+    AudioController* audioController = Game::getInstance()->getAudioController();
+    GP_ASSERT(audioController);
+    std::lock_guard<std::mutex> lock(*audioController->_streamingMutex);
+
+    _fadeFrom = from;
+    _fadeTo = to;
+    _fadeDuration = duration;
+    _fadeTime = 0.0f;
+    _fadeStop = stopWhenDone;
+    _fadeGain = duration > 0.0f ? from : to;
+    AL_CHECK( alSourcef(_alSource, AL_GAIN, _gain * _fadeGain) );
+    audioController->_streamingCondition->notify_one();
+}
+
+bool AudioSource::updateFade(float elapsedTime)
+{
+    if (_fadeTime >= _fadeDuration && !_fadeStop)
+        return false;
+
+    _fadeTime = std::min(_fadeTime + elapsedTime, _fadeDuration);
+    _fadeGain = _fadeDuration > 0.0f ? _fadeFrom + (_fadeTo - _fadeFrom) * (_fadeTime / _fadeDuration) : _fadeTo;
+
+    if (_fadeTime >= _fadeDuration && _fadeStop)
+    {
+        // The source has faded out, so it stops and gets its gain back for the next time it is played.
+        _fadeStop = false;
+        _fadeGain = 1.0f;
+        AL_CHECK( alSourceStop(_alSource) );
+    }
+    AL_CHECK( alSourcef(_alSource, AL_GAIN, _gain * _fadeGain) );
+    return _fadeTime < _fadeDuration;
+}
+
+float AudioSource::getStreamingWait() const
+{
+    GP_ASSERT(_buffer);
+
+    ALint state = 0, offset = 0, bits = 0, channels = 0, frequency = 0;
+    AL_CHECK( alGetSourcei(_alSource, AL_SOURCE_STATE, &state) );
+    if (state != AL_PLAYING)
+        return -1.0f;
+
+    // The processed buffers are unqueued when streaming, so the offset is within the buffer being played.
+    AL_CHECK( alGetSourcei(_alSource, AL_SAMPLE_OFFSET, &offset) );
+    ALuint buffer = _buffer->_alBufferQueue[0];
+    AL_CHECK( alGetBufferi(buffer, AL_BITS, &bits) );
+    AL_CHECK( alGetBufferi(buffer, AL_CHANNELS, &channels) );
+    AL_CHECK( alGetBufferi(buffer, AL_FREQUENCY, &frequency) );
+    if (bits <= 0 || channels <= 0 || frequency <= 0 || _pitch <= 0.0f)
+        return 0.0f;
+
+    int bufferSamples = AudioBuffer::STREAMING_BUFFER_SIZE / ((bits / 8) * channels);
+    return std::max(bufferSamples - offset, 0) * 1000.0f / (frequency * _pitch);
+}
+
 bool AudioSource::streamDataIfNeeded()
 {
     GP_ASSERT( isStreamed() );
@@ -358,7 +569,105 @@ bool AudioSource::streamDataIfNeeded()
             AL_CHECK( alSourceQueueBuffers(_alSource, 1, &bufferID) );
         }
     }
+
+    // Decode ahead while the queued buffers play so that the next refill is only a copy.
+    _buffer->prefetch(_looped);
+    return true;
+}
+
+void AudioSource::setVirtual(bool virtualize)
+{
+    if (_virtual == virtualize)
+        return;
+
+    if (virtualize)
+    {
+        AL_CHECK( alGetSourcef(_alSource, AL_SEC_OFFSET, &_virtualOffset) );
+        AL_CHECK( alSourcePause(_alSource) );
+    }
+    else
+    {
+        AL_CHECK( alSourcef(_alSource, AL_SEC_OFFSET, _virtualOffset) );
+        AL_CHECK( alSourcePlay(_alSource) );
+    }
+    _virtual = virtualize;
+}
+
+void AudioSource::updateVirtual(float elapsedTime)
+{
+    GP_ASSERT(_virtual);
+
+    float duration = getDuration();
+    _virtualOffset += elapsedTime * 0.001f * _pitch;
+    if (duration > 0.0f && _virtualOffset >= duration)
+    {
+        if (_looped)
+        {
+            _virtualOffset = fmodf(_virtualOffset, duration);
+        }
+        else
+        {
+            // The sound has played to the end while virtual, so it ends as it would have on its voice.
+            _virtual = false;
+            _virtualOffset = 0.0f;
+            AL_CHECK( alSourceStop(_alSource) );
+        }
+    }
+}
+
+float AudioSource::getAudibility(const Vector3& listenerPosition) const
+{
+    // OpenAL attenuates by the inverse distance clamped to a reference distance and rolloff of one by default.
+    ALfloat position[3];
+    AL_CHECK( alGetSourcefv(_alSource, AL_POSITION, position) );
+    float distance = listenerPosition.distance(Vector3(position[0], position[1], position[2]));
+    return _gain / std::max(distance, 1.0f);
+}
+
+float AudioSource::getDuration() const
+{
+    GP_ASSERT(_buffer);
+    if (isStreamed() || !_bufferAttached)
+        return 0.0f;
+
+    ALint size = 0, bits = 0, channels = 0, frequency = 0;
+    ALuint buffer = _buffer->_alBufferQueue[0];
+    AL_CHECK( alGetBufferi(buffer, AL_SIZE, &size) );
+    AL_CHECK( alGetBufferi(buffer, AL_BITS, &bits) );
+    AL_CHECK( alGetBufferi(buffer, AL_CHANNELS, &channels) );
+    AL_CHECK( alGetBufferi(buffer, AL_FREQUENCY, &frequency) );
+    if (bits <= 0 || channels <= 0 || frequency <= 0)
+        return 0.0f;
+
+    return (float)size / (float)((bits / 8) * channels * frequency);
+}
+
+bool AudioSource::attachBuffer()
+{
+    GP_ASSERT(_buffer);
+    if (_bufferAttached)
+        return true;
+    if (!_buffer->decode())
+        return false;
+
+    AL_CHECK( alSourcei(_alSource, AL_BUFFER, _buffer->_alBufferQueue[0]) );
+    _bufferAttached = true;
     return true;
 }
 
+void AudioSource::updatePendingPlay()
+{
+    GP_ASSERT(_pendingPlay);
+
+    if (attachBuffer())
+    {
+        _pendingPlay = false;
+        AL_CHECK( alSourcePlay(_alSource) );
+    }
+    else if (_buffer->_decodeState == AudioBuffer::DECODE_FAILED)
+    {
+        _pendingPlay = false;
+    }
+}
+
 }
@@ -90,6 +90,39 @@ public:
      */
     AudioSource::State getState() const;
 
+    /**
+     * Gets the priority of the audio source.
+     *
+     * @return The priority.
+     *
+     * @see setPriority
+     */
+    int getPriority() const;
+
+    /**
+     * Sets the priority of the audio source.
+     *
+     * When more sources are playing than the audio controller has voices for, the sources
+     * with the highest priority, and the most audible among sources of equal priority, keep
+     * playing. The others continue virtually, without being mixed, and resume from where
+     * they would be once a voice frees up. The default priority is zero.
+     *
+     * @param priority The priority of the source.
+     *
+     * @see AudioController::setMaxVoices
+     */
+    void setPriority(int priority);
+
+    /**
+     * Determines whether the audio source is playing virtually.
+     *
+     * A virtual source reports that it is playing and keeps track of its playback position,
+     * but is not heard until it gets a voice back.
+     *
+     * @return true if the audio source is playing virtually, false if not.
+     */
+    bool isVirtual() const;
+
     /**
      * Determines whether the audio source is streaming or not.
      *
@@ -149,6 +182,9 @@ public:
     /**
      * Sets the velocity of the audio source.
      *
+     * While the source is attached to a node, its velocity is derived from the motion of the
+     * node each frame. Setting the velocity stops that until the source is attached to another node.
+     *
      * @param velocity A vector representing the velocity.
      */
     void setVelocity(const Vector3& velocity);
@@ -169,6 +205,17 @@ public:
      */
     Node* getNode() const;
 
+    /**
+     * Fades this source out and stops it, while playing the given source and fading it in.
+     *
+     * The gains are ramped by the streaming thread, so both sources must be streamed. This is
+     * typically used to change the music without a gap. The given source fades in to its own gain.
+     *
+     * @param source The streamed source to play, or NULL to only fade this source out.
+     * @param duration The duration of the cross-fade in milliseconds.
+     */
+    void crossFade(AudioSource* source, float duration);
+
 private:
 
     /**
@@ -196,6 +243,13 @@ private:
      */
     void transformChanged(Transform* transform, long cookie);
 
+    /**
+     * Sends the position of the node, and the velocity derived from its motion, to OpenAL.
+     *
+     * @return true if the source has to be updated next frame as well, to bring its velocity back to rest.
+     */
+    bool updateTransform(float elapsedTime);
+
     /**
      * Clones the audio source and returns a new audio source.
      * 
@@ -206,6 +260,56 @@ private:
 
     bool streamDataIfNeeded();
 
+    /**
+     * Moves the source between playing on its voice and playing virtually, keeping its position.
+     */
+    void setVirtual(bool virtualize);
+
+    /**
+     * Advances the playback position of a virtual source, stopping it once it has played to the end.
+     */
+    void updateVirtual(float elapsedTime);
+
+    /**
+     * Returns the gain that the source is heard with from the given listener position.
+     */
+    float getAudibility(const Vector3& listenerPosition) const;
+
+    /**
+     * Returns the length of the sound in seconds, or zero if it is streamed.
+     */
+    float getDuration() const;
+
+    /**
+     * Starts ramping the gain of a streamed source from one fade level to another.
+     */
+    void fade(float from, float to, float duration, bool stopWhenDone);
+
+    /**
+     * Advances the fade of the source from the streaming thread.
+     *
+     * @return true if the source is still fading.
+     */
+    bool updateFade(float elapsedTime);
+
+    /**
+     * Returns the number of milliseconds until the buffer that a streamed source is playing
+     * is processed, or a negative value if the source is not playing.
+     */
+    float getStreamingWait() const;
+
+    /**
+     * Attaches the buffer to the source, which is deferred for buffers that are kept compressed until they are decoded.
+     *
+     * @return true if the buffer is attached, false if it is still decoding or failed to.
+     */
+    bool attachBuffer();
+
+    /**
+     * Starts playing a source that was played before its buffer was decoded, once it is.
+     */
+    void updatePendingPlay();
+
     ALuint _alSource;
     AudioBuffer* _buffer;
     bool _looped;
@@ -213,6 +317,21 @@ private:
     float _pitch;
     Vector3 _velocity;
     Node* _node;
+    int _priority;
+    bool _virtual;
+    float _virtualOffset;
+    float _audibility;
+    bool _bufferAttached;
+    bool _pendingPlay;
+    float _fadeGain;
+    float _fadeFrom;
+    float _fadeTo;
+    float _fadeDuration;
+    float _fadeTime;
+    bool _fadeStop;
+    bool _transformDirty;
+    bool _trackVelocity;
+    Vector3 _trackedPosition;
 };
 
 }
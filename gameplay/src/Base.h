@@ -19,6 +19,7 @@
 #include <cstring>
 #include <vector>
 #include <list>
+#include <deque>
 #include <set>
 #include <stack>
 #include <map>
@@ -31,6 +32,8 @@
 #include <typeinfo>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
+#include <atomic>
 #include <chrono>
 #include "Logger.h"
 
@@ -106,9 +109,13 @@ extern int strcmpnocase(const char* s1, const char* s2);
 // Warning macro.
 #define GP_WARN(...) do \
     { \
-        gameplay::Logger::log(gameplay::Logger::LEVEL_WARN, "%s -- ", __current__func__); \
-        gameplay::Logger::log(gameplay::Logger::LEVEL_WARN, __VA_ARGS__); \
-        gameplay::Logger::log(gameplay::Logger::LEVEL_WARN, "\n"); \
+        static gameplay::Logger::RateLimit __gp_warnRateLimit; \
+        if (__gp_warnRateLimit.allow(gameplay::Logger::LEVEL_WARN)) \
+        { \
+            gameplay::Logger::log(gameplay::Logger::LEVEL_WARN, "%s -- ", __current__func__); \
+            gameplay::Logger::log(gameplay::Logger::LEVEL_WARN, __VA_ARGS__); \
+            gameplay::Logger::log(gameplay::Logger::LEVEL_WARN, "\n"); \
+        } \
     } while (0)
 
 #if defined(WIN32)
@@ -132,6 +139,9 @@ extern int strcmpnocase(const char* s1, const char* s2);
 // Debug new for memory leak detection
 #include "DebugNew.h"
 
+// CPU profiling markers (only enabled when GP_USE_PROFILER is defined)
+#include "Profiler.h"
+
 // Object deletion macro
 #define SAFE_DELETE(x) \
     { \
@@ -220,20 +230,53 @@ using std::va_list;
     extern PFNGLISVERTEXARRAYOESPROC glIsVertexArray;
     extern PFNGLMAPBUFFEROESPROC glMapBuffer;
     extern PFNGLUNMAPBUFFEROESPROC glUnmapBuffer;
+    extern PFNGLGETPROGRAMBINARYOESPROC glGetProgramBinary;
+    extern PFNGLPROGRAMBINARYOESPROC glProgramBinary;
+    extern PFNGLDISCARDFRAMEBUFFEREXTPROC glDiscardFramebuffer;
     #define GL_WRITE_ONLY GL_WRITE_ONLY_OES
+    #define GL_PROGRAM_BINARY_LENGTH GL_PROGRAM_BINARY_LENGTH_OES
+    #define GL_NUM_PROGRAM_BINARY_FORMATS GL_NUM_PROGRAM_BINARY_FORMATS_OES
     #define GL_DEPTH24_STENCIL8 GL_DEPTH24_STENCIL8_OES
     #define glClearDepth glClearDepthf
     #define OPENGL_ES
     #define GP_USE_VAO
+    #define GP_USE_PROGRAM_BINARY
+    #define GP_USE_FRAMEBUFFER_DISCARD
 #elif WIN32
         #define WIN32_LEAN_AND_MEAN
         #define GLEW_STATIC
         #include <GL/glew.h>
         #define GP_USE_VAO
+        #define GP_USE_INSTANCING
+        #define GP_USE_UNIFORM_BUFFERS
+        #define GP_USE_PROGRAM_BINARY
+        #define GP_USE_PIXEL_BUFFERS
+        #define GP_USE_BUFFER_SYNC
+        #define GP_USE_OCCLUSION_QUERIES
+        #define GP_USE_FLOAT_TEXTURES
+        #define GP_USE_TEXTURE_ARRAYS
+        #define GP_USE_TIMER_QUERIES
+        #define GP_USE_TRANSFORM_FEEDBACK
+        #define GP_USE_SAMPLER_OBJECTS
+        #define GP_USE_FRAMEBUFFER_INVALIDATE
+        #define GP_USE_FRAMEBUFFER_MULTISAMPLE
 #elif __linux__
         #define GLEW_STATIC
         #include <GL/glew.h>
         #define GP_USE_VAO
+        #define GP_USE_INSTANCING
+        #define GP_USE_UNIFORM_BUFFERS
+        #define GP_USE_PROGRAM_BINARY
+        #define GP_USE_PIXEL_BUFFERS
+        #define GP_USE_BUFFER_SYNC
+        #define GP_USE_OCCLUSION_QUERIES
+        #define GP_USE_FLOAT_TEXTURES
+        #define GP_USE_TEXTURE_ARRAYS
+        #define GP_USE_TIMER_QUERIES
+        #define GP_USE_TRANSFORM_FEEDBACK
+        #define GP_USE_SAMPLER_OBJECTS
+        #define GP_USE_FRAMEBUFFER_INVALIDATE
+        #define GP_USE_FRAMEBUFFER_MULTISAMPLE
 #elif __APPLE__
     #include "TargetConditionals.h"
     #if TARGET_OS_IPHONE || TARGET_IPHONE_SIMULATOR
@@ -245,11 +288,13 @@ using std::va_list;
         #define glIsVertexArray glIsVertexArrayOES
         #define glMapBuffer glMapBufferOES
         #define glUnmapBuffer glUnmapBufferOES
+        #define glDiscardFramebuffer glDiscardFramebufferEXT
         #define GL_WRITE_ONLY GL_WRITE_ONLY_OES
         #define GL_DEPTH24_STENCIL8 GL_DEPTH24_STENCIL8_OES
         #define glClearDepth glClearDepthf
         #define OPENGL_ES
         #define GP_USE_VAO
+        #define GP_USE_FRAMEBUFFER_DISCARD
     #elif TARGET_OS_MAC
         #include <OpenGL/gl.h>
         #include <OpenGL/glext.h>
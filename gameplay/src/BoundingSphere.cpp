@@ -1,6 +1,7 @@
 #include "Base.h"
 #include "BoundingSphere.h"
 #include "BoundingBox.h"
+#include "MathUtil.h"
 
 namespace gameplay
 {
@@ -302,6 +303,17 @@ void BoundingSphere::transform(const Matrix& matrix)
     radius = r;
 }
 
+void BoundingSphere::transform(const Matrix& matrix, const BoundingSphere* spheres, unsigned int count, BoundingSphere* dst)
+{
+    GP_ASSERT(spheres || count == 0);
+    GP_ASSERT(dst || count == 0);
+
+    // Scaling a radius by the largest scale is the same as taking the largest of the scaled radii.
+    Vector3 scale;
+    matrix.decompose(&scale, NULL, NULL);
+    MathUtil::transformSphereArray(matrix.m, max(max(scale.x, scale.y), scale.z), &spheres->center.x, count, &dst->center.x);
+}
+
 float BoundingSphere::distance(const BoundingSphere& sphere, const Vector3& point)
 {
     return sqrt((point.x - sphere.center.x) * (point.x - sphere.center.x) +
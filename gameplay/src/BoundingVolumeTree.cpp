@@ -0,0 +1,395 @@
+#include "Base.h"
+#include "BoundingVolumeTree.h"
+
+#define NULL_NODE -1
+
+namespace gameplay
+{
+
+// The area heuristic used to pick where leaves are inserted (half the surface area of the box).
+static float getPerimeter(const BoundingBox& box)
+{
+    float x = box.max.x - box.min.x;
+    float y = box.max.y - box.min.y;
+    float z = box.max.z - box.min.z;
+    return x * y + y * z + z * x;
+}
+
+static BoundingBox getMerged(const BoundingBox& a, const BoundingBox& b)
+{
+    return BoundingBox(std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z),
+                       std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z));
+}
+
+static bool contains(const BoundingBox& outer, const BoundingBox& inner)
+{
+    return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+           inner.max.x <= outer.max.x && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+}
+
+static BoundingBox getFattened(const BoundingBox& box, float margin)
+{
+    return BoundingBox(box.min.x - margin, box.min.y - margin, box.min.z - margin,
+                       box.max.x + margin, box.max.y + margin, box.max.z + margin);
+}
+
+BoundingVolumeTree::BoundingVolumeTree()
+    : _root(NULL_NODE), _freeList(NULL_NODE), _proxyCount(0)
+{
+}
+
+BoundingVolumeTree::~BoundingVolumeTree()
+{
+}
+
+int BoundingVolumeTree::insert(const BoundingBox& box, void* userData, float margin)
+{
+    int proxy = allocateNode();
+    TreeNode& node = _nodes[proxy];
+    node.box = getFattened(box, margin);
+    node.userData = userData;
+    node.height = 0;
+    insertLeaf(proxy);
+    ++_proxyCount;
+    return proxy;
+}
+
+void BoundingVolumeTree::remove(int proxy)
+{
+    GP_ASSERT(proxy >= 0 && proxy < (int)_nodes.size());
+    GP_ASSERT(_nodes[proxy].isLeaf());
+
+    removeLeaf(proxy);
+    freeNode(proxy);
+    --_proxyCount;
+}
+
+bool BoundingVolumeTree::update(int proxy, const BoundingBox& box, float margin)
+{
+    GP_ASSERT(proxy >= 0 && proxy < (int)_nodes.size());
+    GP_ASSERT(_nodes[proxy].isLeaf());
+
+    if (contains(_nodes[proxy].box, box))
+        return false;
+
+    removeLeaf(proxy);
+    _nodes[proxy].box = getFattened(box, margin);
+    insertLeaf(proxy);
+    return true;
+}
+
+void* BoundingVolumeTree::getUserData(int proxy) const
+{
+    GP_ASSERT(proxy >= 0 && proxy < (int)_nodes.size());
+    return _nodes[proxy].userData;
+}
+
+const BoundingBox& BoundingVolumeTree::getBoundingBox(int proxy) const
+{
+    GP_ASSERT(proxy >= 0 && proxy < (int)_nodes.size());
+    return _nodes[proxy].box;
+}
+
+unsigned int BoundingVolumeTree::getProxyCount() const
+{
+    return _proxyCount;
+}
+
+int BoundingVolumeTree::getHeight() const
+{
+    return _root == NULL_NODE ? 0 : _nodes[_root].height + 1;
+}
+
+void BoundingVolumeTree::clear()
+{
+    _nodes.clear();
+    _root = NULL_NODE;
+    _freeList = NULL_NODE;
+    _proxyCount = 0;
+}
+
+unsigned int BoundingVolumeTree::query(const Frustum& frustum, std::vector<void*>& results) const
+{
+    return queryNodes(frustum, results);
+}
+
+unsigned int BoundingVolumeTree::query(const BoundingBox& box, std::vector<void*>& results) const
+{
+    return queryNodes(box, results);
+}
+
+unsigned int BoundingVolumeTree::query(const BoundingSphere& sphere, std::vector<void*>& results) const
+{
+    return queryNodes(sphere, results);
+}
+
+unsigned int BoundingVolumeTree::query(const Ray& ray, float maxDistance, std::vector<void*>& results) const
+{
+    if (_root == NULL_NODE)
+        return 0;
+
+    unsigned int count = 0;
+    std::vector<int> stack;
+    stack.push_back(_root);
+    while (!stack.empty())
+    {
+        const TreeNode& node = _nodes[stack.back()];
+        stack.pop_back();
+
+        float distance = node.box.intersects(ray);
+        if (distance == (float)Ray::INTERSECTS_NONE || distance > maxDistance)
+            continue;
+
+        if (node.isLeaf())
+        {
+            results.push_back(node.userData);
+            ++count;
+        }
+        else
+        {
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+    }
+    return count;
+}
+
+template <class T>
+unsigned int BoundingVolumeTree::queryNodes(const T& volume, std::vector<void*>& results) const
+{
+    if (_root == NULL_NODE)
+        return 0;
+
+    unsigned int count = 0;
+    std::vector<int> stack;
+    stack.push_back(_root);
+    while (!stack.empty())
+    {
+        const TreeNode& node = _nodes[stack.back()];
+        stack.pop_back();
+
+        if (!node.box.intersects(volume))
+            continue;
+
+        if (node.isLeaf())
+        {
+            results.push_back(node.userData);
+            ++count;
+        }
+        else
+        {
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+    }
+    return count;
+}
+
+int BoundingVolumeTree::allocateNode()
+{
+    if (_freeList == NULL_NODE)
+    {
+        _nodes.push_back(TreeNode());
+        _freeList = (int)_nodes.size() - 1;
+        _nodes[_freeList].parent = NULL_NODE;
+    }
+
+    int index = _freeList;
+    TreeNode& node = _nodes[index];
+    _freeList = node.parent;
+    node.userData = NULL;
+    node.parent = NULL_NODE;
+    node.child1 = NULL_NODE;
+    node.child2 = NULL_NODE;
+    node.height = 0;
+    return index;
+}
+
+void BoundingVolumeTree::freeNode(int index)
+{
+    TreeNode& node = _nodes[index];
+    node.userData = NULL;
+    node.parent = _freeList;
+    node.height = -1;
+    _freeList = index;
+}
+
+void BoundingVolumeTree::insertLeaf(int leaf)
+{
+    if (_root == NULL_NODE)
+    {
+        _root = leaf;
+        _nodes[leaf].parent = NULL_NODE;
+        return;
+    }
+
+    // Descend to the sibling that minimizes the total area added to the tree.
+    const BoundingBox leafBox = _nodes[leaf].box;
+    int index = _root;
+    while (!_nodes[index].isLeaf())
+    {
+        const TreeNode& node = _nodes[index];
+        float area = getPerimeter(node.box);
+        float combinedArea = getPerimeter(getMerged(node.box, leafBox));
+
+        // The cost of making a new parent for this node and the leaf.
+        float cost = 2.0f * combinedArea;
+
+        // The minimum cost of pushing the leaf further down the tree.
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        float childCost[2];
+        int children[2] = { node.child1, node.child2 };
+        for (int i = 0; i < 2; ++i)
+        {
+            const TreeNode& child = _nodes[children[i]];
+            float mergedArea = getPerimeter(getMerged(child.box, leafBox));
+            childCost[i] = (child.isLeaf() ? mergedArea : mergedArea - getPerimeter(child.box)) + inheritanceCost;
+        }
+
+        if (cost < childCost[0] && cost < childCost[1])
+            break;
+
+        index = childCost[0] < childCost[1] ? children[0] : children[1];
+    }
+
+    // Create a new parent for the sibling and the leaf.
+    int sibling = index;
+    int oldParent = _nodes[sibling].parent;
+    int newParent = allocateNode();
+    _nodes[newParent].parent = oldParent;
+    _nodes[newParent].box = getMerged(leafBox, _nodes[sibling].box);
+    _nodes[newParent].height = _nodes[sibling].height + 1;
+    _nodes[newParent].child1 = sibling;
+    _nodes[newParent].child2 = leaf;
+    _nodes[sibling].parent = newParent;
+    _nodes[leaf].parent = newParent;
+
+    if (oldParent != NULL_NODE)
+    {
+        if (_nodes[oldParent].child1 == sibling)
+            _nodes[oldParent].child1 = newParent;
+        else
+            _nodes[oldParent].child2 = newParent;
+    }
+    else
+    {
+        _root = newParent;
+    }
+
+    refit(_nodes[leaf].parent);
+}
+
+void BoundingVolumeTree::removeLeaf(int leaf)
+{
+    if (leaf == _root)
+    {
+        _root = NULL_NODE;
+        return;
+    }
+
+    int parent = _nodes[leaf].parent;
+    int grandParent = _nodes[parent].parent;
+    int sibling = _nodes[parent].child1 == leaf ? _nodes[parent].child2 : _nodes[parent].child1;
+
+    // Replace the parent with the sibling.
+    if (grandParent != NULL_NODE)
+    {
+        if (_nodes[grandParent].child1 == parent)
+            _nodes[grandParent].child1 = sibling;
+        else
+            _nodes[grandParent].child2 = sibling;
+        _nodes[sibling].parent = grandParent;
+        freeNode(parent);
+        refit(grandParent);
+    }
+    else
+    {
+        _root = sibling;
+        _nodes[sibling].parent = NULL_NODE;
+        freeNode(parent);
+    }
+}
+
+void BoundingVolumeTree::refit(int index)
+{
+    while (index != NULL_NODE)
+    {
+        index = balance(index);
+
+        TreeNode& node = _nodes[index];
+        const TreeNode& child1 = _nodes[node.child1];
+        const TreeNode& child2 = _nodes[node.child2];
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.box = getMerged(child1.box, child2.box);
+
+        index = node.parent;
+    }
+}
+
+int BoundingVolumeTree::balance(int iA)
+{
+    GP_ASSERT(iA != NULL_NODE);
+
+    TreeNode* a = &_nodes[iA];
+    if (a->isLeaf() || a->height < 2)
+        return iA;
+
+    int iB = a->child1;
+    int iC = a->child2;
+    TreeNode* b = &_nodes[iB];
+    TreeNode* c = &_nodes[iC];
+    int difference = c->height - b->height;
+
+    // Rotates the taller child up to replace the given node, where 'up' is the taller child and 'other' its sibling.
+    if (difference > 1 || difference < -1)
+    {
+        int iUp = difference > 1 ? iC : iB;
+        int iOther = difference > 1 ? iB : iC;
+        TreeNode* up = &_nodes[iUp];
+        int iF = up->child1;
+        int iG = up->child2;
+        TreeNode* f = &_nodes[iF];
+        TreeNode* g = &_nodes[iG];
+
+        // The taller child takes the place of the given node.
+        up->child1 = iA;
+        up->parent = a->parent;
+        a->parent = iUp;
+        if (up->parent != NULL_NODE)
+        {
+            TreeNode& upParent = _nodes[up->parent];
+            if (upParent.child1 == iA)
+                upParent.child1 = iUp;
+            else
+                upParent.child2 = iUp;
+        }
+        else
+        {
+            _root = iUp;
+        }
+
+        // The taller grandchild stays with the rotated node, the shorter one moves down to the given node.
+        int iKeep = f->height > g->height ? iF : iG;
+        int iMove = f->height > g->height ? iG : iF;
+        up->child2 = iKeep;
+        if (difference > 1)
+            a->child2 = iMove;
+        else
+            a->child1 = iMove;
+        _nodes[iMove].parent = iA;
+
+        const TreeNode& other = _nodes[iOther];
+        const TreeNode& moved = _nodes[iMove];
+        const TreeNode& kept = _nodes[iKeep];
+        a->box = getMerged(other.box, moved.box);
+        a->height = 1 + std::max(other.height, moved.height);
+        up->box = getMerged(a->box, kept.box);
+        up->height = 1 + std::max(a->height, kept.height);
+        return iUp;
+    }
+
+    return iA;
+}
+
+}
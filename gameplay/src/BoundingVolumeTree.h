@@ -0,0 +1,201 @@
+#ifndef BOUNDINGVOLUMETREE_H_
+#define BOUNDINGVOLUMETREE_H_
+
+#include "BoundingBox.h"
+
+namespace gameplay
+{
+
+/**
+ * Defines a dynamic bounding volume hierarchy of axis-aligned bounding boxes.
+ *
+ * Each object inserted into the tree is represented by a proxy with a fattened
+ * bounding box. Moving an object only restructures the tree when its tight
+ * bounding box leaves the fattened one, and the tree is kept balanced through
+ * rotations as proxies are inserted and removed. Queries only descend into the
+ * branches whose bounding boxes intersect the query volume, so their cost scales
+ * with the number of objects found rather than the number of objects in the tree.
+ *
+ * @script{ignore}
+ */
+class BoundingVolumeTree
+{
+public:
+
+    /**
+     * Constructor.
+     */
+    BoundingVolumeTree();
+
+    /**
+     * Destructor.
+     */
+    ~BoundingVolumeTree();
+
+    /**
+     * Inserts a proxy for an object into the tree.
+     *
+     * @param box The bounding box of the object.
+     * @param userData The object the proxy represents, returned by the queries.
+     * @param margin The distance to fatten the bounding box by in each direction.
+     *
+     * @return The new proxy.
+     */
+    int insert(const BoundingBox& box, void* userData, float margin = 0.0f);
+
+    /**
+     * Removes a proxy from the tree.
+     *
+     * @param proxy The proxy returned by insert().
+     */
+    void remove(int proxy);
+
+    /**
+     * Updates the bounding box of a proxy.
+     *
+     * The tree is only changed if the box is no longer contained by the proxy's fattened box.
+     *
+     * @param proxy The proxy returned by insert().
+     * @param box The new bounding box of the object.
+     * @param margin The distance to fatten the bounding box by in each direction.
+     *
+     * @return true if the proxy was moved in the tree, false otherwise.
+     */
+    bool update(int proxy, const BoundingBox& box, float margin = 0.0f);
+
+    /**
+     * Gets the object that a proxy represents.
+     *
+     * @param proxy The proxy returned by insert().
+     *
+     * @return The object passed to insert().
+     */
+    void* getUserData(int proxy) const;
+
+    /**
+     * Gets the fattened bounding box of a proxy.
+     *
+     * @param proxy The proxy returned by insert().
+     *
+     * @return The fattened bounding box of the proxy.
+     */
+    const BoundingBox& getBoundingBox(int proxy) const;
+
+    /**
+     * Gets the number of proxies in the tree.
+     *
+     * @return The number of proxies.
+     */
+    unsigned int getProxyCount() const;
+
+    /**
+     * Gets the height of the tree, zero if it is empty.
+     *
+     * @return The height of the tree.
+     */
+    int getHeight() const;
+
+    /**
+     * Removes all proxies from the tree.
+     */
+    void clear();
+
+    /**
+     * Finds the objects whose fattened bounding boxes intersect a frustum.
+     *
+     * @param frustum The frustum to test.
+     * @param results The vector to append the objects to.
+     *
+     * @return The number of objects appended.
+     */
+    unsigned int query(const Frustum& frustum, std::vector<void*>& results) const;
+
+    /**
+     * Finds the objects whose fattened bounding boxes intersect a bounding box.
+     *
+     * @param box The bounding box to test.
+     * @param results The vector to append the objects to.
+     *
+     * @return The number of objects appended.
+     */
+    unsigned int query(const BoundingBox& box, std::vector<void*>& results) const;
+
+    /**
+     * Finds the objects whose fattened bounding boxes intersect a bounding sphere.
+     *
+     * @param sphere The bounding sphere to test.
+     * @param results The vector to append the objects to.
+     *
+     * @return The number of objects appended.
+     */
+    unsigned int query(const BoundingSphere& sphere, std::vector<void*>& results) const;
+
+    /**
+     * Finds the objects whose fattened bounding boxes intersect a ray.
+     *
+     * @param ray The ray to test.
+     * @param maxDistance The maximum distance along the ray to test.
+     * @param results The vector to append the objects to.
+     *
+     * @return The number of objects appended.
+     */
+    unsigned int query(const Ray& ray, float maxDistance, std::vector<void*>& results) const;
+
+private:
+
+    struct TreeNode
+    {
+        bool isLeaf() const { return child1 < 0; }
+
+        BoundingBox box;
+        void* userData;
+        // The parent for nodes in the tree, or the next free node for nodes in the free list.
+        int parent;
+        int child1;
+        int child2;
+        // The height of the node above the leaves, or -1 for free nodes.
+        int height;
+    };
+
+    /**
+     * Hidden copy constructor.
+     */
+    BoundingVolumeTree(const BoundingVolumeTree&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    BoundingVolumeTree& operator=(const BoundingVolumeTree&);
+
+    int allocateNode();
+
+    void freeNode(int index);
+
+    void insertLeaf(int leaf);
+
+    void removeLeaf(int leaf);
+
+    /**
+     * Recomputes the bounding boxes and heights from the given node up to the root, balancing along the way.
+     */
+    void refit(int index);
+
+    /**
+     * Performs a rotation at the given node if its children are unbalanced.
+     *
+     * @return The index of the node that replaced the given node in the tree.
+     */
+    int balance(int index);
+
+    template <class T>
+    unsigned int queryNodes(const T& volume, std::vector<void*>& results) const;
+
+    std::vector<TreeNode> _nodes;
+    int _root;
+    int _freeList;
+    unsigned int _proxyCount;
+};
+
+}
+
+#endif
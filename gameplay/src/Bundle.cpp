@@ -4,6 +4,9 @@
 #include "MeshPart.h"
 #include "Scene.h"
 #include "Joint.h"
+#include "SceneLoader.h"
+#include "GLStateCache.h"
+#include "UploadThread.h"
 
 // Minimum version numbers supported
 #define BUNDLE_VERSION_MAJOR_REQUIRED   1 
@@ -22,19 +25,510 @@
 #define BUNDLE_TYPE_MESH                34
 #define BUNDLE_TYPE_MESHPART            35
 #define BUNDLE_TYPE_MESHSKIN            36
+#define BUNDLE_TYPE_CONVEXHULL          37
 #define BUNDLE_TYPE_FONT                128
 
+// Suffix added to the ids of meshes for the ids of their cooked convex hulls
+#define BUNDLE_CONVEXHULL_SUFFIX        "_hull"
+
 // For sanity checking string reads
 #define BUNDLE_MAX_STRING_LENGTH        5000
 
 #define BUNDLE_VERSION_MAJOR_FONT_FORMAT  1
 #define BUNDLE_VERSION_MINOR_FONT_FORMAT  5
 
+// Minor version from which bundles list their compressed sections after the ref table
+#define BUNDLE_VERSION_MINOR_SECTIONS     8
+
+// Minor version from which vertex elements have a value type and a normalized flag
+#define BUNDLE_VERSION_MINOR_VERTEX_TYPES 9
+
+// Minor version from which mesh skins store the bounds of the vertices of each joint
+#define BUNDLE_VERSION_MINOR_JOINT_BOUNDS 10
+
+// Encodings of the key values of animation channels (since version 1.7)
+#define BUNDLE_ANIMATION_CHANNEL_FLOAT      0
+#define BUNDLE_ANIMATION_CHANNEL_QUANTIZED  1
+
 namespace gameplay
 {
 
 static std::vector<Bundle*> __bundleCache;
 
+struct Bundle::PendingLoad
+{
+    PendingLoad() : hasSceneId(false), properties(NULL), bundle(NULL), nextMesh(0) { }
+
+    std::string path;                                           // Path of the bundle, read from the scene file when loading one
+    std::string sceneUrl;                                       // URL of the .scene file, or empty when loading from the bundle
+    std::string sceneId;
+    bool hasSceneId;
+    LoadSceneCallback callback;
+    Properties* properties;                                     // The parsed scene file
+    Bundle* bundle;
+    JobSystem::Counter read;                                    // Outstanding job parsing the scene file or reading the meshes
+    std::vector<std::pair<std::string, MeshData*> > meshData;
+    size_t nextMesh;                                            // The next mesh data to create a mesh from
+};
+
+std::vector<Bundle::PendingLoad*> Bundle::_pendingLoads;
+
+// Gets the number of bytes of mesh data that asynchronous loads may upload each frame.
+static size_t getMeshUploadBudget()
+{
+    static size_t budget = 0;
+    if (budget == 0)
+    {
+        Properties* graphicsConfig = Game::getInstance()->getConfig()->getNamespace("graphics", true);
+        int kilobytes = graphicsConfig && graphicsConfig->exists("meshUploadBudget") ? graphicsConfig->getInt("meshUploadBudget") : 0;
+        budget = (size_t)(kilobytes > 0 ? kilobytes : 4096) * 1024;
+    }
+    return budget;
+}
+
+// Gets the size of an index, in bytes.
+static size_t getIndexSize(Mesh::IndexFormat indexFormat)
+{
+    return indexFormat == Mesh::INDEX8 ? 1 : (indexFormat == Mesh::INDEX16 ? 2 : 4);
+}
+
+// Reads a byte of every page of mapped data, so that the pages are faulted in on the calling thread.
+static void touchPages(const unsigned char* data, size_t size)
+{
+    volatile unsigned char sum = 0;
+    for (size_t i = 0; i < size; i += 4096)
+        sum = sum + data[i];
+    if (size > 0)
+        sum = sum + data[size - 1];
+}
+
+/**
+ * Reads a bundle file that is mapped into memory.
+ *
+ * Bundles are read a field at a time, which costs a copy from the mapping, rather than
+ * a call into the C runtime, and the vertex and index data of meshes can be uploaded
+ * straight from the mapping.
+ *
+ * @script{ignore}
+ */
+class MappedBundleStream : public Stream
+{
+public:
+
+    MappedBundleStream(const void* data, size_t size)
+        : _data((const unsigned char*)data), _size(size), _position(0)
+    {
+    }
+
+    ~MappedBundleStream()
+    {
+        close();
+    }
+
+    bool canRead()
+    {
+        return _data != NULL;
+    }
+
+    bool canWrite()
+    {
+        return false;
+    }
+
+    bool canSeek()
+    {
+        return true;
+    }
+
+    void close()
+    {
+        FileSystem::unmapFile(_data, _size);
+        _data = NULL;
+    }
+
+    size_t read(void* ptr, size_t size, size_t count)
+    {
+        if (!_data || size == 0)
+            return 0;
+        count = std::min(count, (_size - _position) / size);
+        memcpy(ptr, _data + _position, size * count);
+        _position += size * count;
+        return count;
+    }
+
+    char* readLine(char* str, int num)
+    {
+        if (!_data || num <= 0 || _position >= _size)
+            return NULL;
+        int i = 0;
+        while (i < num - 1 && _position < _size)
+        {
+            char c = (char)_data[_position++];
+            str[i++] = c;
+            if (c == '\n')
+                break;
+        }
+        str[i] = '\0';
+        return str;
+    }
+
+    size_t write(const void* ptr, size_t size, size_t count)
+    {
+        return 0;
+    }
+
+    bool eof()
+    {
+        return _position >= _size;
+    }
+
+    size_t length()
+    {
+        return _size;
+    }
+
+    long int position()
+    {
+        return (long int)_position;
+    }
+
+    bool seek(long int offset, int origin)
+    {
+        long int position;
+        switch (origin)
+        {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position = (long int)_position + offset;
+            break;
+        case SEEK_END:
+            position = (long int)_size + offset;
+            break;
+        default:
+            return false;
+        }
+        if (position < 0 || (size_t)position > _size)
+            return false;
+        _position = (size_t)position;
+        return true;
+    }
+
+    bool rewind()
+    {
+        _position = 0;
+        return true;
+    }
+
+    const void* map(size_t size)
+    {
+        if (!_data || size > _size - _position)
+            return NULL;
+        const unsigned char* data = _data + _position;
+        _position += size;
+        return data;
+    }
+
+private:
+
+    const unsigned char* _data;
+    size_t _size;
+    size_t _position;
+};
+
+/**
+ * Reads a bundle file whose mesh and animation sections are LZ4 compressed.
+ *
+ * The stream reads the bundle as if it was not compressed, so the offsets in the ref table
+ * and the stream positions the bundle reads at are unchanged by the compression. Sections
+ * are decompressed when they are first read, one at a time, unless they were all decompressed
+ * in parallel by prefetch().
+ *
+ * @script{ignore}
+ */
+class CompressedBundleStream : public Stream
+{
+public:
+
+    struct Section
+    {
+        size_t offset;                  // Offset in the uncompressed bundle
+        size_t size;                    // Size in the uncompressed bundle
+        size_t storedOffset;            // Offset in the file
+        size_t storedSize;              // Size in the file, which is the size when the section is not compressed
+        unsigned char* data;            // The decompressed section, or NULL
+    };
+
+    CompressedBundleStream(Stream* stream, const std::vector<Section>& sections)
+        : _stream(stream), _sections(sections), _length(stream->length()), _position(0), _current(sections.size()), _prefetched(false)
+    {
+        for (size_t i = 0, count = _sections.size(); i < count; ++i)
+            _length += _sections[i].size - _sections[i].storedSize;
+    }
+
+    ~CompressedBundleStream()
+    {
+        close();
+    }
+
+    bool canRead()
+    {
+        return _stream != NULL;
+    }
+
+    bool canWrite()
+    {
+        return false;
+    }
+
+    bool canSeek()
+    {
+        return true;
+    }
+
+    void close()
+    {
+        discard();
+        SAFE_DELETE(_stream);
+    }
+
+    size_t read(void* ptr, size_t size, size_t count)
+    {
+        if (!_stream || size == 0)
+            return 0;
+        count = std::min(count, (_length - _position) / size);
+        unsigned char* out = (unsigned char*)ptr;
+        size_t remaining = size * count;
+        while (remaining > 0)
+        {
+            size_t n = readSpan(out, remaining);
+            if (n == 0)
+                return (size * count - remaining) / size;
+            out += n;
+            remaining -= n;
+        }
+        return count;
+    }
+
+    char* readLine(char* str, int num)
+    {
+        if (!_stream || num <= 0 || _position >= _length)
+            return NULL;
+        int i = 0;
+        while (i < num - 1 && _position < _length)
+        {
+            char c;
+            if (read(&c, 1, 1) != 1)
+                break;
+            str[i++] = c;
+            if (c == '\n')
+                break;
+        }
+        str[i] = '\0';
+        return str;
+    }
+
+    size_t write(const void* ptr, size_t size, size_t count)
+    {
+        return 0;
+    }
+
+    bool eof()
+    {
+        return _position >= _length;
+    }
+
+    size_t length()
+    {
+        return _length;
+    }
+
+    long int position()
+    {
+        return (long int)_position;
+    }
+
+    bool seek(long int offset, int origin)
+    {
+        long int position;
+        switch (origin)
+        {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position = (long int)_position + offset;
+            break;
+        case SEEK_END:
+            position = (long int)_length + offset;
+            break;
+        default:
+            return false;
+        }
+        if (position < 0 || (size_t)position > _length)
+            return false;
+        _position = (size_t)position;
+        return true;
+    }
+
+    bool rewind()
+    {
+        _position = 0;
+        return true;
+    }
+
+    /**
+     * Decompresses every compressed section in parallel on the JobSystem, and keeps them until discard().
+     */
+    void prefetch()
+    {
+        // The compressed sections are read in file order on this thread, then decompressed in parallel.
+        std::vector<size_t> sections;
+        std::vector<unsigned char*> storedData;
+        for (size_t i = 0, count = _sections.size(); i < count; ++i)
+        {
+            Section& section = _sections[i];
+            if (section.data || section.storedSize == section.size)
+                continue;
+            unsigned char* stored = readStored(section);
+            if (stored)
+            {
+                sections.push_back(i);
+                storedData.push_back(stored);
+            }
+        }
+
+        JobSystem::RangeFunction decompress = [this, &sections, &storedData](unsigned int first, unsigned int last)
+        {
+            for (unsigned int i = first; i < last; ++i)
+            {
+                Section& section = _sections[sections[i]];
+                section.data = new unsigned char[section.size];
+                if (!FileSystem::decompress(storedData[i], section.storedSize, section.data, section.size))
+                    SAFE_DELETE_ARRAY(section.data);
+                SAFE_DELETE_ARRAY(storedData[i]);
+            }
+        };
+        JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+        if (jobSystem)
+            jobSystem->parallelFor(0, (unsigned int)sections.size(), decompress, 1);
+        else
+            decompress(0, (unsigned int)sections.size());
+        _prefetched = true;
+    }
+
+    /**
+     * Frees the decompressed sections.
+     */
+    void discard()
+    {
+        for (size_t i = 0, count = _sections.size(); i < count; ++i)
+            SAFE_DELETE_ARRAY(_sections[i].data);
+        _current = _sections.size();
+        _prefetched = false;
+    }
+
+private:
+
+    /**
+     * Reads a section as it is stored in the file.
+     */
+    unsigned char* readStored(const Section& section)
+    {
+        unsigned char* stored = new unsigned char[section.storedSize];
+        if (!_stream->seek((long int)section.storedOffset, SEEK_SET) || _stream->read(stored, 1, section.storedSize) != section.storedSize)
+        {
+            GP_ERROR("Failed to read compressed bundle section at offset %u.", (unsigned int)section.offset);
+            SAFE_DELETE_ARRAY(stored);
+        }
+        return stored;
+    }
+
+    /**
+     * Reads from the current position up to the end of the section or gap between sections it is in.
+     */
+    size_t readSpan(unsigned char* ptr, size_t size)
+    {
+        // Find the first section ending after the position.
+        size_t index = 0;
+        size_t count = _sections.size();
+        size_t low = 0;
+        size_t high = count;
+        while (low < high)
+        {
+            size_t middle = (low + high) / 2;
+            if (_sections[middle].offset + _sections[middle].size <= _position)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        index = low;
+
+        if (index < count && _sections[index].offset <= _position)
+        {
+            Section& section = _sections[index];
+            size_t offset = _position - section.offset;
+            size = std::min(size, section.size - offset);
+            if (section.storedSize == section.size)
+            {
+                // The section did not compress, so it is stored as it is.
+                if (!_stream->seek((long int)(section.storedOffset + offset), SEEK_SET) || _stream->read(ptr, 1, size) != size)
+                    return 0;
+            }
+            else
+            {
+                if (!section.data && !decompress(index))
+                    return 0;
+                memcpy(ptr, section.data + offset, size);
+            }
+        }
+        else
+        {
+            // Data between compressed sections is stored as it is, shifted by the sections before it.
+            size_t end = index < count ? _sections[index].offset : _length;
+            size_t shift = index < count ? _sections[index].offset - _sections[index].storedOffset : _length - _stream->length();
+            size = std::min(size, end - _position);
+            if (!_stream->seek((long int)(_position - shift), SEEK_SET) || _stream->read(ptr, 1, size) != size)
+                return 0;
+        }
+        _position += size;
+        return size;
+    }
+
+    /**
+     * Decompresses a section that is read without being prefetched, freeing the last such section.
+     */
+    bool decompress(size_t index)
+    {
+        if (!_prefetched && _current < _sections.size())
+            SAFE_DELETE_ARRAY(_sections[_current].data);
+
+        Section& section = _sections[index];
+        unsigned char* stored = readStored(section);
+        if (!stored)
+            return false;
+        section.data = new unsigned char[section.size];
+        bool decompressed = FileSystem::decompress(stored, section.storedSize, section.data, section.size);
+        SAFE_DELETE_ARRAY(stored);
+        if (!decompressed)
+        {
+            GP_ERROR("Failed to decompress bundle section at offset %u.", (unsigned int)section.offset);
+            SAFE_DELETE_ARRAY(section.data);
+            return false;
+        }
+        _current = index;
+        return true;
+    }
+
+    Stream* _stream;
+    std::vector<Section> _sections;     // The sections, in file order
+    size_t _length;
+    size_t _position;
+    size_t _current;                    // The section decompressed by the last read, or the number of sections
+    bool _prefetched;
+};
+
 Bundle::Bundle(const char* path) :
     _path(path), _referenceCount(0), _references(NULL), _stream(NULL), _trackedNodes(NULL)
 {
@@ -51,6 +545,9 @@ Bundle::~Bundle()
         __bundleCache.erase(itr);
     }
 
+    for (std::map<std::string, Mesh*>::iterator itr = _preparedMeshes.begin(); itr != _preparedMeshes.end(); ++itr)
+        SAFE_RELEASE(itr->second);
+
     SAFE_DELETE_ARRAY(_references);
 
     if (_stream)
@@ -185,8 +682,21 @@ Bundle* Bundle::create(const char* path)
         }
     }
 
-    // Open the bundle.
-    Stream* stream = FileSystem::open(path);
+    return open(path);
+}
+
+Bundle* Bundle::open(const char* path)
+{
+    GP_ASSERT(path);
+
+    // Open the bundle, mapping it into memory where the platform supports it.
+    Stream* stream = NULL;
+    size_t mappingSize = 0;
+    const void* mapping = FileSystem::mapFile(path, &mappingSize);
+    if (mapping)
+        stream = new MappedBundleStream(mapping, mappingSize);
+    else
+        stream = FileSystem::open(path);
     if (!stream)
     {
         GP_WARN("Failed to open file '%s'.", path);
@@ -242,6 +752,53 @@ Bundle* Bundle::create(const char* path)
         }
     }
 
+    // Read the section table, and read the bundle through the sections if any are compressed.
+    if (version[1] >= BUNDLE_VERSION_MINOR_SECTIONS)
+    {
+        unsigned int sectionCount;
+        if (stream->read(&sectionCount, 4, 1) != 1)
+        {
+            SAFE_DELETE(stream);
+            GP_WARN("Failed to read section table for bundle '%s'.", path);
+            SAFE_DELETE_ARRAY(refs);
+            return NULL;
+        }
+        std::vector<CompressedBundleStream::Section> sections(sectionCount);
+        size_t shift = 0;
+        size_t end = 0;
+        bool compressed = false;
+        size_t length = stream->length();
+        for (unsigned int i = 0; i < sectionCount; ++i)
+        {
+            // Sections must be in file order and lie within the file as it is stored.
+            unsigned int values[3];
+            if (stream->read(values, 4, 3) != 3 || values[0] < end || values[2] > values[1] ||
+                (size_t)values[0] - shift + values[2] > length)
+            {
+                SAFE_DELETE(stream);
+                GP_WARN("Failed to read section number %d for bundle '%s'.", i, path);
+                SAFE_DELETE_ARRAY(refs);
+                return NULL;
+            }
+            CompressedBundleStream::Section& section = sections[i];
+            section.offset = values[0];
+            section.size = values[1];
+            section.storedOffset = values[0] - shift;
+            section.storedSize = values[2];
+            section.data = NULL;
+            shift += section.size - section.storedSize;
+            end = section.offset + section.size;
+            compressed |= section.storedSize != section.size;
+        }
+        if (compressed)
+        {
+            // The position is the same in the uncompressed bundle, since the header and tables are never compressed.
+            long int position = stream->position();
+            stream = new CompressedBundleStream(stream, sections);
+            stream->seek(position, SEEK_SET);
+        }
+    }
+
     // Keep file open for faster reading later.
     Bundle* bundle = new Bundle(path);
     bundle->_version[0] = version[0];
@@ -250,6 +807,15 @@ Bundle* Bundle::create(const char* path)
     bundle->_references = refs;
     bundle->_stream = stream;
 
+    // Index the refs by id and offset, keeping the first ref of each like the linear searches they replace.
+    bundle->_referenceIndex.reserve(refCount);
+    bundle->_offsetIndex.reserve(refCount);
+    for (unsigned int i = 0; i < refCount; ++i)
+    {
+        bundle->_referenceIndex.insert(std::make_pair(refs[i].id, &refs[i]));
+        bundle->_offsetIndex.insert(std::make_pair(refs[i].offset, &refs[i]));
+    }
+
     return bundle;
 }
 
@@ -258,17 +824,9 @@ Bundle::Reference* Bundle::find(const char* id) const
     GP_ASSERT(id);
     GP_ASSERT(_references);
 
-    // Search the ref table for the given id (case-sensitive).
-    for (unsigned int i = 0; i < _referenceCount; ++i)
-    {
-        if (_references[i].id == id)
-        {
-            // Found a match
-            return &_references[i];
-        }
-    }
-
-    return NULL;
+    // Look the id up in the index of the ref table (case-sensitive).
+    std::unordered_map<std::string, Reference*>::const_iterator itr = _referenceIndex.find(id);
+    return itr != _referenceIndex.end() ? itr->second : NULL;
 }
 
 void Bundle::clearLoadSession()
@@ -288,17 +846,12 @@ const char* Bundle::getIdFromOffset() const
 
 const char* Bundle::getIdFromOffset(unsigned int offset) const
 {
-    // Search the ref table for the given offset.
+    // Look the offset up in the index of the ref table.
     if (offset > 0)
     {
-        GP_ASSERT(_references);
-        for (unsigned int i = 0; i < _referenceCount; ++i)
-        {
-            if (_references[i].offset == offset && _references[i].id.length() > 0)
-            {
-                return _references[i].id.c_str();
-            }
-        }
+        std::unordered_map<unsigned int, Reference*>::const_iterator itr = _offsetIndex.find(offset);
+        if (itr != _offsetIndex.end())
+            return itr->second->id.c_str();
     }
     return NULL;
 }
@@ -379,20 +932,273 @@ bool Bundle::read(unsigned char* ptr)
     return _stream->read(ptr, sizeof(unsigned char), 1) == 1;
 }
 
-bool Bundle::read(float* ptr)
+bool Bundle::read(float* ptr)
+{
+    return _stream->read(ptr, sizeof(float), 1) == 1;
+}
+
+bool Bundle::readMatrix(float* m)
+{
+    return _stream->read(m, sizeof(float), 16) == 16;
+}
+
+void Bundle::loadSceneAsync(const char* path, const char* id, const LoadSceneCallback& callback)
+{
+    GP_ASSERT(path);
+
+    loadAsync(path, NULL, id, callback);
+}
+
+void Bundle::loadAsync(const char* path, const char* sceneUrl, const char* id, const LoadSceneCallback& callback)
+{
+    PendingLoad* load = new PendingLoad();
+    if (path)
+        load->path = path;
+    if (id)
+    {
+        load->sceneId = id;
+        load->hasSceneId = true;
+    }
+    load->callback = callback;
+    _pendingLoads.push_back(load);
+
+    // The bundle is opened on the main thread by updatePending, since worker threads must not create Ref objects.
+    if (sceneUrl)
+    {
+        load->sceneUrl = sceneUrl;
+        JobSystem::Function parse = [load]()
+        {
+            load->properties = Properties::create(load->sceneUrl.c_str());
+            if (load->properties)
+            {
+                Properties* sceneProperties = strlen(load->properties->getNamespace()) > 0 ? load->properties : load->properties->getNextNamespace();
+                if (sceneProperties)
+                    sceneProperties->getPath("path", &load->path);
+                load->properties->rewind();
+            }
+        };
+        JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+        if (jobSystem)
+            jobSystem->run(parse, &load->read);
+        else
+            parse();
+    }
+}
+
+void Bundle::readPendingMeshes(PendingLoad* load)
+{
+    GP_ASSERT(load);
+    GP_ASSERT(load->bundle);
+
+    // The bundle of a pending load is not shared, so its stream is only used by this job until it completes.
+    // The mapped mesh data stays valid while the bundle is open, so it can be uploaded after the job.
+    Bundle* bundle = load->bundle;
+    UploadThread* uploadThread = Game::getInstance()->getUploadThread();
+    bundle->prefetchSections();
+    for (unsigned int i = 0; i < bundle->_referenceCount; ++i)
+    {
+        Reference* ref = &bundle->_references[i];
+        if (ref->type != BUNDLE_TYPE_MESH || !bundle->_stream->seek(ref->offset, SEEK_SET))
+            continue;
+
+        MeshData* meshData = bundle->readMeshData(true);
+        if (meshData == NULL)
+        {
+            GP_WARN("Failed to read mesh data for mesh '%s' in bundle '%s'.", ref->id.c_str(), bundle->_path.c_str());
+            continue;
+        }
+
+        // Fault in the mapped data now rather than while it is uploaded on the main thread.
+        if (meshData->mapped)
+            touchPages(meshData->vertexData, meshData->vertexFormat.getVertexSize() * meshData->vertexCount);
+        for (size_t j = 0, count = meshData->parts.size(); j < count; ++j)
+        {
+            MeshPartData* partData = meshData->parts[j];
+            if (partData->mapped)
+                touchPages(partData->indexData, getIndexSize(partData->indexFormat) * partData->indexCount);
+        }
+        load->meshData.push_back(std::make_pair(ref->id, meshData));
+
+        // The load is only done reading once the upload thread has uploaded the mesh as well.
+        if (uploadThread)
+            uploadThread->run([meshData]() { uploadMeshData(meshData); }, &load->read);
+    }
+
+    // The mesh data of compressed sections was copied out of them, so they are no longer needed.
+    bundle->discardSections();
+}
+
+void Bundle::uploadMeshData(MeshData* meshData)
+{
+    GP_ASSERT(meshData);
+
+    // The upload context has no state cache of its own, so its bindings are made directly.
+    // Geometry too large for the pools gets buffers of its own.
+    if (MeshBufferPool::allocateVertices(meshData->vertexFormat, meshData->vertexCount, &meshData->vertexRange, true))
+    {
+        MeshBufferPool::write(GL_ARRAY_BUFFER, meshData->vertexRange, meshData->vertexData, true);
+    }
+    else
+    {
+        GL_ASSERT( glGenBuffers(1, &meshData->vertexBuffer) );
+        GL_ASSERT( glBindBuffer(GL_ARRAY_BUFFER, meshData->vertexBuffer) );
+        GL_ASSERT( glBufferData(GL_ARRAY_BUFFER, meshData->vertexFormat.getVertexSize() * meshData->vertexCount, meshData->vertexData, GL_STATIC_DRAW) );
+        GL_ASSERT( glBindBuffer(GL_ARRAY_BUFFER, 0) );
+    }
+
+    for (size_t i = 0, count = meshData->parts.size(); i < count; ++i)
+    {
+        MeshPartData* partData = meshData->parts[i];
+        if (MeshBufferPool::allocateIndices(getIndexSize(partData->indexFormat) * partData->indexCount, &partData->indexRange, true))
+        {
+            MeshBufferPool::write(GL_ELEMENT_ARRAY_BUFFER, partData->indexRange, partData->indexData, true);
+            continue;
+        }
+        GL_ASSERT( glGenBuffers(1, &partData->indexBuffer) );
+        GL_ASSERT( glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, partData->indexBuffer) );
+        GL_ASSERT( glBufferData(GL_ELEMENT_ARRAY_BUFFER, getIndexSize(partData->indexFormat) * partData->indexCount, partData->indexData, GL_STATIC_DRAW) );
+    }
+    GL_ASSERT( glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0) );
+}
+
+void Bundle::updatePending()
+{
+    size_t budget = getMeshUploadBudget();
+    size_t uploaded = 0;
+    for (size_t i = 0; i < _pendingLoads.size() && uploaded < budget;)
+    {
+        PendingLoad* load = _pendingLoads[i];
+        if (!load->read.isDone())
+        {
+            ++i;
+            continue;
+        }
+
+        // Open the bundle once its path is known, and read its meshes in the background.
+        if (load->bundle == NULL && !load->path.empty() && (load->sceneUrl.empty() || load->properties))
+        {
+            load->bundle = open(load->path.c_str());
+            if (load->bundle)
+            {
+                JobSystem::Function read = [load]() { readPendingMeshes(load); };
+                JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+                if (jobSystem)
+                {
+                    jobSystem->run(read, &load->read);
+                    ++i;
+                    continue;
+                }
+                read();
+            }
+        }
+
+        // Create the meshes, always at least one per frame so that meshes larger than the budget still load.
+        if (load->bundle)
+        {
+            GP_PROFILE_SCOPE("Bundle::updatePending");
+
+            while (load->nextMesh < load->meshData.size() && uploaded < budget)
+            {
+                const std::string& id = load->meshData[load->nextMesh].first;
+                MeshData* meshData = load->meshData[load->nextMesh].second;
+                ++load->nextMesh;
+
+                // Meshes the upload thread uploaded only need wrapping, so they don't count against the budget.
+                if (!meshData->vertexBuffer)
+                {
+                    uploaded += meshData->vertexFormat.getVertexSize() * meshData->vertexCount;
+                    for (size_t j = 0, count = meshData->parts.size(); j < count; ++j)
+                        uploaded += getIndexSize(meshData->parts[j]->indexFormat) * meshData->parts[j]->indexCount;
+                }
+
+                Mesh* mesh = load->bundle->createMesh(id.c_str(), meshData);
+                SAFE_DELETE(meshData);
+                if (mesh)
+                    load->bundle->_preparedMeshes[id] = mesh;
+            }
+            if (load->nextMesh < load->meshData.size())
+            {
+                ++i;
+                continue;
+            }
+        }
+
+        // Callbacks may start other loads, so the load is removed before they are fired.
+        _pendingLoads.erase(_pendingLoads.begin() + i);
+        completePending(load);
+    }
+}
+
+void Bundle::completePending(PendingLoad* load)
 {
-    return _stream->read(ptr, sizeof(float), 1) == 1;
+    GP_ASSERT(load);
+
+    GP_PROFILE_SCOPE("Bundle::completePending");
+
+    Scene* scene = NULL;
+    if (!load->sceneUrl.empty())
+    {
+        if (load->properties)
+            scene = SceneLoader::load(load->sceneUrl.c_str(), load->properties, load->bundle);
+        else
+            GP_ERROR("Failed to load scene file '%s'.", load->sceneUrl.c_str());
+        load->properties = NULL;
+    }
+    else if (load->bundle)
+    {
+        scene = load->bundle->loadScene(load->hasSceneId ? load->sceneId.c_str() : NULL);
+    }
+    else
+    {
+        GP_ERROR("Failed to load scene from bundle '%s'.", load->path.c_str());
+    }
+
+    // Release the meshes that no model of the scene used.
+    if (load->bundle)
+    {
+        for (std::map<std::string, Mesh*>::iterator itr = load->bundle->_preparedMeshes.begin(); itr != load->bundle->_preparedMeshes.end(); ++itr)
+            SAFE_RELEASE(itr->second);
+        load->bundle->_preparedMeshes.clear();
+        SAFE_RELEASE(load->bundle);
+    }
+
+    if (load->callback)
+        load->callback(scene);
+    else
+        SAFE_RELEASE(scene);
+    SAFE_DELETE(load);
 }
 
-bool Bundle::readMatrix(float* m)
+void Bundle::finalize()
 {
-    return _stream->read(m, sizeof(float), 16) == 16;
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    for (size_t i = 0, count = _pendingLoads.size(); i < count; ++i)
+    {
+        PendingLoad* load = _pendingLoads[i];
+        if (jobSystem)
+            jobSystem->wait(&load->read);
+        for (size_t j = load->nextMesh, meshCount = load->meshData.size(); j < meshCount; ++j)
+            SAFE_DELETE(load->meshData[j].second);
+        SAFE_DELETE(load->properties);
+        SAFE_RELEASE(load->bundle);
+        if (load->callback)
+            load->callback(NULL);
+        SAFE_DELETE(load);
+    }
+    _pendingLoads.clear();
 }
 
 Scene* Bundle::loadScene(const char* id)
 {
+    GP_PROFILE_SCOPE("Bundle::loadScene");
+
     clearLoadSession();
 
+    // Decompress the compressed sections of the bundle in parallel, rather than one at a time as they are read,
+    // unless an asynchronous load already read the meshes out of them.
+    if (_preparedMeshes.empty())
+        prefetchSections();
+
     Reference* ref = NULL;
     if (id)
     {
@@ -415,6 +1221,9 @@ Scene* Bundle::loadScene(const char* id)
 
     Scene* scene = Scene::create(getIdFromOffset());
 
+    // Allocate the nodes of the scene from its own pool.
+    ObjectPool::Scope scope(scene->getObjectPool());
+
     // Read the number of children.
     unsigned int childrenCount;
     if (!read(&childrenCount))
@@ -489,6 +1298,8 @@ Scene* Bundle::loadScene(const char* id)
 
     resolveJointReferences(scene, NULL);
 
+    discardSections();
+
     return scene;
 }
 
@@ -1023,6 +1834,37 @@ Model* Bundle::readModel(const char* nodeId)
                     }
                 }
             }
+            // Read levels of detail.
+            if (getVersionMajor() >= 1 && getVersionMinor() >= 6)
+            {
+                unsigned int lodCount;
+                if (!read(&lodCount))
+                {
+                    GP_ERROR("Failed to load level of detail count for model with mesh '%s' in bundle '%s'.", xref.c_str() + 1, _path.c_str());
+                    SAFE_RELEASE(model);
+                    return NULL;
+                }
+                for (unsigned int i = 0; i < lodCount; ++i)
+                {
+                    std::string lodXref = readString(_stream);
+                    float screenSize;
+                    if (!read(&screenSize))
+                    {
+                        GP_ERROR("Failed to load screen size of level of detail %d for model with mesh '%s' in bundle '%s'.", i + 1, xref.c_str() + 1, _path.c_str());
+                        SAFE_RELEASE(model);
+                        return NULL;
+                    }
+                    if (lodXref.length() > 1 && lodXref[0] == '#')
+                    {
+                        Mesh* lodMesh = loadMesh(lodXref.c_str() + 1, nodeId);
+                        if (lodMesh)
+                        {
+                            model->addLod(lodMesh, screenSize);
+                            SAFE_RELEASE(lodMesh);
+                        }
+                    }
+                }
+            }
             return model;
         }
     }
@@ -1097,6 +1939,35 @@ MeshSkin* Bundle::readMeshSkin()
         }
     }
 
+    // Read joint bounds.
+    if (_version[0] == 1 && _version[1] >= BUNDLE_VERSION_MINOR_JOINT_BOUNDS)
+    {
+        unsigned int jointBoundsCount;
+        if (!read(&jointBoundsCount))
+        {
+            GP_ERROR("Failed to load number of joint bounds in bundle '%s'.", _path.c_str());
+            SAFE_DELETE(meshSkin);
+            SAFE_DELETE(skinData);
+            return NULL;
+        }
+        if (jointBoundsCount > 0)
+        {
+            GP_ASSERT(jointBoundsCount == jointCount);
+            meshSkin->_jointBounds.resize(jointBoundsCount);
+            for (unsigned int i = 0; i < jointBoundsCount; i++)
+            {
+                BoundingSphere& bounds = meshSkin->_jointBounds[i];
+                if (!read(&bounds.center.x) || !read(&bounds.center.y) || !read(&bounds.center.z) || !read(&bounds.radius))
+                {
+                    GP_ERROR("Failed to load bounds of joint with index %d in bundle '%s'.", i, _path.c_str());
+                    SAFE_DELETE(meshSkin);
+                    SAFE_DELETE(skinData);
+                    return NULL;
+                }
+            }
+        }
+    }
+
     // Store the MeshSkinData so we can go back and resolve all joint references later.
     _meshSkins.push_back(skinData);
 
@@ -1304,6 +2175,17 @@ Animation* Bundle::readAnimationChannelData(Animation* animation, const char* id
     unsigned int tangentsOutCount;
     unsigned int interpolationCount;
 
+    // Read the encoding of the key values.
+    unsigned int encoding = BUNDLE_ANIMATION_CHANNEL_FLOAT;
+    if (getVersionMajor() >= 1 && getVersionMinor() >= 7)
+    {
+        if (!read(&encoding))
+        {
+            GP_ERROR("Failed to read the key value encoding for animation '%s'.", id);
+            return NULL;
+        }
+    }
+
     // Read key times.
     if (!readArray(&keyTimesCount, &keyTimes, sizeof(unsigned int)))
     {
@@ -1311,25 +2193,65 @@ Animation* Bundle::readAnimationChannelData(Animation* animation, const char* id
         return NULL;
     }
 
-    // Read key values.
-    if (!readArray(&valuesCount, &values))
+    if (encoding == BUNDLE_ANIMATION_CHANNEL_QUANTIZED)
     {
-        GP_ERROR("Failed to read key values for animation '%s'.", id);
-        return NULL;
-    }
+        // Read quantized key values, which are decoded to create the channel and quantized again by its curve.
+        unsigned int componentCount;
+        unsigned int quaternionOffset;
+        unsigned int rangesCount;
+        unsigned int quantizedCount;
+        std::vector<float> ranges;
+        std::vector<unsigned short> quantizedValues;
+        if (!read(&componentCount) || !read(&quaternionOffset) ||
+            !readArray(&rangesCount, &ranges) || !readArray(&quantizedCount, &quantizedValues))
+        {
+            GP_ERROR("Failed to read quantized key values for animation '%s'.", id);
+            return NULL;
+        }
 
-    // Read in-tangents.
-    if (!readArray(&tangentsInCount, &tangentsIn))
-    {
-        GP_ERROR("Failed to read in tangents for animation '%s'.", id);
-        return NULL;
-    }
+        const unsigned int scalarCount = quaternionOffset < componentCount ? componentCount - 4 : componentCount;
+        const unsigned int stride = quaternionOffset < componentCount ? scalarCount + 3 : scalarCount;
+        if (componentCount == 0 || (quaternionOffset < componentCount && quaternionOffset + 4 > componentCount) ||
+            rangesCount != scalarCount * 2 || quantizedCount != keyTimesCount * stride)
+        {
+            GP_ERROR("Invalid quantized key values for animation '%s'.", id);
+            return NULL;
+        }
+        if (targetAttribute > 0 && componentCount != target->getAnimationPropertyComponentCount(targetAttribute))
+        {
+            GP_ERROR("Quantized key values for animation '%s' do not match the component count of the target property.", id);
+            return NULL;
+        }
 
-    // Read out-tangents.
-    if (!readArray(&tangentsOutCount, &tangentsOut))
+        valuesCount = keyTimesCount * componentCount;
+        values.resize(valuesCount);
+        for (unsigned int i = 0; i < keyTimesCount; ++i)
+        {
+            Curve::dequantize(rangesCount > 0 ? &ranges[0] : NULL, &quantizedValues[i * stride], componentCount, quaternionOffset, &values[i * componentCount]);
+        }
+    }
+    else
     {
-        GP_ERROR("Failed to read out tangents for animation '%s'.", id);
-        return NULL;
+        // Read key values.
+        if (!readArray(&valuesCount, &values))
+        {
+            GP_ERROR("Failed to read key values for animation '%s'.", id);
+            return NULL;
+        }
+
+        // Read in-tangents.
+        if (!readArray(&tangentsInCount, &tangentsIn))
+        {
+            GP_ERROR("Failed to read in tangents for animation '%s'.", id);
+            return NULL;
+        }
+
+        // Read out-tangents.
+        if (!readArray(&tangentsOutCount, &tangentsOut))
+        {
+            GP_ERROR("Failed to read out tangents for animation '%s'.", id);
+            return NULL;
+        }
     }
 
     // Read interpolations.
@@ -1352,6 +2274,15 @@ Animation* Bundle::readAnimationChannelData(Animation* animation, const char* id
         {
             animation->createChannel(target, targetAttribute, keyTimesCount, &keyTimes[0], &values[0], Curve::LINEAR);
         }
+
+        if (encoding == BUNDLE_ANIMATION_CHANNEL_QUANTIZED)
+        {
+            GP_ASSERT(animation && !animation->_channels.empty());
+            Curve* curve = animation->_channels.back()->_curve;
+            GP_ASSERT(curve);
+            if (!curve->quantize())
+                GP_WARN("Failed to quantize a channel of animation '%s'.", id);
+        }
     }
 
     return animation;
@@ -1367,6 +2298,15 @@ Mesh* Bundle::loadMesh(const char* id, const char* nodeId)
     GP_ASSERT(_stream);
     GP_ASSERT(id);
 
+    // Meshes created ahead of the scene by an asynchronous load are handed to the first model that uses them.
+    std::map<std::string, Mesh*>::iterator prepared = _preparedMeshes.find(id);
+    if (prepared != _preparedMeshes.end())
+    {
+        Mesh* mesh = prepared->second;
+        _preparedMeshes.erase(prepared);
+        return mesh;
+    }
+
     // Save the file position.
     long position = _stream->position();
     if (position == -1L)
@@ -1383,29 +2323,67 @@ Mesh* Bundle::loadMesh(const char* id, const char* nodeId)
         return NULL;
     }
 
-    // Read mesh data.
-    MeshData* meshData = readMeshData();
+    // Read mesh data, which is uploaded straight from the bundle file when it is mapped.
+    MeshData* meshData = readMeshData(true);
     if (meshData == NULL)
     {
         GP_ERROR("Failed to load mesh data for mesh '%s'.", id);
         return NULL;
     }
 
-    // Create mesh.
-    Mesh* mesh = Mesh::createMesh(meshData->vertexFormat, meshData->vertexCount, false);
+    Mesh* mesh = createMesh(id, meshData);
+    SAFE_DELETE(meshData);
     if (mesh == NULL)
+        return NULL;
+
+    // Restore file pointer.
+    if (_stream->seek(position, SEEK_SET) == false)
     {
-        GP_ERROR("Failed to create mesh '%s'.", id);
-        SAFE_DELETE_ARRAY(meshData);
+        GP_ERROR("Failed to restore file pointer after loading mesh '%s'.", id);
         return NULL;
     }
 
+    return mesh;
+}
+
+Mesh* Bundle::createMesh(const char* id, MeshData* meshData)
+{
+    GP_ASSERT(id);
+    GP_ASSERT(meshData);
+
+    // Create mesh, around the vertex buffer or pooled range the upload thread filled if there is one.
+    // Meshes loaded on the main thread are pooled here instead.
+    if (!meshData->vertexRange.page && !meshData->vertexBuffer &&
+        MeshBufferPool::allocateVertices(meshData->vertexFormat, meshData->vertexCount, &meshData->vertexRange))
+    {
+        MeshBufferPool::write(GL_ARRAY_BUFFER, meshData->vertexRange, meshData->vertexData);
+    }
+    Mesh* mesh;
+    if (meshData->vertexRange.page)
+    {
+        mesh = Mesh::createPooledMesh(meshData->vertexFormat, meshData->vertexCount, meshData->vertexRange);
+        meshData->vertexRange = MeshBufferPool::Range();
+    }
+    else if (meshData->vertexBuffer)
+    {
+        mesh = Mesh::createUploadedMesh(meshData->vertexFormat, meshData->vertexCount, meshData->vertexBuffer);
+        meshData->vertexBuffer = 0;
+    }
+    else
+    {
+        mesh = Mesh::createMesh(meshData->vertexFormat, meshData->vertexCount, false);
+        if (mesh == NULL)
+        {
+            GP_ERROR("Failed to create mesh '%s'.", id);
+            return NULL;
+        }
+        mesh->setVertexData((float*)meshData->vertexData, 0, meshData->vertexCount);
+    }
+
     mesh->_url = _path;
     mesh->_url += "#";
     mesh->_url += id;
 
-    mesh->setVertexData((float*)meshData->vertexData, 0, meshData->vertexCount);
-
     mesh->_boundingBox.set(meshData->boundingBox);
     mesh->_boundingSphere.set(meshData->boundingSphere);
 
@@ -1415,29 +2393,114 @@ Mesh* Bundle::loadMesh(const char* id, const char* nodeId)
         MeshPartData* partData = meshData->parts[i];
         GP_ASSERT(partData);
 
+        if (!partData->indexRange.page && !partData->indexBuffer &&
+            MeshBufferPool::allocateIndices(getIndexSize(partData->indexFormat) * partData->indexCount, &partData->indexRange))
+        {
+            MeshBufferPool::write(GL_ELEMENT_ARRAY_BUFFER, partData->indexRange, partData->indexData);
+        }
+        if (partData->indexRange.page)
+        {
+            mesh->addPooledPart(partData->primitiveType, partData->indexFormat, partData->indexCount, partData->indexRange);
+            partData->indexRange = MeshBufferPool::Range();
+            continue;
+        }
+        if (partData->indexBuffer)
+        {
+            mesh->addUploadedPart(partData->primitiveType, partData->indexFormat, partData->indexCount, partData->indexBuffer);
+            partData->indexBuffer = 0;
+            continue;
+        }
+
         MeshPart* part = mesh->addPart(partData->primitiveType, partData->indexFormat, partData->indexCount, false);
         if (part == NULL)
         {
             GP_ERROR("Failed to create mesh part (with index %d) for mesh '%s'.", i, id);
-            SAFE_DELETE(meshData);
+            SAFE_RELEASE(mesh);
             return NULL;
         }
         part->setIndexData(partData->indexData, 0, partData->indexCount);
     }
 
-    SAFE_DELETE(meshData);
+    return mesh;
+}
 
-    // Restore file pointer.
-    if (_stream->seek(position, SEEK_SET) == false)
+void Bundle::unpackUnsupportedVertexElements(MeshData* meshData)
+{
+    GP_ASSERT(meshData);
+
+    const VertexFormat& format = meshData->vertexFormat;
+    unsigned int elementCount = format.getElementCount();
+    bool supported = true;
+    for (unsigned int i = 0; i < elementCount && supported; ++i)
     {
-        GP_ERROR("Failed to restore file pointer after loading mesh '%s'.", id);
-        return NULL;
+        supported = VertexFormat::isTypeSupported(format.getElement(i).type);
     }
+    if (supported)
+        return;
 
-    return mesh;
+    std::vector<VertexFormat::Element> elements(elementCount);
+    for (unsigned int i = 0; i < elementCount; ++i)
+    {
+        elements[i] = format.getElement(i);
+        if (!VertexFormat::isTypeSupported(elements[i].type))
+        {
+            elements[i].type = VertexFormat::FLOAT;
+            elements[i].normalized = false;
+        }
+    }
+    VertexFormat unpackedFormat(&elements[0], elementCount);
+    unsigned int vertexSize = format.getVertexSize();
+    unsigned int unpackedSize = unpackedFormat.getVertexSize();
+    unsigned char* vertexData = new unsigned char[(size_t)unpackedSize * meshData->vertexCount];
+    float values[4];
+    for (unsigned int v = 0; v < meshData->vertexCount; ++v)
+    {
+        const unsigned char* src = meshData->vertexData + (size_t)v * vertexSize;
+        unsigned char* dst = vertexData + (size_t)v * unpackedSize;
+        for (unsigned int i = 0; i < elementCount; ++i)
+        {
+            const VertexFormat::Element& element = format.getElement(i);
+            if (element.type == elements[i].type)
+            {
+                memcpy(dst, src, element.getByteSize());
+            }
+            else
+            {
+                VertexFormat::unpack(element, src, values);
+                memcpy(dst, values, elements[i].getByteSize());
+            }
+            src += element.getByteSize();
+            dst += elements[i].getByteSize();
+        }
+    }
+
+    if (!meshData->mapped)
+        SAFE_DELETE_ARRAY(meshData->vertexData);
+    meshData->vertexData = vertexData;
+    meshData->mapped = false;
+    meshData->vertexFormat = unpackedFormat;
+}
+
+const unsigned char* Bundle::readMappedData(size_t size)
+{
+    return (const unsigned char*)_stream->map(size);
+}
+
+void Bundle::prefetchSections()
+{
+    CompressedBundleStream* stream = dynamic_cast<CompressedBundleStream*>(_stream);
+    if (stream)
+        stream->prefetch();
+}
+
+void Bundle::discardSections()
+{
+    CompressedBundleStream* stream = dynamic_cast<CompressedBundleStream*>(_stream);
+    if (stream)
+        stream->discard();
 }
 
-Bundle::MeshData* Bundle::readMeshData()
+Bundle::MeshData* Bundle::readMeshData(bool mapData)
 {
     // Read vertex format/elements.
     unsigned int vertexElementCount;
@@ -1471,6 +2534,20 @@ Bundle::MeshData* Bundle::readMeshData()
 
         vertexElements[i].usage = (VertexFormat::Usage)vUsage;
         vertexElements[i].size = vSize;
+
+        if (_version[0] == 1 && _version[1] >= BUNDLE_VERSION_MINOR_VERTEX_TYPES)
+        {
+            unsigned int vType;
+            unsigned char vNormalized;
+            if (_stream->read(&vType, 4, 1) != 1 || _stream->read(&vNormalized, 1, 1) != 1)
+            {
+                GP_ERROR("Failed to load vertex type.");
+                SAFE_DELETE_ARRAY(vertexElements);
+                return NULL;
+            }
+            vertexElements[i].type = (VertexFormat::Type)vType;
+            vertexElements[i].normalized = vNormalized != 0;
+        }
     }
 
     MeshData* meshData = new MeshData(VertexFormat(vertexElements, vertexElementCount));
@@ -1493,13 +2570,23 @@ Bundle::MeshData* Bundle::readMeshData()
 
     GP_ASSERT(meshData->vertexFormat.getVertexSize());
     meshData->vertexCount = vertexByteCount / meshData->vertexFormat.getVertexSize();
-    meshData->vertexData = new unsigned char[vertexByteCount];
-    if (_stream->read(meshData->vertexData, 1, vertexByteCount) != vertexByteCount)
+    const unsigned char* mappedVertexData = mapData ? readMappedData(vertexByteCount) : NULL;
+    if (mappedVertexData)
+    {
+        meshData->vertexData = const_cast<unsigned char*>(mappedVertexData);
+        meshData->mapped = true;
+    }
+    else
+    {
+        meshData->vertexData = new unsigned char[vertexByteCount];
+    }
+    if (!meshData->mapped && _stream->read(meshData->vertexData, 1, vertexByteCount) != vertexByteCount)
     {
         GP_ERROR("Failed to load vertex data.");
         SAFE_DELETE(meshData);
         return NULL;
     }
+    unpackUnsupportedVertexElements(meshData);
 
     // Read mesh bounds (bounding box and bounding sphere).
     if (_stream->read(&meshData->boundingBox.min.x, 4, 3) != 3 || _stream->read(&meshData->boundingBox.max.x, 4, 3) != 3)
@@ -1572,8 +2659,17 @@ Bundle::MeshData* Bundle::readMeshData()
         GP_ASSERT(indexSize);
         partData->indexCount = iByteCount / indexSize;
 
-        partData->indexData = new unsigned char[iByteCount];
-        if (_stream->read(partData->indexData, 1, iByteCount) != iByteCount)
+        const unsigned char* mappedIndexData = mapData ? readMappedData(iByteCount) : NULL;
+        if (mappedIndexData)
+        {
+            partData->indexData = const_cast<unsigned char*>(mappedIndexData);
+            partData->mapped = true;
+        }
+        else
+        {
+            partData->indexData = new unsigned char[iByteCount];
+        }
+        if (!partData->mapped && _stream->read(partData->indexData, 1, iByteCount) != iByteCount)
         {
             GP_ERROR("Failed to read index data for mesh part with index %d.", i);
             SAFE_DELETE(meshData);
@@ -1631,6 +2727,56 @@ Bundle::MeshData* Bundle::readMeshData(const char* url)
     return meshData;
 }
 
+float* Bundle::readConvexHull(const char* url, unsigned int* vertexCount)
+{
+    GP_ASSERT(url);
+    GP_ASSERT(vertexCount);
+
+    // Parse URL (formatted as 'bundle#id').
+    std::string urlstring(url);
+    size_t pos = urlstring.find('#');
+    if (pos == std::string::npos)
+        return NULL;
+
+    std::string file = urlstring.substr(0, pos);
+    std::string id = urlstring.substr(pos + 1) + BUNDLE_CONVEXHULL_SUFFIX;
+
+    Bundle* bundle = Bundle::create(file.c_str());
+    if (bundle == NULL)
+        return NULL;
+
+    // Most meshes have no cooked hull, which is not an error.
+    Reference* ref = bundle->find(id.c_str());
+    if (ref == NULL || ref->type != BUNDLE_TYPE_CONVEXHULL)
+    {
+        SAFE_RELEASE(bundle);
+        return NULL;
+    }
+
+    float* vertices = NULL;
+    unsigned int count = 0;
+    GP_ASSERT(bundle->_stream);
+    if (!bundle->_stream->seek(ref->offset, SEEK_SET) || bundle->_stream->read(&count, 4, 1) != 1 || count == 0)
+    {
+        GP_ERROR("Failed to read convex hull '%s' in bundle '%s'.", id.c_str(), file.c_str());
+    }
+    else
+    {
+        vertices = new float[count * 3];
+        if (bundle->_stream->read(vertices, 4, count * 3) != count * 3)
+        {
+            GP_ERROR("Failed to read the vertices of convex hull '%s' in bundle '%s'.", id.c_str(), file.c_str());
+            SAFE_DELETE_ARRAY(vertices);
+            count = 0;
+        }
+    }
+    *vertexCount = count;
+
+    SAFE_RELEASE(bundle);
+
+    return vertices;
+}
+
 Font* Bundle::loadFont(const char* id)
 {
     GP_ASSERT(id);
@@ -1671,7 +2817,18 @@ Font* Bundle::loadFont(const char* id)
         }
     }
 
-    Font* masterFont = NULL;
+    // The data of each size, kept until every size is read so that their textures can share an atlas.
+    struct FontSize
+    {
+        unsigned int size;
+        std::vector<Font::Glyph> glyphs;
+        unsigned int width;
+        unsigned int height;
+        std::vector<unsigned char> textureData;
+        unsigned int format;
+        unsigned int atlasTop;
+    };
+    std::vector<FontSize> sizes;
 
     for (unsigned int i = 0; i < fontSizeCount; ++i)
     {
@@ -1771,12 +2928,11 @@ Font* Bundle::loadFont(const char* id)
         }
 
         // Read texture data.
-        unsigned char* textureData = new unsigned char[textureByteCount];
-        if (_stream->read(textureData, 1, textureByteCount) != textureByteCount)
+        std::vector<unsigned char> textureData(textureByteCount);
+        if (_stream->read(&textureData[0], 1, textureByteCount) != textureByteCount)
         {
             GP_ERROR("Failed to read texture data for font '%s'.", id);
             SAFE_DELETE_ARRAY(glyphs);
-            SAFE_DELETE_ARRAY(textureData);
             return NULL;
         }
 
@@ -1789,29 +2945,95 @@ Font* Bundle::loadFont(const char* id)
             {
                 GP_ERROR("Failed to font format'%u'.", format);
                 SAFE_DELETE_ARRAY(glyphs);
-                SAFE_DELETE_ARRAY(textureData);
                 return NULL;
             }
         }
 
-        // Create the texture for the font.
-        Texture* texture = Texture::create(Texture::ALPHA, width, height, textureData, true);
+        sizes.push_back(FontSize());
+        FontSize& fontSize = sizes.back();
+        fontSize.size = size;
+        fontSize.glyphs.assign(glyphs, glyphs + glyphCount);
+        fontSize.width = width;
+        fontSize.height = height;
+        fontSize.textureData.swap(textureData);
+        fontSize.format = format;
+
+        // Free the glyph array.
+        SAFE_DELETE_ARRAY(glyphs);
+    }
+
+    // Stack the textures of all sizes into one atlas when it fits, so that every size draws with the same sprite batch.
+    unsigned int atlasWidth = 0;
+    unsigned int atlasHeight = 0;
+    bool sharedAtlas = sizes.size() > 1;
+    for (size_t i = 0, count = sizes.size(); i < count; ++i)
+    {
+        atlasWidth = std::max(atlasWidth, sizes[i].width);
+        atlasHeight += sizes[i].height;
+        sharedAtlas &= sizes[i].format == sizes[0].format;
+    }
+    GLint maxTextureSize = 0;
+    GL_ASSERT( glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize) );
+    sharedAtlas &= atlasWidth <= (unsigned int)maxTextureSize && atlasHeight <= (unsigned int)maxTextureSize;
+
+    Texture* atlas = NULL;
+    if (sharedAtlas)
+    {
+        std::vector<unsigned char> atlasData(atlasWidth * atlasHeight, 0);
+        unsigned int offsetY = 0;
+        for (size_t i = 0, count = sizes.size(); i < count; ++i)
+        {
+            FontSize& fontSize = sizes[i];
+            for (unsigned int y = 0; y < fontSize.height; ++y)
+            {
+                memcpy(&atlasData[(offsetY + y) * atlasWidth], &fontSize.textureData[y * fontSize.width], fontSize.width);
+            }
 
-        // Free the texture data (no longer needed).
-        SAFE_DELETE_ARRAY(textureData);
+            // Move the glyphs to where their texture is in the atlas.
+            for (size_t j = 0, glyphCount = fontSize.glyphs.size(); j < glyphCount; ++j)
+            {
+                float* uvs = fontSize.glyphs[j].uvs;
+                uvs[0] = uvs[0] * fontSize.width / atlasWidth;
+                uvs[1] = (uvs[1] * fontSize.height + offsetY) / atlasHeight;
+                uvs[2] = uvs[2] * fontSize.width / atlasWidth;
+                uvs[3] = (uvs[3] * fontSize.height + offsetY) / atlasHeight;
+            }
+            fontSize.atlasTop = offsetY;
+            offsetY += fontSize.height;
+        }
 
-        if (texture == NULL)
+        atlas = Texture::create(Texture::ALPHA, atlasWidth, atlasHeight, &atlasData[0], true);
+        if (atlas == NULL)
         {
             GP_ERROR("Failed to create texture for font '%s'.", id);
-            SAFE_DELETE_ARRAY(glyphs);
             return NULL;
         }
+    }
 
-        // Create the font for this size
-        Font* font = Font::create(family.c_str(), Font::PLAIN, size, glyphs, glyphCount, texture, (Font::Format)format);
+    Font* masterFont = NULL;
+    for (size_t i = 0, count = sizes.size(); i < count; ++i)
+    {
+        FontSize& fontSize = sizes[i];
 
-        // Free the glyph array.
-        SAFE_DELETE_ARRAY(glyphs);
+        // Create the texture for the font.
+        Texture* texture = atlas;
+        if (texture)
+        {
+            texture->addRef();
+        }
+        else
+        {
+            texture = Texture::create(Texture::ALPHA, fontSize.width, fontSize.height, &fontSize.textureData[0], true);
+            if (texture == NULL)
+            {
+                GP_ERROR("Failed to create texture for font '%s'.", id);
+                SAFE_RELEASE(masterFont);
+                return NULL;
+            }
+        }
+
+        // Create the font for this size
+        Font* font = Font::create(family.c_str(), Font::PLAIN, fontSize.size, &fontSize.glyphs[0], (int)fontSize.glyphs.size(), texture, (Font::Format)fontSize.format);
 
         // Release the texture since the Font now owns it.
         SAFE_RELEASE(texture);
@@ -1820,13 +3042,30 @@ Font* Bundle::loadFont(const char* id)
         {
             font->_path = _path;
             font->_id = id;
+            if (atlas)
+            {
+                font->_atlasTop = fontSize.atlasTop;
+                font->_atlasBottom = fontSize.atlasTop + fontSize.height;
+            }
 
             if (masterFont)
+            {
                 masterFont->_sizes.push_back(font);
+                if (atlas)
+                {
+                    // The sizes draw from the same texture, so they share the sprite batch of the master font.
+                    SAFE_DELETE(font->_batch);
+                    font->_batch = masterFont->_batch;
+                    font->_sharedBatch = true;
+                }
+            }
             else
+            {
                 masterFont = font;
+            }
         }
     }
+    SAFE_RELEASE(atlas);
 
     return masterFont;
 }
@@ -1871,23 +3110,31 @@ Bundle::Reference::~Reference()
 }
 
 Bundle::MeshPartData::MeshPartData() :
-		primitiveType(Mesh::TRIANGLES), indexFormat(Mesh::INDEX32), indexCount(0), indexData(NULL)
+		primitiveType(Mesh::TRIANGLES), indexFormat(Mesh::INDEX32), indexCount(0), indexData(NULL), mapped(false), indexBuffer(0)
 {
 }
 
 Bundle::MeshPartData::~MeshPartData()
 {
-    SAFE_DELETE_ARRAY(indexData);
+    if (!mapped)
+        SAFE_DELETE_ARRAY(indexData);
+    if (indexBuffer)
+        GLStateCache::deleteBuffer(indexBuffer);
+    MeshBufferPool::free(&indexRange);
 }
 
 Bundle::MeshData::MeshData(const VertexFormat& vertexFormat)
-    : vertexFormat(vertexFormat), vertexCount(0), vertexData(NULL), primitiveType(Mesh::TRIANGLES)
+    : vertexFormat(vertexFormat), vertexCount(0), vertexData(NULL), mapped(false), vertexBuffer(0), primitiveType(Mesh::TRIANGLES)
 {
 }
 
 Bundle::MeshData::~MeshData()
 {
-    SAFE_DELETE_ARRAY(vertexData);
+    if (!mapped)
+        SAFE_DELETE_ARRAY(vertexData);
+    if (vertexBuffer)
+        GLStateCache::deleteBuffer(vertexBuffer);
+    MeshBufferPool::free(&vertexRange);
 
     for (unsigned int i = 0; i < parts.size(); ++i)
     {
@@ -16,11 +16,22 @@ namespace gameplay
  */
 class Bundle : public Ref
 {
+    friend class Game;
+    friend class NavigationMesh;
     friend class PhysicsController;
+    friend class Scene;
     friend class SceneLoader;
 
 public:
 
+    /**
+     * The function called once a scene loaded by loadSceneAsync has finished loading.
+     *
+     * The scene is passed with a reference that the callback must release, or NULL
+     * if the scene could not be loaded.
+     */
+    typedef std::function<void(Scene*)> LoadSceneCallback;
+
     /**
      * Returns a Bundle for the given resource path.
      *
@@ -47,6 +58,23 @@ public:
      */
     Scene* loadScene(const char* id = NULL);
 
+    /**
+     * Loads the scene with the specified ID from a bundle without stalling the game.
+     *
+     * The vertex and index data of the meshes in the bundle are read on the JobSystem.
+     * The meshes are then created on the main thread over the following frames, within
+     * the per-frame budget set by the property 'meshUploadBudget' (in kilobytes, 4096 by
+     * default) of the 'graphics' section of the game config. Once all of the meshes are
+     * created, the nodes, materials and animations of the scene are loaded in a single
+     * frame and the callback is called.
+     *
+     * @param path The path of the bundle.
+     * @param id The ID of the scene to load (NULL to load the first scene).
+     * @param callback The function called on the main thread once the scene has loaded.
+     * @script{ignore}
+     */
+    static void loadSceneAsync(const char* path, const char* id, const LoadSceneCallback& callback);
+
     /**
      * Loads a node with the specified ID from the bundle.
      *
@@ -150,6 +178,9 @@ private:
         Mesh::IndexFormat indexFormat;
         unsigned int indexCount;
         unsigned char* indexData;
+        bool mapped;                // Whether indexData points into the mapped bundle file rather than being owned
+        IndexBufferHandle indexBuffer;  // The index buffer the upload thread filled, or 0
+        MeshBufferPool::Range indexRange;   // The pooled range the upload thread filled, if allocated
     };
 
     struct MeshData
@@ -160,12 +191,17 @@ private:
         VertexFormat vertexFormat;
         unsigned int vertexCount;
         unsigned char* vertexData;
+        bool mapped;                // Whether vertexData points into the mapped bundle file rather than being owned
+        VertexBufferHandle vertexBuffer;    // The vertex buffer the upload thread filled, or 0
+        MeshBufferPool::Range vertexRange;  // The pooled range the upload thread filled, if allocated
         BoundingBox boundingBox;
         BoundingSphere boundingSphere;
         Mesh::PrimitiveType primitiveType;
         std::vector<MeshPartData*> parts;
     };
 
+    struct PendingLoad;
+
     Bundle(const char* path);
 
     /**
@@ -173,6 +209,49 @@ private:
      */
     ~Bundle();
 
+    /**
+     * Opens a bundle file and reads its reference table, without searching the cache.
+     */
+    static Bundle* open(const char* path);
+
+    /**
+     * Starts loading a scene asynchronously, from a bundle or from a .scene file.
+     *
+     * @param path The path of the bundle, or NULL to read it from the scene file.
+     * @param sceneUrl The URL of the .scene file, or NULL to load the scene from the bundle.
+     * @param id The ID of the scene to load from the bundle (NULL to load the first scene).
+     * @param callback The function called once the scene has loaded.
+     */
+    static void loadAsync(const char* path, const char* sceneUrl, const char* id, const LoadSceneCallback& callback);
+
+    /**
+     * Reads the data of every mesh in the bundle of a pending load. Called on the JobSystem.
+     */
+    static void readPendingMeshes(PendingLoad* load);
+
+    /**
+     * Creates and fills the vertex and index buffers of mesh data, or the pooled ranges they
+     * fit in. Called on the upload thread.
+     */
+    static void uploadMeshData(MeshData* meshData);
+
+    /**
+     * Creates the meshes of the pending loads and finishes the loads whose meshes are all created.
+     *
+     * Called once per frame by the game.
+     */
+    static void updatePending();
+
+    /**
+     * Loads the scene of a pending load whose meshes are all created, and calls its callback.
+     */
+    static void completePending(PendingLoad* load);
+
+    /**
+     * Waits for and discards the pending loads.
+     */
+    static void finalize();
+
     /**
      * Hidden copy assignment operator.
      */
@@ -255,6 +334,16 @@ private:
      */
     Mesh* loadMesh(const char* id, const char* nodeId);
 
+    /**
+     * Creates a mesh and its parts from mesh data.
+     *
+     * @param id The ID of the mesh.
+     * @param meshData The data of the mesh.
+     *
+     * @return The new mesh, or NULL if the mesh could not be created.
+     */
+    Mesh* createMesh(const char* id, MeshData* meshData);
+
     /**
      * Reads an unsigned int from the current file position.
      *
@@ -365,8 +454,37 @@ private:
 
     /**
      * Reads mesh data from the current file position.
+     *
+     * @param mapData Whether the vertex and index data may point into the mapped bundle file
+     *      instead of being copied, in which case the mesh data must not outlive this bundle.
+     */
+    MeshData* readMeshData(bool mapData = false);
+
+    /**
+     * Converts the vertex elements of mesh data whose types cannot be drawn on this platform to floats.
+     *
+     * @param meshData The mesh data, whose vertex format and vertex data are replaced if any element is converted.
+     */
+    static void unpackUnsupportedVertexElements(MeshData* meshData);
+
+    /**
+     * Decompresses all of the compressed sections of the bundle in parallel, when it has any.
      */
-    MeshData* readMeshData();
+    void prefetchSections();
+
+    /**
+     * Frees the decompressed sections of the bundle, when it has any.
+     */
+    void discardSections();
+
+    /**
+     * Gets the data at the current file position, and skips over it, when the stream of the bundle can map it.
+     *
+     * @param size The size of the data, in bytes.
+     *
+     * @return The data in the mapped file, or NULL if the stream cannot map it or is too short.
+     */
+    const unsigned char* readMappedData(size_t size);
 
     /**
      * Reads mesh data for the specified URL.
@@ -381,6 +499,20 @@ private:
      */
     static MeshData* readMeshData(const char* url);
 
+    /**
+     * Reads the convex hull cooked by the encoder for the mesh at the specified URL.
+     *
+     * The specified URL is formatted as for readMeshData(). Bundles only hold the hulls
+     * of the meshes that the encoder was asked to cook them for.
+     *
+     * @param url The URL of the mesh to read the convex hull of.
+     * @param vertexCount Populated with the number of vertices in the hull.
+     *
+     * @return A new array of the x, y and z of each hull vertex, or NULL if the bundle
+     *      has no convex hull for the mesh.
+     */
+    static float* readConvexHull(const char* url, unsigned int* vertexCount);
+
     /**
      * Reads a mesh skin from the current file position.
      *
@@ -455,10 +587,15 @@ private:
     std::string _materialPath;
     unsigned int _referenceCount;
     Reference* _references;
+    std::unordered_map<std::string, Reference*> _referenceIndex;   // Refs by id
+    std::unordered_map<unsigned int, Reference*> _offsetIndex;      // Refs by offset
     Stream* _stream;
 
     std::vector<MeshSkinData*> _meshSkins;
     std::map<std::string, Node*>* _trackedNodes;
+    std::map<std::string, Mesh*> _preparedMeshes;       // Meshes created by an asynchronous load, by ID, until their models are read
+
+    static std::vector<PendingLoad*> _pendingLoads;
 };
 
 }
@@ -241,7 +241,7 @@ const Matrix& Camera::getViewMatrix() const
         if (_node)
         {
             // The view matrix is the inverse of our transform matrix.
-            _node->getWorldMatrix().invert(&_view);
+            _node->getWorldMatrix().invertAffine(&_view);
         }
         else
         {
@@ -258,7 +258,7 @@ const Matrix& Camera::getInverseViewMatrix() const
 {
     if (_bits & CAMERA_DIRTY_INV_VIEW)
     {
-        getViewMatrix().invert(&_inverseView);
+        getViewMatrix().invertAffine(&_inverseView);
 
         _bits &= ~CAMERA_DIRTY_INV_VIEW;
     }
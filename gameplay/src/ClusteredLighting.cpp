@@ -0,0 +1,389 @@
+#include "Base.h"
+#include "ClusteredLighting.h"
+#include "Camera.h"
+#include "Game.h"
+#include "GLStateCache.h"
+#include "FrameCapture.h"
+#include "Light.h"
+#include "MaterialParameter.h"
+#include "Node.h"
+#include "Scene.h"
+
+// Number of RGBA texels that each light takes in the light texture.
+#define CLUSTER_LIGHT_TEXELS 3
+
+// Width of the index texture, which holds one light index per texel.
+#define CLUSTER_INDEX_TEXTURE_WIDTH 1024
+
+// Average number of lights per cluster that the index texture is sized for.
+#define CLUSTER_AVERAGE_LIGHTS 8
+
+namespace gameplay
+{
+
+ClusteredLighting::ClusteredLighting(unsigned int tileCountX, unsigned int tileCountY, unsigned int sliceCount, unsigned int maxLights, unsigned int maxLightsPerCluster)
+    : _tileCountX(tileCountX), _tileCountY(tileCountY), _sliceCount(sliceCount), _maxLights(maxLights), _maxLightsPerCluster(maxLightsPerCluster),
+      _maxIndices(0), _perspective(true), _overflowed(false), _lightSampler(NULL), _clusterSampler(NULL), _indexSampler(NULL)
+{
+    const unsigned int clusterCount = _tileCountX * _tileCountY * _sliceCount;
+    _maxIndices = ((clusterCount * CLUSTER_AVERAGE_LIGHTS + CLUSTER_INDEX_TEXTURE_WIDTH - 1) / CLUSTER_INDEX_TEXTURE_WIDTH) * CLUSTER_INDEX_TEXTURE_WIDTH;
+
+    _lightData.resize(_maxLights * CLUSTER_LIGHT_TEXELS * 4, 0.0f);
+    _clusterData.resize(clusterCount * 4, 0.0f);
+    _indexData.resize(_maxIndices * 4, 0.0f);
+    _clusterCounts.resize(clusterCount, 0);
+    _sliceDepths.resize(_sliceCount + 1, 0.0f);
+
+    _grid.set((float)_tileCountX, (float)_tileCountY, (float)_sliceCount, 0.0f);
+    _textureScale.set(1.0f / CLUSTER_INDEX_TEXTURE_WIDTH, (float)CLUSTER_INDEX_TEXTURE_WIDTH / _maxIndices, 1.0f / _maxLights, 0.0f);
+}
+
+ClusteredLighting::~ClusteredLighting()
+{
+    SAFE_RELEASE(_lightSampler);
+    SAFE_RELEASE(_clusterSampler);
+    SAFE_RELEASE(_indexSampler);
+}
+
+bool ClusteredLighting::isSupported()
+{
+#ifdef GP_USE_FLOAT_TEXTURES
+    return GLEW_VERSION_3_0 || GLEW_ARB_texture_float;
+#else
+    return false;
+#endif
+}
+
+ClusteredLighting* ClusteredLighting::create(unsigned int tileCountX, unsigned int tileCountY, unsigned int sliceCount, unsigned int maxLights, unsigned int maxLightsPerCluster)
+{
+    GP_ASSERT(tileCountX > 0 && tileCountY > 0 && sliceCount > 0);
+    GP_ASSERT(maxLights > 0 && maxLightsPerCluster > 0);
+
+    if (!isSupported())
+    {
+        GP_WARN("Clustered lighting requires floating point textures, which are not supported.");
+        return NULL;
+    }
+
+    ClusteredLighting* lighting = new ClusteredLighting(tileCountX, tileCountY, sliceCount, maxLights, maxLightsPerCluster);
+    if (!lighting->initialize())
+    {
+        GP_ERROR("Failed to initialize clustered lighting.");
+        SAFE_DELETE(lighting);
+    }
+    return lighting;
+}
+
+// Creates an RGBA floating point texture that is sampled without filtering.
+static Texture::Sampler* createFloatSampler(unsigned int width, unsigned int height)
+{
+#ifdef GP_USE_FLOAT_TEXTURES
+    TextureHandle handle;
+    GL_ASSERT( glGenTextures(1, &handle) );
+    GLStateCache::bindTexture(GL_TEXTURE_2D, handle);
+    GL_ASSERT( glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, width, height, 0, GL_RGBA, GL_FLOAT, NULL) );
+
+    Texture* texture = Texture::create(handle, width, height);
+    Texture::Sampler* sampler = Texture::Sampler::create(texture);
+    SAFE_RELEASE(texture);
+    sampler->setFilterMode(Texture::NEAREST, Texture::NEAREST);
+    sampler->setWrapMode(Texture::CLAMP, Texture::CLAMP);
+    return sampler;
+#else
+    return NULL;
+#endif
+}
+
+bool ClusteredLighting::initialize()
+{
+    _lightSampler = createFloatSampler(CLUSTER_LIGHT_TEXELS, _maxLights);
+    _clusterSampler = createFloatSampler(_tileCountX * _tileCountY, _sliceCount);
+    _indexSampler = createFloatSampler(CLUSTER_INDEX_TEXTURE_WIDTH, _maxIndices / CLUSTER_INDEX_TEXTURE_WIDTH);
+    return _lightSampler && _clusterSampler && _indexSampler;
+}
+
+bool ClusteredLighting::gatherLight(Node* node)
+{
+    if (!node->isEnabled())
+        return false;
+
+    Light* light = node->getLight();
+    if (light && light->getLightType() != Light::DIRECTIONAL)
+    {
+        if (_lights.size() < _maxLights)
+        {
+            _lights.push_back(node);
+        }
+        else if (!_overflowed)
+        {
+            GP_WARN("More than %u point and spot lights are in view; the rest are ignored by clustered lighting.", _maxLights);
+            _overflowed = true;
+        }
+    }
+    return true;
+}
+
+// Gets the range of normalized device coordinates covered by an interval of view space
+// positions between two depths, along one axis of the projection.
+static void getDeviceRange(float minPosition, float maxPosition, float minDepth, float maxDepth, float scale, float offset,
+                           bool perspective, float* minDevice, float* maxDevice)
+{
+    if (perspective)
+    {
+        *minDevice = scale * (minPosition / (minPosition < 0.0f ? minDepth : maxDepth)) - offset;
+        *maxDevice = scale * (maxPosition / (maxPosition > 0.0f ? minDepth : maxDepth)) - offset;
+    }
+    else
+    {
+        *minDevice = scale * minPosition + offset;
+        *maxDevice = scale * maxPosition + offset;
+    }
+}
+
+// Gets the tiles covered by a range of normalized device coordinates.
+static bool getTiles(float minDevice, float maxDevice, unsigned int tileCount, unsigned int* first, unsigned int* last)
+{
+    if (maxDevice < -1.0f || minDevice > 1.0f)
+        return false;
+
+    float low = (MATH_CLAMP(minDevice, -1.0f, 1.0f) * 0.5f + 0.5f) * tileCount;
+    float high = (MATH_CLAMP(maxDevice, -1.0f, 1.0f) * 0.5f + 0.5f) * tileCount;
+    *first = std::min((unsigned int)low, tileCount - 1);
+    *last = std::min((unsigned int)high, tileCount - 1);
+    return true;
+}
+
+bool ClusteredLighting::getSliceRange(unsigned int light, unsigned int* first, unsigned int* last) const
+{
+    const float* data = &_lightData[light * CLUSTER_LIGHT_TEXELS * 4];
+    const float radius = 1.0f / data[3];
+    const float depth = -data[2];
+
+    const float nearPlane = _sliceDepths[0];
+    const float farPlane = _sliceDepths[_sliceCount];
+    if (depth + radius < nearPlane || depth - radius > farPlane)
+        return false;
+
+    *first = depth - radius <= nearPlane ? 0 : std::min((unsigned int)(logf((depth - radius) / nearPlane) * _depth.y), _sliceCount - 1);
+    *last = depth + radius >= farPlane ? _sliceCount - 1 : std::min((unsigned int)(logf((depth + radius) / nearPlane) * _depth.y), _sliceCount - 1);
+    return true;
+}
+
+bool ClusteredLighting::getTileRange(unsigned int light, unsigned int slice, unsigned int* x0, unsigned int* y0, unsigned int* x1, unsigned int* y1) const
+{
+    // The view space position and range of the light are in the first texel of its data.
+    const float* data = &_lightData[light * CLUSTER_LIGHT_TEXELS * 4];
+    const float radius = 1.0f / data[3];
+    const float depth = -data[2];
+
+    const float minDepth = std::max(depth - radius, _sliceDepths[slice]);
+    const float maxDepth = std::min(depth + radius, _sliceDepths[slice + 1]);
+    if (minDepth > maxDepth)
+        return false;
+
+    const float* m = _projectionMatrix.m;
+    float minX, maxX, minY, maxY;
+    getDeviceRange(data[0] - radius, data[0] + radius, minDepth, maxDepth, m[0], _perspective ? m[8] : m[12], _perspective, &minX, &maxX);
+    getDeviceRange(data[1] - radius, data[1] + radius, minDepth, maxDepth, m[5], _perspective ? m[9] : m[13], _perspective, &minY, &maxY);
+    return getTiles(minX, maxX, _tileCountX, x0, x1) && getTiles(minY, maxY, _tileCountY, y0, y1);
+}
+
+unsigned int ClusteredLighting::update(Scene* scene, Camera* camera)
+{
+    GP_PROFILE_SCOPE("ClusteredLighting::update");
+    GP_ASSERT(scene);
+
+    if (camera == NULL)
+        camera = scene->getActiveCamera();
+
+    _lights.clear();
+    if (camera)
+        scene->visit(this, &ClusteredLighting::gatherLight);
+
+    // Each light is three texels: view space position and inverse range, color and outer
+    // cone angle cosine, and view space direction and inner cone angle cosine. Point lights
+    // use cone angles that never attenuate.
+    const unsigned int lightCount = (unsigned int)_lights.size();
+    const Matrix& viewMatrix = camera ? camera->getViewMatrix() : Matrix::identity();
+    for (unsigned int i = 0; i < lightCount; ++i)
+    {
+        Node* node = _lights[i];
+        Light* light = node->getLight();
+
+        Vector3 position;
+        viewMatrix.transformPoint(node->getTranslationWorld(), &position);
+        Vector3 direction;
+        viewMatrix.transformVector(node->getForwardVectorWorld(), &direction);
+        direction.normalize();
+        const Vector3& color = light->getColor();
+        const bool spot = light->getLightType() == Light::SPOT;
+
+        float* data = &_lightData[i * CLUSTER_LIGHT_TEXELS * 4];
+        data[0] = position.x;
+        data[1] = position.y;
+        data[2] = position.z;
+        data[3] = light->getRangeInverse();
+        data[4] = color.x;
+        data[5] = color.y;
+        data[6] = color.z;
+        data[7] = spot ? light->getOuterAngleCos() : -2.0f;
+        data[8] = direction.x;
+        data[9] = direction.y;
+        data[10] = direction.z;
+        data[11] = spot ? light->getInnerAngleCos() : -1.0f;
+    }
+
+    // Slices are spaced exponentially, so that clusters keep a similar shape at every depth.
+    const float nearPlane = camera ? camera->getNearPlane() : 1.0f;
+    const float farPlane = camera ? camera->getFarPlane() : 2.0f;
+    const float depthScale = _sliceCount / logf(farPlane / nearPlane);
+    for (unsigned int i = 0; i <= _sliceCount; ++i)
+    {
+        _sliceDepths[i] = nearPlane * powf(farPlane / nearPlane, (float)i / _sliceCount);
+    }
+    _projectionMatrix = camera ? camera->getProjectionMatrix() : Matrix::identity();
+    _perspective = camera == NULL || camera->getCameraType() == Camera::PERSPECTIVE;
+
+    const Rectangle& viewport = Game::getInstance()->getViewport();
+    _depth.set(nearPlane, depthScale, 0.0f, 0.0f);
+    _screen.set(_tileCountX / std::max(viewport.width, 1.0f), _tileCountY / std::max(viewport.height, 1.0f), viewport.x, viewport.y);
+
+    // Count the lights of each cluster, then lay the index lists out one after another.
+    std::fill(_clusterCounts.begin(), _clusterCounts.end(), 0);
+    const unsigned int tileCount = _tileCountX * _tileCountY;
+    for (unsigned int i = 0; i < lightCount; ++i)
+    {
+        unsigned int firstSlice, lastSlice;
+        if (!getSliceRange(i, &firstSlice, &lastSlice))
+            continue;
+        for (unsigned int slice = firstSlice; slice <= lastSlice; ++slice)
+        {
+            unsigned int x0, y0, x1, y1;
+            if (!getTileRange(i, slice, &x0, &y0, &x1, &y1))
+                continue;
+            for (unsigned int y = y0; y <= y1; ++y)
+            {
+                for (unsigned int x = x0; x <= x1; ++x)
+                {
+                    unsigned int& count = _clusterCounts[slice * tileCount + y * _tileCountX + x];
+                    count = std::min(count + 1, _maxLightsPerCluster);
+                }
+            }
+        }
+    }
+
+    unsigned int indexCount = 0;
+    for (unsigned int i = 0, clusterCount = (unsigned int)_clusterCounts.size(); i < clusterCount; ++i)
+    {
+        unsigned int count = std::min(_clusterCounts[i], _maxIndices - indexCount);
+        if (count < _clusterCounts[i] && !_overflowed)
+        {
+            GP_WARN("The light indices of the clusters exceed the capacity of %u; some lights are dropped.", _maxIndices);
+            _overflowed = true;
+        }
+        _clusterData[i * 4] = (float)indexCount;
+        _clusterData[i * 4 + 1] = 0.0f;
+        _clusterCounts[i] = count;
+        indexCount += count;
+    }
+
+    // The second component of each cluster counts the indices written so far.
+    for (unsigned int i = 0; i < lightCount; ++i)
+    {
+        unsigned int firstSlice, lastSlice;
+        if (!getSliceRange(i, &firstSlice, &lastSlice))
+            continue;
+        for (unsigned int slice = firstSlice; slice <= lastSlice; ++slice)
+        {
+            unsigned int x0, y0, x1, y1;
+            if (!getTileRange(i, slice, &x0, &y0, &x1, &y1))
+                continue;
+            for (unsigned int y = y0; y <= y1; ++y)
+            {
+                for (unsigned int x = x0; x <= x1; ++x)
+                {
+                    const unsigned int cluster = slice * tileCount + y * _tileCountX + x;
+                    float* clusterData = &_clusterData[cluster * 4];
+                    if ((unsigned int)clusterData[1] < _clusterCounts[cluster])
+                    {
+                        _indexData[((unsigned int)clusterData[0] + (unsigned int)clusterData[1]) * 4] = (float)i;
+                        clusterData[1] += 1.0f;
+                    }
+                }
+            }
+        }
+    }
+
+#ifdef GP_USE_FLOAT_TEXTURES
+    if (lightCount > 0)
+    {
+        GLStateCache::bindTexture(GL_TEXTURE_2D, _lightSampler->getTexture()->getHandle());
+        GL_ASSERT( glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, CLUSTER_LIGHT_TEXELS, lightCount, GL_RGBA, GL_FLOAT, &_lightData[0]) );
+        FrameCapture::record(FrameCapture::UPLOAD_TEXTURE, GL_TEXTURE_2D, _lightSampler->getTexture()->getHandle(), 0, CLUSTER_LIGHT_TEXELS * lightCount * 4 * sizeof(float));
+    }
+    GLStateCache::bindTexture(GL_TEXTURE_2D, _clusterSampler->getTexture()->getHandle());
+    GL_ASSERT( glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, tileCount, _sliceCount, GL_RGBA, GL_FLOAT, &_clusterData[0]) );
+    FrameCapture::record(FrameCapture::UPLOAD_TEXTURE, GL_TEXTURE_2D, _clusterSampler->getTexture()->getHandle(), 0, tileCount * _sliceCount * 4 * sizeof(float));
+    if (indexCount > 0)
+    {
+        const unsigned int rows = (indexCount + CLUSTER_INDEX_TEXTURE_WIDTH - 1) / CLUSTER_INDEX_TEXTURE_WIDTH;
+        GLStateCache::bindTexture(GL_TEXTURE_2D, _indexSampler->getTexture()->getHandle());
+        GL_ASSERT( glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, CLUSTER_INDEX_TEXTURE_WIDTH, rows, GL_RGBA, GL_FLOAT, &_indexData[0]) );
+        FrameCapture::record(FrameCapture::UPLOAD_TEXTURE, GL_TEXTURE_2D, _indexSampler->getTexture()->getHandle(), 0, CLUSTER_INDEX_TEXTURE_WIDTH * rows * 4 * sizeof(float));
+    }
+#endif
+
+    _grid.w = (float)lightCount;
+    return lightCount;
+}
+
+unsigned int ClusteredLighting::getLightCount() const
+{
+    return (unsigned int)_grid.w;
+}
+
+bool ClusteredLighting::resolveAutoBinding(const char* autoBinding, Node* node, MaterialParameter* parameter)
+{
+    GP_ASSERT(autoBinding);
+    GP_ASSERT(parameter);
+
+    if (strcmp(autoBinding, "CLUSTER_LIGHT_TEXTURE") == 0)
+        parameter->setValue(_lightSampler);
+    else if (strcmp(autoBinding, "CLUSTER_TEXTURE") == 0)
+        parameter->setValue(_clusterSampler);
+    else if (strcmp(autoBinding, "CLUSTER_INDEX_TEXTURE") == 0)
+        parameter->setValue(_indexSampler);
+    else if (strcmp(autoBinding, "CLUSTER_GRID") == 0)
+        parameter->bindValue(this, &ClusteredLighting::getGrid);
+    else if (strcmp(autoBinding, "CLUSTER_DEPTH") == 0)
+        parameter->bindValue(this, &ClusteredLighting::getDepth);
+    else if (strcmp(autoBinding, "CLUSTER_SCREEN") == 0)
+        parameter->bindValue(this, &ClusteredLighting::getScreen);
+    else if (strcmp(autoBinding, "CLUSTER_TEXTURE_SCALE") == 0)
+        parameter->bindValue(this, &ClusteredLighting::getTextureScale);
+    else
+        return false;
+    return true;
+}
+
+const Vector4& ClusteredLighting::getGrid() const
+{
+    return _grid;
+}
+
+const Vector4& ClusteredLighting::getDepth() const
+{
+    return _depth;
+}
+
+const Vector4& ClusteredLighting::getScreen() const
+{
+    return _screen;
+}
+
+const Vector4& ClusteredLighting::getTextureScale() const
+{
+    return _textureScale;
+}
+
+}
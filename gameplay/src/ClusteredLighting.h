@@ -0,0 +1,178 @@
+#ifndef CLUSTEREDLIGHTING_H_
+#define CLUSTEREDLIGHTING_H_
+
+#include "RenderState.h"
+#include "Texture.h"
+#include "Vector4.h"
+
+namespace gameplay
+{
+
+class Camera;
+class Node;
+class Scene;
+
+/**
+ * Defines a light culling stage that sorts the point and spot lights of a scene into the
+ * clusters of the view frustum of a camera.
+ *
+ * Materials normally reach lights through per-material parameter bindings, which limits
+ * each shader permutation to the fixed number of lights given by its POINT_LIGHT_COUNT
+ * and SPOT_LIGHT_COUNT defines. Clustered lighting instead splits the view frustum into a
+ * grid of tiles on the screen and exponentially spaced depth slices, and finds the lights
+ * whose range overlaps each of these clusters. Every pixel then only shades with the
+ * lights of its own cluster, so a single shader handles hundreds of lights in a scene.
+ *
+ * The lights, the light list of each cluster and the light indices are uploaded each
+ * frame to floating point textures, which materials bind through the following auto
+ * bindings, handled by the clustered lighting while it exists:
+ * <ul>
+ * <li>u_clusterLightTexture = CLUSTER_LIGHT_TEXTURE
+ * <li>u_clusterTexture = CLUSTER_TEXTURE
+ * <li>u_clusterIndexTexture = CLUSTER_INDEX_TEXTURE
+ * <li>u_clusterGrid = CLUSTER_GRID
+ * <li>u_clusterDepth = CLUSTER_DEPTH
+ * <li>u_clusterScreen = CLUSTER_SCREEN
+ * <li>u_clusterTextureScale = CLUSTER_TEXTURE_SCALE
+ * </ul>
+ * The built-in colored and textured shaders read them when CLUSTERED_LIGHTING is defined
+ * (but not together with BUMPED), in addition to any directional lights of the material.
+ * Each pixel shades with at most CLUSTER_MAX_LIGHTS lights, which must match the maximum
+ * number of lights per cluster given at creation (64 by default).
+ *
+ * Clustered lighting requires floating point textures, which are not available on
+ * OpenGL ES 2.0.
+ *
+ * @script{ignore}
+ */
+class ClusteredLighting : public RenderState::AutoBindingResolver
+{
+public:
+
+    /**
+     * Determines if clustered lighting is supported on this platform.
+     *
+     * @return true if floating point textures are supported.
+     */
+    static bool isSupported();
+
+    /**
+     * Creates a new clustered lighting stage.
+     *
+     * @param tileCountX The number of tiles across the screen.
+     * @param tileCountY The number of tiles down the screen.
+     * @param sliceCount The number of depth slices between the near and far planes of the camera.
+     * @param maxLights The maximum number of point and spot lights in a frame.
+     * @param maxLightsPerCluster The maximum number of lights in each cluster.
+     *
+     * @return A new clustered lighting stage, or NULL if it is not supported.
+     */
+    static ClusteredLighting* create(unsigned int tileCountX = 16, unsigned int tileCountY = 8, unsigned int sliceCount = 24,
+                                     unsigned int maxLights = 256, unsigned int maxLightsPerCluster = 64);
+
+    /**
+     * Destructor.
+     */
+    ~ClusteredLighting();
+
+    /**
+     * Sorts the enabled point and spot lights of a scene into clusters and uploads them.
+     *
+     * This must be called each frame before the scene is drawn from the camera, and
+     * while the viewport of the game is set to the one the scene is drawn to.
+     *
+     * @param scene The scene to find the lights in.
+     * @param camera The camera the scene is drawn from, or NULL for the active camera of the scene.
+     *
+     * @return The number of lights that were uploaded.
+     */
+    unsigned int update(Scene* scene, Camera* camera = NULL);
+
+    /**
+     * Gets the number of lights uploaded by the last update.
+     *
+     * @return The number of lights.
+     */
+    unsigned int getLightCount() const;
+
+    /**
+     * @see RenderState::AutoBindingResolver::resolveAutoBinding
+     */
+    bool resolveAutoBinding(const char* autoBinding, Node* node, MaterialParameter* parameter);
+
+private:
+
+    /**
+     * Constructor.
+     */
+    ClusteredLighting(unsigned int tileCountX, unsigned int tileCountY, unsigned int sliceCount, unsigned int maxLights, unsigned int maxLightsPerCluster);
+
+    /**
+     * Hidden copy constructor.
+     */
+    ClusteredLighting(const ClusteredLighting&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    ClusteredLighting& operator=(const ClusteredLighting&);
+
+    /**
+     * Creates the textures that the lights and clusters are uploaded to.
+     */
+    bool initialize();
+
+    /**
+     * Adds the light of a node, if it has an enabled point or spot light, to the lights of the frame.
+     */
+    bool gatherLight(Node* node);
+
+    /**
+     * Gets the range of depth slices that a light overlaps.
+     *
+     * @return false if the light is entirely in front of the near plane or behind the far plane.
+     */
+    bool getSliceRange(unsigned int light, unsigned int* first, unsigned int* last) const;
+
+    /**
+     * Gets the range of tiles that a light overlaps in a depth slice.
+     *
+     * @return false if the light does not overlap any tile of the slice.
+     */
+    bool getTileRange(unsigned int light, unsigned int slice, unsigned int* x0, unsigned int* y0, unsigned int* x1, unsigned int* y1) const;
+
+    const Vector4& getGrid() const;
+
+    const Vector4& getDepth() const;
+
+    const Vector4& getScreen() const;
+
+    const Vector4& getTextureScale() const;
+
+    unsigned int _tileCountX;
+    unsigned int _tileCountY;
+    unsigned int _sliceCount;
+    unsigned int _maxLights;
+    unsigned int _maxLightsPerCluster;
+    unsigned int _maxIndices;
+    std::vector<Node*> _lights;
+    std::vector<float> _lightData;
+    std::vector<float> _clusterData;
+    std::vector<float> _indexData;
+    std::vector<unsigned int> _clusterCounts;
+    std::vector<float> _sliceDepths;
+    Matrix _projectionMatrix;
+    bool _perspective;
+    bool _overflowed;
+    Vector4 _grid;
+    Vector4 _depth;
+    Vector4 _screen;
+    Vector4 _textureScale;
+    Texture::Sampler* _lightSampler;
+    Texture::Sampler* _clusterSampler;
+    Texture::Sampler* _indexSampler;
+};
+
+}
+
+#endif
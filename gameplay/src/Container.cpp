@@ -277,6 +277,11 @@ void Container::removeControl(unsigned int index)
     std::vector<Control*>::iterator it = _controls.begin() + index;
     Control* control = *it;
     _controls.erase(it);
+    // The form's hit testing grid refers to the control, so it must be rebuilt.
+    Form* form = getTopLevelForm();
+    if (form)
+        form->_hitGridDirty = true;
+
     control->_parent = NULL;
     setDirty(Control::DIRTY_BOUNDS);
 
@@ -629,7 +634,8 @@ bool Container::updateChildBounds()
         Control* ctrl = _controls[i];
         GP_ASSERT(ctrl);
 
-        if (ctrl->isVisible())
+        // Skip children whose subtree has nothing to lay out.
+        if (ctrl->isVisible() && (ctrl->_dirtyBits & (DIRTY_BOUNDS | DIRTY_CHILDREN)) != 0)
         {
             bool changed = ctrl->updateBoundsInternal(_scrollPosition);
 
@@ -664,7 +670,8 @@ unsigned int Container::draw(Form* form, const Rectangle& clip)
     for (size_t i = 0, count = _controls.size(); i < count; ++i)
     {
         Control* control = _controls[i];
-        if (control && control->_absoluteClipBounds.intersects(_absoluteClipBounds))
+        if (control && control->_absoluteClipBounds.intersects(_absoluteClipBounds) &&
+            (form->_redrawRegion.isEmpty() || control->_absoluteClipBounds.intersects(form->_redrawRegion)))
         {
             drawCalls += control->draw(form, _viewportClipBounds);
         }
@@ -1062,6 +1069,35 @@ Layout* Container::createLayout(Layout::Type type)
     }
 }
 
+void Container::measureContent(float* width, float* height)
+{
+    GP_ASSERT(width && height);
+
+    *width = *height = 0.0f;
+    for (size_t i = 0, count = _controls.size(); i < count; ++i)
+    {
+        Control* control = _controls[i];
+
+        if (!control->isVisible())
+            continue;
+
+        const Rectangle& bounds = control->getBounds();
+        const Theme::Margin& margin = control->getMargin();
+
+        float newWidth = bounds.x + bounds.width + margin.right;
+        if (newWidth > *width)
+        {
+            *width = newWidth;
+        }
+
+        float newHeight = bounds.y + bounds.height + margin.bottom;
+        if (newHeight > *height)
+        {
+            *height = newHeight;
+        }
+    }
+}
+
 void Container::updateScroll()
 {
     if (_scroll == SCROLL_NONE)
@@ -1082,30 +1118,7 @@ void Container::updateScroll()
     const Theme::Padding& containerPadding = getPadding();
 
     // Calculate total width and height.
-    _totalWidth = _totalHeight = 0.0f;
-    std::vector<Control*> controls = getControls();
-    for (size_t i = 0, count = controls.size(); i < count; ++i)
-    {
-        Control* control = _controls[i];
-
-        if (!control->isVisible())
-            continue;
-
-        const Rectangle& bounds = control->getBounds();
-        const Theme::Margin& margin = control->getMargin();
-
-        float newWidth = bounds.x + bounds.width + margin.right;
-        if (newWidth > _totalWidth)
-        {
-            _totalWidth = newWidth;
-        }
-
-        float newHeight = bounds.y + bounds.height + margin.bottom;
-        if (newHeight > _totalHeight)
-        {
-            _totalHeight = newHeight;
-        }
-    }
+    measureContent(&_totalWidth, &_totalHeight);
 
     float vWidth = getImageRegion("verticalScrollBar", state).width;
     float hHeight = getImageRegion("horizontalScrollBar", state).height;
@@ -1207,6 +1220,11 @@ void Container::sortControls()
     if (_layout->getType() == Layout::LAYOUT_ABSOLUTE)
     {
         std::sort(_controls.begin(), _controls.end(), &sortControlsByZOrder);
+
+        // Hit testing follows the draw order of controls.
+        Form* form = getTopLevelForm();
+        if (form)
+            form->_hitGridDirty = true;
     }
 }
 
@@ -397,6 +397,16 @@ protected:
      */
     void updateScroll();
 
+    /**
+     * Computes the total size of the content of this container, which limits how far it can scroll.
+     *
+     * By default this is the extent of the visible child controls.
+     *
+     * @param width Populated with the content width.
+     * @param height Populated with the content height.
+     */
+    virtual void measureContent(float* width, float* height);
+
     /**
      * Sorts controls by Z-Order (for absolute layouts only).
      * This method is used by controls to notify their parent container when
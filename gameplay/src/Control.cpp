@@ -1062,6 +1062,11 @@ void Control::notifyListeners(Control::Listener::EventType eventType)
     // need to keep it alive until the method returns.
     this->addRef();
 
+    // Events usually mean the control's appearance changed, so redraw it in cached forms.
+    Form* form = getTopLevelForm();
+    if (form && form->_cached)
+        form->invalidate(_absoluteClipBounds);
+
     controlEvent(eventType);
 
     if (_listeners)
@@ -1090,6 +1095,18 @@ void Control::controlEvent(Control::Listener::EventType evt)
 void Control::setDirty(int bits)
 {
     _dirtyBits |= bits;
+
+    // Flag ancestors so that bounds updates only descend into subtrees containing dirty controls.
+    if (bits & DIRTY_BOUNDS)
+    {
+        for (Control* parent = _parent; parent && (parent->_dirtyBits & DIRTY_CHILDREN) == 0; parent = parent->_parent)
+            parent->_dirtyBits |= DIRTY_CHILDREN;
+    }
+
+    // Layout changes can move anything in the form, state changes only affect this control.
+    Form* form = getTopLevelForm();
+    if (form && form->_cached)
+        form->invalidate((bits & DIRTY_BOUNDS) ? form->_absoluteClipBounds : _absoluteClipBounds);
 }
 
 bool Control::isDirty(int bit) const
@@ -1107,9 +1124,17 @@ void Control::update(float elapsedTime)
 
     // Since opacity is pre-multiplied, we compute it every frame so that we don't need to
     // dirty the entire hierarchy any time a state changes (which could affect opacity).
+    float opacity = _opacity;
     _opacity = getOpacity(state);
     if (_parent)
         _opacity *= _parent->_opacity;
+
+    if (_opacity != opacity)
+    {
+        Form* form = getTopLevelForm();
+        if (form && form->_cached)
+            form->invalidate(_absoluteClipBounds);
+    }
 }
 
 void Control::updateState(State state)
@@ -1132,7 +1157,9 @@ bool Control::updateBoundsInternal(const Vector2& offset)
         _dirtyBits &= ~DIRTY_STATE;
     }
 
-    // If we are a container, always update child bounds first
+    // If we are a container, update dirty child bounds first. The flag is cleared before descending
+    // so that children dirtied during this pass flag us again for the next one.
+    _dirtyBits &= ~DIRTY_CHILDREN;
     bool changed = false;
     if (isContainer())
         changed = static_cast<Container*>(this)->updateChildBounds();
@@ -997,6 +997,11 @@ protected:
      */
     static const int DIRTY_STATE = 2;
 
+    /**
+     * Indicates that the bounds of one or more descendants of the control are dirty.
+     */
+    static const int DIRTY_CHILDREN = 4;
+
     /**
      * Indicates that the x position of the control is a percentage.
      */
@@ -7,6 +7,7 @@
 #include <memory>
 
 using std::memcpy;
+using std::memset;
 using std::fabs;
 using std::sqrt;
 using std::cos;
@@ -80,6 +81,54 @@ static inline float lerpInl(float s, float from, float to)
     return from + (to - from) * s;
 }
 
+// Largest number of components of a quantized curve.
+#define CURVE_MAX_QUANTIZED_COMPONENTS 16
+
+// Largest magnitude of the three smallest components of a unit quaternion.
+#define CURVE_QUATERNION_COMPONENT_MAX 0.70710678f
+
+// Largest number of samples of a baked curve.
+#define CURVE_MAX_BAKED_SAMPLES 1025
+
+static inline unsigned short quantizeScalar(float value, float minValue, float step)
+{
+    float q = step > 0.0f ? (value - minValue) / step + 0.5f : 0.0f;
+    q = q < 0.0f ? 0.0f : (q > 65535.0f ? 65535.0f : q);
+    return (unsigned short)q;
+}
+
+static inline unsigned short quantizeRotationComponent(float value)
+{
+    float s = (value / CURVE_QUATERNION_COMPONENT_MAX) * 0.5f + 0.5f;
+    s = s < 0.0f ? 0.0f : (s > 1.0f ? 1.0f : s);
+    return (unsigned short)(s * 32767.0f + 0.5f);
+}
+
+// Quantizes a quaternion to its three smallest components, with the index of the largest in the top bits of the first two.
+static void quantizeQuaternion(const float* q, unsigned short* dst)
+{
+    float length = sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    if (length <= 0.0f)
+        length = 1.0f;
+
+    unsigned int largest = 0;
+    for (unsigned int i = 1; i < 4; ++i)
+    {
+        if (fabs(q[i]) > fabs(q[largest]))
+            largest = i;
+    }
+    const float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+
+    unsigned int j = 0;
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        if (i != largest)
+            dst[j++] = quantizeRotationComponent(q[i] * sign / length);
+    }
+    dst[0] |= (unsigned short)((largest >> 1) << 15);
+    dst[1] |= (unsigned short)((largest & 1) << 15);
+}
+
 namespace gameplay
 {
 
@@ -89,7 +138,8 @@ Curve* Curve::create(unsigned int pointCount, unsigned int componentCount)
 }
 
 Curve::Curve(unsigned int pointCount, unsigned int componentCount)
-    : _pointCount(pointCount), _componentCount(componentCount), _componentSize(sizeof(float)*componentCount), _quaternionOffset(NULL), _points(NULL)
+    : _pointCount(pointCount), _componentCount(componentCount), _componentSize(sizeof(float)*componentCount), _quaternionOffset(NULL), _points(NULL),
+      _quantizedValues(NULL), _quantizedRanges(NULL), _quantizedStride(0), _bakedValues(NULL), _bakedCount(0)
 {
     _points = new Point[_pointCount];
     for (unsigned int i = 0; i < _pointCount; i++)
@@ -107,6 +157,9 @@ Curve::~Curve()
 {
     SAFE_DELETE_ARRAY(_points);
     SAFE_DELETE_ARRAY(_quaternionOffset);
+    SAFE_DELETE_ARRAY(_quantizedValues);
+    SAFE_DELETE_ARRAY(_quantizedRanges);
+    SAFE_DELETE_ARRAY(_bakedValues);
 }
 
 Curve::Point::Point()
@@ -121,6 +174,11 @@ Curve::Point::~Point()
     SAFE_DELETE_ARRAY(outValue);
 }
 
+Curve::Cursor::Cursor()
+    : _index(0), _min(0), _max(0), _startTime(-1.0f), _endTime(-1.0f)
+{
+}
+
 unsigned int Curve::getPointCount() const
 {
     return _pointCount;
@@ -159,13 +217,24 @@ void Curve::getPointValues(unsigned int index, float* value, float* inValue, flo
     assert(index < _pointCount);
     
     if (value)
-        memcpy(value, _points[index].value, _componentSize);
+        getValue(&_points[index], value);
     
+    // Quantized curves are linear, so their points have no tangents.
     if (inValue)
-        memcpy(inValue, _points[index].inValue, _componentSize);
+    {
+        if (_quantizedValues)
+            memset(inValue, 0, _componentSize);
+        else
+            memcpy(inValue, _points[index].inValue, _componentSize);
+    }
     
     if (outValue)
-        memcpy(outValue, _points[index].outValue, _componentSize);
+    {
+        if (_quantizedValues)
+            memset(outValue, 0, _componentSize);
+        else
+            memcpy(outValue, _points[index].outValue, _componentSize);
+    }
 }
 
 void Curve::setPoint(unsigned int index, float time, float* value, InterpolationType type)
@@ -175,8 +244,10 @@ void Curve::setPoint(unsigned int index, float time, float* value, Interpolation
 
 void Curve::setPoint(unsigned int index, float time, float* value, InterpolationType type, float* inValue, float* outValue)
 {
+    assert(!_quantizedValues);
     assert(index < _pointCount && time >= 0.0f && time <= 1.0f && !(_pointCount > 1 && index == 0 && time != 0.0f) && !(_pointCount != 1 && index == _pointCount - 1 && time != 1.0f));
 
+    SAFE_DELETE_ARRAY(_bakedValues);
     _points[index].time = time;
     _points[index].type = type;
 
@@ -192,8 +263,10 @@ void Curve::setPoint(unsigned int index, float time, float* value, Interpolation
 
 void Curve::setTangent(unsigned int index, InterpolationType type, float* inValue, float* outValue)
 {
+    assert(!_quantizedValues);
     assert(index < _pointCount);
 
+    SAFE_DELETE_ARRAY(_bakedValues);
     _points[index].type = type;
 
     if (inValue)
@@ -212,14 +285,67 @@ void Curve::evaluate(float time, float* dst) const
 
 void Curve::evaluate(float time, float startTime, float endTime, float loopBlendTime, float* dst) const
 {
-    assert(dst && startTime >= 0.0f && startTime <= endTime && endTime <= 1.0f && loopBlendTime >= 0.0f);
+    evaluate(time, startTime, endTime, loopBlendTime, dst, NULL);
+}
 
-    // If there's only one point on the curve, return its value.
-    if (_pointCount == 1)
+void Curve::evaluate(float time, float startTime, float endTime, float loopBlendTime, float* dst, Cursor* cursor) const
+{
+    assert(dst);
+
+    unsigned int index;
+    Point* from;
+    Point* to;
+    float t;
+    Point* point = locate(time, startTime, endTime, loopBlendTime, cursor, &index, &from, &to, &t);
+    if (point)
+        getValue(point, dst);
+    else
+        interpolate(t, index, from, to, dst);
+}
+
+void Curve::evaluate(unsigned int curveCount, const Curve* const* curves, float time, float startTime, float endTime,
+                     float loopBlendTime, float* const* dst, Cursor* cursors)
+{
+    assert(curves && dst && cursors);
+
+    for (unsigned int i = 0; i < curveCount; ++i)
     {
-        memcpy(dst, _points[0].value, _componentSize);
-        return;
+        const Curve* curve = curves[i];
+        assert(curve && dst[i]);
+
+        unsigned int index;
+        Point* from;
+        Point* to;
+        float t;
+        Point* point = curve->locate(time, startTime, endTime, loopBlendTime, &cursors[i], &index, &from, &to, &t);
+        if (point)
+        {
+            curve->getValue(point, dst[i]);
+        }
+        else if (from->type == LINEAR && !curve->_quaternionOffset && !curve->_quantizedValues)
+        {
+            // Scalar linear segments, the most common in animations, interpolate without branches.
+            const float* fromValue = from->value;
+            const float* toValue = to->value;
+            float* value = dst[i];
+            for (unsigned int j = 0, count = curve->_componentCount; j < count; ++j)
+                value[j] = fromValue[j] + (toValue[j] - fromValue[j]) * t;
+        }
+        else
+        {
+            curve->interpolate(t, index, from, to, dst[i]);
+        }
     }
+}
+
+Curve::Point* Curve::locate(float time, float startTime, float endTime, float loopBlendTime, Cursor* cursor,
+                            unsigned int* index, Point** from, Point** to, float* t) const
+{
+    assert(startTime >= 0.0f && startTime <= endTime && endTime <= 1.0f && loopBlendTime >= 0.0f);
+
+    // If there's only one point on the curve, return its value.
+    if (_pointCount == 1)
+        return &_points[0];
 
     unsigned int min = 0;
     unsigned int max = _pointCount - 1;
@@ -227,8 +353,23 @@ void Curve::evaluate(float time, float startTime, float endTime, float loopBlend
     if (startTime > 0.0f || endTime < 1.0f)
     {
         // Evaluating a sub section of the curve
-        min = determineIndex(startTime, 0, max);
-        max = determineIndex(endTime, min, max);
+        if (cursor && cursor->_startTime == startTime && cursor->_endTime == endTime)
+        {
+            min = cursor->_min;
+            max = cursor->_max;
+        }
+        else
+        {
+            min = determineIndex(startTime, 0, max);
+            max = determineIndex(endTime, min, max);
+            if (cursor)
+            {
+                cursor->_min = min;
+                cursor->_max = max;
+                cursor->_startTime = startTime;
+                cursor->_endTime = endTime;
+            }
+        }
 
         // Convert time to fall within the subregion
         localTime = _points[min].time + (_points[max].time - _points[min].time) * time;
@@ -245,52 +386,69 @@ void Curve::evaluate(float time, float startTime, float endTime, float loopBlend
 
     // If an exact endpoint was specified, skip interpolation and return the value directly
     if (localTime == _points[min].time)
-    {
-        memcpy(dst, _points[min].value, _componentSize);
-        return;
-    }
+        return &_points[min];
     if (localTime == _points[max].time)
-    {
-        memcpy(dst, _points[max].value, _componentSize);
-        return;
-    }
-
-    Point* from;
-    Point* to;
-    float scale;
-    float t;
-    unsigned int index;
+        return &_points[max];
 
     if (localTime > _points[max].time)
     {
         // Looping forward
-        index = max;
-        from = &_points[max];
-        to = &_points[min];
+        *index = max;
+        *from = &_points[max];
+        *to = &_points[min];
 
         // Calculate the fractional time between the two points.
-        t = (localTime - from->time) / loopBlendTime;
+        *t = (localTime - (*from)->time) / loopBlendTime;
     }
     else if (localTime < _points[min].time)
     {
         // Looping in reverse
-        index = min;
-        from = &_points[min];
-        to = &_points[max];
+        *index = min;
+        *from = &_points[min];
+        *to = &_points[max];
 
         // Calculate the fractional time between the two points.
-        t = (from->time - localTime) / loopBlendTime;
+        *t = ((*from)->time - localTime) / loopBlendTime;
     }
     else
     {
-        // Locate the points we are interpolating between using a binary search.
-        index = determineIndex(localTime, min, max);
-        from = &_points[index];
-        to = &_points[index == max ? index : index+1];
+        // Locate the points we are interpolating between, next to the last ones or using a binary search.
+        *index = cursor ? determineIndex(localTime, min, max, cursor->_index) : determineIndex(localTime, min, max);
+        if (cursor)
+            cursor->_index = *index;
+        *from = &_points[*index];
+        *to = &_points[*index == max ? *index : *index + 1];
 
         // Calculate the fractional time between the two points.
-        scale = (to->time - from->time);
-        t = (localTime - from->time) / scale;
+        *t = (localTime - (*from)->time) / ((*to)->time - (*from)->time);
+    }
+
+    return NULL;
+}
+
+void Curve::interpolate(float t, unsigned int index, Point* from, Point* to, float* dst) const
+{
+    if (_quantizedValues)
+    {
+        // Quantized curves are linear, so only the values of the two points are decoded.
+        float fromValue[CURVE_MAX_QUANTIZED_COMPONENTS];
+        float toValue[CURVE_MAX_QUANTIZED_COMPONENTS];
+        getValue(from, fromValue);
+        getValue(to, toValue);
+        interpolateLinear(t, fromValue, toValue, dst);
+        return;
+    }
+
+    if (_bakedValues && to == from + 1)
+    {
+        // The table covers the points of the curve, which span times zero to one.
+        const float time = from->time + (to->time - from->time) * t;
+        const float position = time * (float)(_bakedCount - 1);
+        unsigned int sample = position > 0.0f ? (unsigned int)position : 0;
+        if (sample > _bakedCount - 2)
+            sample = _bakedCount - 2;
+        interpolateLinear(position - (float)sample, _bakedValues + sample * _componentCount, _bakedValues + (sample + 1) * _componentCount, dst);
+        return;
     }
 
     // Calculate the value of the curve discretely if appropriate.
@@ -833,8 +991,187 @@ float Curve::lerp(float t, float from, float to)
     return lerpInl(t, from, to);
 }
 
+bool Curve::quantize()
+{
+    if (_quantizedValues)
+        return true;
+    if (_componentCount > CURVE_MAX_QUANTIZED_COMPONENTS)
+        return false;
+    for (unsigned int i = 0; i < _pointCount; i++)
+    {
+        if (_points[i].type != LINEAR)
+            return false;
+    }
+
+    const unsigned int quaternionOffset = _quaternionOffset ? *_quaternionOffset : _componentCount;
+    const unsigned int scalarCount = _quaternionOffset ? _componentCount - 4 : _componentCount;
+    _quantizedStride = _quaternionOffset ? scalarCount + 3 : scalarCount;
+
+    // Each scalar component is quantized within its own range, stored as its minimum and step.
+    _quantizedRanges = new float[scalarCount * 2];
+    for (unsigned int c = 0, range = 0; c < _componentCount; c++)
+    {
+        if (c >= quaternionOffset && c < quaternionOffset + 4)
+            continue;
+        float minValue = _points[0].value[c];
+        float maxValue = minValue;
+        for (unsigned int i = 1; i < _pointCount; i++)
+        {
+            const float value = _points[i].value[c];
+            minValue = value < minValue ? value : minValue;
+            maxValue = value > maxValue ? value : maxValue;
+        }
+        _quantizedRanges[range * 2] = minValue;
+        _quantizedRanges[range * 2 + 1] = (maxValue - minValue) / 65535.0f;
+        ++range;
+    }
+
+    _quantizedValues = new unsigned short[_pointCount * _quantizedStride];
+    for (unsigned int i = 0; i < _pointCount; i++)
+    {
+        const float* value = _points[i].value;
+        unsigned short* dst = _quantizedValues + i * _quantizedStride;
+        for (unsigned int c = 0, range = 0; c < _componentCount; c++)
+        {
+            if (c >= quaternionOffset && c < quaternionOffset + 4)
+                continue;
+            *dst++ = quantizeScalar(value[c], _quantizedRanges[range * 2], _quantizedRanges[range * 2 + 1]);
+            ++range;
+        }
+        if (_quaternionOffset)
+            quantizeQuaternion(value + quaternionOffset, dst);
+
+        SAFE_DELETE_ARRAY(_points[i].value);
+        SAFE_DELETE_ARRAY(_points[i].inValue);
+        SAFE_DELETE_ARRAY(_points[i].outValue);
+    }
+
+    return true;
+}
+
+bool Curve::isQuantized() const
+{
+    return _quantizedValues != NULL;
+}
+
+bool Curve::bake(float maxError)
+{
+    assert(maxError > 0.0f);
+
+    if (_bakedValues)
+        return true;
+    if (_pointCount < 2 || _quantizedValues)
+        return false;
+    bool linear = true;
+    for (unsigned int i = 0; i < _pointCount - 1 && linear; i++)
+    {
+        linear = _points[i].type == LINEAR;
+    }
+    if (linear)
+        return false;
+
+    // Start from a sample for each point, doubling the intervals until their interpolation is within the bound.
+    float* expected = new float[_componentCount];
+    float* actual = new float[_componentCount];
+    float* values = NULL;
+    unsigned int intervals = 1;
+    while (intervals < _pointCount - 1)
+        intervals <<= 1;
+    for (; intervals + 1 <= CURVE_MAX_BAKED_SAMPLES; intervals <<= 1)
+    {
+        const unsigned int count = intervals + 1;
+        values = new float[count * _componentCount];
+        for (unsigned int i = 0; i < count; i++)
+        {
+            evaluate((float)i / (float)intervals, values + i * _componentCount);
+        }
+
+        // Measure the error at the quarters of each interval.
+        bool withinError = true;
+        for (unsigned int i = 0; i < intervals && withinError; i++)
+        {
+            for (unsigned int j = 1; j < 4 && withinError; j++)
+            {
+                const float s = (float)j * 0.25f;
+                evaluate(((float)i + s) / (float)intervals, expected);
+                interpolateLinear(s, values + i * _componentCount, values + (i + 1) * _componentCount, actual);
+                for (unsigned int c = 0; c < _componentCount; c++)
+                {
+                    if (fabs(expected[c] - actual[c]) > maxError)
+                    {
+                        withinError = false;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (withinError)
+        {
+            _bakedValues = values;
+            _bakedCount = count;
+            break;
+        }
+        SAFE_DELETE_ARRAY(values);
+    }
+    SAFE_DELETE_ARRAY(expected);
+    SAFE_DELETE_ARRAY(actual);
+
+    return _bakedValues != NULL;
+}
+
+bool Curve::isBaked() const
+{
+    return _bakedValues != NULL;
+}
+
+void Curve::getValue(const Point* point, float* dst) const
+{
+    if (_quantizedValues)
+    {
+        const unsigned int index = (unsigned int)(point - _points);
+        dequantize(_quantizedRanges, _quantizedValues + index * _quantizedStride, _componentCount, _quaternionOffset ? *_quaternionOffset : _componentCount, dst);
+    }
+    else
+    {
+        memcpy(dst, point->value, _componentSize);
+    }
+}
+
+void Curve::dequantize(const float* ranges, const unsigned short* src, unsigned int componentCount, unsigned int quaternionOffset, float* dst)
+{
+    for (unsigned int c = 0; c < componentCount; c++)
+    {
+        if (c == quaternionOffset)
+        {
+            c += 3;
+            continue;
+        }
+        dst[c] = ranges[0] + ranges[1] * (float)*src++;
+        ranges += 2;
+    }
+
+    if (quaternionOffset < componentCount)
+    {
+        // Rebuild the largest component of the unit quaternion from the three smallest.
+        float* q = dst + quaternionOffset;
+        const unsigned int largest = ((src[0] >> 15) << 1) | (src[1] >> 15);
+        float sum = 0.0f;
+        for (unsigned int i = 0, j = 0; i < 4; i++)
+        {
+            if (i == largest)
+                continue;
+            const float value = ((float)(src[j++] & 0x7fff) / 32767.0f * 2.0f - 1.0f) * CURVE_QUATERNION_COMPONENT_MAX;
+            q[i] = value;
+            sum += value * value;
+        }
+        q[largest] = sum < 1.0f ? sqrt(1.0f - sum) : 0.0f;
+    }
+}
+
 void Curve::setQuaternionOffset(unsigned int offset)
 {
+    assert(!_quantizedValues);
     assert(offset <= (_componentCount - 4));
 
     if (!_quaternionOffset)
@@ -1198,8 +1535,11 @@ void Curve::interpolateHermiteSmooth(float s, unsigned int index, Point* from, P
 
 void Curve::interpolateLinear(float s, Point* from, Point* to, float* dst) const
 {
-    float* fromValue = from->value;
-    float* toValue = to->value;
+    interpolateLinear(s, from->value, to->value, dst);
+}
+
+void Curve::interpolateLinear(float s, float* fromValue, float* toValue, float* dst) const
+{
 
     if (!_quaternionOffset)
     {
@@ -1267,6 +1607,27 @@ int Curve::determineIndex(float time, unsigned int min, unsigned int max) const
     return max;
 }
 
+int Curve::determineIndex(float time, unsigned int min, unsigned int max, unsigned int hint) const
+{
+    // Sampling moves little between evaluations, so try the segment of the hint and its neighbours first.
+    if (hint >= min && hint < max)
+    {
+        if (time >= _points[hint].time)
+        {
+            if (time < _points[hint + 1].time)
+                return hint;
+            if (hint + 1 < max && time < _points[hint + 2].time)
+                return hint + 1;
+        }
+        else if (hint > min && time >= _points[hint - 1].time)
+        {
+            return hint - 1;
+        }
+    }
+
+    return determineIndex(time, min, max);
+}
+
 int Curve::getInterpolationType(const char* curveId)
 {
     if (strcmp(curveId, "BEZIER") == 0)
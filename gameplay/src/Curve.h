@@ -16,6 +16,7 @@ class Curve : public Ref
     friend class AnimationClip;
     friend class AnimationController;
     friend class MeshSkin;
+    friend class Bundle;
 
 public:
 
@@ -275,6 +276,37 @@ public:
         BOUNCE_OUT_IN
     };
 
+    /**
+     * Defines a cursor that remembers where a curve was last evaluated.
+     *
+     * Animations sample their curves at positions that move little from one frame to the
+     * next. Evaluating with a cursor looks for the points to interpolate between next to the
+     * ones of the last evaluation before searching the whole curve, which makes sequential
+     * sampling constant time. A cursor also keeps the bounds of the subregion it was last
+     * evaluated in. A cursor should only be used with a single curve.
+     *
+     * @script{ignore}
+     */
+    class Cursor
+    {
+        friend class Curve;
+
+    public:
+
+        /**
+         * Constructor.
+         */
+        Cursor();
+
+    private:
+
+        unsigned int _index;
+        unsigned int _min;
+        unsigned int _max;
+        float _startTime;
+        float _endTime;
+    };
+
     /**
      * Creates a new curve.
      *
@@ -414,6 +446,96 @@ public:
      */
     void evaluate(float time, float startTime, float endTime, float loopBlendTime, float* dst) const;
 
+    /**
+     * Evaluates the curve at the given position value within the specified subregion of
+     * the curve, starting the search for the points to interpolate between at a cursor.
+     *
+     * @param time The position within the subregion of the curve to evaluate the curve at.
+     * @param startTime Start time for the subregion (between 0.0 - 1.0).
+     * @param endTime End time for the subregion (between 0.0 - 1.0).
+     * @param loopBlendTime Time (in milliseconds) to blend between the end points of the curve
+     *      for looping purposes when time is outside the range 0-1.
+     * @param dst The evaluated value of the curve at the given time.
+     * @param cursor The cursor of the last evaluation of this curve, which is updated.
+     *
+     * @see Curve::evaluate(float, float, float, float, float*) const
+     * @script{ignore}
+     */
+    void evaluate(float time, float startTime, float endTime, float loopBlendTime, float* dst, Cursor* cursor) const;
+
+    /**
+     * Evaluates many curves at the same position value within the same subregion.
+     *
+     * This is the same as evaluating each of the curves with its cursor, but it finds the
+     * points to interpolate between for all of the curves before interpolating any of them,
+     * and interpolates the scalar linear segments in a single loop.
+     *
+     * @param curveCount The number of curves.
+     * @param curves The curves to evaluate.
+     * @param time The position within the subregion of the curves to evaluate them at.
+     * @param startTime Start time for the subregion (between 0.0 - 1.0).
+     * @param endTime End time for the subregion (between 0.0 - 1.0).
+     * @param loopBlendTime Time (in milliseconds) to blend between the end points of the curves
+     *      for looping purposes when time is outside the range 0-1.
+     * @param dst The destination of the evaluated value of each curve.
+     * @param cursors The cursor of each curve, which are updated.
+     *
+     * @script{ignore}
+     */
+    static void evaluate(unsigned int curveCount, const Curve* const* curves, float time, float startTime, float endTime,
+                         float loopBlendTime, float* const* dst, Cursor* cursors);
+
+    /**
+     * Replaces the float values of the points of the curve with quantized values.
+     *
+     * Rotations (the components from the quaternion offset of the curve) are stored as the
+     * smallest three components of their quaternion in 15 bits each, and the other components
+     * as 16-bit fixed point within the range of each component over the curve. The values are
+     * decoded when the curve is evaluated. Curves are only quantized when all of their points
+     * are linear and they have at most 16 components, and their points cannot be set afterwards.
+     *
+     * @return true if the curve is quantized.
+     *
+     * @script{ignore}
+     */
+    bool quantize();
+
+    /**
+     * Determines if the values of the curve are quantized.
+     *
+     * @return true if the curve is quantized.
+     */
+    bool isQuantized() const;
+
+    /**
+     * Resamples the curve into a table of values at a fixed rate, within an error bound.
+     *
+     * Evaluating a baked curve between two of its points looks up the samples around the
+     * time and interpolates them linearly (spherically for rotations), instead of evaluating
+     * the interpolation type of the points. This suits curves of eased or spline points that
+     * are evaluated constantly, such as tweens and looping idle animations. The points are
+     * kept, so evaluating subregions and blending loops is unchanged. The table doubles in
+     * size until the linear interpolation of its samples is within the error bound of the
+     * curve, and the curve is not baked if a table of the largest size is not. Setting a
+     * point or tangent of the curve discards its table.
+     *
+     * Curves of linear points are evaluated as fast as a table already, and are not baked.
+     *
+     * @param maxError The largest difference of any component from the value of the curve.
+     *
+     * @return true if the curve is baked.
+     *
+     * @script{ignore}
+     */
+    bool bake(float maxError);
+
+    /**
+     * Determines if the curve is evaluated from a baked table of values.
+     *
+     * @return true if the curve is baked.
+     */
+    bool isBaked() const;
+
     /**
      * Linear interpolation function.
      */
@@ -513,6 +635,11 @@ private:
      */
     void interpolateLinear(float s, Point* from, Point* to, float* dst) const;
 
+    /**
+     * Linear interpolation function of point values.
+     */
+    void interpolateLinear(float s, float* fromValue, float* toValue, float* dst) const;
+
     /**
      * Quaternion interpolation function.
      */
@@ -523,6 +650,41 @@ private:
      */
     int determineIndex(float time, unsigned int min, unsigned int max) const;
 
+    /**
+     * Determines the current keyframe to interpolate from, looking next to the given keyframe first.
+     */
+    int determineIndex(float time, unsigned int min, unsigned int max, unsigned int hint) const;
+
+    /**
+     * Finds the segment of the curve to interpolate for the given position value within a subregion.
+     *
+     * @return The point whose value is the value of the curve, or NULL if the curve must be
+     *      interpolated from the returned segment.
+     */
+    Point* locate(float time, float startTime, float endTime, float loopBlendTime, Cursor* cursor,
+                  unsigned int* index, Point** from, Point** to, float* t) const;
+
+    /**
+     * Interpolates a segment of the curve found by locate().
+     */
+    void interpolate(float t, unsigned int index, Point* from, Point* to, float* dst) const;
+
+    /**
+     * Copies the value of a point of the curve, decoding it if the curve is quantized.
+     */
+    void getValue(const Point* point, float* dst) const;
+
+    /**
+     * Decodes quantized values of a point.
+     *
+     * @param ranges The minimum and step of each scalar component.
+     * @param src The quantized values of the point.
+     * @param componentCount The number of components of the point.
+     * @param quaternionOffset The offset of the quaternion in the components, or componentCount if there is none.
+     * @param dst The decoded values of the point.
+     */
+    static void dequantize(const float* ranges, const unsigned short* src, unsigned int componentCount, unsigned int quaternionOffset, float* dst);
+
     /**
      * Sets the offset for the beginning of a Quaternion piece of data within the curve's value span at the specified
      * index. The next four components of data starting at the given index will be interpolated as a Quaternion.
@@ -546,6 +708,11 @@ private:
     unsigned int _componentSize;        // The component size (in bytes).
     unsigned int* _quaternionOffset;    // Offset for the rotation component.
     Point* _points;                     // The points on the curve.
+    unsigned short* _quantizedValues;   // The quantized values of the points, or NULL if the values are floats.
+    float* _quantizedRanges;            // The minimum and step of each scalar component of the quantized values.
+    unsigned int _quantizedStride;      // The number of quantized values of each point.
+    float* _bakedValues;                // The samples of the baked curve at a fixed rate over its points, or NULL if it is not baked.
+    unsigned int _bakedCount;           // The number of samples of the baked curve.
 };
 
 }
@@ -6,6 +6,11 @@
 #include <cstdarg>
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include "DebugNew.h"
+
+// The operators are defined below, so the macro redefining new is of no use here.
+#undef new
 
 #ifdef WIN32
 #include <windows.h>
@@ -22,6 +27,7 @@ struct MemoryAllocationRecord
     unsigned int size;              // size of the allocation request
     const char* file;               // source file of allocation request
     int line;                       // source line of the allocation request
+    int tag;                        // memory tag of the allocating thread at the time of the request
     MemoryAllocationRecord* next;
     MemoryAllocationRecord* prev;
 #ifdef WIN32
@@ -30,13 +36,44 @@ struct MemoryAllocationRecord
 #endif
 };
 
-MemoryAllocationRecord* __memoryAllocations = 0;
-int __memoryAllocationCount = 0;
+// Number of separately locked lists the allocation records are spread over, which must be a power of two.
+#define MEMORY_ALLOCATION_SHARDS 64
+
+// A list of allocation records with its own lock, so that threads allocating at the same time
+// rarely wait for each other. A record is kept in the shard its address hashes to, so that it
+// is found again whichever thread frees it.
+struct MemoryAllocationShard
+{
+    std::mutex mutex;
+    MemoryAllocationRecord* allocations;
+};
+
+std::atomic<int> __memoryAllocationCount(0);
+static std::atomic<std::size_t> __memoryTagBytes[MEMORY_TAG_COUNT];
+static std::atomic<unsigned int> __memoryTagCounts[MEMORY_TAG_COUNT];
+static std::atomic<std::size_t> __memoryTagPeakBytes[MEMORY_TAG_COUNT];
+static std::atomic<unsigned int> __memoryTagPeakCounts[MEMORY_TAG_COUNT];
+static thread_local MemoryTag __memoryTag = MEMORY_TAG_GENERAL;
+
+static MemoryAllocationShard* getMemoryAllocationShards()
+{
+    static MemoryAllocationShard shards[MEMORY_ALLOCATION_SHARDS];
+    return shards;
+}
 
-static std::mutex& getMemoryAllocationMutex()
+static MemoryAllocationShard& getMemoryAllocationShard(unsigned long address)
 {
-    static std::mutex m;
-    return m;
+    // Allocations are aligned, so the low bits carry no information.
+    return getMemoryAllocationShards()[((address >> 4) ^ (address >> 12)) & (MEMORY_ALLOCATION_SHARDS - 1)];
+}
+
+template <typename T>
+static void updateMemoryPeak(std::atomic<T>& peak, T value)
+{
+    T current = peak.load(std::memory_order_relaxed);
+    while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
 }
 
 void* debugAlloc(std::size_t size, const char* file, int line);
@@ -113,12 +150,11 @@ void* debugAlloc(std::size_t size, const char* file, int line)
     // Move memory pointer past record
     mem += sizeof(MemoryAllocationRecord);
 
-    std::lock_guard<std::mutex> lock(getMemoryAllocationMutex());
     rec->address = (unsigned long)mem;
     rec->size = (unsigned int)size;
     rec->file = file;
     rec->line = line;
-    rec->next = __memoryAllocations;
+    rec->tag = __memoryTag;
     rec->prev = 0;
 
     // Capture the stack frame (up to MAX_STACK_FRAMES) if we 
@@ -127,6 +163,10 @@ void* debugAlloc(std::size_t size, const char* file, int line)
     rec->trackStackTrace = __trackStackTrace;
     if (rec->trackStackTrace)
     {
+        // The stack walk uses shared state, so stack traces are captured one at a time.
+        static std::mutex stackTraceMutex;
+        std::lock_guard<std::mutex> stackTraceLock(stackTraceMutex);
+
         static bool initialized = false;
         if (!initialized)
         {
@@ -177,11 +217,22 @@ void* debugAlloc(std::size_t size, const char* file, int line)
     }
 #endif
 
-    if (__memoryAllocations)
-        __memoryAllocations->prev = rec;
-    __memoryAllocations = rec;
+    MemoryAllocationShard& shard = getMemoryAllocationShard(rec->address);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        rec->next = shard.allocations;
+        if (shard.allocations)
+            shard.allocations->prev = rec;
+        shard.allocations = rec;
+    }
     ++__memoryAllocationCount;
 
+    // Track the live usage of the tag.
+    std::size_t bytes = __memoryTagBytes[rec->tag].fetch_add(size, std::memory_order_relaxed) + size;
+    unsigned int count = __memoryTagCounts[rec->tag].fetch_add(1, std::memory_order_relaxed) + 1;
+    updateMemoryPeak(__memoryTagPeakBytes[rec->tag], bytes);
+    updateMemoryPeak(__memoryTagPeakCounts[rec->tag], count);
+
     return mem;
 }
 
@@ -203,14 +254,19 @@ void debugFree(void* p)
     }
 
     // Link this item out
-    std::lock_guard<std::mutex> lock(getMemoryAllocationMutex());
-    if (__memoryAllocations == rec)
-        __memoryAllocations = rec->next;
-    if (rec->prev)
-        rec->prev->next = rec->next;
-    if (rec->next)
-        rec->next->prev = rec->prev;
+    MemoryAllocationShard& shard = getMemoryAllocationShard(rec->address);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.allocations == rec)
+            shard.allocations = rec->next;
+        if (rec->prev)
+            rec->prev->next = rec->next;
+        if (rec->next)
+            rec->next->prev = rec->prev;
+    }
     --__memoryAllocationCount;
+    __memoryTagBytes[rec->tag].fetch_sub(rec->size, std::memory_order_relaxed);
+    __memoryTagCounts[rec->tag].fetch_sub(1, std::memory_order_relaxed);
 
     // Free the address from the original alloc location (before mem allocation record)
     free(mem);
@@ -289,26 +345,70 @@ extern void printMemoryLeaks()
     }
     else
     {
-        gameplay::print("[memory] WARNING: %d HEAP allocations still active in memory.\n", __memoryAllocationCount);
-        MemoryAllocationRecord* rec = __memoryAllocations;
-        while (rec)
+        gameplay::print("[memory] WARNING: %d HEAP allocations still active in memory.\n", __memoryAllocationCount.load());
+
+        // Printing allocates, so the shards are walked without their locks, which is safe at shutdown.
+        for (unsigned int i = 0; i < MEMORY_ALLOCATION_SHARDS; ++i)
         {
-#ifdef WIN32
-            if (rec->trackStackTrace)
+            MemoryAllocationRecord* rec = getMemoryAllocationShards()[i].allocations;
+            while (rec)
             {
-                gameplay::print("[memory] LEAK: HEAP allocation leak at address %#x of size %d:\n", rec->address, rec->size);
-                printStackTrace(rec);
-            }
-            else
-                gameplay::print("[memory] LEAK: HEAP allocation leak at address %#x of size %d from line %d in file '%s'.\n", rec->address, rec->size, rec->line, rec->file);
+#ifdef WIN32
+                if (rec->trackStackTrace)
+                {
+                    gameplay::print("[memory] LEAK: HEAP allocation leak at address %#x of size %d:\n", rec->address, rec->size);
+                    printStackTrace(rec);
+                }
+                else
+                    gameplay::print("[memory] LEAK: HEAP allocation leak at address %#x of size %d from line %d in file '%s'.\n", rec->address, rec->size, rec->line, rec->file);
 #else
-            gameplay::print("[memory] LEAK: HEAP allocation leak at address %#x of size %d from line %d in file '%s'.\n", rec->address, rec->size, rec->line, rec->file);
+                gameplay::print("[memory] LEAK: HEAP allocation leak at address %#x of size %d from line %d in file '%s'.\n", rec->address, rec->size, rec->line, rec->file);
 #endif
-            rec = rec->next;
+                rec = rec->next;
+            }
         }
     }
 }
 
+MemoryTagScope::MemoryTagScope(MemoryTag tag)
+    : _previous(__memoryTag)
+{
+    __memoryTag = tag;
+}
+
+MemoryTagScope::~MemoryTagScope()
+{
+    __memoryTag = _previous;
+}
+
+extern const char* getMemoryTagName(MemoryTag tag)
+{
+    static const char* names[MEMORY_TAG_COUNT] = { "general", "render", "physics", "audio", "script", "ui" };
+    return tag >= 0 && tag < MEMORY_TAG_COUNT ? names[tag] : "unknown";
+}
+
+extern void getMemoryTagStats(MemoryTag tag, MemoryTagStats* stats)
+{
+    GP_ASSERT(tag >= 0 && tag < MEMORY_TAG_COUNT);
+    GP_ASSERT(stats);
+    stats->bytes = __memoryTagBytes[tag].load(std::memory_order_relaxed);
+    stats->count = __memoryTagCounts[tag].load(std::memory_order_relaxed);
+    stats->peakBytes = __memoryTagPeakBytes[tag].load(std::memory_order_relaxed);
+    stats->peakCount = __memoryTagPeakCounts[tag].load(std::memory_order_relaxed);
+}
+
+extern void printMemoryReport()
+{
+    gameplay::print("[memory] %-8s %12s %10s %12s %10s\n", "tag", "bytes", "count", "peak bytes", "peak count");
+    for (int i = 0; i < MEMORY_TAG_COUNT; ++i)
+    {
+        MemoryTagStats stats;
+        getMemoryTagStats((MemoryTag)i, &stats);
+        gameplay::print("[memory] %-8s %12u %10u %12u %10u\n", getMemoryTagName((MemoryTag)i),
+            (unsigned int)stats.bytes, stats.count, (unsigned int)stats.peakBytes, stats.peakCount);
+    }
+}
+
 #if defined(WIN32)
 void setTrackStackTrace(bool trackStackTrace)
 {
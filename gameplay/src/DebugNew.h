@@ -14,6 +14,60 @@
 // Prints all heap and reference leaks to stderr.
 extern void printMemoryLeaks();
 
+/**
+ * The subsystems heap allocations are attributed to.
+ *
+ * Allocations are tagged with the tag current on the allocating thread, which is set for
+ * the extent of a scope with GP_MEMORY_TAG. Allocations outside any such scope are general.
+ */
+enum MemoryTag
+{
+    MEMORY_TAG_GENERAL,
+    MEMORY_TAG_RENDER,
+    MEMORY_TAG_PHYSICS,
+    MEMORY_TAG_AUDIO,
+    MEMORY_TAG_SCRIPT,
+    MEMORY_TAG_UI,
+    MEMORY_TAG_COUNT
+};
+
+/**
+ * The live heap usage of a memory tag.
+ */
+struct MemoryTagStats
+{
+    std::size_t bytes;              // bytes currently allocated with the tag
+    unsigned int count;             // number of allocations currently alive with the tag
+    std::size_t peakBytes;          // highest number of bytes allocated with the tag at once
+    unsigned int peakCount;         // highest number of allocations alive with the tag at once
+};
+
+/**
+ * Sets the memory tag of the calling thread for as long as the scope lasts.
+ * Use the GP_MEMORY_TAG macro rather than this directly.
+ */
+class MemoryTagScope
+{
+public:
+    explicit MemoryTagScope(MemoryTag tag);
+    ~MemoryTagScope();
+private:
+    MemoryTag _previous;
+};
+
+// Gets the name of a memory tag.
+extern const char* getMemoryTagName(MemoryTag tag);
+
+// Gets the live heap usage of a memory tag.
+extern void getMemoryTagStats(MemoryTag tag, MemoryTagStats* stats);
+
+// Prints the live heap usage of every memory tag.
+extern void printMemoryReport();
+
+#define GP_MEMORY_TAG_CONCAT_(a, b) a##b
+#define GP_MEMORY_TAG_CONCAT(a, b) GP_MEMORY_TAG_CONCAT_(a, b)
+#define GP_MEMORY_TAG(tag) MemoryTagScope GP_MEMORY_TAG_CONCAT(__memoryTagScope, __LINE__)(tag)
+
 // global new/delete operator overloads
 #ifdef _MSC_VER
 #pragma warning( disable : 4290 ) // C++ exception specification ignored.
@@ -38,6 +92,10 @@ void operator delete[] (void* p, const char* file, int line) throw();
 #define DEBUG_NEW new (__FILE__, __LINE__)
 #define new DEBUG_NEW
 
+#else
+
+#define GP_MEMORY_TAG(tag)
+
 #endif
 
 // Since Bullet overrides new, we define custom functions to allocate Bullet objects that undef
@@ -1,5 +1,6 @@
 #include "Base.h"
 #include "DepthStencilTarget.h"
+#include "GLStateCache.h"
 
 #ifndef GL_DEPTH24_STENCIL8_OES
 #define GL_DEPTH24_STENCIL8_OES 0x88F0
@@ -14,7 +15,7 @@ namespace gameplay
 static std::vector<DepthStencilTarget*> __depthStencilTargets;
 
 DepthStencilTarget::DepthStencilTarget(const char* id, Format format, unsigned int width, unsigned int height)
-    : _id(id ? id : ""), _format(format), _depthBuffer(0), _stencilBuffer(0), _width(width), _height(height), _packed(false)
+    : _id(id ? id : ""), _format(format), _depthBuffer(0), _stencilBuffer(0), _width(width), _height(height), _packed(false), _memorySize(0)
 {
 }
 
@@ -22,9 +23,9 @@ DepthStencilTarget::~DepthStencilTarget()
 {
     // Destroy GL resources.
     if (_depthBuffer)
-        GL_ASSERT( glDeleteRenderbuffers(1, &_depthBuffer) );
+        GLStateCache::deleteRenderbuffer(_depthBuffer);
     if (_stencilBuffer)
-        GL_ASSERT( glDeleteRenderbuffers(1, &_stencilBuffer) );
+        GLStateCache::deleteRenderbuffer(_stencilBuffer);
 
     // Remove from vector.
     std::vector<DepthStencilTarget*>::iterator it = std::find(__depthStencilTargets.begin(), __depthStencilTargets.end(), this);
@@ -34,6 +35,11 @@ DepthStencilTarget::~DepthStencilTarget()
     }
 }
 
+bool DepthStencilTarget::isDestroyedOnMainThread() const
+{
+    return true;
+}
+
 DepthStencilTarget* DepthStencilTarget::create(const char* id, Format format, unsigned int width, unsigned int height)
 {
     // Create the depth stencil target.
@@ -56,22 +62,26 @@ DepthStencilTarget* DepthStencilTarget::create(const char* id, Format format, un
         {
             GL_ASSERT( glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8_OES, width, height) );
             depthStencilTarget->_packed = true;
+            depthStencilTarget->_memorySize = (size_t)width * height * 4;
         }
         else
         {
             if (strstr(extString, "GL_OES_depth24") != 0)
             {
                 GL_ASSERT( glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height) );
+                depthStencilTarget->_memorySize = (size_t)width * height * 4;
             }
             else
             {
                 GL_ASSERT( glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, width, height) );
+                depthStencilTarget->_memorySize = (size_t)width * height * 2;
             }
             if (format == DepthStencilTarget::DEPTH_STENCIL)
             {
                 GL_ASSERT( glGenRenderbuffers(1, &depthStencilTarget->_stencilBuffer) );
                 GL_ASSERT( glBindRenderbuffer(GL_RENDERBUFFER, depthStencilTarget->_stencilBuffer) );
                 GL_ASSERT( glRenderbufferStorage(GL_RENDERBUFFER, GL_STENCIL_INDEX8, width, height) );
+                depthStencilTarget->_memorySize += (size_t)width * height;
             }
         }
     }
@@ -79,6 +89,7 @@ DepthStencilTarget* DepthStencilTarget::create(const char* id, Format format, un
     {
         // Packed format GL_DEPTH24_STENCIL8 is used mark format as packed.
         depthStencilTarget->_packed = true;
+        depthStencilTarget->_memorySize = (size_t)width * height * 4;
     }
 
     // Add it to the cache.
@@ -129,4 +140,12 @@ bool DepthStencilTarget::isPacked() const
 {
     return _packed;
 }
+
+size_t DepthStencilTarget::getTotalMemorySize()
+{
+    size_t size = 0;
+    for (size_t i = 0, count = __depthStencilTargets.size(); i < count; ++i)
+        size += __depthStencilTargets[i]->_memorySize;
+    return size;
+}
 }
@@ -13,6 +13,7 @@ namespace gameplay
 class DepthStencilTarget : public Ref
 {
     friend class FrameBuffer;
+    friend class ResourceManager;
 
 public:
 
@@ -101,11 +102,21 @@ private:
      */
     ~DepthStencilTarget();
 
+    /**
+     * @see Ref::isDestroyedOnMainThread
+     */
+    bool isDestroyedOnMainThread() const;
+
     /**
      * Hidden copy assignment operator.
      */
     DepthStencilTarget& operator=(const DepthStencilTarget&);
 
+    /**
+     * Gets the estimated number of bytes of the render buffers of all depth stencil targets.
+     */
+    static size_t getTotalMemorySize();
+
     std::string _id;
     Format _format;
     RenderBufferHandle _depthBuffer;
@@ -113,6 +124,7 @@ private:
     unsigned int _width;
     unsigned int _height;
     bool _packed;
+    size_t _memorySize;
 };
 
 }
@@ -25,4 +25,22 @@ void Drawable::setNode(Node* node)
     _node = node;
 }
 
+bool Drawable::isUpdatable() const
+{
+    return false;
+}
+
+bool Drawable::isUpdateThreadSafe() const
+{
+    return false;
+}
+
+void Drawable::updateDrawable(float elapsedTime)
+{
+}
+
+void Drawable::finishUpdate()
+{
+}
+
 }
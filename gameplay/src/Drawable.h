@@ -13,6 +13,7 @@ class NodeCloneContext;
 class Drawable
 {
     friend class Node;
+    friend class Scene;
 
 public:
 
@@ -52,6 +53,41 @@ protected:
      */
     virtual Drawable* clone(NodeCloneContext& context) = 0;
 
+    /**
+     * Gets whether the drawable updates itself when its scene is updated in parallel.
+     *
+     * The scene gathers the nodes of updatable drawables whenever its hierarchy changes,
+     * so the result should not change while the drawable is attached to a node.
+     *
+     * @return true if updateDrawable() is to be called each time the scene is updated.
+     * @see Scene::setParallelUpdateEnabled
+     */
+    virtual bool isUpdatable() const;
+
+    /**
+     * Gets whether updateDrawable() may be called on a thread of the JobSystem.
+     *
+     * A thread-safe update may only write to the drawable itself, which rules out shared
+     * state such as that of rand(). Changes that reach its node or other objects must be
+     * left to finishUpdate(), which is called on the thread that updates the scene.
+     *
+     * @return true if the drawable can be updated alongside other drawables.
+     */
+    virtual bool isUpdateThreadSafe() const;
+
+    /**
+     * Updates the drawable when its scene is updated in parallel.
+     *
+     * @param elapsedTime The elapsed time since the last update, in milliseconds.
+     */
+    virtual void updateDrawable(float elapsedTime);
+
+    /**
+     * Completes the update of the drawable on the thread that updates the scene, once the
+     * updates of all the drawables of the scene are done.
+     */
+    virtual void finishUpdate();
+
     /**
      * Sets the node this drawable is attached to.
      *
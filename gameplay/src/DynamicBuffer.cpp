@@ -0,0 +1,192 @@
+#include "Base.h"
+#include "DynamicBuffer.h"
+#include "Game.h"
+#include "GLStateCache.h"
+#include "FrameCapture.h"
+
+// Default size of each region of a ring, in KB.
+#define DYNAMIC_BUFFER_DEFAULT_SIZE 1024
+
+// Alignment of every upload, suitable for any vertex or index type.
+#define DYNAMIC_BUFFER_ALIGNMENT 16
+
+namespace gameplay
+{
+
+static DynamicBuffer* __vertexBuffer = NULL;
+static DynamicBuffer* __indexBuffer = NULL;
+
+DynamicBuffer::DynamicBuffer(GLenum target, size_t regionSize)
+    : _target(target), _handle(0), _regionSize(regionSize), _regionCount(1), _region(0), _used(0), _mapped(NULL)
+{
+    GL_ASSERT( glGenBuffers(1, &_handle) );
+    bind();
+
+#ifdef GP_USE_BUFFER_SYNC
+    for (unsigned int i = 0; i < 3; ++i)
+        _fences[i] = 0;
+
+    // Fences tell when the GPU is done with a region, so three regions can be cycled through.
+    if (glFenceSync && glClientWaitSync && glMapBufferRange)
+    {
+        _regionCount = 3;
+        if (glBufferStorage)
+        {
+            const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            GL_ASSERT( glBufferStorage(_target, _regionSize * _regionCount, NULL, flags) );
+            _mapped = (unsigned char*)glMapBufferRange(_target, 0, _regionSize * _regionCount, flags);
+        }
+        else
+        {
+            GL_ASSERT( glBufferData(_target, _regionSize * _regionCount, NULL, GL_STREAM_DRAW) );
+        }
+        return;
+    }
+#endif
+
+    GL_ASSERT( glBufferData(_target, _regionSize, NULL, GL_STREAM_DRAW) );
+}
+
+DynamicBuffer::~DynamicBuffer()
+{
+#ifdef GP_USE_BUFFER_SYNC
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        if (_fences[i])
+            GL_ASSERT( glDeleteSync(_fences[i]) );
+    }
+    if (_mapped)
+    {
+        bind();
+        GL_ASSERT( glUnmapBuffer(_target) );
+        _mapped = NULL;
+    }
+#endif
+    if (_handle)
+    {
+        GLStateCache::deleteBuffer(_handle);
+        _handle = 0;
+    }
+}
+
+DynamicBuffer* DynamicBuffer::getBuffer(GLenum target)
+{
+    DynamicBuffer*& buffer = target == GL_ELEMENT_ARRAY_BUFFER ? __indexBuffer : __vertexBuffer;
+    if (buffer == NULL)
+    {
+        Properties* graphicsConfig = Game::getInstance()->getConfig()->getNamespace("graphics", true);
+        int kilobytes = graphicsConfig && graphicsConfig->exists("dynamicBufferSize") ? graphicsConfig->getInt("dynamicBufferSize") : DYNAMIC_BUFFER_DEFAULT_SIZE;
+        if (kilobytes <= 0)
+            kilobytes = DYNAMIC_BUFFER_DEFAULT_SIZE;
+        buffer = new DynamicBuffer(target, (size_t)kilobytes * 1024);
+    }
+    return buffer;
+}
+
+bool DynamicBuffer::upload(GLenum target, const void* data, size_t size, GLuint* buffer, size_t* offset)
+{
+    GP_ASSERT( target == GL_ARRAY_BUFFER || target == GL_ELEMENT_ARRAY_BUFFER );
+    GP_ASSERT( data );
+    GP_ASSERT( buffer );
+    GP_ASSERT( offset );
+
+    DynamicBuffer* ring = getBuffer(target);
+    if (!ring->write(data, size, offset))
+        return false;
+
+    *buffer = ring->_handle;
+    return true;
+}
+
+void DynamicBuffer::bind()
+{
+    // The element array binding belongs to the bound vertex array object, which must not be changed.
+#ifdef GP_USE_VAO
+    if (_target == GL_ELEMENT_ARRAY_BUFFER && glBindVertexArray)
+        GLStateCache::bindVertexArray(0);
+#endif
+    GLStateCache::bindBuffer(_target, _handle);
+}
+
+bool DynamicBuffer::write(const void* data, size_t size, size_t* offset)
+{
+    size_t start = (_used + DYNAMIC_BUFFER_ALIGNMENT - 1) & ~(size_t)(DYNAMIC_BUFFER_ALIGNMENT - 1);
+    if (size == 0 || start + size > _regionSize)
+        return false;
+
+    *offset = _region * _regionSize + start;
+    _used = start + size;
+    FrameCapture::record(FrameCapture::UPLOAD_BUFFER, _target, _handle, 0, (unsigned int)size);
+
+    if (_mapped)
+    {
+        memcpy(_mapped + *offset, data, size);
+        return true;
+    }
+
+    bind();
+#ifdef GP_USE_BUFFER_SYNC
+    if (_regionCount > 1)
+    {
+        // The fence of this region has already been waited on, so the write needs no synchronization.
+        void* mapped = glMapBufferRange(_target, *offset, size, GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+        if (mapped)
+        {
+            memcpy(mapped, data, size);
+            GL_ASSERT( glUnmapBuffer(_target) );
+            return true;
+        }
+    }
+#endif
+    GL_ASSERT( glBufferSubData(_target, *offset, size, data) );
+    return true;
+}
+
+void DynamicBuffer::advance()
+{
+    if (_used == 0)
+        return;
+    _used = 0;
+
+#ifdef GP_USE_BUFFER_SYNC
+    if (_regionCount > 1)
+    {
+        GL_ASSERT( _fences[_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) );
+        _region = (_region + 1) % _regionCount;
+
+        // Wait for the GPU to finish with the frame that last used the next region.
+        GLsync fence = _fences[_region];
+        if (fence)
+        {
+            GLenum result;
+            do
+            {
+                result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            } while (result == GL_TIMEOUT_EXPIRED);
+            GL_ASSERT( glDeleteSync(fence) );
+            _fences[_region] = 0;
+        }
+        return;
+    }
+#endif
+
+    // Orphan the buffer so the writes of the next frame do not wait for the draws of this one.
+    bind();
+    GL_ASSERT( glBufferData(_target, _regionSize, NULL, GL_STREAM_DRAW) );
+}
+
+void DynamicBuffer::nextFrame()
+{
+    if (__vertexBuffer)
+        __vertexBuffer->advance();
+    if (__indexBuffer)
+        __indexBuffer->advance();
+}
+
+void DynamicBuffer::finalize()
+{
+    SAFE_DELETE(__vertexBuffer);
+    SAFE_DELETE(__indexBuffer);
+}
+
+}
@@ -0,0 +1,113 @@
+#ifndef DYNAMICBUFFER_H_
+#define DYNAMICBUFFER_H_
+
+namespace gameplay
+{
+
+/**
+ * Defines a ring of GPU buffer memory that geometry rebuilt every frame is streamed into.
+ *
+ * The buffer is split into three regions used by consecutive frames in turn, so the GPU
+ * can still be reading the geometry of the last two frames while the current one is written.
+ * Where fence objects are available, a fence is placed at the end of each frame and waited
+ * on before its region is reused, and the buffer is persistently mapped when buffer storage
+ * is supported (or mapped per upload without synchronization otherwise). Without fences, the
+ * buffer is orphaned at the start of every frame instead.
+ *
+ * MeshBatch streams its vertices and indices through one ring per buffer target. The size
+ * of each region is read from the 'dynamicBufferSize' value (in KB) of the graphics section
+ * of the game config, defaulting to 1024.
+ *
+ * @script{ignore}
+ */
+class DynamicBuffer
+{
+    friend class Game;
+
+public:
+
+    /**
+     * Copies data into the ring of the given buffer target.
+     *
+     * @param target The buffer target (GL_ARRAY_BUFFER or GL_ELEMENT_ARRAY_BUFFER).
+     * @param data The data to copy.
+     * @param size The size of the data in bytes.
+     * @param buffer Set to the buffer the data was copied into.
+     * @param offset Set to the offset of the data in the buffer.
+     *
+     * @return true if the data was copied, false if it does not fit in what is left of the
+     *      region of the current frame (the caller should then draw from client memory).
+     */
+    static bool upload(GLenum target, const void* data, size_t size, GLuint* buffer, size_t* offset);
+
+private:
+
+    /**
+     * Constructor.
+     */
+    DynamicBuffer(GLenum target, size_t regionSize);
+
+    /**
+     * Destructor.
+     */
+    ~DynamicBuffer();
+
+    /**
+     * Hidden copy constructor.
+     */
+    DynamicBuffer(const DynamicBuffer&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    DynamicBuffer& operator=(const DynamicBuffer&);
+
+    /**
+     * Gets the ring of a buffer target, creating it on first use.
+     */
+    static DynamicBuffer* getBuffer(GLenum target);
+
+    /**
+     * Binds the buffer to its target.
+     */
+    void bind();
+
+    /**
+     * Copies data into the region of the current frame.
+     */
+    bool write(const void* data, size_t size, size_t* offset);
+
+    /**
+     * Ends the frame of the current region and moves on to the next region.
+     */
+    void advance();
+
+    /**
+     * Moves every ring on to its region for the next frame.
+     *
+     * Called by Game at the start of every frame.
+     */
+    static void nextFrame();
+
+    /**
+     * Deletes every ring.
+     *
+     * Called by Game at shutdown, while the GL context is still current.
+     */
+    static void finalize();
+
+    GLenum _target;
+    GLuint _handle;
+    size_t _regionSize;
+    unsigned int _regionCount;
+    unsigned int _region;
+    size_t _used;
+    unsigned char* _mapped;
+#ifdef GP_USE_BUFFER_SYNC
+    GLsync _fences[3];
+#endif
+};
+
+}
+
+#endif
@@ -0,0 +1,192 @@
+#include "Base.h"
+#include "DynamicResolution.h"
+#include "FrameBuffer.h"
+#include "Game.h"
+#include "RenderTargetPool.h"
+#include "SpriteBatch.h"
+
+// Number of frames between adjustments of the resolution scale.
+#define DYNAMIC_RESOLUTION_ADJUST_INTERVAL 10
+
+// Step the resolution scale is rounded to, which bounds the number of target sizes in the pool.
+#define DYNAMIC_RESOLUTION_SCALE_STEP 0.05f
+
+// Fraction of the budget the frame time must be under before the scale is raised.
+#define DYNAMIC_RESOLUTION_RAISE_THRESHOLD 0.8f
+
+// Weight of the latest frame in the smoothed frame time.
+#define DYNAMIC_RESOLUTION_SMOOTHING 0.1f
+
+namespace gameplay
+{
+
+DynamicResolution::DynamicResolution()
+    : _budget(0.0f), _minScale(0.5f), _maxScale(1.0f), _scale(1.0f), _frameTime(0.0f), _frame(0), _timerQueries(false),
+      _frameBuffer(NULL), _previousFrameBuffer(NULL), _renderTarget(NULL), _depthStencilTarget(NULL), _batch(NULL)
+{
+    memset(_queries, 0, sizeof(_queries));
+    memset(_queryPending, 0, sizeof(_queryPending));
+}
+
+DynamicResolution::~DynamicResolution()
+{
+#ifdef GP_USE_TIMER_QUERIES
+    if (_timerQueries)
+        GL_ASSERT( glDeleteQueries(3, _queries) );
+#endif
+    SAFE_DELETE(_batch);
+    SAFE_RELEASE(_frameBuffer);
+}
+
+void DynamicResolution::setBudget(float milliseconds)
+{
+    _budget = std::max(milliseconds, 0.0f);
+    _frameTime = 0.0f;
+    if (_budget == 0.0f)
+        _scale = _maxScale;
+
+#ifdef GP_USE_TIMER_QUERIES
+    if (_budget > 0.0f && !_timerQueries && (GLEW_VERSION_3_3 || GLEW_ARB_timer_query))
+    {
+        GL_ASSERT( glGenQueries(3, _queries) );
+        _timerQueries = true;
+    }
+#endif
+}
+
+void DynamicResolution::setMinScale(float scale)
+{
+    _minScale = std::min(std::max(scale, DYNAMIC_RESOLUTION_SCALE_STEP), 1.0f);
+    _maxScale = std::max(_maxScale, _minScale);
+    _scale = std::max(_scale, _minScale);
+}
+
+void DynamicResolution::setMaxScale(float scale)
+{
+    _maxScale = std::min(std::max(scale, _minScale), 1.0f);
+    _scale = _budget == 0.0f ? _maxScale : std::min(_scale, _maxScale);
+}
+
+void DynamicResolution::beginFrame()
+{
+    if (_budget == 0.0f)
+        return;
+
+#ifdef GP_USE_TIMER_QUERIES
+    if (_timerQueries)
+    {
+        // The query of this frame was issued three frames ago, so its result is usually ready.
+        const unsigned int index = _frame % 3;
+        if (_queryPending[index])
+        {
+            GLuint64 elapsed = 0;
+            GL_ASSERT( glGetQueryObjectui64v(_queries[index], GL_QUERY_RESULT, &elapsed) );
+            const float milliseconds = (float)(elapsed / 1000000.0);
+            _frameTime = _frameTime == 0.0f ? milliseconds : _frameTime + (milliseconds - _frameTime) * DYNAMIC_RESOLUTION_SMOOTHING;
+        }
+        GL_ASSERT( glBeginQuery(GL_TIME_ELAPSED, _queries[index]) );
+        _queryPending[index] = true;
+    }
+#endif
+}
+
+void DynamicResolution::endFrame(float elapsedTime)
+{
+    if (_budget == 0.0f)
+        return;
+
+#ifdef GP_USE_TIMER_QUERIES
+    if (_timerQueries)
+        GL_ASSERT( glEndQuery(GL_TIME_ELAPSED) );
+#endif
+    if (!_timerQueries)
+        _frameTime = _frameTime == 0.0f ? elapsedTime : _frameTime + (elapsedTime - _frameTime) * DYNAMIC_RESOLUTION_SMOOTHING;
+
+    if (++_frame % DYNAMIC_RESOLUTION_ADJUST_INTERVAL == 0 && _frameTime > 0.0f)
+        adjustScale();
+}
+
+void DynamicResolution::adjustScale()
+{
+    float scale = _scale;
+    if (_frameTime > _budget)
+    {
+        // The cost of the scene follows its pixel count, which is the square of the scale.
+        scale = std::min(_scale * sqrt(_budget / _frameTime), _scale - DYNAMIC_RESOLUTION_SCALE_STEP);
+        scale = floor(scale / DYNAMIC_RESOLUTION_SCALE_STEP) * DYNAMIC_RESOLUTION_SCALE_STEP;
+    }
+    else if (_frameTime < _budget * DYNAMIC_RESOLUTION_RAISE_THRESHOLD)
+    {
+        scale = _scale + DYNAMIC_RESOLUTION_SCALE_STEP;
+    }
+    _scale = std::min(std::max(scale, _minScale), _maxScale);
+}
+
+void DynamicResolution::beginScene()
+{
+    GP_ASSERT(_renderTarget == NULL);
+
+    if (_scale >= 1.0f)
+        return;
+
+    Game* game = Game::getInstance();
+    _viewport = game->getViewport();
+    const unsigned int width = std::max((unsigned int)(_viewport.width * _scale), 1u);
+    const unsigned int height = std::max((unsigned int)(_viewport.height * _scale), 1u);
+    _renderTarget = RenderTargetPool::acquire(width, height, Texture::RGBA);
+    _depthStencilTarget = RenderTargetPool::acquireDepthStencil(width, height, DepthStencilTarget::DEPTH_STENCIL);
+    if (_renderTarget == NULL || _depthStencilTarget == NULL)
+    {
+        if (_renderTarget)
+            RenderTargetPool::release(_renderTarget);
+        if (_depthStencilTarget)
+            RenderTargetPool::release(_depthStencilTarget);
+        _renderTarget = NULL;
+        _depthStencilTarget = NULL;
+        return;
+    }
+
+    if (_frameBuffer == NULL)
+        _frameBuffer = FrameBuffer::create("org.gameplay3d.dynamicresolution");
+    _frameBuffer->setRenderTarget(_renderTarget);
+    _frameBuffer->setDepthStencilTarget(_depthStencilTarget);
+    _previousFrameBuffer = _frameBuffer->bind();
+    game->setViewport(Rectangle((float)width, (float)height));
+}
+
+void DynamicResolution::endScene()
+{
+    if (_renderTarget == NULL)
+        return;
+
+    GP_PROFILE_GPU_SCOPE("DynamicResolution::upscale");
+
+    Game* game = Game::getInstance();
+    _previousFrameBuffer->bind();
+    game->setViewport(_viewport);
+
+    // The batch is bound to a texture, so it is created again when the pool hands out another target.
+    Texture* texture = _renderTarget->getTexture();
+    if (_batch == NULL || _batch->getSampler()->getTexture() != texture)
+    {
+        SAFE_DELETE(_batch);
+        _batch = SpriteBatch::create(texture);
+        _batch->getSampler()->setFilterMode(Texture::LINEAR, Texture::LINEAR);
+        _batch->getSampler()->setWrapMode(Texture::CLAMP, Texture::CLAMP);
+        _batch->getStateBlock()->setBlend(false);
+    }
+
+    Matrix projection;
+    Matrix::createOrthographicOffCenter(0, _viewport.width, _viewport.height, 0, 0, 1, &projection);
+    _batch->setProjectionMatrix(projection);
+    _batch->start();
+    _batch->draw(0, 0, _viewport.width, _viewport.height, 0.0f, 1.0f, 1.0f, 0.0f, Vector4::one());
+    _batch->finish();
+
+    RenderTargetPool::release(_renderTarget);
+    RenderTargetPool::release(_depthStencilTarget);
+    _renderTarget = NULL;
+    _depthStencilTarget = NULL;
+}
+
+}
@@ -0,0 +1,122 @@
+#ifndef DYNAMICRESOLUTION_H_
+#define DYNAMICRESOLUTION_H_
+
+#include "Rectangle.h"
+
+namespace gameplay
+{
+
+class DepthStencilTarget;
+class FrameBuffer;
+class RenderTarget;
+class SpriteBatch;
+
+/**
+ * Defines the scaling of the resolution of the scene to keep the frame time within a budget.
+ *
+ * While a frame time budget is set, the scene is drawn between Game::beginScene() and
+ * Game::endScene() into a render target of the render target pool that is smaller than the
+ * viewport by the current resolution scale, and endScene() upscales it to the viewport so
+ * that forms and other UI drawn afterwards stay at the native resolution.
+ *
+ * The GPU time of each frame is measured with timer queries where they are supported, and
+ * the time between frames is used otherwise. Every few frames the scale is lowered when
+ * the smoothed frame time is over the budget, and raised again once it is well under it,
+ * in steps of 5% of the native resolution.
+ *
+ * Game owns the dynamic resolution and forwards its settings.
+ *
+ * @script{ignore}
+ */
+class DynamicResolution
+{
+    friend class Game;
+
+private:
+
+    /**
+     * Constructor.
+     */
+    DynamicResolution();
+
+    /**
+     * Destructor.
+     */
+    ~DynamicResolution();
+
+    /**
+     * Hidden copy constructor.
+     */
+    DynamicResolution(const DynamicResolution&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    DynamicResolution& operator=(const DynamicResolution&);
+
+    /**
+     * Sets the frame time budget in milliseconds, or zero to draw the scene at the native resolution.
+     */
+    void setBudget(float milliseconds);
+
+    /**
+     * Sets the lowest resolution scale.
+     */
+    void setMinScale(float scale);
+
+    /**
+     * Sets the highest resolution scale, which the scene is drawn at even without a budget.
+     *
+     * Used by the performance governor.
+     */
+    void setMaxScale(float scale);
+
+    /**
+     * Starts the GPU timing of a frame.
+     *
+     * Called by Game before rendering each frame.
+     */
+    void beginFrame();
+
+    /**
+     * Ends the GPU timing of a frame and adjusts the resolution scale.
+     *
+     * Called by Game after rendering each frame.
+     */
+    void endFrame(float elapsedTime);
+
+    /**
+     * Binds a scaled render target to draw the scene into.
+     */
+    void beginScene();
+
+    /**
+     * Restores the frame buffer bound before beginScene() and upscales the scene into it.
+     */
+    void endScene();
+
+    /**
+     * Moves the scale towards the budget given the smoothed frame time.
+     */
+    void adjustScale();
+
+    float _budget;
+    float _minScale;
+    float _maxScale;
+    float _scale;
+    float _frameTime;
+    unsigned int _frame;
+    bool _timerQueries;
+    GLuint _queries[3];
+    bool _queryPending[3];
+    FrameBuffer* _frameBuffer;
+    FrameBuffer* _previousFrameBuffer;
+    RenderTarget* _renderTarget;
+    DepthStencilTarget* _depthStencilTarget;
+    Rectangle _viewport;
+    SpriteBatch* _batch;
+};
+
+}
+
+#endif
@@ -2,29 +2,131 @@
 #include "Effect.h"
 #include "FileSystem.h"
 #include "Game.h"
+#include "FrameStats.h"
+#include "FrameCapture.h"
+#include "GLStateCache.h"
+#include "ViewUniformBuffer.h"
 
 #define OPENGL_ES_DEFINE  "OPENGL_ES"
+#define UNIFORM_BUFFERS_DEFINE "UNIFORM_BUFFERS"
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
 
 namespace gameplay
 {
 
+struct Effect::PendingProgram
+{
+    PendingProgram() : hasPaths(false), vertexShader(0), fragmentShader(0), program(0), binaryHash(0) { }
+
+    std::string id;
+    std::string vshName;
+    std::string fshName;
+    bool hasPaths;
+    std::string defines;
+    std::string vshSource;
+    std::string fshSource;
+    GLuint vertexShader;
+    GLuint fragmentShader;
+    GLuint program;
+    std::string binaryPath;
+    unsigned long long binaryHash;
+};
+
 // Cache of unique effects.
 static std::map<std::string, Effect*> __effectCache;
 static Effect* __currentEffect = NULL;
 
-Effect::Effect() : _program(0)
+// Every effect and the estimated size of their programs, for resource statistics.
+static unsigned int __effectCount = 0;
+static size_t __effectMemorySize = 0;
+
+std::vector<Effect::PendingProgram*> Effect::_pendingPrograms;
+
+// Effects finished by prewarming, which are kept alive until shutdown.
+static std::vector<Effect*> __prewarmedEffects;
+
+// The ids of every effect created from files, which Effect::saveManifest writes out.
+static std::set<std::string> __usedEffects;
+
+// Shader files by path, read once with their includes expanded.
+static std::map<std::string, std::string> __shaderSourceCache;
+
+// Define headers by the comma separated defines they were built from.
+static std::map<std::string, std::string> __definesCache;
+
+// The names of the uniform handles by handle, and the handles by name.
+static std::deque<std::string> __uniformHandleNames;
+static std::map<std::string, unsigned int> __uniformHandles;
+static std::mutex __uniformHandleMutex;
+
+static const std::string* getShaderSource(const char* path);
+static const std::string& getDefines(const char* defines);
+
+// Returns whether a uniform type is a sampler, which is bound to texture units.
+static bool isSamplerType(GLenum type)
+{
+#ifdef GP_USE_TEXTURE_ARRAYS
+    if (type == GL_SAMPLER_2D_ARRAY)
+        return true;
+#endif
+    return type == GL_SAMPLER_2D || type == GL_SAMPLER_CUBE;
+}
+
+// Returns the type of the sampler uniforms that textures of a type are bound to.
+static GLenum getSamplerType(Texture::Type type)
+{
+#ifdef GP_USE_TEXTURE_ARRAYS
+    if (type == Texture::TEXTURE_2D_ARRAY)
+        return GL_SAMPLER_2D_ARRAY;
+#endif
+    return type == Texture::TEXTURE_CUBE ? GL_SAMPLER_CUBE : GL_SAMPLER_2D;
+}
+
+// Builds the id of an effect created from files, which is also its line in a manifest.
+static std::string getEffectId(const char* vshPath, const char* fshPath, const char* defines)
 {
+    std::string uniqueId = vshPath;
+    uniqueId += ';';
+    uniqueId += fshPath;
+    uniqueId += ';';
+    if (defines)
+    {
+        uniqueId += defines;
+    }
+    return uniqueId;
+}
+
+// Determines if the driver can report whether a program is done compiling without waiting for it.
+static bool isParallelCompileSupported()
+{
+    static int supported = -1;
+    if (supported < 0)
+    {
+        const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+        supported = extensions && (strstr(extensions, "GL_KHR_parallel_shader_compile") || strstr(extensions, "GL_ARB_parallel_shader_compile")) ? 1 : 0;
+    }
+    return supported == 1;
+}
+
+Effect::Effect() : _program(0), _memorySize(0)
+{
+    ++__effectCount;
 }
 
 Effect::~Effect()
 {
     // Remove this effect from the cache.
     __effectCache.erase(_id);
+    --__effectCount;
+    __effectMemorySize -= _memorySize;
 
     // Free uniforms.
-    for (std::map<std::string, Uniform*>::iterator itr = _uniforms.begin(); itr != _uniforms.end(); ++itr)
+    for (size_t i = 0, count = _uniforms.size(); i < count; ++i)
     {
-        SAFE_DELETE(itr->second);
+        SAFE_DELETE(_uniforms[i]);
     }
 
     if (_program)
@@ -32,29 +134,28 @@ Effect::~Effect()
         // If our program object is currently bound, unbind it before we're destroyed.
         if (__currentEffect == this)
         {
-            GL_ASSERT( glUseProgram(0) );
+            GLStateCache::useProgram(0);
             __currentEffect = NULL;
         }
 
-        GL_ASSERT( glDeleteProgram(_program) );
+        GLStateCache::deleteProgram(_program);
         _program = 0;
     }
 }
 
+bool Effect::isDestroyedOnMainThread() const
+{
+    return true;
+}
+
 Effect* Effect::createFromFile(const char* vshPath, const char* fshPath, const char* defines)
 {
     GP_ASSERT(vshPath);
     GP_ASSERT(fshPath);
 
     // Search the effect cache for an identical effect that is already loaded.
-    std::string uniqueId = vshPath;
-    uniqueId += ';';
-    uniqueId += fshPath;
-    uniqueId += ';';
-    if (defines)
-    {
-        uniqueId += defines;
-    }
+    std::string uniqueId = getEffectId(vshPath, fshPath, defines);
+    __usedEffects.insert(uniqueId);
     std::map<std::string, Effect*>::const_iterator itr = __effectCache.find(uniqueId);
     if (itr != __effectCache.end())
     {
@@ -64,38 +165,228 @@ Effect* Effect::createFromFile(const char* vshPath, const char* fshPath, const c
         return itr->second;
     }
 
-    // Read source from file.
-    char* vshSource = FileSystem::readAll(vshPath);
+    // If the effect was prewarmed but is still compiling, wait for it now.
+    for (size_t i = 0, count = _pendingPrograms.size(); i < count; ++i)
+    {
+        if (_pendingPrograms[i]->id == uniqueId)
+        {
+            PendingProgram* pending = _pendingPrograms[i];
+            _pendingPrograms.erase(_pendingPrograms.begin() + i);
+            Effect* effect = finishProgram(pending);
+            if (effect == NULL)
+            {
+                GP_ERROR("Failed to create effect from shaders '%s', '%s'.", vshPath, fshPath);
+                return NULL;
+            }
+            __prewarmedEffects.push_back(effect);
+            effect->addRef();
+            return effect;
+        }
+    }
+
+    // Read source from file, with its includes already expanded.
+    const std::string* vshSource = getShaderSource(vshPath);
     if (vshSource == NULL)
     {
         GP_ERROR("Failed to read vertex shader from file '%s'.", vshPath);
         return NULL;
     }
-    char* fshSource = FileSystem::readAll(fshPath);
+    const std::string* fshSource = getShaderSource(fshPath);
     if (fshSource == NULL)
     {
         GP_ERROR("Failed to read fragment shader from file '%s'.", fshPath);
-        SAFE_DELETE_ARRAY(vshSource);
         return NULL;
     }
 
-    Effect* effect = createFromSource(vshPath, vshSource, fshPath, fshSource, defines);
-    
-    SAFE_DELETE_ARRAY(vshSource);
-    SAFE_DELETE_ARRAY(fshSource);
+    PendingProgram* pending = beginProgram(vshPath, vshSource->c_str(), fshPath, fshSource->c_str(), defines);
+    pending->id = uniqueId;
+    Effect* effect = finishProgram(pending);
 
     if (effect == NULL)
     {
         GP_ERROR("Failed to create effect from shaders '%s', '%s'.", vshPath, fshPath);
     }
-    else
+
+    return effect;
+}
+
+Effect* Effect::createTransformFeedback(const char* vshPath, const char* fshPath, const char* defines, const char* const* varyings, unsigned int varyingCount)
+{
+    GP_ASSERT(vshPath);
+    GP_ASSERT(fshPath);
+    GP_ASSERT(varyings && varyingCount > 0);
+
+#ifdef GP_USE_TRANSFORM_FEEDBACK
+    if (!glTransformFeedbackVaryings)
+        return NULL;
+
+    const std::string* vshSource = getShaderSource(vshPath);
+    if (vshSource == NULL)
     {
-        // Store this effect in the cache.
-        effect->_id = uniqueId;
-        __effectCache[uniqueId] = effect;
+        GP_ERROR("Failed to read vertex shader from file '%s'.", vshPath);
+        return NULL;
+    }
+    const std::string* fshSource = getShaderSource(fshPath);
+    if (fshSource == NULL)
+    {
+        GP_ERROR("Failed to read fragment shader from file '%s'.", fshPath);
+        return NULL;
     }
 
+    Effect* effect = finishProgram(beginProgram(vshPath, vshSource->c_str(), fshPath, fshSource->c_str(), defines, varyings, varyingCount));
+    if (effect == NULL)
+    {
+        GP_ERROR("Failed to create transform feedback effect from shaders '%s', '%s'.", vshPath, fshPath);
+    }
     return effect;
+#else
+    return NULL;
+#endif
+}
+
+void Effect::prewarm(const char* vshPath, const char* fshPath, const char* defines)
+{
+    GP_ASSERT(vshPath);
+    GP_ASSERT(fshPath);
+
+    std::string uniqueId = getEffectId(vshPath, fshPath, defines);
+    if (__effectCache.find(uniqueId) != __effectCache.end())
+        return;
+    for (size_t i = 0, count = _pendingPrograms.size(); i < count; ++i)
+    {
+        if (_pendingPrograms[i]->id == uniqueId)
+            return;
+    }
+
+    const std::string* vshSource = getShaderSource(vshPath);
+    if (vshSource == NULL)
+    {
+        GP_ERROR("Failed to read vertex shader from file '%s'.", vshPath);
+        return;
+    }
+    const std::string* fshSource = getShaderSource(fshPath);
+    if (fshSource == NULL)
+    {
+        GP_ERROR("Failed to read fragment shader from file '%s'.", fshPath);
+        return;
+    }
+
+    PendingProgram* pending = beginProgram(vshPath, vshSource->c_str(), fshPath, fshSource->c_str(), defines);
+    pending->id = uniqueId;
+    _pendingPrograms.push_back(pending);
+}
+
+unsigned int Effect::prewarmManifest(const char* manifestPath)
+{
+    GP_ASSERT(manifestPath);
+
+    char* manifest = FileSystem::readAll(manifestPath);
+    if (manifest == NULL)
+    {
+        GP_WARN("Failed to read effect manifest '%s'.", manifestPath);
+        return 0;
+    }
+
+    // Each line is the id of an effect: "vshPath;fshPath;defines".
+    unsigned int count = 0;
+    for (char* line = strtok(manifest, "\r\n"); line != NULL; line = strtok(NULL, "\r\n"))
+    {
+        char* fshPath = strchr(line, ';');
+        char* defines = fshPath ? strchr(fshPath + 1, ';') : NULL;
+        if (defines == NULL)
+        {
+            GP_WARN("Invalid line in effect manifest '%s': %s", manifestPath, line);
+            continue;
+        }
+        *fshPath++ = '\0';
+        *defines++ = '\0';
+        prewarm(line, fshPath, *defines ? defines : NULL);
+        ++count;
+    }
+    SAFE_DELETE_ARRAY(manifest);
+
+    return count;
+}
+
+bool Effect::saveManifest(const char* manifestPath)
+{
+    GP_ASSERT(manifestPath);
+
+    std::unique_ptr<Stream> stream(FileSystem::open(manifestPath, FileSystem::WRITE));
+    if (stream.get() == NULL || !stream->canWrite())
+    {
+        GP_ERROR("Failed to open effect manifest '%s' for writing.", manifestPath);
+        return false;
+    }
+    for (std::set<std::string>::const_iterator itr = __usedEffects.begin(); itr != __usedEffects.end(); ++itr)
+    {
+        stream->write(itr->c_str(), 1, itr->length());
+        stream->write("\n", 1, 1);
+    }
+    return true;
+}
+
+unsigned int Effect::getPendingCount()
+{
+    return (unsigned int)_pendingPrograms.size();
+}
+
+void Effect::updatePending()
+{
+    if (_pendingPrograms.empty())
+        return;
+
+    GP_PROFILE_SCOPE("Effect::updatePending");
+
+    // Without a way to poll the driver, finish one effect per frame to spread out the stalls.
+    bool parallel = isParallelCompileSupported();
+    for (size_t i = 0; i < _pendingPrograms.size();)
+    {
+        PendingProgram* pending = _pendingPrograms[i];
+        if (parallel)
+        {
+            GLint complete = GL_FALSE;
+            GL_ASSERT( glGetProgramiv(pending->program, GL_COMPLETION_STATUS_KHR, &complete) );
+            if (complete != GL_TRUE)
+            {
+                ++i;
+                continue;
+            }
+        }
+
+        _pendingPrograms.erase(_pendingPrograms.begin() + i);
+        Effect* effect = finishProgram(pending);
+        if (effect)
+            __prewarmedEffects.push_back(effect);
+
+        if (!parallel)
+            break;
+    }
+}
+
+void Effect::finalize()
+{
+    for (size_t i = 0, count = _pendingPrograms.size(); i < count; ++i)
+    {
+        PendingProgram* pending = _pendingPrograms[i];
+        if (pending->vertexShader)
+        {
+            GL_ASSERT( glDeleteShader(pending->vertexShader) );
+            GL_ASSERT( glDeleteShader(pending->fragmentShader) );
+        }
+        GL_ASSERT( glDeleteProgram(pending->program) );
+        SAFE_DELETE(pending);
+    }
+    _pendingPrograms.clear();
+
+    for (size_t i = 0, count = __prewarmedEffects.size(); i < count; ++i)
+    {
+        SAFE_RELEASE(__prewarmedEffects[i]);
+    }
+    __prewarmedEffects.clear();
+
+    __shaderSourceCache.clear();
+    __definesCache.clear();
 }
 
 Effect* Effect::createFromSource(const char* vshSource, const char* fshSource, const char* defines)
@@ -114,6 +405,12 @@ static void replaceDefines(const char* defines, std::string& out)
 #else
     out = "";
 #endif
+    if (ViewUniformBuffer::isSupported())
+    {
+        if (out.length() > 0)
+            out += ';';
+        out += UNIFORM_BUFFERS_DEFINE;
+    }
     if (globalDefines && strlen(globalDefines) > 0)
     {
         if (out.length() > 0)
@@ -138,6 +435,10 @@ static void replaceDefines(const char* defines, std::string& out)
         }
         out += "\n";
     }
+
+    // Uniform blocks are not part of the GLSL version the shaders are written against.
+    if (ViewUniformBuffer::isSupported())
+        out += "#extension GL_ARB_uniform_buffer_object : enable\n";
 }
 
 static void replaceIncludes(const char* filepath, const char* source, std::string& out)
@@ -194,7 +495,7 @@ static void replaceIncludes(const char* filepath, const char* source, std::strin
             size_t len = endQuote - (startQuote);
             std::string includeStr = str.substr(startQuote, len);
             directoryPath.append(includeStr);
-            const char* includedSource = FileSystem::readAll(directoryPath.c_str());
+            const std::string* includedSource = getShaderSource(directoryPath.c_str());
             if (includedSource == NULL)
             {
                 GP_ERROR("Compile failed for shader '%s' invalid filepath.", filepathStr.c_str());
@@ -202,9 +503,8 @@ static void replaceIncludes(const char* filepath, const char* source, std::strin
             }
             else
             {
-                // Valid file so lets attempt to see if we need to append anything to it too (recurse...)
-                replaceIncludes(directoryPath.c_str(), includedSource, out);
-                SAFE_DELETE_ARRAY(includedSource);
+                // Valid file, its own includes were already expanded when it was cached.
+                out.append(*includedSource);
             }
         }
         else
@@ -215,6 +515,41 @@ static void replaceIncludes(const char* filepath, const char* source, std::strin
     }
 }
 
+// Gets the source of a shader file with its includes expanded, reading it on first use.
+static const std::string* getShaderSource(const char* path)
+{
+    GP_ASSERT(path);
+
+    std::map<std::string, std::string>::const_iterator itr = __shaderSourceCache.find(path);
+    if (itr != __shaderSourceCache.end())
+        return &itr->second;
+
+    char* source = FileSystem::readAll(path);
+    if (source == NULL)
+        return NULL;
+
+    std::string expanded;
+    replaceIncludes(path, source, expanded);
+    SAFE_DELETE_ARRAY(source);
+
+    std::string& cached = __shaderSourceCache[path];
+    cached.swap(expanded);
+    return &cached;
+}
+
+// Gets the define header for a list of defines, building it on first use.
+static const std::string& getDefines(const char* defines)
+{
+    std::string key = defines ? defines : "";
+    std::map<std::string, std::string>::iterator itr = __definesCache.find(key);
+    if (itr == __definesCache.end())
+    {
+        itr = __definesCache.insert(std::make_pair(key, std::string())).first;
+        replaceDefines(defines, itr->second);
+    }
+    return itr->second;
+}
+
 static void writeShaderToErrorFile(const char* filePath, const char* source)
 {
     std::string path = filePath;
@@ -226,145 +561,354 @@ static void writeShaderToErrorFile(const char* filePath, const char* source)
     }
 }
 
-Effect* Effect::createFromSource(const char* vshPath, const char* vshSource, const char* fshPath, const char* fshSource, const char* defines)
+#ifdef GP_USE_PROGRAM_BINARY
+// Identifies program binary cache files. The version must change whenever ProgramBinaryHeader does.
+#define PROGRAM_BINARY_MAGIC 0x42504750
+#define PROGRAM_BINARY_VERSION 1
+
+struct ProgramBinaryHeader
 {
-    GP_ASSERT(vshSource);
-    GP_ASSERT(fshSource);
+    unsigned int magic;
+    unsigned int version;
+    unsigned long long hash;
+    GLenum format;
+    GLsizei length;
+};
+
+// Hashes a string with 64-bit FNV-1a.
+static unsigned long long hashString(const char* str, unsigned long long hash)
+{
+    for (; *str; ++str)
+    {
+        hash ^= (unsigned char)*str;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Gets the path of the cache file for a program and the hash it is stored with, or an
+// empty path if program binaries are not supported or the cache is disabled.
+static std::string getProgramBinaryPath(const char* defines, const char* vshSource, const char* fshSource, unsigned long long* hash)
+{
+    if (!glGetProgramBinary || !glProgramBinary)
+        return "";
+
+    GLint formatCount = 0;
+    GL_ASSERT( glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount) );
+    if (formatCount <= 0)
+        return "";
+
+    Properties* graphicsConfig = Game::getInstance()->getConfig()->getNamespace("graphics", true);
+    if (graphicsConfig && !graphicsConfig->getBool("programCache", true))
+        return "";
+    const char* cachePath = graphicsConfig ? graphicsConfig->getString("programCachePath") : NULL;
+
+    // Binaries are only valid for the driver that produced them, so it is part of the key.
+    unsigned long long h = 14695981039346656037ULL;
+    h = hashString((const char*)glGetString(GL_VENDOR), h);
+    h = hashString((const char*)glGetString(GL_RENDERER), h);
+    h = hashString((const char*)glGetString(GL_VERSION), h);
+    h = hashString(defines, h);
+    h = hashString(vshSource, h);
+    h = hashString(fshSource, h);
+    *hash = h;
+
+    char name[32];
+    sprintf(name, "%016llx.program", h);
+    std::string path = cachePath ? cachePath : "cache/programs/";
+    if (!path.empty() && path[path.length() - 1] != '/')
+        path += '/';
+    return path + name;
+}
+
+// Loads a program from its cache file, returning 0 if the file is missing, stale or rejected by the driver.
+static GLuint loadProgramBinary(const char* path, unsigned long long hash)
+{
+    if (!FileSystem::fileExists(path))
+        return 0;
+    std::unique_ptr<Stream> stream(FileSystem::open(path));
+    if (stream.get() == NULL)
+        return 0;
+
+    ProgramBinaryHeader header;
+    if (stream->read(&header, sizeof(header), 1) != 1 || header.magic != PROGRAM_BINARY_MAGIC ||
+        header.version != PROGRAM_BINARY_VERSION || header.hash != hash || header.length <= 0)
+    {
+        return 0;
+    }
+    std::vector<unsigned char> binary(header.length);
+    if (stream->read(&binary[0], 1, header.length) != (size_t)header.length)
+        return 0;
 
-    const unsigned int SHADER_SOURCE_LENGTH = 3;
-    const GLchar* shaderSource[SHADER_SOURCE_LENGTH];
-    char* infoLog = NULL;
-    GLuint vertexShader;
-    GLuint fragmentShader;
     GLuint program;
-    GLint length;
-    GLint success;
+    GL_ASSERT( program = glCreateProgram() );
 
-    // Replace all comma separated definitions with #define prefix and \n suffix
-    std::string definesStr = "";
-    replaceDefines(defines, definesStr);
-    
-    shaderSource[0] = definesStr.c_str();
-    shaderSource[1] = "\n";
-    std::string vshSourceStr = "";
-    if (vshPath)
-    {
-        // Replace the #include "xxxxx.xxx" with the sources that come from file paths
-        replaceIncludes(vshPath, vshSource, vshSourceStr);
-        if (vshSource && strlen(vshSource) != 0)
-            vshSourceStr += "\n";
-    }
-    shaderSource[2] = vshPath ? vshSourceStr.c_str() :  vshSource;
-    GL_ASSERT( vertexShader = glCreateShader(GL_VERTEX_SHADER) );
-    GL_ASSERT( glShaderSource(vertexShader, SHADER_SOURCE_LENGTH, shaderSource, NULL) );
-    GL_ASSERT( glCompileShader(vertexShader) );
-    GL_ASSERT( glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success) );
+    // A driver update can reject the binary, which fails the link status and may raise an error.
+    glProgramBinary(program, header.format, &binary[0], header.length);
+    while (glGetError() != GL_NO_ERROR);
+
+    GLint success;
+    GL_ASSERT( glGetProgramiv(program, GL_LINK_STATUS, &success) );
     if (success != GL_TRUE)
     {
-        GL_ASSERT( glGetShaderiv(vertexShader, GL_INFO_LOG_LENGTH, &length) );
-        if (length == 0)
-        {
-            length = 4096;
-        }
-        if (length > 0)
+        GL_ASSERT( glDeleteProgram(program) );
+        return 0;
+    }
+    return program;
+}
+
+// Writes a linked program to its cache file.
+static void saveProgramBinary(GLuint program, const char* path, unsigned long long hash)
+{
+    GLint length = 0;
+    GL_ASSERT( glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length) );
+    if (length <= 0)
+        return;
+
+    ProgramBinaryHeader header;
+    header.magic = PROGRAM_BINARY_MAGIC;
+    header.version = PROGRAM_BINARY_VERSION;
+    header.hash = hash;
+    std::vector<unsigned char> binary(length);
+    GL_ASSERT( glGetProgramBinary(program, length, &header.length, &header.format, &binary[0]) );
+    if (header.length <= 0)
+        return;
+
+    // The cache directory is created by the first program saved to it.
+    std::unique_ptr<Stream> stream(FileSystem::open(path, FileSystem::WRITE));
+    if (stream.get() == NULL)
+    {
+        std::string directory(path);
+        size_t index = directory.rfind('/');
+        if (index != std::string::npos && FileSystem::createDirectory(directory.substr(0, index).c_str()))
+            stream.reset(FileSystem::open(path, FileSystem::WRITE));
+    }
+    if (stream.get() == NULL || !stream->canWrite())
+    {
+        static bool warned = false;
+        if (!warned)
         {
-            infoLog = new char[length];
-            GL_ASSERT( glGetShaderInfoLog(vertexShader, length, NULL, infoLog) );
-            infoLog[length-1] = '\0';
+            GP_WARN("Failed to write program binary cache file '%s'.", path);
+            warned = true;
         }
+        return;
+    }
+    stream->write(&header, sizeof(header), 1);
+    stream->write(&binary[0], 1, header.length);
+}
+#endif
 
-        // Write out the expanded shader file.
-        if (vshPath)
-            writeShaderToErrorFile(vshPath, shaderSource[2]);
+Effect* Effect::createFromSource(const char* vshPath, const char* vshSource, const char* fshPath, const char* fshSource, const char* defines)
+{
+    GP_PROFILE_SCOPE("Effect::createFromSource");
 
-        GP_ERROR("Compile failed for vertex shader '%s' with error '%s'.", vshPath == NULL ? vshSource : vshPath, infoLog == NULL ? "" : infoLog);
-        SAFE_DELETE_ARRAY(infoLog);
+    return finishProgram(beginProgram(vshPath, vshSource, fshPath, fshSource, defines));
+}
 
-        // Clean up.
-        GL_ASSERT( glDeleteShader(vertexShader) );
+Effect::PendingProgram* Effect::beginProgram(const char* vshPath, const char* vshSource, const char* fshPath, const char* fshSource, const char* defines,
+                                             const char* const* varyings, unsigned int varyingCount)
+{
+    GP_ASSERT(vshSource);
+    GP_ASSERT(fshSource);
 
-        return NULL;
-    }
+    PendingProgram* pending = new PendingProgram();
+    pending->vshName = vshPath ? vshPath : vshSource;
+    pending->fshName = fshPath ? fshPath : fshSource;
+    pending->hasPaths = vshPath && fshPath;
 
-    // Compile the fragment shader.
-    std::string fshSourceStr;
-    if (fshPath)
+    // Replace all comma separated definitions with #define prefix and \n suffix
+    pending->defines = getDefines(defines);
+
+    // Sources read from file paths come from the cache with their #include "xxxxx.xxx" already replaced
+    pending->vshSource = vshSource;
+    if (vshPath && strlen(vshSource) != 0)
+        pending->vshSource += "\n";
+    pending->fshSource = fshSource;
+    if (fshPath && strlen(fshSource) != 0)
+        pending->fshSource += "\n";
+
+#ifdef GP_USE_PROGRAM_BINARY
+    // Reuse the program linked by a previous run for the same source and driver.
+    // Binaries are keyed by source alone, so programs with captured varyings are always linked.
+    if (varyingCount == 0)
+        pending->binaryPath = getProgramBinaryPath(pending->defines.c_str(), pending->vshSource.c_str(), pending->fshSource.c_str(), &pending->binaryHash);
+    if (!pending->binaryPath.empty())
     {
-        // Replace the #include "xxxxx.xxx" with the sources that come from file paths
-        replaceIncludes(fshPath, fshSource, fshSourceStr);
-        if (fshSource && strlen(fshSource) != 0)
-            fshSourceStr += "\n";
+        pending->program = loadProgramBinary(pending->binaryPath.c_str(), pending->binaryHash);
+        if (pending->program)
+            return pending;
     }
-    shaderSource[2] = fshPath ? fshSourceStr.c_str() : fshSource;
-    GL_ASSERT( fragmentShader = glCreateShader(GL_FRAGMENT_SHADER) );
-    GL_ASSERT( glShaderSource(fragmentShader, SHADER_SOURCE_LENGTH, shaderSource, NULL) );
-    GL_ASSERT( glCompileShader(fragmentShader) );
-    GL_ASSERT( glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success) );
-    if (success != GL_TRUE)
+#endif
+
+    // Submit both shaders and the link. Their status is only queried by finishProgram(),
+    // so that drivers that compile in the background are not forced to wait.
+    const unsigned int SHADER_SOURCE_LENGTH = 3;
+    const GLchar* shaderSource[SHADER_SOURCE_LENGTH];
+    shaderSource[0] = pending->defines.c_str();
+    shaderSource[1] = "\n";
+    shaderSource[2] = pending->vshSource.c_str();
+    GL_ASSERT( pending->vertexShader = glCreateShader(GL_VERTEX_SHADER) );
+    GL_ASSERT( glShaderSource(pending->vertexShader, SHADER_SOURCE_LENGTH, shaderSource, NULL) );
+    GL_ASSERT( glCompileShader(pending->vertexShader) );
+
+    shaderSource[2] = pending->fshSource.c_str();
+    GL_ASSERT( pending->fragmentShader = glCreateShader(GL_FRAGMENT_SHADER) );
+    GL_ASSERT( glShaderSource(pending->fragmentShader, SHADER_SOURCE_LENGTH, shaderSource, NULL) );
+    GL_ASSERT( glCompileShader(pending->fragmentShader) );
+
+    GL_ASSERT( pending->program = glCreateProgram() );
+    GL_ASSERT( glAttachShader(pending->program, pending->vertexShader) );
+    GL_ASSERT( glAttachShader(pending->program, pending->fragmentShader) );
+#ifdef GP_USE_TRANSFORM_FEEDBACK
+    if (varyingCount > 0)
+        GL_ASSERT( glTransformFeedbackVaryings(pending->program, varyingCount, (const GLchar**)varyings, GL_INTERLEAVED_ATTRIBS) );
+#endif
+#if defined(GP_USE_PROGRAM_BINARY) && !defined(OPENGL_ES)
+    if (!pending->binaryPath.empty() && glProgramParameteri)
+        GL_ASSERT( glProgramParameteri(pending->program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE) );
+#endif
+    GL_ASSERT( glLinkProgram(pending->program) );
+
+    return pending;
+}
+
+Effect* Effect::finishProgram(PendingProgram* pending)
+{
+    GP_ASSERT(pending);
+
+    char* infoLog = NULL;
+    GLint length;
+    GLint success;
+    GLuint program = pending->program;
+    std::string id = pending->id;
+
+    // Programs loaded from a binary have no shaders to check.
+    if (pending->vertexShader)
     {
-        GL_ASSERT( glGetShaderiv(fragmentShader, GL_INFO_LOG_LENGTH, &length) );
-        if (length == 0)
+        GLuint vertexShader = pending->vertexShader;
+        GLuint fragmentShader = pending->fragmentShader;
+
+        GL_ASSERT( glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success) );
+        if (success != GL_TRUE)
         {
-            length = 4096;
+            GL_ASSERT( glGetShaderiv(vertexShader, GL_INFO_LOG_LENGTH, &length) );
+            if (length == 0)
+            {
+                length = 4096;
+            }
+            if (length > 0)
+            {
+                infoLog = new char[length];
+                GL_ASSERT( glGetShaderInfoLog(vertexShader, length, NULL, infoLog) );
+                infoLog[length-1] = '\0';
+            }
+
+            // Write out the expanded shader file.
+            if (pending->hasPaths)
+                writeShaderToErrorFile(pending->vshName.c_str(), pending->vshSource.c_str());
+
+            GP_ERROR("Compile failed for vertex shader '%s' with error '%s'.", pending->vshName.c_str(), infoLog == NULL ? "" : infoLog);
+            SAFE_DELETE_ARRAY(infoLog);
+
+            // Clean up.
+            GL_ASSERT( glDeleteShader(vertexShader) );
+            GL_ASSERT( glDeleteShader(fragmentShader) );
+            GL_ASSERT( glDeleteProgram(program) );
+            SAFE_DELETE(pending);
+
+            return NULL;
         }
-        if (length > 0)
+
+        GL_ASSERT( glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success) );
+        if (success != GL_TRUE)
         {
-            infoLog = new char[length];
-            GL_ASSERT( glGetShaderInfoLog(fragmentShader, length, NULL, infoLog) );
-            infoLog[length-1] = '\0';
+            GL_ASSERT( glGetShaderiv(fragmentShader, GL_INFO_LOG_LENGTH, &length) );
+            if (length == 0)
+            {
+                length = 4096;
+            }
+            if (length > 0)
+            {
+                infoLog = new char[length];
+                GL_ASSERT( glGetShaderInfoLog(fragmentShader, length, NULL, infoLog) );
+                infoLog[length-1] = '\0';
+            }
+
+            // Write out the expanded shader file.
+            if (pending->hasPaths)
+                writeShaderToErrorFile(pending->fshName.c_str(), pending->fshSource.c_str());
+
+            GP_ERROR("Compile failed for fragment shader (%s): %s", pending->fshName.c_str(), infoLog == NULL ? "" : infoLog);
+            SAFE_DELETE_ARRAY(infoLog);
+
+            // Clean up.
+            GL_ASSERT( glDeleteShader(vertexShader) );
+            GL_ASSERT( glDeleteShader(fragmentShader) );
+            GL_ASSERT( glDeleteProgram(program) );
+            SAFE_DELETE(pending);
+
+            return NULL;
         }
-        
-        // Write out the expanded shader file.
-        if (fshPath)
-            writeShaderToErrorFile(fshPath, shaderSource[2]);
 
-        GP_ERROR("Compile failed for fragment shader (%s): %s", fshPath == NULL ? fshSource : fshPath, infoLog == NULL ? "" : infoLog);
-        SAFE_DELETE_ARRAY(infoLog);
+        GL_ASSERT( glGetProgramiv(program, GL_LINK_STATUS, &success) );
 
-        // Clean up.
+        // Delete shaders after linking.
         GL_ASSERT( glDeleteShader(vertexShader) );
         GL_ASSERT( glDeleteShader(fragmentShader) );
 
-        return NULL;
-    }
-
-    // Link program.
-    GL_ASSERT( program = glCreateProgram() );
-    GL_ASSERT( glAttachShader(program, vertexShader) );
-    GL_ASSERT( glAttachShader(program, fragmentShader) );
-    GL_ASSERT( glLinkProgram(program) );
-    GL_ASSERT( glGetProgramiv(program, GL_LINK_STATUS, &success) );
+        // Check link status.
+        if (success != GL_TRUE)
+        {
+            GL_ASSERT( glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length) );
+            if (length == 0)
+            {
+                length = 4096;
+            }
+            if (length > 0)
+            {
+                infoLog = new char[length];
+                GL_ASSERT( glGetProgramInfoLog(program, length, NULL, infoLog) );
+                infoLog[length-1] = '\0';
+            }
+            GP_ERROR("Linking program failed (%s,%s): %s", pending->hasPaths ? pending->vshName.c_str() : "NULL", pending->hasPaths ? pending->fshName.c_str() : "NULL", infoLog == NULL ? "" : infoLog);
+            SAFE_DELETE_ARRAY(infoLog);
 
-    // Delete shaders after linking.
-    GL_ASSERT( glDeleteShader(vertexShader) );
-    GL_ASSERT( glDeleteShader(fragmentShader) );
+            // Clean up.
+            GL_ASSERT( glDeleteProgram(program) );
+            SAFE_DELETE(pending);
 
-    // Check link status.
-    if (success != GL_TRUE)
-    {
-        GL_ASSERT( glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length) );
-        if (length == 0)
-        {
-            length = 4096;
+            return NULL;
         }
-        if (length > 0)
-        {
-            infoLog = new char[length];
-            GL_ASSERT( glGetProgramInfoLog(program, length, NULL, infoLog) );
-            infoLog[length-1] = '\0';
-        }
-        GP_ERROR("Linking program failed (%s,%s): %s", vshPath == NULL ? "NULL" : vshPath, fshPath == NULL ? "NULL" : fshPath, infoLog == NULL ? "" : infoLog);
-        SAFE_DELETE_ARRAY(infoLog);
-
-        // Clean up.
-        GL_ASSERT( glDeleteProgram(program) );
 
-        return NULL;
+#ifdef GP_USE_PROGRAM_BINARY
+        if (!pending->binaryPath.empty())
+            saveProgramBinary(program, pending->binaryPath.c_str(), pending->binaryHash);
+#endif
     }
+    SAFE_DELETE(pending);
+
+    // Bind the shared per-view uniform block, if the program uses it.
+    ViewUniformBuffer::attach(program);
 
     // Create and return the new Effect.
     Effect* effect = new Effect();
     effect->_program = program;
+#ifdef GP_USE_PROGRAM_BINARY
+    // The size of the program binary is the closest estimate of the memory the driver holds for the program.
+    if (glGetProgramBinary)
+    {
+        GLint binaryLength = 0;
+        GL_ASSERT( glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength) );
+        effect->_memorySize = binaryLength > 0 ? (size_t)binaryLength : 0;
+        __effectMemorySize += effect->_memorySize;
+    }
+#endif
+    if (!id.empty())
+    {
+        // Store this effect in the cache.
+        effect->_id = id;
+        __effectCache[id] = effect;
+    }
 
     // Query and store vertex attribute meta-data from the program.
     // NOTE: Rather than using glBindAttribLocation to explicitly specify our own
@@ -394,7 +938,7 @@ Effect* Effect::createFromSource(const char* vshPath, const char* vshSource, con
                 GL_ASSERT( attribLocation = glGetAttribLocation(program, attribName) );
 
                 // Assign the vertex attribute mapping for the effect.
-                effect->_vertexAttributes[attribName] = attribLocation;
+                effect->_vertexAttributes.push_back(std::make_pair(std::string(attribName), attribLocation));
             }
             SAFE_DELETE_ARRAY(attribName);
         }
@@ -439,7 +983,7 @@ Effect* Effect::createFromSource(const char* vshPath, const char* vshSource, con
                 uniform->_name = uniformName;
                 uniform->_location = uniformLocation;
                 uniform->_type = uniformType;
-                if (uniformType == GL_SAMPLER_2D || uniformType == GL_SAMPLER_CUBE)
+                if (isSamplerType(uniformType))
                 {
                     uniform->_index = samplerIndex;
                     samplerIndex += uniformSize;
@@ -449,12 +993,31 @@ Effect* Effect::createFromSource(const char* vshPath, const char* vshSource, con
                     uniform->_index = 0;
                 }
 
-                effect->_uniforms[uniformName] = uniform;
+                uniform->_handle = getUniformHandle(uniformName);
+                effect->_uniforms.push_back(uniform);
             }
             SAFE_DELETE_ARRAY(uniformName);
         }
     }
 
+    // Every active uniform is known now, so the handle table is filled in at once: handles of
+    // uniforms find them, and handles of other names without an array index find nothing.
+    {
+        std::lock_guard<std::mutex> lock(__uniformHandleMutex);
+        const unsigned int handleCount = (unsigned int)__uniformHandleNames.size();
+        effect->_handleUniforms.assign(handleCount, NULL);
+        effect->_handleUniformsFound.assign(handleCount, false);
+        for (unsigned int i = 0; i < handleCount; ++i)
+        {
+            if (__uniformHandleNames[i].find('[') == std::string::npos)
+                effect->_handleUniformsFound[i] = true;
+        }
+    }
+    for (size_t i = 0, count = effect->_uniforms.size(); i < count; ++i)
+    {
+        effect->_handleUniforms[effect->_uniforms[i]->_handle] = effect->_uniforms[i];
+    }
+
     return effect;
 }
 
@@ -465,18 +1028,27 @@ const char* Effect::getId() const
 
 VertexAttribute Effect::getVertexAttribute(const char* name) const
 {
-    std::map<std::string, VertexAttribute>::const_iterator itr = _vertexAttributes.find(name);
-    return (itr == _vertexAttributes.end() ? -1 : itr->second);
+    // Programs have a handful of attributes, which are compared without building a string.
+    GP_ASSERT(name);
+    for (size_t i = 0, count = _vertexAttributes.size(); i < count; ++i)
+    {
+        if (strcmp(_vertexAttributes[i].first.c_str(), name) == 0)
+            return _vertexAttributes[i].second;
+    }
+    return -1;
 }
 
 Uniform* Effect::getUniform(const char* name) const
 {
-    std::map<std::string, Uniform*>::const_iterator itr = _uniforms.find(name);
+    return getUniformByHandle(getUniformHandle(name));
+}
 
-	if (itr != _uniforms.end()) {
-		// Return cached uniform variable
-		return itr->second;
-	}
+Uniform* Effect::findUniform(const char* name) const
+{
+    // Every active uniform was added when the program was linked, so only the elements
+    // of array uniforms are left to look up.
+    if (strchr(name, '[') == NULL)
+        return NULL;
 
     GLint uniformLocation;
     GL_ASSERT( uniformLocation = glGetUniformLocation(_program, name) );
@@ -486,17 +1058,17 @@ Uniform* Effect::getUniform(const char* name) const
 		char* parentname = new char[strlen(name)+1];
 		strcpy(parentname, name);
 		if (strtok(parentname, "[") != NULL) {
-			std::map<std::string, Uniform*>::const_iterator itr = _uniforms.find(parentname);
-			if (itr != _uniforms.end()) {
-				Uniform* puniform = itr->second;
-
+			Uniform* puniform = getUniformByHandle(getUniformHandle(parentname));
+			if (puniform && puniform->_parent == NULL) {
 				Uniform* uniform = new Uniform();
 				uniform->_effect = const_cast<Effect*>(this);
 				uniform->_name = name;
+				uniform->_handle = getUniformHandle(name);
 				uniform->_location = uniformLocation;
 				uniform->_index = 0;
 				uniform->_type = puniform->getType();
-				_uniforms[name] = uniform;
+				uniform->_parent = puniform;
+				_uniforms.push_back(uniform);
 
 				SAFE_DELETE_ARRAY(parentname);
 				return uniform;
@@ -509,17 +1081,48 @@ Uniform* Effect::getUniform(const char* name) const
 	return NULL;
 }
 
-Uniform* Effect::getUniform(unsigned int index) const
+Uniform* Effect::getUniformByHandle(unsigned int handle) const
 {
-    unsigned int i = 0;
-    for (std::map<std::string, Uniform*>::const_iterator itr = _uniforms.begin(); itr != _uniforms.end(); ++itr, ++i)
+    if (handle < _handleUniforms.size() && _handleUniformsFound[handle])
+        return _handleUniforms[handle];
+
+    Uniform* uniform = findUniform(getUniformHandleName(handle));
+    if (handle >= _handleUniforms.size())
     {
-        if (i == index)
-        {
-            return itr->second;
-        }
+        _handleUniforms.resize(handle + 1, NULL);
+        _handleUniformsFound.resize(handle + 1, false);
     }
-    return NULL;
+    _handleUniforms[handle] = uniform;
+    _handleUniformsFound[handle] = true;
+    return uniform;
+}
+
+unsigned int Effect::getUniformHandle(const char* name)
+{
+    GP_ASSERT(name);
+
+    std::lock_guard<std::mutex> lock(__uniformHandleMutex);
+    std::map<std::string, unsigned int>::const_iterator itr = __uniformHandles.find(name);
+    if (itr != __uniformHandles.end())
+        return itr->second;
+
+    const unsigned int handle = (unsigned int)__uniformHandleNames.size();
+    __uniformHandleNames.push_back(name);
+    __uniformHandles[name] = handle;
+    return handle;
+}
+
+const char* Effect::getUniformHandleName(unsigned int handle)
+{
+    // Names are never removed, and a deque does not move its elements as it grows.
+    std::lock_guard<std::mutex> lock(__uniformHandleMutex);
+    GP_ASSERT(handle < __uniformHandleNames.size());
+    return __uniformHandleNames[handle].c_str();
+}
+
+Uniform* Effect::getUniform(unsigned int index) const
+{
+    return index < _uniforms.size() ? _uniforms[index] : NULL;
 }
 
 unsigned int Effect::getUniformCount() const
@@ -530,110 +1133,122 @@ unsigned int Effect::getUniformCount() const
 void Effect::setValue(Uniform* uniform, float value)
 {
     GP_ASSERT(uniform);
-    GL_ASSERT( glUniform1f(uniform->_location, value) );
+    if (uniform->updateValue(&value, sizeof(float)))
+        GL_ASSERT( glUniform1f(uniform->_location, value) );
 }
 
 void Effect::setValue(Uniform* uniform, const float* values, unsigned int count)
 {
     GP_ASSERT(uniform);
     GP_ASSERT(values);
-    GL_ASSERT( glUniform1fv(uniform->_location, count, values) );
+    if (uniform->updateValue(values, sizeof(float) * count))
+        GL_ASSERT( glUniform1fv(uniform->_location, count, values) );
 }
 
 void Effect::setValue(Uniform* uniform, int value)
 {
     GP_ASSERT(uniform);
-    GL_ASSERT( glUniform1i(uniform->_location, value) );
+    if (uniform->updateValue(&value, sizeof(int)))
+        GL_ASSERT( glUniform1i(uniform->_location, value) );
 }
 
 void Effect::setValue(Uniform* uniform, const int* values, unsigned int count)
 {
     GP_ASSERT(uniform);
     GP_ASSERT(values);
-    GL_ASSERT( glUniform1iv(uniform->_location, count, values) );
+    if (uniform->updateValue(values, sizeof(int) * count))
+        GL_ASSERT( glUniform1iv(uniform->_location, count, values) );
 }
 
 void Effect::setValue(Uniform* uniform, const Matrix& value)
 {
     GP_ASSERT(uniform);
-    GL_ASSERT( glUniformMatrix4fv(uniform->_location, 1, GL_FALSE, value.m) );
+    if (uniform->updateValue(value.m, sizeof(Matrix)))
+        GL_ASSERT( glUniformMatrix4fv(uniform->_location, 1, GL_FALSE, value.m) );
 }
 
 void Effect::setValue(Uniform* uniform, const Matrix* values, unsigned int count)
 {
     GP_ASSERT(uniform);
     GP_ASSERT(values);
-    GL_ASSERT( glUniformMatrix4fv(uniform->_location, count, GL_FALSE, (GLfloat*)values) );
+    if (uniform->updateValue(values, sizeof(Matrix) * count))
+        GL_ASSERT( glUniformMatrix4fv(uniform->_location, count, GL_FALSE, (GLfloat*)values) );
 }
 
 void Effect::setValue(Uniform* uniform, const Vector2& value)
 {
     GP_ASSERT(uniform);
-    GL_ASSERT( glUniform2f(uniform->_location, value.x, value.y) );
+    if (uniform->updateValue(&value, sizeof(Vector2)))
+        GL_ASSERT( glUniform2f(uniform->_location, value.x, value.y) );
 }
 
 void Effect::setValue(Uniform* uniform, const Vector2* values, unsigned int count)
 {
     GP_ASSERT(uniform);
     GP_ASSERT(values);
-    GL_ASSERT( glUniform2fv(uniform->_location, count, (GLfloat*)values) );
+    if (uniform->updateValue(values, sizeof(Vector2) * count))
+        GL_ASSERT( glUniform2fv(uniform->_location, count, (GLfloat*)values) );
 }
 
 void Effect::setValue(Uniform* uniform, const Vector3& value)
 {
     GP_ASSERT(uniform);
-    GL_ASSERT( glUniform3f(uniform->_location, value.x, value.y, value.z) );
+    if (uniform->updateValue(&value, sizeof(Vector3)))
+        GL_ASSERT( glUniform3f(uniform->_location, value.x, value.y, value.z) );
 }
 
 void Effect::setValue(Uniform* uniform, const Vector3* values, unsigned int count)
 {
     GP_ASSERT(uniform);
     GP_ASSERT(values);
-    GL_ASSERT( glUniform3fv(uniform->_location, count, (GLfloat*)values) );
+    if (uniform->updateValue(values, sizeof(Vector3) * count))
+        GL_ASSERT( glUniform3fv(uniform->_location, count, (GLfloat*)values) );
 }
 
 void Effect::setValue(Uniform* uniform, const Vector4& value)
 {
     GP_ASSERT(uniform);
-    GL_ASSERT( glUniform4f(uniform->_location, value.x, value.y, value.z, value.w) );
+    if (uniform->updateValue(&value, sizeof(Vector4)))
+        GL_ASSERT( glUniform4f(uniform->_location, value.x, value.y, value.z, value.w) );
 }
 
 void Effect::setValue(Uniform* uniform, const Vector4* values, unsigned int count)
 {
     GP_ASSERT(uniform);
     GP_ASSERT(values);
-    GL_ASSERT( glUniform4fv(uniform->_location, count, (GLfloat*)values) );
+    if (uniform->updateValue(values, sizeof(Vector4) * count))
+        GL_ASSERT( glUniform4fv(uniform->_location, count, (GLfloat*)values) );
 }
 
 void Effect::setValue(Uniform* uniform, const Texture::Sampler* sampler)
 {
     GP_ASSERT(uniform);
-    GP_ASSERT(uniform->_type == GL_SAMPLER_2D || uniform->_type == GL_SAMPLER_CUBE);
+    GP_ASSERT(isSamplerType(uniform->_type));
     GP_ASSERT(sampler);
-    GP_ASSERT((sampler->getTexture()->getType() == Texture::TEXTURE_2D && uniform->_type == GL_SAMPLER_2D) || 
-        (sampler->getTexture()->getType() == Texture::TEXTURE_CUBE && uniform->_type == GL_SAMPLER_CUBE));
+    GP_ASSERT(getSamplerType(sampler->getTexture()->getType()) == uniform->_type);
 
-    GL_ASSERT( glActiveTexture(GL_TEXTURE0 + uniform->_index) );
+    GLStateCache::activeTexture(uniform->_index);
 
     // Bind the sampler - this binds the texture and applies sampler state
     const_cast<Texture::Sampler*>(sampler)->bind();
 
-    GL_ASSERT( glUniform1i(uniform->_location, uniform->_index) );
+    GLint unit = uniform->_index;
+    if (uniform->updateValue(&unit, sizeof(GLint)))
+        GL_ASSERT( glUniform1i(uniform->_location, unit) );
 }
 
 void Effect::setValue(Uniform* uniform, const Texture::Sampler** values, unsigned int count)
 {
     GP_ASSERT(uniform);
-    GP_ASSERT(uniform->_type == GL_SAMPLER_2D || uniform->_type == GL_SAMPLER_CUBE);
+    GP_ASSERT(isSamplerType(uniform->_type));
     GP_ASSERT(values);
 
     // Set samplers as active and load texture unit array
     GLint units[32];
     for (unsigned int i = 0; i < count; ++i)
     {
-        GP_ASSERT((const_cast<Texture::Sampler*>(values[i])->getTexture()->getType() == Texture::TEXTURE_2D && uniform->_type == GL_SAMPLER_2D) || 
-            (const_cast<Texture::Sampler*>(values[i])->getTexture()->getType() == Texture::TEXTURE_CUBE && uniform->_type == GL_SAMPLER_CUBE));
-        GL_ASSERT( glActiveTexture(GL_TEXTURE0 + uniform->_index + i) );
+        GP_ASSERT(getSamplerType(values[i]->getTexture()->getType()) == uniform->_type);
+        GLStateCache::activeTexture(uniform->_index + i);
 
         // Bind the sampler - this binds the texture and applies sampler state
         const_cast<Texture::Sampler*>(values[i])->bind();
@@ -642,12 +1257,13 @@ void Effect::setValue(Uniform* uniform, const Texture::Sampler** values, unsigne
     }
 
     // Pass texture unit array to GL
-    GL_ASSERT( glUniform1iv(uniform->_location, count, units) );
+    if (uniform->updateValue(units, sizeof(GLint) * count))
+        GL_ASSERT( glUniform1iv(uniform->_location, count, units) );
 }
 
 void Effect::bind()
 {
-   GL_ASSERT( glUseProgram(_program) );
+    GLStateCache::useProgram(_program);
 
     __currentEffect = this;
 }
@@ -657,8 +1273,18 @@ Effect* Effect::getCurrentEffect()
     return __currentEffect;
 }
 
+unsigned int Effect::getEffectCount()
+{
+    return __effectCount;
+}
+
+size_t Effect::getTotalMemorySize()
+{
+    return __effectMemorySize;
+}
+
 Uniform::Uniform() :
-    _location(-1), _type(0), _index(0), _effect(NULL)
+    _handle(0), _location(-1), _type(0), _index(0), _effect(NULL), _parent(NULL)
 {
 }
 
@@ -672,6 +1298,33 @@ Effect* Uniform::getEffect() const
     return _effect;
 }
 
+bool Uniform::updateValue(const void* value, size_t size)
+{
+    // Array element uniforms alias part of their parent's value, so they are always
+    // uploaded and the value cached for the parent is discarded.
+    const GLuint program = _effect ? _effect->_program : 0;
+    if (_parent)
+    {
+        _parent->_value.clear();
+        FrameStats::recordUniform(true);
+        FrameCapture::record(FrameCapture::SET_UNIFORM, _type, program, 0, (unsigned int)size, false, _name.c_str());
+        return true;
+    }
+
+    // Uniform values are part of the program state, so unchanged values do not need to be uploaded again.
+    if (size > 0 && _value.size() == size && memcmp(&_value[0], value, size) == 0)
+    {
+        FrameStats::recordUniform(false);
+        FrameCapture::record(FrameCapture::SET_UNIFORM, _type, program, 0, (unsigned int)size, true, _name.c_str());
+        return false;
+    }
+
+    _value.assign((const unsigned char*)value, (const unsigned char*)value + size);
+    FrameStats::recordUniform(true);
+    FrameCapture::record(FrameCapture::SET_UNIFORM, _type, program, 0, (unsigned int)size, false, _name.c_str());
+    return true;
+}
+
 const char* Uniform::getName() const
 {
     return _name.c_str();
@@ -25,6 +25,10 @@ class Uniform;
  */
 class Effect: public Ref
 {
+    friend class Game;
+    friend class ResourceManager;
+    friend class Uniform;
+
 public:
 
     /**
@@ -49,6 +53,70 @@ public:
      */
     static Effect* createFromSource(const char* vshSource, const char* fshSource, const char* defines = NULL);
 
+    /**
+     * Creates an effect whose vertex shader outputs are captured into a buffer with transform feedback.
+     *
+     * The varyings are captured interleaved, in the order given. Such effects are linked for
+     * one purpose, so they are neither cached, shared nor loaded from program binaries.
+     *
+     * @param vshPath The path to the vertex shader file.
+     * @param fshPath The path to the fragment shader file.
+     * @param defines A new-line delimited list of preprocessor defines. May be NULL.
+     * @param varyings The names of the varyings to capture.
+     * @param varyingCount The number of varyings.
+     *
+     * @return The created effect, or NULL if transform feedback is not supported or the shaders failed to build.
+     * @script{ignore}
+     */
+    static Effect* createTransformFeedback(const char* vshPath, const char* fshPath, const char* defines, const char* const* varyings, unsigned int varyingCount);
+
+    /**
+     * Submits an effect to be compiled in the background, so that the first call to
+     * createFromFile() for it does not stall rendering.
+     *
+     * The shaders are compiled and linked without waiting for the driver, and the effect
+     * is finished as the game runs frames. Where KHR_parallel_shader_compile is supported,
+     * the driver compiles the submitted effects on its own threads and effects are finished
+     * once they complete. Otherwise the driver may still defer the work, and one effect is
+     * finished per frame. Calling createFromFile() for an effect that is still compiling
+     * finishes it immediately.
+     *
+     * Prewarmed effects are kept in the effect cache until the game shuts down.
+     *
+     * @param vshPath The path to the vertex shader file.
+     * @param fshPath The path to the fragment shader file.
+     * @param defines A new-line delimited list of preprocessor defines. May be NULL.
+     */
+    static void prewarm(const char* vshPath, const char* fshPath, const char* defines = NULL);
+
+    /**
+     * Submits every effect listed in a manifest written by saveManifest() to be compiled in the background.
+     *
+     * @param manifestPath The path to the manifest file.
+     *
+     * @return The number of effects submitted.
+     *
+     * @see prewarm
+     */
+    static unsigned int prewarmManifest(const char* manifestPath);
+
+    /**
+     * Writes a manifest of every effect that has been created with createFromFile() since
+     * the game started, to be replayed with prewarmManifest() by later runs.
+     *
+     * @param manifestPath The path to write the manifest file to.
+     *
+     * @return true if the manifest was written.
+     */
+    static bool saveManifest(const char* manifestPath);
+
+    /**
+     * Gets the number of submitted effects that are still compiling.
+     *
+     * @return The number of pending effects.
+     */
+    static unsigned int getPendingCount();
+
     /**
      * Returns the unique string identifier for the effect, which is a concatenation of
      * the shader paths it was loaded from.
@@ -82,6 +150,42 @@ public:
      */
     Uniform* getUniform(unsigned int index) const;
 
+    /**
+     * Returns the uniform with the name of the specified uniform handle.
+     *
+     * The uniforms of an effect are placed in a table indexed by handle when its program is
+     * linked, so finding a uniform by handle is an array index. Handles given out later, and
+     * the elements of array uniforms, are looked up by name the first time they are used with
+     * this effect, and by index afterwards.
+     *
+     * @param handle A handle returned by getUniformHandle().
+     *
+     * @return The uniform, or NULL if no such uniform exists.
+     */
+    Uniform* getUniformByHandle(unsigned int handle) const;
+
+    /**
+     * Gets the handle of the uniforms with the specified name.
+     *
+     * Handles are small integers that are the same for every effect, given out in the order
+     * the names are first seen, so that a name can be looked up once and its uniforms then
+     * found by handle in each effect. May be called from any thread.
+     *
+     * @param name The name of the uniform.
+     *
+     * @return The handle of the name.
+     */
+    static unsigned int getUniformHandle(const char* name);
+
+    /**
+     * Gets the name of a uniform handle.
+     *
+     * @param handle A handle returned by getUniformHandle().
+     *
+     * @return The name of the uniforms of the handle.
+     */
+    static const char* getUniformHandleName(unsigned int handle);
+
     /**
      * Returns the number of active uniforms in this effect.
      * 
@@ -234,18 +338,70 @@ private:
      */
     ~Effect();
 
+    /**
+     * @see Ref::isDestroyedOnMainThread
+     */
+    bool isDestroyedOnMainThread() const;
+
     /**
      * Hidden copy assignment operator.
      */
     Effect& operator=(const Effect&);
 
+    /**
+     * A program whose shaders have been submitted for compilation and linking.
+     */
+    struct PendingProgram;
+
     static Effect* createFromSource(const char* vshPath, const char* vshSource, const char* fshPath, const char* fshSource, const char* defines = NULL);
 
+    /**
+     * Preprocesses the shaders and submits them for compilation and linking without waiting for the result.
+     */
+    static PendingProgram* beginProgram(const char* vshPath, const char* vshSource, const char* fshPath, const char* fshSource, const char* defines,
+                                        const char* const* varyings = NULL, unsigned int varyingCount = 0);
+
+    /**
+     * Waits for a submitted program, reports any errors and creates its effect,
+     * which is added to the effect cache if the program has an id. Deletes the pending program.
+     */
+    static Effect* finishProgram(PendingProgram* pending);
+
+    /**
+     * Finishes the prewarmed effects that are done compiling. Called once per frame.
+     */
+    static void updatePending();
+
+    /**
+     * Deletes the pending programs and releases the prewarmed effects. Called during game shutdown.
+     */
+    static void finalize();
+
+    /**
+     * Gets the number of effects.
+     */
+    static unsigned int getEffectCount();
+
+    /**
+     * Gets the estimated number of bytes used by the programs of all effects.
+     */
+    static size_t getTotalMemorySize();
+
+    /**
+     * Looks up a uniform that is not in the handle table yet, which is either an element
+     * of an array uniform or not a uniform of this effect.
+     */
+    Uniform* findUniform(const char* name) const;
+
     GLuint _program;
+    size_t _memorySize;
     std::string _id;
-    std::map<std::string, VertexAttribute> _vertexAttributes;
-    mutable std::map<std::string, Uniform*> _uniforms;
+    std::vector<std::pair<std::string, VertexAttribute> > _vertexAttributes;
+    mutable std::vector<Uniform*> _uniforms;
+    mutable std::vector<Uniform*> _handleUniforms;
+    mutable std::vector<bool> _handleUniformsFound;
     static Uniform _emptyUniform;
+    static std::vector<PendingProgram*> _pendingPrograms;
 };
 
 /**
@@ -300,11 +456,24 @@ private:
      */
     Uniform& operator=(const Uniform&);
 
+    /**
+     * Stores a value that is about to be set on this uniform, unless the program already holds it.
+     *
+     * @param value The value to set.
+     * @param size The size of the value in bytes.
+     *
+     * @return true if the value must be uploaded to the program, false if it is unchanged.
+     */
+    bool updateValue(const void* value, size_t size);
+
     std::string _name;
+    unsigned int _handle;
     GLint _location;
     GLenum _type;
     unsigned int _index;
     Effect* _effect;
+    Uniform* _parent;
+    std::vector<unsigned char> _value;
 };
 
 }
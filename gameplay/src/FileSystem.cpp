@@ -3,6 +3,8 @@
 #include "Properties.h"
 #include "Stream.h"
 #include "Platform.h"
+#include "Game.h"
+#include "JobSystem.h"
 
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -14,12 +16,17 @@
     #include <direct.h>
     #define gp_stat _stat
     #define gp_stat_struct struct stat
+    #define gp_mkdir(path) _mkdir(path)
 #else
     #define __EXT_POSIX2
     #include <libgen.h>
     #include <dirent.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
     #define gp_stat stat
     #define gp_stat_struct struct stat
+    #define gp_mkdir(path) mkdir(path, 0777)
 #endif
 
 #ifdef __ANDROID__
@@ -27,6 +34,10 @@
 extern AAssetManager* __assetManager;
 #endif
 
+// Identifier and version of the archives written by gameplay-encoder
+#define ARCHIVE_IDENTIFIER "GPAK"
+#define ARCHIVE_VERSION 1
+
 namespace gameplay
 {
 
@@ -83,6 +94,35 @@ static bool androidFileExists(const char* filePath)
     return false;
 }
 
+/**
+ * Maps an asset that is stored uncompressed in the APK straight from the package file.
+ *
+ * @return The contents of the asset, or NULL if the asset is compressed or could not be mapped.
+ */
+static const void* mapAsset(AAsset* asset, size_t* size)
+{
+    off_t start;
+    off_t length;
+    int file = AAsset_openFileDescriptor(asset, &start, &length);
+    if (file < 0)
+        return NULL;
+    if (length == 0)
+    {
+        ::close(file);
+        return NULL;
+    }
+
+    // Mappings start on a page boundary, so the asset starts partway into the first mapped page.
+    size_t pageOffset = (size_t)start % (size_t)sysconf(_SC_PAGESIZE);
+    void* data = mmap(NULL, (size_t)length + pageOffset, PROT_READ, MAP_PRIVATE, file, start - (off_t)pageOffset);
+    ::close(file);
+    if (data == MAP_FAILED)
+        return NULL;
+
+    *size = (size_t)length;
+    return (const unsigned char*)data + pageOffset;
+}
+
 #endif
 
 /** @script{ignore} */
@@ -169,6 +209,7 @@ public:
     virtual long int position();
     virtual bool seek(long int offset, int origin);
     virtual bool rewind();
+    virtual const void* map(size_t size);
 
     static FileStreamAndroid* create(const char* filePath, const char* mode);
 
@@ -177,10 +218,314 @@ private:
 
 private:
     AAsset* _asset;
+    const unsigned char* _buffer;   // The contents of the asset, once they have been mapped
 };
 
 #endif
 
+/**
+ * Defines a file in a mounted archive.
+ */
+struct ArchiveEntry
+{
+    size_t offset;                  // Offset of the stored file in the archive
+    size_t size;                    // Size of the file
+    size_t storedSize;              // Size of the stored file, which is the size when it is not compressed
+};
+
+/**
+ * Defines a mounted archive.
+ */
+struct Archive
+{
+    Archive() : mapping(NULL), mappingSize(0), stream(NULL) { }
+
+    std::string mountPath;                                  // Prefix of the paths of the files, empty or ending with '/'
+    const void* mapping;                                    // The archive mapped into memory, or NULL
+    size_t mappingSize;
+    Stream* stream;                                         // The archive stream, when it could not be mapped
+    std::mutex streamMutex;                                 // Serializes the seeks and reads of the stream
+    std::unordered_map<std::string, ArchiveEntry> entries;  // The files, by path
+};
+
+// The mounted archives, in the order they were mounted.
+static std::vector<Archive*> __archives;
+
+/**
+ * Reads data at an offset of an archive.
+ */
+static bool readArchive(Archive* archive, size_t offset, void* data, size_t size)
+{
+    if (archive->mapping)
+    {
+        if (offset > archive->mappingSize || size > archive->mappingSize - offset)
+            return false;
+        memcpy(data, (const unsigned char*)archive->mapping + offset, size);
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(archive->streamMutex);
+    return archive->stream->seek((long int)offset, SEEK_SET) && archive->stream->read(data, 1, size) == size;
+}
+
+/**
+ * Finds the file in the mounted archives with the given path, searching the archives mounted last first.
+ *
+ * @return The archive containing the file, or NULL if no archive contains it.
+ */
+static Archive* findArchiveEntry(const char* path, const ArchiveEntry** entry)
+{
+    if (__archives.empty() || FileSystem::isAbsolutePath(path))
+        return NULL;
+
+    std::string key(FileSystem::resolvePath(path));
+    std::replace(key.begin(), key.end(), '\\', '/');
+    while (key.compare(0, 2, "./") == 0)
+        key.erase(0, 2);
+    for (size_t i = __archives.size(); i-- > 0;)
+    {
+        Archive* archive = __archives[i];
+        if (key.compare(0, archive->mountPath.length(), archive->mountPath) != 0)
+            continue;
+        std::unordered_map<std::string, ArchiveEntry>::const_iterator itr = archive->entries.find(key.substr(archive->mountPath.length()));
+        if (itr != archive->entries.end())
+        {
+            *entry = &itr->second;
+            return archive;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Reads a file stored in an archive in memory.
+ *
+ * @script{ignore}
+ */
+class ArchiveStream : public Stream
+{
+public:
+
+    ArchiveStream(const unsigned char* data, size_t size, bool owned)
+        : _data(data), _size(size), _owned(owned), _position(0)
+    {
+    }
+
+    ~ArchiveStream()
+    {
+        close();
+    }
+
+    bool canRead()
+    {
+        return _data != NULL;
+    }
+
+    bool canWrite()
+    {
+        return false;
+    }
+
+    bool canSeek()
+    {
+        return true;
+    }
+
+    void close()
+    {
+        if (_owned)
+            SAFE_DELETE_ARRAY(_data);
+        _data = NULL;
+    }
+
+    size_t read(void* ptr, size_t size, size_t count)
+    {
+        if (!_data || size == 0)
+            return 0;
+        count = std::min(count, (_size - _position) / size);
+        memcpy(ptr, _data + _position, size * count);
+        _position += size * count;
+        return count;
+    }
+
+    char* readLine(char* str, int num)
+    {
+        if (!_data || num <= 0 || _position >= _size)
+            return NULL;
+        int i = 0;
+        while (i < num - 1 && _position < _size)
+        {
+            char c = (char)_data[_position++];
+            str[i++] = c;
+            if (c == '\n')
+                break;
+        }
+        str[i] = '\0';
+        return str;
+    }
+
+    size_t write(const void* ptr, size_t size, size_t count)
+    {
+        return 0;
+    }
+
+    bool eof()
+    {
+        return _position >= _size;
+    }
+
+    size_t length()
+    {
+        return _size;
+    }
+
+    long int position()
+    {
+        return (long int)_position;
+    }
+
+    bool seek(long int offset, int origin)
+    {
+        long int position;
+        switch (origin)
+        {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position = (long int)_position + offset;
+            break;
+        case SEEK_END:
+            position = (long int)_size + offset;
+            break;
+        default:
+            return false;
+        }
+        if (position < 0 || (size_t)position > _size)
+            return false;
+        _position = (size_t)position;
+        return true;
+    }
+
+    bool rewind()
+    {
+        _position = 0;
+        return true;
+    }
+
+    const void* map(size_t size)
+    {
+        if (!_data || size > _size - _position)
+            return NULL;
+        const unsigned char* data = _data + _position;
+        _position += size;
+        return data;
+    }
+
+private:
+
+    const unsigned char* _data;
+    size_t _size;
+    bool _owned;                    // Whether the data was read for this stream rather than pointing into a mapped archive
+    size_t _position;
+};
+
+/**
+ * Opens a file in an archive, reading it into memory unless it can be read straight from the archive mapping.
+ */
+static Stream* openArchiveEntry(Archive* archive, const ArchiveEntry& entry)
+{
+    if (archive->mapping && entry.storedSize == entry.size)
+        return new ArchiveStream((const unsigned char*)archive->mapping + entry.offset, entry.size, false);
+
+    unsigned char* stored = new unsigned char[entry.storedSize];
+    if (!readArchive(archive, entry.offset, stored, entry.storedSize))
+    {
+        SAFE_DELETE_ARRAY(stored);
+        return NULL;
+    }
+    if (entry.storedSize == entry.size)
+        return new ArchiveStream(stored, entry.size, true);
+
+    unsigned char* data = new unsigned char[entry.size];
+    bool decompressed = FileSystem::decompress(stored, entry.storedSize, data, entry.size);
+    SAFE_DELETE_ARRAY(stored);
+    if (!decompressed)
+    {
+        SAFE_DELETE_ARRAY(data);
+        return NULL;
+    }
+    return new ArchiveStream(data, entry.size, true);
+}
+
+/**
+ * Defines a file read ahead by FileSystem::prefetch.
+ */
+struct PrefetchedFile
+{
+    enum State
+    {
+        QUEUED,
+        READING,
+        READ,
+        FAILED
+    };
+
+    State state;
+    unsigned char* data;            // The contents of the file, once it has been read
+    size_t size;
+};
+
+// The prefetched files by path, the condition signalled whenever one has been read, and the
+// counter of the jobs reading them.
+static std::unordered_map<std::string, PrefetchedFile> __prefetched;
+static std::mutex __prefetchMutex;
+static std::condition_variable __prefetchCondition;
+static JobSystem::Counter* __prefetchCounter = NULL;
+
+// The paths of the files opened for reading while recording, in the order they were first opened.
+static bool __recording = false;
+static std::vector<std::string> __recordedPaths;
+static std::set<std::string> __recordedPathSet;
+static std::mutex __recordingMutex;
+
+/**
+ * Records the path of a file opened for reading, if the file accesses are being recorded.
+ */
+static void recordAccess(const char* path)
+{
+    std::lock_guard<std::mutex> lock(__recordingMutex);
+    if (__recording && __recordedPathSet.insert(path).second)
+        __recordedPaths.push_back(path);
+}
+
+/**
+ * Takes a prefetched file, waiting for it if it is still being read.
+ *
+ * @return A stream over the contents of the file, or NULL if the file was not prefetched or could not be read.
+ */
+static Stream* takePrefetched(const char* path)
+{
+    std::unique_lock<std::mutex> lock(__prefetchMutex);
+    if (__prefetched.empty())
+        return NULL;
+
+    std::unordered_map<std::string, PrefetchedFile>::iterator itr = __prefetched.find(path);
+    while (itr != __prefetched.end() && itr->second.state == PrefetchedFile::READING)
+    {
+        __prefetchCondition.wait(lock);
+        itr = __prefetched.find(path);
+    }
+    if (itr == __prefetched.end())
+        return NULL;
+
+    // A file that has not started reading yet is read by the caller instead, and its job skips it.
+    Stream* stream = NULL;
+    if (itr->second.state == PrefetchedFile::READ)
+        stream = new ArchiveStream(itr->second.data, itr->second.size, true);
+    __prefetched.erase(itr);
+    return stream;
+}
+
 /////////////////////////////
 
 FileSystem::FileSystem()
@@ -344,6 +689,10 @@ bool FileSystem::fileExists(const char* filePath)
 {
     GP_ASSERT(filePath);
 
+    const ArchiveEntry* entry;
+    if (findArchiveEntry(filePath, &entry))
+        return true;
+
     std::string fullPath;
 
 #ifdef __ANDROID__
@@ -364,10 +713,37 @@ bool FileSystem::fileExists(const char* filePath)
 }
 
 Stream* FileSystem::open(const char* path, size_t streamMode)
+{
+    if ((streamMode & WRITE) != 0)
+        return openStream(path, streamMode);
+
+    Stream* stream = takePrefetched(path);
+    if (!stream)
+        stream = openStream(path, streamMode);
+    if (stream)
+        recordAccess(path);
+    return stream;
+}
+
+Stream* FileSystem::openStream(const char* path, size_t streamMode)
 {
     char modeStr[] = "rb";
     if ((streamMode & WRITE) != 0)
         modeStr[0] = 'w';
+
+    // Files in the mounted archives are found before loose files.
+    if ((streamMode & WRITE) == 0)
+    {
+        const ArchiveEntry* entry;
+        Archive* archive = findArchiveEntry(path, &entry);
+        if (archive)
+        {
+            Stream* stream = openArchiveEntry(archive, *entry);
+            if (!stream)
+                GP_ERROR("Failed to read file '%s' from an archive.", path);
+            return stream;
+        }
+    }
 #ifdef __ANDROID__
     std::string fullPath(__resourcePath);
     fullPath += resolvePath(path);
@@ -409,6 +785,37 @@ Stream* FileSystem::open(const char* path, size_t streamMode)
 #endif
 }
 
+bool FileSystem::createDirectory(const char* dirPath)
+{
+    GP_ASSERT(dirPath);
+
+    std::string fullPath;
+#ifdef __ANDROID__
+    fullPath = __resourcePath;
+    fullPath += resolvePath(dirPath);
+#else
+    getFullPath(dirPath, fullPath);
+#endif
+
+    // Create each directory of the path that does not exist yet, skipping the root and drive letters.
+    size_t index = 0;
+    do
+    {
+        index = fullPath.find_first_of("/\\", index + 1);
+        std::string path = fullPath.substr(0, index);
+        if (path.empty() || path[path.length() - 1] == ':')
+            continue;
+
+        gp_stat_struct s;
+        if (gp_stat(path.c_str(), &s) != 0 && gp_mkdir(path.c_str()) != 0)
+        {
+            GP_WARN("Failed to create directory: '%s'", path.c_str());
+            return false;
+        }
+    } while (index != std::string::npos && index + 1 < fullPath.length());
+    return true;
+}
+
 FILE* FileSystem::openFile(const char* filePath, const char* mode)
 {
     GP_ASSERT(filePath);
@@ -456,6 +863,418 @@ char* FileSystem::readAll(const char* filePath, int* fileSize)
     return buffer;
 }
 
+const void* FileSystem::mapFile(const char* filePath, size_t* fileSize)
+{
+    GP_ASSERT(filePath);
+    GP_ASSERT(fileSize);
+
+    // Files in a mapped archive are mapped straight from it, unless they need to be decompressed.
+    const ArchiveEntry* entry;
+    Archive* archive = findArchiveEntry(filePath, &entry);
+    if (archive)
+    {
+        if (!archive->mapping || entry->storedSize != entry->size)
+            return NULL;
+        *fileSize = entry->size;
+        return (const unsigned char*)archive->mapping + entry->offset;
+    }
+
+#ifdef __ANDROID__
+    // Uncompressed assets are mapped straight from the APK, rather than copied out of it first.
+    if (!isAbsolutePath(filePath))
+    {
+        AAsset* asset = AAssetManager_open(__assetManager, resolvePath(filePath), AASSET_MODE_UNKNOWN);
+        if (asset)
+        {
+            const void* data = mapAsset(asset, fileSize);
+            AAsset_close(asset);
+            if (data)
+                return data;
+        }
+    }
+#endif
+
+    std::string fullPath;
+    getFullPath(filePath, fullPath);
+
+    createFileFromAsset(filePath);
+
+#ifdef WIN32
+    HANDLE file = CreateFileA(fullPath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return NULL;
+    }
+
+    // The view keeps the file and its mapping open until it is unmapped.
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (mapping == NULL)
+        return NULL;
+    const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (data == NULL)
+        return NULL;
+
+    *fileSize = (size_t)size.QuadPart;
+    return data;
+#else
+    int file = ::open(fullPath.c_str(), O_RDONLY);
+    if (file < 0)
+        return NULL;
+
+    struct stat s;
+    if (fstat(file, &s) != 0 || s.st_size == 0)
+    {
+        ::close(file);
+        return NULL;
+    }
+
+    // The mapping keeps the file open until it is unmapped.
+    void* data = mmap(NULL, (size_t)s.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file);
+    if (data == MAP_FAILED)
+        return NULL;
+
+    *fileSize = (size_t)s.st_size;
+    return data;
+#endif
+}
+
+void FileSystem::unmapFile(const void* data, size_t fileSize)
+{
+    if (data == NULL)
+        return;
+
+    // Files mapped from an archive stay mapped with it.
+    for (size_t i = 0, count = __archives.size(); i < count; ++i)
+    {
+        const unsigned char* mapping = (const unsigned char*)__archives[i]->mapping;
+        if (mapping && (const unsigned char*)data >= mapping && (const unsigned char*)data < mapping + __archives[i]->mappingSize)
+            return;
+    }
+
+#ifdef WIN32
+    UnmapViewOfFile(data);
+#else
+    // Assets mapped from an APK start partway into their first page.
+    size_t pageOffset = (size_t)data % (size_t)sysconf(_SC_PAGESIZE);
+    munmap((unsigned char*)const_cast<void*>(data) - pageOffset, fileSize + pageOffset);
+#endif
+}
+
+bool FileSystem::mountArchive(const char* path, const char* mountPath)
+{
+    GP_ASSERT(path);
+
+    // Map the archive where the platform supports it, and otherwise keep a stream open to it.
+    Archive* archive = new Archive();
+    archive->mapping = mapFile(path, &archive->mappingSize);
+    if (!archive->mapping)
+    {
+        archive->stream = open(path);
+        if (!archive->stream)
+        {
+            GP_WARN("Failed to open archive '%s'.", path);
+            SAFE_DELETE(archive);
+            return false;
+        }
+    }
+
+    // Read the header.
+    char identifier[4];
+    unsigned int header[4];
+    if (!readArchive(archive, 0, identifier, 4) || memcmp(identifier, ARCHIVE_IDENTIFIER, 4) != 0 ||
+        !readArchive(archive, 4, header, sizeof(header)) || header[0] != ARCHIVE_VERSION)
+    {
+        GP_WARN("Invalid header for archive '%s'.", path);
+        unmapFile(archive->mapping, archive->mappingSize);
+        SAFE_DELETE(archive->stream);
+        SAFE_DELETE(archive);
+        return false;
+    }
+    unsigned int entryCount = header[1];
+    size_t tableSize = header[2];
+    size_t tableStoredSize = header[3];
+
+    // Read the entry table, which is compressed when it is stored in fewer bytes than its size.
+    size_t tableOffset = 4 + sizeof(header);
+    std::vector<unsigned char> table(tableSize);
+    bool tableRead;
+    if (tableStoredSize == tableSize)
+    {
+        tableRead = tableSize == 0 || readArchive(archive, tableOffset, &table[0], tableSize);
+    }
+    else
+    {
+        std::vector<unsigned char> stored(tableStoredSize);
+        tableRead = tableStoredSize < tableSize && tableStoredSize > 0 && readArchive(archive, tableOffset, &stored[0], tableStoredSize) &&
+            decompress(&stored[0], tableStoredSize, &table[0], tableSize);
+    }
+
+    // Index the entries by path.
+    size_t archiveSize = archive->mapping ? archive->mappingSize : archive->stream->length();
+    size_t position = 0;
+    archive->entries.reserve(entryCount);
+    for (unsigned int i = 0; tableRead && i < entryCount; ++i)
+    {
+        unsigned int length;
+        unsigned int values[3];
+        if (tableSize - position < sizeof(length))
+        {
+            tableRead = false;
+            break;
+        }
+        memcpy(&length, &table[position], sizeof(length));
+        position += sizeof(length);
+        if (tableSize - position < (size_t)length + sizeof(values))
+        {
+            tableRead = false;
+            break;
+        }
+        std::string entryPath((const char*)&table[position], length);
+        position += length;
+        memcpy(values, &table[position], sizeof(values));
+        position += sizeof(values);
+
+        ArchiveEntry entry;
+        entry.offset = values[0];
+        entry.size = values[1];
+        entry.storedSize = values[2];
+        if (entry.offset > archiveSize || entry.storedSize > archiveSize - entry.offset || entry.storedSize > entry.size)
+            tableRead = false;
+        archive->entries[entryPath] = entry;
+    }
+    if (!tableRead)
+    {
+        GP_WARN("Invalid entry table for archive '%s'.", path);
+        unmapFile(archive->mapping, archive->mappingSize);
+        SAFE_DELETE(archive->stream);
+        SAFE_DELETE(archive);
+        return false;
+    }
+
+    if (mountPath && strlen(mountPath) > 0)
+    {
+        archive->mountPath = mountPath;
+        std::replace(archive->mountPath.begin(), archive->mountPath.end(), '\\', '/');
+        if (archive->mountPath[archive->mountPath.length() - 1] != '/')
+            archive->mountPath += '/';
+    }
+    __archives.push_back(archive);
+    return true;
+}
+
+void FileSystem::unmountArchives()
+{
+    // Unmount the last mounted first, so that an archive mapped from an earlier archive is left in its mapping.
+    while (!__archives.empty())
+    {
+        Archive* archive = __archives.back();
+        __archives.pop_back();
+        unmapFile(archive->mapping, archive->mappingSize);
+        SAFE_DELETE(archive->stream);
+        SAFE_DELETE(archive);
+    }
+}
+
+void FileSystem::startAccessRecording()
+{
+    std::lock_guard<std::mutex> lock(__recordingMutex);
+    __recording = true;
+}
+
+bool FileSystem::stopAccessRecording(const char* manifestPath)
+{
+    std::vector<std::string> paths;
+    {
+        std::lock_guard<std::mutex> lock(__recordingMutex);
+        __recording = false;
+        paths.swap(__recordedPaths);
+        __recordedPathSet.clear();
+    }
+    if (manifestPath == NULL)
+        return false;
+
+    std::unique_ptr<Stream> stream(open(manifestPath, WRITE));
+    if (stream.get() == NULL || !stream->canWrite())
+    {
+        GP_ERROR("Failed to open access manifest '%s' for writing.", manifestPath);
+        return false;
+    }
+    for (size_t i = 0, count = paths.size(); i < count; ++i)
+    {
+        stream->write(paths[i].c_str(), 1, paths[i].length());
+        stream->write("\n", 1, 1);
+    }
+    return true;
+}
+
+unsigned int FileSystem::prefetch(const char* manifestPath)
+{
+    GP_ASSERT(manifestPath);
+
+    // Without worker threads the files would only be read in the order the loaders read them anyway.
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem == NULL || jobSystem->getThreadCount() <= 1)
+        return 0;
+
+    char* manifest = readAll(manifestPath);
+    if (manifest == NULL)
+    {
+        GP_WARN("Failed to read access manifest '%s'.", manifestPath);
+        return 0;
+    }
+    if (__prefetchCounter == NULL)
+        __prefetchCounter = new JobSystem::Counter();
+
+    // Each line is the path of a file, in the order the files were first opened.
+    unsigned int count = 0;
+    for (char* line = strtok(manifest, "\r\n"); line != NULL; line = strtok(NULL, "\r\n"))
+    {
+        std::string path(line);
+        {
+            std::lock_guard<std::mutex> lock(__prefetchMutex);
+            if (__prefetched.find(path) != __prefetched.end())
+                continue;
+            PrefetchedFile& file = __prefetched[path];
+            file.state = PrefetchedFile::QUEUED;
+            file.data = NULL;
+            file.size = 0;
+        }
+
+        jobSystem->run([path]()
+        {
+            {
+                std::lock_guard<std::mutex> lock(__prefetchMutex);
+                std::unordered_map<std::string, PrefetchedFile>::iterator itr = __prefetched.find(path);
+                if (itr == __prefetched.end() || itr->second.state != PrefetchedFile::QUEUED)
+                    return;
+                itr->second.state = PrefetchedFile::READING;
+            }
+
+            unsigned char* data = NULL;
+            size_t size = 0;
+            bool read = false;
+            std::unique_ptr<Stream> stream(openStream(path.c_str(), READ));
+            if (stream.get())
+            {
+                size = stream->length();
+                data = new unsigned char[size > 0 ? size : 1];
+                read = stream->read(data, 1, size) == size;
+            }
+
+            {
+                // The file may have been taken or cleared while it was read, in which case it is discarded.
+                std::lock_guard<std::mutex> lock(__prefetchMutex);
+                std::unordered_map<std::string, PrefetchedFile>::iterator itr = __prefetched.find(path);
+                if (itr != __prefetched.end() && itr->second.state == PrefetchedFile::READING)
+                {
+                    itr->second.state = read ? PrefetchedFile::READ : PrefetchedFile::FAILED;
+                    if (read)
+                    {
+                        itr->second.data = data;
+                        itr->second.size = size;
+                        data = NULL;
+                    }
+                }
+            }
+            SAFE_DELETE_ARRAY(data);
+            __prefetchCondition.notify_all();
+        }, __prefetchCounter);
+        ++count;
+    }
+    SAFE_DELETE_ARRAY(manifest);
+
+    return count;
+}
+
+void FileSystem::clearPrefetched()
+{
+    {
+        std::lock_guard<std::mutex> lock(__prefetchMutex);
+        for (std::unordered_map<std::string, PrefetchedFile>::iterator itr = __prefetched.begin(); itr != __prefetched.end(); ++itr)
+        {
+            SAFE_DELETE_ARRAY(itr->second.data);
+        }
+        __prefetched.clear();
+    }
+    __prefetchCondition.notify_all();
+
+    // The jobs still queued find their files gone and return.
+    if (__prefetchCounter)
+    {
+        Game::getInstance()->getJobSystem()->wait(__prefetchCounter);
+        SAFE_DELETE(__prefetchCounter);
+    }
+}
+
+bool FileSystem::decompress(const void* data, size_t size, void* output, size_t outputSize)
+{
+    const unsigned char* in = (const unsigned char*)data;
+    const unsigned char* inEnd = in + size;
+    unsigned char* out = (unsigned char*)output;
+    unsigned char* outStart = out;
+    unsigned char* outEnd = out + outputSize;
+    while (in < inEnd)
+    {
+        // Each sequence is a run of literals followed by a match, except for the last which only has literals.
+        unsigned int token = *in++;
+        size_t literalLength = token >> 4;
+        if (literalLength == 15)
+        {
+            unsigned char extra;
+            do
+            {
+                if (in >= inEnd)
+                    return false;
+                extra = *in++;
+                literalLength += extra;
+            } while (extra == 255);
+        }
+        if (literalLength > (size_t)(inEnd - in) || literalLength > (size_t)(outEnd - out))
+            return false;
+        memcpy(out, in, literalLength);
+        in += literalLength;
+        out += literalLength;
+        if (in >= inEnd)
+            break;
+
+        if (inEnd - in < 2)
+            return false;
+        size_t distance = (size_t)in[0] | ((size_t)in[1] << 8);
+        in += 2;
+        if (distance == 0 || distance > (size_t)(out - outStart))
+            return false;
+        size_t matchLength = token & 15;
+        if (matchLength == 15)
+        {
+            unsigned char extra;
+            do
+            {
+                if (in >= inEnd)
+                    return false;
+                extra = *in++;
+                matchLength += extra;
+            } while (extra == 255);
+        }
+        matchLength += 4;
+        if (matchLength > (size_t)(outEnd - out))
+            return false;
+
+        // Matches may overlap the output they are copied to, so they are copied a byte at a time.
+        const unsigned char* match = out - distance;
+        while (matchLength-- > 0)
+            *out++ = *match++;
+    }
+    return out == outEnd;
+}
+
 bool FileSystem::isAbsolutePath(const char* filePath)
 {
     if (filePath == 0 || filePath[0] == '\0')
@@ -720,7 +1539,7 @@ bool FileStream::rewind()
 #ifdef __ANDROID__
 
 FileStreamAndroid::FileStreamAndroid(AAsset* asset)
-    : _asset(asset)
+    : _asset(asset), _buffer(NULL)
 {
 }
 
@@ -761,6 +1580,7 @@ void FileStreamAndroid::close()
     if (_asset)
         AAsset_close(_asset);
     _asset = NULL;
+    _buffer = NULL;
 }
 
 size_t FileStreamAndroid::read(void* ptr, size_t size, size_t count)
@@ -862,6 +1682,21 @@ bool FileStreamAndroid::rewind()
     return false;
 }
 
+const void* FileStreamAndroid::map(size_t size)
+{
+    // Uncompressed assets are mapped from the APK, compressed ones are inflated into memory once.
+    if (!_asset)
+        return NULL;
+    if (!_buffer)
+        _buffer = (const unsigned char*)AAsset_getBuffer(_asset);
+    long int offset = position();
+    if (!_buffer || offset < 0 || size > length() - (size_t)offset)
+        return NULL;
+    if (AAsset_seek(_asset, (off_t)size, SEEK_CUR) == -1)
+        return NULL;
+    return _buffer + offset;
+}
+
 #endif
 
 }
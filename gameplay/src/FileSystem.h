@@ -137,6 +137,15 @@ public:
      */
     static bool listFiles(const char* dirPath, std::vector<std::string>& files);
 
+    /**
+     * Creates a directory, along with the directories above it that do not exist yet.
+     *
+     * @param dirPath Directory path relative to the path set in <code>setResourcePath(const char*)</code>.
+     *
+     * @return <code>true</code> if the directory exists or was created; <code>false</code> otherwise.
+     */
+    static bool createDirectory(const char* dirPath);
+
     /**
      * Checks if the file at the given path exists.
      * 
@@ -192,6 +201,113 @@ public:
      */
     static char* readAll(const char* filePath, int* fileSize = NULL);
 
+    /**
+     * Maps the entire contents of the specified file into memory for reading.
+     *
+     * The pages of the file are read in by the operating system as they are first
+     * touched, so only the regions that are accessed take up memory. The returned
+     * memory must be released with unmapFile. On Android, assets stored uncompressed
+     * in the APK are mapped straight from the package.
+     *
+     * @param filePath The path to the file to be mapped.
+     * @param fileSize The size of the file in bytes.
+     *
+     * @return The read-only contents of the file, or NULL if the file could not be mapped.
+     * @script{ignore}
+     */
+    static const void* mapFile(const char* filePath, size_t* fileSize);
+
+    /**
+     * Unmaps the contents of a file mapped with mapFile.
+     *
+     * @param data The contents returned by mapFile.
+     * @param fileSize The size of the file returned by mapFile.
+     * @script{ignore}
+     */
+    static void unmapFile(const void* data, size_t fileSize);
+
+    /**
+     * Mounts an archive of resource files, which is searched before the loose files.
+     *
+     * Archives (.pak) are written by gameplay-encoder from a directory of resources. Opening
+     * a file from an archive looks up its path in a hash table and reads it through the one
+     * handle or memory mapping that the archive keeps open, instead of opening a file each.
+     * Archives mounted later are searched first. Only files opened for reading are read from
+     * archives, and listFiles() and openFile() only see loose files.
+     *
+     * Archives must be mounted before resources are loaded from them on other threads. The
+     * 'archives' section of the game config mounts archives at startup, with a property for
+     * each archive naming the path it is mounted at ('.' for the resource path) and set to
+     * the path of the archive, such as 'res = res.pak'.
+     *
+     * @param path The path of the archive.
+     * @param mountPath The path that the paths of the files in the archive are relative to,
+     *      or NULL to look them up relative to the resource path.
+     *
+     * @return true if the archive was mounted, false if it could not be read.
+     */
+    static bool mountArchive(const char* path, const char* mountPath = NULL);
+
+    /**
+     * Unmounts all of the mounted archives.
+     *
+     * The streams and mappings of the files opened from the archives must no longer be in use.
+     */
+    static void unmountArchives();
+
+    /**
+     * Decompresses a block of LZ4 compressed data, as written by gameplay-encoder for the
+     * compressed sections of bundles and the compressed files of archives.
+     *
+     * @param data The compressed data.
+     * @param size The size of the compressed data.
+     * @param output The buffer to decompress the data into.
+     * @param outputSize The size of the decompressed data.
+     *
+     * @return true if the data decompressed to exactly outputSize bytes, false if it is corrupt.
+     * @script{ignore}
+     */
+    static bool decompress(const void* data, size_t size, void* output, size_t outputSize);
+
+    /**
+     * Starts recording the paths of the files opened for reading, in the order they are first opened.
+     *
+     * The files a game reads while it starts are the same every run, so the recorded paths
+     * can be saved with stopAccessRecording() and read ahead with prefetch() by later runs.
+     * This is done for the files read before the first frame when the 'prefetch' section of
+     * the game config names a 'manifest' file, which is recorded when 'record' is true and
+     * prefetched otherwise.
+     */
+    static void startAccessRecording();
+
+    /**
+     * Stops recording the paths of the files opened for reading and writes them to a manifest.
+     *
+     * @param manifestPath The path to write the manifest file to, or NULL to discard the recorded paths.
+     *
+     * @return true if the manifest was written.
+     */
+    static bool stopAccessRecording(const char* manifestPath);
+
+    /**
+     * Reads the files listed in a manifest written by stopAccessRecording() into memory
+     * in the background, in the order they were recorded.
+     *
+     * Opening a prefetched file for reading returns a stream over its memory instead of
+     * reading it again, waiting for it if it is still being read. A file is only served
+     * from memory once; the files that are never opened are freed with clearPrefetched().
+     *
+     * @param manifestPath The path to the manifest file.
+     *
+     * @return The number of files submitted for reading.
+     */
+    static unsigned int prefetch(const char* manifestPath);
+
+    /**
+     * Frees the prefetched files that have not been opened, waiting for the ones still being read.
+     */
+    static void clearPrefetched();
+
     /**
      * Determines if the file path is an absolute path for the current platform.
      * 
@@ -261,6 +377,11 @@ private:
      * Constructor.
      */
     FileSystem();
+
+    /**
+     * Opens a stream without recording it or serving it from the prefetched files.
+     */
+    static Stream* openStream(const char* path, size_t streamMode);
 };
 
 }
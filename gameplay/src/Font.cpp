@@ -10,15 +10,66 @@
 #define FONT_VSH "res/shaders/font.vert"
 #define FONT_FSH "res/shaders/font.frag"
 
+// Pixels left between glyphs in the texture, as the encoder does.
+#define FONT_GLYPH_PADDING 4
+
 namespace gameplay
 {
 
 static std::vector<Font*> __fontCache;
 
+// Decodes the UTF-8 character that starts at the given byte, or returns zero for the continuation bytes of a character.
+static unsigned int getCharacter(const char* text, unsigned int* byteCount = NULL)
+{
+    const unsigned char* bytes = (const unsigned char*)text;
+    unsigned int character = bytes[0];
+    unsigned int count = 1;
+    if ((character & 0xC0) == 0x80)
+    {
+        character = 0;
+    }
+    else if ((character & 0xE0) == 0xC0)
+    {
+        character &= 0x1F;
+        count = 2;
+    }
+    else if ((character & 0xF0) == 0xE0)
+    {
+        character &= 0x0F;
+        count = 3;
+    }
+    else if ((character & 0xF8) == 0xF0)
+    {
+        character &= 0x07;
+        count = 4;
+    }
+    else if (character >= 0x80)
+    {
+        character = 0xFFFD;
+    }
+
+    for (unsigned int i = 1; i < count; ++i)
+    {
+        if ((bytes[i] & 0xC0) != 0x80)
+        {
+            // Truncated sequence.
+            character = 0xFFFD;
+            count = i;
+            break;
+        }
+        character = (character << 6) | (bytes[i] & 0x3F);
+    }
+
+    if (byteCount)
+        *byteCount = count;
+    return character;
+}
+
 static Effect* __fontEffect = NULL;
 
 Font::Font() :
-    _format(BITMAP), _style(PLAIN), _size(0), _spacing(0.0f), _glyphs(NULL), _glyphCount(0), _texture(NULL), _batch(NULL), _cutoffParam(NULL)
+    _format(BITMAP), _style(PLAIN), _size(0), _spacing(0.0f), _layout(NULL), _rasterizer(NULL),
+    _atlasX(0), _atlasY(0), _atlasRowHeight(0), _atlasTop(0), _atlasBottom(0), _dirtyX(0), _dirtyWidth(0), _texture(NULL), _batch(NULL), _sharedBatch(false), _cutoffParam(NULL)
 {
 }
 
@@ -31,8 +82,8 @@ Font::~Font()
         __fontCache.erase(itr);
     }
 
-    SAFE_DELETE(_batch);
-    SAFE_DELETE_ARRAY(_glyphs);
+    if (!_sharedBatch)
+        SAFE_DELETE(_batch);
     SAFE_RELEASE(_texture);
 
     // Free child fonts
@@ -151,10 +202,12 @@ Font* Font::create(const char* family, Style style, unsigned int size, Glyph* gl
     font->_texture = texture;
     font->_batch = batch;
 
-    // Copy the glyphs array.
-    font->_glyphs = new Glyph[glyphCount];
-    memcpy(font->_glyphs, glyphs, sizeof(Glyph) * glyphCount);
-    font->_glyphCount = glyphCount;
+    // Copy the glyphs array and index it by character.
+    font->_glyphs.assign(glyphs, glyphs + glyphCount);
+    for (int i = 0; i < glyphCount; ++i)
+    {
+        font->setGlyphIndex(glyphs[i].code, i);
+    }
 
     return font;
 }
@@ -179,9 +232,37 @@ Font::Format Font::getFormat()
 
 bool Font::isCharacterSupported(int character) const
 {
-    // TODO: Update this once we support unicode fonts
-    int glyphIndex = character - 32; // HACK for ASCII
-    return (glyphIndex >= 0 && glyphIndex < (int)_glyphCount);
+    if (character < 0)
+        return false;
+
+    // Characters that have not been looked up yet are rasterized when they are first drawn.
+    int glyphIndex = findGlyphIndex((unsigned int)character);
+    return glyphIndex >= 0 || (glyphIndex == GLYPH_UNKNOWN && _rasterizer);
+}
+
+Font::Layout::Layout()
+    : _font(NULL), _size(0), _justify(ALIGN_TOP_LEFT), _wrap(false), _rightToLeft(false), _spacing(0.0f)
+{
+}
+
+void Font::Layout::invalidate()
+{
+    _font = NULL;
+    _quads.clear();
+}
+
+Font::GlyphRasterizer* Font::getGlyphRasterizer() const
+{
+    return _rasterizer;
+}
+
+void Font::setGlyphRasterizer(GlyphRasterizer* rasterizer)
+{
+    _rasterizer = rasterizer;
+    for (size_t i = 0, count = _sizes.size(); i < count; ++i)
+    {
+        _sizes[i]->_rasterizer = rasterizer;
+    }
 }
 
 void Font::start()
@@ -209,6 +290,13 @@ void Font::lazyStart()
 
 void Font::finish()
 {
+    // Upload the glyphs that were rasterized for the text before it is drawn.
+    updateAtlas();
+    for (size_t i = 0, count = _sizes.size(); i < count; ++i)
+    {
+        _sizes[i]->updateAtlas();
+    }
+
     // Finish any font batches that have been started
     if (_batch->isStarted())
         _batch->finish();
@@ -327,18 +415,18 @@ void Font::drawText(const char* text, int x, int y, const Vector4& color, unsign
             iteration = 1;
         }
 
-        GP_ASSERT(_glyphs);
+        GP_ASSERT(!_glyphs.empty());
         GP_ASSERT(_batch);
         for (size_t i = startIndex; i < length; i += (size_t)iteration)
         {
-            char c = 0;
+            unsigned int c = 0;
             if (rightToLeft)
             {
-                c = cursor[i];
+                c = getCharacter(cursor + i);
             }
             else
             {
-                c = text[i];
+                c = getCharacter(text + i);
             }
 
             // Draw this character.
@@ -355,11 +443,14 @@ void Font::drawText(const char* text, int x, int y, const Vector4& color, unsign
             case '\t':
                 xPos += _glyphs[0].advance * 4;
                 break;
+            case 0:
+                // Continuation bytes are part of the character that they follow.
+                break;
             default:
-                int index = c - 32; // HACK for ASCII
-                if (index >= 0 && index < (int)_glyphCount)
+                Glyph* glyph = getGlyph(c);
+                if (glyph)
                 {
-                    Glyph& g = _glyphs[index];
+                    Glyph& g = *glyph;
 
                     if (getFormat() == DISTANCE_FIELD )
                     {
@@ -385,6 +476,95 @@ void Font::drawText(const char* text, int x, int y, const Vector4& color, unsign
             done = true;
         }
     }
+
+    // Upload the glyphs rasterized for the text, since forms finish the batch without the font.
+    updateAtlas();
+}
+
+void Font::drawText(Layout* layout, const char* text, const Rectangle& area, const Vector4& color, unsigned int size, Justify justify, bool wrap, bool rightToLeft, const Rectangle& clip)
+{
+    GP_ASSERT(layout);
+    GP_ASSERT(text);
+    GP_ASSERT(_size);
+
+    if (size == 0)
+    {
+        size = _size;
+    }
+    else
+    {
+        // Delegate to closest sized font
+        Font* f = findClosestSize(size);
+        if (f != this)
+        {
+            f->drawText(layout, text, area, color, size, justify, wrap, rightToLeft, clip);
+            return;
+        }
+    }
+
+    if (layout->_font != this || layout->_text != text || layout->_area != area || layout->_size != size || layout->_justify != justify ||
+        layout->_wrap != wrap || layout->_rightToLeft != rightToLeft || layout->_clip != clip || layout->_spacing != _spacing)
+    {
+        // Lay the text out again, keeping the glyphs it draws.
+        layout->_font = this;
+        layout->_text = text;
+        layout->_area = area;
+        layout->_size = size;
+        layout->_justify = justify;
+        layout->_wrap = wrap;
+        layout->_rightToLeft = rightToLeft;
+        layout->_clip = clip;
+        layout->_spacing = _spacing;
+        layout->_quads.clear();
+
+        _layout = layout;
+        drawText(text, area, color, size, justify, wrap, rightToLeft, clip);
+        _layout = NULL;
+        return;
+    }
+
+    lazyStart();
+
+    if (getFormat() == DISTANCE_FIELD && !layout->_quads.empty())
+    {
+        if (_cutoffParam == NULL)
+            _cutoffParam = _batch->getMaterial()->getParameter("u_cutoff");
+        // TODO: Fix me so that smaller font are much smoother
+        _cutoffParam->setVector2(Vector2(1.0, 1.0));
+    }
+
+    bool clipped = clip != Rectangle(0, 0, 0, 0);
+    for (size_t i = 0, count = layout->_quads.size(); i < count; ++i)
+    {
+        const Layout::Quad& q = layout->_quads[i];
+        if (clipped)
+            _batch->draw(q.x, q.y, q.width, q.height, q.uvs[0], q.uvs[1], q.uvs[2], q.uvs[3], color, clip);
+        else
+            _batch->draw(q.x, q.y, q.width, q.height, q.uvs[0], q.uvs[1], q.uvs[2], q.uvs[3], color);
+    }
+}
+
+void Font::drawGlyph(float x, float y, float width, float height, const float* uvs, const Vector4& color, const Rectangle& clip)
+{
+    if (clip != Rectangle(0, 0, 0, 0))
+    {
+        _batch->draw(x, y, width, height, uvs[0], uvs[1], uvs[2], uvs[3], color, clip);
+    }
+    else
+    {
+        _batch->draw(x, y, width, height, uvs[0], uvs[1], uvs[2], uvs[3], color);
+    }
+
+    if (_layout)
+    {
+        Layout::Quad q;
+        q.x = x;
+        q.y = y;
+        q.width = width;
+        q.height = height;
+        memcpy(q.uvs, uvs, sizeof(q.uvs));
+        _layout->_quads.push_back(q);
+    }
 }
 
 void Font::drawText(const char* text, int x, int y, float red, float green, float blue, float alpha, unsigned int size, bool rightToLeft)
@@ -418,14 +598,16 @@ void Font::drawText(const char* text, const Rectangle& area, const Vector4& colo
     int spacing = (int)(size * _spacing);
     int yPos = area.y;
     const float areaHeight = area.height - size;
-    std::vector<int> xPositions;
-    std::vector<unsigned int> lineLengths;
+    MemoryArena* arena = MemoryArena::getScratchArena();
+    MemoryArena::Scope scope(arena);
+    PositionList xPositions(arena);
+    LengthList lineLengths(arena);
 
     getMeasurementInfo(text, area, size, justify, wrap, rightToLeft, &xPositions, &yPos, &lineLengths);
 
     // Now we have the info we need in order to render.
     int xPos = area.x;
-    std::vector<int>::const_iterator xPositionsIt = xPositions.begin();
+    PositionList::const_iterator xPositionsIt = xPositions.begin();
     if (xPositionsIt != xPositions.end())
     {
         xPos = *xPositionsIt++;
@@ -436,7 +618,7 @@ void Font::drawText(const char* text, const Rectangle& area, const Vector4& colo
     unsigned int lineLength;
     unsigned int currentLineLength = 0;
     const char* lineStart;
-    std::vector<unsigned int>::const_iterator lineLengthsIt;
+    LengthList::const_iterator lineLengthsIt;
     if (rightToLeft)
     {
         lineStart = token;
@@ -503,16 +685,17 @@ void Font::drawText(const char* text, const Rectangle& area, const Vector4& colo
             break;
         }
 
-        GP_ASSERT(_glyphs);
+        GP_ASSERT(!_glyphs.empty());
         GP_ASSERT(_batch);
         for (int i = startIndex; i < (int)tokenLength && i >= 0; i += iteration)
         {
-            char c = token[i];
-            int glyphIndex = c - 32; // HACK for ASCII
+            unsigned int byteCount = 1;
+            unsigned int c = getCharacter(token + i, &byteCount);
+            Glyph* glyph = c ? getGlyph(c) : NULL;
 
-            if (glyphIndex >= 0 && glyphIndex < (int)_glyphCount)
+            if (glyph)
             {
-                Glyph& g = _glyphs[glyphIndex];
+                Glyph& g = *glyph;
 
                 if (xPos + (int)(g.advance*scale) > area.x + area.width)
                 {
@@ -532,14 +715,7 @@ void Font::drawText(const char* text, const Rectangle& area, const Vector4& colo
                             // TODO: Fix me so that smaller font are much smoother
                             _cutoffParam->setVector2(Vector2(1.0, 1.0));
                         }
-                        if (clip != Rectangle(0, 0, 0, 0))
-                        {
-                            _batch->draw(xPos + (int)(g.bearingX * scale), yPos, g.width * scale, size, g.uvs[0], g.uvs[1], g.uvs[2], g.uvs[3], color, clip);
-                        }
-                        else
-                        {
-                            _batch->draw(xPos + (int)(g.bearingX * scale), yPos, g.width * scale, size, g.uvs[0], g.uvs[1], g.uvs[2], g.uvs[3], color);
-                        }
+                        drawGlyph(xPos + (int)(g.bearingX * scale), yPos, g.width * scale, size, g.uvs, color, clip);
                     }
                 }
                 xPos += (int)(g.advance)*scale + spacing;
@@ -608,6 +784,9 @@ void Font::drawText(const char* text, const Rectangle& area, const Vector4& colo
             }
         }
     }
+
+    // Upload the glyphs rasterized for the text, since forms finish the batch without the font.
+    updateAtlas();
 }
 
 void Font::measureText(const char* text, unsigned int size, unsigned int* width, unsigned int* height)
@@ -707,8 +886,10 @@ void Font::measureText(const char* text, const Rectangle& clip, unsigned int siz
     }
 
     const char* token = text;
-    std::vector<bool> emptyLines;
-    std::vector<Vector2> lines;
+    MemoryArena* arena = MemoryArena::getScratchArena();
+    MemoryArena::Scope scope(arena);
+    std::vector<bool, MemoryArenaAllocator<bool> > emptyLines(arena);
+    std::vector<Vector2, MemoryArenaAllocator<Vector2> > lines(arena);
 
     unsigned int lineWidth = 0;
     int yPos = clip.y + size;
@@ -1013,7 +1194,7 @@ void Font::measureText(const char* text, const Rectangle& clip, unsigned int siz
 }
 
 void Font::getMeasurementInfo(const char* text, const Rectangle& area, unsigned int size, Justify justify, bool wrap, bool rightToLeft,
-        std::vector<int>* xPositions, int* yPosition, std::vector<unsigned int>* lineLengths)
+        PositionList* xPositions, int* yPosition, LengthList* lineLengths)
 {
     GP_ASSERT(_size);
     GP_ASSERT(text);
@@ -1249,13 +1430,15 @@ int Font::getIndexOrLocation(const char* text, const Rectangle& area, unsigned i
     int spacing = (int)(size * _spacing);
     int yPos = area.y;
     const float areaHeight = area.height - size;
-    std::vector<int> xPositions;
-    std::vector<unsigned int> lineLengths;
+    MemoryArena* arena = MemoryArena::getScratchArena();
+    MemoryArena::Scope scope(arena);
+    PositionList xPositions(arena);
+    LengthList lineLengths(arena);
 
     getMeasurementInfo(text, area, size, justify, wrap, rightToLeft, &xPositions, &yPos, &lineLengths);
 
     int xPos = area.x;
-    std::vector<int>::const_iterator xPositionsIt = xPositions.begin();
+    PositionList::const_iterator xPositionsIt = xPositions.begin();
     if (xPositionsIt != xPositions.end())
     {
         xPos = *xPositionsIt++;
@@ -1267,7 +1450,7 @@ int Font::getIndexOrLocation(const char* text, const Rectangle& area, unsigned i
     unsigned int lineLength;
     unsigned int currentLineLength = 0;
     const char* lineStart;
-    std::vector<unsigned int>::const_iterator lineLengthsIt;
+    LengthList::const_iterator lineLengthsIt;
     if (rightToLeft)
     {
         lineStart = token;
@@ -1353,15 +1536,16 @@ int Font::getIndexOrLocation(const char* text, const Rectangle& area, unsigned i
             break;
         }
 
-        GP_ASSERT(_glyphs);
+        GP_ASSERT(!_glyphs.empty());
         for (int i = startIndex; i < (int)tokenLength && i >= 0; i += iteration)
         {
-            char c = token[i];
-            int glyphIndex = c - 32; // HACK for ASCII
+            unsigned int byteCount = 1;
+            unsigned int c = getCharacter(token + i, &byteCount);
+            Glyph* glyph = c ? getGlyph(c) : NULL;
 
-            if (glyphIndex >= 0 && glyphIndex < (int)_glyphCount)
+            if (glyph)
             {
-                Glyph& g = _glyphs[glyphIndex];
+                Glyph& g = *glyph;
 
                 if (xPos + (int)(g.advance*scale) > area.x + area.width)
                 {
@@ -1384,7 +1568,7 @@ int Font::getIndexOrLocation(const char* text, const Rectangle& area, unsigned i
                 }
 
                 xPos += floor(g.advance*scale + spacing);
-                charIndex++;
+                charIndex += byteCount;
             }
         }
 
@@ -1471,7 +1655,7 @@ int Font::getIndexOrLocation(const char* text, const Rectangle& area, unsigned i
 unsigned int Font::getTokenWidth(const char* token, unsigned int length, unsigned int size, float scale)
 {
     GP_ASSERT(token);
-    GP_ASSERT(_glyphs);
+    GP_ASSERT(!_glyphs.empty());
 
     if (size == 0)
         size = _size;
@@ -1482,7 +1666,7 @@ unsigned int Font::getTokenWidth(const char* token, unsigned int length, unsigne
     unsigned int tokenWidth = 0;
     for (unsigned int i = 0; i < length; ++i)
     {
-        char c = token[i];
+        unsigned int c = getCharacter(token + i);
         switch (c)
         {
         case ' ':
@@ -1491,12 +1675,14 @@ unsigned int Font::getTokenWidth(const char* token, unsigned int length, unsigne
         case '\t':
             tokenWidth += _glyphs[0].advance * 4;
             break;
+        case 0:
+            // Continuation bytes are part of the character that they follow.
+            break;
         default:
-            int glyphIndex = c - 32;
-            if (glyphIndex >= 0 && glyphIndex < (int)_glyphCount)
+            Glyph* glyph = getGlyph(c);
+            if (glyph)
             {
-                Glyph& g = _glyphs[glyphIndex];
-                tokenWidth += floor(g.advance * scale + spacing);
+                tokenWidth += floor(glyph->advance * scale + spacing);
             }
             break;
         }
@@ -1530,7 +1716,7 @@ unsigned int Font::getReversedTokenLength(const char* token, const char* bufStar
 }
 
 int Font::handleDelimiters(const char** token, const unsigned int size, const int iteration, const int areaX, int* xPos, int* yPos, unsigned int* lineLength,
-                          std::vector<int>::const_iterator* xPositionsIt, std::vector<int>::const_iterator xPositionsEnd, unsigned int* charIndex,
+                          PositionList::const_iterator* xPositionsIt, PositionList::const_iterator xPositionsEnd, unsigned int* charIndex,
                           const Vector2* stopAtPosition, const int currentIndex, const int destIndex)
 {
     GP_ASSERT(token);
@@ -1613,7 +1799,7 @@ int Font::handleDelimiters(const char** token, const unsigned int size, const in
 }
 
 void Font::addLineInfo(const Rectangle& area, int lineWidth, int lineLength, Justify hAlign,
-                       std::vector<int>* xPositions, std::vector<unsigned int>* lineLengths, bool rightToLeft)
+                       PositionList* xPositions, LengthList* lineLengths, bool rightToLeft)
 {
     int hWhitespace = area.width - lineWidth;
     if (hAlign == ALIGN_HCENTER)
@@ -1719,4 +1905,150 @@ Font::Justify Font::getJustify(const char* justify)
     return Font::ALIGN_TOP_LEFT;
 }
 
+Font::Glyph* Font::getGlyph(unsigned int character)
+{
+    int glyphIndex = findGlyphIndex(character);
+    if (glyphIndex == GLYPH_UNKNOWN && _rasterizer)
+        glyphIndex = addGlyph(character);
+    return glyphIndex >= 0 ? &_glyphs[glyphIndex] : NULL;
+}
+
+int Font::findGlyphIndex(unsigned int character) const
+{
+    if (character < 0x10000)
+    {
+        const std::vector<int>& page = _glyphPages[character >> 8];
+        return page.empty() ? GLYPH_UNKNOWN : page[character & 0xFF];
+    }
+
+    std::unordered_map<unsigned int, int>::const_iterator itr = _supplementaryGlyphs.find(character);
+    return itr == _supplementaryGlyphs.end() ? GLYPH_UNKNOWN : itr->second;
+}
+
+void Font::setGlyphIndex(unsigned int character, int index)
+{
+    if (character < 0x10000)
+    {
+        std::vector<int>& page = _glyphPages[character >> 8];
+        if (page.empty())
+            page.resize(256, GLYPH_UNKNOWN);
+        page[character & 0xFF] = index;
+    }
+    else
+    {
+        _supplementaryGlyphs[character] = index;
+    }
+}
+
+int Font::addGlyph(unsigned int character)
+{
+    GP_ASSERT(_rasterizer);
+    GP_ASSERT(_texture);
+
+    unsigned int textureWidth = _texture->getWidth();
+    unsigned int textureHeight = _texture->getHeight();
+    if (_atlasRowHeight == 0)
+    {
+        // Continue packing after the last of the glyphs that the font was encoded with, in rows of the same height.
+        _atlasRowHeight = _size;
+        _atlasX = 1;
+        _atlasY = _atlasTop;
+        if (!_glyphs.empty())
+        {
+            _atlasRowHeight = (unsigned int)((_glyphs[0].uvs[3] - _glyphs[0].uvs[1]) * textureHeight + 0.5f);
+            float rowTop = 0.0f;
+            float rowRight = 0.0f;
+            for (size_t i = 0, count = _glyphs.size(); i < count; ++i)
+            {
+                const Glyph& g = _glyphs[i];
+                if (g.uvs[1] > rowTop)
+                {
+                    rowTop = g.uvs[1];
+                    rowRight = 0.0f;
+                }
+                if (g.uvs[1] == rowTop)
+                    rowRight = std::max(rowRight, g.uvs[2]);
+            }
+            _atlasX = (unsigned int)(rowRight * textureWidth + 0.5f) + FONT_GLYPH_PADDING;
+            _atlasY = (unsigned int)(rowTop * textureHeight + 0.5f);
+        }
+    }
+
+    std::vector<unsigned char> pixels;
+    unsigned int width = 0;
+    int bearingX = 0;
+    unsigned int advance = 0;
+    if (!_rasterizer->rasterizeGlyph(this, character, _atlasRowHeight, &pixels, &width, &bearingX, &advance) ||
+        pixels.size() < width * _atlasRowHeight)
+    {
+        setGlyphIndex(character, GLYPH_MISSING);
+        return GLYPH_MISSING;
+    }
+
+    // Move on to the next row when the glyph does not fit in the current one.
+    if (_atlasX + width > textureWidth)
+    {
+        updateAtlas();
+        _atlasX = 1;
+        _atlasY += _atlasRowHeight + FONT_GLYPH_PADDING;
+    }
+    unsigned int atlasBottom = _atlasBottom ? _atlasBottom : textureHeight;
+    if (_atlasX + width > textureWidth || _atlasY + _atlasRowHeight > atlasBottom)
+    {
+        GP_WARN("No room left in the texture of font '%s' for character %u.", _family.c_str(), character);
+        setGlyphIndex(character, GLYPH_MISSING);
+        return GLYPH_MISSING;
+    }
+
+    // Copy the glyph into the dirty region of the row, which is uploaded when the text is drawn.
+    if (_dirtyPixels.empty())
+    {
+        _dirtyPixels.resize(textureWidth * _atlasRowHeight, 0);
+        _dirtyX = _atlasX;
+    }
+    for (unsigned int y = 0; y < _atlasRowHeight; ++y)
+    {
+        memcpy(&_dirtyPixels[y * textureWidth + _atlasX], &pixels[y * width], width);
+    }
+    _dirtyWidth = _atlasX + width - _dirtyX;
+
+    Glyph glyph;
+    glyph.code = character;
+    glyph.width = width;
+    glyph.bearingX = bearingX;
+    glyph.advance = advance;
+    glyph.uvs[0] = (float)_atlasX / (float)textureWidth;
+    glyph.uvs[1] = (float)_atlasY / (float)textureHeight;
+    glyph.uvs[2] = (float)(_atlasX + width) / (float)textureWidth;
+    glyph.uvs[3] = (float)(_atlasY + _atlasRowHeight) / (float)textureHeight;
+    _atlasX += width + FONT_GLYPH_PADDING;
+
+    int glyphIndex = (int)_glyphs.size();
+    _glyphs.push_back(glyph);
+    setGlyphIndex(character, glyphIndex);
+    return glyphIndex;
+}
+
+void Font::updateAtlas()
+{
+    if (_dirtyPixels.empty())
+        return;
+
+    GP_ASSERT(_texture);
+    unsigned int textureWidth = _texture->getWidth();
+    if (_dirtyWidth > 0)
+    {
+        // Pack the dirty region of the row tightly for the upload.
+        std::vector<unsigned char> region(_dirtyWidth * _atlasRowHeight);
+        for (unsigned int y = 0; y < _atlasRowHeight; ++y)
+        {
+            memcpy(&region[y * _dirtyWidth], &_dirtyPixels[y * textureWidth + _dirtyX], _dirtyWidth);
+        }
+        _texture->setData(&region[0], _dirtyX, _atlasY, _dirtyWidth, _atlasRowHeight);
+    }
+
+    _dirtyPixels.clear();
+    _dirtyWidth = 0;
+}
+
 }
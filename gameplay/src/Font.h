@@ -2,6 +2,7 @@
 #define FONT_H_
 
 #include "SpriteBatch.h"
+#include "MemoryArena.h"
 
 namespace gameplay
 {
@@ -59,6 +60,93 @@ public:
         DISTANCE_FIELD = 1
     };
 
+    /**
+     * Defines the layout of a text drawn within an area.
+     *
+     * Drawing a text with a layout keeps the positions of its glyphs, so that drawing it again
+     * with the same text, area, size, justification, wrapping and clip only draws the glyphs
+     * again instead of wrapping, justifying and looking up the text. The color can change
+     * without laying the text out again.
+     *
+     * @script{ignore}
+     */
+    class Layout
+    {
+        friend class Font;
+
+    public:
+
+        /**
+         * Constructor.
+         */
+        Layout();
+
+        /**
+         * Discards the layout so that the next draw lays the text out again.
+         */
+        void invalidate();
+
+    private:
+
+        struct Quad
+        {
+            float x;
+            float y;
+            float width;
+            float height;
+            float uvs[4];
+        };
+
+        Font* _font;
+        std::string _text;
+        Rectangle _area;
+        unsigned int _size;
+        Justify _justify;
+        bool _wrap;
+        bool _rightToLeft;
+        Rectangle _clip;
+        float _spacing;
+        std::vector<Quad> _quads;
+    };
+
+    /**
+     * Defines an interface for rasterizing the glyphs that are missing from a font.
+     *
+     * Fonts only hold the glyphs that were encoded into their bundle. A font with a glyph
+     * rasterizer asks it for any other character the first time the character is drawn or
+     * measured, and packs the result into the free space of its texture.
+     *
+     * @script{ignore}
+     */
+    class GlyphRasterizer
+    {
+    public:
+
+        /**
+         * Destructor.
+         */
+        virtual ~GlyphRasterizer() { }
+
+        /**
+         * Rasterizes a glyph for a font.
+         *
+         * The pixels are 8-bit coverage values, or distances for fonts in the DISTANCE_FIELD
+         * format, stored tightly packed and top row first.
+         *
+         * @param font The font that the glyph is missing from.
+         * @param character The Unicode code point of the character.
+         * @param height The height of the glyph in pixels, which matches the other glyphs of the font.
+         * @param pixels Filled with width * height pixels of the glyph.
+         * @param width Set to the width of the glyph in pixels.
+         * @param bearingX Set to the left side bearing of the glyph in pixels.
+         * @param advance Set to the horizontal advance of the glyph in pixels.
+         *
+         * @return true if the glyph was rasterized, false if the character cannot be drawn.
+         */
+        virtual bool rasterizeGlyph(const Font* font, unsigned int character, unsigned int height,
+                                    std::vector<unsigned char>* pixels, unsigned int* width, int* bearingX, unsigned int* advance) = 0;
+    };
+
     /**
      * Creates a font from the given bundle.
      *
@@ -101,11 +189,27 @@ public:
     /**
      * Determines if this font supports the specified character code.
      *
-     * @param character The character code to check.
+     * @param character The Unicode code point to check.
      * @return True if this Font supports (can draw) the specified character, false otherwise.
      */
     bool isCharacterSupported(int character) const;
 
+    /**
+     * Gets the rasterizer for the glyphs that are missing from this font.
+     *
+     * @return The glyph rasterizer, or NULL if the font only draws the glyphs it was encoded with.
+     */
+    GlyphRasterizer* getGlyphRasterizer() const;
+
+    /**
+     * Sets the rasterizer for the glyphs that are missing from this font and its other sizes.
+     *
+     * The rasterizer is not owned by the font and must outlive it.
+     *
+     * @param rasterizer The glyph rasterizer, or NULL to only draw the glyphs the font was encoded with.
+     */
+    void setGlyphRasterizer(GlyphRasterizer* rasterizer);
+
     /**
      * Starts text drawing for this font.
      */
@@ -157,6 +261,25 @@ public:
                   Justify justify = ALIGN_TOP_LEFT, bool wrap = true, bool rightToLeft = false,
                   const Rectangle& clip = Rectangle(0, 0, 0, 0));
 
+    /**
+     * Draws the specified text within a rectangular area, reusing the given layout while the text and its placement do not change.
+     *
+     * @param layout The layout of the text, which is laid out again when any of the other parameters but the color change.
+     * @param text The text to draw.
+     * @param area The viewport area to draw within.  Text will be clipped outside this rectangle.
+     * @param color The color of text.
+     * @param size The size to draw text (0 for default size).
+     * @param justify Justification of text within the viewport.
+     * @param wrap Wraps text to fit within the width of the viewport if true.
+     * @param rightToLeft Whether to draw text from right to left.
+     * @param clip A region to clip text within after applying justification to the viewport area.
+     *
+     * @script{ignore}
+     */
+    void drawText(Layout* layout, const char* text, const Rectangle& area, const Vector4& color, unsigned int size = 0,
+                  Justify justify = ALIGN_TOP_LEFT, bool wrap = true, bool rightToLeft = false,
+                  const Rectangle& clip = Rectangle(0, 0, 0, 0));
+
     /**
      * Finishes text batching for this font and renders all drawn text.
      */
@@ -312,8 +435,12 @@ private:
      */
     static Font* create(const char* family, Style style, unsigned int size, Glyph* glyphs, int glyphCount, Texture* texture, Font::Format format);
 
+    // Layout information of the lines of a text, allocated from the scratch arena of the thread.
+    typedef std::vector<int, MemoryArenaAllocator<int> > PositionList;
+    typedef std::vector<unsigned int, MemoryArenaAllocator<unsigned int> > LengthList;
+
     void getMeasurementInfo(const char* text, const Rectangle& area, unsigned int size, Justify justify, bool wrap, bool rightToLeft,
-                            std::vector<int>* xPositions, int* yPosition, std::vector<unsigned int>* lineLengths);
+                            PositionList* xPositions, int* yPosition, LengthList* lineLengths);
 
     int getIndexOrLocation(const char* text, const Rectangle& clip, unsigned int size, const Vector2& inLocation, Vector2* outLocation,
                            const int destIndex = -1, Justify justify = ALIGN_TOP_LEFT, bool wrap = true, bool rightToLeft = false);
@@ -323,16 +450,47 @@ private:
     unsigned int getReversedTokenLength(const char* token, const char* bufStart);
 
     int handleDelimiters(const char** token, const unsigned int size, const int iteration, const int areaX, int* xPos, int* yPos, unsigned int* lineLength,
-                         std::vector<int>::const_iterator* xPositionsIt, std::vector<int>::const_iterator xPositionsEnd, unsigned int* charIndex = NULL,
+                         PositionList::const_iterator* xPositionsIt, PositionList::const_iterator xPositionsEnd, unsigned int* charIndex = NULL,
                          const Vector2* stopAtPosition = NULL, const int currentIndex = -1, const int destIndex = -1);
 
     void addLineInfo(const Rectangle& area, int lineWidth, int lineLength, Justify hAlign,
-                     std::vector<int>* xPositions, std::vector<unsigned int>* lineLengths, bool rightToLeft);
+                     PositionList* xPositions, LengthList* lineLengths, bool rightToLeft);
 
     Font* findClosestSize(int size);
 
+    /**
+     * Gets the glyph for a Unicode code point, rasterizing it if it is missing and the font has a glyph rasterizer.
+     *
+     * @return The glyph, or NULL if the font cannot draw the character.
+     */
+    Glyph* getGlyph(unsigned int character);
+
+    /**
+     * Gets the index of the glyph for a Unicode code point, or GLYPH_UNKNOWN if it has not been looked up.
+     */
+    int findGlyphIndex(unsigned int character) const;
+
+    void setGlyphIndex(unsigned int character, int index);
+
+    /**
+     * Rasterizes a missing glyph and packs it into the texture after the glyphs already in it.
+     *
+     * @return The index of the new glyph, or GLYPH_MISSING if it could not be added.
+     */
+    int addGlyph(unsigned int character);
+
+    /**
+     * Uploads the region of the texture that holds the glyphs rasterized since the last upload.
+     */
+    void updateAtlas();
+
     void lazyStart();
 
+    /**
+     * Draws a glyph of the text being drawn, and adds it to the layout being built if there is one.
+     */
+    void drawGlyph(float x, float y, float width, float height, const float* uvs, const Vector4& color, const Rectangle& clip);
+
     Format _format;
     std::string _path;
     std::string _id;
@@ -341,10 +499,28 @@ private:
     unsigned int _size;
     std::vector<Font*> _sizes; // stores additional font sizes of the same family
     float _spacing;
-    Glyph* _glyphs;
-    unsigned int _glyphCount;
+    enum
+    {
+        GLYPH_UNKNOWN = -1,
+        GLYPH_MISSING = -2
+    };
+
+    Layout* _layout; // the layout being built by the text being drawn
+    std::vector<Glyph> _glyphs;
+    std::vector<int> _glyphPages[256]; // glyph indices of the basic multilingual plane, by pages of 256 code points
+    std::unordered_map<unsigned int, int> _supplementaryGlyphs;
+    GlyphRasterizer* _rasterizer;
+    unsigned int _atlasX;
+    unsigned int _atlasY;
+    unsigned int _atlasRowHeight;
+    unsigned int _atlasTop;
+    unsigned int _atlasBottom; // end of the rows of the texture that belong to this font, or zero for all of them
+    unsigned int _dirtyX;
+    unsigned int _dirtyWidth;
+    std::vector<unsigned char> _dirtyPixels;
     Texture* _texture;
     SpriteBatch* _batch;
+    bool _sharedBatch; // batch owned by the master font, when the sizes share an atlas
     Rectangle _viewport;
     MaterialParameter* _cutoffParam;
 };
@@ -16,6 +16,11 @@ static const float GAMEPAD_SCROLL_SPEED = 600.0f;
 static const float JOYSTICK_THRESHOLD = 0.75f;
 // If the DPad or joystick is held down, this is the initial delay in milliseconds between focus changes.
 static const float GAMEPAD_FOCUS_REPEAT_DELAY = 300.0f;
+// Number of unused cache frame buffers kept around for reuse by cached forms.
+static const unsigned int FORM_CACHE_POOL_SIZE = 4;
+// Preferred size in pixels of the cells of the grid used for input hit testing, and the maximum number of cells per axis.
+static const float FORM_HIT_CELL_SIZE = 64.0f;
+static const unsigned int FORM_HIT_MAX_CELLS = 32;
 
 // Shaders used for drawing offscreen quad when form is attached to a node
 #define FORM_VSH "res/shaders/sprite.vert"
@@ -28,6 +33,10 @@ static std::vector<Form*> __forms;
 static Control* __focusControl = NULL;
 static Control* __activeControl[Touch::MAX_TOUCH_POINTS];
 static bool __shiftKeyDown = false;
+static std::vector<FrameBuffer*> __cachePool;
+static unsigned int __drawDepth = 0;
+static std::vector<SpriteBatch*> __drawBatches;
+static unsigned int __cacheBufferCount = 0;
 
 /**
  * Static initializer for forms.
@@ -42,22 +51,64 @@ struct FormInit
 };
 static FormInit __init;
 
-Form::Form() : Drawable(), _batched(true)
+static FrameBuffer* acquireCacheBuffer(unsigned int width, unsigned int height)
+{
+    // Reuse a pooled frame buffer of the same size before creating a new one.
+    for (size_t i = 0, size = __cachePool.size(); i < size; ++i)
+    {
+        FrameBuffer* frameBuffer = __cachePool[i];
+        if (frameBuffer->getWidth() == width && frameBuffer->getHeight() == height)
+        {
+            __cachePool.erase(__cachePool.begin() + i);
+            return frameBuffer;
+        }
+    }
+
+    char id[32];
+    sprintf(id, "__formCache%u", __cacheBufferCount++);
+    return FrameBuffer::create(id, width, height);
+}
+
+static void releaseCacheBuffer(FrameBuffer* frameBuffer)
+{
+    __cachePool.push_back(frameBuffer);
+    if (__cachePool.size() > FORM_CACHE_POOL_SIZE)
+    {
+        SAFE_RELEASE(__cachePool.front());
+        __cachePool.erase(__cachePool.begin());
+    }
+}
+
+Form::Form() : Drawable(), _batched(true), _cached(false), _cacheBuffer(NULL), _cacheBatch(NULL),
+    _hitCellSize(FORM_HIT_CELL_SIZE), _hitColumns(0), _hitRows(0), _hitGridDirty(true)
 {
 }
 
 Form::~Form()
 {
+    SAFE_DELETE(_cacheBatch);
+    if (_cacheBuffer)
+        releaseCacheBuffer(_cacheBuffer);
+
     // Remove this Form from the global list.
     std::vector<Form*>::iterator it = std::find(__forms.begin(), __forms.end(), this);
     if (it != __forms.end())
     {
         __forms.erase(it);
     }
+
+    // Release pooled cache buffers once the last form is gone.
+    if (__forms.empty())
+    {
+        for (size_t i = 0, size = __cachePool.size(); i < size; ++i)
+            SAFE_RELEASE(__cachePool[i]);
+        __cachePool.clear();
+    }
 }
 
 Form* Form::create(const char* url)
 {
+    GP_MEMORY_TAG(MEMORY_TAG_UI);
     Form* form = new Form();
 
     // Load Form from .form file.
@@ -102,6 +153,7 @@ Form* Form::create(const char* url)
     }
 
     form->_batched = formProperties->getBool("batchingEnabled", true);
+    form->_cached = formProperties->getBool("cached", false);
 
     // Initialize the form and all of its child controls
     form->initialize("Form", style, formProperties);
@@ -135,7 +187,10 @@ void Form::initialize(const char* typeName, Theme::Style* style, Properties* pro
     // After creation, update our bounds once so code that runs immediately after form
     // creation has access to up-to-date bounds.
     if (updateBoundsInternal(Vector2::zero()))
+    {
+        _hitGridDirty = true;
         updateBoundsInternal(Vector2::zero());
+    }
 }
 
 Form* Form::getForm(const char* id)
@@ -204,7 +259,10 @@ void Form::update(float elapsedTime)
     //  1. First pass updates leaf controls
     //  2. Second pass updates parent controls that depend on child sizes
     if (updateBoundsInternal(Vector2::zero()))
+    {
+        _hitGridDirty = true;
         updateBoundsInternal(Vector2::zero());
+    }
 }
 
 void Form::startBatch(SpriteBatch* batch)
@@ -238,6 +296,8 @@ unsigned int Form::draw(bool wireframe)
     if (!_visible || _absoluteClipBounds.width == 0 || _absoluteClipBounds.height == 0)
         return 0;
 
+    GP_PROFILE_GPU_SCOPE("Form::draw");
+
     Game* game = Game::getInstance();
     Rectangle viewport = game->getViewport();
 
@@ -261,9 +321,28 @@ unsigned int Form::draw(bool wireframe)
         Matrix::createOrthographicOffCenter(0, viewport.width, viewport.height, 0, 0, 1, &_projectionMatrix);
     }
 
+    // Batches left pending by other forms were started with a different projection than a form
+    // drawn in 3D or into its cache uses, so they have to be flushed first.
+    unsigned int flushedDrawCalls = 0;
+    bool deferred = _batched && !_cached && !_node && __drawDepth > 0;
+    if (!deferred)
+        flushedDrawCalls = flushDrawBatches();
+
+    if (_cached)
+        return flushedDrawCalls + drawCache();
+
     // Draw the form
     unsigned int drawCalls = Container::draw(this, _absoluteClipBounds);
 
+    // Leave the batches to be flushed with those of the other forms of the group
+    if (deferred)
+    {
+        for (size_t i = 0, count = _batches.size(); i < count; ++i)
+            __drawBatches.push_back(_batches[i]);
+        _batches.clear();
+        return 0;
+    }
+
     // Flush all batches that were queued during drawing and then empty the batch list
     if (_batched)
     {
@@ -273,7 +352,7 @@ unsigned int Form::draw(bool wireframe)
         _batches.clear();
         drawCalls = batchCount;
     }
-    return drawCalls;
+    return flushedDrawCalls + drawCalls;
 }
 
 Drawable* Form::clone(NodeCloneContext& context)
@@ -292,8 +371,150 @@ void Form::setBatchingEnabled(bool enabled)
     _batched = enabled;
 }
 
+bool Form::isCached() const
+{
+    return _cached;
+}
+
+void Form::setCached(bool cached)
+{
+    if (_cached == cached)
+        return;
+
+    _cached = cached;
+    if (_cached)
+    {
+        invalidate();
+    }
+    else
+    {
+        SAFE_DELETE(_cacheBatch);
+        if (_cacheBuffer)
+        {
+            releaseCacheBuffer(_cacheBuffer);
+            _cacheBuffer = NULL;
+        }
+    }
+}
+
+void Form::invalidate()
+{
+    invalidate(_absoluteClipBounds);
+}
+
+void Form::invalidate(const Rectangle& region)
+{
+    if (!_cached || region.isEmpty())
+        return;
+
+    if (_cacheRegion.isEmpty())
+        _cacheRegion = region;
+    else
+        Rectangle::combine(_cacheRegion, region, &_cacheRegion);
+}
+
+void Form::beginDraw()
+{
+    ++__drawDepth;
+}
+
+unsigned int Form::endDraw()
+{
+    GP_ASSERT(__drawDepth > 0);
+
+    if (__drawDepth == 0 || --__drawDepth > 0)
+        return 0;
+
+    return flushDrawBatches();
+}
+
+unsigned int Form::flushDrawBatches()
+{
+    unsigned int batchCount = __drawBatches.size();
+    for (unsigned int i = 0; i < batchCount; ++i)
+        __drawBatches[i]->finish();
+    __drawBatches.clear();
+    return batchCount;
+}
+
+unsigned int Form::drawCache()
+{
+    const Rectangle& bounds = _absoluteClipBounds;
+    unsigned int width = (unsigned int)ceil(bounds.width);
+    unsigned int height = (unsigned int)ceil(bounds.height);
+
+    // Swap in a pooled frame buffer of the new size when the form is resized.
+    if (_cacheBuffer && (_cacheBuffer->getWidth() != width || _cacheBuffer->getHeight() != height))
+    {
+        SAFE_DELETE(_cacheBatch);
+        releaseCacheBuffer(_cacheBuffer);
+        _cacheBuffer = NULL;
+    }
+    if (!_cacheBuffer)
+    {
+        _cacheBuffer = acquireCacheBuffer(width, height);
+        if (!_cacheBuffer)
+        {
+            GP_WARN("Failed to create cache frame buffer for form '%s'; drawing it uncached.", _id.c_str());
+            _cached = false;
+            return draw();
+        }
+        _cacheBatch = SpriteBatch::create(_cacheBuffer->getRenderTarget()->getTexture());
+        _cacheBatch->getSampler()->setWrapMode(Texture::CLAMP, Texture::CLAMP);
+        _cacheBatch->getSampler()->setFilterMode(Texture::NEAREST, Texture::NEAREST);
+        _cacheRegion = bounds;
+    }
+
+    unsigned int drawCalls = 0;
+    Rectangle region;
+    if (Rectangle::intersect(_cacheRegion, bounds, &region) && !region.isEmpty())
+    {
+        Game* game = Game::getInstance();
+        Rectangle viewport = game->getViewport();
+        FrameBuffer* previousFrameBuffer = _cacheBuffer->bind();
+        game->setViewport(Rectangle(0, 0, width, height));
+
+        // Only clear and redraw the dirty region of the cache, children outside of it are skipped.
+        Matrix projection(_projectionMatrix);
+        Matrix::createOrthographicOffCenter(bounds.x, bounds.x + width, bounds.y + height, bounds.y, 0, 1, &_projectionMatrix);
+        int left = (int)floor(region.x - bounds.x);
+        int bottom = (int)floor(bounds.bottom() - region.bottom());
+        GL_ASSERT( glEnable(GL_SCISSOR_TEST) );
+        GL_ASSERT( glScissor(left, bottom, (int)ceil(region.right() - bounds.x) - left, (int)ceil(bounds.bottom() - region.y) - bottom) );
+        game->clear(Game::CLEAR_COLOR, Vector4::zero(), 1, 0);
+
+        _redrawRegion = region;
+        drawCalls = Container::draw(this, bounds);
+        if (_batched)
+        {
+            unsigned int batchCount = _batches.size();
+            for (unsigned int i = 0; i < batchCount; ++i)
+                _batches[i]->finish();
+            _batches.clear();
+            drawCalls = batchCount;
+        }
+        _redrawRegion = Rectangle::empty();
+
+        GL_ASSERT( glDisable(GL_SCISSOR_TEST) );
+        previousFrameBuffer->bind();
+        game->setViewport(viewport);
+        _projectionMatrix = projection;
+    }
+    _cacheRegion = Rectangle::empty();
+
+    // Draw the cached texture over the form's bounds.
+    _cacheBatch->setProjectionMatrix(_projectionMatrix);
+    _cacheBatch->start();
+    _cacheBatch->draw(bounds.x, bounds.y, width, height, 0.0f, 1.0f, 1.0f, 0.0f, Vector4::one());
+    _cacheBatch->finish();
+
+    return drawCalls + 1;
+}
+
 void Form::updateInternal(float elapsedTime)
 {
+    GP_PROFILE_SCOPE("Form::updateInternal");
+
     pollGamepads();
 
     for (size_t i = 0, size = __forms.size(); i < size; ++i)
@@ -349,7 +570,7 @@ Control* Form::findInputControl(int* x, int* y, bool focus, unsigned int contact
             continue;
 
         // Search for an input control within this form
-        Control* ctrl = findInputControl(form, formX, formY, focus, contactIndex);
+        Control* ctrl = form->findHitControl(formX, formY, focus);
         if (ctrl)
         {
             *x = formX;
@@ -397,6 +618,83 @@ Control* Form::findInputControl(Control* control, int x, int y, bool focus, unsi
     return result;
 }
 
+Control* Form::findHitControl(int x, int y, bool focus)
+{
+    if (!(_visible && isEnabled()))
+        return NULL;
+
+    if (_hitGridDirty)
+        buildHitGrid();
+
+    if (!_hitBounds.contains(x, y))
+        return NULL;
+
+    unsigned int column = std::min((unsigned int)((x - _hitBounds.x) / _hitCellSize), _hitColumns - 1);
+    unsigned int row = std::min((unsigned int)((y - _hitBounds.y) / _hitCellSize), _hitRows - 1);
+    const std::vector<unsigned int>& cell = _hitCells[row * _hitColumns + column];
+
+    // The tree walk picks the last matching control in traversal order, so search the cell backwards.
+    for (std::vector<unsigned int>::const_reverse_iterator itr = cell.rbegin(); itr != cell.rend(); ++itr)
+    {
+        Control* control = _hitControls[*itr];
+        if (!control->_consumeInputEvents || (focus && !control->canFocus()) || !control->_absoluteClipBounds.contains(x, y))
+            continue;
+
+        // Controls inside hidden or disabled containers cannot receive input.
+        bool reachable = true;
+        for (Control* c = control; c != this && reachable; c = c->_parent)
+            reachable = c->_visible && c->isEnabled();
+        if (reachable)
+            return control;
+    }
+
+    return NULL;
+}
+
+void Form::buildHitGrid()
+{
+    _hitGridDirty = false;
+    _hitControls.clear();
+    addHitControl(this);
+
+    // Cover the form with square cells, growing them when the form is too large for the maximum cell count.
+    _hitBounds = _absoluteClipBounds;
+    _hitCellSize = std::max(FORM_HIT_CELL_SIZE, std::max(_hitBounds.width, _hitBounds.height) / FORM_HIT_MAX_CELLS);
+    _hitColumns = std::max(1u, (unsigned int)ceil(_hitBounds.width / _hitCellSize));
+    _hitRows = std::max(1u, (unsigned int)ceil(_hitBounds.height / _hitCellSize));
+    _hitCells.resize(_hitColumns * _hitRows);
+    for (size_t i = 0, count = _hitCells.size(); i < count; ++i)
+        _hitCells[i].clear();
+
+    for (unsigned int i = 0, count = (unsigned int)_hitControls.size(); i < count; ++i)
+    {
+        Rectangle bounds;
+        if (!Rectangle::intersect(_hitControls[i]->_absoluteClipBounds, _hitBounds, &bounds))
+            continue;
+
+        unsigned int left = std::min((unsigned int)((bounds.x - _hitBounds.x) / _hitCellSize), _hitColumns - 1);
+        unsigned int top = std::min((unsigned int)((bounds.y - _hitBounds.y) / _hitCellSize), _hitRows - 1);
+        unsigned int right = std::min((unsigned int)((bounds.right() - _hitBounds.x) / _hitCellSize), _hitColumns - 1);
+        unsigned int bottom = std::min((unsigned int)((bounds.bottom() - _hitBounds.y) / _hitCellSize), _hitRows - 1);
+        for (unsigned int row = top; row <= bottom; ++row)
+        {
+            for (unsigned int column = left; column <= right; ++column)
+                _hitCells[row * _hitColumns + column].push_back(i);
+        }
+    }
+}
+
+void Form::addHitControl(Control* control)
+{
+    _hitControls.push_back(control);
+    if (control->isContainer())
+    {
+        Container* container = static_cast<Container*>(control);
+        for (unsigned int i = 0, childCount = container->getControlCount(); i < childCount; ++i)
+            addHitControl(container->getControl(i));
+    }
+}
+
 Control* Form::handlePointerPressRelease(int* x, int* y, bool pressed, unsigned int contactIndex)
 {
     if (contactIndex >= Touch::MAX_TOUCH_POINTS)
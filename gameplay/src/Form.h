@@ -140,6 +140,58 @@ public:
      */
     void setBatchingEnabled(bool enabled);
 
+    /**
+     * Starts drawing a group of forms that share their sprite batches.
+     *
+     * Until endDraw is called, forms drawn in 2D with batching enabled leave their sprite batches
+     * unflushed, so forms that use the same theme, fonts or atlas pages (see Theme::setAtlas) are
+     * all drawn with one flush per batch. As with batching within a form, the contents of each batch
+     * are drawn together, so overlapping forms using different batches may not layer in draw order.
+     * Forms drawn in 3D or with caching enabled flush the pending batches before drawing.
+     *
+     * Calls may be nested; batches are flushed by the outermost endDraw.
+     */
+    static void beginDraw();
+
+    /**
+     * Flushes the sprite batches of the forms drawn since beginDraw.
+     *
+     * @return The number of draw calls issued.
+     */
+    static unsigned int endDraw();
+
+    /**
+     * Determines whether this form caches its rendered controls in a texture.
+     *
+     * @return True if the form is cached, false otherwise.
+     */
+    bool isCached() const;
+
+    /**
+     * Turns render caching on or off for this form.
+     *
+     * A cached form renders its controls into an offscreen frame buffer only when one of
+     * them changes, redrawing just the region that changed, and otherwise draws the cached
+     * texture with a single quad. This is most useful for large forms that change rarely,
+     * such as menus and HUDs. Controls drawn with custom code that the form cannot track
+     * should call invalidate() when their appearance changes.
+     *
+     * @param cached True to enable caching, false (default) otherwise.
+     */
+    void setCached(bool cached);
+
+    /**
+     * Marks the whole form for redrawing into its cache on the next draw.
+     */
+    void invalidate();
+
+    /**
+     * Marks a region of the form for redrawing into its cache on the next draw.
+     *
+     * @param region The region to redraw, in the same coordinate space as the absolute bounds of the form's controls.
+     */
+    void invalidate(const Rectangle& region);
+
 private:
     
     /**
@@ -260,6 +312,12 @@ private:
 
     static Control* findInputControl(Control* control, int x, int y, bool focus, unsigned int contactIndex);
 
+    Control* findHitControl(int x, int y, bool focus);
+
+    void buildHitGrid();
+
+    void addHitControl(Control* control);
+
     static Control* handlePointerPressRelease(int* x, int* y, bool pressed, unsigned int contactIndex);
 
     static Control* handlePointerMove(int* x, int* y, unsigned int contactIndex);
@@ -276,9 +334,25 @@ private:
 
     static bool pollGamepad(Gamepad* gamepad);
 
+    unsigned int drawCache();
+
+    static unsigned int flushDrawBatches();
+
     Matrix _projectionMatrix;           // Projection matrix to be set on SpriteBatch objects when rendering the form
     std::vector<SpriteBatch*> _batches;
     bool _batched;
+    bool _cached;                       // Whether controls are rendered into _cacheBuffer rather than directly
+    FrameBuffer* _cacheBuffer;          // Pooled frame buffer holding the last rendering of the form
+    SpriteBatch* _cacheBatch;           // Batch used to draw the cached texture
+    Rectangle _cacheRegion;             // Region of the cache that needs to be redrawn, empty when the cache is up to date
+    Rectangle _redrawRegion;            // Region being redrawn during drawCache, empty when drawing everything
+    std::vector<Control*> _hitControls; // All controls of the form in traversal order, for input hit testing
+    std::vector<std::vector<unsigned int> > _hitCells; // Indices into _hitControls of the controls overlapping each grid cell
+    Rectangle _hitBounds;               // Area covered by the hit testing grid
+    float _hitCellSize;                 // Width and height of each grid cell
+    unsigned int _hitColumns;           // Number of grid columns
+    unsigned int _hitRows;              // Number of grid rows
+    bool _hitGridDirty;                 // Whether the grid must be rebuilt before the next hit test
 };
 
 }
@@ -1,19 +1,163 @@
 #include "Base.h"
 #include "FrameBuffer.h"
 #include "Game.h"
+#include "GLStateCache.h"
 
 #define FRAMEBUFFER_ID_DEFAULT "org.gameplay3d.framebuffer.default"
+// Number of pixel buffers screenshots are read back into, and so of readbacks in flight.
+#define FRAMEBUFFER_READBACK_BUFFERS 3
+// Largest number of attachments invalidated at once: the color attachments, depth and stencil.
+#define FRAMEBUFFER_MAX_INVALIDATED_ATTACHMENTS 10
+
+// Names of the attachments of a default frame buffer that is not a frame buffer object.
+#ifdef GP_USE_FRAMEBUFFER_DISCARD
+#define FRAMEBUFFER_DEFAULT_COLOR GL_COLOR_EXT
+#define FRAMEBUFFER_DEFAULT_DEPTH GL_DEPTH_EXT
+#define FRAMEBUFFER_DEFAULT_STENCIL GL_STENCIL_EXT
+#else
+#define FRAMEBUFFER_DEFAULT_COLOR GL_COLOR
+#define FRAMEBUFFER_DEFAULT_DEPTH GL_DEPTH
+#define FRAMEBUFFER_DEFAULT_STENCIL GL_STENCIL
+#endif
 
 namespace gameplay
 {
 
+// A screenshot being copied into a pixel buffer by the GPU.
+struct Readback
+{
+    GLuint buffer;
+#ifdef GP_USE_BUFFER_SYNC
+    GLsync fence;
+#endif
+    unsigned int width;
+    unsigned int height;
+    Image::Format format;
+    FrameBuffer::ReadbackCallback callback;
+};
+
+// A screenshot read back, waiting for the next frame to be delivered.
+struct ReadbackResult
+{
+    Image* image;
+    FrameBuffer::ReadbackCallback callback;
+};
+
+// The readbacks in flight, in the order they were requested from the first one.
+static Readback __readbacks[FRAMEBUFFER_READBACK_BUFFERS];
+static unsigned int __readbackFirst = 0;
+static unsigned int __readbackCount = 0;
+static std::vector<ReadbackResult> __readbackResults;
+
+static size_t getReadbackSize(unsigned int width, unsigned int height, Image::Format format)
+{
+    return (size_t)width * height * (format == Image::RGBA ? 4 : 3);
+}
+
+static void readPixels(unsigned int width, unsigned int height, Image::Format format, void* data)
+{
+    // Rows are tightly packed in images, which RGB rows of most widths are not by default.
+    GL_ASSERT( glPixelStorei(GL_PACK_ALIGNMENT, 1) );
+    GL_ASSERT( glReadPixels(0, 0, width, height, format == Image::RGB ? GL_RGB : GL_RGBA, GL_UNSIGNED_BYTE, data) );
+    GL_ASSERT( glPixelStorei(GL_PACK_ALIGNMENT, 4) );
+}
+
+#ifdef GP_USE_BUFFER_SYNC
+// Copies the first readback into an image once the GPU is done with it, or waits for it.
+static bool completeReadback(bool wait)
+{
+    GP_ASSERT(__readbackCount > 0);
+    Readback& readback = __readbacks[__readbackFirst];
+
+    GLenum result;
+    if (wait)
+    {
+        do
+        {
+            result = glClientWaitSync(readback.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+        } while (result == GL_TIMEOUT_EXPIRED);
+    }
+    else
+    {
+        GL_ASSERT( result = glClientWaitSync(readback.fence, 0, 0) );
+        if (result == GL_TIMEOUT_EXPIRED)
+            return false;
+    }
+    GL_ASSERT( glDeleteSync(readback.fence) );
+    readback.fence = 0;
+
+    const size_t size = getReadbackSize(readback.width, readback.height, readback.format);
+    Image* image = Image::create(readback.width, readback.height, readback.format, NULL);
+    GL_ASSERT( glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer) );
+    void* data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+    if (data)
+    {
+        memcpy(image->getData(), data, size);
+        GL_ASSERT( glUnmapBuffer(GL_PIXEL_PACK_BUFFER) );
+    }
+    else
+    {
+        GP_WARN("Failed to map the pixel buffer of a screenshot readback.");
+    }
+    GL_ASSERT( glBindBuffer(GL_PIXEL_PACK_BUFFER, 0) );
+
+    ReadbackResult entry;
+    entry.image = image;
+    entry.callback = std::move(readback.callback);
+    readback.callback = nullptr;
+    __readbackResults.push_back(std::move(entry));
+
+    __readbackFirst = (__readbackFirst + 1) % FRAMEBUFFER_READBACK_BUFFERS;
+    --__readbackCount;
+    return true;
+}
+#endif
+
+// Tells the driver that the contents of attachments of a bound frame buffer are no longer needed.
+static void invalidateFramebuffer(GLenum target, GLsizei count, const GLenum* attachments)
+{
+#if defined(GP_USE_FRAMEBUFFER_DISCARD)
+#ifdef __ANDROID__
+    if (!glDiscardFramebuffer)
+        return;
+#endif
+    GL_ASSERT( glDiscardFramebuffer(target, count, attachments) );
+#elif defined(GP_USE_FRAMEBUFFER_INVALIDATE)
+    if (glInvalidateFramebuffer)
+        GL_ASSERT( glInvalidateFramebuffer(target, count, attachments) );
+#endif
+}
+
+#ifdef GP_USE_FRAMEBUFFER_MULTISAMPLE
+// Returns the internal format of the multisampled buffer of a render target of a texture format.
+static GLenum getMultisampleFormat(Texture::Format format)
+{
+    switch (format)
+    {
+    case Texture::RGB:
+        return GL_RGB8;
+    case Texture::RGB565:
+        return GL_RGB565;
+    case Texture::RGBA4444:
+        return GL_RGBA4;
+    case Texture::RGBA5551:
+        return GL_RGB5_A1;
+    case Texture::DEPTH:
+        return GL_DEPTH_COMPONENT24;
+    default:
+        return GL_RGBA8;
+    }
+}
+#endif
+
 unsigned int FrameBuffer::_maxRenderTargets = 0;
 std::vector<FrameBuffer*> FrameBuffer::_frameBuffers;
 FrameBuffer* FrameBuffer::_defaultFrameBuffer = NULL;
 FrameBuffer* FrameBuffer::_currentFrameBuffer = NULL;
 
 FrameBuffer::FrameBuffer(const char* id, unsigned int width, unsigned int height, FrameBufferHandle handle) 
-    : _id(id ? id : ""), _handle(handle), _renderTargets(NULL), _renderTargetCount(0), _depthStencilTarget(NULL)
+    : _id(id ? id : ""), _handle(handle), _renderTargets(NULL), _renderTargetCount(0), _depthStencilTarget(NULL),
+      _invalidatedAttachments(0), _samples(0), _multisampleHandle(0)
 {
 }
 
@@ -34,9 +178,14 @@ FrameBuffer::~FrameBuffer()
     if (_depthStencilTarget)
         SAFE_RELEASE(_depthStencilTarget);
 
-    // Release GL resource.
+    // Release GL resource, which is only freed later so it must not stay bound.
+    if (_currentFrameBuffer == this && this != _defaultFrameBuffer)
+        bindDefault();
     if (_handle)
-        GL_ASSERT( glDeleteFramebuffers(1, &_handle) );
+        GLStateCache::deleteFramebuffer(_handle);
+    deleteMultisampleBuffers();
+    if (_multisampleHandle)
+        GLStateCache::deleteFramebuffer(_multisampleHandle);
 
     // Remove self from vector.
     std::vector<FrameBuffer*>::iterator it = std::find(_frameBuffers.begin(), _frameBuffers.end(), this);
@@ -46,6 +195,11 @@ FrameBuffer::~FrameBuffer()
     }
 }
 
+bool FrameBuffer::isDestroyedOnMainThread() const
+{
+    return true;
+}
+
 void FrameBuffer::initialize()
 {
     // Query the current/initial FBO handle and store is as out 'default' frame buffer.
@@ -55,6 +209,9 @@ void FrameBuffer::initialize()
     _defaultFrameBuffer = new FrameBuffer(FRAMEBUFFER_ID_DEFAULT, 0, 0, (FrameBufferHandle)fbo);
     _currentFrameBuffer = _defaultFrameBuffer;
 
+    // The depth and stencil of the frame are never read once it is presented.
+    _defaultFrameBuffer->_invalidatedAttachments = ATTACHMENT_DEPTH_STENCIL;
+
     // Query the max supported color attachments. This glGet operation is not supported
     // on GL ES 2.x, so if the define does not exist, assume a value of 1.
 #ifdef GL_MAX_COLOR_ATTACHMENTS
@@ -68,9 +225,61 @@ void FrameBuffer::initialize()
 
 void FrameBuffer::finalize()
 {
+    // Screenshots still in flight are dropped, as their callbacks may refer to objects already finalized.
+    for (unsigned int i = 0; i < FRAMEBUFFER_READBACK_BUFFERS; ++i)
+    {
+        Readback& readback = __readbacks[i];
+#ifdef GP_USE_BUFFER_SYNC
+        if (readback.fence)
+        {
+            GL_ASSERT( glDeleteSync(readback.fence) );
+            readback.fence = 0;
+        }
+#endif
+        if (readback.buffer)
+        {
+            GLStateCache::deleteBuffer(readback.buffer);
+            readback.buffer = 0;
+        }
+        readback.callback = nullptr;
+    }
+    __readbackFirst = 0;
+    __readbackCount = 0;
+    for (size_t i = 0, count = __readbackResults.size(); i < count; ++i)
+    {
+        SAFE_RELEASE(__readbackResults[i].image);
+    }
+    __readbackResults.clear();
+
     SAFE_RELEASE(_defaultFrameBuffer);
 }
 
+void FrameBuffer::nextFrame()
+{
+#ifdef GP_USE_BUFFER_SYNC
+    while (__readbackCount > 0 && completeReadback(false))
+    {
+    }
+#endif
+    if (__readbackResults.empty())
+        return;
+
+    // Callbacks may request more screenshots, which are delivered on a later frame.
+    std::vector<ReadbackResult> results;
+    results.swap(__readbackResults);
+    for (size_t i = 0, count = results.size(); i < count; ++i)
+    {
+        results[i].callback(results[i].image);
+        SAFE_RELEASE(results[i].image);
+    }
+}
+
+void FrameBuffer::endFrame()
+{
+    if (_currentFrameBuffer == _defaultFrameBuffer && _defaultFrameBuffer->_invalidatedAttachments)
+        _defaultFrameBuffer->invalidate(_defaultFrameBuffer->_invalidatedAttachments);
+}
+
 FrameBuffer* FrameBuffer::create(const char* id)
 {
     return create(id, 0, 0);
@@ -220,7 +429,13 @@ void FrameBuffer::setRenderTarget(RenderTarget* target, unsigned int index, GLen
         }
 
         // Restore the FBO binding
-        GL_ASSERT( glBindFramebuffer(GL_FRAMEBUFFER, _currentFrameBuffer->_handle) );
+        GL_ASSERT( glBindFramebuffer(GL_FRAMEBUFFER, _currentFrameBuffer->getDrawHandle()) );
+    }
+
+    if (_samples > 0)
+    {
+        deleteMultisampleBuffers();
+        createMultisampleBuffers();
     }
 }
 
@@ -276,7 +491,13 @@ void FrameBuffer::setDepthStencilTarget(DepthStencilTarget* target)
         }
 
         // Restore the FBO binding
-        GL_ASSERT( glBindFramebuffer(GL_FRAMEBUFFER, _currentFrameBuffer->_handle) );
+        GL_ASSERT( glBindFramebuffer(GL_FRAMEBUFFER, _currentFrameBuffer->getDrawHandle()) );
+    }
+
+    if (_samples > 0)
+    {
+        deleteMultisampleBuffers();
+        createMultisampleBuffers();
     }
 }
 
@@ -292,12 +513,238 @@ bool FrameBuffer::isDefault() const
 
 FrameBuffer* FrameBuffer::bind(GLenum type)
 {
-    GL_ASSERT( glBindFramebuffer(type, _handle) );
+    if (type == GL_FRAMEBUFFER && _currentFrameBuffer && _currentFrameBuffer != this)
+        _currentFrameBuffer->endPass();
+
+    FrameBufferHandle handle = getDrawHandle();
+#ifdef GP_USE_FRAMEBUFFER_MULTISAMPLE
+    // Multisampled frame buffers are drawn into their samples and read from their resolved render targets.
+    if (type == GL_READ_FRAMEBUFFER)
+        handle = _handle;
+#endif
+    GL_ASSERT( glBindFramebuffer(type, handle) );
     FrameBuffer* previousFrameBuffer = _currentFrameBuffer;
     _currentFrameBuffer = this;
     return previousFrameBuffer;
 }
 
+FrameBufferHandle FrameBuffer::getDrawHandle() const
+{
+    return _samples > 0 ? _multisampleHandle : _handle;
+}
+
+void FrameBuffer::endPass()
+{
+    // The default frame buffer is invalidated at the end of the frame instead, as it is often bound again.
+    if (_invalidatedAttachments && this != _defaultFrameBuffer)
+        invalidate(_invalidatedAttachments);
+}
+
+void FrameBuffer::setInvalidatedAttachments(unsigned int attachments)
+{
+    _invalidatedAttachments = attachments & (ATTACHMENT_COLOR | ATTACHMENT_DEPTH_STENCIL);
+}
+
+unsigned int FrameBuffer::getInvalidatedAttachments() const
+{
+    return _invalidatedAttachments;
+}
+
+void FrameBuffer::invalidate(unsigned int attachments)
+{
+    GP_ASSERT(_currentFrameBuffer == this);
+
+    GLenum names[FRAMEBUFFER_MAX_INVALIDATED_ATTACHMENTS];
+    GLsizei count = 0;
+    const bool objectNames = _handle != 0;
+    if (attachments & ATTACHMENT_COLOR)
+    {
+        if (isDefault())
+        {
+            names[count++] = objectNames ? GL_COLOR_ATTACHMENT0 : FRAMEBUFFER_DEFAULT_COLOR;
+        }
+        else
+        {
+            for (unsigned int i = 0; i < _maxRenderTargets && count < FRAMEBUFFER_MAX_INVALIDATED_ATTACHMENTS - 2; ++i)
+            {
+                if (_renderTargets[i] && _renderTargets[i]->getTexture()->getFormat() != Texture::DEPTH)
+                    names[count++] = GL_COLOR_ATTACHMENT0 + i;
+            }
+        }
+    }
+    if (attachments & ATTACHMENT_DEPTH)
+        names[count++] = objectNames ? GL_DEPTH_ATTACHMENT : FRAMEBUFFER_DEFAULT_DEPTH;
+    if (attachments & ATTACHMENT_STENCIL)
+        names[count++] = objectNames ? GL_STENCIL_ATTACHMENT : FRAMEBUFFER_DEFAULT_STENCIL;
+
+    if (count > 0)
+        invalidateFramebuffer(GL_FRAMEBUFFER, count, names);
+}
+
+bool FrameBuffer::setSamples(unsigned int samples)
+{
+    GP_ASSERT(!isDefault());
+
+    if (samples == 1)
+        samples = 0;
+    if (samples == _samples)
+        return true;
+
+#ifdef GP_USE_FRAMEBUFFER_MULTISAMPLE
+    if (samples > 0 && !(glRenderbufferStorageMultisample && glBlitFramebuffer))
+    {
+        GP_WARN("Failed to multisample frame buffer '%s': multisampled renderbuffers are not supported.", _id.c_str());
+        return false;
+    }
+
+    GLint maxSamples = 0;
+    if (samples > 0)
+        GL_ASSERT( glGetIntegerv(GL_MAX_SAMPLES, &maxSamples) );
+    deleteMultisampleBuffers();
+    _samples = std::min(samples, (unsigned int)std::max(maxSamples, 0));
+    if (_samples == 1)
+        _samples = 0;
+    if (_samples > 0)
+    {
+        createMultisampleBuffers();
+    }
+    else if (_multisampleHandle)
+    {
+        GLStateCache::deleteFramebuffer(_multisampleHandle);
+        _multisampleHandle = 0;
+    }
+
+    if (_currentFrameBuffer == this)
+        GL_ASSERT( glBindFramebuffer(GL_FRAMEBUFFER, getDrawHandle()) );
+    return true;
+#else
+    GP_WARN("Failed to multisample frame buffer '%s': multisampled frame buffers are not supported on this platform.", _id.c_str());
+    return false;
+#endif
+}
+
+unsigned int FrameBuffer::getSamples() const
+{
+    return _samples;
+}
+
+void FrameBuffer::createMultisampleBuffers()
+{
+#ifdef GP_USE_FRAMEBUFFER_MULTISAMPLE
+    GP_ASSERT(_samples > 0 && _multisampleBuffers.empty());
+
+    if (!_multisampleHandle)
+        GL_ASSERT( glGenFramebuffers(1, &_multisampleHandle) );
+    GL_ASSERT( glBindFramebuffer(GL_FRAMEBUFFER, _multisampleHandle) );
+
+    // Each render target is drawn into a multisampled buffer at the same attachment.
+    unsigned int colorCount = 0;
+    for (unsigned int i = 0; i < _maxRenderTargets; ++i)
+    {
+        RenderTarget* target = _renderTargets[i];
+        if (!target)
+            continue;
+
+        const Texture::Format format = target->getTexture()->getFormat();
+        RenderBufferHandle buffer;
+        GL_ASSERT( glGenRenderbuffers(1, &buffer) );
+        GL_ASSERT( glBindRenderbuffer(GL_RENDERBUFFER, buffer) );
+        GL_ASSERT( glRenderbufferStorageMultisample(GL_RENDERBUFFER, _samples, getMultisampleFormat(format), target->getWidth(), target->getHeight()) );
+        GL_ASSERT( glFramebufferRenderbuffer(GL_FRAMEBUFFER, format == Texture::DEPTH ? GL_DEPTH_ATTACHMENT : GL_COLOR_ATTACHMENT0 + i, GL_RENDERBUFFER, buffer) );
+        _multisampleBuffers.push_back(buffer);
+        if (format != Texture::DEPTH)
+            ++colorCount;
+    }
+    if (colorCount == 0)
+    {
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+    }
+
+    if (_depthStencilTarget)
+    {
+        const bool stencil = _depthStencilTarget->getFormat() == DepthStencilTarget::DEPTH_STENCIL;
+        RenderBufferHandle buffer;
+        GL_ASSERT( glGenRenderbuffers(1, &buffer) );
+        GL_ASSERT( glBindRenderbuffer(GL_RENDERBUFFER, buffer) );
+        GL_ASSERT( glRenderbufferStorageMultisample(GL_RENDERBUFFER, _samples, stencil ? GL_DEPTH24_STENCIL8 : GL_DEPTH_COMPONENT24,
+                                                    _depthStencilTarget->getWidth(), _depthStencilTarget->getHeight()) );
+        GL_ASSERT( glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, buffer) );
+        if (stencil)
+            GL_ASSERT( glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, buffer) );
+        _multisampleBuffers.push_back(buffer);
+    }
+
+    GLenum fboStatus = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    if (fboStatus != GL_FRAMEBUFFER_COMPLETE)
+    {
+        GP_ERROR("Multisampled framebuffer status incomplete: 0x%x", fboStatus);
+    }
+
+    // Restore the FBO binding
+    GL_ASSERT( glBindFramebuffer(GL_FRAMEBUFFER, _currentFrameBuffer->getDrawHandle()) );
+#endif
+}
+
+void FrameBuffer::deleteMultisampleBuffers()
+{
+    for (size_t i = 0, count = _multisampleBuffers.size(); i < count; ++i)
+    {
+        GLStateCache::deleteRenderbuffer(_multisampleBuffers[i]);
+    }
+    _multisampleBuffers.clear();
+}
+
+void FrameBuffer::resolve()
+{
+#ifdef GP_USE_FRAMEBUFFER_MULTISAMPLE
+    if (_samples == 0)
+        return;
+
+    GL_ASSERT( glBindFramebuffer(GL_READ_FRAMEBUFFER, _multisampleHandle) );
+    GL_ASSERT( glBindFramebuffer(GL_DRAW_FRAMEBUFFER, _handle) );
+
+    // Color attachments are copied one at a time, as a blit reads a single buffer.
+    GLenum names[FRAMEBUFFER_MAX_INVALIDATED_ATTACHMENTS];
+    GLsizei count = 0;
+    bool color = false;
+    for (unsigned int i = 0; i < _maxRenderTargets; ++i)
+    {
+        RenderTarget* target = _renderTargets[i];
+        if (!target)
+            continue;
+
+        const GLint width = (GLint)target->getWidth();
+        const GLint height = (GLint)target->getHeight();
+        if (target->getTexture()->getFormat() == Texture::DEPTH)
+        {
+            GL_ASSERT( glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_DEPTH_BUFFER_BIT, GL_NEAREST) );
+        }
+        else
+        {
+            GL_ASSERT( glReadBuffer(GL_COLOR_ATTACHMENT0 + i) );
+            GL_ASSERT( glDrawBuffer(GL_COLOR_ATTACHMENT0 + i) );
+            GL_ASSERT( glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST) );
+            if (count < FRAMEBUFFER_MAX_INVALIDATED_ATTACHMENTS - 2)
+                names[count++] = GL_COLOR_ATTACHMENT0 + i;
+            color = true;
+        }
+    }
+    if (color)
+    {
+        GL_ASSERT( glReadBuffer(GL_COLOR_ATTACHMENT0) );
+        GL_ASSERT( glDrawBuffer(GL_COLOR_ATTACHMENT0) );
+    }
+
+    // The samples are not needed once resolved, so tile-based GPUs need not write them out.
+    names[count++] = GL_DEPTH_ATTACHMENT;
+    names[count++] = GL_STENCIL_ATTACHMENT;
+    invalidateFramebuffer(GL_READ_FRAMEBUFFER, count, names);
+
+    GL_ASSERT( glBindFramebuffer(GL_FRAMEBUFFER, _currentFrameBuffer->getDrawHandle()) );
+#endif
+}
+
 void FrameBuffer::getScreenshot(Image* image)
 {
     GP_ASSERT( image );
@@ -311,6 +758,64 @@ void FrameBuffer::getScreenshot(Image* image)
 	}
 }
 
+void FrameBuffer::readScreenshotAsync(const ReadbackCallback& callback, Image::Format format)
+{
+    GP_ASSERT(callback);
+    GP_ASSERT(_currentFrameBuffer);
+
+    const unsigned int width = _currentFrameBuffer->getWidth();
+    const unsigned int height = _currentFrameBuffer->getHeight();
+
+#ifdef GP_USE_BUFFER_SYNC
+    if (glFenceSync && glClientWaitSync && glDeleteSync && glMapBufferRange)
+    {
+        // All the pixel buffers are in flight, so the oldest readback has to finish first.
+        if (__readbackCount == FRAMEBUFFER_READBACK_BUFFERS)
+            completeReadback(true);
+
+        Readback& readback = __readbacks[(__readbackFirst + __readbackCount) % FRAMEBUFFER_READBACK_BUFFERS];
+        if (!readback.buffer)
+            GL_ASSERT( glGenBuffers(1, &readback.buffer) );
+        readback.width = width;
+        readback.height = height;
+        readback.format = format;
+        readback.callback = callback;
+
+        // The buffer is orphaned, so the copy does not wait for an earlier readback to be mapped.
+        GL_ASSERT( glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer) );
+        GL_ASSERT( glBufferData(GL_PIXEL_PACK_BUFFER, getReadbackSize(width, height, format), NULL, GL_STREAM_READ) );
+        readPixels(width, height, format, NULL);
+        GL_ASSERT( glBindBuffer(GL_PIXEL_PACK_BUFFER, 0) );
+        GL_ASSERT( readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) );
+        ++__readbackCount;
+        return;
+    }
+#endif
+
+    ReadbackResult entry;
+    entry.image = Image::create(width, height, format, NULL);
+    entry.callback = callback;
+    readPixels(width, height, format, entry.image->getData());
+    __readbackResults.push_back(std::move(entry));
+}
+
+void FrameBuffer::saveScreenshotAsync(const char* path, Image::Format format)
+{
+    GP_ASSERT(path);
+
+    std::string file(path);
+    readScreenshotAsync([file](Image* image)
+    {
+        // The job holds its own reference, as the image is released once the callback returns.
+        image->addRef();
+        Game::getInstance()->getJobSystem()->run([file, image]()
+        {
+            image->save(file.c_str());
+            image->release();
+        });
+    }, format);
+}
+
 Image* FrameBuffer::createScreenshot(Image::Format format)
 {
     Image* screenshot = Image::create(_currentFrameBuffer->getWidth(), _currentFrameBuffer->getHeight(), format, NULL);
@@ -321,6 +826,9 @@ Image* FrameBuffer::createScreenshot(Image::Format format)
 
 FrameBuffer* FrameBuffer::bindDefault(GLenum type)
 {
+    if (type == GL_FRAMEBUFFER && _currentFrameBuffer && _currentFrameBuffer != _defaultFrameBuffer)
+        _currentFrameBuffer->endPass();
+
     GL_ASSERT( glBindFramebuffer(type, _defaultFrameBuffer->_handle) );
     _currentFrameBuffer = _defaultFrameBuffer;
     return _defaultFrameBuffer;
@@ -25,9 +25,21 @@ namespace gameplay
 class FrameBuffer : public Ref
 {
     friend class Game;
+    friend class ResourceManager;
 
 public:
 
+    /**
+     * Defines the attachments of a frame buffer whose contents can be invalidated, which can be combined.
+     */
+    enum AttachmentFlags
+    {
+        ATTACHMENT_COLOR = GL_COLOR_BUFFER_BIT,
+        ATTACHMENT_DEPTH = GL_DEPTH_BUFFER_BIT,
+        ATTACHMENT_STENCIL = GL_STENCIL_BUFFER_BIT,
+        ATTACHMENT_DEPTH_STENCIL = ATTACHMENT_DEPTH | ATTACHMENT_STENCIL
+    };
+
     /**
      * Creates a new, empty FrameBuffer object.
      *
@@ -161,6 +173,72 @@ public:
      */
     FrameBuffer* bind(GLenum type = GL_FRAMEBUFFER);
 
+    /**
+     * Sets the attachments whose contents are not needed once a pass of drawing into this
+     * frame buffer is finished, such as the depth and stencil of a render-to-texture pass.
+     *
+     * Tile-based GPUs write the attachments of a frame buffer out of their tile memory when
+     * it stops being drawn to, and read them back in when it is drawn to again. The contents
+     * of these attachments are invalidated, which skips the writes, when another frame buffer
+     * is bound in place of this one. The default frame buffer is often bound again within a
+     * frame, so its attachments are only invalidated at the end of each frame, before it is
+     * presented. Clearing the attachments when a pass starts skips the reads in the same way.
+     *
+     * The default frame buffer invalidates its depth and stencil by default, and other frame
+     * buffers invalidate nothing.
+     *
+     * @param attachments The attachments to invalidate, from AttachmentFlags.
+     */
+    void setInvalidatedAttachments(unsigned int attachments);
+
+    /**
+     * Gets the attachments whose contents are invalidated at the end of a pass.
+     *
+     * @return The attachments, from AttachmentFlags.
+     */
+    unsigned int getInvalidatedAttachments() const;
+
+    /**
+     * Invalidates the contents of attachments of this frame buffer, which must be bound.
+     *
+     * This does nothing when the platform cannot invalidate frame buffers.
+     *
+     * @param attachments The attachments to invalidate, from AttachmentFlags.
+     */
+    void invalidate(unsigned int attachments);
+
+    /**
+     * Sets the number of samples that this frame buffer is drawn with.
+     *
+     * A multisampled frame buffer is drawn into multisampled buffers of the formats and sizes
+     * of its render targets and depth-stencil target, which resolve() copies into the textures
+     * of the render targets. The samples are not kept once resolved, so drawing into the frame
+     * buffer again starts a new pass, which should clear it. Reading
+     * the frame buffer, as getScreenshot() does, requires it to be resolved and bound as the
+     * read frame buffer.
+     *
+     * @param samples The number of samples, or zero or one not to multisample.
+     *
+     * @return true if the samples were set, false if the platform cannot multisample frame buffers.
+     * @script{ignore}
+     */
+    bool setSamples(unsigned int samples);
+
+    /**
+     * Gets the number of samples that this frame buffer is drawn with.
+     *
+     * @return The number of samples, or zero if the frame buffer is not multisampled.
+     */
+    unsigned int getSamples() const;
+
+    /**
+     * Copies the samples drawn into this frame buffer into the textures of its render targets.
+     *
+     * This is called at the end of each pass of drawing into a multisampled frame buffer,
+     * before its render targets are read, and does nothing if it is not multisampled.
+     */
+    void resolve();
+
     /**
      * Records a screenshot of what is stored on the current FrameBuffer.
      *
@@ -178,6 +256,40 @@ public:
      */
     static void getScreenshot(Image* image);
 
+    /**
+     * Defines the callback receiving a screenshot read back asynchronously.
+     *
+     * The image is released after the callback returns, so it must be referenced to be kept.
+     */
+    typedef std::function<void(Image*)> ReadbackCallback;
+
+    /**
+     * Reads back a screenshot of what is stored on the current FrameBuffer, without stalling
+     * until the GPU has finished drawing it.
+     *
+     * The pixels are copied into a pixel buffer object, and the callback is called on the thread
+     * rendering the frames once the GPU is done with the copy, usually one or two frames later.
+     * Up to three readbacks are in flight, beyond which the oldest one is waited for. Where fences
+     * or mapped buffers are not supported, the pixels are read immediately and still delivered
+     * on the next frame.
+     *
+     * @param callback The callback receiving the screenshot.
+     * @param format The format the Image should be in.
+     * @script{ignore}
+     */
+    static void readScreenshotAsync(const ReadbackCallback& callback, Image::Format format = Image::RGBA);
+
+    /**
+     * Saves a screenshot of what is stored on the current FrameBuffer to a PNG file.
+     *
+     * The screenshot is read back as readScreenshotAsync() does, and encoded by the job system.
+     *
+     * @param path The path of the PNG file to write.
+     * @param format The format the Image should be in.
+     * @script{ignore}
+     */
+    static void saveScreenshotAsync(const char* path, Image::Format format = Image::RGBA);
+
     /**
      * Binds the default FrameBuffer for rendering to the display.
      *
@@ -204,6 +316,11 @@ private:
      */
     ~FrameBuffer();
 
+    /**
+     * @see Ref::isDestroyedOnMainThread
+     */
+    bool isDestroyedOnMainThread() const;
+
     /**
      * Hidden copy assignment operator.
      */
@@ -211,10 +328,41 @@ private:
 
     void setRenderTarget(RenderTarget* target, unsigned int index, GLenum textureTarget);
 
+    /**
+     * Gets the handle of the frame buffer that is drawn into when this frame buffer is bound.
+     */
+    FrameBufferHandle getDrawHandle() const;
+
+    /**
+     * Invalidates the attachments of this frame buffer that are not needed once a pass is
+     * finished, as another frame buffer is bound in its place.
+     */
+    void endPass();
+
+    /**
+     * Creates the multisampled buffers of the render targets and depth-stencil target.
+     */
+    void createMultisampleBuffers();
+
+    /**
+     * Deletes the multisampled buffers.
+     */
+    void deleteMultisampleBuffers();
+
     static void initialize();
 
     static void finalize();
 
+    /**
+     * Delivers the screenshots whose readbacks have completed.
+     */
+    static void nextFrame();
+
+    /**
+     * Invalidates the attachments of the default frame buffer before it is presented.
+     */
+    static void endFrame();
+
     static bool isPowerOfTwo(unsigned int value);
 
     std::string _id;
@@ -222,6 +370,10 @@ private:
     RenderTarget** _renderTargets;
     unsigned int _renderTargetCount;
     DepthStencilTarget* _depthStencilTarget;
+    unsigned int _invalidatedAttachments;
+    unsigned int _samples;
+    FrameBufferHandle _multisampleHandle;
+    std::vector<RenderBufferHandle> _multisampleBuffers;
 
     static unsigned int _maxRenderTargets;
     static std::vector<FrameBuffer*> _frameBuffers;
@@ -0,0 +1,372 @@
+#include "Base.h"
+#include "FrameCapture.h"
+#include "FileSystem.h"
+#include "Node.h"
+#include "Material.h"
+
+namespace gameplay
+{
+
+// The identifier and version at the start of capture files.
+static const char FRAME_CAPTURE_IDENTIFIER[] = { 'G', 'P', 'F', 'C' };
+static const unsigned int FRAME_CAPTURE_VERSION = 1;
+
+// A command as stored in capture files. Nodes, materials and names are indices in the string
+// table of the capture, where zero is no string.
+struct CapturedCommand
+{
+    unsigned char type;
+    unsigned char redundant;
+    unsigned short reserved;
+    unsigned int target;
+    unsigned int object;
+    unsigned int count;
+    unsigned int size;
+    unsigned int node;
+    unsigned int material;
+    unsigned int name;
+};
+
+static const char* __commandNames[FrameCapture::COMMAND_TYPE_COUNT] =
+{
+    "USE_PROGRAM",
+    "BIND_TEXTURE",
+    "BIND_SAMPLER",
+    "BIND_BUFFER",
+    "BIND_VERTEX_ARRAY",
+    "SET_UNIFORM",
+    "SET_RENDER_STATE",
+    "DRAW",
+    "UPLOAD_BUFFER",
+    "UPLOAD_TEXTURE"
+};
+
+std::atomic<bool> FrameCapture::_recording(false);
+
+// The capture requested for the next frame, and the capture of the current frame.
+static std::string __pendingPath;
+static unsigned int __pendingMaxCommands = 0;
+static std::string __path;
+static unsigned int __maxCommands = 0;
+static std::thread::id __thread;
+static std::vector<CapturedCommand> __commands;
+static unsigned int __droppedCount = 0;
+
+// The string table of the current capture, with the indices of the sources and names already in it.
+static std::vector<std::string> __strings;
+static std::map<const void*, unsigned int> __sourceStrings;
+static std::map<std::string, unsigned int> __nameStrings;
+
+// The source of the commands being issued, and its indices in the string table once a command uses it.
+static const Node* __node = NULL;
+static const Material* __material = NULL;
+static unsigned int __nodeString = 0;
+static unsigned int __materialString = 0;
+
+/**
+ * Returns the index of the label of the given node or material in the string table, adding it if needed.
+ */
+static unsigned int getSourceString(const void* source, const std::string& label)
+{
+    std::map<const void*, unsigned int>::iterator itr = __sourceStrings.find(source);
+    if (itr != __sourceStrings.end())
+        return itr->second;
+
+    unsigned int index = (unsigned int)__strings.size();
+    __strings.push_back(label);
+    __sourceStrings[source] = index;
+    return index;
+}
+
+/**
+ * Returns the label of a material in captures, made of the ids of its technique and of the effect of its first pass.
+ */
+static std::string getMaterialLabel(const Material* material)
+{
+    std::string label;
+    Technique* technique = material->getTechnique();
+    if (technique)
+    {
+        label = technique->getId();
+        Pass* pass = technique->getPassCount() > 0 ? technique->getPassByIndex(0) : NULL;
+        if (pass && pass->getEffect())
+        {
+            label += " ";
+            label += pass->getEffect()->getId();
+        }
+    }
+    return label;
+}
+
+/**
+ * Writes a field of a command table, quoted if it contains a separator.
+ */
+static void writeCsvField(std::ostringstream& csv, const std::string& field)
+{
+    if (field.find_first_of(",\"\n") == std::string::npos)
+    {
+        csv << field;
+        return;
+    }
+
+    csv << '"';
+    for (size_t i = 0, length = field.size(); i < length; ++i)
+    {
+        if (field[i] == '"')
+            csv << '"';
+        csv << field[i];
+    }
+    csv << '"';
+}
+
+FrameCapture::Source::Source(const Node* node, const Material* material)
+    : _node(__node), _material(__material), _active(_recording)
+{
+    if (_active)
+    {
+        if (node && node != __node)
+        {
+            __node = node;
+            __nodeString = 0;
+        }
+        if (material && material != __material)
+        {
+            __material = material;
+            __materialString = 0;
+        }
+    }
+}
+
+FrameCapture::Source::~Source()
+{
+    if (_active)
+    {
+        if (__node != _node)
+        {
+            __node = _node;
+            __nodeString = 0;
+        }
+        if (__material != _material)
+        {
+            __material = _material;
+            __materialString = 0;
+        }
+    }
+}
+
+bool FrameCapture::capture(const char* path, unsigned int maxCommands)
+{
+    GP_ASSERT(path);
+
+    if (!__pendingPath.empty() || _recording)
+    {
+        GP_WARN("A frame is already being captured; not capturing to '%s'.", path);
+        return false;
+    }
+
+    __pendingPath = path;
+    __pendingMaxCommands = maxCommands;
+    return true;
+}
+
+bool FrameCapture::isCapturing()
+{
+    return _recording || !__pendingPath.empty();
+}
+
+void FrameCapture::recordCommand(CommandType type, unsigned int target, unsigned int object, unsigned int count,
+                                 unsigned int size, bool redundant, const char* name)
+{
+    if (std::this_thread::get_id() != __thread)
+        return;
+    if (__commands.size() >= __maxCommands)
+    {
+        ++__droppedCount;
+        return;
+    }
+
+    // The labels of sources are only looked up for the sources that issue commands.
+    if (__node && __nodeString == 0)
+        __nodeString = getSourceString(__node, __node->getId());
+    if (__material && __materialString == 0)
+        __materialString = getSourceString(__material, getMaterialLabel(__material));
+
+    CapturedCommand command;
+    command.type = (unsigned char)type;
+    command.redundant = redundant ? 1 : 0;
+    command.reserved = 0;
+    command.target = target;
+    command.object = object;
+    command.count = count;
+    command.size = size;
+    command.node = __node ? __nodeString : 0;
+    command.material = __material ? __materialString : 0;
+    command.name = 0;
+    if (name)
+    {
+        std::map<std::string, unsigned int>::iterator itr = __nameStrings.find(name);
+        if (itr == __nameStrings.end())
+        {
+            itr = __nameStrings.insert(std::make_pair(std::string(name), (unsigned int)__strings.size())).first;
+            __strings.push_back(name);
+        }
+        command.name = itr->second;
+    }
+    __commands.push_back(command);
+}
+
+void FrameCapture::nextFrame()
+{
+    // Write the capture of the frame that just ended.
+    if (_recording)
+    {
+        _recording = false;
+        __node = NULL;
+        __material = NULL;
+        if (__droppedCount > 0)
+            GP_WARN("Dropped %u commands beyond the first %u of the captured frame.", __droppedCount, __maxCommands);
+
+        Stream* stream = FileSystem::open(__path.c_str(), FileSystem::WRITE);
+        if (stream == NULL)
+        {
+            GP_WARN("Failed to open file '%s' for writing the frame capture.", __path.c_str());
+        }
+        else
+        {
+            const unsigned int commandCount = (unsigned int)__commands.size();
+            const unsigned int stringCount = (unsigned int)__strings.size();
+            bool result = stream->write(FRAME_CAPTURE_IDENTIFIER, 1, sizeof(FRAME_CAPTURE_IDENTIFIER)) == sizeof(FRAME_CAPTURE_IDENTIFIER) &&
+                stream->write(&FRAME_CAPTURE_VERSION, sizeof(unsigned int), 1) == 1 &&
+                stream->write(&stringCount, sizeof(unsigned int), 1) == 1 &&
+                stream->write(&commandCount, sizeof(unsigned int), 1) == 1;
+            for (unsigned int i = 0; i < stringCount && result; ++i)
+            {
+                const unsigned int length = (unsigned int)__strings[i].size();
+                result = stream->write(&length, sizeof(unsigned int), 1) == 1 &&
+                    (length == 0 || stream->write(__strings[i].c_str(), 1, length) == length);
+            }
+            if (result && commandCount > 0)
+                result = stream->write(&__commands[0], sizeof(CapturedCommand), commandCount) == commandCount;
+            stream->close();
+            SAFE_DELETE(stream);
+            if (!result)
+                GP_WARN("Failed to write the frame capture to file '%s'.", __path.c_str());
+        }
+
+        std::vector<CapturedCommand>().swap(__commands);
+        __strings.clear();
+        __sourceStrings.clear();
+        __nameStrings.clear();
+    }
+
+    // Begin the pending capture on the thread that renders the frames.
+    if (!__pendingPath.empty())
+    {
+        __path.swap(__pendingPath);
+        __pendingPath.clear();
+        __maxCommands = __pendingMaxCommands;
+        __thread = std::this_thread::get_id();
+        __droppedCount = 0;
+        __nodeString = 0;
+        __materialString = 0;
+
+        // The first string is the empty string, the source of the commands issued outside of any.
+        __strings.push_back(std::string());
+        _recording = true;
+    }
+}
+
+void FrameCapture::finalize()
+{
+    _recording = false;
+    __pendingPath.clear();
+    __node = NULL;
+    __material = NULL;
+    std::vector<CapturedCommand>().swap(__commands);
+    __strings.clear();
+    __sourceStrings.clear();
+    __nameStrings.clear();
+}
+
+bool FrameCapture::exportCsv(const char* capturePath, const char* csvPath)
+{
+    GP_ASSERT(capturePath);
+    GP_ASSERT(csvPath);
+
+    Stream* stream = FileSystem::open(capturePath);
+    if (stream == NULL)
+    {
+        GP_WARN("Failed to open frame capture '%s'.", capturePath);
+        return false;
+    }
+
+    char identifier[sizeof(FRAME_CAPTURE_IDENTIFIER)];
+    unsigned int version = 0;
+    unsigned int stringCount = 0;
+    unsigned int commandCount = 0;
+    bool result = stream->read(identifier, 1, sizeof(identifier)) == sizeof(identifier) &&
+        memcmp(identifier, FRAME_CAPTURE_IDENTIFIER, sizeof(identifier)) == 0 &&
+        stream->read(&version, sizeof(unsigned int), 1) == 1 && version == FRAME_CAPTURE_VERSION &&
+        stream->read(&stringCount, sizeof(unsigned int), 1) == 1 &&
+        stream->read(&commandCount, sizeof(unsigned int), 1) == 1;
+
+    std::vector<std::string> strings;
+    for (unsigned int i = 0; i < stringCount && result; ++i)
+    {
+        unsigned int length = 0;
+        result = stream->read(&length, sizeof(unsigned int), 1) == 1;
+        if (result)
+        {
+            strings.push_back(std::string(length, '\0'));
+            result = length == 0 || stream->read(&strings.back()[0], 1, length) == length;
+        }
+    }
+    std::vector<CapturedCommand> commands(commandCount);
+    if (result && commandCount > 0)
+        result = stream->read(&commands[0], sizeof(CapturedCommand), commandCount) == commandCount;
+    stream->close();
+    SAFE_DELETE(stream);
+    if (!result)
+    {
+        GP_WARN("Invalid or unsupported frame capture '%s'.", capturePath);
+        return false;
+    }
+
+    std::ostringstream csv;
+    csv << "index,command,target,object,count,size,redundant,node,nodeName,material,materialName,name\n";
+    for (unsigned int i = 0; i < commandCount; ++i)
+    {
+        const CapturedCommand& command = commands[i];
+        if (command.type >= COMMAND_TYPE_COUNT || command.node >= stringCount || command.material >= stringCount || command.name >= stringCount)
+        {
+            GP_WARN("Invalid command %u in frame capture '%s'.", i, capturePath);
+            return false;
+        }
+
+        csv << i << ',' << __commandNames[command.type] << ",0x" << std::hex << command.target << std::dec << ','
+            << command.object << ',' << command.count << ',' << command.size << ',' << (unsigned int)command.redundant << ','
+            << command.node << ',';
+        writeCsvField(csv, strings[command.node]);
+        csv << ',' << command.material << ',';
+        writeCsvField(csv, strings[command.material]);
+        csv << ',';
+        writeCsvField(csv, strings[command.name]);
+        csv << '\n';
+    }
+
+    stream = FileSystem::open(csvPath, FileSystem::WRITE);
+    if (stream == NULL)
+    {
+        GP_WARN("Failed to open file '%s' for writing the frame capture table.", csvPath);
+        return false;
+    }
+    const std::string text = csv.str();
+    result = stream->write(text.c_str(), 1, text.size()) == text.size();
+    stream->close();
+    SAFE_DELETE(stream);
+    if (!result)
+        GP_WARN("Failed to write the frame capture table to file '%s'.", csvPath);
+    return result;
+}
+
+}
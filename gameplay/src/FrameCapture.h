@@ -0,0 +1,210 @@
+#ifndef FRAMECAPTURE_H_
+#define FRAMECAPTURE_H_
+
+namespace gameplay
+{
+
+class Node;
+class Material;
+
+/**
+ * Defines the capture of the GL commands that the engine issues over a single frame.
+ *
+ * A capture records the program, texture, sampler, buffer and vertex array binds made
+ * through GLStateCache, including the binds that the cache skipped because the object was
+ * already bound, the uniform values set through Effect::setValue(), including the unchanged
+ * values that were not uploaded again, the render state changes made by RenderState, the
+ * draw calls counted by FrameStats with their primitive type and vertex or index count, and
+ * the buffer and texture data uploaded by the engine each frame with its size. Each command
+ * is recorded with the node and the material being drawn when it was issued, where known.
+ *
+ * A capture is requested with capture() and records the next whole frame, from the start of
+ * its graphics updates to the start of those of the following frame, on the thread that
+ * renders it. The commands issued by other threads, such as those uploading resources in the
+ * background, are not recorded. Once the frame is over, its commands are written to a compact
+ * binary file, which exportCsv() converts into a table of one command per row, to find the
+ * redundant binds and uploads of a frame or the nodes and materials that issue the most work.
+ *
+ * While no capture is active, recording a command costs a single test.
+ *
+ * @script{ignore}
+ */
+class FrameCapture
+{
+    friend class Game;
+
+public:
+
+    /**
+     * The kinds of commands in a capture.
+     */
+    enum CommandType
+    {
+        /**
+         * A program bind. The object is the program.
+         */
+        USE_PROGRAM,
+
+        /**
+         * A texture bind. The target is the texture target, the object is the texture and the count is the texture unit.
+         */
+        BIND_TEXTURE,
+
+        /**
+         * A sampler object bind. The object is the sampler and the count is the texture unit.
+         */
+        BIND_SAMPLER,
+
+        /**
+         * A buffer bind. The target is the buffer target and the object is the buffer.
+         */
+        BIND_BUFFER,
+
+        /**
+         * A vertex array object bind. The object is the vertex array.
+         */
+        BIND_VERTEX_ARRAY,
+
+        /**
+         * A uniform value set. The target is the uniform type, the object is the program, the size is
+         * the size of the value and the name is the name of the uniform.
+         */
+        SET_UNIFORM,
+
+        /**
+         * A render state block bind. The target is the bits of the states that were set and the count is
+         * the number of states that changed.
+         */
+        SET_RENDER_STATE,
+
+        /**
+         * A draw call. The target is the primitive type and the count is the number of vertices or
+         * indices drawn, over all the instances drawn.
+         */
+        DRAW,
+
+        /**
+         * A buffer data upload. The target is the buffer target, the object is the buffer, where known,
+         * and the size is the number of bytes uploaded.
+         */
+        UPLOAD_BUFFER,
+
+        /**
+         * A texture data upload. The target is the texture target, the object is the texture, where known,
+         * and the size is the number of bytes uploaded.
+         */
+        UPLOAD_TEXTURE,
+
+        /**
+         * The number of kinds of commands.
+         */
+        COMMAND_TYPE_COUNT
+    };
+
+    /**
+     * Sets the node and material that the commands issued over its lifetime are recorded with.
+     */
+    class Source
+    {
+    public:
+
+        /**
+         * Constructor. Sets the source of the next commands.
+         *
+         * @param node The node being drawn, or NULL to keep the node of the enclosing source.
+         * @param material The material being drawn with, or NULL to keep the material of the enclosing source.
+         */
+        Source(const Node* node, const Material* material);
+
+        /**
+         * Destructor. Restores the source of the enclosing scope.
+         */
+        ~Source();
+
+    private:
+
+        Source(const Source&);
+        Source& operator=(const Source&);
+
+        const Node* _node;
+        const Material* _material;
+        bool _active;
+    };
+
+    /**
+     * Captures the commands of the next frame to the given file.
+     *
+     * @param path The path of the file to write the capture to.
+     * @param maxCommands The maximum number of commands to record. Later commands are dropped.
+     *
+     * @return true if the capture was requested, false if a capture is already pending or active.
+     */
+    static bool capture(const char* path, unsigned int maxCommands = 1048576);
+
+    /**
+     * Determines if a capture is pending or active.
+     *
+     * @return true if the commands of the current or next frame are captured.
+     */
+    static bool isCapturing();
+
+    /**
+     * Converts a capture file into a table of comma separated values.
+     *
+     * The table has a row for each command, in the order they were issued, with the index, the kind,
+     * the target, object, count and size of the command, whether it was redundant, the indices and
+     * names of its node and material, and the name of its uniform.
+     *
+     * @param capturePath The path of the capture file to read.
+     * @param csvPath The path of the file to write the table to.
+     *
+     * @return true if the table was written, false otherwise.
+     */
+    static bool exportCsv(const char* capturePath, const char* csvPath);
+
+    /**
+     * Records a command if a capture is active.
+     *
+     * @param type The kind of the command.
+     * @param target The target of the command, as given for each kind of command.
+     * @param object The object of the command, as given for each kind of command.
+     * @param count The count of the command, as given for each kind of command.
+     * @param size The number of bytes of data of the command.
+     * @param redundant true if the command had no effect, such as the bind of an object that was already bound.
+     * @param name The name of the uniform of the command, or NULL.
+     */
+    inline static void record(CommandType type, unsigned int target, unsigned int object, unsigned int count = 0,
+                              unsigned int size = 0, bool redundant = false, const char* name = NULL);
+
+private:
+
+    /**
+     * Hidden constructor.
+     */
+    FrameCapture();
+
+    /**
+     * Records a command of the active capture.
+     */
+    static void recordCommand(CommandType type, unsigned int target, unsigned int object, unsigned int count,
+                              unsigned int size, bool redundant, const char* name);
+
+    /**
+     * Writes the capture of the frame that just ended, and begins the pending capture. Called by Game
+     * at the start of the graphics updates of each frame.
+     */
+    static void nextFrame();
+
+    /**
+     * Discards the pending or active capture. Called during game shutdown.
+     */
+    static void finalize();
+
+    static std::atomic<bool> _recording;
+};
+
+}
+
+#include "FrameCapture.inl"
+
+#endif
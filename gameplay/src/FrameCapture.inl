@@ -0,0 +1,13 @@
+#include "FrameCapture.h"
+
+namespace gameplay
+{
+
+inline void FrameCapture::record(CommandType type, unsigned int target, unsigned int object, unsigned int count,
+                                 unsigned int size, bool redundant, const char* name)
+{
+    if (_recording)
+        recordCommand(type, target, object, count, size, redundant, name);
+}
+
+}
@@ -0,0 +1,160 @@
+#include "Base.h"
+#include "FramePacer.h"
+#include "Profiler.h"
+
+// Time before the slot of a frame that the limiter stops sleeping and starts spinning, in milliseconds.
+#define FRAME_PACER_SPIN_TIME 2.0
+
+// Number of frames over which the work time is averaged before the divisor is adjusted.
+#define FRAME_PACER_ADJUST_INTERVAL 30
+
+// Highest divisor of the target frame rate of an adaptive limiter.
+#define FRAME_PACER_MAX_DIVISOR 4
+
+// Fraction of the frame interval the work of a frame may take over it before the rate is divided.
+#define FRAME_PACER_LATE_THRESHOLD 1.05f
+
+// Fraction of the next higher frame interval the work of a frame must be under before the divisor is lowered.
+#define FRAME_PACER_EARLY_THRESHOLD 0.8f
+
+// Weight of the latest frame in the mean and variance of the frame time.
+#define FRAME_PACER_STATISTICS_WEIGHT 0.05f
+
+// Fraction of the accumulated smoothing error fed back each frame.
+#define FRAME_PACER_DRIFT_CORRECTION 0.1f
+
+namespace gameplay
+{
+
+FramePacer::FramePacer()
+    : _targetFrameRate(0.0f), _frameRateLimit(0.0f), _adaptive(false), _smoothing(false), _divisor(1), _waited(false),
+      _workTime(0.0f), _workFrames(0), _historyCount(0), _historyIndex(0), _drift(0.0f),
+      _meanFrameTime(0.0f), _variance(0.0f)
+{
+    memset(_history, 0, sizeof(_history));
+}
+
+FramePacer::~FramePacer()
+{
+}
+
+void FramePacer::setTargetFrameRate(float framesPerSecond)
+{
+    _targetFrameRate = std::max(framesPerSecond, 0.0f);
+    _divisor = 1;
+    _workTime = 0.0f;
+    _workFrames = 0;
+    _waited = false;
+}
+
+void FramePacer::setFrameRateLimit(float framesPerSecond)
+{
+    framesPerSecond = std::max(framesPerSecond, 0.0f);
+    if (framesPerSecond == _frameRateLimit)
+        return;
+
+    _frameRateLimit = framesPerSecond;
+    _divisor = 1;
+    _workTime = 0.0f;
+    _workFrames = 0;
+    _waited = false;
+}
+
+float FramePacer::getLimitedFrameRate() const
+{
+    if (_frameRateLimit > 0.0f && (_targetFrameRate <= 0.0f || _frameRateLimit < _targetFrameRate))
+        return _frameRateLimit;
+    return _targetFrameRate;
+}
+
+float FramePacer::getPacedFrameRate() const
+{
+    return getLimitedFrameRate() / _divisor;
+}
+
+void FramePacer::waitForNextFrame()
+{
+    const float frameRate = getLimitedFrameRate();
+    if (frameRate <= 0.0f)
+        return;
+
+    typedef std::chrono::steady_clock Clock;
+    typedef std::chrono::duration<double, std::milli> Milliseconds;
+
+    Clock::time_point now = Clock::now();
+    if (_waited)
+    {
+        _workTime += (float)Milliseconds(now - _workStart).count();
+        if (++_workFrames == FRAME_PACER_ADJUST_INTERVAL)
+            adjustDivisor();
+    }
+    else
+    {
+        _nextFrame = now;
+    }
+
+    {
+        GP_PROFILE_SCOPE("FramePacer::wait");
+
+        // Sleeps overshoot by up to a scheduler tick, so the last part of the wait is spun.
+        const double remaining = Milliseconds(_nextFrame - now).count();
+        if (remaining > FRAME_PACER_SPIN_TIME)
+            std::this_thread::sleep_for(Milliseconds(remaining - FRAME_PACER_SPIN_TIME));
+        while ((now = Clock::now()) < _nextFrame)
+            std::this_thread::yield();
+    }
+
+    // A late frame starts the next interval from itself instead of shortening the frames after it.
+    const Clock::duration interval = std::chrono::duration_cast<Clock::duration>(Milliseconds(1000.0 * _divisor / frameRate));
+    _nextFrame += interval;
+    if (_nextFrame < now)
+        _nextFrame = now + interval;
+    _workStart = now;
+    _waited = true;
+}
+
+float FramePacer::update(float elapsedTime)
+{
+    // Track the mean and variance of the raw frame time with exponential weights.
+    const float delta = elapsedTime - _meanFrameTime;
+    _meanFrameTime += FRAME_PACER_STATISTICS_WEIGHT * delta;
+    _variance = (1.0f - FRAME_PACER_STATISTICS_WEIGHT) * (_variance + FRAME_PACER_STATISTICS_WEIGHT * delta * delta);
+    GP_PROFILE_COUNTER("Frame time", elapsedTime);
+    GP_PROFILE_COUNTER("Frame time deviation", sqrt(_variance));
+
+    _history[_historyIndex] = elapsedTime;
+    _historyIndex = (_historyIndex + 1) % (sizeof(_history) / sizeof(_history[0]));
+    _historyCount = std::min(_historyCount + 1, (unsigned int)(sizeof(_history) / sizeof(_history[0])));
+    if (!_smoothing)
+    {
+        _drift = 0.0f;
+        return elapsedTime;
+    }
+
+    float sum = 0.0f;
+    for (unsigned int i = 0; i < _historyCount; ++i)
+        sum += _history[i];
+
+    // Feed back part of the time the smoothed frames have gained or lost against the real ones.
+    float smoothed = sum / _historyCount + _drift * FRAME_PACER_DRIFT_CORRECTION;
+    smoothed = std::max(smoothed, 0.0f);
+    _drift += elapsedTime - smoothed;
+    return smoothed;
+}
+
+void FramePacer::adjustDivisor()
+{
+    const float workTime = _workTime / _workFrames;
+    _workTime = 0.0f;
+    _workFrames = 0;
+    if (!_adaptive)
+        return;
+
+    const float interval = 1000.0f / getLimitedFrameRate();
+    if (workTime > interval * _divisor * FRAME_PACER_LATE_THRESHOLD && _divisor < FRAME_PACER_MAX_DIVISOR)
+        ++_divisor;
+    else if (_divisor > 1 && workTime < interval * (_divisor - 1) * FRAME_PACER_EARLY_THRESHOLD)
+        --_divisor;
+}
+
+}
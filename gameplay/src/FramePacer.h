@@ -0,0 +1,117 @@
+#ifndef FRAMEPACER_H_
+#define FRAMEPACER_H_
+
+namespace gameplay
+{
+
+/**
+ * Defines the pacing of frames to a target frame rate.
+ *
+ * While a target frame rate is set, each frame is held until its slot comes up: the
+ * limiter sleeps through most of the wait and spins through the last couple of
+ * milliseconds, since sleeps are only accurate to the scheduler tick. When frames are
+ * late, the next slot starts from the late frame rather than bursting to catch up.
+ *
+ * With an adaptive frame rate, the limiter divides the target rate by the smallest whole
+ * number (up to 4) that the frames keep up with, so that a game which cannot hold 60 frames
+ * per second is paced evenly at 30 rather than alternating between the two.
+ *
+ * The elapsed time of frames can also be smoothed over the last few frames, which evens out
+ * the motion of games whose frame times jitter. The difference with the real elapsed time
+ * is fed back over the following frames, so the game time does not drift.
+ *
+ * The time and standard deviation of frames are reported to the profiler as the counters
+ * "Frame time" and "Frame time deviation".
+ *
+ * Game owns the frame pacer and forwards its settings.
+ *
+ * @script{ignore}
+ */
+class FramePacer
+{
+    friend class Game;
+
+private:
+
+    /**
+     * Constructor.
+     */
+    FramePacer();
+
+    /**
+     * Destructor.
+     */
+    ~FramePacer();
+
+    /**
+     * Hidden copy constructor.
+     */
+    FramePacer(const FramePacer&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    FramePacer& operator=(const FramePacer&);
+
+    /**
+     * Sets the target frame rate, or zero to not limit the frame rate.
+     */
+    void setTargetFrameRate(float framesPerSecond);
+
+    /**
+     * Sets the highest rate frames are paced to whatever the target frame rate, or zero for none.
+     *
+     * Used by the performance governor, so that the target frame rate of the game keeps its value.
+     */
+    void setFrameRateLimit(float framesPerSecond);
+
+    /**
+     * Gets the target frame rate capped by the frame rate limit, or zero if frames are not paced.
+     */
+    float getLimitedFrameRate() const;
+
+    /**
+     * Gets the frame rate the limiter currently paces frames to, or zero if it is not limited.
+     */
+    float getPacedFrameRate() const;
+
+    /**
+     * Holds the calling thread until the slot of the next frame.
+     *
+     * Called by Game at the start of each frame.
+     */
+    void waitForNextFrame();
+
+    /**
+     * Records the elapsed time of a frame and returns the time to advance the game by.
+     *
+     * Called by Game with the elapsed game time of each running frame.
+     */
+    float update(float elapsedTime);
+
+    /**
+     * Moves the divisor of the target frame rate towards the rate frames keep up with.
+     */
+    void adjustDivisor();
+
+    float _targetFrameRate;
+    float _frameRateLimit;
+    bool _adaptive;
+    bool _smoothing;
+    unsigned int _divisor;
+    std::chrono::steady_clock::time_point _nextFrame;
+    std::chrono::steady_clock::time_point _workStart;
+    bool _waited;
+    float _workTime;
+    unsigned int _workFrames;
+    float _history[8];
+    unsigned int _historyCount;
+    unsigned int _historyIndex;
+    float _drift;
+    float _meanFrameTime;
+    float _variance;
+};
+
+}
+
+#endif
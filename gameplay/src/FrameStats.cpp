@@ -0,0 +1,26 @@
+#include "Base.h"
+#include "FrameStats.h"
+
+namespace gameplay
+{
+
+FrameStats FrameStats::_current;
+
+FrameStats::FrameStats()
+    : drawCalls(0), triangles(0), vertices(0), programBinds(0), textureBinds(0), stateChanges(0), uniformUploads(0), uniformsSkipped(0)
+{
+}
+
+void FrameStats::reset()
+{
+    drawCalls = 0;
+    triangles = 0;
+    vertices = 0;
+    programBinds = 0;
+    textureBinds = 0;
+    stateChanges = 0;
+    uniformUploads = 0;
+    uniformsSkipped = 0;
+}
+
+}
@@ -0,0 +1,119 @@
+#ifndef FRAMESTATS_H_
+#define FRAMESTATS_H_
+
+namespace gameplay
+{
+
+/**
+ * Defines the rendering statistics gathered over a single frame.
+ *
+ * The draw calls and primitives submitted through Model and MeshBatch, the
+ * program, texture and render state changes made through Effect::bind(),
+ * Texture::Sampler::bind() and RenderState::StateBlock, and the uniform values
+ * set through Effect::setValue() are counted while a frame
+ * is rendered. The counters are reset at the start of every frame and the
+ * statistics of the last completed frame can be retrieved with Game::getFrameStats().
+ */
+class FrameStats
+{
+    friend class Game;
+
+public:
+
+    /**
+     * Constructor.
+     */
+    FrameStats();
+
+    /**
+     * Resets all the counters to zero.
+     */
+    void reset();
+
+    /**
+     * The number of draw calls submitted.
+     */
+    unsigned int drawCalls;
+
+    /**
+     * The number of triangles submitted (triangle lists and strips only).
+     */
+    unsigned int triangles;
+
+    /**
+     * The number of vertices (or indices, for indexed draws) submitted.
+     */
+    unsigned int vertices;
+
+    /**
+     * The number of shader programs bound.
+     */
+    unsigned int programBinds;
+
+    /**
+     * The number of textures bound.
+     */
+    unsigned int textureBinds;
+
+    /**
+     * The number of fixed-function render states changed.
+     */
+    unsigned int stateChanges;
+
+    /**
+     * The number of uniform values uploaded to shader programs.
+     */
+    unsigned int uniformUploads;
+
+    /**
+     * The number of uniform values that were not uploaded because the program already held them.
+     */
+    unsigned int uniformsSkipped;
+
+    /**
+     * Records a draw call in the current frame's statistics.
+     *
+     * @param primitiveType The GL primitive type drawn.
+     * @param vertexCount The number of vertices or indices drawn.
+     * @script{ignore}
+     */
+    inline static void recordDraw(GLenum primitiveType, unsigned int vertexCount);
+
+    /**
+     * Records a shader program bind in the current frame's statistics.
+     * @script{ignore}
+     */
+    inline static void recordProgramBind();
+
+    /**
+     * Records a texture bind in the current frame's statistics.
+     * @script{ignore}
+     */
+    inline static void recordTextureBind();
+
+    /**
+     * Records render state changes in the current frame's statistics.
+     *
+     * @param count The number of render states that were changed.
+     * @script{ignore}
+     */
+    inline static void recordStateChanges(unsigned int count);
+
+    /**
+     * Records a uniform value being set in the current frame's statistics.
+     *
+     * @param uploaded true if the value was uploaded, false if it was skipped because it was unchanged.
+     * @script{ignore}
+     */
+    inline static void recordUniform(bool uploaded);
+
+private:
+
+    static FrameStats _current;
+};
+
+}
+
+#include "FrameStats.inl"
+
+#endif
@@ -0,0 +1,50 @@
+#include "FrameStats.h"
+#include "FrameCapture.h"
+
+namespace gameplay
+{
+
+inline void FrameStats::recordDraw(GLenum primitiveType, unsigned int vertexCount)
+{
+    FrameCapture::record(FrameCapture::DRAW, primitiveType, 0, vertexCount);
+
+    ++_current.drawCalls;
+    _current.vertices += vertexCount;
+
+    switch (primitiveType)
+    {
+    case GL_TRIANGLES:
+        _current.triangles += vertexCount / 3;
+        break;
+    case GL_TRIANGLE_STRIP:
+        _current.triangles += vertexCount > 2 ? vertexCount - 2 : 0;
+        break;
+    default:
+        break;
+    }
+}
+
+inline void FrameStats::recordProgramBind()
+{
+    ++_current.programBinds;
+}
+
+inline void FrameStats::recordTextureBind()
+{
+    ++_current.textureBinds;
+}
+
+inline void FrameStats::recordStateChanges(unsigned int count)
+{
+    _current.stateChanges += count;
+}
+
+inline void FrameStats::recordUniform(bool uploaded)
+{
+    if (uploaded)
+        ++_current.uniformUploads;
+    else
+        ++_current.uniformsSkipped;
+}
+
+}
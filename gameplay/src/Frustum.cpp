@@ -2,6 +2,7 @@
 #include "Frustum.h"
 #include "BoundingSphere.h"
 #include "BoundingBox.h"
+#include "MathUtil.h"
 
 namespace gameplay
 {
@@ -120,6 +121,41 @@ bool Frustum::intersects(const BoundingBox& box) const
     return box.intersects(*this);
 }
 
+unsigned int Frustum::intersects(const BoundingSphere* spheres, unsigned int count, unsigned int* visible) const
+{
+    static_assert(sizeof(BoundingSphere) == sizeof(float) * 4, "BoundingSphere must be laid out as (x, y, z, radius).");
+    GP_ASSERT(count == 0 || (spheres && visible));
+
+    memset(visible, 0, ((count + 31) / 32) * sizeof(unsigned int));
+    float planes[24];
+    getPlanes(planes);
+    return MathUtil::cullSpheres(planes, &spheres->center.x, count, visible);
+}
+
+unsigned int Frustum::intersects(const BoundingBox* boxes, unsigned int count, unsigned int* visible) const
+{
+    static_assert(sizeof(BoundingBox) == sizeof(float) * 6, "BoundingBox must be laid out as (min, max).");
+    GP_ASSERT(count == 0 || (boxes && visible));
+
+    memset(visible, 0, ((count + 31) / 32) * sizeof(unsigned int));
+    float planes[24];
+    getPlanes(planes);
+    return MathUtil::cullBoxes(planes, &boxes->min.x, count, visible);
+}
+
+void Frustum::getPlanes(float* planes) const
+{
+    const Plane* sides[6] = { &_near, &_far, &_left, &_right, &_bottom, &_top };
+    for (unsigned int i = 0; i < 6; ++i)
+    {
+        const Vector3& normal = sides[i]->getNormal();
+        planes[i * 4] = normal.x;
+        planes[i * 4 + 1] = normal.y;
+        planes[i * 4 + 2] = normal.z;
+        planes[i * 4 + 3] = sides[i]->getDistance();
+    }
+}
+
 float Frustum::intersects(const Plane& plane) const
 {
     return plane.intersects(*this);
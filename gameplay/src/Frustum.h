@@ -171,6 +171,38 @@ public:
      */
     bool intersects(const BoundingBox& box) const;
 
+    /**
+     * Tests an array of bounding spheres against this frustum at once.
+     *
+     * The spheres are tested four at a time with SSE or NEON instructions where available.
+     * A sphere is visible when Frustum::intersects(const BoundingSphere&) would return true for it.
+     *
+     * @param spheres The contiguous array of spheres to test.
+     * @param count The number of spheres.
+     * @param visible The bitmask to set, of at least (count + 31) / 32 words. Bit (i % 32) of
+     *      word (i / 32) is set if sphere i is visible, and cleared otherwise.
+     *
+     * @return The number of visible spheres.
+     * @script{ignore}
+     */
+    unsigned int intersects(const BoundingSphere* spheres, unsigned int count, unsigned int* visible) const;
+
+    /**
+     * Tests an array of bounding boxes against this frustum at once.
+     *
+     * The boxes are tested four at a time with SSE or NEON instructions where available.
+     * A box is visible when Frustum::intersects(const BoundingBox&) would return true for it.
+     *
+     * @param boxes The contiguous array of boxes to test.
+     * @param count The number of boxes.
+     * @param visible The bitmask to set, of at least (count + 31) / 32 words. Bit (i % 32) of
+     *      word (i / 32) is set if box i is visible, and cleared otherwise.
+     *
+     * @return The number of visible boxes.
+     * @script{ignore}
+     */
+    unsigned int intersects(const BoundingBox* boxes, unsigned int count, unsigned int* visible) const;
+
     /**
      * Tests whether this frustum intersects the specified plane.
      *
@@ -214,6 +246,11 @@ private:
      */
     void updatePlanes();
 
+    /**
+     * Gets the six planes of the frustum as (nx, ny, nz, d) quadruples.
+     */
+    void getPlanes(float* planes) const;
+
     Plane _near;
     Plane _far;
     Plane _bottom;
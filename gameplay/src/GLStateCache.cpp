@@ -0,0 +1,252 @@
+#include "Base.h"
+#include "GLStateCache.h"
+
+// The number of frames after which deleted objects are freed when sync objects are not supported.
+#define GLSTATECACHE_DELETE_FRAMES 3
+
+namespace gameplay
+{
+
+// The kinds of deleted objects, each of which is freed in one call per batch.
+enum DeletedObjectType
+{
+    DELETED_PROGRAM,
+    DELETED_TEXTURE,
+    DELETED_SAMPLER,
+    DELETED_BUFFER,
+    DELETED_VERTEX_ARRAY,
+    DELETED_FRAMEBUFFER,
+    DELETED_RENDERBUFFER,
+    DELETED_OBJECT_TYPE_COUNT
+};
+
+// The objects deleted in a frame, waiting for the GPU to be done with them.
+struct DeleteBatch
+{
+    std::vector<GLuint> objects[DELETED_OBJECT_TYPE_COUNT];
+#ifdef GP_USE_BUFFER_SYNC
+    GLsync fence;
+#endif
+    unsigned int frame;
+};
+
+// The objects deleted since the last frame, which may be deleted by the upload thread as well.
+static std::vector<GLuint> __deletedObjects[DELETED_OBJECT_TYPE_COUNT];
+static std::mutex __deletedObjectsMutex;
+
+// The batches of earlier frames, in the order they were fenced.
+static std::deque<DeleteBatch*> __deleteBatches;
+static unsigned int __deleteFrame = 0;
+
+static void deleteLater(DeletedObjectType type, GLuint object)
+{
+    std::lock_guard<std::mutex> lock(__deletedObjectsMutex);
+    __deletedObjects[type].push_back(object);
+}
+
+static void freeObjects(std::vector<GLuint>* objects)
+{
+    // Programs are the only objects without a call that frees several of them.
+    for (size_t i = 0, count = objects[DELETED_PROGRAM].size(); i < count; ++i)
+    {
+        GL_ASSERT( glDeleteProgram(objects[DELETED_PROGRAM][i]) );
+    }
+    if (!objects[DELETED_TEXTURE].empty())
+        GL_ASSERT( glDeleteTextures((GLsizei)objects[DELETED_TEXTURE].size(), &objects[DELETED_TEXTURE][0]) );
+#ifdef GP_USE_SAMPLER_OBJECTS
+    if (!objects[DELETED_SAMPLER].empty())
+        GL_ASSERT( glDeleteSamplers((GLsizei)objects[DELETED_SAMPLER].size(), &objects[DELETED_SAMPLER][0]) );
+#endif
+    if (!objects[DELETED_BUFFER].empty())
+        GL_ASSERT( glDeleteBuffers((GLsizei)objects[DELETED_BUFFER].size(), &objects[DELETED_BUFFER][0]) );
+#ifdef GP_USE_VAO
+    if (!objects[DELETED_VERTEX_ARRAY].empty())
+        GL_ASSERT( glDeleteVertexArrays((GLsizei)objects[DELETED_VERTEX_ARRAY].size(), &objects[DELETED_VERTEX_ARRAY][0]) );
+#endif
+    if (!objects[DELETED_FRAMEBUFFER].empty())
+        GL_ASSERT( glDeleteFramebuffers((GLsizei)objects[DELETED_FRAMEBUFFER].size(), &objects[DELETED_FRAMEBUFFER][0]) );
+    if (!objects[DELETED_RENDERBUFFER].empty())
+        GL_ASSERT( glDeleteRenderbuffers((GLsizei)objects[DELETED_RENDERBUFFER].size(), &objects[DELETED_RENDERBUFFER][0]) );
+    for (unsigned int i = 0; i < DELETED_OBJECT_TYPE_COUNT; ++i)
+    {
+        objects[i].clear();
+    }
+}
+
+static void freeBatch(DeleteBatch* batch)
+{
+#ifdef GP_USE_BUFFER_SYNC
+    if (batch->fence)
+        GL_ASSERT( glDeleteSync(batch->fence) );
+#endif
+    freeObjects(batch->objects);
+    SAFE_DELETE(batch);
+}
+
+GLuint GLStateCache::_program = GLStateCache::UNKNOWN;
+unsigned int GLStateCache::_activeTexture = 0;
+TextureHandle GLStateCache::_textures[GLStateCache::TEXTURE_UNIT_COUNT] = { 0 };
+TextureHandle GLStateCache::_cubeTextures[GLStateCache::TEXTURE_UNIT_COUNT] = { 0 };
+#ifdef GP_USE_TEXTURE_ARRAYS
+TextureHandle GLStateCache::_arrayTextures[GLStateCache::TEXTURE_UNIT_COUNT] = { 0 };
+#endif
+#ifdef GP_USE_SAMPLER_OBJECTS
+GLuint GLStateCache::_samplers[GLStateCache::TEXTURE_UNIT_COUNT] = { 0 };
+#endif
+GLuint GLStateCache::_arrayBuffer = GLStateCache::UNKNOWN;
+GLuint GLStateCache::_elementArrayBuffer = GLStateCache::UNKNOWN;
+GLuint GLStateCache::_vertexArray = GLStateCache::UNKNOWN;
+
+// Deleted objects stay bound in OpenGL until they are freed, at which point OpenGL resets
+// their bindings, so their cached bindings are unknown rather than zero.
+
+void GLStateCache::deleteProgram(GLuint program)
+{
+    if (_program == program)
+        _program = UNKNOWN;
+    deleteLater(DELETED_PROGRAM, program);
+}
+
+void GLStateCache::deleteTexture(TextureHandle texture)
+{
+    for (unsigned int i = 0; i < TEXTURE_UNIT_COUNT; ++i)
+    {
+        if (_textures[i] == texture)
+            _textures[i] = UNKNOWN;
+        if (_cubeTextures[i] == texture)
+            _cubeTextures[i] = UNKNOWN;
+#ifdef GP_USE_TEXTURE_ARRAYS
+        if (_arrayTextures[i] == texture)
+            _arrayTextures[i] = UNKNOWN;
+#endif
+    }
+    deleteLater(DELETED_TEXTURE, texture);
+}
+
+#ifdef GP_USE_SAMPLER_OBJECTS
+void GLStateCache::deleteSampler(GLuint sampler)
+{
+    for (unsigned int i = 0; i < TEXTURE_UNIT_COUNT; ++i)
+    {
+        if (_samplers[i] == sampler)
+            _samplers[i] = UNKNOWN;
+    }
+    deleteLater(DELETED_SAMPLER, sampler);
+}
+#endif
+
+void GLStateCache::deleteBuffer(GLuint buffer)
+{
+    if (_arrayBuffer == buffer)
+        _arrayBuffer = UNKNOWN;
+    if (_elementArrayBuffer == buffer)
+        _elementArrayBuffer = UNKNOWN;
+    deleteLater(DELETED_BUFFER, buffer);
+}
+
+#ifdef GP_USE_VAO
+void GLStateCache::deleteVertexArray(GLuint vertexArray)
+{
+    if (_vertexArray == vertexArray)
+    {
+        _vertexArray = UNKNOWN;
+        _elementArrayBuffer = UNKNOWN;
+    }
+    deleteLater(DELETED_VERTEX_ARRAY, vertexArray);
+}
+#endif
+
+void GLStateCache::deleteFramebuffer(GLuint framebuffer)
+{
+    deleteLater(DELETED_FRAMEBUFFER, framebuffer);
+}
+
+void GLStateCache::deleteRenderbuffer(GLuint renderbuffer)
+{
+    deleteLater(DELETED_RENDERBUFFER, renderbuffer);
+}
+
+void GLStateCache::nextFrame()
+{
+    GP_PROFILE_SCOPE("GLStateCache::nextFrame");
+    ++__deleteFrame;
+
+    // The fences complete in order, so the batches are freed from the oldest until one is still in use.
+    while (!__deleteBatches.empty())
+    {
+        DeleteBatch* batch = __deleteBatches.front();
+        bool done = __deleteFrame - batch->frame >= GLSTATECACHE_DELETE_FRAMES;
+#ifdef GP_USE_BUFFER_SYNC
+        if (batch->fence)
+        {
+            GLenum result;
+            GL_ASSERT( result = glClientWaitSync(batch->fence, 0, 0) );
+            done = result != GL_TIMEOUT_EXPIRED;
+        }
+#endif
+        if (!done)
+            break;
+        __deleteBatches.pop_front();
+        freeBatch(batch);
+    }
+
+    DeleteBatch* batch = NULL;
+    {
+        std::lock_guard<std::mutex> lock(__deletedObjectsMutex);
+        for (unsigned int i = 0; i < DELETED_OBJECT_TYPE_COUNT; ++i)
+        {
+            if (__deletedObjects[i].empty())
+                continue;
+            if (!batch)
+                batch = new DeleteBatch();
+            batch->objects[i].swap(__deletedObjects[i]);
+        }
+    }
+    if (!batch)
+        return;
+
+    batch->frame = __deleteFrame;
+#ifdef GP_USE_BUFFER_SYNC
+    batch->fence = 0;
+    if (glFenceSync && glClientWaitSync && glDeleteSync)
+        GL_ASSERT( batch->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) );
+#endif
+    __deleteBatches.push_back(batch);
+}
+
+void GLStateCache::finalize()
+{
+    for (size_t i = 0, count = __deleteBatches.size(); i < count; ++i)
+    {
+        freeBatch(__deleteBatches[i]);
+    }
+    __deleteBatches.clear();
+
+    std::lock_guard<std::mutex> lock(__deletedObjectsMutex);
+    freeObjects(__deletedObjects);
+}
+
+void GLStateCache::invalidate()
+{
+    _program = UNKNOWN;
+    _arrayBuffer = UNKNOWN;
+    _elementArrayBuffer = UNKNOWN;
+    _vertexArray = UNKNOWN;
+    for (unsigned int i = 0; i < TEXTURE_UNIT_COUNT; ++i)
+    {
+        _textures[i] = UNKNOWN;
+        _cubeTextures[i] = UNKNOWN;
+#ifdef GP_USE_TEXTURE_ARRAYS
+        _arrayTextures[i] = UNKNOWN;
+#endif
+#ifdef GP_USE_SAMPLER_OBJECTS
+        _samplers[i] = UNKNOWN;
+#endif
+    }
+
+    // The texture bindings are tracked per unit, so the active unit must be known.
+    GL_ASSERT( glActiveTexture(GL_TEXTURE0) );
+    _activeTexture = 0;
+}
+
+}
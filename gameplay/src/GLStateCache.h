@@ -0,0 +1,193 @@
+#ifndef GLSTATECACHE_H_
+#define GLSTATECACHE_H_
+
+namespace gameplay
+{
+
+/**
+ * Defines a cache of the OpenGL object bindings made by the engine.
+ *
+ * The cache shadows the current program, the active texture unit, the 2D, cube map
+ * and 2D array textures and the sampler object bound to each texture unit, the array and
+ * element array buffers and the vertex array object. Binding an object that is already bound returns without
+ * calling OpenGL.
+ *
+ * All engine code binds these objects through the cache, and deletes them through it
+ * so that the bindings OpenGL resets on deletion are reset in the cache as well. Code
+ * that binds these objects by calling OpenGL directly must call invalidate() afterwards.
+ *
+ * Objects are not freed as they are deleted, which is often in the middle of a frame
+ * while the GPU may still be drawing with them. The objects deleted in a frame are
+ * collected, and freed in one call per kind of object by nextFrame() once the GPU is done
+ * with the commands issued before their deletion, as told by a fence where sync objects
+ * are supported, or a few frames later otherwise. Deleted objects must not be used again.
+ *
+ * The element array buffer binding is part of the vertex array object state, so it
+ * becomes unknown whenever a different vertex array object is bound.
+ *
+ * @script{ignore}
+ */
+class GLStateCache
+{
+public:
+
+    /**
+     * The number of texture units tracked by the cache.
+     */
+    static const unsigned int TEXTURE_UNIT_COUNT = 32;
+
+    /**
+     * Makes a program current.
+     *
+     * @param program The program to use.
+     */
+    inline static void useProgram(GLuint program);
+
+    /**
+     * Selects the active texture unit.
+     *
+     * @param unit The index of the texture unit, less than TEXTURE_UNIT_COUNT.
+     */
+    inline static void activeTexture(unsigned int unit);
+
+    /**
+     * Binds a texture to the active texture unit.
+     *
+     * @param target The texture target, GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP or GL_TEXTURE_2D_ARRAY.
+     * @param texture The texture to bind.
+     */
+    inline static void bindTexture(GLenum target, TextureHandle texture);
+
+#ifdef GP_USE_SAMPLER_OBJECTS
+    /**
+     * Binds a sampler object to the active texture unit.
+     *
+     * @param sampler The sampler object to bind, or zero to sample with the parameters of the texture.
+     */
+    inline static void bindSampler(GLuint sampler);
+#endif
+
+    /**
+     * Binds a buffer.
+     *
+     * @param target The buffer target, GL_ARRAY_BUFFER or GL_ELEMENT_ARRAY_BUFFER.
+     * @param buffer The buffer to bind.
+     */
+    inline static void bindBuffer(GLenum target, GLuint buffer);
+
+#ifdef GP_USE_VAO
+    /**
+     * Binds a vertex array object.
+     *
+     * @param vertexArray The vertex array object to bind.
+     */
+    inline static void bindVertexArray(GLuint vertexArray);
+#endif
+
+    /**
+     * Deletes a program.
+     *
+     * @param program The program to delete.
+     */
+    static void deleteProgram(GLuint program);
+
+    /**
+     * Deletes a texture, unbinding it from every texture unit.
+     *
+     * @param texture The texture to delete.
+     */
+    static void deleteTexture(TextureHandle texture);
+
+#ifdef GP_USE_SAMPLER_OBJECTS
+    /**
+     * Deletes a sampler object, unbinding it from every texture unit.
+     *
+     * @param sampler The sampler object to delete.
+     */
+    static void deleteSampler(GLuint sampler);
+#endif
+
+    /**
+     * Deletes a buffer, unbinding it from the buffer targets.
+     *
+     * @param buffer The buffer to delete.
+     */
+    static void deleteBuffer(GLuint buffer);
+
+#ifdef GP_USE_VAO
+    /**
+     * Deletes a vertex array object, unbinding it if it is bound.
+     *
+     * @param vertexArray The vertex array object to delete.
+     */
+    static void deleteVertexArray(GLuint vertexArray);
+#endif
+
+    /**
+     * Deletes a framebuffer, which must not be bound.
+     *
+     * @param framebuffer The framebuffer to delete.
+     */
+    static void deleteFramebuffer(GLuint framebuffer);
+
+    /**
+     * Deletes a renderbuffer.
+     *
+     * @param renderbuffer The renderbuffer to delete.
+     */
+    static void deleteRenderbuffer(GLuint renderbuffer);
+
+    /**
+     * Frees the deleted objects that the GPU is done with, and fences the objects deleted since
+     * the last call.
+     *
+     * This is called by the game once per frame.
+     */
+    static void nextFrame();
+
+    /**
+     * Frees all of the deleted objects right away.
+     *
+     * This is called by the game on shutdown, while its graphics context is still current.
+     */
+    static void finalize();
+
+    /**
+     * Forgets all of the cached bindings, so that the next bind of each kind calls OpenGL.
+     *
+     * This must be called after code outside of the engine changes any of the cached bindings.
+     */
+    static void invalidate();
+
+private:
+
+    /**
+     * The binding of objects that have not been bound through the cache since it was invalidated.
+     */
+    static const GLuint UNKNOWN = 0xFFFFFFFF;
+
+    /**
+     * Hidden constructor.
+     */
+    GLStateCache();
+
+    static GLuint _program;
+    static unsigned int _activeTexture;
+    static TextureHandle _textures[TEXTURE_UNIT_COUNT];
+    static TextureHandle _cubeTextures[TEXTURE_UNIT_COUNT];
+#ifdef GP_USE_TEXTURE_ARRAYS
+    static TextureHandle _arrayTextures[TEXTURE_UNIT_COUNT];
+#endif
+#ifdef GP_USE_SAMPLER_OBJECTS
+    static GLuint _samplers[TEXTURE_UNIT_COUNT];
+#endif
+    static GLuint _arrayBuffer;
+    static GLuint _elementArrayBuffer;
+    static GLuint _vertexArray;
+};
+
+}
+
+#include "GLStateCache.inl"
+
+#endif
@@ -0,0 +1,90 @@
+#include "GLStateCache.h"
+#include "FrameStats.h"
+#include "FrameCapture.h"
+
+namespace gameplay
+{
+
+inline void GLStateCache::useProgram(GLuint program)
+{
+    FrameCapture::record(FrameCapture::USE_PROGRAM, 0, program, 0, 0, _program == program);
+    if (_program != program)
+    {
+        GL_ASSERT( glUseProgram(program) );
+        FrameStats::recordProgramBind();
+        _program = program;
+    }
+}
+
+inline void GLStateCache::activeTexture(unsigned int unit)
+{
+    GP_ASSERT(unit < TEXTURE_UNIT_COUNT);
+
+    if (_activeTexture != unit)
+    {
+        GL_ASSERT( glActiveTexture(GL_TEXTURE0 + unit) );
+        _activeTexture = unit;
+    }
+}
+
+inline void GLStateCache::bindTexture(GLenum target, TextureHandle texture)
+{
+#ifdef GP_USE_TEXTURE_ARRAYS
+    GP_ASSERT(target == GL_TEXTURE_2D || target == GL_TEXTURE_CUBE_MAP || target == GL_TEXTURE_2D_ARRAY);
+
+    TextureHandle& bound = target == GL_TEXTURE_CUBE_MAP ? _cubeTextures[_activeTexture] :
+        (target == GL_TEXTURE_2D_ARRAY ? _arrayTextures[_activeTexture] : _textures[_activeTexture]);
+#else
+    GP_ASSERT(target == GL_TEXTURE_2D || target == GL_TEXTURE_CUBE_MAP);
+
+    TextureHandle& bound = target == GL_TEXTURE_CUBE_MAP ? _cubeTextures[_activeTexture] : _textures[_activeTexture];
+#endif
+    FrameCapture::record(FrameCapture::BIND_TEXTURE, target, texture, _activeTexture, 0, bound == texture);
+    if (bound != texture)
+    {
+        GL_ASSERT( glBindTexture(target, texture) );
+        FrameStats::recordTextureBind();
+        bound = texture;
+    }
+}
+
+#ifdef GP_USE_SAMPLER_OBJECTS
+inline void GLStateCache::bindSampler(GLuint sampler)
+{
+    GLuint& bound = _samplers[_activeTexture];
+    FrameCapture::record(FrameCapture::BIND_SAMPLER, 0, sampler, _activeTexture, 0, bound == sampler);
+    if (bound != sampler)
+    {
+        GL_ASSERT( glBindSampler(_activeTexture, sampler) );
+        bound = sampler;
+    }
+}
+#endif
+
+inline void GLStateCache::bindBuffer(GLenum target, GLuint buffer)
+{
+    GP_ASSERT(target == GL_ARRAY_BUFFER || target == GL_ELEMENT_ARRAY_BUFFER);
+
+    GLuint& bound = target == GL_ARRAY_BUFFER ? _arrayBuffer : _elementArrayBuffer;
+    FrameCapture::record(FrameCapture::BIND_BUFFER, target, buffer, 0, 0, bound == buffer);
+    if (bound != buffer)
+    {
+        GL_ASSERT( glBindBuffer(target, buffer) );
+        bound = buffer;
+    }
+}
+
+#ifdef GP_USE_VAO
+inline void GLStateCache::bindVertexArray(GLuint vertexArray)
+{
+    FrameCapture::record(FrameCapture::BIND_VERTEX_ARRAY, 0, vertexArray, 0, 0, _vertexArray == vertexArray);
+    if (_vertexArray != vertexArray)
+    {
+        GL_ASSERT( glBindVertexArray(vertexArray) );
+        _vertexArray = vertexArray;
+        _elementArrayBuffer = UNKNOWN;
+    }
+}
+#endif
+
+}
@@ -2,9 +2,30 @@
 #include "Game.h"
 #include "Platform.h"
 #include "RenderState.h"
+#include "GLStateCache.h"
+#include "ViewUniformBuffer.h"
+#include "JointTexture.h"
 #include "FileSystem.h"
 #include "FrameBuffer.h"
+#include "DynamicBuffer.h"
+#include "MeshBufferPool.h"
+#include "RenderTargetPool.h"
+#include "MemoryArena.h"
+#include "StringTable.h"
+#include "ResourceManager.h"
+#include "ParticleEmitterPool.h"
+#include "ParticleSystem.h"
+#include "DynamicResolution.h"
+#include "FramePacer.h"
+#include "PerformanceGovernor.h"
+#include "PerformanceHud.h"
+#include "RenderThread.h"
+#include "UploadThread.h"
+#include "InputRecorder.h"
+#include "FrameCapture.h"
+#include "LoadingScreen.h"
 #include "SceneLoader.h"
+#include "Bundle.h"
 #include "ControlFactory.h"
 #include "Theme.h"
 #include "Form.h"
@@ -18,9 +39,45 @@ namespace gameplay
 {
 
 static Game* __gameInstance = NULL;
+static std::recursive_mutex __subsystemMutex;
 double Game::_pausedTimeLast = 0.0;
 double Game::_pausedTimeTotal = 0.0;
 
+// The internal subsystem update stages run each frame before the user update.
+#define UPDATE_STAGE_ANIMATION  0x01
+#define UPDATE_STAGE_PHYSICS    0x02
+#define UPDATE_STAGE_AI         0x04
+#define UPDATE_STAGE_GAMEPAD    0x08
+#define UPDATE_STAGE_AUDIO      0x10
+#define UPDATE_STAGE_FORMS      0x20
+
+/**
+ * Describes an update stage, the stages it must run after and whether
+ * it must run on the main thread (because it may invoke user callbacks).
+ */
+struct UpdateStageInfo
+{
+    unsigned int stage;
+    unsigned int dependencies;
+    bool mainThread;
+};
+
+// Physics must run after animation since animated nodes can drive kinematic bodies,
+// and AI agents expect to see the animated poses of the current frame.
+// While the physics step runs on a worker, the main thread only runs the AI update, whose
+// callbacks must not touch the physics world or the nodes of collision objects. Gamepad
+// events, audio and forms invoke user callbacks that may move any node, so they wait for
+// the step to complete.
+static const UpdateStageInfo __updateStages[] =
+{
+    { UPDATE_STAGE_ANIMATION, 0, true },
+    { UPDATE_STAGE_PHYSICS, UPDATE_STAGE_ANIMATION, false },
+    { UPDATE_STAGE_AI, UPDATE_STAGE_ANIMATION, true },
+    { UPDATE_STAGE_GAMEPAD, UPDATE_STAGE_PHYSICS, true },
+    { UPDATE_STAGE_AUDIO, UPDATE_STAGE_PHYSICS, true },
+    { UPDATE_STAGE_FORMS, UPDATE_STAGE_PHYSICS, true }
+};
+
 /**
 * @script{ignore}
 */
@@ -44,6 +101,7 @@ class GameScriptTarget : public ScriptTarget
     GP_SCRIPT_EVENT(gestureDragEvent, "ii");
     GP_SCRIPT_EVENT(gestureDropEvent, "ii");
     GP_SCRIPT_EVENT(gamepadEvent, "[Gamepad::GamepadEvent]<Gamepad>");
+    GP_SCRIPT_EVENT(performanceLevelEvent, "[Game::PerformanceLevel]");
     GP_SCRIPT_EVENTS_END();
 
 public:
@@ -61,11 +119,12 @@ public:
 
 Game::Game()
     : _initialized(false), _state(UNINITIALIZED), _pausedCount(0),
-      _frameLastFPS(0), _frameCount(0), _frameRate(0), _width(0), _height(0),
+      _frameLastFPS(0), _frameCount(0), _frameRate(0), _frameNumber(0), _width(0), _height(0),
       _clearDepth(1.0f), _clearStencil(0), _properties(NULL),
       _animationController(NULL), _audioController(NULL),
-      _physicsController(NULL), _aiController(NULL), _audioListener(NULL),
-      _timeEvents(NULL), _scriptController(NULL), _scriptTarget(NULL)
+      _physicsController(NULL), _aiController(NULL), _lazySubsystems(0), _audioListener(NULL),
+      _timeEvents(NULL), _scriptController(NULL), _scriptTarget(NULL),
+      _jobSystem(NULL), _pipelinedUpdate(false), _dynamicResolution(NULL), _framePacer(NULL), _performanceGovernor(NULL), _performanceHud(NULL), _renderThread(NULL), _uploadThread(NULL)
 {
     GP_ASSERT(__gameInstance == NULL);
 
@@ -76,7 +135,7 @@ Game::Game()
 Game::~Game()
 {
     SAFE_DELETE(_scriptTarget);
-	SAFE_DELETE(_scriptController);
+	delete _scriptController.exchange(NULL);
 
     // Do not call any virtual functions from the destructor.
     // Finalization is done from outside this class.
@@ -135,6 +194,16 @@ bool Game::isVsync()
     return Platform::isVsync();
 }
 
+void Game::setSwapInterval(unsigned int interval)
+{
+    Platform::setSwapInterval(interval);
+}
+
+unsigned int Game::getSwapInterval()
+{
+    return Platform::getSwapInterval();
+}
+
 int Game::run()
 {
     if (_state != UNINITIALIZED)
@@ -160,27 +229,93 @@ bool Game::startup()
     if (_state != UNINITIALIZED)
         return false;
 
+    // The game loop runs on this thread, which owns the graphics context.
+    Ref::setMainThread();
+
+    // Write the log from a background thread and limit repeated warnings, if configured to.
+    Properties* loggerConfig = _properties ? _properties->getNamespace("logger", true) : NULL;
+    if (loggerConfig)
+    {
+        if (loggerConfig->exists("rateLimit"))
+            Logger::setRateLimit((unsigned int)loggerConfig->getInt("rateLimit"));
+        Logger::setAsync(loggerConfig->getBool("async"));
+    }
+
+    // Start the job system first so that the other subsystems can use it.
+    int jobThreads = _properties ? _properties->getInt("jobThreads") : 0;
+    _jobSystem = new JobSystem();
+    _jobSystem->initialize(jobThreads > 0 ? (unsigned int)jobThreads : 0);
+
+    // Read ahead the files that the last runs read before their first frame, or record them for the next runs.
+    Properties* prefetchConfig = _properties ? _properties->getNamespace("prefetch", true) : NULL;
+    if (prefetchConfig && prefetchConfig->exists("manifest"))
+    {
+        const char* manifest = prefetchConfig->getString("manifest");
+        if (prefetchConfig->getBool("record"))
+            FileSystem::startAccessRecording();
+        else if (FileSystem::fileExists(manifest))
+            FileSystem::prefetch(manifest);
+    }
+
+    // Replay the input of a recorded session, or record the input of this one.
+    Properties* inputConfig = _properties ? _properties->getNamespace("input", true) : NULL;
+    if (inputConfig)
+    {
+        if (inputConfig->exists("replay"))
+            InputRecorder::startReplay(inputConfig->getString("replay"), inputConfig->getBool("exitOnReplayEnd"));
+        else if (inputConfig->exists("record"))
+            InputRecorder::startRecording(inputConfig->getString("record"), inputConfig->getFloat("timeStep"));
+    }
+
     setViewport(Rectangle(0.0f, 0.0f, (float)_width, (float)_height));
+    GLStateCache::invalidate();
     RenderState::initialize();
     FrameBuffer::initialize();
 
-    _animationController = new AnimationController();
-    _animationController->initialize();
+    // Initialize the subsystems needed at startup, leaving the others to be initialized on first use.
+    const unsigned int startupSubsystems = loadSubsystems();
+    if (startupSubsystems & SUBSYSTEM_ANIMATION)
+        initializeSubsystem(SUBSYSTEM_ANIMATION);
+    if (startupSubsystems & SUBSYSTEM_AUDIO)
+        initializeSubsystem(SUBSYSTEM_AUDIO);
+    if (startupSubsystems & SUBSYSTEM_PHYSICS)
+        initializeSubsystem(SUBSYSTEM_PHYSICS);
+    if (startupSubsystems & SUBSYSTEM_AI)
+        initializeSubsystem(SUBSYSTEM_AI);
+    if (startupSubsystems & SUBSYSTEM_SCRIPT)
+        initializeSubsystem(SUBSYSTEM_SCRIPT);
+
+    // Load any gamepads, ui or physical.
+    Properties* subsystemsConfig = _properties ? _properties->getNamespace("subsystems", true) : NULL;
+    if (!subsystemsConfig || subsystemsConfig->getBool("gamepads", true))
+        loadGamepads();
 
-    _audioController = new AudioController();
-    _audioController->initialize();
+    if (_properties)
+        _pipelinedUpdate = _properties->getBool("pipelinedUpdate", _pipelinedUpdate);
 
-    _physicsController = new PhysicsController();
-    _physicsController->initialize();
+    _dynamicResolution = new DynamicResolution();
+    Properties* graphicsConfig = _properties ? _properties->getNamespace("graphics", true) : NULL;
+    if (graphicsConfig && graphicsConfig->exists("dynamicResolutionBudget"))
+        _dynamicResolution->setBudget(graphicsConfig->getFloat("dynamicResolutionBudget"));
 
-    _aiController = new AIController();
-    _aiController->initialize();
+    _framePacer = new FramePacer();
+    if (graphicsConfig)
+    {
+        if (graphicsConfig->exists("targetFrameRate"))
+            _framePacer->setTargetFrameRate(graphicsConfig->getFloat("targetFrameRate"));
+        _framePacer->_adaptive = graphicsConfig->getBool("adaptiveFrameRate");
+        _framePacer->_smoothing = graphicsConfig->getBool("smoothFrameTime");
+        if (graphicsConfig->exists("swapInterval"))
+            Platform::setSwapInterval((unsigned int)graphicsConfig->getInt("swapInterval"));
+    }
 
-    _scriptController = new ScriptController();
-    _scriptController->initialize();
+    _performanceGovernor = new PerformanceGovernor(_framePacer, _dynamicResolution);
+    if (graphicsConfig && graphicsConfig->getBool("performanceGovernor"))
+        _performanceGovernor->setEnabled(true);
 
-    // Load any gamepads, ui or physical.
-    loadGamepads();
+    _performanceHud = new PerformanceHud();
+    if (graphicsConfig && graphicsConfig->getBool("performanceHud"))
+        _performanceHud->setVisible(true);
 
     // Set script handler
     if (_properties)
@@ -218,10 +353,26 @@ bool Game::startup()
                 GP_REG_GAME_SCRIPT_CB(gestureDragEvent);
                 GP_REG_GAME_SCRIPT_CB(gestureDropEvent);
                 GP_REG_GAME_SCRIPT_CB(gamepadEvent);
+                GP_REG_GAME_SCRIPT_CB(performanceLevelEvent);
             }
         }
     }
 
+    // Upload streamed resources through a shared graphics context, created while the context of the game is still current here.
+    if (graphicsConfig && graphicsConfig->getBool("uploadThread"))
+    {
+        _uploadThread = new UploadThread(_jobSystem);
+        if (!_uploadThread->start())
+        {
+            GP_WARN("An upload thread is not supported on this platform, so resources are uploaded on the main thread.");
+            SAFE_DELETE(_uploadThread);
+        }
+    }
+
+    // Render and present the frames on a render thread, which is started once the game is initialized.
+    if (graphicsConfig && graphicsConfig->getBool("renderThread"))
+        _renderThread = new RenderThread(this);
+
     _state = RUNNING;
 
     return true;
@@ -232,13 +383,14 @@ void Game::shutdown()
     // Call user finalization.
     if (_state != UNINITIALIZED)
     {
-        GP_ASSERT(_animationController);
-        GP_ASSERT(_audioController);
-        GP_ASSERT(_physicsController);
-        GP_ASSERT(_aiController);
-
         Platform::signalShutdown();
 
+        // Wait for the last frame and move the graphics context back to this thread, which the subsystems are finalized on.
+        SAFE_DELETE(_renderThread);
+
+        // Finish the input recording while the gamepads still exist.
+        InputRecorder::stop();
+
 		// Call user finalize
         finalize();
 
@@ -249,8 +401,12 @@ void Game::shutdown()
         // Destroy script target so no more script events are fired
         SAFE_DELETE(_scriptTarget);
 
+        // Subsystems that were never used are not initialized just to be finalized.
+        _lazySubsystems = 0;
+
 		// Shutdown scripting system first so that any objects allocated in script are released before our subsystems are released
-		_scriptController->finalize();
+		if (_scriptController)
+			_scriptController.load()->finalize();
 
         unsigned int gamepadCount = Gamepad::getGamepadCount();
         for (unsigned int i = 0; i < gamepadCount; i++)
@@ -259,17 +415,31 @@ void Game::shutdown()
             SAFE_DELETE(gamepad);
         }
 
-        _animationController->finalize();
-        SAFE_DELETE(_animationController);
+        if (_animationController)
+        {
+            _animationController.load()->finalize();
+            delete _animationController.exchange(NULL);
+        }
 
-        _audioController->finalize();
-        SAFE_DELETE(_audioController);
+        if (_audioController)
+        {
+            _audioController.load()->finalize();
+            delete _audioController.exchange(NULL);
+        }
 
-        _physicsController->finalize();
-        SAFE_DELETE(_physicsController);
-        _aiController->finalize();
-        SAFE_DELETE(_aiController);
+        if (_physicsController)
+        {
+            _physicsController.load()->finalize();
+            delete _physicsController.exchange(NULL);
+        }
+        if (_aiController)
+        {
+            _aiController.load()->finalize();
+            delete _aiController.exchange(NULL);
+        }
         
+        LoadingScreen::finalize();
+
         ControlFactory::finalize();
 
         Theme::finalize();
@@ -279,11 +449,43 @@ void Game::shutdown()
 
         SAFE_DELETE(_audioListener);
 
+        SAFE_DELETE(_performanceGovernor);
+        SAFE_DELETE(_framePacer);
+        SAFE_DELETE(_performanceHud);
+        SAFE_DELETE(_dynamicResolution);
+        Profiler::finalize();
+        FrameCapture::finalize();
+        ParticleEmitterPool::finalize();
+        ParticleSystem::finalize();
+        RenderTargetPool::finalize();
         FrameBuffer::finalize();
+        DynamicBuffer::finalize();
+        ViewUniformBuffer::finalize();
+        JointTexture::finalize();
+        Bundle::finalize();
+        MeshBufferPool::finalize();
+        Ref::destroyPending();
+        Effect::finalize();
+        Texture::finalize();
+
+        // The pending loads have waited for their uploads, so the upload context can go.
+        SAFE_DELETE(_uploadThread);
         RenderState::finalize();
+        GLStateCache::finalize();
+        Properties::clearCache();
+        FileSystem::stopAccessRecording(NULL);
+        FileSystem::clearPrefetched();
+        FileSystem::unmountArchives();
 
         SAFE_DELETE(_properties);
 
+        _jobSystem->finalize();
+        SAFE_DELETE(_jobSystem);
+        StringTable::finalize();
+
+        // Write the messages still queued by asynchronous logging.
+        Logger::flush();
+
 		_state = UNINITIALIZED;
     }
 }
@@ -292,16 +494,16 @@ void Game::pause()
 {
     if (_state == RUNNING)
     {
-        GP_ASSERT(_animationController);
-        GP_ASSERT(_audioController);
-        GP_ASSERT(_physicsController);
-        GP_ASSERT(_aiController);
         _state = PAUSED;
         _pausedTimeLast = Platform::getAbsoluteTime();
-        _animationController->pause();
-        _audioController->pause();
-        _physicsController->pause();
-        _aiController->pause();
+        if (_animationController)
+            _animationController.load()->pause();
+        if (_audioController)
+            _audioController.load()->pause();
+        if (_physicsController)
+            _physicsController.load()->pause();
+        if (_aiController)
+            _aiController.load()->pause();
     }
 
     ++_pausedCount;
@@ -315,16 +517,16 @@ void Game::resume()
 
         if (_pausedCount == 0)
         {
-            GP_ASSERT(_animationController);
-            GP_ASSERT(_audioController);
-            GP_ASSERT(_physicsController);
-            GP_ASSERT(_aiController);
             _state = RUNNING;
             _pausedTimeTotal += Platform::getAbsoluteTime() - _pausedTimeLast;
-            _animationController->resume();
-            _audioController->resume();
-            _physicsController->resume();
-            _aiController->resume();
+            if (_animationController)
+                _animationController.load()->resume();
+            if (_audioController)
+                _audioController.load()->resume();
+            if (_physicsController)
+                _physicsController.load()->resume();
+            if (_aiController)
+                _aiController.load()->resume();
         }
     }
 }
@@ -356,18 +558,58 @@ void Game::exit()
 
 void Game::frame()
 {
+    GP_PROFILE_SCOPE("Game::frame");
+
     if (!_initialized)
     {
-        // Perform lazy first time initialization
-        initialize();
-        if (_scriptTarget)
-            _scriptTarget->fireScriptEvent<void>(GP_GET_SCRIPT_EVENT(GameScriptTarget, initialize));
-        _initialized = true;
+        // Perform lazy first time initialization on this thread, while the graphics context is still current on it.
+        initializeInternal();
 
         // Fire first game resize event
         Platform::resizeEventInternal(_width, _height);
+
+        // Move the graphics context to the render thread for the frames from now on.
+        if (_renderThread && !_renderThread->start())
+        {
+            GP_WARN("A render thread is not supported on this platform.");
+            SAFE_DELETE(_renderThread);
+        }
+    }
+
+    // Adapt the frame rate limit to the state of the device before pacing the frame to it.
+    if (_performanceGovernor && _performanceGovernor->_enabled && _performanceGovernor->update())
+        performanceLevelEventInternal((PerformanceLevel)_performanceGovernor->_level);
+
+    // Hold the frame until its slot at the target frame rate.
+    if (_framePacer)
+        _framePacer->waitForNextFrame();
+    ++_frameNumber;
+
+    // Deliver the replayed input that arrived before this frame when it was recorded.
+    InputRecorder::nextFrame();
+
+    // The first frame has been drawn, so the files read while starting up have all been opened.
+    if (_frameNumber == 2)
+    {
+        Properties* prefetchConfig = _properties ? _properties->getNamespace("prefetch", true) : NULL;
+        if (prefetchConfig && prefetchConfig->getBool("record"))
+            FileSystem::stopAccessRecording(prefetchConfig->getString("manifest"));
+        FileSystem::clearPrefetched();
     }
 
+    // The render thread does the graphics work of the frame once it is handed the frame.
+    if (!isRenderThreadEnabled())
+    {
+        // Publish the rendering statistics of the last frame and start counting this one.
+        _frameStats = FrameStats::_current;
+        FrameStats::_current.reset();
+
+        updateGraphics();
+    }
+
+    // Release the transient allocations of last frame.
+    MemoryArena::nextFrame();
+
 	static double lastFrameTime = Game::getGameTime();
 	double frameTime = getGameTime();
 
@@ -376,46 +618,88 @@ void Game::frame()
 
     if (_state == Game::RUNNING)
     {
-        GP_ASSERT(_animationController);
-        GP_ASSERT(_audioController);
-        GP_ASSERT(_physicsController);
-        GP_ASSERT(_aiController);
-
         // Update Time.
-        float elapsedTime = (frameTime - lastFrameTime);
+        float elapsedTime = _framePacer->update(frameTime - lastFrameTime);
         lastFrameTime = frameTime;
 
-        // Update the scheduled and running animations.
-        _animationController->update(elapsedTime);
+        // Replayed frames advance by the fixed timestep of the recording, so that every replay runs the same session.
+        if (InputRecorder::isReplaying())
+            elapsedTime = InputRecorder::getTimeStep();
+
+        if (_pipelinedUpdate)
+        {
+            // Update animation, physics, AI, gamepads, audio and forms, overlapping independent stages.
+            updatePipelined(elapsedTime);
+        }
+        else
+        {
+            // Update the scheduled and running animations.
+            if (_animationController)
+                _animationController.load()->update(elapsedTime);
+
+            // Update the physics.
+            if (_physicsController)
+            {
+                GP_MEMORY_TAG(MEMORY_TAG_PHYSICS);
+                _physicsController.load()->update(elapsedTime);
+            }
 
-        // Update the physics.
-        _physicsController->update(elapsedTime);
+            // Update AI.
+            if (_aiController)
+                _aiController.load()->update(elapsedTime);
 
-        // Update AI.
-        _aiController->update(elapsedTime);
+            // Update gamepads.
+            Gamepad::updateInternal(elapsedTime);
+        }
 
-        // Update gamepads.
-        Gamepad::updateInternal(elapsedTime);
+        // Update the particle emitters of the particle system, now that their nodes have moved.
+        // They may simulate on the GPU, so the render thread updates them when there is one.
+        if (!isRenderThreadEnabled())
+            ParticleSystem::update(elapsedTime);
 
-        // Application Update.
-        update(elapsedTime);
+        // Application Update, which waits while a loading screen is displayed.
+        const bool loading = LoadingScreen::isActive();
+        if (!loading)
+        {
+            GP_PROFILE_SCOPE("Game::update");
+            update(elapsedTime);
+        }
 
-        // Update forms.
-        Form::updateInternal(elapsedTime);
+        // Update forms, unless they were updated with the pipelined stages.
+        if (!_pipelinedUpdate)
+        {
+            GP_MEMORY_TAG(MEMORY_TAG_UI);
+            Form::updateInternal(elapsedTime);
+        }
 
         // Run script update.
-        if (_scriptTarget)
+        if (_scriptTarget && !loading)
+        {
+            GP_PROFILE_SCOPE("Game::scriptUpdate");
+            GP_MEMORY_TAG(MEMORY_TAG_SCRIPT);
             _scriptTarget->fireScriptEvent<void>(GP_GET_SCRIPT_EVENT(GameScriptTarget, update), elapsedTime);
+        }
 
-        // Audio Rendering.
-        _audioController->update(elapsedTime);
+        // Resume script coroutines that are ready.
+        if (_scriptController)
+        {
+            GP_MEMORY_TAG(MEMORY_TAG_SCRIPT);
+            _scriptController.load()->updateCoroutines();
+        }
+
+        // Audio Rendering (already done by the pipelined update stages).
+        if (!_pipelinedUpdate && _audioController)
+        {
+            GP_MEMORY_TAG(MEMORY_TAG_AUDIO);
+            _audioController.load()->update(elapsedTime);
+        }
 
         // Graphics Rendering.
-        render(elapsedTime);
+        submitFrame(elapsedTime, true);
 
-        // Run script render.
-        if (_scriptTarget)
-            _scriptTarget->fireScriptEvent<void>(GP_GET_SCRIPT_EVENT(GameScriptTarget, render), elapsedTime);
+        // Collect script garbage within the budget, now that the frame's scripts have run.
+        if (_scriptController)
+            _scriptController.load()->collectGarbage();
 
         // Update FPS.
         ++_frameCount;
@@ -442,27 +726,231 @@ void Game::frame()
             _scriptTarget->fireScriptEvent<void>(GP_GET_SCRIPT_EVENT(GameScriptTarget, update), 0);
 
         // Graphics Rendering.
-        render(0);
+        submitFrame(0, false);
+
+        // Collect script garbage within the budget.
+        if (_scriptController)
+            _scriptController.load()->collectGarbage();
+    }
+}
+
+void Game::initializeInternal()
+{
+    initialize();
+    if (_scriptTarget)
+        _scriptTarget->fireScriptEvent<void>(GP_GET_SCRIPT_EVENT(GameScriptTarget, initialize));
+    _initialized = true;
+}
+
+void Game::updateGraphics()
+{
+    // Write the capture of the last frame, and begin capturing this one if it was requested.
+    FrameCapture::nextFrame();
+
+    // Destroy the graphics objects released by worker threads since the last frame.
+    Ref::destroyPending();
 
-        // Script render.
+    // Skins may have moved since the last frame, so their palettes are written to the joint texture again.
+    JointTexture::nextFrame();
+
+    // Finish any prewarmed effects that are done compiling.
+    Effect::updatePending();
+
+    // Upload the textures that finished decoding, within the per-frame budget.
+    Texture::updatePending();
+
+    // Keep the resource caches within the global memory budget.
+    ResourceManager::update();
+
+    // Create the meshes of the scenes being loaded asynchronously, within the per-frame budget.
+    Bundle::updatePending();
+
+    // Fence the geometry streamed last frame and move on to the next region of the dynamic buffers.
+    DynamicBuffer::nextFrame();
+
+    // Return the transient render targets of last frame to the pool.
+    RenderTargetPool::nextFrame();
+
+    // Record the GPU timings of earlier frames that have completed.
+    Profiler::nextFrame();
+
+    // Deliver the screenshots that the GPU has finished copying.
+    FrameBuffer::nextFrame();
+
+    // Free the graphics objects deleted in earlier frames that the GPU is done with.
+    GLStateCache::nextFrame();
+}
+
+void Game::renderFrame(float elapsedTime, bool running)
+{
+    if (isRenderThreadEnabled())
+    {
+        updateGraphics();
+        if (running)
+            ParticleSystem::update(elapsedTime);
+    }
+
+    // A loading screen is drawn in place of the game until its loads have finished.
+    if (LoadingScreen::renderFrame())
+    {
+        FrameBuffer::endFrame();
+        return;
+    }
+
+    if (!running)
+    {
+        render(0);
         if (_scriptTarget)
             _scriptTarget->fireScriptEvent<void>(GP_GET_SCRIPT_EVENT(GameScriptTarget, render), 0);
+        FrameBuffer::endFrame();
+        return;
+    }
+
+    {
+        GP_PROFILE_SCOPE("Game::render");
+        GP_PROFILE_GPU_SCOPE("Game::render");
+        GP_MEMORY_TAG(MEMORY_TAG_RENDER);
+        _dynamicResolution->beginFrame();
+        render(elapsedTime);
+    }
+
+    // Run script render.
+    if (_scriptTarget)
+    {
+        GP_PROFILE_SCOPE("Game::scriptRender");
+        GP_MEMORY_TAG(MEMORY_TAG_SCRIPT);
+        _scriptTarget->fireScriptEvent<void>(GP_GET_SCRIPT_EVENT(GameScriptTarget, render), elapsedTime);
+    }
+
+    // Draw the performance HUD over the frame.
+    if (_performanceHud->_visible)
+        _performanceHud->draw();
+
+    // Scale the resolution of the next frames by the time this one took.
+    _dynamicResolution->endFrame(elapsedTime);
+
+    // Tell the driver which attachments of the frame need not be written out before it is presented.
+    FrameBuffer::endFrame();
+}
+
+void Game::submitFrame(float elapsedTime, bool running)
+{
+    if (!isRenderThreadEnabled())
+    {
+        renderFrame(elapsedTime, running);
+        return;
+    }
+
+    // The statistics of the last frame are complete once the render thread has presented it.
+    _renderThread->waitForFrame();
+    _frameStats = FrameStats::_current;
+    FrameStats::_current.reset();
+    _renderThread->submit(elapsedTime, running);
+}
+
+void Game::updatePipelined(float elapsedTime)
+{
+    GP_PROFILE_SCOPE("Game::updatePipelined");
+
+    GP_ASSERT(_jobSystem);
+
+    const unsigned int stageCount = sizeof(__updateStages) / sizeof(__updateStages[0]);
+    unsigned int allStages = 0;
+    for (unsigned int i = 0; i < stageCount; ++i)
+        allStages |= __updateStages[i].stage;
+
+    JobSystem::Counter workerCounter;
+    unsigned int started = 0;
+    unsigned int completed = 0;
+    unsigned int workerStage = 0;
+    while (completed != allStages)
+    {
+        // Start every stage whose dependencies have completed. Main thread stages
+        // run in declaration order while the worker stage is in flight as a job.
+        bool progressed = false;
+        for (unsigned int i = 0; i < stageCount; ++i)
+        {
+            const UpdateStageInfo& info = __updateStages[i];
+            if ((started & info.stage) || (info.dependencies & ~completed))
+                continue;
+
+            if (info.mainThread)
+            {
+                started |= info.stage;
+                updateStage(info.stage, elapsedTime);
+                completed |= info.stage;
+                progressed = true;
+            }
+            else if (workerStage == 0)
+            {
+                started |= info.stage;
+                workerStage = info.stage;
+                unsigned int stage = info.stage;
+                _jobSystem->run([this, stage, elapsedTime]() { updateStage(stage, elapsedTime); }, &workerCounter);
+                progressed = true;
+            }
+        }
+
+        if (!progressed)
+        {
+            GP_ASSERT(workerStage);
+            _jobSystem->wait(&workerCounter);
+
+            // Node updates and physics events are always delivered on the main thread.
+            if (workerStage == UPDATE_STAGE_PHYSICS && _physicsController)
+                _physicsController.load()->dispatchEvents();
+
+            completed |= workerStage;
+            workerStage = 0;
+        }
+    }
+}
+
+void Game::updateStage(unsigned int stage, float elapsedTime)
+{
+    switch (stage)
+    {
+    case UPDATE_STAGE_ANIMATION:
+        if (_animationController)
+            _animationController.load()->update(elapsedTime);
+        break;
+    case UPDATE_STAGE_PHYSICS:
+        if (_physicsController)
+            _physicsController.load()->stepSimulation(elapsedTime, true);
+        break;
+    case UPDATE_STAGE_AI:
+        if (_aiController)
+            _aiController.load()->update(elapsedTime);
+        break;
+    case UPDATE_STAGE_GAMEPAD:
+        Gamepad::updateInternal(elapsedTime);
+        break;
+    case UPDATE_STAGE_AUDIO:
+        if (_audioController)
+            _audioController.load()->update(elapsedTime);
+        break;
+    case UPDATE_STAGE_FORMS:
+        {
+            GP_MEMORY_TAG(MEMORY_TAG_UI);
+            Form::updateInternal(elapsedTime);
+        }
+        break;
+    default:
+        GP_ERROR("Unsupported update stage (%d).", stage);
+        break;
     }
 }
 
 void Game::renderOnce(const char* function)
 {
-    _scriptController->executeFunction<void>(function, NULL);
+    ScriptController* scriptController = getScriptController();
+    if (scriptController)
+        scriptController->executeFunction<void>(function, NULL);
     Platform::swapBuffers();
 }
 
 void Game::updateOnce()
 {
-    GP_ASSERT(_animationController);
-    GP_ASSERT(_audioController);
-    GP_ASSERT(_physicsController);
-    GP_ASSERT(_aiController);
-
     // Update Time.
     static double lastFrameTime = getGameTime();
     double frameTime = getGameTime();
@@ -470,12 +958,18 @@ void Game::updateOnce()
     lastFrameTime = frameTime;
 
     // Update the internal controllers.
-    _animationController->update(elapsedTime);
-    _physicsController->update(elapsedTime);
-    _aiController->update(elapsedTime);
-    _audioController->update(elapsedTime);
+    if (_animationController)
+        _animationController.load()->update(elapsedTime);
+    if (_physicsController)
+        _physicsController.load()->update(elapsedTime);
+    if (_aiController)
+        _aiController.load()->update(elapsedTime);
+    if (_audioController)
+        _audioController.load()->update(elapsedTime);
     if (_scriptTarget)
         _scriptTarget->fireScriptEvent<void>(GP_GET_SCRIPT_EVENT(GameScriptTarget, update), elapsedTime);
+    if (_scriptController)
+        _scriptController.load()->updateCoroutines();
 }
 
 void Game::setViewport(const Rectangle& viewport)
@@ -532,6 +1026,165 @@ void Game::clear(ClearFlags flags, float red, float green, float blue, float alp
     clear(flags, Vector4(red, green, blue, alpha), clearDepth, clearStencil);
 }
 
+void Game::setFrameTimeBudget(float milliseconds)
+{
+    GP_ASSERT(_dynamicResolution);
+    _dynamicResolution->setBudget(milliseconds);
+}
+
+float Game::getFrameTimeBudget() const
+{
+    return _dynamicResolution ? _dynamicResolution->_budget : 0.0f;
+}
+
+void Game::setMinResolutionScale(float scale)
+{
+    GP_ASSERT(_dynamicResolution);
+    _dynamicResolution->setMinScale(scale);
+}
+
+float Game::getMinResolutionScale() const
+{
+    return _dynamicResolution ? _dynamicResolution->_minScale : 1.0f;
+}
+
+float Game::getResolutionScale() const
+{
+    return _dynamicResolution ? _dynamicResolution->_scale : 1.0f;
+}
+
+void Game::setTargetFrameRate(float framesPerSecond)
+{
+    GP_ASSERT(_framePacer);
+    _framePacer->setTargetFrameRate(framesPerSecond);
+}
+
+float Game::getTargetFrameRate() const
+{
+    return _framePacer ? _framePacer->_targetFrameRate : 0.0f;
+}
+
+void Game::setAdaptiveFrameRate(bool adaptive)
+{
+    GP_ASSERT(_framePacer);
+    _framePacer->_adaptive = adaptive;
+    _framePacer->_divisor = 1;
+}
+
+bool Game::isAdaptiveFrameRate() const
+{
+    return _framePacer ? _framePacer->_adaptive : false;
+}
+
+void Game::setPerformanceHudVisible(bool visible)
+{
+    GP_ASSERT(_performanceHud);
+    _performanceHud->setVisible(visible);
+}
+
+bool Game::isPerformanceHudVisible() const
+{
+    return _performanceHud ? _performanceHud->_visible : false;
+}
+
+ResourceStats Game::getResourceStats() const
+{
+    ResourceStats stats;
+    ResourceManager::Stats categoryStats;
+
+    ResourceManager::getStats(ResourceManager::TEXTURES, &categoryStats);
+    stats.textureCount = categoryStats.count;
+    stats.textureMemory = categoryStats.memorySize;
+    ResourceManager::getStats(ResourceManager::MESHES, &categoryStats);
+    stats.meshCount = categoryStats.count;
+    stats.meshMemory = categoryStats.memorySize;
+    ResourceManager::getStats(ResourceManager::EFFECTS, &categoryStats);
+    stats.effectCount = categoryStats.count;
+    stats.effectMemory = categoryStats.memorySize;
+    ResourceManager::getStats(ResourceManager::VERTEX_ATTRIBUTE_BINDINGS, &categoryStats);
+    stats.vertexAttributeBindingCount = categoryStats.count;
+    stats.vertexAttributeBindingMemory = categoryStats.memorySize;
+    ResourceManager::getStats(ResourceManager::FRAME_BUFFERS, &categoryStats);
+    stats.frameBufferCount = categoryStats.count;
+    stats.frameBufferMemory = categoryStats.memorySize;
+    ResourceManager::getStats(ResourceManager::AUDIO_BUFFERS, &categoryStats);
+    stats.audioBufferCount = categoryStats.count;
+    stats.audioBufferMemory = categoryStats.memorySize;
+
+    stats.totalMemory = stats.textureMemory + stats.meshMemory + stats.effectMemory + stats.vertexAttributeBindingMemory +
+        stats.frameBufferMemory + stats.audioBufferMemory;
+    return stats;
+}
+
+bool Game::isRenderThreadEnabled() const
+{
+    return _renderThread ? _renderThread->_running : false;
+}
+
+void Game::setRenderThreadSuspended(bool suspended)
+{
+    // The render thread is only started once the game is initialized.
+    if (!_renderThread || !_initialized)
+        return;
+
+    if (suspended)
+        _renderThread->stop();
+    else if (!_renderThread->start())
+        GP_WARN("Failed to resume the render thread.");
+}
+
+float Game::getPacedFrameRate() const
+{
+    return _framePacer ? _framePacer->getPacedFrameRate() : 0.0f;
+}
+
+void Game::setFrameTimeSmoothing(bool smoothing)
+{
+    GP_ASSERT(_framePacer);
+    _framePacer->_smoothing = smoothing;
+}
+
+bool Game::isFrameTimeSmoothing() const
+{
+    return _framePacer ? _framePacer->_smoothing : false;
+}
+
+float Game::getFrameTimeVariance() const
+{
+    return _framePacer ? _framePacer->_variance : 0.0f;
+}
+
+void Game::setPerformanceGovernorEnabled(bool enabled)
+{
+    GP_ASSERT(_performanceGovernor);
+    const bool changed = _performanceGovernor->_level != PERFORMANCE_FULL;
+    _performanceGovernor->setEnabled(enabled);
+    if (changed && !enabled)
+        performanceLevelEventInternal(PERFORMANCE_FULL);
+}
+
+bool Game::isPerformanceGovernorEnabled() const
+{
+    return _performanceGovernor ? _performanceGovernor->_enabled : false;
+}
+
+Game::PerformanceLevel Game::getPerformanceLevel() const
+{
+    return _performanceGovernor ? (PerformanceLevel)_performanceGovernor->_level : PERFORMANCE_FULL;
+}
+
+void Game::beginScene()
+{
+    GP_ASSERT(_dynamicResolution);
+    _dynamicResolution->beginScene();
+}
+
+void Game::endScene()
+{
+    GP_ASSERT(_dynamicResolution);
+    _dynamicResolution->endScene();
+}
+
 AudioListener* Game::getAudioListener()
 {
     if (_audioListener == NULL)
@@ -617,6 +1270,11 @@ void Game::gamepadEvent(Gamepad::GamepadEvent evt, Gamepad* gamepad)
     // stub
 }
 
+void Game::performanceLevelEvent(PerformanceLevel level)
+{
+    // stub
+}
+
 void Game::keyEventInternal(Keyboard::KeyEvent evt, int key)
 {
     keyEvent(evt, key);
@@ -704,6 +1362,13 @@ void Game::gamepadEventInternal(Gamepad::GamepadEvent evt, Gamepad* gamepad)
         _scriptTarget->fireScriptEvent<void>(GP_GET_SCRIPT_EVENT(GameScriptTarget, gamepadEvent), evt, gamepad);
 }
 
+void Game::performanceLevelEventInternal(PerformanceLevel level)
+{
+    performanceLevelEvent(level);
+    if (_scriptTarget)
+        _scriptTarget->fireScriptEvent<void>(GP_GET_SCRIPT_EVENT(GameScriptTarget, performanceLevelEvent), level);
+}
+
 void Game::getArguments(int* argc, char*** argv) const
 {
     Platform::getArguments(argc, argv);
@@ -778,6 +1443,19 @@ void Game::loadConfig()
             {
                 FileSystem::loadResourceAliases(aliases);
             }
+
+            // Mount resource archives, named by the path their files are mounted at.
+            Properties* archives = _properties->getNamespace("archives", true);
+            if (archives)
+            {
+                const char* mountPath;
+                while ((mountPath = archives->getNextProperty()) != NULL)
+                {
+                    const char* path = archives->getString();
+                    if (path && !FileSystem::mountArchive(path, strcmp(mountPath, ".") == 0 ? NULL : mountPath))
+                        GP_WARN("Failed to mount archive '%s' at '%s'.", path, mountPath);
+                }
+            }
         }
         else
         {
@@ -817,6 +1495,110 @@ void Game::loadGamepads()
     }
 }
 
+unsigned int Game::loadSubsystems()
+{
+    static const struct { const char* name; Subsystem subsystem; } subsystems[] =
+    {
+        { "animation", SUBSYSTEM_ANIMATION },
+        { "audio", SUBSYSTEM_AUDIO },
+        { "physics", SUBSYSTEM_PHYSICS },
+        { "ai", SUBSYSTEM_AI },
+        { "script", SUBSYSTEM_SCRIPT }
+    };
+
+    // Each subsystem is initialized at startup (true), on first use (lazy, the default) or never (false).
+    Properties* config = _properties ? _properties->getNamespace("subsystems", true) : NULL;
+    unsigned int startup = 0;
+    _lazySubsystems = 0;
+    for (unsigned int i = 0; i < sizeof(subsystems) / sizeof(subsystems[0]); ++i)
+    {
+        const char* value = config ? config->getString(subsystems[i].name) : NULL;
+        if (value == NULL || strcmp(value, "lazy") == 0)
+        {
+            _lazySubsystems |= subsystems[i].subsystem;
+        }
+        else if (strcmp(value, "true") == 0)
+        {
+            startup |= subsystems[i].subsystem;
+        }
+        else if (strcmp(value, "false") != 0)
+        {
+            GP_WARN("Invalid value '%s' for subsystem '%s'; expected true, false or lazy.", value, subsystems[i].name);
+            _lazySubsystems |= subsystems[i].subsystem;
+        }
+    }
+    return startup;
+}
+
+void Game::initializeSubsystem(Subsystem subsystem) const
+{
+    // Subsystems may be first used from a worker thread, such as while loading a scene. The controllers
+    // are only published once initialized, and their initialization may use the other subsystems.
+    std::lock_guard<std::recursive_mutex> lock(__subsystemMutex);
+
+    switch (subsystem)
+    {
+    case SUBSYSTEM_ANIMATION:
+        if (_animationController == NULL)
+        {
+            AnimationController* animationController = new AnimationController();
+            animationController->initialize();
+            if (_state == PAUSED)
+                animationController->pause();
+            _animationController.store(animationController, std::memory_order_release);
+        }
+        break;
+    case SUBSYSTEM_AUDIO:
+        if (_audioController == NULL)
+        {
+            GP_MEMORY_TAG(MEMORY_TAG_AUDIO);
+            AudioController* audioController = new AudioController();
+            audioController->initialize();
+            if (_state == PAUSED)
+                audioController->pause();
+            _audioController.store(audioController, std::memory_order_release);
+        }
+        break;
+    case SUBSYSTEM_PHYSICS:
+        if (_physicsController == NULL)
+        {
+            GP_MEMORY_TAG(MEMORY_TAG_PHYSICS);
+            PhysicsController* physicsController = new PhysicsController();
+            physicsController->initialize();
+            if (_state == PAUSED)
+                physicsController->pause();
+            _physicsController.store(physicsController, std::memory_order_release);
+        }
+        break;
+    case SUBSYSTEM_AI:
+        if (_aiController == NULL)
+        {
+            AIController* aiController = new AIController();
+            aiController->initialize();
+            if (_state == PAUSED)
+                aiController->pause();
+            _aiController.store(aiController, std::memory_order_release);
+        }
+        break;
+    case SUBSYSTEM_SCRIPT:
+        if (_scriptController == NULL)
+        {
+            GP_MEMORY_TAG(MEMORY_TAG_SCRIPT);
+            ScriptController* scriptController = new ScriptController();
+            scriptController->initialize();
+            if (_properties && _properties->exists("scriptGarbageCollectionBudget"))
+                scriptController->setGarbageCollectionBudget(_properties->getFloat("scriptGarbageCollectionBudget"));
+            if (_properties && _properties->exists("scriptCoroutineBudget"))
+                scriptController->setCoroutineBudget(_properties->getFloat("scriptCoroutineBudget"));
+            _scriptController.store(scriptController, std::memory_order_release);
+        }
+        break;
+    default:
+        GP_ERROR("Unsupported subsystem (%d).", subsystem);
+        break;
+    }
+}
+
 void Game::ShutdownListener::timeEvent(long timeDiff, void* cookie)
 {
 	Game::getInstance()->shutdown();
@@ -14,11 +14,20 @@
 #include "Rectangle.h"
 #include "Vector4.h"
 #include "TimeListener.h"
+#include "JobSystem.h"
+#include "FrameStats.h"
+#include "ResourceStats.h"
 
 namespace gameplay
 {
 
 class ScriptController;
+class DynamicResolution;
+class FramePacer;
+class PerformanceGovernor;
+class PerformanceHud;
+class RenderThread;
+class UploadThread;
 
 /**
  * Defines the base class your game will extend for game initialization, logic and platform delegates.
@@ -33,6 +42,7 @@ class Game
     friend class Platform;
     friend class Gamepad;
     friend class ShutdownListener;
+    friend class RenderThread;
 
 public:
     
@@ -60,6 +70,20 @@ public:
         CLEAR_COLOR_DEPTH_STENCIL = CLEAR_COLOR | CLEAR_DEPTH | CLEAR_STENCIL
     };
 
+    /**
+     * The performance levels that the performance governor holds the game to, from the
+     * highest to the lowest.
+     *
+     * @see setPerformanceGovernorEnabled
+     */
+    enum PerformanceLevel
+    {
+        PERFORMANCE_FULL,
+        PERFORMANCE_SUSTAINED,
+        PERFORMANCE_REDUCED,
+        PERFORMANCE_MINIMAL
+    };
+
     /**
      * Constructor.
      */
@@ -91,6 +115,23 @@ public:
      */
     static void setVsync(bool enable);
 
+    /**
+     * Gets the number of display refreshes between buffer swaps.
+     *
+     * @return The swap interval, where zero means vertical sync is disabled.
+     */
+    static unsigned int getSwapInterval();
+
+    /**
+     * Sets the number of display refreshes between buffer swaps.
+     *
+     * An interval of 2 presents a frame every other refresh, such as 60 frames per second
+     * on a 120 Hz display, and zero disables vertical sync.
+     *
+     * @param interval The swap interval.
+     */
+    static void setSwapInterval(unsigned int interval);
+
     /**
      * Gets the total absolute running time (in milliseconds) since Game::run().
      * 
@@ -162,6 +203,32 @@ public:
      */
     void frame();
 
+    /**
+     * Sets whether the internal subsystem updates run by frame() are pipelined.
+     *
+     * When enabled, the physics simulation step runs as a job at the same time as the AI
+     * update on the main thread. Node transforms produced by the simulation are applied, and
+     * physics events are fired, on the main thread once the step completes. The gamepad,
+     * audio and form updates then run on the main thread, so update() and render() still see
+     * a fully updated frame. The audio listener is then applied, and forms are updated,
+     * before update() rather than after it.
+     *
+     * While enabled, AI agent callbacks must not access the physics world or move nodes that
+     * have collision objects attached, as they run while the physics world is stepped. The
+     * other callbacks are not affected. Default is disabled. This can also be enabled with
+     * the 'pipelinedUpdate' property in game.config.
+     *
+     * @param enabled true to enable pipelined updates, false to disable them.
+     */
+    inline void setPipelinedUpdate(bool enabled);
+
+    /**
+     * Determines whether the internal subsystem updates are pipelined.
+     *
+     * @return true if pipelined updates are enabled, false otherwise.
+     */
+    inline bool isPipelinedUpdate() const;
+
     /**
      * Gets the current frame rate.
      * 
@@ -169,6 +236,13 @@ public:
      */
     inline unsigned int getFrameRate() const;
 
+    /**
+     * Gets the number of frames run since the game started, including the current one.
+     *
+     * @return The current frame number.
+     */
+    inline unsigned int getFrameNumber() const;
+
     /**
      * Gets the game window width.
      * 
@@ -233,7 +307,10 @@ public:
      * Gets the audio controller for managing control of audio
      * associated with the game.
      *
-     * @return The audio controller for this game.
+     * The subsystems of the game are initialized on first use unless the subsystems
+     * namespace of the game config initializes them at startup or disables them.
+     *
+     * @return The audio controller for this game, or NULL if audio is disabled.
      */
     inline AudioController* getAudioController() const;
 
@@ -241,7 +318,7 @@ public:
      * Gets the animation controller for managing control of animations
      * associated with the game.
      * 
-     * @return The animation controller for this game.
+     * @return The animation controller for this game, or NULL if animation is disabled.
      */
     inline AnimationController* getAnimationController() const;
 
@@ -249,7 +326,7 @@ public:
      * Gets the physics controller for managing control of physics
      * associated with the game.
      * 
-     * @return The physics controller for this game.
+     * @return The physics controller for this game, or NULL if physics is disabled.
      */
     inline PhysicsController* getPhysicsController() const;
 
@@ -257,7 +334,7 @@ public:
      * Gets the AI controller for managing control of artificial
      * intelligence associated with the game.
      *
-     * @return The AI controller for this game.
+     * @return The AI controller for this game, or NULL if AI is disabled.
      */
     inline AIController* getAIController() const;
 
@@ -265,10 +342,257 @@ public:
      * Gets the script controller for managing control of Lua scripts
      * associated with the game.
      * 
-     * @return The script controller for this game.
+     * @return The script controller for this game, or NULL if scripting is disabled.
      */
     inline ScriptController* getScriptController() const;
 
+    /**
+     * Gets the job system used to run work across the worker threads.
+     *
+     * The number of worker threads can be set with the 'jobThreads' property in
+     * game.config. By default it is one less than the hardware concurrency.
+     *
+     * @return The job system for this game.
+     * @script{ignore}
+     */
+    inline JobSystem* getJobSystem() const;
+
+    /**
+     * Gets the thread that uploads graphics resources through a graphics context of its own.
+     *
+     * The upload thread is enabled with the 'uploadThread' property of the graphics namespace
+     * of game.config. See UploadThread for the details.
+     *
+     * @return The upload thread, or NULL if it is not enabled or not supported by the platform.
+     * @script{ignore}
+     */
+    inline UploadThread* getUploadThread() const;
+
+    /**
+     * Gets the rendering statistics of the last completed frame.
+     *
+     * The statistics are gathered from the start of one frame to the start of
+     * the next, so they include everything submitted during update and render.
+     *
+     * @return The rendering statistics of the last frame.
+     */
+    inline const FrameStats& getFrameStats() const;
+
+    /**
+     * Gets the number and estimated memory size of the textures, meshes, effects, vertex
+     * attribute bindings, frame buffers and cached audio buffers currently alive.
+     *
+     * The statistics are gathered from the resource caches each time this is called, so
+     * they are cheap enough to poll every frame but are not meant to be called per object.
+     *
+     * @return The statistics of the resources.
+     * @see ResourceManager::getStats
+     */
+    ResourceStats getResourceStats() const;
+
+    /**
+     * Sets the frame time budget that the resolution of the scene is scaled to fit.
+     *
+     * While a budget is set, the scene drawn between beginScene() and endScene() is rendered
+     * at a lower resolution whenever frames take longer than the budget, and is upscaled to
+     * the viewport by endScene(). The GPU time of the frame is measured where timer queries
+     * are supported, and the time between frames otherwise, in which case the budget should
+     * be a little above the refresh interval of the display.
+     *
+     * The initial budget is the 'dynamicResolutionBudget' value of the graphics section of
+     * the game config. The default is zero, which draws the scene at the native resolution.
+     *
+     * @param milliseconds The frame time budget in milliseconds, or zero to disable scaling.
+     */
+    void setFrameTimeBudget(float milliseconds);
+
+    /**
+     * Gets the frame time budget that the resolution of the scene is scaled to fit.
+     *
+     * @return The frame time budget in milliseconds, or zero if scaling is disabled.
+     */
+    float getFrameTimeBudget() const;
+
+    /**
+     * Sets the lowest scale the resolution of the scene is reduced to. The default is 0.5.
+     *
+     * @param scale The lowest resolution scale, between 0.05 and 1.
+     */
+    void setMinResolutionScale(float scale);
+
+    /**
+     * Gets the lowest scale the resolution of the scene is reduced to.
+     *
+     * @return The lowest resolution scale.
+     */
+    float getMinResolutionScale() const;
+
+    /**
+     * Gets the current scale of the resolution of the scene relative to the viewport.
+     *
+     * @return The resolution scale, which is 1 while the frame time is within the budget.
+     */
+    float getResolutionScale() const;
+
+    /**
+     * Sets the frame rate that frames are limited to.
+     *
+     * Each frame is held until 1/framesPerSecond seconds after the start of the previous one,
+     * which saves power on displays that refresh faster than the game needs and evens out
+     * the pacing of frames when vertical sync is disabled. The initial rate is the
+     * 'targetFrameRate' value of the graphics section of the game config. The default is
+     * zero, which does not limit the frame rate.
+     *
+     * @param framesPerSecond The target frame rate, or zero to not limit the frame rate.
+     */
+    void setTargetFrameRate(float framesPerSecond);
+
+    /**
+     * Gets the frame rate that frames are limited to.
+     *
+     * @return The target frame rate, or zero if the frame rate is not limited.
+     */
+    float getTargetFrameRate() const;
+
+    /**
+     * Sets whether the frame limiter divides the target frame rate when frames cannot keep up with it.
+     *
+     * When enabled, the target frame rate is divided by the smallest whole number (up to 4)
+     * that the frames keep up with, so that frames are paced evenly at a lower rate instead
+     * of alternating between two. The initial value is the 'adaptiveFrameRate' value of the
+     * graphics section of the game config. It is disabled by default.
+     *
+     * @param adaptive true to adapt the target frame rate to the frame time.
+     */
+    void setAdaptiveFrameRate(bool adaptive);
+
+    /**
+     * Determines whether the frame limiter divides the target frame rate when frames cannot keep up with it.
+     *
+     * @return true if the target frame rate is adapted to the frame time.
+     */
+    bool isAdaptiveFrameRate() const;
+
+    /**
+     * Gets the frame rate that the frame limiter currently paces frames to.
+     *
+     * @return The paced frame rate, which is below the target frame rate while an adaptive
+     *      limiter divides it, or zero if the frame rate is not limited.
+     */
+    float getPacedFrameRate() const;
+
+    /**
+     * Sets whether the elapsed time passed to update() and render() is smoothed over the last frames.
+     *
+     * Smoothing evens out the motion of games whose frame times jitter. The game time still
+     * advances by the real elapsed time over several frames. The initial value is the
+     * 'smoothFrameTime' value of the graphics section of the game config. It is disabled by default.
+     *
+     * @param smoothing true to smooth the elapsed time.
+     */
+    void setFrameTimeSmoothing(bool smoothing);
+
+    /**
+     * Determines whether the elapsed time passed to update() and render() is smoothed over the last frames.
+     *
+     * @return true if the elapsed time is smoothed.
+     */
+    bool isFrameTimeSmoothing() const;
+
+    /**
+     * Gets the variance of the time between frames, weighted towards the last second or so.
+     *
+     * The standard deviation is also reported to the profiler as the "Frame time deviation" counter.
+     *
+     * @return The frame time variance, in squared milliseconds.
+     */
+    float getFrameTimeVariance() const;
+
+    /**
+     * Sets whether the performance governor adapts the game to the thermal and battery state of the device.
+     *
+     * While enabled, the governor reads the thermal state, battery level and low power mode
+     * of the device every few seconds, where the platform reports them, and lowers the
+     * performance level as the device heats up or its battery runs low. Below PERFORMANCE_FULL
+     * frames are limited to 60 frames per second, and at PERFORMANCE_REDUCED and below to 30,
+     * while the resolution scale of the scene drawn between beginScene() and endScene() is
+     * capped at 0.85 and then 0.7. This keeps the frame rate steady rather than letting the
+     * device throttle it. The level is raised again once the device has recovered.
+     *
+     * The limits are applied on top of the target frame rate and frame time budget, which keep
+     * their values. Games are told of changes of level through performanceLevelEvent(), so that
+     * they can also scale their own costs, such as the number of particles they emit or the
+     * detail of their animations.
+     *
+     * The initial value is the 'performanceGovernor' value of the graphics section of the game
+     * config. It is disabled by default.
+     *
+     * @param enabled true to enable the performance governor.
+     */
+    void setPerformanceGovernorEnabled(bool enabled);
+
+    /**
+     * Determines whether the performance governor adapts the game to the thermal and battery state of the device.
+     *
+     * @return true if the performance governor is enabled.
+     */
+    bool isPerformanceGovernorEnabled() const;
+
+    /**
+     * Gets the performance level that the performance governor holds the game to.
+     *
+     * @return The performance level, which is PERFORMANCE_FULL while the governor is disabled.
+     */
+    PerformanceLevel getPerformanceLevel() const;
+
+    /**
+     * Shows or hides the performance HUD.
+     *
+     * The HUD is drawn over the frame after the game and its scripts render, and shows the
+     * frame times, rendering statistics, stage timings and memory use of the last frames.
+     * The initial value is the 'performanceHud' value of the graphics section of the game
+     * config. It is hidden by default.
+     *
+     * @param visible true to show the performance HUD.
+     */
+    void setPerformanceHudVisible(bool visible);
+
+    /**
+     * Determines whether the performance HUD is shown.
+     *
+     * @return true if the performance HUD is shown.
+     */
+    bool isPerformanceHudVisible() const;
+
+    /**
+     * Determines whether frames are rendered and presented on a separate render thread.
+     *
+     * The render thread is enabled by the 'renderThread' value of the graphics section of
+     * the game config, on platforms that can move their graphics context between threads.
+     * It is started once initialize() has run on the game thread. While it is enabled, render()
+     * runs on the render thread, while update() and the input events run without a graphics
+     * context and must not make graphics calls. See RenderThread for the details.
+     *
+     * @return true if frames are rendered on a render thread.
+     * @script{ignore}
+     */
+    bool isRenderThreadEnabled() const;
+
+    /**
+     * Starts drawing the scene of the frame at the current resolution scale.
+     *
+     * This binds a render target of the scaled size and sets the viewport to it, unless the
+     * scale is 1. It should be called from render() before the scene is drawn.
+     */
+    void beginScene();
+
+    /**
+     * Finishes drawing the scene of the frame and upscales it to the viewport.
+     *
+     * Forms and other UI drawn after this are drawn at the native resolution.
+     */
+    void endScene();
+
     /**
      * Gets the audio listener for 3D audio.
      * 
@@ -482,6 +806,15 @@ public:
      */
     virtual void gamepadEvent(Gamepad::GamepadEvent evt, Gamepad* gamepad);
 
+    /**
+     * Performance governor callback on changes of the performance level. Override to scale
+     * the costs of the game, such as particle counts or animation detail, to the level.
+     *
+     * @param level The new performance level.
+     * @see setPerformanceGovernorEnabled
+     */
+    virtual void performanceLevelEvent(PerformanceLevel level);
+
     /**
      * Gets the current number of gamepads currently connected to the system.
      *
@@ -678,6 +1011,18 @@ protected:
 
 private:
 
+    /**
+     * The subsystems that can be initialized on first use.
+     */
+    enum Subsystem
+    {
+        SUBSYSTEM_ANIMATION = 1,
+        SUBSYSTEM_AUDIO = 2,
+        SUBSYSTEM_PHYSICS = 4,
+        SUBSYSTEM_AI = 8,
+        SUBSYSTEM_SCRIPT = 16
+    };
+
     struct ShutdownListener : public TimeListener
     {
         void timeEvent(long timeDiff, void* cookie);
@@ -721,6 +1066,58 @@ private:
      */
     void fireTimeEvents(double frameTime);
 
+    /**
+     * Runs the internal subsystem update stages, overlapping independent stages.
+     *
+     * @param elapsedTime The elapsed game time.
+     */
+    void updatePipelined(float elapsedTime);
+
+    /**
+     * Runs a single internal subsystem update stage.
+     *
+     * @param stage The update stage to run.
+     * @param elapsedTime The elapsed game time.
+     */
+    void updateStage(unsigned int stage, float elapsedTime);
+
+    /**
+     * Runs the first time initialization of the game and its script.
+     */
+    void initializeInternal();
+
+    /**
+     * Does the graphics work at the start of a frame, such as destroying the graphics
+     * objects released since the last frame and uploading streamed resources.
+     */
+    void updateGraphics();
+
+    /**
+     * Renders the frame: the game, the scripts and the performance HUD.
+     *
+     * Runs on the render thread when there is one, with the graphics work of updateGraphics() first.
+     *
+     * @param elapsedTime The elapsed game time.
+     * @param running true if the game is running, false if it is paused.
+     */
+    void renderFrame(float elapsedTime, bool running);
+
+    /**
+     * Renders the frame, or hands it to the render thread once it has presented the last one.
+     *
+     * @param elapsedTime The elapsed game time.
+     * @param running true if the game is running, false if it is paused.
+     */
+    void submitFrame(float elapsedTime, bool running);
+
+    /**
+     * Stops the render thread and moves the graphics context back to the calling thread,
+     * or starts it again.
+     *
+     * @param suspended true to suspend the render thread, false to resume it.
+     */
+    void setRenderThreadSuspended(bool suspended);
+
     /**
      * Loads the game configuration.
      */
@@ -731,6 +1128,20 @@ private:
      */
     void loadGamepads();
 
+    /**
+     * Reads which subsystems are initialized at startup, on first use or not at all from the configuration file.
+     *
+     * @return The subsystems to initialize at startup.
+     */
+    unsigned int loadSubsystems();
+
+    /**
+     * Creates and initializes a subsystem that is initialized on first use, if it has not been already.
+     *
+     * @param subsystem The subsystem to initialize.
+     */
+    void initializeSubsystem(Subsystem subsystem) const;
+
     void keyEventInternal(Keyboard::KeyEvent evt, int key);
     void touchEventInternal(Touch::TouchEvent evt, int x, int y, unsigned int contactIndex);
     bool mouseEventInternal(Mouse::MouseEvent evt, int x, int y, int wheelDelta);
@@ -742,6 +1153,7 @@ private:
     void gestureDragEventInternal(int x, int y);
     void gestureDropEventInternal(int x, int y);
     void gamepadEventInternal(Gamepad::GamepadEvent evt, Gamepad* gamepad);
+    void performanceLevelEventInternal(PerformanceLevel level);
 
     bool _initialized;                          // If game has initialized yet.
     State _state;                               // The game state.
@@ -751,6 +1163,7 @@ private:
     double _frameLastFPS;                       // The last time the frame count was updated.
     unsigned int _frameCount;                   // The current frame count.
     unsigned int _frameRate;                    // The current frame rate.
+    unsigned int _frameNumber;                  // The number of frames run since the game started.
     unsigned int _width;                        // The game's display width.
     unsigned int _height;                       // The game's display height.
     Rectangle _viewport;                        // the games's current viewport.
@@ -758,14 +1171,24 @@ private:
     float _clearDepth;                          // The clear depth value last used for clearing the depth buffer.
     int _clearStencil;                          // The clear stencil value last used for clearing the stencil buffer.
     Properties* _properties;                    // Game configuration properties object.
-    AnimationController* _animationController;  // Controls the scheduling and running of animations.
-    AudioController* _audioController;          // Controls audio sources that are playing in the game.
-    PhysicsController* _physicsController;      // Controls the simulation of a physics scene and entities.
-    AIController* _aiController;                // Controls AI simulation.
+    mutable std::atomic<AnimationController*> _animationController;  // Controls the scheduling and running of animations.
+    mutable std::atomic<AudioController*> _audioController;  // Controls audio sources that are playing in the game.
+    mutable std::atomic<PhysicsController*> _physicsController;      // Controls the simulation of a physics scene and entities.
+    mutable std::atomic<AIController*> _aiController;        // Controls AI simulation.
+    unsigned int _lazySubsystems;               // The subsystems not yet initialized that are initialized on first use.
     AudioListener* _audioListener;              // The audio listener in 3D space.
     std::priority_queue<TimeEvent, std::vector<TimeEvent>, std::less<TimeEvent> >* _timeEvents;     // Contains the scheduled time events.
-    ScriptController* _scriptController;            // Controls the scripting engine.
+    mutable std::atomic<ScriptController*> _scriptController;    // Controls the scripting engine.
     ScriptTarget* _scriptTarget;                // Script target for the game
+    JobSystem* _jobSystem;                      // Schedules jobs across the worker threads.
+    bool _pipelinedUpdate;                      // If the internal subsystem updates are pipelined.
+    FrameStats _frameStats;                     // The rendering statistics of the last completed frame.
+    DynamicResolution* _dynamicResolution;      // Scales the resolution of the scene to the frame time budget.
+    FramePacer* _framePacer;                    // Limits the frame rate and smooths the elapsed time.
+    PerformanceGovernor* _performanceGovernor;  // Adapts the frame rate and resolution to the thermal and battery state.
+    PerformanceHud* _performanceHud;            // Draws the performance overlay while it is visible.
+    RenderThread* _renderThread;                // Renders and presents frames while the next one updates, if enabled.
+    UploadThread* _uploadThread;                // Uploads streamed resources through a shared graphics context, if enabled.
 
     // Note: Do not add STL object member variables on the stack; this will cause false memory leaks to be reported.
 
@@ -19,6 +19,11 @@ inline unsigned int Game::getFrameRate() const
     return _frameRate;
 }
 
+inline unsigned int Game::getFrameNumber() const
+{
+    return _frameNumber;
+}
+
 inline unsigned int Game::getWidth() const
 {
     return _width;
@@ -41,26 +46,81 @@ inline const Rectangle& Game::getViewport() const
 
 inline AnimationController* Game::getAnimationController() const
 {
-    return _animationController;
+    AnimationController* animationController = _animationController.load(std::memory_order_acquire);
+    if (animationController == NULL && (_lazySubsystems & SUBSYSTEM_ANIMATION))
+    {
+        initializeSubsystem(SUBSYSTEM_ANIMATION);
+        animationController = _animationController.load(std::memory_order_acquire);
+    }
+    return animationController;
 }
 
 inline AudioController* Game::getAudioController() const
 {
-    return _audioController;
+    AudioController* audioController = _audioController.load(std::memory_order_acquire);
+    if (audioController == NULL && (_lazySubsystems & SUBSYSTEM_AUDIO))
+    {
+        initializeSubsystem(SUBSYSTEM_AUDIO);
+        audioController = _audioController.load(std::memory_order_acquire);
+    }
+    return audioController;
 }
 
 inline PhysicsController* Game::getPhysicsController() const
 {
-    return _physicsController;
+    PhysicsController* physicsController = _physicsController.load(std::memory_order_acquire);
+    if (physicsController == NULL && (_lazySubsystems & SUBSYSTEM_PHYSICS))
+    {
+        initializeSubsystem(SUBSYSTEM_PHYSICS);
+        physicsController = _physicsController.load(std::memory_order_acquire);
+    }
+    return physicsController;
 }
 
 inline ScriptController* Game::getScriptController() const
 {
-    return _scriptController;
+    ScriptController* scriptController = _scriptController.load(std::memory_order_acquire);
+    if (scriptController == NULL && (_lazySubsystems & SUBSYSTEM_SCRIPT))
+    {
+        initializeSubsystem(SUBSYSTEM_SCRIPT);
+        scriptController = _scriptController.load(std::memory_order_acquire);
+    }
+    return scriptController;
 }
 inline AIController* Game::getAIController() const
 {
-    return _aiController;
+    AIController* aiController = _aiController.load(std::memory_order_acquire);
+    if (aiController == NULL && (_lazySubsystems & SUBSYSTEM_AI))
+    {
+        initializeSubsystem(SUBSYSTEM_AI);
+        aiController = _aiController.load(std::memory_order_acquire);
+    }
+    return aiController;
+}
+
+inline JobSystem* Game::getJobSystem() const
+{
+    return _jobSystem;
+}
+
+inline UploadThread* Game::getUploadThread() const
+{
+    return _uploadThread;
+}
+
+inline const FrameStats& Game::getFrameStats() const
+{
+    return _frameStats;
+}
+
+inline void Game::setPipelinedUpdate(bool enabled)
+{
+    _pipelinedUpdate = enabled;
+}
+
+inline bool Game::isPipelinedUpdate() const
+{
+    return _pipelinedUpdate;
 }
 
 template <class T>
@@ -5,6 +5,7 @@
 #include "Platform.h"
 #include "Form.h"
 #include "JoystickControl.h"
+#include "InputRecorder.h"
 
 namespace gameplay
 {
@@ -240,7 +241,8 @@ const char* Gamepad::getName() const
 
 void Gamepad::update(float elapsedTime)
 {
-    if (!_form)
+    // Replays set the state of the physical gamepads from the recording instead.
+    if (!_form && !InputRecorder::isReplaying())
     {
         Platform::pollGamepadState(this);
     }
@@ -248,11 +250,15 @@ void Gamepad::update(float elapsedTime)
 
 void Gamepad::updateInternal(float elapsedTime)
 {
+    GP_PROFILE_SCOPE("Gamepad::updateInternal");
+
     unsigned int size = __gamepads.size();
     for (unsigned int i = 0; i < size; ++i)
     {
         __gamepads[i]->update(elapsedTime);
     }
+
+    InputRecorder::updateGamepads();
 }
 
 void Gamepad::draw()
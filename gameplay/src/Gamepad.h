@@ -23,6 +23,7 @@ class Gamepad
     friend class Platform;
     friend class Game;
     friend class Button;
+    friend class InputRecorder;
 
 public:
 
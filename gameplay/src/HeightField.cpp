@@ -3,18 +3,30 @@
 #include "Image.h"
 #include "FileSystem.h"
 
+// The number of heights interpolated together by getHeights, gathered into arrays on the stack.
+#define HEIGHTFIELD_QUERY_BLOCK_SIZE 64
+
 namespace gameplay
 {
 
-HeightField::HeightField(unsigned int columns, unsigned int rows)
-    : _array(NULL), _cols(columns), _rows(rows)
+HeightField::HeightField(unsigned int columns, unsigned int rows, Storage storage)
+    : _array(NULL), _samples(NULL), _mapping(NULL), _mappingSize(0), _sampleScale(1.0f), _sampleOffset(0.0f),
+      _storage(storage), _cols(columns), _rows(rows)
 {
-    _array = new float[columns * rows];
+    // Mapped heightfields point their samples into the file once it is mapped
+    if (storage == STORAGE_FLOAT)
+        _array = new float[columns * rows];
+    else if (storage == STORAGE_QUANTIZED)
+        _samples = new unsigned short[columns * rows];
 }
 
 HeightField::~HeightField()
 {
     SAFE_DELETE_ARRAY(_array);
+    if (_mapping)
+        FileSystem::unmapFile(_mapping, _mappingSize);
+    else
+        delete[] const_cast<unsigned short*>(_samples);
 }
 
 HeightField* HeightField::create(unsigned int columns, unsigned int rows)
@@ -35,23 +47,26 @@ float normalizedHeightPacked(float r, float g, float b)
     return (256.0f*r + g + 0.00390625f*b) / 65536.0f;
 }
 
-HeightField* HeightField::createFromImage(const char* path, float heightMin, float heightMax)
+HeightField* HeightField::createFromImage(const char* path, float heightMin, float heightMax, Storage storage)
 {
-    return create(path, 0, 0, heightMin, heightMax);
+    return create(path, 0, 0, heightMin, heightMax, storage);
 }
 
-HeightField* HeightField::createFromRAW(const char* path, unsigned int width, unsigned int height, float heightMin, float heightMax)
+HeightField* HeightField::createFromRAW(const char* path, unsigned int width, unsigned int height, float heightMin, float heightMax, Storage storage)
 {
-    return create(path, width, height, heightMin, heightMax);
+    return create(path, width, height, heightMin, heightMax, storage);
 }
 
-HeightField* HeightField::create(const char* path, unsigned int width, unsigned int height, float heightMin, float heightMax)
+HeightField* HeightField::create(const char* path, unsigned int width, unsigned int height, float heightMin, float heightMax, Storage storage)
 {
     GP_ASSERT(path);
     GP_ASSERT(heightMax >= heightMin);
 
     float heightScale = heightMax - heightMin;
 
+    // Only RAW16 files can be mapped, which is decided once the file size is known
+    Storage memoryStorage = storage == STORAGE_MAPPED ? STORAGE_QUANTIZED : storage;
+
     HeightField* heightfield = NULL;
 
     // Load height data from image
@@ -79,8 +94,9 @@ HeightField* HeightField::create(const char* path, unsigned int width, unsigned
         }
 
         // Calculate the heights for each pixel.
-        heightfield = HeightField::create(image->getWidth(), image->getHeight());
-        float* heights = heightfield->getArray();
+        heightfield = new HeightField(image->getWidth(), image->getHeight(), memoryStorage);
+        heightfield->_sampleScale = heightScale / 65535.0f;
+        heightfield->_sampleOffset = heightMin;
         unsigned char* data = image->getData();
         int idx;
         for (int y = image->getHeight()-1, i = 0; y >= 0; --y)
@@ -88,7 +104,7 @@ HeightField* HeightField::create(const char* path, unsigned int width, unsigned
             for (unsigned int x = 0, w = image->getWidth(); x < w; ++x)
             {
                 idx = (y*w + x) * pixelSize;
-                heights[i++] = heightMin + normalizedHeightPacked(data[idx], data[idx + 1], data[idx + 2]) * heightScale;
+                heightfield->setSample(i++, heightMin + normalizedHeightPacked(data[idx], data[idx + 1], data[idx + 2]) * heightScale);
             }
         }
 
@@ -103,6 +119,25 @@ HeightField* HeightField::create(const char* path, unsigned int width, unsigned
             return NULL;
         }
 
+        // Map RAW16 files, reading in only the pages that heights are queried from.
+        // RAW16 files are little endian, as are all supported platforms.
+        if (storage == STORAGE_MAPPED)
+        {
+            size_t mappingSize = 0;
+            const void* mapping = FileSystem::mapFile(path, &mappingSize);
+            if (mapping && mappingSize == (size_t)width * height * 2)
+            {
+                heightfield = new HeightField(width, height, STORAGE_MAPPED);
+                heightfield->_mapping = mapping;
+                heightfield->_mappingSize = mappingSize;
+                heightfield->_samples = (const unsigned short*)mapping;
+                heightfield->_sampleScale = heightScale / 65535.0f;
+                heightfield->_sampleOffset = heightMin;
+                return heightfield;
+            }
+            FileSystem::unmapFile(mapping, mappingSize);
+        }
+
         // Load raw bytes
         int fileSize = 0;
         unsigned char* bytes = (unsigned char*)FileSystem::readAll(path, &fileSize);
@@ -121,8 +156,9 @@ HeightField* HeightField::create(const char* path, unsigned int width, unsigned
             return NULL;
         }
 
-        heightfield = HeightField::create(width, height);
-        float* heights = heightfield->getArray();
+        heightfield = new HeightField(width, height, memoryStorage);
+        heightfield->_sampleScale = heightScale / 65535.0f;
+        heightfield->_sampleOffset = heightMin;
 
         if (bits == 16)
         {
@@ -133,7 +169,7 @@ HeightField* HeightField::create(const char* path, unsigned int width, unsigned
                 for (unsigned int x = 0; x < width; ++x, ++i)
                 {
                     idx = (y * width + x) << 1;
-                    heights[i] = heightMin + ((bytes[idx] | (int)bytes[idx+1] << 8) / 65535.0f) * heightScale;
+                    heightfield->setSample(i, heightMin + ((bytes[idx] | (int)bytes[idx+1] << 8) / 65535.0f) * heightScale);
                 }
             }
         }
@@ -144,7 +180,7 @@ HeightField* HeightField::create(const char* path, unsigned int width, unsigned
             {
                 for (unsigned int x = 0; x < width; ++x, ++i)
                 {
-                    heights[i] = heightMin + (bytes[y * width + x] / 255.0f) * heightScale;
+                    heightfield->setSample(i, heightMin + (bytes[y * width + x] / 255.0f) * heightScale);
                 }
             }
         }
@@ -159,11 +195,44 @@ HeightField* HeightField::create(const char* path, unsigned int width, unsigned
     return heightfield;
 }
 
+HeightField::Storage HeightField::getStorage() const
+{
+    return _storage;
+}
+
 float* HeightField::getArray() const
 {
     return _array;
 }
 
+const unsigned short* HeightField::getSampleArray() const
+{
+    return _samples;
+}
+
+float HeightField::getSampleScale() const
+{
+    return _sampleScale;
+}
+
+float HeightField::getSampleOffset() const
+{
+    return _sampleOffset;
+}
+
+void HeightField::setSample(unsigned int index, float height)
+{
+    if (_array)
+    {
+        _array[index] = height;
+    }
+    else
+    {
+        float sample = _sampleScale > 0.0f ? (height - _sampleOffset) / _sampleScale + 0.5f : 0.0f;
+        const_cast<unsigned short*>(_samples)[index] = (unsigned short)(sample < 0.0f ? 0.0f : (sample > 65535.0f ? 65535.0f : sample));
+    }
+}
+
 float HeightField::getHeight(float column, float row) const
 {
     // Clamp to heightfield boundaries
@@ -182,15 +251,15 @@ float HeightField::getHeight(float column, float row) const
 
     if (x2 >= _cols && y2 >= _rows)
     {
-        return _array[x1 + y1 * _cols];
+        return getSample(x1, y1);
     }
     else if (x2 >= _cols)
     {
-        return _array[x1 + y1 * _cols] * yFactorI + _array[x1 + y2 * _cols] * yFactor;
+        return getSample(x1, y1) * yFactorI + getSample(x1, y2) * yFactor;
     }
     else if (y2 >= _rows)
     {
-        return _array[x1 + y1 * _cols] * xFactorI + _array[x2 + y1 * _cols] * xFactor;
+        return getSample(x1, y1) * xFactorI + getSample(x2, y1) * xFactor;
     }
     else
     {
@@ -198,8 +267,50 @@ float HeightField::getHeight(float column, float row) const
         float b = xFactorI * yFactor;
         float c = xFactor * yFactor;
         float d = xFactor * yFactorI;
-        return _array[x1 + y1 * _cols] * a + _array[x1 + y2 * _cols] * b +
-            _array[x2 + y2 * _cols] * c + _array[x2 + y1 * _cols] * d;
+        return getSample(x1, y1) * a + getSample(x1, y2) * b +
+            getSample(x2, y2) * c + getSample(x2, y1) * d;
+    }
+}
+
+void HeightField::getHeights(const float* columns, const float* rows, unsigned int count, float* heights) const
+{
+    GP_ASSERT(columns);
+    GP_ASSERT(rows);
+    GP_ASSERT(heights);
+
+    const float maxColumn = (float)(_cols - 1);
+    const float maxRow = (float)(_rows - 1);
+    float h00[HEIGHTFIELD_QUERY_BLOCK_SIZE];
+    float h10[HEIGHTFIELD_QUERY_BLOCK_SIZE];
+    float h01[HEIGHTFIELD_QUERY_BLOCK_SIZE];
+    float h11[HEIGHTFIELD_QUERY_BLOCK_SIZE];
+    float fx[HEIGHTFIELD_QUERY_BLOCK_SIZE];
+    float fy[HEIGHTFIELD_QUERY_BLOCK_SIZE];
+    for (unsigned int first = 0; first < count; first += HEIGHTFIELD_QUERY_BLOCK_SIZE)
+    {
+        const unsigned int blockCount = std::min(count - first, (unsigned int)HEIGHTFIELD_QUERY_BLOCK_SIZE);
+
+        // Clamp to heightfield boundaries, where the neighbors past the last row or column are the boundary itself.
+        for (unsigned int i = 0; i < blockCount; ++i)
+        {
+            float column = columns[first + i];
+            float row = rows[first + i];
+            column = column < 0 ? 0 : (column > maxColumn ? maxColumn : column);
+            row = row < 0 ? 0 : (row > maxRow ? maxRow : row);
+
+            const unsigned int x1 = (unsigned int)column;
+            const unsigned int y1 = (unsigned int)row;
+            const unsigned int x2 = std::min(x1 + 1, _cols - 1);
+            const unsigned int y2 = std::min(y1 + 1, _rows - 1);
+            fx[i] = column - (float)x1;
+            fy[i] = row - (float)y1;
+            h00[i] = getSample(x1, y1);
+            h10[i] = getSample(x2, y1);
+            h01[i] = getSample(x1, y2);
+            h11[i] = getSample(x2, y2);
+        }
+
+        MathUtil::bilinearArray(h00, h10, h01, h11, fx, fy, heights + first, blockCount);
     }
 }
 
@@ -12,11 +12,40 @@ namespace gameplay
      * Heightfields can be used to construct both Terrain objects as well as PhysicsCollisionShape
      * heightfield defintions, which are used in heightfield rigid body creation. Heightfields can
      * be populated manually, or loaded from images and RAW files.
+     *
+     * Heights loaded from images and RAW files can be kept compact, as 16-bit samples between
+     * the minimum and maximum height, which takes half the memory of float heights. RAW16 files
+     * can also be memory-mapped, in which case only the regions of the file that are queried
+     * are read into memory. Compact heightfields have no float height array.
      */
     class HeightField : public Ref
     {
     public:
 
+        /**
+         * Defines how the heights of a heightfield are stored.
+         */
+        enum Storage
+        {
+            /**
+             * Heights are stored in memory as floats.
+             */
+            STORAGE_FLOAT,
+
+            /**
+             * Heights are stored in memory as 16-bit samples between the minimum and maximum height.
+             */
+            STORAGE_QUANTIZED,
+
+            /**
+             * Heights are read from a memory-mapped RAW16 file as they are queried.
+             *
+             * Heightfields from images and RAW8 files, or on platforms that cannot map the
+             * file, fall back to STORAGE_QUANTIZED.
+             */
+            STORAGE_MAPPED
+        };
+
         /**
          * Creates a new HeightField of the given dimensions, with uninitialized height data.
          *
@@ -40,10 +69,11 @@ namespace gameplay
          * @param path Path to a heightfield image.
          * @param heightMin Minimum height value for a zero intensity pixel.
          * @param heightMax Maximum height value for a full intensity heightfield pixel (must be >= minHeight).
+         * @param storage How to store the heights.
          *
          * @return The new HeightField.
          */
-        static HeightField* createFromImage(const char* path, float heightMin = 0, float heightMax = 1);
+        static HeightField* createFromImage(const char* path, float heightMin = 0, float heightMax = 1, Storage storage = STORAGE_FLOAT);
 
         /**
          * Creates a HeightField from the specified RAW8 or RAW16 file.
@@ -67,10 +97,18 @@ namespace gameplay
          * @param height Height of the RAW data.
          * @param heightMin Minimum height value for a zero intensity pixel.
          * @param heightMax Maximum height value for a full intensity heightfield pixel (must be >= minHeight).
+         * @param storage How to store the heights.
          *
          * @return The new HeightField.
          */
-        static HeightField* createFromRAW(const char* path, unsigned int width, unsigned int height, float heightMin = 0, float heightMax = 1);
+        static HeightField* createFromRAW(const char* path, unsigned int width, unsigned int height, float heightMin = 0, float heightMax = 1, Storage storage = STORAGE_FLOAT);
+
+        /**
+         * Returns how the heights of this heightfield are stored.
+         *
+         * @return The storage of the heights.
+         */
+        Storage getStorage() const;
 
         /**
          * Returns a pointer to the underlying height array.
@@ -78,10 +116,45 @@ namespace gameplay
          * The array is packed in row major order, meaning that the data is aligned in rows,
          * from top left to bottom right.
          *
-         * @return The underlying height array.
+         * @return The underlying height array, or NULL if the heights are not stored as floats.
          */
         float* getArray() const;
 
+        /**
+         * Returns a pointer to the underlying 16-bit samples of a compact heightfield.
+         *
+         * The samples are packed in the same order as the height array. The height of a
+         * sample is getSampleOffset() + sample * getSampleScale().
+         *
+         * @return The underlying samples, or NULL if the heights are stored as floats.
+         * @script{ignore}
+         */
+        const unsigned short* getSampleArray() const;
+
+        /**
+         * Returns the height of a 16-bit sample of one step above the height of zero.
+         *
+         * @return The height step between samples.
+         */
+        float getSampleScale() const;
+
+        /**
+         * Returns the height of a 16-bit sample of zero.
+         *
+         * @return The height of a zero sample.
+         */
+        float getSampleOffset() const;
+
+        /**
+         * Returns the height stored at the specified row and column, whatever the storage.
+         *
+         * @param column The column of the height value, less than the column count.
+         * @param row The row of the height value, less than the row count.
+         *
+         * @return The height value.
+         */
+        inline float getSample(unsigned int column, unsigned int row) const;
+
         /**
          * Returns the height at the specified row and column.
          *
@@ -99,6 +172,20 @@ namespace gameplay
          */
         float getHeight(float column, float row) const;
 
+        /**
+         * Returns the heights at an array of rows and columns, as getHeight() does for each of them.
+         *
+         * The neighboring height values are gathered for each point and then interpolated
+         * together, which is much faster than calling getHeight() for many points.
+         *
+         * @param columns The columns of the height values to query.
+         * @param rows The rows of the height values to query.
+         * @param count The number of points to query.
+         * @param heights Set to the height values.
+         * @script{ignore}
+         */
+        void getHeights(const float* columns, const float* rows, unsigned int count, float* heights) const;
+
         /**
          * Returns the number of rows in the heightfield.
          *
@@ -118,7 +205,7 @@ namespace gameplay
         /**
          * Hidden constructor.
          */
-        HeightField(unsigned int columns, unsigned int rows);
+        HeightField(unsigned int columns, unsigned int rows, Storage storage = STORAGE_FLOAT);
 
         /**
          * Hidden destructor (use Ref::release()).
@@ -128,13 +215,26 @@ namespace gameplay
         /**
          * Internal method for creating a HeightField.
          */
-        static HeightField* create(const char* path, unsigned int width, unsigned int height, float heightMin, float heightMax);
+        static HeightField* create(const char* path, unsigned int width, unsigned int height, float heightMin, float heightMax, Storage storage);
+
+        /**
+         * Sets the height of a sample, quantizing it for compact storage.
+         */
+        void setSample(unsigned int index, float height);
 
         float* _array;
+        const unsigned short* _samples;
+        const void* _mapping;
+        size_t _mappingSize;
+        float _sampleScale;
+        float _sampleOffset;
+        Storage _storage;
         unsigned int _cols;
         unsigned int _rows;
     };
 
 }
 
+#include "HeightField.inl"
+
 #endif
@@ -0,0 +1,12 @@
+#include "HeightField.h"
+
+namespace gameplay
+{
+
+inline float HeightField::getSample(unsigned int column, unsigned int row) const
+{
+    unsigned int index = column + row * _cols;
+    return _array ? _array[index] : _sampleOffset + _samples[index] * _sampleScale;
+}
+
+}
@@ -2,6 +2,20 @@
 #include "FileSystem.h"
 #include "Image.h"
 
+// Size of the QOI header: the "qoif" identifier, the big-endian width and height, the channel count and the color space.
+#define QOI_HEADER_SIZE 14
+// Size of the marker ending the chunks of a QOI file.
+#define QOI_END_MARKER_SIZE 8
+
+// QOI chunk tags. The 8-bit tags take precedence over the 2-bit tags.
+#define QOI_OP_INDEX 0x00
+#define QOI_OP_DIFF 0x40
+#define QOI_OP_LUMA 0x80
+#define QOI_OP_RUN 0xc0
+#define QOI_OP_RGB 0xfe
+#define QOI_OP_RGBA 0xff
+#define QOI_MASK_2 0xc0
+
 namespace gameplay
 {
 // Callback for reading a png image using Stream
@@ -14,32 +28,52 @@ static void readStream(png_structp png, png_bytep data, png_size_t length)
     }
 }
 
-Image* Image::create(const char* path)
+// Callback for writing a png image using Stream
+static void writeStream(png_structp png, png_bytep data, png_size_t length)
 {
-    GP_ASSERT(path);
-
-    // Open the file.
-    std::unique_ptr<Stream> stream(FileSystem::open(path));
-    if (stream.get() == NULL || !stream->canRead())
+    Stream* stream = reinterpret_cast<Stream*>(png_get_io_ptr(png));
+    if (stream == NULL || stream->write(data, 1, length) != length)
     {
-        GP_ERROR("Failed to open image file '%s'.", path);
-        return NULL;
+        png_error(png, "Error writing PNG.");
     }
+}
 
-    // Verify PNG signature.
-    unsigned char sig[8];
-    if (stream->read(sig, 1, 8) != 8 || png_sig_cmp(sig, 0, 8) != 0)
+// Callback for flushing a png image written to a Stream, which is flushed once it is closed.
+static void flushStream(png_structp png)
+{
+}
+
+/**
+ * Checks that a caller's buffer can hold an image, or allocates one.
+ */
+static bool prepareBuffer(const char* path, unsigned char** data, size_t size, size_t required)
+{
+    if (*data == NULL)
     {
-        GP_ERROR("Failed to load file '%s'; not a valid PNG.", path);
-        return NULL;
+        *data = new unsigned char[required];
+    }
+    else if (size < required)
+    {
+        GP_WARN("Buffer of %u bytes is too small to decode image file '%s' of %u bytes.", (unsigned int)size, path, (unsigned int)required);
+        return false;
     }
+    return true;
+}
 
+/**
+ * Reads the header of a PNG file, after its signature, and decodes it if requested.
+ *
+ * Rows are decoded straight into the output, bottom-up, without an intermediate copy.
+ */
+static bool readPNG(Stream* stream, const char* path, bool decode, unsigned char** data, size_t size,
+                    unsigned int* width, unsigned int* height, Image::Format* format)
+{
     // Initialize png read struct (last three parameters use stderr+longjump if NULL).
     png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
     if (png == NULL)
     {
         GP_ERROR("Failed to create PNG structure for reading PNG file '%s'.", path);
-        return NULL;
+        return false;
     }
 
     // Initialize info struct.
@@ -48,65 +82,298 @@ Image* Image::create(const char* path)
     {
         GP_ERROR("Failed to create PNG info structure for PNG file '%s'.", path);
         png_destroy_read_struct(&png, NULL, NULL);
-        return NULL;
+        return false;
     }
 
     // Set up error handling (required without using custom error handlers above).
+    // Locals changed after setjmp must be volatile to be valid after a longjmp.
+    png_bytep* volatile rows = NULL;
     if (setjmp(png_jmpbuf(png)))
     {
-        GP_ERROR("Failed to set up error handling for reading PNG file '%s'.", path);
+        GP_ERROR("Failed to read PNG file '%s'.", path);
+        SAFE_DELETE_ARRAY(rows);
         png_destroy_read_struct(&png, &info, NULL);
-        return NULL;
+        return false;
     }
 
     // Initialize file io.
-    png_set_read_fn(png, stream.get(), readStream);
+    png_set_read_fn(png, stream, readStream);
 
     // Indicate that we already read the first 8 bytes (signature).
     png_set_sig_bytes(png, 8);
 
-    // Read the entire image into memory.
-    png_read_png(png, info, PNG_TRANSFORM_STRIP_16 | PNG_TRANSFORM_PACKING | PNG_TRANSFORM_EXPAND | PNG_TRANSFORM_GRAY_TO_RGB, NULL);
-
-    Image* image = new Image();
-    image->_width = png_get_image_width(png, info);
-    image->_height = png_get_image_height(png, info);
+    // Expand every color type to 8-bit RGB or RGBA.
+    png_read_info(png, info);
+    png_set_strip_16(png);
+    png_set_packing(png);
+    png_set_expand(png);
+    png_set_gray_to_rgb(png);
+    png_set_interlace_handling(png);
+    png_read_update_info(png, info);
 
     png_byte colorType = png_get_color_type(png, info);
     switch (colorType)
     {
     case PNG_COLOR_TYPE_RGBA:
-        image->_format = Image::RGBA;
+        *format = Image::RGBA;
         break;
 
     case PNG_COLOR_TYPE_RGB:
-        image->_format = Image::RGB;
+        *format = Image::RGB;
         break;
 
     default:
         GP_ERROR("Unsupported PNG color type (%d) for image file '%s'.", (int)colorType, path);
         png_destroy_read_struct(&png, &info, NULL);
-        return NULL;
+        return false;
     }
 
-    size_t stride = png_get_rowbytes(png, info);
+    *width = png_get_image_width(png, info);
+    *height = png_get_image_height(png, info);
+    if (!decode)
+    {
+        png_destroy_read_struct(&png, &info, NULL);
+        return true;
+    }
 
-    // Allocate image data.
-    image->_data = new unsigned char[stride * image->_height];
+    size_t stride = png_get_rowbytes(png, info);
+    if (!prepareBuffer(path, data, size, stride * (*height)))
+    {
+        png_destroy_read_struct(&png, &info, NULL);
+        return false;
+    }
 
-    // Read rows into image data.
-    png_bytepp rows = png_get_rows(png, info);
-    for (unsigned int i = 0; i < image->_height; ++i)
+    // Point the rows at the output so that they are stored bottom-up.
+    rows = new png_bytep[*height];
+    for (unsigned int i = 0; i < *height; ++i)
     {
-        memcpy(image->_data+(stride * (image->_height-1-i)), rows[i], stride);
+        rows[i] = *data + stride * (*height - 1 - i);
     }
+    png_read_image(png, rows);
+    png_read_end(png, NULL);
 
     // Clean up.
+    SAFE_DELETE_ARRAY(rows);
     png_destroy_read_struct(&png, &info, NULL);
 
+    return true;
+}
+
+/**
+ * Reads the header of a QOI file, whose first 8 bytes have been read, and decodes it if requested.
+ *
+ * @see https://qoiformat.org/qoi-specification.pdf
+ */
+static bool readQOI(Stream* stream, const unsigned char* signature, const char* path, bool decode, unsigned char** data, size_t size,
+                    unsigned int* width, unsigned int* height, Image::Format* format)
+{
+    unsigned char header[QOI_HEADER_SIZE];
+    memcpy(header, signature, 8);
+    if (stream->read(header + 8, 1, QOI_HEADER_SIZE - 8) != QOI_HEADER_SIZE - 8)
+    {
+        GP_ERROR("Failed to read QOI header of image file '%s'.", path);
+        return false;
+    }
+
+    *width = ((unsigned int)header[4] << 24) | ((unsigned int)header[5] << 16) | ((unsigned int)header[6] << 8) | header[7];
+    *height = ((unsigned int)header[8] << 24) | ((unsigned int)header[9] << 16) | ((unsigned int)header[10] << 8) | header[11];
+    unsigned int channels = header[12];
+    if (*width == 0 || *height == 0 || (channels != 3 && channels != 4))
+    {
+        GP_ERROR("Invalid QOI header for image file '%s'.", path);
+        return false;
+    }
+    *format = channels == 4 ? Image::RGBA : Image::RGB;
+    if (!decode)
+        return true;
+
+    // Read all of the chunks at once, which is much faster than reading them from the stream.
+    size_t length = stream->length();
+    if (length < QOI_HEADER_SIZE + QOI_END_MARKER_SIZE)
+    {
+        GP_ERROR("Truncated QOI image file '%s'.", path);
+        return false;
+    }
+    std::vector<unsigned char> chunks(length - QOI_HEADER_SIZE);
+    if (stream->read(&chunks[0], 1, chunks.size()) != chunks.size())
+    {
+        GP_ERROR("Failed to read QOI image file '%s'.", path);
+        return false;
+    }
+
+    size_t stride = (size_t)(*width) * channels;
+    if (!prepareBuffer(path, data, size, stride * (*height)))
+        return false;
+
+    unsigned char index[64][4];
+    memset(index, 0, sizeof(index));
+    unsigned char pixel[4] = { 0, 0, 0, 255 };
+    size_t position = 0;
+    size_t end = chunks.size() - QOI_END_MARKER_SIZE;
+    unsigned int run = 0;
+    bool truncated = false;
+    for (unsigned int y = 0; y < *height && !truncated; ++y)
+    {
+        // Rows are stored top-down and decoded bottom-up.
+        unsigned char* row = *data + stride * (*height - 1 - y);
+        for (unsigned int x = 0; x < *width && !truncated; ++x)
+        {
+            if (run > 0)
+            {
+                --run;
+            }
+            else if (position < end)
+            {
+                unsigned char tag = chunks[position++];
+                if (tag == QOI_OP_RGB)
+                {
+                    if (end - position < 3)
+                    {
+                        truncated = true;
+                        break;
+                    }
+                    pixel[0] = chunks[position++];
+                    pixel[1] = chunks[position++];
+                    pixel[2] = chunks[position++];
+                }
+                else if (tag == QOI_OP_RGBA)
+                {
+                    if (end - position < 4)
+                    {
+                        truncated = true;
+                        break;
+                    }
+                    pixel[0] = chunks[position++];
+                    pixel[1] = chunks[position++];
+                    pixel[2] = chunks[position++];
+                    pixel[3] = chunks[position++];
+                }
+                else if ((tag & QOI_MASK_2) == QOI_OP_INDEX)
+                {
+                    memcpy(pixel, index[tag], 4);
+                }
+                else if ((tag & QOI_MASK_2) == QOI_OP_DIFF)
+                {
+                    pixel[0] += ((tag >> 4) & 0x03) - 2;
+                    pixel[1] += ((tag >> 2) & 0x03) - 2;
+                    pixel[2] += (tag & 0x03) - 2;
+                }
+                else if ((tag & QOI_MASK_2) == QOI_OP_LUMA)
+                {
+                    if (position >= end)
+                    {
+                        truncated = true;
+                        break;
+                    }
+                    unsigned char second = chunks[position++];
+                    int dg = (tag & 0x3f) - 32;
+                    pixel[0] += dg - 8 + ((second >> 4) & 0x0f);
+                    pixel[1] += dg;
+                    pixel[2] += dg - 8 + (second & 0x0f);
+                }
+                else
+                {
+                    run = tag & 0x3f;
+                }
+                memcpy(index[(pixel[0] * 3 + pixel[1] * 5 + pixel[2] * 7 + pixel[3] * 11) % 64], pixel, 4);
+            }
+            else
+            {
+                truncated = true;
+            }
+            memcpy(row + x * channels, pixel, channels);
+        }
+    }
+    if (truncated)
+    {
+        GP_ERROR("Truncated QOI image file '%s'.", path);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Reads the header of the image file at the given path, and decodes it if requested.
+ */
+static bool readImage(const char* path, bool decode, unsigned char** data, size_t size,
+                      unsigned int* width, unsigned int* height, Image::Format* format)
+{
+    GP_ASSERT(path);
+    GP_ASSERT(data);
+    GP_ASSERT(width);
+    GP_ASSERT(height);
+    GP_ASSERT(format);
+
+    // Open the file.
+    std::unique_ptr<Stream> stream(FileSystem::open(path));
+    if (stream.get() == NULL || !stream->canRead())
+    {
+        GP_ERROR("Failed to open image file '%s'.", path);
+        return false;
+    }
+
+    // Identify the file from its signature.
+    unsigned char sig[8];
+    if (stream->read(sig, 1, 8) == 8)
+    {
+        if (png_sig_cmp(sig, 0, 8) == 0)
+            return readPNG(stream.get(), path, decode, data, size, width, height, format);
+        if (memcmp(sig, "qoif", 4) == 0)
+            return readQOI(stream.get(), sig, path, decode, data, size, width, height, format);
+    }
+    GP_ERROR("Failed to load file '%s'; not a valid PNG or QOI image.", path);
+    return false;
+}
+
+Image* Image::create(const char* path)
+{
+    GP_ASSERT(path);
+
+    unsigned int width;
+    unsigned int height;
+    Format format;
+    unsigned char* data = read(path, NULL, 0, &width, &height, &format);
+    if (data == NULL)
+        return NULL;
+
+    Image* image = new Image();
+    image->_width = width;
+    image->_height = height;
+    image->_format = format;
+    image->_data = data;
+
     return image;
 }
 
+bool Image::getInfo(const char* path, unsigned int* width, unsigned int* height, Format* format)
+{
+    unsigned char* data = NULL;
+    return readImage(path, false, &data, 0, width, height, format);
+}
+
+bool Image::decode(const char* path, unsigned char* data, size_t size)
+{
+    GP_ASSERT(data);
+
+    unsigned int width;
+    unsigned int height;
+    Format format;
+    return read(path, data, size, &width, &height, &format) != NULL;
+}
+
+unsigned char* Image::read(const char* path, unsigned char* data, size_t size, unsigned int* width, unsigned int* height, Format* format)
+{
+    unsigned char* output = data;
+    if (!readImage(path, true, &output, size, width, height, format))
+    {
+        // Free the buffer allocated for a file that failed to decode part way through.
+        if (output != data)
+            SAFE_DELETE_ARRAY(output);
+        return NULL;
+    }
+    return output;
+}
+
 Image* Image::create(unsigned int width, unsigned int height, Image::Format format, unsigned char* data)
 {
     GP_ASSERT(width > 0 && height > 0);
@@ -141,6 +408,62 @@ Image::Image() : _data(NULL), _format(RGB), _width(0), _height(0)
 {
 }
 
+bool Image::save(const char* path) const
+{
+    GP_ASSERT(path);
+    GP_ASSERT(_data);
+
+    std::unique_ptr<Stream> stream(FileSystem::open(path, FileSystem::WRITE));
+    if (stream.get() == NULL || !stream->canWrite())
+    {
+        GP_ERROR("Failed to open image file '%s' for writing.", path);
+        return false;
+    }
+
+    png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    if (png == NULL)
+    {
+        GP_ERROR("Failed to create PNG structure for writing PNG file '%s'.", path);
+        return false;
+    }
+    png_infop info = png_create_info_struct(png);
+    if (info == NULL)
+    {
+        GP_ERROR("Failed to create PNG info structure for PNG file '%s'.", path);
+        png_destroy_write_struct(&png, NULL);
+        return false;
+    }
+
+    png_bytep* volatile rows = NULL;
+    if (setjmp(png_jmpbuf(png)))
+    {
+        GP_ERROR("Failed to write PNG file '%s'.", path);
+        SAFE_DELETE_ARRAY(rows);
+        png_destroy_write_struct(&png, &info);
+        return false;
+    }
+
+    png_set_write_fn(png, stream.get(), writeStream, flushStream);
+    png_set_IHDR(png, info, _width, _height, 8, _format == RGBA ? PNG_COLOR_TYPE_RGBA : PNG_COLOR_TYPE_RGB,
+                 PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_write_info(png, info);
+
+    // The pixel data is stored bottom-up, and PNG files are stored top-down.
+    const size_t stride = _width * (_format == RGBA ? 4 : 3);
+    rows = new png_bytep[_height];
+    for (unsigned int i = 0; i < _height; ++i)
+    {
+        rows[i] = _data + stride * (_height - 1 - i);
+    }
+    png_write_image(png, rows);
+    png_write_end(png, NULL);
+
+    SAFE_DELETE_ARRAY(rows);
+    png_destroy_write_struct(&png, &info);
+
+    return true;
+}
+
 Image::~Image()
 {
     SAFE_DELETE_ARRAY(_data);
@@ -9,10 +9,16 @@ namespace gameplay
 /**
  * Defines an image buffer of RGB or RGBA color data.
  *
- * Currently only supports loading from .png image files.
+ * Supports loading from .png image files, and from .qoi image files, which
+ * decode several times faster and are meant for development builds.
+ *
+ * Decoding does not create any Ref objects, so images can be decoded with
+ * decode() from job system workers, straight into a buffer owned by the caller.
  */
 class Image : public Ref
 {
+    friend class Texture;
+
 public:
 
     /**
@@ -45,6 +51,38 @@ public:
      */
     static Image* create(unsigned int width, unsigned int height, Format format, unsigned char* data = NULL);
 
+    /**
+     * Reads the size and format of the image file at the given path, without decoding it.
+     *
+     * @param path The path to the image file.
+     * @param width Populated with the width of the image.
+     * @param height Populated with the height of the image.
+     * @param format Populated with the format the image decodes to.
+     *
+     * @return true if the file is a supported image, false otherwise.
+     * @script{ignore}
+     */
+    static bool getInfo(const char* path, unsigned int* width, unsigned int* height, Format* format);
+
+    /**
+     * Decodes the image file at the given path into a buffer provided by the caller.
+     *
+     * The rows are tightly packed and stored bottom-up, which is the layout Texture
+     * uploads, so the buffer can be uploaded without another copy. The size of the
+     * buffer required is the width times the height of the image times its pixel size,
+     * as returned by getInfo().
+     *
+     * This is safe to call from job system workers.
+     *
+     * @param path The path to the image file.
+     * @param data The buffer to decode the pixels into.
+     * @param size The size of the buffer, in bytes.
+     *
+     * @return true if the image was decoded, false if it could not be read or the buffer is too small.
+     * @script{ignore}
+     */
+    static bool decode(const char* path, unsigned char* data, size_t size);
+
     /**
      * Gets the image's raw pixel data.
      *
@@ -74,6 +112,19 @@ public:
      */
     inline unsigned int getWidth() const;
 
+    /**
+     * Saves the image to a PNG file.
+     *
+     * This does not create any Ref objects, so images can be encoded from job system workers,
+     * such as the screenshots read back by FrameBuffer::readScreenshotAsync().
+     *
+     * @param path The path of the PNG file to write.
+     *
+     * @return true if the image was saved, false otherwise.
+     * @script{ignore}
+     */
+    bool save(const char* path) const;
+
 private:
 
     /**
@@ -91,6 +142,18 @@ private:
      */
     Image& operator=(const Image&);
 
+    /**
+     * Decodes the image file at the given path into bottom-up pixel data.
+     *
+     * This does not create any Ref objects, so it is safe to call from job system workers.
+     *
+     * @param data The buffer to decode into, or NULL to allocate one.
+     * @param size The size of the buffer, when one is provided.
+     *
+     * @return The pixel data, which the caller must delete if it was allocated, or NULL if the file could not be decoded.
+     */
+    static unsigned char* read(const char* path, unsigned char* data, size_t size, unsigned int* width, unsigned int* height, Format* format);
+
     unsigned char* _data;
     Format _format;
     unsigned int _width;
@@ -5,14 +5,17 @@ namespace gameplay
 {
 
 ImageControl::ImageControl() :
-    _srcRegion(Rectangle::empty()), _dstRegion(Rectangle::empty()), _batch(NULL),
+    _srcRegion(Rectangle::empty()), _dstRegion(Rectangle::empty()), _batch(NULL), _atlas(NULL),
     _tw(0.0f), _th(0.0f), _uvs(Theme::UVs::full())
 {
 }
 
 ImageControl::~ImageControl()
 {
-    SAFE_DELETE(_batch);
+    if (_atlas)
+        SAFE_RELEASE(_atlas);
+    else
+        SAFE_DELETE(_batch);
 }
 
 ImageControl* ImageControl::create(const char* id, Theme::Style* style)
@@ -65,12 +68,49 @@ const char* ImageControl::getTypeName() const
 
 void ImageControl::setImage(const char* path)
 {
-    SAFE_DELETE(_batch);
-    Texture* texture = Texture::create(path);
-    _batch = SpriteBatch::create(texture);
-    _tw = 1.0f / texture->getWidth();
-    _th = 1.0f / texture->getHeight();
-    texture->release();
+    if (_atlas)
+        SAFE_RELEASE(_atlas);
+    else
+        SAFE_DELETE(_batch);
+    _batch = NULL;
+
+    // Images packed into an atlas draw through the batch of their page, which other images of the page share.
+    TextureAtlas* uiAtlas = Theme::getAtlas();
+    if (uiAtlas)
+        uiAtlas->add(path);
+    unsigned int page;
+    TextureAtlas* atlas = TextureAtlas::find(path, &page, &_imageRegion);
+    if (atlas)
+    {
+        _atlas = atlas;
+        _atlas->addRef();
+        _batch = _atlas->getSpriteBatch(page);
+        Texture* texture = _atlas->getPage(page);
+        _tw = 1.0f / texture->getWidth();
+        _th = 1.0f / texture->getHeight();
+    }
+    else
+    {
+        Texture* texture = Texture::create(path);
+        _batch = SpriteBatch::create(texture);
+        _tw = 1.0f / texture->getWidth();
+        _th = 1.0f / texture->getHeight();
+        _imageRegion.set(0, 0, texture->getWidth(), texture->getHeight());
+        texture->release();
+    }
+
+    // Recalculate the UVs for the new image.
+    if (_srcRegion.isEmpty())
+    {
+        _uvs.u1 = _imageRegion.x * _tw;
+        _uvs.u2 = (_imageRegion.x + _imageRegion.width) * _tw;
+        _uvs.v1 = 1.0f - (_imageRegion.y * _th);
+        _uvs.v2 = 1.0f - ((_imageRegion.y + _imageRegion.height) * _th);
+    }
+    else
+    {
+        setRegionSrc(_srcRegion);
+    }
 
     if (_autoSize != AUTO_SIZE_NONE)
         setDirty(DIRTY_BOUNDS);
@@ -80,6 +120,9 @@ void ImageControl::setRegionSrc(float x, float y, float width, float height)
 {
     _srcRegion.set(x, y, width, height);
 
+    // The source region is relative to the image, which may be packed into an atlas.
+    x += _imageRegion.x;
+    y += _imageRegion.y;
     _uvs.u1 = x * _tw;
     _uvs.u2 = (x + width) * _tw;
     _uvs.v1 = 1.0f - (y * _th);
@@ -144,12 +187,12 @@ void ImageControl::updateBounds()
     {
         if (_autoSize & AUTO_SIZE_WIDTH)
         {
-            setWidthInternal(_batch->getSampler()->getTexture()->getWidth());
+            setWidthInternal(_imageRegion.width);
         }
 
         if (_autoSize & AUTO_SIZE_HEIGHT)
         {
-            setHeightInternal(_batch->getSampler()->getTexture()->getWidth());
+            setHeightInternal(_imageRegion.height);
         }
     }
 
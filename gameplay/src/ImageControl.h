@@ -5,6 +5,7 @@
 #include "Theme.h"
 #include "Image.h"
 #include "SpriteBatch.h"
+#include "TextureAtlas.h"
 #include "Rectangle.h"
 
 namespace gameplay
@@ -144,6 +145,10 @@ private:
     Rectangle _dstRegion;
     SpriteBatch* _batch;
 
+    // The atlas that owns the batch when the image is packed into one, and the region of the image in its page.
+    TextureAtlas* _atlas;
+    Rectangle _imageRegion;
+
     // One over texture width and height, for use when calculating UVs from a new source region.
     float _tw;
     float _th;
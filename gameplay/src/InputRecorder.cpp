@@ -0,0 +1,459 @@
+#include "Base.h"
+#include "InputRecorder.h"
+#include "FileSystem.h"
+#include "Platform.h"
+#include "Game.h"
+
+// The first word of a recording, followed by the format version and the timestep.
+#define INPUT_RECORDING_MAGIC "gameplay-input"
+
+// The version of the recording format.
+#define INPUT_RECORDING_VERSION 1
+
+// The timestep of the replays of a recording when none is configured, in milliseconds.
+#define INPUT_RECORDING_DEFAULT_TIME_STEP (1000.0f / 60.0f)
+
+namespace gameplay
+{
+
+// The keyword and layout of each event type in a recording: whether it names a gamepad,
+// then how many integer and float arguments follow, then whether it ends with a name.
+struct EventFormat
+{
+    const char* keyword;
+    bool hasHandle;
+    unsigned int argCount;
+    unsigned int valueCount;
+    bool hasName;
+};
+
+static const EventFormat __eventFormats[] =
+{
+    { "touch",      false, 5, 0, false },
+    { "key",        false, 2, 0, false },
+    { "mouse",      false, 4, 0, false },
+    { "swipe",      false, 3, 0, false },
+    { "pinch",      false, 2, 1, false },
+    { "tap",        false, 2, 0, false },
+    { "longtap",    false, 2, 1, false },
+    { "drag",       false, 2, 0, false },
+    { "drop",       false, 2, 0, false },
+    { "connect",    true,  3, 0, true  },
+    { "disconnect", true,  0, 0, false },
+    { "press",      true,  1, 0, false },
+    { "release",    true,  1, 0, false },
+    { "trigger",    true,  1, 1, false },
+    { "joystick",   true,  1, 2, false },
+    { "gamepad",    true,  1, 6, false },
+    { "end",        false, 0, 0, false }
+};
+
+struct RecordedEvent
+{
+    unsigned int frame;
+    InputRecorder::EventType type;
+    GamepadHandle handle;
+    int args[5];
+    float values[6];
+    std::string name;
+};
+
+static Stream* __recording = NULL;
+static std::map<GamepadHandle, std::pair<unsigned int, std::vector<float> > > __recordedGamepads;
+static std::vector<RecordedEvent> __replay;
+static size_t __replayEvent = 0;
+static size_t __replayGamepad = 0;
+static bool __replaying = false;
+static bool __dispatching = false;
+static bool __exitOnReplayEnd = false;
+static unsigned int __frame = 0;
+static float __timeStep = INPUT_RECORDING_DEFAULT_TIME_STEP;
+
+static void writeEvent(const RecordedEvent& event)
+{
+    GP_ASSERT(__recording);
+
+    const EventFormat& format = __eventFormats[event.type];
+    std::ostringstream line;
+    line.precision(9);
+    line << event.frame << " " << format.keyword;
+    if (format.hasHandle)
+        line << " " << (unsigned long)event.handle;
+    for (unsigned int i = 0; i < format.argCount; ++i)
+    {
+        line << " " << event.args[i];
+    }
+    for (unsigned int i = 0; i < format.valueCount; ++i)
+    {
+        line << " " << event.values[i];
+    }
+    if (format.hasName)
+        line << " " << event.name;
+    line << "\n";
+
+    const std::string text = line.str();
+    __recording->write(text.c_str(), 1, text.size());
+}
+
+static void dispatchEvent(const RecordedEvent& event)
+{
+    switch (event.type)
+    {
+    case InputRecorder::TOUCH:
+        Platform::touchEventInternal((Touch::TouchEvent)event.args[0], event.args[1], event.args[2], (unsigned int)event.args[3], event.args[4] != 0);
+        break;
+    case InputRecorder::KEY:
+        Platform::keyEventInternal((Keyboard::KeyEvent)event.args[0], event.args[1]);
+        break;
+    case InputRecorder::MOUSE:
+        Platform::mouseEventInternal((Mouse::MouseEvent)event.args[0], event.args[1], event.args[2], event.args[3]);
+        break;
+    case InputRecorder::GESTURE_SWIPE:
+        Platform::gestureSwipeEventInternal(event.args[0], event.args[1], event.args[2]);
+        break;
+    case InputRecorder::GESTURE_PINCH:
+        Platform::gesturePinchEventInternal(event.args[0], event.args[1], event.values[0]);
+        break;
+    case InputRecorder::GESTURE_TAP:
+        Platform::gestureTapEventInternal(event.args[0], event.args[1]);
+        break;
+    case InputRecorder::GESTURE_LONG_TAP:
+        Platform::gestureLongTapEventInternal(event.args[0], event.args[1], event.values[0]);
+        break;
+    case InputRecorder::GESTURE_DRAG:
+        Platform::gestureDragEventInternal(event.args[0], event.args[1]);
+        break;
+    case InputRecorder::GESTURE_DROP:
+        Platform::gestureDropEventInternal(event.args[0], event.args[1]);
+        break;
+    case InputRecorder::GAMEPAD_CONNECTED:
+        Platform::gamepadEventConnectedInternal(event.handle, (unsigned int)event.args[0], (unsigned int)event.args[1], (unsigned int)event.args[2], event.name.c_str());
+        break;
+    case InputRecorder::GAMEPAD_DISCONNECTED:
+        Platform::gamepadEventDisconnectedInternal(event.handle);
+        break;
+    case InputRecorder::GAMEPAD_BUTTON_PRESSED:
+        Platform::gamepadButtonPressedEventInternal(event.handle, (Gamepad::ButtonMapping)event.args[0]);
+        break;
+    case InputRecorder::GAMEPAD_BUTTON_RELEASED:
+        Platform::gamepadButtonReleasedEventInternal(event.handle, (Gamepad::ButtonMapping)event.args[0]);
+        break;
+    case InputRecorder::GAMEPAD_TRIGGER:
+        Platform::gamepadTriggerChangedEventInternal(event.handle, (unsigned int)event.args[0], event.values[0]);
+        break;
+    case InputRecorder::GAMEPAD_JOYSTICK:
+        Platform::gamepadJoystickChangedEventInternal(event.handle, (unsigned int)event.args[0], event.values[0], event.values[1]);
+        break;
+    default:
+        break;
+    }
+}
+
+InputRecorder::InputRecorder()
+{
+}
+
+bool InputRecorder::isRecording()
+{
+    return __recording != NULL;
+}
+
+bool InputRecorder::isReplaying()
+{
+    return __replaying;
+}
+
+float InputRecorder::getTimeStep()
+{
+    return __timeStep;
+}
+
+bool InputRecorder::startRecording(const char* path, float timeStep)
+{
+    GP_ASSERT(path);
+
+    if (__recording || __replaying)
+    {
+        GP_WARN("Input is already being recorded or replayed; not recording to '%s'.", path);
+        return false;
+    }
+
+    __recording = FileSystem::open(path, FileSystem::WRITE);
+    if (!__recording)
+    {
+        GP_WARN("Failed to open input recording '%s' for writing.", path);
+        return false;
+    }
+
+    __timeStep = timeStep > 0.0f ? timeStep : INPUT_RECORDING_DEFAULT_TIME_STEP;
+    __frame = 0;
+    __recordedGamepads.clear();
+
+    std::ostringstream header;
+    header.precision(9);
+    header << INPUT_RECORDING_MAGIC << " " << INPUT_RECORDING_VERSION << " " << __timeStep << "\n";
+    const std::string text = header.str();
+    __recording->write(text.c_str(), 1, text.size());
+    return true;
+}
+
+bool InputRecorder::startReplay(const char* path, bool exitOnEnd)
+{
+    GP_ASSERT(path);
+
+    if (__recording || __replaying)
+    {
+        GP_WARN("Input is already being recorded or replayed; not replaying '%s'.", path);
+        return false;
+    }
+
+    char* text = FileSystem::readAll(path);
+    if (!text)
+    {
+        GP_WARN("Failed to read input recording '%s'.", path);
+        return false;
+    }
+    std::istringstream lines(text);
+    SAFE_DELETE_ARRAY(text);
+
+    std::string line;
+    std::getline(lines, line);
+    std::istringstream header(line);
+    std::string magic;
+    int version = 0;
+    float timeStep = 0.0f;
+    header >> magic >> version >> timeStep;
+    if (magic != INPUT_RECORDING_MAGIC || version != INPUT_RECORDING_VERSION || timeStep <= 0.0f)
+    {
+        GP_WARN("Invalid input recording '%s'.", path);
+        return false;
+    }
+
+    __replay.clear();
+    unsigned int lineNumber = 1;
+    while (std::getline(lines, line))
+    {
+        ++lineNumber;
+        if (line.empty())
+            continue;
+
+        std::istringstream fields(line);
+        RecordedEvent event;
+        std::string keyword;
+        fields >> event.frame >> keyword;
+
+        int type = 0;
+        while (type < EVENT_TYPE_COUNT && keyword != __eventFormats[type].keyword)
+        {
+            ++type;
+        }
+        if (fields.fail() || type == EVENT_TYPE_COUNT)
+        {
+            GP_WARN("Invalid event on line %u of input recording '%s'.", lineNumber, path);
+            __replay.clear();
+            return false;
+        }
+
+        const EventFormat& format = __eventFormats[type];
+        event.type = (EventType)type;
+        event.handle = 0;
+        memset(event.args, 0, sizeof(event.args));
+        memset(event.values, 0, sizeof(event.values));
+        if (format.hasHandle)
+        {
+            unsigned long handle = 0;
+            fields >> handle;
+            event.handle = (GamepadHandle)handle;
+        }
+        for (unsigned int i = 0; i < format.argCount; ++i)
+        {
+            fields >> event.args[i];
+        }
+        for (unsigned int i = 0; i < format.valueCount; ++i)
+        {
+            fields >> event.values[i];
+        }
+        if (fields.fail())
+        {
+            GP_WARN("Invalid event on line %u of input recording '%s'.", lineNumber, path);
+            __replay.clear();
+            return false;
+        }
+        if (format.hasName)
+        {
+            std::getline(fields >> std::ws, event.name);
+        }
+        __replay.push_back(event);
+    }
+
+    __timeStep = timeStep;
+    __exitOnReplayEnd = exitOnEnd;
+    __replayEvent = 0;
+    __replayGamepad = 0;
+    __frame = 0;
+    __replaying = true;
+    return true;
+}
+
+void InputRecorder::stop()
+{
+    if (__recording)
+    {
+        RecordedEvent event;
+        event.frame = __frame;
+        event.type = END;
+        event.handle = 0;
+        writeEvent(event);
+        __recording->close();
+        SAFE_DELETE(__recording);
+        __recordedGamepads.clear();
+    }
+    if (__replaying)
+    {
+        __replaying = false;
+        __replay.clear();
+    }
+}
+
+void InputRecorder::nextFrame()
+{
+    if (__replaying)
+    {
+        // Deliver the events that arrived before this frame when it was recorded.
+        __dispatching = true;
+        bool ended = __replayEvent >= __replay.size();
+        while (!ended && __replay[__replayEvent].frame <= __frame)
+        {
+            const RecordedEvent& event = __replay[__replayEvent++];
+            if (event.type == END)
+                ended = true;
+            else if (event.type != GAMEPAD_STATE)
+                dispatchEvent(event);
+            if (__replayEvent >= __replay.size())
+                ended = true;
+        }
+        __dispatching = false;
+
+        if (ended)
+        {
+            print("Input replay ended after %u frames.\n", __frame);
+            stop();
+            if (__exitOnReplayEnd)
+                Game::getInstance()->exit();
+        }
+    }
+    ++__frame;
+}
+
+void InputRecorder::updateGamepads()
+{
+    if (__replaying)
+    {
+        while (__replayGamepad < __replay.size() && __replay[__replayGamepad].frame <= __frame)
+        {
+            const RecordedEvent& event = __replay[__replayGamepad++];
+            if (event.type != GAMEPAD_STATE)
+                continue;
+
+            Gamepad* gamepad = Gamepad::getGamepad(event.handle);
+            if (!gamepad)
+                continue;
+            gamepad->setButtons((unsigned int)event.args[0]);
+            for (unsigned int i = 0; i < gamepad->_joystickCount && i < 2; ++i)
+            {
+                gamepad->setJoystickValue(i, event.values[i * 2], event.values[i * 2 + 1]);
+            }
+            for (unsigned int i = 0; i < gamepad->_triggerCount && i < 2; ++i)
+            {
+                gamepad->setTriggerValue(i, event.values[4 + i]);
+            }
+        }
+    }
+    else if (__recording)
+    {
+        // Only the states that changed since they were last recorded are written.
+        for (unsigned int i = 0, count = Gamepad::getGamepadCount(); i < count; ++i)
+        {
+            Gamepad* gamepad = Gamepad::getGamepad(i, false);
+            if (!gamepad || gamepad->isVirtual())
+                continue;
+
+            std::vector<float> values(6);
+            values[0] = gamepad->_joysticks[0].x;
+            values[1] = gamepad->_joysticks[0].y;
+            values[2] = gamepad->_joysticks[1].x;
+            values[3] = gamepad->_joysticks[1].y;
+            values[4] = gamepad->_triggers[0];
+            values[5] = gamepad->_triggers[1];
+
+            std::pair<unsigned int, std::vector<float> >& recorded = __recordedGamepads[gamepad->_handle];
+            if (recorded.first == gamepad->_buttons && recorded.second == values)
+                continue;
+            recorded.first = gamepad->_buttons;
+            recorded.second = values;
+
+            RecordedEvent event;
+            event.frame = __frame;
+            event.type = GAMEPAD_STATE;
+            event.handle = gamepad->_handle;
+            event.args[0] = (int)gamepad->_buttons;
+            for (unsigned int j = 0; j < 6; ++j)
+            {
+                event.values[j] = values[j];
+            }
+            writeEvent(event);
+        }
+    }
+}
+
+bool InputRecorder::capture(EventType type, int arg0, int arg1, int arg2, int arg3, int arg4, float value0, float value1)
+{
+    if (__dispatching)
+        return true;
+    if (__replaying)
+        return false;
+
+    if (__recording)
+    {
+        RecordedEvent event;
+        event.frame = __frame;
+        event.type = type;
+        event.handle = 0;
+        event.args[0] = arg0;
+        event.args[1] = arg1;
+        event.args[2] = arg2;
+        event.args[3] = arg3;
+        event.args[4] = arg4;
+        event.values[0] = value0;
+        event.values[1] = value1;
+        writeEvent(event);
+    }
+    return true;
+}
+
+bool InputRecorder::captureGamepad(EventType type, GamepadHandle handle, int arg0, int arg1, int arg2, float value0, float value1, const char* name)
+{
+    if (__dispatching)
+        return true;
+    if (__replaying)
+        return false;
+
+    if (__recording)
+    {
+        RecordedEvent event;
+        event.frame = __frame;
+        event.type = type;
+        event.handle = handle;
+        event.args[0] = arg0;
+        event.args[1] = arg1;
+        event.args[2] = arg2;
+        event.values[0] = value0;
+        event.values[1] = value1;
+        if (name)
+            event.name = name;
+        writeEvent(event);
+    }
+    return true;
+}
+
+}
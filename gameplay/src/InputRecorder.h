@@ -0,0 +1,163 @@
+#ifndef INPUTRECORDER_H_
+#define INPUTRECORDER_H_
+
+#include "Keyboard.h"
+#include "Mouse.h"
+#include "Touch.h"
+#include "Gamepad.h"
+
+namespace gameplay
+{
+
+/**
+ * Defines the recording of the input of a session and its replay.
+ *
+ * While recording, every touch, key, mouse, gesture and gamepad event the platform delivers
+ * is written to the recording with the index of the frame it arrived before, along with the
+ * state of the physical gamepads whenever it changes after they are polled. Replaying feeds
+ * the events back at the start of the same frames and the gamepad states at the point they
+ * were polled, and ignores the live input of the platform until the recording ends.
+ *
+ * Replayed frames advance the game by the fixed timestep stored in the recording rather than
+ * by the real elapsed time, so that the same recording runs the same session on every run.
+ * Time events and budgets measured against Game::getAbsoluteTime still follow the clock,
+ * unless the platform is run with a fixed timestep as well.
+ *
+ * Recording and replay are configured by the input namespace of game.config:
+ *
+ * @code
+ * input
+ * {
+ *     record = session.input      // Records the input of the session to this file.
+ *     replay = session.input      // Or replays the input recorded in this file.
+ *     timeStep = 16.667           // The fixed timestep of the replays of this recording, in milliseconds.
+ *     exitOnReplayEnd = true      // Exits the game once the replay ends.
+ * }
+ * @endcode
+ *
+ * @script{ignore}
+ */
+class InputRecorder
+{
+    friend class Game;
+    friend class Gamepad;
+    friend class Platform;
+
+public:
+
+    /**
+     * The kinds of events in a recording.
+     */
+    enum EventType
+    {
+        TOUCH,
+        KEY,
+        MOUSE,
+        GESTURE_SWIPE,
+        GESTURE_PINCH,
+        GESTURE_TAP,
+        GESTURE_LONG_TAP,
+        GESTURE_DRAG,
+        GESTURE_DROP,
+        GAMEPAD_CONNECTED,
+        GAMEPAD_DISCONNECTED,
+        GAMEPAD_BUTTON_PRESSED,
+        GAMEPAD_BUTTON_RELEASED,
+        GAMEPAD_TRIGGER,
+        GAMEPAD_JOYSTICK,
+        GAMEPAD_STATE,
+        END,
+        EVENT_TYPE_COUNT
+    };
+
+    /**
+     * Determines if the input is being recorded.
+     *
+     * @return true if the input is being recorded.
+     */
+    static bool isRecording();
+
+    /**
+     * Determines if recorded input is being replayed.
+     *
+     * @return true if recorded input is being replayed.
+     */
+    static bool isReplaying();
+
+    /**
+     * Gets the fixed timestep that replayed frames advance the game by.
+     *
+     * @return The timestep of the recording being replayed, in milliseconds.
+     */
+    static float getTimeStep();
+
+private:
+
+    /**
+     * Hidden constructor.
+     */
+    InputRecorder();
+
+    /**
+     * Starts recording the input to a file.
+     *
+     * @param path The path of the recording to write.
+     * @param timeStep The fixed timestep of the replays of the recording, in milliseconds.
+     *
+     * @return true if the recording was started.
+     */
+    static bool startRecording(const char* path, float timeStep);
+
+    /**
+     * Starts replaying the input recorded in a file.
+     *
+     * @param path The path of the recording to replay.
+     * @param exitOnEnd true to exit the game once the replay ends.
+     *
+     * @return true if the replay was started.
+     */
+    static bool startReplay(const char* path, bool exitOnEnd);
+
+    /**
+     * Stops recording or replaying.
+     *
+     * Called by Game when it shuts down.
+     */
+    static void stop();
+
+    /**
+     * Starts the next frame: replays the events recorded before it and counts it.
+     *
+     * Called by Game at the start of each frame.
+     */
+    static void nextFrame();
+
+    /**
+     * Records the state of the physical gamepads, or replaces it with the recorded state.
+     *
+     * Called by Gamepad once the gamepads have been polled.
+     */
+    static void updateGamepads();
+
+    /**
+     * Records an input event of the platform.
+     *
+     * Called by Platform for each input event it is about to deliver.
+     *
+     * @return false if the event must be dropped because recorded input is being replayed.
+     */
+    static bool capture(EventType type, int arg0 = 0, int arg1 = 0, int arg2 = 0, int arg3 = 0, int arg4 = 0, float value0 = 0.0f, float value1 = 0.0f);
+
+    /**
+     * Records a gamepad event of the platform.
+     *
+     * @return false if the event must be dropped because recorded input is being replayed.
+     *
+     * @see InputRecorder::capture
+     */
+    static bool captureGamepad(EventType type, GamepadHandle handle, int arg0 = 0, int arg1 = 0, int arg2 = 0, float value0 = 0.0f, float value1 = 0.0f, const char* name = NULL);
+};
+
+}
+
+#endif
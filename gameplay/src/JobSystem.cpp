@@ -0,0 +1,284 @@
+#include "Base.h"
+#include "JobSystem.h"
+
+namespace gameplay
+{
+
+// The queue owned by the calling thread. Zero is the shared queue used by non-worker threads.
+static thread_local unsigned int __jobQueueIndex = 0;
+
+JobSystem::Counter::Counter()
+    : _value(0)
+{
+}
+
+JobSystem::Counter::~Counter()
+{
+    GP_ASSERT(_value == 0);
+    GP_ASSERT(_dependents.empty());
+}
+
+bool JobSystem::Counter::isDone() const
+{
+    return _value == 0;
+}
+
+JobSystem::JobSystem()
+    : _pendingJobs(0), _quit(false)
+{
+}
+
+JobSystem::~JobSystem()
+{
+}
+
+void JobSystem::initialize(unsigned int workerCount)
+{
+    if (workerCount == 0)
+    {
+        // Leave one hardware thread for the main thread, which also executes jobs while it waits.
+        unsigned int hardwareCount = std::thread::hardware_concurrency();
+        workerCount = hardwareCount > 1 ? hardwareCount - 1 : 1;
+    }
+
+    _quit = false;
+    for (unsigned int i = 0; i <= workerCount; ++i)
+    {
+        _queues.push_back(new Queue());
+    }
+    for (unsigned int i = 1; i <= workerCount; ++i)
+    {
+        _threads.push_back(std::thread(&JobSystem::workerMain, this, i));
+    }
+}
+
+void JobSystem::finalize()
+{
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _quit = true;
+    }
+    _sleepCondition.notify_all();
+
+    for (size_t i = 0, count = _threads.size(); i < count; ++i)
+    {
+        _threads[i].join();
+    }
+    _threads.clear();
+
+    for (size_t i = 0, count = _queues.size(); i < count; ++i)
+    {
+        Queue* queue = _queues[i];
+        GP_ASSERT(queue->jobs.empty());
+        SAFE_DELETE(queue);
+    }
+    _queues.clear();
+}
+
+void JobSystem::run(const Function& function, Counter* counter)
+{
+    push(createJob(function, counter));
+}
+
+void JobSystem::runAfter(Counter* dependency, const Function& function, Counter* counter)
+{
+    GP_ASSERT(dependency);
+
+    Job* job = createJob(function, counter);
+    {
+        // The dependency lock is also held while its dependents are scheduled,
+        // so the job is either queued here or picked up by that completion.
+        std::lock_guard<std::mutex> lock(dependency->_mutex);
+        if (dependency->_value > 0)
+        {
+            dependency->_dependents.push_back(job);
+            return;
+        }
+    }
+    push(job);
+}
+
+void JobSystem::wait(Counter* counter)
+{
+    GP_ASSERT(counter);
+    GP_ASSERT(!_queues.empty());
+
+    while (counter->_value > 0)
+    {
+        Job* job = pop(__jobQueueIndex);
+        if (job)
+            execute(job);
+        else
+            std::this_thread::yield();
+    }
+
+    // Synchronize with the job that released the counter before the caller is allowed to destroy it.
+    std::lock_guard<std::mutex> lock(counter->_mutex);
+}
+
+void JobSystem::parallelFor(unsigned int begin, unsigned int end, const RangeFunction& function, unsigned int grainSize)
+{
+    if (end <= begin)
+        return;
+
+    const unsigned int count = end - begin;
+    if (grainSize == 0)
+    {
+        // Aim for several jobs per thread so that stealing can balance uneven work.
+        unsigned int jobCount = getThreadCount() * 4;
+        grainSize = (count + jobCount - 1) / jobCount;
+    }
+    if (grainSize == 0 || count <= grainSize)
+    {
+        function(begin, end);
+        return;
+    }
+
+    Counter counter;
+    for (unsigned int first = begin; first < end; first += grainSize)
+    {
+        unsigned int last = std::min(first + grainSize, end);
+        run([&function, first, last]() { function(first, last); }, &counter);
+    }
+    wait(&counter);
+}
+
+unsigned int JobSystem::getThreadCount() const
+{
+    return (unsigned int)_threads.size() + 1;
+}
+
+bool JobSystem::isWorkerThread() const
+{
+    return __jobQueueIndex != 0;
+}
+
+JobSystem::Job* JobSystem::createJob(const Function& function, Counter* counter)
+{
+    GP_ASSERT(function);
+
+    Job* job = new Job();
+    job->function = function;
+    job->counter = counter;
+    if (counter)
+        ++counter->_value;
+    return job;
+}
+
+void JobSystem::push(Job* job)
+{
+    GP_ASSERT(job);
+    GP_ASSERT(!_queues.empty());
+
+    Queue* queue = _queues[__jobQueueIndex];
+    {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        ++_pendingJobs;
+        queue->jobs.push_back(job);
+    }
+
+    // Take the sleep lock so a worker cannot miss the wake up between checking for work and sleeping.
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+    }
+    _sleepCondition.notify_one();
+}
+
+JobSystem::Job* JobSystem::pop(unsigned int queueIndex)
+{
+    if (_pendingJobs == 0)
+        return NULL;
+
+    // Take the most recently pushed job from our own queue first since its data is likely still in cache.
+    Queue* queue = _queues[queueIndex];
+    {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        if (!queue->jobs.empty())
+        {
+            Job* job = queue->jobs.back();
+            queue->jobs.pop_back();
+            --_pendingJobs;
+            return job;
+        }
+    }
+
+    // Steal the oldest job from the other queues.
+    const unsigned int queueCount = (unsigned int)_queues.size();
+    for (unsigned int i = 1; i < queueCount; ++i)
+    {
+        Queue* victim = _queues[(queueIndex + i) % queueCount];
+        std::lock_guard<std::mutex> lock(victim->mutex);
+        if (!victim->jobs.empty())
+        {
+            Job* job = victim->jobs.front();
+            victim->jobs.pop_front();
+            --_pendingJobs;
+            return job;
+        }
+    }
+
+    return NULL;
+}
+
+void JobSystem::execute(Job* job)
+{
+    GP_ASSERT(job);
+
+    job->function();
+
+    Counter* counter = job->counter;
+    SAFE_DELETE(job);
+
+    if (counter)
+        release(counter);
+}
+
+void JobSystem::acquire(Counter* counter)
+{
+    GP_ASSERT(counter);
+
+    ++counter->_value;
+}
+
+void JobSystem::release(Counter* counter)
+{
+    GP_ASSERT(counter);
+
+    // The counter lock is held while decrementing so that a waiter cannot destroy
+    // the counter until we are done with it (see wait()).
+    std::vector<Job*> dependents;
+    {
+        std::lock_guard<std::mutex> lock(counter->_mutex);
+        if (--counter->_value == 0)
+            dependents.swap(counter->_dependents);
+    }
+
+    // Schedule any jobs that were waiting for this counter to reach zero.
+    for (size_t i = 0, count = dependents.size(); i < count; ++i)
+    {
+        push(dependents[i]);
+    }
+}
+
+void JobSystem::workerMain(unsigned int queueIndex)
+{
+    __jobQueueIndex = queueIndex;
+
+    while (true)
+    {
+        Job* job = pop(queueIndex);
+        if (job)
+        {
+            execute(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        while (_pendingJobs == 0 && !_quit)
+            _sleepCondition.wait(lock);
+        if (_quit)
+            break;
+    }
+}
+
+}
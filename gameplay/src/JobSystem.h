@@ -0,0 +1,232 @@
+#ifndef JOBSYSTEM_H_
+#define JOBSYSTEM_H_
+
+namespace gameplay
+{
+
+/**
+ * Defines a work-stealing job scheduler shared by the engine and the game.
+ *
+ * The job system owns a pool of worker threads (by default, one less than the
+ * hardware concurrency so that the main thread gets a core) each with their own
+ * job queue. Workers execute jobs from the back of their own queue and steal from
+ * the front of other queues when they run out of work. Jobs submitted from threads
+ * that are not workers (such as the main thread) are placed on a shared queue.
+ *
+ * Completion of jobs is tracked through counters. A counter is incremented when a
+ * job is submitted against it and decremented when that job completes. Waiting on
+ * a counter executes other pending jobs on the calling thread until it reaches zero,
+ * which gives fork/join semantics. Jobs can also be made dependent on a counter so
+ * that they are only scheduled once it reaches zero.
+ *
+ * Jobs must not call into the GL or fire user callbacks unless they document it.
+ *
+ * @script{ignore}
+ */
+class JobSystem
+{
+    friend class Game;
+    friend class UploadThread;
+
+    struct Job;
+
+public:
+
+    /**
+     * The function executed by a job.
+     */
+    typedef std::function<void()> Function;
+
+    /**
+     * The function executed by each job of a parallel-for, with the [begin, end) sub-range to process.
+     */
+    typedef std::function<void(unsigned int, unsigned int)> RangeFunction;
+
+    /**
+     * Tracks the completion of a group of jobs.
+     */
+    class Counter
+    {
+        friend class JobSystem;
+
+    public:
+
+        /**
+         * Constructor.
+         */
+        Counter();
+
+        /**
+         * Destructor.
+         *
+         * The counter must not be destroyed while it still has jobs outstanding.
+         */
+        ~Counter();
+
+        /**
+         * Determines if all of the jobs submitted against this counter have completed.
+         *
+         * @return true if there are no outstanding jobs, false otherwise.
+         */
+        bool isDone() const;
+
+    private:
+
+        /**
+         * Hidden copy constructor.
+         */
+        Counter(const Counter&);
+
+        /**
+         * Hidden copy assignment operator.
+         */
+        Counter& operator=(const Counter&);
+
+        std::atomic<int> _value;
+        std::mutex _mutex;
+        std::vector<Job*> _dependents;
+    };
+
+    /**
+     * Runs the specified function as a job.
+     *
+     * @param function The function to run.
+     * @param counter An optional counter to increment now and decrement once the job completes.
+     */
+    void run(const Function& function, Counter* counter = NULL);
+
+    /**
+     * Runs the specified function as a job once the dependency counter reaches zero.
+     *
+     * @param dependency The counter that must reach zero before the job is scheduled.
+     * @param function The function to run.
+     * @param counter An optional counter to increment now and decrement once the job completes.
+     */
+    void runAfter(Counter* dependency, const Function& function, Counter* counter = NULL);
+
+    /**
+     * Waits for all of the jobs submitted against the specified counter to complete.
+     *
+     * The calling thread executes pending jobs while it waits.
+     *
+     * @param counter The counter to wait on.
+     */
+    void wait(Counter* counter);
+
+    /**
+     * Splits the range [begin, end) into sub-ranges, runs the function over each sub-range
+     * as a job and waits for all of them to complete.
+     *
+     * @param begin The first index of the range.
+     * @param end One past the last index of the range.
+     * @param function The function to run for each sub-range.
+     * @param grainSize The minimum number of indices per job, or zero to pick one automatically.
+     */
+    void parallelFor(unsigned int begin, unsigned int end, const RangeFunction& function, unsigned int grainSize = 0);
+
+    /**
+     * Gets the number of threads that execute jobs, including the thread that waits on them.
+     *
+     * @return The number of threads executing jobs.
+     */
+    unsigned int getThreadCount() const;
+
+    /**
+     * Determines if the calling thread is one of the job system's worker threads.
+     *
+     * @return true if called from a worker thread, false otherwise.
+     */
+    bool isWorkerThread() const;
+
+private:
+
+    struct Job
+    {
+        Function function;
+        Counter* counter;
+    };
+
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Job*> jobs;
+    };
+
+    /**
+     * Constructor.
+     */
+    JobSystem();
+
+    /**
+     * Destructor.
+     */
+    ~JobSystem();
+
+    /**
+     * Hidden copy constructor.
+     */
+    JobSystem(const JobSystem&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    JobSystem& operator=(const JobSystem&);
+
+    /**
+     * Called during startup to create the worker threads.
+     *
+     * @param workerCount The number of worker threads, or zero to size the pool to the hardware.
+     */
+    void initialize(unsigned int workerCount);
+
+    /**
+     * Called during shutdown to stop and join the worker threads.
+     */
+    void finalize();
+
+    /**
+     * Creates a job, incrementing its counter.
+     */
+    Job* createJob(const Function& function, Counter* counter);
+
+    /**
+     * Pushes a job onto the queue of the calling thread and wakes a worker.
+     */
+    void push(Job* job);
+
+    /**
+     * Pops a job from the given queue or steals one from the other queues.
+     */
+    Job* pop(unsigned int queueIndex);
+
+    /**
+     * Executes a job and schedules any jobs that were waiting on its counter.
+     */
+    void execute(Job* job);
+
+    /**
+     * Counts work that completes outside of the job system, such as an upload, against a counter.
+     */
+    void acquire(Counter* counter);
+
+    /**
+     * Completes work counted against a counter and schedules any jobs that were waiting for it to reach zero.
+     */
+    void release(Counter* counter);
+
+    /**
+     * The main loop of each worker thread.
+     */
+    void workerMain(unsigned int queueIndex);
+
+    std::vector<std::thread> _threads;
+    std::vector<Queue*> _queues;
+    std::atomic<unsigned int> _pendingJobs;
+    std::mutex _sleepMutex;
+    std::condition_variable _sleepCondition;
+    bool _quit;
+};
+
+}
+
+#endif
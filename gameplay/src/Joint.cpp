@@ -7,7 +7,7 @@ namespace gameplay
 {
 
 Joint::Joint(const char* id)
-    : Node(id), _jointMatrixDirty(true)
+    : Node(id)
 {
 }
 
@@ -64,22 +64,67 @@ Scene* Joint::getScene() const
 void Joint::transformChanged()
 {
     Node::transformChanged();
-    _jointMatrixDirty = true;
+    setJointMatrixDirty();
 }
 
-void Joint::updateJointMatrix(const Matrix& bindShape, Vector4* matrixPalette)
+void Joint::setPose(const Vector3& scale, const Quaternion& rotation, const Vector3& translation)
 {
-    // Note: If more than one MeshSkin influences this Joint, we need to skip
-    // the _jointMatrixDirty optimization since updateJointMatrix() may be
-    // called multiple times a frame with different bindShape matrices (and
-    // different matrixPallete pointers).
-    if (_skin.next || _jointMatrixDirty)
+    if (isStatic())
+        return;
+
+    // The matrix is composed lazily as usual, but nothing is notified.
+    _scale.set(scale);
+    _rotation.set(rotation);
+    _translation.set(translation);
+    _matrixDirtyBits |= DIRTY_TRANSLATION | DIRTY_ROTATION | DIRTY_SCALE;
+}
+
+void Joint::notifyPose()
+{
+    dirty(0);
+}
+
+bool Joint::hasAttachments() const
+{
+    if ((_listeners && !_listeners->empty()) || _skin.next || _drawable || _camera || _light || _audioSource || _collisionObject || _agent)
+        return true;
+    if (hasScriptListener(GP_GET_SCRIPT_EVENT(Transform, transformChanged)))
+        return true;
+
+    for (Node* child = getFirstChild(); child != NULL; child = child->getNextSibling())
+    {
+        if (child->getType() != Node::JOINT || static_cast<Joint*>(child)->_skin.skin != _skin.skin)
+            return true;
+    }
+    return false;
+}
+
+void Joint::setJointMatrixDirty()
+{
+    // Each skin keeps its own palette, so the joint is dirty for each of them until they update it.
+    for (SkinReference* ref = &_skin; ref && ref->skin; ref = ref->next)
+    {
+        ref->dirty = true;
+        ref->skin->setPaletteDirty();
+    }
+}
+
+void Joint::updateJointMatrix(MeshSkin* skin, bool force, Vector4* matrixPalette)
+{
+    SkinReference* ref = &_skin;
+    while (ref && ref->skin != skin)
+    {
+        ref = ref->next;
+    }
+    GP_ASSERT(ref);
+
+    if (ref->dirty || force)
     {
-        _jointMatrixDirty = false;
+        ref->dirty = false;
 
-        static Matrix t;
-        Matrix::multiply(Node::getWorldMatrix(), getInverseBindPose(), &t);
-        Matrix::multiply(t, bindShape, &t);
+        Matrix t;
+        Matrix::multiplyAffine(Node::getWorldMatrix(), getInverseBindPose(), &t);
+        Matrix::multiplyAffine(t, skin->getBindShape(), &t);
 
         GP_ASSERT(matrixPalette);
         matrixPalette[0].set(t.m[0], t.m[4], t.m[8], t.m[12]);
@@ -96,7 +141,7 @@ const Matrix& Joint::getInverseBindPose() const
 void Joint::setInverseBindPose(const Matrix& m)
 {
     _bindPose = m;
-    _jointMatrixDirty = true;
+    setJointMatrixDirty();
 }
 
 void Joint::addSkin(MeshSkin* skin)
@@ -105,6 +150,7 @@ void Joint::addSkin(MeshSkin* skin)
     {
         // Store skin in root reference
         _skin.skin = skin;
+        _skin.dirty = true;
     }
     else
     {
@@ -132,6 +178,7 @@ void Joint::removeSkin(MeshSkin* skin)
             SkinReference* tmp = _skin.next;
             _skin.skin = tmp->skin;
             _skin.next = tmp->next;
+            _skin.dirty = tmp->dirty;
             tmp->next = NULL; // prevent deletion
             SAFE_DELETE(tmp);
         }
@@ -156,7 +203,7 @@ void Joint::removeSkin(MeshSkin* skin)
 }
 
 Joint::SkinReference::SkinReference()
-    : skin(NULL), next(NULL)
+    : skin(NULL), next(NULL), dirty(true)
 {
 }
 
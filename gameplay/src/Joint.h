@@ -21,6 +21,8 @@ class Joint : public Node
     friend class Node;
     friend class MeshSkin;
     friend class Bundle;
+    friend class AnimationController;
+    friend class Prefab;
 
 public:
 
@@ -88,18 +90,44 @@ protected:
     void setInverseBindPose(const Matrix& m);
 
     /**
-     * Updates the joint matrix.
+     * Updates the joint matrix of a skin, if the joint moved since it was last updated for that skin.
      * 
-     * @param bindShape The bind shape matrix.
-     * @param matrixPalette The matrix palette to update.
+     * @param skin The skin whose palette is updated.
+     * @param force true to update the joint matrix even if the joint has not moved.
+     * @param matrixPalette The matrix palette entry to update.
      */
-    void updateJointMatrix(const Matrix& bindShape, Vector4* matrixPalette);
+    void updateJointMatrix(MeshSkin* skin, bool force, Vector4* matrixPalette);
 
     /**
      * Called when this Joint's transform changes.
      */
     void transformChanged();
 
+    /**
+     * Sets the local transform of the joint without notifying its children or listeners,
+     * for joints whose world matrix is then resolved by their skin.
+     *
+     * @param scale The scale.
+     * @param rotation The rotation.
+     * @param translation The translation.
+     */
+    void setPose(const Vector3& scale, const Quaternion& rotation, const Vector3& translation);
+
+    /**
+     * Notifies a change of the transform of the joint set by its skin, as setting the
+     * transform does, for joints with attachments.
+     */
+    void notifyPose();
+
+    /**
+     * Determines if anything besides the joints of its skin depends on the transform of the
+     * joint: transform listeners or scripts, other skins, attached components or child nodes
+     * that are not joints of the skin.
+     *
+     * @return true if the joint must notify its transform changes.
+     */
+    bool hasAttachments() const;
+
 private:
 
     /**
@@ -109,6 +137,7 @@ private:
     {
         MeshSkin* skin;
         SkinReference* next;
+        bool dirty;
 
         SkinReference();
         ~SkinReference();
@@ -128,16 +157,16 @@ private:
 
     void removeSkin(MeshSkin* skin);
 
+    /**
+     * Marks the joint matrix dirty for every skin referencing the joint.
+     */
+    void setJointMatrixDirty();
+
     /** 
      * The Matrix representation of the Joint's bind pose.
      */
     Matrix _bindPose;
 
-    /**
-     * Flag used to mark if the Joint's matrix is dirty.
-     */
-    bool _jointMatrixDirty;
-
     /**
      * Linked list of mesh skins that are referenced by this joint.
      */
@@ -0,0 +1,168 @@
+#include "Base.h"
+#include "JointTexture.h"
+#include "MeshSkin.h"
+#include "GLStateCache.h"
+#include "FrameCapture.h"
+
+// Width of the joint texture in texels. Palettes wrap from one row to the next.
+#define JOINT_TEXTURE_WIDTH 1024
+
+// Height of the joint texture when it is created, which it doubles from when palettes do not fit.
+#define JOINT_TEXTURE_MIN_HEIGHT 4
+
+namespace gameplay
+{
+
+Texture::Sampler* JointTexture::_sampler = NULL;
+unsigned int JointTexture::_height = 0;
+std::vector<Vector4> JointTexture::_texels;
+std::map<std::pair<MeshSkin*, bool>, unsigned int> JointTexture::_palettes;
+
+bool JointTexture::isSupported()
+{
+#ifdef GP_USE_FLOAT_TEXTURES
+    static GLint vertexTextureUnits = -1;
+    if (vertexTextureUnits < 0)
+    {
+        vertexTextureUnits = 0;
+        GL_ASSERT( glGetIntegerv(GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS, &vertexTextureUnits) );
+    }
+    return (GLEW_VERSION_3_0 || GLEW_ARB_texture_float) && vertexTextureUnits > 0;
+#else
+    return false;
+#endif
+}
+
+Texture::Sampler* JointTexture::getSampler()
+{
+    if (!_sampler && isSupported())
+        reserve();
+    return _sampler;
+}
+
+Vector4 JointTexture::getPaletteOffset(MeshSkin* skin, bool dualQuaternion)
+{
+    GP_ASSERT(skin);
+
+    if (!isSupported())
+        return Vector4::zero();
+
+    const std::pair<MeshSkin*, bool> key(skin, dualQuaternion);
+    std::map<std::pair<MeshSkin*, bool>, unsigned int>::const_iterator itr = _palettes.find(key);
+    unsigned int offset;
+    if (itr != _palettes.end())
+    {
+        offset = itr->second;
+    }
+    else
+    {
+        const Vector4* palette = dualQuaternion ? skin->getDualQuaternionPalette() : skin->getMatrixPalette();
+        const unsigned int count = dualQuaternion ? skin->getDualQuaternionPaletteSize() : skin->getMatrixPaletteSize();
+        offset = (unsigned int)_texels.size();
+        _texels.insert(_texels.end(), palette, palette + count);
+
+        // The texture is written in full when it is created or grows.
+        const unsigned int height = _height;
+        if (!reserve())
+        {
+            _texels.resize(offset);
+            return Vector4::zero();
+        }
+        if (_height == height)
+            upload(offset, count);
+        _palettes[key] = offset;
+    }
+    return Vector4((float)offset, (float)JOINT_TEXTURE_WIDTH, 1.0f / JOINT_TEXTURE_WIDTH, 1.0f / _height);
+}
+
+bool JointTexture::reserve()
+{
+#ifdef GP_USE_FLOAT_TEXTURES
+    const unsigned int rows = ((unsigned int)_texels.size() + JOINT_TEXTURE_WIDTH - 1) / JOINT_TEXTURE_WIDTH;
+    if (_sampler && rows <= _height)
+        return true;
+
+    unsigned int height = std::max(_height, (unsigned int)JOINT_TEXTURE_MIN_HEIGHT);
+    while (height < rows)
+        height *= 2;
+
+    GLint maxSize = 0;
+    GL_ASSERT( glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize) );
+    if (height > (unsigned int)maxSize)
+    {
+        GP_WARN("The joint palettes of a frame do not fit in a %ux%d joint texture; the remaining skins are not drawn.", JOINT_TEXTURE_WIDTH, maxSize);
+        return false;
+    }
+
+    // The texture keeps its handle when it grows, so the sampler bound by earlier draws stays valid.
+    TextureHandle handle;
+    if (_sampler)
+    {
+        handle = _sampler->getTexture()->getHandle();
+        GLStateCache::bindTexture(GL_TEXTURE_2D, handle);
+    }
+    else
+    {
+        GL_ASSERT( glGenTextures(1, &handle) );
+        GLStateCache::bindTexture(GL_TEXTURE_2D, handle);
+    }
+    GL_ASSERT( glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, JOINT_TEXTURE_WIDTH, height, 0, GL_RGBA, GL_FLOAT, NULL) );
+
+    if (!_sampler)
+    {
+        Texture* texture = Texture::create(handle, JOINT_TEXTURE_WIDTH, height);
+        _sampler = Texture::Sampler::create(texture);
+        SAFE_RELEASE(texture);
+        _sampler->setFilterMode(Texture::NEAREST, Texture::NEAREST);
+        _sampler->setWrapMode(Texture::CLAMP, Texture::CLAMP);
+    }
+    _height = height;
+
+    upload(0, (unsigned int)_texels.size());
+    return true;
+#else
+    return false;
+#endif
+}
+
+void JointTexture::upload(unsigned int offset, unsigned int count)
+{
+    GP_ASSERT(_sampler);
+    GP_ASSERT(offset + count <= _texels.size());
+
+    if (count == 0)
+        return;
+
+    GLStateCache::bindTexture(GL_TEXTURE_2D, _sampler->getTexture()->getHandle());
+    while (count > 0)
+    {
+        const unsigned int x = offset % JOINT_TEXTURE_WIDTH;
+        const unsigned int width = std::min(count, JOINT_TEXTURE_WIDTH - x);
+        GL_ASSERT( glTexSubImage2D(GL_TEXTURE_2D, 0, x, offset / JOINT_TEXTURE_WIDTH, width, 1, GL_RGBA, GL_FLOAT, &_texels[offset]) );
+        FrameCapture::record(FrameCapture::UPLOAD_TEXTURE, GL_TEXTURE_2D, _sampler->getTexture()->getHandle(), 0, width * 4 * sizeof(float));
+        offset += width;
+        count -= width;
+    }
+}
+
+void JointTexture::remove(MeshSkin* skin)
+{
+    _palettes.erase(std::make_pair(skin, false));
+    _palettes.erase(std::make_pair(skin, true));
+}
+
+void JointTexture::nextFrame()
+{
+    _palettes.clear();
+    _texels.clear();
+}
+
+void JointTexture::finalize()
+{
+    _palettes.clear();
+    _texels.clear();
+    _height = 0;
+    SAFE_RELEASE(_sampler);
+}
+
+}
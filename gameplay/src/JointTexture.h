@@ -0,0 +1,108 @@
+#ifndef JOINTTEXTURE_H_
+#define JOINTTEXTURE_H_
+
+#include "Texture.h"
+#include "Vector4.h"
+
+namespace gameplay
+{
+
+class MeshSkin;
+
+/**
+ * Defines the floating point texture that the joint palettes of the skins drawn in a frame
+ * are packed into.
+ *
+ * Skinned materials normally bind the palette of their skin to a uniform array through the
+ * MATRIX_PALETTE auto binding, which limits the number of joints to what fits in the vertex
+ * uniforms of the platform and uploads the palette again for every pass that draws the skin.
+ * Shaders compiled with SKINNING_TEXTURE defined instead read the palette from this texture,
+ * through the following auto bindings:
+ * <ul>
+ * <li>u_jointTexture = JOINT_TEXTURE
+ * <li>u_jointPaletteOffset = MATRIX_PALETTE_OFFSET (or DUAL_QUATERNION_PALETTE_OFFSET with SKINNING_DUAL_QUATERNION)
+ * </ul>
+ * The palette of each skin is written to the texture the first time it is bound in a frame,
+ * and every later draw of the skin in that frame, such as its shadow or depth pre-pass, reuses
+ * it. SKINNING_JOINT_COUNT is not needed by these shaders.
+ *
+ * The joint texture requires floating point textures and texture fetches in vertex shaders,
+ * which are not available on OpenGL ES 2.0.
+ *
+ * @script{ignore}
+ */
+class JointTexture
+{
+    friend class Game;
+    friend class MeshSkin;
+    friend class RenderState;
+
+public:
+
+    /**
+     * Determines if the joint texture is supported on this platform.
+     *
+     * @return true if floating point textures can be sampled in vertex shaders.
+     */
+    static bool isSupported();
+
+    /**
+     * Gets the sampler of the joint texture.
+     *
+     * @return The sampler, or NULL if no palette has been written to the texture.
+     */
+    static Texture::Sampler* getSampler();
+
+    /**
+     * Gets the location of the palette of a skin in the joint texture, writing it there if it
+     * is not in the texture yet this frame.
+     *
+     * @param skin The skin to get the palette of.
+     * @param dualQuaternion true for the dual quaternion palette of the skin, false for its matrix palette.
+     *
+     * @return The first texel of the palette in x, the width of the texture in y and the reciprocals
+     *      of the width and height of the texture in z and w.
+     */
+    static Vector4 getPaletteOffset(MeshSkin* skin, bool dualQuaternion);
+
+private:
+
+    /**
+     * Hidden constructor.
+     */
+    JointTexture();
+
+    /**
+     * Creates the texture, or makes it grow to hold the palettes of the frame and writes them to it again.
+     */
+    static bool reserve();
+
+    /**
+     * Writes a range of the palettes of the frame to the texture.
+     */
+    static void upload(unsigned int offset, unsigned int count);
+
+    /**
+     * Forgets the palettes of a skin that is being destroyed.
+     */
+    static void remove(MeshSkin* skin);
+
+    /**
+     * Forgets the palettes written during the last frame. Called by Game at the start of each frame.
+     */
+    static void nextFrame();
+
+    /**
+     * Deletes the texture. Called during game shutdown.
+     */
+    static void finalize();
+
+    static Texture::Sampler* _sampler;
+    static unsigned int _height;
+    static std::vector<Vector4> _texels;
+    static std::map<std::pair<MeshSkin*, bool>, unsigned int> _palettes;
+};
+
+}
+
+#endif
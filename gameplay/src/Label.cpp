@@ -1,10 +1,11 @@
 #include "Base.h"
 #include "Label.h"
+#include "Form.h"
 
 namespace gameplay
 {
 
-Label::Label() : _text(""), _font(NULL)
+Label::Label() : _text(""), _font(NULL), _measuredFont(NULL), _measuredFontSize(0), _measuredWidth(0), _measuredHeight(0)
 {
 }
 
@@ -67,7 +68,15 @@ void Label::setText(const char* text)
     {
         _text = text ? text : "";
         if (_autoSize != AUTO_SIZE_NONE)
+        {
             setDirty(DIRTY_BOUNDS);
+        }
+        else
+        {
+            Form* form = getTopLevelForm();
+            if (form)
+                form->invalidate(_absoluteClipBounds);
+        }
     }
 }
 
@@ -101,8 +110,17 @@ void Label::updateBounds()
         // Measure bounds based only on normal state so that bounds updates are not always required on state changes.
         // This is a trade-off for functionality vs performance, but changing the size of UI controls on hover/focus/etc
         // is a pretty bad practice so we'll prioritize performance here.
-        unsigned int w, h;
-        _font->measureText(_text.c_str(), getFontSize(NORMAL), &w, &h);
+        // Measurements are kept until the text or font changes, since layout passes often revisit
+        // labels whose text is unchanged.
+        unsigned int fontSize = getFontSize(NORMAL);
+        if (_font != _measuredFont || fontSize != _measuredFontSize || _text != _measuredText)
+        {
+            _font->measureText(_text.c_str(), fontSize, &_measuredWidth, &_measuredHeight);
+            _measuredText = _text;
+            _measuredFont = _font;
+            _measuredFontSize = fontSize;
+        }
+        unsigned int w = _measuredWidth, h = _measuredHeight;
         if (_autoSize & AUTO_SIZE_WIDTH)
         {
             setWidthInternal(w + getBorder(NORMAL).left + getBorder(NORMAL).right + getPadding().left + getPadding().right);
@@ -131,7 +149,7 @@ unsigned int Label::drawText(Form* form, const Rectangle& clip)
 
         SpriteBatch* batch = _font->getSpriteBatch(fontSize);
         startBatch(form, batch);
-        _font->drawText(_text.c_str(), _textBounds, _textColor, fontSize, getTextAlignment(state), true, getTextRightToLeft(state), _viewportClipBounds);
+        _font->drawText(&_textLayout, _text.c_str(), _textBounds, _textColor, fontSize, getTextAlignment(state), true, getTextRightToLeft(state), _viewportClipBounds);
         finishBatch(form, batch);
 
         return 1;
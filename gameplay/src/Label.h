@@ -141,12 +141,23 @@ protected:
      */
     Rectangle _textBounds;
 
+    /**
+     * The layout of the text, which is only laid out again when the text or its bounds change.
+     */
+    Font::Layout _textLayout;
+
 private:
 
     /**
      * Constructor.
      */
     Label(const Label& copy);
+
+    std::string _measuredText;      // Text last measured for auto sizing
+    Font* _measuredFont;            // Font used for the last measurement
+    unsigned int _measuredFontSize; // Font size used for the last measurement
+    unsigned int _measuredWidth;    // Cached width of _measuredText
+    unsigned int _measuredHeight;   // Cached height of _measuredText
 };
 
 }
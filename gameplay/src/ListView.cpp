@@ -0,0 +1,224 @@
+#include "Base.h"
+#include "ListView.h"
+
+// Fraction of the viewport height kept bound above and below the visible rows,
+// so rows are ready before fast scrolling brings them into view.
+#define LISTVIEW_OVERSCAN 0.5f
+
+namespace gameplay
+{
+
+ListView::ListView() : _dataSource(NULL)
+{
+}
+
+ListView::~ListView()
+{
+}
+
+ListView* ListView::create(const char* id, Theme::Style* style)
+{
+    ListView* listView = new ListView();
+    listView->_id = id ? id : "";
+    listView->_layout = createLayout(Layout::LAYOUT_ABSOLUTE);
+    listView->initialize("ListView", style, NULL);
+    return listView;
+}
+
+Control* ListView::create(Theme::Style* style, Properties* properties)
+{
+    ListView* listView = new ListView();
+    listView->initialize("ListView", style, properties);
+    return listView;
+}
+
+void ListView::initialize(const char* typeName, Theme::Style* style, Properties* properties)
+{
+    Container::initialize(typeName, style, properties);
+
+    // Rows are positioned by the list itself, which only scrolls vertically.
+    setLayout(Layout::LAYOUT_ABSOLUTE);
+    setScroll(SCROLL_VERTICAL);
+}
+
+const char* ListView::getTypeName() const
+{
+    return "ListView";
+}
+
+void ListView::setDataSource(DataSource* dataSource)
+{
+    if (_dataSource != dataSource)
+    {
+        _dataSource = dataSource;
+
+        // Controls created by the previous data source cannot be reused.
+        recycleRows();
+        for (size_t i = 0, count = _recycledControls.size(); i < count; ++i)
+            removeControl(_recycledControls[i]);
+        _recycledControls.clear();
+
+        reloadData();
+    }
+}
+
+ListView::DataSource* ListView::getDataSource() const
+{
+    return _dataSource;
+}
+
+void ListView::reloadData()
+{
+    _rowOffsets.clear();
+    if (_dataSource)
+    {
+        unsigned int rowCount = _dataSource->getRowCount(this);
+        _rowOffsets.resize(rowCount + 1);
+        float offset = 0.0f;
+        for (unsigned int i = 0; i < rowCount; ++i)
+        {
+            _rowOffsets[i] = offset;
+            offset += _dataSource->getRowHeight(this, i);
+        }
+        _rowOffsets[rowCount] = offset;
+    }
+
+    // Rebind every visible row, since row indices may now refer to different content.
+    recycleRows();
+    setDirty(DIRTY_BOUNDS);
+}
+
+void ListView::reloadRow(unsigned int row)
+{
+    if (_dataSource)
+    {
+        std::map<unsigned int, Control*>::const_iterator itr = _rowControls.find(row);
+        if (itr != _rowControls.end())
+            _dataSource->updateRowControl(this, row, itr->second);
+    }
+}
+
+unsigned int ListView::getRowCount() const
+{
+    return _rowOffsets.empty() ? 0 : (unsigned int)_rowOffsets.size() - 1;
+}
+
+Control* ListView::getRowControl(unsigned int row) const
+{
+    std::map<unsigned int, Control*>::const_iterator itr = _rowControls.find(row);
+    return itr != _rowControls.end() ? itr->second : NULL;
+}
+
+unsigned int ListView::getRowAt(float y) const
+{
+    unsigned int rowCount = getRowCount();
+    if (rowCount == 0)
+        return 0;
+
+    // The row containing y is the last row starting at or above it.
+    size_t row = std::upper_bound(_rowOffsets.begin(), _rowOffsets.end() - 1, y) - _rowOffsets.begin();
+    return row > 0 ? (unsigned int)row - 1 : 0;
+}
+
+void ListView::scrollToRow(unsigned int row)
+{
+    if (row < getRowCount())
+    {
+        // Container::updateScroll clamps this to the end of the list.
+        setScrollPosition(Vector2(_scrollPosition.x, -_rowOffsets[row]));
+    }
+}
+
+void ListView::update(float elapsedTime)
+{
+    // Bind rows before the children are updated so that new rows are laid out this frame.
+    updateRows();
+
+    Container::update(elapsedTime);
+}
+
+void ListView::measureContent(float* width, float* height)
+{
+    Container::measureContent(width, height);
+
+    // The content is the full list, not just the rows that currently have controls.
+    if (!_rowOffsets.empty())
+        *height = _rowOffsets.back();
+}
+
+void ListView::updateRows()
+{
+    unsigned int rowCount = getRowCount();
+    if (!_dataSource || rowCount == 0)
+    {
+        recycleRows();
+        return;
+    }
+
+    // Find the range of rows overlapping the viewport plus overscan.
+    float overscan = _viewportBounds.height * LISTVIEW_OVERSCAN;
+    float top = -_scrollPosition.y - overscan;
+    float bottom = -_scrollPosition.y + _viewportBounds.height + overscan;
+    unsigned int first = getRowAt(top);
+    unsigned int last = (unsigned int)(std::lower_bound(_rowOffsets.begin(), _rowOffsets.end() - 1, bottom) - _rowOffsets.begin());
+
+    // Recycle the controls of rows that left the range.
+    std::map<unsigned int, Control*>::iterator itr = _rowControls.begin();
+    while (itr != _rowControls.end())
+    {
+        if (itr->first < first || itr->first >= last)
+        {
+            itr->second->setVisible(false);
+            _recycledControls.push_back(itr->second);
+            _rowControls.erase(itr++);
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+
+    // Bind controls to rows that entered the range.
+    for (unsigned int row = first; row < last; ++row)
+    {
+        if (_rowControls.find(row) != _rowControls.end())
+            continue;
+
+        Control* control = NULL;
+        if (!_recycledControls.empty())
+        {
+            control = _recycledControls.back();
+            _recycledControls.pop_back();
+            control->setVisible(true);
+        }
+        else
+        {
+            control = _dataSource->createRowControl(this);
+            if (!control)
+            {
+                GP_WARN("Data source of list view '%s' failed to create a row control.", _id.c_str());
+                return;
+            }
+            addControl(control);
+            control->release();
+        }
+
+        control->setPosition(0, _rowOffsets[row]);
+        control->setWidth(1.0f, true);
+        control->setHeight(_rowOffsets[row + 1] - _rowOffsets[row]);
+        _rowControls[row] = control;
+        _dataSource->updateRowControl(this, row, control);
+    }
+}
+
+void ListView::recycleRows()
+{
+    for (std::map<unsigned int, Control*>::iterator itr = _rowControls.begin(); itr != _rowControls.end(); ++itr)
+    {
+        itr->second->setVisible(false);
+        _recycledControls.push_back(itr->second);
+    }
+    _rowControls.clear();
+}
+
+}
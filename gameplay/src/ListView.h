@@ -0,0 +1,222 @@
+#ifndef LISTVIEW_H_
+#define LISTVIEW_H_
+
+#include "Container.h"
+
+namespace gameplay
+{
+
+/**
+ * Defines a vertically scrolling container for very large lists of rows.
+ *
+ * Rather than holding a control for every row, a list view asks its data source
+ * for the number of rows and their heights, and only keeps controls for the rows
+ * intersecting its viewport. Controls of rows that scroll out of view are recycled
+ * for rows that scroll into view, so updating, laying out and drawing the list costs
+ * the same regardless of the number of rows.
+ *
+ * @see http://gameplay3d.github.io/GamePlay/docs/file-formats.html#wiki-UI_Forms
+ */
+class ListView : public Container
+{
+    friend class ControlFactory;
+
+public:
+
+    /**
+     * Provides the rows displayed by a list view.
+     */
+    class DataSource
+    {
+    public:
+
+        /**
+         * Destructor.
+         */
+        virtual ~DataSource() { }
+
+        /**
+         * Gets the number of rows in the list.
+         *
+         * @param list The list view requesting the row count.
+         *
+         * @return The number of rows.
+         */
+        virtual unsigned int getRowCount(ListView* list) = 0;
+
+        /**
+         * Gets the height of a row, in pixels.
+         *
+         * @param list The list view requesting the height.
+         * @param row The index of the row.
+         *
+         * @return The height of the row.
+         */
+        virtual float getRowHeight(ListView* list, unsigned int row) = 0;
+
+        /**
+         * Creates a new control for displaying rows.
+         *
+         * The list view takes ownership of the returned control and reuses it
+         * for different rows as the list scrolls.
+         *
+         * @param list The list view requesting the control.
+         *
+         * @return A new control.
+         */
+        virtual Control* createRowControl(ListView* list) = 0;
+
+        /**
+         * Updates a control to display the content of a row.
+         *
+         * The list view positions and sizes the control before calling this.
+         *
+         * @param list The list view displaying the row.
+         * @param row The index of the row.
+         * @param control The control to update, created by createRowControl.
+         */
+        virtual void updateRowControl(ListView* list, unsigned int row, Control* control) = 0;
+    };
+
+    /**
+     * Creates a new list view.
+     *
+     * @param id The list view ID.
+     * @param style The list view style (optional).
+     *
+     * @return The new list view.
+     * @script{create}
+     */
+    static ListView* create(const char* id, Theme::Style* style = NULL);
+
+    /**
+     * Extends ScriptTarget::getTypeName() to return the type name of this class.
+     *
+     * Child controls should override this function to return the correct type name.
+     *
+     * @return The type name of this class: "ListView"
+     * @see ScriptTarget::getTypeName()
+     */
+    const char* getTypeName() const;
+
+    /**
+     * Sets the data source providing the rows of this list.
+     *
+     * The data source is not owned by the list and must outlive it or be reset to NULL.
+     *
+     * @param dataSource The data source, or NULL to clear the list.
+     */
+    void setDataSource(DataSource* dataSource);
+
+    /**
+     * Gets the data source providing the rows of this list.
+     *
+     * @return The data source, or NULL if there is none.
+     */
+    DataSource* getDataSource() const;
+
+    /**
+     * Reloads the row count and heights from the data source and updates all visible rows.
+     *
+     * This should be called whenever rows are added, removed or resized.
+     */
+    void reloadData();
+
+    /**
+     * Updates the control of a row from the data source if the row is visible.
+     *
+     * The height of the row must not have changed; call reloadData for that.
+     *
+     * @param row The index of the row.
+     */
+    void reloadRow(unsigned int row);
+
+    /**
+     * Gets the number of rows in the list, as of the last call to reloadData.
+     *
+     * @return The number of rows.
+     */
+    unsigned int getRowCount() const;
+
+    /**
+     * Gets the control currently displaying a row.
+     *
+     * @param row The index of the row.
+     *
+     * @return The control of the row, or NULL if the row is not visible.
+     */
+    Control* getRowControl(unsigned int row) const;
+
+    /**
+     * Gets the index of the row at a vertical offset from the top of the list.
+     *
+     * @param y The offset from the top of the list's content, in pixels.
+     *
+     * @return The index of the row, clamped to the rows of the list.
+     */
+    unsigned int getRowAt(float y) const;
+
+    /**
+     * Scrolls the list so that a row is at the top of its viewport.
+     *
+     * @param row The index of the row.
+     */
+    void scrollToRow(unsigned int row);
+
+protected:
+
+    /**
+     * Constructor.
+     */
+    ListView();
+
+    /**
+     * Destructor.
+     */
+    virtual ~ListView();
+
+    /**
+     * Creates a new list view.
+     *
+     * @param style The list view's custom style.
+     * @param properties A properties object containing a definition of the list view (optional).
+     *
+     * @return The new list view.
+     */
+    static Control* create(Theme::Style* style, Properties* properties = NULL);
+
+    /**
+     * @see Container::initialize
+     */
+    void initialize(const char* typeName, Theme::Style* style, Properties* properties);
+
+    /**
+     * @see Control::update
+     */
+    void update(float elapsedTime);
+
+    /**
+     * @see Container::measureContent
+     */
+    void measureContent(float* width, float* height);
+
+private:
+
+    /**
+     * Constructor.
+     */
+    ListView(const ListView& copy);
+
+    void updateRows();
+
+    void recycleRows();
+
+    DataSource* _dataSource;
+    std::vector<float> _rowOffsets;                 // Top of each row, followed by the total height of the list
+    std::map<unsigned int, Control*> _rowControls;  // Controls of the visible rows, by row index
+    std::vector<Control*> _recycledControls;        // Hidden controls available for rows scrolling into view
+};
+
+}
+
+#endif
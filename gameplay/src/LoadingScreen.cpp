@@ -0,0 +1,199 @@
+#include "Base.h"
+#include "LoadingScreen.h"
+#include "Game.h"
+
+namespace gameplay
+{
+
+static std::atomic<bool> __active(false);
+static std::atomic<unsigned int> __loadCount(0);
+static std::atomic<unsigned int> __finishedCount(0);
+static unsigned int __reportedCount = 0;
+static double __startTime = 0.0;
+static unsigned long __minimumTime = 0L;
+static LoadingScreen::RenderFunction __render;
+static LoadingScreen::CompleteCallback __complete;
+static LoadingScreen::ProgressCallback __progress;
+static std::vector<Texture*> __textures;
+static std::vector<LoadingScreen::CompleteCallback> __finishedJobs;
+static std::mutex __finishedJobsMutex;
+
+void LoadingScreen::start(const RenderFunction& render, const CompleteCallback& complete, unsigned long minimumTime)
+{
+    GP_ASSERT(render);
+
+    if (__active)
+    {
+        GP_WARN("A loading screen is already being displayed.");
+        return;
+    }
+
+    __render = render;
+    __complete = complete;
+    __minimumTime = minimumTime;
+    __startTime = Game::getInstance()->getGameTime();
+    __loadCount = 0;
+    __finishedCount = 0;
+    __reportedCount = 0;
+    __active = true;
+}
+
+void LoadingScreen::setProgressCallback(const ProgressCallback& callback)
+{
+    __progress = callback;
+}
+
+void LoadingScreen::loadScene(const char* path, const Scene::LoadCallback& callback)
+{
+    GP_ASSERT(path);
+
+    beginLoad();
+    Scene::loadAsync(path, [callback](Scene* scene)
+    {
+        if (callback)
+            callback(scene);
+        else
+            SAFE_RELEASE(scene);
+        endLoad();
+    });
+}
+
+void LoadingScreen::loadBundleScene(const char* path, const char* id, const Bundle::LoadSceneCallback& callback)
+{
+    GP_ASSERT(path);
+
+    beginLoad();
+    Bundle::loadSceneAsync(path, id, [callback](Scene* scene)
+    {
+        if (callback)
+            callback(scene);
+        else
+            SAFE_RELEASE(scene);
+        endLoad();
+    });
+}
+
+Texture* LoadingScreen::loadTexture(const char* path, bool generateMipmaps, const Texture::LoadCallback& callback)
+{
+    GP_ASSERT(path);
+
+    beginLoad();
+    Texture* texture = Texture::createAsync(path, generateMipmaps, [callback](Texture* loadedTexture, bool loaded)
+    {
+        if (callback)
+            callback(loadedTexture, loaded);
+        endLoad();
+    });
+
+    // The callback has already been called for textures that were loaded immediately, and
+    // is never called for textures that could not be created or that are destroyed first.
+    if (texture == NULL)
+    {
+        endLoad();
+    }
+    else if (!texture->isLoaded())
+    {
+        texture->addRef();
+        __textures.push_back(texture);
+    }
+    return texture;
+}
+
+void LoadingScreen::run(const JobSystem::Function& job, const CompleteCallback& callback)
+{
+    GP_ASSERT(job);
+
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    GP_ASSERT(jobSystem);
+
+    beginLoad();
+    jobSystem->run([job, callback]()
+    {
+        job();
+
+        // The callback is called by the next frame drawn, with the callbacks of the other loads.
+        std::lock_guard<std::mutex> lock(__finishedJobsMutex);
+        __finishedJobs.push_back(callback);
+    });
+}
+
+bool LoadingScreen::isActive()
+{
+    return __active;
+}
+
+float LoadingScreen::getProgress()
+{
+    const unsigned int loadCount = __loadCount;
+    return loadCount > 0 ? (float)__finishedCount / (float)loadCount : 1.0f;
+}
+
+void LoadingScreen::beginLoad()
+{
+    GP_ASSERT(__active);
+    ++__loadCount;
+}
+
+void LoadingScreen::endLoad()
+{
+    GP_ASSERT(__finishedCount < __loadCount);
+    ++__finishedCount;
+}
+
+bool LoadingScreen::renderFrame()
+{
+    if (!__active)
+        return false;
+
+    std::vector<CompleteCallback> finishedJobs;
+    {
+        std::lock_guard<std::mutex> lock(__finishedJobsMutex);
+        finishedJobs.swap(__finishedJobs);
+    }
+    for (size_t i = 0, count = finishedJobs.size(); i < count; ++i)
+    {
+        if (finishedJobs[i])
+            finishedJobs[i]();
+        endLoad();
+    }
+
+    // Loads queued by the callbacks of finished loads are counted before the loads that queued them finish.
+    const unsigned int finishedCount = __finishedCount;
+    const unsigned int loadCount = __loadCount;
+    if (__progress && finishedCount != __reportedCount)
+    {
+        __reportedCount = finishedCount;
+        __progress(finishedCount, loadCount);
+    }
+
+    if (finishedCount == loadCount && Game::getInstance()->getGameTime() - __startTime >= __minimumTime)
+    {
+        CompleteCallback complete;
+        complete.swap(__complete);
+        finalize();
+        if (complete)
+            complete();
+        return false;
+    }
+
+    __render(loadCount > 0 ? (float)finishedCount / (float)loadCount : 1.0f);
+    return true;
+}
+
+void LoadingScreen::finalize()
+{
+    __active = false;
+    __render = RenderFunction();
+    __complete = CompleteCallback();
+    __progress = ProgressCallback();
+    for (size_t i = 0, count = __textures.size(); i < count; ++i)
+    {
+        SAFE_RELEASE(__textures[i]);
+    }
+    __textures.clear();
+
+    std::lock_guard<std::mutex> lock(__finishedJobsMutex);
+    __finishedJobs.clear();
+}
+
+}
@@ -0,0 +1,158 @@
+#ifndef LOADINGSCREEN_H_
+#define LOADINGSCREEN_H_
+
+#include "Scene.h"
+#include "Bundle.h"
+#include "Texture.h"
+#include "JobSystem.h"
+
+namespace gameplay
+{
+
+/**
+ * Defines a loading screen that keeps rendering while resources load in the background.
+ *
+ * Unlike ScreenDisplayer, which draws a screen once and blocks until its time has elapsed,
+ * a loading screen is drawn every frame at the frame rate of the game while scenes, bundles
+ * and textures load asynchronously. The game starts a loading screen, typically from
+ * Game::initialize(), and queues its loads through it. Until they have all finished,
+ * Game::update() and Game::render() are not called and the render function of the screen
+ * draws each frame instead, with the fraction of the loads that have finished. The animation,
+ * physics and audio subsystems keep updating, so the screen itself can be animated.
+ *
+ * Loads may be queued from the callbacks of earlier loads, such as to load the textures that
+ * a scene refers to once it has loaded, and the screen stays up until they have finished too.
+ * Once every load has finished and the minimum time has elapsed, the complete callback is
+ * called and the game is updated and rendered again from that frame on.
+ *
+ * The callbacks are called on the thread that renders the frames, which is the thread of the
+ * render thread when it is enabled.
+ *
+ * @script{ignore}
+ */
+class LoadingScreen
+{
+    friend class Game;
+
+public:
+
+    /**
+     * The function that draws the loading screen, passed the fraction of the loads that
+     * have finished, from 0 to 1.
+     */
+    typedef std::function<void(float)> RenderFunction;
+
+    /**
+     * The function called as loads finish, passed the number of loads that have finished
+     * and the number of loads that have been queued.
+     */
+    typedef std::function<void(unsigned int, unsigned int)> ProgressCallback;
+
+    /**
+     * The function called once the loading screen has finished.
+     */
+    typedef std::function<void()> CompleteCallback;
+
+    /**
+     * Starts displaying a loading screen.
+     *
+     * @param render The function that draws the loading screen each frame.
+     * @param complete An optional function to call once every load has finished.
+     * @param minimumTime The minimum amount of time to display the screen (in milliseconds).
+     */
+    static void start(const RenderFunction& render, const CompleteCallback& complete = CompleteCallback(), unsigned long minimumTime = 0L);
+
+    /**
+     * Sets the function called as loads finish, such as to report the progress elsewhere
+     * than on the screen.
+     *
+     * @param callback The function to call, or an empty function to call none.
+     */
+    static void setProgressCallback(const ProgressCallback& callback);
+
+    /**
+     * Loads a scene while the screen is displayed, as Scene::loadAsync() does.
+     *
+     * @param path The path to the '.scene' or '.gpb' file to load from.
+     * @param callback The function called once the scene has loaded.
+     */
+    static void loadScene(const char* path, const Scene::LoadCallback& callback);
+
+    /**
+     * Loads a scene from a bundle while the screen is displayed, as Bundle::loadSceneAsync() does.
+     *
+     * @param path The path of the bundle.
+     * @param id The ID of the scene to load (NULL to load the first scene).
+     * @param callback The function called once the scene has loaded.
+     */
+    static void loadBundleScene(const char* path, const char* id, const Bundle::LoadSceneCallback& callback);
+
+    /**
+     * Loads a texture while the screen is displayed, as Texture::createAsync() does.
+     *
+     * The loading screen keeps a reference to the texture until it has loaded, so the
+     * screen finishes even if the returned texture is released before then.
+     *
+     * @param path The image resource path.
+     * @param generateMipmaps true to auto-generate a full mipmap chain, false otherwise.
+     * @param callback An optional function to call once the texture has loaded.
+     *
+     * @return The new texture, or NULL if the texture could not be created.
+     */
+    static Texture* loadTexture(const char* path, bool generateMipmaps = false, const Texture::LoadCallback& callback = Texture::LoadCallback());
+
+    /**
+     * Runs a function on the JobSystem while the screen is displayed, such as to read or
+     * generate game data.
+     *
+     * @param job The function to run on a worker thread.
+     * @param callback An optional function called on the thread that renders the frames once the job has run.
+     */
+    static void run(const JobSystem::Function& job, const CompleteCallback& callback = CompleteCallback());
+
+    /**
+     * Determines if a loading screen is being displayed.
+     *
+     * @return true if a loading screen is being displayed, false otherwise.
+     */
+    static bool isActive();
+
+    /**
+     * Gets the fraction of the loads of the loading screen that have finished.
+     *
+     * @return The progress, from 0 to 1.
+     */
+    static float getProgress();
+
+private:
+
+    /**
+     * Queues a load.
+     */
+    static void beginLoad();
+
+    /**
+     * Records that a load has finished.
+     */
+    static void endLoad();
+
+    /**
+     * Draws the loading screen, or finishes it once every load has finished.
+     *
+     * Called by Game in place of rendering the frame.
+     *
+     * @return true if the loading screen was drawn, false if there is none.
+     */
+    static bool renderFrame();
+
+    /**
+     * Releases the callbacks and the textures of a loading screen that has not finished.
+     *
+     * Called by Game at shutdown.
+     */
+    static void finalize();
+};
+
+}
+
+#endif
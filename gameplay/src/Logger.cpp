@@ -3,9 +3,107 @@
 #include "Game.h"
 #include "ScriptController.h"
 
+// The number of messages the ring buffer of asynchronous logging holds. Must be a power of two.
+#define LOGGER_RING_SIZE 1024
+
+// The size of a message in the ring buffer, including its terminator. Longer messages are truncated.
+#define LOGGER_MESSAGE_SIZE 512
+
+// How long the writer thread sleeps when the ring buffer is empty, in milliseconds.
+#define LOGGER_WRITER_INTERVAL 5
+
+// How many messages a rate limited call site may log each second by default.
+#define LOGGER_DEFAULT_RATE_LIMIT 10
+
 namespace gameplay
 {
 
+// A slot of the ring buffer. Its sequence is the position it will next be written at, plus one
+// once it holds the message of that position.
+struct LogMessage
+{
+    std::atomic<unsigned int> sequence;
+    char text[LOGGER_MESSAGE_SIZE];
+};
+
+static LogMessage* __ring = NULL;
+static std::atomic<unsigned int> __ringHead(0);
+static std::atomic<unsigned int> __ringTail(0);
+static std::atomic<unsigned int> __dropped(0);
+static std::atomic<bool> __async(false);
+static std::atomic<bool> __writerRunning(false);
+static std::thread* __writer = NULL;
+static std::mutex __asyncMutex;
+static std::atomic<unsigned int> __rateLimit(LOGGER_DEFAULT_RATE_LIMIT);
+
+// Adds a message to the ring buffer without blocking. Returns false if the buffer is full.
+static bool enqueueMessage(const char* str)
+{
+    unsigned int position = __ringHead.load(std::memory_order_relaxed);
+    LogMessage* message;
+    for (;;)
+    {
+        message = &__ring[position & (LOGGER_RING_SIZE - 1)];
+        const int difference = (int)(message->sequence.load(std::memory_order_acquire) - position);
+        if (difference == 0)
+        {
+            if (__ringHead.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (difference < 0)
+        {
+            return false;
+        }
+        else
+        {
+            position = __ringHead.load(std::memory_order_relaxed);
+        }
+    }
+
+    strncpy(message->text, str, LOGGER_MESSAGE_SIZE - 1);
+    message->text[LOGGER_MESSAGE_SIZE - 1] = '\0';
+    message->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+// Writes the messages in the ring buffer. Only one thread may drain the buffer at a time.
+static unsigned int drainMessages()
+{
+    unsigned int count = 0;
+    unsigned int tail = __ringTail.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        LogMessage& message = __ring[tail & (LOGGER_RING_SIZE - 1)];
+        if (message.sequence.load(std::memory_order_acquire) != tail + 1)
+            break;
+
+        gameplay::print("%s", message.text);
+        message.sequence.store(tail + LOGGER_RING_SIZE, std::memory_order_release);
+        __ringTail.store(++tail, std::memory_order_release);
+        ++count;
+    }
+
+    const unsigned int dropped = __dropped.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0)
+        gameplay::print("(%u log messages were dropped while the log buffer was full)\n", dropped);
+    return count;
+}
+
+static void writeMessages()
+{
+    while (__writerRunning.load(std::memory_order_acquire))
+    {
+        if (drainMessages() == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(LOGGER_WRITER_INTERVAL));
+    }
+    drainMessages();
+}
+
+static void stopAsyncLogging()
+{
+    Logger::setAsync(false);
+}
+
 Logger::State Logger::_state[3];
 
 Logger::State::State() : logFunctionC(NULL), logFunctionLua(NULL), enabled(true)
@@ -70,10 +168,27 @@ void Logger::log(Level level, const char* message, ...)
     else
     {
         // Log to the default output
-        gameplay::print("%s", str);
+        write(level, str);
     }
 }
 
+void Logger::write(Level level, const char* message)
+{
+    if (__async.load(std::memory_order_acquire))
+    {
+        if (level != LEVEL_ERROR)
+        {
+            if (!enqueueMessage(message))
+                __dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // Errors usually end the process, so they are written right away, after the queued messages.
+        flush();
+    }
+    gameplay::print("%s", message);
+}
+
 bool Logger::isEnabled(Level level)
 {
     return _state[level].enabled;
@@ -98,4 +213,91 @@ void Logger::set(Level level, const char* logFunction)
     state.logFunctionC = NULL;
 }
 
+void Logger::setAsync(bool async)
+{
+    std::lock_guard<std::mutex> lock(__asyncMutex);
+    if (async == __async.load(std::memory_order_relaxed))
+        return;
+
+    if (async)
+    {
+        // The ring buffer is kept once created, since other threads may still be adding to it.
+        if (!__ring)
+        {
+            __ring = new LogMessage[LOGGER_RING_SIZE];
+            for (unsigned int i = 0; i < LOGGER_RING_SIZE; ++i)
+            {
+                __ring[i].sequence.store(i, std::memory_order_relaxed);
+            }
+            atexit(stopAsyncLogging);
+        }
+        __writerRunning.store(true, std::memory_order_release);
+        __writer = new std::thread(writeMessages);
+        __async.store(true, std::memory_order_release);
+    }
+    else
+    {
+        __async.store(false, std::memory_order_release);
+        __writerRunning.store(false, std::memory_order_release);
+        __writer->join();
+        SAFE_DELETE(__writer);
+        drainMessages();
+    }
+}
+
+bool Logger::isAsync()
+{
+    return __async.load(std::memory_order_acquire);
+}
+
+void Logger::flush()
+{
+    if (!__async.load(std::memory_order_acquire))
+        return;
+
+    const unsigned int head = __ringHead.load(std::memory_order_acquire);
+    while ((int)(__ringTail.load(std::memory_order_acquire) - head) < 0 && __writerRunning.load(std::memory_order_acquire))
+    {
+        std::this_thread::yield();
+    }
+}
+
+void Logger::setRateLimit(unsigned int messagesPerSecond)
+{
+    __rateLimit.store(messagesPerSecond, std::memory_order_relaxed);
+}
+
+unsigned int Logger::getRateLimit()
+{
+    return __rateLimit.load(std::memory_order_relaxed);
+}
+
+Logger::RateLimit::RateLimit() : _windowStart(0), _count(0), _suppressed(0)
+{
+}
+
+bool Logger::RateLimit::allow(Level level)
+{
+    const unsigned int limit = __rateLimit.load(std::memory_order_relaxed);
+    if (limit == 0)
+        return true;
+
+    // Each call site counts its messages over windows of a second.
+    const unsigned int now = (unsigned int)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    unsigned int windowStart = _windowStart.load(std::memory_order_relaxed);
+    if (now - windowStart >= 1000 && _windowStart.compare_exchange_strong(windowStart, now, std::memory_order_relaxed))
+    {
+        _count.store(0, std::memory_order_relaxed);
+        const unsigned int suppressed = _suppressed.exchange(0, std::memory_order_relaxed);
+        if (suppressed > 0)
+            Logger::log(level, "(%u messages like the next one were dropped)\n", suppressed);
+    }
+
+    if (_count.fetch_add(1, std::memory_order_relaxed) < limit)
+        return true;
+    _suppressed.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
 }
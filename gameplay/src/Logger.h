@@ -13,6 +13,19 @@ namespace gameplay
  * can be modified for a specific log level by passing a custom C or Lua logging
  * function to the Logger::set method. Logging can also be toggled using the
  * setEnabled method.
+ *
+ * In asynchronous mode, messages logged to the default output are formatted into a
+ * ring buffer and written by a background thread, so that logging costs the calling
+ * thread little more than the formatting. Messages logged while the ring buffer is full
+ * are dropped and counted. Errors are still written right away, after the queued
+ * messages, since they are normally followed by the end of the process. Messages passed
+ * to custom logging functions are always delivered on the calling thread.
+ *
+ * GP_WARN limits how often each call site logs, so that a warning repeated every frame
+ * does not flood the log; see setRateLimit.
+ *
+ * Both can be configured by the async and rateLimit properties of the logger namespace
+ * of game.config.
  */
 class Logger
 {
@@ -85,6 +98,84 @@ public:
      */
     static void set(Level level, const char* logFunction);
 
+    /**
+     * Enables or disables asynchronous logging to the default output.
+     *
+     * Disabling it writes the messages still queued before returning.
+     *
+     * @param async True to write messages from a background thread, false to write them on the calling thread.
+     * @script{ignore}
+     */
+    static void setAsync(bool async);
+
+    /**
+     * Determines if messages are logged asynchronously.
+     *
+     * @return True if messages are written from a background thread.
+     * @script{ignore}
+     */
+    static bool isAsync();
+
+    /**
+     * Waits until the messages queued by asynchronous logging have been written.
+     * @script{ignore}
+     */
+    static void flush();
+
+    /**
+     * Sets how many messages a rate limited call site, such as GP_WARN, may log each second.
+     *
+     * The messages over the limit are dropped, and their number is logged with the next
+     * message the call site logs.
+     *
+     * @param messagesPerSecond The number of messages per second, or 0 for no limit.
+     * @script{ignore}
+     */
+    static void setRateLimit(unsigned int messagesPerSecond);
+
+    /**
+     * Gets how many messages a rate limited call site may log each second.
+     *
+     * @return The number of messages per second, or 0 if there is no limit.
+     * @script{ignore}
+     */
+    static unsigned int getRateLimit();
+
+    /**
+     * Limits how often a call site logs.
+     *
+     * GP_WARN keeps one for each of its call sites.
+     *
+     * @script{ignore}
+     */
+    class RateLimit
+    {
+    public:
+
+        /**
+         * Constructor.
+         */
+        RateLimit();
+
+        /**
+         * Determines if the call site may log a message now, and counts it.
+         *
+         * When the first message in a second is allowed, the number of messages dropped
+         * during the last second is logged at the given level.
+         *
+         * @param level The log level of the message.
+         *
+         * @return True if the message should be logged, false if it should be dropped.
+         */
+        bool allow(Level level);
+
+    private:
+
+        std::atomic<unsigned int> _windowStart;
+        std::atomic<unsigned int> _count;
+        std::atomic<unsigned int> _suppressed;
+    };
+
 private:
 
     struct State
@@ -115,6 +206,8 @@ private:
      */
     Logger& operator=(const Logger&);
 
+    static void write(Level level, const char* message);
+
     static State _state[3];
 
 };
@@ -220,6 +220,8 @@ bool Material::loadTechnique(Material* material, Properties* techniqueProperties
     // Load uniform value parameters for this technique.
     loadRenderState(technique, techniqueProperties);
 
+    technique->_depthPrepass = techniqueProperties->getBool("depthPrepass");
+
     // Go through all the properties and create passes under this technique.
     techniqueProperties->rewind();
     Properties* passProperties = NULL;
@@ -292,12 +294,13 @@ static bool isMaterialKeyword(const char* str)
 {
     GP_ASSERT(str);
 
-    #define MATERIAL_KEYWORD_COUNT 3
+    #define MATERIAL_KEYWORD_COUNT 4
     static const char* reservedKeywords[MATERIAL_KEYWORD_COUNT] =
     {
         "vertexShader",
         "fragmentShader",
-        "defines"
+        "defines",
+        "depthPrepass"
     };
     for (unsigned int i = 0; i < MATERIAL_KEYWORD_COUNT; ++i)
     {
@@ -6,7 +6,7 @@ namespace gameplay
 {
 
 MaterialParameter::MaterialParameter(const char* name) :
-_type(MaterialParameter::NONE), _count(1), _dynamic(false), _name(name ? name : ""), _uniform(NULL), _loggerDirtyBits(0)
+_type(MaterialParameter::NONE), _count(1), _dynamic(false), _name(name ? name : ""), _handle(Effect::getUniformHandle(_name.c_str())), _uniform(NULL), _loggerDirtyBits(0)
 {
     clearValue();
 }
@@ -80,6 +80,11 @@ const char* MaterialParameter::getName() const
     return _name.c_str();
 }
 
+unsigned int MaterialParameter::getHandle() const
+{
+    return _handle;
+}
+
 Texture::Sampler* MaterialParameter::getSampler(unsigned int index) const
 {
     if (_type == MaterialParameter::SAMPLER)
@@ -454,7 +459,7 @@ void MaterialParameter::bind(Effect* effect)
     // we need to update our uniform to point to the new effect's uniform.
     if (!_uniform || _uniform->getEffect() != effect)
     {
-        _uniform = effect->getUniform(_name.c_str());
+        _uniform = effect->getUniformByHandle(_handle);
 
         if (!_uniform)
         {
@@ -504,6 +509,9 @@ void MaterialParameter::bind(Effect* effect)
         if (_value.method)
             _value.method->setValue(effect);
         break;
+    case MaterialParameter::AUTO_BINDING:
+        // The value is set by the render state that owns the auto binding.
+        break;
     default:
         {
              if ((_loggerDirtyBits & PARAMETER_VALUE_NOT_SET) == 0)
@@ -516,94 +524,65 @@ void MaterialParameter::bind(Effect* effect)
     }
 }
 
+// The node methods that can be bound to a material parameter by name, resolved once when the binding is made.
+static const struct
+{
+    const char* name;
+    Vector3 (Node::*method)() const;
+} __nodeVector3Bindings[] =
+{
+    { "&Node::getBackVector",                   &Node::getBackVector },
+    { "&Node::getDownVector",                   &Node::getDownVector },
+    { "&Node::getTranslationWorld",             &Node::getTranslationWorld },
+    { "&Node::getTranslationView",              &Node::getTranslationView },
+    { "&Node::getForwardVector",                &Node::getForwardVector },
+    { "&Node::getForwardVectorWorld",           &Node::getForwardVectorWorld },
+    { "&Node::getForwardVectorView",            &Node::getForwardVectorView },
+    { "&Node::getLeftVector",                   &Node::getLeftVector },
+    { "&Node::getRightVector",                  &Node::getRightVector },
+    { "&Node::getRightVectorWorld",             &Node::getRightVectorWorld },
+    { "&Node::getUpVector",                     &Node::getUpVector },
+    { "&Node::getUpVectorWorld",                &Node::getUpVectorWorld },
+    { "&Node::getActiveCameraTranslationWorld", &Node::getActiveCameraTranslationWorld },
+    { "&Node::getActiveCameraTranslationView",  &Node::getActiveCameraTranslationView },
+};
+
+static const struct
+{
+    const char* name;
+    float (Node::*method)() const;
+} __nodeFloatBindings[] =
+{
+    { "&Node::getScaleX",       &Node::getScaleX },
+    { "&Node::getScaleY",       &Node::getScaleY },
+    { "&Node::getScaleZ",       &Node::getScaleZ },
+    { "&Node::getTranslationX", &Node::getTranslationX },
+    { "&Node::getTranslationY", &Node::getTranslationY },
+    { "&Node::getTranslationZ", &Node::getTranslationZ },
+};
+
 void MaterialParameter::bindValue(Node* node, const char* binding)
 {
     GP_ASSERT(binding);
 
-    if (strcmp(binding, "&Node::getBackVector") == 0)
-    {
-        bindValue<Node, Vector3>(node, &Node::getBackVector);
-    }
-    else if (strcmp(binding, "&Node::getDownVector") == 0)
-    {
-        bindValue<Node, Vector3>(node, &Node::getDownVector);
-    }
-    else if (strcmp(binding, "&Node::getTranslationWorld") == 0)
-    {
-        bindValue<Node, Vector3>(node, &Node::getTranslationWorld);
-    }
-    else if (strcmp(binding, "&Node::getTranslationView") == 0)
-    {
-        bindValue<Node, Vector3>(node, &Node::getTranslationView);
-    }
-    else if (strcmp(binding, "&Node::getForwardVector") == 0)
+    for (size_t i = 0; i < sizeof(__nodeVector3Bindings) / sizeof(__nodeVector3Bindings[0]); ++i)
     {
-        bindValue<Node, Vector3>(node, &Node::getForwardVector);
-    }
-    else if (strcmp(binding, "&Node::getForwardVectorWorld") == 0)
-    {
-        bindValue<Node, Vector3>(node, &Node::getForwardVectorWorld);
-    }
-    else if (strcmp(binding, "&Node::getForwardVectorView") == 0)
-    {
-        bindValue<Node, Vector3>(node, &Node::getForwardVectorView);
-    }
-    else if (strcmp(binding, "&Node::getLeftVector") == 0)
-    {
-        bindValue<Node, Vector3>(node, &Node::getLeftVector);
-    }
-    else if (strcmp(binding, "&Node::getRightVector") == 0)
-    {
-        bindValue<Node, Vector3>(node, &Node::getRightVector);
-    }
-    else if (strcmp(binding, "&Node::getRightVectorWorld") == 0)
-    {
-        bindValue<Node, Vector3>(node, &Node::getRightVectorWorld);
-    }
-    else if (strcmp(binding, "&Node::getUpVector") == 0)
-    {
-        bindValue<Node, Vector3>(node, &Node::getUpVector);
-    }
-    else if (strcmp(binding, "&Node::getUpVectorWorld") == 0)
-    {
-        bindValue<Node, Vector3>(node, &Node::getUpVectorWorld);
-    }
-    else if (strcmp(binding, "&Node::getActiveCameraTranslationWorld") == 0)
-    {
-        bindValue<Node, Vector3>(node, &Node::getActiveCameraTranslationWorld);
-    }
-    else if (strcmp(binding, "&Node::getActiveCameraTranslationView") == 0)
-    {
-        bindValue<Node, Vector3>(node, &Node::getActiveCameraTranslationView);
-    }
-    else if (strcmp(binding, "&Node::getScaleX") == 0)
-    {
-        bindValue<Node, float>(node, &Node::getScaleX);
-    }
-    else if (strcmp(binding, "&Node::getScaleY") == 0)
-    {
-        bindValue<Node, float>(node, &Node::getScaleY);
-    }
-    else if (strcmp(binding, "&Node::getScaleZ") == 0)
-    {
-        bindValue<Node, float>(node, &Node::getScaleZ);
-    }
-    else if (strcmp(binding, "&Node::getTranslationX") == 0)
-    {
-        bindValue<Node, float>(node, &Node::getTranslationX);
-    }
-    else if (strcmp(binding, "&Node::getTranslationY") == 0)
-    {
-        bindValue<Node, float>(node, &Node::getTranslationY);
-    }
-    else if (strcmp(binding, "&Node::getTranslationZ") == 0)
-    {
-        bindValue<Node, float>(node, &Node::getTranslationZ);
+        if (strcmp(binding, __nodeVector3Bindings[i].name) == 0)
+        {
+            bindValue<Node, Vector3>(node, __nodeVector3Bindings[i].method);
+            return;
+        }
     }
-    else
+    for (size_t i = 0; i < sizeof(__nodeFloatBindings) / sizeof(__nodeFloatBindings[0]); ++i)
     {
-        GP_WARN("Unsupported material parameter binding '%s'.", binding);
+        if (strcmp(binding, __nodeFloatBindings[i].name) == 0)
+        {
+            bindValue<Node, float>(node, __nodeFloatBindings[i].method);
+            return;
+        }
     }
+
+    GP_WARN("Unsupported material parameter binding '%s'.", binding);
 }
 
 unsigned int MaterialParameter::getAnimationPropertyComponentCount(int propertyId) const
@@ -620,6 +599,7 @@ unsigned int MaterialParameter::getAnimationPropertyComponentCount(int propertyI
                 case SAMPLER:
                 case SAMPLER_ARRAY:
                 case METHOD:
+                case AUTO_BINDING:
                     return 0;
                 case FLOAT:
                 case FLOAT_ARRAY:
@@ -683,6 +663,7 @@ void MaterialParameter::getAnimationPropertyValue(int propertyId, AnimationValue
                 case NONE:
                 case MATRIX:
                 case METHOD:
+                case AUTO_BINDING:
                 case SAMPLER:
                 case SAMPLER_ARRAY:
                     // Unsupported material parameter types for animation.
@@ -732,6 +713,7 @@ void MaterialParameter::setAnimationPropertyValue(int propertyId, AnimationValue
                 case NONE:
                 case MATRIX:
                 case METHOD:
+                case AUTO_BINDING:
                 case SAMPLER:
                 case SAMPLER_ARRAY:
                     // Unsupported material parameter types for animation.
@@ -764,6 +746,7 @@ void MaterialParameter::cloneInto(MaterialParameter* materialParameter) const
     switch (_type)
     {
     case NONE:
+    case AUTO_BINDING:
         break;
     case FLOAT:
         materialParameter->setValue(_value.floatValue);
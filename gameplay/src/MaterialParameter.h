@@ -37,6 +37,7 @@ namespace gameplay
 class MaterialParameter : public AnimationTarget, public Ref
 {
     friend class RenderState;
+    friend class MaterialParameterBlock;
 
 public:
 
@@ -50,6 +51,13 @@ public:
      */
     const char* getName() const;
 
+    /**
+     * Returns the uniform handle of the name of this material parameter.
+     *
+     * @see Effect::getUniformHandle
+     */
+    unsigned int getHandle() const;
+
     /**
      * Returns the texture sampler or NULL if this MaterialParameter is not a sampler type.
      * 
@@ -473,12 +481,14 @@ private:
         MATRIX,
         SAMPLER,
         SAMPLER_ARRAY,
-        METHOD
+        METHOD,
+        AUTO_BINDING
     } _type;
     
     unsigned int _count;
     bool _dynamic;
     std::string _name;
+    unsigned int _handle;
     Uniform* _uniform;
     char _loggerDirtyBits;
 };
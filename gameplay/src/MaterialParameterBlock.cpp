@@ -0,0 +1,81 @@
+#include "Base.h"
+#include "MaterialParameterBlock.h"
+
+namespace gameplay
+{
+
+MaterialParameterBlock::MaterialParameterBlock()
+{
+}
+
+MaterialParameterBlock::~MaterialParameterBlock()
+{
+    for (size_t i = 0, count = _parameters.size(); i < count; ++i)
+    {
+        SAFE_RELEASE(_parameters[i]);
+    }
+}
+
+MaterialParameterBlock* MaterialParameterBlock::create()
+{
+    return new MaterialParameterBlock();
+}
+
+MaterialParameter* MaterialParameterBlock::getParameter(const char* name)
+{
+    GP_ASSERT(name);
+
+    return getParameterByHandle(Effect::getUniformHandle(name));
+}
+
+MaterialParameter* MaterialParameterBlock::getParameterByHandle(unsigned int handle)
+{
+    for (size_t i = 0, count = _parameters.size(); i < count; ++i)
+    {
+        if (_parameters[i]->_handle == handle)
+            return _parameters[i];
+    }
+
+    MaterialParameter* param = new MaterialParameter(Effect::getUniformHandleName(handle));
+    _parameters.push_back(param);
+    return param;
+}
+
+void MaterialParameterBlock::removeParameter(unsigned int handle)
+{
+    for (size_t i = 0, count = _parameters.size(); i < count; ++i)
+    {
+        if (_parameters[i]->_handle == handle)
+        {
+            SAFE_RELEASE(_parameters[i]);
+            _parameters.erase(_parameters.begin() + i);
+            return;
+        }
+    }
+}
+
+unsigned int MaterialParameterBlock::getParameterCount() const
+{
+    return (unsigned int)_parameters.size();
+}
+
+MaterialParameter* MaterialParameterBlock::getParameterByIndex(unsigned int index) const
+{
+    GP_ASSERT(index < _parameters.size());
+    return _parameters[index];
+}
+
+void MaterialParameterBlock::bind(Effect* effect)
+{
+    GP_ASSERT(effect);
+
+    // Effects that do not use a parameter, such as depth-only effects, are skipped without a warning.
+    for (size_t i = 0, count = _parameters.size(); i < count; ++i)
+    {
+        MaterialParameter* param = _parameters[i];
+        if (effect->getUniformByHandle(param->_handle))
+            param->bind(effect);
+    }
+}
+
+}
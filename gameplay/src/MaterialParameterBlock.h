@@ -0,0 +1,117 @@
+#ifndef MATERIALPARAMETERBLOCK_H_
+#define MATERIALPARAMETERBLOCK_H_
+
+#include "MaterialParameter.h"
+
+namespace gameplay
+{
+
+/**
+ * Defines a block of material parameters that override those of the materials of a drawable.
+ *
+ * Giving each node its own values of a few parameters, such as a tint or a texture, would
+ * otherwise require a clone of the whole material for each node, duplicating its techniques,
+ * passes, state blocks and parameters, and drawables with different materials are not sorted
+ * or instanced together. A model can instead keep sharing a material and hold a block of the
+ * parameters it overrides, which are set on the effect of each pass after the pass is bound.
+ *
+ * Parameters are addressed by uniform handles (see Effect::getUniformHandle()), so the names
+ * of the parameters can be looked up once, and the uniforms of a handle are found in each
+ * effect without comparing names.
+ *
+ * A block only sets the uniforms it overrides when the drawable holding it is drawn, so the
+ * parameters it overrides should also be set by the material, for the drawables without the
+ * override to get the values of the material back.
+ *
+ * @see Model::setParameterBlock
+ * @script{ignore}
+ */
+class MaterialParameterBlock : public Ref
+{
+    friend class Model;
+
+public:
+
+    /**
+     * Creates an empty parameter block.
+     *
+     * @return The new parameter block.
+     */
+    static MaterialParameterBlock* create();
+
+    /**
+     * Gets the parameter of the block with the specified name, creating it if it does not exist yet.
+     *
+     * @param name The name of the parameter.
+     *
+     * @return The parameter.
+     */
+    MaterialParameter* getParameter(const char* name);
+
+    /**
+     * Gets the parameter of the block with the specified uniform handle, creating it if it does not exist yet.
+     *
+     * @param handle The uniform handle of the name of the parameter.
+     *
+     * @return The parameter.
+     */
+    MaterialParameter* getParameterByHandle(unsigned int handle);
+
+    /**
+     * Removes the parameter with the specified uniform handle from the block.
+     *
+     * @param handle The uniform handle of the name of the parameter.
+     */
+    void removeParameter(unsigned int handle);
+
+    /**
+     * Gets the number of parameters in the block.
+     *
+     * @return The number of parameters.
+     */
+    unsigned int getParameterCount() const;
+
+    /**
+     * Gets the parameter at the specified index.
+     *
+     * @param index The index of the parameter.
+     *
+     * @return The parameter.
+     */
+    MaterialParameter* getParameterByIndex(unsigned int index) const;
+
+private:
+
+    /**
+     * Constructor.
+     */
+    MaterialParameterBlock();
+
+    /**
+     * Destructor.
+     */
+    ~MaterialParameterBlock();
+
+    /**
+     * Hidden copy constructor.
+     */
+    MaterialParameterBlock(const MaterialParameterBlock& copy);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    MaterialParameterBlock& operator=(const MaterialParameterBlock&);
+
+    /**
+     * Sets the parameters of the block that the specified effect has on it.
+     *
+     * The effect must be bound.
+     */
+    void bind(Effect* effect);
+
+    std::vector<MaterialParameter*> _parameters;
+};
+
+}
+
+#endif
@@ -25,4 +25,50 @@ void MathUtil::smooth(float* x, float target, float elapsedTime, float riseTime,
     }
 }
 
+// Tests the spheres (x, y, z, radius) from 'first' on against the six planes (nx, ny, nz, d) one at a time.
+unsigned int MathUtil::cullSpheresScalar(const float* planes, const float* spheres, unsigned int first, unsigned int count, unsigned int* visible)
+{
+    unsigned int visibleCount = 0;
+    for (unsigned int i = first; i < count; ++i)
+    {
+        const float* s = spheres + i * 4;
+        bool outside = false;
+        for (unsigned int p = 0; p < 24 && !outside; p += 4)
+        {
+            outside = planes[p] * s[0] + planes[p + 1] * s[1] + planes[p + 2] * s[2] + planes[p + 3] < -s[3];
+        }
+        if (!outside)
+        {
+            visible[i >> 5] |= 1u << (i & 31);
+            ++visibleCount;
+        }
+    }
+    return visibleCount;
+}
+
+// Tests the boxes (min x, y, z, max x, y, z) from 'first' on against the six planes (nx, ny, nz, d) one at a time.
+unsigned int MathUtil::cullBoxesScalar(const float* planes, const float* boxes, unsigned int first, unsigned int count, unsigned int* visible)
+{
+    unsigned int visibleCount = 0;
+    for (unsigned int i = first; i < count; ++i)
+    {
+        const float* b = boxes + i * 6;
+        float cx = (b[0] + b[3]) * 0.5f, cy = (b[1] + b[4]) * 0.5f, cz = (b[2] + b[5]) * 0.5f;
+        float ex = (b[3] - b[0]) * 0.5f, ey = (b[4] - b[1]) * 0.5f, ez = (b[5] - b[2]) * 0.5f;
+        bool outside = false;
+        for (unsigned int p = 0; p < 24 && !outside; p += 4)
+        {
+            float distance = planes[p] * cx + planes[p + 1] * cy + planes[p + 2] * cz + planes[p + 3];
+            float extent = fabsf(planes[p]) * ex + fabsf(planes[p + 1]) * ey + fabsf(planes[p + 2]) * ez;
+            outside = distance < -extent;
+        }
+        if (!outside)
+        {
+            visible[i >> 5] |= 1u << (i & 31);
+            ++visibleCount;
+        }
+    }
+    return visibleCount;
+}
+
 }
@@ -11,7 +11,12 @@ namespace gameplay
 class MathUtil
 {
     friend class Matrix;
+    friend class BoundingSphere;
     friend class Vector3;
+    friend class Frustum;
+    friend class ParticleEmitter;
+    friend class AnimationPose;
+    friend class HeightField;
 
 public:
 
@@ -56,6 +61,8 @@ private:
 
     inline static void multiplyMatrix(const float* m1, const float* m2, float* dst);
 
+    inline static void multiplyAffineMatrix(const float* m1, const float* m2, float* dst);
+
     inline static void negateMatrix(const float* m, float* dst);
 
     inline static void transposeMatrix(const float* m, float* dst);
@@ -66,6 +73,32 @@ private:
 
     inline static void crossVector3(const float* v1, const float* v2, float* dst);
 
+    inline static void multiplyMatrixArray(const float* parent, const float* matrices, unsigned int count, float* dst);
+
+    inline static void transformVector3Array(const float* m, const float* vectors, float w, unsigned int count, float* dst);
+
+    inline static void transformVector4Array(const float* m, const float* vectors, unsigned int count, float* dst);
+
+    inline static void transformSphereArray(const float* m, float scale, const float* spheres, unsigned int count, float* dst);
+
+    inline static unsigned int cullSpheres(const float* planes, const float* spheres, unsigned int count, unsigned int* visible);
+
+    inline static unsigned int cullBoxes(const float* planes, const float* boxes, unsigned int count, unsigned int* visible);
+
+    static unsigned int cullSpheresScalar(const float* planes, const float* spheres, unsigned int first, unsigned int count, unsigned int* visible);
+
+    static unsigned int cullBoxesScalar(const float* planes, const float* boxes, unsigned int first, unsigned int count, unsigned int* visible);
+
+    inline static void multiplyAddArray(const float* a, float scalar, float* dst, unsigned int count);
+
+    inline static void lerpArray(const float* start, const float* end, const float* t, float* dst, unsigned int count);
+
+    inline static void bilinearArray(const float* h00, const float* h10, const float* h01, const float* h11, const float* fx, const float* fy,
+                                     float* dst, unsigned int count);
+
+    inline static void blendQuaternionArray(float* x, float* y, float* z, float* w, const float* srcX, const float* srcY, const float* srcZ, const float* srcW,
+                                            const float* weights, float blendWeight, unsigned int count);
+
     MathUtil();
 };
 
@@ -1,8 +1,30 @@
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define GP_MATH_SSE
+#endif
+
+// Coefficients of the correction of the interpolation factor of blendQuaternionArray, as a function of the
+// cosine of the angle between the quaternions, fitted by Arseny Kapoulkine ("Approximating slerp").
+#define QUATERNION_BLEND_A0 1.0904f
+#define QUATERNION_BLEND_A1 -3.2452f
+#define QUATERNION_BLEND_A2 3.55645f
+#define QUATERNION_BLEND_A3 -1.43519f
+#define QUATERNION_BLEND_B0 0.848013f
+#define QUATERNION_BLEND_B1 -1.06021f
+#define QUATERNION_BLEND_B2 0.215638f
+
 namespace gameplay
 {
 
 inline void MathUtil::addMatrix(const float* m, float scalar, float* dst)
 {
+#ifdef GP_MATH_SSE
+    const __m128 s = _mm_set1_ps(scalar);
+    for (unsigned int i = 0; i < 16; i += 4)
+    {
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(m + i), s));
+    }
+#else
     dst[0]  = m[0]  + scalar;
     dst[1]  = m[1]  + scalar;
     dst[2]  = m[2]  + scalar;
@@ -19,10 +41,17 @@ inline void MathUtil::addMatrix(const float* m, float scalar, float* dst)
     dst[13] = m[13] + scalar;
     dst[14] = m[14] + scalar;
     dst[15] = m[15] + scalar;
+#endif
 }
 
 inline void MathUtil::addMatrix(const float* m1, const float* m2, float* dst)
 {
+#ifdef GP_MATH_SSE
+    for (unsigned int i = 0; i < 16; i += 4)
+    {
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(m1 + i), _mm_loadu_ps(m2 + i)));
+    }
+#else
     dst[0]  = m1[0]  + m2[0];
     dst[1]  = m1[1]  + m2[1];
     dst[2]  = m1[2]  + m2[2];
@@ -39,10 +68,17 @@ inline void MathUtil::addMatrix(const float* m1, const float* m2, float* dst)
     dst[13] = m1[13] + m2[13];
     dst[14] = m1[14] + m2[14];
     dst[15] = m1[15] + m2[15];
+#endif
 }
 
 inline void MathUtil::subtractMatrix(const float* m1, const float* m2, float* dst)
 {
+#ifdef GP_MATH_SSE
+    for (unsigned int i = 0; i < 16; i += 4)
+    {
+        _mm_storeu_ps(dst + i, _mm_sub_ps(_mm_loadu_ps(m1 + i), _mm_loadu_ps(m2 + i)));
+    }
+#else
     dst[0]  = m1[0]  - m2[0];
     dst[1]  = m1[1]  - m2[1];
     dst[2]  = m1[2]  - m2[2];
@@ -59,10 +95,18 @@ inline void MathUtil::subtractMatrix(const float* m1, const float* m2, float* ds
     dst[13] = m1[13] - m2[13];
     dst[14] = m1[14] - m2[14];
     dst[15] = m1[15] - m2[15];
+#endif
 }
 
 inline void MathUtil::multiplyMatrix(const float* m, float scalar, float* dst)
 {
+#ifdef GP_MATH_SSE
+    const __m128 s = _mm_set1_ps(scalar);
+    for (unsigned int i = 0; i < 16; i += 4)
+    {
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_loadu_ps(m + i), s));
+    }
+#else
     dst[0]  = m[0]  * scalar;
     dst[1]  = m[1]  * scalar;
     dst[2]  = m[2]  * scalar;
@@ -79,10 +123,30 @@ inline void MathUtil::multiplyMatrix(const float* m, float scalar, float* dst)
     dst[13] = m[13] * scalar;
     dst[14] = m[14] * scalar;
     dst[15] = m[15] * scalar;
+#endif
 }
 
 inline void MathUtil::multiplyMatrix(const float* m1, const float* m2, float* dst)
 {
+#ifdef GP_MATH_SSE
+    // Each column of the product is the columns of m1 scaled by one column of m2, summed in the same order as below.
+    // All of the columns are computed before any is stored, in case m1 or m2 is the same array as dst.
+    const __m128 c0 = _mm_loadu_ps(m1);
+    const __m128 c1 = _mm_loadu_ps(m1 + 4);
+    const __m128 c2 = _mm_loadu_ps(m1 + 8);
+    const __m128 c3 = _mm_loadu_ps(m1 + 12);
+    __m128 product[4];
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        const float* column = m2 + i * 4;
+        product[i] = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(column[0])), _mm_mul_ps(c1, _mm_set1_ps(column[1]))),
+                                           _mm_mul_ps(c2, _mm_set1_ps(column[2]))), _mm_mul_ps(c3, _mm_set1_ps(column[3])));
+    }
+    _mm_storeu_ps(dst, product[0]);
+    _mm_storeu_ps(dst + 4, product[1]);
+    _mm_storeu_ps(dst + 8, product[2]);
+    _mm_storeu_ps(dst + 12, product[3]);
+#else
     // Support the case where m1 or m2 is the same array as dst.
     float product[16];
 
@@ -107,10 +171,68 @@ inline void MathUtil::multiplyMatrix(const float* m1, const float* m2, float* ds
     product[15] = m1[3] * m2[12] + m1[7] * m2[13] + m1[11] * m2[14] + m1[15] * m2[15];
 
     memcpy(dst, product, MATRIX_SIZE);
+#endif
+}
+
+inline void MathUtil::multiplyAffineMatrix(const float* m1, const float* m2, float* dst)
+{
+#ifdef GP_MATH_SSE
+    // The bottom rows are (0, 0, 0, 1), so only the last column of m2 picks up the translation of m1,
+    // and the bottom row of the product is set rather than summed.
+    const __m128 mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+    const __m128 c0 = _mm_loadu_ps(m1);
+    const __m128 c1 = _mm_loadu_ps(m1 + 4);
+    const __m128 c2 = _mm_loadu_ps(m1 + 8);
+    const __m128 c3 = _mm_loadu_ps(m1 + 12);
+    __m128 product[4];
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        const float* column = m2 + i * 4;
+        product[i] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(column[0])), _mm_mul_ps(c1, _mm_set1_ps(column[1]))),
+                                _mm_mul_ps(c2, _mm_set1_ps(column[2])));
+    }
+    _mm_storeu_ps(dst, _mm_and_ps(product[0], mask));
+    _mm_storeu_ps(dst + 4, _mm_and_ps(product[1], mask));
+    _mm_storeu_ps(dst + 8, _mm_and_ps(product[2], mask));
+    _mm_storeu_ps(dst + 12, _mm_or_ps(_mm_and_ps(_mm_add_ps(product[3], c3), mask), _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f)));
+#else
+    // The bottom rows are (0, 0, 0, 1), so only the last column of m2 picks up the translation of m1.
+    float product[16];
+
+    product[0]  = m1[0] * m2[0]  + m1[4] * m2[1]  + m1[8]  * m2[2];
+    product[1]  = m1[1] * m2[0]  + m1[5] * m2[1]  + m1[9]  * m2[2];
+    product[2]  = m1[2] * m2[0]  + m1[6] * m2[1]  + m1[10] * m2[2];
+    product[3]  = 0.0f;
+
+    product[4]  = m1[0] * m2[4]  + m1[4] * m2[5]  + m1[8]  * m2[6];
+    product[5]  = m1[1] * m2[4]  + m1[5] * m2[5]  + m1[9]  * m2[6];
+    product[6]  = m1[2] * m2[4]  + m1[6] * m2[5]  + m1[10] * m2[6];
+    product[7]  = 0.0f;
+
+    product[8]  = m1[0] * m2[8]  + m1[4] * m2[9]  + m1[8]  * m2[10];
+    product[9]  = m1[1] * m2[8]  + m1[5] * m2[9]  + m1[9]  * m2[10];
+    product[10] = m1[2] * m2[8]  + m1[6] * m2[9]  + m1[10] * m2[10];
+    product[11] = 0.0f;
+
+    product[12] = m1[0] * m2[12] + m1[4] * m2[13] + m1[8]  * m2[14] + m1[12];
+    product[13] = m1[1] * m2[12] + m1[5] * m2[13] + m1[9]  * m2[14] + m1[13];
+    product[14] = m1[2] * m2[12] + m1[6] * m2[13] + m1[10] * m2[14] + m1[14];
+    product[15] = 1.0f;
+
+    memcpy(dst, product, MATRIX_SIZE);
+#endif
 }
 
 inline void MathUtil::negateMatrix(const float* m, float* dst)
 {
+#ifdef GP_MATH_SSE
+    // Flipping the sign bit is what negation does, including for zeros and NaNs.
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    for (unsigned int i = 0; i < 16; i += 4)
+    {
+        _mm_storeu_ps(dst + i, _mm_xor_ps(_mm_loadu_ps(m + i), signMask));
+    }
+#else
     dst[0]  = -m[0];
     dst[1]  = -m[1];
     dst[2]  = -m[2];
@@ -127,10 +249,22 @@ inline void MathUtil::negateMatrix(const float* m, float* dst)
     dst[13] = -m[13];
     dst[14] = -m[14];
     dst[15] = -m[15];
+#endif
 }
 
 inline void MathUtil::transposeMatrix(const float* m, float* dst)
 {
+#ifdef GP_MATH_SSE
+    __m128 c0 = _mm_loadu_ps(m);
+    __m128 c1 = _mm_loadu_ps(m + 4);
+    __m128 c2 = _mm_loadu_ps(m + 8);
+    __m128 c3 = _mm_loadu_ps(m + 12);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    _mm_storeu_ps(dst, c0);
+    _mm_storeu_ps(dst + 4, c1);
+    _mm_storeu_ps(dst + 8, c2);
+    _mm_storeu_ps(dst + 12, c3);
+#else
     float t[16] = {
         m[0], m[4], m[8], m[12],
         m[1], m[5], m[9], m[13],
@@ -138,17 +272,31 @@ inline void MathUtil::transposeMatrix(const float* m, float* dst)
         m[3], m[7], m[11], m[15]
     };
     memcpy(dst, t, MATRIX_SIZE);
+#endif
 }
 
 inline void MathUtil::transformVector4(const float* m, float x, float y, float z, float w, float* dst)
 {
+#ifdef GP_MATH_SSE
+    // dst only holds three floats, so the fourth component is neither computed into it nor stored.
+    __m128 r = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(x), _mm_loadu_ps(m)), _mm_mul_ps(_mm_set1_ps(y), _mm_loadu_ps(m + 4))),
+                                     _mm_mul_ps(_mm_set1_ps(z), _mm_loadu_ps(m + 8))), _mm_mul_ps(_mm_set1_ps(w), _mm_loadu_ps(m + 12)));
+    _mm_storel_pi((__m64*)dst, r);
+    _mm_store_ss(dst + 2, _mm_movehl_ps(r, r));
+#else
     dst[0] = x * m[0] + y * m[4] + z * m[8] + w * m[12];
     dst[1] = x * m[1] + y * m[5] + z * m[9] + w * m[13];
     dst[2] = x * m[2] + y * m[6] + z * m[10] + w * m[14];
+#endif
 }
 
 inline void MathUtil::transformVector4(const float* m, const float* v, float* dst)
 {
+#ifdef GP_MATH_SSE
+    __m128 r = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(v[0]), _mm_loadu_ps(m)), _mm_mul_ps(_mm_set1_ps(v[1]), _mm_loadu_ps(m + 4))),
+                                     _mm_mul_ps(_mm_set1_ps(v[2]), _mm_loadu_ps(m + 8))), _mm_mul_ps(_mm_set1_ps(v[3]), _mm_loadu_ps(m + 12)));
+    _mm_storeu_ps(dst, r);
+#else
     // Handle case where v == dst.
     float x = v[0] * m[0] + v[1] * m[4] + v[2] * m[8] + v[3] * m[12];
     float y = v[0] * m[1] + v[1] * m[5] + v[2] * m[9] + v[3] * m[13];
@@ -159,10 +307,20 @@ inline void MathUtil::transformVector4(const float* m, const float* v, float* ds
     dst[1] = y;
     dst[2] = z;
     dst[3] = w;
+#endif
 }
 
 inline void MathUtil::crossVector3(const float* v1, const float* v2, float* dst)
 {
+#ifdef GP_MATH_SSE
+    // The vectors only hold three floats, so they are loaded and stored a component at a time.
+    const __m128 a = _mm_set_ps(0.0f, v1[2], v1[1], v1[0]);
+    const __m128 b = _mm_set_ps(0.0f, v2[2], v2[1], v2[0]);
+    const __m128 r = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 0, 2))),
+                                _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 0, 2)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1))));
+    _mm_storel_pi((__m64*)dst, r);
+    _mm_store_ss(dst + 2, _mm_movehl_ps(r, r));
+#else
     float x = (v1[1] * v2[2]) - (v1[2] * v2[1]);
     float y = (v1[2] * v2[0]) - (v1[0] * v2[2]);
     float z = (v1[0] * v2[1]) - (v1[1] * v2[0]);
@@ -170,8 +328,307 @@ inline void MathUtil::crossVector3(const float* v1, const float* v2, float* dst)
     dst[0] = x;
     dst[1] = y;
     dst[2] = z;
+#endif
 }
 
+inline void MathUtil::multiplyMatrixArray(const float* parent, const float* matrices, unsigned int count, float* dst)
+{
+#ifdef GP_MATH_SSE
+    // The columns of the parent are loaded once, and each product is summed in the same order as multiplyMatrix.
+    const __m128 c0 = _mm_loadu_ps(parent);
+    const __m128 c1 = _mm_loadu_ps(parent + 4);
+    const __m128 c2 = _mm_loadu_ps(parent + 8);
+    const __m128 c3 = _mm_loadu_ps(parent + 12);
+    for (unsigned int i = 0; i < count; ++i, matrices += 16, dst += 16)
+    {
+        __m128 product[4];
+        for (unsigned int j = 0; j < 4; ++j)
+        {
+            const float* column = matrices + j * 4;
+            product[j] = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(column[0])), _mm_mul_ps(c1, _mm_set1_ps(column[1]))),
+                                               _mm_mul_ps(c2, _mm_set1_ps(column[2]))), _mm_mul_ps(c3, _mm_set1_ps(column[3])));
+        }
+        _mm_storeu_ps(dst, product[0]);
+        _mm_storeu_ps(dst + 4, product[1]);
+        _mm_storeu_ps(dst + 8, product[2]);
+        _mm_storeu_ps(dst + 12, product[3]);
+    }
+#else
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        multiplyMatrix(parent, matrices + i * 16, dst + i * 16);
+    }
+#endif
+}
+
+inline void MathUtil::transformVector3Array(const float* m, const float* vectors, float w, unsigned int count, float* dst)
+{
+#ifdef GP_MATH_SSE
+    // Each result is stored a lane at a time, since a fourth lane would overwrite the next vector when transforming in place.
+    const __m128 c0 = _mm_loadu_ps(m);
+    const __m128 c1 = _mm_loadu_ps(m + 4);
+    const __m128 c2 = _mm_loadu_ps(m + 8);
+    const __m128 c3 = _mm_mul_ps(_mm_set1_ps(w), _mm_loadu_ps(m + 12));
+    for (unsigned int i = 0; i < count; ++i, vectors += 3, dst += 3)
+    {
+        __m128 r = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(vectors[0]), c0), _mm_mul_ps(_mm_set1_ps(vectors[1]), c1)),
+                                         _mm_mul_ps(_mm_set1_ps(vectors[2]), c2)), c3);
+        _mm_storel_pi((__m64*)dst, r);
+        _mm_store_ss(dst + 2, _mm_movehl_ps(r, r));
+    }
+#else
+    for (unsigned int i = 0; i < count; ++i, vectors += 3, dst += 3)
+    {
+        transformVector4(m, vectors[0], vectors[1], vectors[2], w, dst);
+    }
+#endif
 }
 
+inline void MathUtil::transformVector4Array(const float* m, const float* vectors, unsigned int count, float* dst)
+{
+#ifdef GP_MATH_SSE
+    const __m128 c0 = _mm_loadu_ps(m);
+    const __m128 c1 = _mm_loadu_ps(m + 4);
+    const __m128 c2 = _mm_loadu_ps(m + 8);
+    const __m128 c3 = _mm_loadu_ps(m + 12);
+    for (unsigned int i = 0; i < count; ++i, vectors += 4, dst += 4)
+    {
+        __m128 r = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(vectors[0]), c0), _mm_mul_ps(_mm_set1_ps(vectors[1]), c1)),
+                                         _mm_mul_ps(_mm_set1_ps(vectors[2]), c2)), _mm_mul_ps(_mm_set1_ps(vectors[3]), c3));
+        _mm_storeu_ps(dst, r);
+    }
+#else
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        transformVector4(m, vectors + i * 4, dst + i * 4);
+    }
+#endif
+}
+
+inline void MathUtil::transformSphereArray(const float* m, float scale, const float* spheres, unsigned int count, float* dst)
+{
+#ifdef GP_MATH_SSE
+    const __m128 c0 = _mm_loadu_ps(m);
+    const __m128 c1 = _mm_loadu_ps(m + 4);
+    const __m128 c2 = _mm_loadu_ps(m + 8);
+    const __m128 c3 = _mm_loadu_ps(m + 12);
+    for (unsigned int i = 0; i < count; ++i, spheres += 4, dst += 4)
+    {
+        const float radius = spheres[3] * scale;
+        __m128 r = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(spheres[0]), c0), _mm_mul_ps(_mm_set1_ps(spheres[1]), c1)),
+                                         _mm_mul_ps(_mm_set1_ps(spheres[2]), c2)), c3);
+        _mm_storeu_ps(dst, r);
+        dst[3] = radius;
+    }
+#else
+    for (unsigned int i = 0; i < count; ++i, spheres += 4, dst += 4)
+    {
+        const float radius = spheres[3] * scale;
+        transformVector4(m, spheres[0], spheres[1], spheres[2], 1.0f, dst);
+        dst[3] = radius;
+    }
+#endif
+}
+
+inline unsigned int MathUtil::cullSpheres(const float* planes, const float* spheres, unsigned int count, unsigned int* visible)
+{
+    unsigned int visibleCount = 0;
+    unsigned int i = 0;
+#ifdef GP_MATH_SSE
+    // Four spheres at a time, transposed so that each register holds one component of all four.
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(spheres + i * 4);
+        __m128 y = _mm_loadu_ps(spheres + i * 4 + 4);
+        __m128 z = _mm_loadu_ps(spheres + i * 4 + 8);
+        __m128 r = _mm_loadu_ps(spheres + i * 4 + 12);
+        _MM_TRANSPOSE4_PS(x, y, z, r);
+        const __m128 negativeRadius = _mm_sub_ps(zero, r);
 
+        __m128 outside = zero;
+        for (unsigned int p = 0; p < 24; p += 4)
+        {
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p]), x), _mm_mul_ps(_mm_set1_ps(planes[p + 1]), y)),
+                                         _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p + 2]), z), _mm_set1_ps(planes[p + 3])));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, negativeRadius));
+        }
+
+        unsigned int mask = ~(unsigned int)_mm_movemask_ps(outside) & 0xF;
+        visible[i >> 5] |= mask << (i & 31);
+        visibleCount += (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + (mask >> 3);
+    }
+#endif
+    return visibleCount + cullSpheresScalar(planes, spheres, i, count, visible);
+}
+
+inline unsigned int MathUtil::cullBoxes(const float* planes, const float* boxes, unsigned int count, unsigned int* visible)
+{
+    unsigned int visibleCount = 0;
+    unsigned int i = 0;
+#ifdef GP_MATH_SSE
+    // Four boxes at a time, as centers and half extents with one component of all four per register.
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    for (; i + 4 <= count; i += 4)
+    {
+        const float* b = boxes + i * 6;
+        __m128 minX = _mm_set_ps(b[18], b[12], b[6], b[0]);
+        __m128 minY = _mm_set_ps(b[19], b[13], b[7], b[1]);
+        __m128 minZ = _mm_set_ps(b[20], b[14], b[8], b[2]);
+        __m128 maxX = _mm_set_ps(b[21], b[15], b[9], b[3]);
+        __m128 maxY = _mm_set_ps(b[22], b[16], b[10], b[4]);
+        __m128 maxZ = _mm_set_ps(b[23], b[17], b[11], b[5]);
+        __m128 cx = _mm_mul_ps(_mm_add_ps(minX, maxX), half);
+        __m128 cy = _mm_mul_ps(_mm_add_ps(minY, maxY), half);
+        __m128 cz = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half);
+        __m128 ex = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+        __m128 ey = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+        __m128 ez = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+        __m128 outside = zero;
+        for (unsigned int p = 0; p < 24; p += 4)
+        {
+            __m128 nx = _mm_set1_ps(planes[p]);
+            __m128 ny = _mm_set1_ps(planes[p + 1]);
+            __m128 nz = _mm_set1_ps(planes[p + 2]);
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, cx), _mm_mul_ps(ny, cy)), _mm_add_ps(_mm_mul_ps(nz, cz), _mm_set1_ps(planes[p + 3])));
+            __m128 extent = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(signMask, nx), ex), _mm_mul_ps(_mm_andnot_ps(signMask, ny), ey)),
+                                       _mm_mul_ps(_mm_andnot_ps(signMask, nz), ez));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, _mm_sub_ps(zero, extent)));
+        }
+
+        unsigned int mask = ~(unsigned int)_mm_movemask_ps(outside) & 0xF;
+        visible[i >> 5] |= mask << (i & 31);
+        visibleCount += (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + (mask >> 3);
+    }
+#endif
+    return visibleCount + cullBoxesScalar(planes, boxes, i, count, visible);
+}
+
+inline void MathUtil::multiplyAddArray(const float* a, float scalar, float* dst, unsigned int count)
+{
+    unsigned int i = 0;
+#ifdef GP_MATH_SSE
+    const __m128 s = _mm_set1_ps(scalar);
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(a + i), s)));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        dst[i] += a[i] * scalar;
+    }
+}
+
+inline void MathUtil::lerpArray(const float* start, const float* end, const float* t, float* dst, unsigned int count)
+{
+    unsigned int i = 0;
+#ifdef GP_MATH_SSE
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 s = _mm_loadu_ps(start + i);
+        _mm_storeu_ps(dst + i, _mm_add_ps(s, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(end + i), s), _mm_loadu_ps(t + i))));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        dst[i] = start[i] + (end[i] - start[i]) * t[i];
+    }
+}
+
+inline void MathUtil::bilinearArray(const float* h00, const float* h10, const float* h01, const float* h11, const float* fx, const float* fy,
+                                    float* dst, unsigned int count)
+{
+    unsigned int i = 0;
+#ifdef GP_MATH_SSE
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 x = _mm_loadu_ps(fx + i);
+        const __m128 a = _mm_loadu_ps(h00 + i);
+        const __m128 b = _mm_loadu_ps(h01 + i);
+        const __m128 top = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(h10 + i), a), x));
+        const __m128 bottom = _mm_add_ps(b, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(h11 + i), b), x));
+        _mm_storeu_ps(dst + i, _mm_add_ps(top, _mm_mul_ps(_mm_sub_ps(bottom, top), _mm_loadu_ps(fy + i))));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        const float top = h00[i] + (h10[i] - h00[i]) * fx[i];
+        const float bottom = h01[i] + (h11[i] - h01[i]) * fx[i];
+        dst[i] = top + (bottom - top) * fy[i];
+    }
+}
+
+
+inline void MathUtil::blendQuaternionArray(float* x, float* y, float* z, float* w, const float* srcX, const float* srcY, const float* srcZ, const float* srcW,
+                                           const float* weights, float blendWeight, unsigned int count)
+{
+    // Normalized lerp in the hemisphere of the destination, with the interpolation factor corrected
+    // so that the result follows slerp to about a thousandth of a radian at any angle.
+    unsigned int i = 0;
+#ifdef GP_MATH_SSE
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 smallest = _mm_set1_ps(MATH_FLOAT_SMALL);
+    const __m128 b = _mm_set1_ps(blendWeight);
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 qx = _mm_loadu_ps(x + i);
+        const __m128 qy = _mm_loadu_ps(y + i);
+        const __m128 qz = _mm_loadu_ps(z + i);
+        const __m128 qw = _mm_loadu_ps(w + i);
+        const __m128 sx = _mm_loadu_ps(srcX + i);
+        const __m128 sy = _mm_loadu_ps(srcY + i);
+        const __m128 sz = _mm_loadu_ps(srcZ + i);
+        const __m128 sw = _mm_loadu_ps(srcW + i);
+        const __m128 t = _mm_mul_ps(b, _mm_loadu_ps(weights + i));
+        const __m128 cosine = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(qx, sx), _mm_mul_ps(qy, sy)), _mm_mul_ps(qz, sz)), _mm_mul_ps(qw, sw));
+        const __m128 d = _mm_andnot_ps(signMask, cosine);
+        const __m128 u = _mm_sub_ps(t, half);
+        const __m128 a = _mm_add_ps(_mm_set1_ps(QUATERNION_BLEND_A0), _mm_mul_ps(d, _mm_add_ps(_mm_set1_ps(QUATERNION_BLEND_A1),
+                         _mm_mul_ps(d, _mm_add_ps(_mm_set1_ps(QUATERNION_BLEND_A2), _mm_mul_ps(d, _mm_set1_ps(QUATERNION_BLEND_A3)))))));
+        const __m128 k = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(a, u), u), _mm_set1_ps(QUATERNION_BLEND_B0)),
+                                    _mm_mul_ps(d, _mm_add_ps(_mm_set1_ps(QUATERNION_BLEND_B1), _mm_mul_ps(d, _mm_set1_ps(QUATERNION_BLEND_B2)))));
+        const __m128 ct = _mm_add_ps(t, _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, u), _mm_sub_ps(t, one)), k));
+        const __m128 s = _mm_xor_ps(ct, _mm_and_ps(_mm_cmplt_ps(cosine, zero), signMask));
+        const __m128 it = _mm_sub_ps(one, ct);
+        const __m128 rx = _mm_add_ps(_mm_mul_ps(it, qx), _mm_mul_ps(s, sx));
+        const __m128 ry = _mm_add_ps(_mm_mul_ps(it, qy), _mm_mul_ps(s, sy));
+        const __m128 rz = _mm_add_ps(_mm_mul_ps(it, qz), _mm_mul_ps(s, sz));
+        const __m128 rw = _mm_add_ps(_mm_mul_ps(it, qw), _mm_mul_ps(s, sw));
+        const __m128 length = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)), _mm_mul_ps(rz, rz)), _mm_mul_ps(rw, rw));
+        const __m128 scale = _mm_div_ps(one, _mm_sqrt_ps(_mm_max_ps(length, smallest)));
+        _mm_storeu_ps(x + i, _mm_mul_ps(rx, scale));
+        _mm_storeu_ps(y + i, _mm_mul_ps(ry, scale));
+        _mm_storeu_ps(z + i, _mm_mul_ps(rz, scale));
+        _mm_storeu_ps(w + i, _mm_mul_ps(rw, scale));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        const float t = blendWeight * weights[i];
+        const float cosine = x[i] * srcX[i] + y[i] * srcY[i] + z[i] * srcZ[i] + w[i] * srcW[i];
+        const float d = fabs(cosine);
+        const float u = t - 0.5f;
+        const float k = (QUATERNION_BLEND_A0 + d * (QUATERNION_BLEND_A1 + d * (QUATERNION_BLEND_A2 + d * QUATERNION_BLEND_A3))) * u * u +
+                        QUATERNION_BLEND_B0 + d * (QUATERNION_BLEND_B1 + d * QUATERNION_BLEND_B2);
+        const float ct = t + t * u * (t - 1.0f) * k;
+        const float s = cosine < 0.0f ? -ct : ct;
+        const float rx = (1.0f - ct) * x[i] + s * srcX[i];
+        const float ry = (1.0f - ct) * y[i] + s * srcY[i];
+        const float rz = (1.0f - ct) * z[i] + s * srcZ[i];
+        const float rw = (1.0f - ct) * w[i] + s * srcW[i];
+        const float scale = 1.0f / sqrt(std::max(rx * rx + ry * ry + rz * rz + rw * rw, MATH_FLOAT_SMALL));
+        x[i] = rx * scale;
+        y[i] = ry * scale;
+        z[i] = rz * scale;
+        w[i] = rw * scale;
+    }
+}
+
+}
@@ -1,3 +1,5 @@
+#include <arm_neon.h>
+
 namespace gameplay
 {
 
@@ -123,6 +125,26 @@ inline void MathUtil::multiplyMatrix(const float* m1, const float* m2, float* ds
     );
 }
 
+inline void MathUtil::multiplyAffineMatrix(const float* m1, const float* m2, float* dst)
+{
+    // The bottom rows are (0, 0, 0, 1), so only the last column of m2 picks up the translation of m1,
+    // and the bottom row of the product is set rather than summed.
+    const float32x4_t c0 = vld1q_f32(m1);
+    const float32x4_t c1 = vld1q_f32(m1 + 4);
+    const float32x4_t c2 = vld1q_f32(m1 + 8);
+    const float32x4_t c3 = vld1q_f32(m1 + 12);
+    float32x4_t product[4];
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        const float* column = m2 + i * 4;
+        product[i] = vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(c0, column[0]), c1, column[1]), c2, column[2]);
+    }
+    vst1q_f32(dst, vsetq_lane_f32(0.0f, product[0], 3));
+    vst1q_f32(dst + 4, vsetq_lane_f32(0.0f, product[1], 3));
+    vst1q_f32(dst + 8, vsetq_lane_f32(0.0f, product[2], 3));
+    vst1q_f32(dst + 12, vsetq_lane_f32(1.0f, vaddq_f32(product[3], c3), 3));
+}
+
 inline void MathUtil::negateMatrix(const float* m, float* dst)
 {
     asm volatile(
@@ -226,4 +248,277 @@ inline void MathUtil::crossVector3(const float* v1, const float* v2, float* dst)
     );
 }
 
+inline void MathUtil::multiplyMatrixArray(const float* parent, const float* matrices, unsigned int count, float* dst)
+{
+    // The columns of the parent are loaded once, and each product is summed in the same order as multiplyMatrix.
+    const float32x4_t c0 = vld1q_f32(parent);
+    const float32x4_t c1 = vld1q_f32(parent + 4);
+    const float32x4_t c2 = vld1q_f32(parent + 8);
+    const float32x4_t c3 = vld1q_f32(parent + 12);
+    for (unsigned int i = 0; i < count; ++i, matrices += 16, dst += 16)
+    {
+        float32x4_t product[4];
+        for (unsigned int j = 0; j < 4; ++j)
+        {
+            const float32x4_t column = vld1q_f32(matrices + j * 4);
+            product[j] = vmlaq_lane_f32(vmlaq_lane_f32(vmlaq_lane_f32(vmulq_lane_f32(c0, vget_low_f32(column), 0),
+                                                                      c1, vget_low_f32(column), 1),
+                                                       c2, vget_high_f32(column), 0),
+                                        c3, vget_high_f32(column), 1);
+        }
+        vst1q_f32(dst, product[0]);
+        vst1q_f32(dst + 4, product[1]);
+        vst1q_f32(dst + 8, product[2]);
+        vst1q_f32(dst + 12, product[3]);
+    }
+}
+
+inline void MathUtil::transformVector3Array(const float* m, const float* vectors, float w, unsigned int count, float* dst)
+{
+    // Each result is stored as two lanes and one, since a fourth lane would overwrite the next vector when transforming in place.
+    const float32x4_t c0 = vld1q_f32(m);
+    const float32x4_t c1 = vld1q_f32(m + 4);
+    const float32x4_t c2 = vld1q_f32(m + 8);
+    const float32x4_t c3 = vmulq_n_f32(vld1q_f32(m + 12), w);
+    for (unsigned int i = 0; i < count; ++i, vectors += 3, dst += 3)
+    {
+        float32x4_t r = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(c3, c0, vectors[0]), c1, vectors[1]), c2, vectors[2]);
+        vst1_f32(dst, vget_low_f32(r));
+        vst1q_lane_f32(dst + 2, r, 2);
+    }
+}
+
+inline void MathUtil::transformVector4Array(const float* m, const float* vectors, unsigned int count, float* dst)
+{
+    const float32x4_t c0 = vld1q_f32(m);
+    const float32x4_t c1 = vld1q_f32(m + 4);
+    const float32x4_t c2 = vld1q_f32(m + 8);
+    const float32x4_t c3 = vld1q_f32(m + 12);
+    for (unsigned int i = 0; i < count; ++i, vectors += 4, dst += 4)
+    {
+        const float32x4_t v = vld1q_f32(vectors);
+        vst1q_f32(dst, vmlaq_lane_f32(vmlaq_lane_f32(vmlaq_lane_f32(vmulq_lane_f32(c0, vget_low_f32(v), 0),
+                                                                    c1, vget_low_f32(v), 1),
+                                                     c2, vget_high_f32(v), 0),
+                                      c3, vget_high_f32(v), 1));
+    }
+}
+
+inline void MathUtil::transformSphereArray(const float* m, float scale, const float* spheres, unsigned int count, float* dst)
+{
+    const float32x4_t c0 = vld1q_f32(m);
+    const float32x4_t c1 = vld1q_f32(m + 4);
+    const float32x4_t c2 = vld1q_f32(m + 8);
+    const float32x4_t c3 = vld1q_f32(m + 12);
+    for (unsigned int i = 0; i < count; ++i, spheres += 4, dst += 4)
+    {
+        const float32x4_t s = vld1q_f32(spheres);
+        float32x4_t r = vmlaq_lane_f32(vmlaq_lane_f32(vmlaq_lane_f32(c3, c0, vget_low_f32(s), 0), c1, vget_low_f32(s), 1), c2, vget_high_f32(s), 0);
+        vst1q_f32(dst, vsetq_lane_f32(vgetq_lane_f32(s, 3) * scale, r, 3));
+    }
+}
+
+// Gets a bit per lane of a comparison result, for the lanes that are not set.
+inline static unsigned int getClearLanes(uint32x4_t lanes)
+{
+    uint32_t values[4];
+    vst1q_u32(values, lanes);
+    return (values[0] ? 0 : 1) | (values[1] ? 0 : 2) | (values[2] ? 0 : 4) | (values[3] ? 0 : 8);
+}
+
+inline unsigned int MathUtil::cullSpheres(const float* planes, const float* spheres, unsigned int count, unsigned int* visible)
+{
+    unsigned int visibleCount = 0;
+    unsigned int i = 0;
+
+    // Four spheres at a time, deinterleaved so that each register holds one component of all four.
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x4_t s = vld4q_f32(spheres + i * 4);
+        const float32x4_t negativeRadius = vnegq_f32(s.val[3]);
+
+        uint32x4_t outside = vdupq_n_u32(0);
+        for (unsigned int p = 0; p < 24; p += 4)
+        {
+            float32x4_t distance = vdupq_n_f32(planes[p + 3]);
+            distance = vmlaq_n_f32(distance, s.val[0], planes[p]);
+            distance = vmlaq_n_f32(distance, s.val[1], planes[p + 1]);
+            distance = vmlaq_n_f32(distance, s.val[2], planes[p + 2]);
+            outside = vorrq_u32(outside, vcltq_f32(distance, negativeRadius));
+        }
+
+        unsigned int mask = getClearLanes(outside);
+        visible[i >> 5] |= mask << (i & 31);
+        visibleCount += (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + (mask >> 3);
+    }
+    return visibleCount + cullSpheresScalar(planes, spheres, i, count, visible);
+}
+
+inline unsigned int MathUtil::cullBoxes(const float* planes, const float* boxes, unsigned int count, unsigned int* visible)
+{
+    unsigned int visibleCount = 0;
+    unsigned int i = 0;
+
+    // Four boxes at a time, as centers and half extents with one component of all four per register.
+    for (; i + 4 <= count; i += 4)
+    {
+        float c[3][4];
+        float e[3][4];
+        for (unsigned int j = 0; j < 4; ++j)
+        {
+            const float* b = boxes + (i + j) * 6;
+            for (unsigned int k = 0; k < 3; ++k)
+            {
+                c[k][j] = (b[k] + b[k + 3]) * 0.5f;
+                e[k][j] = (b[k + 3] - b[k]) * 0.5f;
+            }
+        }
+        float32x4_t cx = vld1q_f32(c[0]), cy = vld1q_f32(c[1]), cz = vld1q_f32(c[2]);
+        float32x4_t ex = vld1q_f32(e[0]), ey = vld1q_f32(e[1]), ez = vld1q_f32(e[2]);
+
+        uint32x4_t outside = vdupq_n_u32(0);
+        for (unsigned int p = 0; p < 24; p += 4)
+        {
+            float32x4_t distance = vdupq_n_f32(planes[p + 3]);
+            distance = vmlaq_n_f32(distance, cx, planes[p]);
+            distance = vmlaq_n_f32(distance, cy, planes[p + 1]);
+            distance = vmlaq_n_f32(distance, cz, planes[p + 2]);
+            float32x4_t extent = vmulq_n_f32(ex, fabsf(planes[p]));
+            extent = vmlaq_n_f32(extent, ey, fabsf(planes[p + 1]));
+            extent = vmlaq_n_f32(extent, ez, fabsf(planes[p + 2]));
+            outside = vorrq_u32(outside, vcltq_f32(distance, vnegq_f32(extent)));
+        }
+
+        unsigned int mask = getClearLanes(outside);
+        visible[i >> 5] |= mask << (i & 31);
+        visibleCount += (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + (mask >> 3);
+    }
+    return visibleCount + cullBoxesScalar(planes, boxes, i, count, visible);
+}
+
+inline void MathUtil::multiplyAddArray(const float* a, float scalar, float* dst, unsigned int count)
+{
+    unsigned int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        vst1q_f32(dst + i, vmlaq_n_f32(vld1q_f32(dst + i), vld1q_f32(a + i), scalar));
+    }
+    for (; i < count; ++i)
+    {
+        dst[i] += a[i] * scalar;
+    }
+}
+
+inline void MathUtil::lerpArray(const float* start, const float* end, const float* t, float* dst, unsigned int count)
+{
+    unsigned int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const float32x4_t s = vld1q_f32(start + i);
+        vst1q_f32(dst + i, vmlaq_f32(s, vsubq_f32(vld1q_f32(end + i), s), vld1q_f32(t + i)));
+    }
+    for (; i < count; ++i)
+    {
+        dst[i] = start[i] + (end[i] - start[i]) * t[i];
+    }
+}
+
+inline void MathUtil::bilinearArray(const float* h00, const float* h10, const float* h01, const float* h11, const float* fx, const float* fy,
+                                    float* dst, unsigned int count)
+{
+    unsigned int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const float32x4_t x = vld1q_f32(fx + i);
+        const float32x4_t a = vld1q_f32(h00 + i);
+        const float32x4_t b = vld1q_f32(h01 + i);
+        const float32x4_t top = vmlaq_f32(a, vsubq_f32(vld1q_f32(h10 + i), a), x);
+        const float32x4_t bottom = vmlaq_f32(b, vsubq_f32(vld1q_f32(h11 + i), b), x);
+        vst1q_f32(dst + i, vmlaq_f32(top, vsubq_f32(bottom, top), vld1q_f32(fy + i)));
+    }
+    for (; i < count; ++i)
+    {
+        const float top = h00[i] + (h10[i] - h00[i]) * fx[i];
+        const float bottom = h01[i] + (h11[i] - h01[i]) * fx[i];
+        dst[i] = top + (bottom - top) * fy[i];
+    }
+}
+
+
+// Coefficients of the correction of the interpolation factor of blendQuaternionArray, as a function of the
+// cosine of the angle between the quaternions, fitted by Arseny Kapoulkine ("Approximating slerp").
+#define QUATERNION_BLEND_A0 1.0904f
+#define QUATERNION_BLEND_A1 -3.2452f
+#define QUATERNION_BLEND_A2 3.55645f
+#define QUATERNION_BLEND_A3 -1.43519f
+#define QUATERNION_BLEND_B0 0.848013f
+#define QUATERNION_BLEND_B1 -1.06021f
+#define QUATERNION_BLEND_B2 0.215638f
+
+inline void MathUtil::blendQuaternionArray(float* x, float* y, float* z, float* w, const float* srcX, const float* srcY, const float* srcZ, const float* srcW,
+                                           const float* weights, float blendWeight, unsigned int count)
+{
+    // Normalized lerp in the hemisphere of the destination, with the interpolation factor corrected
+    // so that the result follows slerp to about a thousandth of a radian at any angle.
+    unsigned int i = 0;
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const uint32x4_t signMask = vdupq_n_u32(0x80000000);
+    for (; i + 4 <= count; i += 4)
+    {
+        const float32x4_t qx = vld1q_f32(x + i);
+        const float32x4_t qy = vld1q_f32(y + i);
+        const float32x4_t qz = vld1q_f32(z + i);
+        const float32x4_t qw = vld1q_f32(w + i);
+        const float32x4_t sx = vld1q_f32(srcX + i);
+        const float32x4_t sy = vld1q_f32(srcY + i);
+        const float32x4_t sz = vld1q_f32(srcZ + i);
+        const float32x4_t sw = vld1q_f32(srcW + i);
+        const float32x4_t t = vmulq_n_f32(vld1q_f32(weights + i), blendWeight);
+        const float32x4_t cosine = vmlaq_f32(vmlaq_f32(vmlaq_f32(vmulq_f32(qx, sx), qy, sy), qz, sz), qw, sw);
+        const float32x4_t d = vabsq_f32(cosine);
+        const float32x4_t u = vsubq_f32(t, vdupq_n_f32(0.5f));
+        const float32x4_t a = vmlaq_f32(vdupq_n_f32(QUATERNION_BLEND_A0), d, vmlaq_f32(vdupq_n_f32(QUATERNION_BLEND_A1), d,
+                                        vmlaq_n_f32(vdupq_n_f32(QUATERNION_BLEND_A2), d, QUATERNION_BLEND_A3)));
+        const float32x4_t k = vmlaq_f32(vmlaq_f32(vdupq_n_f32(QUATERNION_BLEND_B0), d, vmlaq_n_f32(vdupq_n_f32(QUATERNION_BLEND_B1), d, QUATERNION_BLEND_B2)),
+                                        vmulq_f32(a, u), u);
+        const float32x4_t ct = vmlaq_f32(t, vmulq_f32(vmulq_f32(t, u), vsubq_f32(t, one)), k);
+        const float32x4_t s = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(ct), vandq_u32(vcltq_f32(cosine, vdupq_n_f32(0.0f)), signMask)));
+        const float32x4_t it = vsubq_f32(one, ct);
+        const float32x4_t rx = vmlaq_f32(vmulq_f32(it, qx), s, sx);
+        const float32x4_t ry = vmlaq_f32(vmulq_f32(it, qy), s, sy);
+        const float32x4_t rz = vmlaq_f32(vmulq_f32(it, qz), s, sz);
+        const float32x4_t rw = vmlaq_f32(vmulq_f32(it, qw), s, sw);
+        const float32x4_t length = vmaxq_f32(vmlaq_f32(vmlaq_f32(vmlaq_f32(vmulq_f32(rx, rx), ry, ry), rz, rz), rw, rw), vdupq_n_f32(MATH_FLOAT_SMALL));
+
+        // Two Newton steps refine the reciprocal square root estimate to nearly full precision.
+        float32x4_t scale = vrsqrteq_f32(length);
+        scale = vmulq_f32(scale, vrsqrtsq_f32(vmulq_f32(length, scale), scale));
+        scale = vmulq_f32(scale, vrsqrtsq_f32(vmulq_f32(length, scale), scale));
+        vst1q_f32(x + i, vmulq_f32(rx, scale));
+        vst1q_f32(y + i, vmulq_f32(ry, scale));
+        vst1q_f32(z + i, vmulq_f32(rz, scale));
+        vst1q_f32(w + i, vmulq_f32(rw, scale));
+    }
+    for (; i < count; ++i)
+    {
+        const float t = blendWeight * weights[i];
+        const float cosine = x[i] * srcX[i] + y[i] * srcY[i] + z[i] * srcZ[i] + w[i] * srcW[i];
+        const float d = fabs(cosine);
+        const float u = t - 0.5f;
+        const float k = (QUATERNION_BLEND_A0 + d * (QUATERNION_BLEND_A1 + d * (QUATERNION_BLEND_A2 + d * QUATERNION_BLEND_A3))) * u * u +
+                        QUATERNION_BLEND_B0 + d * (QUATERNION_BLEND_B1 + d * QUATERNION_BLEND_B2);
+        const float ct = t + t * u * (t - 1.0f) * k;
+        const float s = cosine < 0.0f ? -ct : ct;
+        const float rx = (1.0f - ct) * x[i] + s * srcX[i];
+        const float ry = (1.0f - ct) * y[i] + s * srcY[i];
+        const float rz = (1.0f - ct) * z[i] + s * srcZ[i];
+        const float rw = (1.0f - ct) * w[i] + s * srcW[i];
+        const float scale = 1.0f / sqrt(std::max(rx * rx + ry * ry + rz * rz + rw * rw, MATH_FLOAT_SMALL));
+        x[i] = rx * scale;
+        y[i] = ry * scale;
+        z[i] = rz * scale;
+        w[i] = rw * scale;
+    }
+}
+
 }
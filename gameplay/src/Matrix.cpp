@@ -700,6 +700,45 @@ bool Matrix::invert(Matrix* dst) const
     return true;
 }
 
+bool Matrix::invertAffine(Matrix* dst) const
+{
+    GP_ASSERT(dst);
+
+    // Cofactors of the first column of the upper 3x3 part.
+    float c0 = m[5] * m[10] - m[9] * m[6];
+    float c1 = m[9] * m[2] - m[1] * m[10];
+    float c2 = m[1] * m[6] - m[5] * m[2];
+
+    // Calculate the determinant.
+    float det = m[0] * c0 + m[4] * c1 + m[8] * c2;
+
+    // Close to zero, can't invert.
+    if (fabs(det) <= MATH_TOLERANCE)
+        return false;
+
+    // The upper 3x3 part is the adjugate over the determinant, and the translation is moved back by it.
+    float invDet = 1.0f / det;
+    float r0 = c0 * invDet;
+    float r1 = c1 * invDet;
+    float r2 = c2 * invDet;
+    float r4 = (m[8] * m[6] - m[4] * m[10]) * invDet;
+    float r5 = (m[0] * m[10] - m[8] * m[2]) * invDet;
+    float r6 = (m[4] * m[2] - m[0] * m[6]) * invDet;
+    float r8 = (m[4] * m[9] - m[8] * m[5]) * invDet;
+    float r9 = (m[8] * m[1] - m[0] * m[9]) * invDet;
+    float r10 = (m[0] * m[5] - m[4] * m[1]) * invDet;
+    float r12 = -(r0 * m[12] + r4 * m[13] + r8 * m[14]);
+    float r13 = -(r1 * m[12] + r5 * m[13] + r9 * m[14]);
+    float r14 = -(r2 * m[12] + r6 * m[13] + r10 * m[14]);
+
+    dst->set(r0, r4, r8, r12,
+             r1, r5, r9, r13,
+             r2, r6, r10, r14,
+             0.0f, 0.0f, 0.0f, 1.0f);
+
+    return true;
+}
+
 bool Matrix::isIdentity() const
 {
     return (memcmp(m, MATRIX_IDENTITY, MATRIX_SIZE) == 0);
@@ -734,6 +773,21 @@ void Matrix::multiply(const Matrix& m1, const Matrix& m2, Matrix* dst)
     MathUtil::multiplyMatrix(m1.m, m2.m, dst->m);
 }
 
+void Matrix::multiplyAffine(const Matrix& m1, const Matrix& m2, Matrix* dst)
+{
+    GP_ASSERT(dst);
+
+    MathUtil::multiplyAffineMatrix(m1.m, m2.m, dst->m);
+}
+
+void Matrix::multiply(const Matrix& parent, const Matrix* matrices, unsigned int count, Matrix* dst)
+{
+    GP_ASSERT(matrices || count == 0);
+    GP_ASSERT(dst || count == 0);
+
+    MathUtil::multiplyMatrixArray(parent.m, (const float*)matrices, count, (float*)dst);
+}
+
 void Matrix::negate()
 {
     negate(this);
@@ -903,6 +957,14 @@ void Matrix::transformPoint(const Vector3& point, Vector3* dst) const
     transformVector(point.x, point.y, point.z, 1.0f, dst);
 }
 
+void Matrix::transformPoints(const Vector3* points, unsigned int count, Vector3* dst) const
+{
+    GP_ASSERT(points || count == 0);
+    GP_ASSERT(dst || count == 0);
+
+    MathUtil::transformVector3Array(m, (const float*)points, 1.0f, count, (float*)dst);
+}
+
 void Matrix::transformVector(Vector3* vector) const
 {
     GP_ASSERT(vector);
@@ -914,6 +976,14 @@ void Matrix::transformVector(const Vector3& vector, Vector3* dst) const
     transformVector(vector.x, vector.y, vector.z, 0.0f, dst);
 }
 
+void Matrix::transformVectors(const Vector3* vectors, unsigned int count, Vector3* dst) const
+{
+    GP_ASSERT(vectors || count == 0);
+    GP_ASSERT(dst || count == 0);
+
+    MathUtil::transformVector3Array(m, (const float*)vectors, 0.0f, count, (float*)dst);
+}
+
 void Matrix::transformVector(float x, float y, float z, float w, Vector3* dst) const
 {
     GP_ASSERT(dst);
@@ -934,6 +1004,14 @@ void Matrix::transformVector(const Vector4& vector, Vector4* dst) const
     MathUtil::transformVector4(m, (const float*) &vector, (float*)dst);
 }
 
+void Matrix::transformVectors(const Vector4* vectors, unsigned int count, Vector4* dst) const
+{
+    GP_ASSERT(vectors || count == 0);
+    GP_ASSERT(dst || count == 0);
+
+    MathUtil::transformVector4Array(m, (const float*)vectors, count, (float*)dst);
+}
+
 void Matrix::translate(float x, float y, float z)
 {
     translate(x, y, z, this);
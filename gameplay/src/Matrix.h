@@ -40,6 +40,8 @@ class Quaternion;
  * (which is optimized for that kind of usage).
  *
  * @see Transform
+ *
+ * @script{value}
  */
 class Matrix
 {
@@ -480,6 +482,20 @@ public:
      */
     bool invert(Matrix* dst) const;
 
+    /**
+     * Stores the inverse of this matrix in the specified matrix, assuming that
+     * the bottom row of this matrix is (0, 0, 0, 1).
+     *
+     * This is the case for matrices composed of translations, rotations and scales,
+     * such as those of transforms, nodes and joints. Only the upper 3x3 part is
+     * inverted, which takes much less work than invert().
+     *
+     * @param dst A matrix to store the invert of this matrix in.
+     *
+     * @return true if the the matrix can be inverted, false otherwise.
+     */
+    bool invertAffine(Matrix* dst) const;
+
     /**
      * Determines if this matrix is equal to the identity matrix.
      *
@@ -527,6 +543,33 @@ public:
      */
     static void multiply(const Matrix& m1, const Matrix& m2, Matrix* dst);
 
+    /**
+     * Multiplies m1 by m2 and stores the result in dst, assuming that the
+     * bottom rows of both are (0, 0, 0, 1).
+     *
+     * This is the case for matrices composed of translations, rotations and scales,
+     * such as those of transforms, nodes and joints. The bottom row of the product
+     * is set rather than computed, which takes less work than multiply().
+     *
+     * @param m1 The first matrix to multiply.
+     * @param m2 The second matrix to multiply.
+     * @param dst A matrix to store the result in.
+     */
+    static void multiplyAffine(const Matrix& m1, const Matrix& m2, Matrix* dst);
+
+    /**
+     * Multiplies a parent matrix by each of an array of matrices and stores the results in dst.
+     *
+     * This gives the same results as calling multiply(parent, matrices[i], &dst[i]) for each matrix,
+     * with the parent loaded once for the whole array.
+     *
+     * @param parent The matrix to multiply each matrix by, which must not be in dst.
+     * @param matrices The matrices to multiply.
+     * @param count The number of matrices.
+     * @param dst An array of count matrices to store the results in, which may be matrices.
+     */
+    static void multiply(const Matrix& parent, const Matrix* matrices, unsigned int count, Matrix* dst);
+
     /**
      * Negates this matrix.
      */
@@ -762,6 +805,16 @@ public:
      */
     void transformPoint(const Vector3& point, Vector3* dst) const;
 
+    /**
+     * Transforms an array of points by this matrix, and stores
+     * the results in dst.
+     *
+     * @param points The points to transform.
+     * @param count The number of points.
+     * @param dst An array of count vectors to store the transformed points in, which may be points.
+     */
+    void transformPoints(const Vector3* points, unsigned int count, Vector3* dst) const;
+
     /**
      * Transforms the specified vector by this matrix by
      * treating the fourth (w) coordinate as zero.
@@ -782,6 +835,17 @@ public:
      */
     void transformVector(const Vector3& vector, Vector3* dst) const;
 
+    /**
+     * Transforms an array of vectors by this matrix by
+     * treating the fourth (w) coordinate as zero, and stores the
+     * results in dst.
+     *
+     * @param vectors The vectors to transform.
+     * @param count The number of vectors.
+     * @param dst An array of count vectors to store the transformed vectors in, which may be vectors.
+     */
+    void transformVectors(const Vector3* vectors, unsigned int count, Vector3* dst) const;
+
     /**
      * Transforms the specified vector by this matrix.
      *
@@ -810,6 +874,15 @@ public:
      */
     void transformVector(const Vector4& vector, Vector4* dst) const;
 
+    /**
+     * Transforms an array of vectors by this matrix.
+     *
+     * @param vectors The vectors to transform.
+     * @param count The number of vectors.
+     * @param dst An array of count vectors to store the transformed vectors in, which may be vectors.
+     */
+    void transformVectors(const Vector4* vectors, unsigned int count, Vector4* dst) const;
+
     /**
      * Post-multiplies this matrix by the matrix corresponding to the
      * specified translation.
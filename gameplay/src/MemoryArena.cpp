@@ -0,0 +1,147 @@
+#include "Base.h"
+#include "MemoryArena.h"
+
+namespace gameplay
+{
+
+static MemoryArena __frameArena;
+static thread_local MemoryArena* __scratchArena = NULL;
+
+// Frees the scratch arena of a thread when the thread exits.
+struct ScratchArenaOwner
+{
+    ~ScratchArenaOwner()
+    {
+        SAFE_DELETE(__scratchArena);
+    }
+};
+
+MemoryArena::Scope::Scope(MemoryArena* arena)
+    : _arena(arena), _block(arena->_block), _offset(arena->_offset)
+{
+    GP_ASSERT(arena);
+}
+
+MemoryArena::Scope::~Scope()
+{
+    GP_ASSERT(_block < _arena->_block || (_block == _arena->_block && _offset <= _arena->_offset));
+    _arena->_block = _block;
+    _arena->_offset = _offset;
+}
+
+MemoryArena::MemoryArena(size_t blockSize)
+    : _block(0), _offset(0), _blockSize(blockSize)
+{
+    GP_ASSERT(blockSize > 0);
+}
+
+MemoryArena::~MemoryArena()
+{
+    for (size_t i = 0, count = _blocks.size(); i < count; ++i)
+    {
+        free(_blocks[i].data);
+    }
+}
+
+void* MemoryArena::allocate(size_t size, size_t alignment)
+{
+    GP_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    // Blocks are allocated with malloc, which aligns them for any fundamental type, so an
+    // allocation with a larger alignment reserves the padding it may need past the block start.
+    const size_t padding = alignment > MEMORY_ARENA_ALIGNMENT ? alignment : 0;
+    while (_block < _blocks.size())
+    {
+        Block& block = _blocks[_block];
+        const size_t address = (size_t)block.data + _offset;
+        const size_t aligned = (address + alignment - 1) & ~(alignment - 1);
+        const size_t end = aligned - (size_t)block.data + size;
+        if (end <= block.size)
+        {
+            _offset = end;
+            return (void*)aligned;
+        }
+
+        // Move on to the next block, which a rewound scope may have left behind for reuse.
+        ++_block;
+        _offset = 0;
+    }
+
+    Block block;
+    block.size = std::max(_blockSize, size + padding);
+    block.data = (char*)malloc(block.size);
+    if (!block.data)
+    {
+        GP_ERROR("Failed to allocate a block of %u bytes for a memory arena.", (unsigned int)block.size);
+        return NULL;
+    }
+    _blocks.push_back(block);
+    _block = _blocks.size() - 1;
+    const size_t aligned = ((size_t)block.data + alignment - 1) & ~(alignment - 1);
+    _offset = aligned - (size_t)block.data + size;
+    return (void*)aligned;
+}
+
+void MemoryArena::reset()
+{
+    // Coalesce the blocks into one, so the next use of the arena allocates from a single block.
+    if (_blocks.size() > 1)
+    {
+        Block block;
+        block.size = getCapacity();
+        for (size_t i = 0, count = _blocks.size(); i < count; ++i)
+        {
+            free(_blocks[i].data);
+        }
+        _blocks.clear();
+        block.data = (char*)malloc(block.size);
+        if (block.data)
+        {
+            _blocks.push_back(block);
+        }
+    }
+    _block = 0;
+    _offset = 0;
+}
+
+size_t MemoryArena::getUsedSize() const
+{
+    size_t size = _offset;
+    for (size_t i = 0; i < _block && i < _blocks.size(); ++i)
+    {
+        size += _blocks[i].size;
+    }
+    return size;
+}
+
+size_t MemoryArena::getCapacity() const
+{
+    size_t capacity = 0;
+    for (size_t i = 0, count = _blocks.size(); i < count; ++i)
+    {
+        capacity += _blocks[i].size;
+    }
+    return capacity;
+}
+
+MemoryArena* MemoryArena::getFrameArena()
+{
+    return &__frameArena;
+}
+
+MemoryArena* MemoryArena::getScratchArena()
+{
+    if (!__scratchArena)
+    {
+        static thread_local ScratchArenaOwner owner;
+        __scratchArena = new MemoryArena();
+    }
+    return __scratchArena;
+}
+
+void MemoryArena::nextFrame()
+{
+    __frameArena.reset();
+}
+
+}
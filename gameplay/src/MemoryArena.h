@@ -0,0 +1,242 @@
+#ifndef MEMORYARENA_H_
+#define MEMORYARENA_H_
+
+// Size of the blocks an arena allocates from the heap, unless a single allocation needs more.
+#define MEMORY_ARENA_BLOCK_SIZE (64 * 1024)
+
+// Alignment of the allocations of an arena, enough for any type including SIMD vectors.
+#define MEMORY_ARENA_ALIGNMENT 16
+
+namespace gameplay
+{
+
+/**
+ * Defines a linear allocator for transient memory.
+ *
+ * An arena hands out memory by moving an offset through blocks that it allocates from the
+ * heap, and frees nothing until it is reset or rewound, at which point all of its memory is
+ * available again without returning any of it to the heap. Once an arena has grown to the
+ * size a frame needs, allocating from it costs a few instructions and never locks.
+ *
+ * The frame arena is for allocations that live until the end of the frame. It belongs to the
+ * main thread and Game resets it at the start of every frame. Each thread also has a scratch
+ * arena for allocations that live within a function, which a MemoryArena::Scope rewinds to
+ * where it was when the scope ends.
+ *
+ * Objects in an arena are never destroyed by it, so it should only hold trivially destructible
+ * data, or containers using a MemoryArenaAllocator that are themselves destroyed in time.
+ *
+ * @script{ignore}
+ */
+class MemoryArena
+{
+    friend class Game;
+
+public:
+
+    /**
+     * Rewinds an arena to where it was when the scope started, once the scope ends.
+     *
+     * Scopes of an arena must end in the reverse order they started in, which is the case for
+     * scopes declared as local variables.
+     */
+    class Scope
+    {
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param arena The arena to rewind at the end of the scope.
+         */
+        explicit Scope(MemoryArena* arena);
+
+        /**
+         * Destructor, which rewinds the arena.
+         */
+        ~Scope();
+
+    private:
+
+        Scope(const Scope&);
+        Scope& operator=(const Scope&);
+
+        MemoryArena* _arena;
+        size_t _block;
+        size_t _offset;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param blockSize The size of the blocks to allocate from the heap.
+     */
+    explicit MemoryArena(size_t blockSize = MEMORY_ARENA_BLOCK_SIZE);
+
+    /**
+     * Destructor, which frees all of the blocks of the arena.
+     */
+    ~MemoryArena();
+
+    /**
+     * Allocates memory from the arena.
+     *
+     * @param size The number of bytes to allocate.
+     * @param alignment The alignment of the memory, which must be a power of two.
+     *
+     * @return The memory, which is valid until the arena is reset or rewound past it.
+     */
+    void* allocate(size_t size, size_t alignment = MEMORY_ARENA_ALIGNMENT);
+
+    /**
+     * Makes all of the memory of the arena available again.
+     *
+     * If the last use of the arena needed more than one block, the blocks are replaced by a
+     * single one large enough for all of them, so that the next use allocates from one block.
+     */
+    void reset();
+
+    /**
+     * Gets the number of bytes allocated from the arena since it was last reset.
+     *
+     * @return The number of bytes in use, including alignment padding.
+     */
+    size_t getUsedSize() const;
+
+    /**
+     * Gets the number of bytes the arena holds from the heap.
+     *
+     * @return The total size of the blocks of the arena.
+     */
+    size_t getCapacity() const;
+
+    /**
+     * Gets the arena for allocations that live until the end of the current frame.
+     *
+     * It must only be used by the main thread.
+     *
+     * @return The frame arena.
+     */
+    static MemoryArena* getFrameArena();
+
+    /**
+     * Gets the scratch arena of the calling thread.
+     *
+     * Allocations from it should be made within a MemoryArena::Scope, so that they are
+     * released when the function making them returns.
+     *
+     * @return The scratch arena of the thread.
+     */
+    static MemoryArena* getScratchArena();
+
+private:
+
+    struct Block
+    {
+        char* data;
+        size_t size;
+    };
+
+    MemoryArena(const MemoryArena&);
+    MemoryArena& operator=(const MemoryArena&);
+
+    /**
+     * Resets the frame arena.
+     *
+     * Called by Game at the start of every frame.
+     */
+    static void nextFrame();
+
+    std::vector<Block> _blocks;
+    size_t _block;
+    size_t _offset;
+    size_t _blockSize;
+};
+
+/**
+ * Defines an STL allocator that allocates from a MemoryArena.
+ *
+ * Deallocating does nothing, since the memory returns to the arena when it is reset or
+ * rewound, so a container using one must be destroyed before that happens. Reserving the
+ * capacity a container needs avoids leaving its smaller buffers behind in the arena.
+ *
+ * @script{ignore}
+ */
+template <typename T>
+class MemoryArenaAllocator
+{
+public:
+
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef MemoryArenaAllocator<U> other;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param arena The arena to allocate from.
+     */
+    MemoryArenaAllocator(MemoryArena* arena);
+
+    /**
+     * Constructor, from an allocator of another type using the same arena.
+     */
+    template <typename U>
+    MemoryArenaAllocator(const MemoryArenaAllocator<U>& other);
+
+    /**
+     * Allocates memory for count objects from the arena.
+     */
+    T* allocate(size_t count, const void* hint = 0);
+
+    /**
+     * Does nothing, since the memory is released with the arena.
+     */
+    void deallocate(T* p, size_t count);
+
+    /**
+     * Gets the maximum number of objects that can be allocated at once.
+     */
+    size_t max_size() const;
+
+    /**
+     * Constructs an object in allocated memory.
+     */
+    void construct(T* p, const T& value);
+
+    /**
+     * Destroys an object without releasing its memory.
+     */
+    void destroy(T* p);
+
+    /**
+     * Gets the arena of the allocator.
+     */
+    MemoryArena* getArena() const;
+
+private:
+
+    MemoryArena* _arena;
+};
+
+template <typename T, typename U>
+inline bool operator==(const MemoryArenaAllocator<T>& a, const MemoryArenaAllocator<U>& b);
+
+template <typename T, typename U>
+inline bool operator!=(const MemoryArenaAllocator<T>& a, const MemoryArenaAllocator<U>& b);
+
+}
+
+#include "MemoryArena.inl"
+
+#endif
@@ -0,0 +1,67 @@
+#include "MemoryArena.h"
+
+namespace gameplay
+{
+
+template <typename T>
+MemoryArenaAllocator<T>::MemoryArenaAllocator(MemoryArena* arena)
+    : _arena(arena)
+{
+    GP_ASSERT(arena);
+}
+
+template <typename T>
+template <typename U>
+MemoryArenaAllocator<T>::MemoryArenaAllocator(const MemoryArenaAllocator<U>& other)
+    : _arena(other.getArena())
+{
+}
+
+template <typename T>
+T* MemoryArenaAllocator<T>::allocate(size_t count, const void* hint)
+{
+    return static_cast<T*>(_arena->allocate(count * sizeof(T)));
+}
+
+template <typename T>
+void MemoryArenaAllocator<T>::deallocate(T* p, size_t count)
+{
+}
+
+template <typename T>
+size_t MemoryArenaAllocator<T>::max_size() const
+{
+    return ((size_t)-1) / sizeof(T);
+}
+
+template <typename T>
+void MemoryArenaAllocator<T>::construct(T* p, const T& value)
+{
+    new(p) T(value);
+}
+
+template <typename T>
+void MemoryArenaAllocator<T>::destroy(T* p)
+{
+    p->~T();
+}
+
+template <typename T>
+MemoryArena* MemoryArenaAllocator<T>::getArena() const
+{
+    return _arena;
+}
+
+template <typename T, typename U>
+inline bool operator==(const MemoryArenaAllocator<T>& a, const MemoryArenaAllocator<U>& b)
+{
+    return a.getArena() == b.getArena();
+}
+
+template <typename T, typename U>
+inline bool operator!=(const MemoryArenaAllocator<T>& a, const MemoryArenaAllocator<U>& b)
+{
+    return a.getArena() != b.getArena();
+}
+
+}
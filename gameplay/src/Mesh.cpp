@@ -4,14 +4,20 @@
 #include "Effect.h"
 #include "Model.h"
 #include "Material.h"
+#include "GLStateCache.h"
+#include "FrameCapture.h"
 
 namespace gameplay
 {
 
+static unsigned int __meshCount = 0;
+static size_t __vertexMemorySize = 0;
+
 Mesh::Mesh(const VertexFormat& vertexFormat) 
     : _vertexFormat(vertexFormat), _vertexCount(0), _vertexBuffer(0), _primitiveType(TRIANGLES), 
       _partCount(0), _parts(NULL), _dynamic(false)
 {
+    ++__meshCount;
 }
 
 Mesh::~Mesh()
@@ -25,28 +31,66 @@ Mesh::~Mesh()
         SAFE_DELETE_ARRAY(_parts);
     }
 
-    if (_vertexBuffer)
+    if (_vertexRange.page)
+    {
+        MeshBufferPool::free(&_vertexRange);
+        _vertexBuffer = 0;
+        __vertexMemorySize -= (size_t)_vertexFormat.getVertexSize() * _vertexCount;
+    }
+    else if (_vertexBuffer)
     {
-        glDeleteBuffers(1, &_vertexBuffer);
+        GLStateCache::deleteBuffer(_vertexBuffer);
         _vertexBuffer = 0;
+        __vertexMemorySize -= (size_t)_vertexFormat.getVertexSize() * _vertexCount;
     }
+    --__meshCount;
+}
+
+bool Mesh::isDestroyedOnMainThread() const
+{
+    return true;
 }
 
 Mesh* Mesh::createMesh(const VertexFormat& vertexFormat, unsigned int vertexCount, bool dynamic)
 {
     GLuint vbo;
     GL_ASSERT( glGenBuffers(1, &vbo) );
-    GL_ASSERT( glBindBuffer(GL_ARRAY_BUFFER, vbo) );
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, vbo);
     GL_ASSERT( glBufferData(GL_ARRAY_BUFFER, vertexFormat.getVertexSize() * vertexCount, NULL, dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW) );
 
     Mesh* mesh = new Mesh(vertexFormat);
     mesh->_vertexCount = vertexCount;
     mesh->_vertexBuffer = vbo;
     mesh->_dynamic = dynamic;
+    __vertexMemorySize += (size_t)vertexFormat.getVertexSize() * vertexCount;
+
+    return mesh;
+}
+
+Mesh* Mesh::createUploadedMesh(const VertexFormat& vertexFormat, unsigned int vertexCount, VertexBufferHandle vertexBuffer)
+{
+    GP_ASSERT(vertexBuffer);
+
+    Mesh* mesh = new Mesh(vertexFormat);
+    mesh->_vertexCount = vertexCount;
+    mesh->_vertexBuffer = vertexBuffer;
+    __vertexMemorySize += (size_t)vertexFormat.getVertexSize() * vertexCount;
 
     return mesh;
 }
 
+Mesh* Mesh::createPooledMesh(const VertexFormat& vertexFormat, unsigned int vertexCount, const MeshBufferPool::Range& vertexRange)
+{
+    GP_ASSERT(vertexRange.page);
+
+    Mesh* mesh = new Mesh(vertexFormat);
+    mesh->_vertexCount = vertexCount;
+    mesh->_vertexBuffer = vertexRange.buffer;
+    mesh->_vertexRange = vertexRange;
+    __vertexMemorySize += (size_t)vertexFormat.getVertexSize() * vertexCount;
+
+    return mesh;
+}
 
 Mesh* Mesh::createQuad(float x, float y, float width, float height, float s1, float t1, float s2, float t2)
 {
@@ -246,6 +290,11 @@ VertexBufferHandle Mesh::getVertexBuffer() const
     return _vertexBuffer;
 }
 
+size_t Mesh::getVertexOffset() const
+{
+    return _vertexRange.offset;
+}
+
 bool Mesh::isDynamic() const
 {
     return _dynamic;
@@ -263,9 +312,11 @@ void Mesh::setPrimitiveType(PrimitiveType type)
 
 void* Mesh::mapVertexBuffer()
 {
-    GL_ASSERT( glBindBuffer(GL_ARRAY_BUFFER, _vertexBuffer) );
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, _vertexBuffer);
 
-    return (void*)glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
+    // A pooled mesh maps the whole page, of which only its own vertices may be written.
+    unsigned char* data = (unsigned char*)glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
+    return data ? data + _vertexRange.offset : NULL;
 }
 
 bool Mesh::unmapVertexBuffer()
@@ -275,11 +326,13 @@ bool Mesh::unmapVertexBuffer()
 
 void Mesh::setVertexData(const void* vertexData, unsigned int vertexStart, unsigned int vertexCount)
 {
-    GL_ASSERT( glBindBuffer(GL_ARRAY_BUFFER, _vertexBuffer) );
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, _vertexBuffer);
 
-    if (vertexStart == 0 && vertexCount == 0)
+    // The vertices of a pooled mesh are a range of a shared buffer, which must not be reallocated.
+    if (vertexStart == 0 && vertexCount == 0 && !_vertexRange.page)
     {
         GL_ASSERT( glBufferData(GL_ARRAY_BUFFER, _vertexFormat.getVertexSize() * _vertexCount, vertexData, _dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW) );
+        FrameCapture::record(FrameCapture::UPLOAD_BUFFER, GL_ARRAY_BUFFER, _vertexBuffer, 0, _vertexFormat.getVertexSize() * _vertexCount);
     }
     else
     {
@@ -288,7 +341,8 @@ void Mesh::setVertexData(const void* vertexData, unsigned int vertexStart, unsig
             vertexCount = _vertexCount - vertexStart;
         }
 
-        GL_ASSERT( glBufferSubData(GL_ARRAY_BUFFER, vertexStart * _vertexFormat.getVertexSize(), vertexCount * _vertexFormat.getVertexSize(), vertexData) );
+        GL_ASSERT( glBufferSubData(GL_ARRAY_BUFFER, _vertexRange.offset + vertexStart * _vertexFormat.getVertexSize(), vertexCount * _vertexFormat.getVertexSize(), vertexData) );
+        FrameCapture::record(FrameCapture::UPLOAD_BUFFER, GL_ARRAY_BUFFER, _vertexBuffer, 0, vertexCount * _vertexFormat.getVertexSize());
     }
 }
 
@@ -296,25 +350,52 @@ MeshPart* Mesh::addPart(PrimitiveType primitiveType, IndexFormat indexFormat, un
 {
     MeshPart* part = MeshPart::create(this, _partCount, primitiveType, indexFormat, indexCount, dynamic);
     if (part)
-    {
-        // Increase size of part array and copy old subets into it.
-        MeshPart** oldParts = _parts;
-        _parts = new MeshPart*[_partCount + 1];
-        for (unsigned int i = 0; i < _partCount; ++i)
-        {
-            _parts[i] = oldParts[i];
-        }
+        appendPart(part);
 
-        // Add new part to array.
-        _parts[_partCount++] = part;
+    return part;
+}
 
-        // Delete old part array.
-        SAFE_DELETE_ARRAY(oldParts);
-    }
+MeshPart* Mesh::addUploadedPart(PrimitiveType primitiveType, IndexFormat indexFormat, unsigned int indexCount, IndexBufferHandle indexBuffer)
+{
+    MeshPart* part = MeshPart::createUploaded(this, _partCount, primitiveType, indexFormat, indexCount, indexBuffer);
+    appendPart(part);
+
+    return part;
+}
+
+MeshPart* Mesh::addPooledPart(PrimitiveType primitiveType, IndexFormat indexFormat, unsigned int indexCount, const MeshBufferPool::Range& indexRange)
+{
+    MeshPart* part = MeshPart::createPooled(this, _partCount, primitiveType, indexFormat, indexCount, indexRange);
+    appendPart(part);
+
+    return part;
+}
+
+MeshPart* Mesh::addSharedPart(PrimitiveType primitiveType, IndexFormat indexFormat, unsigned int indexCount, IndexBufferHandle indexBuffer)
+{
+    MeshPart* part = MeshPart::createShared(this, _partCount, primitiveType, indexFormat, indexCount, indexBuffer);
+    appendPart(part);
 
     return part;
 }
 
+void Mesh::appendPart(MeshPart* part)
+{
+    // Increase size of part array and copy old subets into it.
+    MeshPart** oldParts = _parts;
+    _parts = new MeshPart*[_partCount + 1];
+    for (unsigned int i = 0; i < _partCount; ++i)
+    {
+        _parts[i] = oldParts[i];
+    }
+
+    // Add new part to array.
+    _parts[_partCount++] = part;
+
+    // Delete old part array.
+    SAFE_DELETE_ARRAY(oldParts);
+}
+
 unsigned int Mesh::getPartCount() const
 {
     return _partCount;
@@ -326,6 +407,16 @@ MeshPart* Mesh::getPart(unsigned int index)
     return _parts[index];
 }
 
+unsigned int Mesh::getMeshCount()
+{
+    return __meshCount;
+}
+
+size_t Mesh::getTotalMemorySize()
+{
+    return __vertexMemorySize + MeshPart::getTotalMemorySize();
+}
+
 const BoundingBox& Mesh::getBoundingBox() const
 {
     return _boundingBox;
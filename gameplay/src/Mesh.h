@@ -6,6 +6,7 @@
 #include "Vector3.h"
 #include "BoundingBox.h"
 #include "BoundingSphere.h"
+#include "MeshBufferPool.h"
 
 namespace gameplay
 {
@@ -22,6 +23,7 @@ class Mesh : public Ref
 {
     friend class Model;
     friend class Bundle;
+    friend class ResourceManager;
 
 public:
 
@@ -170,6 +172,16 @@ public:
      */
     VertexBufferHandle getVertexBuffer() const;
 
+    /**
+     * Returns the offset of the first vertex of the mesh in its vertex buffer, in bytes.
+     *
+     * This is zero unless the vertex buffer is shared with other meshes, as it is for
+     * meshes loaded from bundles, whose vertices are pooled by vertex format.
+     *
+     * @return The offset of the vertices in the vertex buffer.
+     */
+    size_t getVertexOffset() const;
+
     /**
      * Determines if the mesh is dynamic.
      *
@@ -253,6 +265,22 @@ public:
      */
     MeshPart* addPart(PrimitiveType primitiveType, Mesh::IndexFormat indexFormat, unsigned int indexCount, bool dynamic = false);
 
+    /**
+     * Adds a new part that connects the vertices with the indices of an existing index buffer.
+     *
+     * The part does not own the index buffer, so that meshes whose vertices are laid out alike
+     * can share their index buffers. The index buffer must outlive the mesh.
+     *
+     * @param primitiveType The type of primitive data to connect the indices as.
+     * @param indexFormat The format of the indices. SHORT or INT.
+     * @param indexCount The number of indices in the index buffer.
+     * @param indexBuffer The index buffer to draw the part with.
+     *
+     * @return The newly created/added mesh part.
+     * @script{ignore}
+     */
+    MeshPart* addSharedPart(PrimitiveType primitiveType, Mesh::IndexFormat indexFormat, unsigned int indexCount, IndexBufferHandle indexBuffer);
+
     /**
      * Gets the number of mesh parts contained within the mesh.
      *
@@ -332,6 +360,11 @@ public:
      */
     virtual ~Mesh();
 
+    /**
+     * @see Ref::isDestroyedOnMainThread
+     */
+    bool isDestroyedOnMainThread() const;
+
 private:
 
     /**
@@ -349,10 +382,47 @@ private:
      */
     Mesh& operator=(const Mesh&);
 
+    /**
+     * Appends a part to the parts of the mesh.
+     */
+    void appendPart(MeshPart* part);
+
+    /**
+     * Creates a static mesh that takes ownership of a vertex buffer already filled with its vertices,
+     * such as one uploaded on the upload thread.
+     */
+    static Mesh* createUploadedMesh(const VertexFormat& vertexFormat, unsigned int vertexCount, VertexBufferHandle vertexBuffer);
+
+    /**
+     * Adds a static part that takes ownership of an index buffer already filled with its indices.
+     */
+    MeshPart* addUploadedPart(PrimitiveType primitiveType, Mesh::IndexFormat indexFormat, unsigned int indexCount, IndexBufferHandle indexBuffer);
+
+    /**
+     * Creates a static mesh that takes ownership of a range of a MeshBufferPool page already filled with its vertices.
+     */
+    static Mesh* createPooledMesh(const VertexFormat& vertexFormat, unsigned int vertexCount, const MeshBufferPool::Range& vertexRange);
+
+    /**
+     * Adds a static part that takes ownership of a range of a MeshBufferPool page already filled with its indices.
+     */
+    MeshPart* addPooledPart(PrimitiveType primitiveType, Mesh::IndexFormat indexFormat, unsigned int indexCount, const MeshBufferPool::Range& indexRange);
+
+    /**
+     * Gets the number of meshes.
+     */
+    static unsigned int getMeshCount();
+
+    /**
+     * Gets the number of bytes of the vertex and index buffers owned by all meshes.
+     */
+    static size_t getTotalMemorySize();
+
     std::string _url;
     const VertexFormat _vertexFormat;
     unsigned int _vertexCount;
     VertexBufferHandle _vertexBuffer;
+    MeshBufferPool::Range _vertexRange;
     PrimitiveType _primitiveType;
     unsigned int _partCount;
     MeshPart** _parts;
@@ -1,13 +1,17 @@
 #include "Base.h"
 #include "MeshBatch.h"
 #include "Material.h"
+#include "FrameStats.h"
+#include "FrameCapture.h"
+#include "GLStateCache.h"
+#include "DynamicBuffer.h"
 
 namespace gameplay
 {
 
 MeshBatch::MeshBatch(const VertexFormat& vertexFormat, Mesh::PrimitiveType primitiveType, Material* material, bool indexed, unsigned int initialCapacity, unsigned int growSize)
     : _vertexFormat(vertexFormat), _primitiveType(primitiveType), _material(material), _indexed(indexed), _capacity(0), _growSize(growSize),
-    _vertexCapacity(0), _indexCapacity(0), _vertexCount(0), _indexCount(0), _vertices(NULL), _verticesPtr(NULL), _indices(NULL), _indicesPtr(NULL), _started(false)
+    _vertexCapacity(0), _indexCapacity(0), _vertexCount(0), _indexCount(0), _vertices(NULL), _verticesPtr(NULL), _indexFormat(Mesh::INDEX16), _indices(NULL), _started(false)
 {
     resize(initialCapacity);
 }
@@ -17,6 +21,10 @@ MeshBatch::~MeshBatch()
     SAFE_RELEASE(_material);
     SAFE_DELETE_ARRAY(_vertices);
     SAFE_DELETE_ARRAY(_indices);
+    for (size_t i = 0, count = _segments.size(); i < count; ++i)
+    {
+        SAFE_DELETE(_segments[i]);
+    }
 }
 
 MeshBatch* MeshBatch::create(const VertexFormat& vertexFormat, Mesh::PrimitiveType primitiveType, const char* materialPath, bool indexed, unsigned int initialCapacity, unsigned int growSize)
@@ -44,6 +52,12 @@ MeshBatch* MeshBatch::create(const VertexFormat& vertexFormat, Mesh::PrimitiveTy
 }
 
 void MeshBatch::add(const void* vertices, size_t size, unsigned int vertexCount, const unsigned short* indices, unsigned int indexCount)
+{
+    addPrimitives(vertices, vertexCount, indices, indexCount);
+}
+
+template <class I>
+void MeshBatch::addPrimitives(const void* vertices, unsigned int vertexCount, const I* indices, unsigned int indexCount)
 {
     GP_ASSERT(vertices);
     
@@ -53,13 +67,8 @@ void MeshBatch::add(const void* vertices, size_t size, unsigned int vertexCount,
         newIndexCount += 2; // need an extra 2 indices for connecting strips with degenerate triangles
     
     // Do we need to grow the batch?
-    while (newVertexCount > _vertexCapacity || (_indexed && newIndexCount > _indexCapacity))
-    {
-        if (_growSize == 0)
-            return; // growing disabled, just clip batch
-        if (!resize(_capacity + _growSize))
-            return; // failed to grow
-    }
+    if (!reserve(newVertexCount, newIndexCount))
+        return;
     
     // Copy vertex data.
     GP_ASSERT(_verticesPtr);
@@ -70,32 +79,51 @@ void MeshBatch::add(const void* vertices, size_t size, unsigned int vertexCount,
     if (_indexed)
     {
         GP_ASSERT(indices);
-        GP_ASSERT(_indicesPtr);
+        GP_ASSERT(_indices);
 
-        if (_vertexCount == 0)
+        unsigned int position = _indexCount;
+        if (_primitiveType == Mesh::TRIANGLE_STRIP && _vertexCount > 0)
         {
-            // Simply copy values directly into the start of the index array.
-            memcpy(_indicesPtr, indices, indexCount * sizeof(unsigned short));
+            // Create a degenerate triangle to connect separate triangle strips
+            // by duplicating the previous and next vertices.
+            if (_indexFormat == Mesh::INDEX32)
+            {
+                unsigned int* dst = (unsigned int*)_indices + position;
+                dst[0] = dst[-1];
+                dst[1] = _vertexCount;
+            }
+            else
+            {
+                unsigned short* dst = (unsigned short*)_indices + position;
+                dst[0] = dst[-1];
+                dst[1] = (unsigned short)_vertexCount;
+            }
+            position += 2;
         }
-        else
+
+        // Insert the indices with their values offset by 'vertexCount' so that
+        // they are relative to the first newly inserted vertex.
+        if (_indexFormat == Mesh::INDEX32)
         {
-            if (_primitiveType == Mesh::TRIANGLE_STRIP)
+            unsigned int* dst = (unsigned int*)_indices + position;
+            for (unsigned int i = 0; i < indexCount; ++i)
             {
-                // Create a degenerate triangle to connect separate triangle strips
-                // by duplicating the previous and next vertices.
-                _indicesPtr[0] = *(_indicesPtr-1);
-                _indicesPtr[1] = _vertexCount;
-                _indicesPtr += 2;
+                dst[i] = (unsigned int)indices[i] + _vertexCount;
             }
-            
-            // Loop through all indices and insert them, with their values offset by
-            // 'vertexCount' so that they are relative to the first newly inserted vertex.
+        }
+        else if (_vertexCount == 0 && sizeof(I) == sizeof(unsigned short))
+        {
+            // Simply copy values directly into the start of the index array.
+            memcpy(_indices, indices, indexCount * sizeof(unsigned short));
+        }
+        else
+        {
+            unsigned short* dst = (unsigned short*)_indices + position;
             for (unsigned int i = 0; i < indexCount; ++i)
             {
-                _indicesPtr[i] = indices[i] + _vertexCount;
+                dst[i] = (unsigned short)(indices[i] + _vertexCount);
             }
         }
-        _indicesPtr += indexCount;
         _indexCount = newIndexCount;
     }
     
@@ -103,6 +131,25 @@ void MeshBatch::add(const void* vertices, size_t size, unsigned int vertexCount,
     _vertexCount = newVertexCount;
 }
 
+bool MeshBatch::reserve(unsigned int vertexCount, unsigned int indexCount)
+{
+    if (vertexCount <= _vertexCapacity && (!_indexed || indexCount <= _indexCapacity))
+        return true;
+    if (_growSize == 0)
+        return false; // growing disabled, just clip batch
+
+    // Grow once by as many steps as needed, rather than reallocating for every step.
+    unsigned int capacity = _capacity;
+    unsigned int vertexCapacity;
+    do
+    {
+        capacity += _growSize;
+        vertexCapacity = computeVertexCapacity(capacity);
+    } while (vertexCount > vertexCapacity || (_indexed && indexCount > vertexCapacity));
+
+    return resize(capacity);
+}
+
 void MeshBatch::updateVertexAttributeBinding()
 {
     GP_ASSERT(_material);
@@ -133,6 +180,25 @@ void MeshBatch::setCapacity(unsigned int capacity)
     resize(capacity);
 }
 
+unsigned int MeshBatch::computeVertexCapacity(unsigned int capacity) const
+{
+    switch (_primitiveType)
+    {
+    case Mesh::LINES:
+        return capacity * 2;
+    case Mesh::LINE_STRIP:
+        return capacity + 1;
+    case Mesh::POINTS:
+        return capacity;
+    case Mesh::TRIANGLES:
+        return capacity * 3;
+    case Mesh::TRIANGLE_STRIP:
+        return capacity + 2;
+    default:
+        return 0;
+    }
+}
+
 bool MeshBatch::resize(unsigned int capacity)
 {
     if (capacity == 0)
@@ -146,27 +212,12 @@ bool MeshBatch::resize(unsigned int capacity)
 
     // Store old batch data.
     unsigned char* oldVertices = _vertices;
-    unsigned short* oldIndices = _indices;
+    unsigned char* oldIndices = _indices;
+    Mesh::IndexFormat oldIndexFormat = _indexFormat;
 
-    unsigned int vertexCapacity = 0;
-    switch (_primitiveType)
+    unsigned int vertexCapacity = computeVertexCapacity(capacity);
+    if (vertexCapacity == 0)
     {
-    case Mesh::LINES:
-        vertexCapacity = capacity * 2;
-        break;
-    case Mesh::LINE_STRIP:
-        vertexCapacity = capacity + 1;
-        break;
-    case Mesh::POINTS:
-        vertexCapacity = capacity;
-        break;
-    case Mesh::TRIANGLES:
-        vertexCapacity = capacity * 3;
-        break;
-    case Mesh::TRIANGLE_STRIP:
-        vertexCapacity = capacity + 2;
-        break;
-    default:
         GP_ERROR("Unsupported primitive type for mesh batch (%d).", _primitiveType);
         return false;
     }
@@ -174,28 +225,22 @@ bool MeshBatch::resize(unsigned int capacity)
     // We have no way of knowing how many vertices will be stored in the batch
     // (we only know how many indices will be stored). Assume the worst case
     // for now, which is the same number of vertices as indices.
+    // Indices switch to 32-bit once they can address more vertices than 16 bits can.
     unsigned int indexCapacity = vertexCapacity;
-    if (_indexed && indexCapacity > USHRT_MAX)
-    {
-        GP_ERROR("Index capacity is greater than the maximum unsigned short value (%d > %d).", indexCapacity, USHRT_MAX);
-        return false;
-    }
+    Mesh::IndexFormat indexFormat = vertexCapacity > USHRT_MAX + 1 ? Mesh::INDEX32 : Mesh::INDEX16;
+    unsigned int indexSize = indexFormat == Mesh::INDEX32 ? sizeof(unsigned int) : sizeof(unsigned short);
 
-    // Allocate new data and reset pointers.
-    unsigned int voffset = _verticesPtr - _vertices;
+    // Allocate new data and clip the batch to the new capacity.
+    _vertexCount = std::min(_vertexCount, vertexCapacity);
+    _indexCount = std::min(_indexCount, indexCapacity);
     unsigned int vBytes = vertexCapacity * _vertexFormat.getVertexSize();
     _vertices = new unsigned char[vBytes];
-    if (voffset >= vBytes)
-        voffset = vBytes - 1;
-    _verticesPtr = _vertices + voffset;
+    _verticesPtr = _vertices + _vertexCount * _vertexFormat.getVertexSize();
 
     if (_indexed)
     {
-        unsigned int ioffset = _indicesPtr - _indices;
-        _indices = new unsigned short[indexCapacity];
-        if (ioffset >= indexCapacity)
-            ioffset = indexCapacity - 1;
-        _indicesPtr = _indices + ioffset;
+        _indices = new unsigned char[indexCapacity * indexSize];
+        _indexFormat = indexFormat;
     }
 
     // Copy old data back in
@@ -203,7 +248,24 @@ bool MeshBatch::resize(unsigned int capacity)
         memcpy(_vertices, oldVertices, std::min(_vertexCapacity, vertexCapacity) * _vertexFormat.getVertexSize());
     SAFE_DELETE_ARRAY(oldVertices);
     if (oldIndices)
-        memcpy(_indices, oldIndices, std::min(_indexCapacity, indexCapacity) * sizeof(unsigned short));
+    {
+        unsigned int count = std::min(_indexCapacity, indexCapacity);
+        if (oldIndexFormat == _indexFormat)
+        {
+            memcpy(_indices, oldIndices, count * indexSize);
+        }
+        else if (_indexFormat == Mesh::INDEX32)
+        {
+            for (unsigned int i = 0; i < count; ++i)
+                ((unsigned int*)_indices)[i] = ((unsigned short*)oldIndices)[i];
+        }
+        else
+        {
+            // Indices of vertices clipped by the smaller capacity are clamped.
+            for (unsigned int i = 0; i < count; ++i)
+                ((unsigned short*)_indices)[i] = (unsigned short)std::min(((unsigned int*)oldIndices)[i], (unsigned int)USHRT_MAX);
+        }
+    }
     SAFE_DELETE_ARRAY(oldIndices);
 
     // Assign new capacities
@@ -222,12 +284,39 @@ void MeshBatch::add(const float* vertices, unsigned int vertexCount, const unsig
     add(vertices, sizeof(float), vertexCount, indices, indexCount);
 }
 
+void MeshBatch::setSegmentCount(unsigned int count)
+{
+    while (_segments.size() > count)
+    {
+        SAFE_DELETE(_segments.back());
+        _segments.pop_back();
+    }
+    while (_segments.size() < count)
+    {
+        _segments.push_back(new Segment(this));
+    }
+}
+
+unsigned int MeshBatch::getSegmentCount() const
+{
+    return (unsigned int)_segments.size();
+}
+
+MeshBatch::Segment* MeshBatch::getSegment(unsigned int index) const
+{
+    GP_ASSERT(index < _segments.size());
+    return _segments[index];
+}
+
 void MeshBatch::start()
 {
     _vertexCount = 0;
     _indexCount = 0;
     _verticesPtr = _vertices;
-    _indicesPtr = _indices;
+    for (size_t i = 0, count = _segments.size(); i < count; ++i)
+    {
+        _segments[i]->clear();
+    }
     _started = true;
 }
 
@@ -238,6 +327,33 @@ bool MeshBatch::isStarted() const
 
 void MeshBatch::finish()
 {
+    // Merge the segments in order, growing the batch once for all of them.
+    unsigned int vertexCount = _vertexCount;
+    unsigned int indexCount = _indexCount;
+    for (size_t i = 0, count = _segments.size(); i < count; ++i)
+    {
+        const Segment* segment = _segments[i];
+        if (segment->_vertexCount > 0)
+        {
+            if (_primitiveType == Mesh::TRIANGLE_STRIP && vertexCount > 0)
+                indexCount += 2;
+            vertexCount += segment->_vertexCount;
+            indexCount += (unsigned int)segment->_indices.size();
+        }
+    }
+    if (vertexCount > _vertexCount)
+        reserve(vertexCount, indexCount);
+
+    for (size_t i = 0, count = _segments.size(); i < count; ++i)
+    {
+        Segment* segment = _segments[i];
+        if (segment->_vertexCount > 0)
+        {
+            addPrimitives(&segment->_vertices[0], segment->_vertexCount, segment->_indices.empty() ? NULL : &segment->_indices[0], (unsigned int)segment->_indices.size());
+        }
+        segment->clear();
+    }
+
     _started = false;
 }
 
@@ -246,13 +362,23 @@ void MeshBatch::draw()
     if (_vertexCount == 0 || (_indexed && _indexCount == 0))
         return; // nothing to draw
 
-    // Not using VBOs, so unbind the element array buffer.
-    // ARRAY_BUFFER will be unbound automatically during pass->bind().
-    GL_ASSERT( glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0 ) );
-
     GP_ASSERT(_material);
     if (_indexed)
         GP_ASSERT(_indices);
+    FrameCapture::Source source(NULL, _material);
+
+    // Stream the geometry into the dynamic buffers, so the draws below do not copy it from client memory.
+    // If the rings of this frame are full, the client arrays are drawn from as before.
+    GLuint vertexBuffer = 0;
+    GLuint indexBuffer = 0;
+    size_t vertexOffset = 0;
+    size_t indexOffset = 0;
+    if (!DynamicBuffer::upload(GL_ARRAY_BUFFER, _vertices, _vertexCount * _vertexFormat.getVertexSize(), &vertexBuffer, &vertexOffset) ||
+        (_indexed && !DynamicBuffer::upload(GL_ELEMENT_ARRAY_BUFFER, _indices, _indexCount * (_indexFormat == Mesh::INDEX32 ? sizeof(unsigned int) : sizeof(unsigned short)), &indexBuffer, &indexOffset)))
+    {
+        vertexBuffer = 0;
+        indexBuffer = 0;
+    }
 
     // Bind the material.
     Technique* technique = _material->getTechnique();
@@ -262,20 +388,80 @@ void MeshBatch::draw()
     {
         Pass* pass = technique->getPassByIndex(i);
         GP_ASSERT(pass);
+        VertexAttributeBinding* binding = pass->getVertexAttributeBinding();
+        if (binding)
+            binding->setVertexBuffer(vertexBuffer, vertexOffset);
         pass->bind();
 
+        // The vertex buffer is bound during pass->bind(), the index buffer is bound here
+        // (to 0 when drawing from client memory).
+        GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+
         if (_indexed)
         {
-            GL_ASSERT( glDrawElements(_primitiveType, _indexCount, GL_UNSIGNED_SHORT, (GLvoid*)_indices) );
+            const GLvoid* indices = indexBuffer ? (const GLvoid*)indexOffset : (const GLvoid*)_indices;
+            GL_ASSERT( glDrawElements(_primitiveType, _indexCount, (GLenum)_indexFormat, indices) );
+            FrameStats::recordDraw(_primitiveType, _indexCount);
         }
         else
         {
             GL_ASSERT( glDrawArrays(_primitiveType, 0, _vertexCount) );
+            FrameStats::recordDraw(_primitiveType, _vertexCount);
         }
 
         pass->unbind();
     }
 }
+
+MeshBatch::Segment::Segment(const MeshBatch* batch)
+    : _batch(batch), _vertexCount(0)
+{
+}
+
+void MeshBatch::Segment::add(const float* vertices, unsigned int vertexCount, const unsigned short* indices, unsigned int indexCount)
+{
+    add((const void*)vertices, vertexCount, indices, indexCount);
+}
+
+void MeshBatch::Segment::add(const void* vertices, unsigned int vertexCount, const unsigned short* indices, unsigned int indexCount)
+{
+    GP_ASSERT(vertices);
+
+    size_t vertexSize = _batch->_vertexFormat.getVertexSize();
+    const unsigned char* src = (const unsigned char*)vertices;
+    _vertices.insert(_vertices.end(), src, src + vertexCount * vertexSize);
+
+    if (_batch->_indexed)
+    {
+        GP_ASSERT(indices);
+
+        // Connect separate triangle strips with a degenerate triangle, as the batch does.
+        if (_batch->_primitiveType == Mesh::TRIANGLE_STRIP && _vertexCount > 0)
+        {
+            unsigned int last = _indices.back();
+            _indices.push_back(last);
+            _indices.push_back(_vertexCount);
+        }
+        for (unsigned int i = 0; i < indexCount; ++i)
+        {
+            _indices.push_back(indices[i] + _vertexCount);
+        }
+    }
+
+    _vertexCount += vertexCount;
+}
+
+unsigned int MeshBatch::Segment::getVertexCount() const
+{
+    return _vertexCount;
+}
+
+void MeshBatch::Segment::clear()
+{
+    _vertices.clear();
+    _indices.clear();
+    _vertexCount = 0;
+}
     
 
 }
@@ -10,11 +10,74 @@ class Material;
 
 /**
  * Defines a class for rendering multiple mesh into a single draw call on the graphics device.
+ *
+ * Indexed batches store 16-bit indices, and switch to 32-bit indices once their capacity
+ * exceeds 65536 vertices (on OpenGL ES this requires the OES_element_index_uint extension).
  */
 class MeshBatch
 {
 public:
 
+    /**
+     * Defines a list of primitives recorded apart from its batch.
+     *
+     * Segments let several threads fill a batch at once: each thread adds primitives to its
+     * own segment, and the segments are merged into the batch, in index order, when the batch
+     * is finished. Segments only hold memory, so they can be filled from job system workers.
+     *
+     * @script{ignore}
+     */
+    class Segment
+    {
+        friend class MeshBatch;
+
+    public:
+
+        /**
+         * Adds a group of primitives to the segment.
+         *
+         * The parameters are the same as those of MeshBatch::add(). The indices are relative
+         * to the vertices passed in, and triangle strips are stitched together like in the batch.
+         *
+         * @param vertices Array of vertices.
+         * @param vertexCount Number of vertices.
+         * @param indices Array of indices into the vertex array (should be NULL for non-indexed batches).
+         * @param indexCount Number of indices (should be zero for non-indexed batches).
+         */
+        template <class T>
+        void add(const T* vertices, unsigned int vertexCount, const unsigned short* indices = NULL, unsigned int indexCount = 0);
+
+        /**
+         * Adds a group of primitives to the segment, from an array of floats.
+         *
+         * @param vertices Array of vertices.
+         * @param vertexCount Number of vertices.
+         * @param indices Array of indices into the vertex array (should be NULL for non-indexed batches).
+         * @param indexCount Number of indices (should be zero for non-indexed batches).
+         */
+        void add(const float* vertices, unsigned int vertexCount, const unsigned short* indices = NULL, unsigned int indexCount = 0);
+
+        /**
+         * Returns the number of vertices added to the segment since the batch was started.
+         *
+         * @return The number of vertices.
+         */
+        unsigned int getVertexCount() const;
+
+    private:
+
+        Segment(const MeshBatch* batch);
+
+        void add(const void* vertices, unsigned int vertexCount, const unsigned short* indices, unsigned int indexCount);
+
+        void clear();
+
+        const MeshBatch* _batch;
+        std::vector<unsigned char> _vertices;
+        std::vector<unsigned int> _indices;
+        unsigned int _vertexCount;
+    };
+
     /**
      * Creates a new mesh batch.
      *
@@ -114,6 +177,33 @@ public:
      */
     void add(const float* vertices, unsigned int vertexCount, const unsigned short* indices = NULL, unsigned int indexCount = 0);
 
+    /**
+     * Sets the number of segments of the batch.
+     *
+     * This must be called before the segments are filled, and not while other threads are
+     * adding primitives to them. Typically the count is the number of threads of the job system.
+     *
+     * @param count The number of segments.
+     */
+    void setSegmentCount(unsigned int count);
+
+    /**
+     * Returns the number of segments of the batch.
+     *
+     * @return The number of segments.
+     */
+    unsigned int getSegmentCount() const;
+
+    /**
+     * Returns a segment of the batch.
+     *
+     * @param index The index of the segment, less than getSegmentCount().
+     *
+     * @return The segment.
+     * @script{ignore}
+     */
+    Segment* getSegment(unsigned int index) const;
+
     /**
      * Starts batching.
      *
@@ -121,8 +211,8 @@ public:
      * After all primitives have been added to the batch, call the finish() method to
      * complete the batch.
      *
-     * Calling this method will clear any primitives currently in the batch and set the
-     * position of the batch back to the beginning.
+     * Calling this method will clear any primitives currently in the batch and its segments,
+     * and set the position of the batch back to the beginning.
      */
     void start();
 
@@ -133,6 +223,8 @@ public:
 
     /**
      * Indicates that batching is complete and prepares the batch for drawing.
+     *
+     * The primitives of the segments are appended to the batch, and the segments cleared.
      */
     void finish();
 
@@ -160,6 +252,13 @@ private:
 
     void add(const void* vertices, size_t size, unsigned int vertexCount, const unsigned short* indices, unsigned int indexCount);
 
+    template <class I>
+    void addPrimitives(const void* vertices, unsigned int vertexCount, const I* indices, unsigned int indexCount);
+
+    bool reserve(unsigned int vertexCount, unsigned int indexCount);
+
+    unsigned int computeVertexCapacity(unsigned int capacity) const;
+
     void updateVertexAttributeBinding();
 
     bool resize(unsigned int capacity);
@@ -176,8 +275,9 @@ private:
     unsigned int _indexCount;
     unsigned char* _vertices;
     unsigned char* _verticesPtr;
-    unsigned short* _indices;
-    unsigned short* _indicesPtr;
+    Mesh::IndexFormat _indexFormat;
+    unsigned char* _indices;
+    std::vector<Segment*> _segments;
     bool _started;
 
 };
@@ -15,4 +15,11 @@ void MeshBatch::add(const T* vertices, unsigned int vertexCount, const unsigned
     add(vertices, sizeof(T), vertexCount, indices, indexCount);
 }
 
+template <class T>
+void MeshBatch::Segment::add(const T* vertices, unsigned int vertexCount, const unsigned short* indices, unsigned int indexCount)
+{
+    GP_ASSERT(sizeof(T) == _batch->_vertexFormat.getVertexSize());
+    add((const void*)vertices, vertexCount, indices, indexCount);
+}
+
 }
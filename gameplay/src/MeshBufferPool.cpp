@@ -0,0 +1,215 @@
+#include "Base.h"
+#include "MeshBufferPool.h"
+#include "GLStateCache.h"
+#include "FrameCapture.h"
+
+// Size of a page of vertices, in bytes.
+#define MESH_BUFFER_POOL_VERTEX_PAGE_SIZE (4 * 1024 * 1024)
+
+// Size of a page of indices, in bytes.
+#define MESH_BUFFER_POOL_INDEX_PAGE_SIZE (1024 * 1024)
+
+// Fraction of a page beyond which geometry keeps buffers of its own, so large meshes do not leave pages mostly empty.
+#define MESH_BUFFER_POOL_MAX_FRACTION 4
+
+// Alignment of the ranges of index pages, suitable for any index format.
+#define MESH_BUFFER_POOL_INDEX_ALIGNMENT 4
+
+namespace gameplay
+{
+
+// A shared buffer, with the free ranges between its allocated ranges in the order of their offsets.
+struct MeshBufferPool::Page
+{
+    GLuint buffer;
+    size_t size;
+    VertexFormat* vertexFormat;
+    std::vector<std::pair<size_t, size_t> > freeRanges;
+    unsigned int rangeCount;
+};
+
+static std::vector<MeshBufferPool::Page*> __pages;
+static std::mutex __pagesMutex;
+static size_t __memorySize = 0;
+
+static void bindBuffer(GLenum target, GLuint buffer, bool uploadThread)
+{
+    // The upload context has no state cache of its own, so its bindings are made directly.
+    if (uploadThread)
+        GL_ASSERT( glBindBuffer(target, buffer) );
+    else
+        GLStateCache::bindBuffer(target, buffer);
+}
+
+MeshBufferPool::Range::Range()
+    : page(NULL), buffer(0), offset(0), size(0)
+{
+}
+
+bool MeshBufferPool::allocateVertices(const VertexFormat& vertexFormat, unsigned int vertexCount, Range* range, bool uploadThread)
+{
+    const size_t vertexSize = vertexFormat.getVertexSize();
+    return allocate(&vertexFormat, vertexSize * vertexCount, vertexSize, range, uploadThread);
+}
+
+bool MeshBufferPool::allocateIndices(size_t size, Range* range, bool uploadThread)
+{
+    return allocate(NULL, size, MESH_BUFFER_POOL_INDEX_ALIGNMENT, range, uploadThread);
+}
+
+bool MeshBufferPool::allocate(const VertexFormat* vertexFormat, size_t size, size_t alignment, Range* range, bool uploadThread)
+{
+    GP_ASSERT(range);
+    GP_ASSERT(alignment > 0);
+
+    // Every range and page is a whole number of alignments, so the free ranges stay aligned as well.
+    size_t pageSize = vertexFormat ? MESH_BUFFER_POOL_VERTEX_PAGE_SIZE : MESH_BUFFER_POOL_INDEX_PAGE_SIZE;
+    pageSize -= pageSize % alignment;
+    const size_t allocationSize = ((size + alignment - 1) / alignment) * alignment;
+    if (allocationSize == 0 || allocationSize > pageSize / MESH_BUFFER_POOL_MAX_FRACTION)
+        return false;
+
+    std::lock_guard<std::mutex> lock(__pagesMutex);
+
+    Page* page = NULL;
+    size_t freeRange = 0;
+    for (size_t i = 0, count = __pages.size(); i < count && page == NULL; ++i)
+    {
+        Page* candidate = __pages[i];
+        if (vertexFormat ? (candidate->vertexFormat == NULL || *candidate->vertexFormat != *vertexFormat) : candidate->vertexFormat != NULL)
+            continue;
+        for (size_t j = 0, freeCount = candidate->freeRanges.size(); j < freeCount; ++j)
+        {
+            if (candidate->freeRanges[j].second >= allocationSize)
+            {
+                page = candidate;
+                freeRange = j;
+                break;
+            }
+        }
+    }
+
+    if (page == NULL)
+    {
+        const GLenum target = vertexFormat ? GL_ARRAY_BUFFER : GL_ELEMENT_ARRAY_BUFFER;
+        GLuint buffer;
+        GL_ASSERT( glGenBuffers(1, &buffer) );
+        bindBuffer(target, buffer, uploadThread);
+        GL_ASSERT( glBufferData(target, pageSize, NULL, GL_STATIC_DRAW) );
+        if (uploadThread)
+            GL_ASSERT( glBindBuffer(target, 0) );
+
+        page = new Page();
+        page->buffer = buffer;
+        page->size = pageSize;
+        page->vertexFormat = vertexFormat ? new VertexFormat(*vertexFormat) : NULL;
+        page->freeRanges.push_back(std::make_pair((size_t)0, pageSize));
+        page->rangeCount = 0;
+        __pages.push_back(page);
+        __memorySize += pageSize;
+        freeRange = 0;
+    }
+
+    std::pair<size_t, size_t>& entry = page->freeRanges[freeRange];
+    range->page = page;
+    range->buffer = page->buffer;
+    range->offset = entry.first;
+    range->size = size;
+    entry.first += allocationSize;
+    entry.second -= allocationSize;
+    if (entry.second == 0)
+        page->freeRanges.erase(page->freeRanges.begin() + freeRange);
+    ++page->rangeCount;
+
+    return true;
+}
+
+void MeshBufferPool::write(GLenum target, const Range& range, const void* data, bool uploadThread)
+{
+    GP_ASSERT(range.page);
+    GP_ASSERT(data);
+
+    bindBuffer(target, range.buffer, uploadThread);
+    GL_ASSERT( glBufferSubData(target, range.offset, range.size, data) );
+    FrameCapture::record(FrameCapture::UPLOAD_BUFFER, target, range.buffer, 0, (unsigned int)range.size);
+    if (uploadThread)
+        GL_ASSERT( glBindBuffer(target, 0) );
+}
+
+void MeshBufferPool::free(Range* range)
+{
+    GP_ASSERT(range);
+    Page* page = range->page;
+    if (page == NULL)
+        return;
+
+    std::lock_guard<std::mutex> lock(__pagesMutex);
+
+    GP_ASSERT(page->rangeCount > 0);
+    if (--page->rangeCount == 0)
+    {
+        // The GPU may still be drawing from the page, which GLStateCache frees once it is done.
+        std::vector<Page*>::iterator itr = std::find(__pages.begin(), __pages.end(), page);
+        GP_ASSERT(itr != __pages.end());
+        __pages.erase(itr);
+        __memorySize -= page->size;
+        GLStateCache::deleteBuffer(page->buffer);
+        SAFE_DELETE(page->vertexFormat);
+        SAFE_DELETE(page);
+    }
+    else
+    {
+        // Return the range to the free ranges, merging it with its neighbours.
+        const size_t alignment = page->vertexFormat ? page->vertexFormat->getVertexSize() : MESH_BUFFER_POOL_INDEX_ALIGNMENT;
+        const size_t start = range->offset;
+        const size_t end = start + ((range->size + alignment - 1) / alignment) * alignment;
+        std::vector<std::pair<size_t, size_t> >& freeRanges = page->freeRanges;
+        size_t i = 0;
+        while (i < freeRanges.size() && freeRanges[i].first < start)
+            ++i;
+        const bool mergePrevious = i > 0 && freeRanges[i - 1].first + freeRanges[i - 1].second == start;
+        const bool mergeNext = i < freeRanges.size() && freeRanges[i].first == end;
+        if (mergePrevious && mergeNext)
+        {
+            freeRanges[i - 1].second += (end - start) + freeRanges[i].second;
+            freeRanges.erase(freeRanges.begin() + i);
+        }
+        else if (mergePrevious)
+        {
+            freeRanges[i - 1].second += end - start;
+        }
+        else if (mergeNext)
+        {
+            freeRanges[i].first = start;
+            freeRanges[i].second += end - start;
+        }
+        else
+        {
+            freeRanges.insert(freeRanges.begin() + i, std::make_pair(start, end - start));
+        }
+    }
+
+    *range = Range();
+}
+
+size_t MeshBufferPool::getMemorySize()
+{
+    std::lock_guard<std::mutex> lock(__pagesMutex);
+    return __memorySize;
+}
+
+void MeshBufferPool::finalize()
+{
+    std::lock_guard<std::mutex> lock(__pagesMutex);
+    for (size_t i = 0, count = __pages.size(); i < count; ++i)
+    {
+        Page* page = __pages[i];
+        GLStateCache::deleteBuffer(page->buffer);
+        SAFE_DELETE(page->vertexFormat);
+        SAFE_DELETE(page);
+    }
+    __pages.clear();
+    __memorySize = 0;
+}
+
+}
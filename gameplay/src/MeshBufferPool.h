@@ -0,0 +1,129 @@
+#ifndef MESHBUFFERPOOL_H_
+#define MESHBUFFERPOOL_H_
+
+#include "VertexFormat.h"
+
+namespace gameplay
+{
+
+/**
+ * Defines the pools of large shared buffers that the static geometry of bundle meshes is
+ * sub-allocated from.
+ *
+ * Each mesh loaded from a bundle used to own a vertex buffer, and each of its parts an index
+ * buffer, so a scene of a few thousand meshes had several thousand buffer objects to bind
+ * between draws. Meshes are instead placed in pages of vertices of the same vertex format,
+ * at a whole number of vertices from the start of the page, and their parts in pages of
+ * indices shared by every format. Geometry that is too large for a page keeps buffers of its
+ * own.
+ *
+ * Ranges are allocated under a lock, so the upload thread can fill new ranges of a page while
+ * the main thread draws from the others. Ranges are freed on the main thread, and a page is
+ * deleted once its last range is freed.
+ *
+ * @script{ignore}
+ */
+class MeshBufferPool
+{
+    friend class Game;
+
+public:
+
+    struct Page;
+
+    /**
+     * Defines a range of a page.
+     */
+    struct Range
+    {
+        /**
+         * Constructor.
+         */
+        Range();
+
+        /**
+         * The page of the range, or NULL if the range is not allocated.
+         */
+        Page* page;
+
+        /**
+         * The buffer of the page.
+         */
+        GLuint buffer;
+
+        /**
+         * The offset of the range in the buffer, in bytes.
+         */
+        size_t offset;
+
+        /**
+         * The size of the range in bytes.
+         */
+        size_t size;
+    };
+
+    /**
+     * Allocates a range for the vertices of a mesh.
+     *
+     * @param vertexFormat The vertex format of the mesh.
+     * @param vertexCount The number of vertices.
+     * @param range Set to the allocated range.
+     * @param uploadThread true if called on the upload thread, which binds buffers directly.
+     *
+     * @return true if the range was allocated, false if the vertices do not fit in a page.
+     */
+    static bool allocateVertices(const VertexFormat& vertexFormat, unsigned int vertexCount, Range* range, bool uploadThread = false);
+
+    /**
+     * Allocates a range for the indices of a mesh part.
+     *
+     * @param size The size of the indices in bytes.
+     * @param range Set to the allocated range.
+     * @param uploadThread true if called on the upload thread, which binds buffers directly.
+     *
+     * @return true if the range was allocated, false if the indices do not fit in a page.
+     */
+    static bool allocateIndices(size_t size, Range* range, bool uploadThread = false);
+
+    /**
+     * Copies data into an allocated range.
+     *
+     * @param target The buffer target of the range (GL_ARRAY_BUFFER or GL_ELEMENT_ARRAY_BUFFER).
+     * @param range The range to copy the data into.
+     * @param data The data to copy, of the size of the range.
+     * @param uploadThread true if called on the upload thread, which binds buffers directly.
+     */
+    static void write(GLenum target, const Range& range, const void* data, bool uploadThread = false);
+
+    /**
+     * Frees an allocated range, and resets it.
+     *
+     * @param range The range to free.
+     */
+    static void free(Range* range);
+
+    /**
+     * Gets the number of bytes of the buffers of every page.
+     *
+     * @return The size of the pages in bytes.
+     */
+    static size_t getMemorySize();
+
+private:
+
+    /**
+     * Allocates a range from the pages of a format, creating a page if none has room for it.
+     */
+    static bool allocate(const VertexFormat* vertexFormat, size_t size, size_t alignment, Range* range, bool uploadThread);
+
+    /**
+     * Deletes every page.
+     *
+     * Called by Game at shutdown, while the GL context is still current.
+     */
+    static void finalize();
+};
+
+}
+
+#endif
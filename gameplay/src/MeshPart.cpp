@@ -1,19 +1,45 @@
 #include "Base.h"
 #include "MeshPart.h"
+#include "GLStateCache.h"
+#include "FrameCapture.h"
 
 namespace gameplay
 {
 
+static size_t __indexMemorySize = 0;
+
+// Gets the size of an index of the given format in bytes, or zero if the format is not supported.
+static unsigned int getIndexSize(Mesh::IndexFormat indexFormat)
+{
+    switch (indexFormat)
+    {
+    case Mesh::INDEX8:
+        return 1;
+    case Mesh::INDEX16:
+        return 2;
+    case Mesh::INDEX32:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
 MeshPart::MeshPart() :
-    _mesh(NULL), _meshIndex(0), _primitiveType(Mesh::TRIANGLES), _indexCount(0), _indexBuffer(0), _dynamic(false)
+    _mesh(NULL), _meshIndex(0), _primitiveType(Mesh::TRIANGLES), _indexCount(0), _indexBuffer(0), _dynamic(false), _sharedIndexBuffer(false)
 {
 }
 
 MeshPart::~MeshPart()
 {
-    if (_indexBuffer)
+    if (_indexRange.page)
+    {
+        MeshBufferPool::free(&_indexRange);
+        __indexMemorySize -= (size_t)getIndexSize(_indexFormat) * _indexCount;
+    }
+    else if (_indexBuffer && !_sharedIndexBuffer)
     {
-        glDeleteBuffers(1, &_indexBuffer);
+        GLStateCache::deleteBuffer(_indexBuffer);
+        __indexMemorySize -= (size_t)getIndexSize(_indexFormat) * _indexCount;
     }
 }
 
@@ -23,23 +49,13 @@ MeshPart* MeshPart::create(Mesh* mesh, unsigned int meshIndex, Mesh::PrimitiveTy
     // Create a VBO for our index buffer.
     GLuint vbo;
     GL_ASSERT( glGenBuffers(1, &vbo) );
-    GL_ASSERT( glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vbo) );
+    GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, vbo);
 
-    unsigned int indexSize = 0;
-    switch (indexFormat)
+    unsigned int indexSize = getIndexSize(indexFormat);
+    if (indexSize == 0)
     {
-    case Mesh::INDEX8:
-        indexSize = 1;
-        break;
-    case Mesh::INDEX16:
-        indexSize = 2;
-        break;
-    case Mesh::INDEX32:
-        indexSize = 4;
-        break;
-    default:
         GP_ERROR("Unsupported index format (%d).", indexFormat);
-        glDeleteBuffers(1, &vbo);
+        GLStateCache::deleteBuffer(vbo);
         return NULL;
     }
 
@@ -53,6 +69,59 @@ MeshPart* MeshPart::create(Mesh* mesh, unsigned int meshIndex, Mesh::PrimitiveTy
     part->_indexCount = indexCount;
     part->_indexBuffer = vbo;
     part->_dynamic = dynamic;
+    __indexMemorySize += (size_t)indexSize * indexCount;
+
+    return part;
+}
+
+MeshPart* MeshPart::createShared(Mesh* mesh, unsigned int meshIndex, Mesh::PrimitiveType primitiveType,
+    Mesh::IndexFormat indexFormat, unsigned int indexCount, IndexBufferHandle indexBuffer)
+{
+    GP_ASSERT(indexBuffer);
+
+    MeshPart* part = new MeshPart();
+    part->_mesh = mesh;
+    part->_meshIndex = meshIndex;
+    part->_primitiveType = primitiveType;
+    part->_indexFormat = indexFormat;
+    part->_indexCount = indexCount;
+    part->_indexBuffer = indexBuffer;
+    part->_sharedIndexBuffer = true;
+
+    return part;
+}
+
+MeshPart* MeshPart::createUploaded(Mesh* mesh, unsigned int meshIndex, Mesh::PrimitiveType primitiveType,
+    Mesh::IndexFormat indexFormat, unsigned int indexCount, IndexBufferHandle indexBuffer)
+{
+    GP_ASSERT(indexBuffer);
+
+    MeshPart* part = new MeshPart();
+    part->_mesh = mesh;
+    part->_meshIndex = meshIndex;
+    part->_primitiveType = primitiveType;
+    part->_indexFormat = indexFormat;
+    part->_indexCount = indexCount;
+    part->_indexBuffer = indexBuffer;
+    __indexMemorySize += (size_t)getIndexSize(indexFormat) * indexCount;
+
+    return part;
+}
+
+MeshPart* MeshPart::createPooled(Mesh* mesh, unsigned int meshIndex, Mesh::PrimitiveType primitiveType,
+    Mesh::IndexFormat indexFormat, unsigned int indexCount, const MeshBufferPool::Range& indexRange)
+{
+    GP_ASSERT(indexRange.page);
+
+    MeshPart* part = new MeshPart();
+    part->_mesh = mesh;
+    part->_meshIndex = meshIndex;
+    part->_primitiveType = primitiveType;
+    part->_indexFormat = indexFormat;
+    part->_indexCount = indexCount;
+    part->_indexBuffer = indexRange.buffer;
+    part->_indexRange = indexRange;
+    __indexMemorySize += (size_t)getIndexSize(indexFormat) * indexCount;
 
     return part;
 }
@@ -82,11 +151,18 @@ IndexBufferHandle MeshPart::getIndexBuffer() const
     return _indexBuffer;
 }
 
+size_t MeshPart::getIndexOffset() const
+{
+    return _indexRange.offset;
+}
+
 void* MeshPart::mapIndexBuffer()
 {
-    GL_ASSERT( glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBuffer) );
+    GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBuffer);
 
-    return (void*)glMapBuffer(GL_ELEMENT_ARRAY_BUFFER, GL_WRITE_ONLY);
+    // A pooled part maps the whole page, of which only its own indices may be written.
+    unsigned char* data = (unsigned char*)glMapBuffer(GL_ELEMENT_ARRAY_BUFFER, GL_WRITE_ONLY);
+    return data ? data + _indexRange.offset : NULL;
 }
 
 bool MeshPart::unmapIndexBuffer()
@@ -96,7 +172,7 @@ bool MeshPart::unmapIndexBuffer()
 
 void MeshPart::setIndexData(const void* indexData, unsigned int indexStart, unsigned int indexCount)
 {
-    GL_ASSERT( glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBuffer) );
+    GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBuffer);
 
     unsigned int indexSize = 0;
     switch (_indexFormat)
@@ -115,9 +191,11 @@ void MeshPart::setIndexData(const void* indexData, unsigned int indexStart, unsi
         return;
     }
 
-    if (indexStart == 0 && indexCount == 0)
+    // The indices of a pooled part are a range of a shared buffer, which must not be reallocated.
+    if (indexStart == 0 && indexCount == 0 && !_indexRange.page)
     {
         GL_ASSERT( glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexSize * _indexCount, indexData, _dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW) );
+        FrameCapture::record(FrameCapture::UPLOAD_BUFFER, GL_ELEMENT_ARRAY_BUFFER, _indexBuffer, 0, indexSize * _indexCount);
     }
     else
     {
@@ -126,7 +204,8 @@ void MeshPart::setIndexData(const void* indexData, unsigned int indexStart, unsi
             indexCount = _indexCount - indexStart;
         }
 
-        GL_ASSERT( glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, indexStart * indexSize, indexCount * indexSize, indexData) );
+        GL_ASSERT( glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, _indexRange.offset + indexStart * indexSize, indexCount * indexSize, indexData) );
+        FrameCapture::record(FrameCapture::UPLOAD_BUFFER, GL_ELEMENT_ARRAY_BUFFER, _indexBuffer, 0, indexCount * indexSize);
     }
 }
 
@@ -135,4 +214,9 @@ bool MeshPart::isDynamic() const
     return _dynamic;
 }
 
+size_t MeshPart::getTotalMemorySize()
+{
+    return __indexMemorySize;
+}
+
 }
@@ -57,6 +57,16 @@ public:
      */
     IndexBufferHandle getIndexBuffer() const;
 
+    /**
+     * Returns the offset of the first index of the part in its index buffer, in bytes.
+     *
+     * This is zero unless the index buffer is shared with other parts, as it is for the
+     * parts of meshes loaded from bundles, and is passed to the draw calls of the part.
+     *
+     * @return The offset of the indices in the index buffer.
+     */
+    size_t getIndexOffset() const;
+
     /**
      * Maps the index buffer for the specified access.
      *
@@ -130,13 +140,58 @@ private:
      */
     static MeshPart* create(Mesh* mesh, unsigned int meshIndex, Mesh::PrimitiveType primitiveType, Mesh::IndexFormat indexFormat, unsigned int indexCount, bool dynamic = false);
 
+    /**
+     * Creates a mesh part for the specified mesh that draws with an index buffer it does not own.
+     *
+     * @param mesh The mesh that this is part of.
+     * @param meshIndex The index of the part within the mesh.
+     * @param primitiveType The primitive type.
+     * @param indexFormat The index format.
+     * @param indexCount The number of indices.
+     * @param indexBuffer The shared index buffer, which must outlive the part.
+     */
+    static MeshPart* createShared(Mesh* mesh, unsigned int meshIndex, Mesh::PrimitiveType primitiveType, Mesh::IndexFormat indexFormat, unsigned int indexCount, IndexBufferHandle indexBuffer);
+
+    /**
+     * Creates a static mesh part for the specified mesh that takes ownership of an index buffer
+     * already filled with its indices.
+     *
+     * @param mesh The mesh that this is part of.
+     * @param meshIndex The index of the part within the mesh.
+     * @param primitiveType The primitive type.
+     * @param indexFormat The index format.
+     * @param indexCount The number of indices.
+     * @param indexBuffer The filled index buffer, which is deleted with the part.
+     */
+    static MeshPart* createUploaded(Mesh* mesh, unsigned int meshIndex, Mesh::PrimitiveType primitiveType, Mesh::IndexFormat indexFormat, unsigned int indexCount, IndexBufferHandle indexBuffer);
+
+    /**
+     * Creates a static mesh part for the specified mesh that takes ownership of a range of a
+     * MeshBufferPool page already filled with its indices.
+     *
+     * @param mesh The mesh that this is part of.
+     * @param meshIndex The index of the part within the mesh.
+     * @param primitiveType The primitive type.
+     * @param indexFormat The index format.
+     * @param indexCount The number of indices.
+     * @param indexRange The filled range, which is freed with the part.
+     */
+    static MeshPart* createPooled(Mesh* mesh, unsigned int meshIndex, Mesh::PrimitiveType primitiveType, Mesh::IndexFormat indexFormat, unsigned int indexCount, const MeshBufferPool::Range& indexRange);
+
+    /**
+     * Gets the number of bytes of the index buffers owned by all mesh parts, excluding shared index buffers.
+     */
+    static size_t getTotalMemorySize();
+
     Mesh* _mesh;
     unsigned int _meshIndex;
     Mesh::PrimitiveType _primitiveType;
     Mesh::IndexFormat _indexFormat;
     unsigned int _indexCount;
     IndexBufferHandle _indexBuffer;
+    MeshBufferPool::Range _indexRange;
     bool _dynamic;
+    bool _sharedIndexBuffer;
 };
 
 }
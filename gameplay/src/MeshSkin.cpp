@@ -2,15 +2,21 @@
 #include "MeshSkin.h"
 #include "Joint.h"
 #include "Model.h"
+#include "JointTexture.h"
+#include "AnimationPose.h"
 
 // The number of rows in each palette matrix.
 #define PALETTE_ROWS 3
 
+// The number of Vector4's in each palette dual quaternion.
+#define DUAL_QUATERNION_ROWS 2
+
 namespace gameplay
 {
 
 MeshSkin::MeshSkin()
-    : _rootJoint(NULL), _rootNode(NULL), _matrixPalette(NULL), _model(NULL)
+    : _rootJoint(NULL), _rootNode(NULL), _matrixPalette(NULL), _dualQuaternionPalette(NULL),
+      _paletteDirty(true), _paletteReset(true), _dualQuaternionPaletteDirty(true), _skeletonDirty(true), _pose(NULL), _poseFrame(0), _model(NULL)
 {
 }
 
@@ -18,7 +24,11 @@ MeshSkin::~MeshSkin()
 {
     clearJoints();
 
+    JointTexture::remove(this);
+
     SAFE_DELETE_ARRAY(_matrixPalette);
+    SAFE_DELETE_ARRAY(_dualQuaternionPalette);
+    SAFE_DELETE(_pose);
 }
 
 const Matrix& MeshSkin::getBindShape() const
@@ -29,6 +39,7 @@ const Matrix& MeshSkin::getBindShape() const
 void MeshSkin::setBindShape(const float* matrix)
 {
     _bindShape.set(matrix);
+    _paletteReset = true;
 }
 
 unsigned int MeshSkin::getJointCount() const
@@ -66,6 +77,7 @@ MeshSkin* MeshSkin::clone(NodeCloneContext &context) const
     {
         const unsigned int jointCount = getJointCount();
         skin->setJointCount(jointCount);
+        skin->_jointBounds = _jointBounds;
 
         GP_ASSERT(skin->_rootNode == NULL);
         
@@ -116,6 +128,7 @@ void MeshSkin::setJointCount(unsigned int jointCount)
 
     // Resize the joints vector and initialize to NULL.
     _joints.resize(jointCount);
+    _jointBounds.clear();
     for (unsigned int i = 0; i < jointCount; i++)
     {
         _joints[i] = NULL;
@@ -123,6 +136,7 @@ void MeshSkin::setJointCount(unsigned int jointCount)
 
     // Rebuild the matrix palette. Each matrix is 3 rows of Vector4.
     SAFE_DELETE_ARRAY(_matrixPalette);
+    SAFE_DELETE_ARRAY(_dualQuaternionPalette);
 
     if (jointCount > 0)
     {
@@ -133,7 +147,10 @@ void MeshSkin::setJointCount(unsigned int jointCount)
             _matrixPalette[i+1].set(0.0f, 1.0f, 0.0f, 0.0f);
             _matrixPalette[i+2].set(0.0f, 0.0f, 1.0f, 0.0f);
         }
+        _dualQuaternionPalette = new Vector4[jointCount * DUAL_QUATERNION_ROWS];
     }
+    _paletteReset = true;
+    _skeletonDirty = true;
 }
 
 void MeshSkin::setJoint(Joint* joint, unsigned int index)
@@ -153,18 +170,191 @@ void MeshSkin::setJoint(Joint* joint, unsigned int index)
         joint->addRef();
         joint->addSkin(this);
     }
+    _paletteReset = true;
+    _skeletonDirty = true;
 }
 
 Vector4* MeshSkin::getMatrixPalette() const
 {
     GP_ASSERT(_matrixPalette);
 
+    updateMatrixPalette();
+    return _matrixPalette;
+}
+
+void MeshSkin::updateMatrixPalette() const
+{
+    if (!_paletteDirty && !_paletteReset)
+        return;
+
+    MeshSkin* skin = const_cast<MeshSkin*>(this);
     for (size_t i = 0, count = _joints.size(); i < count; i++)
     {
         GP_ASSERT(_joints[i]);
-        _joints[i]->updateJointMatrix(getBindShape(), &_matrixPalette[i * PALETTE_ROWS]);
+        _joints[i]->updateJointMatrix(skin, _paletteReset, &_matrixPalette[i * PALETTE_ROWS]);
+    }
+    _paletteDirty = false;
+    _paletteReset = false;
+    _dualQuaternionPaletteDirty = true;
+}
+
+void MeshSkin::applyPose()
+{
+    GP_PROFILE_SCOPE("MeshSkin::applyPose");
+    GP_ASSERT(_pose && _pose->getTransformCount() == _joints.size());
+
+    Vector3 scale;
+    Quaternion rotation;
+    Vector3 translation;
+    if (!updateSkeleton())
+    {
+        for (unsigned int i = 0, count = (unsigned int)_joints.size(); i < count; ++i)
+        {
+            if (_joints[i] && _pose->getTransform(i, &scale, &rotation, &translation))
+                _joints[i]->set(scale, rotation, translation);
+        }
+        return;
+    }
+
+    // Parents precede their children, so the world matrix of a parent joint is already resolved when its children
+    // are reached. Joints that moved only notify the change when something besides the skin depends on them, and
+    // those are resolved again from their notification, to the same matrices.
+    const size_t count = _skeleton.size();
+    _skeletonMoved.assign(count, false);
+    bool moved = false;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const SkeletonJoint& entry = _skeleton[i];
+        Joint* joint = _joints[entry.index];
+        const bool posed = _pose->getTransform(entry.index, &scale, &rotation, &translation);
+        if (posed)
+            joint->setPose(scale, rotation, translation);
+
+        if (posed || (entry.parent >= 0 && _skeletonMoved[entry.parent]))
+        {
+            const Node* parent = entry.parent >= 0 ? _joints[_skeleton[entry.parent].index] : entry.parentNode;
+            joint->resolveWorldMatrix(parent ? &parent->getWorldMatrix() : NULL);
+            joint->updateJointMatrix(this, true, &_matrixPalette[entry.index * PALETTE_ROWS]);
+            if (joint->hasAttachments())
+                joint->notifyPose();
+            _skeletonMoved[i] = true;
+            moved = true;
+        }
+        else
+        {
+            joint->updateJointMatrix(this, _paletteReset, &_matrixPalette[entry.index * PALETTE_ROWS]);
+        }
+    }
+    _paletteDirty = false;
+    _paletteReset = false;
+    _dualQuaternionPaletteDirty = true;
+
+    if (moved && !_jointBounds.empty() && _model && _model->getNode())
+        _model->getNode()->setBoundsDirty();
+}
+
+bool MeshSkin::updateSkeleton()
+{
+    if (!_skeletonDirty)
+    {
+        // Joints moved to other parents since the order was built invalidate it.
+        for (size_t i = 0, count = _skeleton.size(); i < count; ++i)
+        {
+            const SkeletonJoint& entry = _skeleton[i];
+            const Node* parent = entry.parent >= 0 ? _joints[_skeleton[entry.parent].index] : entry.parentNode;
+            if (_joints[entry.index]->getParent() != parent)
+            {
+                _skeletonDirty = true;
+                break;
+            }
+        }
+    }
+
+    if (_skeletonDirty)
+    {
+        _skeletonDirty = false;
+        _skeleton.clear();
+        for (unsigned int i = 0, count = (unsigned int)_joints.size(); i < count; ++i)
+        {
+            if (_joints[i] == NULL)
+            {
+                _skeleton.clear();
+                return false;
+            }
+
+            // Each joint whose parent is not a joint of the skin starts a subtree of the order.
+            Node* parent = _joints[i]->getParent();
+            if (parent == NULL || parent->getType() != Node::JOINT || getJointIndex(static_cast<Joint*>(parent)) < 0)
+                addSkeletonJoint(i, -1);
+        }
+    }
+    return _skeleton.size() == _joints.size();
+}
+
+void MeshSkin::addSkeletonJoint(unsigned int index, int parent)
+{
+    Joint* joint = _joints[index];
+    GP_ASSERT(joint);
+
+    SkeletonJoint entry;
+    entry.index = index;
+    entry.parent = parent;
+    entry.parentNode = joint->getParent();
+    const int position = (int)_skeleton.size();
+    _skeleton.push_back(entry);
+    for (Node* child = joint->getFirstChild(); child != NULL; child = child->getNextSibling())
+    {
+        int childIndex = child->getType() == Node::JOINT ? getJointIndex(static_cast<Joint*>(child)) : -1;
+        if (childIndex >= 0)
+            addSkeletonJoint((unsigned int)childIndex, position);
     }
-    return _matrixPalette;
+}
+
+void MeshSkin::setPaletteDirty()
+{
+    // Skins bounded by their joints follow the pose, so the bounds of their node move with them.
+    if (!_jointBounds.empty() && _model && _model->getNode())
+        _model->getNode()->setBoundsDirty();
+    _paletteDirty = true;
+}
+
+bool MeshSkin::hasSharedJoints() const
+{
+    for (size_t i = 0, count = _joints.size(); i < count; i++)
+    {
+        if (_joints[i] && _joints[i]->_skin.next)
+            return true;
+    }
+    return false;
+}
+
+bool MeshSkin::computeBounds(BoundingSphere* sphere) const
+{
+    GP_ASSERT(sphere);
+
+    if (_jointBounds.empty())
+        return false;
+    GP_ASSERT(_jointBounds.size() == _joints.size());
+
+    const Vector4* rows = getMatrixPalette();
+    sphere->radius = 0;
+    for (size_t i = 0, count = _joints.size(); i < count; i++, rows += PALETTE_ROWS)
+    {
+        if (_jointBounds[i].isEmpty())
+            continue;
+
+        const Matrix m(rows[0].x, rows[0].y, rows[0].z, rows[0].w,
+                       rows[1].x, rows[1].y, rows[1].z, rows[1].w,
+                       rows[2].x, rows[2].y, rows[2].z, rows[2].w,
+                       0.0f, 0.0f, 0.0f, 1.0f);
+        BoundingSphere bounds(_jointBounds[i]);
+        bounds.transform(m);
+        if (sphere->isEmpty())
+            sphere->set(bounds);
+        else
+            sphere->merge(bounds);
+    }
+    return true;
 }
 
 unsigned int MeshSkin::getMatrixPaletteSize() const
@@ -172,6 +362,40 @@ unsigned int MeshSkin::getMatrixPaletteSize() const
     return (unsigned int)_joints.size() * PALETTE_ROWS;
 }
 
+Vector4* MeshSkin::getDualQuaternionPalette() const
+{
+    GP_ASSERT(_dualQuaternionPalette);
+
+    const Vector4* rows = getMatrixPalette();
+    if (!_dualQuaternionPaletteDirty)
+        return _dualQuaternionPalette;
+    _dualQuaternionPaletteDirty = false;
+    for (size_t i = 0, count = _joints.size(); i < count; i++, rows += PALETTE_ROWS)
+    {
+        const Matrix m(rows[0].x, rows[0].y, rows[0].z, rows[0].w,
+                       rows[1].x, rows[1].y, rows[1].z, rows[1].w,
+                       rows[2].x, rows[2].y, rows[2].z, rows[2].w,
+                       0.0f, 0.0f, 0.0f, 1.0f);
+        Quaternion q;
+        m.getRotation(&q);
+
+        // The dual part is half the product of the translation (as a pure quaternion) and the rotation.
+        const Vector3 t(rows[0].w, rows[1].w, rows[2].w);
+        Vector4* dq = &_dualQuaternionPalette[i * DUAL_QUATERNION_ROWS];
+        dq[0].set(q.x, q.y, q.z, q.w);
+        dq[1].set(0.5f * (t.x * q.w + t.y * q.z - t.z * q.y),
+                  0.5f * (t.y * q.w + t.z * q.x - t.x * q.z),
+                  0.5f * (t.z * q.w + t.x * q.y - t.y * q.x),
+                  -0.5f * (t.x * q.x + t.y * q.y + t.z * q.z));
+    }
+    return _dualQuaternionPalette;
+}
+
+unsigned int MeshSkin::getDualQuaternionPaletteSize() const
+{
+    return (unsigned int)_joints.size() * DUAL_QUATERNION_ROWS;
+}
+
 Model* MeshSkin::getModel() const
 {
     return _model;
@@ -218,6 +442,7 @@ void MeshSkin::setRootJoint(Joint* joint)
 
 void MeshSkin::transformChanged(Transform* transform, long cookie)
 {
+    // The transform is not used, which transformsChanged() relies on.
     switch (cookie)
     {
     case 1:
@@ -235,6 +460,15 @@ void MeshSkin::transformChanged(Transform* transform, long cookie)
     }
 }
 
+void MeshSkin::transformsChanged(Transform* const* transforms, unsigned int count, long cookie)
+{
+    // transformChanged() only depends on the cookie and ignores the transform, so every
+    // transform in the group results in the same bounds update and it is applied once.
+    // This must forward each transform instead if transformChanged() ever uses it.
+    if (count > 0)
+        transformChanged(transforms[0], cookie);
+}
+
 int MeshSkin::getJointIndex(Joint* joint) const
 {
     for (size_t i = 0, count = _joints.size(); i < count; ++i)
@@ -265,8 +499,11 @@ void MeshSkin::clearJoints()
 {
     setRootJoint(NULL);
 
+    // Joints outliving the skin must not mark it dirty any longer.
     for (size_t i = 0, count = _joints.size(); i < count; ++i)
     {
+        if (_joints[i])
+            _joints[i]->removeSkin(this);
         SAFE_RELEASE(_joints[i]);
     }
     _joints.clear();
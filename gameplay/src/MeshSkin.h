@@ -3,12 +3,14 @@
 
 #include "Matrix.h"
 #include "Transform.h"
+#include "BoundingSphere.h"
 
 namespace gameplay
 {
 
 class Bundle;
 class Model;
+class AnimationPose;
 class Node;
 class Joint;
 
@@ -27,6 +29,9 @@ class MeshSkin : public Transform::Listener
     friend class Joint;
     friend class Node;
     friend class Scene;
+    friend class Prefab;
+    friend class RenderQueue;
+    friend class AnimationController;
 
 public:
 
@@ -92,6 +97,9 @@ public:
 
     /**
      * Returns the pointer to the Vector4 array for the purpose of binding to a shader.
+     *
+     * The palette is kept until the joints move, and only the entries of the joints that
+     * moved since it was last returned are computed again.
      * 
      * @return The pointer to the matrix palette.
      */
@@ -106,6 +114,26 @@ public:
      */
     unsigned int getMatrixPaletteSize() const;
 
+    /**
+     * Returns the pointer to the Vector4 array of dual quaternions for the purpose of binding to a shader.
+     *
+     * Each joint is represented by 2 Vector4's: the rotation of the joint matrix as a
+     * quaternion, followed by its translation as the dual part. Dual quaternion skinning
+     * keeps the volume of the mesh around twisting joints, which linear blending of the
+     * matrix palette collapses, but it does not support joints with non-uniform scale.
+     *
+     * @return The pointer to the dual quaternion palette.
+     */
+    Vector4* getDualQuaternionPalette() const;
+
+    /**
+     * Returns the number of elements in the dual quaternion palette array.
+     * Each dual quaternion is represented by 2 Vector4's.
+     *
+     * @return The dual quaternion palette size.
+     */
+    unsigned int getDualQuaternionPaletteSize() const;
+
     /**
      * Returns our parent Model.
      */
@@ -116,6 +144,11 @@ public:
      */
     void transformChanged(Transform* transform, long cookie);
 
+    /**
+     * Handles batched transform change events for joints.
+     */
+    void transformsChanged(Transform* const* transforms, unsigned int count, long cookie);
+
 private:
 
     /**
@@ -175,6 +208,74 @@ private:
      */
     void clearJoints();
 
+    /**
+     * Computes the entries of the matrix palette of the joints that moved since it was last computed.
+     *
+     * Only the skin and its joints are written to, so skins whose joints are not shared with
+     * other skins can be updated on other threads once the world matrix of the parent of their
+     * root joint is resolved.
+     */
+    void updateMatrixPalette() const;
+
+    /**
+     * Called by the joints of this skin when they move.
+     */
+    void setPaletteDirty();
+
+    /**
+     * Determines if any joint of this skin is also a joint of another skin.
+     */
+    bool hasSharedJoints() const;
+
+    /**
+     * Computes the bounds of the skinned mesh in its current pose, in the space of its model's node.
+     *
+     * The bounds of the vertices influenced by each joint are transformed by the entry of the
+     * joint in the matrix palette, which is computed first if it is out of date.
+     *
+     * @param sphere Populated with the bounds of the skinned mesh.
+     *
+     * @return true if the skin has bounds for its joints, false otherwise.
+     */
+    bool computeBounds(BoundingSphere* sphere) const;
+
+    /**
+     * Writes the blended pose of the skin to its joints and resolves their world matrices
+     * and the matrix palette in one pass over the joints in hierarchy order.
+     *
+     * Joints without attachments (see Joint::hasAttachments()) are posed without notifying
+     * their transform changes, while the others notify them as usual. Skins whose joints
+     * cannot be ordered have their pose applied to each joint as usual instead.
+     *
+     * Called by AnimationController once per frame for each skin it blends a pose for.
+     */
+    void applyPose();
+
+    /**
+     * Rebuilds the hierarchy order of the joints if the joints or their parents changed.
+     *
+     * @return true if every joint is in the order, false otherwise.
+     */
+    bool updateSkeleton();
+
+    /**
+     * Adds a joint and the joints of the skin below it to the hierarchy order.
+     */
+    void addSkeletonJoint(unsigned int index, int parent);
+
+    /**
+     * A joint in the hierarchy order of the skin.
+     */
+    struct SkeletonJoint
+    {
+        // The index of the joint in the joints of the skin.
+        unsigned int index;
+        // The position of the parent joint in the order, or -1 if the parent is not a joint of the skin.
+        int parent;
+        // The parent node when the order was built, to tell when the hierarchy changed.
+        Node* parentNode;
+    };
+
     Matrix _bindShape;
     std::vector<Joint*> _joints;
     Joint* _rootJoint;
@@ -189,6 +290,30 @@ private:
     // Each 4x3 row-wise matrix is represented as 3 Vector4's.
     // The number of Vector4's is (_joints.size() * 3).
     Vector4* _matrixPalette;
+
+    // Pointer to the array of palette dual quaternions, 2 Vector4's per joint,
+    // derived from the matrix palette when requested.
+    Vector4* _dualQuaternionPalette;
+
+    // Whether some joints moved since the palettes were computed, whether every entry of the
+    // matrix palette must be computed again, and whether the dual quaternions are out of date.
+    mutable bool _paletteDirty;
+    mutable bool _paletteReset;
+    mutable bool _dualQuaternionPaletteDirty;
+
+    // The bounds of the vertices each joint influences, in the space of the mesh, or empty when
+    // the bundle of the skin has none. The bounds of joints that influence no vertices are empty.
+    std::vector<BoundingSphere> _jointBounds;
+
+    // The joints in hierarchy order, parents first, rebuilt when the joints change.
+    std::vector<SkeletonJoint> _skeleton;
+    std::vector<bool> _skeletonMoved;
+    bool _skeletonDirty;
+
+    // The pose the clips animating the joints are blended into, created by the AnimationController
+    // the first time they are blended, and the number of the controller update it was last captured in.
+    AnimationPose* _pose;
+    unsigned int _poseFrame;
     Model* _model;
 };
 
@@ -5,17 +5,51 @@
 #include "Technique.h"
 #include "Pass.h"
 #include "Node.h"
+#include "FrameStats.h"
+#include "FrameCapture.h"
+#include "GLStateCache.h"
+#include "Camera.h"
+#include "ObjectPool.h"
+
+// Default fraction of its screen size past which a level of detail must be before it is switched to.
+#define MODEL_LOD_DEFAULT_HYSTERESIS 0.1f
 
 namespace gameplay
 {
 
+// Gets the location of the vertex attribute bound to INSTANCE_WORLD_MATRIX in a pass, or -1 if it has none.
+static VertexAttribute getInstanceMatrixAttribute(Pass* pass)
+{
+    const char* name = pass->getInstanceMatrixAttribute();
+    return name ? pass->getEffect()->getVertexAttribute(name) : -1;
+}
+
+// Sets the constant value of an instance matrix attribute for a draw that is not instanced.
+static void setInstanceMatrix(VertexAttribute attribute, Node* node)
+{
+    const Matrix& matrix = node ? node->getWorldMatrix() : Matrix::identity();
+    for (int i = 0; i < 4; ++i)
+    {
+        GL_ASSERT( glVertexAttrib4fv(attribute + i, &matrix.m[i * 4]) );
+    }
+}
+
+// Gets the location of the vertex attribute bound to INSTANCE_DATA in a pass, or -1 if it has none.
+static VertexAttribute getInstanceDataAttribute(Pass* pass)
+{
+    const char* name = pass->getInstanceDataAttribute();
+    return name ? pass->getEffect()->getVertexAttribute(name) : -1;
+}
+
 Model::Model() : Drawable(),
-    _mesh(NULL), _material(NULL), _partCount(0), _partMaterials(NULL), _skin(NULL)
+    _mesh(NULL), _material(NULL), _partCount(0), _partMaterials(NULL), _skin(NULL),
+    _lod(0), _lodHysteresis(MODEL_LOD_DEFAULT_HYSTERESIS), _parameterBlock(NULL), _sharedMaterials(false)
 {
 }
 
 Model::Model(Mesh* mesh) : Drawable(),
-    _mesh(mesh), _material(NULL), _partCount(0), _partMaterials(NULL), _skin(NULL)
+    _mesh(mesh), _material(NULL), _partCount(0), _partMaterials(NULL), _skin(NULL),
+    _lod(0), _lodHysteresis(MODEL_LOD_DEFAULT_HYSTERESIS), _parameterBlock(NULL), _sharedMaterials(false)
 {
     GP_ASSERT(mesh);
     _partCount = mesh->getPartCount();
@@ -23,6 +57,7 @@ Model::Model(Mesh* mesh) : Drawable(),
 
 Model::~Model()
 {
+    SAFE_RELEASE(_parameterBlock);
     SAFE_RELEASE(_material);
     if (_partMaterials)
     {
@@ -32,10 +67,26 @@ Model::~Model()
         }
         SAFE_DELETE_ARRAY(_partMaterials);
     }
+    for (size_t i = 0, count = _lods.size(); i < count; ++i)
+    {
+        SAFE_RELEASE(_lods[i].mesh);
+    }
     SAFE_RELEASE(_mesh);
     SAFE_DELETE(_skin);
 }
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+void* Model::operator new(size_t size)
+{
+    return ObjectPool::allocate(size);
+}
+
+void Model::operator delete(void* p)
+{
+    ObjectPool::deallocate(p);
+}
+#endif
+
 Model* Model::create(Mesh* mesh)
 {
     GP_ASSERT(mesh);
@@ -48,6 +99,151 @@ Mesh* Model::getMesh() const
     return _mesh;
 }
 
+bool Model::addLod(Mesh* mesh, float screenSize)
+{
+    GP_ASSERT(_mesh);
+
+    if (mesh == NULL || mesh->getPartCount() != _mesh->getPartCount())
+    {
+        GP_ERROR("The level of detail mesh of a model must have as many parts as the mesh of the model.");
+        return false;
+    }
+    if (screenSize <= 0.0f || (!_lods.empty() && screenSize >= _lods.back().screenSize))
+    {
+        GP_ERROR("The screen size of a level of detail (%f) must be positive and smaller than that of the previous level.", screenSize);
+        return false;
+    }
+
+    Lod lod;
+    lod.mesh = mesh;
+    lod.screenSize = screenSize;
+    mesh->addRef();
+    _lods.push_back(lod);
+    return true;
+}
+
+unsigned int Model::getLodCount() const
+{
+    return (unsigned int)_lods.size() + 1;
+}
+
+Mesh* Model::getLodMesh(unsigned int level) const
+{
+    GP_ASSERT(level <= _lods.size());
+    return level == 0 ? _mesh : _lods[level - 1].mesh;
+}
+
+float Model::getLodScreenSize(unsigned int level) const
+{
+    GP_ASSERT(level <= _lods.size());
+    return level == 0 ? FLT_MAX : _lods[level - 1].screenSize;
+}
+
+void Model::setLodHysteresis(float hysteresis)
+{
+    _lodHysteresis = MATH_CLAMP(hysteresis, 0.0f, 1.0f);
+}
+
+float Model::getLodHysteresis() const
+{
+    return _lodHysteresis;
+}
+
+void Model::setInstanceData(const Vector4& data)
+{
+    _instanceData = data;
+}
+
+const Vector4& Model::getInstanceData() const
+{
+    return _instanceData;
+}
+
+void Model::setParameterBlock(MaterialParameterBlock* block)
+{
+    if (_parameterBlock != block)
+    {
+        SAFE_RELEASE(_parameterBlock);
+        _parameterBlock = block;
+        if (_parameterBlock)
+            _parameterBlock->addRef();
+    }
+}
+
+MaterialParameterBlock* Model::getParameterBlock() const
+{
+    return _parameterBlock;
+}
+
+unsigned int Model::getLod() const
+{
+    return _lod;
+}
+
+unsigned int Model::selectLod(Camera* camera)
+{
+    GP_ASSERT(camera);
+
+    setLod(computeLod(camera));
+    return _lod;
+}
+
+unsigned int Model::computeLod(Camera* camera) const
+{
+    GP_ASSERT(camera);
+
+    if (_lods.empty() || _node == NULL)
+        return _lod;
+
+    // A level is only switched to once the size is past its threshold by the hysteresis fraction.
+    const float size = computeScreenSize(camera);
+    unsigned int lod = _lod;
+    while (lod < _lods.size() && size < _lods[lod].screenSize * (1.0f - _lodHysteresis))
+        ++lod;
+    while (lod > 0 && size > _lods[lod - 1].screenSize * (1.0f + _lodHysteresis))
+        --lod;
+    return lod;
+}
+
+void Model::setLod(unsigned int lod)
+{
+    GP_ASSERT(lod <= _lods.size());
+
+    if (lod != _lod)
+    {
+        _lod = lod;
+
+        // The passes of the materials bind the vertex attributes of one mesh at a time.
+        Mesh* mesh = getLodMesh(_lod);
+        if (_material)
+            setMaterialMeshBinding(_material, mesh);
+        if (_partMaterials)
+        {
+            for (unsigned int i = 0; i < _partCount; ++i)
+            {
+                if (_partMaterials[i])
+                    setMaterialMeshBinding(_partMaterials[i], mesh);
+            }
+        }
+    }
+}
+
+float Model::computeScreenSize(Camera* camera) const
+{
+    GP_ASSERT(camera);
+    GP_ASSERT(_node);
+
+    const BoundingSphere& sphere = _node->getBoundingSphere();
+    if (camera->getCameraType() == Camera::ORTHOGRAPHIC)
+        return camera->getZoomY() > 0.0f ? sphere.radius * 2.0f / camera->getZoomY() : FLT_MAX;
+
+    const Vector3 eye = camera->getNode() ? camera->getNode()->getTranslationWorld() : Vector3::zero();
+    const float distance = sphere.center.distance(eye);
+    if (distance <= sphere.radius)
+        return FLT_MAX;
+    return sphere.radius / (distance * tanf(MATH_DEG_TO_RAD(camera->getFieldOfView()) * 0.5f));
+}
+
 unsigned int Model::getMeshPartCount() const
 {
     GP_ASSERT(_mesh);
@@ -143,19 +339,8 @@ void Model::setMaterial(Material* material, int partIndex)
     if (material)
     {
         // Hookup vertex attribute bindings for all passes in the new material.
-        for (unsigned int i = 0, tCount = material->getTechniqueCount(); i < tCount; ++i)
-        {
-            Technique* t = material->getTechniqueByIndex(i);
-            GP_ASSERT(t);
-            for (unsigned int j = 0, pCount = t->getPassCount(); j < pCount; ++j)
-            {
-                Pass* p = t->getPassByIndex(j);
-                GP_ASSERT(p);
-                VertexAttributeBinding* b = VertexAttributeBinding::create(_mesh, p->getEffect());
-                p->setVertexAttributeBinding(b);
-                SAFE_RELEASE(b);
-            }
-        }
+        setMaterialMeshBinding(material, getLodMesh(_lod));
+
         // Apply node binding for the new material.
         if (_node)
         {
@@ -222,7 +407,10 @@ void Model::setSkin(MeshSkin* skin)
         // Assign the new skin
         _skin = skin;
         if (_skin)
+        {
             _skin->_model = this;
+            _skin->setPaletteDirty();
+        }
     }
 }
 
@@ -230,8 +418,8 @@ void Model::setNode(Node* node)
 {
     Drawable::setNode(node);
 
-    // Re-bind node related material parameters
-    if (node)
+    // Re-bind node related material parameters. Shared materials are bound as the model is drawn instead.
+    if (node && !_sharedMaterials)
     {
         if (_material)
         {
@@ -260,6 +448,7 @@ static bool drawWireframe(Mesh* mesh)
             for (unsigned int i = 0; i < vertexCount; i += 3)
             {
                 GL_ASSERT( glDrawArrays(GL_LINE_LOOP, i, 3) );
+                FrameStats::recordDraw(GL_LINE_LOOP, 3);
             }
         }
         return true;
@@ -270,6 +459,7 @@ static bool drawWireframe(Mesh* mesh)
             for (unsigned int i = 2; i < vertexCount; ++i)
             {
                 GL_ASSERT( glDrawArrays(GL_LINE_LOOP, i-2, 3) );
+                FrameStats::recordDraw(GL_LINE_LOOP, 3);
             }
         }
         return true;
@@ -306,7 +496,8 @@ static bool drawWireframe(MeshPart* part)
         {
             for (size_t i = 0; i < indexCount; i += 3)
             {
-                GL_ASSERT( glDrawElements(GL_LINE_LOOP, 3, part->getIndexFormat(), ((const GLvoid*)(i*indexSize))) );
+                GL_ASSERT( glDrawElements(GL_LINE_LOOP, 3, part->getIndexFormat(), ((const GLvoid*)(part->getIndexOffset() + i*indexSize))) );
+                FrameStats::recordDraw(GL_LINE_LOOP, 3);
             }
         }
         return true;
@@ -315,7 +506,8 @@ static bool drawWireframe(MeshPart* part)
         {
             for (size_t i = 2; i < indexCount; ++i)
             {
-                GL_ASSERT( glDrawElements(GL_LINE_LOOP, 3, part->getIndexFormat(), ((const GLvoid*)((i-2)*indexSize))) );
+                GL_ASSERT( glDrawElements(GL_LINE_LOOP, 3, part->getIndexFormat(), ((const GLvoid*)(part->getIndexOffset() + (i-2)*indexSize))) );
+                FrameStats::recordDraw(GL_LINE_LOOP, 3);
             }
         }
         return true;
@@ -330,12 +522,37 @@ unsigned int Model::draw(bool wireframe)
 {
     GP_ASSERT(_mesh);
 
+    if (!_lods.empty() && _node && _node->getScene() && _node->getScene()->getActiveCamera())
+        selectLod(_node->getScene()->getActiveCamera());
+
     unsigned int partCount = _mesh->getPartCount();
     if (partCount == 0)
     {
         // No mesh parts (index buffers).
+        drawPart(0, wireframe);
+    }
+    else
+    {
+        for (unsigned int i = 0; i < partCount; ++i)
+        {
+            drawPart(i, wireframe);
+        }
+    }
+    return partCount;
+}
+
+void Model::drawPart(unsigned int partIndex, bool wireframe, bool depthEqual)
+{
+    Mesh* mesh = getLodMesh(_lod);
+    GP_ASSERT(mesh);
+
+    if (mesh->getPartCount() == 0)
+    {
         if (_material)
         {
+            FrameCapture::Source source(_node, _material);
+            if (_sharedMaterials)
+                bindSharedMaterial(_material, mesh);
             Technique* technique = _material->getTechnique();
             GP_ASSERT(technique);
             unsigned int passCount = technique->getPassCount();
@@ -343,11 +560,23 @@ unsigned int Model::draw(bool wireframe)
             {
                 Pass* pass = technique->getPassByIndex(i);
                 GP_ASSERT(pass);
-                pass->bind();
-                GL_ASSERT( glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0) );
-                if (!wireframe || !drawWireframe(_mesh))
+                if (depthEqual)
+                    pass->bindDepthEqual();
+                else
+                    pass->bind();
+                if (_parameterBlock)
+                    _parameterBlock->bind(pass->getEffect());
+                VertexAttribute instanceAttribute = getInstanceMatrixAttribute(pass);
+                if (instanceAttribute >= 0)
+                    setInstanceMatrix(instanceAttribute, _node);
+                VertexAttribute dataAttribute = getInstanceDataAttribute(pass);
+                if (dataAttribute >= 0)
+                    GL_ASSERT( glVertexAttrib4f(dataAttribute, _instanceData.x, _instanceData.y, _instanceData.z, _instanceData.w) );
+                GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+                if (!wireframe || !drawWireframe(mesh))
                 {
-                    GL_ASSERT( glDrawArrays(_mesh->getPrimitiveType(), 0, _mesh->getVertexCount()) );
+                    GL_ASSERT( glDrawArrays(mesh->getPrimitiveType(), 0, mesh->getVertexCount()) );
+                    FrameStats::recordDraw(mesh->getPrimitiveType(), mesh->getVertexCount());
                 }
                 pass->unbind();
             }
@@ -355,36 +584,163 @@ unsigned int Model::draw(bool wireframe)
     }
     else
     {
-        for (unsigned int i = 0; i < partCount; ++i)
-        {
-            MeshPart* part = _mesh->getPart(i);
-            GP_ASSERT(part);
+        MeshPart* part = mesh->getPart(partIndex);
+        GP_ASSERT(part);
 
-            // Get the material for this mesh part.
-            Material* material = getMaterial(i);
-            if (material)
+        // Get the material for this mesh part.
+        Material* material = getMaterial(partIndex);
+        if (material)
+        {
+            FrameCapture::Source source(_node, material);
+            if (_sharedMaterials)
+                bindSharedMaterial(material, mesh);
+            Technique* technique = material->getTechnique();
+            GP_ASSERT(technique);
+            unsigned int passCount = technique->getPassCount();
+            for (unsigned int j = 0; j < passCount; ++j)
             {
-                Technique* technique = material->getTechnique();
-                GP_ASSERT(technique);
-                unsigned int passCount = technique->getPassCount();
-                for (unsigned int j = 0; j < passCount; ++j)
-                {
-                    Pass* pass = technique->getPassByIndex(j);
-                    GP_ASSERT(pass);
+                Pass* pass = technique->getPassByIndex(j);
+                GP_ASSERT(pass);
+                if (depthEqual)
+                    pass->bindDepthEqual();
+                else
                     pass->bind();
-                    GL_ASSERT( glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, part->_indexBuffer) );
-                    if (!wireframe || !drawWireframe(part))
-                    {
-                        GL_ASSERT( glDrawElements(part->getPrimitiveType(), part->getIndexCount(), part->getIndexFormat(), 0) );
-                    }
-                    pass->unbind();
+                if (_parameterBlock)
+                    _parameterBlock->bind(pass->getEffect());
+                VertexAttribute instanceAttribute = getInstanceMatrixAttribute(pass);
+                if (instanceAttribute >= 0)
+                    setInstanceMatrix(instanceAttribute, _node);
+                VertexAttribute dataAttribute = getInstanceDataAttribute(pass);
+                if (dataAttribute >= 0)
+                    GL_ASSERT( glVertexAttrib4f(dataAttribute, _instanceData.x, _instanceData.y, _instanceData.z, _instanceData.w) );
+                GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, part->_indexBuffer);
+                if (!wireframe || !drawWireframe(part))
+                {
+                    GL_ASSERT( glDrawElements(part->getPrimitiveType(), part->getIndexCount(), part->getIndexFormat(), (const GLvoid*)part->getIndexOffset()) );
+                    FrameStats::recordDraw(part->getPrimitiveType(), part->getIndexCount());
                 }
+                pass->unbind();
             }
         }
     }
-    return partCount;
 }
 
+bool Model::drawPartDepth(unsigned int partIndex)
+{
+    Mesh* mesh = getLodMesh(_lod);
+    GP_ASSERT(mesh);
+
+    MeshPart* part = mesh->getPartCount() > 0 ? mesh->getPart(partIndex) : NULL;
+    Material* material = getMaterial(part ? (int)partIndex : -1);
+    if (material == NULL)
+        return false;
+    FrameCapture::Source source(_node, material);
+    if (_sharedMaterials)
+        bindSharedMaterial(material, mesh);
+
+    Technique* technique = material->getTechnique();
+    GP_ASSERT(technique);
+    if (technique->getPassCount() == 0)
+        return false;
+
+    // The first pass lays down the depth that every pass is then drawn over.
+    Pass* pass = technique->getPassByIndex(0);
+    GP_ASSERT(pass);
+    if (!pass->bindDepthPrepass(mesh))
+        return false;
+    if (_parameterBlock)
+        _parameterBlock->bind(pass->getDepthEffect());
+
+    if (part)
+    {
+        GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, part->_indexBuffer);
+        GL_ASSERT( glDrawElements(part->getPrimitiveType(), part->getIndexCount(), part->getIndexFormat(), (const GLvoid*)part->getIndexOffset()) );
+        FrameStats::recordDraw(part->getPrimitiveType(), part->getIndexCount());
+    }
+    else
+    {
+        GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        GL_ASSERT( glDrawArrays(mesh->getPrimitiveType(), 0, mesh->getVertexCount()) );
+        FrameStats::recordDraw(mesh->getPrimitiveType(), mesh->getVertexCount());
+    }
+    pass->unbindDepthPrepass();
+    return true;
+}
+
+#ifdef GP_USE_INSTANCING
+void Model::drawPartInstanced(unsigned int partIndex, VertexBufferHandle instanceBuffer, unsigned int instanceOffset, unsigned int instanceCount)
+{
+    Mesh* mesh = getLodMesh(_lod);
+    GP_ASSERT(mesh);
+
+    MeshPart* part = mesh->getPartCount() > 0 ? mesh->getPart(partIndex) : NULL;
+    Material* material = getMaterial(part ? (int)partIndex : -1);
+    if (material == NULL)
+        return;
+    FrameCapture::Source source(_node, material);
+    if (_sharedMaterials)
+        bindSharedMaterial(material, mesh);
+
+    Technique* technique = material->getTechnique();
+    GP_ASSERT(technique);
+    unsigned int passCount = technique->getPassCount();
+    for (unsigned int j = 0; j < passCount; ++j)
+    {
+        Pass* pass = technique->getPassByIndex(j);
+        GP_ASSERT(pass);
+        pass->bind();
+        if (_parameterBlock)
+            _parameterBlock->bind(pass->getEffect());
+
+        // Each column of the instance matrices, and the instance data, is sourced once per instance.
+        VertexAttribute attribute = getInstanceMatrixAttribute(pass);
+        GP_ASSERT(attribute >= 0);
+        const GLsizei stride = MODEL_INSTANCE_FLOATS * sizeof(float);
+        const size_t offset = instanceOffset * MODEL_INSTANCE_FLOATS * sizeof(float);
+        GLStateCache::bindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+        for (int i = 0; i < 4; ++i)
+        {
+            GL_ASSERT( glEnableVertexAttribArray(attribute + i) );
+            GL_ASSERT( glVertexAttribPointer(attribute + i, 4, GL_FLOAT, GL_FALSE, stride, (const GLvoid*)(offset + i * 4 * sizeof(float))) );
+            GL_ASSERT( glVertexAttribDivisor(attribute + i, 1) );
+        }
+        VertexAttribute dataAttribute = getInstanceDataAttribute(pass);
+        if (dataAttribute >= 0)
+        {
+            GL_ASSERT( glEnableVertexAttribArray(dataAttribute) );
+            GL_ASSERT( glVertexAttribPointer(dataAttribute, 4, GL_FLOAT, GL_FALSE, stride, (const GLvoid*)(offset + sizeof(Matrix))) );
+            GL_ASSERT( glVertexAttribDivisor(dataAttribute, 1) );
+        }
+
+        if (part)
+        {
+            GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, part->_indexBuffer);
+            GL_ASSERT( glDrawElementsInstanced(part->getPrimitiveType(), part->getIndexCount(), part->getIndexFormat(), (const GLvoid*)part->getIndexOffset(), instanceCount) );
+            FrameStats::recordDraw(part->getPrimitiveType(), part->getIndexCount() * instanceCount);
+        }
+        else
+        {
+            GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+            GL_ASSERT( glDrawArraysInstanced(mesh->getPrimitiveType(), 0, mesh->getVertexCount(), instanceCount) );
+            FrameStats::recordDraw(mesh->getPrimitiveType(), mesh->getVertexCount() * instanceCount);
+        }
+
+        // Restore the attributes so that later draws of the same vertex array use constant matrices.
+        for (int i = 0; i < 4; ++i)
+        {
+            GL_ASSERT( glVertexAttribDivisor(attribute + i, 0) );
+            GL_ASSERT( glDisableVertexAttribArray(attribute + i) );
+        }
+        if (dataAttribute >= 0)
+        {
+            GL_ASSERT( glVertexAttribDivisor(dataAttribute, 0) );
+            GL_ASSERT( glDisableVertexAttribArray(dataAttribute) );
+        }
+        pass->unbind();
+    }
+}
+#endif
+
 void Model::setMaterialNodeBinding(Material *material)
 {
     GP_ASSERT(material);
@@ -395,6 +751,81 @@ void Model::setMaterialNodeBinding(Material *material)
     }
 }
 
+void Model::setMaterialMeshBinding(Material* material, Mesh* mesh)
+{
+    GP_ASSERT(material);
+    GP_ASSERT(mesh);
+
+    for (unsigned int i = 0, tCount = material->getTechniqueCount(); i < tCount; ++i)
+    {
+        Technique* t = material->getTechniqueByIndex(i);
+        GP_ASSERT(t);
+        for (unsigned int j = 0, pCount = t->getPassCount(); j < pCount; ++j)
+        {
+            Pass* p = t->getPassByIndex(j);
+            GP_ASSERT(p);
+            VertexAttributeBinding* b = VertexAttributeBinding::create(mesh, p->getEffect());
+            p->setVertexAttributeBinding(b);
+            SAFE_RELEASE(b);
+        }
+    }
+}
+
+void Model::bindSharedMaterial(Material* material, Mesh* mesh)
+{
+    GP_ASSERT(material);
+    GP_ASSERT(mesh);
+
+    // The auto bindings of a material are resolved the first time it is bound to a node.
+    if (material->_nodeBinding == NULL)
+    {
+        setMaterialNodeBinding(material);
+    }
+    else if (material->_nodeBinding != _node)
+    {
+        material->_nodeBinding = _node;
+        for (unsigned int i = 0, tCount = material->getTechniqueCount(); i < tCount; ++i)
+        {
+            Technique* t = material->getTechniqueByIndex(i);
+            t->_nodeBinding = _node;
+            for (unsigned int j = 0, pCount = t->getPassCount(); j < pCount; ++j)
+            {
+                t->getPassByIndex(j)->_nodeBinding = _node;
+            }
+        }
+    }
+
+    // Models sharing the material may draw other levels of detail of the mesh.
+    Technique* technique = material->getTechnique();
+    GP_ASSERT(technique);
+    if (technique->getPassCount() > 0)
+    {
+        VertexAttributeBinding* binding = technique->getPassByIndex(0)->getVertexAttributeBinding();
+        if (binding == NULL || binding->_mesh != mesh)
+            setMaterialMeshBinding(material, mesh);
+    }
+}
+
+bool Model::isShareable(const Material* material)
+{
+    GP_ASSERT(material);
+
+    if (material->hasResolvedAutoBindings())
+        return false;
+    for (unsigned int i = 0, tCount = material->getTechniqueCount(); i < tCount; ++i)
+    {
+        Technique* t = material->getTechniqueByIndex(i);
+        if (t->hasResolvedAutoBindings())
+            return false;
+        for (unsigned int j = 0, pCount = t->getPassCount(); j < pCount; ++j)
+        {
+            if (t->getPassByIndex(j)->hasResolvedAutoBindings())
+                return false;
+        }
+    }
+    return true;
+}
+
 Drawable* Model::clone(NodeCloneContext& context)
 {
     Model* model = Model::create(getMesh());
@@ -404,6 +835,13 @@ Drawable* Model::clone(NodeCloneContext& context)
         return NULL;
     }
 
+    for (size_t i = 0, count = _lods.size(); i < count; ++i)
+    {
+        model->addLod(_lods[i].mesh, _lods[i].screenSize);
+    }
+    model->_lodHysteresis = _lodHysteresis;
+    model->_instanceData = _instanceData;
+    model->setParameterBlock(_parameterBlock);
     if (getSkin())
     {
         model->setSkin(getSkin()->clone(context));
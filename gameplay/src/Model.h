@@ -4,13 +4,18 @@
 #include "Mesh.h"
 #include "MeshSkin.h"
 #include "Material.h"
+#include "MaterialParameterBlock.h"
 #include "Drawable.h"
 
+// The number of floats of each instance in an instance buffer: its world matrix, then its instance data.
+#define MODEL_INSTANCE_FLOATS 20
+
 namespace gameplay
 {
 
 class Bundle;
 class MeshSkin;
+class Camera;
 
 
 /**
@@ -18,6 +23,11 @@ class MeshSkin;
  *
  * A model has a mesh that can be drawn with the specified materials for
  * each of the mesh parts within it.
+ *
+ * A model may also have a chain of coarser level of detail (LOD) meshes, each used
+ * once the bounding sphere of the node covers less than a given fraction of the
+ * height of the viewport. A level is selected for the camera the model is drawn
+ * with, and the materials of the model are shared by all of its levels.
  */
 class Model : public Ref, public Drawable
 {
@@ -25,6 +35,9 @@ class Model : public Ref, public Drawable
     friend class Scene;
     friend class Mesh;
     friend class Bundle;
+    friend class RenderQueue;
+    friend class TerrainPatch;
+    friend class Prefab;
 
 public:
 
@@ -41,6 +54,122 @@ public:
      */
     Mesh* getMesh() const;
 
+    /**
+     * Adds a level of detail mesh, coarser than the last level of this model.
+     *
+     * The mesh is drawn when the bounding sphere of the node covers less than the given
+     * fraction of the height of the viewport, and more than the screen size of the next
+     * level (if any). The mesh must have as many parts as the mesh of this model, since
+     * the same materials are used to draw it.
+     *
+     * @param mesh The mesh of the new level.
+     * @param screenSize The screen size below which the mesh is drawn, smaller than the
+     *      screen size of the last level.
+     *
+     * @return true if the level was added, false if the mesh or screen size is not valid.
+     */
+    bool addLod(Mesh* mesh, float screenSize);
+
+    /**
+     * Returns the number of levels of detail of this model, including the Mesh of the model.
+     *
+     * @return The number of levels of detail.
+     */
+    unsigned int getLodCount() const;
+
+    /**
+     * Returns the mesh of a level of detail.
+     *
+     * @param level The level, where 0 is the Mesh of this model.
+     *
+     * @return The mesh of the level.
+     */
+    Mesh* getLodMesh(unsigned int level) const;
+
+    /**
+     * Returns the screen size below which a level of detail is drawn.
+     *
+     * @param level The level, where 0 is the Mesh of this model.
+     *
+     * @return The fraction of the height of the viewport, or FLT_MAX for level 0.
+     */
+    float getLodScreenSize(unsigned int level) const;
+
+    /**
+     * Sets the fraction of its screen size past which a level must be before it is switched to.
+     *
+     * A value of 0.1 makes a level switch to a coarser one at 90% of the screen size of
+     * the coarser level, and back at 110% of it, so that a node hovering at a threshold
+     * does not switch levels every frame. The default is 0.1.
+     *
+     * @param hysteresis The fraction, between 0 and 1.
+     */
+    void setLodHysteresis(float hysteresis);
+
+    /**
+     * Returns the fraction of its screen size past which a level must be before it is switched to.
+     *
+     * @return The fraction, between 0 and 1.
+     */
+    float getLodHysteresis() const;
+
+    /**
+     * Returns the level of detail selected by the last call to selectLod().
+     *
+     * @return The selected level, where 0 is the Mesh of this model.
+     */
+    unsigned int getLod() const;
+
+    /**
+     * Selects the level of detail to draw from the size of the node on the screen of a camera.
+     *
+     * This is called by draw() with the active camera of the scene, and by RenderQueue
+     * with its camera when the model is submitted.
+     *
+     * @param camera The camera the model is drawn with.
+     *
+     * @return The selected level, where 0 is the Mesh of this model.
+     */
+    unsigned int selectLod(Camera* camera);
+
+    /**
+     * Sets the vector that the vertex attribute bound to RenderState::INSTANCE_DATA is
+     * set to when this model is drawn, such as the time offset of a crowd member playing
+     * an AnimationTexture.
+     *
+     * When the model is drawn as one of the instances of an instanced draw, the vector
+     * is streamed into the instance buffer with its world matrix. The default is zero.
+     *
+     * @param data The instance data.
+     */
+    void setInstanceData(const Vector4& data);
+
+    /**
+     * Returns the vector that the vertex attribute bound to RenderState::INSTANCE_DATA is set to.
+     *
+     * @return The instance data.
+     */
+    const Vector4& getInstanceData() const;
+
+    /**
+     * Sets a block of material parameters that override those of the materials of this model.
+     *
+     * The parameters of the block are set after each pass of the materials is bound, so
+     * models can share a material while drawing with different values of some of its
+     * parameters. Models with different parameter blocks are not drawn as instances of the
+     * same instanced draw.
+     *
+     * @param block The parameter block, or NULL to draw with the parameters of the materials only.
+     */
+    void setParameterBlock(MaterialParameterBlock* block);
+
+    /**
+     * Returns the block of material parameters that override those of the materials of this model.
+     *
+     * @return The parameter block, or NULL if the model has none.
+     */
+    MaterialParameterBlock* getParameterBlock() const;
+
     /**
      * Returns the number of parts in the Mesh for this Model.
      *
@@ -134,7 +263,9 @@ public:
      * @see Drawable::draw
      *
      * Binds the vertex buffer and index buffers for the Mesh and
-     * all of its MeshPart's and draws the mesh geometry.
+     * all of its MeshPart's and draws the mesh geometry. If the model
+     * has levels of detail, the mesh of the level selected for the
+     * active camera of the scene is drawn.
      * Any other state necessary to render the Mesh, such as
      * rendering states, shader state, and so on, should be set
      * up before calling this method.
@@ -158,6 +289,18 @@ private:
      */
     ~Model();
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+    /**
+     * Allocates the memory of a model from the current ObjectPool.
+     */
+    static void* operator new(size_t size);
+
+    /**
+     * Returns the memory of a model to the ObjectPool it was allocated from.
+     */
+    static void operator delete(void* p);
+#endif
+
     /**
      * Hidden copy assignment operator.
      */
@@ -168,6 +311,43 @@ private:
      */
     void setNode(Node* node);
 
+    /**
+     * Draws a single mesh part with all of the passes of its material, or the
+     * whole mesh if it has no parts.
+     *
+     * @param partIndex The index of the mesh part to draw (ignored if the mesh has no parts).
+     * @param wireframe true if you want to request to draw the wireframe only.
+     * @param depthEqual true to draw over the depth of a depth pre-pass (see Pass::bindDepthEqual()).
+     */
+    void drawPart(unsigned int partIndex, bool wireframe, bool depthEqual = false);
+
+    /**
+     * Draws the depth of a single mesh part, or of the whole mesh if it has no parts,
+     * with the depth effect of the first pass of its material.
+     *
+     * @param partIndex The index of the mesh part to draw (ignored if the mesh has no parts).
+     *
+     * @return true if the depth was drawn, or false if the pass has no depth effect.
+     */
+    bool drawPartDepth(unsigned int partIndex);
+
+#ifdef GP_USE_INSTANCING
+    /**
+     * Draws a single mesh part, or the whole mesh if it has no parts, once for each
+     * of a range of instances in an instance buffer.
+     *
+     * Each instance is its world matrix followed by its instance data vector. Every pass
+     * of the part's material must bind a vertex attribute to RenderState::INSTANCE_WORLD_MATRIX,
+     * and may bind one to RenderState::INSTANCE_DATA.
+     *
+     * @param partIndex The index of the mesh part to draw (ignored if the mesh has no parts).
+     * @param instanceBuffer The vertex buffer holding the instances.
+     * @param instanceOffset The index of the first instance in the instance buffer to draw.
+     * @param instanceCount The number of instances to draw.
+     */
+    void drawPartInstanced(unsigned int partIndex, VertexBufferHandle instanceBuffer, unsigned int instanceOffset, unsigned int instanceCount);
+#endif
+
     /**
      * @see Drawable::clone
      */
@@ -185,13 +365,62 @@ private:
      */
     void setMaterialNodeBinding(Material *m);
 
+    /**
+     * Binds the vertex attributes of every pass of the specified material to a mesh.
+     */
+    void setMaterialMeshBinding(Material* material, Mesh* mesh);
+
+    /**
+     * Binds a material that is shared with the models of other nodes to the node of this model
+     * and the given mesh, before the model draws with it.
+     *
+     * Only the node that the built-in auto bindings are evaluated for changes, so the
+     * bindings are not resolved again.
+     */
+    void bindSharedMaterial(Material* material, Mesh* mesh);
+
+    /**
+     * Determines if a material can be shared by the models of several nodes.
+     */
+    static bool isShareable(const Material* material);
+
+    /**
+     * Computes the fraction of the height of the viewport of a camera covered by the bounding sphere of the node.
+     */
+    float computeScreenSize(Camera* camera) const;
+
+    /**
+     * Computes the level of detail selectLod() would select for a camera, without selecting it.
+     *
+     * This only reads the model, its node and the camera, so it may be called from any thread
+     * as long as their transforms are up to date.
+     */
+    unsigned int computeLod(Camera* camera) const;
+
+    /**
+     * Selects a level of detail, binding the vertex attributes of its mesh to the materials.
+     */
+    void setLod(unsigned int lod);
+
     void validatePartCount();
 
+    struct Lod
+    {
+        Mesh* mesh;
+        float screenSize;
+    };
+
     Mesh* _mesh;
     Material* _material;
     unsigned int _partCount;
     Material** _partMaterials;
     MeshSkin* _skin;
+    std::vector<Lod> _lods;
+    unsigned int _lod;
+    float _lodHysteresis;
+    Vector4 _instanceData;
+    MaterialParameterBlock* _parameterBlock;
+    bool _sharedMaterials;
 };
 
 }
@@ -0,0 +1,713 @@
+#include "Base.h"
+#include "NavigationMesh.h"
+#include "Bundle.h"
+#include "Game.h"
+#include "Model.h"
+#include "PhysicsCollisionObject.h"
+#include "Scene.h"
+#include "Terrain.h"
+
+// Size of the steps positions are quantized to for welding vertices.
+#define NAVIGATION_WELD_TOLERANCE 0.001f
+
+// The maximum number of cells of the triangle grid along each axis.
+#define NAVIGATION_MAX_GRID_CELLS 1024
+
+// The default number of triangle corridors kept in the path cache.
+#define NAVIGATION_PATH_CACHE_SIZE 256
+
+namespace gameplay
+{
+
+// Gets the closest point to p on the triangle abc (from Real-Time Collision Detection, 5.1.5).
+static Vector3 closestPointOnTriangle(const Vector3& p, const Vector3& a, const Vector3& b, const Vector3& c)
+{
+    const Vector3 ab = b - a;
+    const Vector3 ac = c - a;
+    const Vector3 ap = p - a;
+    const float d1 = ab.dot(ap);
+    const float d2 = ac.dot(ap);
+    if (d1 <= 0.0f && d2 <= 0.0f)
+        return a;
+
+    const Vector3 bp = p - b;
+    const float d3 = ab.dot(bp);
+    const float d4 = ac.dot(bp);
+    if (d3 >= 0.0f && d4 <= d3)
+        return b;
+
+    const float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+        return a + ab * (d1 / (d1 - d3));
+
+    const Vector3 cp = p - c;
+    const float d5 = ab.dot(cp);
+    const float d6 = ac.dot(cp);
+    if (d6 >= 0.0f && d5 <= d6)
+        return c;
+
+    const float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+        return a + ac * (d2 / (d2 - d6));
+
+    const float va = d3 * d6 - d5 * d4;
+    if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+    const float denom = 1.0f / (va + vb + vc);
+    return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+// Gets twice the signed area of the triangle abc on the X,Z plane.
+static float triangleArea2(const Vector3& a, const Vector3& b, const Vector3& c)
+{
+    return (c.x - a.x) * (b.z - a.z) - (b.x - a.x) * (c.z - a.z);
+}
+
+static bool isSamePoint(const Vector3& a, const Vector3& b)
+{
+    return a.distanceSquared(b) < NAVIGATION_WELD_TOLERANCE * NAVIGATION_WELD_TOLERANCE;
+}
+
+NavigationMesh::Path::Path(NavigationMesh* mesh)
+    : _mesh(mesh), _done(false), _found(false)
+{
+    _mesh->addRef();
+}
+
+NavigationMesh::Path::~Path()
+{
+    // The job writes to the path, so it must complete first.
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem && !_counter.isDone())
+        jobSystem->wait(&_counter);
+    SAFE_RELEASE(_mesh);
+}
+
+bool NavigationMesh::Path::isDone() const
+{
+    return _done;
+}
+
+bool NavigationMesh::Path::isFound() const
+{
+    return _done && _found;
+}
+
+const std::vector<Vector3>& NavigationMesh::Path::getPoints() const
+{
+    static const std::vector<Vector3> empty;
+    return _done ? _points : empty;
+}
+
+bool NavigationMesh::WeldKey::operator<(const WeldKey& other) const
+{
+    if (x != other.x)
+        return x < other.x;
+    if (y != other.y)
+        return y < other.y;
+    return z < other.z;
+}
+
+NavigationMesh::NavigationMesh()
+    : _cellSize(1.0f), _gridX(0.0f), _gridZ(0.0f), _gridColumns(0), _gridRows(0), _pathCacheSize(NAVIGATION_PATH_CACHE_SIZE)
+{
+}
+
+NavigationMesh::~NavigationMesh()
+{
+}
+
+NavigationMesh* NavigationMesh::create(const float* vertices, unsigned int vertexCount, const unsigned int* indices, unsigned int indexCount,
+                                       float maxSlope)
+{
+    GP_ASSERT(vertices);
+    GP_ASSERT(indices);
+
+    std::vector<Vector3> positions(vertexCount);
+    for (unsigned int i = 0; i < vertexCount; ++i)
+        positions[i].set(vertices + i * 3);
+
+    NavigationMesh* mesh = new NavigationMesh();
+    mesh->addTriangles(positions, indices, indexCount, cos(MATH_DEG_TO_RAD(maxSlope)));
+    if (!mesh->build())
+    {
+        GP_WARN("Navigation mesh has no walkable triangles.");
+        SAFE_RELEASE(mesh);
+    }
+    return mesh;
+}
+
+NavigationMesh* NavigationMesh::create(Scene* scene, float maxSlope)
+{
+    GP_ASSERT(scene);
+
+    NavigationMesh* mesh = new NavigationMesh();
+    const float minNormalY = cos(MATH_DEG_TO_RAD(maxSlope));
+    for (Node* node = scene->getFirstNode(); node != NULL; node = node->getNextSibling())
+        mesh->addNode(node, minNormalY);
+    if (!mesh->build())
+    {
+        GP_WARN("Scene '%s' has no walkable static geometry for a navigation mesh.", scene->getId());
+        SAFE_RELEASE(mesh);
+    }
+    return mesh;
+}
+
+NavigationMesh* NavigationMesh::create(Terrain* terrain, unsigned int sampleStep, float maxSlope)
+{
+    GP_ASSERT(terrain);
+
+    NavigationMesh* mesh = new NavigationMesh();
+    mesh->addTerrain(terrain, std::max(sampleStep, 1u), cos(MATH_DEG_TO_RAD(maxSlope)));
+    if (!mesh->build())
+    {
+        GP_WARN("Terrain has no walkable triangles for a navigation mesh.");
+        SAFE_RELEASE(mesh);
+    }
+    return mesh;
+}
+
+void NavigationMesh::addTriangles(const std::vector<Vector3>& vertices, const unsigned int* indices, unsigned int indexCount, float minNormalY)
+{
+    // Weld the vertices of the walkable triangles to the vertices already in the mesh.
+    std::vector<int> welded(vertices.size(), -1);
+    for (unsigned int i = 0; i + 2 < indexCount; i += 3)
+    {
+        const Vector3& a = vertices[indices[i]];
+        const Vector3& b = vertices[indices[i + 1]];
+        const Vector3& c = vertices[indices[i + 2]];
+        Vector3 normal;
+        Vector3::cross(b - a, c - a, &normal);
+        const float length = normal.length();
+        if (length < MATH_EPSILON || normal.y / length < minNormalY)
+            continue;
+
+        Triangle triangle;
+        for (unsigned int j = 0; j < 3; ++j)
+        {
+            const unsigned int index = indices[i + j];
+            if (welded[index] < 0)
+            {
+                const Vector3& v = vertices[index];
+                WeldKey key;
+                key.x = (int)floor(v.x / NAVIGATION_WELD_TOLERANCE + 0.5f);
+                key.y = (int)floor(v.y / NAVIGATION_WELD_TOLERANCE + 0.5f);
+                key.z = (int)floor(v.z / NAVIGATION_WELD_TOLERANCE + 0.5f);
+                std::map<WeldKey, unsigned int>::const_iterator itr = _weldedVertices.find(key);
+                if (itr != _weldedVertices.end())
+                {
+                    welded[index] = (int)itr->second;
+                }
+                else
+                {
+                    welded[index] = (int)_vertices.size();
+                    _weldedVertices[key] = (unsigned int)_vertices.size();
+                    _vertices.push_back(v);
+                }
+            }
+            triangle.vertices[j] = (unsigned int)welded[index];
+            triangle.neighbors[j] = -1;
+        }
+
+        // Triangles smaller than the weld tolerance collapse.
+        if (triangle.vertices[0] == triangle.vertices[1] || triangle.vertices[1] == triangle.vertices[2] ||
+            triangle.vertices[2] == triangle.vertices[0])
+            continue;
+        _triangles.push_back(triangle);
+    }
+}
+
+void NavigationMesh::addNode(Node* node, float minNormalY)
+{
+    Terrain* terrain = dynamic_cast<Terrain*>(node->getDrawable());
+    Model* model = dynamic_cast<Model*>(node->getDrawable());
+    PhysicsCollisionObject* collisionObject = node->getCollisionObject();
+    if (terrain)
+    {
+        addTerrain(terrain, 1, minNormalY);
+    }
+    else if (model && collisionObject && collisionObject->isStatic())
+    {
+        // Mesh vertices are only kept on the GPU, so they are read back from the bundle.
+        Mesh* mesh = model->getMesh();
+        Bundle::MeshData* data = strlen(mesh->getUrl()) > 0 ? Bundle::readMeshData(mesh->getUrl()) : NULL;
+        if (data)
+        {
+            const Matrix& world = node->getWorldMatrix();
+            const unsigned int vertexStride = data->vertexFormat.getVertexSize();
+            std::vector<Vector3> vertices(data->vertexCount);
+            for (unsigned int i = 0; i < data->vertexCount; ++i)
+            {
+                vertices[i].set((const float*)&data->vertexData[i * vertexStride]);
+                world.transformPoint(&vertices[i]);
+            }
+
+            std::vector<unsigned int> indices;
+            if (data->parts.empty())
+            {
+                if (data->primitiveType == Mesh::TRIANGLES)
+                {
+                    indices.resize(data->vertexCount);
+                    for (unsigned int i = 0; i < data->vertexCount; ++i)
+                        indices[i] = i;
+                }
+            }
+            for (size_t i = 0, count = data->parts.size(); i < count; ++i)
+            {
+                const Bundle::MeshPartData* part = data->parts[i];
+                if (part->primitiveType != Mesh::TRIANGLES)
+                    continue;
+                for (unsigned int j = 0; j < part->indexCount; ++j)
+                {
+                    switch (part->indexFormat)
+                    {
+                    case Mesh::INDEX8:
+                        indices.push_back(((const unsigned char*)part->indexData)[j]);
+                        break;
+                    case Mesh::INDEX16:
+                        indices.push_back(((const unsigned short*)part->indexData)[j]);
+                        break;
+                    case Mesh::INDEX32:
+                        indices.push_back(((const unsigned int*)part->indexData)[j]);
+                        break;
+                    }
+                }
+            }
+            if (indices.empty())
+                GP_WARN("Navigation mesh ignores node '%s', since its mesh has no TRIANGLES.", node->getId());
+            else
+                addTriangles(vertices, &indices[0], (unsigned int)indices.size(), minNormalY);
+            SAFE_DELETE(data);
+        }
+    }
+
+    for (Node* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+        addNode(child, minNormalY);
+}
+
+void NavigationMesh::addTerrain(Terrain* terrain, unsigned int sampleStep, float minNormalY)
+{
+    HeightField* heightfield = terrain->_heightfield;
+    GP_ASSERT(heightfield);
+    const unsigned int columns = heightfield->getColumnCount();
+    const unsigned int rows = heightfield->getRowCount();
+    if (columns < 2 || rows < 2)
+        return;
+
+    // Sample the heightfield as the terrain patches do, centered on the origin of the terrain.
+    std::vector<unsigned int> sampleColumns;
+    std::vector<unsigned int> sampleRows;
+    for (unsigned int i = 0; i < columns - 1; i += sampleStep)
+        sampleColumns.push_back(i);
+    sampleColumns.push_back(columns - 1);
+    for (unsigned int i = 0; i < rows - 1; i += sampleStep)
+        sampleRows.push_back(i);
+    sampleRows.push_back(rows - 1);
+
+    const unsigned int width = (unsigned int)sampleColumns.size();
+    const unsigned int height = (unsigned int)sampleRows.size();
+    const Matrix& world = terrain->_node ? terrain->_node->getWorldMatrix() : Matrix::identity();
+    const Vector3& scale = terrain->_localScale;
+    std::vector<Vector3> vertices(width * height);
+    for (unsigned int z = 0; z < height; ++z)
+    {
+        for (unsigned int x = 0; x < width; ++x)
+        {
+            Vector3& v = vertices[z * width + x];
+            v.set((sampleColumns[x] - (columns - 1) * 0.5f) * scale.x,
+                  heightfield->getHeight((float)sampleColumns[x], (float)sampleRows[z]) * scale.y,
+                  (sampleRows[z] - (rows - 1) * 0.5f) * scale.z);
+            world.transformPoint(&v);
+        }
+    }
+
+    // Two triangles per cell, wound to face up.
+    std::vector<unsigned int> indices;
+    indices.reserve((width - 1) * (height - 1) * 6);
+    for (unsigned int z = 0; z + 1 < height; ++z)
+    {
+        for (unsigned int x = 0; x + 1 < width; ++x)
+        {
+            const unsigned int i = z * width + x;
+            indices.push_back(i);
+            indices.push_back(i + width);
+            indices.push_back(i + 1);
+            indices.push_back(i + 1);
+            indices.push_back(i + width);
+            indices.push_back(i + width + 1);
+        }
+    }
+    addTriangles(vertices, &indices[0], (unsigned int)indices.size(), minNormalY);
+}
+
+bool NavigationMesh::build()
+{
+    _weldedVertices.clear();
+    if (_triangles.empty())
+        return false;
+
+    // Connect the triangles through the edges they share.
+    std::map<std::pair<unsigned int, unsigned int>, std::pair<int, int> > edges;
+    for (size_t i = 0, count = _triangles.size(); i < count; ++i)
+    {
+        Triangle& triangle = _triangles[i];
+        for (int j = 0; j < 3; ++j)
+        {
+            const unsigned int a = triangle.vertices[j];
+            const unsigned int b = triangle.vertices[(j + 1) % 3];
+            std::pair<unsigned int, unsigned int> key(std::min(a, b), std::max(a, b));
+            std::map<std::pair<unsigned int, unsigned int>, std::pair<int, int> >::iterator itr = edges.find(key);
+            if (itr == edges.end())
+            {
+                edges[key] = std::make_pair((int)i, j);
+            }
+            else if (itr->second.first >= 0)
+            {
+                // Edges shared by more than two triangles only connect the first two.
+                _triangles[itr->second.first].neighbors[itr->second.second] = (int)i;
+                triangle.neighbors[j] = itr->second.first;
+                itr->second.first = -1;
+            }
+        }
+        triangle.center = (_vertices[triangle.vertices[0]] + _vertices[triangle.vertices[1]] + _vertices[triangle.vertices[2]]) * (1.0f / 3.0f);
+    }
+
+    // Size the grid cells to hold a couple of triangles each.
+    float minX = FLT_MAX, minZ = FLT_MAX, maxX = -FLT_MAX, maxZ = -FLT_MAX;
+    for (size_t i = 0, count = _vertices.size(); i < count; ++i)
+    {
+        minX = std::min(minX, _vertices[i].x);
+        minZ = std::min(minZ, _vertices[i].z);
+        maxX = std::max(maxX, _vertices[i].x);
+        maxZ = std::max(maxZ, _vertices[i].z);
+    }
+    const float area = std::max((maxX - minX) * (maxZ - minZ), MATH_EPSILON);
+    _cellSize = std::max(sqrt(area / _triangles.size()) * 2.0f, NAVIGATION_WELD_TOLERANCE);
+    _cellSize = std::max(_cellSize, std::max(maxX - minX, maxZ - minZ) / NAVIGATION_MAX_GRID_CELLS);
+    _gridX = minX;
+    _gridZ = minZ;
+    _gridColumns = std::min((unsigned int)((maxX - minX) / _cellSize) + 1, (unsigned int)NAVIGATION_MAX_GRID_CELLS);
+    _gridRows = std::min((unsigned int)((maxZ - minZ) / _cellSize) + 1, (unsigned int)NAVIGATION_MAX_GRID_CELLS);
+
+    // Bin the triangles into the cells their bounds overlap, counting them first.
+    _cellStarts.assign(_gridColumns * _gridRows + 1, 0);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (size_t i = 0, count = _triangles.size(); i < count; ++i)
+        {
+            const Triangle& triangle = _triangles[i];
+            float x1 = FLT_MAX, z1 = FLT_MAX, x2 = -FLT_MAX, z2 = -FLT_MAX;
+            for (int j = 0; j < 3; ++j)
+            {
+                const Vector3& v = _vertices[triangle.vertices[j]];
+                x1 = std::min(x1, v.x);
+                z1 = std::min(z1, v.z);
+                x2 = std::max(x2, v.x);
+                z2 = std::max(z2, v.z);
+            }
+            const unsigned int column2 = std::min((unsigned int)((x2 - _gridX) / _cellSize), _gridColumns - 1);
+            const unsigned int row2 = std::min((unsigned int)((z2 - _gridZ) / _cellSize), _gridRows - 1);
+            for (unsigned int row = std::min((unsigned int)((z1 - _gridZ) / _cellSize), _gridRows - 1); row <= row2; ++row)
+            {
+                for (unsigned int column = std::min((unsigned int)((x1 - _gridX) / _cellSize), _gridColumns - 1); column <= column2; ++column)
+                {
+                    const unsigned int cell = row * _gridColumns + column;
+                    if (pass == 0)
+                        ++_cellStarts[cell + 1];
+                    else
+                        _cellTriangles[_cellStarts[cell]++] = (unsigned int)i;
+                }
+            }
+        }
+
+        if (pass == 0)
+        {
+            for (size_t i = 1, count = _cellStarts.size(); i < count; ++i)
+                _cellStarts[i] += _cellStarts[i - 1];
+            _cellTriangles.resize(_cellStarts.back());
+        }
+    }
+
+    // Filling the cells advanced each start to the start of the next cell.
+    for (size_t i = _cellStarts.size() - 1; i > 0; --i)
+        _cellStarts[i] = _cellStarts[i - 1];
+    _cellStarts[0] = 0;
+    return true;
+}
+
+unsigned int NavigationMesh::getTriangleCount() const
+{
+    return (unsigned int)_triangles.size();
+}
+
+int NavigationMesh::findNearestTriangle(const Vector3& point, Vector3* nearest) const
+{
+    if (_triangles.empty())
+        return -1;
+
+    const int column = (int)MATH_CLAMP(floor((point.x - _gridX) / _cellSize), 0.0f, (float)(_gridColumns - 1));
+    const int row = (int)MATH_CLAMP(floor((point.z - _gridZ) / _cellSize), 0.0f, (float)(_gridRows - 1));
+    const int maxRing = (int)std::max(_gridColumns, _gridRows);
+
+    // Search rings of cells around the point until the next ring is further than the nearest triangle found.
+    int nearestTriangle = -1;
+    float nearestDistance = FLT_MAX;
+    for (int ring = 0; ring <= maxRing; ++ring)
+    {
+        for (int z = row - ring; z <= row + ring; ++z)
+        {
+            if (z < 0 || z >= (int)_gridRows)
+                continue;
+            const int step = (z == row - ring || z == row + ring) ? 1 : std::max(ring * 2, 1);
+            for (int x = column - ring; x <= column + ring; x += step)
+            {
+                if (x < 0 || x >= (int)_gridColumns)
+                    continue;
+                const unsigned int cell = z * _gridColumns + x;
+                for (unsigned int i = _cellStarts[cell]; i < _cellStarts[cell + 1]; ++i)
+                {
+                    const Triangle& triangle = _triangles[_cellTriangles[i]];
+                    const Vector3 p = closestPointOnTriangle(point, _vertices[triangle.vertices[0]], _vertices[triangle.vertices[1]],
+                                                             _vertices[triangle.vertices[2]]);
+                    const float distance = p.distanceSquared(point);
+                    if (distance < nearestDistance)
+                    {
+                        nearestDistance = distance;
+                        nearestTriangle = (int)_cellTriangles[i];
+                        *nearest = p;
+                    }
+                }
+            }
+        }
+
+        const float ringDistance = ring * _cellSize;
+        if (nearestTriangle >= 0 && nearestDistance <= ringDistance * ringDistance)
+            break;
+    }
+    return nearestTriangle;
+}
+
+bool NavigationMesh::findNearestPoint(const Vector3& point, Vector3* nearest) const
+{
+    GP_ASSERT(nearest);
+
+    return findNearestTriangle(point, nearest) >= 0;
+}
+
+bool NavigationMesh::findCorridor(int start, int end, std::vector<int>* corridor) const
+{
+    corridor->clear();
+    if (start == end)
+    {
+        corridor->push_back(start);
+        return true;
+    }
+
+    const std::pair<int, int> key(start, end);
+    if (_pathCacheSize > 0)
+    {
+        std::lock_guard<std::mutex> lock(_pathCacheMutex);
+        std::map<std::pair<int, int>, std::vector<int> >::const_iterator itr = _pathCache.find(key);
+        if (itr != _pathCache.end())
+        {
+            *corridor = itr->second;
+            return true;
+        }
+    }
+
+    // A* search over the triangles, moving between their centers.
+    const size_t count = _triangles.size();
+    std::vector<float> costs(count, FLT_MAX);
+    std::vector<int> parents(count, -1);
+    std::vector<bool> closed(count, false);
+    std::priority_queue<std::pair<float, int>, std::vector<std::pair<float, int> >, std::greater<std::pair<float, int> > > open;
+    const Vector3& goal = _triangles[end].center;
+    costs[start] = 0.0f;
+    open.push(std::make_pair(_triangles[start].center.distance(goal), start));
+    while (!open.empty())
+    {
+        const int current = open.top().second;
+        open.pop();
+        if (current == end)
+            break;
+        if (closed[current])
+            continue;
+        closed[current] = true;
+
+        const Triangle& triangle = _triangles[current];
+        for (int i = 0; i < 3; ++i)
+        {
+            const int neighbor = triangle.neighbors[i];
+            if (neighbor < 0 || closed[neighbor])
+                continue;
+            const float cost = costs[current] + triangle.center.distance(_triangles[neighbor].center);
+            if (cost < costs[neighbor])
+            {
+                costs[neighbor] = cost;
+                parents[neighbor] = current;
+                open.push(std::make_pair(cost + _triangles[neighbor].center.distance(goal), neighbor));
+            }
+        }
+    }
+    if (parents[end] < 0)
+        return false;
+
+    for (int triangle = end; triangle >= 0; triangle = parents[triangle])
+        corridor->push_back(triangle);
+    std::reverse(corridor->begin(), corridor->end());
+
+    if (_pathCacheSize > 0)
+    {
+        std::lock_guard<std::mutex> lock(_pathCacheMutex);
+        if (_pathCache.size() >= _pathCacheSize)
+            _pathCache.clear();
+        _pathCache[key] = *corridor;
+    }
+    return true;
+}
+
+void NavigationMesh::straightenPath(const Vector3& start, const Vector3& end, const std::vector<int>& corridor, std::vector<Vector3>* points) const
+{
+    // Gather the edges crossed by the corridor as portals, with their left and right ends as seen crossing them.
+    std::vector<Vector3> lefts;
+    std::vector<Vector3> rights;
+    lefts.push_back(start);
+    rights.push_back(start);
+    for (size_t i = 0; i + 1 < corridor.size(); ++i)
+    {
+        const Triangle& triangle = _triangles[corridor[i]];
+        for (int j = 0; j < 3; ++j)
+        {
+            if (triangle.neighbors[j] == corridor[i + 1])
+            {
+                const Vector3& a = _vertices[triangle.vertices[j]];
+                const Vector3& b = _vertices[triangle.vertices[(j + 1) % 3]];
+                const bool ordered = triangleArea2(triangle.center, a, b) >= 0.0f;
+                lefts.push_back(ordered ? a : b);
+                rights.push_back(ordered ? b : a);
+                break;
+            }
+        }
+    }
+    lefts.push_back(end);
+    rights.push_back(end);
+
+    // Pull the path tight through the portals (the simple stupid funnel algorithm).
+    points->clear();
+    points->push_back(start);
+    Vector3 apex = start;
+    Vector3 left = start;
+    Vector3 right = start;
+    int apexIndex = 0;
+    int leftIndex = 0;
+    int rightIndex = 0;
+    const int portalCount = (int)lefts.size();
+    for (int i = 1; i < portalCount; ++i)
+    {
+        // Narrow the right side of the funnel, or turn around the left corner once they cross.
+        if (triangleArea2(apex, right, rights[i]) <= 0.0f)
+        {
+            if (isSamePoint(apex, right) || triangleArea2(apex, left, rights[i]) > 0.0f)
+            {
+                right = rights[i];
+                rightIndex = i;
+            }
+            else
+            {
+                points->push_back(left);
+                apex = left;
+                apexIndex = leftIndex;
+                right = apex;
+                rightIndex = apexIndex;
+                i = apexIndex;
+                continue;
+            }
+        }
+
+        // Likewise for the left side.
+        if (triangleArea2(apex, left, lefts[i]) >= 0.0f)
+        {
+            if (isSamePoint(apex, left) || triangleArea2(apex, right, lefts[i]) < 0.0f)
+            {
+                left = lefts[i];
+                leftIndex = i;
+            }
+            else
+            {
+                points->push_back(right);
+                apex = right;
+                apexIndex = rightIndex;
+                left = apex;
+                leftIndex = apexIndex;
+                i = apexIndex;
+                continue;
+            }
+        }
+    }
+
+    if (!isSamePoint(points->back(), end))
+        points->push_back(end);
+}
+
+bool NavigationMesh::findPath(const Vector3& start, const Vector3& end, std::vector<Vector3>* points) const
+{
+    GP_ASSERT(points);
+
+    points->clear();
+    Vector3 startPoint;
+    Vector3 endPoint;
+    const int startTriangle = findNearestTriangle(start, &startPoint);
+    const int endTriangle = findNearestTriangle(end, &endPoint);
+    if (startTriangle < 0 || endTriangle < 0)
+        return false;
+
+    std::vector<int> corridor;
+    if (!findCorridor(startTriangle, endTriangle, &corridor))
+        return false;
+
+    straightenPath(startPoint, endPoint, corridor, points);
+    return true;
+}
+
+NavigationMesh::Path* NavigationMesh::findPathAsync(const Vector3& start, const Vector3& end)
+{
+    Path* path = new Path(this);
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem)
+    {
+        // The path waits for the job when it is destroyed, and holds this mesh until then.
+        jobSystem->run([this, path, start, end]()
+        {
+            path->_found = findPath(start, end, &path->_points);
+            path->_done = true;
+        }, &path->_counter);
+    }
+    else
+    {
+        path->_found = findPath(start, end, &path->_points);
+        path->_done = true;
+    }
+    return path;
+}
+
+void NavigationMesh::setPathCacheSize(unsigned int size)
+{
+    std::lock_guard<std::mutex> lock(_pathCacheMutex);
+    _pathCacheSize = size;
+    if (_pathCache.size() > size)
+        _pathCache.clear();
+}
+
+unsigned int NavigationMesh::getPathCacheSize() const
+{
+    return _pathCacheSize;
+}
+
+void NavigationMesh::clearPathCache()
+{
+    std::lock_guard<std::mutex> lock(_pathCacheMutex);
+    _pathCache.clear();
+}
+
+}
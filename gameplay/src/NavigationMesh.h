@@ -0,0 +1,298 @@
+#ifndef NAVIGATIONMESH_H_
+#define NAVIGATIONMESH_H_
+
+#include "Ref.h"
+#include "Vector3.h"
+#include "JobSystem.h"
+
+namespace gameplay
+{
+
+class Node;
+class Scene;
+class Terrain;
+
+/**
+ * Defines a navigation mesh, the walkable surface that AI agents find paths across.
+ *
+ * A navigation mesh is made of the triangles of its source geometry that are flat enough
+ * to walk on, connected through their shared edges. Paths are found with an A* search over
+ * the triangles, and straightened through the edges they cross so that agents walk directly
+ * between the corners they have to go around.
+ *
+ * Finding a path in a large mesh can take longer than a frame, so paths can be found
+ * asynchronously on the JobSystem with findPathAsync(). The corridors of triangles found
+ * between two triangles are cached, so queries between the same areas of the mesh skip the
+ * search. A navigation mesh is not changed after it is created, so it can be queried from
+ * any number of threads at once.
+ *
+ * AIAgent::moveTo() moves the node of an agent along a path found in a navigation mesh.
+ *
+ * @script{ignore}
+ */
+class NavigationMesh : public Ref
+{
+    friend class AIAgent;
+
+public:
+
+    /**
+     * Defines a path being found asynchronously by NavigationMesh::findPathAsync().
+     */
+    class Path : public Ref
+    {
+        friend class NavigationMesh;
+
+    public:
+
+        /**
+         * Determines if the search for the path has completed.
+         *
+         * @return true if the search has completed, false if it is still running.
+         */
+        bool isDone() const;
+
+        /**
+         * Determines if a path was found.
+         *
+         * @return true if the search has completed and found a path, false otherwise.
+         */
+        bool isFound() const;
+
+        /**
+         * Gets the points of the path, from its start to its end.
+         *
+         * @return The points of the path, which are empty until the search has completed and found one.
+         */
+        const std::vector<Vector3>& getPoints() const;
+
+    private:
+
+        /**
+         * Constructor.
+         */
+        Path(NavigationMesh* mesh);
+
+        /**
+         * Destructor, which waits for the search to complete.
+         */
+        ~Path();
+
+        /**
+         * Hidden copy constructor.
+         */
+        Path(const Path&);
+
+        /**
+         * Hidden copy assignment operator.
+         */
+        Path& operator=(const Path&);
+
+        NavigationMesh* _mesh;
+        JobSystem::Counter _counter;
+        std::atomic<bool> _done;
+        bool _found;
+        std::vector<Vector3> _points;
+    };
+
+    /**
+     * Creates a navigation mesh from triangles.
+     *
+     * Vertices closer than a millimeter are welded, so triangles that do not share vertices
+     * but touch are still connected.
+     *
+     * @param vertices The positions of the vertices, three floats per vertex.
+     * @param vertexCount The number of vertices.
+     * @param indices The indices of the triangles, three per triangle.
+     * @param indexCount The number of indices.
+     * @param maxSlope The steepest slope that can be walked, in degrees from horizontal.
+     *
+     * @return The new navigation mesh, or NULL if none of the triangles can be walked.
+     */
+    static NavigationMesh* create(const float* vertices, unsigned int vertexCount, const unsigned int* indices, unsigned int indexCount,
+                                  float maxSlope = 45.0f);
+
+    /**
+     * Creates a navigation mesh from the static geometry of a scene.
+     *
+     * The static geometry is the models of nodes with a static collision object, and the
+     * terrains of the scene. The vertices of models are read from the bundles they were loaded
+     * from, so models created at runtime are ignored. Only meshes of TRIANGLES are supported.
+     *
+     * @param scene The scene.
+     * @param maxSlope The steepest slope that can be walked, in degrees from horizontal.
+     *
+     * @return The new navigation mesh, or NULL if the scene has no walkable static geometry.
+     */
+    static NavigationMesh* create(Scene* scene, float maxSlope = 45.0f);
+
+    /**
+     * Creates a navigation mesh from a terrain.
+     *
+     * @param terrain The terrain.
+     * @param sampleStep The number of heightfield samples between the vertices of the navigation mesh.
+     * @param maxSlope The steepest slope that can be walked, in degrees from horizontal.
+     *
+     * @return The new navigation mesh, or NULL if none of the terrain can be walked.
+     */
+    static NavigationMesh* create(Terrain* terrain, unsigned int sampleStep = 1, float maxSlope = 45.0f);
+
+    /**
+     * Gets the number of walkable triangles in the navigation mesh.
+     *
+     * @return The number of triangles.
+     */
+    unsigned int getTriangleCount() const;
+
+    /**
+     * Finds the point of the navigation mesh nearest to the specified point.
+     *
+     * @param point The point.
+     * @param nearest Populated with the nearest point of the navigation mesh.
+     *
+     * @return true if a point was found, false if the mesh is empty.
+     */
+    bool findNearestPoint(const Vector3& point, Vector3* nearest) const;
+
+    /**
+     * Finds a path between two points, on the calling thread.
+     *
+     * The points are moved to the nearest points of the navigation mesh.
+     *
+     * @param start The start of the path.
+     * @param end The end of the path.
+     * @param points Populated with the points of the path, from its start to its end.
+     *
+     * @return true if a path was found, false if the points are not connected.
+     */
+    bool findPath(const Vector3& start, const Vector3& end, std::vector<Vector3>* points) const;
+
+    /**
+     * Finds a path between two points, asynchronously on the JobSystem.
+     *
+     * The path is found by a job. Its points can be read once Path::isDone() returns true.
+     * The returned path holds a reference to this navigation mesh.
+     *
+     * @param start The start of the path.
+     * @param end The end of the path.
+     *
+     * @return The path being found, which must be released by the caller.
+     */
+    Path* findPathAsync(const Vector3& start, const Vector3& end);
+
+    /**
+     * Sets the maximum number of triangle corridors kept in the path cache.
+     *
+     * Once the cache is full, it is emptied when the next corridor is added. The default is 256.
+     *
+     * @param size The size of the cache, or zero to disable the cache.
+     */
+    void setPathCacheSize(unsigned int size);
+
+    /**
+     * Gets the maximum number of triangle corridors kept in the path cache.
+     *
+     * @return The size of the cache.
+     */
+    unsigned int getPathCacheSize() const;
+
+    /**
+     * Empties the path cache.
+     */
+    void clearPathCache();
+
+private:
+
+    struct WeldKey
+    {
+        int x;
+        int y;
+        int z;
+
+        bool operator<(const WeldKey& other) const;
+    };
+
+    struct Triangle
+    {
+        unsigned int vertices[3];
+        int neighbors[3];           // Triangle across the edge from vertices[i] to vertices[i + 1], or -1
+        Vector3 center;
+    };
+
+    /**
+     * Constructor.
+     */
+    NavigationMesh();
+
+    /**
+     * Destructor.
+     */
+    ~NavigationMesh();
+
+    /**
+     * Hidden copy constructor.
+     */
+    NavigationMesh(const NavigationMesh&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    NavigationMesh& operator=(const NavigationMesh&);
+
+    /**
+     * Adds the walkable triangles of indexed vertices, welding vertices to the ones already added.
+     */
+    void addTriangles(const std::vector<Vector3>& vertices, const unsigned int* indices, unsigned int indexCount, float minNormalY);
+
+    /**
+     * Adds the walkable geometry of a scene node and its children.
+     */
+    void addNode(Node* node, float minNormalY);
+
+    /**
+     * Adds the walkable triangles of a terrain.
+     */
+    void addTerrain(Terrain* terrain, unsigned int sampleStep, float minNormalY);
+
+    /**
+     * Connects the triangles through their shared edges and builds the grid used to find them.
+     *
+     * @return true if the mesh has any triangles, false otherwise.
+     */
+    bool build();
+
+    /**
+     * Finds the triangle nearest to a point, and the nearest point on it.
+     *
+     * @return The index of the triangle, or -1 if the mesh is empty.
+     */
+    int findNearestTriangle(const Vector3& point, Vector3* nearest) const;
+
+    /**
+     * Finds the corridor of triangles between two triangles, from the cache or with an A* search.
+     */
+    bool findCorridor(int start, int end, std::vector<int>* corridor) const;
+
+    /**
+     * Straightens a path between two points through the edges between the triangles of a corridor.
+     */
+    void straightenPath(const Vector3& start, const Vector3& end, const std::vector<int>& corridor, std::vector<Vector3>* points) const;
+
+    std::vector<Vector3> _vertices;
+    std::vector<Triangle> _triangles;
+    std::map<WeldKey, unsigned int> _weldedVertices;                // Vertex index, by quantized position, while building
+    float _cellSize;                                                // Size of the cells of the triangle grid, on the X,Z plane
+    float _gridX;                                                   // Position of the grid, on the X,Z plane
+    float _gridZ;
+    unsigned int _gridColumns;
+    unsigned int _gridRows;
+    std::vector<unsigned int> _cellStarts;                          // First entry of each cell in the cell triangles, and the end
+    std::vector<unsigned int> _cellTriangles;                       // Triangles overlapping each cell
+    unsigned int _pathCacheSize;
+    mutable std::map<std::pair<int, int>, std::vector<int> > _pathCache;
+    mutable std::mutex _pathCacheMutex;
+};
+
+}
+
+#endif
@@ -9,30 +9,32 @@
 #include "PhysicsGhostObject.h"
 #include "PhysicsCharacter.h"
 #include "Terrain.h"
+#include "StreamingTerrain.h"
+#include "ParticleEmitter.h"
 #include "Game.h"
 #include "Drawable.h"
 #include "Form.h"
 #include "Ref.h"
+#include "ObjectPool.h"
 
 // Node dirty flags
 #define NODE_DIRTY_WORLD 1
 #define NODE_DIRTY_BOUNDS 2
 #define NODE_DIRTY_HIERARCHY 4
-#define NODE_DIRTY_ALL (NODE_DIRTY_WORLD | NODE_DIRTY_BOUNDS | NODE_DIRTY_HIERARCHY)
+#define NODE_DIRTY_SPATIAL 8
+#define NODE_DIRTY_CONTENT_BOUNDS 16
+#define NODE_DIRTY_ALL (NODE_DIRTY_WORLD | NODE_DIRTY_BOUNDS | NODE_DIRTY_HIERARCHY | NODE_DIRTY_CONTENT_BOUNDS)
 
 namespace gameplay
 {
 
 Node::Node(const char* id)
-    : _scene(NULL), _firstChild(NULL), _nextSibling(NULL), _prevSibling(NULL), _parent(NULL), _childCount(0), _enabled(true), _tags(NULL),
+    : _scene(NULL), _id(0), _firstChild(NULL), _nextSibling(NULL), _prevSibling(NULL), _parent(NULL), _childCount(0), _enabled(true), _tags(NULL),
     _drawable(NULL), _camera(NULL), _light(NULL), _audioSource(NULL), _collisionObject(NULL), _agent(NULL), _userObject(NULL),
-      _dirtyBits(NODE_DIRTY_ALL)
+      _dirtyBits(NODE_DIRTY_ALL), _spatialProxy(-1), _occluded(false), _visibleFrame(0)
 {
     GP_REGISTER_SCRIPT_EVENTS();
-    if (id)
-    {
-        _id = id;
-    }
+    _id = StringTable::intern(id);
 }
 
 Node::~Node()
@@ -53,6 +55,18 @@ Node::~Node()
     setAgent(NULL);
 }
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+void* Node::operator new(size_t size)
+{
+    return ObjectPool::allocate(size);
+}
+
+void Node::operator delete(void* p)
+{
+    ObjectPool::deallocate(p);
+}
+#endif
+
 Node* Node::create(const char* id)
 {
     return new Node(id);
@@ -65,14 +79,28 @@ const char* Node::getTypeName() const
 
 const char* Node::getId() const
 {
-    return _id.c_str();
+    return StringTable::get(_id);
 }
 
 void Node::setId(const char* id)
 {
     if (id)
     {
-        _id = id;
+        // Re-key this node in the node index of its scene, and its agent in the AI controller.
+        Scene* scene = getScene();
+        bool indexed = scene && scene->_nodeIndex;
+        AIController* aiController = _agent ? Game::getInstance()->getAIController() : NULL;
+        if (indexed)
+            scene->removeIndexedNode(this);
+        if (aiController)
+            aiController->removeIndexedAgent(_agent, getId());
+
+        _id = StringTable::intern(id);
+
+        if (aiController)
+            aiController->addIndexedAgent(_agent);
+        if (indexed)
+            scene->addIndexedNode(this);
     }
 }
 
@@ -120,7 +148,11 @@ void Node::addChild(Node* child)
     }
     child->_parent = this;
     ++_childCount;
-    setBoundsDirty();
+    setHierarchyBoundsDirty();
+
+    Scene* scene = getScene();
+    if (scene)
+        scene->hierarchyAdded(child);
 
     if (_dirtyBits & NODE_DIRTY_HIERARCHY)
     {
@@ -176,6 +208,14 @@ void Node::remove()
     _prevSibling = NULL;
     _parent = NULL;
 
+    if (parent)
+    {
+        parent->setHierarchyBoundsDirty();
+        Scene* scene = parent->getScene();
+        if (scene)
+            scene->hierarchyRemoved(this);
+    }
+
     if (parent && parent->_dirtyBits & NODE_DIRTY_HIERARCHY)
     {
         parent->hierarchyChanged();
@@ -219,10 +259,17 @@ Node* Node::getRootNode() const
 
 Node* Node::findNode(const char* id, bool recursive, bool exactMatch) const
 {
-    return findNode(id, recursive, exactMatch, false);
+    GP_ASSERT(id);
+
+    // No node can have an ID that was never interned.
+    const unsigned int handle = StringTable::find(id);
+    if (exactMatch && handle == STRING_TABLE_NOT_FOUND)
+        return NULL;
+
+    return findNode(id, handle, recursive, exactMatch, false);
 }
 
-Node* Node::findNode(const char* id, bool recursive, bool exactMatch, bool skipSkin) const
+Node* Node::findNode(const char* id, unsigned int handle, bool recursive, bool exactMatch, bool skipSkin) const
 {
     GP_ASSERT(id);
 
@@ -236,10 +283,10 @@ Node* Node::findNode(const char* id, bool recursive, bool exactMatch, bool skipS
         {
             if (model->getSkin() != NULL && (rootNode = model->getSkin()->_rootNode) != NULL)
             {
-                if ((exactMatch && rootNode->_id == id) || (!exactMatch && rootNode->_id.find(id) == 0))
+                if (rootNode->matchesId(id, handle, exactMatch))
                     return rootNode;
 
-                Node* match = rootNode->findNode(id, true, exactMatch, true);
+                Node* match = rootNode->findNode(id, handle, true, exactMatch, true);
                 if (match)
                 {
                     return match;
@@ -251,7 +298,7 @@ Node* Node::findNode(const char* id, bool recursive, bool exactMatch, bool skipS
     for (Node* child = getFirstChild(); child != NULL; child = child->getNextSibling())
     {
         // Does this child's ID match?
-        if ((exactMatch && child->_id == id) || (!exactMatch && child->_id.find(id) == 0))
+        if (child->matchesId(id, handle, exactMatch))
         {
             return child;
         }
@@ -261,7 +308,7 @@ Node* Node::findNode(const char* id, bool recursive, bool exactMatch, bool skipS
     {
         for (Node* child = getFirstChild(); child != NULL; child = child->getNextSibling())
         {
-            Node* match = child->findNode(id, true, exactMatch, skipSkin);
+            Node* match = child->findNode(id, handle, true, exactMatch, skipSkin);
             if (match)
             {
                 return match;
@@ -273,10 +320,17 @@ Node* Node::findNode(const char* id, bool recursive, bool exactMatch, bool skipS
 
 unsigned int Node::findNodes(const char* id, std::vector<Node*>& nodes, bool recursive, bool exactMatch) const
 {
-    return findNodes(id, nodes, recursive, exactMatch, false);
+    GP_ASSERT(id);
+
+    // No node can have an ID that was never interned.
+    const unsigned int handle = StringTable::find(id);
+    if (exactMatch && handle == STRING_TABLE_NOT_FOUND)
+        return 0;
+
+    return findNodes(id, handle, nodes, recursive, exactMatch, false);
 }
 
-unsigned int Node::findNodes(const char* id, std::vector<Node*>& nodes, bool recursive, bool exactMatch, bool skipSkin) const
+unsigned int Node::findNodes(const char* id, unsigned int handle, std::vector<Node*>& nodes, bool recursive, bool exactMatch, bool skipSkin) const
 {
     GP_ASSERT(id);
 
@@ -291,12 +345,12 @@ unsigned int Node::findNodes(const char* id, std::vector<Node*>& nodes, bool rec
         {
             if (model->getSkin() != NULL && (rootNode = model->getSkin()->_rootNode) != NULL)
             {
-                if ((exactMatch && rootNode->_id == id) || (!exactMatch && rootNode->_id.find(id) == 0))
+                if (rootNode->matchesId(id, handle, exactMatch))
                 {
                     nodes.push_back(rootNode);
                     ++count;
                 }
-                count += rootNode->findNodes(id, nodes, recursive, exactMatch, true);
+                count += rootNode->findNodes(id, handle, nodes, recursive, exactMatch, true);
             }
         }
     }
@@ -305,7 +359,7 @@ unsigned int Node::findNodes(const char* id, std::vector<Node*>& nodes, bool rec
     for (Node* child = getFirstChild(); child != NULL; child = child->getNextSibling())
     {
         // Does this child's ID match?
-        if ((exactMatch && child->_id == id) || (!exactMatch && child->_id.find(id) == 0))
+        if (child->matchesId(id, handle, exactMatch))
         {
             nodes.push_back(child);
             ++count;
@@ -316,13 +370,20 @@ unsigned int Node::findNodes(const char* id, std::vector<Node*>& nodes, bool rec
     {
         for (Node* child = getFirstChild(); child != NULL; child = child->getNextSibling())
         {
-            count += child->findNodes(id, nodes, recursive, exactMatch, skipSkin);
+            count += child->findNodes(id, handle, nodes, recursive, exactMatch, skipSkin);
         }
     }
 
     return count;
 }
 
+bool Node::matchesId(const char* id, unsigned int handle, bool exactMatch) const
+{
+    if (exactMatch)
+        return _id == handle;
+    return strncmp(StringTable::get(_id), id, strlen(id)) == 0;
+}
+
 Scene* Node::getScene() const
 {
     if (_scene)
@@ -340,8 +401,7 @@ Scene* Node::getScene() const
 
 bool Node::hasTag(const char* name) const
 {
-    GP_ASSERT(name);
-    return (_tags ? _tags->find(name) != _tags->end() : false);
+    return getTag(name) != NULL;
 }
 
 const char* Node::getTag(const char* name) const
@@ -351,8 +411,14 @@ const char* Node::getTag(const char* name) const
     if (!_tags)
         return NULL;
 
-    std::map<std::string, std::string>::const_iterator itr = _tags->find(name);
-    return (itr == _tags->end() ? NULL : itr->second.c_str());
+    // Nodes carry a handful of tags at most, so a linear search of their handles is fastest.
+    const unsigned int handle = StringTable::find(name);
+    for (size_t i = 0, count = _tags->size(); i < count; ++i)
+    {
+        if ((*_tags)[i].first == handle)
+            return (*_tags)[i].second.c_str();
+    }
+    return NULL;
 }
 
 void Node::setTag(const char* name, const char* value)
@@ -364,7 +430,16 @@ void Node::setTag(const char* name, const char* value)
         // Removing tag
         if (_tags)
         {
-            _tags->erase(name);
+            const unsigned int handle = StringTable::find(name);
+            for (size_t i = 0, count = _tags->size(); i < count; ++i)
+            {
+                if ((*_tags)[i].first == handle)
+                {
+                    (*_tags)[i] = _tags->back();
+                    _tags->pop_back();
+                    break;
+                }
+            }
             if (_tags->size() == 0)
             {
                 SAFE_DELETE(_tags);
@@ -374,11 +449,20 @@ void Node::setTag(const char* name, const char* value)
     else
     {
         // Setting tag
+        const unsigned int handle = StringTable::intern(name);
         if (_tags == NULL)
         {
-            _tags = new std::map<std::string, std::string>();
+            _tags = new std::vector<std::pair<unsigned int, std::string> >();
+        }
+        for (size_t i = 0, count = _tags->size(); i < count; ++i)
+        {
+            if ((*_tags)[i].first == handle)
+            {
+                (*_tags)[i].second = value;
+                return;
+            }
         }
-        (*_tags)[name] = value;
+        _tags->push_back(std::make_pair(handle, std::string(value)));
     }
 }
 
@@ -416,6 +500,16 @@ bool Node::isEnabledInHierarchy() const
    return true;
 }
 
+bool Node::isOccluded() const
+{
+    return _occluded;
+}
+
+unsigned int Node::getVisibleFrame() const
+{
+    return _visibleFrame;
+}
+
 void Node::update(float elapsedTime)
 {
     for (Node* node = _firstChild; node != NULL; node = node->_nextSibling)
@@ -444,11 +538,12 @@ const Matrix& Node::getWorldMatrix() const
         if (!isStatic())
         {
             // If we have a parent, multiply our parent world transform by our local
-            // transform to obtain our final resolved world transform.
+            // transform to obtain our final resolved world transform. Both are composed
+            // of translations, rotations and scales, so the affine multiply is enough.
             Node* parent = getParent();
             if (parent && (!_collisionObject || _collisionObject->isKinematic()))
             {
-                Matrix::multiply(parent->getWorldMatrix(), getMatrix(), &_world);
+                Matrix::multiplyAffine(parent->getWorldMatrix(), getMatrix(), &_world);
             }
             else
             {
@@ -466,18 +561,46 @@ const Matrix& Node::getWorldMatrix() const
     return _world;
 }
 
+void Node::updateWorldMatrix(const Matrix* parentWorld) const
+{
+    if (_dirtyBits & NODE_DIRTY_WORLD)
+    {
+        _dirtyBits &= ~NODE_DIRTY_WORLD;
+
+        // Same as getWorldMatrix(), except that the parent is resolved by the caller.
+        if (!isStatic())
+        {
+            if (parentWorld && (!_collisionObject || _collisionObject->isKinematic()))
+            {
+                Matrix::multiplyAffine(*parentWorld, getMatrix(), &_world);
+            }
+            else
+            {
+                _world = getMatrix();
+            }
+        }
+    }
+}
+
+void Node::resolveWorldMatrix(const Matrix* parentWorld)
+{
+    _dirtyBits |= NODE_DIRTY_WORLD | NODE_DIRTY_CONTENT_BOUNDS;
+    updateWorldMatrix(parentWorld);
+    setHierarchyBoundsDirty();
+}
+
 const Matrix& Node::getWorldViewMatrix() const
 {
     static Matrix worldView;
-    Matrix::multiply(getViewMatrix(), getWorldMatrix(), &worldView);
+    Matrix::multiplyAffine(getViewMatrix(), getWorldMatrix(), &worldView);
     return worldView;
 }
 
 const Matrix& Node::getInverseTransposeWorldViewMatrix() const
 {
     static Matrix invTransWorldView;
-    Matrix::multiply(getViewMatrix(), getWorldMatrix(), &invTransWorldView);
-    invTransWorldView.invert();
+    Matrix::multiplyAffine(getViewMatrix(), getWorldMatrix(), &invTransWorldView);
+    invTransWorldView.invertAffine(&invTransWorldView);
     invTransWorldView.transpose();
     return invTransWorldView;
 }
@@ -486,7 +609,7 @@ const Matrix& Node::getInverseTransposeWorldMatrix() const
 {
     static Matrix invTransWorld;
     invTransWorld = getWorldMatrix();
-    invTransWorld.invert();
+    invTransWorld.invertAffine(&invTransWorld);
     invTransWorld.transpose();
     return invTransWorld;
 }
@@ -657,7 +780,8 @@ void Node::hierarchyChanged()
 void Node::transformChanged()
 {
     // Our local transform was changed, so mark our world matrices dirty.
-    _dirtyBits |= NODE_DIRTY_WORLD | NODE_DIRTY_BOUNDS;
+    _dirtyBits |= NODE_DIRTY_WORLD | NODE_DIRTY_CONTENT_BOUNDS;
+    setHierarchyBoundsDirty();
 
     // Notify our children that their transform has also changed (since transforms are inherited).
     for (Node* n = getFirstChild(); n != NULL; n = n->getNextSibling())
@@ -681,12 +805,46 @@ void Node::transformChanged()
 
 void Node::setBoundsDirty()
 {
-    // Mark ourself and our parent nodes as dirty
-    _dirtyBits |= NODE_DIRTY_BOUNDS;
+    // Our own content changed, so it is refit along with the bounds of our ancestors.
+    _dirtyBits |= NODE_DIRTY_CONTENT_BOUNDS;
+    setHierarchyBoundsDirty();
+}
 
-    // Mark our parent bounds as dirty as well
-    if (_parent)
-        _parent->setBoundsDirty();
+void Node::setHierarchyBoundsDirty()
+{
+    // The bounds of a node are only computed along with those of its children, so the
+    // ancestors of a dirty node are already dirty and the walk stops at the first one.
+    for (Node* node = this; node != NULL; node = node->_parent)
+    {
+        node->setSpatialBoundsDirty();
+        if (node->_dirtyBits & NODE_DIRTY_BOUNDS)
+            break;
+        node->_dirtyBits |= NODE_DIRTY_BOUNDS;
+    }
+}
+
+void Node::invalidateVisibility()
+{
+    // Whether the node is static follows its collision object, which the visibility cache of the scene depends on.
+    Scene* scene = _drawable ? getScene() : NULL;
+    if (scene)
+        scene->invalidateVisibilityCache();
+}
+
+void Node::setSpatialBoundsDirty()
+{
+    if (_spatialProxy >= 0 && !(_dirtyBits & NODE_DIRTY_SPATIAL))
+    {
+        _dirtyBits |= NODE_DIRTY_SPATIAL;
+        Scene* scene = getScene();
+        GP_ASSERT(scene);
+        scene->_spatialDirtyNodes.push_back(this);
+    }
+}
+
+void Node::clearSpatialBoundsDirty()
+{
+    _dirtyBits &= ~NODE_DIRTY_SPATIAL;
 }
 
 Animation* Node::getAnimation(const char* id) const
@@ -827,6 +985,22 @@ void Node::setDrawable(Drawable* drawable)
                 ref->addRef();
             _drawable->setNode(this);
         }
+
+        // Only nodes with drawables are kept in the spatial index of the scene.
+        Scene* scene = getScene();
+        if (scene)
+        {
+            scene->_updateNodesDirty = true;
+            if (isStatic())
+                scene->invalidateVisibilityCache();
+        }
+        if (scene && scene->isSpatialIndexEnabled())
+        {
+            if (_drawable && _spatialProxy < 0)
+                scene->addSpatialNode(this);
+            else if (!_drawable && _spatialProxy >= 0)
+                scene->removeSpatialNode(this);
+        }
     }
     setBoundsDirty();
 }
@@ -837,109 +1011,162 @@ const BoundingSphere& Node::getBoundingSphere() const
     {
         _dirtyBits &= ~NODE_DIRTY_BOUNDS;
 
-        const Matrix& worldMatrix = getWorldMatrix();
-
-        // Start with our local bounding sphere
-        // TODO: Incorporate bounds from entities other than mesh (i.e. particleemitters, audiosource, etc)
-        bool empty = true;
-        Terrain* terrain = dynamic_cast<Terrain*>(_drawable);
-        if (terrain)
-        {
-            _bounds.set(terrain->getBoundingBox());
-            empty = false;
-        }
-        Model* model = dynamic_cast<Model*>(_drawable);
-        if (model && model->getMesh())
+        // Our own content is only refit when it or our transform changed, and the children whose
+        // bounds are not dirty return them as they are, so only the dirty path below us is visited.
+        if (_dirtyBits & NODE_DIRTY_CONTENT_BOUNDS)
         {
-            if (empty)
-            {
-                _bounds.set(model->getMesh()->getBoundingSphere());
-                empty = false;
-            }
-            else
-            {
-                _bounds.merge(model->getMesh()->getBoundingSphere());
-            }
+            _dirtyBits &= ~NODE_DIRTY_CONTENT_BOUNDS;
+            updateContentBounds();
         }
-        if (_light)
+        _bounds = _contentBounds;
+        bool empty = _bounds.isEmpty();
+
+        // Merge this world-space bounding sphere with our childrens' bounding volumes.
+        for (Node* n = getFirstChild(); n != NULL; n = n->getNextSibling())
         {
-            switch (_light->getLightType())
+            const BoundingSphere& childSphere = n->getBoundingSphere();
+            if (!childSphere.isEmpty())
             {
-            case Light::POINT:
                 if (empty)
                 {
-                    _bounds.set(Vector3::zero(), _light->getRange());
+                    _bounds.set(childSphere);
                     empty = false;
                 }
                 else
                 {
-                    _bounds.merge(BoundingSphere(Vector3::zero(), _light->getRange()));
+                    _bounds.merge(childSphere);
                 }
-                break;
-            case Light::SPOT:
-                // TODO: Implement spot light bounds
-                break;
             }
         }
+    }
+
+    return _bounds;
+}
+
+void Node::updateContentBounds() const
+{
+    const Matrix& worldMatrix = getWorldMatrix();
+
+    // Start with our local bounding sphere
+    // TODO: Incorporate bounds from entities other than mesh (i.e. audiosource, etc)
+    bool empty = true;
+    Terrain* terrain = dynamic_cast<Terrain*>(_drawable);
+    if (terrain)
+    {
+        _contentBounds.set(terrain->getBoundingBox());
+        empty = false;
+    }
+    StreamingTerrain* streamingTerrain = dynamic_cast<StreamingTerrain*>(_drawable);
+    if (streamingTerrain)
+    {
+        _contentBounds.set(streamingTerrain->getBoundingBox());
+        empty = false;
+    }
+    Model* model = dynamic_cast<Model*>(_drawable);
+    BoundingSphere skinBounds;
+    bool skinned = model && model->getSkin() && model->getSkin()->computeBounds(&skinBounds);
+    if (skinned)
+    {
+        // The bounds of the joints of the skin in its current pose are tighter than those of the
+        // mesh, which contain every pose of the animations the skin was exported with.
+        if (!skinBounds.isEmpty())
+        {
+            if (empty)
+                _contentBounds.set(skinBounds);
+            else
+                _contentBounds.merge(skinBounds);
+            empty = false;
+        }
+    }
+    else if (model && model->getMesh())
+    {
         if (empty)
         {
-            // Empty bounding sphere, set the world translation with zero radius
-            worldMatrix.getTranslation(&_bounds.center);
-            _bounds.radius = 0;
+            _contentBounds.set(model->getMesh()->getBoundingSphere());
+            empty = false;
         }
-
-        // Transform the sphere (if not empty) into world space.
-        if (!empty)
+        else
+        {
+            _contentBounds.merge(model->getMesh()->getBoundingSphere());
+        }
+    }
+    if (_light)
+    {
+        switch (_light->getLightType())
         {
-            bool applyWorldTransform = true;
-            if (model && model->getSkin())
+        case Light::POINT:
+            if (empty)
             {
-                // Special case: If the root joint of our mesh skin is parented by any nodes, 
-                // multiply the world matrix of the root joint's parent by this node's
-                // world matrix. This computes a final world matrix used for transforming this
-                // node's bounding volume. This allows us to store a much smaller bounding
-                // volume approximation than would otherwise be possible for skinned meshes,
-                // since joint parent nodes that are not in the matrix palette do not need to
-                // be considered as directly transforming vertices on the GPU (they can instead
-                // be applied directly to the bounding volume transformation below).
-                GP_ASSERT(model->getSkin()->getRootJoint());
-                Node* jointParent = model->getSkin()->getRootJoint()->getParent();
-                if (jointParent)
-                {
-                    // TODO: Should we protect against the case where joints are nested directly
-                    // in the node hierachy of the model (this is normally not the case)?
-                    Matrix boundsMatrix;
-                    Matrix::multiply(getWorldMatrix(), jointParent->getWorldMatrix(), &boundsMatrix);
-                    _bounds.transform(boundsMatrix);
-                    applyWorldTransform = false;
-                }
+                _contentBounds.set(Vector3::zero(), _light->getRange());
+                empty = false;
             }
-            if (applyWorldTransform)
+            else
             {
-                _bounds.transform(getWorldMatrix());
+                _contentBounds.merge(BoundingSphere(Vector3::zero(), _light->getRange()));
             }
+            break;
+        case Light::SPOT:
+            // TODO: Implement spot light bounds
+            break;
         }
+    }
+    if (empty)
+    {
+        // Empty bounding sphere, set the world translation with zero radius
+        worldMatrix.getTranslation(&_contentBounds.center);
+        _contentBounds.radius = 0;
+    }
 
-        // Merge this world-space bounding sphere with our childrens' bounding volumes.
-        for (Node* n = getFirstChild(); n != NULL; n = n->getNextSibling())
+    // Transform the sphere (if not empty) into world space.
+    if (!empty)
+    {
+        bool applyWorldTransform = true;
+        if (model && model->getSkin() && !skinned)
         {
-            const BoundingSphere& childSphere = n->getBoundingSphere();
-            if (!childSphere.isEmpty())
+            // Special case: If the root joint of our mesh skin is parented by any nodes, 
+            // multiply the world matrix of the root joint's parent by this node's
+            // world matrix. This computes a final world matrix used for transforming this
+            // node's bounding volume. This allows us to store a much smaller bounding
+            // volume approximation than would otherwise be possible for skinned meshes,
+            // since joint parent nodes that are not in the matrix palette do not need to
+            // be considered as directly transforming vertices on the GPU (they can instead
+            // be applied directly to the bounding volume transformation below).
+            GP_ASSERT(model->getSkin()->getRootJoint());
+            Node* jointParent = model->getSkin()->getRootJoint()->getParent();
+            if (jointParent)
             {
-                if (empty)
-                {
-                    _bounds.set(childSphere);
-                    empty = false;
-                }
-                else
-                {
-                    _bounds.merge(childSphere);
-                }
+                // TODO: Should we protect against the case where joints are nested directly
+                // in the node hierachy of the model (this is normally not the case)?
+                Matrix boundsMatrix;
+                Matrix::multiply(getWorldMatrix(), jointParent->getWorldMatrix(), &boundsMatrix);
+                _contentBounds.transform(boundsMatrix);
+                applyWorldTransform = false;
             }
         }
+        if (applyWorldTransform)
+        {
+            _contentBounds.transform(getWorldMatrix());
+        }
     }
 
-    return _bounds;
+    // Particles are simulated in world space, so the bounds of an emitter are merged untransformed.
+    ParticleEmitter* emitter = dynamic_cast<ParticleEmitter*>(_drawable);
+    if (emitter)
+    {
+        const BoundingBox& particleBounds = emitter->getBoundingBox();
+        if (!particleBounds.isEmpty())
+        {
+            if (empty)
+            {
+                _contentBounds.set(particleBounds);
+                empty = false;
+            }
+            else
+            {
+                _contentBounds.merge(particleBounds);
+            }
+        }
+    }
 }
 
 Node* Node::clone() const
@@ -977,7 +1204,7 @@ void Node::cloneInto(Node* node, NodeCloneContext& context) const
 {
     GP_ASSERT(node);
 
-    Transform::cloneInto(node, context);
+    cloneComponentsInto(node, context);
 
     if (Drawable* drawable = getDrawable())
     {
@@ -987,6 +1214,19 @@ void Node::cloneInto(Node* node, NodeCloneContext& context) const
         if (ref)
             ref->release();
     }
+
+    node->_world = _world;
+    node->_bounds = _bounds;
+
+    // TODO: Clone the rest of the node data.
+}
+
+void Node::cloneComponentsInto(Node* node, NodeCloneContext& context) const
+{
+    GP_ASSERT(node);
+
+    Transform::cloneInto(node, context);
+
     if (Camera* camera = getCamera())
     {
         Camera* clone = camera->clone(context);
@@ -1013,13 +1253,8 @@ void Node::cloneInto(Node* node, NodeCloneContext& context) const
     }
     if (_tags)
     {
-        node->_tags = new std::map<std::string, std::string>(_tags->begin(), _tags->end());
+        node->_tags = new std::vector<std::pair<unsigned int, std::string> >(*_tags);
     }
-
-    node->_world = _world;
-    node->_bounds = _bounds;
-
-    // TODO: Clone the rest of the node data.
 }
 
 AudioSource* Node::getAudioSource() const
@@ -1055,6 +1290,7 @@ PhysicsCollisionObject* Node::getCollisionObject() const
 PhysicsCollisionObject* Node::setCollisionObject(PhysicsCollisionObject::Type type, const PhysicsCollisionShape::Definition& shape, PhysicsRigidBody::Parameters* rigidBodyParameters, int group, int mask)
 {
     SAFE_DELETE(_collisionObject);
+    invalidateVisibility();
 
     switch (type)
     {
@@ -1123,6 +1359,7 @@ PhysicsCollisionObject* Node::setCollisionObject(const char* url)
 PhysicsCollisionObject* Node::setCollisionObject(Properties* properties)
 {
     SAFE_DELETE(_collisionObject);
+    invalidateVisibility();
 
     // Check if the properties is valid.
     if (!properties || !(strcmp(properties->getNamespace(), "collisionObject") == 0))
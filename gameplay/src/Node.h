@@ -15,6 +15,7 @@
 #include "PhysicsCollisionObject.h"
 #include "BoundingBox.h"
 #include "AIAgent.h"
+#include "StringTable.h"
 
 namespace gameplay
 {
@@ -41,6 +42,10 @@ class Node : public Transform, public Ref
     friend class Bundle;
     friend class MeshSkin;
     friend class Light;
+    friend class OcclusionCuller;
+    friend class ParticleEmitter;
+    friend class Prefab;
+    friend class SceneSnapshot;
 
     GP_SCRIPT_EVENTS_START();
     GP_SCRIPT_EVENT(update, "<Node>f");
@@ -246,6 +251,27 @@ public:
      */
     bool isEnabledInHierarchy() const;
 
+    /**
+     * Gets if the node was hidden behind other geometry when it was last tested by an OcclusionCuller.
+     *
+     * Nodes that have never been tested are not occluded. Draw visitors can skip the nodes
+     * that are occluded, since nothing of them would cover any pixel.
+     *
+     * @return true if the node is occluded, false otherwise.
+     */
+    bool isOccluded() const;
+
+    /**
+     * Gets the number of the last frame in which Scene::findVisibleNodes() found this node.
+     *
+     * Nodes are found by the culling of the cameras and shadow casting lights that draw them,
+     * so this tells whether the node or its shadow was drawn in a recent frame.
+     *
+     * @return The frame number, as returned by Game::getFrameNumber(), or zero if the node was never found.
+     * @script{ignore}
+     */
+    unsigned int getVisibleFrame() const;
+
     /**
      * Called to update the state of this Node.
      *
@@ -619,6 +645,18 @@ protected:
      */
     virtual ~Node();
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+    /**
+     * Allocates the memory of a node from the current ObjectPool.
+     */
+    static void* operator new(size_t size);
+
+    /**
+     * Returns the memory of a node to the ObjectPool it was allocated from.
+     */
+    static void operator delete(void* p);
+#endif
+
     /**
      * Clones a single node and its data but not its children.
      *
@@ -645,6 +683,14 @@ protected:
      */
     void cloneInto(Node* node, NodeCloneContext &context) const;
 
+    /**
+     * Copies the data from this node other than its drawable, world matrix and bounds into the given node.
+     *
+     * @param node The node to copy the data to.
+     * @param context The clone context.
+     */
+    void cloneComponentsInto(Node* node, NodeCloneContext &context) const;
+
     /**
      * Removes this node from its parent.
      */
@@ -655,6 +701,23 @@ protected:
      */
     void transformChanged();
 
+    /**
+     * Resolves the world matrix of this node, if it is dirty, from the given parent world
+     * matrix without visiting any child nodes. Used by Scene::updateTransforms().
+     *
+     * @param parentWorld The resolved world matrix of the parent node, or NULL if there is no parent.
+     */
+    void updateWorldMatrix(const Matrix* parentWorld) const;
+
+    /**
+     * Resolves the world matrix of this node from the given parent world matrix after its
+     * local transform was changed without notification, and marks its bounds dirty. Used by
+     * MeshSkin to resolve the joints of a skeleton in one pass.
+     *
+     * @param parentWorld The resolved world matrix of the parent node, or NULL if there is no parent.
+     */
+    void resolveWorldMatrix(const Matrix* parentWorld);
+
     /**
      * Called when this Node's hierarchy changes.
      */
@@ -662,9 +725,36 @@ protected:
 
     /**
      * Marks the bounding volume of the node as dirty.
+     *
+     * This is called when the content of the node changes, which refits it along with the bounds of its ancestors.
      */
     void setBoundsDirty();
 
+    /**
+     * Marks the bounding volumes of the node and its ancestors as dirty, without refitting the content of the node.
+     */
+    void setHierarchyBoundsDirty();
+
+    /**
+     * Computes the world-space bounding sphere of the content of this node, without its children.
+     */
+    void updateContentBounds() const;
+
+    /**
+     * Discards the visibility cache of the scene of this node, if it has a drawable.
+     */
+    void invalidateVisibility();
+
+    /**
+     * Queues this node for an update in the spatial index of its scene, if it is indexed.
+     */
+    void setSpatialBoundsDirty();
+
+    /**
+     * Called by the scene once this node's queued spatial index update has been applied.
+     */
+    void clearSpatialBoundsDirty();
+
     /**
      * Returns the first child node that matches the given ID.
      *
@@ -673,6 +763,7 @@ protected:
      * If recursive is true, it also traverses the Node's hierarchy with a breadth first search.
      *
      * @param id The ID of the child to find.
+     * @param handle The handle of the ID in the StringTable, or STRING_TABLE_NOT_FOUND if it is not interned.
      * @param recursive True to search recursively all the node's children, false for only direct children.
      * @param exactMatch true if only nodes whose ID exactly matches the specified ID are returned,
      *        or false if nodes that start with the given ID are returned.
@@ -680,13 +771,14 @@ protected:
      *
      * @return The Node found or NULL if not found.
      */
-    Node* findNode(const char* id, bool recursive, bool exactMatch, bool skipSkin) const;
+    Node* findNode(const char* id, unsigned int handle, bool recursive, bool exactMatch, bool skipSkin) const;
 
 
     /**
      * Returns all child nodes that match the given ID.
      *
      * @param id The ID of the node to find.
+     * @param handle The handle of the ID in the StringTable, or STRING_TABLE_NOT_FOUND if it is not interned.
      * @param nodes A vector of nodes to be populated with matches.
      * @param recursive true if a recursive search should be performed, false otherwise.
      * @param exactMatch true if only nodes whose ID exactly matches the specified ID are returned,
@@ -696,7 +788,18 @@ protected:
      * @return The number of matches found.
      * @script{ignore}
      */
-    unsigned int findNodes(const char* id, std::vector<Node*>& nodes, bool recursive, bool exactMatch, bool skipSkin) const;
+    unsigned int findNodes(const char* id, unsigned int handle, std::vector<Node*>& nodes, bool recursive, bool exactMatch, bool skipSkin) const;
+
+    /**
+     * Returns whether the ID of this node matches the given ID.
+     *
+     * @param id The ID to match.
+     * @param handle The handle of the ID in the StringTable, or STRING_TABLE_NOT_FOUND if it is not interned.
+     * @param exactMatch true to match only the whole ID, false to match IDs that start with the given ID.
+     *
+     * @return true if the ID matches.
+     */
+    bool matchesId(const char* id, unsigned int handle, bool exactMatch) const;
 
 private:
 
@@ -716,8 +819,8 @@ protected:
 
     /** The scene this node is attached to. */
     Scene* _scene;
-    /** The nodes id. */
-    std::string _id;
+    /** The handle of the nodes id in the StringTable. */
+    unsigned int _id;
     /** The nodes first child. */
     Node* _firstChild;
     /** The nodes next sibiling. */
@@ -730,8 +833,8 @@ protected:
     unsigned int _childCount;
     /** If this node is enabled. Maybe different if parent is enabled/disabled. */
     bool _enabled; 
-    /** Tags assigned to this node. */
-    std::map<std::string, std::string>* _tags;
+    /** Tags assigned to this node, by the handle of their name in the StringTable. */
+    std::vector<std::pair<unsigned int, std::string> >* _tags;
     /** The drawble component attached to this node. */
     Drawable* _drawable;
     /** The camera component attached to this node. */
@@ -750,8 +853,16 @@ protected:
     mutable Matrix _world;
     /** The bounding sphere for this node. */
     mutable BoundingSphere _bounds;
+    /** The bounding sphere for the content of this node, without its children. */
+    mutable BoundingSphere _contentBounds;
     /** The dirty bits used for optimization. */
     mutable int _dirtyBits;
+    /** The proxy of this node in the spatial index of its scene, or -1 if it is not indexed. */
+    int _spatialProxy;
+    /** If this node was hidden behind other geometry when last tested by an OcclusionCuller. */
+    bool _occluded;
+    /** The number of the last frame in which Scene::findVisibleNodes() found this node. */
+    unsigned int _visibleFrame;
 };
 
 /**
@@ -0,0 +1,193 @@
+#include "Base.h"
+#include "ObjectPool.h"
+
+// Granularity of the object sizes a pool keeps slots of, which is also the alignment of the objects.
+#define OBJECT_POOL_ALIGNMENT 16
+
+namespace gameplay
+{
+
+// Stored in front of each object, so that freeing it finds its pool and size without a search.
+// Padded to the alignment of the objects, with which the slots of a block start aligned.
+union ObjectHeader
+{
+    struct
+    {
+        ObjectPool* pool;
+        unsigned int sizeClass;
+    } info;
+    char padding[OBJECT_POOL_ALIGNMENT];
+};
+
+static thread_local ObjectPool* __currentPool = NULL;
+static ObjectPool* __defaultPool = NULL;
+static std::once_flag __defaultPoolFlag;
+
+ObjectPool::Scope::Scope(ObjectPool* pool)
+    : _previous(__currentPool)
+{
+    __currentPool = pool;
+}
+
+ObjectPool::Scope::~Scope()
+{
+    __currentPool = _previous;
+}
+
+ObjectPool::ObjectPool(unsigned int objectsPerBlock)
+    : _objectsPerBlock(objectsPerBlock), _objectCount(0), _released(false)
+{
+    GP_ASSERT(objectsPerBlock > 0);
+}
+
+ObjectPool::~ObjectPool()
+{
+    GP_ASSERT(_objectCount == 0);
+    for (size_t i = 0, count = _sizeClasses.size(); i < count; ++i)
+    {
+        std::vector<char*>& blocks = _sizeClasses[i].blocks;
+        for (size_t j = 0, blockCount = blocks.size(); j < blockCount; ++j)
+        {
+            free(blocks[j]);
+        }
+    }
+}
+
+ObjectPool* ObjectPool::create(unsigned int objectsPerBlock)
+{
+    return new ObjectPool(objectsPerBlock);
+}
+
+void ObjectPool::release()
+{
+    bool empty;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        GP_ASSERT(!_released);
+        _released = true;
+        empty = _objectCount == 0;
+    }
+    if (empty)
+    {
+        delete this;
+    }
+}
+
+void* ObjectPool::allocate(size_t size)
+{
+    void* p = getCurrent()->allocateObject(size);
+    if (!p)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void ObjectPool::deallocate(void* p)
+{
+    if (p)
+    {
+        ObjectHeader* header = (ObjectHeader*)p - 1;
+        header->info.pool->deallocateObject(header->info.sizeClass, header);
+    }
+}
+
+ObjectPool* ObjectPool::getCurrent()
+{
+    return __currentPool ? __currentPool : getDefault();
+}
+
+ObjectPool* ObjectPool::getDefault()
+{
+    // The default pool is never released, since objects may be freed from it at any time up to exit.
+    std::call_once(__defaultPoolFlag, []() { __defaultPool = new ObjectPool(OBJECT_POOL_BLOCK_OBJECTS); });
+    return __defaultPool;
+}
+
+unsigned int ObjectPool::getObjectCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _objectCount;
+}
+
+size_t ObjectPool::getCapacity() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    size_t capacity = 0;
+    for (size_t i = 0, count = _sizeClasses.size(); i < count; ++i)
+    {
+        capacity += _sizeClasses[i].blocks.size() * _sizeClasses[i].size * _objectsPerBlock;
+    }
+    return capacity;
+}
+
+void* ObjectPool::allocateObject(size_t size)
+{
+    const size_t slotSize = sizeof(ObjectHeader) + ((size + OBJECT_POOL_ALIGNMENT - 1) & ~(size_t)(OBJECT_POOL_ALIGNMENT - 1));
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    GP_ASSERT(!_released);
+
+    // A pool only holds a few types of objects, so there are only a handful of sizes to look through.
+    unsigned int sizeClass = 0;
+    const unsigned int sizeClassCount = (unsigned int)_sizeClasses.size();
+    while (sizeClass < sizeClassCount && _sizeClasses[sizeClass].size != slotSize)
+    {
+        ++sizeClass;
+    }
+    if (sizeClass == sizeClassCount)
+    {
+        SizeClass newClass;
+        newClass.size = slotSize;
+        newClass.freeSlots = NULL;
+        _sizeClasses.push_back(newClass);
+    }
+
+    SizeClass& slots = _sizeClasses[sizeClass];
+    if (!slots.freeSlots)
+    {
+        char* block = (char*)malloc(slotSize * _objectsPerBlock);
+        if (!block)
+        {
+            GP_ERROR("Failed to allocate a block of %u objects of %u bytes for an object pool.", _objectsPerBlock, (unsigned int)slotSize);
+            return NULL;
+        }
+        slots.blocks.push_back(block);
+
+        // Thread the slots of the block into the free list in address order.
+        for (unsigned int i = _objectsPerBlock; i > 0; --i)
+        {
+            Slot* slot = (Slot*)(block + (i - 1) * slotSize);
+            slot->next = slots.freeSlots;
+            slots.freeSlots = slot;
+        }
+    }
+
+    ObjectHeader* header = (ObjectHeader*)slots.freeSlots;
+    slots.freeSlots = slots.freeSlots->next;
+    header->info.pool = this;
+    header->info.sizeClass = sizeClass;
+    ++_objectCount;
+    return header + 1;
+}
+
+void ObjectPool::deallocateObject(unsigned int sizeClass, void* slot)
+{
+    bool destroy;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        GP_ASSERT(sizeClass < _sizeClasses.size());
+        GP_ASSERT(_objectCount > 0);
+        SizeClass& slots = _sizeClasses[sizeClass];
+        ((Slot*)slot)->next = slots.freeSlots;
+        slots.freeSlots = (Slot*)slot;
+        --_objectCount;
+        destroy = _released && _objectCount == 0;
+    }
+    if (destroy)
+    {
+        delete this;
+    }
+}
+
+}
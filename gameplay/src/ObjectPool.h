@@ -0,0 +1,156 @@
+#ifndef OBJECTPOOL_H_
+#define OBJECTPOOL_H_
+
+// Number of objects of a size that a pool allocates room for at a time.
+#define OBJECT_POOL_BLOCK_OBJECTS 64
+
+namespace gameplay
+{
+
+/**
+ * Defines a pool of fixed-size slots for the objects of the most common engine types.
+ *
+ * Nodes, joints, models and animation clips are allocated from the pool that is current on
+ * the thread creating them, rather than individually from the heap. A pool hands out slots
+ * of each object size from blocks holding many of them, so the objects allocated from one
+ * pool sit close together in memory, and allocating or freeing an object takes a constant
+ * number of steps.
+ *
+ * Every scene has a pool of its own, which is current while the scene is loaded from a bundle
+ * or a scene file and while nodes are added to it by id, so the nodes of a scene are grouped
+ * together. Objects created outside such a scope, or within an ObjectPool::Scope of another
+ * pool, come from that pool, or from the default pool otherwise.
+ *
+ * An object returns to the pool it was allocated from, whichever pool is current when it is
+ * freed, and a pool lives on until its last object is freed, even after its owner released it.
+ *
+ * Pools are not used when GP_USE_MEM_LEAK_DETECTION is defined, so that every object is
+ * tracked as an allocation of its own.
+ *
+ * @script{ignore}
+ */
+class ObjectPool
+{
+public:
+
+    /**
+     * Makes a pool current on the calling thread for as long as the scope lasts.
+     */
+    class Scope
+    {
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param pool The pool to make current, or NULL for the default pool.
+         */
+        explicit Scope(ObjectPool* pool);
+
+        /**
+         * Destructor, which makes the previous pool current again.
+         */
+        ~Scope();
+
+    private:
+
+        Scope(const Scope&);
+        Scope& operator=(const Scope&);
+
+        ObjectPool* _previous;
+    };
+
+    /**
+     * Creates a pool.
+     *
+     * @param objectsPerBlock The number of objects of a size to allocate room for at a time.
+     *
+     * @return The new pool, which is released with release().
+     */
+    static ObjectPool* create(unsigned int objectsPerBlock = OBJECT_POOL_BLOCK_OBJECTS);
+
+    /**
+     * Releases the pool, which is deleted once its last object is freed.
+     */
+    void release();
+
+    /**
+     * Allocates memory for an object from the pool current on the calling thread.
+     *
+     * @param size The size of the object.
+     *
+     * @return The memory of the object.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * Frees the memory of an object, returning it to the pool it was allocated from.
+     *
+     * @param p The memory of the object, as returned by allocate(), or NULL.
+     */
+    static void deallocate(void* p);
+
+    /**
+     * Gets the pool current on the calling thread.
+     *
+     * @return The pool of the innermost ObjectPool::Scope of the thread, or the default pool.
+     */
+    static ObjectPool* getCurrent();
+
+    /**
+     * Gets the pool for objects that are not created within the scope of another pool.
+     *
+     * @return The default pool.
+     */
+    static ObjectPool* getDefault();
+
+    /**
+     * Gets the number of objects allocated from the pool that have not been freed.
+     *
+     * @return The object count.
+     */
+    unsigned int getObjectCount() const;
+
+    /**
+     * Gets the number of bytes of the blocks of the pool.
+     *
+     * @return The capacity of the pool.
+     */
+    size_t getCapacity() const;
+
+private:
+
+    struct Slot
+    {
+        Slot* next;
+    };
+
+    struct SizeClass
+    {
+        size_t size;
+        Slot* freeSlots;
+        std::vector<char*> blocks;
+    };
+
+    ObjectPool(unsigned int objectsPerBlock);
+
+    ~ObjectPool();
+
+    ObjectPool(const ObjectPool&);
+
+    ObjectPool& operator=(const ObjectPool&);
+
+    void* allocateObject(size_t size);
+
+    void deallocateObject(unsigned int sizeClass, void* slot);
+
+    std::vector<SizeClass> _sizeClasses;
+    unsigned int _objectsPerBlock;
+    unsigned int _objectCount;
+    bool _released;
+    mutable std::mutex _mutex;
+};
+
+}
+
+#endif
@@ -0,0 +1,274 @@
+#include "Base.h"
+#include "OcclusionCuller.h"
+#include "GLStateCache.h"
+
+// Number of frames a node may be out of view before its query is deleted.
+#define OCCLUSION_QUERY_LIFETIME 60
+
+namespace gameplay
+{
+
+OcclusionCuller::OcclusionCuller()
+    : _frame(0), _visibleTestInterval(4), _effect(NULL), _matrixUniform(NULL), _stateBlock(NULL), _vertexBuffer(0), _indexBuffer(0)
+{
+}
+
+OcclusionCuller::~OcclusionCuller()
+{
+    for (std::unordered_map<Node*, Query>::iterator itr = _queries.begin(); itr != _queries.end(); ++itr)
+    {
+#ifdef GP_USE_OCCLUSION_QUERIES
+        GL_ASSERT( glDeleteQueries(1, &itr->second.handle) );
+#endif
+        itr->first->_occluded = false;
+        itr->first->release();
+    }
+    _queries.clear();
+
+    if (_vertexBuffer)
+        GLStateCache::deleteBuffer(_vertexBuffer);
+    if (_indexBuffer)
+        GLStateCache::deleteBuffer(_indexBuffer);
+    SAFE_RELEASE(_stateBlock);
+    SAFE_RELEASE(_effect);
+}
+
+OcclusionCuller* OcclusionCuller::create()
+{
+    OcclusionCuller* culler = new OcclusionCuller();
+#ifdef GP_USE_OCCLUSION_QUERIES
+    if (glGenQueries == NULL)
+    {
+        GP_WARN("Occlusion queries are not supported, so no nodes will be culled.");
+    }
+    else if (!culler->initialize())
+    {
+        GP_ERROR("Failed to initialize occlusion culler.");
+        SAFE_DELETE(culler);
+    }
+#endif
+    return culler;
+}
+
+bool OcclusionCuller::initialize()
+{
+    // Shaders that only transform the unit cube into the bounding volume of a node.
+    const char* vs_str =
+    {
+        "uniform mat4 u_worldViewProjectionMatrix;\n"
+        "attribute vec4 a_position;\n"
+        "void main(void) {\n"
+        "    gl_Position = u_worldViewProjectionMatrix * a_position;\n"
+        "}"
+    };
+    const char* fs_str =
+    {
+    #ifdef OPENGL_ES
+        "precision mediump float;\n"
+    #endif
+        "void main(void) {\n"
+        "   gl_FragColor = vec4(1.0);\n"
+        "}"
+    };
+
+    _effect = Effect::createFromSource(vs_str, fs_str);
+    if (_effect == NULL)
+        return false;
+    _matrixUniform = _effect->getUniform("u_worldViewProjectionMatrix");
+    if (_matrixUniform == NULL || _effect->getVertexAttribute(VERTEX_ATTRIBUTE_POSITION_NAME) == -1)
+        return false;
+
+    // Test against the depth of the frame without changing it. Both faces are drawn since
+    // either may be the visible one.
+    _stateBlock = RenderState::StateBlock::create();
+    _stateBlock->setDepthTest(true);
+    _stateBlock->setDepthWrite(false);
+    _stateBlock->setDepthFunction(RenderState::DEPTH_LEQUAL);
+    _stateBlock->setCullFace(false);
+    _stateBlock->setBlend(false);
+
+    static const float vertices[] =
+    {
+        -1, -1, -1,   1, -1, -1,   1,  1, -1,  -1,  1, -1,
+        -1, -1,  1,   1, -1,  1,   1,  1,  1,  -1,  1,  1
+    };
+    static const unsigned short indices[] =
+    {
+        0, 2, 1,  0, 3, 2,   4, 5, 6,  4, 6, 7,
+        0, 1, 5,  0, 5, 4,   3, 7, 6,  3, 6, 2,
+        0, 4, 7,  0, 7, 3,   1, 2, 6,  1, 6, 5
+    };
+
+#ifdef GP_USE_VAO
+    if (glBindVertexArray)
+        GLStateCache::bindVertexArray(0);
+#endif
+    GL_ASSERT( glGenBuffers(1, &_vertexBuffer) );
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, _vertexBuffer);
+    GL_ASSERT( glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW) );
+    GL_ASSERT( glGenBuffers(1, &_indexBuffer) );
+    GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBuffer);
+    GL_ASSERT( glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW) );
+
+    return true;
+}
+
+unsigned int OcclusionCuller::cull(Camera* camera, const std::vector<Node*>& nodes)
+{
+    GP_ASSERT(camera);
+
+    ++_frame;
+    _tested.clear();
+    if (_effect == NULL || camera->getNode() == NULL)
+        return (unsigned int)nodes.size();
+
+    _viewProjectionMatrix = camera->getViewProjectionMatrix();
+    const Vector3 eye = camera->getNode()->getTranslationWorld();
+
+    unsigned int visibleCount = 0;
+    for (size_t i = 0, count = nodes.size(); i < count; ++i)
+    {
+        Node* node = nodes[i];
+        GP_ASSERT(node);
+
+        std::unordered_map<Node*, Query>::iterator itr = _queries.find(node);
+        if (itr == _queries.end())
+        {
+            Query query;
+            query.handle = 0;
+#ifdef GP_USE_OCCLUSION_QUERIES
+            GL_ASSERT( glGenQueries(1, &query.handle) );
+#endif
+            query.pending = false;
+            query.lastCulledFrame = 0;
+            query.nextTestFrame = _frame;
+            itr = _queries.insert(std::make_pair(node, query)).first;
+            node->addRef();
+        }
+        Query& query = itr->second;
+
+        if (query.lastCulledFrame != _frame - 1)
+        {
+            // The node has just come into view, so its last result no longer applies.
+            node->_occluded = false;
+            query.pending = false;
+            query.nextTestFrame = _frame;
+        }
+#ifdef GP_USE_OCCLUSION_QUERIES
+        else if (query.pending)
+        {
+            GLuint available = 0;
+            GL_ASSERT( glGetQueryObjectuiv(query.handle, GL_QUERY_RESULT_AVAILABLE, &available) );
+            if (available)
+            {
+                GLuint samples = 0;
+                GL_ASSERT( glGetQueryObjectuiv(query.handle, GL_QUERY_RESULT, &samples) );
+                query.pending = false;
+                node->_occluded = samples == 0;
+                query.nextTestFrame = node->_occluded ? _frame : _frame + _visibleTestInterval;
+            }
+        }
+#endif
+        query.lastCulledFrame = _frame;
+
+        // The faces of the bounding cube are clipped when the camera is inside it or too close to it.
+        const BoundingSphere& bounds = node->getBoundingSphere();
+        if (eye.distance(bounds.center) <= bounds.radius * 1.7320508f + camera->getNearPlane())
+        {
+            node->_occluded = false;
+        }
+        else if (!query.pending && _frame >= query.nextTestFrame)
+        {
+            _tested.push_back(node);
+        }
+
+        if (!node->_occluded)
+            ++visibleCount;
+    }
+
+    if (_frame % OCCLUSION_QUERY_LIFETIME == 0)
+        prune();
+
+    return visibleCount;
+}
+
+void OcclusionCuller::test()
+{
+#ifdef GP_USE_OCCLUSION_QUERIES
+    if (_tested.empty())
+        return;
+
+    _stateBlock->bind();
+    GL_ASSERT( glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE) );
+    _effect->bind();
+
+#ifdef GP_USE_VAO
+    if (glBindVertexArray)
+        GLStateCache::bindVertexArray(0);
+#endif
+    GLuint attribute = (GLuint)_effect->getVertexAttribute(VERTEX_ATTRIBUTE_POSITION_NAME);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, _vertexBuffer);
+    GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBuffer);
+    GL_ASSERT( glVertexAttribPointer(attribute, 3, GL_FLOAT, GL_FALSE, 0, 0) );
+    GL_ASSERT( glEnableVertexAttribArray(attribute) );
+
+    for (size_t i = 0, count = _tested.size(); i < count; ++i)
+    {
+        Node* node = _tested[i];
+        Query& query = _queries[node];
+
+        // A cube around the bounding sphere of the node.
+        const BoundingSphere& bounds = node->getBoundingSphere();
+        Matrix world;
+        Matrix::createTranslation(bounds.center, &world);
+        world.scale(bounds.radius);
+        Matrix worldViewProjection;
+        Matrix::multiply(_viewProjectionMatrix, world, &worldViewProjection);
+        _effect->setValue(_matrixUniform, worldViewProjection);
+
+        GL_ASSERT( glBeginQuery(GL_SAMPLES_PASSED, query.handle) );
+        GL_ASSERT( glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_SHORT, 0) );
+        GL_ASSERT( glEndQuery(GL_SAMPLES_PASSED) );
+        query.pending = true;
+    }
+
+    GL_ASSERT( glDisableVertexAttribArray(attribute) );
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+    GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    GL_ASSERT( glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE) );
+#endif
+    _tested.clear();
+}
+
+void OcclusionCuller::setVisibleTestInterval(unsigned int frames)
+{
+    _visibleTestInterval = std::max(frames, 1u);
+}
+
+unsigned int OcclusionCuller::getVisibleTestInterval() const
+{
+    return _visibleTestInterval;
+}
+
+void OcclusionCuller::prune()
+{
+    std::unordered_map<Node*, Query>::iterator itr = _queries.begin();
+    while (itr != _queries.end())
+    {
+        if (itr->second.lastCulledFrame + OCCLUSION_QUERY_LIFETIME < _frame)
+        {
+#ifdef GP_USE_OCCLUSION_QUERIES
+            GL_ASSERT( glDeleteQueries(1, &itr->second.handle) );
+#endif
+            itr->first->_occluded = false;
+            itr->first->release();
+            itr = _queries.erase(itr);
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+}
+
+}
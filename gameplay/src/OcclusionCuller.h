@@ -0,0 +1,136 @@
+#ifndef OCCLUSIONCULLER_H_
+#define OCCLUSIONCULLER_H_
+
+#include "Node.h"
+#include "Camera.h"
+#include "Effect.h"
+#include "RenderState.h"
+
+namespace gameplay
+{
+
+/**
+ * Defines a stage that finds the nodes hidden behind other geometry, using hardware occlusion queries.
+ *
+ * Frustum culling keeps every node in view, even when walls hide most of them. An occlusion
+ * culler tests the bounding volumes of the nodes in view against the depth buffer of the
+ * frame and sets the occluded flag of each node (see Node::isOccluded()), which draw
+ * visitors and RenderQueue::submit(Scene*) use to skip the hidden nodes.
+ *
+ * Query results are read back a frame later so that the CPU never waits on the GPU, and
+ * the visibility of each node is assumed to stay the same until its next result arrives.
+ * Visible nodes are only tested again every few frames, while occluded nodes are tested
+ * every frame so that they reappear as soon as they come into view.
+ *
+ * A frame is culled in two steps:
+ * <ol>
+ * <li>cull() is called with the nodes in view before drawing, which updates their flags.
+ * <li>test() is called after the visible opaque geometry has been drawn, which issues the
+ * queries for the nodes due for a test against the depth buffer of the frame.
+ * </ol>
+ *
+ * Occlusion queries are not available on OpenGL ES 2.0, where every node stays visible.
+ */
+class OcclusionCuller
+{
+public:
+
+    /**
+     * Creates a new occlusion culler.
+     *
+     * @return A new occlusion culler.
+     * @script{create}
+     */
+    static OcclusionCuller* create();
+
+    /**
+     * Destructor.
+     */
+    ~OcclusionCuller();
+
+    /**
+     * Updates the occluded flags of the nodes in view with the latest query results.
+     *
+     * @param camera The camera the frame is drawn from.
+     * @param nodes The nodes in view, typically found with Scene::findVisibleNodes().
+     *
+     * @return The number of the nodes that are not occluded.
+     * @script{ignore}
+     */
+    unsigned int cull(Camera* camera, const std::vector<Node*>& nodes);
+
+    /**
+     * Issues the occlusion queries of the nodes passed to the last call to cull() that are due for a test.
+     *
+     * The bounding volumes of the nodes are drawn without writing color or depth, so this
+     * must be called while the depth buffer holds the geometry drawn in the frame.
+     */
+    void test();
+
+    /**
+     * Sets the number of frames between the tests of a node that was found visible.
+     *
+     * Longer intervals issue fewer queries, while a node that becomes hidden stays drawn
+     * for longer. The default is 4.
+     *
+     * @param frames The number of frames, at least 1.
+     */
+    void setVisibleTestInterval(unsigned int frames);
+
+    /**
+     * Gets the number of frames between the tests of a node that was found visible.
+     *
+     * @return The number of frames.
+     */
+    unsigned int getVisibleTestInterval() const;
+
+private:
+
+    struct Query
+    {
+        GLuint handle;
+        bool pending;
+        unsigned int lastCulledFrame;
+        unsigned int nextTestFrame;
+    };
+
+    /**
+     * Constructor.
+     */
+    OcclusionCuller();
+
+    /**
+     * Hidden copy constructor.
+     */
+    OcclusionCuller(const OcclusionCuller&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    OcclusionCuller& operator=(const OcclusionCuller&);
+
+    /**
+     * Creates the effect, state and unit cube used to draw the bounding volumes of the queries.
+     */
+    bool initialize();
+
+    /**
+     * Deletes the queries of the nodes that have not been in view for a while.
+     */
+    void prune();
+
+    std::unordered_map<Node*, Query> _queries;
+    std::vector<Node*> _tested;
+    Matrix _viewProjectionMatrix;
+    unsigned int _frame;
+    unsigned int _visibleTestInterval;
+    Effect* _effect;
+    Uniform* _matrixUniform;
+    RenderState::StateBlock* _stateBlock;
+    GLuint _vertexBuffer;
+    GLuint _indexBuffer;
+};
+
+}
+
+#endif
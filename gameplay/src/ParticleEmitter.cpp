@@ -5,17 +5,27 @@
 #include "Scene.h"
 #include "Quaternion.h"
 #include "Properties.h"
+#include "MathUtil.h"
+#include "ParticleSimulator.h"
+#include "ParticleRenderer.h"
+#include "ParticleSystem.h"
 
 #define PARTICLE_COUNT_MAX                       100
 #define PARTICLE_EMISSION_RATE                   10
 #define PARTICLE_EMISSION_RATE_TIME_INTERVAL     1000.0f / (float)PARTICLE_EMISSION_RATE
 #define PARTICLE_UPDATE_RATE_MAX                 8
 
+// The number of particles that the particle arrays are padded to a multiple of.
+#define PARTICLE_ARRAY_ALIGNMENT                 4
+
 namespace gameplay
 {
 
+// The number of emitters created, which seeds the random state of each new emitter.
+static std::atomic<unsigned int> __emitterCount(0);
+
 ParticleEmitter::ParticleEmitter(unsigned int particleCountMax) : Drawable(),
-    _particleCountMax(particleCountMax), _particleCount(0), _particles(NULL),
+    _particleCountMax(particleCountMax), _particleCount(0), _particleStride(0), _particles(NULL), _particleFrames(NULL), _simulator(NULL), _renderer(NULL),
     _emissionRate(PARTICLE_EMISSION_RATE), _started(false), _ellipsoid(false),
     _sizeStartMin(1.0f), _sizeStartMax(1.0f), _sizeEndMin(1.0f), _sizeEndMax(1.0f),
     _energyMin(1000L), _energyMax(1000L),
@@ -29,16 +39,30 @@ ParticleEmitter::ParticleEmitter(unsigned int particleCountMax) : Drawable(),
     _spriteBatch(NULL), _spriteBlendMode(BLEND_ALPHA),  _spriteTextureWidth(0), _spriteTextureHeight(0), _spriteTextureWidthRatio(0), _spriteTextureHeightRatio(0), _spriteTextureCoords(NULL),
     _spriteAnimated(false),  _spriteLooped(false), _spriteFrameCount(1), _spriteFrameRandomOffset(0),_spriteFrameDuration(0L), _spriteFrameDurationSecs(0.0f), _spritePercentPerFrame(0.0f),
     _orbitPosition(false), _orbitVelocity(false), _orbitAcceleration(false),
-    _timePerEmission(PARTICLE_EMISSION_RATE_TIME_INTERVAL), _emitTime(0), _lastUpdated(0)
+    _timePerEmission(PARTICLE_EMISSION_RATE_TIME_INTERVAL), _emitTime(0), _updateTime(0), _lastUpdated(0),
+    _cullingEnabled(true), _culledTime(0), _boundsTime(0), _boundsChanged(false), _particleVersion(0), _systemUpdated(false), _randomState(0)
 {
     GP_ASSERT(particleCountMax);
-    _particles = new Particle[particleCountMax];
+
+    // Give each emitter a distinct non-zero xorshift state, spread by a multiplicative hash.
+    _randomState = (++__emitterCount) * 2654435761u;
+    if (_randomState == 0)
+        _randomState = 1;
+    _particleStride = (particleCountMax + PARTICLE_ARRAY_ALIGNMENT - 1) & ~(PARTICLE_ARRAY_ALIGNMENT - 1);
+    _particles = new float[PARTICLE_ARRAY_COUNT * _particleStride];
+    _particleFrames = new unsigned int[particleCountMax];
+    _renderer = ParticleRenderer::create(particleCountMax);
 }
 
 ParticleEmitter::~ParticleEmitter()
 {
+    if (_systemUpdated)
+        ParticleSystem::remove(this);
     SAFE_DELETE(_spriteBatch);
     SAFE_DELETE_ARRAY(_particles);
+    SAFE_DELETE_ARRAY(_particleFrames);
+    SAFE_DELETE(_simulator);
+    SAFE_DELETE(_renderer);
     SAFE_DELETE_ARRAY(_spriteTextureCoords);
 }
 
@@ -175,6 +199,7 @@ ParticleEmitter* ParticleEmitter::create(Properties* properties)
     bool orbitPosition = properties->getBool("orbitPosition");
     bool orbitVelocity = properties->getBool("orbitVelocity");
     bool orbitAcceleration = properties->getBool("orbitAcceleration");
+    Simulation simulation = getSimulationFromString(properties->getString("simulation"));
 
     // Apply all properties to a newly created ParticleEmitter.
     ParticleEmitter* emitter = ParticleEmitter::create(texturePath.c_str(), blendMode, particleCountMax);
@@ -199,6 +224,7 @@ ParticleEmitter* ParticleEmitter::create(Properties* properties)
     emitter->setSpriteFrameDuration(spriteFrameDuration);
     emitter->setSpriteFrameCoords(spriteFrameCount, spriteWidth, spriteHeight);
     emitter->setOrbit(orbitPosition, orbitVelocity, orbitAcceleration);
+    emitter->setSimulation(simulation);
 
     return emitter;
 }
@@ -302,6 +328,15 @@ void ParticleEmitter::emitOnce(unsigned int particleCount)
     GP_ASSERT(_node);
     GP_ASSERT(_particles);
 
+    // The GPU emits the particles with its next update.
+    if (_simulator)
+    {
+        _simulator->emit(particleCount);
+        return;
+    }
+
+    ++_particleVersion;
+
     // Limit particleCount so as not to go over _particleCountMax.
     if (particleCount + _particleCount > _particleCountMax)
     {
@@ -318,63 +353,87 @@ void ParticleEmitter::emitOnce(unsigned int particleCount)
     world.m[14] = 0.0f;
 
     // Emit the new particles.
+    Vector3 position, velocity, acceleration, rotationAxis;
+    Vector4 colorStart, colorEnd;
     for (unsigned int i = 0; i < particleCount; i++)
     {
-        Particle* p = &_particles[_particleCount];
-
-        generateColor(_colorStart, _colorStartVar, &p->_colorStart);
-        generateColor(_colorEnd, _colorEndVar, &p->_colorEnd);
-        p->_color.set(p->_colorStart);
-
-        p->_energy = p->_energyStart = generateScalar(_energyMin, _energyMax);
-        p->_size = p->_sizeStart = generateScalar(_sizeStartMin, _sizeStartMax);
-        p->_sizeEnd = generateScalar(_sizeEndMin, _sizeEndMax);
-        p->_rotationPerParticleSpeed = generateScalar(_rotationPerParticleSpeedMin, _rotationPerParticleSpeedMax);
-        p->_angle = generateScalar(0.0f, p->_rotationPerParticleSpeed);
-        p->_rotationSpeed = generateScalar(_rotationSpeedMin, _rotationSpeedMax);
+        const unsigned int p = _particleCount;
+
+        generateColor(_colorStart, _colorStartVar, &colorStart);
+        generateColor(_colorEnd, _colorEndVar, &colorEnd);
+        getParticleArray(COLOR_START_R)[p] = getParticleArray(COLOR_R)[p] = colorStart.x;
+        getParticleArray(COLOR_START_G)[p] = getParticleArray(COLOR_G)[p] = colorStart.y;
+        getParticleArray(COLOR_START_B)[p] = getParticleArray(COLOR_B)[p] = colorStart.z;
+        getParticleArray(COLOR_START_A)[p] = getParticleArray(COLOR_A)[p] = colorStart.w;
+        getParticleArray(COLOR_END_R)[p] = colorEnd.x;
+        getParticleArray(COLOR_END_G)[p] = colorEnd.y;
+        getParticleArray(COLOR_END_B)[p] = colorEnd.z;
+        getParticleArray(COLOR_END_A)[p] = colorEnd.w;
+
+        getParticleArray(ENERGY)[p] = getParticleArray(ENERGY_START)[p] = generateScalar(_energyMin, _energyMax);
+        getParticleArray(SIZE)[p] = getParticleArray(SIZE_START)[p] = generateScalar(_sizeStartMin, _sizeStartMax);
+        getParticleArray(SIZE_END)[p] = generateScalar(_sizeEndMin, _sizeEndMax);
+        const float rotationPerParticleSpeed = generateScalar(_rotationPerParticleSpeedMin, _rotationPerParticleSpeedMax);
+        getParticleArray(ROTATION_PER_PARTICLE_SPEED)[p] = rotationPerParticleSpeed;
+        getParticleArray(ANGLE)[p] = generateScalar(0.0f, rotationPerParticleSpeed);
+        const float rotationSpeed = generateScalar(_rotationSpeedMin, _rotationSpeedMax);
+        getParticleArray(ROTATION_SPEED)[p] = rotationSpeed;
 
         // Only initial position can be generated within an ellipsoidal domain.
-        generateVector(_position, _positionVar, &p->_position, _ellipsoid);
-        generateVector(_velocity, _velocityVar, &p->_velocity, false);
-        generateVector(_acceleration, _accelerationVar, &p->_acceleration, false);
-        generateVector(_rotationAxis, _rotationAxisVar, &p->_rotationAxis, false);
+        generateVector(_position, _positionVar, &position, _ellipsoid);
+        generateVector(_velocity, _velocityVar, &velocity, false);
+        generateVector(_acceleration, _accelerationVar, &acceleration, false);
+        generateVector(_rotationAxis, _rotationAxisVar, &rotationAxis, false);
 
         // Initial position, velocity and acceleration can all be relative to the emitter's transform.
         // Rotate specified properties by the node's rotation.
         if (_orbitPosition)
         {
-            world.transformPoint(p->_position, &p->_position);
+            world.transformPoint(position, &position);
         }
 
         if (_orbitVelocity)
         {
-            world.transformPoint(p->_velocity, &p->_velocity);
+            world.transformPoint(velocity, &velocity);
         }
 
         if (_orbitAcceleration)
         {
-            world.transformPoint(p->_acceleration, &p->_acceleration);
+            world.transformPoint(acceleration, &acceleration);
         }
 
         // The rotation axis always orbits the node.
-        if (p->_rotationSpeed != 0.0f && !p->_rotationAxis.isZero())
+        if (rotationSpeed != 0.0f && !rotationAxis.isZero())
         {
-            world.transformPoint(p->_rotationAxis, &p->_rotationAxis);
+            world.transformPoint(rotationAxis, &rotationAxis);
         }
 
         // Translate position relative to the node's world space.
-        p->_position.add(translation);
+        position.add(translation);
+
+        getParticleArray(POSITION_X)[p] = position.x;
+        getParticleArray(POSITION_Y)[p] = position.y;
+        getParticleArray(POSITION_Z)[p] = position.z;
+        getParticleArray(VELOCITY_X)[p] = velocity.x;
+        getParticleArray(VELOCITY_Y)[p] = velocity.y;
+        getParticleArray(VELOCITY_Z)[p] = velocity.z;
+        getParticleArray(ACCELERATION_X)[p] = acceleration.x;
+        getParticleArray(ACCELERATION_Y)[p] = acceleration.y;
+        getParticleArray(ACCELERATION_Z)[p] = acceleration.z;
+        getParticleArray(ROTATION_AXIS_X)[p] = rotationAxis.x;
+        getParticleArray(ROTATION_AXIS_Y)[p] = rotationAxis.y;
+        getParticleArray(ROTATION_AXIS_Z)[p] = rotationAxis.z;
 
         // Initial sprite frame.
         if (_spriteFrameRandomOffset > 0)
         {
-            p->_frame = rand() % _spriteFrameRandomOffset;
+            _particleFrames[p] = generateRandom() % _spriteFrameRandomOffset;
         }
         else
         {
-            p->_frame = 0;
+            _particleFrames[p] = 0;
         }
-        p->_timeOnCurrentFrame = 0.0f;
+        getParticleArray(TIME_ON_CURRENT_FRAME)[p] = 0.0f;
 
         ++_particleCount;
     }
@@ -385,6 +444,59 @@ unsigned int ParticleEmitter::getParticlesCount() const
     return _particleCount;
 }
 
+void ParticleEmitter::setSimulation(Simulation simulation)
+{
+    if (simulation == getSimulation())
+        return;
+
+    _particleCount = 0;
+    ++_particleVersion;
+    _particleBounds = _previousBounds = BoundingBox::empty();
+    SAFE_DELETE(_simulator);
+    if (simulation == SIMULATION_GPU)
+    {
+        _simulator = ParticleSimulator::create(_particleCountMax);
+        if (!_simulator)
+            GP_WARN("Particles cannot be simulated on the GPU on this platform; simulating them on the CPU.");
+    }
+}
+
+ParticleEmitter::Simulation ParticleEmitter::getSimulation() const
+{
+    return _simulator ? SIMULATION_GPU : SIMULATION_CPU;
+}
+
+const BoundingBox& ParticleEmitter::getBoundingBox() const
+{
+    _bounds = _particleBounds;
+    if (_node)
+    {
+        BoundingBox emission;
+        getEmissionBounds(&emission);
+        if (_bounds.isEmpty())
+            _bounds = emission;
+        else
+            _bounds.merge(emission);
+    }
+    if (!_previousBounds.isEmpty() && _simulator)
+    {
+        _bounds.merge(_previousBounds);
+    }
+    return _bounds;
+}
+
+void ParticleEmitter::setCullingEnabled(bool enabled)
+{
+    _cullingEnabled = enabled;
+    if (!enabled)
+        _culledTime = 0;
+}
+
+bool ParticleEmitter::isCullingEnabled() const
+{
+    return _cullingEnabled;
+}
+
 void ParticleEmitter::setEllipsoid(bool ellipsoid)
 {
     _ellipsoid = ellipsoid;
@@ -744,26 +856,48 @@ bool ParticleEmitter::getOrbitAcceleration() const
     return _orbitAcceleration;
 }
 
+unsigned int ParticleEmitter::generateRandom()
+{
+    // xorshift32
+    unsigned int x = _randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    _randomState = x;
+    return x;
+}
+
+float ParticleEmitter::generateRandom0_1()
+{
+    // The top 24 bits, which a float holds exactly.
+    return (float)(generateRandom() >> 8) * (1.0f / 16777215.0f);
+}
+
+float ParticleEmitter::generateRandomMinus1_1()
+{
+    return 2.0f * generateRandom0_1() - 1.0f;
+}
+
 long ParticleEmitter::generateScalar(long min, long max)
 {
-    // Note: this is not a very good RNG, but it should be suitable for our purposes.
-    long r = 0;
-    for (unsigned int i = 0; i < sizeof(long)/sizeof(int); i++)
+    if (max <= min)
+        return min;
+
+    // A random unsigned long made of as many random integers as it holds. Each is shifted in
+    // two steps, since a shift by the whole width of a 32-bit long is undefined.
+    unsigned long r = 0;
+    for (unsigned int i = 0; i < sizeof(long) / sizeof(unsigned int); i++)
     {
-        r = r << 8; // sizeof(int) * CHAR_BITS
-        r |= rand();
+        r = (r << (sizeof(unsigned int) * 8 - 1) << 1) | generateRandom();
     }
 
-    // Now we have a random long between 0 and MAX_LONG.  We need to clamp it between min and max.
-    r %= max - min;
-    r += min;
-
-    return r;
+    // Clamp it between min and max.
+    return min + (long)(r % (unsigned long)(max - min));
 }
 
 float ParticleEmitter::generateScalar(float min, float max)
 {
-    return min + (max - min) * MATH_RANDOM_0_1();
+    return min + (max - min) * generateRandom0_1();
 }
 
 void ParticleEmitter::generateVectorInRect(const Vector3& base, const Vector3& variance, Vector3* dst)
@@ -772,9 +906,9 @@ void ParticleEmitter::generateVectorInRect(const Vector3& base, const Vector3& v
 
     // Scale each component of the variance vector by a random float
     // between -1 and 1, then add this to the corresponding base component.
-    dst->x = base.x + variance.x * MATH_RANDOM_MINUS1_1();
-    dst->y = base.y + variance.y * MATH_RANDOM_MINUS1_1();
-    dst->z = base.z + variance.z * MATH_RANDOM_MINUS1_1();
+    dst->x = base.x + variance.x * generateRandomMinus1_1();
+    dst->y = base.y + variance.y * generateRandomMinus1_1();
+    dst->z = base.z + variance.z * generateRandomMinus1_1();
 }
 
 void ParticleEmitter::generateVectorInEllipsoid(const Vector3& center, const Vector3& scale, Vector3* dst)
@@ -784,9 +918,9 @@ void ParticleEmitter::generateVectorInEllipsoid(const Vector3& center, const Vec
     // Generate a point within a unit cube, then reject if the point is not in a unit sphere.
     do
     {
-        dst->x = MATH_RANDOM_MINUS1_1();
-        dst->y = MATH_RANDOM_MINUS1_1();
-        dst->z = MATH_RANDOM_MINUS1_1();
+        dst->x = generateRandomMinus1_1();
+        dst->y = generateRandomMinus1_1();
+        dst->z = generateRandomMinus1_1();
     } while (dst->length() > 1.0f);
     
     // Scale this point by the scaling vector.
@@ -816,10 +950,19 @@ void ParticleEmitter::generateColor(const Vector4& base, const Vector4& variance
 
     // Scale each component of the variance color by a random float
     // between -1 and 1, then add this to the corresponding base component.
-    dst->x = base.x + variance.x * MATH_RANDOM_MINUS1_1();
-    dst->y = base.y + variance.y * MATH_RANDOM_MINUS1_1();
-    dst->z = base.z + variance.z * MATH_RANDOM_MINUS1_1();
-    dst->w = base.w + variance.w * MATH_RANDOM_MINUS1_1();
+    dst->x = base.x + variance.x * generateRandomMinus1_1();
+    dst->y = base.y + variance.y * generateRandomMinus1_1();
+    dst->z = base.z + variance.z * generateRandomMinus1_1();
+    dst->w = base.w + variance.w * generateRandomMinus1_1();
+}
+
+ParticleEmitter::Simulation ParticleEmitter::getSimulationFromString(const char* str)
+{
+    if (str && (strcmp(str, "SIMULATION_GPU") == 0 || strcmp(str, "GPU") == 0))
+    {
+        return SIMULATION_GPU;
+    }
+    return SIMULATION_CPU;
 }
 
 ParticleEmitter::BlendMode ParticleEmitter::getBlendModeFromString(const char* str)
@@ -857,22 +1000,51 @@ ParticleEmitter::BlendMode ParticleEmitter::getBlendModeFromString(const char* s
 }
 
 void ParticleEmitter::update(float elapsedTime)
+{
+    updateParticles(elapsedTime);
+    updateNodeBounds();
+}
+
+void ParticleEmitter::updateParticles(float elapsedTime)
 {
     if (!isActive())
         return;
 
     // Cap particle updates at a maximum rate. This saves processing
     // and also improves precision since updating with very small
-    // time increments is more lossy.
-    static double runningTime = 0;
-    runningTime += elapsedTime;
-    if (runningTime < PARTICLE_UPDATE_RATE_MAX)
-        return;    
+    // time increments is more lossy. Each emitter keeps its own time,
+    // so that every emitter is updated at the same rate.
+    _updateTime += elapsedTime;
+
+    // A hidden emitter leaves its particles as they are until it is seen again.
+    if (isUpdateCulled())
+    {
+        _culledTime = std::min(_culledTime + _updateTime, _energyMax);
+        _updateTime = 0;
 
-    float elapsedMs = runningTime;
-    runningTime = 0;
+        // Once an emitter that has stopped is hidden for a whole lifetime, its particles have all died.
+        if (!_started && _culledTime >= _energyMax)
+        {
+            if (_simulator)
+            {
+                _simulator->update(this, _culledTime);
+                _particleCount = _simulator->getParticleCount();
+            }
+            else
+            {
+                _particleCount = 0;
+            }
+            _culledTime = 0;
+            ++_particleVersion;
+            updateParticleBounds(0);
+        }
+        return;
+    }
+    if (_updateTime < PARTICLE_UPDATE_RATE_MAX)
+        return;
 
-    float elapsedSecs = elapsedMs * 0.001f;
+    float elapsedMs = _updateTime;
+    _updateTime = 0;
 
     if (_started && _emissionRate)
     {
@@ -893,98 +1065,283 @@ void ParticleEmitter::update(float elapsedTime)
         }
     }
 
-    // Now update all currently living particles.
-    GP_ASSERT(_particles);
-    for (unsigned int particlesIndex = 0; particlesIndex < _particleCount; ++particlesIndex)
+    ++_particleVersion;
+
+    // The particles age by the time the emitter was hidden for as well.
+    elapsedMs += _culledTime;
+    _culledTime = 0;
+    float elapsedSecs = elapsedMs * 0.001f;
+
+    if (_simulator)
     {
-        Particle* p = &_particles[particlesIndex];
-        p->_energy -= elapsedMs;
+        _simulator->update(this, elapsedMs);
+        _particleCount = _simulator->getParticleCount();
+        updateParticleBounds(elapsedMs);
+        return;
+    }
 
-        if (p->_energy > 0L)
+    // Remove the particles that die this update. The particle furthest from the start of the
+    // arrays is moved down to take the place of each, so that the living particles stay contiguous.
+    GP_ASSERT(_particles);
+    float* energy = getParticleArray(ENERGY);
+    for (unsigned int i = 0; i < _particleCount;)
+    {
+        energy[i] -= elapsedMs;
+        if (energy[i] > 0.0f)
+        {
+            ++i;
+        }
+        else
         {
-            if (p->_rotationSpeed != 0.0f && !p->_rotationAxis.isZero())
+            --_particleCount;
+            if (i != _particleCount)
             {
-                Matrix::createRotation(p->_rotationAxis, p->_rotationSpeed * elapsedSecs, &_rotation);
+                // The moved particle has not aged yet, so it is aged in this slot next.
+                moveParticle(_particleCount, i);
+            }
+        }
+    }
+    const unsigned int count = _particleCount;
+    if (count == 0)
+    {
+        updateParticleBounds(elapsedMs);
+        return;
+    }
 
-                _rotation.transformPoint(p->_velocity, &p->_velocity);
-                _rotation.transformPoint(p->_acceleration, &p->_acceleration);
+    // Rotate the velocities and accelerations of the particles that rotate about an axis.
+    if (_rotationSpeedMin != 0.0f || _rotationSpeedMax != 0.0f)
+    {
+        const float* rotationSpeed = getParticleArray(ROTATION_SPEED);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            const Vector3 axis(getParticleArray(ROTATION_AXIS_X)[i], getParticleArray(ROTATION_AXIS_Y)[i], getParticleArray(ROTATION_AXIS_Z)[i]);
+            if (rotationSpeed[i] != 0.0f && !axis.isZero())
+            {
+                Matrix::createRotation(axis, rotationSpeed[i] * elapsedSecs, &_rotation);
+
+                Vector3 velocity(getParticleArray(VELOCITY_X)[i], getParticleArray(VELOCITY_Y)[i], getParticleArray(VELOCITY_Z)[i]);
+                Vector3 acceleration(getParticleArray(ACCELERATION_X)[i], getParticleArray(ACCELERATION_Y)[i], getParticleArray(ACCELERATION_Z)[i]);
+                _rotation.transformPoint(&velocity);
+                _rotation.transformPoint(&acceleration);
+                getParticleArray(VELOCITY_X)[i] = velocity.x;
+                getParticleArray(VELOCITY_Y)[i] = velocity.y;
+                getParticleArray(VELOCITY_Z)[i] = velocity.z;
+                getParticleArray(ACCELERATION_X)[i] = acceleration.x;
+                getParticleArray(ACCELERATION_Y)[i] = acceleration.y;
+                getParticleArray(ACCELERATION_Z)[i] = acceleration.z;
             }
+        }
+    }
 
-            // Particle is still alive.
-            p->_velocity.x += p->_acceleration.x * elapsedSecs;
-            p->_velocity.y += p->_acceleration.y * elapsedSecs;
-            p->_velocity.z += p->_acceleration.z * elapsedSecs;
+    // Integrate the motion of the living particles, one array at a time.
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        MathUtil::multiplyAddArray(getParticleArray((ParticleArray)(ACCELERATION_X + axis)), elapsedSecs, getParticleArray((ParticleArray)(VELOCITY_X + axis)), count);
+        MathUtil::multiplyAddArray(getParticleArray((ParticleArray)(VELOCITY_X + axis)), elapsedSecs, getParticleArray((ParticleArray)(POSITION_X + axis)), count);
+    }
+    MathUtil::multiplyAddArray(getParticleArray(ROTATION_PER_PARTICLE_SPEED), elapsedSecs, getParticleArray(ANGLE), count);
 
-            p->_position.x += p->_velocity.x * elapsedSecs;
-            p->_position.y += p->_velocity.y * elapsedSecs;
-            p->_position.z += p->_velocity.z * elapsedSecs;
+    // Simple linear interpolation of color and size.
+    float* percent = getParticleArray(PERCENT);
+    const float* energyStart = getParticleArray(ENERGY_START);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        percent[i] = 1.0f - energy[i] / energyStart[i];
+    }
+    for (int channel = 0; channel < 4; ++channel)
+    {
+        MathUtil::lerpArray(getParticleArray((ParticleArray)(COLOR_START_R + channel)), getParticleArray((ParticleArray)(COLOR_END_R + channel)),
+                            percent, getParticleArray((ParticleArray)(COLOR_R + channel)), count);
+    }
+    MathUtil::lerpArray(getParticleArray(SIZE_START), getParticleArray(SIZE_END), percent, getParticleArray(SIZE), count);
 
-            p->_angle += p->_rotationPerParticleSpeed * elapsedSecs;
+    // Handle sprite animations.
+    if (_spriteAnimated)
+    {
+        updateSpriteFrames(elapsedSecs);
+    }
 
-            // Simple linear interpolation of color and size.
-            float percent = 1.0f - ((float)p->_energy / (float)p->_energyStart);
+    updateParticleBounds(elapsedMs);
+}
 
-            p->_color.x = p->_colorStart.x + (p->_colorEnd.x - p->_colorStart.x) * percent;
-            p->_color.y = p->_colorStart.y + (p->_colorEnd.y - p->_colorStart.y) * percent;
-            p->_color.z = p->_colorStart.z + (p->_colorEnd.z - p->_colorStart.z) * percent;
-            p->_color.w = p->_colorStart.w + (p->_colorEnd.w - p->_colorStart.w) * percent;
+float* ParticleEmitter::getParticleArray(ParticleArray array) const
+{
+    return _particles + array * _particleStride;
+}
 
-            p->_size = p->_sizeStart + (p->_sizeEnd - p->_sizeStart) * percent;
+void ParticleEmitter::moveParticle(unsigned int from, unsigned int to)
+{
+    for (int array = 0; array < PARTICLE_ARRAY_COUNT; ++array)
+    {
+        float* values = getParticleArray((ParticleArray)array);
+        values[to] = values[from];
+    }
+    _particleFrames[to] = _particleFrames[from];
+}
 
-            // Handle sprite animations.
-            if (_spriteAnimated)
+void ParticleEmitter::updateSpriteFrames(float elapsedSecs)
+{
+    const float* percent = getParticleArray(PERCENT);
+    float* timeOnCurrentFrame = getParticleArray(TIME_ON_CURRENT_FRAME);
+    for (unsigned int i = 0; i < _particleCount; ++i)
+    {
+        unsigned int& frame = _particleFrames[i];
+        if (!_spriteLooped)
+        {
+            // The last frame should finish exactly when the particle dies.
+            timeOnCurrentFrame[i] = percent[i] - frame * _spritePercentPerFrame;
+            if (frame < _spriteFrameCount - 1 &&
+                timeOnCurrentFrame[i] >= _spritePercentPerFrame)
             {
-                if (!_spriteLooped)
-                {
-                    // The last frame should finish exactly when the particle dies.
-                    float percentSpent = 0.0f;
-                    for (unsigned int i = 0; i < p->_frame; i++)
-                    {
-                        percentSpent += _spritePercentPerFrame;
-                    }
-                    p->_timeOnCurrentFrame = percent - percentSpent;
-                    if (p->_frame < _spriteFrameCount - 1 &&
-                        p->_timeOnCurrentFrame >= _spritePercentPerFrame)
-                    {
-                        ++p->_frame;
-                    }
-                }
-                else
-                {
-                    // _spriteFrameDurationSecs is an absolute time measured in seconds,
-                    // and the animation repeats indefinitely.
-                    p->_timeOnCurrentFrame += elapsedSecs;
-                    if (p->_timeOnCurrentFrame >= _spriteFrameDurationSecs)
-                    {
-                        p->_timeOnCurrentFrame -= _spriteFrameDurationSecs;
-                        ++p->_frame;
-                        if (p->_frame == _spriteFrameCount)
-                        {
-                            p->_frame = 0;
-                        }
-                    }
-                }
+                ++frame;
             }
         }
         else
         {
-            // Particle is dead.  Move the particle furthest from the start of the array
-            // down to take its place, and re-use the slot at the end of the list of living particles.
-            if (particlesIndex != _particleCount - 1)
+            // _spriteFrameDurationSecs is an absolute time measured in seconds,
+            // and the animation repeats indefinitely.
+            timeOnCurrentFrame[i] += elapsedSecs;
+            if (timeOnCurrentFrame[i] >= _spriteFrameDurationSecs)
             {
-                _particles[particlesIndex] = _particles[_particleCount - 1];
+                timeOnCurrentFrame[i] -= _spriteFrameDurationSecs;
+                ++frame;
+                if (frame == _spriteFrameCount)
+                {
+                    frame = 0;
+                }
             }
-            --_particleCount;
         }
     }
 }
 
+bool ParticleEmitter::isUpdateCulled() const
+{
+    if (!_cullingEnabled || !_node)
+        return false;
+
+    // Visibility is found while drawing, so the last frame tells whether the emitter is seen.
+    Scene* scene = _node->getScene();
+    const unsigned int frame = Game::getInstance()->getFrameNumber();
+    return scene && scene->getVisibleFrame() + 1 >= frame && _node->getVisibleFrame() + 1 < frame;
+}
+
+void ParticleEmitter::getEmissionBounds(BoundingBox* dst) const
+{
+    GP_ASSERT(dst);
+    GP_ASSERT(_node);
+
+    // Positions are generated within the box of their variance, which holds an ellipsoidal domain too.
+    const Matrix& world = _node->getWorldMatrix();
+    const Vector3 variance(fabs(_positionVar.x), fabs(_positionVar.y), fabs(_positionVar.z));
+    dst->set(_position - variance, _position + variance);
+    if (_orbitPosition)
+    {
+        dst->transform(world);
+    }
+    else
+    {
+        Vector3 translation;
+        world.getTranslation(&translation);
+        dst->min.add(translation);
+        dst->max.add(translation);
+    }
+
+    // A camera-facing quad reaches out by half its diagonal, whichever way it is rotated.
+    float extent = std::max(_sizeStartMax, _sizeEndMax) * 0.7072f;
+    if (_simulator)
+    {
+        // The particles on the GPU are not read back, so count how far one could move in its
+        // longest lifetime. Rotating the velocity keeps its speed, and the stepped integration
+        // moves no further than a full step of acceleration per lifetime.
+        Vector3 scale;
+        world.getScale(&scale);
+        const float maxScale = std::max(std::max(fabs(scale.x), fabs(scale.y)), fabs(scale.z));
+        const float speed = (_velocity.length() + _velocityVar.length()) * (_orbitVelocity ? maxScale : 1.0f);
+        const float acceleration = (_acceleration.length() + _accelerationVar.length()) * (_orbitAcceleration ? maxScale : 1.0f);
+        const float lifetime = _energyMax * 0.001f;
+        extent += (speed + acceleration * lifetime) * lifetime;
+    }
+    dst->min.x -= extent;
+    dst->min.y -= extent;
+    dst->min.z -= extent;
+    dst->max.x += extent;
+    dst->max.y += extent;
+    dst->max.z += extent;
+}
+
+void ParticleEmitter::updateParticleBounds(float elapsedMs)
+{
+    if (_simulator)
+    {
+        // Every living particle was emitted within the longest lifetime, so the boxes the
+        // emitter was in over this lifetime and the last one hold them all.
+        BoundingBox emission;
+        getEmissionBounds(&emission);
+        _boundsTime += elapsedMs;
+        if (_boundsTime > _energyMax || _particleBounds.isEmpty())
+        {
+            _previousBounds = _particleBounds;
+            _particleBounds = emission;
+            _boundsTime = 0;
+        }
+        else
+        {
+            _particleBounds.merge(emission);
+        }
+    }
+    else if (_particleCount > 0)
+    {
+        const float* positionX = getParticleArray(POSITION_X);
+        const float* positionY = getParticleArray(POSITION_Y);
+        const float* positionZ = getParticleArray(POSITION_Z);
+        const float* size = getParticleArray(SIZE);
+        Vector3 min(positionX[0], positionY[0], positionZ[0]);
+        Vector3 max(min);
+        float sizeMax = size[0];
+        for (unsigned int i = 1; i < _particleCount; ++i)
+        {
+            min.x = std::min(min.x, positionX[i]);
+            min.y = std::min(min.y, positionY[i]);
+            min.z = std::min(min.z, positionZ[i]);
+            max.x = std::max(max.x, positionX[i]);
+            max.y = std::max(max.y, positionY[i]);
+            max.z = std::max(max.z, positionZ[i]);
+            sizeMax = std::max(sizeMax, size[i]);
+        }
+        const float extent = sizeMax * 0.7072f;
+        _particleBounds.set(min.x - extent, min.y - extent, min.z - extent, max.x + extent, max.y + extent, max.z + extent);
+    }
+    else
+    {
+        _particleBounds = BoundingBox::empty();
+    }
+
+    _boundsChanged = true;
+}
+
+void ParticleEmitter::updateNodeBounds()
+{
+    if (_boundsChanged && _node)
+        _node->setBoundsDirty();
+    _boundsChanged = false;
+}
+
 unsigned int ParticleEmitter::draw(bool wireframe)
 {
     if (!isActive())
         return 0;
 
-    if (_particleCount > 0)
+    GP_PROFILE_GPU_SCOPE("ParticleEmitter::draw");
+
+    if (_particleCount > 0 && _simulator)
+    {
+        _simulator->draw(this);
+    }
+    else if (_particleCount > 0 && _renderer)
+    {
+        _renderer->draw(this);
+    }
+    else if (_particleCount > 0)
     {
         GP_ASSERT(_spriteBatch);
         GP_ASSERT(_particles);
@@ -1011,13 +1368,17 @@ unsigned int ParticleEmitter::draw(bool wireframe)
         Vector3 up;
         cameraWorldMatrix.getUpVector(&up);
 
+        const float* size = getParticleArray(SIZE);
+        const float* angle = getParticleArray(ANGLE);
         for (unsigned int i = 0; i < _particleCount; i++)
         {
-            Particle* p = &_particles[i];
+            const Vector3 position(getParticleArray(POSITION_X)[i], getParticleArray(POSITION_Y)[i], getParticleArray(POSITION_Z)[i]);
+            const Vector4 color(getParticleArray(COLOR_R)[i], getParticleArray(COLOR_G)[i], getParticleArray(COLOR_B)[i], getParticleArray(COLOR_A)[i]);
+            const float* texCoords = &_spriteTextureCoords[_particleFrames[i] * 4];
 
-            _spriteBatch->draw(p->_position, right, up, p->_size, p->_size,
-                                _spriteTextureCoords[p->_frame * 4], _spriteTextureCoords[p->_frame * 4 + 1], _spriteTextureCoords[p->_frame * 4 + 2], _spriteTextureCoords[p->_frame * 4 + 3],
-                                p->_color, pivot, p->_angle);
+            _spriteBatch->draw(position, right, up, size[i], size[i],
+                                texCoords[0], texCoords[1], texCoords[2], texCoords[3],
+                                color, pivot, angle[i]);
         }
 
         // Render.
@@ -1026,6 +1387,33 @@ unsigned int ParticleEmitter::draw(bool wireframe)
     return 1;
 }
 
+bool ParticleEmitter::isUpdatable() const
+{
+    return true;
+}
+
+bool ParticleEmitter::isUpdateThreadSafe() const
+{
+    return _simulator == NULL;
+}
+
+void ParticleEmitter::updateDrawable(float elapsedTime)
+{
+    // Emitters in the ParticleSystem are updated by it instead.
+    if (_systemUpdated || !isActive())
+        return;
+
+    updateParticles(elapsedTime);
+    if (_renderer && !_simulator)
+        _renderer->fill(this);
+}
+
+void ParticleEmitter::finishUpdate()
+{
+    if (!_systemUpdated)
+        updateNodeBounds();
+}
+
 Drawable* ParticleEmitter::clone(NodeCloneContext& context)
 {
     // Create a clone of this emitter
@@ -1064,6 +1452,8 @@ Drawable* ParticleEmitter::clone(NodeCloneContext& context)
     clone->_orbitPosition = _orbitPosition;
     clone->_orbitVelocity = _orbitVelocity;
     clone->_orbitAcceleration = _orbitAcceleration;
+    clone->setSimulation(getSimulation());
+    clone->_cullingEnabled = _cullingEnabled;
 
     return clone;
 }
@@ -15,6 +15,8 @@ namespace gameplay
 {
 
 class Node;
+class ParticleSimulator;
+class ParticleRenderer;
 
 /**
  * Defines a particle emitter that can be made to simulate and render a particle system.
@@ -137,11 +139,30 @@ class Node;
  * be set before rendering the particle system and then will be reset to their original
  * values.  Accepts the same symbolic constants as glBlendFunc().
  *
+ * <h2>Simulation:</h2>
+ *
+ * Particles are simulated on the CPU by default. An emitter whose properties set
+ * "simulation = GPU", or that is set to SIMULATION_GPU, keeps its particles in GPU
+ * buffers instead and emits and ages them with transform feedback (see ParticleSimulator),
+ * from the same emission settings. This suits large smoke, rain and spark effects, but
+ * getParticlesCount() then only estimates the living particles, and an emitter that emits
+ * more particles than it can hold replaces its oldest ones. Where the GPU backend is not
+ * supported, emitters fall back to the CPU.
+ *
+ * Where hardware instancing is supported, particles simulated on the CPU are drawn as
+ * instanced billboards (see ParticleRenderer): each particle is uploaded as one compact
+ * record and expanded into a camera-facing quad by the vertex shader. Otherwise they are
+ * drawn as quads built by the emitter's SpriteBatch.
+ *
  * @see http://gameplay3d.github.io/GamePlay/docs/file-formats.html#wiki-Particles
  */
 class ParticleEmitter : public Ref, public Drawable
 {
     friend class Node;
+    friend class ParticleSimulator;
+    friend class ParticleRenderer;
+    friend class ParticleEmitterPool;
+    friend class ParticleSystem;
 
 public:
 
@@ -156,6 +177,15 @@ public:
         BLEND_MULTIPLIED
     };
 
+    /**
+     * Defines where the particles of an emitter are simulated.
+     */
+    enum Simulation
+    {
+        SIMULATION_CPU,
+        SIMULATION_GPU
+    };
+
     /**
      * Creates a particle emitter using the data from the Properties object defined at the specified URL, 
      * where the URL is of the format "<file-path>.<extension>#<namespace-id>/<namespace-id>/.../<namespace-id>"
@@ -292,6 +322,57 @@ public:
      */
     unsigned int getParticlesCount() const;
 
+    /**
+     * Sets where the particles of this emitter are simulated.
+     *
+     * The particles alive when the simulation changes are discarded. If the GPU is
+     * requested but not supported, the emitter stays on the CPU.
+     *
+     * @param simulation The simulation backend.
+     */
+    void setSimulation(Simulation simulation);
+
+    /**
+     * Gets where the particles of this emitter are simulated.
+     *
+     * @return The simulation backend.
+     */
+    Simulation getSimulation() const;
+
+    /**
+     * Gets the world space bounding box of the particles of this emitter.
+     *
+     * The box holds the particles alive at the last update and the region new particles are
+     * emitted in, grown by the largest particle size. The particles of an emitter simulated
+     * on the GPU are not read back, so its box instead holds how far any particle emitted
+     * within its longest lifetime could have moved.
+     *
+     * The bounding sphere of the node of the emitter includes this box, so that the scene
+     * culls emitters like models.
+     *
+     * @return The bounding box of the particles.
+     */
+    const BoundingBox& getBoundingBox() const;
+
+    /**
+     * Sets whether this emitter stops updating while its node is not visible (on by default).
+     *
+     * When the scene of the emitter is culled and the last frame did not find its node
+     * visible, an update neither emits nor moves the particles. The time the emitter was
+     * hidden for, up to its longest particle lifetime, is then added to its next visible
+     * update, so that the particles are as old as they would have been.
+     *
+     * @param enabled true to stop updating hidden emitters, false to always update.
+     */
+    void setCullingEnabled(bool enabled);
+
+    /**
+     * Determines whether this emitter stops updating while its node is not visible.
+     *
+     * @return true if hidden emitters stop updating, false otherwise.
+     */
+    bool isCullingEnabled() const;
+
     /**
      * Sets whether the positions of newly emitted particles are generated within an ellipsoidal domain.
      *
@@ -703,6 +784,10 @@ public:
     /**
      * Updates the particles currently being emitted.
      *
+     * Emitters added to the ParticleSystem are updated by it each frame, and should not
+     * be updated again here. Nor should emitters in a scene that is updated in parallel,
+     * which updates the emitters it holds that are not in the ParticleSystem.
+     *
      * @param elapsedTime The amount of time that has passed since the last call to update(), in milliseconds.
      */
     void update(float elapsedTime);
@@ -731,6 +816,29 @@ private:
      */
     Drawable* clone(NodeCloneContext& context);
 
+    /**
+     * @see Drawable::isUpdatable
+     */
+    bool isUpdatable() const;
+
+    /**
+     * @see Drawable::isUpdateThreadSafe
+     *
+     * Emitters simulated on the GPU issue GL commands, so only those simulated on the CPU are thread-safe.
+     * Emission draws its random values from the state of the emitter rather than from rand().
+     */
+    bool isUpdateThreadSafe() const;
+
+    /**
+     * @see Drawable::updateDrawable
+     */
+    void updateDrawable(float elapsedTime);
+
+    /**
+     * @see Drawable::finishUpdate
+     */
+    void finishUpdate();
+
     /**
      * Creates an uninitialized ParticleEmitter.
      *
@@ -746,6 +854,16 @@ private:
      */
     ParticleEmitter& operator=(const ParticleEmitter&);
 
+    // Generates a random integer from the random state of the emitter, which emitters updated
+    // on different threads do not share, unlike the state of rand().
+    unsigned int generateRandom();
+
+    // Generates a random float between 0 and 1.
+    float generateRandom0_1();
+
+    // Generates a random float between -1 and 1.
+    float generateRandomMinus1_1();
+
     // Generates a scalar within the range defined by min and max.
     float generateScalar(float min, float max);
 
@@ -765,35 +883,102 @@ private:
     // Gets the blend mode from string.
     static ParticleEmitter::BlendMode getBlendModeFromString(const char* src);
 
+    // Gets the simulation backend from string.
+    static ParticleEmitter::Simulation getSimulationFromString(const char* src);
+
     /**
-     * Defines the data for a single particle in the system.
+     * Defines the arrays that the particles in the system are stored in, one element per
+     * particle, so that the particles are updated with loops over contiguous arrays.
      */
-    class Particle
+    enum ParticleArray
     {
-
-    public:
-        Vector3 _position;
-        Vector3 _velocity;
-        Vector3 _acceleration;
-        Vector4 _colorStart;
-        Vector4 _colorEnd;
-        Vector4 _color;
-        float _rotationPerParticleSpeed;
-        Vector3 _rotationAxis;
-        float _rotationSpeed;
-        float _angle;
-        long _energyStart;
-        long _energy;
-        float _sizeStart;
-        float _sizeEnd;
-        float _size;
-        unsigned int _frame;
-        float _timeOnCurrentFrame;
+        POSITION_X,
+        POSITION_Y,
+        POSITION_Z,
+        VELOCITY_X,
+        VELOCITY_Y,
+        VELOCITY_Z,
+        ACCELERATION_X,
+        ACCELERATION_Y,
+        ACCELERATION_Z,
+        COLOR_START_R,
+        COLOR_START_G,
+        COLOR_START_B,
+        COLOR_START_A,
+        COLOR_END_R,
+        COLOR_END_G,
+        COLOR_END_B,
+        COLOR_END_A,
+        COLOR_R,
+        COLOR_G,
+        COLOR_B,
+        COLOR_A,
+        SIZE_START,
+        SIZE_END,
+        SIZE,
+        ENERGY_START,
+        ENERGY,
+        PERCENT,
+        ANGLE,
+        ROTATION_PER_PARTICLE_SPEED,
+        ROTATION_AXIS_X,
+        ROTATION_AXIS_Y,
+        ROTATION_AXIS_Z,
+        ROTATION_SPEED,
+        TIME_ON_CURRENT_FRAME,
+        PARTICLE_ARRAY_COUNT
     };
 
+    /**
+     * Gets one of the arrays the particles are stored in.
+     */
+    float* getParticleArray(ParticleArray array) const;
+
+    /**
+     * Moves a particle to another slot of the particle arrays.
+     */
+    void moveParticle(unsigned int from, unsigned int to);
+
+    /**
+     * Advances the sprite animation frames of the living particles.
+     */
+    void updateSpriteFrames(float elapsedSecs);
+
+    /**
+     * Determines whether the last frame found the node of this emitter hidden, in a scene that is culled.
+     */
+    bool isUpdateCulled() const;
+
+    /**
+     * Gets the world space box new particles are emitted in, grown by the largest particle size.
+     */
+    void getEmissionBounds(BoundingBox* dst) const;
+
+    /**
+     * Updates the bounds of the living particles, after they are updated.
+     */
+    void updateParticleBounds(float elapsedMs);
+
+    /**
+     * Emits, moves and ages the particles, without touching the node of the emitter.
+     *
+     * Only the emitter and its particles are written to, so that the ParticleSystem can
+     * update emitters that are simulated on the CPU on other threads.
+     */
+    void updateParticles(float elapsedTime);
+
+    /**
+     * Marks the bounds of the node of the emitter dirty, if the particle bounds changed since the last call.
+     */
+    void updateNodeBounds();
+
     unsigned int _particleCountMax;
     unsigned int _particleCount;
-    Particle* _particles;
+    unsigned int _particleStride;
+    float* _particles;
+    unsigned int* _particleFrames;
+    ParticleSimulator* _simulator;
+    ParticleRenderer* _renderer;
     unsigned int _emissionRate;
     bool _started;
     bool _ellipsoid;
@@ -839,7 +1024,18 @@ private:
     bool _orbitAcceleration;
     float _timePerEmission;
     float _emitTime;
+    float _updateTime;
     double _lastUpdated;
+    bool _cullingEnabled;
+    float _culledTime;
+    BoundingBox _particleBounds;
+    BoundingBox _previousBounds;
+    float _boundsTime;
+    bool _boundsChanged;
+    mutable BoundingBox _bounds;
+    unsigned int _particleVersion;
+    bool _systemUpdated;
+    unsigned int _randomState;
 };
 
 }
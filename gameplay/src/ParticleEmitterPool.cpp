@@ -0,0 +1,158 @@
+#include "Base.h"
+#include "ParticleEmitterPool.h"
+#include "Node.h"
+
+namespace gameplay
+{
+
+// An emitter of the pool, and the particle file it was created from.
+struct PooledEmitter
+{
+    ParticleEmitter* emitter;
+    std::string url;
+    bool acquired;
+};
+
+static std::vector<PooledEmitter> __emitters;
+static std::map<std::string, Properties*> __templates;
+
+// Gets the parsed particle file of a URL, which is only read the first time it is used.
+static Properties* getTemplate(const char* url)
+{
+    std::map<std::string, Properties*>::iterator itr = __templates.find(url);
+    if (itr != __templates.end())
+        return itr->second;
+
+    Properties* properties = Properties::create(url);
+    if (!properties)
+    {
+        GP_ERROR("Failed to create particle emitter from file '%s'.", url);
+        return NULL;
+    }
+    __templates[url] = properties;
+    return properties;
+}
+
+// Determines whether a released emitter has no particles left to update or draw.
+static bool isFinished(const PooledEmitter& pooled)
+{
+    return !pooled.acquired && !pooled.emitter->isStarted() && pooled.emitter->getParticlesCount() == 0;
+}
+
+ParticleEmitter* ParticleEmitterPool::acquire(const char* url)
+{
+    GP_ASSERT(url);
+
+    for (size_t i = 0, count = __emitters.size(); i < count; ++i)
+    {
+        PooledEmitter& pooled = __emitters[i];
+        if (isFinished(pooled) && pooled.url == url)
+        {
+            ParticleEmitter* emitter = pooled.emitter;
+            Node* node = emitter->getNode();
+            if (node)
+                node->setDrawable(NULL);
+
+            // Forget the time and bounds of the last effect.
+            emitter->_emitTime = 0;
+            emitter->_updateTime = 0;
+            emitter->_culledTime = 0;
+            emitter->_boundsTime = 0;
+            emitter->_particleBounds = emitter->_previousBounds = BoundingBox::empty();
+            pooled.acquired = true;
+            return emitter;
+        }
+    }
+
+    Properties* properties = getTemplate(url);
+    if (!properties)
+        return NULL;
+    properties->rewind();
+    ParticleEmitter* emitter = ParticleEmitter::create((strlen(properties->getNamespace()) > 0) ? properties : properties->getNextNamespace());
+    if (!emitter)
+        return NULL;
+
+    PooledEmitter pooled;
+    pooled.emitter = emitter;
+    pooled.url = url;
+    pooled.acquired = true;
+    __emitters.push_back(pooled);
+    return emitter;
+}
+
+void ParticleEmitterPool::release(ParticleEmitter* emitter)
+{
+    GP_ASSERT(emitter);
+
+    for (size_t i = 0, count = __emitters.size(); i < count; ++i)
+    {
+        if (__emitters[i].emitter == emitter)
+        {
+            GP_ASSERT(__emitters[i].acquired);
+            __emitters[i].acquired = false;
+            emitter->stop();
+            return;
+        }
+    }
+    GP_ERROR("Released a particle emitter that was not acquired from the particle emitter pool.");
+}
+
+void ParticleEmitterPool::clear()
+{
+    std::vector<PooledEmitter>::iterator itr = __emitters.begin();
+    while (itr != __emitters.end())
+    {
+        if (isFinished(*itr))
+        {
+            Node* node = itr->emitter->getNode();
+            if (node)
+                node->setDrawable(NULL);
+            SAFE_RELEASE(itr->emitter);
+            itr = __emitters.erase(itr);
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+
+    std::map<std::string, Properties*>::iterator templateItr = __templates.begin();
+    while (templateItr != __templates.end())
+    {
+        bool used = false;
+        for (size_t i = 0, count = __emitters.size(); i < count && !used; ++i)
+        {
+            used = __emitters[i].url == templateItr->first;
+        }
+        if (used)
+        {
+            ++templateItr;
+        }
+        else
+        {
+            SAFE_DELETE(templateItr->second);
+            __templates.erase(templateItr++);
+        }
+    }
+}
+
+unsigned int ParticleEmitterPool::getEmitterCount()
+{
+    return (unsigned int)__emitters.size();
+}
+
+void ParticleEmitterPool::finalize()
+{
+    for (size_t i = 0, count = __emitters.size(); i < count; ++i)
+    {
+        SAFE_RELEASE(__emitters[i].emitter);
+    }
+    __emitters.clear();
+    for (std::map<std::string, Properties*>::iterator itr = __templates.begin(); itr != __templates.end(); ++itr)
+    {
+        SAFE_DELETE(itr->second);
+    }
+    __templates.clear();
+}
+
+}
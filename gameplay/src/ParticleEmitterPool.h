@@ -0,0 +1,80 @@
+#ifndef PARTICLEEMITTERPOOL_H_
+#define PARTICLEEMITTERPOOL_H_
+
+#include "ParticleEmitter.h"
+
+namespace gameplay
+{
+
+/**
+ * Defines a pool of particle emitters, recycled by the URL of the particle file they are created from.
+ *
+ * Short-lived effects such as impacts and muzzle flashes would otherwise create a new emitter,
+ * with its particle arrays, sprite batch and GPU buffers, every time they are spawned. The pool
+ * instead parses each particle file once and hands out emitters of it that have finished: an
+ * effect acquires an emitter, attaches it to a node and starts it or emits from it, then
+ * releases it. A released emitter stops emitting, and once its last particles have died, the
+ * pool detaches it from its node and hands it out again.
+ *
+ * Emitters are handed out as they were released, so an effect that changes the settings of
+ * its emitter should set them again each time it acquires one.
+ *
+ * @script{ignore}
+ */
+class ParticleEmitterPool
+{
+    friend class Game;
+
+public:
+
+    /**
+     * Acquires an emitter created from a particle file.
+     *
+     * The emitter is not attached to a node, is not started and has no particles. It is owned
+     * by the pool, which keeps it alive until it is finalized; nodes it is attached to hold a
+     * reference of their own.
+     *
+     * @param url The URL of the particle file, as passed to ParticleEmitter::create(const char*).
+     *
+     * @return An emitter no other effect is using, or NULL if it could not be created.
+     */
+    static ParticleEmitter* acquire(const char* url);
+
+    /**
+     * Returns an emitter to the pool, once its remaining particles have died.
+     *
+     * @param emitter An emitter acquired from the pool.
+     */
+    static void release(ParticleEmitter* emitter);
+
+    /**
+     * Deletes the emitters of the pool that are released and finished, and the particle files
+     * that no emitter was created from since.
+     */
+    static void clear();
+
+    /**
+     * Gets the number of emitters held by the pool.
+     *
+     * @return The number of emitters, whether acquired or not.
+     */
+    static unsigned int getEmitterCount();
+
+private:
+
+    /**
+     * Constructor.
+     */
+    ParticleEmitterPool();
+
+    /**
+     * Deletes every emitter and particle file of the pool.
+     *
+     * Called by Game at shutdown, while the GL context is still current.
+     */
+    static void finalize();
+};
+
+}
+
+#endif
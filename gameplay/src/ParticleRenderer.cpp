@@ -0,0 +1,216 @@
+#include "Base.h"
+#include "ParticleRenderer.h"
+#include "ParticleEmitter.h"
+#include "Node.h"
+#include "Scene.h"
+#include "FrameStats.h"
+#include "GLStateCache.h"
+#include "FrameCapture.h"
+
+// The number of floats of the record of each particle simulated on the CPU.
+#define PARTICLE_RENDERER_RECORD_FLOATS          10
+
+// The number of sprite frames whose texture coordinates are passed to the draw shader.
+#define PARTICLE_SPRITE_FRAME_COUNT_MAX          64
+
+namespace gameplay
+{
+
+// Sets a uniform of the bound effect, if its shaders use it.
+template <class T>
+static void setUniform(Effect* effect, const char* name, const T& value)
+{
+    Uniform* uniform = effect->getUniform(name);
+    if (uniform)
+        effect->setValue(uniform, value);
+}
+
+ParticleRenderer::ParticleRenderer()
+    : _effect(NULL), _recordBuffer(0), _cornerBuffer(0), _vertexArray(0), _recordCount(0), _recordsVersion(0), _recordsFilled(false)
+{
+}
+
+ParticleRenderer::~ParticleRenderer()
+{
+#ifdef GP_USE_INSTANCING
+    if (_vertexArray)
+        GLStateCache::deleteVertexArray(_vertexArray);
+    if (_recordBuffer)
+        GLStateCache::deleteBuffer(_recordBuffer);
+    if (_cornerBuffer)
+        GLStateCache::deleteBuffer(_cornerBuffer);
+#endif
+    SAFE_RELEASE(_effect);
+}
+
+bool ParticleRenderer::isSupported()
+{
+#if defined(GP_USE_INSTANCING) && defined(GP_USE_VAO)
+    return glVertexAttribDivisor && glDrawArraysInstanced;
+#else
+    return false;
+#endif
+}
+
+ParticleRenderer* ParticleRenderer::create(unsigned int particleCountMax)
+{
+    GP_ASSERT(particleCountMax);
+
+#if defined(GP_USE_INSTANCING) && defined(GP_USE_VAO)
+    if (!isSupported())
+        return NULL;
+
+    Effect* effect = createEffect(true);
+    if (!effect)
+        return NULL;
+
+    ParticleRenderer* renderer = new ParticleRenderer();
+    renderer->_effect = effect;
+    renderer->_records.resize(particleCountMax * PARTICLE_RENDERER_RECORD_FLOATS);
+    renderer->_cornerBuffer = createCornerBuffer();
+    GL_ASSERT( glGenBuffers(1, &renderer->_recordBuffer) );
+
+    // Each record is a position and size, a color, and an angle and sprite frame.
+    GL_ASSERT( glGenVertexArrays(1, &renderer->_vertexArray) );
+    GLStateCache::bindVertexArray(renderer->_vertexArray);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, renderer->_recordBuffer);
+    const GLsizei stride = PARTICLE_RENDERER_RECORD_FLOATS * sizeof(float);
+    const char* attributes[] = { "a_position", "a_color", "a_frame" };
+    const GLint sizes[] = { 4, 4, 2 };
+    size_t offset = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+        VertexAttribute attribute = effect->getVertexAttribute(attributes[i]);
+        if (attribute >= 0)
+        {
+            GL_ASSERT( glEnableVertexAttribArray(attribute) );
+            GL_ASSERT( glVertexAttribPointer(attribute, sizes[i], GL_FLOAT, GL_FALSE, stride, (const GLvoid*)(offset * sizeof(float))) );
+            GL_ASSERT( glVertexAttribDivisor(attribute, 1) );
+        }
+        offset += sizes[i];
+    }
+    VertexAttribute corner = effect->getVertexAttribute("a_corner");
+    if (corner >= 0)
+    {
+        GLStateCache::bindBuffer(GL_ARRAY_BUFFER, renderer->_cornerBuffer);
+        GL_ASSERT( glEnableVertexAttribArray(corner) );
+        GL_ASSERT( glVertexAttribPointer(corner, 2, GL_FLOAT, GL_FALSE, 0, 0) );
+    }
+    GLStateCache::bindVertexArray(0);
+
+    return renderer;
+#else
+    return NULL;
+#endif
+}
+
+Effect* ParticleRenderer::createEffect(bool cpuSimulation)
+{
+    char defines[64];
+    sprintf(defines, "SPRITE_FRAME_COUNT_MAX %d%s", PARTICLE_SPRITE_FRAME_COUNT_MAX, cpuSimulation ? ";CPU_SIMULATION" : "");
+    return Effect::createFromFile("res/shaders/particle.vert", "res/shaders/sprite.frag", defines);
+}
+
+GLuint ParticleRenderer::createCornerBuffer()
+{
+    static const float corners[] = { -0.5f, -0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f, 0.5f };
+    GLuint buffer = 0;
+    GL_ASSERT( glGenBuffers(1, &buffer) );
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, buffer);
+    GL_ASSERT( glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW) );
+    return buffer;
+}
+
+void ParticleRenderer::bind(Effect* effect, ParticleEmitter* emitter)
+{
+    GP_ASSERT(effect);
+    GP_ASSERT(emitter && emitter->_spriteBatch && emitter->_spriteTextureCoords);
+
+    Node* node = emitter->_node;
+    GP_ASSERT(node && node->getScene() && node->getScene()->getActiveCamera() && node->getScene()->getActiveCamera()->getNode());
+    const Matrix& cameraWorldMatrix = node->getScene()->getActiveCamera()->getNode()->getWorldMatrix();
+    Vector3 right;
+    cameraWorldMatrix.getRightVector(&right);
+    Vector3 up;
+    cameraWorldMatrix.getUpVector(&up);
+
+    // The animation of the sprites: their frame count, whether they animate once (1) or loop (2), their frame duration and the part of a lifetime each frame lasts.
+    const unsigned int frameCount = std::min(emitter->_spriteFrameCount, (unsigned int)PARTICLE_SPRITE_FRAME_COUNT_MAX);
+    const float animation = emitter->_spriteAnimated ? (emitter->_spriteLooped ? 2.0f : 1.0f) : 0.0f;
+    const Vector4 spriteAnimation((float)frameCount, animation, std::max(emitter->_spriteFrameDurationSecs, 0.001f), std::max(emitter->_spritePercentPerFrame, 0.0001f));
+
+    emitter->_spriteBatch->getStateBlock()->bind();
+    effect->bind();
+    setUniform(effect, "u_viewProjectionMatrix", node->getViewProjectionMatrix());
+    setUniform(effect, "u_cameraRight", right);
+    setUniform(effect, "u_cameraUp", up);
+    setUniform(effect, "u_spriteAnimation", spriteAnimation);
+    Uniform* texCoords = effect->getUniform("u_spriteTexCoords");
+    if (texCoords)
+        effect->setValue(texCoords, (const Vector4*)emitter->_spriteTextureCoords, frameCount);
+    Uniform* texture = effect->getUniform("u_texture");
+    if (texture)
+        effect->setValue(texture, emitter->_spriteBatch->getSampler());
+}
+
+void ParticleRenderer::fill(ParticleEmitter* emitter)
+{
+    GP_ASSERT(emitter);
+
+    // Gather the records from the particle arrays of the emitter.
+    const unsigned int count = emitter->_particleCount;
+    const float* positionX = emitter->getParticleArray(ParticleEmitter::POSITION_X);
+    const float* positionY = emitter->getParticleArray(ParticleEmitter::POSITION_Y);
+    const float* positionZ = emitter->getParticleArray(ParticleEmitter::POSITION_Z);
+    const float* size = emitter->getParticleArray(ParticleEmitter::SIZE);
+    const float* colorR = emitter->getParticleArray(ParticleEmitter::COLOR_R);
+    const float* colorG = emitter->getParticleArray(ParticleEmitter::COLOR_G);
+    const float* colorB = emitter->getParticleArray(ParticleEmitter::COLOR_B);
+    const float* colorA = emitter->getParticleArray(ParticleEmitter::COLOR_A);
+    const float* angle = emitter->getParticleArray(ParticleEmitter::ANGLE);
+    const unsigned int* frames = emitter->_particleFrames;
+    GP_ASSERT(count * PARTICLE_RENDERER_RECORD_FLOATS <= _records.size());
+    float* record = &_records[0];
+    for (unsigned int i = 0; i < count; ++i, record += PARTICLE_RENDERER_RECORD_FLOATS)
+    {
+        record[0] = positionX[i];
+        record[1] = positionY[i];
+        record[2] = positionZ[i];
+        record[3] = size[i];
+        record[4] = colorR[i];
+        record[5] = colorG[i];
+        record[6] = colorB[i];
+        record[7] = colorA[i];
+        record[8] = angle[i];
+        record[9] = (float)frames[i];
+    }
+    _recordCount = count;
+    _recordsVersion = emitter->_particleVersion;
+    _recordsFilled = true;
+}
+
+void ParticleRenderer::draw(ParticleEmitter* emitter)
+{
+    GP_ASSERT(emitter);
+
+#if defined(GP_USE_INSTANCING) && defined(GP_USE_VAO)
+    // The ParticleSystem fills the records of the emitters it updates ahead of drawing.
+    if (!_recordsFilled || _recordsVersion != emitter->_particleVersion)
+        fill(emitter);
+    const unsigned int count = _recordCount;
+    if (count == 0)
+        return;
+
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, _recordBuffer);
+    GL_ASSERT( glBufferData(GL_ARRAY_BUFFER, count * PARTICLE_RENDERER_RECORD_FLOATS * sizeof(float), &_records[0], GL_STREAM_DRAW) );
+    FrameCapture::record(FrameCapture::UPLOAD_BUFFER, GL_ARRAY_BUFFER, _recordBuffer, 0, count * PARTICLE_RENDERER_RECORD_FLOATS * sizeof(float));
+
+    bind(_effect, emitter);
+    GLStateCache::bindVertexArray(_vertexArray);
+    GL_ASSERT( glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, count) );
+    FrameStats::recordDraw(GL_TRIANGLE_STRIP, 4 * count);
+    GLStateCache::bindVertexArray(0);
+#endif
+}
+
+}
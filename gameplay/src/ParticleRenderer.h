@@ -0,0 +1,110 @@
+#ifndef PARTICLERENDERER_H_
+#define PARTICLERENDERER_H_
+
+#include "Effect.h"
+
+namespace gameplay
+{
+
+class ParticleEmitter;
+
+/**
+ * Defines how the particles of a ParticleEmitter are drawn as instanced billboards.
+ *
+ * Rather than expanding every particle into the four vertices of a quad on the CPU, as a
+ * SpriteBatch does, each particle is uploaded as one compact record (its position, size,
+ * color, angle and sprite frame), and particle.vert expands the record into a quad facing
+ * the camera, rotates it about its center and looks up the texture coordinates of its
+ * frame. A single instanced draw call draws all the particles of an emitter.
+ *
+ * ParticleSimulator draws the particles it simulates with the same shader, from its own
+ * particle records.
+ *
+ * Instanced billboards require hardware instancing; where it is not supported, emitters
+ * draw their particles with their SpriteBatch.
+ *
+ * @script{ignore}
+ */
+class ParticleRenderer
+{
+    friend class ParticleEmitter;
+    friend class ParticleSimulator;
+    friend class ParticleSystem;
+
+public:
+
+    /**
+     * Determines whether particles can be drawn as instanced billboards on this platform.
+     *
+     * @return true if instanced billboards are supported, false otherwise.
+     */
+    static bool isSupported();
+
+private:
+
+    /**
+     * Constructor.
+     */
+    ParticleRenderer();
+
+    /**
+     * Destructor.
+     */
+    ~ParticleRenderer();
+
+    /**
+     * Hidden copy constructor.
+     */
+    ParticleRenderer(const ParticleRenderer&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    ParticleRenderer& operator=(const ParticleRenderer&);
+
+    /**
+     * Creates a renderer for the particles an emitter simulates on the CPU, or returns NULL if it could not be created.
+     */
+    static ParticleRenderer* create(unsigned int particleCountMax);
+
+    /**
+     * Gathers the records of the living particles of an emitter, without touching GL.
+     */
+    void fill(ParticleEmitter* emitter);
+
+    /**
+     * Uploads the records of the living particles of an emitter and draws them.
+     *
+     * The records are gathered first, unless the particles have not changed since they last were.
+     */
+    void draw(ParticleEmitter* emitter);
+
+    /**
+     * Creates the effect that draws particle records simulated on the CPU, or on the GPU.
+     */
+    static Effect* createEffect(bool cpuSimulation);
+
+    /**
+     * Creates a vertex buffer holding the four corners of a particle quad, as a triangle strip.
+     */
+    static GLuint createCornerBuffer();
+
+    /**
+     * Binds the state of the sprite batch of an emitter, and an effect created by createEffect()
+     * with the uniforms that draw the particles of the emitter.
+     */
+    static void bind(Effect* effect, ParticleEmitter* emitter);
+
+    Effect* _effect;
+    GLuint _recordBuffer;
+    GLuint _cornerBuffer;
+    GLuint _vertexArray;
+    std::vector<float> _records;
+    unsigned int _recordCount;
+    unsigned int _recordsVersion;
+    bool _recordsFilled;
+};
+
+}
+
+#endif
@@ -0,0 +1,272 @@
+#include "Base.h"
+#include "ParticleSimulator.h"
+#include "ParticleEmitter.h"
+#include "ParticleRenderer.h"
+#include "Node.h"
+#include "Scene.h"
+#include "FrameStats.h"
+#include "GLStateCache.h"
+
+// The number of vec4 attributes of the record of each particle.
+#define PARTICLE_RECORD_ATTRIBUTES               7
+
+namespace gameplay
+{
+
+// The attributes of a particle record, and the varyings that write them, in the order they are stored.
+static const char* __recordAttributes[PARTICLE_RECORD_ATTRIBUTES] =
+{
+    "a_position", "a_velocity", "a_acceleration", "a_rotation", "a_colorStart", "a_colorEnd", "a_size"
+};
+static const char* __recordVaryings[PARTICLE_RECORD_ATTRIBUTES] =
+{
+    "v_position", "v_velocity", "v_acceleration", "v_rotation", "v_colorStart", "v_colorEnd", "v_size"
+};
+
+// Sets a uniform of the bound effect, if its shaders use it.
+template <class T>
+static void setUniform(Effect* effect, const char* name, const T& value)
+{
+    Uniform* uniform = effect->getUniform(name);
+    if (uniform)
+        effect->setValue(uniform, value);
+}
+
+ParticleSimulator::ParticleSimulator()
+    : _simulateEffect(NULL), _drawEffect(NULL), _indexBuffer(0), _cornerBuffer(0), _current(0),
+    _particleCountMax(0), _particleCount(0), _emitHead(0), _emitCount(0), _liveTime(0.0f)
+{
+    _buffers[0] = _buffers[1] = 0;
+    _simulateVertexArrays[0] = _simulateVertexArrays[1] = 0;
+    _drawVertexArrays[0] = _drawVertexArrays[1] = 0;
+}
+
+ParticleSimulator::~ParticleSimulator()
+{
+#ifdef GP_USE_TRANSFORM_FEEDBACK
+    for (int i = 0; i < 2; ++i)
+    {
+        if (_simulateVertexArrays[i])
+            GLStateCache::deleteVertexArray(_simulateVertexArrays[i]);
+        if (_drawVertexArrays[i])
+            GLStateCache::deleteVertexArray(_drawVertexArrays[i]);
+        if (_buffers[i])
+            GLStateCache::deleteBuffer(_buffers[i]);
+    }
+    if (_indexBuffer)
+        GLStateCache::deleteBuffer(_indexBuffer);
+    if (_cornerBuffer)
+        GLStateCache::deleteBuffer(_cornerBuffer);
+#endif
+    SAFE_RELEASE(_simulateEffect);
+    SAFE_RELEASE(_drawEffect);
+}
+
+bool ParticleSimulator::isSupported()
+{
+#if defined(GP_USE_TRANSFORM_FEEDBACK) && defined(GP_USE_INSTANCING)
+    return (GLEW_VERSION_3_0 || GLEW_EXT_transform_feedback) && glVertexAttribDivisor && glDrawArraysInstanced;
+#else
+    return false;
+#endif
+}
+
+ParticleSimulator* ParticleSimulator::create(unsigned int particleCountMax)
+{
+    GP_ASSERT(particleCountMax);
+
+#if defined(GP_USE_TRANSFORM_FEEDBACK) && defined(GP_USE_INSTANCING)
+    if (!isSupported())
+        return NULL;
+
+    Effect* simulateEffect = Effect::createTransformFeedback("res/shaders/particle-simulate.vert", "res/shaders/particle-simulate.frag", NULL,
+                                                             __recordVaryings, PARTICLE_RECORD_ATTRIBUTES);
+    if (!simulateEffect)
+        return NULL;
+    Effect* drawEffect = ParticleRenderer::createEffect(false);
+    if (!drawEffect)
+    {
+        SAFE_RELEASE(simulateEffect);
+        return NULL;
+    }
+
+    ParticleSimulator* simulator = new ParticleSimulator();
+    simulator->_simulateEffect = simulateEffect;
+    simulator->_drawEffect = drawEffect;
+    simulator->_particleCountMax = particleCountMax;
+
+    // Both particle buffers start out with every slot dead, as a record with no energy.
+    std::vector<float> records(particleCountMax * PARTICLE_RECORD_ATTRIBUTES * 4, 0.0f);
+    GL_ASSERT( glGenBuffers(2, simulator->_buffers) );
+    for (int i = 0; i < 2; ++i)
+    {
+        GLStateCache::bindBuffer(GL_ARRAY_BUFFER, simulator->_buffers[i]);
+        GL_ASSERT( glBufferData(GL_ARRAY_BUFFER, records.size() * sizeof(float), &records[0], GL_DYNAMIC_COPY) );
+    }
+
+    // The index of each slot seeds its random numbers and places it in the emission ring.
+    std::vector<float> indices(particleCountMax);
+    for (unsigned int i = 0; i < particleCountMax; ++i)
+    {
+        indices[i] = (float)i;
+    }
+    GL_ASSERT( glGenBuffers(1, &simulator->_indexBuffer) );
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, simulator->_indexBuffer);
+    GL_ASSERT( glBufferData(GL_ARRAY_BUFFER, indices.size() * sizeof(float), &indices[0], GL_STATIC_DRAW) );
+
+    simulator->_cornerBuffer = ParticleRenderer::createCornerBuffer();
+
+    // Each buffer is read by one vertex array to simulate and one to draw.
+    GL_ASSERT( glGenVertexArrays(2, simulator->_simulateVertexArrays) );
+    GL_ASSERT( glGenVertexArrays(2, simulator->_drawVertexArrays) );
+    for (int i = 0; i < 2; ++i)
+    {
+        GLStateCache::bindVertexArray(simulator->_simulateVertexArrays[i]);
+        simulator->bindParticleAttributes(simulateEffect, simulator->_buffers[i], false);
+        VertexAttribute index = simulateEffect->getVertexAttribute("a_index");
+        if (index >= 0)
+        {
+            GLStateCache::bindBuffer(GL_ARRAY_BUFFER, simulator->_indexBuffer);
+            GL_ASSERT( glEnableVertexAttribArray(index) );
+            GL_ASSERT( glVertexAttribPointer(index, 1, GL_FLOAT, GL_FALSE, 0, 0) );
+        }
+
+        GLStateCache::bindVertexArray(simulator->_drawVertexArrays[i]);
+        simulator->bindParticleAttributes(drawEffect, simulator->_buffers[i], true);
+        VertexAttribute corner = drawEffect->getVertexAttribute("a_corner");
+        if (corner >= 0)
+        {
+            GLStateCache::bindBuffer(GL_ARRAY_BUFFER, simulator->_cornerBuffer);
+            GL_ASSERT( glEnableVertexAttribArray(corner) );
+            GL_ASSERT( glVertexAttribPointer(corner, 2, GL_FLOAT, GL_FALSE, 0, 0) );
+        }
+    }
+    GLStateCache::bindVertexArray(0);
+
+    return simulator;
+#else
+    return NULL;
+#endif
+}
+
+void ParticleSimulator::bindParticleAttributes(Effect* effect, GLuint buffer, bool instanced)
+{
+#if defined(GP_USE_TRANSFORM_FEEDBACK) && defined(GP_USE_INSTANCING)
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, buffer);
+    const GLsizei stride = PARTICLE_RECORD_ATTRIBUTES * 4 * sizeof(float);
+    for (unsigned int i = 0; i < PARTICLE_RECORD_ATTRIBUTES; ++i)
+    {
+        VertexAttribute attribute = effect->getVertexAttribute(__recordAttributes[i]);
+        if (attribute < 0)
+            continue;
+        GL_ASSERT( glEnableVertexAttribArray(attribute) );
+        GL_ASSERT( glVertexAttribPointer(attribute, 4, GL_FLOAT, GL_FALSE, stride, (const GLvoid*)(i * 4 * sizeof(float))) );
+        if (instanced)
+            GL_ASSERT( glVertexAttribDivisor(attribute, 1) );
+    }
+#endif
+}
+
+void ParticleSimulator::emit(unsigned int particleCount)
+{
+    _emitCount = std::min(_emitCount + particleCount, _particleCountMax);
+}
+
+void ParticleSimulator::update(ParticleEmitter* emitter, float elapsedMs)
+{
+    GP_ASSERT(emitter);
+
+#if defined(GP_USE_TRANSFORM_FEEDBACK) && defined(GP_USE_INSTANCING)
+    GP_PROFILE_SCOPE("ParticleSimulator::update");
+
+    // Emitted slots are respawned by this update, so they stay alive for the longest energy from now.
+    const unsigned int emitCount = _emitCount;
+    _emitCount = 0;
+    if (emitCount > 0)
+    {
+        _liveTime = std::max(_liveTime, std::max(emitter->_energyMin, emitter->_energyMax));
+        _particleCount = std::min(_particleCount + emitCount, _particleCountMax);
+    }
+    else if (_particleCount == 0)
+    {
+        return;
+    }
+
+    // Orbiting properties are rotated by the world matrix of the node without its translation.
+    Matrix rotation = emitter->_node ? emitter->_node->getWorldMatrix() : Matrix::identity();
+    Vector3 translation;
+    rotation.getTranslation(&translation);
+    rotation.m[12] = 0.0f;
+    rotation.m[13] = 0.0f;
+    rotation.m[14] = 0.0f;
+
+    Effect* effect = _simulateEffect;
+    effect->bind();
+    setUniform(effect, "u_elapsedTime", Vector2(elapsedMs, elapsedMs * 0.001f));
+    setUniform(effect, "u_emission", Vector3((float)_emitHead, (float)emitCount, (float)_particleCountMax));
+    setUniform(effect, "u_seed", emitter->generateRandom0_1());
+    setUniform(effect, "u_emitterRotation", rotation);
+    setUniform(effect, "u_emitterTranslation", translation);
+    setUniform(effect, "u_orbit", Vector3(emitter->_orbitPosition ? 1.0f : 0.0f, emitter->_orbitVelocity ? 1.0f : 0.0f, emitter->_orbitAcceleration ? 1.0f : 0.0f));
+    setUniform(effect, "u_ellipsoid", emitter->_ellipsoid ? 1.0f : 0.0f);
+    setUniform(effect, "u_positionBase", emitter->_position);
+    setUniform(effect, "u_positionVar", emitter->_positionVar);
+    setUniform(effect, "u_velocityBase", emitter->_velocity);
+    setUniform(effect, "u_velocityVar", emitter->_velocityVar);
+    setUniform(effect, "u_accelerationBase", emitter->_acceleration);
+    setUniform(effect, "u_accelerationVar", emitter->_accelerationVar);
+    setUniform(effect, "u_rotationAxisBase", emitter->_rotationAxis);
+    setUniform(effect, "u_rotationAxisVar", emitter->_rotationAxisVar);
+    setUniform(effect, "u_rotationSpeed", Vector2(emitter->_rotationSpeedMin, emitter->_rotationSpeedMax));
+    setUniform(effect, "u_rotationPerParticleSpeed", Vector2(emitter->_rotationPerParticleSpeedMin, emitter->_rotationPerParticleSpeedMax));
+    setUniform(effect, "u_energy", Vector2(emitter->_energyMin, emitter->_energyMax));
+    setUniform(effect, "u_sizeStart", Vector2(emitter->_sizeStartMin, emitter->_sizeStartMax));
+    setUniform(effect, "u_sizeEnd", Vector2(emitter->_sizeEndMin, emitter->_sizeEndMax));
+    setUniform(effect, "u_colorStartBase", emitter->_colorStart);
+    setUniform(effect, "u_colorStartVar", emitter->_colorStartVar);
+    setUniform(effect, "u_colorEndBase", emitter->_colorEnd);
+    setUniform(effect, "u_colorEndVar", emitter->_colorEndVar);
+    setUniform(effect, "u_frameRandomOffset", (float)emitter->_spriteFrameRandomOffset);
+    _emitHead = (_emitHead + emitCount) % _particleCountMax;
+
+    // Read every slot from the current buffer and capture it into the other one.
+    GL_ASSERT( glEnable(GL_RASTERIZER_DISCARD) );
+    GLStateCache::bindVertexArray(_simulateVertexArrays[_current]);
+    GL_ASSERT( glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, _buffers[1 - _current]) );
+    GL_ASSERT( glBeginTransformFeedback(GL_POINTS) );
+    GL_ASSERT( glDrawArrays(GL_POINTS, 0, _particleCountMax) );
+    GL_ASSERT( glEndTransformFeedback() );
+    GL_ASSERT( glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0) );
+    GLStateCache::bindVertexArray(0);
+    GL_ASSERT( glDisable(GL_RASTERIZER_DISCARD) );
+    _current = 1 - _current;
+
+    // Once the longest lived particle could have died, no slot holds a living particle.
+    _liveTime -= elapsedMs;
+    if (_liveTime <= 0.0f)
+    {
+        _liveTime = 0.0f;
+        _particleCount = 0;
+    }
+#endif
+}
+
+void ParticleSimulator::draw(ParticleEmitter* emitter)
+{
+    GP_ASSERT(emitter && emitter->_spriteBatch && emitter->_spriteTextureCoords);
+
+#if defined(GP_USE_TRANSFORM_FEEDBACK) && defined(GP_USE_INSTANCING)
+    ParticleRenderer::bind(_drawEffect, emitter);
+    GLStateCache::bindVertexArray(_drawVertexArrays[_current]);
+    GL_ASSERT( glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, _particleCountMax) );
+    FrameStats::recordDraw(GL_TRIANGLE_STRIP, 4 * _particleCountMax);
+    GLStateCache::bindVertexArray(0);
+#endif
+}
+
+unsigned int ParticleSimulator::getParticleCount() const
+{
+    return _particleCount;
+}
+
+}
@@ -0,0 +1,115 @@
+#ifndef PARTICLESIMULATOR_H_
+#define PARTICLESIMULATOR_H_
+
+#include "Effect.h"
+
+namespace gameplay
+{
+
+class ParticleEmitter;
+
+/**
+ * Defines the GPU simulation backend of a ParticleEmitter.
+ *
+ * The particles of the emitter are kept in a pair of vertex buffers, one record per
+ * particle slot. Each update, a vertex shader reads every record of one buffer and writes
+ * it, aged by the elapsed time, to the other with transform feedback. The slots that an
+ * update emits into are respawned by the same shader from the emission settings of the
+ * emitter, which are set as uniforms, so that neither emission nor simulation touches the
+ * particles on the CPU. The particles are then drawn straight from the buffer as instanced
+ * camera-facing quads.
+ *
+ * Slots are emitted into in a ring, so an emitter that emits more particles than it can
+ * hold replaces its oldest particles rather than dropping new ones.
+ *
+ * The GPU backend requires transform feedback and hardware instancing, which are not
+ * available on OpenGL ES 2.0.
+ *
+ * @script{ignore}
+ */
+class ParticleSimulator
+{
+    friend class ParticleEmitter;
+
+public:
+
+    /**
+     * Determines whether particles can be simulated on the GPU on this platform.
+     *
+     * @return true if the GPU backend is supported, false otherwise.
+     */
+    static bool isSupported();
+
+private:
+
+    /**
+     * Constructor.
+     */
+    ParticleSimulator();
+
+    /**
+     * Destructor.
+     */
+    ~ParticleSimulator();
+
+    /**
+     * Hidden copy constructor.
+     */
+    ParticleSimulator(const ParticleSimulator&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    ParticleSimulator& operator=(const ParticleSimulator&);
+
+    /**
+     * Creates the buffers and effects that simulate and draw a number of particles, or returns NULL if they could not be created.
+     */
+    static ParticleSimulator* create(unsigned int particleCountMax);
+
+    /**
+     * Requests particles to be emitted by the next update.
+     */
+    void emit(unsigned int particleCount);
+
+    /**
+     * Emits the requested particles and ages all particles by the elapsed time.
+     */
+    void update(ParticleEmitter* emitter, float elapsedMs);
+
+    /**
+     * Draws the particles with the texture and state of the sprite batch of the emitter.
+     */
+    void draw(ParticleEmitter* emitter);
+
+    /**
+     * Gets the number of slots that may hold living particles.
+     *
+     * The particles are not read back, so this counts the slots emitted into since the
+     * last time the longest lived particle could have died.
+     */
+    unsigned int getParticleCount() const;
+
+    /**
+     * Sets the vertex attributes of a vertex array to the records of a particle buffer.
+     */
+    void bindParticleAttributes(Effect* effect, GLuint buffer, bool instanced);
+
+    Effect* _simulateEffect;
+    Effect* _drawEffect;
+    GLuint _buffers[2];
+    GLuint _indexBuffer;
+    GLuint _cornerBuffer;
+    GLuint _simulateVertexArrays[2];
+    GLuint _drawVertexArrays[2];
+    unsigned int _current;
+    unsigned int _particleCountMax;
+    unsigned int _particleCount;
+    unsigned int _emitHead;
+    unsigned int _emitCount;
+    float _liveTime;
+};
+
+}
+
+#endif
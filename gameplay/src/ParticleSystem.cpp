@@ -0,0 +1,115 @@
+#include "Base.h"
+#include "ParticleSystem.h"
+#include "ParticleRenderer.h"
+#include "Game.h"
+#include "Node.h"
+
+// The number of emitters simulated on the CPU from which they are updated in parallel.
+#define PARTICLE_PARALLEL_UPDATE_EMITTERS       4
+
+namespace gameplay
+{
+
+static std::vector<ParticleEmitter*> __emitters;
+static std::vector<ParticleEmitter*> __updatedEmitters;
+
+// Updates an emitter simulated on the CPU and gathers the records it is drawn from.
+static void updateEmitter(ParticleEmitter* emitter, float elapsedTime)
+{
+    emitter->updateParticles(elapsedTime);
+    if (emitter->_renderer)
+        emitter->_renderer->fill(emitter);
+}
+
+void ParticleSystem::add(ParticleEmitter* emitter)
+{
+    GP_ASSERT(emitter);
+
+    if (emitter->_systemUpdated)
+        return;
+    emitter->_systemUpdated = true;
+    __emitters.push_back(emitter);
+}
+
+void ParticleSystem::remove(ParticleEmitter* emitter)
+{
+    GP_ASSERT(emitter);
+
+    if (!emitter->_systemUpdated)
+        return;
+    emitter->_systemUpdated = false;
+    std::vector<ParticleEmitter*>::iterator itr = std::find(__emitters.begin(), __emitters.end(), emitter);
+    GP_ASSERT(itr != __emitters.end());
+    __emitters.erase(itr);
+}
+
+unsigned int ParticleSystem::getEmitterCount()
+{
+    return (unsigned int)__emitters.size();
+}
+
+void ParticleSystem::update(float elapsedTime)
+{
+    if (__emitters.empty())
+        return;
+
+    GP_PROFILE_SCOPE("ParticleSystem::update");
+
+    __updatedEmitters.clear();
+    for (size_t i = 0, count = __emitters.size(); i < count; ++i)
+    {
+        ParticleEmitter* emitter = __emitters[i];
+        if (!emitter->isActive())
+            continue;
+
+        if (emitter->_simulator)
+        {
+            emitter->update(elapsedTime);
+            continue;
+        }
+
+        // World matrices are resolved lazily through the shared ancestors of the nodes, so they
+        // are resolved here before the emitters read them on other threads.
+        if (emitter->_node)
+            emitter->_node->getWorldMatrix();
+        __updatedEmitters.push_back(emitter);
+    }
+
+    const unsigned int updatedCount = (unsigned int)__updatedEmitters.size();
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem && updatedCount >= PARTICLE_PARALLEL_UPDATE_EMITTERS)
+    {
+        jobSystem->parallelFor(0, updatedCount, [elapsedTime](unsigned int first, unsigned int last)
+        {
+            for (unsigned int i = first; i < last; ++i)
+            {
+                updateEmitter(__updatedEmitters[i], elapsedTime);
+            }
+        });
+    }
+    else
+    {
+        for (unsigned int i = 0; i < updatedCount; ++i)
+        {
+            updateEmitter(__updatedEmitters[i], elapsedTime);
+        }
+    }
+
+    // Dirtying the bounds of a node walks its ancestors, so it is done on this thread.
+    for (unsigned int i = 0; i < updatedCount; ++i)
+    {
+        __updatedEmitters[i]->updateNodeBounds();
+    }
+}
+
+void ParticleSystem::finalize()
+{
+    for (size_t i = 0, count = __emitters.size(); i < count; ++i)
+    {
+        __emitters[i]->_systemUpdated = false;
+    }
+    __emitters.clear();
+    __updatedEmitters.clear();
+}
+
+}
@@ -0,0 +1,78 @@
+#ifndef PARTICLESYSTEM_H_
+#define PARTICLESYSTEM_H_
+
+#include "ParticleEmitter.h"
+
+namespace gameplay
+{
+
+/**
+ * Defines the manager that updates particle emitters together, each frame.
+ *
+ * Emitters are otherwise updated one after another, by whatever code owns them, through
+ * ParticleEmitter::update(). Emitters added to the particle system are instead updated by
+ * Game every frame, after animation and physics and before Game::update(). Emitters that
+ * are simulated on the CPU only write to their own particles, so when there are enough of
+ * them they are updated in parallel on the JobSystem, and the records their particles are
+ * drawn from are gathered by the same jobs, ready for rendering.
+ *
+ * Emitters simulated on the GPU are updated on the main thread, as they issue GL commands.
+ *
+ * An emitter that is added must not also be updated by calling ParticleEmitter::update().
+ * The particle system does not hold a reference to its emitters; an emitter is removed
+ * when it is destroyed.
+ *
+ * @script{ignore}
+ */
+class ParticleSystem
+{
+    friend class Game;
+
+public:
+
+    /**
+     * Adds an emitter to be updated every frame.
+     *
+     * @param emitter The emitter to add.
+     */
+    static void add(ParticleEmitter* emitter);
+
+    /**
+     * Removes an emitter, which must then be updated by calling ParticleEmitter::update().
+     *
+     * @param emitter The emitter to remove.
+     */
+    static void remove(ParticleEmitter* emitter);
+
+    /**
+     * Gets the number of emitters in the particle system.
+     *
+     * @return The number of emitters.
+     */
+    static unsigned int getEmitterCount();
+
+private:
+
+    /**
+     * Constructor.
+     */
+    ParticleSystem();
+
+    /**
+     * Updates the active emitters.
+     *
+     * Called by Game every frame while it is running.
+     */
+    static void update(float elapsedTime);
+
+    /**
+     * Removes every emitter.
+     *
+     * Called by Game at shutdown.
+     */
+    static void finalize();
+};
+
+}
+
+#endif
@@ -8,7 +8,8 @@ namespace gameplay
 {
 
 Pass::Pass(const char* id, Technique* technique) :
-    _id(id ? id : ""), _technique(technique), _effect(NULL), _vaBinding(NULL)
+    _id(id ? id : ""), _technique(technique), _effect(NULL), _vaBinding(NULL),
+    _depthEffect(NULL), _depthVaBinding(NULL), _depthMesh(NULL), _depthEffectFailed(false)
 {
     RenderState::_parent = _technique;
 }
@@ -17,6 +18,8 @@ Pass::~Pass()
 {
     SAFE_RELEASE(_effect);
     SAFE_RELEASE(_vaBinding);
+    SAFE_RELEASE(_depthEffect);
+    SAFE_RELEASE(_depthVaBinding);
 }
 
 bool Pass::initialize(const char* vshPath, const char* fshPath, const char* defines)
@@ -26,6 +29,10 @@ bool Pass::initialize(const char* vshPath, const char* fshPath, const char* defi
 
     SAFE_RELEASE(_effect);
     SAFE_RELEASE(_vaBinding);
+    SAFE_RELEASE(_depthEffect);
+    SAFE_RELEASE(_depthVaBinding);
+    _depthMesh = NULL;
+    _depthEffectFailed = false;
 
     // Attempt to create/load the effect.
     _effect = Effect::createFromFile(vshPath, fshPath, defines);
@@ -35,6 +42,10 @@ bool Pass::initialize(const char* vshPath, const char* fshPath, const char* defi
         return false;
     }
 
+    // Keep the vertex shader and defines for the depth effect.
+    _vshPath = vshPath;
+    _defines = defines ? defines : "";
+
     return true;
 }
 
@@ -90,6 +101,66 @@ void Pass::unbind()
     }
 }
 
+Effect* Pass::getDepthEffect()
+{
+    if (_depthEffect == NULL && !_depthEffectFailed && !_vshPath.empty())
+    {
+        // The same vertex shader and defines give the same positions, which the depth test
+        // of the passes drawn over the pre-pass relies on.
+        _depthEffect = Effect::createFromFile(_vshPath.c_str(), "res/shaders/depth.frag", _defines.empty() ? NULL : _defines.c_str());
+        if (_depthEffect == NULL)
+        {
+            GP_WARN("Failed to create depth effect for pass. vertexShader = %s, defines = %s", _vshPath.c_str(), _defines.c_str());
+            _depthEffectFailed = true;
+        }
+    }
+    return _depthEffect;
+}
+
+bool Pass::bindDepthPrepass(Mesh* mesh)
+{
+    GP_ASSERT(mesh);
+
+    Effect* effect = getDepthEffect();
+    if (effect == NULL)
+        return false;
+
+    if (_depthMesh != mesh)
+    {
+        SAFE_RELEASE(_depthVaBinding);
+        _depthVaBinding = VertexAttributeBinding::create(mesh, effect);
+        _depthMesh = mesh;
+    }
+
+    effect->bind();
+    RenderState::bind(this, effect, _depthPrepassState);
+    if (_depthVaBinding)
+    {
+        _depthVaBinding->bind();
+    }
+    return true;
+}
+
+void Pass::unbindDepthPrepass()
+{
+    if (_depthVaBinding)
+    {
+        _depthVaBinding->unbind();
+    }
+}
+
+void Pass::bindDepthEqual()
+{
+    GP_ASSERT(_effect);
+
+    _effect->bind();
+    RenderState::bind(this, _effect, _depthEqualState);
+    if (_vaBinding)
+    {
+        _vaBinding->bind();
+    }
+}
+
 Pass* Pass::clone(Technique* technique, NodeCloneContext &context) const
 {
     GP_ASSERT(_effect);
@@ -97,6 +168,13 @@ Pass* Pass::clone(Technique* technique, NodeCloneContext &context) const
 
     Pass* pass = new Pass(getId(), technique);
     pass->_effect = _effect;
+    pass->_vshPath = _vshPath;
+    pass->_defines = _defines;
+    if (_depthEffect)
+    {
+        _depthEffect->addRef();
+        pass->_depthEffect = _depthEffect;
+    }
 
     RenderState::cloneInto(pass, context);
     pass->_parent = technique;
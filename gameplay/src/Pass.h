@@ -8,6 +8,7 @@ namespace gameplay
 {
 
 class Technique;
+class Mesh;
 class NodeCloneContext;
 
 /**
@@ -68,6 +69,50 @@ public:
      */
     void unbind();
 
+    /**
+     * Gets the depth effect of this pass, which is used to draw a depth pre-pass.
+     *
+     * The depth effect is created the first time it is needed, from the vertex shader
+     * and defines of this pass with a fragment shader that only writes depth, so that
+     * it computes exactly the same positions as the effect of the pass. Alpha tested
+     * passes (defining TEXTURE_DISCARD_ALPHA) still discard their transparent pixels.
+     *
+     * @return The depth effect, or NULL if it could not be created.
+     * @script{ignore}
+     */
+    Effect* getDepthEffect();
+
+    /**
+     * Binds the render state for drawing a mesh into a depth pre-pass with this pass.
+     *
+     * The depth effect of the pass is bound with depth writes enabled and blending
+     * disabled. When drawing is complete, unbindDepthPrepass() should be called.
+     *
+     * @param mesh The mesh that is about to be drawn.
+     *
+     * @return true if the pass was bound, or false if it has no depth effect.
+     * @script{ignore}
+     */
+    bool bindDepthPrepass(Mesh* mesh);
+
+    /**
+     * Unbinds the render state bound by bindDepthPrepass().
+     *
+     * @script{ignore}
+     */
+    void unbindDepthPrepass();
+
+    /**
+     * Binds the render state for this pass to draw over the depth of a depth pre-pass.
+     *
+     * This is the same as bind(), except that the depth test is set to equal and depth
+     * writes are disabled, so that each pixel is only shaded by the surface that is
+     * visible in it. When drawing is complete, the unbind() method should be called.
+     *
+     * @script{ignore}
+     */
+    void bindDepthEqual();
+
 private:
 
     /**
@@ -109,6 +154,12 @@ private:
     Technique* _technique;
     Effect* _effect;
     VertexAttributeBinding* _vaBinding;
+    std::string _vshPath;
+    std::string _defines;
+    Effect* _depthEffect;
+    VertexAttributeBinding* _depthVaBinding;
+    Mesh* _depthMesh;
+    bool _depthEffectFailed;
 };
 
 }
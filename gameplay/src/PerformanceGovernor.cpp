@@ -0,0 +1,114 @@
+#include "Base.h"
+#include "PerformanceGovernor.h"
+#include "DynamicResolution.h"
+#include "FramePacer.h"
+#include "Game.h"
+#include "Platform.h"
+
+// Time between reads of the thermal and battery state of the device, in milliseconds.
+#define PERFORMANCE_GOVERNOR_POLL_INTERVAL 2000.0
+
+// Time the device must stay below the current level before the level is raised, in milliseconds.
+#define PERFORMANCE_GOVERNOR_RECOVERY_TIME 30000.0
+
+// Battery level below which the level is lowered to PERFORMANCE_SUSTAINED.
+#define PERFORMANCE_GOVERNOR_LOW_BATTERY 0.2f
+
+// Battery level below which the level is lowered to PERFORMANCE_REDUCED.
+#define PERFORMANCE_GOVERNOR_CRITICAL_BATTERY 0.05f
+
+namespace gameplay
+{
+
+// The frame rate limit of each level, or zero for none.
+static const float __levelFrameRates[] = { 0.0f, 60.0f, 30.0f, 30.0f };
+
+// The highest resolution scale of each level.
+static const float __levelResolutionScales[] = { 1.0f, 1.0f, 0.85f, 0.7f };
+
+PerformanceGovernor::PerformanceGovernor(FramePacer* framePacer, DynamicResolution* dynamicResolution)
+    : _framePacer(framePacer), _dynamicResolution(dynamicResolution), _enabled(false), _level(Game::PERFORMANCE_FULL),
+      _lastPollTime(0.0), _recoveryStartTime(0.0)
+{
+    GP_ASSERT(framePacer);
+    GP_ASSERT(dynamicResolution);
+}
+
+PerformanceGovernor::~PerformanceGovernor()
+{
+}
+
+void PerformanceGovernor::setEnabled(bool enabled)
+{
+    if (enabled == _enabled)
+        return;
+
+    _enabled = enabled;
+    _level = Game::PERFORMANCE_FULL;
+    _lastPollTime = 0.0;
+    _recoveryStartTime = 0.0;
+    applyLevel();
+}
+
+bool PerformanceGovernor::update()
+{
+    const double now = Game::getAbsoluteTime();
+    if (_lastPollTime > 0.0 && now - _lastPollTime < PERFORMANCE_GOVERNOR_POLL_INTERVAL)
+        return false;
+    _lastPollTime = now;
+
+    const unsigned int target = getTargetLevel();
+    if (target > _level)
+    {
+        // Heat builds up quickly, so lower the level straight away.
+        _level = target;
+        _recoveryStartTime = 0.0;
+    }
+    else if (target < _level)
+    {
+        if (_recoveryStartTime == 0.0)
+            _recoveryStartTime = now;
+        if (now - _recoveryStartTime < PERFORMANCE_GOVERNOR_RECOVERY_TIME)
+            return false;
+
+        // Restart the recovery time, so that each step up is held before the next.
+        --_level;
+        _recoveryStartTime = _level > target ? now : 0.0;
+    }
+    else
+    {
+        _recoveryStartTime = 0.0;
+        return false;
+    }
+
+    applyLevel();
+    return true;
+}
+
+unsigned int PerformanceGovernor::getTargetLevel() const
+{
+    unsigned int level = Game::PERFORMANCE_FULL;
+
+    // The thermal states follow the levels: nominal, fair, serious and critical.
+    const int thermalState = Platform::getThermalState();
+    if (thermalState > 0)
+        level = std::min((unsigned int)thermalState, (unsigned int)Game::PERFORMANCE_MINIMAL);
+
+    const float batteryLevel = Platform::getBatteryLevel();
+    if (batteryLevel >= 0.0f && batteryLevel < PERFORMANCE_GOVERNOR_CRITICAL_BATTERY)
+        level = std::max(level, (unsigned int)Game::PERFORMANCE_REDUCED);
+    else if (Platform::isLowPowerMode() || (batteryLevel >= 0.0f && batteryLevel < PERFORMANCE_GOVERNOR_LOW_BATTERY))
+        level = std::max(level, (unsigned int)Game::PERFORMANCE_SUSTAINED);
+
+    return level;
+}
+
+void PerformanceGovernor::applyLevel()
+{
+    GP_ASSERT(_level < sizeof(__levelFrameRates) / sizeof(__levelFrameRates[0]));
+
+    _framePacer->setFrameRateLimit(__levelFrameRates[_level]);
+    _dynamicResolution->setMaxScale(__levelResolutionScales[_level]);
+}
+
+}
@@ -0,0 +1,88 @@
+#ifndef PERFORMANCEGOVERNOR_H_
+#define PERFORMANCEGOVERNOR_H_
+
+namespace gameplay
+{
+
+class DynamicResolution;
+class FramePacer;
+
+/**
+ * Defines the governor that holds the game to a performance level the device can sustain.
+ *
+ * While enabled, the governor reads the thermal state, battery level and low power mode of
+ * the device every few seconds, where the platform reports them, and derives a performance
+ * level from them. A warm device or a low battery lowers the level straight away. The level
+ * is only raised again, one step at a time, once the device has stayed below it for a while,
+ * so that the game does not oscillate between levels as the device cools.
+ *
+ * Below Game::PERFORMANCE_FULL the governor limits the frame rate through the frame pacer,
+ * and at the lower levels it also caps the resolution scale of the dynamic resolution. The
+ * limits are applied on top of the settings of the game, which keep their values.
+ *
+ * Game owns the performance governor and tells the game of changes of level through
+ * Game::performanceLevelEvent().
+ *
+ * @script{ignore}
+ */
+class PerformanceGovernor
+{
+    friend class Game;
+
+private:
+
+    /**
+     * Constructor.
+     */
+    PerformanceGovernor(FramePacer* framePacer, DynamicResolution* dynamicResolution);
+
+    /**
+     * Destructor.
+     */
+    ~PerformanceGovernor();
+
+    /**
+     * Hidden copy constructor.
+     */
+    PerformanceGovernor(const PerformanceGovernor&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    PerformanceGovernor& operator=(const PerformanceGovernor&);
+
+    /**
+     * Enables or disables the governor. Disabling it lifts its limits.
+     */
+    void setEnabled(bool enabled);
+
+    /**
+     * Reads the state of the device when it is due and moves the level towards it.
+     *
+     * Called by Game at the start of each frame while the governor is enabled.
+     *
+     * @return true if the level changed.
+     */
+    bool update();
+
+    /**
+     * Gets the level that the current state of the device calls for.
+     */
+    unsigned int getTargetLevel() const;
+
+    /**
+     * Applies the frame rate limit and resolution scale cap of the current level.
+     */
+    void applyLevel();
+
+    FramePacer* _framePacer;
+    DynamicResolution* _dynamicResolution;
+    bool _enabled;
+    unsigned int _level;            // A Game::PerformanceLevel.
+    double _lastPollTime;
+    double _recoveryStartTime;
+};
+
+}
+
+#endif
@@ -0,0 +1,230 @@
+#include "Base.h"
+#include "PerformanceHud.h"
+#include "Game.h"
+#include "Font.h"
+#include "SpriteBatch.h"
+#include "Texture.h"
+#include "Profiler.h"
+#include "ResourceManager.h"
+
+// The font the text of the HUD is drawn with.
+#define PERFORMANCE_HUD_FONT "res/ui/arial.gpb"
+
+// The distance of the panel from the corner of the viewport, and of its contents from its edges, in pixels.
+#define PERFORMANCE_HUD_MARGIN 8.0f
+
+// The time between updates of the text, in milliseconds.
+#define PERFORMANCE_HUD_TEXT_INTERVAL 250.0
+
+// The width of a frame in the graph of frame times, in pixels.
+#define PERFORMANCE_HUD_BAR_WIDTH 2.0f
+
+// The height of the graph of frame times, in pixels.
+#define PERFORMANCE_HUD_GRAPH_HEIGHT 64.0f
+
+// The frame time at the top of the graph, in milliseconds.
+#define PERFORMANCE_HUD_GRAPH_MAX_TIME 50.0f
+
+namespace gameplay
+{
+
+// Appends a size in bytes in the most readable unit.
+static void appendBytes(std::string& text, size_t bytes)
+{
+    char buffer[32];
+    if (bytes >= 1024 * 1024)
+        sprintf(buffer, "%.1f MB", bytes / (1024.0 * 1024.0));
+    else
+        sprintf(buffer, "%.1f KB", bytes / 1024.0);
+    text += buffer;
+}
+
+PerformanceHud::PerformanceHud()
+    : _visible(false), _loaded(false), _font(NULL), _batch(NULL), _frameTimeIndex(0), _lastDrawTime(0.0), _lastTextTime(0.0)
+{
+    memset(_frameTimes, 0, sizeof(_frameTimes));
+}
+
+PerformanceHud::~PerformanceHud()
+{
+    if (_visible)
+        Profiler::setStageTimingEnabled(false);
+    SAFE_DELETE(_batch);
+    SAFE_RELEASE(_font);
+}
+
+void PerformanceHud::setVisible(bool visible)
+{
+    if (visible == _visible)
+        return;
+
+    _visible = visible;
+    Profiler::setStageTimingEnabled(visible);
+    if (!visible)
+        return;
+
+    if (!_loaded)
+    {
+        _loaded = true;
+        _font = Font::create(PERFORMANCE_HUD_FONT);
+        if (!_font)
+            GP_WARN("Failed to load the font of the performance HUD '%s'.", PERFORMANCE_HUD_FONT);
+
+        // Every quad of the HUD is a tinted white texel.
+        const unsigned char white[] = { 255, 255, 255, 255 };
+        Texture* texture = Texture::create(Texture::RGBA, 1, 1, white);
+        if (texture)
+        {
+            _batch = SpriteBatch::create(texture);
+            SAFE_RELEASE(texture);
+        }
+    }
+
+    // Start the graph and the text afresh.
+    memset(_frameTimes, 0, sizeof(_frameTimes));
+    _lastDrawTime = 0.0;
+    _lastTextTime = 0.0;
+    _text.clear();
+}
+
+void PerformanceHud::draw()
+{
+    GP_PROFILE_SCOPE("PerformanceHud::draw");
+
+    const unsigned int frameCount = sizeof(_frameTimes) / sizeof(_frameTimes[0]);
+    const double now = Game::getAbsoluteTime();
+    if (_lastDrawTime > 0.0)
+    {
+        _frameTimes[_frameTimeIndex] = (float)(now - _lastDrawTime);
+        _frameTimeIndex = (_frameTimeIndex + 1) % frameCount;
+    }
+    _lastDrawTime = now;
+
+    if (now - _lastTextTime >= PERFORMANCE_HUD_TEXT_INTERVAL)
+    {
+        _lastTextTime = now;
+        updateText();
+    }
+
+    if (!_batch || !_font)
+        return;
+
+    const Rectangle& viewport = Game::getInstance()->getViewport();
+    if (viewport.isEmpty())
+        return;
+
+    unsigned int textWidth = 0;
+    unsigned int textHeight = 0;
+    _font->measureText(_text.c_str(), _font->getSize(), &textWidth, &textHeight);
+    const float graphWidth = frameCount * PERFORMANCE_HUD_BAR_WIDTH;
+    const float x = PERFORMANCE_HUD_MARGIN * 2.0f;
+    const float y = PERFORMANCE_HUD_MARGIN * 2.0f;
+    const float graphY = y + textHeight + PERFORMANCE_HUD_MARGIN;
+    const float width = std::max((float)textWidth, graphWidth) + PERFORMANCE_HUD_MARGIN * 2.0f;
+    const float height = textHeight + PERFORMANCE_HUD_GRAPH_HEIGHT + PERFORMANCE_HUD_MARGIN * 3.0f;
+
+    Matrix projectionMatrix;
+    Matrix::createOrthographicOffCenter(viewport.x, viewport.width, viewport.height, viewport.y, 0, 1, &projectionMatrix);
+    _batch->setProjectionMatrix(projectionMatrix);
+    _batch->start();
+
+    // The panel.
+    _batch->draw(PERFORMANCE_HUD_MARGIN, PERFORMANCE_HUD_MARGIN, width, height, 0, 0, 1, 1, Vector4(0.0f, 0.0f, 0.0f, 0.6f));
+
+    // The graph, oldest frame first, colored by the frame rate each frame would hold.
+    const float graphBottom = graphY + PERFORMANCE_HUD_GRAPH_HEIGHT;
+    const float scale = PERFORMANCE_HUD_GRAPH_HEIGHT / PERFORMANCE_HUD_GRAPH_MAX_TIME;
+    for (unsigned int i = 0; i < frameCount; ++i)
+    {
+        const float frameTime = _frameTimes[(_frameTimeIndex + i) % frameCount];
+        if (frameTime <= 0.0f)
+            continue;
+
+        const float barHeight = std::min(frameTime * scale, PERFORMANCE_HUD_GRAPH_HEIGHT);
+        const Vector4 color = frameTime <= 1000.0f / 60.0f ? Vector4(0.2f, 0.9f, 0.2f, 0.9f) :
+            (frameTime <= 1000.0f / 30.0f ? Vector4(0.9f, 0.8f, 0.2f, 0.9f) : Vector4(0.9f, 0.2f, 0.2f, 0.9f));
+        _batch->draw(x + i * PERFORMANCE_HUD_BAR_WIDTH, graphBottom - barHeight, PERFORMANCE_HUD_BAR_WIDTH, barHeight, 0, 0, 1, 1, color);
+    }
+    _batch->draw(x, graphBottom - 1000.0f / 60.0f * scale, graphWidth, 1.0f, 0, 0, 1, 1, Vector4(1.0f, 1.0f, 1.0f, 0.5f));
+    _batch->draw(x, graphBottom - 1000.0f / 30.0f * scale, graphWidth, 1.0f, 0, 0, 1, 1, Vector4(1.0f, 1.0f, 1.0f, 0.5f));
+    _batch->finish();
+
+    _font->start();
+    _font->drawText(_text.c_str(), (int)x, (int)y, Vector4::one(), _font->getSize());
+    _font->finish();
+}
+
+void PerformanceHud::updateText()
+{
+    char buffer[256];
+    Game* game = Game::getInstance();
+
+    // Frame rate and times over the graph.
+    const unsigned int frameCount = sizeof(_frameTimes) / sizeof(_frameTimes[0]);
+    float minTime = 0.0f;
+    float maxTime = 0.0f;
+    float totalTime = 0.0f;
+    unsigned int timedFrames = 0;
+    for (unsigned int i = 0; i < frameCount; ++i)
+    {
+        const float frameTime = _frameTimes[i];
+        if (frameTime <= 0.0f)
+            continue;
+        minTime = timedFrames == 0 ? frameTime : std::min(minTime, frameTime);
+        maxTime = std::max(maxTime, frameTime);
+        totalTime += frameTime;
+        ++timedFrames;
+    }
+    sprintf(buffer, "%u fps  frame %.2f ms (min %.2f, max %.2f)\n", game->getFrameRate(),
+        timedFrames > 0 ? totalTime / timedFrames : 0.0f, minTime, maxTime);
+    _text = buffer;
+
+    // Rendering statistics.
+    const FrameStats& stats = game->getFrameStats();
+    sprintf(buffer, "draws %u  triangles %u  programs %u  textures %u  states %u  uniforms %u (%u skipped)\n",
+        stats.drawCalls, stats.triangles, stats.programBinds, stats.textureBinds, stats.stateChanges,
+        stats.uniformUploads, stats.uniformsSkipped);
+    _text += buffer;
+
+    // Stages of the frame, CPU then GPU.
+    const std::vector<Profiler::Stage>& stages = Profiler::getStageTimes();
+    for (int gpu = 0; gpu < 2; ++gpu)
+    {
+        for (size_t i = 0, count = stages.size(); i < count; ++i)
+        {
+            const Profiler::Stage& stage = stages[i];
+            if (stage.gpu != (gpu != 0))
+                continue;
+            snprintf(buffer, sizeof(buffer), "%s  %s %.2f ms\n", gpu ? "GPU" : "CPU", stage.name, stage.time);
+            _text += buffer;
+        }
+    }
+
+    // Memory of the resource caches.
+    _text += "cached";
+    for (int i = 0; i < ResourceManager::CATEGORY_COUNT; ++i)
+    {
+        ResourceManager::Stats cacheStats;
+        ResourceManager::getStats((ResourceManager::Category)i, &cacheStats);
+        sprintf(buffer, "  %s %u ", ResourceManager::getCategoryName((ResourceManager::Category)i), cacheStats.count);
+        _text += buffer;
+        appendBytes(_text, cacheStats.memorySize);
+    }
+    _text += "\n";
+
+#ifdef GP_USE_MEM_LEAK_DETECTION
+    // Heap memory by tag.
+    _text += "heap";
+    for (int i = 0; i < MEMORY_TAG_COUNT; ++i)
+    {
+        MemoryTagStats tagStats;
+        getMemoryTagStats((MemoryTag)i, &tagStats);
+        sprintf(buffer, "  %s ", getMemoryTagName((MemoryTag)i));
+        _text += buffer;
+        appendBytes(_text, tagStats.bytes);
+    }
+    _text += "\n";
+#endif
+}
+
+}
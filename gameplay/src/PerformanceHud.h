@@ -0,0 +1,84 @@
+#ifndef PERFORMANCEHUD_H_
+#define PERFORMANCEHUD_H_
+
+namespace gameplay
+{
+
+class Font;
+class SpriteBatch;
+
+/**
+ * Defines the performance HUD drawn over the frame while it is visible.
+ *
+ * The HUD shows the frame rate and frame time, the draw calls, state changes and uniform
+ * uploads counted by FrameStats, the time spent in the CPU and GPU stages of the frame as
+ * timed by the profiler, the memory used by the resource caches and, in builds with
+ * GP_USE_MEM_LEAK_DETECTION, the heap memory of each memory tag. A graph of the time of the
+ * last frames is drawn below, with lines at the times of 60 and 30 frames per second.
+ *
+ * The text is only formatted again a few times per second. The panel and the graph are
+ * drawn with a single sprite batch and the text with the batch of the font, so the HUD
+ * adds two draw calls to the frame. Stage timings need profiling markers, which are only
+ * compiled into builds with GP_USE_PROFILER.
+ *
+ * Game owns the performance HUD and draws it after the game and its scripts render.
+ *
+ * @script{ignore}
+ */
+class PerformanceHud
+{
+    friend class Game;
+
+private:
+
+    /**
+     * Constructor.
+     */
+    PerformanceHud();
+
+    /**
+     * Destructor.
+     */
+    ~PerformanceHud();
+
+    /**
+     * Hidden copy constructor.
+     */
+    PerformanceHud(const PerformanceHud&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    PerformanceHud& operator=(const PerformanceHud&);
+
+    /**
+     * Shows or hides the HUD. The font and sprite batch are loaded the first time it is shown.
+     */
+    void setVisible(bool visible);
+
+    /**
+     * Records the time of the frame and draws the HUD over it.
+     *
+     * Called by Game at the end of each frame while the HUD is visible.
+     */
+    void draw();
+
+    /**
+     * Formats the text of the HUD from the statistics of the last frame.
+     */
+    void updateText();
+
+    bool _visible;
+    bool _loaded;
+    Font* _font;
+    SpriteBatch* _batch;
+    float _frameTimes[120];
+    unsigned int _frameTimeIndex;
+    double _lastDrawTime;
+    double _lastTextTime;
+    std::string _text;
+};
+
+}
+
+#endif
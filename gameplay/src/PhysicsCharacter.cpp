@@ -650,7 +650,10 @@ PhysicsCharacter::ActionInterface::ActionInterface(PhysicsCharacter* character)
 
 void PhysicsCharacter::ActionInterface::updateAction(btCollisionWorld* collisionWorld, btScalar deltaTimeStep)
 {
-    character->updateAction(collisionWorld, deltaTimeStep);
+    // Distant characters update less often, or not at all, with the physics level of detail.
+    float timeStep;
+    if (Game::getInstance()->getPhysicsController()->stepLodAction(character, deltaTimeStep, &timeStep))
+        character->updateAction(collisionWorld, timeStep);
 }
 
 void PhysicsCharacter::ActionInterface::debugDraw(btIDebugDraw* debugDrawer)
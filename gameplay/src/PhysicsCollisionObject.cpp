@@ -37,7 +37,8 @@ struct CollidesWithCallback : public btCollisionWorld::ContactResultCallback
 };
 
 PhysicsCollisionObject::PhysicsCollisionObject(Node* node, int group, int mask)
-    : _node(node), _collisionShape(NULL), _enabled(true), _scriptListeners(NULL), _motionState(NULL), _group(group), _mask(mask)
+    : _node(node), _collisionShape(NULL), _enabled(true), _scriptListeners(NULL), _motionState(NULL), _group(group), _mask(mask),
+      _lodLevel(LOD_FULL), _lodTime(0.0f), _lodTicks(0), _lodActivationState(0)
 {
 }
 
@@ -111,6 +112,11 @@ bool PhysicsCollisionObject::isEnabled() const
     return _enabled;
 }
 
+PhysicsCollisionObject::LodLevel PhysicsCollisionObject::getLodLevel() const
+{
+    return _lodLevel;
+}
+
 void PhysicsCollisionObject::setEnabled(bool enable)
 {
     if (enable)
@@ -211,7 +217,7 @@ bool PhysicsCollisionObject::CollisionPair::operator < (const CollisionPair& col
 }
 
 PhysicsCollisionObject::PhysicsMotionState::PhysicsMotionState(Node* node, PhysicsCollisionObject* collisionObject, const Vector3* centerOfMassOffset) :
-    _node(node), _collisionObject(collisionObject), _centerOfMassOffset(btTransform::getIdentity())
+    _node(node), _collisionObject(collisionObject), _centerOfMassOffset(btTransform::getIdentity()), _updated(false)
 {
     if (centerOfMassOffset)
     {
@@ -224,6 +230,15 @@ PhysicsCollisionObject::PhysicsMotionState::PhysicsMotionState(Node* node, Physi
 
 PhysicsCollisionObject::PhysicsMotionState::~PhysicsMotionState()
 {
+    if (_updated)
+    {
+        PhysicsController* physicsController = Game::getInstance()->getPhysicsController();
+        if (physicsController)
+        {
+            std::vector<PhysicsMotionState*>& states = physicsController->_updatedMotionStates;
+            states.erase(std::remove(states.begin(), states.end(), this), states.end());
+        }
+    }
 }
 
 void PhysicsCollisionObject::PhysicsMotionState::getWorldTransform(btTransform &transform) const
@@ -241,10 +256,34 @@ void PhysicsCollisionObject::PhysicsMotionState::setWorldTransform(const btTrans
 {
     GP_ASSERT(_node);
 
+    _previousWorldTransform = _worldTransform;
     _worldTransform = transform * _centerOfMassOffset;
-        
-    const btQuaternion& rot = _worldTransform.getRotation();
-    const btVector3& pos = _worldTransform.getOrigin();
+
+    // The node itself is updated by the physics controller once the simulation step
+    // completes, which may be on the main thread after a step run as a job.
+    if (!_updated)
+    {
+        _updated = true;
+        Game::getInstance()->getPhysicsController()->_updatedMotionStates.push_back(this);
+    }
+}
+
+void PhysicsCollisionObject::PhysicsMotionState::updateNodeFromTransform(float alpha)
+{
+    GP_ASSERT(_node);
+
+    btQuaternion rot;
+    btVector3 pos;
+    if (alpha < 1.0f)
+    {
+        rot = _previousWorldTransform.getRotation().slerp(_worldTransform.getRotation(), alpha);
+        pos = _previousWorldTransform.getOrigin().lerp(_worldTransform.getOrigin(), alpha);
+    }
+    else
+    {
+        rot = _worldTransform.getRotation();
+        pos = _worldTransform.getOrigin();
+    }
 
     _node->setRotation(rot.x(), rot.y(), rot.z(), rot.w());
     _node->setTranslation(pos.x(), pos.y(), pos.z());
@@ -274,6 +313,9 @@ void PhysicsCollisionObject::PhysicsMotionState::updateTransformFromNode() const
     {
         _worldTransform = btTransform(BQ(rotation), btVector3(m.m[12], m.m[13], m.m[14]));
     }
+
+    // The node was moved directly, so there is nothing to interpolate from.
+    _previousWorldTransform = _worldTransform;
 }
 
 void PhysicsCollisionObject::PhysicsMotionState::setCenterOfMassOffset(const Vector3& centerOfMassOffset)
@@ -29,6 +29,7 @@ class PhysicsCollisionObject
     friend class PhysicsConstraint;
     friend class PhysicsRigidBody;
     friend class PhysicsGhostObject;
+    friend class SceneSnapshot;
 
 public:
 
@@ -68,6 +69,31 @@ public:
         NONE
     };
 
+    /**
+     * Represents the levels of detail that collision objects are simulated at.
+     *
+     * @see PhysicsController::setLodNode
+     */
+    enum LodLevel
+    {
+        /**
+         * The object is simulated every tick.
+         */
+        LOD_FULL,
+
+        /**
+         * Characters and vehicles run their per-tick update at a reduced rate.
+         * Rigid bodies are still simulated every tick.
+         */
+        LOD_REDUCED,
+
+        /**
+         * Rigid bodies are taken out of the simulation, keeping their velocities, and
+         * characters and vehicles skip their per-tick update until promoted.
+         */
+        LOD_FROZEN
+    };
+
     /** 
      * Defines a pair of rigid bodies that collided (or may collide).
      */
@@ -211,6 +237,13 @@ public:
      */
     bool isEnabled() const;
 
+    /**
+     * Gets the level of detail that this collision object is simulated at.
+     *
+     * @return The level of detail.
+     */
+    LodLevel getLodLevel() const;
+
     /**
      * Sets the collision object to be enabled or disabled.
      *
@@ -349,6 +382,7 @@ private:
     class PhysicsMotionState : public btMotionState
     {
         friend class PhysicsConstraint;
+        friend class PhysicsController;
         
     public:
         
@@ -380,6 +414,13 @@ private:
          * Updates the motion state's world transform from the GamePlay Node object's world transform.
          */
         void updateTransformFromNode() const;
+
+        /**
+         * Updates the GamePlay Node object's transform from the motion state's world transform.
+         *
+         * @param alpha The fraction to interpolate from the previous to the current world transform.
+         */
+        void updateNodeFromTransform(float alpha = 1.0f);
         
         /**
          * Sets the center of mass offset for the associated collision shape.
@@ -392,6 +433,8 @@ private:
         PhysicsCollisionObject* _collisionObject;
         btTransform _centerOfMassOffset;
         mutable btTransform _worldTransform;
+        mutable btTransform _previousWorldTransform;
+        bool _updated;
     };
 
     /** 
@@ -404,6 +447,14 @@ private:
      */
     int _group;
     int _mask;
+
+    /**
+     * The level of detail state, with the time and ticks since the last reduced update.
+     */
+    LodLevel _lodLevel;
+    float _lodTime;
+    unsigned int _lodTicks;
+    int _lodActivationState;
 };
 
 }
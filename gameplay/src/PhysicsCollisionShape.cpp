@@ -42,6 +42,7 @@ PhysicsCollisionShape::~PhysicsCollisionShape()
             if (_shapeData.heightfieldData)
             {
                 SAFE_RELEASE(_shapeData.heightfieldData->heightfield);
+                SAFE_DELETE_ARRAY(_shapeData.heightfieldData->samples);
                 SAFE_DELETE(_shapeData.heightfieldData);
             }
             break;
@@ -250,6 +250,7 @@ private:
         Matrix inverse;
         float minHeight;
         float maxHeight;
+        short* samples;
     };
 
     /**
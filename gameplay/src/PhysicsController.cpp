@@ -2,16 +2,24 @@
 #include "PhysicsController.h"
 #include "PhysicsRigidBody.h"
 #include "PhysicsCharacter.h"
+#include "PhysicsGhostObject.h"
 #include "Game.h"
 #include "MeshPart.h"
 #include "Bundle.h"
 #include "Terrain.h"
+#include "Stream.h"
 
 #ifdef GP_USE_MEM_LEAK_DETECTION
 #undef new
 #endif
 #include "BulletCollision/CollisionShapes/btHeightfieldTerrainShape.h"
 #include "BulletCollision/CollisionShapes/btShapeHull.h"
+#ifdef BT_THREADSAFE
+#include "LinearMath/btThreads.h"
+#include "BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h"
+#include "BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h"
+#include "BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h"
+#endif
 #ifdef GP_USE_MEM_LEAK_DETECTION
 #define new DEBUG_NEW
 #endif
@@ -19,29 +27,171 @@
 // The initial capacity of the Bullet debug drawer's vertex batch.
 #define INITIAL_CAPACITY 280
 
+// The number of updates that a terrain collision tile is kept for once no object needs it.
+#define TERRAIN_TILE_EXPIRY 60
+
+// The minimum number of manifolds that the multi-threaded dispatcher processes per job.
+#define DISPATCHER_GRAIN_SIZE 40
+
 namespace gameplay
 {
 
+/**
+ * Returns whether the given Bullet object belongs to a ghost object that is a trigger.
+ */
+static bool isTrigger(const btCollisionObject* collisionObject)
+{
+    const PhysicsCollisionObject* object = reinterpret_cast<const PhysicsCollisionObject*>(collisionObject->getUserPointer());
+    return object && object->getType() == PhysicsCollisionObject::GHOST_OBJECT &&
+        static_cast<const PhysicsGhostObject*>(object)->getTriggerMode() != PhysicsGhostObject::TRIGGER_NONE;
+}
+
+/**
+ * Generates the contacts of the broadphase pairs of the world, except for the pairs of triggers,
+ * whose overlaps are reported from the broadphase pairs alone when the events are dispatched.
+ */
+static void nearCallback(btBroadphasePair& pair, btCollisionDispatcher& dispatcher, const btDispatcherInfo& info)
+{
+    if (isTrigger(static_cast<btCollisionObject*>(pair.m_pProxy0->m_clientObject)) ||
+        isTrigger(static_cast<btCollisionObject*>(pair.m_pProxy1->m_clientObject)))
+        return;
+
+    btCollisionDispatcher::defaultNearCallback(pair, dispatcher, info);
+}
+
+/**
+ * Internal class used to test the shapes of an exact trigger and of an object overlapping it.
+ * @script{ignore}
+ */
+struct TriggerContactCallback : public btCollisionWorld::ContactResultCallback
+{
+    /**
+     * Constructor.
+     */
+    TriggerContactCallback(const btCollisionObject* trigger) : trigger(trigger), touching(false)
+    {
+    }
+
+    /**
+     * Called with each contact; keeps the first one that touches.
+     */
+    btScalar addSingleResult(btManifoldPoint& cp, const btCollisionObjectWrapper* a, int partIdA, int indexA, const btCollisionObjectWrapper* b, int partIdB, int indexB)
+    {
+        if (!touching && cp.getDistance() <= 0.0f)
+        {
+            bool swapped = a->getCollisionObject() != trigger;
+            pointA = swapped ? cp.getPositionWorldOnB() : cp.getPositionWorldOnA();
+            pointB = swapped ? cp.getPositionWorldOnA() : cp.getPositionWorldOnB();
+            touching = true;
+        }
+        return 0.0f;
+    }
+
+    /**
+     * The Bullet object of the trigger.
+     */
+    const btCollisionObject* trigger;
+
+    /**
+     * Whether the shapes touch.
+     */
+    bool touching;
+
+    /**
+     * The contact point on the trigger.
+     */
+    btVector3 pointA;
+
+    /**
+     * The contact point on the other object.
+     */
+    btVector3 pointB;
+};
+
+#ifdef BT_THREADSAFE
+/**
+ * Runs the parallel loops of a multi-threaded Bullet world on the engine job system.
+ *
+ * @script{ignore}
+ */
+class PhysicsTaskScheduler : public btITaskScheduler
+{
+public:
+
+    PhysicsTaskScheduler(JobSystem* jobSystem, unsigned int threadCount)
+        : btITaskScheduler("GamePlay"), _jobSystem(jobSystem), _threadCount(threadCount)
+    {
+    }
+
+    int getMaxNumThreads() const
+    {
+        return (int)_jobSystem->getThreadCount();
+    }
+
+    int getNumThreads() const
+    {
+        return (int)_threadCount;
+    }
+
+    void setNumThreads(int numThreads)
+    {
+        _threadCount = (unsigned int)std::max(1, std::min(numThreads, getMaxNumThreads()));
+    }
+
+    void parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body)
+    {
+        _jobSystem->parallelFor((unsigned int)iBegin, (unsigned int)iEnd,
+            [&body](unsigned int begin, unsigned int end) { body.forLoop((int)begin, (int)end); },
+            getGrainSize(iBegin, iEnd, grainSize));
+    }
+
+    btScalar parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body)
+    {
+        std::mutex mutex;
+        btScalar sum = 0;
+        _jobSystem->parallelFor((unsigned int)iBegin, (unsigned int)iEnd,
+            [&body, &mutex, &sum](unsigned int begin, unsigned int end)
+            {
+                btScalar partial = body.sumLoop((int)begin, (int)end);
+                std::lock_guard<std::mutex> lock(mutex);
+                sum += partial;
+            },
+            getGrainSize(iBegin, iEnd, grainSize));
+        return sum;
+    }
+
+private:
+
+    // Splits a range into no more jobs than there are simulation threads.
+    unsigned int getGrainSize(int iBegin, int iEnd, int grainSize) const
+    {
+        unsigned int count = (unsigned int)std::max(iEnd - iBegin, 0);
+        return std::max((unsigned int)std::max(grainSize, 1), (count + _threadCount - 1) / _threadCount);
+    }
+
+    JobSystem* _jobSystem;
+    unsigned int _threadCount;
+};
+#endif
+
 const int PhysicsController::DIRTY         = 0x01;
 const int PhysicsController::COLLISION     = 0x02;
 const int PhysicsController::REGISTERED    = 0x04;
 const int PhysicsController::REMOVE        = 0x08;
 
 PhysicsController::PhysicsController()
-  : _isUpdating(false), _collisionConfiguration(NULL), _dispatcher(NULL),
+  : _isUpdating(false), _deferNodeUpdates(false), _tickRate(0.0f), _maxSubSteps(10),
+    _timeAccumulator(0.0f), _threadCount(1), _taskScheduler(NULL), _solverPool(NULL), _terrainTileSize(0), _terrainTileFrame(0),
+    _lodNode(NULL), _lodReducedDistance(0.0f), _lodFrozenDistance(0.0f), _lodReducedRate(4), _collisionConfiguration(NULL), _dispatcher(NULL),
     _overlappingPairCache(NULL), _solver(NULL), _world(NULL), _ghostPairCallback(NULL),
     _debugDrawer(NULL), _status(PhysicsController::Listener::DEACTIVATED), _listeners(NULL),
-    _gravity(btScalar(0.0), btScalar(-9.8), btScalar(0.0)), _collisionCallback(NULL)
+    _gravity(btScalar(0.0), btScalar(-9.8), btScalar(0.0))
 {
     GP_REGISTER_SCRIPT_EVENTS();
-
-    // Default gravity is 9.8 along the negative Y axis.
-    _collisionCallback = new CollisionCallback(this);
 }
 
 PhysicsController::~PhysicsController()
 {
-    SAFE_DELETE(_collisionCallback);
     SAFE_DELETE(_ghostPairCallback);
     SAFE_DELETE(_debugDrawer);
     SAFE_DELETE(_listeners);
@@ -160,6 +310,96 @@ void PhysicsController::setGravity(const Vector3& gravity)
         _world->setGravity(BV(_gravity));
 }
 
+float PhysicsController::getTickRate() const
+{
+    return _tickRate;
+}
+
+void PhysicsController::setTickRate(float tickRate)
+{
+    _tickRate = tickRate > 0.0f ? tickRate : 0.0f;
+    _timeAccumulator = 0.0f;
+}
+
+int PhysicsController::getMaxSubSteps() const
+{
+    return _maxSubSteps;
+}
+
+void PhysicsController::setMaxSubSteps(int maxSubSteps)
+{
+    _maxSubSteps = maxSubSteps > 1 ? maxSubSteps : 1;
+}
+
+unsigned int PhysicsController::getThreadCount() const
+{
+    return _threadCount;
+}
+
+unsigned int PhysicsController::getTerrainTileSize() const
+{
+    return _terrainTileSize;
+}
+
+void PhysicsController::setTerrainTileSize(unsigned int tileSize)
+{
+    _terrainTileSize = tileSize;
+}
+
+Node* PhysicsController::getLodNode() const
+{
+    return _lodNode;
+}
+
+void PhysicsController::setLodNode(Node* node)
+{
+    if (_lodNode == node)
+        return;
+
+    SAFE_RELEASE(_lodNode);
+    _lodNode = node;
+    if (_lodNode)
+    {
+        _lodNode->addRef();
+    }
+    else if (_world)
+    {
+        // Bring every object back to full simulation.
+        for (int i = 0; i < _world->getNumCollisionObjects(); i++)
+        {
+            PhysicsCollisionObject* object = static_cast<PhysicsCollisionObject*>(_world->getCollisionObjectArray()[i]->getUserPointer());
+            if (object && object->_lodLevel != PhysicsCollisionObject::LOD_FULL)
+                setLodLevel(object, PhysicsCollisionObject::LOD_FULL);
+        }
+    }
+}
+
+float PhysicsController::getLodReducedDistance() const
+{
+    return _lodReducedDistance;
+}
+
+float PhysicsController::getLodFrozenDistance() const
+{
+    return _lodFrozenDistance;
+}
+
+void PhysicsController::setLodDistances(float reducedDistance, float frozenDistance)
+{
+    _lodReducedDistance = std::max(reducedDistance, 0.0f);
+    _lodFrozenDistance = std::max(frozenDistance, 0.0f);
+}
+
+unsigned int PhysicsController::getLodReducedRate() const
+{
+    return _lodReducedRate;
+}
+
+void PhysicsController::setLodReducedRate(unsigned int rate)
+{
+    _lodReducedRate = std::max(rate, 1u);
+}
+
 void PhysicsController::drawDebug(const Matrix& viewProjection)
 {
     GP_ASSERT(_debugDrawer);
@@ -170,6 +410,25 @@ void PhysicsController::drawDebug(const Matrix& viewProjection)
     _debugDrawer->end();
 }
 
+// Gets the world transform of a node without scale, as the start of a sweep.
+static void getSweepTransform(Node* node, btTransform* transform)
+{
+    GP_ASSERT(transform);
+
+    transform->setIdentity();
+    if (node)
+    {
+        Vector3 translation;
+        Quaternion rotation;
+        const Matrix& m = node->getWorldMatrix();
+        m.getTranslation(&translation);
+        m.getRotation(&rotation);
+
+        transform->setOrigin(BV(translation));
+        transform->setRotation(BQ(rotation));
+    }
+}
+
 bool PhysicsController::rayTest(const Ray& ray, float distance, PhysicsController::HitResult* result, PhysicsController::HitFilter* filter)
 {
     class RayTestCallback : public btCollisionWorld::ClosestRayResultCallback
@@ -226,6 +485,16 @@ bool PhysicsController::rayTest(const Ray& ray, float distance, PhysicsControlle
     btVector3 rayFromWorld(BV(ray.getOrigin()));
     btVector3 rayToWorld(rayFromWorld + BV(ray.getDirection() * distance));
 
+    // Build the terrain tiles that the ray passes over.
+    if (!_tiledTerrains.empty())
+    {
+        btVector3 aabbMin(rayFromWorld);
+        btVector3 aabbMax(rayFromWorld);
+        aabbMin.setMin(rayToWorld);
+        aabbMax.setMax(rayToWorld);
+        buildTerrainTiles(aabbMin, aabbMax);
+    }
+
     RayTestCallback callback(rayFromWorld, rayToWorld, filter);
     _world->rayTest(rayFromWorld, rayToWorld, callback);
     if (callback.hasHit())
@@ -304,19 +573,7 @@ bool PhysicsController::sweepTest(PhysicsCollisionObject* object, const Vector3&
 
     // Define the start transform.
     btTransform start;
-    start.setIdentity();
-    if (object->getNode())
-    {
-        Vector3 translation;
-        Quaternion rotation;
-        const Matrix& m = object->getNode()->getWorldMatrix();
-        m.getTranslation(&translation);
-        m.getRotation(&rotation);
-
-        start.setIdentity();
-        start.setOrigin(BV(translation));
-        start.setRotation(BQ(rotation));
-    }
+    getSweepTransform(object->getNode(), &start);
 
     // Define the end transform.
     btTransform end(start);
@@ -340,6 +597,17 @@ bool PhysicsController::sweepTest(PhysicsCollisionObject* object, const Vector3&
         break;
     }*/
 
+    // Build the terrain tiles that the object sweeps over.
+    if (!_tiledTerrains.empty())
+    {
+        btVector3 aabbMin, aabbMax, endMin, endMax;
+        shape->getShape()->getAabb(start, aabbMin, aabbMax);
+        shape->getShape()->getAabb(end, endMin, endMax);
+        aabbMin.setMin(endMin);
+        aabbMax.setMax(endMax);
+        buildTerrainTiles(aabbMin, aabbMax);
+    }
+
     GP_ASSERT(_world);
     _world->convexSweepTest(static_cast<btConvexShape*>(shape->getShape()), start, end, callback, _world->getDispatchInfo().m_allowedCcdPenetration);
 
@@ -360,90 +628,472 @@ bool PhysicsController::sweepTest(PhysicsCollisionObject* object, const Vector3&
     return false;
 }
 
-btScalar PhysicsController::CollisionCallback::addSingleResult(btManifoldPoint& cp, const btCollisionObjectWrapper* a, int partIdA, int indexA, 
-    const btCollisionObjectWrapper* b, int partIdB, int indexB)
+/**
+ * Tests a ray against the collision objects of the broadphase leaves it passes through.
+ *
+ * @script{ignore}
+ */
+class RayBatchCollector : public btDbvt::ICollide
 {
-    GP_ASSERT(_pc);
+public:
 
-    // Get pointers to the PhysicsCollisionObject objects.
-    PhysicsCollisionObject* objectA = _pc->getCollisionObject(a->m_collisionObject);
-    PhysicsCollisionObject* objectB = _pc->getCollisionObject(b->m_collisionObject);
+    RayBatchCollector(const btTransform& from, const btTransform& to, int mask, btCollisionWorld::ClosestRayResultCallback& callback)
+        : _from(from), _to(to), _mask(mask), _callback(callback)
+    {
+    }
 
-    // If the given collision object pair has collided in the past, then
-    // we notify the listeners only if the pair was not colliding
-    // during the previous frame. Otherwise, it's a new pair, so add a
-    // new entry to the cache with the appropriate listeners and notify them.
-    PhysicsCollisionObject::CollisionPair pair(objectA, objectB);
+    void Process(const btDbvtNode* leaf)
+    {
+        btBroadphaseProxy* proxy = static_cast<btBroadphaseProxy*>(leaf->data);
+        btCollisionObject* object = static_cast<btCollisionObject*>(proxy->m_clientObject);
+        if ((proxy->m_collisionFilterGroup & _mask) == 0 || object->getUserPointer() == NULL)
+            return;
+
+        btCollisionWorld::rayTestSingle(_from, _to, object, object->getCollisionShape(), object->getWorldTransform(), _callback);
+    }
+
+private:
+
+    const btTransform& _from;
+    const btTransform& _to;
+    int _mask;
+    btCollisionWorld::ClosestRayResultCallback& _callback;
+};
 
-    CollisionInfo* collisionInfo;
-    if (_pc->_collisionStatus.count(pair) > 0)
+/**
+ * Tests a convex sweep against the collision objects of the broadphase leaves it overlaps.
+ *
+ * @script{ignore}
+ */
+class SweepBatchCollector : public btDbvt::ICollide
+{
+public:
+
+    SweepBatchCollector(const btConvexShape* shape, const btTransform& from, const btTransform& to, const btCollisionObject* me,
+                        int mask, btScalar allowedPenetration, btCollisionWorld::ClosestConvexResultCallback& callback)
+        : _shape(shape), _from(from), _to(to), _me(me), _mask(mask), _allowedPenetration(allowedPenetration), _callback(callback)
     {
-        collisionInfo = &_pc->_collisionStatus[pair];
     }
-    else
+
+    void Process(const btDbvtNode* leaf)
     {
-        // Add a new collision pair for these objects.
-        collisionInfo = &_pc->_collisionStatus[pair];
+        btBroadphaseProxy* proxy = static_cast<btBroadphaseProxy*>(leaf->data);
+        btCollisionObject* object = static_cast<btCollisionObject*>(proxy->m_clientObject);
+        if (object == _me || (proxy->m_collisionFilterGroup & _mask) == 0 || object->getUserPointer() == NULL)
+            return;
+
+        btCollisionWorld::objectQuerySingle(_shape, _from, _to, object, object->getCollisionShape(), object->getWorldTransform(), _callback, _allowedPenetration);
+    }
+
+private:
+
+    const btConvexShape* _shape;
+    const btTransform& _from;
+    const btTransform& _to;
+    const btCollisionObject* _me;
+    int _mask;
+    btScalar _allowedPenetration;
+    btCollisionWorld::ClosestConvexResultCallback& _callback;
+};
+
+unsigned int PhysicsController::rayTestBatch(const RayQuery* queries, unsigned int count, PhysicsController::HitResult* results)
+{
+    GP_ASSERT(queries || count == 0);
+    GP_ASSERT(results || count == 0);
+    GP_ASSERT(_world);
+    GP_ASSERT(!_isUpdating);
+
+    // Build the terrain tiles under all of the rays before testing them concurrently.
+    if (!_tiledTerrains.empty())
+    {
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            btVector3 from(BV(queries[i].ray.getOrigin()));
+            btVector3 to(from + BV(queries[i].ray.getDirection() * queries[i].distance));
+            btVector3 aabbMin(from);
+            btVector3 aabbMax(from);
+            aabbMin.setMin(to);
+            aabbMax.setMax(to);
+            buildTerrainTiles(aabbMin, aabbMax);
+        }
+    }
 
-        // Add the appropriate listeners.
-        PhysicsCollisionObject::CollisionPair p1(pair.objectA, NULL);
-        if (_pc->_collisionStatus.count(p1) > 0)
+    // Walk the broadphase trees directly, since the world's ray test shares its traversal stack between calls.
+    btDbvtBroadphase* broadphase = static_cast<btDbvtBroadphase*>(_overlappingPairCache);
+    std::atomic<unsigned int> hits(0);
+    JobSystem::RangeFunction test = [this, queries, results, broadphase, &hits](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int i = begin; i < end; ++i)
         {
-            const CollisionInfo& ci = _pc->_collisionStatus[p1];
-            std::vector<PhysicsCollisionObject::CollisionListener*>::const_iterator iter = ci._listeners.begin();
-            for (; iter != ci._listeners.end(); iter++)
+            btTransform from, to;
+            from.setIdentity();
+            to.setIdentity();
+            from.setOrigin(BV(queries[i].ray.getOrigin()));
+            to.setOrigin(from.getOrigin() + BV(queries[i].ray.getDirection() * queries[i].distance));
+
+            btCollisionWorld::ClosestRayResultCallback callback(from.getOrigin(), to.getOrigin());
+            RayBatchCollector collector(from, to, queries[i].mask, callback);
+            btDbvt::rayTest(broadphase->m_sets[0].m_root, from.getOrigin(), to.getOrigin(), collector);
+            btDbvt::rayTest(broadphase->m_sets[1].m_root, from.getOrigin(), to.getOrigin(), collector);
+
+            HitResult& result = results[i];
+            if (callback.hasHit())
+            {
+                result.object = getCollisionObject(callback.m_collisionObject);
+                result.point.set(callback.m_hitPointWorld.x(), callback.m_hitPointWorld.y(), callback.m_hitPointWorld.z());
+                result.fraction = callback.m_closestHitFraction;
+                result.normal.set(callback.m_hitNormalWorld.x(), callback.m_hitNormalWorld.y(), callback.m_hitNormalWorld.z());
+                ++hits;
+            }
+            else
             {
-                GP_ASSERT(*iter);
-                collisionInfo->_listeners.push_back(*iter);
+                result.object = NULL;
+                result.fraction = 1.0f;
             }
         }
-        PhysicsCollisionObject::CollisionPair p2(pair.objectB, NULL);
-        if (_pc->_collisionStatus.count(p2) > 0)
+    };
+
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem)
+        jobSystem->parallelFor(0, count, test);
+    else
+        test(0, count);
+
+    return hits;
+}
+
+unsigned int PhysicsController::sweepTestBatch(const SweepQuery* queries, unsigned int count, PhysicsController::HitResult* results)
+{
+    GP_ASSERT(queries || count == 0);
+    GP_ASSERT(results || count == 0);
+    GP_ASSERT(_world);
+    GP_ASSERT(!_isUpdating);
+
+    // Compute the start and end of each sweep, and build the terrain tiles under them, before testing them concurrently.
+    std::vector<btTransform> transforms(count * 2);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        GP_ASSERT(queries[i].object);
+        getSweepTransform(queries[i].object->getNode(), &transforms[i * 2]);
+        transforms[i * 2 + 1] = transforms[i * 2];
+        transforms[i * 2 + 1].setOrigin(BV(queries[i].endPosition));
+
+        if (!_tiledTerrains.empty() && queries[i].object->getCollisionShape())
         {
-            const CollisionInfo& ci = _pc->_collisionStatus[p2];
-            std::vector<PhysicsCollisionObject::CollisionListener*>::const_iterator iter = ci._listeners.begin();
-            for (; iter != ci._listeners.end(); iter++)
+            btVector3 aabbMin, aabbMax, endMin, endMax;
+            queries[i].object->getCollisionShape()->getShape()->getAabb(transforms[i * 2], aabbMin, aabbMax);
+            queries[i].object->getCollisionShape()->getShape()->getAabb(transforms[i * 2 + 1], endMin, endMax);
+            aabbMin.setMin(endMin);
+            aabbMax.setMax(endMax);
+            buildTerrainTiles(aabbMin, aabbMax);
+        }
+    }
+
+    btDbvtBroadphase* broadphase = static_cast<btDbvtBroadphase*>(_overlappingPairCache);
+    btScalar allowedPenetration = _world->getDispatchInfo().m_allowedCcdPenetration;
+    std::atomic<unsigned int> hits(0);
+    JobSystem::RangeFunction test = [this, queries, results, broadphase, allowedPenetration, &transforms, &hits](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int i = begin; i < end; ++i)
+        {
+            HitResult& result = results[i];
+            result.object = NULL;
+            result.fraction = 1.0f;
+
+            PhysicsCollisionShape* shape = queries[i].object->getCollisionShape();
+            PhysicsCollisionShape::Type type = shape ? shape->getType() : PhysicsCollisionShape::SHAPE_NONE;
+            if (type != PhysicsCollisionShape::SHAPE_BOX && type != PhysicsCollisionShape::SHAPE_SPHERE && type != PhysicsCollisionShape::SHAPE_CAPSULE)
+                continue; // unsupported type
+
+            const btConvexShape* castShape = static_cast<const btConvexShape*>(shape->getShape());
+            const btTransform& from = transforms[i * 2];
+            const btTransform& to = transforms[i * 2 + 1];
+            btVector3 aabbMin, aabbMax, endMin, endMax;
+            castShape->getAabb(from, aabbMin, aabbMax);
+            castShape->getAabb(to, endMin, endMax);
+            aabbMin.setMin(endMin);
+            aabbMax.setMax(endMax);
+            btDbvtVolume volume = btDbvtVolume::FromMM(aabbMin, aabbMax);
+
+            btCollisionWorld::ClosestConvexResultCallback callback(from.getOrigin(), to.getOrigin());
+            SweepBatchCollector collector(castShape, from, to, queries[i].object->getCollisionObject(), queries[i].mask, allowedPenetration, callback);
+            broadphase->m_sets[0].collideTV(broadphase->m_sets[0].m_root, volume, collector);
+            broadphase->m_sets[1].collideTV(broadphase->m_sets[1].m_root, volume, collector);
+
+            if (callback.hasHit())
             {
-                GP_ASSERT(*iter);
-                collisionInfo->_listeners.push_back(*iter);
+                result.object = getCollisionObject(callback.m_hitCollisionObject);
+                result.point.set(callback.m_hitPointWorld.x(), callback.m_hitPointWorld.y(), callback.m_hitPointWorld.z());
+                result.fraction = callback.m_closestHitFraction;
+                result.normal.set(callback.m_hitNormalWorld.x(), callback.m_hitNormalWorld.y(), callback.m_hitNormalWorld.z());
+                ++hits;
             }
         }
+    };
+
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem)
+        jobSystem->parallelFor(0, count, test);
+    else
+        test(0, count);
+
+    return hits;
+}
+
+// Identifies and versions the binary snapshots written by saveState().
+static const char PHYSICS_STATE_IDENTIFIER[] = { 'G', 'P', 'P', 'S' };
+static const unsigned int PHYSICS_STATE_VERSION = 1;
+
+// The state of a single collision object in a snapshot, following the id of its node.
+struct PhysicsObjectState
+{
+    float rotation[4];
+    float origin[3];
+    float linearVelocity[3];
+    float angularVelocity[3];
+    int activationState;
+};
+
+// Returns whether the given collision object is moved by the simulation and so stored in snapshots.
+static PhysicsCollisionObject* getStatefulObject(btCollisionObject* collisionObject)
+{
+    GP_ASSERT(collisionObject);
+    PhysicsCollisionObject* object = static_cast<PhysicsCollisionObject*>(collisionObject->getUserPointer());
+    if (!object || collisionObject->isStaticObject() || !object->getNode() || object->getCollisionObject() != collisionObject)
+        return NULL;
+    return object;
+}
+
+bool PhysicsController::saveState(Stream* stream) const
+{
+    GP_ASSERT(_world);
+
+    if (!stream || !stream->canWrite())
+    {
+        GP_ERROR("Failed to save physics state; the stream is not writable.");
+        return false;
     }
 
-    // Fire collision event.
-    if ((collisionInfo->_status & COLLISION) == 0)
+    unsigned int count = 0;
+    for (int i = 0; i < _world->getNumCollisionObjects(); i++)
+    {
+        if (getStatefulObject(_world->getCollisionObjectArray()[i]))
+            ++count;
+    }
+
+    if (stream->write(PHYSICS_STATE_IDENTIFIER, 1, sizeof(PHYSICS_STATE_IDENTIFIER)) != sizeof(PHYSICS_STATE_IDENTIFIER) ||
+        stream->write(&PHYSICS_STATE_VERSION, sizeof(unsigned int), 1) != 1 ||
+        stream->write(&count, sizeof(unsigned int), 1) != 1)
+    {
+        GP_ERROR("Failed to write physics state header.");
+        return false;
+    }
+
+    for (int i = 0; i < _world->getNumCollisionObjects(); i++)
     {
-        std::vector<PhysicsCollisionObject::CollisionListener*>::const_iterator iter = collisionInfo->_listeners.begin();
-        for (; iter != collisionInfo->_listeners.end(); iter++)
+        btCollisionObject* collisionObject = _world->getCollisionObjectArray()[i];
+        PhysicsCollisionObject* object = getStatefulObject(collisionObject);
+        if (!object)
+            continue;
+
+        const btTransform& transform = collisionObject->getWorldTransform();
+        const btQuaternion rotation = transform.getRotation();
+        PhysicsObjectState state;
+        state.rotation[0] = rotation.x();
+        state.rotation[1] = rotation.y();
+        state.rotation[2] = rotation.z();
+        state.rotation[3] = rotation.w();
+        state.origin[0] = transform.getOrigin().x();
+        state.origin[1] = transform.getOrigin().y();
+        state.origin[2] = transform.getOrigin().z();
+        memset(state.linearVelocity, 0, sizeof(state.linearVelocity));
+        memset(state.angularVelocity, 0, sizeof(state.angularVelocity));
+        state.activationState = collisionObject->getActivationState();
+
+        const btRigidBody* body = btRigidBody::upcast(collisionObject);
+        if (body)
         {
-            GP_ASSERT(*iter);
-            if ((collisionInfo->_status & REMOVE) == 0)
+            for (int j = 0; j < 3; j++)
             {
-                (*iter)->collisionEvent(PhysicsCollisionObject::CollisionListener::COLLIDING, pair, Vector3(cp.getPositionWorldOnA().x(), cp.getPositionWorldOnA().y(), cp.getPositionWorldOnA().z()),
-                    Vector3(cp.getPositionWorldOnB().x(), cp.getPositionWorldOnB().y(), cp.getPositionWorldOnB().z()));
+                state.linearVelocity[j] = body->getLinearVelocity()[j];
+                state.angularVelocity[j] = body->getAngularVelocity()[j];
             }
         }
+
+        // Frozen objects are saved with the activation state they come back to.
+        if (object->_lodLevel == PhysicsCollisionObject::LOD_FROZEN && object->getType() == PhysicsCollisionObject::RIGID_BODY)
+            state.activationState = object->_lodActivationState;
+
+        const char* id = object->getNode()->getId();
+        unsigned int length = (unsigned int)strlen(id);
+        if (stream->write(&length, sizeof(unsigned int), 1) != 1 ||
+            (length > 0 && stream->write(id, 1, length) != length) ||
+            stream->write(&state, sizeof(PhysicsObjectState), 1) != 1)
+        {
+            GP_ERROR("Failed to write physics state of node '%s'.", id);
+            return false;
+        }
     }
 
-    // Update the collision status cache (we remove the dirty bit
-    // set in the controller's update so that this particular collision pair's
-    // status is not reset to 'no collision' when the controller's update completes).
-    collisionInfo->_status &= ~DIRTY;
-    collisionInfo->_status |= COLLISION;
-    return 0.0f;
+    return true;
+}
+
+bool PhysicsController::loadState(Stream* stream)
+{
+    GP_ASSERT(_world);
+
+    if (_isUpdating)
+    {
+        GP_ERROR("Cannot load physics state while the world is being stepped.");
+        return false;
+    }
+    if (!stream || !stream->canRead())
+    {
+        GP_ERROR("Failed to load physics state; the stream is not readable.");
+        return false;
+    }
+
+    char identifier[sizeof(PHYSICS_STATE_IDENTIFIER)];
+    unsigned int version = 0;
+    unsigned int count = 0;
+    if (stream->read(identifier, 1, sizeof(identifier)) != sizeof(identifier) ||
+        memcmp(identifier, PHYSICS_STATE_IDENTIFIER, sizeof(identifier)) != 0)
+    {
+        GP_ERROR("Invalid physics state; the identifier does not match.");
+        return false;
+    }
+    if (stream->read(&version, sizeof(unsigned int), 1) != 1 || version != PHYSICS_STATE_VERSION)
+    {
+        GP_ERROR("Unsupported physics state version (%d).", version);
+        return false;
+    }
+    if (stream->read(&count, sizeof(unsigned int), 1) != 1)
+    {
+        GP_ERROR("Failed to read physics state header.");
+        return false;
+    }
+
+    // Index the objects in the world by node id, keeping their order for nodes that share an id.
+    std::multimap<std::string, PhysicsCollisionObject*> objects;
+    for (int i = 0; i < _world->getNumCollisionObjects(); i++)
+    {
+        PhysicsCollisionObject* object = getStatefulObject(_world->getCollisionObjectArray()[i]);
+        if (object)
+            objects.insert(std::make_pair(std::string(object->getNode()->getId()), object));
+    }
+
+    std::string id;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        unsigned int length = 0;
+        PhysicsObjectState state;
+        if (stream->read(&length, sizeof(unsigned int), 1) != 1)
+        {
+            GP_ERROR("Failed to read physics state of object %d.", i);
+            return false;
+        }
+        id.resize(length);
+        if ((length > 0 && stream->read(&id[0], 1, length) != length) ||
+            stream->read(&state, sizeof(PhysicsObjectState), 1) != 1)
+        {
+            GP_ERROR("Failed to read physics state of object %d.", i);
+            return false;
+        }
+
+        std::multimap<std::string, PhysicsCollisionObject*>::iterator itr = objects.find(id);
+        if (itr == objects.end())
+        {
+            GP_WARN("No collision object in the world for the physics state of node '%s'.", id.c_str());
+            continue;
+        }
+        PhysicsCollisionObject* object = itr->second;
+        objects.erase(itr);
+
+        // A frozen object is brought back first so that it takes the saved activation state.
+        if (object->_lodLevel != PhysicsCollisionObject::LOD_FULL)
+            setLodLevel(object, PhysicsCollisionObject::LOD_FULL);
+
+        btCollisionObject* collisionObject = object->getCollisionObject();
+        btTransform transform(btQuaternion(state.rotation[0], state.rotation[1], state.rotation[2], state.rotation[3]),
+            btVector3(state.origin[0], state.origin[1], state.origin[2]));
+        collisionObject->setWorldTransform(transform);
+        collisionObject->setInterpolationWorldTransform(transform);
+
+        btRigidBody* body = btRigidBody::upcast(collisionObject);
+        if (body)
+        {
+            body->setLinearVelocity(btVector3(state.linearVelocity[0], state.linearVelocity[1], state.linearVelocity[2]));
+            body->setAngularVelocity(btVector3(state.angularVelocity[0], state.angularVelocity[1], state.angularVelocity[2]));
+            body->setInterpolationLinearVelocity(body->getLinearVelocity());
+            body->setInterpolationAngularVelocity(body->getAngularVelocity());
+            body->clearForces();
+        }
+        collisionObject->forceActivationState(state.activationState);
+
+        // Place the node at the restored transform without interpolating from where it was.
+        if (object->_motionState)
+        {
+            object->_motionState->setWorldTransform(transform);
+            object->_motionState->_previousWorldTransform = object->_motionState->_worldTransform;
+            object->_motionState->updateNodeFromTransform();
+        }
+
+        // Overlapping pairs and contacts from before the restore no longer apply.
+        if (collisionObject->getBroadphaseHandle())
+        {
+            _world->updateSingleAabb(collisionObject);
+            _world->getBroadphase()->getOverlappingPairCache()->cleanProxyFromPairs(collisionObject->getBroadphaseHandle(), _dispatcher);
+        }
+    }
+
+    return true;
 }
 
 void PhysicsController::initialize()
 {
-    _collisionConfiguration = bullet_new<btDefaultCollisionConfiguration>();
-    _dispatcher = bullet_new<btCollisionDispatcher>(_collisionConfiguration);
-    _overlappingPairCache = bullet_new<btDbvtBroadphase>();
-    _solver = bullet_new<btSequentialImpulseConstraintSolver>();
+    Properties* config = Game::getInstance()->getConfig()->getNamespace("physics", true);
+    int threads = config ? config->getInt("threads") : 0;
 
-    // Create the world.
-    _world = bullet_new<btDiscreteDynamicsWorld>(_dispatcher, _overlappingPairCache, _solver, _collisionConfiguration);
+#ifdef BT_THREADSAFE
+    // Create a multi-threaded world, which runs its parallel loops on the job system.
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (threads > 1 && jobSystem && jobSystem->getThreadCount() > 1)
+    {
+        _threadCount = std::min((unsigned int)threads, jobSystem->getThreadCount());
+        _taskScheduler = new PhysicsTaskScheduler(jobSystem, _threadCount);
+        btSetTaskScheduler(_taskScheduler);
+
+        // Large pools keep the worker threads from allocating manifolds and collision algorithms on the heap.
+        btDefaultCollisionConstructionInfo info;
+        info.m_defaultMaxPersistentManifoldPoolSize = 80000;
+        info.m_defaultMaxCollisionAlgorithmPoolSize = 80000;
+        _collisionConfiguration = bullet_new<btDefaultCollisionConfiguration>(info);
+        _dispatcher = bullet_new<btCollisionDispatcherMt>(_collisionConfiguration, DISPATCHER_GRAIN_SIZE);
+        _overlappingPairCache = bullet_new<btDbvtBroadphase>();
+        _solverPool = bullet_new<btConstraintSolverPoolMt>((int)_threadCount);
+        _solver = bullet_new<btSequentialImpulseConstraintSolverMt>();
+        _world = bullet_new<btDiscreteDynamicsWorldMt>(_dispatcher, _overlappingPairCache, _solverPool, _solver, _collisionConfiguration);
+    }
+#else
+    if (threads > 1)
+        GP_WARN("Bullet was built without BT_THREADSAFE; the physics world is single-threaded.");
+#endif
+
+    if (!_world)
+    {
+        _collisionConfiguration = bullet_new<btDefaultCollisionConfiguration>();
+        _dispatcher = bullet_new<btCollisionDispatcher>(_collisionConfiguration);
+        _overlappingPairCache = bullet_new<btDbvtBroadphase>();
+        _solver = bullet_new<btSequentialImpulseConstraintSolver>();
+
+        // Create the world.
+        _world = bullet_new<btDiscreteDynamicsWorld>(_dispatcher, _overlappingPairCache, _solver, _collisionConfiguration);
+    }
     _world->setGravity(BV(_gravity));
 
+    // Skip the narrowphase of the pairs of triggers.
+    _dispatcher->setNearCallback(nearCallback);
+
     // Register ghost pair callback so bullet detects collisions with ghost objects (used for character collisions).
     GP_ASSERT(_world->getPairCache());
     _ghostPairCallback = bullet_new<btGhostPairCallback>();
@@ -453,17 +1103,55 @@ void PhysicsController::initialize()
     // Set up debug drawing.
     _debugDrawer = new DebugDrawer();
     _world->setDebugDrawer(_debugDrawer);
+
+    // Load the simulation stepping settings from the game config.
+    if (config)
+    {
+        if (config->exists("tickRate"))
+            setTickRate(config->getFloat("tickRate"));
+        if (config->exists("maxSubSteps"))
+            setMaxSubSteps(config->getInt("maxSubSteps"));
+        if (config->exists("terrainTileSize"))
+            setTerrainTileSize((unsigned int)std::max(config->getInt("terrainTileSize"), 0));
+        if (config->exists("lodReducedDistance") || config->exists("lodFrozenDistance"))
+            setLodDistances(config->getFloat("lodReducedDistance"), config->getFloat("lodFrozenDistance"));
+        if (config->exists("lodReducedRate"))
+            setLodReducedRate((unsigned int)std::max(config->getInt("lodReducedRate"), 1));
+    }
 }
 
-void PhysicsController::finalize()
-{
+void PhysicsController::finalize()
+{
+    // Destroy the tiles of the terrains still in the world.
+    for (size_t i = 0, count = _tiledTerrains.size(); i < count; ++i)
+    {
+        TiledTerrain* terrain = _tiledTerrains[i];
+        for (std::map<unsigned int, TerrainTile>::iterator itr = terrain->tiles.begin(); itr != terrain->tiles.end(); ++itr)
+        {
+            destroyTerrainTile(&itr->second);
+        }
+        SAFE_DELETE(terrain);
+    }
+    _tiledTerrains.clear();
+    SAFE_RELEASE(_lodNode);
+
     // Clean up the world and its various components.
     SAFE_DELETE(_world);
     SAFE_DELETE(_ghostPairCallback);
     SAFE_DELETE(_solver);
+    SAFE_DELETE(_solverPool);
     SAFE_DELETE(_overlappingPairCache);
     SAFE_DELETE(_dispatcher);
     SAFE_DELETE(_collisionConfiguration);
+
+#ifdef BT_THREADSAFE
+    if (_taskScheduler)
+    {
+        btSetTaskScheduler(NULL);
+        SAFE_DELETE(_taskScheduler);
+    }
+#endif
+    _threadCount = 1;
 }
 
 void PhysicsController::pause()
@@ -478,49 +1166,115 @@ void PhysicsController::resume()
 
 void PhysicsController::update(float elapsedTime)
 {
+    stepSimulation(elapsedTime, false);
+    dispatchEvents();
+}
+
+void PhysicsController::stepSimulation(float elapsedTime, bool deferNodeUpdates)
+{
+    GP_PROFILE_SCOPE("PhysicsController::stepSimulation");
+
     GP_ASSERT(_world);
     _isUpdating = true;
+    _deferNodeUpdates = deferNodeUpdates;
+
+    updateTerrainTiles();
+    updateLod();
 
-    // Update the physics simulation, with a maximum
-    // of 10 simulation steps being performed in a given frame.
-    //
     // Note that stepSimulation takes elapsed time in seconds
     // so we divide by 1000 to convert from milliseconds.
-    _world->stepSimulation(elapsedTime * 0.001f, 10);
+    if (_tickRate > 0.0f)
+    {
+        // Step the world by whole fixed ticks only. Bullet is given no sub-steps so that it
+        // reports the exact simulated state of each tick, which updateNodes() interpolates.
+        const float fixedTimeStep = 1.0f / _tickRate;
+        _timeAccumulator += elapsedTime * 0.001f;
+        int steps = 0;
+        while (_timeAccumulator >= fixedTimeStep && steps < _maxSubSteps)
+        {
+            if (steps == 0)
+                clearUpdatedMotionStates();
+            _world->stepSimulation(fixedTimeStep, 0);
+            _timeAccumulator -= fixedTimeStep;
+            ++steps;
+        }
+
+        // Drop the time we could not catch up on rather than spiralling on the next frames.
+        if (_timeAccumulator >= fixedTimeStep)
+            _timeAccumulator = fmodf(_timeAccumulator, fixedTimeStep);
+    }
+    else
+    {
+        // Update the physics simulation, with a maximum
+        // number of simulation steps being performed in a given frame.
+        clearUpdatedMotionStates();
+        _world->stepSimulation(elapsedTime * 0.001f, _maxSubSteps);
+    }
+
+    if (!deferNodeUpdates)
+        updateNodes();
+}
+
+void PhysicsController::updateNodes()
+{
+    // In fixed tick mode nodes are placed between the last two ticks by the fraction of
+    // a tick that has elapsed since the last one. This runs every frame, including those
+    // without a new tick.
+    // Only the bodies the simulation moved are listed, so sleeping bodies cost nothing here.
+    if (_updatedMotionStates.empty())
+        return;
+
+    // Suspend transform notifications so that each node is notified once for both its rotation and
+    // translation, and listeners and bounds are updated in one batch after all nodes are written.
+    float alpha = _tickRate > 0.0f ? _timeAccumulator * _tickRate : 1.0f;
+    Transform::suspendTransformChanged();
+    for (size_t i = 0, count = _updatedMotionStates.size(); i < count; ++i)
+    {
+        GP_ASSERT(_updatedMotionStates[i]);
+        _updatedMotionStates[i]->updateNodeFromTransform(alpha);
+    }
+    Transform::resumeTransformChanged();
+}
+
+void PhysicsController::clearUpdatedMotionStates()
+{
+    for (size_t i = 0, count = _updatedMotionStates.size(); i < count; ++i)
+    {
+        GP_ASSERT(_updatedMotionStates[i]);
+        _updatedMotionStates[i]->_updated = false;
+    }
+    _updatedMotionStates.clear();
+}
+
+void PhysicsController::dispatchEvents()
+{
+    GP_PROFILE_SCOPE("PhysicsController::dispatchEvents");
+
+    GP_ASSERT(_world);
+    GP_ASSERT(_isUpdating);
+
+    // Apply any node transforms that were deferred while stepping the simulation off the main thread.
+    if (_deferNodeUpdates)
+    {
+        _deferNodeUpdates = false;
+        updateNodes();
+    }
 
     // If we have status listeners, then check if our status has changed.
     if (_listeners || hasScriptListener(GP_GET_SCRIPT_EVENT(PhysicsController, statusEvent)))
     {
         Listener::EventType oldStatus = _status;
 
-        if (_status == Listener::DEACTIVATED)
-        {
-            for (int i = 0; i < _world->getNumCollisionObjects(); i++)
-            {
-                GP_ASSERT(_world->getCollisionObjectArray()[i]);
-                if (_world->getCollisionObjectArray()[i]->isActive())
-                {
-                    _status = Listener::ACTIVATED;
-                    break;
-                }
-            }
-        }
-        else
+        // Bullet synchronizes the motion state of every active dynamic body on each step, so the
+        // world is active whenever a motion state was updated. Kinematic bodies, ghosts and
+        // characters are never synchronized and are checked on their own.
+        bool active = !_updatedMotionStates.empty();
+        for (size_t i = 0, count = _kinematicObjects.size(); i < count && !active; ++i)
         {
-            bool allInactive = true;
-            for (int i = 0; i < _world->getNumCollisionObjects(); i++)
-            {
-                GP_ASSERT(_world->getCollisionObjectArray()[i]);
-                if (_world->getCollisionObjectArray()[i]->isActive())
-                {
-                    allInactive = false;
-                    break;
-                }
-            }
-
-            if (allInactive)
-                _status = Listener::DEACTIVATED;
+            GP_ASSERT(_kinematicObjects[i] && _kinematicObjects[i]->getCollisionObject());
+            active = _kinematicObjects[i]->getCollisionObject()->isActive();
         }
+        _status = active ? Listener::ACTIVATED : Listener::DEACTIVATED;
 
         // If the status has changed, notify our listeners.
         if (oldStatus != _status)
@@ -572,19 +1326,48 @@ void PhysicsController::update(float elapsedTime)
         }
     }
 
-    // Go through the collision status cache and perform all registered collision tests.
-    iter = _collisionStatus.begin();
-    for (; iter != _collisionStatus.end(); iter++)
+    // Go through the contact manifolds of the last step once, recording the contacts of the pairs that are listened to.
+    // (In the case where we register for all collisions with a rigid body, there will be a lot
+    // of collision pairs in the status cache that we did not explicitly register for.)
+    if (!_collisionStatus.empty())
     {
-        // If this collision pair was one that was registered for listening, then perform the collision test.
-        // (In the case where we register for all collisions with a rigid body, there will be a lot
-        // of collision pairs in the status cache that we did not explicitly register for.)
-        if ((iter->second._status & REGISTERED) != 0 && (iter->second._status & REMOVE) == 0)
+        GP_ASSERT(_dispatcher);
+        for (int i = 0, count = _dispatcher->getNumManifolds(); i < count; ++i)
         {
-            if (iter->first.objectB)
-                _world->contactPairTest(iter->first.objectA->getCollisionObject(), iter->first.objectB->getCollisionObject(), *_collisionCallback);
-            else
-                _world->contactTest(iter->first.objectA->getCollisionObject(), *_collisionCallback);
+            const btPersistentManifold* manifold = _dispatcher->getManifoldByIndexInternal(i);
+            GP_ASSERT(manifold);
+            if (manifold->getNumContacts() == 0)
+                continue;
+
+            // Bullet objects without a gameplay collision object are ignored.
+            PhysicsCollisionObject* objectA = getCollisionObject(manifold->getBody0());
+            PhysicsCollisionObject* objectB = getCollisionObject(manifold->getBody1());
+            if (objectA == NULL || objectB == NULL || objectA == objectB)
+                continue;
+
+            // Report the deepest point of the manifold.
+            int deepest = 0;
+            for (int j = 1, points = manifold->getNumContacts(); j < points; ++j)
+            {
+                if (manifold->getContactPoint(j).getDistance() < manifold->getContactPoint(deepest).getDistance())
+                    deepest = j;
+            }
+            const btManifoldPoint& point = manifold->getContactPoint(deepest);
+
+            // Manifolds keep speculative and separating points within the contact breaking
+            // threshold, so the objects only touch if the deepest point has penetrated.
+            if (point.getDistance() > 0.0f)
+                continue;
+
+            addCollision(objectA, objectB,
+                Vector3(point.getPositionWorldOnA().x(), point.getPositionWorldOnA().y(), point.getPositionWorldOnA().z()),
+                Vector3(point.getPositionWorldOnB().x(), point.getPositionWorldOnB().y(), point.getPositionWorldOnB().z()));
+        }
+
+        // Triggers have no manifolds; the objects overlapping them are found from the broadphase pairs of the last step.
+        for (size_t i = 0, count = _triggerObjects.size(); i < count; ++i)
+        {
+            addTriggerCollisions(_triggerObjects[i]);
         }
     }
 
@@ -610,6 +1393,103 @@ void PhysicsController::update(float elapsedTime)
     _isUpdating = false;
 }
 
+void PhysicsController::addCollision(PhysicsCollisionObject* objectA, PhysicsCollisionObject* objectB, const Vector3& pointA, const Vector3& pointB)
+{
+    // If the given collision object pair has collided in the past, then
+    // we notify the listeners only if the pair was not colliding
+    // during the previous frame. Otherwise, it's a new pair, so add a
+    // new entry to the cache with the appropriate listeners and notify them.
+    PhysicsCollisionObject::CollisionPair pair(objectA, objectB);
+
+    std::map<PhysicsCollisionObject::CollisionPair, CollisionInfo>::iterator iter = _collisionStatus.find(pair);
+    if (iter == _collisionStatus.end())
+    {
+        // Only pairs that one of the two objects listens to are tracked.
+        std::map<PhysicsCollisionObject::CollisionPair, CollisionInfo>::iterator p1 = _collisionStatus.find(PhysicsCollisionObject::CollisionPair(objectA, NULL));
+        std::map<PhysicsCollisionObject::CollisionPair, CollisionInfo>::iterator p2 = _collisionStatus.find(PhysicsCollisionObject::CollisionPair(objectB, NULL));
+        if (p1 == _collisionStatus.end() && p2 == _collisionStatus.end())
+            return;
+
+        // Add a new collision pair for these objects, with the appropriate listeners.
+        iter = _collisionStatus.insert(std::make_pair(pair, CollisionInfo())).first;
+        if (p1 != _collisionStatus.end())
+            iter->second._listeners.insert(iter->second._listeners.end(), p1->second._listeners.begin(), p1->second._listeners.end());
+        if (p2 != _collisionStatus.end())
+            iter->second._listeners.insert(iter->second._listeners.end(), p2->second._listeners.begin(), p2->second._listeners.end());
+    }
+
+    // Fire collision event.
+    CollisionInfo& collisionInfo = iter->second;
+    if ((collisionInfo._status & COLLISION) == 0 && (collisionInfo._status & REMOVE) == 0)
+    {
+        for (size_t i = 0, count = collisionInfo._listeners.size(); i < count; ++i)
+        {
+            GP_ASSERT(collisionInfo._listeners[i]);
+            collisionInfo._listeners[i]->collisionEvent(PhysicsCollisionObject::CollisionListener::COLLIDING, pair, pointA, pointB);
+        }
+    }
+
+    // Update the collision status cache (we remove the dirty bit
+    // set in dispatchEvents so that this particular collision pair's
+    // status is not reset to 'no collision' when the dispatch completes).
+    collisionInfo._status &= ~DIRTY;
+    collisionInfo._status |= COLLISION;
+}
+
+void PhysicsController::addTriggerCollisions(PhysicsGhostObject* trigger)
+{
+    GP_ASSERT(trigger && trigger->_ghostObject);
+    btPairCachingGhostObject* ghost = trigger->_ghostObject;
+    const btBroadphaseProxy* proxy = ghost->getBroadphaseHandle();
+    if (!proxy)
+        return;
+
+    const bool listened = _collisionStatus.find(PhysicsCollisionObject::CollisionPair(trigger, NULL)) != _collisionStatus.end();
+    for (int i = 0, count = ghost->getNumOverlappingObjects(); i < count; ++i)
+    {
+        btCollisionObject* collisionObject = ghost->getOverlappingObject(i);
+        GP_ASSERT(collisionObject && collisionObject->getBroadphaseHandle());
+        PhysicsCollisionObject* object = getCollisionObject(collisionObject);
+        if (object == NULL || object == trigger)
+            continue;
+
+        // The overlap of two triggers is reported once, and is exact if either of them is.
+        bool exact = trigger->_triggerMode == PhysicsGhostObject::TRIGGER_EXACT;
+        if (isTrigger(collisionObject))
+        {
+            if (object < trigger)
+                continue;
+            exact = exact || static_cast<PhysicsGhostObject*>(object)->_triggerMode == PhysicsGhostObject::TRIGGER_EXACT;
+        }
+
+        if (exact)
+        {
+            // Only the shapes of the pairs that are listened to are tested.
+            if (!listened && _collisionStatus.find(PhysicsCollisionObject::CollisionPair(object, NULL)) == _collisionStatus.end() &&
+                _collisionStatus.find(PhysicsCollisionObject::CollisionPair(trigger, object)) == _collisionStatus.end())
+                continue;
+
+            TriggerContactCallback callback(ghost);
+            _world->contactPairTest(ghost, collisionObject, callback);
+            if (callback.touching)
+            {
+                addCollision(trigger, object, Vector3(callback.pointA.x(), callback.pointA.y(), callback.pointA.z()),
+                    Vector3(callback.pointB.x(), callback.pointB.y(), callback.pointB.z()));
+            }
+        }
+        else
+        {
+            btVector3 aabbMin = proxy->m_aabbMin;
+            btVector3 aabbMax = proxy->m_aabbMax;
+            aabbMin.setMax(collisionObject->getBroadphaseHandle()->m_aabbMin);
+            aabbMax.setMin(collisionObject->getBroadphaseHandle()->m_aabbMax);
+            btVector3 center = (aabbMin + aabbMax) * 0.5f;
+            Vector3 point(center.x(), center.y(), center.z());
+            addCollision(trigger, object, point, point);
+        }
+    }
+}
+
 void PhysicsController::addCollisionListener(PhysicsCollisionObject::CollisionListener* listener, PhysicsCollisionObject* objectA, PhysicsCollisionObject* objectB)
 {
     GP_ASSERT(listener);
@@ -648,7 +1528,25 @@ void PhysicsController::addCollisionObject(PhysicsCollisionObject* object)
     short group = (short)object->_group;
     short mask = (short)object->_mask;
 
+    // Static heightfields collide through tiles built near moving objects rather than as a whole.
+    if (_terrainTileSize > 0 && object->getType() == PhysicsCollisionObject::RIGID_BODY &&
+        object->getShapeType() == PhysicsCollisionShape::SHAPE_HEIGHTFIELD && static_cast<PhysicsRigidBody*>(object)->isStatic())
+    {
+        if (findTiledTerrain(object) == _tiledTerrains.end())
+        {
+            TiledTerrain* terrain = new TiledTerrain();
+            terrain->body = static_cast<PhysicsRigidBody*>(object);
+            terrain->tileSize = _terrainTileSize;
+            terrain->transform = object->getCollisionObject()->getWorldTransform();
+            terrain->scale = object->getCollisionShape()->getShape()->getLocalScaling();
+            _tiledTerrains.push_back(terrain);
+        }
+        return;
+    }
+
     // Add the object to the physics world.
+    updateKinematicObject(object, true);
+    updateTriggerObject(object, true);
     switch (object->getType())
     {
     case PhysicsCollisionObject::RIGID_BODY:
@@ -675,8 +1573,19 @@ void PhysicsController::removeCollisionObject(PhysicsCollisionObject* object, bo
     GP_ASSERT(_world);
     GP_ASSERT(!_isUpdating);
 
-    // Remove the collision object from the world.
-    if (object->getCollisionObject())
+    // Remove the collision object from the world. Tiled terrains are only in the world through their tiles.
+    std::vector<TiledTerrain*>::iterator tiled = findTiledTerrain(object);
+    if (tiled != _tiledTerrains.end())
+    {
+        TiledTerrain* terrain = *tiled;
+        for (std::map<unsigned int, TerrainTile>::iterator itr = terrain->tiles.begin(); itr != terrain->tiles.end(); ++itr)
+        {
+            destroyTerrainTile(&itr->second);
+        }
+        SAFE_DELETE(terrain);
+        _tiledTerrains.erase(tiled);
+    }
+    else if (object->getCollisionObject())
     {
         switch (object->getType())
         {
@@ -695,6 +1604,11 @@ void PhysicsController::removeCollisionObject(PhysicsCollisionObject* object, bo
         }
     }
 
+    updateKinematicObject(object, false);
+    updateTriggerObject(object, false);
+    if (object->_lodLevel != PhysicsCollisionObject::LOD_FULL)
+        setLodLevel(object, PhysicsCollisionObject::LOD_FULL);
+
     // Find all references to the object in the collision status cache and mark them for removal.
     if (removeListeners)
     {
@@ -707,6 +1621,332 @@ void PhysicsController::removeCollisionObject(PhysicsCollisionObject* object, bo
     }
 }
 
+void PhysicsController::updateLod()
+{
+    if (!_lodNode)
+        return;
+
+    // Objects are promoted only once they are well inside a distance to avoid switching on the boundary.
+    static const float LOD_HYSTERESIS = 0.9f;
+
+    const Vector3 origin = _lodNode->getTranslationWorld();
+    const btVector3 lodOrigin(origin.x, origin.y, origin.z);
+    for (int i = 0; i < _world->getNumCollisionObjects(); i++)
+    {
+        btCollisionObject* collisionObject = _world->getCollisionObjectArray()[i];
+        GP_ASSERT(collisionObject);
+        PhysicsCollisionObject* object = static_cast<PhysicsCollisionObject*>(collisionObject->getUserPointer());
+
+        // Only dynamic rigid bodies and characters are simulated by the world.
+        if (!object || collisionObject->isStaticObject() ||
+            (object->getType() == PhysicsCollisionObject::RIGID_BODY && collisionObject->isKinematicObject()) ||
+            object->getType() == PhysicsCollisionObject::GHOST_OBJECT)
+            continue;
+
+        float distanceSq = collisionObject->getWorldTransform().getOrigin().distance2(lodOrigin);
+        float frozen = _lodFrozenDistance * (object->_lodLevel == PhysicsCollisionObject::LOD_FROZEN ? LOD_HYSTERESIS : 1.0f);
+        float reduced = _lodReducedDistance * (object->_lodLevel != PhysicsCollisionObject::LOD_FULL ? LOD_HYSTERESIS : 1.0f);
+
+        PhysicsCollisionObject::LodLevel level = PhysicsCollisionObject::LOD_FULL;
+        if (_lodFrozenDistance > 0.0f && distanceSq > frozen * frozen)
+            level = PhysicsCollisionObject::LOD_FROZEN;
+        else if (_lodReducedDistance > 0.0f && distanceSq > reduced * reduced)
+            level = PhysicsCollisionObject::LOD_REDUCED;
+
+        if (level != object->_lodLevel)
+            setLodLevel(object, level);
+    }
+}
+
+void PhysicsController::setLodLevel(PhysicsCollisionObject* object, PhysicsCollisionObject::LodLevel level)
+{
+    GP_ASSERT(object);
+
+    PhysicsCollisionObject::LodLevel previous = object->_lodLevel;
+    object->_lodLevel = level;
+    object->_lodTime = 0.0f;
+
+    // Stagger the updates of reduced objects so that they do not all update on the same tick.
+    object->_lodTicks = (unsigned int)(((size_t)object / sizeof(void*)) % _lodReducedRate);
+
+    // Characters and vehicles skip their per-tick update when frozen. Rigid bodies, including
+    // vehicle chassis, are taken out of the simulation with their velocities kept for when they
+    // come back.
+    if (object->getType() != PhysicsCollisionObject::RIGID_BODY || !object->getCollisionObject())
+        return;
+
+    btCollisionObject* collisionObject = object->getCollisionObject();
+    if (level == PhysicsCollisionObject::LOD_FROZEN)
+    {
+        object->_lodActivationState = collisionObject->getActivationState();
+        collisionObject->forceActivationState(DISABLE_SIMULATION);
+    }
+    else if (previous == PhysicsCollisionObject::LOD_FROZEN)
+    {
+        collisionObject->forceActivationState(object->_lodActivationState);
+        if (object->_lodActivationState != ISLAND_SLEEPING)
+            collisionObject->activate(true);
+    }
+}
+
+bool PhysicsController::stepLodAction(PhysicsCollisionObject* object, float timeStep, float* actionTimeStep)
+{
+    GP_ASSERT(object);
+    GP_ASSERT(actionTimeStep);
+
+    switch (object->_lodLevel)
+    {
+    case PhysicsCollisionObject::LOD_FROZEN:
+        return false;
+
+    case PhysicsCollisionObject::LOD_REDUCED:
+        object->_lodTime += timeStep;
+        if (++object->_lodTicks < _lodReducedRate)
+            return false;
+        *actionTimeStep = object->_lodTime;
+        object->_lodTime = 0.0f;
+        object->_lodTicks = 0;
+        return true;
+
+    default:
+        *actionTimeStep = timeStep;
+        return true;
+    }
+}
+
+void PhysicsController::updateKinematicObject(PhysicsCollisionObject* object, bool inWorld)
+{
+    GP_ASSERT(object);
+
+    std::vector<PhysicsCollisionObject*>::iterator itr = std::find(_kinematicObjects.begin(), _kinematicObjects.end(), object);
+    bool tracked = inWorld && object->getCollisionObject() && object->isKinematic();
+    if (tracked && itr == _kinematicObjects.end())
+        _kinematicObjects.push_back(object);
+    else if (!tracked && itr != _kinematicObjects.end())
+        _kinematicObjects.erase(itr);
+}
+
+void PhysicsController::updateTriggerObject(PhysicsCollisionObject* object, bool inWorld)
+{
+    GP_ASSERT(object);
+
+    std::vector<PhysicsGhostObject*>::iterator itr = std::find(_triggerObjects.begin(), _triggerObjects.end(), object);
+    bool tracked = inWorld && object->getType() == PhysicsCollisionObject::GHOST_OBJECT &&
+        static_cast<PhysicsGhostObject*>(object)->_triggerMode != PhysicsGhostObject::TRIGGER_NONE;
+    if (tracked && itr == _triggerObjects.end())
+    {
+        _triggerObjects.push_back(static_cast<PhysicsGhostObject*>(object));
+
+        // The contacts generated for the object before it became a trigger no longer apply.
+        btCollisionObject* collisionObject = object->getCollisionObject();
+        if (collisionObject && collisionObject->getBroadphaseHandle())
+            _world->getBroadphase()->getOverlappingPairCache()->cleanProxyFromPairs(collisionObject->getBroadphaseHandle(), _dispatcher);
+    }
+    else if (!tracked && itr != _triggerObjects.end())
+    {
+        _triggerObjects.erase(itr);
+    }
+}
+
+std::vector<PhysicsController::TiledTerrain*>::iterator PhysicsController::findTiledTerrain(PhysicsCollisionObject* object)
+{
+    std::vector<TiledTerrain*>::iterator itr = _tiledTerrains.begin();
+    for (; itr != _tiledTerrains.end(); ++itr)
+    {
+        if ((*itr)->body == object)
+            break;
+    }
+    return itr;
+}
+
+void PhysicsController::updateTerrainTiles()
+{
+    if (_tiledTerrains.empty())
+        return;
+
+    ++_terrainTileFrame;
+
+    // Drop all tiles of the terrains that were moved or scaled, so they are rebuilt in place.
+    for (size_t i = 0, count = _tiledTerrains.size(); i < count; ++i)
+    {
+        TiledTerrain* terrain = _tiledTerrains[i];
+        const btTransform& transform = terrain->body->_body->getWorldTransform();
+        const btVector3& scale = terrain->body->getCollisionShape()->getShape()->getLocalScaling();
+        if (transform == terrain->transform && scale == terrain->scale)
+            continue;
+
+        for (std::map<unsigned int, TerrainTile>::iterator itr = terrain->tiles.begin(); itr != terrain->tiles.end(); ++itr)
+        {
+            destroyTerrainTile(&itr->second);
+        }
+        terrain->tiles.clear();
+        terrain->transform = transform;
+        terrain->scale = scale;
+    }
+
+    // Build the tiles under every active collision object.
+    btCollisionObjectArray& objects = _world->getCollisionObjectArray();
+    for (int i = 0, count = objects.size(); i < count; ++i)
+    {
+        const btCollisionObject* object = objects[i];
+        const btBroadphaseProxy* proxy = object->getBroadphaseHandle();
+        if (object->isStaticObject() || !object->isActive() || !proxy)
+            continue;
+
+        buildTerrainTiles(proxy->m_aabbMin, proxy->m_aabbMax);
+    }
+
+    // Destroy the tiles that no object has needed for a while.
+    for (size_t i = 0, count = _tiledTerrains.size(); i < count; ++i)
+    {
+        std::map<unsigned int, TerrainTile>& tiles = _tiledTerrains[i]->tiles;
+        for (std::map<unsigned int, TerrainTile>::iterator itr = tiles.begin(); itr != tiles.end();)
+        {
+            if (_terrainTileFrame - itr->second.lastUsed > TERRAIN_TILE_EXPIRY)
+            {
+                destroyTerrainTile(&itr->second);
+                tiles.erase(itr++);
+            }
+            else
+            {
+                ++itr;
+            }
+        }
+    }
+}
+
+void PhysicsController::buildTerrainTiles(const btVector3& aabbMin, const btVector3& aabbMax)
+{
+    for (size_t i = 0, count = _tiledTerrains.size(); i < count; ++i)
+    {
+        buildTerrainTiles(_tiledTerrains[i], aabbMin, aabbMax);
+    }
+}
+
+void PhysicsController::buildTerrainTiles(TiledTerrain* terrain, const btVector3& aabbMin, const btVector3& aabbMax)
+{
+    GP_ASSERT(terrain);
+
+    PhysicsCollisionShape::HeightfieldData* data = terrain->body->getCollisionShape()->_shapeData.heightfieldData;
+    GP_ASSERT(data && data->heightfield);
+    unsigned int columns = data->heightfield->getColumnCount();
+    unsigned int rows = data->heightfield->getRowCount();
+    unsigned int tileSize = terrain->tileSize;
+
+    // Find the heightfield cells under the box, padded by half a tile so tiles are ready before objects reach them.
+    btTransform inverse = terrain->transform.inverse();
+    float minColumn = FLT_MAX, maxColumn = -FLT_MAX;
+    float minRow = FLT_MAX, maxRow = -FLT_MAX;
+    for (int i = 0; i < 8; ++i)
+    {
+        btVector3 corner((i & 1) ? aabbMax.x() : aabbMin.x(), (i & 2) ? aabbMax.y() : aabbMin.y(), (i & 4) ? aabbMax.z() : aabbMin.z());
+        btVector3 local = inverse * corner;
+        float column = local.x() / terrain->scale.x() + (columns - 1) * 0.5f;
+        float row = local.z() / terrain->scale.z() + (rows - 1) * 0.5f;
+        minColumn = std::min(minColumn, column);
+        maxColumn = std::max(maxColumn, column);
+        minRow = std::min(minRow, row);
+        maxRow = std::max(maxRow, row);
+    }
+    float padding = tileSize * 0.5f;
+    minColumn -= padding;
+    maxColumn += padding;
+    minRow -= padding;
+    maxRow += padding;
+    if (maxColumn < 0 || maxRow < 0 || minColumn > columns - 1 || minRow > rows - 1)
+        return;
+
+    unsigned int tileColumns = (columns - 2) / tileSize + 1;
+    unsigned int tileRows = (rows - 2) / tileSize + 1;
+    unsigned int firstColumn = (unsigned int)std::max(minColumn, 0.0f) / tileSize;
+    unsigned int lastColumn = std::min((unsigned int)std::min(maxColumn, (float)(columns - 1)) / tileSize, tileColumns - 1);
+    unsigned int firstRow = (unsigned int)std::max(minRow, 0.0f) / tileSize;
+    unsigned int lastRow = std::min((unsigned int)std::min(maxRow, (float)(rows - 1)) / tileSize, tileRows - 1);
+
+    for (unsigned int row = firstRow; row <= lastRow; ++row)
+    {
+        for (unsigned int column = firstColumn; column <= lastColumn; ++column)
+        {
+            unsigned int key = (row << 16) | column;
+            std::map<unsigned int, TerrainTile>::iterator itr = terrain->tiles.find(key);
+            if (itr == terrain->tiles.end())
+            {
+                itr = terrain->tiles.insert(std::make_pair(key, TerrainTile())).first;
+                createTerrainTile(terrain, row, column, &itr->second);
+            }
+            itr->second.lastUsed = _terrainTileFrame;
+        }
+    }
+}
+
+void PhysicsController::createTerrainTile(TiledTerrain* terrain, unsigned int row, unsigned int column, TerrainTile* tile)
+{
+    GP_ASSERT(terrain);
+    GP_ASSERT(tile);
+    GP_ASSERT(_world);
+
+    PhysicsCollisionShape::HeightfieldData* data = terrain->body->getCollisionShape()->_shapeData.heightfieldData;
+    HeightField* heightfield = data->heightfield;
+    unsigned int columns = heightfield->getColumnCount();
+    unsigned int rows = heightfield->getRowCount();
+    unsigned int column1 = column * terrain->tileSize;
+    unsigned int column2 = std::min(column1 + terrain->tileSize, columns - 1);
+    unsigned int row1 = row * terrain->tileSize;
+    unsigned int row2 = std::min(row1 + terrain->tileSize, rows - 1);
+    unsigned int width = column2 - column1 + 1;
+    unsigned int length = row2 - row1 + 1;
+
+    // Copy the heights of the tile, since Bullet reads a heightfield as one contiguous array.
+    tile->heights = new float[width * length];
+    float minHeight = FLT_MAX, maxHeight = -FLT_MAX;
+    for (unsigned int z = 0; z < length; ++z)
+    {
+        for (unsigned int x = 0; x < width; ++x)
+        {
+            float h = heightfield->getSample(column1 + x, row1 + z);
+            tile->heights[z * width + x] = h;
+            if (h < minHeight)
+                minHeight = h;
+            if (h > maxHeight)
+                maxHeight = h;
+        }
+    }
+
+    btHeightfieldTerrainShape* shape = bullet_new<btHeightfieldTerrainShape>(
+        width, length, tile->heights, 1.0f, minHeight, maxHeight, 1, PHY_FLOAT, false);
+    shape->setLocalScaling(terrain->scale);
+    tile->shape = shape;
+
+    // Bullet centers heightfields on their bodies, so offset the tile from the center of the whole heightfield.
+    const btVector3& scale = terrain->scale;
+    btVector3 offset(((column1 + column2) * 0.5f - (columns - 1) * 0.5f) * scale.x(),
+                     ((minHeight + maxHeight) * 0.5f - (data->minHeight + data->maxHeight) * 0.5f) * scale.y(),
+                     ((row1 + row2) * 0.5f - (rows - 1) * 0.5f) * scale.z());
+    btRigidBody::btRigidBodyConstructionInfo info(0.0f, NULL, shape);
+    info.m_startWorldTransform = terrain->transform;
+    info.m_startWorldTransform.setOrigin(terrain->transform * offset);
+
+    // The tile collides like the terrain rigid body and is reported as it.
+    btRigidBody* source = terrain->body->_body;
+    tile->body = bullet_new<btRigidBody>(info);
+    tile->body->setCollisionFlags(source->getCollisionFlags());
+    tile->body->setFriction(source->getFriction());
+    tile->body->setRestitution(source->getRestitution());
+    tile->body->setUserPointer(terrain->body);
+    _world->addRigidBody(tile->body, (short)terrain->body->_group, (short)terrain->body->_mask);
+}
+
+void PhysicsController::destroyTerrainTile(TerrainTile* tile)
+{
+    GP_ASSERT(tile);
+    GP_ASSERT(_world);
+
+    _world->removeRigidBody(tile->body);
+    SAFE_DELETE(tile->body);
+    SAFE_DELETE(tile->shape);
+    SAFE_DELETE_ARRAY(tile->heights);
+}
+
 PhysicsCollisionObject* PhysicsController::getCollisionObject(const btCollisionObject* collisionObject) const
 {
     // Gameplay collision objects are stored in the userPointer data of Bullet collision objects.
@@ -1022,16 +2262,20 @@ PhysicsCollisionShape* PhysicsController::createHeightfield(Node* node, HeightFi
     GP_ASSERT(heightfield);
     GP_ASSERT(centerOfMassOffset);
 
-    // Inspect the height array for the min and max values
-    float* heights = heightfield->getArray();
+    // Inspect the heights for the min and max values
+    unsigned int columns = heightfield->getColumnCount();
+    unsigned int rows = heightfield->getRowCount();
     float minHeight = FLT_MAX, maxHeight = -FLT_MAX;
-    for (unsigned int i = 0, count = heightfield->getColumnCount()*heightfield->getRowCount(); i < count; ++i)
+    for (unsigned int row = 0; row < rows; ++row)
     {
-        float h = heights[i];
-        if (h < minHeight)
-            minHeight = h;
-        if (h > maxHeight)
-            maxHeight = h;
+        for (unsigned int column = 0; column < columns; ++column)
+        {
+            float h = heightfield->getSample(column, row);
+            if (h < minHeight)
+                minHeight = h;
+            if (h > maxHeight)
+                maxHeight = h;
+        }
     }
 
     // Compute initial heightfield scale by pulling the current world scale out of the node
@@ -1057,10 +2301,31 @@ PhysicsCollisionShape* PhysicsController::createHeightfield(Node* node, HeightFi
     heightfieldData->inverseIsDirty = true;
     heightfieldData->minHeight = minHeight;
     heightfieldData->maxHeight = maxHeight;
+    heightfieldData->samples = NULL;
 
     // Create the bullet terrain shape
-    btHeightfieldTerrainShape* terrainShape = bullet_new<btHeightfieldTerrainShape>(
-        heightfield->getColumnCount(), heightfield->getRowCount(), heightfield->getArray(), 1.0f, minHeight, maxHeight, 1, PHY_FLOAT, false);
+    btHeightfieldTerrainShape* terrainShape;
+    const unsigned short* samples = heightfield->getSampleArray();
+    if (samples)
+    {
+        // Bullet has no unsigned 16-bit heights, so compact heights are copied to signed samples
+        // around the middle of the range. Bullet centers the shape between the min and max sample
+        // heights, which are the heights less a constant bias, so the center of mass offset holds.
+        unsigned int count = columns * rows;
+        heightfieldData->samples = new short[count];
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            heightfieldData->samples[i] = (short)((int)samples[i] - 32768);
+        }
+        float bias = heightfield->getSampleOffset() + 32768.0f * heightfield->getSampleScale();
+        terrainShape = bullet_new<btHeightfieldTerrainShape>(
+            columns, rows, heightfieldData->samples, heightfield->getSampleScale(), minHeight - bias, maxHeight - bias, 1, PHY_SHORT, false);
+    }
+    else
+    {
+        terrainShape = bullet_new<btHeightfieldTerrainShape>(
+            columns, rows, heightfield->getArray(), 1.0f, minHeight, maxHeight, 1, PHY_FLOAT, false);
+    }
 
     // Set initial bullet local scaling for the heightfield
     terrainShape->setLocalScaling(BV(scale));
@@ -1115,6 +2380,33 @@ PhysicsCollisionShape* PhysicsController::createMesh(Mesh* mesh, const Vector3&
         }
     }
 
+    // Dynamic meshes use the convex hull cooked by the encoder when their bundle has one,
+    // which saves reading the whole mesh and building its hull here.
+    if (dynamic)
+    {
+        unsigned int hullVertexCount = 0;
+        float* hullVertices = Bundle::readConvexHull(mesh->getUrl(), &hullVertexCount);
+        if (hullVertices)
+        {
+            for (unsigned int i = 0; i < hullVertexCount; i++)
+            {
+                hullVertices[i * 3 + 0] *= scale.x;
+                hullVertices[i * 3 + 1] *= scale.y;
+                hullVertices[i * 3 + 2] *= scale.z;
+            }
+
+            PhysicsCollisionShape::MeshData* hullMeshData = new PhysicsCollisionShape::MeshData();
+            hullMeshData->vertexData = hullVertices;
+
+            PhysicsCollisionShape* shape = new PhysicsCollisionShape(PhysicsCollisionShape::SHAPE_MESH,
+                bullet_new<btConvexHullShape>(hullVertices, hullVertexCount, sizeof(float) * 3));
+            shape->_shapeData.meshData = hullMeshData;
+            _shapes.push_back(shape);
+
+            return shape;
+        }
+    }
+
     // Read mesh data from URL
     Bundle::MeshData* data = Bundle::readMeshData(mesh->getUrl());
     if (data == NULL)
@@ -1467,6 +2759,16 @@ PhysicsController::HitFilter::HitFilter()
 {
 }
 
+PhysicsController::RayQuery::RayQuery()
+    : distance(0.0f), mask(PHYSICS_COLLISION_MASK_DEFAULT)
+{
+}
+
+PhysicsController::SweepQuery::SweepQuery()
+    : object(NULL), mask(PHYSICS_COLLISION_MASK_DEFAULT)
+{
+}
+
 PhysicsController::HitFilter::~HitFilter()
 {
 }
@@ -12,10 +12,15 @@
 #include "HeightField.h"
 #include "ScriptTarget.h"
 
+class btITaskScheduler;
+class btConstraintSolverPoolMt;
+
 namespace gameplay
 {
 
 class ScriptListener;
+class Stream;
+class PhysicsGhostObject;
 
 /**
  * Defines a class for controlling game physics.
@@ -148,6 +153,58 @@ public:
         virtual bool hit(const HitResult& result);
     };
 
+    /**
+     * Defines a ray test for rayTestBatch.
+     */
+    struct RayQuery
+    {
+        /**
+         * Constructor.
+         */
+        RayQuery();
+
+        /**
+         * The ray to test intersection with.
+         */
+        Ray ray;
+
+        /**
+         * How far along the ray to test for intersections.
+         */
+        float distance;
+
+        /**
+         * The collision groups of the objects to test (all groups by default).
+         */
+        int mask;
+    };
+
+    /**
+     * Defines a sweep test for sweepTestBatch.
+     */
+    struct SweepQuery
+    {
+        /**
+         * Constructor.
+         */
+        SweepQuery();
+
+        /**
+         * The collision object to sweep from its current world position. Its shape must be a box, sphere or capsule.
+         */
+        PhysicsCollisionObject* object;
+
+        /**
+         * The end position of the sweep, in world space.
+         */
+        Vector3 endPosition;
+
+        /**
+         * The collision groups of the objects to test (all groups by default).
+         */
+        int mask;
+    };
+
     /**
      * Extends ScriptTarget::getTypeName() to return the type name of this class.
      *
@@ -301,6 +358,147 @@ public:
      */
     void setGravity(const Vector3& gravity);
 
+    /**
+     * Gets the fixed simulation tick rate, in ticks per second.
+     *
+     * @return The tick rate, or zero if the simulation is stepped with the variable frame time.
+     */
+    float getTickRate() const;
+
+    /**
+     * Sets the fixed simulation tick rate, in ticks per second.
+     *
+     * With a non-zero tick rate the world is always stepped by exactly 1/tickRate seconds,
+     * as many times as needed to catch up with the elapsed game time (but never more than
+     * the maximum number of sub-steps per frame, after which the remaining time is dropped).
+     * Node transforms are then interpolated between the last two simulated states, so
+     * rendering stays smooth independent of the display refresh rate.
+     *
+     * The default of zero keeps stepping with the variable frame time. This can also be set
+     * with the 'tickRate' property of the 'physics' namespace in game.config.
+     *
+     * @param tickRate The tick rate, or zero to step with the variable frame time.
+     */
+    void setTickRate(float tickRate);
+
+    /**
+     * Gets the maximum number of simulation sub-steps performed in a single frame.
+     *
+     * @return The maximum number of sub-steps.
+     */
+    int getMaxSubSteps() const;
+
+    /**
+     * Sets the maximum number of simulation sub-steps performed in a single frame.
+     *
+     * This bounds the cost of the simulation on frame spikes. The default is 10. This can
+     * also be set with the 'maxSubSteps' property of the 'physics' namespace in game.config.
+     *
+     * @param maxSubSteps The maximum number of sub-steps (at least one).
+     */
+    void setMaxSubSteps(int maxSubSteps);
+
+    /**
+     * Gets the number of threads that the simulation is stepped with.
+     *
+     * The world is multi-threaded when the 'threads' property of the 'physics' namespace in
+     * game.config is greater than one, and Bullet is built with BT_THREADSAFE. Collision
+     * detection, constraint solving and integration are then split across the engine job
+     * system, over at most this many threads. The thread count is fixed at initialization.
+     *
+     * @return The number of simulation threads, or one when the world is single-threaded.
+     */
+    unsigned int getThreadCount() const;
+
+    /**
+     * Gets the size of the tiles that static heightfields collide in, in heightfield cells.
+     *
+     * @return The tile size, or zero if static heightfields collide as a whole.
+     */
+    unsigned int getTerrainTileSize() const;
+
+    /**
+     * Sets the size of the tiles that static heightfields collide in, in heightfield cells.
+     *
+     * With a non-zero tile size, a static heightfield rigid body is not added to the world as a
+     * whole. Tiles of its heightfield are instead built wherever an active collision object comes
+     * within half a tile of them, or a ray or sweep test passes over them, and are destroyed once
+     * nothing has needed them for a while. This keeps large terrains out of the broadphase, so only
+     * the few tiles near moving objects are ever tested. Collision events and hit results report
+     * the heightfield rigid body itself for hits on any of its tiles.
+     *
+     * The default of zero adds static heightfields as a whole. The tile size applies to the
+     * heightfield rigid bodies added to the world afterwards. This can also be set with the
+     * 'terrainTileSize' property of the 'physics' namespace in game.config.
+     *
+     * @param tileSize The tile size, or zero to add static heightfields as a whole.
+     */
+    void setTerrainTileSize(unsigned int tileSize);
+
+    /**
+     * Gets the node that physics level of detail distances are measured from.
+     *
+     * @return The level of detail node, or NULL if level of detail is disabled.
+     */
+    Node* getLodNode() const;
+
+    /**
+     * Sets the node that physics level of detail distances are measured from.
+     *
+     * This is typically the node of the active camera or of the player. Each frame, moving
+     * collision objects farther from this node than the reduced distance are simulated at
+     * PhysicsCollisionObject::LOD_REDUCED and those farther than the frozen distance at
+     * PhysicsCollisionObject::LOD_FROZEN. Objects are promoted back once they come within
+     * 90% of these distances, so that objects near a boundary do not switch every frame.
+     *
+     * @param node The level of detail node, or NULL to simulate every object in full.
+     */
+    void setLodNode(Node* node);
+
+    /**
+     * Gets the distance beyond which objects are simulated at a reduced rate.
+     *
+     * @return The reduced distance, or zero if objects are never reduced.
+     */
+    float getLodReducedDistance() const;
+
+    /**
+     * Gets the distance beyond which objects are frozen.
+     *
+     * @return The frozen distance, or zero if objects are never frozen.
+     */
+    float getLodFrozenDistance() const;
+
+    /**
+     * Sets the distances from the level of detail node beyond which objects are reduced and frozen.
+     *
+     * These can also be set with the 'lodReducedDistance' and 'lodFrozenDistance' properties
+     * of the 'physics' namespace in game.config.
+     *
+     * @param reducedDistance The reduced distance, or zero to never reduce objects.
+     * @param frozenDistance The frozen distance, or zero to never freeze objects.
+     */
+    void setLodDistances(float reducedDistance, float frozenDistance);
+
+    /**
+     * Gets the number of simulation ticks over which reduced objects are stepped once.
+     *
+     * @return The reduced rate.
+     */
+    unsigned int getLodReducedRate() const;
+
+    /**
+     * Sets the number of simulation ticks over which reduced objects are stepped once.
+     *
+     * Reduced characters and vehicles run their per-tick update, including the sweeps and wheel
+     * raycasts, once every this many ticks over the time elapsed since their last update. The
+     * default is 4. This can also be set with the 'lodReducedRate' property of the 'physics'
+     * namespace in game.config.
+     *
+     * @param rate The reduced rate (at least one).
+     */
+    void setLodReducedRate(unsigned int rate);
+
     /**
      * Draws debugging information (rigid body outlines, etc.) using the given view projection matrix.
      * 
@@ -341,30 +539,70 @@ public:
      */
     bool sweepTest(PhysicsCollisionObject* object, const Vector3& endPosition, PhysicsController::HitResult* result = NULL, PhysicsController::HitFilter* filter = NULL);
 
-private:
+    /**
+     * Performs many ray tests on the physics world at once.
+     *
+     * The rays are tested in parallel on the job system, directly against the broadphase,
+     * and each result is the closest object hit by the ray among the collision groups of
+     * its query. This is much cheaper than calling rayTest for each ray when issuing many
+     * of them, such as for line of sight checks. The world must not be stepped while the
+     * batch runs.
+     *
+     * @param queries The ray tests to perform.
+     * @param count The number of ray tests.
+     * @param results The array of count results to write to. The object of a result is NULL if its ray hit nothing.
+     *
+     * @return The number of rays that hit an object.
+     */
+    unsigned int rayTestBatch(const RayQuery* queries, unsigned int count, PhysicsController::HitResult* results);
 
     /**
-     * Internal class used to integrate with Bullet collision callbacks.
+     * Performs many sweep tests on the physics world at once.
+     *
+     * The sweeps are tested in parallel on the job system, directly against the broadphase,
+     * and each result is the closest object hit by the sweep among the collision groups of
+     * its query, other than the swept object itself. The world must not be stepped while
+     * the batch runs.
+     *
+     * @param queries The sweep tests to perform.
+     * @param count The number of sweep tests.
+     * @param results The array of count results to write to. The object of a result is NULL if its sweep hit
+     *      nothing, or if the swept object does not have a box, sphere or capsule shape.
+     *
+     * @return The number of sweeps that hit an object.
      */
-    class CollisionCallback : public btCollisionWorld::ContactResultCallback
-    {
-    public:
-        /**
-         * Constructor.
-         * 
-         * @param pc The physics controller that owns the callback.
-         */
-        CollisionCallback(PhysicsController* pc) : _pc(pc) {}
+    unsigned int sweepTestBatch(const SweepQuery* queries, unsigned int count, PhysicsController::HitResult* results);
 
-    protected:
-        /**
-            * Internal function used for Bullet integration (do not use or override).
-            */
-        btScalar addSingleResult(btManifoldPoint& cp, const btCollisionObjectWrapper* a, int partIdA, int indexA, const btCollisionObjectWrapper* b, int partIdB, int indexB);    
+    /**
+     * Writes a binary snapshot of the simulation state of the world to the given stream.
+     *
+     * The snapshot holds the world transform, velocities and activation state of every
+     * non-static collision object in the world, keyed by the id of its node. It can be
+     * restored with loadState() once the same objects have been created again, such as
+     * after reloading the level, or at any time to rewind the simulation.
+     *
+     * @param stream The stream to write to.
+     *
+     * @return true if the snapshot was written, false otherwise.
+     */
+    bool saveState(Stream* stream) const;
 
-    private:
-        PhysicsController* _pc;
-    };
+    /**
+     * Restores a binary snapshot written by saveState() from the given stream.
+     *
+     * Each saved object is matched to the collision object in the world whose node has the
+     * same id, in the order in which they were saved when several nodes share an id. The
+     * matched objects and their nodes are moved to the saved state, while objects that are
+     * not in the snapshot are left as they are. This must not be called while the world
+     * is being stepped.
+     *
+     * @param stream The stream to read from.
+     *
+     * @return true if the snapshot was restored, false otherwise.
+     */
+    bool loadState(Stream* stream);
+
+private:
 
     // Internal constants for the collision status cache.
     static const int DIRTY;
@@ -372,6 +610,25 @@ private:
     static const int REGISTERED;
     static const int REMOVE;
 
+    // A static rigid body with a tile of a heightfield, built while objects are near it.
+    struct TerrainTile
+    {
+        btRigidBody* body;
+        btCollisionShape* shape;
+        float* heights;
+        unsigned int lastUsed;
+    };
+
+    // A static heightfield rigid body that collides through the tiles of its heightfield.
+    struct TiledTerrain
+    {
+        PhysicsRigidBody* body;
+        unsigned int tileSize;
+        btTransform transform;
+        btVector3 scale;
+        std::map<unsigned int, TerrainTile> tiles;
+    };
+
     // Represents the collision listeners and status for a given collision pair (used by the collision status cache).
     struct CollisionInfo
     {
@@ -416,6 +673,69 @@ private:
      */
     void update(float elapsedTime);
 
+    /**
+     * Steps the Bullet simulation without firing any listener callbacks.
+     *
+     * This is safe to call from a worker thread when deferNodeUpdates is true, in which
+     * case node transforms are not written until dispatchEvents() is called.
+     *
+     * @param elapsedTime The elapsed game time.
+     * @param deferNodeUpdates true to defer updating the nodes of moved collision objects.
+     */
+    void stepSimulation(float elapsedTime, bool deferNodeUpdates);
+
+    /**
+     * Applies deferred node transforms and fires status and collision events.
+     *
+     * Must be called on the main thread after each call to stepSimulation().
+     */
+    void dispatchEvents();
+
+    // Updates the nodes of the collision objects moved by the last simulation steps.
+    void updateNodes();
+
+    // Clears the list of motion states moved by the simulation.
+    void clearUpdatedMotionStates();
+
+    // Updates the level of detail of the moving objects from their distance to the level of detail node.
+    void updateLod();
+
+    // Moves the given object to the given level of detail, freezing or unfreezing its simulation.
+    void setLodLevel(PhysicsCollisionObject* object, PhysicsCollisionObject::LodLevel level);
+
+    // Returns whether the per-tick update of the given object runs this tick, and the time step to run it with.
+    bool stepLodAction(PhysicsCollisionObject* object, float timeStep, float* actionTimeStep);
+
+    // Tracks or stops tracking the given object in the list of kinematic objects checked for activity.
+    void updateKinematicObject(PhysicsCollisionObject* object, bool inWorld);
+
+    // Tracks or stops tracking the given object in the list of triggers whose overlaps are reported.
+    void updateTriggerObject(PhysicsCollisionObject* object, bool inWorld);
+
+    // Records a contact between the two given objects, firing the events of the pair when it starts colliding.
+    void addCollision(PhysicsCollisionObject* objectA, PhysicsCollisionObject* objectB, const Vector3& pointA, const Vector3& pointB);
+
+    // Records the objects overlapping the given trigger as contacts with it.
+    void addTriggerCollisions(PhysicsGhostObject* trigger);
+
+    // Builds the terrain tiles near active collision objects and destroys the ones no longer needed.
+    void updateTerrainTiles();
+
+    // Builds the terrain tiles of all tiled terrains that overlap the given world-space box.
+    void buildTerrainTiles(const btVector3& aabbMin, const btVector3& aabbMax);
+
+    // Builds the tiles of the given terrain that overlap the given world-space box.
+    void buildTerrainTiles(TiledTerrain* terrain, const btVector3& aabbMin, const btVector3& aabbMax);
+
+    // Creates the collision of one tile of the given terrain.
+    void createTerrainTile(TiledTerrain* terrain, unsigned int row, unsigned int column, TerrainTile* tile);
+
+    // Removes a terrain tile from the world and destroys it.
+    void destroyTerrainTile(TerrainTile* tile);
+
+    // Finds the tiled terrain of the given collision object, or returns the end of the tiled terrains.
+    std::vector<TiledTerrain*>::iterator findTiledTerrain(PhysicsCollisionObject* object);
+
     // Adds the given collision listener for the two given collision objects.
     void addCollisionListener(PhysicsCollisionObject::CollisionListener* listener, PhysicsCollisionObject* objectA, PhysicsCollisionObject* objectB);
 
@@ -544,6 +864,23 @@ private:
     };
 
     bool _isUpdating;
+    bool _deferNodeUpdates;
+    float _tickRate;
+    int _maxSubSteps;
+    float _timeAccumulator;
+    unsigned int _threadCount;
+    btITaskScheduler* _taskScheduler;
+    btConstraintSolverPoolMt* _solverPool;
+    unsigned int _terrainTileSize;
+    unsigned int _terrainTileFrame;
+    std::vector<TiledTerrain*> _tiledTerrains;
+    Node* _lodNode;
+    float _lodReducedDistance;
+    float _lodFrozenDistance;
+    unsigned int _lodReducedRate;
+    std::vector<PhysicsCollisionObject::PhysicsMotionState*> _updatedMotionStates;
+    std::vector<PhysicsCollisionObject*> _kinematicObjects;
+    std::vector<PhysicsGhostObject*> _triggerObjects;
     btDefaultCollisionConfiguration* _collisionConfiguration;
     btCollisionDispatcher* _dispatcher;
     btBroadphaseInterface* _overlappingPairCache;
@@ -556,7 +893,6 @@ private:
     std::vector<Listener*>* _listeners;
     Vector3 _gravity;
     std::map<PhysicsCollisionObject::CollisionPair, CollisionInfo> _collisionStatus;
-    CollisionCallback* _collisionCallback;
 };
 
 }
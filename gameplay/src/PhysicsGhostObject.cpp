@@ -7,7 +7,7 @@ namespace gameplay
 {
 
 PhysicsGhostObject::PhysicsGhostObject(Node* node, const PhysicsCollisionShape::Definition& shape, int group, int mask)
-    : PhysicsCollisionObject(node, group, mask), _ghostObject(NULL)
+    : PhysicsCollisionObject(node, group, mask), _ghostObject(NULL), _triggerMode(TRIGGER_NONE)
 {
     Vector3 centerOfMassOffset;
     PhysicsController* physicsController = Game::getInstance()->getPhysicsController();
@@ -77,6 +77,23 @@ PhysicsGhostObject* PhysicsGhostObject::create(Node* node, Properties* propertie
     // Create the ghost object.
     PhysicsGhostObject* ghost = new PhysicsGhostObject(node, shape);
 
+    // Load the trigger mode, if any.
+    if (const char* trigger = properties->getString("trigger"))
+    {
+        if (strcmp(trigger, "BROADPHASE") == 0)
+        {
+            ghost->setTriggerMode(TRIGGER_BROADPHASE);
+        }
+        else if (strcmp(trigger, "EXACT") == 0)
+        {
+            ghost->setTriggerMode(TRIGGER_EXACT);
+        }
+        else if (strcmp(trigger, "NONE") != 0)
+        {
+            GP_WARN("Unsupported ghost object trigger mode '%s'; the ghost object is not a trigger.", trigger);
+        }
+    }
+
     return ghost;
 }
 
@@ -85,6 +102,30 @@ PhysicsCollisionObject::Type PhysicsGhostObject::getType() const
     return GHOST_OBJECT;
 }
 
+PhysicsGhostObject::TriggerMode PhysicsGhostObject::getTriggerMode() const
+{
+    return _triggerMode;
+}
+
+void PhysicsGhostObject::setTriggerMode(TriggerMode mode)
+{
+    // Characters resolve their collisions from the contacts of their ghost object.
+    if (getType() != GHOST_OBJECT)
+    {
+        GP_WARN("Only plain ghost objects can be triggers.");
+        return;
+    }
+    if (_triggerMode == mode)
+        return;
+
+    PhysicsController* physicsController = Game::getInstance()->getPhysicsController();
+    GP_ASSERT(physicsController);
+    GP_ASSERT(!physicsController->_isUpdating);
+
+    _triggerMode = mode;
+    physicsController->updateTriggerObject(this, isEnabled());
+}
+
 btCollisionObject* PhysicsGhostObject::getCollisionObject() const
 {
     return _ghostObject;
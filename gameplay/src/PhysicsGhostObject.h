@@ -14,6 +14,14 @@ namespace gameplay
  * It is a collision volume that does not participate in the physics
  * simulation but can be used the test against other phyics collision objects.
  *
+ * A ghost object can also be made a trigger with setTriggerMode(), for volumes that only
+ * need to know what enters and leaves them, such as zones and pickups. No contacts are
+ * generated for the pairs of a trigger while the world is stepped; instead, the objects whose
+ * bounding boxes overlap the trigger's are reported to its collision listeners once per
+ * update, after the contacts of the other objects. Exact triggers test the shapes of only
+ * these pairs. Since contacts are not computed for them, the contact points reported for
+ * broadphase triggers are the center of the overlap of the bounding boxes of the pair.
+ *
  * @see http://gameplay3d.github.io/GamePlay/docs/file-formats.html#wiki-Collision_Objects
  */
 class PhysicsGhostObject : public PhysicsCollisionObject, public Transform::Listener
@@ -23,11 +31,49 @@ class PhysicsGhostObject : public PhysicsCollisionObject, public Transform::List
 
 public:
 
+    /**
+     * Defines how the objects overlapping a ghost object are detected.
+     */
+    enum TriggerMode
+    {
+        /**
+         * The contacts of the ghost object are generated while the world is stepped, as for any other object.
+         */
+        TRIGGER_NONE,
+
+        /**
+         * The ghost object is a trigger overlapped by the objects whose bounding boxes overlap its own.
+         */
+        TRIGGER_BROADPHASE,
+
+        /**
+         * The ghost object is a trigger overlapped by the objects whose bounding boxes overlap its own
+         * and whose shapes touch its shape.
+         */
+        TRIGGER_EXACT
+    };
+
     /**
      * @see PhysicsCollisionObject::getType
      */
     PhysicsCollisionObject::Type getType() const;
 
+    /**
+     * Gets how the objects overlapping this ghost object are detected.
+     *
+     * @return The trigger mode of the ghost object.
+     */
+    TriggerMode getTriggerMode() const;
+
+    /**
+     * Sets how the objects overlapping this ghost object are detected.
+     *
+     * This must not be called while the physics world is being updated.
+     *
+     * @param mode The trigger mode of the ghost object.
+     */
+    void setTriggerMode(TriggerMode mode);
+
     /**
      * Used to synchronize the transform between GamePlay and Bullet.
      */
@@ -71,6 +117,11 @@ protected:
      * Pointer to the Bullet ghost collision object.
      */
     btPairCachingGhostObject* _ghostObject;
+
+    /**
+     * How the objects overlapping the ghost object are detected.
+     */
+    TriggerMode _triggerMode;
 };
 
 }
@@ -270,6 +270,13 @@ void PhysicsRigidBody::setKinematic(bool kinematic)
         _body->setCollisionFlags(_body->getCollisionFlags() & ~btCollisionObject::CF_KINEMATIC_OBJECT);
         _body->setActivationState(ACTIVE_TAG);
     }
+
+    // Kinematic bodies are never synchronized by the simulation, so the controller checks their activity directly.
+    if (isEnabled())
+    {
+        GP_ASSERT(Game::getInstance()->getPhysicsController());
+        Game::getInstance()->getPhysicsController()->updateKinematicObject(this, true);
+    }
 }
 
 void PhysicsRigidBody::setEnabled(bool enable)
@@ -34,6 +34,7 @@ class PhysicsRigidBody : public PhysicsCollisionObject, public Transform::Listen
     friend class PhysicsHingeConstraint;
     friend class PhysicsSocketConstraint;
     friend class PhysicsSpringConstraint;
+    friend class SceneSnapshot;
 
 public:
 
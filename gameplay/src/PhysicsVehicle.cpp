@@ -80,7 +80,7 @@ private:
 };
 
 PhysicsVehicle::PhysicsVehicle(Node* node, const PhysicsCollisionShape::Definition& shape, const PhysicsRigidBody::Parameters& parameters)
-    : PhysicsCollisionObject(node), _speedSmoothed(0)
+    : PhysicsCollisionObject(node), _speedSmoothed(0), _actionInterface(NULL)
 {
     // Note that the constructor for PhysicsRigidBody calls addCollisionObject and so
     // that is where the rigid body gets added to the dynamics world.
@@ -90,7 +90,7 @@ PhysicsVehicle::PhysicsVehicle(Node* node, const PhysicsCollisionShape::Definiti
 }
 
 PhysicsVehicle::PhysicsVehicle(Node* node, PhysicsRigidBody* rigidBody)
-    : PhysicsCollisionObject(node), _speedSmoothed(0)
+    : PhysicsCollisionObject(node), _speedSmoothed(0), _actionInterface(NULL)
 {
     _rigidBody = rigidBody;
 
@@ -186,8 +186,11 @@ void PhysicsVehicle::initialize()
     _vehicleRaycaster = new VehicleNotMeRaycaster(dynamicsWorld, body);
     _vehicle = bullet_new<btRaycastVehicle>(_vehicleTuning, body, _vehicleRaycaster);
     body->setActivationState(DISABLE_DEACTIVATION);
-    dynamicsWorld->addVehicle(_vehicle);
     _vehicle->setCoordinateSystem(0, 1, 2);
+
+    // The vehicle is stepped through our own action so that distant vehicles can skip their wheel raycasts.
+    _actionInterface = new ActionInterface(this);
+    dynamicsWorld->addAction(_actionInterface);
 }
 
 PhysicsVehicle::~PhysicsVehicle()
@@ -195,6 +198,9 @@ PhysicsVehicle::~PhysicsVehicle()
     // Note that the destructor for PhysicsRigidBody calls removeCollisionObject and so
     // that is where the rigid body gets removed from the dynamics world. The vehicle
     // itself is just an action interface in the dynamics world.
+    GP_ASSERT(Game::getInstance()->getPhysicsController() && Game::getInstance()->getPhysicsController()->_world);
+    Game::getInstance()->getPhysicsController()->_world->removeAction(_actionInterface);
+    SAFE_DELETE(_actionInterface);
     SAFE_DELETE(_vehicle);
     SAFE_DELETE(_vehicleRaycaster);
     SAFE_DELETE(_rigidBody);
@@ -458,4 +464,31 @@ void PhysicsVehicle::setDownforce(float downforce)
     _downforce = downforce;
 }
 
+PhysicsVehicle::ActionInterface::ActionInterface(PhysicsVehicle* vehicle) : vehicle(vehicle)
+{
+}
+
+void PhysicsVehicle::ActionInterface::updateAction(btCollisionWorld* collisionWorld, btScalar deltaTimeStep)
+{
+    vehicle->updateAction(collisionWorld, deltaTimeStep);
+}
+
+void PhysicsVehicle::ActionInterface::debugDraw(btIDebugDraw* debugDrawer)
+{
+    GP_ASSERT(vehicle->_vehicle);
+    vehicle->_vehicle->debugDraw(debugDrawer);
+}
+
+void PhysicsVehicle::updateAction(btCollisionWorld* collisionWorld, btScalar deltaTimeStep)
+{
+    GP_ASSERT(_vehicle);
+    GP_ASSERT(_rigidBody);
+
+    // Distant vehicles raycast their wheels less often, over the time since their last update,
+    // and frozen ones not at all.
+    float timeStep;
+    if (Game::getInstance()->getPhysicsController()->stepLodAction(_rigidBody, deltaTimeStep, &timeStep))
+        _vehicle->updateAction(collisionWorld, timeStep);
+}
+
 }
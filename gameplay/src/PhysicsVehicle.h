@@ -367,6 +367,28 @@ private:
      */
     void applyDownforce();
 
+    /**
+     * Hides the callback interfaces within the PhysicsVehicle.
+     * @script{ignore}
+     */
+    class ActionInterface : public btActionInterface
+    {
+    public:
+
+        ActionInterface(PhysicsVehicle* vehicle);
+
+        void updateAction(btCollisionWorld* collisionWorld, btScalar deltaTimeStep);
+
+        void debugDraw(btIDebugDraw* debugDrawer);
+
+        PhysicsVehicle* vehicle;
+    };
+
+    /**
+     * Steps the raycast vehicle, at the rate given by the physics level of detail of the chassis.
+     */
+    void updateAction(btCollisionWorld* collisionWorld, btScalar deltaTimeStep);
+
     float _steeringGain;
     float _brakingForce;
     float _drivingForce;
@@ -384,6 +406,7 @@ private:
     btRaycastVehicle::btVehicleTuning _vehicleTuning;
     btVehicleRaycaster* _vehicleRaycaster;
     btRaycastVehicle* _vehicle;
+    ActionInterface* _actionInterface;
     std::vector<PhysicsVehicleWheel*> _wheels;
 };
 
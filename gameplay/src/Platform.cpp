@@ -4,12 +4,16 @@
 #include "Game.h"
 #include "ScriptController.h"
 #include "Form.h"
+#include "InputRecorder.h"
 
 namespace gameplay
 {
 
 void Platform::touchEventInternal(Touch::TouchEvent evt, int x, int y, unsigned int contactIndex, bool actuallyMouse)
 {
+    if (!InputRecorder::capture(InputRecorder::TOUCH, evt, x, y, contactIndex, actuallyMouse ? 1 : 0))
+        return;
+
     if (actuallyMouse || !Form::touchEventInternal(evt, x, y, contactIndex))
     {
         Game::getInstance()->touchEventInternal(evt, x, y, contactIndex);
@@ -18,6 +22,9 @@ void Platform::touchEventInternal(Touch::TouchEvent evt, int x, int y, unsigned
 
 void Platform::keyEventInternal(Keyboard::KeyEvent evt, int key)
 {
+    if (!InputRecorder::capture(InputRecorder::KEY, evt, key))
+        return;
+
     if (!Form::keyEventInternal(evt, key))
     {
         Game::getInstance()->keyEventInternal(evt, key);
@@ -26,6 +33,9 @@ void Platform::keyEventInternal(Keyboard::KeyEvent evt, int key)
 
 bool Platform::mouseEventInternal(Mouse::MouseEvent evt, int x, int y, int wheelDelta)
 {
+    if (!InputRecorder::capture(InputRecorder::MOUSE, evt, x, y, wheelDelta))
+        return true;
+
     if (Form::mouseEventInternal(evt, x, y, wheelDelta))
         return true;
 
@@ -34,34 +44,62 @@ bool Platform::mouseEventInternal(Mouse::MouseEvent evt, int x, int y, int wheel
 
 void Platform::gestureSwipeEventInternal(int x, int y, int direction)
 {
+    if (!InputRecorder::capture(InputRecorder::GESTURE_SWIPE, x, y, direction))
+        return;
+
     Game::getInstance()->gestureSwipeEventInternal(x, y, direction);
 }
 
 void Platform::gesturePinchEventInternal(int x, int y, float scale)
 {
+    if (!InputRecorder::capture(InputRecorder::GESTURE_PINCH, x, y, 0, 0, 0, scale))
+        return;
+
     Game::getInstance()->gesturePinchEventInternal(x, y, scale);
 }
 
 void Platform::gestureTapEventInternal(int x, int y)
 {
+    if (!InputRecorder::capture(InputRecorder::GESTURE_TAP, x, y))
+        return;
+
     Game::getInstance()->gestureTapEventInternal(x, y);
 }
 
 void Platform::gestureLongTapEventInternal(int x, int y, float duration)
 {
+    if (!InputRecorder::capture(InputRecorder::GESTURE_LONG_TAP, x, y, 0, 0, 0, duration))
+        return;
+
     Game::getInstance()->gestureLongTapEventInternal(x, y, duration);
 }
 
 void Platform::gestureDragEventInternal(int x, int y)
 {
+    if (!InputRecorder::capture(InputRecorder::GESTURE_DRAG, x, y))
+        return;
+
     Game::getInstance()->gestureDragEventInternal(x, y);
 }
 
 void Platform::gestureDropEventInternal(int x, int y)
 {
+    if (!InputRecorder::capture(InputRecorder::GESTURE_DROP, x, y))
+        return;
+
     Game::getInstance()->gestureDropEventInternal(x, y);
 }
 
+void Platform::suspendRenderThreadInternal()
+{
+    Game::getInstance()->setRenderThreadSuspended(true);
+}
+
+void Platform::resumeRenderThreadInternal()
+{
+    Game::getInstance()->setRenderThreadSuspended(false);
+}
+
 void Platform::resizeEventInternal(unsigned int width, unsigned int height)
 {
     Game::getInstance()->resizeEventInternal(width, height);
@@ -70,16 +108,25 @@ void Platform::resizeEventInternal(unsigned int width, unsigned int height)
 
 void Platform::gamepadEventConnectedInternal(GamepadHandle handle,  unsigned int buttonCount, unsigned int joystickCount, unsigned int triggerCount, const char* name)
 {
+    if (!InputRecorder::captureGamepad(InputRecorder::GAMEPAD_CONNECTED, handle, buttonCount, joystickCount, triggerCount, 0.0f, 0.0f, name))
+        return;
+
     Gamepad::add(handle, buttonCount, joystickCount, triggerCount, name);
 }
 
 void Platform::gamepadEventDisconnectedInternal(GamepadHandle handle)
 {
+    if (!InputRecorder::captureGamepad(InputRecorder::GAMEPAD_DISCONNECTED, handle))
+        return;
+
     Gamepad::remove(handle);
 }
 
 void Platform::gamepadButtonPressedEventInternal(GamepadHandle handle, Gamepad::ButtonMapping mapping)
 {
+    if (!InputRecorder::captureGamepad(InputRecorder::GAMEPAD_BUTTON_PRESSED, handle, mapping))
+        return;
+
     Gamepad* gamepad = Gamepad::getGamepad(handle);
     if (gamepad)
     {
@@ -91,6 +138,9 @@ void Platform::gamepadButtonPressedEventInternal(GamepadHandle handle, Gamepad::
 
 void Platform::gamepadButtonReleasedEventInternal(GamepadHandle handle, Gamepad::ButtonMapping mapping)
 {
+    if (!InputRecorder::captureGamepad(InputRecorder::GAMEPAD_BUTTON_RELEASED, handle, mapping))
+        return;
+
     Gamepad* gamepad = Gamepad::getGamepad(handle);
     if (gamepad)
     {
@@ -102,6 +152,9 @@ void Platform::gamepadButtonReleasedEventInternal(GamepadHandle handle, Gamepad:
 
 void Platform::gamepadTriggerChangedEventInternal(GamepadHandle handle, unsigned int index, float value)
 {
+    if (!InputRecorder::captureGamepad(InputRecorder::GAMEPAD_TRIGGER, handle, index, 0, 0, value))
+        return;
+
     Gamepad* gamepad = Gamepad::getGamepad(handle);
     if (gamepad)
     {
@@ -112,6 +165,9 @@ void Platform::gamepadTriggerChangedEventInternal(GamepadHandle handle, unsigned
 
 void Platform::gamepadJoystickChangedEventInternal(GamepadHandle handle, unsigned int index, float x, float y)
 {
+    if (!InputRecorder::captureGamepad(InputRecorder::GAMEPAD_JOYSTICK, handle, index, 0, 0, x, y))
+        return;
+
     Gamepad* gamepad = Gamepad::getGamepad(handle);
     if (gamepad)
     {
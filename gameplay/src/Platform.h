@@ -27,6 +27,8 @@ public:
     friend class Gamepad;
     friend class ScreenDisplayer;
     friend class FileSystem;
+    friend class RenderThread;
+    friend class UploadThread;
 
     /**
      * Destructor.
@@ -63,6 +65,42 @@ public:
 
 private:
 
+    /**
+     * Makes the graphics context current on the calling thread, or releases it from the calling thread.
+     *
+     * A context can only be current on one thread at a time, so it must be released from the
+     * thread it is current on before it is made current on another.
+     *
+     * @param current true to make the context current on the calling thread, false to release it.
+     *
+     * @return false if the platform cannot move its graphics context between threads.
+     */
+    static bool makeContextCurrent(bool current);
+
+    /**
+     * Creates the upload context, a second graphics context that shares its textures, buffers
+     * and programs with the graphics context of the game.
+     *
+     * Called on the thread the graphics context is current on.
+     *
+     * @return false if the platform cannot create a shared graphics context.
+     */
+    static bool createUploadContext();
+
+    /**
+     * Makes the upload context current on the calling thread, or releases it from the calling thread.
+     *
+     * @param current true to make the upload context current on the calling thread, false to release it.
+     *
+     * @return true if successful, false otherwise.
+     */
+    static bool makeUploadContextCurrent(bool current);
+
+    /**
+     * Destroys the upload context, which must not be current on any thread.
+     */
+    static void destroyUploadContext();
+
     /**
      * This method informs the platform that the game is shutting down
      * and anything platform specific should be shutdown as well or halted
@@ -120,6 +158,24 @@ private:
      */
     static void setVsync(bool enable);
 
+    /**
+     * Gets the number of display refreshes between buffer swaps.
+     *
+     * @return The swap interval, where zero means vertical sync is disabled.
+     */
+    static unsigned int getSwapInterval();
+
+    /**
+     * Sets the number of display refreshes between buffer swaps.
+     *
+     * An interval of 1 is the same as enabling vertical sync, while an interval of 2
+     * presents a frame every other refresh (for example, 60 frames per second on a
+     * 120 Hz display). Zero disables vertical sync.
+     *
+     * @param interval The swap interval.
+     */
+    static void setSwapInterval(unsigned int interval);
+
     /**
      * Sleeps synchronously for the given amount of time (in milliseconds).
      *
@@ -283,6 +339,28 @@ private:
      */
     static bool launchURL(const char* url);
 
+    /**
+     * Gets the thermal state of the device.
+     *
+     * @return The thermal state, from 0 (nominal) through 1 (fair) and 2 (serious) to 3 (critical),
+     *      or -1 if the platform does not report it.
+     */
+    static int getThermalState();
+
+    /**
+     * Gets the charge left in the battery of the device.
+     *
+     * @return The charge between 0 and 1, or -1 if the device has no battery or the platform does not report it.
+     */
+    static float getBatteryLevel();
+
+    /**
+     * Determines whether the device is in a low power or battery saver mode.
+     *
+     * @return true if the user or the system asked for power to be saved.
+     */
+    static bool isLowPowerMode();
+
     /**
      * Constructor.
      */
@@ -439,6 +517,23 @@ public:
      */
     static void shutdownInternal();
 
+    /**
+     * Internal method used only from static code in various platform implementation.
+     *
+     * Moves the graphics context back to the calling thread while the render thread is
+     * suspended, such as while the surface of the platform is destroyed and created again.
+     *
+     * @script{ignore}
+     */
+    static void suspendRenderThreadInternal();
+
+    /**
+     * Internal method used only from static code in various platform implementation.
+     *
+     * @script{ignore}
+     */
+    static void resumeRenderThreadInternal();
+
 private:
 
     Game* _game;                // The game this platform is interfacing with.
@@ -12,6 +12,7 @@
 #include <android/sensor.h>
 #include <android_native_app_glue.h>
 #include <android/log.h>
+#include <dlfcn.h>
 
 // Externally referenced global variables.
 struct android_app* __state;
@@ -23,12 +24,17 @@ static EGLDisplay __eglDisplay = EGL_NO_DISPLAY;
 static EGLContext __eglContext = EGL_NO_CONTEXT;
 static EGLSurface __eglSurface = EGL_NO_SURFACE;
 static EGLConfig __eglConfig = 0;
+static EGLContext __eglUploadContext = EGL_NO_CONTEXT;
+static EGLSurface __eglUploadSurface = EGL_NO_SURFACE;
+static bool __thermalResolved = false;
+static void* __thermalManager = NULL;
+static int (*__getCurrentThermalStatus)(void*) = NULL;
 static int __width;
 static int __height;
 static struct timespec __timespec;
 static double __timeStart;
 static double __timeAbsolute;
-static bool __vsync = WINDOW_VSYNC;
+static unsigned int __swapInterval = WINDOW_VSYNC ? 1 : 0;
 static ASensorManager* __sensorManager;
 static ASensorEventQueue* __sensorEventQueue;
 static ASensorEvent __sensorEvent;
@@ -54,6 +60,9 @@ PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays = NULL;
 PFNGLISVERTEXARRAYOESPROC glIsVertexArray = NULL;
 PFNGLMAPBUFFEROESPROC glMapBuffer = NULL;
 PFNGLUNMAPBUFFEROESPROC glUnmapBuffer = NULL;
+PFNGLGETPROGRAMBINARYOESPROC glGetProgramBinary = NULL;
+PFNGLPROGRAMBINARYOESPROC glProgramBinary = NULL;
+PFNGLDISCARDFRAMEBUFFEREXTPROC glDiscardFramebuffer = NULL;
 
 #define GESTURE_TAP_DURATION_MAX			200
 #define GESTURE_LONG_TAP_DURATION_MIN   	GESTURE_TAP_DURATION_MAX
@@ -320,7 +329,7 @@ static bool initEGL()
     __orientationAngle = getRotation() * 90;
     
     // Set vsync.
-    eglSwapInterval(__eglDisplay, WINDOW_VSYNC ? 1 : 0);
+    eglSwapInterval(__eglDisplay, __swapInterval);
     
     // Initialize OpenGL ES extensions.
     __glExtensions = (const char*)glGetString(GL_EXTENSIONS);
@@ -334,6 +343,17 @@ static bool initEGL()
         glMapBuffer = (PFNGLMAPBUFFEROESPROC)eglGetProcAddress("glMapBufferOES");
         glUnmapBuffer = (PFNGLUNMAPBUFFEROESPROC)eglGetProcAddress("glUnmapBufferOES");
     }
+
+    if (strstr(__glExtensions, "GL_OES_get_program_binary"))
+    {
+        glGetProgramBinary = (PFNGLGETPROGRAMBINARYOESPROC)eglGetProcAddress("glGetProgramBinaryOES");
+        glProgramBinary = (PFNGLPROGRAMBINARYOESPROC)eglGetProcAddress("glProgramBinaryOES");
+    }
+
+    if (strstr(__glExtensions, "GL_EXT_discard_framebuffer"))
+    {
+        glDiscardFramebuffer = (PFNGLDISCARDFRAMEBUFFEREXTPROC)eglGetProcAddress("glDiscardFramebufferEXT");
+    }
     
     return true;
     
@@ -1195,14 +1215,20 @@ static void engine_handle_cmd(struct android_app* app, int32_t cmd)
             {
                 initEGL();
                 __initialized = true;
+
+                // Move the context back to the render thread, if the game renders on one.
+                Platform::resumeRenderThreadInternal();
             }
             break;
         case APP_CMD_TERM_WINDOW:
+            // The render thread must be done with the surface before it is destroyed.
+            Platform::suspendRenderThreadInternal();
             destroyEGLSurface();
             __initialized = false;
             break;
         case APP_CMD_DESTROY:
             Game::getInstance()->exit();
+            Platform::suspendRenderThreadInternal();
             destroyEGLMain();
             __initialized = false;
             break;
@@ -1413,7 +1439,7 @@ int Platform::enterMessagePump()
         {
             _game->frame();
 
-            // Post the new frame to the display.
+            // Post the new frame to the display, unless the render thread does while it runs.
             // Note that there are a couple cases where eglSwapBuffers could fail
             // with an error code that requires a certain level of re-initialization:
             //
@@ -1426,7 +1452,7 @@ int Platform::enterMessagePump()
             //    and all OpenGL ES state.
             //
             // For now, if we get these, we'll simply exit.
-            int rc = eglSwapBuffers(__eglDisplay, __eglSurface);
+            int rc = _game->isRenderThreadEnabled() ? EGL_TRUE : eglSwapBuffers(__eglDisplay, __eglSurface);
             if (rc != EGL_TRUE)
             {
                 EGLint error = eglGetError();
@@ -1489,13 +1515,23 @@ void Platform::setAbsoluteTime(double time)
 
 bool Platform::isVsync()
 {
-    return __vsync;
+    return __swapInterval > 0;
 }
 
 void Platform::setVsync(bool enable)
 {
-    eglSwapInterval(__eglDisplay, enable ? 1 : 0);
-    __vsync = enable;
+    setSwapInterval(enable ? 1 : 0);
+}
+
+unsigned int Platform::getSwapInterval()
+{
+    return __swapInterval;
+}
+
+void Platform::setSwapInterval(unsigned int interval)
+{
+    eglSwapInterval(__eglDisplay, interval);
+    __swapInterval = interval;
 }
 
 
@@ -1505,6 +1541,68 @@ void Platform::swapBuffers()
         eglSwapBuffers(__eglDisplay, __eglSurface);
 }
 
+bool Platform::makeContextCurrent(bool current)
+{
+    if (current)
+        return eglMakeCurrent(__eglDisplay, __eglSurface, __eglSurface, __eglContext) == EGL_TRUE;
+    return eglMakeCurrent(__eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) == EGL_TRUE;
+}
+
+bool Platform::createUploadContext()
+{
+    if (__eglDisplay == EGL_NO_DISPLAY || __eglContext == EGL_NO_CONTEXT)
+        return false;
+
+    // The upload context is made current without a surface where EGL allows it, and with a pbuffer of its own otherwise.
+    const char* extensions = eglQueryString(__eglDisplay, EGL_EXTENSIONS);
+    if (!extensions || !strstr(extensions, "EGL_KHR_surfaceless_context"))
+    {
+        const EGLint surfaceAttrs[] =
+        {
+            EGL_WIDTH,  1,
+            EGL_HEIGHT, 1,
+            EGL_NONE
+        };
+        __eglUploadSurface = eglCreatePbufferSurface(__eglDisplay, __eglConfig, surfaceAttrs);
+        if (__eglUploadSurface == EGL_NO_SURFACE)
+            return false;
+    }
+
+    const EGLint contextAttrs[] =
+    {
+        EGL_CONTEXT_CLIENT_VERSION,    2,
+        EGL_NONE
+    };
+    __eglUploadContext = eglCreateContext(__eglDisplay, __eglConfig, __eglContext, contextAttrs);
+    if (__eglUploadContext == EGL_NO_CONTEXT)
+    {
+        destroyUploadContext();
+        return false;
+    }
+    return true;
+}
+
+bool Platform::makeUploadContextCurrent(bool current)
+{
+    if (current)
+        return eglMakeCurrent(__eglDisplay, __eglUploadSurface, __eglUploadSurface, __eglUploadContext) == EGL_TRUE;
+    return eglMakeCurrent(__eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) == EGL_TRUE;
+}
+
+void Platform::destroyUploadContext()
+{
+    // The objects of the display are already gone once it has been terminated.
+    if (__eglDisplay != EGL_NO_DISPLAY)
+    {
+        if (__eglUploadContext != EGL_NO_CONTEXT)
+            eglDestroyContext(__eglDisplay, __eglUploadContext);
+        if (__eglUploadSurface != EGL_NO_SURFACE)
+            eglDestroySurface(__eglDisplay, __eglUploadSurface);
+    }
+    __eglUploadContext = EGL_NO_CONTEXT;
+    __eglUploadSurface = EGL_NO_SURFACE;
+}
+
 void Platform::sleep(long ms)
 {
     usleep(ms * 1000);
@@ -1802,6 +1900,120 @@ bool Platform::launchURL(const char *url)
     return result;
 }
 
+// Gets the JNI environment of the calling thread, attaching the thread to the JVM if it is not yet.
+static JNIEnv* attachCurrentThread(bool* attached)
+{
+    GP_ASSERT(__state && __state->activity && __state->activity->vm);
+    JavaVM* jvm = __state->activity->vm;
+    JNIEnv* env = NULL;
+    *attached = false;
+    if (jvm->GetEnv((void **)&env, JNI_VERSION_1_6) == JNI_EDETACHED)
+    {
+        if (jvm->AttachCurrentThread(&env, NULL) == JNI_ERR)
+            return NULL;
+        *attached = true;
+    }
+    return env;
+}
+
+// Gets a system service of the activity, such as "power" or "batterymanager".
+static jobject getSystemService(JNIEnv* env, const char* name)
+{
+    jclass classContext = env->FindClass("android/content/Context");
+    GP_ASSERT(classContext);
+    jmethodID methodGetSystemService = env->GetMethodID(classContext, "getSystemService", "(Ljava/lang/String;)Ljava/lang/Object;");
+    GP_ASSERT(methodGetSystemService);
+    jstring serviceName = env->NewStringUTF(name);
+    jobject service = env->CallObjectMethod(__state->activity->clazz, methodGetSystemService, serviceName);
+    env->DeleteLocalRef(serviceName);
+    env->DeleteLocalRef(classContext);
+    return service;
+}
+
+int Platform::getThermalState()
+{
+    // The thermal API of the NDK was added in API level 30, so it is looked up at run time.
+    if (!__thermalResolved)
+    {
+        __thermalResolved = true;
+        void* library = dlopen("libandroid.so", RTLD_NOW);
+        if (library)
+        {
+            void* (*acquireManager)() = (void* (*)())dlsym(library, "AThermal_acquireManager");
+            __getCurrentThermalStatus = (int (*)(void*))dlsym(library, "AThermal_getCurrentThermalStatus");
+            if (acquireManager && __getCurrentThermalStatus)
+                __thermalManager = acquireManager();
+        }
+    }
+    if (!__thermalManager)
+        return -1;
+
+    // Light, moderate and severe throttling map to fair, serious and critical, as do the states past severe.
+    const int status = __getCurrentThermalStatus(__thermalManager);
+    return status < 0 ? -1 : std::min(status, 3);
+}
+
+float Platform::getBatteryLevel()
+{
+    bool attached;
+    JNIEnv* env = attachCurrentThread(&attached);
+    if (!env)
+        return -1.0f;
+
+    // BatteryManager.getIntProperty was added in API level 21, and returns a negative value where unsupported.
+    float level = -1.0f;
+    jobject batteryManager = getSystemService(env, "batterymanager");
+    if (batteryManager)
+    {
+        jclass classBatteryManager = env->FindClass("android/os/BatteryManager");
+        jmethodID methodGetIntProperty = classBatteryManager ? env->GetMethodID(classBatteryManager, "getIntProperty", "(I)I") : NULL;
+        if (methodGetIntProperty)
+        {
+            // BatteryManager.BATTERY_PROPERTY_CAPACITY
+            const jint capacity = env->CallIntMethod(batteryManager, methodGetIntProperty, 4);
+            if (capacity >= 0 && capacity <= 100)
+                level = capacity / 100.0f;
+        }
+        if (classBatteryManager)
+            env->DeleteLocalRef(classBatteryManager);
+        env->DeleteLocalRef(batteryManager);
+    }
+    if (env->ExceptionCheck())
+        env->ExceptionClear();
+
+    if (attached)
+        __state->activity->vm->DetachCurrentThread();
+    return level;
+}
+
+bool Platform::isLowPowerMode()
+{
+    bool attached;
+    JNIEnv* env = attachCurrentThread(&attached);
+    if (!env)
+        return false;
+
+    // PowerManager.isPowerSaveMode was added in API level 21.
+    bool lowPower = false;
+    jobject powerManager = getSystemService(env, "power");
+    if (powerManager)
+    {
+        jclass classPowerManager = env->FindClass("android/os/PowerManager");
+        jmethodID methodIsPowerSaveMode = classPowerManager ? env->GetMethodID(classPowerManager, "isPowerSaveMode", "()Z") : NULL;
+        if (methodIsPowerSaveMode)
+            lowPower = env->CallBooleanMethod(powerManager, methodIsPowerSaveMode) == JNI_TRUE;
+        if (classPowerManager)
+            env->DeleteLocalRef(classPowerManager);
+        env->DeleteLocalRef(powerManager);
+    }
+    if (env->ExceptionCheck())
+        env->ExceptionClear();
+
+    if (attached)
+        __state->activity->vm->DetachCurrentThread();
+    return lowPower;
+}
+
 std::string Platform::displayFileDialog(size_t mode, const char* title, const char* filterDescription, const char* filterExtensions, const char* initialDirectory)
 {
     return "";
@@ -13,7 +13,11 @@
 #include <X11/keysym.h>
 #include <sys/time.h>
 #include <GL/glxew.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
 #include <poll.h>
+#include <sys/epoll.h>
+#include <sys/inotify.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -27,6 +31,12 @@
 #define TOUCH_COUNT_MAX     4
 #define MAX_GAMEPADS 4
 
+// The directory whose joystick device nodes are watched for gamepads being plugged in.
+#define GAMEPAD_DEVICE_DIR "/dev/input"
+
+// The most readiness events taken from the gamepad epoll set at once.
+#define GAMEPAD_MAX_EPOLL_EVENTS 8
+
 using namespace std;
 
 int __argc = 0;
@@ -77,12 +87,13 @@ struct ConnectedGamepadDevInfo
     dev_t deviceId;
     gameplay::GamepadHandle fd;
     const GamepadInfoEntry& gamepadInfo;
+    bool pending;
 };
 
 struct timespec __timespec;
 static double __timeStart;
 static double __timeAbsolute;
-static bool __vsync = WINDOW_VSYNC;
+static unsigned int __swapInterval = WINDOW_VSYNC ? 1 : 0;
 static bool __mouseCaptured = false;
 static float __mouseCapturePointX = 0;
 static float __mouseCapturePointY = 0;
@@ -92,8 +103,24 @@ static Display* __display;
 static Window __window;
 static int __windowSize[2];
 static GLXContext __context;
+static XVisualInfo* __visualInfo = NULL;
+static GLXContext __uploadContext = NULL;
 static Atom __atomWmDeleteWindow;
 static list<ConnectedGamepadDevInfo> __connectedGamepads;
+static int __gamepadEpoll = -1;
+static int __gamepadInotify = -1;
+static bool __gamepadsEnumerated = false;
+static bool __headless = false;
+static unsigned int __headlessFrameBudget = 0;
+static double __headlessTimeStep = 0.0;
+static const char* __headlessStatsPath = NULL;
+static vector<float> __headlessFrameTimes;
+static EGLDisplay __eglDisplay = EGL_NO_DISPLAY;
+static EGLSurface __eglSurface = EGL_NO_SURFACE;
+static EGLContext __eglContext = EGL_NO_CONTEXT;
+static EGLConfig __eglConfig = 0;
+static EGLSurface __eglUploadSurface = EGL_NO_SURFACE;
+static EGLContext __eglUploadContext = EGL_NO_CONTEXT;
 
 // Gets the gameplay::Keyboard::Key enumeration constant that corresponds to the given X11 key symbol.
 static gameplay::Keyboard::Key getKey(KeySym sym)
@@ -553,6 +580,159 @@ extern int strcmpnocase(const char* s1, const char* s2)
     return strcasecmp(s1, s2);
 }
 
+// Reads the headless run options from the command line:
+//   --headless              Render offscreen, without a display, and run frames as fast as possible.
+//   --frames=<count>        Exit after this many frames.
+//   --timestep=<ms>         Advance the game time by this much each frame instead of by the real time.
+//   --frame-stats=<path>    Also write the frame time statistics to this file, as JSON.
+static void parseHeadlessArguments()
+{
+    for (int i = 1; i < __argc; ++i)
+    {
+        const char* arg = __argv[i];
+        if (strcmp(arg, "--headless") == 0)
+            __headless = true;
+        else if (strncmp(arg, "--frames=", 9) == 0)
+            __headlessFrameBudget = (unsigned int)strtoul(arg + 9, NULL, 10);
+        else if (strncmp(arg, "--timestep=", 11) == 0)
+            __headlessTimeStep = strtod(arg + 11, NULL);
+        else if (strncmp(arg, "--frame-stats=", 14) == 0)
+            __headlessStatsPath = arg + 14;
+    }
+}
+
+// Creates an offscreen EGL context rendering to a pbuffer, so that no window or X server is needed.
+static bool createHeadlessContext(int width, int height, int samples)
+{
+    // Prefer the surfaceless platform, which needs no window system at all.
+#ifdef EGL_PLATFORM_SURFACELESS_MESA
+    PFNEGLGETPLATFORMDISPLAYEXTPROC eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (eglGetPlatformDisplayEXT)
+        __eglDisplay = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+#endif
+    if (__eglDisplay == EGL_NO_DISPLAY)
+        __eglDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    EGLint majorEGL = 0, minorEGL = 0;
+    if (__eglDisplay == EGL_NO_DISPLAY || !eglInitialize(__eglDisplay, &majorEGL, &minorEGL))
+    {
+        perror("eglInitialize");
+        return false;
+    }
+    printf("EGL version: %d.%d\n", majorEGL, minorEGL);
+
+    if (!eglBindAPI(EGL_OPENGL_API))
+    {
+        perror("eglBindAPI");
+        return false;
+    }
+
+    EGLint configAttribs[] =
+    {
+        EGL_SURFACE_TYPE,    EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE,        8,
+        EGL_GREEN_SIZE,      8,
+        EGL_BLUE_SIZE,       8,
+        EGL_DEPTH_SIZE,      24,
+        EGL_STENCIL_SIZE,    8,
+        EGL_SAMPLE_BUFFERS,  samples > 0 ? 1 : 0,
+        EGL_SAMPLES,         samples,
+        EGL_NONE
+    };
+    __multiSampling = samples > 0;
+
+    EGLConfig config;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(__eglDisplay, configAttribs, &config, 1, &configCount) || configCount == 0)
+    {
+        perror("eglChooseConfig");
+        return false;
+    }
+    __eglConfig = config;
+
+    EGLint surfaceAttribs[] =
+    {
+        EGL_WIDTH,  width,
+        EGL_HEIGHT, height,
+        EGL_NONE
+    };
+    __eglSurface = eglCreatePbufferSurface(__eglDisplay, config, surfaceAttribs);
+    if (__eglSurface == EGL_NO_SURFACE)
+    {
+        perror("eglCreatePbufferSurface");
+        return false;
+    }
+
+    __eglContext = eglCreateContext(__eglDisplay, config, EGL_NO_CONTEXT, NULL);
+    if (__eglContext == EGL_NO_CONTEXT)
+    {
+        perror("eglCreateContext");
+        return false;
+    }
+    eglMakeCurrent(__eglDisplay, __eglSurface, __eglSurface, __eglContext);
+
+    // The GL entry points are loaded before GLEW looks for a GLX display, which an EGL context does not have.
+    glewExperimental = GL_TRUE;
+    GLenum glewStatus = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+    if (glewStatus != GLEW_OK && glewStatus != GLEW_ERROR_NO_GLX_DISPLAY)
+#else
+    if (glewStatus != GLEW_OK)
+#endif
+    {
+        perror("glewInit");
+        return false;
+    }
+
+    // GL Version
+    int versionGL[2] = {-1, -1};
+    glGetIntegerv(GL_MAJOR_VERSION, versionGL);
+    glGetIntegerv(GL_MINOR_VERSION, versionGL + 1);
+    printf("GL version: %d.%d (headless)\n", versionGL[0], versionGL[1]);
+
+    return true;
+}
+
+// Prints the frame time statistics of a headless run, and writes them to the --frame-stats file.
+// Registered with atexit, since Game::exit may end the process without returning from the message pump.
+static void writeHeadlessFrameStats()
+{
+    const size_t count = __headlessFrameTimes.size();
+    if (count == 0)
+        return;
+
+    vector<float> times(__headlessFrameTimes);
+    sort(times.begin(), times.end());
+    double total = 0.0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        total += times[i];
+    }
+    const double mean = total / count;
+    const double median = (count % 2) ? times[count / 2] : (times[count / 2 - 1] + times[count / 2]) * 0.5;
+    const double p95 = times[std::min(count - 1, (size_t)(count * 0.95))];
+    const double p99 = times[std::min(count - 1, (size_t)(count * 0.99))];
+
+    print("Frames: %u in %.1f ms (%.1f fps); frame time min %.3f, mean %.3f, median %.3f, p95 %.3f, p99 %.3f, max %.3f ms\n",
+        (unsigned int)count, total, 1000.0 * count / total, times.front(), mean, median, p95, p99, times.back());
+
+    if (__headlessStatsPath)
+    {
+        FILE* file = fopen(__headlessStatsPath, "w");
+        if (!file)
+        {
+            GP_WARN("Failed to open frame statistics file '%s' for writing.", __headlessStatsPath);
+            return;
+        }
+        fprintf(file, "{\n  \"frames\": %u,\n  \"total_ms\": %f,\n  \"fps\": %f,\n  \"timestep_ms\": %f,\n"
+            "  \"min_ms\": %f,\n  \"mean_ms\": %f,\n  \"median_ms\": %f,\n  \"p95_ms\": %f,\n  \"p99_ms\": %f,\n  \"max_ms\": %f\n}\n",
+            (unsigned int)count, total, 1000.0 * count / total, __headlessTimeStep,
+            (double)times.front(), mean, median, p95, p99, (double)times.back());
+        fclose(file);
+    }
+}
+
 Platform::Platform(Game* game) : _game(game)
 {
 }
@@ -569,12 +749,22 @@ Platform* Platform::create(Game* game)
     FileSystem::setResourcePath("./");
     Platform* platform = new Platform(game);
 
-    // Get the display and initialize
-    __display = XOpenDisplay(NULL);
-    if (__display == NULL)
+    parseHeadlessArguments();
+
+    // Get the display and initialize; headless runs render offscreen and need none.
+    if (!__headless)
     {
-        perror("XOpenDisplay");
-        return NULL;
+        // A render thread presents frames, and an upload thread uploads resources, while this thread handles the events of the display.
+        Properties* graphicsConfig = game->getConfig() ? game->getConfig()->getNamespace("graphics", true) : NULL;
+        if (graphicsConfig && (graphicsConfig->getBool("renderThread") || graphicsConfig->getBool("uploadThread")))
+            XInitThreads();
+
+        __display = XOpenDisplay(NULL);
+        if (__display == NULL)
+        {
+            perror("XOpenDisplay");
+            return NULL;
+        }
     }
 
     // Get the window configuration values
@@ -597,7 +787,7 @@ Platform* Platform::create(Game* game)
             int samples = config->getInt("samples");
             fullscreen = config->getBool("fullscreen");
 
-            if (fullscreen && width == 0 && height == 0)
+            if (fullscreen && width == 0 && height == 0 && __display)
             {
                 // Use the screen resolution if fullscreen is true but width and height were not set in the config
                 int screen_num = DefaultScreen(__display);
@@ -612,6 +802,16 @@ Platform* Platform::create(Game* game)
         }
     }
 
+    if (__headless)
+    {
+        __windowSize[0] = __width;
+        __windowSize[1] = __height;
+        if (!createHeadlessContext(__width, __height, __samples))
+            return NULL;
+        atexit(writeHeadlessFrameStats);
+        return platform;
+    }
+
     // GLX version
     GLint majorGLX, minorGLX = 0;
     glXQueryVersion(__display, &majorGLX, &minorGLX);
@@ -664,6 +864,7 @@ Platform* Platform::create(Game* game)
     // Create the windows
     XVisualInfo* visualInfo;
     visualInfo = glXGetVisualFromFBConfig(__display, configs[0]);
+    __visualInfo = visualInfo;
 
     XSetWindowAttributes winAttribs;
     long eventMask;
@@ -733,9 +934,9 @@ Platform* Platform::create(Game* game)
 
     // TODO: Get this workings
     if (glXSwapIntervalEXT)
-        glXSwapIntervalEXT(__display, __window, __vsync ? 1 : 0);
+        glXSwapIntervalEXT(__display, __window, __swapInterval);
     else if(glXSwapIntervalMESA)
-        glXSwapIntervalMESA(__vsync ? 1 : 0);
+        glXSwapIntervalMESA(__swapInterval);
 
     return platform;
 }
@@ -755,6 +956,21 @@ void cleanupX11()
     }
 }
 
+void cleanupHeadless()
+{
+    if (__eglDisplay != EGL_NO_DISPLAY)
+    {
+        eglMakeCurrent(__eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+        if (__eglContext != EGL_NO_CONTEXT)
+            eglDestroyContext(__eglDisplay, __eglContext);
+        if (__eglSurface != EGL_NO_SURFACE)
+            eglDestroySurface(__eglDisplay, __eglSurface);
+
+        eglTerminate(__eglDisplay);
+    }
+}
+
 double timespec2millis(struct timespec *a)
 {
     GP_ASSERT(a);
@@ -878,8 +1094,20 @@ bool isGamepadDevRegistered(dev_t devId)
     return false;
 }
 
+ConnectedGamepadDevInfo* findGamepad(GamepadHandle handle)
+{
+    for (list<ConnectedGamepadDevInfo>::iterator it = __connectedGamepads.begin(); it != __connectedGamepads.end(); ++it)
+    {
+        if (handle == (*it).fd)
+            return &(*it);
+    }
+    return NULL;
+}
+
 void closeGamepad(const ConnectedGamepadDevInfo& gamepadDevInfo)
 {
+    if (__gamepadEpoll >= 0)
+        epoll_ctl(__gamepadEpoll, EPOLL_CTL_DEL, gamepadDevInfo.fd, NULL);
     ::close(gamepadDevInfo.fd);
 }
 
@@ -901,7 +1129,18 @@ void closeAllGamepads()
     for (list<ConnectedGamepadDevInfo>::iterator it = __connectedGamepads.begin(); it != __connectedGamepads.end(); ++it)
     {
         closeGamepad(*it);
-        __connectedGamepads.erase(it);
+    }
+    __connectedGamepads.clear();
+
+    if (__gamepadInotify >= 0)
+    {
+        ::close(__gamepadInotify);
+        __gamepadInotify = -1;
+    }
+    if (__gamepadEpoll >= 0)
+    {
+        ::close(__gamepadEpoll);
+        __gamepadEpoll = -1;
     }
 }
 
@@ -1037,10 +1276,24 @@ void handleConnectedGamepad(dev_t devId, const char* devPath, const char* sysFSI
 
     // Ignore accelerometer devices that register themselves as joysticks. Ensure they have at least 2 buttons.
     if (btnsNum < 2)
+    {
+        ::close(handle);
         return;
+    }
+
+    if (__gamepadEpoll >= 0)
+    {
+        struct epoll_event event;
+        event.events = EPOLLIN;
+        event.data.fd = handle;
+        if (epoll_ctl(__gamepadEpoll, EPOLL_CTL_ADD, handle, &event) < 0)
+            GP_WARN("Failed to watch the gamepad device '%s' for input.", devPath);
+    }
 
     Platform::gamepadEventConnectedInternal(handle, btnsNum, numJS, numTR, name);
-    ConnectedGamepadDevInfo info = {devId,handle,gpInfo}; 
+
+    // Read the initial state of the buttons and axes on the next poll.
+    ConnectedGamepadDevInfo info = {devId,handle,gpInfo,true};
     __connectedGamepads.push_back(info);
 }
 
@@ -1113,15 +1366,131 @@ void enumGamepads()
     }
 }
 
-void gamepadHandlingLoop()
+void initGamepads()
 {
+    // Input from the gamepads and the creation of joystick device nodes are both waited on
+    // through one epoll set, so that devices are only rescanned and read when they change.
+    __gamepadEpoll = epoll_create1(EPOLL_CLOEXEC);
+    if (__gamepadEpoll >= 0)
+    {
+        __gamepadInotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (__gamepadInotify >= 0)
+        {
+            // Device nodes are created before their permissions are set, so watch both.
+            struct epoll_event event;
+            event.events = EPOLLIN;
+            event.data.fd = __gamepadInotify;
+            if (inotify_add_watch(__gamepadInotify, GAMEPAD_DEVICE_DIR, IN_CREATE | IN_ATTRIB) < 0 ||
+                epoll_ctl(__gamepadEpoll, EPOLL_CTL_ADD, __gamepadInotify, &event) < 0)
+            {
+                ::close(__gamepadInotify);
+                __gamepadInotify = -1;
+            }
+        }
+        if (__gamepadInotify < 0)
+        {
+            ::close(__gamepadEpoll);
+            __gamepadEpoll = -1;
+        }
+    }
+    if (__gamepadEpoll < 0)
+        GP_WARN("Failed to watch for gamepad events, so gamepads are polled every frame.");
+
     enumGamepads();
 }
 
+// Reads the pending notifications of the device directory and returns whether a joystick node changed.
+bool readGamepadDeviceChanges()
+{
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    bool changed = false;
+    ssize_t length;
+    while ((length = read(__gamepadInotify, buffer, sizeof(buffer))) > 0)
+    {
+        for (char* ptr = buffer; ptr < buffer + length; )
+        {
+            const struct inotify_event* event = (const struct inotify_event*)ptr;
+            if (event->len > 0 && strncmp(event->name, "js", 2) == 0)
+                changed = true;
+            ptr += sizeof(struct inotify_event) + event->len;
+        }
+    }
+    return changed;
+}
+
+void gamepadHandlingLoop()
+{
+    if (__gamepadEpoll < 0)
+    {
+        // Rescan the devices and read every gamepad.
+        enumGamepads();
+        for (list<ConnectedGamepadDevInfo>::iterator it = __connectedGamepads.begin(); it != __connectedGamepads.end(); ++it)
+            it->pending = true;
+        return;
+    }
+
+    struct epoll_event events[GAMEPAD_MAX_EPOLL_EVENTS];
+    int count = epoll_wait(__gamepadEpoll, events, GAMEPAD_MAX_EPOLL_EVENTS, 0);
+    bool rescan = false;
+    for (int i = 0; i < count; ++i)
+    {
+        if (events[i].data.fd == __gamepadInotify)
+        {
+            rescan = readGamepadDeviceChanges() || rescan;
+        }
+        else
+        {
+            // Errors and hang ups are flagged too, so that the read notices the disconnection.
+            ConnectedGamepadDevInfo* info = findGamepad(events[i].data.fd);
+            if (info)
+                info->pending = true;
+        }
+    }
+    if (rescan)
+        enumGamepads();
+}
+
 int Platform::enterMessagePump()
 {
     GP_ASSERT(_game);
 
+    if (__headless)
+    {
+        // Get the initial time.
+        clock_gettime(CLOCK_REALTIME, &__timespec);
+        __timeStart = timespec2millis(&__timespec);
+        __timeAbsolute = 0L;
+
+        // Run the game without a window, as fast as it goes, until it exits or the frame budget is spent.
+        _game->run();
+        bool exiting = false;
+        while (_game->getState() != Game::UNINITIALIZED)
+        {
+            if (!exiting && __headlessFrameBudget > 0 && __headlessFrameTimes.size() >= __headlessFrameBudget)
+            {
+                // Game::exit may only schedule the shutdown, which then happens during the next frame.
+                exiting = true;
+                _game->exit();
+                continue;
+            }
+
+            struct timespec frameStart, frameEnd;
+            clock_gettime(CLOCK_MONOTONIC, &frameStart);
+            _game->frame();
+            if (!_game->isRenderThreadEnabled())
+                eglSwapBuffers(__eglDisplay, __eglSurface);
+            clock_gettime(CLOCK_MONOTONIC, &frameEnd);
+            if (!exiting)
+                __headlessFrameTimes.push_back((float)(timespec2millis(&frameEnd) - timespec2millis(&frameStart)));
+
+            if (__headlessTimeStep > 0.0)
+                __timeAbsolute += __headlessTimeStep;
+        }
+
+        cleanupHeadless();
+        return 0;
+    }
+
     updateWindowSize();
 
     static bool shiftDown = false;
@@ -1136,17 +1505,22 @@ int Platform::enterMessagePump()
     // Run the game.
     _game->run();
 
+    initGamepads();
+
     // Setup select for message handling (to allow non-blocking)
     int x11_fd = ConnectionNumber(__display);
 
-    pollfd xpolls[1];
+    // Gamepad input wakes the loop as well. A negative descriptor is ignored by poll.
+    pollfd xpolls[2];
     xpolls[0].fd = x11_fd;
     xpolls[0].events = POLLIN|POLLPRI;
+    xpolls[1].fd = __gamepadEpoll;
+    xpolls[1].events = POLLIN;
 
     // Message loop.
     while (true)
     {
-        poll( xpolls, 1, 16 );
+        poll( xpolls, 2, 16 );
         // handle all pending events in one block
         while (XPending(__display))
         {
@@ -1333,7 +1707,9 @@ int Platform::enterMessagePump()
             _game->frame();
         }
 
-        glXSwapBuffers(__display, __window);
+        // The render thread presents the frames while it runs.
+        if (!_game->isRenderThreadEnabled())
+            glXSwapBuffers(__display, __window);
     }
 
     cleanupX11();
@@ -1362,6 +1738,9 @@ unsigned int Platform::getDisplayHeight()
 
 double Platform::getAbsoluteTime()
 {
+    // Headless runs with a fixed timestep advance the time once per frame instead.
+    if (__headless && __headlessTimeStep > 0.0)
+        return __timeAbsolute;
 
     clock_gettime(CLOCK_REALTIME, &__timespec);
     double now = timespec2millis(&__timespec);
@@ -1377,22 +1756,116 @@ void Platform::setAbsoluteTime(double time)
 
 bool Platform::isVsync()
 {
-    return __vsync;
+    return __swapInterval > 0;
 }
 
 void Platform::setVsync(bool enable)
 {
-    __vsync = enable;
+    setSwapInterval(enable ? 1 : 0);
+}
 
-    if (glXSwapIntervalEXT)
-        glXSwapIntervalEXT(__display, __window, __vsync ? 1 : 0);
+unsigned int Platform::getSwapInterval()
+{
+    return __swapInterval;
+}
+
+void Platform::setSwapInterval(unsigned int interval)
+{
+    __swapInterval = interval;
+
+    if (__headless)
+        eglSwapInterval(__eglDisplay, __swapInterval);
+    else if (glXSwapIntervalEXT)
+        glXSwapIntervalEXT(__display, __window, __swapInterval);
     else if(glXSwapIntervalMESA)
-        glXSwapIntervalMESA(__vsync ? 1 : 0);
+        glXSwapIntervalMESA(__swapInterval);
 }
 
 void Platform::swapBuffers()
 {
-    glXSwapBuffers(__display, __window);
+    if (__headless)
+        eglSwapBuffers(__eglDisplay, __eglSurface);
+    else
+        glXSwapBuffers(__display, __window);
+}
+
+bool Platform::makeContextCurrent(bool current)
+{
+    if (__headless)
+    {
+        // The rendering API is bound per thread, and contexts are made current for the bound API.
+        if (current)
+            return eglBindAPI(EGL_OPENGL_API) && eglMakeCurrent(__eglDisplay, __eglSurface, __eglSurface, __eglContext) == EGL_TRUE;
+        return eglMakeCurrent(__eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) == EGL_TRUE;
+    }
+
+    if (current)
+        return glXMakeCurrent(__display, __window, __context) == True;
+    return glXMakeCurrent(__display, None, NULL) == True;
+}
+
+bool Platform::createUploadContext()
+{
+    if (__headless)
+    {
+        // EGL surfaces can only be current on one thread, so the upload context gets a pbuffer of its own.
+        EGLint surfaceAttribs[] =
+        {
+            EGL_WIDTH,  1,
+            EGL_HEIGHT, 1,
+            EGL_NONE
+        };
+        __eglUploadSurface = eglCreatePbufferSurface(__eglDisplay, __eglConfig, surfaceAttribs);
+        if (__eglUploadSurface == EGL_NO_SURFACE)
+            return false;
+        __eglUploadContext = eglCreateContext(__eglDisplay, __eglConfig, __eglContext, NULL);
+        if (__eglUploadContext == EGL_NO_CONTEXT)
+        {
+            eglDestroySurface(__eglDisplay, __eglUploadSurface);
+            __eglUploadSurface = EGL_NO_SURFACE;
+            return false;
+        }
+        return true;
+    }
+
+    // The upload context never draws to the window, it only needs a drawable to be made current with.
+    if (!__visualInfo)
+        return false;
+    __uploadContext = glXCreateContext(__display, __visualInfo, __context, True);
+    return __uploadContext != NULL;
+}
+
+bool Platform::makeUploadContextCurrent(bool current)
+{
+    if (__headless)
+    {
+        if (current)
+            return eglBindAPI(EGL_OPENGL_API) && eglMakeCurrent(__eglDisplay, __eglUploadSurface, __eglUploadSurface, __eglUploadContext) == EGL_TRUE;
+        return eglMakeCurrent(__eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) == EGL_TRUE;
+    }
+
+    if (current)
+        return glXMakeCurrent(__display, __window, __uploadContext) == True;
+    return glXMakeCurrent(__display, None, NULL) == True;
+}
+
+void Platform::destroyUploadContext()
+{
+    if (__eglUploadContext != EGL_NO_CONTEXT)
+    {
+        eglDestroyContext(__eglDisplay, __eglUploadContext);
+        __eglUploadContext = EGL_NO_CONTEXT;
+    }
+    if (__eglUploadSurface != EGL_NO_SURFACE)
+    {
+        eglDestroySurface(__eglDisplay, __eglUploadSurface);
+        __eglUploadSurface = EGL_NO_SURFACE;
+    }
+    if (__uploadContext)
+    {
+        glXDestroyContext(__display, __uploadContext);
+        __uploadContext = NULL;
+    }
 }
 
 void Platform::sleep(long ms)
@@ -1488,7 +1961,7 @@ bool Platform::hasMouse()
 
 void Platform::setMouseCaptured(bool captured)
 {
-    if (captured != __mouseCaptured)
+    if (captured != __mouseCaptured && !__headless)
     {
         if (captured)
         {
@@ -1517,7 +1990,7 @@ bool Platform::isMouseCaptured()
 
 void Platform::setCursorVisible(bool visible)
 {
-    if (visible != __cursorVisible)
+    if (visible != __cursorVisible && !__headless)
     {
         if (visible==false)
         {
@@ -1580,10 +2053,16 @@ void Platform::pollGamepadState(Gamepad* gamepad)
 {
     GP_ASSERT(gamepad);
 
+    // Only read the gamepads that the message pump saw input from.
+    ConnectedGamepadDevInfo* devInfo = findGamepad(gamepad->_handle);
+    if (devInfo && !devInfo->pending)
+        return;
+
     struct js_event jevent;
     const GamepadInfoEntry& gpInfo = getGamepadMappedInfo(gamepad->_handle);
 
-    while (read(gamepad->_handle, &jevent, sizeof(struct js_event)) > 0)
+    ssize_t length;
+    while ((length = read(gamepad->_handle, &jevent, sizeof(struct js_event))) > 0)
     {
         switch (jevent.type)
         {
@@ -1656,11 +2135,15 @@ void Platform::pollGamepadState(Gamepad* gamepad)
                 GP_WARN("unhandled gamepad event: %x\n", jevent.type);
         }
     }
-    if(errno == ENODEV)
+    if (length < 0 && errno == ENODEV)
     {
         unregisterGamepad(gamepad->_handle);
         gamepadEventDisconnectedInternal(gamepad->_handle);
     }
+    else if (devInfo && length < 0 && errno == EAGAIN)
+    {
+        devInfo->pending = false;
+    }
 }
 
 bool Platform::launchURL(const char* url)
@@ -1678,6 +2161,29 @@ bool Platform::launchURL(const char* url)
     return (r == 0);
 }
 
+int Platform::getThermalState()
+{
+    return -1;
+}
+
+float Platform::getBatteryLevel()
+{
+    FILE* file = fopen("/sys/class/power_supply/BAT0/capacity", "r");
+    if (!file)
+        return -1.0f;
+
+    int capacity = -1;
+    if (fscanf(file, "%d", &capacity) != 1)
+        capacity = -1;
+    fclose(file);
+    return capacity >= 0 ? std::min(capacity, 100) / 100.0f : -1.0f;
+}
+
+bool Platform::isLowPowerMode()
+{
+    return false;
+}
+
 std::string Platform::displayFileDialog(size_t mode, const char* title, const char* filterDescription, const char* filterExtensions, const char* initialDirectory)
 {
     std::string filename = "";
@@ -40,7 +40,7 @@ static int __height = 720;
 
 static double __timeStart;
 static double __timeAbsolute;
-static bool __vsync = WINDOW_VSYNC;
+static unsigned int __swapInterval = WINDOW_VSYNC ? 1 : 0;
 static bool __hasMouse = false;
 static bool __leftMouseDown = false;
 static bool __rightMouseDown = false;
@@ -922,7 +922,7 @@ static CVReturn MyDisplayLinkCallback(CVDisplayLinkRef displayLink, const CVTime
     // Make all the OpenGL calls to setup rendering and build the necessary rendering objects
     [[self openGLContext] makeCurrentContext];
     // Synchronize buffer swaps with vertical refresh rate
-    GLint swapInt = __vsync ? 1 : 0;
+    GLint swapInt = __swapInterval;
     [[self openGLContext] setValues:&swapInt forParameter:NSOpenGLCPSwapInterval];
     
     // Create a display link capable of being used with all active displays
@@ -1788,13 +1788,23 @@ void Platform::setAbsoluteTime(double time)
 
 bool Platform::isVsync()
 {
-    return __vsync;
+    return __swapInterval > 0;
 }
 
 void Platform::setVsync(bool enable)
 {
-    __vsync = enable;
-    GLint swapInt = enable ? 1 : 0;
+    setSwapInterval(enable ? 1 : 0);
+}
+
+unsigned int Platform::getSwapInterval()
+{
+    return __swapInterval;
+}
+
+void Platform::setSwapInterval(unsigned int interval)
+{
+    __swapInterval = interval;
+    GLint swapInt = interval;
     [[__view openGLContext] setValues:&swapInt forParameter:NSOpenGLCPSwapInterval];
 }
 
@@ -1804,6 +1814,27 @@ void Platform::swapBuffers()
         CGLFlushDrawable((CGLContextObj)[[__view openGLContext] CGLContextObj]);
 }
 
+bool Platform::makeContextCurrent(bool current)
+{
+    // The display link renders the frames on a thread of its own.
+    return false;
+}
+
+bool Platform::createUploadContext()
+{
+    // Resources are uploaded on the thread of the display link.
+    return false;
+}
+
+bool Platform::makeUploadContextCurrent(bool current)
+{
+    return false;
+}
+
+void Platform::destroyUploadContext()
+{
+}
+
 void Platform::sleep(long ms)
 {
     usleep(ms * 1000);
@@ -2299,6 +2330,26 @@ bool Platform::launchURL(const char *url)
     return (err == noErr);
 }
 
+int Platform::getThermalState()
+{
+    // The thermal states of NSProcessInfo, added in OS X 10.10.3, run from nominal to critical.
+    NSProcessInfo* processInfo = [NSProcessInfo processInfo];
+    if (![processInfo respondsToSelector:@selector(thermalState)])
+        return -1;
+    return (int)[processInfo thermalState];
+}
+
+float Platform::getBatteryLevel()
+{
+    return -1.0f;
+}
+
+bool Platform::isLowPowerMode()
+{
+    NSProcessInfo* processInfo = [NSProcessInfo processInfo];
+    return [processInfo respondsToSelector:@selector(isLowPowerModeEnabled)] && [processInfo isLowPowerModeEnabled];
+}
+
 NSString* getAbsolutePath(const char* path)
 {
     NSString* bundlePathStr = [[[NSBundle mainBundle] bundlePath] stringByAppendingString:@"/Contents/Resources"];
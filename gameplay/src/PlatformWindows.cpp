@@ -28,11 +28,12 @@ using gameplay::print;
 static double __timeTicksPerMillis;
 static double __timeStart;
 static double __timeAbsolute;
-static bool __vsync = WINDOW_VSYNC;
+static unsigned int __swapInterval = WINDOW_VSYNC ? 1 : 0;
 static HINSTANCE __hinstance = 0;
 static HWND __hwnd = 0;
 static HDC __hdc = 0;
 static HGLRC __hrc = 0;
+static HGLRC __uploadContext = 0;
 static bool __mouseCaptured = false;
 static POINT __mouseCapturePoint = { 0, 0 };
 static bool __multiSampling = false;
@@ -762,9 +763,9 @@ bool initializeGL(WindowCreationParams* params)
 
     // Vertical sync.
     if (wglSwapIntervalEXT) 
-        wglSwapIntervalEXT(__vsync ? 1 : 0);
+        wglSwapIntervalEXT(__swapInterval);
     else 
-        __vsync = false;
+        __swapInterval = 0;
 
     // Some old graphics cards support EXT_framebuffer_object instead of ARB_framebuffer_object.
     // Patch ARB_framebuffer_object functions to EXT_framebuffer_object ones since semantic is same.
@@ -1021,7 +1022,10 @@ int Platform::enterMessagePump()
             }
 #endif
             _game->frame();
-            SwapBuffers(__hdc);
+
+            // The render thread presents the frames while it runs.
+            if (!_game->isRenderThreadEnabled())
+                SwapBuffers(__hdc);
         }
 
         // If we are done, then exit.
@@ -1072,17 +1076,27 @@ void Platform::setAbsoluteTime(double time)
 
 bool Platform::isVsync()
 {
-    return __vsync;
+    return __swapInterval > 0;
 }
 
 void Platform::setVsync(bool enable)
 {
-    __vsync = enable;
+    setSwapInterval(enable ? 1 : 0);
+}
+
+unsigned int Platform::getSwapInterval()
+{
+    return __swapInterval;
+}
+
+void Platform::setSwapInterval(unsigned int interval)
+{
+    __swapInterval = interval;
 
     if (wglSwapIntervalEXT) 
-        wglSwapIntervalEXT(__vsync ? 1 : 0);
+        wglSwapIntervalEXT(__swapInterval);
     else 
-        __vsync = false;
+        __swapInterval = 0;
 }
 
 void Platform::swapBuffers()
@@ -1091,6 +1105,54 @@ void Platform::swapBuffers()
         SwapBuffers(__hdc);
 }
 
+bool Platform::makeContextCurrent(bool current)
+{
+    if (current)
+        return wglMakeCurrent(__hdc, __hrc) == TRUE;
+    return wglMakeCurrent(NULL, NULL) == TRUE;
+}
+
+bool Platform::createUploadContext()
+{
+    // The window's device context can be current with a context on each thread.
+    if (wglCreateContextAttribsARB)
+    {
+        int attribs[] =
+        {
+            WGL_CONTEXT_MAJOR_VERSION_ARB, 3,
+            WGL_CONTEXT_MINOR_VERSION_ARB, 1,
+            0
+        };
+        __uploadContext = wglCreateContextAttribsARB(__hdc, __hrc, attribs);
+    }
+    else
+    {
+        __uploadContext = wglCreateContext(__hdc);
+        if (__uploadContext && !wglShareLists(__hrc, __uploadContext))
+        {
+            wglDeleteContext(__uploadContext);
+            __uploadContext = 0;
+        }
+    }
+    return __uploadContext != 0;
+}
+
+bool Platform::makeUploadContextCurrent(bool current)
+{
+    if (current)
+        return wglMakeCurrent(__hdc, __uploadContext) == TRUE;
+    return wglMakeCurrent(NULL, NULL) == TRUE;
+}
+
+void Platform::destroyUploadContext()
+{
+    if (__uploadContext)
+    {
+        wglDeleteContext(__uploadContext);
+        __uploadContext = 0;
+    }
+}
+
 void Platform::sleep(long ms)
 {
     Sleep(ms);
@@ -1367,6 +1429,25 @@ bool Platform::launchURL(const char* url)
     return (r > 32);
 }
 
+int Platform::getThermalState()
+{
+    return -1;
+}
+
+float Platform::getBatteryLevel()
+{
+    // A percentage of 255 is unknown, and desktops report a battery flag of 128.
+    SYSTEM_POWER_STATUS status;
+    if (!GetSystemPowerStatus(&status) || status.BatteryLifePercent > 100 || (status.BatteryFlag & 128))
+        return -1.0f;
+    return status.BatteryLifePercent / 100.0f;
+}
+
+bool Platform::isLowPowerMode()
+{
+    return false;
+}
+
 std::string Platform::displayFileDialog(size_t mode, const char* title, const char* filterDescription, const char* filterExtensions, const char* initialDirectory)
 {
     std::string filename;
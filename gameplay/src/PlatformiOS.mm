@@ -7,6 +7,7 @@
 #include "Game.h"
 #include "Form.h"
 #include "ScriptController.h"
+#include "ResourceManager.h"
 #include <unistd.h>
 #include <sys/time.h>
 #import <UIKit/UIKit.h>
@@ -76,7 +77,7 @@ static TouchPoint __touchPoints[TOUCH_POINTS_MAX];
 
 static double __timeStart;
 static double __timeAbsolute;
-static bool __vsync = WINDOW_VSYNC;
+static unsigned int __swapInterval = WINDOW_VSYNC ? 1 : 0;
 static float __pitch;
 static float __roll;
 
@@ -903,6 +904,9 @@ int getUnicode(int key);
 - (void)didReceiveMemoryWarning
 {
     [super didReceiveMemoryWarning];
+
+    // Give up the resources that only the caches are keeping alive.
+    ResourceManager::releaseUnused();
 }
 
 #pragma mark - View lifecycle
@@ -1555,12 +1559,24 @@ void Platform::setAbsoluteTime(double time)
 
 bool Platform::isVsync()
 {
-    return __vsync;
+    return __swapInterval > 0;
 }
 
 void Platform::setVsync(bool enable)
 {
-    __vsync = enable;
+    setSwapInterval(enable ? 1 : 0);
+}
+
+unsigned int Platform::getSwapInterval()
+{
+    return __swapInterval;
+}
+
+void Platform::setSwapInterval(unsigned int interval)
+{
+    // The display link always waits for the display, so an interval of zero still draws every refresh.
+    __swapInterval = interval;
+    [__view setSwapInterval:std::max(interval, 1u)];
 }
 
 void Platform::swapBuffers()
@@ -1568,6 +1584,28 @@ void Platform::swapBuffers()
     if (__view)
         [__view swapBuffers];
 }
+
+bool Platform::makeContextCurrent(bool current)
+{
+    // The display link drives the frames from the main run loop, which owns the context.
+    return false;
+}
+
+bool Platform::createUploadContext()
+{
+    // Resources are uploaded from the main run loop, which owns the context.
+    return false;
+}
+
+bool Platform::makeUploadContextCurrent(bool current)
+{
+    return false;
+}
+
+void Platform::destroyUploadContext()
+{
+}
+
 void Platform::sleep(long ms)
 {
     usleep(ms * 1000);
@@ -1723,6 +1761,30 @@ bool Platform::launchURL(const char *url)
     return [[UIApplication sharedApplication] openURL:[NSURL URLWithString:[NSString stringWithUTF8String: url]]];
 }
 
+int Platform::getThermalState()
+{
+    // The thermal states of NSProcessInfo, added in iOS 11, run from nominal to critical.
+    NSProcessInfo* processInfo = [NSProcessInfo processInfo];
+    if (![processInfo respondsToSelector:@selector(thermalState)])
+        return -1;
+    return (int)[processInfo thermalState];
+}
+
+float Platform::getBatteryLevel()
+{
+    // The battery level is -1 until battery monitoring is enabled.
+    UIDevice* device = [UIDevice currentDevice];
+    if (![device isBatteryMonitoringEnabled])
+        [device setBatteryMonitoringEnabled:YES];
+    return [device batteryLevel];
+}
+
+bool Platform::isLowPowerMode()
+{
+    NSProcessInfo* processInfo = [NSProcessInfo processInfo];
+    return [processInfo respondsToSelector:@selector(isLowPowerModeEnabled)] && [processInfo isLowPowerModeEnabled];
+}
+
 std::string Platform::displayFileDialog(size_t mode, const char* title, const char* filterDescription, const char* filterExtensions, const char* initialDirectory)
 {
     return "";
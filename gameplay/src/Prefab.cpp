@@ -0,0 +1,225 @@
+#include "Base.h"
+#include "Prefab.h"
+#include "Node.h"
+#include "Joint.h"
+#include "Model.h"
+#include "MeshSkin.h"
+#include "Material.h"
+
+namespace gameplay
+{
+
+Prefab::Prefab(Node* node)
+    : _node(node)
+{
+    GP_ASSERT(node);
+    node->addRef();
+
+    std::map<const Node*, int> entries;
+    addEntry(node, -1, entries);
+
+    // Skins refer to the entries of their joints, so they are remapped by index when instantiated.
+    for (unsigned int i = 0, count = (unsigned int)_entries.size(); i < count; ++i)
+    {
+        Model* model = dynamic_cast<Model*>(_entries[i].node->getDrawable());
+        MeshSkin* skin = model ? model->getSkin() : NULL;
+        if (!skin || !skin->_rootNode || !skin->_rootJoint)
+            continue;
+
+        std::map<const Node*, int>::const_iterator rootNode = entries.find(skin->_rootNode);
+        if (rootNode == entries.end())
+            continue;
+
+        Skin entry;
+        entry.entry = i;
+        entry.rootNode = rootNode->second;
+        std::map<const Node*, int>::const_iterator rootJoint = entries.find(skin->_rootJoint);
+        GP_ASSERT(rootJoint != entries.end());
+        entry.rootJoint = rootJoint->second;
+        entry.joints.resize(skin->getJointCount());
+        for (unsigned int j = 0, jointCount = skin->getJointCount(); j < jointCount; ++j)
+        {
+            std::map<const Node*, int>::const_iterator joint = entries.find(skin->getJoint(j));
+            GP_ASSERT(joint != entries.end());
+            entry.joints[j] = joint->second;
+        }
+        _skins.push_back(entry);
+    }
+}
+
+Prefab::~Prefab()
+{
+    SAFE_RELEASE(_node);
+}
+
+Prefab* Prefab::create(Node* node)
+{
+    GP_ASSERT(node);
+    return new Prefab(node);
+}
+
+Node* Prefab::getNode() const
+{
+    return _node;
+}
+
+void Prefab::addEntry(Node* node, int parent, std::map<const Node*, int>& entries)
+{
+    const int index = (int)_entries.size();
+    Entry entry;
+    entry.node = node;
+    entry.parent = parent;
+    _entries.push_back(entry);
+    entries[node] = index;
+
+    // The template model draws with the materials it shares with the instances in the same way they do.
+    Model* model = dynamic_cast<Model*>(node->getDrawable());
+    if (model && (!model->_material || Model::isShareable(model->_material)))
+    {
+        bool shareable = true;
+        for (unsigned int i = 0; model->_partMaterials && i < model->_partCount; ++i)
+        {
+            if (model->_partMaterials[i] && !Model::isShareable(model->_partMaterials[i]))
+                shareable = false;
+        }
+        model->_sharedMaterials = shareable;
+    }
+
+    for (Node* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+    {
+        addEntry(child, index, entries);
+    }
+}
+
+Model* Prefab::instantiateModel(Model* model, NodeCloneContext& context) const
+{
+    GP_ASSERT(model);
+
+    Model* copy = Model::create(model->getMesh());
+    for (size_t i = 0, count = model->_lods.size(); i < count; ++i)
+    {
+        copy->addLod(model->_lods[i].mesh, model->_lods[i].screenSize);
+    }
+    copy->_lodHysteresis = model->_lodHysteresis;
+    copy->_instanceData = model->_instanceData;
+    copy->setParameterBlock(model->_parameterBlock);
+
+    if (!model->_sharedMaterials)
+    {
+        if (model->_material)
+        {
+            Material* material = model->_material->clone(context);
+            copy->setMaterial(material);
+            material->release();
+        }
+        for (unsigned int i = 0; model->_partMaterials && i < model->_partCount; ++i)
+        {
+            if (model->_partMaterials[i])
+            {
+                Material* material = model->_partMaterials[i]->clone(context);
+                copy->setMaterial(material, i);
+                material->release();
+            }
+        }
+        return copy;
+    }
+
+    // The passes of shared materials are already bound to the mesh, and are bound to each node as it is drawn.
+    copy->_sharedMaterials = true;
+    if (model->_material)
+    {
+        copy->_material = model->_material;
+        copy->_material->addRef();
+    }
+    if (model->_partMaterials)
+    {
+        GP_ASSERT(copy->_partCount == model->_partCount);
+        copy->_partMaterials = new Material*[copy->_partCount];
+        for (unsigned int i = 0; i < copy->_partCount; ++i)
+        {
+            copy->_partMaterials[i] = model->_partMaterials[i];
+            if (copy->_partMaterials[i])
+                copy->_partMaterials[i]->addRef();
+        }
+    }
+    return copy;
+}
+
+Node* Prefab::instantiate() const
+{
+    GP_ASSERT(!_entries.empty());
+
+    // Animations are cloned once per instance, and share the curves of the template.
+    NodeCloneContext context;
+    std::vector<Node*> nodes(_entries.size());
+    for (size_t i = 0, count = _entries.size(); i < count; ++i)
+    {
+        const Entry& entry = _entries[i];
+        Node* node;
+        if (entry.node->getType() == Node::JOINT)
+        {
+            Joint* joint = Joint::create(entry.node->getId());
+            joint->_bindPose = static_cast<Joint*>(entry.node)->_bindPose;
+            node = joint;
+        }
+        else
+        {
+            node = Node::create(entry.node->getId());
+        }
+        entry.node->cloneComponentsInto(node, context);
+
+        if (Drawable* drawable = entry.node->getDrawable())
+        {
+            Model* model = dynamic_cast<Model*>(drawable);
+            Drawable* copy = model ? instantiateModel(model, context) : drawable->clone(context);
+            node->setDrawable(copy);
+            Ref* ref = dynamic_cast<Ref*>(copy);
+            if (ref)
+                ref->release();
+        }
+        node->_world = entry.node->_world;
+        node->_bounds = entry.node->_bounds;
+
+        nodes[i] = node;
+        if (entry.parent >= 0)
+        {
+            nodes[entry.parent]->addChild(node);
+            node->release();
+        }
+    }
+
+    // Skins are set up once their joints exist.
+    for (size_t i = 0, count = _skins.size(); i < count; ++i)
+    {
+        const Skin& entry = _skins[i];
+        Model* model = static_cast<Model*>(nodes[entry.entry]->getDrawable());
+        GP_ASSERT(model);
+
+        MeshSkin* templateSkin = static_cast<Model*>(_entries[entry.entry].node->getDrawable())->getSkin();
+        MeshSkin* skin = new MeshSkin();
+        skin->_bindShape = templateSkin->_bindShape;
+        skin->setJointCount((unsigned int)entry.joints.size());
+        skin->_jointBounds = templateSkin->_jointBounds;
+        skin->_rootNode = nodes[entry.rootNode];
+        skin->_rootNode->addRef();
+        skin->_rootJoint = static_cast<Joint*>(nodes[entry.rootJoint]);
+        for (unsigned int j = 0, jointCount = (unsigned int)entry.joints.size(); j < jointCount; ++j)
+        {
+            skin->setJoint(static_cast<Joint*>(nodes[entry.joints[j]]), j);
+        }
+        model->setSkin(skin);
+    }
+
+    // Skins with joints outside of the template are cloned with their joints, as Node::clone() does.
+    for (size_t i = 0, count = _entries.size(); i < count; ++i)
+    {
+        Model* model = dynamic_cast<Model*>(_entries[i].node->getDrawable());
+        Model* copy = dynamic_cast<Model*>(nodes[i]->getDrawable());
+        if (model && copy && model->getSkin() && !copy->getSkin())
+            copy->setSkin(model->getSkin()->clone(context));
+    }
+
+    return nodes[0];
+}
+
+}
@@ -0,0 +1,121 @@
+#ifndef PREFAB_H_
+#define PREFAB_H_
+
+#include "Ref.h"
+
+namespace gameplay
+{
+
+class Node;
+class NodeCloneContext;
+class Model;
+
+/**
+ * Defines a node hierarchy that is instantiated many times, sharing its immutable data.
+ *
+ * Node::clone() copies everything a hierarchy holds: the materials of its models, with their
+ * techniques, passes and parameters, are cloned and bound to each new node, and the nodes are
+ * remapped through the clone context as they are created. A prefab is instead created once
+ * from a template hierarchy, whose nodes and skins it flattens, and each instance only
+ * allocates what differs between instances: its nodes and joints, with their transforms and
+ * animation channels, and the models and skins that refer to them.
+ *
+ * The meshes, materials, joint bind poses and animation curves of the template are shared
+ * by every instance. The materials are bound to the node of each model as it is drawn, and
+ * must be treated as read-only. Per-instance variation is set through
+ * Model::setInstanceData(), which is also streamed into instanced draws, through
+ * Model::setParameterBlock(), or by giving a model of an instance a material of its own. Materials with auto bindings resolved by a custom
+ * RenderState::AutoBindingResolver are bound to a single node, so those are still cloned for
+ * each instance.
+ *
+ * Drawables other than models, cameras, lights and audio sources are cloned for each
+ * instance, as are skins whose joints are outside of the template hierarchy.
+ *
+ * @script{ignore}
+ */
+class Prefab : public Ref
+{
+public:
+
+    /**
+     * Creates a prefab from a template hierarchy.
+     *
+     * The prefab keeps a reference to the template, which should not be changed afterwards.
+     *
+     * @param node The root node of the template hierarchy.
+     *
+     * @return The new prefab.
+     */
+    static Prefab* create(Node* node);
+
+    /**
+     * Gets the root node of the template hierarchy.
+     *
+     * @return The root node of the template.
+     */
+    Node* getNode() const;
+
+    /**
+     * Creates an instance of the prefab.
+     *
+     * Its objects are allocated from the ObjectPool current on the calling thread, so instances
+     * that are added to a scene are best created within an ObjectPool::Scope of its pool.
+     *
+     * @return The root node of the new instance, which is released by the caller.
+     */
+    Node* instantiate() const;
+
+private:
+
+    struct Entry
+    {
+        Node* node;
+        int parent;
+    };
+
+    struct Skin
+    {
+        unsigned int entry;
+        int rootNode;
+        int rootJoint;
+        std::vector<int> joints;
+    };
+
+    /**
+     * Constructor.
+     */
+    Prefab(Node* node);
+
+    /**
+     * Destructor.
+     */
+    ~Prefab();
+
+    /**
+     * Hidden copy constructor.
+     */
+    Prefab(const Prefab& copy);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    Prefab& operator=(const Prefab&);
+
+    /**
+     * Appends the given node and its descendants to the entries.
+     */
+    void addEntry(Node* node, int parent, std::map<const Node*, int>& entries);
+
+    /**
+     * Creates the model of an instance, sharing the mesh and shareable materials of the template model.
+     */
+    Model* instantiateModel(Model* model, NodeCloneContext& context) const;
+
+    Node* _node;
+    std::vector<Entry> _entries;
+    std::vector<Skin> _skins;
+};
+
+}
+
+#endif
@@ -0,0 +1,381 @@
+#include "Base.h"
+#include "Profiler.h"
+#include "FileSystem.h"
+
+// Maximum number of GPU scopes waiting for their queries to complete.
+#define PROFILER_MAX_GPU_SCOPES 1024
+
+namespace gameplay
+{
+
+static std::mutex __profilerMutex;
+static std::atomic<bool> __profilerCapturing(false);
+static std::atomic<unsigned int> __profilerThreadCount(0);
+static std::chrono::steady_clock::time_point __profilerEpoch;
+static Profiler::Event* __profilerEvents = NULL;
+static unsigned int __profilerEventCount = 0;
+static unsigned int __profilerEventCapacity = 0;
+
+// The nesting depth of the active scopes on the calling thread.
+static thread_local unsigned int __profilerDepth = 0;
+
+// The index of the calling thread in captured events, or -1 if not assigned yet.
+static thread_local int __profilerThread = -1;
+
+// The stages of the frame being timed and of the last frame. Only the main thread times stages.
+static std::atomic<bool> __profilerStageTiming(false);
+static std::thread::id __profilerMainThread;
+static std::vector<Profiler::Stage> __profilerStages;
+static std::vector<Profiler::Stage> __profilerLastStages;
+
+#ifdef GP_USE_TIMER_QUERIES
+struct GpuQuery
+{
+    const char* name;
+    GLuint begin;
+    GLuint end;
+    unsigned int depth;
+};
+
+// GPU scopes in the order they were issued, with the scopes of the last few frames still pending.
+static std::vector<GpuQuery> __profilerGpuQueries;
+static std::vector<GLuint> __profilerFreeQueries;
+static unsigned int __profilerGpuDepth = 0;
+static bool __profilerGpuCalibrated = false;
+
+// The capture time, in microseconds, of a GPU timestamp of zero.
+static double __profilerGpuOffset = 0.0;
+
+static GLuint allocateQuery()
+{
+    GLuint query = 0;
+    if (__profilerFreeQueries.empty())
+    {
+        GL_ASSERT( glGenQueries(1, &query) );
+    }
+    else
+    {
+        query = __profilerFreeQueries.back();
+        __profilerFreeQueries.pop_back();
+    }
+    return query;
+}
+#endif
+
+// Adds the time of a scope to its stage of the frame.
+static void addStageTime(const char* name, double time, bool gpu)
+{
+    for (size_t i = 0, count = __profilerStages.size(); i < count; ++i)
+    {
+        Profiler::Stage& stage = __profilerStages[i];
+        if (stage.gpu == gpu && (stage.name == name || strcmp(stage.name, name) == 0))
+        {
+            stage.time += time;
+            return;
+        }
+    }
+    Profiler::Stage stage;
+    stage.name = name;
+    stage.time = time;
+    stage.gpu = gpu;
+    __profilerStages.push_back(stage);
+}
+
+// Appends an event to the capture, if it is active and has room.
+static void pushEvent(const Profiler::Event& event)
+{
+    std::lock_guard<std::mutex> lock(__profilerMutex);
+
+    // The capture may have ended while this scope was open.
+    if (!__profilerCapturing || __profilerEventCount >= __profilerEventCapacity)
+        return;
+
+    __profilerEvents[__profilerEventCount++] = event;
+}
+
+Profiler::Scope::Scope(const char* name)
+    : _name(name), _start(0.0), _active(__profilerCapturing || __profilerStageTiming)
+{
+    if (_active)
+    {
+        _start = getTime();
+        ++__profilerDepth;
+    }
+}
+
+Profiler::Scope::~Scope()
+{
+    if (_active)
+    {
+        --__profilerDepth;
+        const double end = getTime();
+        if (__profilerCapturing)
+            record(_name, _start, end, __profilerDepth);
+
+        // The stages of a frame are the scopes directly within Game::frame.
+        if (__profilerStageTiming && __profilerDepth == 1 && std::this_thread::get_id() == __profilerMainThread)
+            addStageTime(_name, (end - _start) / 1000.0, false);
+    }
+}
+
+void Profiler::beginCapture(unsigned int maxEvents)
+{
+    std::lock_guard<std::mutex> lock(__profilerMutex);
+
+    if (maxEvents != __profilerEventCapacity)
+    {
+        SAFE_DELETE_ARRAY(__profilerEvents);
+        __profilerEvents = maxEvents > 0 ? new Event[maxEvents] : NULL;
+        __profilerEventCapacity = maxEvents;
+    }
+    __profilerEventCount = 0;
+    __profilerEpoch = std::chrono::steady_clock::now();
+#ifdef GP_USE_TIMER_QUERIES
+    __profilerGpuCalibrated = false;
+#endif
+    __profilerCapturing = true;
+}
+
+void Profiler::endCapture()
+{
+    std::lock_guard<std::mutex> lock(__profilerMutex);
+    __profilerCapturing = false;
+}
+
+bool Profiler::isCapturing()
+{
+    return __profilerCapturing;
+}
+
+unsigned int Profiler::getEventCount()
+{
+    return __profilerEventCount;
+}
+
+const Profiler::Event* Profiler::getEvents()
+{
+    GP_ASSERT(!__profilerCapturing);
+    return __profilerEventCount > 0 ? __profilerEvents : NULL;
+}
+
+bool Profiler::writeChromeTrace(const char* path)
+{
+    GP_ASSERT(path);
+    GP_ASSERT(!__profilerCapturing);
+
+    Stream* stream = FileSystem::open(path, FileSystem::WRITE);
+    if (stream == NULL)
+    {
+        GP_WARN("Failed to open file '%s' for writing the profiler capture.", path);
+        return false;
+    }
+
+    // Complete ('X') events carry both the start time and the duration, in microseconds.
+    // Counter ('C') events carry their value as an argument. GPU scopes are shown as a
+    // process of their own.
+    std::ostringstream json;
+    json << "{\"traceEvents\":[";
+    json << "\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"CPU\"}},";
+    json << "\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"GPU\"}}";
+    for (unsigned int i = 0; i < __profilerEventCount; ++i)
+    {
+        const Event& event = __profilerEvents[i];
+        json << ",\n{\"name\":\"";
+        for (const char* c = event.name ? event.name : ""; *c; ++c)
+        {
+            if (*c == '"' || *c == '\\')
+                json << '\\';
+            json << *c;
+        }
+        if (event.counter)
+        {
+            json << "\",\"cat\":\"gameplay\",\"ph\":\"C\",\"pid\":0,\"tid\":" << event.thread
+                 << ",\"ts\":" << event.start << ",\"args\":{\"value\":" << event.value << "}}";
+        }
+        else
+        {
+            json << "\",\"cat\":\"gameplay\",\"ph\":\"X\",\"pid\":" << (event.gpu ? 1 : 0) << ",\"tid\":" << event.thread
+                 << ",\"ts\":" << event.start << ",\"dur\":" << event.duration << "}";
+        }
+    }
+    json << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    const std::string data = json.str();
+    bool result = stream->write(data.c_str(), 1, data.length()) == data.length();
+    stream->close();
+    SAFE_DELETE(stream);
+    if (!result)
+        GP_WARN("Failed to write the profiler capture to file '%s'.", path);
+    return result;
+}
+
+void Profiler::clear()
+{
+    std::lock_guard<std::mutex> lock(__profilerMutex);
+    GP_ASSERT(!__profilerCapturing);
+
+    SAFE_DELETE_ARRAY(__profilerEvents);
+    __profilerEventCount = 0;
+    __profilerEventCapacity = 0;
+}
+
+void Profiler::recordCounter(const char* name, double value)
+{
+    if (__profilerCapturing)
+    {
+        const double time = getTime();
+        record(name, time, time, __profilerDepth, true, value);
+    }
+}
+
+double Profiler::getTime()
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - __profilerEpoch).count();
+}
+
+void Profiler::record(const char* name, double start, double end, unsigned int depth, bool counter, double value)
+{
+    if (__profilerThread < 0)
+        __profilerThread = (int)__profilerThreadCount++;
+
+    Event event;
+    event.name = name;
+    event.start = start;
+    event.duration = end - start;
+    event.thread = (unsigned int)__profilerThread;
+    event.depth = depth;
+    event.counter = counter;
+    event.value = value;
+    event.gpu = false;
+    pushEvent(event);
+}
+
+Profiler::GpuScope::GpuScope(const char* name)
+    : _index(-1)
+{
+#ifdef GP_USE_TIMER_QUERIES
+    if ((!__profilerCapturing && !__profilerStageTiming) || __profilerGpuQueries.size() >= PROFILER_MAX_GPU_SCOPES || !isGpuTimingSupported())
+        return;
+
+    if (__profilerCapturing && !__profilerGpuCalibrated)
+    {
+        // Line up the clock of the GPU with the clock of the capture.
+        GLint64 timestamp = 0;
+        GL_ASSERT( glGetInteger64v(GL_TIMESTAMP, &timestamp) );
+        __profilerGpuOffset = getTime() - timestamp / 1000.0;
+        __profilerGpuCalibrated = true;
+    }
+
+    GpuQuery query;
+    query.name = name;
+    query.begin = allocateQuery();
+    query.end = allocateQuery();
+    query.depth = __profilerGpuDepth++;
+    GL_ASSERT( glQueryCounter(query.begin, GL_TIMESTAMP) );
+    _index = (int)__profilerGpuQueries.size();
+    __profilerGpuQueries.push_back(query);
+#endif
+}
+
+Profiler::GpuScope::~GpuScope()
+{
+#ifdef GP_USE_TIMER_QUERIES
+    if (_index >= 0)
+    {
+        --__profilerGpuDepth;
+        GL_ASSERT( glQueryCounter(__profilerGpuQueries[_index].end, GL_TIMESTAMP) );
+    }
+#endif
+}
+
+bool Profiler::isGpuTimingSupported()
+{
+#ifdef GP_USE_TIMER_QUERIES
+    return (GLEW_VERSION_3_3 || GLEW_ARB_timer_query) && glQueryCounter != NULL;
+#else
+    return false;
+#endif
+}
+
+void Profiler::setStageTimingEnabled(bool enabled)
+{
+    __profilerStageTiming = enabled;
+    if (!enabled)
+    {
+        __profilerStages.clear();
+        __profilerLastStages.clear();
+    }
+}
+
+bool Profiler::isStageTimingEnabled()
+{
+    return __profilerStageTiming;
+}
+
+const std::vector<Profiler::Stage>& Profiler::getStageTimes()
+{
+    return __profilerLastStages;
+}
+
+void Profiler::nextFrame()
+{
+    __profilerMainThread = std::this_thread::get_id();
+
+#ifdef GP_USE_TIMER_QUERIES
+    // Queries complete in the order they were issued, so stop at the first one that is not done.
+    size_t done = 0;
+    for (size_t count = __profilerGpuQueries.size(); done < count; ++done)
+    {
+        const GpuQuery& query = __profilerGpuQueries[done];
+        GLuint available = 0;
+        GL_ASSERT( glGetQueryObjectuiv(query.end, GL_QUERY_RESULT_AVAILABLE, &available) );
+        if (!available)
+            break;
+
+        GLuint64 begin = 0;
+        GLuint64 end = 0;
+        GL_ASSERT( glGetQueryObjectui64v(query.begin, GL_QUERY_RESULT, &begin) );
+        GL_ASSERT( glGetQueryObjectui64v(query.end, GL_QUERY_RESULT, &end) );
+
+        Event event;
+        event.name = query.name;
+        event.start = begin / 1000.0 + __profilerGpuOffset;
+        event.duration = end > begin ? (end - begin) / 1000.0 : 0.0;
+        event.thread = 0;
+        event.depth = query.depth;
+        event.counter = false;
+        event.value = 0.0;
+        event.gpu = true;
+        pushEvent(event);
+        if (__profilerStageTiming && query.depth == 0)
+            addStageTime(query.name, event.duration / 1000.0, true);
+
+        __profilerFreeQueries.push_back(query.begin);
+        __profilerFreeQueries.push_back(query.end);
+    }
+    __profilerGpuQueries.erase(__profilerGpuQueries.begin(), __profilerGpuQueries.begin() + done);
+#endif
+
+    // Publish the stages of the frame that just ended.
+    __profilerLastStages.swap(__profilerStages);
+    __profilerStages.clear();
+}
+
+void Profiler::finalize()
+{
+#ifdef GP_USE_TIMER_QUERIES
+    for (size_t i = 0, count = __profilerGpuQueries.size(); i < count; ++i)
+    {
+        __profilerFreeQueries.push_back(__profilerGpuQueries[i].begin);
+        __profilerFreeQueries.push_back(__profilerGpuQueries[i].end);
+    }
+    __profilerGpuQueries.clear();
+    if (!__profilerFreeQueries.empty())
+    {
+        GL_ASSERT( glDeleteQueries((GLsizei)__profilerFreeQueries.size(), &__profilerFreeQueries[0]) );
+        __profilerFreeQueries.clear();
+    }
+#endif
+}
+
+}
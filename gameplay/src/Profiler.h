@@ -0,0 +1,299 @@
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+namespace gameplay
+{
+
+/**
+ * Defines a hierarchical CPU profiler used to capture where frame time is spent.
+ *
+ * Profiling markers are placed with the GP_PROFILE_SCOPE and GP_PROFILE_FUNCTION
+ * macros, which only generate code when the pre-processor definition GP_USE_PROFILER
+ * is defined, so they cost nothing in builds without it. While a capture is active,
+ * every marker records its start time, duration, nesting depth and thread.
+ *
+ * Values that change over time, such as frame time statistics, are recorded as counters
+ * with the GP_PROFILE_COUNTER macro.
+ *
+ * Regions of GL work are timed on the GPU with the GP_PROFILE_GPU_SCOPE macro, which
+ * surrounds the region with timestamp queries where timer queries are supported. The
+ * GPU does the work some time after the calls are made, so the results are read back a
+ * few frames later without stalling, and recorded as events of their own GPU track. The
+ * engine times the render queue, forms, particle emitters, terrain and the upscale of
+ * dynamic resolution.
+ *
+ * Captured events can be inspected at runtime with getEvents() once the capture
+ * has ended, or written to a JSON file that can be loaded in chrome://tracing.
+ *
+ * Independently of captures, the profiler can time the stages of each frame: the top
+ * level scopes within Game::frame on the main thread and the top level GPU scopes. The
+ * totals of the last frame are returned by getStageTimes(), which is what the performance
+ * HUD displays.
+ *
+ * @script{ignore}
+ */
+class Profiler
+{
+    friend class Game;
+
+public:
+
+    /**
+     * A single completed profiling scope, or a sample of a counter.
+     */
+    struct Event
+    {
+        /**
+         * The name of the scope (not copied; must be a string literal or otherwise outlive the capture).
+         */
+        const char* name;
+
+        /**
+         * The start time of the scope, in microseconds since the capture began.
+         */
+        double start;
+
+        /**
+         * The duration of the scope, in microseconds.
+         */
+        double duration;
+
+        /**
+         * The index of the thread the scope ran on (the first profiled thread is zero).
+         */
+        unsigned int thread;
+
+        /**
+         * The nesting depth of the scope on its thread (top level scopes are zero).
+         */
+        unsigned int depth;
+
+        /**
+         * True if the event is a sample of a counter, with a zero duration, rather than a scope.
+         */
+        bool counter;
+
+        /**
+         * The value of the counter sample (zero for scopes).
+         */
+        double value;
+
+        /**
+         * True if the scope was timed on the GPU, in which case its thread is zero.
+         */
+        bool gpu;
+    };
+
+    /**
+     * The time spent in a stage of a frame.
+     */
+    struct Stage
+    {
+        /**
+         * The name of the scope of the stage.
+         */
+        const char* name;
+
+        /**
+         * The total time spent in the scopes of the stage during the frame, in milliseconds.
+         */
+        double time;
+
+        /**
+         * True if the stage was timed on the GPU.
+         */
+        bool gpu;
+    };
+
+    /**
+     * Records the lifetime of a profiling scope. Use the GP_PROFILE_SCOPE macro rather than this directly.
+     */
+    class Scope
+    {
+    public:
+
+        /**
+         * Constructor. Begins the scope.
+         *
+         * @param name The name of the scope.
+         */
+        Scope(const char* name);
+
+        /**
+         * Destructor. Ends the scope and records it if a capture is active.
+         */
+        ~Scope();
+
+    private:
+
+        Scope(const Scope&);
+        Scope& operator=(const Scope&);
+
+        const char* _name;
+        double _start;
+        bool _active;
+    };
+
+    /**
+     * Records the GPU time of a profiling scope. Use the GP_PROFILE_GPU_SCOPE macro rather than this directly.
+     *
+     * GPU scopes must begin and end on the thread that owns the GL context, within a frame.
+     */
+    class GpuScope
+    {
+    public:
+
+        /**
+         * Constructor. Issues the query for the start of the scope if a capture is active or stages are timed.
+         *
+         * @param name The name of the scope.
+         */
+        GpuScope(const char* name);
+
+        /**
+         * Destructor. Issues the query for the end of the scope.
+         */
+        ~GpuScope();
+
+    private:
+
+        GpuScope(const GpuScope&);
+        GpuScope& operator=(const GpuScope&);
+
+        int _index;
+    };
+
+    /**
+     * Begins a new capture, discarding any previously captured events.
+     *
+     * @param maxEvents The maximum number of events to record. Later events are dropped.
+     */
+    static void beginCapture(unsigned int maxEvents = 65536);
+
+    /**
+     * Ends the active capture.
+     */
+    static void endCapture();
+
+    /**
+     * Determines if a capture is active.
+     *
+     * @return true if a capture is active, false otherwise.
+     */
+    static bool isCapturing();
+
+    /**
+     * Gets the number of events recorded by the last capture.
+     *
+     * @return The number of captured events.
+     */
+    static unsigned int getEventCount();
+
+    /**
+     * Gets the events recorded by the last capture, ordered by the time each scope ended on
+     * the CPU (GPU scopes are recorded when their results are read back, a few frames later).
+     *
+     * The events must not be accessed while a capture is active.
+     *
+     * @return The array of captured events, or NULL if no events were captured.
+     */
+    static const Event* getEvents();
+
+    /**
+     * Writes the events of the last capture to a file in the Chrome trace event JSON format.
+     *
+     * @param path The path of the file to write.
+     *
+     * @return true if the file was written, false otherwise.
+     */
+    static bool writeChromeTrace(const char* path);
+
+    /**
+     * Discards all captured events and releases their memory.
+     */
+    static void clear();
+
+    /**
+     * Determines if GPU scopes are timed on this platform.
+     *
+     * @return true if timer queries are supported.
+     */
+    static bool isGpuTimingSupported();
+
+    /**
+     * Records a sample of a counter if a capture is active. Use the GP_PROFILE_COUNTER macro rather than this directly.
+     *
+     * @param name The name of the counter (not copied; must be a string literal or otherwise outlive the capture).
+     * @param value The value of the counter.
+     */
+    static void recordCounter(const char* name, double value);
+
+    /**
+     * Enables or disables the timing of the stages of each frame.
+     *
+     * @param enabled true to time the stages of each frame.
+     */
+    static void setStageTimingEnabled(bool enabled);
+
+    /**
+     * Determines if the stages of each frame are timed.
+     *
+     * @return true if the stages of each frame are timed.
+     */
+    static bool isStageTimingEnabled();
+
+    /**
+     * Gets the stages of the last frame, in the order they first ended.
+     *
+     * The GPU stages are those whose results were read back during the last frame, which
+     * were issued a few frames earlier.
+     *
+     * @return The stages of the last frame, or an empty list if stages are not timed.
+     */
+    static const std::vector<Stage>& getStageTimes();
+
+private:
+
+    /**
+     * Constructor.
+     */
+    Profiler();
+
+    /**
+     * Gets the current time in microseconds since the capture began.
+     */
+    static double getTime();
+
+    /**
+     * Records a completed scope.
+     */
+    static void record(const char* name, double start, double end, unsigned int depth, bool counter = false, double value = 0.0);
+
+    /**
+     * Records the GPU scopes whose queries have completed. Called by Game at the start of each frame.
+     */
+    static void nextFrame();
+
+    /**
+     * Deletes the timer queries. Called during game shutdown.
+     */
+    static void finalize();
+};
+
+}
+
+#ifdef GP_USE_PROFILER
+#define GP_PROFILE_CONCAT_INTERNAL(a, b) a##b
+#define GP_PROFILE_CONCAT(a, b) GP_PROFILE_CONCAT_INTERNAL(a, b)
+#define GP_PROFILE_SCOPE(name) gameplay::Profiler::Scope GP_PROFILE_CONCAT(__profileScope, __LINE__)(name)
+#define GP_PROFILE_FUNCTION() GP_PROFILE_SCOPE(__current__func__)
+#define GP_PROFILE_COUNTER(name, value) gameplay::Profiler::recordCounter(name, value)
+#define GP_PROFILE_GPU_SCOPE(name) gameplay::Profiler::GpuScope GP_PROFILE_CONCAT(__profileGpuScope, __LINE__)(name)
+#else
+#define GP_PROFILE_SCOPE(name)
+#define GP_PROFILE_FUNCTION()
+#define GP_PROFILE_COUNTER(name, value)
+#define GP_PROFILE_GPU_SCOPE(name)
+#endif
+
+#endif
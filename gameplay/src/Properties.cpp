@@ -3,9 +3,17 @@
 #include "FileSystem.h"
 #include "Quaternion.h"
 
+// Identifier and version of the binary encoding of properties files written by the encoder.
+#define PROPERTIES_BINARY_IDENTIFIER "GPPR"
+#define PROPERTIES_BINARY_VERSION 1
+
 namespace gameplay
 {
 
+// Parsed files, by path, that create() copies namespaces out of.
+static std::unordered_map<std::string, Properties*> __cache;
+static std::mutex __cacheMutex;
+
 /**
  * Reads the next character from the stream. Returns EOF if the end of the stream is reached.
  */
@@ -80,36 +88,174 @@ Properties* Properties::create(const char* url)
     std::vector<std::string> namespacePath;
     calculateNamespacePath(urlString, fileString, namespacePath);
 
-    std::unique_ptr<Stream> stream(FileSystem::open(fileString.c_str()));
+    // Copy the specified properties object out of the cached file. The cached
+    // file is shared, so it is only walked and copied while holding the lock.
+    Properties* p = NULL;
+    bool cached;
+    {
+        std::lock_guard<std::mutex> lock(__cacheMutex);
+        std::unordered_map<std::string, Properties*>::const_iterator itr = __cache.find(fileString);
+        cached = itr != __cache.end();
+        if (cached && (p = getPropertiesFromNamespacePath(itr->second, namespacePath)) != NULL)
+            p = p->clone();
+    }
+
+    // Parse the file outside of the lock, so that other files can be parsed at the same time.
+    if (!cached)
+    {
+        Properties* properties = parse(fileString);
+        if (!properties)
+            return NULL;
+
+        std::lock_guard<std::mutex> lock(__cacheMutex);
+        std::pair<std::unordered_map<std::string, Properties*>::iterator, bool> inserted = __cache.insert(std::make_pair(fileString, properties));
+        if (!inserted.second)
+        {
+            // Another thread parsed the file first.
+            SAFE_DELETE(properties);
+        }
+        if ((p = getPropertiesFromNamespacePath(inserted.first->second, namespacePath)) != NULL)
+            p = p->clone();
+    }
+
+    if (!p)
+    {
+        GP_WARN("Failed to load properties from url '%s'.", url);
+        return NULL;
+    }
+    p->setDirectoryPath(FileSystem::getDirectoryName(fileString.c_str()));
+    return p;
+}
+
+void Properties::clearCache()
+{
+    std::lock_guard<std::mutex> lock(__cacheMutex);
+    for (std::unordered_map<std::string, Properties*>::iterator itr = __cache.begin(); itr != __cache.end(); ++itr)
+    {
+        SAFE_DELETE(itr->second);
+    }
+    __cache.clear();
+}
+
+/**
+ * Reads an unsigned int from the binary encoding of a properties file.
+ */
+static bool readBinaryUint(const char** data, const char* end, unsigned int* value)
+{
+    if ((size_t)(end - *data) < sizeof(unsigned int))
+        return false;
+    memcpy(value, *data, sizeof(unsigned int));
+    *data += sizeof(unsigned int);
+    return true;
+}
+
+/**
+ * Reads a length-prefixed string from the binary encoding of a properties file.
+ */
+static bool readBinaryString(const char** data, const char* end, std::string* value)
+{
+    unsigned int length;
+    if (!readBinaryUint(data, end, &length) || (size_t)(end - *data) < length)
+        return false;
+    value->assign(*data, length);
+    *data += length;
+    return true;
+}
+
+Properties* Properties::parse(const std::string& path)
+{
+    // Read the binary encoding of the file if the encoder has written one.
+    std::string binaryPath = path + "b";
+    if (FileSystem::fileExists(binaryPath.c_str()))
+    {
+        std::unique_ptr<Stream> stream(FileSystem::open(binaryPath.c_str()));
+        if (stream.get())
+        {
+            std::vector<char> data(stream->length());
+            bool read = !data.empty() && stream->read(&data[0], 1, data.size()) == data.size();
+            stream->close();
+
+            const char* ptr = read ? &data[0] : NULL;
+            const char* end = read ? ptr + data.size() : NULL;
+            unsigned int version;
+            if (read && data.size() >= 4 && memcmp(ptr, PROPERTIES_BINARY_IDENTIFIER, 4) == 0)
+            {
+                ptr += 4;
+                if (readBinaryUint(&ptr, end, &version) && version == PROPERTIES_BINARY_VERSION)
+                {
+                    Properties* properties = new Properties();
+                    if (properties->readBinary(&ptr, end))
+                    {
+                        properties->resolveInheritance();
+                        return properties;
+                    }
+                    SAFE_DELETE(properties);
+                }
+            }
+        }
+        GP_WARN("Invalid binary properties file '%s'; reading '%s' instead.", binaryPath.c_str(), path.c_str());
+    }
+
+    std::unique_ptr<Stream> stream(FileSystem::open(path.c_str()));
     if (stream.get() == NULL)
     {
-        GP_WARN("Failed to open file '%s'.", fileString.c_str());
+        GP_WARN("Failed to open file '%s'.", path.c_str());
         return NULL;
     }
 
     Properties* properties = new Properties(stream.get());
     properties->resolveInheritance();
     stream->close();
+    return properties;
+}
 
-    // Get the specified properties object.
-    Properties* p = getPropertiesFromNamespacePath(properties, namespacePath);
-    if (!p)
+bool Properties::readBinary(const char** data, const char* end)
+{
+    // Each namespace is its name, ID and parent ID, followed by its properties,
+    // its variables and its nested namespaces, each preceded by their count.
+    unsigned int count;
+    if (!readBinaryString(data, end, &_namespace) || !readBinaryString(data, end, &_id) || !readBinaryString(data, end, &_parentID))
+        return false;
+
+    std::string name;
+    std::string value;
+    if (!readBinaryUint(data, end, &count))
+        return false;
+    for (unsigned int i = 0; i < count; ++i)
     {
-        GP_WARN("Failed to load properties from url '%s'.", url);
-        SAFE_DELETE(properties);
-        return NULL;
+        if (!readBinaryString(data, end, &name) || !readBinaryString(data, end, &value))
+            return false;
+        _properties.push_back(Property(name.c_str(), value.c_str()));
     }
 
-    // If the loaded properties object is not the root namespace,
-    // then we have to clone it and delete the root namespace
-    // so that we don't leak memory.
-    if (p != properties)
+    if (!readBinaryUint(data, end, &count))
+        return false;
+    if (count > 0)
     {
-        p = p->clone();
-        SAFE_DELETE(properties);
+        _variables = new std::vector<Property>();
+        _variables->reserve(count);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            if (!readBinaryString(data, end, &name) || !readBinaryString(data, end, &value))
+                return false;
+            _variables->push_back(Property(name.c_str(), value.c_str()));
+        }
     }
-    p->setDirectoryPath(FileSystem::getDirectoryName(fileString.c_str()));
-    return p;
+
+    if (!readBinaryUint(data, end, &count))
+        return false;
+    _namespaces.reserve(count);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        Properties* space = new Properties();
+        space->_parent = this;
+        _namespaces.push_back(space);
+        if (!space->readBinary(data, end))
+            return false;
+    }
+
+    rewind();
+    return true;
 }
 
 static bool isVariable(const char* str, char* outName, size_t outSize)
@@ -1016,6 +1162,8 @@ Properties* Properties::clone()
     p->_properties = _properties;
     p->_propertiesItr = p->_properties.end();
     p->setDirectoryPath(_dirPath);
+    if (_variables)
+        p->_variables = new std::vector<Property>(*_variables);
 
     for (size_t i = 0, count = _namespaces.size(); i < count; i++)
     {
@@ -147,6 +147,11 @@ public:
      * Creates a Properties runtime settings from the specified URL, where the URL is of
      * the format "<file-path>.<extension>#<namespace-id>/<namespace-id>/.../<namespace-id>"
      * (and "#<namespace-id>/<namespace-id>/.../<namespace-id>" is optional).
+     *
+     * Each file is parsed once and kept in a cache, and later URLs into the same file
+     * return copies of the cached namespaces. If the encoder has written the binary
+     * encoding of the file next to it ("<file-path>.<extension>b"), it is read in place
+     * of the text.
      * 
      * @param url The URL to create the properties from.
      * 
@@ -155,6 +160,14 @@ public:
      */
     static Properties* create(const char* url);
 
+    /**
+     * Empties the cache of files parsed by create().
+     *
+     * This frees the cached files once a level has loaded, and must be called
+     * for create() to see files that have changed since they were parsed.
+     */
+    static void clearCache();
+
     /**
      * Destructor.
      */
@@ -538,8 +551,18 @@ private:
      */
     Properties(Stream* stream, const char* name, const char* id, const char* parentID, Properties* parent);
 
+    /**
+     * Parses a file, from its binary encoding if there is one, and resolves its inheritance.
+     */
+    static Properties* parse(const std::string& path);
+
     void readProperties(Stream* stream);
 
+    /**
+     * Reads a namespace and its nested namespaces from the binary encoding of a file.
+     */
+    bool readBinary(const char** data, const char* end);
+
     void setDirectoryPath(const std::string* path);
 
     void setDirectoryPath(const std::string& path);
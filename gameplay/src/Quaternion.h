@@ -37,6 +37,8 @@ class Matrix;
  * q3 = (0.6, 0.0, 0.8, 0.0), and
  * q4 = (-0.8, 0.0, -0.6, 0.0).
  * For the point p = (1.0, 1.0, 1.0), the following figures show the trajectories of p using lerp, slerp, and squad.
+ *
+ * @script{value}
  */
 class Quaternion
 {
@@ -10,6 +10,11 @@ void* trackRef(Ref* ref);
 void untrackRef(Ref* ref, void* record);
 #endif
 
+// Written when the render thread starts or stops, while other threads may be releasing objects.
+static std::atomic<std::thread::id> __mainThread(std::this_thread::get_id());
+static std::vector<Ref*> __pendingDestroys;
+static std::mutex __pendingDestroysMutex;
+
 Ref::Ref() :
     _refCount(1)
 {
@@ -26,25 +31,35 @@ Ref::Ref(const Ref& copy) :
 #endif
 }
 
+Ref& Ref::operator=(const Ref&)
+{
+    return *this;
+}
+
 Ref::~Ref()
 {
 }
 
 void Ref::addRef()
 {
-    GP_ASSERT(_refCount > 0 && _refCount < 1000000);
+    GP_ASSERT(getRefCount() > 0 && getRefCount() < 1000000);
     ++_refCount;
 }
 
 void Ref::release()
 {
-    GP_ASSERT(_refCount > 0 && _refCount < 1000000);
-    if ((--_refCount) <= 0)
+    GP_ASSERT(getRefCount() > 0 && getRefCount() < 1000000);
+    if ((--_refCount) == 0)
     {
-#ifdef GP_USE_MEM_LEAK_DETECTION
-        untrackRef(this, __record);
-#endif
-        delete this;
+        if (isDestroyedOnMainThread() && std::this_thread::get_id() != __mainThread.load())
+        {
+            std::lock_guard<std::mutex> lock(__pendingDestroysMutex);
+            __pendingDestroys.push_back(this);
+        }
+        else
+        {
+            destroy();
+        }
     }
 }
 
@@ -53,6 +68,39 @@ unsigned int Ref::getRefCount() const
     return _refCount;
 }
 
+bool Ref::isDestroyedOnMainThread() const
+{
+    return false;
+}
+
+void Ref::setMainThread()
+{
+    __mainThread = std::this_thread::get_id();
+}
+
+void Ref::destroyPending()
+{
+    std::vector<Ref*> pending;
+    {
+        std::lock_guard<std::mutex> lock(__pendingDestroysMutex);
+        pending.swap(__pendingDestroys);
+    }
+
+    // Destroying an object may release others, which are then destroyed right away on this thread.
+    for (size_t i = 0, count = pending.size(); i < count; ++i)
+    {
+        pending[i]->destroy();
+    }
+}
+
+void Ref::destroy()
+{
+#ifdef GP_USE_MEM_LEAK_DETECTION
+    untrackRef(this, __record);
+#endif
+    delete this;
+}
+
 #ifdef GP_USE_MEM_LEAK_DETECTION
 
 struct RefAllocationRecord
@@ -64,6 +112,7 @@ struct RefAllocationRecord
 
 RefAllocationRecord* __refAllocations = 0;
 int __refAllocationCount = 0;
+static std::mutex __refAllocationMutex;
 
 void Ref::printLeaks()
 {
@@ -92,9 +141,11 @@ void* trackRef(Ref* ref)
     // Create memory allocation record.
     RefAllocationRecord* rec = (RefAllocationRecord*)malloc(sizeof(RefAllocationRecord));
     rec->ref = ref;
-    rec->next = __refAllocations;
     rec->prev = 0;
 
+    std::lock_guard<std::mutex> lock(__refAllocationMutex);
+    rec->next = __refAllocations;
+
     if (__refAllocations)
         __refAllocations->prev = rec;
     __refAllocations = rec;
@@ -119,6 +170,7 @@ void untrackRef(Ref* ref, void* record)
     }
 
     // Link this item out.
+    std::lock_guard<std::mutex> lock(__refAllocationMutex);
     if (__refAllocations == rec)
         __refAllocations = rec->next;
     if (rec->prev)
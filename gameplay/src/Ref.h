@@ -13,9 +13,19 @@ namespace gameplay
  * reference counting eliminates the need for programmers to manually
  * keep track of object ownership and having to worry about when to
  * safely delete such objects.
+ *
+ * The reference count is atomic, so that objects can be shared with and
+ * handed over by worker threads, unless GP_USE_NON_ATOMIC_REF_COUNT is
+ * defined for builds that never share objects between threads. Objects
+ * owning graphics resources are never destroyed on a worker thread: when
+ * a worker releases the last reference to one, its destruction is deferred
+ * to the start of the next frame on the main thread.
  */
 class Ref
 {
+    friend class Game;
+    friend class RenderThread;
+
 public:
 
     /**
@@ -57,18 +67,57 @@ protected:
      */
     Ref(const Ref& copy);
 
+    /**
+     * Assignment operator, which leaves the reference count of this object unchanged.
+     *
+     * @param copy The Ref object to assign from.
+     */
+    Ref& operator=(const Ref& copy);
+
     /**
      * Destructor.
      */
     virtual ~Ref();
 
+    /**
+     * Returns whether this object must be destroyed on the main thread.
+     *
+     * Objects owning graphics resources return true, since the graphics
+     * context is only current on the main thread.
+     *
+     * @return true if the object must be destroyed on the main thread.
+     */
+    virtual bool isDestroyedOnMainThread() const;
+
 private:
 
+    /**
+     * Records the calling thread as the main thread.
+     *
+     * Called by Game on the thread that runs the game loop.
+     */
+    static void setMainThread();
+
+    /**
+     * Destroys the objects whose destruction was deferred to the main thread.
+     *
+     * Called by Game at the start of every frame and at shutdown.
+     */
+    static void destroyPending();
+
+    /**
+     * Destroys this object, once its reference count has reached zero.
+     */
+    void destroy();
+
+#ifdef GP_USE_NON_ATOMIC_REF_COUNT
     unsigned int _refCount;
+#else
+    std::atomic<unsigned int> _refCount;
+#endif
 
     // Memory leak diagnostic data (only included when GP_USE_MEM_LEAK_DETECTION is defined)
 #ifdef GP_USE_MEM_LEAK_DETECTION
-    friend class Game;
     static void printLeaks();
     void* __record;
 #endif
@@ -0,0 +1,639 @@
+#include "Base.h"
+#include "RenderQueue.h"
+#include "Scene.h"
+#include "Model.h"
+#include "Terrain.h"
+#include "Material.h"
+#include "Technique.h"
+#include "Pass.h"
+#include "GLStateCache.h"
+#include "FrameCapture.h"
+#include "OcclusionCuller.h"
+#include "Game.h"
+#include "MeshSkin.h"
+#include "Joint.h"
+
+// Sort key layout, from the most significant bit down. Opaque draws are grouped by
+// state and then ordered front to back. Transparent draws are ordered back to front.
+//
+//   opaque:      layer(4) | 0 | effect(12) | technique(16) | texture(12) | depth(19)
+//   transparent: layer(4) | 1 | inverse depth(19) | effect(12) | technique(16) | texture(12)
+#define RENDER_QUEUE_LAYER_SHIFT 60
+#define RENDER_QUEUE_TRANSPARENT_BIT (1ULL << 59)
+#define RENDER_QUEUE_EFFECT_BITS 12
+#define RENDER_QUEUE_TECHNIQUE_BITS 16
+#define RENDER_QUEUE_TEXTURE_BITS 12
+#define RENDER_QUEUE_DEPTH_BITS 19
+
+// Minimum number of visible nodes for a scene to be recorded across command buffers.
+#define RENDER_QUEUE_PARALLEL_SUBMIT_NODES 256
+
+// Minimum number of skins whose matrix palettes are computed on the job system.
+#define RENDER_QUEUE_PARALLEL_SKINS 4
+
+namespace gameplay
+{
+
+// Folds a pointer or handle into the given number of bits. Collisions only weaken the grouping of draws.
+static unsigned long long foldKey(size_t value, unsigned int bits)
+{
+    value ^= value >> 16;
+    value ^= value >> 8;
+    return (unsigned long long)(value & ((1u << bits) - 1));
+}
+
+// Gets the texture handle of the first sampler parameter of a render state.
+static TextureHandle getFirstTexture(RenderState* state)
+{
+    for (unsigned int i = 0, count = state->getParameterCount(); i < count; ++i)
+    {
+        Texture::Sampler* sampler = state->getParameterByIndex(i)->getSampler();
+        if (sampler && sampler->getTexture())
+            return sampler->getTexture()->getHandle();
+    }
+    return 0;
+}
+
+// Determines if every pass of a technique binds an instance matrix attribute.
+static bool isInstanced(Technique* technique)
+{
+    for (unsigned int i = 0, count = technique->getPassCount(); i < count; ++i)
+    {
+        if (technique->getPassByIndex(i)->getInstanceMatrixAttribute() == NULL)
+            return false;
+    }
+    return true;
+}
+
+// Determines if a render state enables blending.
+static bool isBlended(RenderState* state)
+{
+    RenderState::StateBlock* stateBlock = state->getStateBlock();
+    return stateBlock && stateBlock->isBlendEnabled();
+}
+
+RenderQueue::CommandBuffer::CommandBuffer(const RenderQueue* queue)
+    : _queue(queue), _depthPrepassCount(0)
+{
+}
+
+void RenderQueue::CommandBuffer::submit(Drawable* drawable, unsigned int layer)
+{
+    _depthPrepassCount += _queue->record(_draws, drawable, layer);
+}
+
+unsigned int RenderQueue::CommandBuffer::getDrawCount() const
+{
+    return (unsigned int)_draws.size();
+}
+
+void RenderQueue::CommandBuffer::clear()
+{
+    _draws.clear();
+    _depthPrepassCount = 0;
+}
+
+RenderQueue::RenderQueue()
+    : _camera(NULL), _occlusionCuller(NULL), _instanceBuffer(0), _instancing(false), _depthPrepassCount(0)
+{
+#ifdef GP_USE_INSTANCING
+    _instancing = glVertexAttribDivisor && glDrawElementsInstanced && glDrawArraysInstanced;
+#endif
+}
+
+RenderQueue::~RenderQueue()
+{
+    for (size_t i = 0, count = _commandBuffers.size(); i < count; ++i)
+    {
+        SAFE_DELETE(_commandBuffers[i]);
+    }
+    SAFE_RELEASE(_camera);
+    if (_instanceBuffer)
+    {
+        GLStateCache::deleteBuffer(_instanceBuffer);
+    }
+}
+
+RenderQueue* RenderQueue::create(unsigned int initialCapacity)
+{
+    RenderQueue* queue = new RenderQueue();
+    queue->_draws.reserve(initialCapacity);
+    queue->_sorted.reserve(initialCapacity);
+    return queue;
+}
+
+void RenderQueue::setCamera(Camera* camera)
+{
+    if (_camera != camera)
+    {
+        SAFE_RELEASE(_camera);
+        _camera = camera;
+        if (_camera)
+            _camera->addRef();
+    }
+}
+
+Camera* RenderQueue::getCamera() const
+{
+    return _camera;
+}
+
+void RenderQueue::setOcclusionCuller(OcclusionCuller* culler)
+{
+    _occlusionCuller = culler;
+}
+
+OcclusionCuller* RenderQueue::getOcclusionCuller() const
+{
+    return _occlusionCuller;
+}
+
+void RenderQueue::submit(Drawable* drawable, unsigned int layer)
+{
+    _depthPrepassCount += record(_draws, drawable, layer);
+}
+
+unsigned int RenderQueue::record(std::vector<Draw>& draws, Drawable* drawable, unsigned int layer) const
+{
+    GP_ASSERT(drawable);
+    GP_ASSERT(layer < LAYER_COUNT);
+
+    const unsigned long long layerKey = (unsigned long long)layer << RENDER_QUEUE_LAYER_SHIFT;
+    const unsigned long long depthMax = (1ULL << RENDER_QUEUE_DEPTH_BITS) - 1;
+    const unsigned long long depth = (unsigned long long)(getDepth(drawable->getNode()) * depthMax);
+
+    Model* model = dynamic_cast<Model*>(drawable);
+    if (model == NULL)
+    {
+        // Other drawables bind their own state. Everything except terrain is drawn blended.
+        Draw draw;
+        draw.drawable = drawable;
+        draw.model = NULL;
+        draw.part = 0;
+        draw.lod = 0;
+        draw.instanced = false;
+        draw.depthPrepass = false;
+        draw.instanceCount = 1;
+        if (dynamic_cast<Terrain*>(drawable))
+            draw.key = layerKey | depth;
+        else
+            draw.key = layerKey | RENDER_QUEUE_TRANSPARENT_BIT | ((depthMax - depth) << (RENDER_QUEUE_LAYER_SHIFT - 1 - RENDER_QUEUE_DEPTH_BITS));
+        draws.push_back(draw);
+        return 0;
+    }
+
+    // The level of detail is only selected once the draws are merged, since that binds vertex attributes.
+    GP_ASSERT(model->getMesh());
+    const unsigned int lod = _camera ? model->computeLod(_camera) : model->getLod();
+    Mesh* mesh = model->getLodMesh(lod);
+    unsigned int depthPrepassCount = 0;
+    unsigned int partCount = mesh->getPartCount();
+    for (unsigned int i = 0, count = std::max(partCount, 1u); i < count; ++i)
+    {
+        Material* material = model->getMaterial(partCount > 0 ? (int)i : -1);
+        if (material == NULL)
+            continue;
+
+        Technique* technique = material->getTechnique();
+        GP_ASSERT(technique);
+        if (technique->getPassCount() == 0)
+            continue;
+        Pass* pass = technique->getPassByIndex(0);
+        GP_ASSERT(pass);
+
+        TextureHandle texture = getFirstTexture(pass);
+        if (texture == 0)
+            texture = getFirstTexture(technique);
+        if (texture == 0)
+            texture = getFirstTexture(material);
+
+        unsigned long long state = foldKey((size_t)pass->getEffect(), RENDER_QUEUE_EFFECT_BITS);
+        state = (state << RENDER_QUEUE_TECHNIQUE_BITS) | foldKey((size_t)technique, RENDER_QUEUE_TECHNIQUE_BITS);
+        state = (state << RENDER_QUEUE_TEXTURE_BITS) | foldKey((size_t)texture, RENDER_QUEUE_TEXTURE_BITS);
+
+        Draw draw;
+        draw.drawable = drawable;
+        draw.model = model;
+        draw.part = i;
+        draw.lod = lod;
+        draw.instanced = false;
+        draw.depthPrepass = false;
+        draw.instanceCount = 1;
+        if (isBlended(pass) || isBlended(technique) || isBlended(material))
+        {
+            draw.key = layerKey | RENDER_QUEUE_TRANSPARENT_BIT | ((depthMax - depth) << (RENDER_QUEUE_LAYER_SHIFT - 1 - RENDER_QUEUE_DEPTH_BITS)) | state;
+        }
+        else if (_instancing && drawable->getNode() && model->getSkin() == NULL && isInstanced(technique))
+        {
+            // Instanced draws are grouped by mesh part instead of depth so that they can be merged.
+            draw.instanced = true;
+            draw.key = layerKey | (state << RENDER_QUEUE_DEPTH_BITS) | foldKey((size_t)mesh + i, RENDER_QUEUE_DEPTH_BITS);
+        }
+        else
+        {
+            draw.key = layerKey | (state << RENDER_QUEUE_DEPTH_BITS) | depth;
+            if (technique->isDepthPrepass() && pass->getInstanceMatrixAttribute() == NULL)
+            {
+                draw.depthPrepass = true;
+                ++depthPrepassCount;
+            }
+        }
+        draws.push_back(draw);
+    }
+    return depthPrepassCount;
+}
+
+unsigned int RenderQueue::submit(Scene* scene, unsigned int layer)
+{
+    GP_ASSERT(scene);
+
+    if (_camera == NULL)
+        setCamera(scene->getActiveCamera());
+    if (_camera == NULL)
+    {
+        GP_WARN("Cannot submit the scene '%s' to the render queue without a camera.", scene->getId());
+        return 0;
+    }
+
+    std::vector<Node*> nodes;
+    scene->findVisibleNodes(_camera->getFrustum(), nodes);
+    return submitNodes(nodes, layer);
+}
+
+unsigned int RenderQueue::submit(const std::vector<Node*>& nodes, const std::vector<unsigned int>& viewMasks, unsigned int view, unsigned int layer)
+{
+    GP_ASSERT(nodes.size() == viewMasks.size());
+    GP_ASSERT(view < 32);
+
+    if (_camera == NULL)
+    {
+        GP_WARN("Cannot submit the nodes of a view to the render queue without a camera.");
+        return 0;
+    }
+
+    std::vector<Node*> viewNodes;
+    const unsigned int bit = 1u << view;
+    for (size_t i = 0, count = nodes.size(); i < count; ++i)
+    {
+        if (viewMasks[i] & bit)
+            viewNodes.push_back(nodes[i]);
+    }
+    return submitNodes(viewNodes, layer);
+}
+
+unsigned int RenderQueue::submitNodes(std::vector<Node*>& nodes, unsigned int layer)
+{
+    if (_occlusionCuller)
+    {
+        _occlusionCuller->cull(_camera, nodes);
+        nodes.erase(std::remove_if(nodes.begin(), nodes.end(), [](Node* node) { return node->isOccluded(); }), nodes.end());
+    }
+
+    const unsigned int nodeCount = (unsigned int)nodes.size();
+    const unsigned int bufferCount = (unsigned int)_commandBuffers.size();
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem && bufferCount > 1 && nodeCount >= RENDER_QUEUE_PARALLEL_SUBMIT_NODES)
+    {
+        // Finding the visible nodes resolved their transforms, so recording only reads them.
+        beginRecording();
+        jobSystem->parallelFor(0, bufferCount, [this, &nodes, nodeCount, bufferCount, layer](unsigned int first, unsigned int last)
+        {
+            for (unsigned int i = first; i < last; ++i)
+            {
+                CommandBuffer* buffer = _commandBuffers[i];
+                for (unsigned int j = nodeCount * i / bufferCount, end = nodeCount * (i + 1) / bufferCount; j < end; ++j)
+                {
+                    buffer->submit(nodes[j]->getDrawable(), layer);
+                }
+            }
+        }, 1);
+    }
+    else
+    {
+        for (unsigned int i = 0; i < nodeCount; ++i)
+        {
+            submit(nodes[i]->getDrawable(), layer);
+        }
+    }
+    return nodeCount;
+}
+
+void RenderQueue::setCommandBufferCount(unsigned int count)
+{
+    while (_commandBuffers.size() > count)
+    {
+        SAFE_DELETE(_commandBuffers.back());
+        _commandBuffers.pop_back();
+    }
+    while (_commandBuffers.size() < count)
+    {
+        _commandBuffers.push_back(new CommandBuffer(this));
+    }
+    for (size_t i = 0, bufferCount = _commandBuffers.size(); i < bufferCount; ++i)
+    {
+        _commandBuffers[i]->clear();
+    }
+}
+
+unsigned int RenderQueue::getCommandBufferCount() const
+{
+    return (unsigned int)_commandBuffers.size();
+}
+
+RenderQueue::CommandBuffer* RenderQueue::getCommandBuffer(unsigned int index) const
+{
+    GP_ASSERT(index < _commandBuffers.size());
+    return _commandBuffers[index];
+}
+
+void RenderQueue::beginRecording()
+{
+    // The world matrix of the camera node is computed lazily, which is not safe from several threads.
+    if (_camera && _camera->getNode())
+        _camera->getNode()->getWorldMatrix();
+}
+
+void RenderQueue::updateSkins()
+{
+    GP_PROFILE_SCOPE("RenderQueue::updateSkins");
+
+    _skins.clear();
+    for (size_t i = 0, count = _draws.size(); i < count; ++i)
+    {
+        MeshSkin* skin = _draws[i].model ? _draws[i].model->getSkin() : NULL;
+        if (skin && (skin->_paletteDirty || skin->_paletteReset))
+            _skins.push_back(skin);
+    }
+    if (_skins.empty())
+        return;
+    std::sort(_skins.begin(), _skins.end());
+    _skins.erase(std::unique(_skins.begin(), _skins.end()), _skins.end());
+
+    // Skins that share joints mark each other dirty and write the same joints, so they are
+    // computed here. The others only read the world matrix of the parent of their root joint,
+    // which is resolved first since it may be shared with other skins.
+    size_t skinCount = 0;
+    for (size_t i = 0, count = _skins.size(); i < count; ++i)
+    {
+        MeshSkin* skin = _skins[i];
+        if (skin->hasSharedJoints())
+        {
+            skin->updateMatrixPalette();
+            continue;
+        }
+        if (skin->_rootJoint && skin->_rootJoint->getParent())
+            skin->_rootJoint->getParent()->getWorldMatrix();
+        _skins[skinCount++] = skin;
+    }
+    _skins.resize(skinCount);
+
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem && skinCount >= RENDER_QUEUE_PARALLEL_SKINS)
+    {
+        jobSystem->parallelFor(0, (unsigned int)skinCount, [this](unsigned int first, unsigned int last)
+        {
+            for (unsigned int i = first; i < last; ++i)
+            {
+                _skins[i]->updateMatrixPalette();
+            }
+        }, 1);
+    }
+    else
+    {
+        for (size_t i = 0; i < skinCount; ++i)
+        {
+            _skins[i]->updateMatrixPalette();
+        }
+    }
+}
+
+void RenderQueue::mergeCommandBuffers()
+{
+    for (size_t i = 0, count = _commandBuffers.size(); i < count; ++i)
+    {
+        CommandBuffer* buffer = _commandBuffers[i];
+        _draws.insert(_draws.end(), buffer->_draws.begin(), buffer->_draws.end());
+        _depthPrepassCount += buffer->_depthPrepassCount;
+        buffer->clear();
+    }
+}
+
+unsigned int RenderQueue::draw(bool wireframe)
+{
+    GP_PROFILE_SCOPE("RenderQueue::draw");
+    GP_PROFILE_GPU_SCOPE("RenderQueue::draw");
+
+    mergeCommandBuffers();
+
+    // Select the levels of detail the draws were recorded with, in case the models were
+    // recorded from other threads.
+    for (size_t i = 0, count = _draws.size(); i < count; ++i)
+    {
+        const Draw& draw = _draws[i];
+        if (draw.model)
+            draw.model->setLod(draw.lod);
+    }
+
+    updateSkins();
+    sort();
+
+#ifdef GP_USE_INSTANCING
+    // Wireframes are drawn one triangle at a time, so they are never instanced.
+    if (_instancing && !wireframe)
+        gatherInstances();
+    unsigned int instanceOffset = 0;
+#endif
+
+    unsigned int drawCount = 0;
+    size_t layerEnd = 0;
+    for (size_t i = 0, count = _draws.size(); i < count; i += _draws[i].instanceCount, ++drawCount)
+    {
+        // The depth of each layer is laid down before any of its draws.
+        if (i >= layerEnd && _depthPrepassCount > 0 && !wireframe)
+            layerEnd = drawDepthPrepass(i, &drawCount);
+
+        const Draw& draw = _draws[i];
+#ifdef GP_USE_INSTANCING
+        if (draw.instanceCount > 1)
+        {
+            draw.model->drawPartInstanced(draw.part, _instanceBuffer, instanceOffset, draw.instanceCount);
+            instanceOffset += draw.instanceCount;
+            continue;
+        }
+#endif
+        if (draw.model)
+        {
+            draw.model->drawPart(draw.part, wireframe, draw.depthPrepass && !wireframe);
+        }
+        else
+        {
+            FrameCapture::Source source(draw.drawable->getNode(), NULL);
+            draw.drawable->draw(wireframe);
+        }
+    }
+
+    // Test the culled nodes against the depth of what was just drawn, for the next frame.
+    if (_occlusionCuller)
+        _occlusionCuller->test();
+
+    clear();
+    return drawCount;
+}
+
+void RenderQueue::clear()
+{
+    _draws.clear();
+    _depthPrepassCount = 0;
+    for (size_t i = 0, count = _commandBuffers.size(); i < count; ++i)
+    {
+        _commandBuffers[i]->clear();
+    }
+}
+
+unsigned int RenderQueue::getDrawCount() const
+{
+    return (unsigned int)_draws.size();
+}
+
+float RenderQueue::getDepth(Node* node) const
+{
+    Node* cameraNode = _camera ? _camera->getNode() : NULL;
+    if (node == NULL || cameraNode == NULL)
+        return 0.0f;
+
+    Vector3 offset = node->getTranslationWorld() - cameraNode->getTranslationWorld();
+    float depth = offset.dot(cameraNode->getForwardVectorWorld()) / _camera->getFarPlane();
+    return MATH_CLAMP(depth, 0.0f, 1.0f);
+}
+
+void RenderQueue::sort()
+{
+    GP_PROFILE_SCOPE("RenderQueue::sort");
+
+    // Least significant digit radix sort on 8 bits at a time. It is stable, so draws
+    // with equal keys keep their submission order.
+    const size_t count = _draws.size();
+    if (count < 2)
+        return;
+
+    _sorted.resize(count);
+    for (unsigned int shift = 0; shift < 64; shift += 8)
+    {
+        unsigned int offsets[256] = { 0 };
+        for (size_t i = 0; i < count; ++i)
+        {
+            ++offsets[(_draws[i].key >> shift) & 0xFF];
+        }
+
+        // Skip the digits that all of the keys share.
+        if (offsets[(_draws[0].key >> shift) & 0xFF] == count)
+            continue;
+
+        unsigned int total = 0;
+        for (unsigned int digit = 0; digit < 256; ++digit)
+        {
+            unsigned int digitCount = offsets[digit];
+            offsets[digit] = total;
+            total += digitCount;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            _sorted[offsets[(_draws[i].key >> shift) & 0xFF]++] = _draws[i];
+        }
+        _draws.swap(_sorted);
+    }
+}
+
+size_t RenderQueue::drawDepthPrepass(size_t first, unsigned int* drawCount)
+{
+    GP_PROFILE_SCOPE("RenderQueue::drawDepthPrepass");
+
+    const unsigned long long layer = _draws[first].key >> RENDER_QUEUE_LAYER_SHIFT;
+    size_t end = first;
+    bool colorMasked = false;
+    for (size_t count = _draws.size(); end < count && (_draws[end].key >> RENDER_QUEUE_LAYER_SHIFT) == layer; ++end)
+    {
+        Draw& draw = _draws[end];
+        if (!draw.depthPrepass)
+            continue;
+
+        if (!colorMasked)
+        {
+            GL_ASSERT( glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE) );
+            colorMasked = true;
+        }
+
+        // Without a depth effect the draw is shaded as if it had no pre-pass.
+        if (draw.model->drawPartDepth(draw.part))
+            ++(*drawCount);
+        else
+            draw.depthPrepass = false;
+    }
+
+    if (colorMasked)
+    {
+        GL_ASSERT( glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE) );
+    }
+    return end;
+}
+
+#ifdef GP_USE_INSTANCING
+void RenderQueue::gatherInstances()
+{
+    GP_PROFILE_SCOPE("RenderQueue::gatherInstances");
+
+    _instances.clear();
+    for (size_t i = 0, count = _draws.size(); i < count;)
+    {
+        Draw& first = _draws[i];
+        size_t end = i + 1;
+        if (first.instanced)
+        {
+            // Draws with the same state bits and material are in the same layer and technique. Their
+            // parameter blocks are set once for the whole instanced draw, so those must match as well.
+            Material* material = first.model->getMaterial(first.model->getMesh()->getPartCount() > 0 ? (int)first.part : -1);
+            while (end < count)
+            {
+                const Draw& next = _draws[end];
+                if (!next.instanced || (next.key >> RENDER_QUEUE_DEPTH_BITS) != (first.key >> RENDER_QUEUE_DEPTH_BITS) ||
+                    next.part != first.part || next.model->getLodMesh(next.model->getLod()) != first.model->getLodMesh(first.model->getLod()) ||
+                    next.model->getMaterial(next.model->getMesh()->getPartCount() > 0 ? (int)next.part : -1) != material ||
+                    next.model->_parameterBlock != first.model->_parameterBlock)
+                {
+                    break;
+                }
+                ++end;
+            }
+        }
+
+        first.instanceCount = (unsigned int)(end - i);
+        if (first.instanceCount > 1)
+        {
+            for (size_t j = i; j < end; ++j)
+            {
+                const Matrix& matrix = _draws[j].drawable->getNode()->getWorldMatrix();
+                const Vector4& data = _draws[j].model->getInstanceData();
+                _instances.insert(_instances.end(), matrix.m, matrix.m + 16);
+                _instances.push_back(data.x);
+                _instances.push_back(data.y);
+                _instances.push_back(data.z);
+                _instances.push_back(data.w);
+            }
+        }
+        i = end;
+    }
+
+    if (_instances.empty())
+        return;
+
+    if (_instanceBuffer == 0)
+    {
+        GL_ASSERT( glGenBuffers(1, &_instanceBuffer) );
+    }
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, _instanceBuffer);
+    GL_ASSERT( glBufferData(GL_ARRAY_BUFFER, _instances.size() * sizeof(float), &_instances[0], GL_STREAM_DRAW) );
+    FrameCapture::record(FrameCapture::UPLOAD_BUFFER, GL_ARRAY_BUFFER, _instanceBuffer, 0, (unsigned int)(_instances.size() * sizeof(float)));
+}
+#endif
+
+}
@@ -0,0 +1,365 @@
+#ifndef RENDERQUEUE_H_
+#define RENDERQUEUE_H_
+
+#include "Drawable.h"
+#include "Matrix.h"
+
+namespace gameplay
+{
+
+class Camera;
+class MeshSkin;
+class Model;
+class Node;
+class OcclusionCuller;
+class Scene;
+
+/**
+ * Defines a queue of draws that are sorted by render state before they are executed.
+ *
+ * Drawing a scene by visiting its nodes draws them in hierarchy order, which
+ * switches programs, textures and render states between almost every draw. A
+ * render queue instead collects the drawables to draw for a frame, assigns each
+ * draw a 64-bit sort key and draws them in key order.
+ *
+ * Models are submitted per mesh part, since each part may use a different material.
+ * The key of each draw packs, from the most significant bits down: a user layer,
+ * whether the draw is transparent, and then for opaque draws the effect, technique,
+ * texture and view depth, so that opaque draws are grouped by state and drawn front
+ * to back within each group. Transparent draws (draws whose material enables blending,
+ * as well as forms, text, sprites, tile sets and particle emitters) are drawn after
+ * the opaque draws of their layer, back to front.
+ *
+ * Layers are drawn in increasing order and can be used to force an ordering, such
+ * as drawing a sky box before everything else.
+ *
+ * Opaque draws whose material binds a vertex attribute to RenderState::INSTANCE_WORLD_MATRIX
+ * in every pass are sorted by mesh part instead of depth within their state group. Where
+ * hardware instancing is supported, consecutive draws of the same mesh part with the same
+ * material are then drawn with a single instanced draw call, with the world matrices of
+ * their nodes streamed into an instance buffer, along with the Model::getInstanceData()
+ * of each model for materials that bind a vertex attribute to RenderState::INSTANCE_DATA.
+ *
+ * Opaque draws whose technique enables Technique::setDepthPrepass() are drawn with a
+ * depth pre-pass: before the draws of a layer, the depth of these draws is drawn front
+ * to back with the depth effect of their passes and writes to the color buffer disabled.
+ * Their passes are then drawn with the depth test set to equal, so that the expensive
+ * fragment shaders only run for the visible pixels. Instanced draws and wireframes are
+ * drawn without a pre-pass.
+ */
+class RenderQueue
+{
+    struct Draw
+    {
+        unsigned long long key;
+        Drawable* drawable;
+        Model* model;
+        unsigned int part;
+        unsigned int lod;
+        bool instanced;
+        bool depthPrepass;
+        unsigned int instanceCount;
+    };
+
+public:
+
+    /**
+     * Defines a list of draws recorded apart from its queue.
+     *
+     * Command buffers let several threads record draws at once: each thread submits the
+     * drawables of its own part of a scene to its own command buffer, which selects their
+     * levels of detail, finds their materials and computes their sort keys without making
+     * any GL calls. When the queue is drawn, the draws of its command buffers are merged
+     * into it in index order, and the GL thread is only left to sort and execute them.
+     *
+     * Recording only reads the drawables, their nodes and the camera of the queue, which
+     * must not be changed until the queue is drawn. beginRecording() must be called on the
+     * main thread before filling the command buffers from job system workers.
+     *
+     * @script{ignore}
+     */
+    class CommandBuffer
+    {
+        friend class RenderQueue;
+
+    public:
+
+        /**
+         * Records the draws of a drawable.
+         *
+         * @param drawable The drawable to draw. It must remain valid until the queue is drawn or cleared.
+         * @param layer The layer to draw the drawable in, less than LAYER_COUNT.
+         */
+        void submit(Drawable* drawable, unsigned int layer = 0);
+
+        /**
+         * Gets the number of draws recorded since the queue was last drawn or cleared.
+         *
+         * @return The number of draws.
+         */
+        unsigned int getDrawCount() const;
+
+    private:
+
+        CommandBuffer(const RenderQueue* queue);
+
+        CommandBuffer(const CommandBuffer&);
+
+        CommandBuffer& operator=(const CommandBuffer&);
+
+        void clear();
+
+        const RenderQueue* _queue;
+        std::vector<Draw> _draws;
+        unsigned int _depthPrepassCount;
+    };
+
+    /**
+     * The number of layers available to submitted draws.
+     */
+    static const unsigned int LAYER_COUNT = 16;
+
+    /**
+     * Creates a new render queue.
+     *
+     * @param initialCapacity The initial number of draws the queue has space for.
+     *
+     * @return A new render queue.
+     * @script{create}
+     */
+    static RenderQueue* create(unsigned int initialCapacity = 256);
+
+    /**
+     * Destructor.
+     */
+    ~RenderQueue();
+
+    /**
+     * Sets the camera used to compute the depth of submitted draws.
+     *
+     * This should be set before submitting draws. If no camera is set, all
+     * draws are considered to be at the same depth.
+     *
+     * @param camera The camera to sort draws for.
+     */
+    void setCamera(Camera* camera);
+
+    /**
+     * Gets the camera used to compute the depth of submitted draws.
+     *
+     * @return The camera to sort draws for.
+     */
+    Camera* getCamera() const;
+
+    /**
+     * Sets the occlusion culler used when submitting scenes.
+     *
+     * When set, submit(Scene*) culls the visible nodes with it and skips the nodes that are
+     * occluded, and draw() issues its occlusion queries once the draws have been executed.
+     * The culler is not owned by the queue and must outlive its use.
+     *
+     * @param culler The occlusion culler, or NULL to disable occlusion culling.
+     * @script{ignore}
+     */
+    void setOcclusionCuller(OcclusionCuller* culler);
+
+    /**
+     * Gets the occlusion culler used when submitting scenes.
+     *
+     * @return The occlusion culler, or NULL if none is set.
+     * @script{ignore}
+     */
+    OcclusionCuller* getOcclusionCuller() const;
+
+    /**
+     * Submits a drawable to be drawn.
+     *
+     * @param drawable The drawable to draw. It must remain valid until the queue is drawn or cleared.
+     * @param layer The layer to draw the drawable in, less than LAYER_COUNT.
+     */
+    void submit(Drawable* drawable, unsigned int layer = 0);
+
+    /**
+     * Submits the drawables of all nodes in the scene that are visible from the camera.
+     *
+     * The visible nodes are found with Scene::findVisibleNodes(), which uses the
+     * spatial index of the scene when it is enabled, and nodes found occluded by the
+     * occlusion culler of the queue are skipped. If no camera has been set on the queue,
+     * the active camera of the scene is set.
+     *
+     * When the queue has more than one command buffer and there are enough visible nodes,
+     * the nodes are split between the command buffers and recorded on the threads of the
+     * job system.
+     *
+     * @param scene The scene to draw.
+     * @param layer The layer to draw the scene's drawables in, less than LAYER_COUNT.
+     *
+     * @return The number of nodes submitted.
+     */
+    unsigned int submit(Scene* scene, unsigned int layer = 0);
+
+    /**
+     * Submits the drawables of the nodes visible from one of the views culled together by
+     * Scene::findVisibleNodes().
+     *
+     * This lets the queues of several cameras, such as the views of a split screen, share a
+     * single culling pass of the scene. Nodes found occluded by the occlusion culler of the
+     * queue are skipped, and the nodes are recorded as they are by submit(Scene*, unsigned int).
+     * The camera of the queue must be set, and should be the camera of the view.
+     *
+     * @param nodes The nodes found visible from any of the views.
+     * @param viewMasks The mask of views of each node.
+     * @param view The index of the view to submit the nodes of, less than 32.
+     * @param layer The layer to draw the drawables in, less than LAYER_COUNT.
+     *
+     * @return The number of nodes submitted.
+     * @script{ignore}
+     */
+    unsigned int submit(const std::vector<Node*>& nodes, const std::vector<unsigned int>& viewMasks, unsigned int view, unsigned int layer = 0);
+
+    /**
+     * Sets the number of command buffers of the queue.
+     *
+     * Typically this is the thread count of the job system. This must not be called
+     * while command buffers are being recorded, and discards the draws they hold.
+     *
+     * @param count The number of command buffers.
+     * @script{ignore}
+     */
+    void setCommandBufferCount(unsigned int count);
+
+    /**
+     * Gets the number of command buffers of the queue.
+     *
+     * @return The number of command buffers.
+     * @script{ignore}
+     */
+    unsigned int getCommandBufferCount() const;
+
+    /**
+     * Gets a command buffer of the queue.
+     *
+     * @param index The index of the command buffer, less than getCommandBufferCount().
+     *
+     * @return The command buffer.
+     * @script{ignore}
+     */
+    CommandBuffer* getCommandBuffer(unsigned int index) const;
+
+    /**
+     * Prepares the queue for recording its command buffers from other threads.
+     *
+     * This resolves the transform of the camera, which recording reads, and must be called
+     * on the main thread once the camera is set and has moved for the frame.
+     *
+     * @script{ignore}
+     */
+    void beginRecording();
+
+    /**
+     * Sorts and draws all of the submitted draws, including those recorded in the
+     * command buffers of the queue, then clears the queue.
+     *
+     * @param wireframe true to request to draw wireframes only.
+     *
+     * @return The number of draw calls executed, where an instanced draw counts once.
+     */
+    unsigned int draw(bool wireframe = false);
+
+    /**
+     * Removes all of the submitted draws without drawing them.
+     */
+    void clear();
+
+    /**
+     * Gets the number of submitted draws.
+     *
+     * @return The number of draws in the queue.
+     */
+    unsigned int getDrawCount() const;
+
+private:
+
+    /**
+     * Constructor.
+     */
+    RenderQueue();
+
+    /**
+     * Hidden copy constructor.
+     */
+    RenderQueue(const RenderQueue&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    RenderQueue& operator=(const RenderQueue&);
+
+    /**
+     * Adds the draws of a drawable to a list of draws.
+     *
+     * This makes no GL calls and only reads the drawable and the queue, so it is safe to
+     * call from several threads with different lists.
+     *
+     * @return The number of draws added that have a depth pre-pass.
+     */
+    unsigned int record(std::vector<Draw>& draws, Drawable* drawable, unsigned int layer) const;
+
+    /**
+     * Appends the draws of the command buffers to the queue and clears them.
+     */
+    void mergeCommandBuffers();
+
+    /**
+     * Skips the occluded nodes and records the drawables of the others.
+     *
+     * @return The number of nodes submitted.
+     */
+    unsigned int submitNodes(std::vector<Node*>& nodes, unsigned int layer);
+
+    /**
+     * Gets the view depth of a node, normalized to [0, 1] over the camera's clip range.
+     */
+    float getDepth(Node* node) const;
+
+    /**
+     * Computes the matrix palettes of the skins of the submitted draws whose joints moved,
+     * on the job system when there are enough of them.
+     */
+    void updateSkins();
+
+    /**
+     * Sorts the submitted draws by key.
+     */
+    void sort();
+
+    /**
+     * Draws the depth pre-pass of the draws in the layer of the given draw.
+     *
+     * @return The index of the first draw after the layer.
+     */
+    size_t drawDepthPrepass(size_t first, unsigned int* drawCount);
+
+#ifdef GP_USE_INSTANCING
+    /**
+     * Merges consecutive instanced draws of the same mesh part and material and uploads
+     * the world matrices and instance data of the merged draws to the instance buffer.
+     */
+    void gatherInstances();
+#endif
+
+    Camera* _camera;
+    OcclusionCuller* _occlusionCuller;
+    std::vector<Draw> _draws;
+    std::vector<Draw> _sorted;
+    std::vector<CommandBuffer*> _commandBuffers;
+    std::vector<float> _instances;
+    std::vector<MeshSkin*> _skins;
+    VertexBufferHandle _instanceBuffer;
+    bool _instancing;
+    unsigned int _depthPrepassCount;
+};
+
+}
+
+#endif
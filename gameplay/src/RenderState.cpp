@@ -5,6 +5,10 @@
 #include "Technique.h"
 #include "Node.h"
 #include "Scene.h"
+#include "FrameStats.h"
+#include "FrameCapture.h"
+#include "ViewUniformBuffer.h"
+#include "JointTexture.h"
 
 // Render state override bits
 #define RS_BLEND 1
@@ -27,6 +31,8 @@ namespace gameplay
 
 RenderState::StateBlock* RenderState::StateBlock::_defaultState = NULL;
 std::vector<RenderState::AutoBindingResolver*> RenderState::_customAutoBindingResolvers;
+RenderState::StateBlock* RenderState::_depthPrepassState = NULL;
+RenderState::StateBlock* RenderState::_depthEqualState = NULL;
 
 RenderState::RenderState()
     : _nodeBinding(NULL), _state(NULL), _parent(NULL)
@@ -50,10 +56,28 @@ void RenderState::initialize()
     {
         StateBlock::_defaultState = StateBlock::create();
     }
+
+    if (_depthPrepassState == NULL)
+    {
+        _depthPrepassState = StateBlock::create();
+        _depthPrepassState->setDepthTest(true);
+        _depthPrepassState->setDepthWrite(true);
+        _depthPrepassState->setBlend(false);
+    }
+
+    if (_depthEqualState == NULL)
+    {
+        _depthEqualState = StateBlock::create();
+        _depthEqualState->setDepthTest(true);
+        _depthEqualState->setDepthWrite(false);
+        _depthEqualState->setDepthFunction(DEPTH_EQUAL);
+    }
 }
 
 void RenderState::finalize()
 {
+    SAFE_RELEASE(_depthEqualState);
+    SAFE_RELEASE(_depthPrepassState);
     SAFE_RELEASE(StateBlock::_defaultState);
 }
 
@@ -90,6 +114,21 @@ MaterialParameter* RenderState::getParameterByIndex(unsigned int index)
     return _parameters[index];
 }
 
+MaterialParameter* RenderState::getParameterByHandle(unsigned int handle) const
+{
+    for (size_t i = 0, count = _parameters.size(); i < count; ++i)
+    {
+        MaterialParameter* param = _parameters[i];
+        GP_ASSERT(param);
+        if (param->_handle == handle)
+            return param;
+    }
+
+    MaterialParameter* param = new MaterialParameter(Effect::getUniformHandleName(handle));
+    _parameters.push_back(param);
+    return param;
+}
+
 void RenderState::addParameter(MaterialParameter* param)
 {
     _parameters.push_back(param);
@@ -121,6 +160,9 @@ const char* autoBindingToString(RenderState::AutoBinding autoBinding)
     case RenderState::NONE:
         return NULL;
 
+    case RenderState::WORLD_MATRIX:
+        return "WORLD_MATRIX";
+
     case RenderState::VIEW_MATRIX:
         return "VIEW_MATRIX";
 
@@ -154,11 +196,116 @@ const char* autoBindingToString(RenderState::AutoBinding autoBinding)
     case RenderState::SCENE_AMBIENT_COLOR:
         return "SCENE_AMBIENT_COLOR";
 
+    case RenderState::DUAL_QUATERNION_PALETTE:
+        return "DUAL_QUATERNION_PALETTE";
+
+    case RenderState::JOINT_TEXTURE:
+        return "JOINT_TEXTURE";
+
+    case RenderState::MATRIX_PALETTE_OFFSET:
+        return "MATRIX_PALETTE_OFFSET";
+
+    case RenderState::DUAL_QUATERNION_PALETTE_OFFSET:
+        return "DUAL_QUATERNION_PALETTE_OFFSET";
+
+    case RenderState::INSTANCE_WORLD_MATRIX:
+        return "INSTANCE_WORLD_MATRIX";
+
+    case RenderState::INSTANCE_DATA:
+        return "INSTANCE_DATA";
+
     default:
         return "";
     }
 }
 
+// Converts the name of a built-in auto binding to its value, or NONE if the name is not built-in.
+static RenderState::AutoBinding parseAutoBinding(const char* autoBinding)
+{
+    for (int i = RenderState::WORLD_MATRIX; i <= RenderState::INSTANCE_DATA; ++i)
+    {
+        if (strcmp(autoBinding, autoBindingToString((RenderState::AutoBinding)i)) == 0)
+            return (RenderState::AutoBinding)i;
+    }
+    return RenderState::NONE;
+}
+
+// Sets the value of a built-in auto binding for a node directly, without a method binding.
+static void setAutoBindingValue(Effect* effect, Uniform* uniform, RenderState::AutoBinding autoBinding, Node* node)
+{
+    switch (autoBinding)
+    {
+    case RenderState::WORLD_MATRIX:
+        effect->setValue(uniform, node ? node->getWorldMatrix() : Matrix::identity());
+        break;
+    case RenderState::VIEW_MATRIX:
+        effect->setValue(uniform, node ? node->getViewMatrix() : Matrix::identity());
+        break;
+    case RenderState::PROJECTION_MATRIX:
+        effect->setValue(uniform, node ? node->getProjectionMatrix() : Matrix::identity());
+        break;
+    case RenderState::WORLD_VIEW_MATRIX:
+        effect->setValue(uniform, node ? node->getWorldViewMatrix() : Matrix::identity());
+        break;
+    case RenderState::VIEW_PROJECTION_MATRIX:
+        effect->setValue(uniform, node ? node->getViewProjectionMatrix() : Matrix::identity());
+        break;
+    case RenderState::WORLD_VIEW_PROJECTION_MATRIX:
+        effect->setValue(uniform, node ? node->getWorldViewProjectionMatrix() : Matrix::identity());
+        break;
+    case RenderState::INVERSE_TRANSPOSE_WORLD_MATRIX:
+        effect->setValue(uniform, node ? node->getInverseTransposeWorldMatrix() : Matrix::identity());
+        break;
+    case RenderState::INVERSE_TRANSPOSE_WORLD_VIEW_MATRIX:
+        effect->setValue(uniform, node ? node->getInverseTransposeWorldViewMatrix() : Matrix::identity());
+        break;
+    case RenderState::CAMERA_WORLD_POSITION:
+        effect->setValue(uniform, node ? node->getActiveCameraTranslationWorld() : Vector3::zero());
+        break;
+    case RenderState::CAMERA_VIEW_POSITION:
+        effect->setValue(uniform, node ? node->getActiveCameraTranslationView() : Vector3::zero());
+        break;
+    case RenderState::MATRIX_PALETTE:
+        {
+            Model* model = node ? dynamic_cast<Model*>(node->getDrawable()) : NULL;
+            MeshSkin* skin = model ? model->getSkin() : NULL;
+            if (skin)
+                effect->setValue(uniform, skin->getMatrixPalette(), skin->getMatrixPaletteSize());
+        }
+        break;
+    case RenderState::SCENE_AMBIENT_COLOR:
+        {
+            Scene* scene = node ? node->getScene() : NULL;
+            effect->setValue(uniform, scene ? scene->getAmbientColor() : Vector3::zero());
+        }
+        break;
+    case RenderState::DUAL_QUATERNION_PALETTE:
+        {
+            Model* model = node ? dynamic_cast<Model*>(node->getDrawable()) : NULL;
+            MeshSkin* skin = model ? model->getSkin() : NULL;
+            if (skin)
+                effect->setValue(uniform, skin->getDualQuaternionPalette(), skin->getDualQuaternionPaletteSize());
+        }
+        break;
+    case RenderState::JOINT_TEXTURE:
+        if (Texture::Sampler* sampler = JointTexture::getSampler())
+            effect->setValue(uniform, sampler);
+        break;
+    case RenderState::MATRIX_PALETTE_OFFSET:
+    case RenderState::DUAL_QUATERNION_PALETTE_OFFSET:
+        {
+            // Writes the palette of the skin to the joint texture the first time it is bound in a frame.
+            Model* model = node ? dynamic_cast<Model*>(node->getDrawable()) : NULL;
+            MeshSkin* skin = model ? model->getSkin() : NULL;
+            if (skin)
+                effect->setValue(uniform, JointTexture::getPaletteOffset(skin, autoBinding == RenderState::DUAL_QUATERNION_PALETTE_OFFSET));
+        }
+        break;
+    default:
+        break;
+    }
+}
+
 void RenderState::setParameterAutoBinding(const char* name, AutoBinding autoBinding)
 {
     setParameterAutoBinding(name, autoBindingToString(autoBinding));
@@ -175,6 +322,16 @@ void RenderState::setParameterAutoBinding(const char* name, const char* autoBind
         std::map<std::string, std::string>::iterator itr = _autoBindings.find(name);
         if (itr != _autoBindings.end())
             _autoBindings.erase(itr);
+
+        for (size_t i = 0, count = _compiledAutoBindings.size(); i < count; ++i)
+        {
+            if (strcmp(_compiledAutoBindings[i].parameter->getName(), name) == 0)
+            {
+                _compiledAutoBindings.erase(_compiledAutoBindings.begin() + i);
+                break;
+            }
+        }
+        return;
     }
     else
     {
@@ -189,6 +346,28 @@ void RenderState::setParameterAutoBinding(const char* name, const char* autoBind
     }
 }
 
+const char* RenderState::getInstanceMatrixAttribute() const
+{
+    std::map<std::string, std::string>::const_iterator itr = _autoBindings.begin();
+    for (; itr != _autoBindings.end(); ++itr)
+    {
+        if (itr->second == "INSTANCE_WORLD_MATRIX")
+            return itr->first.c_str();
+    }
+    return _parent ? _parent->getInstanceMatrixAttribute() : NULL;
+}
+
+const char* RenderState::getInstanceDataAttribute() const
+{
+    std::map<std::string, std::string>::const_iterator itr = _autoBindings.begin();
+    for (; itr != _autoBindings.end(); ++itr)
+    {
+        if (itr->second == "INSTANCE_DATA")
+            return itr->first.c_str();
+    }
+    return _parent ? _parent->getInstanceDataAttribute() : NULL;
+}
+
 void RenderState::setStateBlock(StateBlock* state)
 {
     if (_state != state)
@@ -237,176 +416,71 @@ void RenderState::applyAutoBinding(const char* uniformName, const char* autoBind
 {
     GP_ASSERT(_nodeBinding);
 
+    // Instance matrices and data are vertex attributes supplied by the draw, not material parameters.
+    if (strcmp(autoBinding, "INSTANCE_WORLD_MATRIX") == 0 || strcmp(autoBinding, "INSTANCE_DATA") == 0)
+        return;
+
     MaterialParameter* param = getParameter(uniformName);
     GP_ASSERT(param);
 
-    bool bound = false;
-
-    // First attempt to resolve the binding using custom registered resolvers.
-    for (size_t i = 0, count = _customAutoBindingResolvers.size(); i < count; ++i)
+    // Forget any built-in binding previously compiled for this parameter.
+    for (std::vector<CompiledAutoBinding>::iterator itr = _compiledAutoBindings.begin(); itr != _compiledAutoBindings.end(); ++itr)
     {
-        if (_customAutoBindingResolvers[i]->resolveAutoBinding(autoBinding, _nodeBinding, param))
+        if (itr->parameter == param)
         {
-            // Handled by custom auto binding resolver
-            bound = true;
+            _compiledAutoBindings.erase(itr);
             break;
         }
     }
 
-    // Perform built-in resolution
-    if (!bound)
+    // First attempt to resolve the binding using custom registered resolvers.
+    for (size_t i = 0, count = _customAutoBindingResolvers.size(); i < count; ++i)
     {
-        bound = true;
-
-        if (strcmp(autoBinding, "WORLD_MATRIX") == 0)
-        {
-            param->bindValue(this, &RenderState::autoBindingGetWorldMatrix);
-        }
-        else if (strcmp(autoBinding, "VIEW_MATRIX") == 0)
-        {
-            param->bindValue(this, &RenderState::autoBindingGetViewMatrix);
-        }
-        else if (strcmp(autoBinding, "PROJECTION_MATRIX") == 0)
-        {
-            param->bindValue(this, &RenderState::autoBindingGetProjectionMatrix);
-        }
-        else if (strcmp(autoBinding, "WORLD_VIEW_MATRIX") == 0)
-        {
-            param->bindValue(this, &RenderState::autoBindingGetWorldViewMatrix);
-        }
-        else if (strcmp(autoBinding, "VIEW_PROJECTION_MATRIX") == 0)
-        {
-            param->bindValue(this, &RenderState::autoBindingGetViewProjectionMatrix);
-        }
-        else if (strcmp(autoBinding, "WORLD_VIEW_PROJECTION_MATRIX") == 0)
-        {
-            param->bindValue(this, &RenderState::autoBindingGetWorldViewProjectionMatrix);
-        }
-        else if (strcmp(autoBinding, "INVERSE_TRANSPOSE_WORLD_MATRIX") == 0)
-        {
-            param->bindValue(this, &RenderState::autoBindingGetInverseTransposeWorldMatrix);
-        }
-        else if (strcmp(autoBinding, "INVERSE_TRANSPOSE_WORLD_VIEW_MATRIX") == 0)
-        {
-            param->bindValue(this, &RenderState::autoBindingGetInverseTransposeWorldViewMatrix);
-        }
-        else if (strcmp(autoBinding, "CAMERA_WORLD_POSITION") == 0)
-        {
-            param->bindValue(this, &RenderState::autoBindingGetCameraWorldPosition);
-        }
-        else if (strcmp(autoBinding, "CAMERA_VIEW_POSITION") == 0)
-        {
-            param->bindValue(this, &RenderState::autoBindingGetCameraViewPosition);
-        }
-        else if (strcmp(autoBinding, "MATRIX_PALETTE") == 0)
-        {
-            param->bindValue(this, &RenderState::autoBindingGetMatrixPalette, &RenderState::autoBindingGetMatrixPaletteSize);
-        }
-        else if (strcmp(autoBinding, "SCENE_AMBIENT_COLOR") == 0)
-        {
-            param->bindValue(this, &RenderState::autoBindingGetAmbientColor);
-        }
-        else
+        if (_customAutoBindingResolvers[i]->resolveAutoBinding(autoBinding, _nodeBinding, param))
         {
-            bound = false;
-            GP_WARN("Unsupported auto binding type (%s).", autoBinding);
+            // Handled by custom auto binding resolver, mark the parameter as an auto binding.
+            if (param->_type == MaterialParameter::METHOD && param->_value.method)
+                param->_value.method->_autoBinding = true;
+            return;
         }
     }
 
-    if (bound)
+    // Perform built-in resolution. The binding is compiled once here and evaluated
+    // directly by bind(), instead of through a method binding on every draw.
+    AutoBinding value = parseAutoBinding(autoBinding);
+    if (value == NONE)
     {
-        // Mark parameter as an auto binding
-        if (param->_type == MaterialParameter::METHOD && param->_value.method)
-            param->_value.method->_autoBinding = true;
+        GP_WARN("Unsupported auto binding type (%s).", autoBinding);
+        return;
     }
-}
-
-const Matrix& RenderState::autoBindingGetWorldMatrix() const
-{
-    return _nodeBinding ? _nodeBinding->getWorldMatrix() : Matrix::identity();
-}
-
-const Matrix& RenderState::autoBindingGetViewMatrix() const
-{
-    return _nodeBinding ? _nodeBinding->getViewMatrix() : Matrix::identity();
-}
-
-const Matrix& RenderState::autoBindingGetProjectionMatrix() const
-{
-    return _nodeBinding ? _nodeBinding->getProjectionMatrix() : Matrix::identity();
-}
-
-const Matrix& RenderState::autoBindingGetWorldViewMatrix() const
-{
-    return _nodeBinding ? _nodeBinding->getWorldViewMatrix() : Matrix::identity();
-}
 
-const Matrix& RenderState::autoBindingGetViewProjectionMatrix() const
-{
-    return _nodeBinding ? _nodeBinding->getViewProjectionMatrix() : Matrix::identity();
-}
-
-const Matrix& RenderState::autoBindingGetWorldViewProjectionMatrix() const
-{
-    return _nodeBinding ? _nodeBinding->getWorldViewProjectionMatrix() : Matrix::identity();
-}
+    param->clearValue();
+    param->_type = MaterialParameter::AUTO_BINDING;
 
-const Matrix& RenderState::autoBindingGetInverseTransposeWorldMatrix() const
-{
-    return _nodeBinding ? _nodeBinding->getInverseTransposeWorldMatrix() : Matrix::identity();
+    CompiledAutoBinding compiled;
+    compiled.parameter = param;
+    compiled.autoBinding = value;
+    _compiledAutoBindings.push_back(compiled);
 }
 
-const Matrix& RenderState::autoBindingGetInverseTransposeWorldViewMatrix() const
-{
-    return _nodeBinding ? _nodeBinding->getInverseTransposeWorldViewMatrix() : Matrix::identity();
-}
-
-Vector3 RenderState::autoBindingGetCameraWorldPosition() const
-{
-    return _nodeBinding ? _nodeBinding->getActiveCameraTranslationWorld() : Vector3::zero();
-}
-
-Vector3 RenderState::autoBindingGetCameraViewPosition() const
-{
-    return _nodeBinding ? _nodeBinding->getActiveCameraTranslationView() : Vector3::zero();
-}
-
-const Vector4* RenderState::autoBindingGetMatrixPalette() const
-{
-    Model* model = dynamic_cast<Model*>(_nodeBinding->getDrawable());
-    if (model)
-    {
-        MeshSkin* skin = model->getSkin();
-        if (skin)
-            return skin->getMatrixPalette();
-    }
-    return NULL;
-}
-
-unsigned int RenderState::autoBindingGetMatrixPaletteSize() const
+void RenderState::bind(Pass* pass)
 {
-    Model* model = dynamic_cast<Model*>(_nodeBinding->getDrawable());
-    if (model)
-    {
-        MeshSkin* skin = model->getSkin();
-        if (skin)
-            return skin->getMatrixPaletteSize();
-    }
-    return 0;
-}
+    GP_ASSERT(pass);
 
-const Vector3& RenderState::autoBindingGetAmbientColor() const
-{
-    Scene* scene = _nodeBinding ? _nodeBinding->getScene() : NULL;
-    return scene ? scene->getAmbientColor() : Vector3::zero();
+    bind(pass, pass->getEffect(), NULL);
 }
 
-void RenderState::bind(Pass* pass)
+void RenderState::bind(Pass* pass, Effect* effect, StateBlock* overrideState)
 {
     GP_ASSERT(pass);
+    GP_ASSERT(effect);
 
     // Get the combined modified state bits for our RenderState hierarchy.
     long stateOverrideBits = _state ? _state->_bits : 0;
+    if (overrideState)
+    {
+        stateOverrideBits |= overrideState->_bits;
+    }
     RenderState* rs = _parent;
     while (rs)
     {
@@ -420,15 +494,30 @@ void RenderState::bind(Pass* pass)
     // Restore renderer state to its default, except for explicitly specified states
     StateBlock::restore(stateOverrideBits);
 
+    // Make the shared per-view uniforms hold the view of the node being drawn.
+    ViewUniformBuffer::bind(_nodeBinding);
+
     // Apply parameter bindings and renderer state for the entire hierarchy, top-down.
     rs = NULL;
-    Effect* effect = pass->getEffect();
+    const bool passEffect = effect == pass->getEffect();
     while ((rs = getTopmost(rs)))
     {
         for (size_t i = 0, count = rs->_parameters.size(); i < count; ++i)
         {
-            GP_ASSERT(rs->_parameters[i]);
-            rs->_parameters[i]->bind(effect);
+            MaterialParameter* param = rs->_parameters[i];
+            GP_ASSERT(param);
+
+            // Other effects of the pass, such as its depth effect, only use some of its parameters.
+            if (passEffect || effect->getUniform(param->getName()))
+                param->bind(effect);
+        }
+
+        for (size_t i = 0, count = rs->_compiledAutoBindings.size(); i < count; ++i)
+        {
+            const CompiledAutoBinding& compiled = rs->_compiledAutoBindings[i];
+            MaterialParameter* param = compiled.parameter;
+            if (param->_type == MaterialParameter::AUTO_BINDING && param->_uniform && param->_uniform->getEffect() == effect)
+                setAutoBindingValue(effect, param->_uniform, compiled.autoBinding, rs->_nodeBinding);
         }
 
         if (rs->_state)
@@ -436,6 +525,11 @@ void RenderState::bind(Pass* pass)
             rs->_state->bindNoRestore();
         }
     }
+
+    if (overrideState)
+    {
+        overrideState->bindNoRestore();
+    }
 }
 
 RenderState* RenderState::getTopmost(RenderState* below)
@@ -478,6 +572,8 @@ void RenderState::cloneInto(RenderState* renderState, NodeCloneContext& context)
         // via the cloned auto bindings instead.
         if (param->_type == MaterialParameter::METHOD && param->_value.method && param->_value.method->_autoBinding)
             continue;
+        if (param->_type == MaterialParameter::AUTO_BINDING)
+            continue;
 
         MaterialParameter* paramCopy = new MaterialParameter(param->getName());
         param->cloneInto(paramCopy);
@@ -496,6 +592,17 @@ void RenderState::cloneInto(RenderState* renderState, NodeCloneContext& context)
     // 2. _parent should not be set here, since it's set in the constructor of Technique and Pass.
 }
 
+bool RenderState::hasResolvedAutoBindings() const
+{
+    for (size_t i = 0, count = _parameters.size(); i < count; ++i)
+    {
+        const MaterialParameter* param = _parameters[i];
+        if (param->_type == MaterialParameter::METHOD && param->_value.method && param->_value.method->_autoBinding)
+            return true;
+    }
+    return false;
+}
+
 RenderState::StateBlock::StateBlock()
     : _cullFaceEnabled(false), _depthTestEnabled(false), _depthWriteEnabled(true), _depthFunction(RenderState::DEPTH_LESS),
       _blendEnabled(false), _blendSrc(RenderState::BLEND_ONE), _blendDst(RenderState::BLEND_ZERO),
@@ -536,9 +643,12 @@ void RenderState::StateBlock::bindNoRestore()
 {
     GP_ASSERT(_defaultState);
 
+    unsigned int changes = 0;
+
     // Update any state that differs from _defaultState and flip _defaultState bits
     if ((_bits & RS_BLEND) && (_blendEnabled != _defaultState->_blendEnabled))
     {
+        ++changes;
         if (_blendEnabled)
             GL_ASSERT( glEnable(GL_BLEND) );
         else
@@ -547,12 +657,14 @@ void RenderState::StateBlock::bindNoRestore()
     }
     if ((_bits & RS_BLEND_FUNC) && (_blendSrc != _defaultState->_blendSrc || _blendDst != _defaultState->_blendDst))
     {
+        ++changes;
         GL_ASSERT( glBlendFunc((GLenum)_blendSrc, (GLenum)_blendDst) );
         _defaultState->_blendSrc = _blendSrc;
         _defaultState->_blendDst = _blendDst;
     }
     if ((_bits & RS_CULL_FACE) && (_cullFaceEnabled != _defaultState->_cullFaceEnabled))
     {
+        ++changes;
         if (_cullFaceEnabled)
             GL_ASSERT( glEnable(GL_CULL_FACE) );
         else
@@ -561,16 +673,19 @@ void RenderState::StateBlock::bindNoRestore()
     }
     if ((_bits & RS_CULL_FACE_SIDE) && (_cullFaceSide != _defaultState->_cullFaceSide))
     {
+        ++changes;
         GL_ASSERT( glCullFace((GLenum)_cullFaceSide) );
         _defaultState->_cullFaceSide = _cullFaceSide;
     }
     if ((_bits & RS_FRONT_FACE) && (_frontFace != _defaultState->_frontFace))
     {
+        ++changes;
         GL_ASSERT( glFrontFace((GLenum)_frontFace) );
         _defaultState->_frontFace = _frontFace;
     }
     if ((_bits & RS_DEPTH_TEST) && (_depthTestEnabled != _defaultState->_depthTestEnabled))
     {
+        ++changes;
         if (_depthTestEnabled)
             GL_ASSERT( glEnable(GL_DEPTH_TEST) );
         else
@@ -579,16 +694,19 @@ void RenderState::StateBlock::bindNoRestore()
     }
     if ((_bits & RS_DEPTH_WRITE) && (_depthWriteEnabled != _defaultState->_depthWriteEnabled))
     {
+        ++changes;
         GL_ASSERT( glDepthMask(_depthWriteEnabled ? GL_TRUE : GL_FALSE) );
         _defaultState->_depthWriteEnabled = _depthWriteEnabled;
     }
     if ((_bits & RS_DEPTH_FUNC) && (_depthFunction != _defaultState->_depthFunction))
     {
+        ++changes;
         GL_ASSERT( glDepthFunc((GLenum)_depthFunction) );
         _defaultState->_depthFunction = _depthFunction;
     }
 	if ((_bits & RS_STENCIL_TEST) && (_stencilTestEnabled != _defaultState->_stencilTestEnabled))
     {
+        ++changes;
         if (_stencilTestEnabled)
 			GL_ASSERT( glEnable(GL_STENCIL_TEST) );
         else
@@ -597,6 +715,7 @@ void RenderState::StateBlock::bindNoRestore()
     }
 	if ((_bits & RS_STENCIL_WRITE) && (_stencilWrite != _defaultState->_stencilWrite))
     {
+        ++changes;
 		GL_ASSERT( glStencilMask(_stencilWrite) );
         _defaultState->_stencilWrite = _stencilWrite;
     }
@@ -604,6 +723,7 @@ void RenderState::StateBlock::bindNoRestore()
 										_stencilFunctionRef != _defaultState->_stencilFunctionRef ||
 										_stencilFunctionMask != _defaultState->_stencilFunctionMask))
     {
+        ++changes;
 		GL_ASSERT( glStencilFunc((GLenum)_stencilFunction, _stencilFunctionRef, _stencilFunctionMask) );
         _defaultState->_stencilFunction = _stencilFunction;
 		_defaultState->_stencilFunctionRef = _stencilFunctionRef;
@@ -613,6 +733,7 @@ void RenderState::StateBlock::bindNoRestore()
 									_stencilOpDpfail != _defaultState->_stencilOpDpfail ||
 									_stencilOpDppass != _defaultState->_stencilOpDppass))
     {
+        ++changes;
 		GL_ASSERT( glStencilOp((GLenum)_stencilOpSfail, (GLenum)_stencilOpDpfail, (GLenum)_stencilOpDppass) );
         _defaultState->_stencilOpSfail = _stencilOpSfail;
 		_defaultState->_stencilOpDpfail = _stencilOpDpfail;
@@ -620,6 +741,9 @@ void RenderState::StateBlock::bindNoRestore()
     }
 
     _defaultState->_bits |= _bits;
+
+    FrameStats::recordStateChanges(changes);
+    FrameCapture::record(FrameCapture::SET_RENDER_STATE, (unsigned int)_bits, 0, changes, 0, changes == 0);
 }
 
 void RenderState::StateBlock::restore(long stateOverrideBits)
@@ -632,15 +756,20 @@ void RenderState::StateBlock::restore(long stateOverrideBits)
         return;
     }
 
+    unsigned int changes = 0;
+    const long restoredBits = _defaultState->_bits & ~stateOverrideBits;
+
     // Restore any state that is not overridden and is not default
     if (!(stateOverrideBits & RS_BLEND) && (_defaultState->_bits & RS_BLEND))
     {
+        ++changes;
         GL_ASSERT( glDisable(GL_BLEND) );
         _defaultState->_bits &= ~RS_BLEND;
         _defaultState->_blendEnabled = false;
     }
     if (!(stateOverrideBits & RS_BLEND_FUNC) && (_defaultState->_bits & RS_BLEND_FUNC))
     {
+        ++changes;
         GL_ASSERT( glBlendFunc(GL_ONE, GL_ZERO) );
         _defaultState->_bits &= ~RS_BLEND_FUNC;
         _defaultState->_blendSrc = RenderState::BLEND_ONE;
@@ -648,54 +777,63 @@ void RenderState::StateBlock::restore(long stateOverrideBits)
     }
     if (!(stateOverrideBits & RS_CULL_FACE) && (_defaultState->_bits & RS_CULL_FACE))
     {
+        ++changes;
         GL_ASSERT( glDisable(GL_CULL_FACE) );
         _defaultState->_bits &= ~RS_CULL_FACE;
         _defaultState->_cullFaceEnabled = false;
     }
     if (!(stateOverrideBits & RS_CULL_FACE_SIDE) && (_defaultState->_bits & RS_CULL_FACE_SIDE))
     {
+        ++changes;
         GL_ASSERT( glCullFace((GLenum)GL_BACK) );
         _defaultState->_bits &= ~RS_CULL_FACE_SIDE;
         _defaultState->_cullFaceSide = RenderState::CULL_FACE_SIDE_BACK;
     }
     if (!(stateOverrideBits & RS_FRONT_FACE) && (_defaultState->_bits & RS_FRONT_FACE))
     {
+        ++changes;
         GL_ASSERT( glFrontFace((GLenum)GL_CCW) );
         _defaultState->_bits &= ~RS_FRONT_FACE;
         _defaultState->_frontFace = RenderState::FRONT_FACE_CCW;
     }
     if (!(stateOverrideBits & RS_DEPTH_TEST) && (_defaultState->_bits & RS_DEPTH_TEST))
     {
+        ++changes;
         GL_ASSERT( glDisable(GL_DEPTH_TEST) );
         _defaultState->_bits &= ~RS_DEPTH_TEST;
         _defaultState->_depthTestEnabled = false;
     }
     if (!(stateOverrideBits & RS_DEPTH_WRITE) && (_defaultState->_bits & RS_DEPTH_WRITE))
     {
+        ++changes;
         GL_ASSERT( glDepthMask(GL_TRUE) );
         _defaultState->_bits &= ~RS_DEPTH_WRITE;
         _defaultState->_depthWriteEnabled = true;
     }
     if (!(stateOverrideBits & RS_DEPTH_FUNC) && (_defaultState->_bits & RS_DEPTH_FUNC))
     {
+        ++changes;
         GL_ASSERT( glDepthFunc((GLenum)GL_LESS) );
         _defaultState->_bits &= ~RS_DEPTH_FUNC;
         _defaultState->_depthFunction = RenderState::DEPTH_LESS;
     }
 	if (!(stateOverrideBits & RS_STENCIL_TEST) && (_defaultState->_bits & RS_STENCIL_TEST))
     {
+        ++changes;
         GL_ASSERT( glDisable(GL_STENCIL_TEST) );
         _defaultState->_bits &= ~RS_STENCIL_TEST;
         _defaultState->_stencilTestEnabled = false;
     }
 	if (!(stateOverrideBits & RS_STENCIL_WRITE) && (_defaultState->_bits & RS_STENCIL_WRITE))
     {
+        ++changes;
 		GL_ASSERT( glStencilMask(RS_ALL_ONES) );
         _defaultState->_bits &= ~RS_STENCIL_WRITE;
 		_defaultState->_stencilWrite = RS_ALL_ONES;
     }
 	if (!(stateOverrideBits & RS_STENCIL_FUNC) && (_defaultState->_bits & RS_STENCIL_FUNC))
     {
+        ++changes;
 		GL_ASSERT( glStencilFunc((GLenum)RenderState::STENCIL_ALWAYS, 0, RS_ALL_ONES) );
         _defaultState->_bits &= ~RS_STENCIL_FUNC;
         _defaultState->_stencilFunction = RenderState::STENCIL_ALWAYS;
@@ -704,12 +842,16 @@ void RenderState::StateBlock::restore(long stateOverrideBits)
     }
 	if (!(stateOverrideBits & RS_STENCIL_OP) && (_defaultState->_bits & RS_STENCIL_OP))
     {
+        ++changes;
 		GL_ASSERT( glStencilOp((GLenum)RenderState::STENCIL_OP_KEEP, (GLenum)RenderState::STENCIL_OP_KEEP, (GLenum)RenderState::STENCIL_OP_KEEP) );
         _defaultState->_bits &= ~RS_STENCIL_OP;
         _defaultState->_stencilOpSfail = RenderState::STENCIL_OP_KEEP;
 		_defaultState->_stencilOpDpfail = RenderState::STENCIL_OP_KEEP;
 		_defaultState->_stencilOpDppass = RenderState::STENCIL_OP_KEEP;
     }
+
+    FrameStats::recordStateChanges(changes);
+    FrameCapture::record(FrameCapture::SET_RENDER_STATE, (unsigned int)restoredBits, 0, changes, 0, changes == 0);
 }
 
 void RenderState::StateBlock::enableDepthWrite()
@@ -1041,6 +1183,11 @@ void RenderState::StateBlock::setState(const char* name, const char* value)
     }
 }
 
+bool RenderState::StateBlock::isBlendEnabled() const
+{
+    return (_bits & RS_BLEND) != 0;
+}
+
 void RenderState::StateBlock::setBlend(bool enabled)
 {
     _blendEnabled = enabled;
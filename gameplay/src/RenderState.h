@@ -8,6 +8,7 @@
 namespace gameplay
 {
 
+class Effect;
 class MaterialParameter;
 class Node;
 class NodeCloneContext;
@@ -159,7 +160,51 @@ public:
         /**
          * Binds the current scene's ambient color (Vector3).
          */
-        SCENE_AMBIENT_COLOR
+        SCENE_AMBIENT_COLOR,
+
+        /**
+         * Binds the dual quaternion palette of MeshSkin attached to a node's model.
+         */
+        DUAL_QUATERNION_PALETTE,
+
+        /**
+         * Binds the sampler of the JointTexture that the joint palettes of skins are written to.
+         */
+        JOINT_TEXTURE,
+
+        /**
+         * Binds the location (Vector4) of the matrix palette of MeshSkin attached to a node's model in the JointTexture.
+         */
+        MATRIX_PALETTE_OFFSET,
+
+        /**
+         * Binds the location (Vector4) of the dual quaternion palette of MeshSkin attached to a node's model in the JointTexture.
+         */
+        DUAL_QUATERNION_PALETTE_OFFSET,
+
+        /**
+         * Binds the world matrix of each instance of an instanced draw to a mat4 vertex attribute.
+         *
+         * Unlike the other auto bindings, this one names a vertex attribute rather than a
+         * uniform. Materials that declare it can be drawn with hardware instancing by a
+         * RenderQueue, which gathers the draws that share a mesh part and material into a
+         * single draw call. When a draw is not instanced, the attribute is set to the world
+         * matrix of the node being drawn.
+         *
+         * The INSTANCED variants of the built-in shaders derive their world, world view and
+         * normal transforms from this attribute, so lit instanced materials bind
+         * u_viewMatrix to VIEW_MATRIX instead of the per-node matrices.
+         */
+        INSTANCE_WORLD_MATRIX,
+
+        /**
+         * Binds the Model::getInstanceData() vector (Vector4) of each instance of an instanced draw to a vec4 vertex attribute.
+         *
+         * Like INSTANCE_WORLD_MATRIX, this names a vertex attribute rather than a uniform, so
+         * that instances of the same material can differ, such as in the time offset of the
+         * AnimationTexture they play.
+         */
+        INSTANCE_DATA
     };
 
     /**
@@ -296,6 +341,13 @@ public:
          */
         void setBlend(bool enabled);
 
+        /**
+         * Determines if this state block enables blending.
+         *
+         * @return true if blending is enabled by this state block, false otherwise.
+         */
+        bool isBlendEnabled() const;
+
         /**
          * Explicitly sets the source used in the blend function for this render state.
          *
@@ -494,6 +546,19 @@ public:
      */
     MaterialParameter* getParameterByIndex(unsigned int index);
 
+    /**
+     * Gets a MaterialParameter by the uniform handle of its name.
+     *
+     * This is the same as getParameter(const char*), except that the parameters are found by
+     * comparing handles, which can be looked up once with Effect::getUniformHandle(), rather
+     * than by comparing names.
+     *
+     * @param handle The uniform handle of the name of the parameter.
+     *
+     * @return The parameter with that handle, which is created if it does not exist yet.
+     */
+    MaterialParameter* getParameterByHandle(unsigned int handle) const;
+
     /**
      * Adds a MaterialParameter to the render state.
      *
@@ -530,6 +595,22 @@ public:
      */
     void setParameterAutoBinding(const char* name, const char* autoBinding);
 
+    /**
+     * Gets the name of the vertex attribute bound to INSTANCE_WORLD_MATRIX in this
+     * render state or any of its parents.
+     *
+     * @return The name of the instance matrix attribute, or NULL if this render state is not instanced.
+     */
+    const char* getInstanceMatrixAttribute() const;
+
+    /**
+     * Gets the name of the vertex attribute bound to INSTANCE_DATA in this
+     * render state or any of its parents.
+     *
+     * @return The name of the instance data attribute, or NULL if there is none.
+     */
+    const char* getInstanceDataAttribute() const;
+
     /**
      * Sets the fixed-function render state of this object to the state contained
      * in the specified StateBlock.
@@ -607,6 +688,20 @@ protected:
      */
     void bind(Pass* pass);
 
+    /**
+     * Binds the render state for this RenderState and any of its parents, top-down,
+     * for the given pass, setting the parameters on the given effect instead of the
+     * effect of the pass.
+     *
+     * Parameters that the effect does not have are skipped. The states of the given
+     * override block are applied last, over those of the hierarchy.
+     *
+     * @param pass The pass being bound.
+     * @param effect The effect to set the parameters on.
+     * @param overrideState The states to apply over those of the hierarchy, or NULL.
+     */
+    void bind(Pass* pass, Effect* effect, StateBlock* overrideState);
+
     /**
      * Returns the topmost RenderState in the hierarchy below the given RenderState.
      */
@@ -620,6 +715,12 @@ protected:
      */
     void cloneInto(RenderState* renderState, NodeCloneContext& context) const;
 
+    /**
+     * Determines if any parameter of this RenderState was resolved by a custom auto binding
+     * resolver, which binds it to the node it was resolved for.
+     */
+    bool hasResolvedAutoBindings() const;
+
 private:
 
     /**
@@ -632,22 +733,14 @@ private:
      */
     RenderState& operator=(const RenderState&);
 
-    // Internal auto binding handler methods.
-    const Matrix& autoBindingGetWorldMatrix() const;
-    const Matrix& autoBindingGetViewMatrix() const;
-    const Matrix& autoBindingGetProjectionMatrix() const;
-    const Matrix& autoBindingGetWorldViewMatrix() const;
-    const Matrix& autoBindingGetViewProjectionMatrix() const;
-    const Matrix& autoBindingGetWorldViewProjectionMatrix() const;
-    const Matrix& autoBindingGetInverseTransposeWorldMatrix() const;
-    const Matrix& autoBindingGetInverseTransposeWorldViewMatrix() const;
-    Vector3 autoBindingGetCameraWorldPosition() const;
-    Vector3 autoBindingGetCameraViewPosition() const;
-    const Vector4* autoBindingGetMatrixPalette() const;
-    unsigned int autoBindingGetMatrixPaletteSize() const;
-    const Vector3& autoBindingGetAmbientColor() const;
-    const Vector3& autoBindingGetLightColor() const;
-    const Vector3& autoBindingGetLightDirection() const;
+    /**
+     * A built-in auto binding resolved for a material parameter.
+     */
+    struct CompiledAutoBinding
+    {
+        MaterialParameter* parameter;
+        AutoBinding autoBinding;
+    };
 
 protected:
 
@@ -661,6 +754,11 @@ protected:
      */
     std::map<std::string, std::string> _autoBindings;
 
+    /**
+     * The built-in auto bindings of the render state, which are set directly when it is bound.
+     */
+    std::vector<CompiledAutoBinding> _compiledAutoBindings;
+
     /**
      * The Node bound to the RenderState.
      */
@@ -680,6 +778,16 @@ protected:
      * Map of custom auto binding resolvers.
      */
     static std::vector<AutoBindingResolver*> _customAutoBindingResolvers;
+
+    /**
+     * The states of the depth pre-pass: depth writes on, with blending off.
+     */
+    static StateBlock* _depthPrepassState;
+
+    /**
+     * The states of the passes drawn over a depth pre-pass: depth test equal, with depth writes off.
+     */
+    static StateBlock* _depthEqualState;
 };
 
 }
@@ -23,6 +23,11 @@ RenderTarget::~RenderTarget()
     }
 }
 
+bool RenderTarget::isDestroyedOnMainThread() const
+{
+    return true;
+}
+
 RenderTarget* RenderTarget::create(const char* id, unsigned int width, unsigned int height, Texture::Format format)
 {
     // Create a new texture with the given width.
@@ -95,6 +95,11 @@ private:
      */
     ~RenderTarget();
 
+    /**
+     * @see Ref::isDestroyedOnMainThread
+     */
+    bool isDestroyedOnMainThread() const;
+
     /**
      * Hidden copy assignment operator.
      */
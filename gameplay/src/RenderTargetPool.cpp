@@ -0,0 +1,166 @@
+#include "Base.h"
+#include "RenderTargetPool.h"
+
+// Number of frames a target may go unused before the pool deletes it.
+#define RENDER_TARGET_POOL_LIFETIME 4
+
+namespace gameplay
+{
+
+// A target of the pool, which is either a render target or a depth stencil target.
+struct PooledTarget
+{
+    Ref* target;
+    unsigned int width;
+    unsigned int height;
+    int format;
+    bool acquired;
+    unsigned int lastUsedFrame;
+};
+
+static std::vector<PooledTarget> __renderTargets;
+static std::vector<PooledTarget> __depthStencilTargets;
+static unsigned int __frame = 0;
+static unsigned int __targetCount = 0;
+
+// Finds a target of the pool that is not acquired and has the given size and format.
+static Ref* acquirePooled(std::vector<PooledTarget>& targets, unsigned int width, unsigned int height, int format)
+{
+    for (size_t i = 0, count = targets.size(); i < count; ++i)
+    {
+        PooledTarget& pooled = targets[i];
+        if (!pooled.acquired && pooled.width == width && pooled.height == height && pooled.format == format)
+        {
+            pooled.acquired = true;
+            pooled.lastUsedFrame = __frame;
+            return pooled.target;
+        }
+    }
+    return NULL;
+}
+
+// Adds a new target to the pool, acquired for the current frame.
+static void addPooled(std::vector<PooledTarget>& targets, Ref* target, unsigned int width, unsigned int height, int format)
+{
+    PooledTarget pooled;
+    pooled.target = target;
+    pooled.width = width;
+    pooled.height = height;
+    pooled.format = format;
+    pooled.acquired = true;
+    pooled.lastUsedFrame = __frame;
+    targets.push_back(pooled);
+}
+
+static void releasePooled(std::vector<PooledTarget>& targets, Ref* target)
+{
+    for (size_t i = 0, count = targets.size(); i < count; ++i)
+    {
+        if (targets[i].target == target)
+        {
+            GP_ASSERT(targets[i].acquired);
+            targets[i].acquired = false;
+            return;
+        }
+    }
+    GP_ERROR("Released a target that was not acquired from the render target pool.");
+}
+
+// Returns every target to the pool, and deletes the ones not used for a while.
+static void recyclePooled(std::vector<PooledTarget>& targets)
+{
+    std::vector<PooledTarget>::iterator itr = targets.begin();
+    while (itr != targets.end())
+    {
+        itr->acquired = false;
+        if (itr->lastUsedFrame + RENDER_TARGET_POOL_LIFETIME < __frame)
+        {
+            SAFE_RELEASE(itr->target);
+            itr = targets.erase(itr);
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+}
+
+RenderTarget* RenderTargetPool::acquire(unsigned int width, unsigned int height, Texture::Format format)
+{
+    GP_ASSERT(width > 0 && height > 0);
+
+    Ref* pooled = acquirePooled(__renderTargets, width, height, format);
+    if (pooled)
+        return static_cast<RenderTarget*>(pooled);
+
+    char id[64];
+    sprintf(id, "org.gameplay3d.pool.rendertarget.%u", ++__targetCount);
+    RenderTarget* target = RenderTarget::create(id, width, height, format);
+    if (target == NULL)
+    {
+        GP_ERROR("Failed to create a %ux%u render target for the render target pool.", width, height);
+        return NULL;
+    }
+    addPooled(__renderTargets, target, width, height, format);
+    return target;
+}
+
+DepthStencilTarget* RenderTargetPool::acquireDepthStencil(unsigned int width, unsigned int height, DepthStencilTarget::Format format)
+{
+    GP_ASSERT(width > 0 && height > 0);
+
+    Ref* pooled = acquirePooled(__depthStencilTargets, width, height, format);
+    if (pooled)
+        return static_cast<DepthStencilTarget*>(pooled);
+
+    char id[64];
+    sprintf(id, "org.gameplay3d.pool.depthstenciltarget.%u", ++__targetCount);
+    DepthStencilTarget* target = DepthStencilTarget::create(id, format, width, height);
+    if (target == NULL)
+    {
+        GP_ERROR("Failed to create a %ux%u depth stencil target for the render target pool.", width, height);
+        return NULL;
+    }
+    addPooled(__depthStencilTargets, target, width, height, format);
+    return target;
+}
+
+void RenderTargetPool::release(RenderTarget* target)
+{
+    GP_ASSERT(target);
+    releasePooled(__renderTargets, target);
+}
+
+void RenderTargetPool::release(DepthStencilTarget* target)
+{
+    GP_ASSERT(target);
+    releasePooled(__depthStencilTargets, target);
+}
+
+unsigned int RenderTargetPool::getTargetCount()
+{
+    return (unsigned int)(__renderTargets.size() + __depthStencilTargets.size());
+}
+
+void RenderTargetPool::nextFrame()
+{
+    ++__frame;
+    recyclePooled(__renderTargets);
+    recyclePooled(__depthStencilTargets);
+}
+
+void RenderTargetPool::finalize()
+{
+    for (size_t i = 0, count = __renderTargets.size(); i < count; ++i)
+    {
+        SAFE_RELEASE(__renderTargets[i].target);
+    }
+    __renderTargets.clear();
+    for (size_t i = 0, count = __depthStencilTargets.size(); i < count; ++i)
+    {
+        SAFE_RELEASE(__depthStencilTargets[i].target);
+    }
+    __depthStencilTargets.clear();
+}
+
+}
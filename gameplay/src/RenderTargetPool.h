@@ -0,0 +1,100 @@
+#ifndef RENDERTARGETPOOL_H_
+#define RENDERTARGETPOOL_H_
+
+#include "RenderTarget.h"
+#include "DepthStencilTarget.h"
+
+namespace gameplay
+{
+
+/**
+ * Defines a pool of transient render targets and depth stencil targets.
+ *
+ * Post-processing passes need targets for the duration of a frame only, and creating them
+ * by id allocates new GL textures and render buffers whenever the game is resized. The pool
+ * instead hands out targets by their size and format and recycles them: a pass acquires the
+ * targets it draws into and releases them once the passes reading them are done, after which
+ * a later pass of the same frame is given the same memory. A chain of passes therefore only
+ * keeps as many targets as it has in use at once.
+ *
+ * Transient targets are only valid until the end of the frame they are acquired in. Targets
+ * that are still acquired return to the pool at the start of the next frame, and targets
+ * that have not been used for a few frames, such as the ones of a size the game was resized
+ * from, are deleted.
+ *
+ * @script{ignore}
+ */
+class RenderTargetPool
+{
+    friend class Game;
+
+public:
+
+    /**
+     * Acquires a render target for the current frame.
+     *
+     * @param width The width of the render target.
+     * @param height The height of the render target.
+     * @param format The format of the texture of the render target.
+     *
+     * @return A render target that no other pass is using, or NULL if it could not be created.
+     */
+    static RenderTarget* acquire(unsigned int width, unsigned int height, Texture::Format format = Texture::RGBA);
+
+    /**
+     * Acquires a depth stencil target for the current frame.
+     *
+     * @param width The width of the depth stencil target.
+     * @param height The height of the depth stencil target.
+     * @param format The format of the depth stencil target.
+     *
+     * @return A depth stencil target that no other pass is using, or NULL if it could not be created.
+     */
+    static DepthStencilTarget* acquireDepthStencil(unsigned int width, unsigned int height, DepthStencilTarget::Format format = DepthStencilTarget::DEPTH);
+
+    /**
+     * Returns a render target to the pool, so later passes of the frame can draw into it.
+     *
+     * @param target A render target acquired from the pool.
+     */
+    static void release(RenderTarget* target);
+
+    /**
+     * Returns a depth stencil target to the pool, so later passes of the frame can draw into it.
+     *
+     * @param target A depth stencil target acquired from the pool.
+     */
+    static void release(DepthStencilTarget* target);
+
+    /**
+     * Gets the number of render targets and depth stencil targets held by the pool.
+     *
+     * @return The number of targets, whether acquired or not.
+     */
+    static unsigned int getTargetCount();
+
+private:
+
+    /**
+     * Constructor.
+     */
+    RenderTargetPool();
+
+    /**
+     * Returns every target to the pool and deletes the ones that have not been used for a while.
+     *
+     * Called by Game at the start of every frame.
+     */
+    static void nextFrame();
+
+    /**
+     * Deletes every target of the pool.
+     *
+     * Called by Game at shutdown, while the GL context is still current.
+     */
+    static void finalize();
+};
+
+}
+
+#endif
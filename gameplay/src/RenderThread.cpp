@@ -0,0 +1,117 @@
+#include "Base.h"
+#include "RenderThread.h"
+#include "Game.h"
+#include "Platform.h"
+
+namespace gameplay
+{
+
+RenderThread::RenderThread(Game* game)
+    : _game(game), _running(false), _task(NONE), _rendered(false), _elapsedTime(0.0f), _gameRunning(false)
+{
+    GP_ASSERT(game);
+}
+
+RenderThread::~RenderThread()
+{
+    stop();
+}
+
+bool RenderThread::start()
+{
+    if (_running)
+        return true;
+
+    // The context can only be current on one thread at a time.
+    if (!Platform::makeContextCurrent(false))
+        return false;
+
+    _task = NONE;
+    _running = true;
+    _thread = std::thread(&RenderThread::run, this);
+    return true;
+}
+
+void RenderThread::stop()
+{
+    if (!_running)
+        return;
+
+    GP_ASSERT(std::this_thread::get_id() != _thread.get_id());
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (_task != NONE)
+            _taskDone.wait(lock);
+        _task = EXIT;
+        _taskReady.notify_one();
+    }
+    _thread.join();
+    _running = false;
+    _task = NONE;
+
+    // Graphics objects are destroyed on this thread again.
+    Platform::makeContextCurrent(true);
+    Ref::setMainThread();
+}
+
+void RenderThread::waitForFrame()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (_task != NONE)
+        _taskDone.wait(lock);
+}
+
+void RenderThread::submit(float elapsedTime, bool running)
+{
+    GP_ASSERT(_running);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    GP_ASSERT(_task == NONE);
+    _task = RENDER;
+    _rendered = false;
+    _elapsedTime = elapsedTime;
+    _gameRunning = running;
+    _taskReady.notify_one();
+
+    // Only the swap of buffers overlaps with the next update.
+    while (!_rendered)
+        _taskDone.wait(lock);
+}
+
+void RenderThread::run()
+{
+    if (!Platform::makeContextCurrent(true))
+        GP_ERROR("Failed to make the graphics context current on the render thread.");
+
+    // Graphics objects released on other threads are destroyed on this one.
+    Ref::setMainThread();
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        while (_task == NONE)
+            _taskReady.wait(lock);
+        const Task task = _task;
+        if (task == EXIT)
+            break;
+
+        const float elapsedTime = _elapsedTime;
+        const bool running = _gameRunning;
+        lock.unlock();
+        _game->renderFrame(elapsedTime, running);
+        lock.lock();
+
+        _rendered = true;
+        _taskDone.notify_all();
+        lock.unlock();
+        Platform::swapBuffers();
+        lock.lock();
+        _task = NONE;
+        _taskDone.notify_all();
+    }
+    lock.unlock();
+
+    Platform::makeContextCurrent(false);
+}
+
+}
@@ -0,0 +1,126 @@
+#ifndef RENDERTHREAD_H_
+#define RENDERTHREAD_H_
+
+namespace gameplay
+{
+
+class Game;
+
+/**
+ * Defines the thread that renders and presents the frames of the game.
+ *
+ * While the render thread runs, the graphics context is current on it rather than on the
+ * game thread. Each frame, the game thread updates the game and then hands the frame to the
+ * render thread, which does the graphics work of the frame (destroying released graphics
+ * objects, uploading streamed textures and meshes, and the other per-frame upkeep), renders
+ * it through Game::render() and the render callbacks of scripts, and presents it.
+ *
+ * The game thread waits until the frame has been rendered, and only the swap of buffers,
+ * which blocks on the display and the GPU, overlaps with the update of the next frame. The
+ * scene is rendered from the live nodes, whose world matrices are computed lazily, so the
+ * update of the next frame cannot start before the rendering of the last one is done.
+ *
+ * The graphics context is only current on one thread at a time, which sets the rules for
+ * the code of the game:
+ *
+ * - Game::initialize() runs on the game thread before the render thread is started, with
+ *   the graphics context current, so it can create and load graphics resources as usual.
+ * - Game::render() and the render callbacks of scripts run on the render thread, with the
+ *   graphics context current.
+ * - Game::update(), the input, gesture and gamepad events, and the other script callbacks
+ *   run on the game thread without a graphics context, and must not make graphics calls.
+ *   This includes creating or loading textures, meshes, effects, materials and scenes, so
+ *   the resources needed after initialize() must be created from render().
+ * - Graphics objects released on the game thread are destroyed on the render thread at the
+ *   start of its next frame.
+ *
+ * The render thread is enabled by the renderThread property of the graphics namespace of
+ * game.config. It is only available on platforms that can move their graphics context
+ * between threads.
+ *
+ * Game owns the render thread.
+ *
+ * @script{ignore}
+ */
+class RenderThread
+{
+    friend class Game;
+
+private:
+
+    /**
+     * The kinds of work handed to the render thread.
+     */
+    enum Task
+    {
+        NONE,
+        RENDER,
+        EXIT
+    };
+
+    /**
+     * Constructor.
+     */
+    RenderThread(Game* game);
+
+    /**
+     * Destructor, which stops the thread.
+     */
+    ~RenderThread();
+
+    /**
+     * Hidden copy constructor.
+     */
+    RenderThread(const RenderThread&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    RenderThread& operator=(const RenderThread&);
+
+    /**
+     * Moves the graphics context to a new render thread.
+     *
+     * @return false if the platform cannot move its graphics context between threads.
+     */
+    bool start();
+
+    /**
+     * Waits for the frames handed to the render thread, stops it and makes the graphics
+     * context current on the calling thread again.
+     */
+    void stop();
+
+    /**
+     * Waits until the render thread has presented the last frame handed to it.
+     */
+    void waitForFrame();
+
+    /**
+     * Hands a frame to the render thread, which must be waiting for one, and waits until it has been rendered.
+     *
+     * @param elapsedTime The elapsed time of the frame, in milliseconds.
+     * @param running true if the game is running, false if it is paused.
+     */
+    void submit(float elapsedTime, bool running);
+
+    /**
+     * The body of the render thread.
+     */
+    void run();
+
+    Game* _game;
+    bool _running;
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _taskReady;
+    std::condition_variable _taskDone;
+    Task _task;
+    bool _rendered;
+    float _elapsedTime;
+    bool _gameRunning;
+};
+
+}
+
+#endif
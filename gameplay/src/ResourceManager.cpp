@@ -0,0 +1,200 @@
+#include "Base.h"
+#include "ResourceManager.h"
+#include "AudioBuffer.h"
+#include "AudioController.h"
+#include "DepthStencilTarget.h"
+#include "Effect.h"
+#include "FrameBuffer.h"
+#include "Game.h"
+#include "Mesh.h"
+#include "Texture.h"
+#include "VertexAttributeBinding.h"
+
+namespace gameplay
+{
+
+static size_t __memoryBudget = 0;
+static bool __memoryBudgetLoaded = false;
+
+// Budgets of the categories that are only reported against.
+static size_t __categoryBudgets[ResourceManager::CATEGORY_COUNT] = { 0 };
+
+const char* ResourceManager::getCategoryName(Category category)
+{
+    switch (category)
+    {
+    case TEXTURES:
+        return "textures";
+    case EFFECTS:
+        return "effects";
+    case AUDIO_BUFFERS:
+        return "audio buffers";
+    case VERTEX_ATTRIBUTE_BINDINGS:
+        return "vertex attribute bindings";
+    case MESHES:
+        return "meshes";
+    case FRAME_BUFFERS:
+        return "frame buffers";
+    default:
+        return "unknown";
+    }
+}
+
+void ResourceManager::getStats(Category category, Stats* stats)
+{
+    GP_ASSERT( stats );
+
+    stats->budget = getMemoryBudget(category);
+    switch (category)
+    {
+    case TEXTURES:
+        stats->count = Texture::getTextureCount();
+        stats->memorySize = Texture::getTotalMemorySize();
+        break;
+    case EFFECTS:
+        stats->count = Effect::getEffectCount();
+        stats->memorySize = Effect::getTotalMemorySize();
+        break;
+    case AUDIO_BUFFERS:
+        stats->count = AudioBuffer::getCacheCount();
+        stats->memorySize = AudioBuffer::getCacheSize();
+        break;
+    case VERTEX_ATTRIBUTE_BINDINGS:
+        stats->count = VertexAttributeBinding::getBindingCount();
+        stats->memorySize = VertexAttributeBinding::getTotalMemorySize();
+        break;
+    case MESHES:
+        stats->count = Mesh::getMeshCount();
+        stats->memorySize = Mesh::getTotalMemorySize();
+        break;
+    case FRAME_BUFFERS:
+        stats->count = (unsigned int)FrameBuffer::_frameBuffers.size();
+        stats->memorySize = DepthStencilTarget::getTotalMemorySize();
+        break;
+    default:
+        stats->count = 0;
+        stats->memorySize = 0;
+        break;
+    }
+}
+
+size_t ResourceManager::getMemorySize()
+{
+    return Texture::getTotalMemorySize() + Effect::getTotalMemorySize() + AudioBuffer::getCacheSize() + VertexAttributeBinding::getTotalMemorySize() +
+        Mesh::getTotalMemorySize() + DepthStencilTarget::getTotalMemorySize();
+}
+
+void ResourceManager::setMemoryBudget(size_t bytes)
+{
+    __memoryBudget = bytes;
+    __memoryBudgetLoaded = true;
+}
+
+size_t ResourceManager::getMemoryBudget()
+{
+    if (!__memoryBudgetLoaded)
+    {
+        Properties* resourcesConfig = Game::getInstance()->getConfig()->getNamespace("resources", true);
+        int kilobytes = resourcesConfig && resourcesConfig->exists("memoryBudget") ? resourcesConfig->getInt("memoryBudget") : 0;
+        __memoryBudget = kilobytes > 0 ? (size_t)kilobytes * 1024 : 0;
+        __memoryBudgetLoaded = true;
+    }
+    return __memoryBudget;
+}
+
+void ResourceManager::setMemoryBudget(Category category, size_t bytes)
+{
+    GP_ASSERT( category < CATEGORY_COUNT );
+
+    switch (category)
+    {
+    case TEXTURES:
+        Texture::setMemoryBudget(bytes);
+        break;
+    case AUDIO_BUFFERS:
+        {
+            AudioController* audioController = Game::getInstance()->getAudioController();
+            if (audioController)
+                audioController->setBufferCacheBudget((unsigned int)std::min(bytes, (size_t)std::numeric_limits<unsigned int>::max()));
+        }
+        break;
+    default:
+        __categoryBudgets[category] = bytes;
+        break;
+    }
+}
+
+size_t ResourceManager::getMemoryBudget(Category category)
+{
+    GP_ASSERT( category < CATEGORY_COUNT );
+
+    switch (category)
+    {
+    case TEXTURES:
+        return Texture::getMemoryBudget();
+    case AUDIO_BUFFERS:
+        {
+            AudioController* audioController = Game::getInstance()->getAudioController();
+            return audioController ? audioController->getBufferCacheBudget() : 0;
+        }
+    default:
+        return __categoryBudgets[category];
+    }
+}
+
+void ResourceManager::releaseUnused()
+{
+    AudioBuffer::trimCache(0);
+    Texture::releaseRetained();
+}
+
+void ResourceManager::printStats()
+{
+    size_t total = getMemorySize();
+    size_t budget = getMemoryBudget();
+    if (budget > 0)
+        print("[resources] %u KB of a %u KB budget.\n", (unsigned int)(total / 1024), (unsigned int)(budget / 1024));
+    else
+        print("[resources] %u KB.\n", (unsigned int)(total / 1024));
+
+    for (int i = 0; i < CATEGORY_COUNT; ++i)
+    {
+        Stats stats;
+        getStats((Category)i, &stats);
+        if (stats.budget > 0)
+        {
+            print("[resources] %8u KB of %8u KB%s  %5u  %s\n", (unsigned int)(stats.memorySize / 1024), (unsigned int)(stats.budget / 1024),
+                stats.memorySize > stats.budget ? " (over)" : "", stats.count, getCategoryName((Category)i));
+        }
+        else
+        {
+            print("[resources] %8u KB              %5u  %s\n", (unsigned int)(stats.memorySize / 1024), stats.count, getCategoryName((Category)i));
+        }
+    }
+}
+
+void ResourceManager::update()
+{
+    size_t budget = getMemoryBudget();
+    if (budget == 0)
+        return;
+    size_t size = getMemorySize();
+    if (size <= budget)
+        return;
+
+    // Audio buffers that no source holds are the cheapest to give up, since they are only reloaded if played again.
+    size_t cacheSize = AudioBuffer::getCacheSize();
+    size_t excess = size - budget;
+    AudioBuffer::trimCache((unsigned int)(cacheSize > excess ? cacheSize - excess : 0));
+
+    // Then textures are evicted or reduced until the rest fits.
+    size = getMemorySize();
+    if (size > budget)
+    {
+        size_t textureSize = Texture::getTotalMemorySize();
+        excess = size - budget;
+        Texture::trimResidency(textureSize > excess ? textureSize - excess : 0);
+    }
+}
+
+}
@@ -0,0 +1,148 @@
+#ifndef RESOURCEMANAGER_H_
+#define RESOURCEMANAGER_H_
+
+namespace gameplay
+{
+
+/**
+ * Defines the statistics and memory budgets of the resource caches of the engine.
+ *
+ * Textures, effects, audio buffers and vertex attribute bindings are each shared through a
+ * cache of their own and are reference counted with Ref, so a resource lives while anything
+ * holds it. The resource manager accounts the memory of each of these categories, and the
+ * caches that keep released resources around (textures and audio buffers) stay within their
+ * own budget as well as a global budget over all categories: while the resources exceed the
+ * global budget, audio buffers that only their cache holds are released first, then textures
+ * are evicted or reduced the same way Texture::setMemoryBudget() describes.
+ *
+ * The vertex and index buffers of meshes, and the depth and stencil buffers of frame buffers,
+ * are accounted alongside them although they are not cached. The color targets of frame
+ * buffers are textures and are accounted as such.
+ *
+ * The initial global budget is the 'memoryBudget' (in kilobytes) of the 'resources' section
+ * of the game config. When the platform reports that memory is low, releaseUnused() releases
+ * every resource that only a cache is keeping alive.
+ *
+ * @script{ignore}
+ */
+class ResourceManager
+{
+    friend class Game;
+
+public:
+
+    /**
+     * The categories of resources.
+     */
+    enum Category
+    {
+        TEXTURES,
+        EFFECTS,
+        AUDIO_BUFFERS,
+        VERTEX_ATTRIBUTE_BINDINGS,
+        MESHES,
+        FRAME_BUFFERS,
+        CATEGORY_COUNT
+    };
+
+    /**
+     * The statistics of a category of resources.
+     */
+    struct Stats
+    {
+        /**
+         * The number of resources.
+         */
+        unsigned int count;
+
+        /**
+         * The estimated number of bytes used by the resources.
+         */
+        size_t memorySize;
+
+        /**
+         * The budget of the category in bytes, or zero if it has no budget.
+         */
+        size_t budget;
+    };
+
+    /**
+     * Gets the name of a category, such as for reporting statistics.
+     *
+     * @param category The category.
+     *
+     * @return The name of the category.
+     */
+    static const char* getCategoryName(Category category);
+
+    /**
+     * Gets the statistics of a category of resources.
+     *
+     * @param category The category.
+     * @param stats Filled with the statistics of the category.
+     */
+    static void getStats(Category category, Stats* stats);
+
+    /**
+     * Gets the estimated number of bytes used by the resources of all categories.
+     *
+     * @return The memory size of all resources.
+     */
+    static size_t getMemorySize();
+
+    /**
+     * Sets the number of bytes that the resources of all categories should stay within.
+     *
+     * @param bytes The global memory budget, or zero for no budget.
+     */
+    static void setMemoryBudget(size_t bytes);
+
+    /**
+     * Gets the number of bytes that the resources of all categories should stay within.
+     *
+     * @return The global memory budget, or zero if there is no budget.
+     */
+    static size_t getMemoryBudget();
+
+    /**
+     * Sets the number of bytes that the resources of a category should stay within.
+     *
+     * The budget of textures is the one of Texture::setMemoryBudget() and the budget of audio
+     * buffers is the one of AudioController::setBufferCacheBudget(). The resources of the other
+     * categories only live while something holds them, so their budgets are only reported against.
+     *
+     * @param category The category.
+     * @param bytes The memory budget of the category, or zero for no budget.
+     */
+    static void setMemoryBudget(Category category, size_t bytes);
+
+    /**
+     * Gets the number of bytes that the resources of a category should stay within.
+     *
+     * @param category The category.
+     *
+     * @return The memory budget of the category, or zero if it has no budget.
+     */
+    static size_t getMemoryBudget(Category category);
+
+    /**
+     * Releases every resource that only its cache is keeping alive, such as when memory is low.
+     */
+    static void releaseUnused();
+
+    /**
+     * Prints the statistics of every category, and the memory budgets, to the log.
+     */
+    static void printStats();
+
+private:
+
+    /**
+     * Keeps the resources within the global memory budget. Called once per frame.
+     */
+    static void update();
+};
+
+}
+
+#endif
@@ -0,0 +1,14 @@
+#include "Base.h"
+#include "ResourceStats.h"
+
+namespace gameplay
+{
+
+ResourceStats::ResourceStats()
+    : textureCount(0), textureMemory(0), meshCount(0), meshMemory(0), effectCount(0), effectMemory(0),
+      vertexAttributeBindingCount(0), vertexAttributeBindingMemory(0), frameBufferCount(0), frameBufferMemory(0),
+      audioBufferCount(0), audioBufferMemory(0), totalMemory(0)
+{
+}
+
+}
@@ -0,0 +1,92 @@
+#ifndef RESOURCESTATS_H_
+#define RESOURCESTATS_H_
+
+namespace gameplay
+{
+
+/**
+ * Defines the number and estimated memory size of the resources of each type.
+ *
+ * The statistics are a snapshot of the resource caches and GPU buffers tracked by
+ * ResourceManager, taken when Game::getResourceStats() is called. Memory sizes are
+ * estimates in bytes of what the resources hold on the GPU or in their caches, and do
+ * not include the memory of the objects themselves unless noted otherwise.
+ */
+class ResourceStats
+{
+public:
+
+    /**
+     * Constructor.
+     */
+    ResourceStats();
+
+    /**
+     * The number of textures, including the color targets of frame buffers.
+     */
+    unsigned int textureCount;
+
+    /**
+     * The number of bytes of the resident levels of all textures.
+     */
+    size_t textureMemory;
+
+    /**
+     * The number of meshes.
+     */
+    unsigned int meshCount;
+
+    /**
+     * The number of bytes of the vertex and index buffers owned by all meshes.
+     */
+    size_t meshMemory;
+
+    /**
+     * The number of effects.
+     */
+    unsigned int effectCount;
+
+    /**
+     * The number of bytes used by all effects.
+     */
+    size_t effectMemory;
+
+    /**
+     * The number of vertex attribute bindings.
+     */
+    unsigned int vertexAttributeBindingCount;
+
+    /**
+     * The number of bytes used by all vertex attribute bindings themselves.
+     */
+    size_t vertexAttributeBindingMemory;
+
+    /**
+     * The number of frame buffers, excluding the default frame buffer.
+     */
+    unsigned int frameBufferCount;
+
+    /**
+     * The number of bytes of the depth and stencil buffers of all frame buffers.
+     */
+    size_t frameBufferMemory;
+
+    /**
+     * The number of audio buffers in the audio buffer cache.
+     */
+    unsigned int audioBufferCount;
+
+    /**
+     * The number of bytes of the audio buffers in the audio buffer cache.
+     */
+    size_t audioBufferMemory;
+
+    /**
+     * The number of bytes used by the resources of all types.
+     */
+    size_t totalMemory;
+};
+
+}
+
+#endif
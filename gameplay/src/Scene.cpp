@@ -5,7 +5,10 @@
 #include "MeshSkin.h"
 #include "Joint.h"
 #include "Terrain.h"
+#include "StreamingTerrain.h"
+#include "StringTable.h"
 #include "Bundle.h"
+#include "Game.h"
 
 namespace gameplay
 {
@@ -13,6 +16,22 @@ namespace gameplay
 // Global list of active scenes
 static std::vector<Scene*> __sceneList;
 
+// The minimum number of nodes for Scene::updateTransforms() to resolve subtrees in parallel.
+#define SCENE_PARALLEL_TRANSFORM_NODES 4096
+
+// The minimum number of thread-safe drawables for Scene::update() to update them in parallel.
+#define SCENE_PARALLEL_UPDATE_DRAWABLES 4
+
+// The fraction of a node's bounding radius that its spatial index box is fattened by,
+// so that small movements do not restructure the index.
+#define SCENE_SPATIAL_MARGIN 0.1f
+
+// The default fraction of the size of a region of the visibility cache that it is enlarged by on each side.
+#define SCENE_VISIBILITY_CACHE_MARGIN 0.1f
+
+// The number of regions kept by the visibility cache, for the views of the cameras and lights culled each frame.
+#define SCENE_VISIBILITY_CACHE_REGIONS 8
+
 static inline char lowercase(char c)
 {
     if (c >= 'A' && c <='Z')
@@ -61,7 +80,10 @@ static bool endsWith(const char* str, const char* suffix, bool ignoreCase)
 
 Scene::Scene()
     : _id(""), _activeCamera(NULL), _firstNode(NULL), _lastNode(NULL), _nodeCount(0), _bindAudioListenerToCamera(true), 
-      _nextItr(NULL), _nextReset(true)
+      _nextItr(NULL), _nextReset(true), _transformOrderDirty(true),
+      _parallelUpdate(false), _updateNodesDirty(true),
+      _spatialTree(NULL), _visibilityCacheEnabled(false), _visibilityCacheMargin(SCENE_VISIBILITY_CACHE_MARGIN),
+      _visibleFrame(0), _nodeIndex(NULL), _objectPool(ObjectPool::create())
 {
     __sceneList.push_back(this);
 }
@@ -82,6 +104,11 @@ Scene::~Scene()
 
     // Remove all nodes from the scene
     removeAllNodes();
+    SAFE_DELETE(_spatialTree);
+    SAFE_DELETE(_nodeIndex);
+
+    // The pool lives on until nodes still referenced elsewhere are released
+    _objectPool->release();
 
     // Remove the scene from global list
     std::vector<Scene*>::iterator itr = std::find(__sceneList.begin(), __sceneList.end(), this);
@@ -112,6 +139,16 @@ Scene* Scene::load(const char* filePath)
     return SceneLoader::load(filePath);
 }
 
+void Scene::loadAsync(const char* filePath, const LoadCallback& callback)
+{
+    GP_ASSERT(filePath);
+
+    if (endsWith(filePath, ".gpb", true))
+        Bundle::loadAsync(filePath, NULL, NULL, callback);
+    else
+        Bundle::loadAsync(NULL, filePath, NULL, callback);
+}
+
 Scene* Scene::getScene(const char* id)
 {
     if (id == NULL)
@@ -141,11 +178,43 @@ Node* Scene::findNode(const char* id, bool recursive, bool exactMatch) const
 {
     GP_ASSERT(id);
 
+    if (_nodeIndex && recursive)
+    {
+        std::multimap<std::string, Node*>::const_iterator first, last;
+        if (exactMatch)
+        {
+            std::pair<std::multimap<std::string, Node*>::const_iterator, std::multimap<std::string, Node*>::const_iterator> range = _nodeIndex->equal_range(id);
+            first = range.first;
+            last = range.second;
+        }
+        else
+        {
+            // Node IDs that start with the given prefix are contiguous in the index.
+            const size_t length = strlen(id);
+            first = last = _nodeIndex->lower_bound(id);
+            while (last != _nodeIndex->end() && last->first.compare(0, length, id) == 0)
+                ++last;
+        }
+
+        if (first == last)
+            return NULL;
+
+        // A unique match is the node the search would find; otherwise search to preserve the traversal order.
+        std::multimap<std::string, Node*>::const_iterator next = first;
+        if (++next == last)
+            return first->second;
+    }
+
+    // No node can have an ID that was never interned.
+    const unsigned int handle = StringTable::find(id);
+    if (exactMatch && handle == STRING_TABLE_NOT_FOUND)
+        return NULL;
+
     // Search immediate children first.
     for (Node* child = getFirstNode(); child != NULL; child = child->getNextSibling())
     {
         // Does this child's ID match?
-        if ((exactMatch && child->_id == id) || (!exactMatch && child->_id.find(id) == 0))
+        if (child->matchesId(id, handle, exactMatch))
         {
             return child;
         }
@@ -156,7 +225,7 @@ Node* Scene::findNode(const char* id, bool recursive, bool exactMatch) const
     {
         for (Node* child = getFirstNode(); child != NULL; child = child->getNextSibling())
         {
-            Node* match = child->findNode(id, true, exactMatch);
+            Node* match = child->findNode(id, handle, true, exactMatch, false);
             if (match)
             {
                 return match;
@@ -170,13 +239,32 @@ unsigned int Scene::findNodes(const char* id, std::vector<Node*>& nodes, bool re
 {
     GP_ASSERT(id);
 
+    if (_nodeIndex && recursive)
+    {
+        unsigned int count = 0;
+        const size_t length = strlen(id);
+        for (std::multimap<std::string, Node*>::const_iterator itr = _nodeIndex->lower_bound(id); itr != _nodeIndex->end(); ++itr)
+        {
+            if (exactMatch ? itr->first != id : itr->first.compare(0, length, id) != 0)
+                break;
+            nodes.push_back(itr->second);
+            ++count;
+        }
+        return count;
+    }
+
+    // No node can have an ID that was never interned.
+    const unsigned int handle = StringTable::find(id);
+    if (exactMatch && handle == STRING_TABLE_NOT_FOUND)
+        return 0;
+
     unsigned int count = 0;
 
     // Search immediate children first.
     for (Node* child = getFirstNode(); child != NULL; child = child->getNextSibling())
     {
         // Does this child's ID match?
-        if ((exactMatch && child->_id == id) || (!exactMatch && child->_id.find(id) == 0))
+        if (child->matchesId(id, handle, exactMatch))
         {
             nodes.push_back(child);
             ++count;
@@ -188,20 +276,48 @@ unsigned int Scene::findNodes(const char* id, std::vector<Node*>& nodes, bool re
     {
         for (Node* child = getFirstNode(); child != NULL; child = child->getNextSibling())
         {
-            count += child->findNodes(id, nodes, true, exactMatch);
+            count += child->findNodes(id, handle, nodes, true, exactMatch, false);
         }
     }
 
     return count;
 }
 
-void Scene::visitNode(Node* node, const char* visitMethod)
+// Calls a resolved visit function with a node.
+static bool callVisitMethod(ScriptController* sc, const ScriptFunction& visitMethod, bool* result, ...)
+{
+    va_list list;
+    va_start(list, result);
+    bool success = sc->executeFunction(visitMethod, "<Node>", result, &list);
+    va_end(list);
+    return success;
+}
+
+void Scene::visit(const char* visitMethod)
+{
+    GP_PROFILE_SCOPE("Scene::visit");
+
+    // Resolve the function once for the traversal, rather than by name for every node.
+    ScriptFunction function;
+    if (!Game::getInstance()->getScriptController()->resolveFunction(visitMethod, &function))
+    {
+        GP_WARN("Failed to find the visit function '%s'.", visitMethod);
+        return;
+    }
+
+    for (Node* node = getFirstNode(); node != NULL; node = node->getNextSibling())
+    {
+        visitNode(node, function);
+    }
+}
+
+void Scene::visitNode(Node* node, const ScriptFunction& visitMethod)
 {
     ScriptController* sc = Game::getInstance()->getScriptController();
 
     // Invoke the visit method for this node.
     bool result;
-    if (!sc->executeFunction<bool>(visitMethod, "<Node>", &result, (void*)node) || !result)
+    if (!callVisitMethod(sc, visitMethod, &result, (void*)node) || !result)
         return;
 
     // If this node has a model with a mesh skin, visit the joint hierarchy within it
@@ -221,8 +337,154 @@ void Scene::visitNode(Node* node, const char* visitMethod)
     }
 }
 
+// Returns the query flag of the type of a drawable, or zero for none.
+static unsigned int getDrawableQueryFlag(Drawable* drawable)
+{
+    if (drawable == NULL)
+        return 0;
+    if (dynamic_cast<Model*>(drawable))
+        return Scene::QUERY_MODEL;
+    if (dynamic_cast<Terrain*>(drawable) || dynamic_cast<StreamingTerrain*>(drawable))
+        return Scene::QUERY_TERRAIN;
+    if (dynamic_cast<Sprite*>(drawable))
+        return Scene::QUERY_SPRITE;
+    if (dynamic_cast<TileSet*>(drawable))
+        return Scene::QUERY_TILESET;
+    if (dynamic_cast<Text*>(drawable))
+        return Scene::QUERY_TEXT;
+    if (dynamic_cast<ParticleEmitter*>(drawable))
+        return Scene::QUERY_PARTICLE_EMITTER;
+    if (dynamic_cast<Form*>(drawable))
+        return Scene::QUERY_FORM;
+    return 0;
+}
+
+unsigned int Scene::findNodes(const char* tag, unsigned int flags, std::vector<Node*>& nodes) const
+{
+    GP_PROFILE_SCOPE("Scene::findNodes");
+
+    // Tags are compared by handle, and a tag that was never interned is on no node.
+    unsigned int handle = STRING_TABLE_NOT_FOUND;
+    if (tag)
+    {
+        handle = StringTable::find(tag);
+        if (handle == STRING_TABLE_NOT_FOUND)
+            return 0;
+    }
+    if ((flags & QUERY_VISIBLE) && _visibleFrame == 0)
+        return 0;
+
+    const size_t start = nodes.size();
+    for (Node* node = getFirstNode(); node != NULL; node = node->getNextSibling())
+    {
+        findNodes(node, handle, flags, nodes);
+    }
+    return (unsigned int)(nodes.size() - start);
+}
+
+void Scene::findNodes(Node* node, unsigned int tag, unsigned int flags, std::vector<Node*>& nodes) const
+{
+    if ((flags & QUERY_ENABLED) && !node->isEnabled())
+        return;
+
+    bool found = true;
+    if (tag != STRING_TABLE_NOT_FOUND)
+    {
+        found = false;
+        for (size_t i = 0, count = node->_tags ? node->_tags->size() : 0; i < count && !found; ++i)
+        {
+            found = (*node->_tags)[i].first == tag;
+        }
+    }
+    if (found && (flags & QUERY_VISIBLE))
+        found = node->_visibleFrame == _visibleFrame;
+    if (found && (flags & QUERY_DRAWABLE))
+        found = (getDrawableQueryFlag(node->getDrawable()) & flags) != 0;
+    if (found)
+        nodes.push_back(node);
+
+    // Joint hierarchies are not added to the scene, so they are searched through their skins as visit() does.
+    Model* model = dynamic_cast<Model*>(node->getDrawable());
+    if (model && model->_skin && model->_skin->_rootNode)
+    {
+        findNodes(model->_skin->_rootNode, tag, flags, nodes);
+    }
+
+    for (Node* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+    {
+        findNodes(child, tag, flags, nodes);
+    }
+}
+
+int Scene::luaFindNodes(lua_State* state)
+{
+    void* userdata = luaL_checkudata(state, 1, "Scene");
+    luaL_argcheck(state, userdata != NULL, 1, "'Scene' expected.");
+    Scene* scene = (Scene*)((ScriptUtil::LuaObject*)userdata)->instance;
+    const char* tag = lua_isnoneornil(state, 2) ? NULL : luaL_checkstring(state, 2);
+    unsigned int flags = (unsigned int)luaL_optinteger(state, 3, 0);
+
+    // Scripts run on the main thread, so the vector of nodes found is kept between calls.
+    static std::vector<Node*> nodes;
+    nodes.clear();
+    scene->findNodes(tag, flags, nodes);
+
+    lua_createtable(state, (int)nodes.size(), 0);
+    for (size_t i = 0, count = nodes.size(); i < count; ++i)
+    {
+        ScriptUtil::LuaObject* object = (ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(ScriptUtil::LuaObject));
+        object->instance = nodes[i];
+        object->owns = false;
+        luaL_getmetatable(state, "Node");
+        lua_setmetatable(state, -2);
+        lua_rawseti(state, -2, (int)i + 1);
+    }
+    return 1;
+}
+
+void Scene::registerScriptFunctions(lua_State* state)
+{
+    // The generated bindings cannot return a vector of nodes, so findNodes() is added to the methods of scenes here.
+    luaL_getmetatable(state, "Scene");
+    if (lua_istable(state, -1))
+    {
+        lua_pushcfunction(state, luaFindNodes);
+        lua_setfield(state, -2, "findNodes");
+    }
+    lua_pop(state, 1);
+
+    static const struct
+    {
+        const char* name;
+        unsigned int flag;
+    } queryFlags[] =
+    {
+        { "QUERY_ENABLED", QUERY_ENABLED },
+        { "QUERY_VISIBLE", QUERY_VISIBLE },
+        { "QUERY_MODEL", QUERY_MODEL },
+        { "QUERY_TERRAIN", QUERY_TERRAIN },
+        { "QUERY_SPRITE", QUERY_SPRITE },
+        { "QUERY_TILESET", QUERY_TILESET },
+        { "QUERY_TEXT", QUERY_TEXT },
+        { "QUERY_PARTICLE_EMITTER", QUERY_PARTICLE_EMITTER },
+        { "QUERY_FORM", QUERY_FORM },
+        { "QUERY_DRAWABLE", QUERY_DRAWABLE }
+    };
+    lua_getglobal(state, "Scene");
+    if (lua_istable(state, -1))
+    {
+        for (size_t i = 0; i < sizeof(queryFlags) / sizeof(queryFlags[0]); ++i)
+        {
+            lua_pushinteger(state, queryFlags[i].flag);
+            lua_setfield(state, -2, queryFlags[i].name);
+        }
+    }
+    lua_pop(state, 1);
+}
+
 Node* Scene::addNode(const char* id)
 {
+    ObjectPool::Scope scope(_objectPool);
     Node* node = Node::create(id);
     GP_ASSERT(node);
     addNode(node);
@@ -272,6 +534,7 @@ void Scene::addNode(Node* node)
     node->_scene = this;
 
     ++_nodeCount;
+    hierarchyAdded(node);
 
     // If we don't have an active camera set, then check for one and set it.
     if (_activeCamera == NULL)
@@ -300,6 +563,7 @@ void Scene::removeNode(Node* node)
         _lastNode = node->_prevSibling;
     }
 
+    hierarchyRemoved(node);
     node->remove();
     node->_scene = NULL;
 
@@ -326,6 +590,11 @@ Node* Scene::getFirstNode() const
     return _firstNode;
 }
 
+ObjectPool* Scene::getObjectPool() const
+{
+    return _objectPool;
+}
+
 Camera* Scene::getActiveCamera()
 {
     return _activeCamera;
@@ -393,6 +662,761 @@ void Scene::update(float elapsedTime)
         if (node->isEnabled())
             node->update(elapsedTime);
     }
+
+    if (_parallelUpdate)
+        updateDrawables(elapsedTime);
+}
+
+void Scene::setParallelUpdateEnabled(bool enabled)
+{
+    _parallelUpdate = enabled;
+    if (!enabled)
+    {
+        _updateNodes.clear();
+        _updateJobNodes.clear();
+        _updateNodesDirty = true;
+    }
+}
+
+bool Scene::isParallelUpdateEnabled() const
+{
+    return _parallelUpdate;
+}
+
+void Scene::addUpdateNodes(Node* node)
+{
+    Drawable* drawable = node->getDrawable();
+    if (drawable && drawable->isUpdatable())
+        _updateNodes.push_back(node);
+    for (Node* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+    {
+        addUpdateNodes(child);
+    }
+}
+
+void Scene::updateDrawables(float elapsedTime)
+{
+    GP_PROFILE_SCOPE("Scene::updateDrawables");
+
+    if (_updateNodesDirty)
+    {
+        _updateNodes.clear();
+        for (Node* node = _firstNode; node != NULL; node = node->_nextSibling)
+        {
+            addUpdateNodes(node);
+        }
+        _updateNodesDirty = false;
+    }
+    if (_updateNodes.empty())
+        return;
+
+    // The drawables that are not thread-safe are updated first, on this thread.
+    _updateJobNodes.clear();
+    for (size_t i = 0, count = _updateNodes.size(); i < count; ++i)
+    {
+        Node* node = _updateNodes[i];
+        if (!node->isEnabledInHierarchy())
+            continue;
+
+        Drawable* drawable = node->getDrawable();
+        if (!drawable->isUpdateThreadSafe())
+        {
+            drawable->updateDrawable(elapsedTime);
+            drawable->finishUpdate();
+            continue;
+        }
+
+        // World matrices are resolved lazily through the shared ancestors of the nodes, so they
+        // are resolved here before the drawables read them on other threads.
+        node->getWorldMatrix();
+        _updateJobNodes.push_back(node);
+    }
+
+    const unsigned int jobCount = (unsigned int)_updateJobNodes.size();
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem && jobCount >= SCENE_PARALLEL_UPDATE_DRAWABLES)
+    {
+        jobSystem->parallelFor(0, jobCount, [this, elapsedTime](unsigned int first, unsigned int last)
+        {
+            for (unsigned int i = first; i < last; ++i)
+            {
+                _updateJobNodes[i]->getDrawable()->updateDrawable(elapsedTime);
+            }
+        });
+    }
+    else
+    {
+        for (unsigned int i = 0; i < jobCount; ++i)
+        {
+            _updateJobNodes[i]->getDrawable()->updateDrawable(elapsedTime);
+        }
+    }
+
+    for (unsigned int i = 0; i < jobCount; ++i)
+    {
+        _updateJobNodes[i]->getDrawable()->finishUpdate();
+    }
+}
+
+void Scene::updateTransforms()
+{
+    GP_PROFILE_SCOPE("Scene::updateTransforms");
+
+    if (_transformOrderDirty)
+        buildTransformOrder();
+
+    const unsigned int nodeCount = (unsigned int)_transformNodes.size();
+    const unsigned int rootCount = (unsigned int)_transformRoots.size() - 1;
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem && rootCount > 1 && nodeCount >= SCENE_PARALLEL_TRANSFORM_NODES)
+    {
+        // Top level subtrees are contiguous in the ordering and share no nodes, so they can be resolved independently.
+        jobSystem->parallelFor(0, rootCount, [this](unsigned int first, unsigned int last)
+        {
+            updateTransformRange(_transformRoots[first], _transformRoots[last]);
+        });
+    }
+    else
+    {
+        updateTransformRange(0, nodeCount);
+    }
+}
+
+void Scene::buildTransformOrder()
+{
+    _transformNodes.clear();
+    _transformParents.clear();
+    _transformRoots.clear();
+    for (Node* node = _firstNode; node != NULL; node = node->_nextSibling)
+    {
+        _transformRoots.push_back((unsigned int)_transformNodes.size());
+        addTransformNode(node, -1);
+    }
+    _transformRoots.push_back((unsigned int)_transformNodes.size());
+    _transformOrderDirty = false;
+}
+
+void Scene::addTransformNode(Node* node, int parentIndex)
+{
+    GP_ASSERT(node);
+
+    int index = (int)_transformNodes.size();
+    _transformNodes.push_back(node);
+    _transformParents.push_back(parentIndex);
+    for (Node* child = node->_firstChild; child != NULL; child = child->_nextSibling)
+    {
+        addTransformNode(child, index);
+    }
+}
+
+void Scene::updateTransformRange(unsigned int begin, unsigned int end)
+{
+    // Parents always precede their children, so a parent's world matrix is already resolved when its children are reached.
+    for (unsigned int i = begin; i < end; ++i)
+    {
+        int parentIndex = _transformParents[i];
+        _transformNodes[i]->updateWorldMatrix(parentIndex >= 0 ? &_transformNodes[parentIndex]->_world : NULL);
+    }
+}
+
+void Scene::setNodeIndexEnabled(bool enabled)
+{
+    if (enabled == (_nodeIndex != NULL))
+        return;
+
+    if (enabled)
+    {
+        _nodeIndex = new std::multimap<std::string, Node*>();
+        for (Node* node = _firstNode; node != NULL; node = node->_nextSibling)
+        {
+            addIndexedNodes(node);
+        }
+    }
+    else
+    {
+        SAFE_DELETE(_nodeIndex);
+    }
+}
+
+bool Scene::isNodeIndexEnabled() const
+{
+    return _nodeIndex != NULL;
+}
+
+// Determines if the given subtree has static nodes with drawables, which the visibility cache may hold.
+static bool hasStaticDrawableNodes(Node* node)
+{
+    if (node->getDrawable() && node->isStatic())
+        return true;
+    for (Node* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+    {
+        if (hasStaticDrawableNodes(child))
+            return true;
+    }
+    return false;
+}
+
+void Scene::hierarchyAdded(Node* node)
+{
+    GP_ASSERT(node);
+
+    _transformOrderDirty = true;
+    _updateNodesDirty = true;
+    if (!_visibilityCaches.empty() && hasStaticDrawableNodes(node))
+        invalidateVisibilityCache();
+    addSpatialNodes(node);
+    addIndexedNodes(node);
+}
+
+void Scene::hierarchyRemoved(Node* node)
+{
+    GP_ASSERT(node);
+
+    _transformOrderDirty = true;
+    _updateNodesDirty = true;
+    if (!_visibilityCaches.empty() && hasStaticDrawableNodes(node))
+        invalidateVisibilityCache();
+    removeSpatialNodes(node);
+    removeIndexedNodes(node);
+}
+
+void Scene::addIndexedNode(Node* node)
+{
+    GP_ASSERT(node);
+
+    if (_nodeIndex)
+        _nodeIndex->insert(std::make_pair(std::string(node->getId()), node));
+}
+
+void Scene::removeIndexedNode(Node* node)
+{
+    GP_ASSERT(node);
+
+    if (!_nodeIndex)
+        return;
+
+    std::pair<std::multimap<std::string, Node*>::iterator, std::multimap<std::string, Node*>::iterator> range = _nodeIndex->equal_range(node->getId());
+    for (std::multimap<std::string, Node*>::iterator itr = range.first; itr != range.second; ++itr)
+    {
+        if (itr->second == node)
+        {
+            _nodeIndex->erase(itr);
+            break;
+        }
+    }
+}
+
+void Scene::addIndexedNodes(Node* node)
+{
+    if (!_nodeIndex)
+        return;
+
+    addIndexedNode(node);
+    for (Node* child = node->_firstChild; child != NULL; child = child->_nextSibling)
+    {
+        addIndexedNodes(child);
+    }
+}
+
+void Scene::removeIndexedNodes(Node* node)
+{
+    if (!_nodeIndex)
+        return;
+
+    removeIndexedNode(node);
+    for (Node* child = node->_firstChild; child != NULL; child = child->_nextSibling)
+    {
+        removeIndexedNodes(child);
+    }
+}
+
+void Scene::setSpatialIndexEnabled(bool enabled)
+{
+    if (enabled == (_spatialTree != NULL))
+        return;
+
+    if (enabled)
+    {
+        _spatialTree = new BoundingVolumeTree();
+        for (Node* node = _firstNode; node != NULL; node = node->_nextSibling)
+        {
+            addSpatialNodes(node);
+        }
+    }
+    else
+    {
+        for (Node* node = _firstNode; node != NULL; node = node->_nextSibling)
+        {
+            removeSpatialNodes(node);
+        }
+        GP_ASSERT(_spatialDirtyNodes.empty());
+        SAFE_DELETE(_spatialTree);
+    }
+}
+
+bool Scene::isSpatialIndexEnabled() const
+{
+    return _spatialTree != NULL;
+}
+
+void Scene::setVisibilityCacheEnabled(bool enabled)
+{
+    _visibilityCacheEnabled = enabled;
+    invalidateVisibilityCache();
+}
+
+bool Scene::isVisibilityCacheEnabled() const
+{
+    return _visibilityCacheEnabled;
+}
+
+void Scene::setVisibilityCacheMargin(float margin)
+{
+    GP_ASSERT(margin >= 0.0f);
+    _visibilityCacheMargin = margin;
+    invalidateVisibilityCache();
+}
+
+float Scene::getVisibilityCacheMargin() const
+{
+    return _visibilityCacheMargin;
+}
+
+void Scene::invalidateVisibilityCache()
+{
+    _visibilityCaches.clear();
+}
+
+// Appends the enabled nodes with drawables in the given subtree, except for the static ones if requested.
+static void gatherEnabledDrawableNodes(Node* node, std::vector<Node*>& nodes, bool skipStatic)
+{
+    if (!node->isEnabled())
+        return;
+    if (node->getDrawable() && !(skipStatic && node->isStatic()))
+        nodes.push_back(node);
+    for (Node* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+    {
+        gatherEnabledDrawableNodes(child, nodes, skipStatic);
+    }
+}
+
+// Appends the static nodes with drawables in the given subtree whose bounds intersect the given region,
+// whether they are enabled or not.
+static void gatherStaticDrawableNodes(Node* node, const BoundingBox& region, std::vector<Node*>& nodes)
+{
+    if (node->getDrawable() && node->isStatic() && region.intersects(node->getBoundingSphere()))
+        nodes.push_back(node);
+    for (Node* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+    {
+        gatherStaticDrawableNodes(child, region, nodes);
+    }
+}
+
+Scene::VisibilityCache* Scene::getVisibilityCache(const BoundingBox& region)
+{
+    const unsigned int frame = Game::getInstance()->getFrameNumber();
+    VisibilityCache* cache = NULL;
+    for (size_t i = 0, count = _visibilityCaches.size(); i < count; ++i)
+    {
+        VisibilityCache& candidate = _visibilityCaches[i];
+        const BoundingBox& cached = candidate.region;
+        if (region.min.x >= cached.min.x && region.min.y >= cached.min.y && region.min.z >= cached.min.z &&
+            region.max.x <= cached.max.x && region.max.y <= cached.max.y && region.max.z <= cached.max.z)
+        {
+            candidate.frame = frame;
+            return &candidate;
+        }
+        if (cache == NULL || candidate.frame < cache->frame)
+            cache = &candidate;
+    }
+    if (_visibilityCaches.size() < SCENE_VISIBILITY_CACHE_REGIONS)
+    {
+        _visibilityCaches.push_back(VisibilityCache());
+        cache = &_visibilityCaches.back();
+    }
+    GP_ASSERT(cache);
+
+    // The region is enlarged so that the view can move and turn within it before it is found again.
+    GP_PROFILE_SCOPE("Scene::getVisibilityCache");
+    const Vector3 margin = (region.max - region.min) * _visibilityCacheMargin;
+    cache->region.set(region.min - margin, region.max + margin);
+    cache->frame = frame;
+    cache->nodes.clear();
+    if (_spatialTree)
+    {
+        updateSpatialIndex();
+        std::vector<void*> proxies;
+        _spatialTree->query(cache->region, proxies);
+        for (size_t i = 0, count = proxies.size(); i < count; ++i)
+        {
+            Node* node = static_cast<Node*>(proxies[i]);
+            if (node->isStatic())
+                cache->nodes.push_back(node);
+        }
+    }
+    else
+    {
+        for (Node* node = _firstNode; node != NULL; node = node->_nextSibling)
+        {
+            gatherStaticDrawableNodes(node, cache->region, cache->nodes);
+        }
+    }
+    cache->bounds.resize(cache->nodes.size());
+    for (size_t i = 0, count = cache->nodes.size(); i < count; ++i)
+    {
+        cache->bounds[i] = cache->nodes[i]->getBoundingSphere();
+    }
+    return cache;
+}
+
+template <class T>
+unsigned int Scene::gatherCullNodes(const T& volume, const BoundingBox& region)
+{
+    // The static nodes near a region that was culled recently are kept by its cache.
+    const VisibilityCache* cache = _visibilityCacheEnabled ? getVisibilityCache(region) : NULL;
+    const bool skipStatic = cache != NULL;
+
+    // Gather the candidates first so their bounds can be tested against the frustums in one batch.
+    _cullNodes.clear();
+    if (_spatialTree)
+    {
+        updateSpatialIndex();
+        std::vector<void*> proxies;
+        _spatialTree->query(volume, proxies);
+        for (size_t i = 0, count = proxies.size(); i < count; ++i)
+        {
+            Node* node = static_cast<Node*>(proxies[i]);
+            if (node->isEnabledInHierarchy() && !(skipStatic && node->isStatic()))
+                _cullNodes.push_back(node);
+        }
+    }
+    else
+    {
+        for (Node* node = _firstNode; node != NULL; node = node->_nextSibling)
+        {
+            gatherEnabledDrawableNodes(node, _cullNodes, skipStatic);
+        }
+    }
+
+    const unsigned int dynamicCount = (unsigned int)_cullNodes.size();
+    _cullBounds.resize(dynamicCount);
+    for (unsigned int i = 0; i < dynamicCount; ++i)
+    {
+        _cullBounds[i] = _cullNodes[i]->getBoundingSphere();
+    }
+    if (cache)
+    {
+        for (size_t i = 0, count = cache->nodes.size(); i < count; ++i)
+        {
+            if (cache->nodes[i]->isEnabledInHierarchy())
+            {
+                _cullNodes.push_back(cache->nodes[i]);
+                _cullBounds.push_back(cache->bounds[i]);
+            }
+        }
+    }
+
+    const unsigned int candidateCount = (unsigned int)_cullNodes.size();
+    _cullMask.resize((candidateCount + 31) / 32);
+    return candidateCount;
+}
+
+unsigned int Scene::findVisibleNodes(const Frustum& frustum, std::vector<Node*>& nodes)
+{
+    GP_PROFILE_SCOPE("Scene::findVisibleNodes");
+
+    const unsigned int frame = Game::getInstance()->getFrameNumber();
+    _visibleFrame = frame;
+
+    // The region around the frustum is only needed by the visibility cache.
+    BoundingBox region;
+    if (_visibilityCacheEnabled)
+    {
+        Vector3 corners[8];
+        frustum.getCorners(corners);
+        region.set(corners[0], corners[0]);
+        for (unsigned int i = 1; i < 8; ++i)
+        {
+            region.min.set(std::min(region.min.x, corners[i].x), std::min(region.min.y, corners[i].y), std::min(region.min.z, corners[i].z));
+            region.max.set(std::max(region.max.x, corners[i].x), std::max(region.max.y, corners[i].y), std::max(region.max.z, corners[i].z));
+        }
+    }
+    const unsigned int candidateCount = gatherCullNodes(frustum, region);
+    if (candidateCount == 0)
+        return 0;
+
+    const unsigned int count = frustum.intersects(&_cullBounds[0], candidateCount, &_cullMask[0]);
+
+    for (unsigned int i = 0; i < candidateCount; ++i)
+    {
+        if (_cullMask[i >> 5] & (1u << (i & 31)))
+        {
+            _cullNodes[i]->_visibleFrame = frame;
+            nodes.push_back(_cullNodes[i]);
+        }
+    }
+    return count;
+}
+
+unsigned int Scene::findVisibleNodes(Camera* const* cameras, unsigned int cameraCount, std::vector<Node*>& nodes, std::vector<unsigned int>& viewMasks)
+{
+    GP_PROFILE_SCOPE("Scene::findVisibleNodes");
+    GP_ASSERT(cameras || cameraCount == 0);
+    GP_ASSERT(cameraCount <= 32);
+
+    if (cameraCount == 0)
+        return 0;
+    cameraCount = std::min(cameraCount, 32u);
+
+    const unsigned int frame = Game::getInstance()->getFrameNumber();
+    _visibleFrame = frame;
+
+    // The spatial index is queried once, by the box around the corners of all the frustums.
+    Vector3 min(FLT_MAX, FLT_MAX, FLT_MAX);
+    Vector3 max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (unsigned int i = 0; i < cameraCount; ++i)
+    {
+        GP_ASSERT(cameras[i]);
+        Vector3 corners[8];
+        cameras[i]->getFrustum().getCorners(corners);
+        for (unsigned int j = 0; j < 8; ++j)
+        {
+            min.set(std::min(min.x, corners[j].x), std::min(min.y, corners[j].y), std::min(min.z, corners[j].z));
+            max.set(std::max(max.x, corners[j].x), std::max(max.y, corners[j].y), std::max(max.z, corners[j].z));
+        }
+    }
+    const BoundingBox region(min, max);
+    const unsigned int candidateCount = gatherCullNodes(region, region);
+    if (candidateCount == 0)
+        return 0;
+
+    // Test the candidates against each frustum, collecting the views of each candidate as bits.
+    const unsigned int wordCount = (unsigned int)_cullMask.size();
+    _cullViewMasks.assign(candidateCount, 0);
+    for (unsigned int view = 0; view < cameraCount; ++view)
+    {
+        if (cameras[view]->getFrustum().intersects(&_cullBounds[0], candidateCount, &_cullMask[0]) == 0)
+            continue;
+        for (unsigned int word = 0; word < wordCount; ++word)
+        {
+            for (unsigned int bits = _cullMask[word]; bits != 0; bits &= bits - 1)
+            {
+                unsigned int bit = 0;
+                while (!(bits & (1u << bit)))
+                    ++bit;
+                _cullViewMasks[(word << 5) + bit] |= 1u << view;
+            }
+        }
+    }
+
+    unsigned int count = 0;
+    for (unsigned int i = 0; i < candidateCount; ++i)
+    {
+        if (_cullViewMasks[i])
+        {
+            _cullNodes[i]->_visibleFrame = frame;
+            nodes.push_back(_cullNodes[i]);
+            viewMasks.push_back(_cullViewMasks[i]);
+            ++count;
+        }
+    }
+    return count;
+}
+
+unsigned int Scene::getVisibleFrame() const
+{
+    return _visibleFrame;
+}
+
+unsigned int Scene::findNodesInRegion(const BoundingBox& region, std::vector<Node*>& nodes)
+{
+    return findSpatialNodes(region, nodes);
+}
+
+unsigned int Scene::findNodesInRegion(const BoundingSphere& region, std::vector<Node*>& nodes)
+{
+    return findSpatialNodes(region, nodes);
+}
+
+// Appends the nodes with drawables in the given subtree.
+static void gatherDrawableNodes(Node* node, std::vector<Node*>& nodes)
+{
+    if (node->getDrawable())
+        nodes.push_back(node);
+    for (Node* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+    {
+        gatherDrawableNodes(child, nodes);
+    }
+}
+
+// Orders nodes found along a ray by their distance.
+static bool compareRayHits(const std::pair<float, Node*>& a, const std::pair<float, Node*>& b)
+{
+    return a.first < b.first;
+}
+
+unsigned int Scene::findNodesAlongRay(const Ray& ray, std::vector<Node*>& nodes, float maxDistance)
+{
+    std::vector<Node*> candidates;
+    if (_spatialTree)
+    {
+        updateSpatialIndex();
+        std::vector<void*> proxies;
+        _spatialTree->query(ray, maxDistance, proxies);
+        for (size_t i = 0, count = proxies.size(); i < count; ++i)
+        {
+            candidates.push_back(static_cast<Node*>(proxies[i]));
+        }
+    }
+    else
+    {
+        for (Node* node = _firstNode; node != NULL; node = node->_nextSibling)
+        {
+            gatherDrawableNodes(node, candidates);
+        }
+    }
+
+    std::vector<std::pair<float, Node*> > hits;
+    for (size_t i = 0, count = candidates.size(); i < count; ++i)
+    {
+        Node* node = candidates[i];
+        if (!node->isEnabledInHierarchy())
+            continue;
+        float distance = ray.intersects(node->getBoundingSphere());
+        if (distance != (float)Ray::INTERSECTS_NONE && distance <= maxDistance)
+            hits.push_back(std::make_pair(distance, node));
+    }
+    std::stable_sort(hits.begin(), hits.end(), compareRayHits);
+
+    for (size_t i = 0, count = hits.size(); i < count; ++i)
+    {
+        nodes.push_back(hits[i].second);
+    }
+    return (unsigned int)hits.size();
+}
+
+void Scene::addSpatialNode(Node* node)
+{
+    GP_ASSERT(node);
+
+    if (!_spatialTree || !node->_drawable || node->_spatialProxy >= 0)
+        return;
+
+    BoundingBox box;
+    const BoundingSphere& sphere = node->getBoundingSphere();
+    box.set(sphere);
+    node->_spatialProxy = _spatialTree->insert(box, node, sphere.radius * SCENE_SPATIAL_MARGIN);
+}
+
+void Scene::removeSpatialNode(Node* node)
+{
+    GP_ASSERT(node);
+
+    if (!_spatialTree || node->_spatialProxy < 0)
+        return;
+
+    _spatialTree->remove(node->_spatialProxy);
+    node->_spatialProxy = -1;
+
+    std::vector<Node*>::iterator itr = std::find(_spatialDirtyNodes.begin(), _spatialDirtyNodes.end(), node);
+    if (itr != _spatialDirtyNodes.end())
+    {
+        _spatialDirtyNodes.erase(itr);
+        node->clearSpatialBoundsDirty();
+    }
+}
+
+void Scene::addSpatialNodes(Node* node)
+{
+    if (!_spatialTree)
+        return;
+
+    addSpatialNode(node);
+    for (Node* child = node->_firstChild; child != NULL; child = child->_nextSibling)
+    {
+        addSpatialNodes(child);
+    }
+}
+
+void Scene::removeSpatialNodes(Node* node)
+{
+    if (!_spatialTree)
+        return;
+
+    removeSpatialNode(node);
+    for (Node* child = node->_firstChild; child != NULL; child = child->_nextSibling)
+    {
+        removeSpatialNodes(child);
+    }
+}
+
+void Scene::updateSpatialIndex()
+{
+    GP_ASSERT(_spatialTree);
+
+    for (size_t i = 0, count = _spatialDirtyNodes.size(); i < count; ++i)
+    {
+        Node* node = _spatialDirtyNodes[i];
+        node->clearSpatialBoundsDirty();
+
+        BoundingBox box;
+        const BoundingSphere& sphere = node->getBoundingSphere();
+        box.set(sphere);
+        _spatialTree->update(node->_spatialProxy, box, sphere.radius * SCENE_SPATIAL_MARGIN);
+    }
+    _spatialDirtyNodes.clear();
+}
+
+template <class T>
+unsigned int Scene::findSpatialNodes(const T& volume, std::vector<Node*>& nodes)
+{
+    unsigned int count = 0;
+    if (_spatialTree)
+    {
+        updateSpatialIndex();
+
+        // The index returns candidates by their fattened boxes, so test the actual bounds too.
+        std::vector<void*> proxies;
+        _spatialTree->query(volume, proxies);
+        for (size_t i = 0, proxyCount = proxies.size(); i < proxyCount; ++i)
+        {
+            Node* node = static_cast<Node*>(proxies[i]);
+            if (node->isEnabledInHierarchy() && node->getBoundingSphere().intersects(volume))
+            {
+                nodes.push_back(node);
+                ++count;
+            }
+        }
+    }
+    else
+    {
+        for (Node* node = _firstNode; node != NULL; node = node->_nextSibling)
+        {
+            count += findSpatialNodes(node, volume, nodes);
+        }
+    }
+    return count;
+}
+
+template <class T>
+unsigned int Scene::findSpatialNodes(Node* node, const T& volume, std::vector<Node*>& nodes)
+{
+    GP_ASSERT(node);
+
+    if (!node->isEnabled())
+        return 0;
+
+    unsigned int count = 0;
+    if (node->_drawable && node->getBoundingSphere().intersects(volume))
+    {
+        nodes.push_back(node);
+        ++count;
+    }
+    for (Node* child = node->_firstChild; child != NULL; child = child->_nextSibling)
+    {
+        count += findSpatialNodes(child, volume, nodes);
+    }
+    return count;
 }
 
 void Scene::reset()
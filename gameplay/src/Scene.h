@@ -6,6 +6,8 @@
 #include "ScriptController.h"
 #include "Light.h"
 #include "Model.h"
+#include "BoundingVolumeTree.h"
+#include "ObjectPool.h"
 
 namespace gameplay
 {
@@ -17,8 +19,31 @@ namespace gameplay
  */
 class Scene : public Ref
 {
+    friend class Node;
+    friend class ScriptController;
+
 public:
 
+    /**
+     * Defines the filters of the nodes found by findNodes(), which can be combined.
+     *
+     * A node passes the type filters if it has a drawable of any of the types given,
+     * and it passes every type when none is given.
+     */
+    enum QueryFlags
+    {
+        QUERY_ENABLED = 1,
+        QUERY_VISIBLE = 2,
+        QUERY_MODEL = 4,
+        QUERY_TERRAIN = 8,
+        QUERY_SPRITE = 16,
+        QUERY_TILESET = 32,
+        QUERY_TEXT = 64,
+        QUERY_PARTICLE_EMITTER = 128,
+        QUERY_FORM = 256,
+        QUERY_DRAWABLE = QUERY_MODEL | QUERY_TERRAIN | QUERY_SPRITE | QUERY_TILESET | QUERY_TEXT | QUERY_PARTICLE_EMITTER | QUERY_FORM
+    };
+
     /**
      * Creates a new empty scene.
      *
@@ -32,6 +57,11 @@ public:
     /**
      * Loads a scene from the given '.scene' or '.gpb' file.
      *
+     * A '.scene' file can set 'staticBatching = true' to merge the models of its static
+     * nodes (nodes with static collision objects) that share a material file into combined
+     * meshes when it is loaded. The batches are split into cubic chunks of the world with
+     * an edge length of 'staticBatchChunkSize' (100 by default) so they can still be culled.
+     *
      * @param filePath The path to the '.scene' or '.gpb' file to load from.
      * @return The loaded scene or <code>NULL</code> if the scene
      *      could not be loaded from the given file.
@@ -39,6 +69,28 @@ public:
      */
     static Scene* load(const char* filePath);
 
+    /**
+     * The function called once a scene loaded by loadAsync has finished loading.
+     *
+     * The scene is passed with a reference that the callback must release, or NULL
+     * if the scene could not be loaded.
+     */
+    typedef std::function<void(Scene*)> LoadCallback;
+
+    /**
+     * Loads a scene from the given '.scene' or '.gpb' file without stalling the game.
+     *
+     * The scene file is parsed and the meshes of its bundle are read on the JobSystem,
+     * and the meshes are created over the following frames as described by
+     * Bundle::loadSceneAsync(). The rest of the scene, including the files referenced by
+     * a '.scene' file, is loaded in the frame that the callback is called in.
+     *
+     * @param filePath The path to the '.scene' or '.gpb' file to load from.
+     * @param callback The function called on the main thread once the scene has loaded.
+     * @script{ignore}
+     */
+    static void loadAsync(const char* filePath, const LoadCallback& callback);
+
     /**
      * Gets a currently active scene.
      *
@@ -64,6 +116,28 @@ public:
      */
     void setId(const char* id);
 
+    /**
+     * Enables or disables the node index of the scene.
+     *
+     * When enabled, the scene keeps the IDs of all nodes in its hierarchy in a sorted
+     * index that is updated as nodes are added, removed or renamed. Recursive calls to
+     * findNode() and findNodes() then look up matching IDs (or ID prefixes) in the index
+     * instead of searching the whole hierarchy. The index is disabled by default.
+     *
+     * Note that the index only contains the nodes of the scene hierarchy, so joints of
+     * mesh skins that are rooted outside of the scene are not found while it is enabled.
+     *
+     * @param enabled true to enable the node index, false to disable it.
+     */
+    void setNodeIndexEnabled(bool enabled);
+
+    /**
+     * Determines if the node index of the scene is enabled.
+     *
+     * @return true if the node index is enabled, false otherwise.
+     */
+    bool isNodeIndexEnabled() const;
+
     /**
      * Returns the first node in the scene that matches the given ID.
      *
@@ -85,7 +159,8 @@ public:
      * @param exactMatch true if only nodes who's ID exactly matches the specified ID are returned,
      *      or false if nodes that start with the given ID are returned.
      *
-     * @return The number of matches found.
+     * @return The number of matches found. When the node index is enabled, recursive
+     *      searches return the matches ordered by ID rather than by hierarchy.
      * @script{ignore}
      */
     unsigned int findNodes(const char* id, std::vector<Node*>& nodes, bool recursive = true, bool exactMatch = true) const;
@@ -132,6 +207,17 @@ public:
      */
     Node* getFirstNode() const;
 
+    /**
+     * Gets the pool the nodes of the scene are allocated from.
+     *
+     * The pool is current while the scene is loaded and while nodes are added to it by id.
+     * Nodes created elsewhere are allocated from it within an ObjectPool::Scope of the pool.
+     *
+     * @return The object pool of the scene.
+     * @script{ignore}
+     */
+    ObjectPool* getObjectPool() const;
+
     /**
      * Gets the active camera for the scene.
      *
@@ -184,10 +270,223 @@ public:
      * are active within the scene. A Node is considered active if Node::isActive()
      * returns true.
      *
+     * When parallel update is enabled, the drawables of the enabled nodes that update
+     * themselves (such as particle emitters) are then updated as well.
+     *
      * @param elapsedTime Elapsed time in milliseconds.
+     * @see setParallelUpdateEnabled
      */
     void update(float elapsedTime);
 
+    /**
+     * Enables or disables the parallel update of the drawables of the scene.
+     *
+     * When enabled, update() also updates the drawables that declare themselves updatable.
+     * The nodes of those drawables are gathered into a list whenever the hierarchy of the
+     * scene changes, rather than being searched for on each update. When there are enough
+     * of them, the drawables that declare their updates thread-safe are updated in parallel
+     * on the game's job system, and the others are updated one after another. Parallel
+     * update is disabled by default, in which case drawables are left to be updated by the
+     * code that owns them.
+     *
+     * @param enabled true to enable parallel update, false to disable it.
+     * @see Drawable::isUpdatable
+     * @see Drawable::isUpdateThreadSafe
+     */
+    void setParallelUpdateEnabled(bool enabled);
+
+    /**
+     * Determines if parallel update of the drawables of the scene is enabled.
+     *
+     * @return true if parallel update is enabled, false otherwise.
+     */
+    bool isParallelUpdateEnabled() const;
+
+    /**
+     * Resolves the world matrices of all nodes in the scene whose transforms have changed.
+     *
+     * World matrices are normally resolved lazily by Node::getWorldMatrix(), which recurses
+     * through the children of a node whenever it is resolved. For large scenes this pass can
+     * be called once per frame (typically after update and before render) to resolve them in
+     * a single linear sweep over the nodes in parent-before-child order instead. When the scene
+     * has enough nodes, independent top level subtrees are resolved in parallel on the game's
+     * job system.
+     *
+     * Nodes that are not part of the scene hierarchy (such as skin joints rooted outside
+     * of it) continue to be resolved lazily.
+     */
+    void updateTransforms();
+
+    /**
+     * Enables or disables the spatial index of the scene.
+     *
+     * When enabled, the scene keeps the bounding volumes of all nodes with drawables
+     * in a dynamic bounding volume hierarchy that is updated as their bounds change.
+     * This lets findVisibleNodes(), findNodesInRegion() and findNodesAlongRay() only
+     * test the nodes near the query, which matters for large scenes where most nodes
+     * are outside of it. The index is disabled by default.
+     *
+     * @param enabled true to enable the spatial index, false to disable it.
+     */
+    void setSpatialIndexEnabled(bool enabled);
+
+    /**
+     * Determines if the spatial index of the scene is enabled.
+     *
+     * @return true if the spatial index is enabled, false otherwise.
+     */
+    bool isSpatialIndexEnabled() const;
+
+    /**
+     * Enables or disables the visibility cache of the scene.
+     *
+     * Most nodes of a scene never move, so when enabled, findVisibleNodes() keeps the static
+     * nodes (those for which Transform::isStatic() is true) near each region it was queried
+     * for, with their bounds. The region is the box around the frustums being culled, enlarged
+     * by the margin, and later queries within the box only walk the scene (or the spatial
+     * index) for the dynamic nodes and test the static nodes of the cache against the frustum.
+     * The static nodes are found again once the camera moves or turns beyond the margin, or
+     * when static nodes are added to or removed from the scene. The views of several cameras
+     * and lights are each kept in a region of their own. The cache is disabled by default.
+     *
+     * Static nodes are expected not to move. The cache must be invalidated when they do, or
+     * when a node in the scene becomes static or stops being static other than by setting its
+     * collision object.
+     *
+     * @param enabled true to enable the visibility cache, false to disable it.
+     *
+     * @see invalidateVisibilityCache()
+     */
+    void setVisibilityCacheEnabled(bool enabled);
+
+    /**
+     * Determines if the visibility cache of the scene is enabled.
+     *
+     * @return true if the visibility cache is enabled, false otherwise.
+     */
+    bool isVisibilityCacheEnabled() const;
+
+    /**
+     * Sets the margin that the regions of the visibility cache are enlarged by on each side,
+     * as a fraction of their size.
+     *
+     * Larger margins let the camera move further before the static nodes are found again, at the
+     * cost of testing more of them against the frustum each frame. The default is 0.1.
+     *
+     * @param margin The margin, as a fraction of the size of the regions.
+     */
+    void setVisibilityCacheMargin(float margin);
+
+    /**
+     * Gets the margin that the regions of the visibility cache are enlarged by.
+     *
+     * @return The margin, as a fraction of the size of the regions.
+     */
+    float getVisibilityCacheMargin() const;
+
+    /**
+     * Discards the static nodes kept by the visibility cache, so that the next queries find them again.
+     */
+    void invalidateVisibilityCache();
+
+    /**
+     * Finds the enabled nodes with drawables whose bounding volumes intersect the specified frustum.
+     *
+     * @param frustum The frustum to test, typically the frustum of the active camera.
+     * @param nodes Vector of nodes to be populated with the nodes found.
+     *
+     * @return The number of nodes found.
+     * @script{ignore}
+     */
+    unsigned int findVisibleNodes(const Frustum& frustum, std::vector<Node*>& nodes);
+
+    /**
+     * Finds the enabled nodes with drawables that are visible from any of several cameras.
+     *
+     * This culls the views of a split screen, a minimap or the eyes of a stereo camera in a
+     * single pass: the candidates are gathered with one walk of the scene (or one query of
+     * the spatial index, by the box around the frustums of all the cameras) and their bounds
+     * are read once, after which only the frustum tests are repeated for each camera.
+     *
+     * Each node found is paired with a mask of the views it is visible from, where bit i is
+     * set if the node is in the frustum of cameras[i]. A view draws the nodes whose masks
+     * have its bit set, for example by passing them to RenderQueue::submit().
+     *
+     * @param cameras The cameras of the views, at most 32.
+     * @param cameraCount The number of cameras.
+     * @param nodes Vector of nodes to be populated with the nodes found.
+     * @param viewMasks Vector to be populated with the mask of views of each node found.
+     *
+     * @return The number of nodes found.
+     * @script{ignore}
+     */
+    unsigned int findVisibleNodes(Camera* const* cameras, unsigned int cameraCount, std::vector<Node*>& nodes, std::vector<unsigned int>& viewMasks);
+
+    /**
+     * Gets the number of the last frame in which findVisibleNodes() was called on this scene.
+     *
+     * The nodes it found in that frame have the same Node::getVisibleFrame(), while the
+     * others were outside the view of every camera and light it culled for.
+     *
+     * @return The frame number, as returned by Game::getFrameNumber(), or zero if the scene was never culled.
+     * @script{ignore}
+     */
+    unsigned int getVisibleFrame() const;
+
+    /**
+     * Finds the enabled nodes with drawables whose bounding volumes intersect the specified box.
+     *
+     * @param region The region to test.
+     * @param nodes Vector of nodes to be populated with the nodes found.
+     *
+     * @return The number of nodes found.
+     * @script{ignore}
+     */
+    unsigned int findNodesInRegion(const BoundingBox& region, std::vector<Node*>& nodes);
+
+    /**
+     * Finds the enabled nodes with drawables whose bounding volumes intersect the specified sphere.
+     *
+     * @param region The region to test.
+     * @param nodes Vector of nodes to be populated with the nodes found.
+     *
+     * @return The number of nodes found.
+     * @script{ignore}
+     */
+    unsigned int findNodesInRegion(const BoundingSphere& region, std::vector<Node*>& nodes);
+
+    /**
+     * Finds the enabled nodes with drawables whose bounding volumes intersect the specified ray,
+     * ordered by the distance along the ray.
+     *
+     * @param ray The ray to test.
+     * @param nodes Vector of nodes to be populated with the nodes found.
+     * @param maxDistance The maximum distance along the ray to test.
+     *
+     * @return The number of nodes found.
+     * @script{ignore}
+     */
+    unsigned int findNodesAlongRay(const Ray& ray, std::vector<Node*>& nodes, float maxDistance = FLT_MAX);
+
+    /**
+     * Finds the nodes of the scene that pass a filter, in the order they are visited by visit().
+     *
+     * This replaces visiting the scene to pick out nodes, which calls a script function for every
+     * node of the scene. Scripts call it as scene:findNodes(tag, flags), which returns a table of
+     * the nodes found, and the flags are Scene.QUERY_ENABLED and so on.
+     *
+     * With QUERY_ENABLED, the nodes under disabled nodes are skipped as well. With QUERY_VISIBLE,
+     * only the nodes found by the last call to findVisibleNodes() are found.
+     *
+     * @param tag The name of a tag the nodes must have, or NULL to find nodes with any tags.
+     * @param flags The filters of the nodes to find, from QueryFlags.
+     * @param nodes Vector of nodes to be populated with the nodes found.
+     *
+     * @return The number of nodes found.
+     * @script{ignore}
+     */
+    unsigned int findNodes(const char* tag, unsigned int flags, std::vector<Node*>& nodes) const;
+
     /**
      * Visits each node in the scene and calls the specified method pointer.
      *
@@ -242,9 +541,13 @@ public:
      * returns true. Returning false will stop traversing further children for
      * the given node and the traversal will continue at the next sibling.
      *
+     * The function is looked up once for the traversal rather than by name for each node.
+     * Scripts that only pick out nodes should use findNodes() instead, which calls no
+     * script function at all.
+     *
      * @param visitMethod The name of the Lua function to call for each node in the scene.
      */
-    inline void visit(const char* visitMethod);
+    void visit(const char* visitMethod);
 
     /**
      * @see VisibleSet#getNext
@@ -293,12 +596,148 @@ private:
     /**
      * Visits the given node and all of its children recursively.
      */
-    void visitNode(Node* node, const char* visitMethod);
+    void visitNode(Node* node, const ScriptFunction& visitMethod);
+
+    /**
+     * Adds the nodes of a hierarchy that pass a filter of findNodes().
+     */
+    void findNodes(Node* node, unsigned int tag, unsigned int flags, std::vector<Node*>& nodes) const;
+
+    /**
+     * The script binding of findNodes(), which returns the nodes found in a table.
+     */
+    static int luaFindNodes(lua_State* state);
+
+    /**
+     * Adds findNodes() and the QueryFlags to the script bindings of the scene.
+     */
+    static void registerScriptFunctions(lua_State* state);
 
     Node* findNextVisibleSibling(Node* node);
 
     bool isNodeVisible(Node* node);
 
+    /**
+     * Called when the given node and its descendants are added to the scene hierarchy.
+     */
+    void hierarchyAdded(Node* node);
+
+    /**
+     * Called when the given node and its descendants are removed from the scene hierarchy.
+     */
+    void hierarchyRemoved(Node* node);
+
+    /**
+     * Adds the given node to the node index, if it is enabled.
+     */
+    void addIndexedNode(Node* node);
+
+    /**
+     * Removes the given node from the node index, if it is enabled.
+     */
+    void removeIndexedNode(Node* node);
+
+    /**
+     * Adds the given node and its descendants to the node index.
+     */
+    void addIndexedNodes(Node* node);
+
+    /**
+     * Removes the given node and its descendants from the node index.
+     */
+    void removeIndexedNodes(Node* node);
+
+    /**
+     * Rebuilds the list of the nodes with updatable drawables, in the given subtree.
+     */
+    void addUpdateNodes(Node* node);
+
+    /**
+     * Updates the updatable drawables of the enabled nodes of the scene.
+     */
+    void updateDrawables(float elapsedTime);
+
+    /**
+     * Rebuilds the parent-before-child ordering of the nodes used by updateTransforms().
+     */
+    void buildTransformOrder();
+
+    /**
+     * Appends the given node and its descendants to the transform ordering.
+     */
+    void addTransformNode(Node* node, int parentIndex);
+
+    /**
+     * Resolves the world matrices of the ordered nodes in the range [begin, end).
+     */
+    void updateTransformRange(unsigned int begin, unsigned int end);
+
+    /**
+     * Adds the given node to the spatial index, if it is enabled and the node has a drawable.
+     */
+    void addSpatialNode(Node* node);
+
+    /**
+     * Removes the given node from the spatial index.
+     */
+    void removeSpatialNode(Node* node);
+
+    /**
+     * Adds the given node and its descendants to the spatial index.
+     */
+    void addSpatialNodes(Node* node);
+
+    /**
+     * Removes the given node and its descendants from the spatial index.
+     */
+    void removeSpatialNodes(Node* node);
+
+    /**
+     * Applies the pending bounds changes of the indexed nodes to the spatial index.
+     */
+    void updateSpatialIndex();
+
+    /**
+     * Finds the nodes intersecting the given volume, using the spatial index if it is enabled.
+     */
+    template <class T>
+    unsigned int findSpatialNodes(const T& volume, std::vector<Node*>& nodes);
+
+    /**
+     * Finds the nodes in the given subtree intersecting the given volume without the spatial index.
+     */
+    template <class T>
+    unsigned int findSpatialNodes(Node* node, const T& volume, std::vector<Node*>& nodes);
+
+    /**
+     * The static nodes with drawables near a region culled by findVisibleNodes(), with their bounds.
+     */
+    struct VisibilityCache
+    {
+        BoundingBox region;
+        std::vector<Node*> nodes;
+        std::vector<BoundingSphere> bounds;
+        unsigned int frame;
+    };
+
+    /**
+     * Gathers the enabled nodes with drawables that may intersect the given volume into the
+     * culling candidates and reads their bounds.
+     *
+     * @param volume The volume to test.
+     * @param region The box around the volume, for the visibility cache.
+     *
+     * @return The number of candidates.
+     */
+    template <class T>
+    unsigned int gatherCullNodes(const T& volume, const BoundingBox& region);
+
+    /**
+     * Gets the visibility cache containing the given region, finding the static nodes of a new
+     * region in place of the least recently used one if none does.
+     */
+    VisibilityCache* getVisibilityCache(const BoundingBox& region);
+
     std::string _id;
     Camera* _activeCamera;
     Node* _firstNode;
@@ -308,11 +747,33 @@ private:
     bool _bindAudioListenerToCamera;
     Node* _nextItr;
     bool _nextReset;
+    std::vector<Node*> _transformNodes;
+    std::vector<int> _transformParents;
+    std::vector<unsigned int> _transformRoots;
+    bool _transformOrderDirty;
+    bool _parallelUpdate;
+    std::vector<Node*> _updateNodes;
+    std::vector<Node*> _updateJobNodes;
+    bool _updateNodesDirty;
+    BoundingVolumeTree* _spatialTree;
+    std::vector<Node*> _spatialDirtyNodes;
+    std::vector<Node*> _cullNodes;
+    std::vector<BoundingSphere> _cullBounds;
+    std::vector<unsigned int> _cullMask;
+    std::vector<unsigned int> _cullViewMasks;
+    bool _visibilityCacheEnabled;
+    float _visibilityCacheMargin;
+    std::vector<VisibilityCache> _visibilityCaches;
+    unsigned int _visibleFrame;
+    std::multimap<std::string, Node*>* _nodeIndex;
+    ObjectPool* _objectPool;
 };
 
 template <class T>
 void Scene::visit(T* instance, bool (T::*visitMethod)(Node*))
 {
+    GP_PROFILE_SCOPE("Scene::visit");
+
     for (Node* node = getFirstNode(); node != NULL; node = node->getNextSibling())
     {
         visitNode(node, instance, visitMethod);
@@ -322,17 +783,11 @@ void Scene::visit(T* instance, bool (T::*visitMethod)(Node*))
 template <class T, class C>
 void Scene::visit(T* instance, bool (T::*visitMethod)(Node*,C), C cookie)
 {
-    for (Node* node = getFirstNode(); node != NULL; node = node->getNextSibling())
-    {
-        visitNode(node, instance, visitMethod, cookie);
-    }
-}
+    GP_PROFILE_SCOPE("Scene::visit");
 
-inline void Scene::visit(const char* visitMethod)
-{
     for (Node* node = getFirstNode(); node != NULL; node = node->getNextSibling())
     {
-        visitNode(node, visitMethod);
+        visitNode(node, instance, visitMethod, cookie);
     }
 }
 
@@ -9,6 +9,16 @@
 #include "Text.h"
 #include "TileSet.h"
 #include "Light.h"
+#include "MeshPart.h"
+
+// The maximum number of vertices in a static batch, so that batches can be indexed with 16-bit indices.
+#define STATIC_BATCH_MAX_VERTICES 65536
+
+// Marks the vertices of a mesh that are not referenced by the mesh part being batched.
+#define STATIC_BATCH_UNUSED_VERTEX 0xFFFFFFFF
+
+// The default edge length of the chunks of the world that static batches are split into.
+#define STATIC_BATCH_CHUNK_SIZE 100.0f
 
 namespace gameplay
 {
@@ -17,7 +27,7 @@ namespace gameplay
 extern void calculateNamespacePath(const std::string& urlString, std::string& fileString, std::vector<std::string>& namespacePath);
 extern Properties* getPropertiesFromNamespacePath(Properties* properties, const std::vector<std::string>& namespacePath);
 
-SceneLoader::SceneLoader() : _scene(NULL)
+SceneLoader::SceneLoader() : _scene(NULL), _bundle(NULL)
 {
 }
 
@@ -27,15 +37,25 @@ Scene* SceneLoader::load(const char* url)
     return loader.loadInternal(url);
 }
 
-Scene* SceneLoader::loadInternal(const char* url)
+Scene* SceneLoader::load(const char* url, Properties* properties, Bundle* bundle)
+{
+    GP_ASSERT(properties);
+
+    SceneLoader loader;
+    loader._bundle = bundle;
+    return loader.loadInternal(url, properties);
+}
+
+Scene* SceneLoader::loadInternal(const char* url, Properties* properties)
 {
     // Get the file part of the url that we are loading the scene from.
     std::string urlStr = url ? url : "";
     std::string id;
     splitURL(urlStr, &_path, &id);
 
-    // Load the scene properties from file.
-    Properties* properties = Properties::create(url);
+    // Load the scene properties from file, unless they were parsed ahead of the load.
+    if (properties == NULL)
+        properties = Properties::create(url);
     if (properties == NULL)
     {
         GP_ERROR("Failed to load scene file '%s'.", url);
@@ -80,6 +100,9 @@ Scene* SceneLoader::loadInternal(const char* url)
         _scene = Scene::create(sceneProperties->getId());
     }
 
+    // Allocate the nodes the scene file adds to the scene from the pool of the scene.
+    ObjectPool::Scope scope(_scene->getObjectPool());
+
     // First apply the node url properties. Following that,
     // apply the normal node properties and create the animations.
     // We apply physics properties after all other node properties
@@ -143,6 +166,22 @@ Scene* SceneLoader::loadInternal(const char* url)
     if (physics)
         loadPhysics(physics);
 
+    // Merge the static geometry now that the static collision objects are known.
+    if (sceneProperties->getBool("staticBatching"))
+    {
+        float chunkSize = sceneProperties->exists("staticBatchChunkSize") ? sceneProperties->getFloat("staticBatchChunkSize") : STATIC_BATCH_CHUNK_SIZE;
+        if (chunkSize > 0.0f)
+            batchStaticNodes(chunkSize);
+        else
+            GP_WARN("Invalid static batch chunk size (%f) for scene '%s'.", chunkSize, sceneProperties->getId());
+    }
+    _materialSources.clear();
+    for (std::map<Properties*, Material*>::iterator itr = _materialPrototypes.begin(); itr != _materialPrototypes.end(); ++itr)
+    {
+        SAFE_RELEASE(itr->second);
+    }
+    _materialPrototypes.clear();
+
     // Clean up all loaded properties objects.
     std::map<std::string, Properties*>::iterator iter = _propertiesFromFile.begin();
     for (; iter != _propertiesFromFile.end(); ++iter)
@@ -285,8 +324,23 @@ void SceneLoader::applyNodeProperty(SceneNode& sceneNode, Node* node, const Prop
             Model* model = dynamic_cast<Model*>(node->getDrawable());
             if (model)
             {
-                Material* material = Material::create(p);
+                // Nodes cannot share a material, since it is bound to the node it is drawn for, but
+                // the nodes referencing the same material URL clone the material loaded by the first.
+                Material* material = NULL;
+                std::map<Properties*, Material*>::const_iterator itr = _materialPrototypes.find(p);
+                if (itr != _materialPrototypes.end())
+                {
+                    NodeCloneContext context;
+                    material = itr->second->clone(context);
+                }
+                else if ((material = Material::create(p)) != NULL)
+                {
+                    material->addRef();
+                    _materialPrototypes[p] = material;
+                }
                 model->setMaterial(material, snp._index);
+                if (material)
+                    _materialSources[material] = p;
                 SAFE_RELEASE(material);
             }
             else
@@ -1001,8 +1055,12 @@ Scene* SceneLoader::loadMainSceneData(const Properties* sceneProperties)
 {
     GP_ASSERT(sceneProperties);
 
-    // Load the main scene from the specified path.
-    Bundle* bundle = Bundle::create(_gpbPath.c_str());
+    // Load the main scene from the specified path, or from the bundle opened ahead of the load.
+    Bundle* bundle = _bundle;
+    if (bundle)
+        bundle->addRef();
+    else
+        bundle = Bundle::create(_gpbPath.c_str());
     if (!bundle)
     {
         GP_WARN("Failed to load scene GPB file '%s'.", _gpbPath.c_str());
@@ -1132,7 +1190,8 @@ void SceneLoader::loadPhysics(Properties* physics)
 
 void SceneLoader::loadReferencedFiles()
 {
-    // Load all referenced properties files.
+    // Collect the distinct files referenced by the URLs that have not been loaded yet.
+    std::vector<std::string> files;
     std::map<std::string, Properties*>::iterator iter = _properties.begin();
     for (; iter != _properties.end(); ++iter)
     {
@@ -1141,26 +1200,45 @@ void SceneLoader::loadReferencedFiles()
             std::string fileString;
             std::vector<std::string> namespacePath;
             calculateNamespacePath(iter->first, fileString, namespacePath);
-
-            // Check if the referenced properties file has already been loaded.
-            Properties* properties = NULL;
-            std::map<std::string, Properties*>::iterator pffIter = _propertiesFromFile.find(fileString);
-            if (pffIter != _propertiesFromFile.end() && pffIter->second)
+            if (_propertiesFromFile.find(fileString) == _propertiesFromFile.end())
             {
-                properties = pffIter->second;
+                _propertiesFromFile[fileString] = NULL;
+                files.push_back(fileString);
             }
-            else
-            {
-                properties = Properties::create(fileString.c_str());
-                if (properties == NULL)
-                {
-                    GP_WARN("Failed to load referenced properties file '%s'.", fileString.c_str());
-                    continue;
-                }
+        }
+    }
 
-                // Add the properties object to the cache.
-                _propertiesFromFile.insert(std::make_pair(fileString, properties));
-            }
+    // Parse the files in parallel, since they do not depend on each other.
+    std::vector<Properties*> parsed(files.size(), NULL);
+    JobSystem::RangeFunction parse = [&files, &parsed](unsigned int first, unsigned int last)
+    {
+        for (unsigned int i = first; i < last; ++i)
+            parsed[i] = Properties::create(files[i].c_str());
+    };
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem && files.size() > 1)
+        jobSystem->parallelFor(0, (unsigned int)files.size(), parse, 1);
+    else
+        parse(0, (unsigned int)files.size());
+    for (size_t i = 0, count = files.size(); i < count; ++i)
+    {
+        if (parsed[i] == NULL)
+            GP_WARN("Failed to load referenced properties file '%s'.", files[i].c_str());
+        _propertiesFromFile[files[i]] = parsed[i];
+    }
+
+    // Resolve each URL to its namespace in the parsed files.
+    for (iter = _properties.begin(); iter != _properties.end(); ++iter)
+    {
+        if (iter->second == NULL)
+        {
+            std::string fileString;
+            std::vector<std::string> namespacePath;
+            calculateNamespacePath(iter->first, fileString, namespacePath);
+
+            Properties* properties = _propertiesFromFile[fileString];
+            if (properties == NULL)
+                continue;
 
             Properties* p = getPropertiesFromNamespacePath(properties, namespacePath);
             if (!p)
@@ -1275,6 +1353,299 @@ PhysicsConstraint* SceneLoader::loadSpringConstraint(const Properties* constrain
     return physicsConstraint;
 }
 
+// Identifies the static batch the geometry of a mesh part is merged into.
+struct StaticBatchKey
+{
+    bool operator<(const StaticBatchKey& key) const
+    {
+        if (material != key.material)
+            return material < key.material;
+        if (format != key.format)
+            return format < key.format;
+        if (x != key.x)
+            return x < key.x;
+        if (y != key.y)
+            return y < key.y;
+        return z < key.z;
+    }
+
+    Properties* material;
+    const VertexFormat* format;
+    int x;
+    int y;
+    int z;
+};
+
+// Holds the merged geometry of a static batch.
+struct StaticBatch
+{
+    StaticBatch(Material* material, const VertexFormat* format)
+        : material(material), format(format), vertexCount(0), min(FLT_MAX, FLT_MAX, FLT_MAX), max(-FLT_MAX, -FLT_MAX, -FLT_MAX)
+    {
+        // The batch outlives the models its material is taken from.
+        material->addRef();
+    }
+
+    ~StaticBatch()
+    {
+        SAFE_RELEASE(material);
+    }
+
+    Material* material;
+    const VertexFormat* format;
+    std::vector<unsigned char> vertices;
+    std::vector<unsigned short> indices;
+    unsigned int vertexCount;
+    Vector3 min;
+    Vector3 max;
+};
+
+// Determines if a static model can be merged into static batches.
+static bool isBatchable(Model* model, const std::map<Material*, Properties*>& materialSources)
+{
+    Mesh* mesh = model->getMesh();
+    if (model->getSkin() || mesh == NULL || strlen(mesh->getUrl()) == 0 || mesh->getVertexCount() > STATIC_BATCH_MAX_VERTICES)
+        return false;
+
+    unsigned int partCount = mesh->getPartCount();
+    if (partCount == 0)
+        return mesh->getPrimitiveType() == Mesh::TRIANGLES && materialSources.count(model->getMaterial()) > 0;
+
+    for (unsigned int i = 0; i < partCount; ++i)
+    {
+        if (mesh->getPart(i)->getPrimitiveType() != Mesh::TRIANGLES || materialSources.count(model->getMaterial(i)) == 0)
+            return false;
+    }
+    return true;
+}
+
+// Gathers the nodes with static models that can be batched in the given node hierarchy.
+static void gatherStaticModels(Node* node, const std::map<Material*, Properties*>& materialSources, std::vector<Node*>& nodes)
+{
+    for (; node != NULL; node = node->getNextSibling())
+    {
+        Model* model = dynamic_cast<Model*>(node->getDrawable());
+        if (model && node->isStatic() && isBatchable(model, materialSources))
+            nodes.push_back(node);
+        gatherStaticModels(node->getFirstChild(), materialSources, nodes);
+    }
+}
+
+// Reads an index from mesh part index data.
+static unsigned int getIndex(const Bundle::MeshPartData* part, unsigned int i)
+{
+    switch (part->indexFormat)
+    {
+    case Mesh::INDEX8:
+        return ((const unsigned char*)part->indexData)[i];
+    case Mesh::INDEX16:
+        return ((const unsigned short*)part->indexData)[i];
+    default:
+        return ((const unsigned int*)part->indexData)[i];
+    }
+}
+
+// Copies a vertex into a static batch, transforming its position and direction vectors into world space.
+static void appendVertex(StaticBatch* batch, const unsigned char* vertex, const Matrix& world, const Matrix& normalMatrix)
+{
+    const VertexFormat& format = *batch->format;
+    unsigned int vertexSize = format.getVertexSize();
+    size_t start = batch->vertices.size();
+    batch->vertices.insert(batch->vertices.end(), vertex, vertex + vertexSize);
+
+    unsigned char* data = &batch->vertices[start];
+    float values[4];
+    for (unsigned int i = 0, count = format.getElementCount(); i < count; ++i)
+    {
+        const VertexFormat::Element& element = format.getElement(i);
+        bool direction = element.usage == VertexFormat::NORMAL || element.usage == VertexFormat::TANGENT || element.usage == VertexFormat::BINORMAL;
+        if (element.size >= 3 && (element.usage == VertexFormat::POSITION || direction))
+        {
+            // Packed elements are unpacked to floats to be transformed, then packed again.
+            VertexFormat::unpack(element, data, values);
+            Vector3 v(values[0], values[1], values[2]);
+            if (element.usage == VertexFormat::POSITION)
+            {
+                world.transformPoint(&v);
+                batch->min.set(std::min(batch->min.x, v.x), std::min(batch->min.y, v.y), std::min(batch->min.z, v.z));
+                batch->max.set(std::max(batch->max.x, v.x), std::max(batch->max.y, v.y), std::max(batch->max.z, v.z));
+            }
+            else
+            {
+                normalMatrix.transformVector(&v);
+                v.normalize();
+            }
+            values[0] = v.x;
+            values[1] = v.y;
+            values[2] = v.z;
+            VertexFormat::pack(element, values, data);
+        }
+        data += element.getByteSize();
+    }
+}
+
+void SceneLoader::batchStaticNodes(float chunkSize)
+{
+    GP_ASSERT(_scene);
+
+    std::vector<Node*> nodes;
+    gatherStaticModels(_scene->getFirstNode(), _materialSources, nodes);
+
+    // The mesh data of each mesh is read back from its bundle once, no matter how many nodes share it.
+    std::map<Mesh*, Bundle::MeshData*> meshData;
+    std::vector<const VertexFormat*> formats;
+    std::map<StaticBatchKey, StaticBatch*> openBatches;
+    std::vector<StaticBatch*> batches;
+    std::vector<unsigned int> remap;
+    std::vector<unsigned int> partIndices;
+    std::vector<unsigned int> order;
+
+    for (size_t n = 0, nodeCount = nodes.size(); n < nodeCount; ++n)
+    {
+        Node* node = nodes[n];
+        Model* model = static_cast<Model*>(node->getDrawable());
+        Mesh* mesh = model->getMesh();
+
+        std::map<Mesh*, Bundle::MeshData*>::iterator itr = meshData.find(mesh);
+        if (itr == meshData.end())
+            itr = meshData.insert(std::make_pair(mesh, Bundle::readMeshData(mesh->getUrl()))).first;
+        Bundle::MeshData* data = itr->second;
+        if (data == NULL || data->vertexCount == 0)
+            continue;
+
+        // Batches of the same vertex format share a single vertex format pointer in their keys.
+        const VertexFormat* format = NULL;
+        for (size_t i = 0, count = formats.size(); i < count && format == NULL; ++i)
+        {
+            if (*formats[i] == data->vertexFormat)
+                format = formats[i];
+        }
+        if (format == NULL)
+        {
+            format = &data->vertexFormat;
+            formats.push_back(format);
+        }
+
+        // Direction vectors are transformed by the inverse transpose of the world matrix,
+        // and mirroring world matrices reverse the winding of the triangles.
+        const Matrix& world = node->getWorldMatrix();
+        Matrix normalMatrix;
+        world.invert(&normalMatrix);
+        normalMatrix.transpose();
+        bool mirrored = world.determinant() < 0.0f;
+
+        const Vector3& center = node->getBoundingSphere().center;
+        StaticBatchKey key;
+        key.format = format;
+        key.x = (int)floor(center.x / chunkSize);
+        key.y = (int)floor(center.y / chunkSize);
+        key.z = (int)floor(center.z / chunkSize);
+
+        const unsigned int vertexSize = data->vertexFormat.getVertexSize();
+        unsigned int partCount = (unsigned int)data->parts.size();
+        for (unsigned int p = 0, count = std::max(partCount, 1u); p < count; ++p)
+        {
+            // Build the triangle list of the part, using the vertices in order for meshes without parts.
+            partIndices.clear();
+            if (partCount == 0)
+            {
+                for (unsigned int i = 0; i < data->vertexCount; ++i)
+                    partIndices.push_back(i);
+            }
+            else
+            {
+                const Bundle::MeshPartData* part = data->parts[p];
+                for (unsigned int i = 0; i < part->indexCount; ++i)
+                    partIndices.push_back(getIndex(part, i));
+            }
+            partIndices.resize(partIndices.size() - partIndices.size() % 3);
+
+            // Only the vertices referenced by the part are copied into its batch.
+            remap.assign(data->vertexCount, STATIC_BATCH_UNUSED_VERTEX);
+            unsigned int usedCount = 0;
+            for (size_t i = 0, indexCount = partIndices.size(); i < indexCount; ++i)
+            {
+                GP_ASSERT(partIndices[i] < data->vertexCount);
+                if (remap[partIndices[i]] == STATIC_BATCH_UNUSED_VERTEX)
+                    remap[partIndices[i]] = usedCount++;
+            }
+            if (usedCount == 0)
+                continue;
+
+            Material* material = model->getMaterial(partCount > 0 ? (int)p : -1);
+            key.material = _materialSources[material];
+            StaticBatch*& batch = openBatches[key];
+            if (batch == NULL || batch->vertexCount + usedCount > STATIC_BATCH_MAX_VERTICES)
+            {
+                batch = new StaticBatch(material, format);
+                batches.push_back(batch);
+            }
+
+            // Vertices are appended in the order they are first referenced.
+            const unsigned int base = batch->vertexCount;
+            order.resize(usedCount);
+            for (unsigned int i = 0; i < data->vertexCount; ++i)
+            {
+                if (remap[i] != STATIC_BATCH_UNUSED_VERTEX)
+                    order[remap[i]] = i;
+            }
+            batch->vertices.reserve(batch->vertices.size() + usedCount * vertexSize);
+            for (unsigned int i = 0; i < usedCount; ++i)
+            {
+                appendVertex(batch, data->vertexData + order[i] * vertexSize, world, normalMatrix);
+            }
+            batch->vertexCount += usedCount;
+
+            for (size_t i = 0, indexCount = partIndices.size(); i < indexCount; i += 3)
+            {
+                batch->indices.push_back((unsigned short)(base + remap[partIndices[i]]));
+                batch->indices.push_back((unsigned short)(base + remap[partIndices[mirrored ? i + 2 : i + 1]]));
+                batch->indices.push_back((unsigned short)(base + remap[partIndices[mirrored ? i + 1 : i + 2]]));
+            }
+        }
+
+        // The node keeps its collision object but is no longer drawn itself.
+        node->setDrawable(NULL);
+    }
+
+    // Create a model for each batch.
+    for (size_t i = 0, count = batches.size(); i < count; ++i)
+    {
+        StaticBatch* batch = batches[i];
+        if (!batch->indices.empty())
+        {
+            Mesh* mesh = Mesh::createMesh(*batch->format, batch->vertexCount, false);
+            mesh->setVertexData(&batch->vertices[0], 0, batch->vertexCount);
+            MeshPart* part = mesh->addPart(Mesh::TRIANGLES, Mesh::INDEX16, (unsigned int)batch->indices.size(), false);
+            part->setIndexData(&batch->indices[0], 0, (unsigned int)batch->indices.size());
+
+            BoundingBox box(batch->min, batch->max);
+            BoundingSphere sphere;
+            sphere.set(box);
+            mesh->setBoundingBox(box);
+            mesh->setBoundingSphere(sphere);
+
+            Model* model = Model::create(mesh);
+            model->setMaterial(batch->material);
+            SAFE_RELEASE(mesh);
+
+            char id[32];
+            sprintf(id, "staticBatch%u", (unsigned int)i);
+            Node* node = Node::create(id);
+            node->setDrawable(model);
+            SAFE_RELEASE(model);
+            _scene->addNode(node);
+            SAFE_RELEASE(node);
+        }
+        SAFE_DELETE(batch);
+    }
+
+    for (std::map<Mesh*, Bundle::MeshData*>::iterator itr = meshData.begin(); itr != meshData.end(); ++itr)
+    {
+        SAFE_DELETE(itr->second);
+    }
+}
+
 void splitURL(const std::string& url, std::string* file, std::string* id)
 {
     if (url.empty())
@@ -10,6 +10,8 @@
 namespace gameplay
 {
 
+class Bundle;
+
 /**
  * Defines an internal helper class for loading scenes from .scene files.
  *
@@ -17,6 +19,7 @@ namespace gameplay
  */
 class SceneLoader
 {
+    friend class Bundle;
     friend class Scene;
 
 private:
@@ -29,6 +32,15 @@ private:
      * @param url The URL pointing to the Properties object defining the scene.
      */
     static Scene* load(const char* url);
+
+    /**
+     * Loads a scene from a scene file that has already been parsed.
+     *
+     * @param url The URL pointing to the Properties object defining the scene.
+     * @param properties The properties of the scene file, which the loader takes ownership of.
+     * @param bundle The bundle of the main scene data, or NULL to open the bundle named by the scene file.
+     */
+    static Scene* load(const char* url, Properties* properties, Bundle* bundle);
     
     /**
      * Helper structures and functions for SceneLoader::load(const char*).
@@ -88,7 +100,7 @@ private:
 
     SceneLoader();
 
-    Scene* loadInternal(const char* url);
+    Scene* loadInternal(const char* url, Properties* properties = NULL);
 
     void applyTags(SceneNode& sceneNode);
 
@@ -112,6 +124,23 @@ private:
 
     void calculateNodesWithMeshRigidBodies(const Properties* sceneProperties);
 
+    /**
+     * Merges the models of static nodes that use the same material into combined meshes.
+     *
+     * The geometry of each mesh part is transformed into world space and appended to the
+     * batch of its material, vertex format and the cubic chunk of the world that contains
+     * the node's bounding sphere center, so that each batch can still be frustum culled.
+     * The models are then removed from the static nodes and each batch is added to the
+     * scene as a new root node with a single model.
+     *
+     * Only models without skins, whose mesh parts are all triangle lists, whose mesh data
+     * can be read back from a bundle and whose materials were loaded by the scene file
+     * are batched. Batches are split so that they can be indexed with 16-bit indices.
+     *
+     * @param chunkSize The edge length of the chunks of the world that batches are split into.
+     */
+    void batchStaticNodes(float chunkSize);
+
     void createAnimations();
 
     PhysicsConstraint* loadGenericConstraint(const Properties* constraint, PhysicsRigidBody* rbA, PhysicsRigidBody* rbB);
@@ -134,7 +163,10 @@ private:
     std::vector<SceneNode> _sceneNodes;                     // Holds all the nodes+properties declared in the .scene file.
     std::string _gpbPath;                                   // The path of the main GPB for the scene being loaded.
     std::string _path;                                      // The path of the scene file being loaded.
+    std::map<Material*, Properties*> _materialSources;      // Holds the properties object each node material was loaded from.
+    std::map<Properties*, Material*> _materialPrototypes;   // Holds the material first loaded from each material properties object.
     Scene* _scene;                                          // The scene being loaded
+    Bundle* _bundle;                                        // The bundle of the main scene data, when opened ahead of the load
 };
 
 /**
@@ -0,0 +1,594 @@
+#include "Base.h"
+#include "SceneSnapshot.h"
+#include "Game.h"
+#include "Scene.h"
+#include "Joint.h"
+#include "Animation.h"
+#include "AnimationClip.h"
+#include "PhysicsRigidBody.h"
+#include "AIAgent.h"
+#include "AIStateMachine.h"
+#include "AIState.h"
+#include "StringTable.h"
+#include "FileSystem.h"
+
+// Identifies snapshot data: "GPSS" in little-endian byte order.
+#define SCENE_SNAPSHOT_MAGIC 0x53535047
+
+// Version of the snapshot layout, which snapshots of other versions are rejected for.
+#define SCENE_SNAPSHOT_VERSION 1
+
+// Offset of a string that is not set.
+#define SCENE_SNAPSHOT_NO_STRING 0xffffffff
+
+// Flags of the node records.
+#define SCENE_SNAPSHOT_NODE_ENABLED 1
+#define SCENE_SNAPSHOT_NODE_JOINT 2
+
+// Flags of the clip records.
+#define SCENE_SNAPSHOT_CLIP_PLAYING 1
+#define SCENE_SNAPSHOT_CLIP_PAUSED 2
+
+// Flags of the rigid body and agent records.
+#define SCENE_SNAPSHOT_ENABLED 1
+
+namespace gameplay
+{
+
+// The records of a snapshot follow its header in the order of the counts, with the strings they refer to last.
+// Every member is four bytes wide, so records are tightly packed and stay aligned.
+struct SnapshotHeader
+{
+    unsigned int magic;
+    unsigned int version;
+    unsigned int nodeCount;
+    unsigned int tagCount;
+    unsigned int clipCount;
+    unsigned int bodyCount;
+    unsigned int agentCount;
+    unsigned int stringSize;
+};
+
+// A node, recorded after its parent, with the offset of its ID in the strings.
+struct SnapshotNode
+{
+    int parent;
+    unsigned int id;
+    unsigned int flags;
+    unsigned int firstTag;
+    unsigned int tagCount;
+    float scale[3];
+    float rotation[4];
+    float translation[3];
+};
+
+struct SnapshotTag
+{
+    unsigned int name;
+    unsigned int value;
+};
+
+// A clip of an animation targeting a node, found through the first node the animation targets.
+struct SnapshotClip
+{
+    unsigned int node;
+    unsigned int animation;
+    unsigned int clip;
+    unsigned int flags;
+    float elapsedTime;
+    float speed;
+    float repeatCount;
+    float blendWeight;
+};
+
+struct SnapshotBody
+{
+    unsigned int node;
+    unsigned int flags;
+    float linearVelocity[3];
+    float angularVelocity[3];
+};
+
+struct SnapshotAgent
+{
+    unsigned int node;
+    unsigned int flags;
+    unsigned int state;
+};
+
+static unsigned int addString(std::vector<char>& strings, std::map<std::string, unsigned int>& offsets, const char* str)
+{
+    if (str == NULL)
+        return SCENE_SNAPSHOT_NO_STRING;
+
+    std::map<std::string, unsigned int>::const_iterator itr = offsets.find(str);
+    if (itr != offsets.end())
+        return itr->second;
+
+    const unsigned int offset = (unsigned int)strings.size();
+    strings.insert(strings.end(), str, str + strlen(str) + 1);
+    offsets[str] = offset;
+    return offset;
+}
+
+template <class T>
+static void appendRecords(std::vector<unsigned char>& data, const std::vector<T>& records)
+{
+    if (!records.empty())
+    {
+        const unsigned char* begin = reinterpret_cast<const unsigned char*>(&records[0]);
+        data.insert(data.end(), begin, begin + records.size() * sizeof(T));
+    }
+}
+
+SceneSnapshot::SceneSnapshot()
+{
+}
+
+SceneSnapshot::~SceneSnapshot()
+{
+}
+
+SceneSnapshot* SceneSnapshot::create(Scene* scene)
+{
+    GP_ASSERT(scene);
+
+    std::vector<SnapshotNode> nodes;
+    std::vector<SnapshotTag> tags;
+    std::vector<SnapshotClip> clips;
+    std::vector<SnapshotBody> bodies;
+    std::vector<SnapshotAgent> agents;
+    std::vector<char> strings;
+    std::map<std::string, unsigned int> offsets;
+    std::set<Animation*> animations;
+
+    // Nodes are recorded depth first, so each parent is recorded before its children.
+    std::vector<std::pair<Node*, int> > stack;
+    std::vector<Node*> siblings;
+    for (Node* node = scene->getFirstNode(); node != NULL; node = node->getNextSibling())
+        siblings.push_back(node);
+    for (size_t i = siblings.size(); i > 0; --i)
+        stack.push_back(std::make_pair(siblings[i - 1], -1));
+
+    while (!stack.empty())
+    {
+        Node* node = stack.back().first;
+        const int parent = stack.back().second;
+        stack.pop_back();
+        const unsigned int index = (unsigned int)nodes.size();
+
+        SnapshotNode record;
+        record.parent = parent;
+        record.id = addString(strings, offsets, node->getId());
+        record.flags = (node->isEnabled() ? SCENE_SNAPSHOT_NODE_ENABLED : 0) | (node->getType() == Node::JOINT ? SCENE_SNAPSHOT_NODE_JOINT : 0);
+        record.firstTag = (unsigned int)tags.size();
+        record.tagCount = 0;
+        if (node->_tags)
+        {
+            for (size_t i = 0, count = node->_tags->size(); i < count; ++i)
+            {
+                SnapshotTag tag;
+                tag.name = addString(strings, offsets, StringTable::get((*node->_tags)[i].first));
+                tag.value = addString(strings, offsets, (*node->_tags)[i].second.c_str());
+                tags.push_back(tag);
+            }
+            record.tagCount = (unsigned int)node->_tags->size();
+        }
+        const Vector3& scale = node->getScale();
+        const Quaternion& rotation = node->getRotation();
+        const Vector3& translation = node->getTranslation();
+        record.scale[0] = scale.x; record.scale[1] = scale.y; record.scale[2] = scale.z;
+        record.rotation[0] = rotation.x; record.rotation[1] = rotation.y; record.rotation[2] = rotation.z; record.rotation[3] = rotation.w;
+        record.translation[0] = translation.x; record.translation[1] = translation.y; record.translation[2] = translation.z;
+        nodes.push_back(record);
+
+        // Skeletal animations target many joints, but their clips are recorded once.
+        if (node->_animationChannels)
+        {
+            for (size_t i = 0, count = node->_animationChannels->size(); i < count; ++i)
+            {
+                Animation* animation = (*node->_animationChannels)[i]->_animation;
+                if (!animations.insert(animation).second)
+                    continue;
+
+                const unsigned int animationId = addString(strings, offsets, animation->getId());
+                for (unsigned int j = 0, clipCount = animation->getClipCount(); j < clipCount; ++j)
+                {
+                    AnimationClip* clip = animation->getClip(j);
+                    GP_ASSERT(clip);
+
+                    SnapshotClip entry;
+                    entry.node = index;
+                    entry.animation = animationId;
+                    entry.clip = addString(strings, offsets, clip->getId());
+                    entry.flags = 0;
+                    if (clip->isClipStateBitSet(AnimationClip::CLIP_IS_PLAYING_BIT) && !clip->isClipStateBitSet(AnimationClip::CLIP_IS_MARKED_FOR_REMOVAL_BIT))
+                        entry.flags |= SCENE_SNAPSHOT_CLIP_PLAYING;
+                    if (clip->isClipStateBitSet(AnimationClip::CLIP_IS_PAUSED_BIT))
+                        entry.flags |= SCENE_SNAPSHOT_CLIP_PAUSED;
+                    entry.elapsedTime = clip->_elapsedTime;
+                    entry.speed = clip->getSpeed();
+                    entry.repeatCount = clip->getRepeatCount();
+                    entry.blendWeight = clip->getBlendWeight();
+                    clips.push_back(entry);
+                }
+            }
+        }
+
+        PhysicsCollisionObject* object = node->getCollisionObject();
+        if (object && object->getType() == PhysicsCollisionObject::RIGID_BODY)
+        {
+            PhysicsRigidBody* body = static_cast<PhysicsRigidBody*>(object);
+            const Vector3 linearVelocity = body->getLinearVelocity();
+            const Vector3 angularVelocity = body->getAngularVelocity();
+
+            SnapshotBody entry;
+            entry.node = index;
+            entry.flags = body->isEnabled() ? SCENE_SNAPSHOT_ENABLED : 0;
+            entry.linearVelocity[0] = linearVelocity.x; entry.linearVelocity[1] = linearVelocity.y; entry.linearVelocity[2] = linearVelocity.z;
+            entry.angularVelocity[0] = angularVelocity.x; entry.angularVelocity[1] = angularVelocity.y; entry.angularVelocity[2] = angularVelocity.z;
+            bodies.push_back(entry);
+        }
+
+        AIAgent* agent = node->getAgent();
+        if (agent)
+        {
+            AIState* state = agent->getStateMachine() ? agent->getStateMachine()->getActiveState() : NULL;
+
+            SnapshotAgent entry;
+            entry.node = index;
+            entry.flags = agent->isEnabled() ? SCENE_SNAPSHOT_ENABLED : 0;
+            entry.state = addString(strings, offsets, state ? state->getId() : NULL);
+            agents.push_back(entry);
+        }
+
+        siblings.clear();
+        for (Node* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+            siblings.push_back(child);
+        for (size_t i = siblings.size(); i > 0; --i)
+            stack.push_back(std::make_pair(siblings[i - 1], (int)index));
+    }
+
+    SnapshotHeader header;
+    header.magic = SCENE_SNAPSHOT_MAGIC;
+    header.version = SCENE_SNAPSHOT_VERSION;
+    header.nodeCount = (unsigned int)nodes.size();
+    header.tagCount = (unsigned int)tags.size();
+    header.clipCount = (unsigned int)clips.size();
+    header.bodyCount = (unsigned int)bodies.size();
+    header.agentCount = (unsigned int)agents.size();
+    header.stringSize = (unsigned int)strings.size();
+
+    SceneSnapshot* snapshot = new SceneSnapshot();
+    std::vector<unsigned char>& data = snapshot->_data;
+    data.reserve(sizeof(SnapshotHeader) + nodes.size() * sizeof(SnapshotNode) + tags.size() * sizeof(SnapshotTag) +
+                 clips.size() * sizeof(SnapshotClip) + bodies.size() * sizeof(SnapshotBody) + agents.size() * sizeof(SnapshotAgent) + strings.size());
+    const unsigned char* begin = reinterpret_cast<const unsigned char*>(&header);
+    data.insert(data.end(), begin, begin + sizeof(SnapshotHeader));
+    appendRecords(data, nodes);
+    appendRecords(data, tags);
+    appendRecords(data, clips);
+    appendRecords(data, bodies);
+    appendRecords(data, agents);
+    data.insert(data.end(), strings.begin(), strings.end());
+
+    return snapshot;
+}
+
+SceneSnapshot* SceneSnapshot::create(const void* data, size_t size)
+{
+    GP_ASSERT(data);
+
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    if (!validate(bytes, size))
+    {
+        GP_WARN("Invalid scene snapshot data.");
+        return NULL;
+    }
+
+    SceneSnapshot* snapshot = new SceneSnapshot();
+    snapshot->_data.assign(bytes, bytes + size);
+    return snapshot;
+}
+
+SceneSnapshot* SceneSnapshot::load(const char* path)
+{
+    GP_ASSERT(path);
+
+    std::unique_ptr<Stream> stream(FileSystem::open(path));
+    if (stream.get() == NULL)
+    {
+        GP_WARN("Failed to open scene snapshot file '%s'.", path);
+        return NULL;
+    }
+
+    const size_t size = stream->length();
+    std::vector<unsigned char> data(size);
+    if (size == 0 || stream->read(&data[0], 1, size) != size)
+    {
+        GP_WARN("Failed to read scene snapshot file '%s'.", path);
+        return NULL;
+    }
+    if (!validate(&data[0], size))
+    {
+        GP_WARN("Invalid scene snapshot file '%s'.", path);
+        return NULL;
+    }
+
+    SceneSnapshot* snapshot = new SceneSnapshot();
+    snapshot->_data.swap(data);
+    return snapshot;
+}
+
+bool SceneSnapshot::save(const char* path) const
+{
+    GP_ASSERT(path);
+
+    std::unique_ptr<Stream> stream(FileSystem::open(path, FileSystem::WRITE));
+    if (stream.get() == NULL || !stream->canWrite())
+    {
+        GP_WARN("Failed to open scene snapshot file '%s' for writing.", path);
+        return false;
+    }
+    if (stream->write(&_data[0], 1, _data.size()) != _data.size())
+    {
+        GP_WARN("Failed to write scene snapshot file '%s'.", path);
+        return false;
+    }
+    return true;
+}
+
+const void* SceneSnapshot::getData() const
+{
+    return &_data[0];
+}
+
+size_t SceneSnapshot::getSize() const
+{
+    return _data.size();
+}
+
+bool SceneSnapshot::validate(const unsigned char* data, size_t size)
+{
+    SnapshotHeader header;
+    if (size < sizeof(SnapshotHeader))
+        return false;
+    memcpy(&header, data, sizeof(SnapshotHeader));
+    if (header.magic != SCENE_SNAPSHOT_MAGIC || header.version != SCENE_SNAPSHOT_VERSION)
+        return false;
+
+    const size_t expected = sizeof(SnapshotHeader) + (size_t)header.nodeCount * sizeof(SnapshotNode) + (size_t)header.tagCount * sizeof(SnapshotTag) +
+        (size_t)header.clipCount * sizeof(SnapshotClip) + (size_t)header.bodyCount * sizeof(SnapshotBody) +
+        (size_t)header.agentCount * sizeof(SnapshotAgent) + header.stringSize;
+    if (size != expected || (header.stringSize > 0 && data[size - 1] != '\0'))
+        return false;
+
+    // Records must refer to earlier nodes and to strings within the data.
+    const unsigned char* records = data + sizeof(SnapshotHeader);
+    for (unsigned int i = 0; i < header.nodeCount; ++i)
+    {
+        SnapshotNode node;
+        memcpy(&node, records + i * sizeof(SnapshotNode), sizeof(SnapshotNode));
+        if (node.parent >= (int)i || node.id >= header.stringSize || (size_t)node.firstTag + node.tagCount > header.tagCount)
+            return false;
+    }
+    records += (size_t)header.nodeCount * sizeof(SnapshotNode);
+    for (unsigned int i = 0; i < header.tagCount; ++i)
+    {
+        SnapshotTag tag;
+        memcpy(&tag, records + i * sizeof(SnapshotTag), sizeof(SnapshotTag));
+        if (tag.name >= header.stringSize || tag.value >= header.stringSize)
+            return false;
+    }
+    records += (size_t)header.tagCount * sizeof(SnapshotTag);
+    for (unsigned int i = 0; i < header.clipCount; ++i)
+    {
+        SnapshotClip clip;
+        memcpy(&clip, records + i * sizeof(SnapshotClip), sizeof(SnapshotClip));
+        if (clip.node >= header.nodeCount || clip.animation >= header.stringSize || clip.clip >= header.stringSize)
+            return false;
+    }
+    records += (size_t)header.clipCount * sizeof(SnapshotClip);
+    for (unsigned int i = 0; i < header.bodyCount; ++i)
+    {
+        SnapshotBody body;
+        memcpy(&body, records + i * sizeof(SnapshotBody), sizeof(SnapshotBody));
+        if (body.node >= header.nodeCount)
+            return false;
+    }
+    records += (size_t)header.bodyCount * sizeof(SnapshotBody);
+    for (unsigned int i = 0; i < header.agentCount; ++i)
+    {
+        SnapshotAgent agent;
+        memcpy(&agent, records + i * sizeof(SnapshotAgent), sizeof(SnapshotAgent));
+        if (agent.node >= header.nodeCount || (agent.state != SCENE_SNAPSHOT_NO_STRING && agent.state >= header.stringSize))
+            return false;
+    }
+    return true;
+}
+
+bool SceneSnapshot::restore(Scene* scene) const
+{
+    GP_ASSERT(scene);
+    GP_ASSERT(_data.size() >= sizeof(SnapshotHeader));
+
+    const unsigned char* data = &_data[0];
+    SnapshotHeader header;
+    memcpy(&header, data, sizeof(SnapshotHeader));
+    const unsigned char* nodeRecords = data + sizeof(SnapshotHeader);
+    const unsigned char* tagRecords = nodeRecords + (size_t)header.nodeCount * sizeof(SnapshotNode);
+    const unsigned char* clipRecords = tagRecords + (size_t)header.tagCount * sizeof(SnapshotTag);
+    const unsigned char* bodyRecords = clipRecords + (size_t)header.clipCount * sizeof(SnapshotClip);
+    const unsigned char* agentRecords = bodyRecords + (size_t)header.bodyCount * sizeof(SnapshotBody);
+    const char* strings = reinterpret_cast<const char*>(agentRecords + (size_t)header.agentCount * sizeof(SnapshotAgent));
+
+    // Match the recorded nodes to the nodes of the scene, restoring the hierarchy and transforms as they are found.
+    std::vector<Node*> nodes(header.nodeCount);
+    std::set<Node*> matched;
+    for (unsigned int i = 0; i < header.nodeCount; ++i)
+    {
+        SnapshotNode record;
+        memcpy(&record, nodeRecords + i * sizeof(SnapshotNode), sizeof(SnapshotNode));
+        const char* id = strings + record.id;
+        Node* parent = record.parent >= 0 ? nodes[record.parent] : NULL;
+
+        Node* node = NULL;
+        for (Node* child = parent ? parent->getFirstChild() : scene->getFirstNode(); child != NULL; child = child->getNextSibling())
+        {
+            if (strcmp(child->getId(), id) == 0 && matched.find(child) == matched.end())
+            {
+                node = child;
+                break;
+            }
+        }
+        if (node == NULL)
+        {
+            // The node may have been moved under another parent since the snapshot was taken.
+            Node* found = scene->findNode(id);
+            if (found && matched.find(found) == matched.end())
+            {
+                node = found;
+                node->addRef();
+                if (parent)
+                {
+                    parent->addChild(node);
+                }
+                else
+                {
+                    node->getParent()->removeChild(node);
+                    scene->addNode(node);
+                }
+                node->release();
+            }
+        }
+        if (node == NULL)
+        {
+            node = (record.flags & SCENE_SNAPSHOT_NODE_JOINT) ? Joint::create(id) : Node::create(id);
+            if (parent)
+                parent->addChild(node);
+            else
+                scene->addNode(node);
+            node->release();
+        }
+        matched.insert(node);
+        nodes[i] = node;
+
+        node->set(Vector3(record.scale[0], record.scale[1], record.scale[2]),
+                  Quaternion(record.rotation[0], record.rotation[1], record.rotation[2], record.rotation[3]),
+                  Vector3(record.translation[0], record.translation[1], record.translation[2]));
+        node->setEnabled((record.flags & SCENE_SNAPSHOT_NODE_ENABLED) != 0);
+
+        SAFE_DELETE(node->_tags);
+        for (unsigned int j = 0; j < record.tagCount; ++j)
+        {
+            SnapshotTag tag;
+            memcpy(&tag, tagRecords + (record.firstTag + j) * sizeof(SnapshotTag), sizeof(SnapshotTag));
+            node->setTag(strings + tag.name, strings + tag.value);
+        }
+    }
+
+    // Remove the nodes that were not in the scene when the snapshot was taken.
+    std::vector<Node*> removed;
+    for (Node* node = scene->getFirstNode(); node != NULL; node = node->getNextSibling())
+    {
+        if (matched.find(node) == matched.end())
+            removed.push_back(node);
+    }
+    for (size_t i = 0, count = removed.size(); i < count; ++i)
+        scene->removeNode(removed[i]);
+    for (unsigned int i = 0; i < header.nodeCount; ++i)
+    {
+        removed.clear();
+        for (Node* child = nodes[i]->getFirstChild(); child != NULL; child = child->getNextSibling())
+        {
+            if (matched.find(child) == matched.end())
+                removed.push_back(child);
+        }
+        for (size_t j = 0, count = removed.size(); j < count; ++j)
+            nodes[i]->removeChild(removed[j]);
+    }
+
+    for (unsigned int i = 0; i < header.clipCount; ++i)
+    {
+        SnapshotClip record;
+        memcpy(&record, clipRecords + i * sizeof(SnapshotClip), sizeof(SnapshotClip));
+        Animation* animation = nodes[record.node]->getAnimation(strings + record.animation);
+        AnimationClip* clip = animation ? animation->getClip(strings + record.clip) : NULL;
+        if (clip == NULL)
+            continue;
+
+        clip->setSpeed(record.speed);
+        clip->setRepeatCount(record.repeatCount);
+        clip->setBlendWeight(record.blendWeight);
+        if (!(record.flags & SCENE_SNAPSHOT_CLIP_PLAYING))
+        {
+            clip->stop();
+            continue;
+        }
+
+        // Clips that are not running yet take their elapsed time from their start time when they begin.
+        if (!clip->isPlaying() && !clip->isClipStateBitSet(AnimationClip::CLIP_IS_PAUSED_BIT))
+            clip->play();
+        clip->resetClipStateBit(AnimationClip::CLIP_IS_MARKED_FOR_REMOVAL_BIT);
+        clip->resetClipStateBit(AnimationClip::CLIP_IS_RESTARTED_BIT);
+        clip->_elapsedTime = record.elapsedTime;
+        if (record.speed != 0.0f)
+        {
+            const float startTime = record.speed >= 0.0f ? record.elapsedTime : record.elapsedTime - (float)clip->getActiveDuration();
+            clip->_timeStarted = Game::getGameTime() - startTime / record.speed;
+        }
+        if (record.flags & SCENE_SNAPSHOT_CLIP_PAUSED)
+            clip->pause();
+        else
+            clip->resetClipStateBit(AnimationClip::CLIP_IS_PAUSED_BIT);
+    }
+
+    // Dynamic bodies are moved to their restored nodes, since their transforms are otherwise driven by the simulation.
+    for (unsigned int i = 0; i < header.bodyCount; ++i)
+    {
+        SnapshotBody record;
+        memcpy(&record, bodyRecords + i * sizeof(SnapshotBody), sizeof(SnapshotBody));
+        PhysicsCollisionObject* object = nodes[record.node]->getCollisionObject();
+        if (object == NULL || object->getType() != PhysicsCollisionObject::RIGID_BODY)
+            continue;
+
+        PhysicsRigidBody* body = static_cast<PhysicsRigidBody*>(object);
+        body->setEnabled((record.flags & SCENE_SNAPSHOT_ENABLED) != 0);
+        if (body->isDynamic())
+        {
+            GP_ASSERT(body->_body);
+            GP_ASSERT(body->_motionState);
+            btTransform transform;
+            body->_motionState->updateTransformFromNode();
+            body->_motionState->getWorldTransform(transform);
+            body->_body->setWorldTransform(transform);
+            body->_body->setInterpolationWorldTransform(transform);
+            body->setLinearVelocity(record.linearVelocity[0], record.linearVelocity[1], record.linearVelocity[2]);
+            body->setAngularVelocity(record.angularVelocity[0], record.angularVelocity[1], record.angularVelocity[2]);
+            body->_body->activate(true);
+        }
+    }
+
+    // State changes are messages, so agents enter their restored states on the next AI update.
+    for (unsigned int i = 0; i < header.agentCount; ++i)
+    {
+        SnapshotAgent record;
+        memcpy(&record, agentRecords + i * sizeof(SnapshotAgent), sizeof(SnapshotAgent));
+        AIAgent* agent = nodes[record.node]->getAgent();
+        if (agent == NULL)
+            continue;
+
+        agent->setEnabled((record.flags & SCENE_SNAPSHOT_ENABLED) != 0);
+        AIStateMachine* stateMachine = agent->getStateMachine();
+        if (stateMachine && record.state != SCENE_SNAPSHOT_NO_STRING)
+        {
+            AIState* state = stateMachine->getActiveState();
+            if (state == NULL || strcmp(state->getId(), strings + record.state) != 0)
+                stateMachine->setState(strings + record.state);
+        }
+    }
+
+    return true;
+}
+
+}
@@ -0,0 +1,125 @@
+#ifndef SCENESNAPSHOT_H_
+#define SCENESNAPSHOT_H_
+
+#include "Ref.h"
+
+namespace gameplay
+{
+
+class Scene;
+
+/**
+ * Defines a binary snapshot of the state of a scene, for quick saves and loads.
+ *
+ * A snapshot records the node hierarchy of a scene with the transform, enabled state and
+ * tags of each node, the state of every clip of the animations targeting the nodes, the
+ * velocities of dynamic rigid bodies and the active state of AI agents. The state is
+ * written to a single contiguous block of fixed-size records followed by the strings they
+ * refer to, which is read back by copying the records out of the block rather than by
+ * parsing, and which can be saved to and loaded from a file as it is.
+ *
+ * A snapshot does not record the content of the nodes, so it is restored onto a scene
+ * loaded from the same file as the scene it was taken from. Nodes are matched by their ID
+ * under the same parent, and moved under their recorded parent if they are found elsewhere
+ * in the scene. Nodes that are not found are created empty, and nodes of the scene that are
+ * not in the snapshot are removed from it.
+ *
+ * @script{ignore}
+ */
+class SceneSnapshot : public Ref
+{
+public:
+
+    /**
+     * Takes a snapshot of the state of a scene.
+     *
+     * @param scene The scene to take a snapshot of.
+     *
+     * @return The new snapshot.
+     */
+    static SceneSnapshot* create(Scene* scene);
+
+    /**
+     * Creates a snapshot from a block of data returned by getData().
+     *
+     * @param data The snapshot data, which is copied.
+     * @param size The size of the data in bytes.
+     *
+     * @return The new snapshot, or NULL if the data is not a valid snapshot.
+     */
+    static SceneSnapshot* create(const void* data, size_t size);
+
+    /**
+     * Loads a snapshot from a file written by save().
+     *
+     * @param path The path of the snapshot file.
+     *
+     * @return The loaded snapshot, or NULL if the file could not be read or is not a valid snapshot.
+     */
+    static SceneSnapshot* load(const char* path);
+
+    /**
+     * Saves the snapshot to a file.
+     *
+     * @param path The path of the snapshot file.
+     *
+     * @return true if the snapshot was saved, false otherwise.
+     */
+    bool save(const char* path) const;
+
+    /**
+     * Gets the data of the snapshot.
+     *
+     * @return The snapshot data.
+     */
+    const void* getData() const;
+
+    /**
+     * Gets the size of the data of the snapshot.
+     *
+     * @return The size of the data in bytes.
+     */
+    size_t getSize() const;
+
+    /**
+     * Restores the state recorded by the snapshot onto a scene.
+     *
+     * @param scene The scene to restore the state of.
+     *
+     * @return true if the state was restored, false otherwise.
+     */
+    bool restore(Scene* scene) const;
+
+private:
+
+    /**
+     * Constructor.
+     */
+    SceneSnapshot();
+
+    /**
+     * Destructor.
+     */
+    ~SceneSnapshot();
+
+    /**
+     * Hidden copy constructor.
+     */
+    SceneSnapshot(const SceneSnapshot& copy);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    SceneSnapshot& operator=(const SceneSnapshot&);
+
+    /**
+     * Determines if the data is a complete snapshot, with every record referring within it.
+     */
+    static bool validate(const unsigned char* data, size_t size);
+
+    std::vector<unsigned char> _data;
+};
+
+}
+
+#endif
@@ -11,6 +11,9 @@ namespace gameplay
  * Defines a helper class for displaying images on screen for a duration of time.
  *
  * Ex. A splash or level loading screens.
+ *
+ * The screen is drawn once and the game is blocked while it is displayed. To keep a screen
+ * rendering while resources load in the background, use LoadingScreen instead.
  */
 class ScreenDisplayer
 {
@@ -4,6 +4,18 @@
 namespace gameplay
 {
 
+Script::Statistics::Statistics() : calls(0), time(0.0), allocations(0), allocatedBytes(0)
+{
+}
+
+void Script::Statistics::add(double time, unsigned int allocations, size_t allocatedBytes)
+{
+    ++calls;
+    this->time += time;
+    this->allocations += allocations;
+    this->allocatedBytes += allocatedBytes;
+}
+
 Script::Script() : _scope(GLOBAL), _env(0)
 {
 }
@@ -39,4 +51,14 @@ bool Script::reload()
     return Game::getInstance()->getScriptController()->loadScript(this);
 }
 
+const Script::Statistics& Script::getStatistics() const
+{
+    return _statistics;
+}
+
+void Script::resetStatistics()
+{
+    _statistics = Statistics();
+}
+
 }
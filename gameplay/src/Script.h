@@ -54,6 +54,48 @@ public:
         PROTECTED
     };
 
+    /**
+     * Execution statistics accumulated by script function calls.
+     *
+     * The time and allocations of a call include those of any nested calls it makes.
+     */
+    struct Statistics
+    {
+        /**
+         * The number of function calls.
+         */
+        unsigned int calls;
+
+        /**
+         * The total execution time of the calls, in milliseconds.
+         */
+        double time;
+
+        /**
+         * The number of memory allocations made by Lua during the calls.
+         */
+        unsigned int allocations;
+
+        /**
+         * The number of bytes allocated by Lua during the calls.
+         */
+        size_t allocatedBytes;
+
+        /**
+         * Constructor.
+         */
+        Statistics();
+
+        /**
+         * Adds a function call to the statistics.
+         *
+         * @param time The execution time of the call, in milliseconds.
+         * @param allocations The number of allocations made during the call.
+         * @param allocatedBytes The number of bytes allocated during the call.
+         */
+        void add(double time, unsigned int allocations, size_t allocatedBytes);
+    };
+
     /**
      * Returns the path from which this Script was loaded.
      *
@@ -91,6 +133,19 @@ public:
      */
     bool reload();
 
+    /**
+     * Gets the execution statistics of the functions of this script called by the engine,
+     * such as its script event callbacks.
+     *
+     * @return The execution statistics of this script.
+     */
+    const Statistics& getStatistics() const;
+
+    /**
+     * Resets the execution statistics of this script.
+     */
+    void resetStatistics();
+
 private:
 
     /**
@@ -111,6 +166,7 @@ private:
     std::string _path;
     Scope _scope;
     int _env;
+    Statistics _statistics;
 
 };
 
@@ -1,6 +1,7 @@
 #include "Base.h"
 #include "FileSystem.h"
 #include "ScriptController.h"
+#include "Scene.h"
 
 #ifndef GP_NO_LUA_BINDINGS
 #include "lua/lua_all_bindings.h"
@@ -14,6 +15,21 @@ static const std::vector<std::string>& luaGetClassRelatives(const char* type)
 }
 #endif
 
+// The size of the header of Lua 5.2 bytecode chunks that identifies the Lua version, bytecode
+// format and the sizes and byte order of the types in the chunk.
+#define SCRIPT_BYTECODE_HEADER_SIZE 12
+
+// The controller that registers the bindings while it is initialized, before the game publishes it.
+static ScriptController* __registeringController = NULL;
+
+/**
+ * Returns the controller that the bindings are registered with.
+ */
+static ScriptController* getRegisteringController()
+{
+    return __registeringController ? __registeringController : Game::getInstance()->getScriptController();
+}
+
 #define GENERATE_LUA_GET_POINTER(type, checkFunc) \
     ScriptController* sc = Game::getInstance()->getScriptController(); \
     /* Check that the parameter is the correct type. */ \
@@ -217,9 +233,14 @@ Script* ScriptController::loadScript(const char* path, Script::Scope scope, bool
 
 bool ScriptController::loadScript(Script* script)
 {
+    GP_MEMORY_TAG(MEMORY_TAG_SCRIPT);
     GP_ASSERT(script);
 
-    if (!FileSystem::fileExists(script->_path.c_str()))
+    // Prefer the precompiled bytecode of a source script, which loads without parsing and compiling it.
+    std::string chunkPath = script->_path;
+    if (chunkPath.size() > 4 && chunkPath.compare(chunkPath.size() - 4, 4, ".lua") == 0 && FileSystem::fileExists((chunkPath + "c").c_str()))
+        chunkPath += "c";
+    else if (!FileSystem::fileExists(chunkPath.c_str()))
     {
         GP_WARN("Failed to load script: %s. File does not exist.", script->_path.c_str());
         return false;
@@ -230,9 +251,19 @@ bool ScriptController::loadScript(Script* script)
     scripts.push_back(script);
 
     // Load the contents of the script, but don't execute it yet
-    const char* scriptSource = FileSystem::readAll(script->_path.c_str());
-    int ret = luaL_loadstring(_lua, scriptSource); // [chunk]
-    SAFE_DELETE_ARRAY(scriptSource);
+    int chunkSize = 0;
+    char* chunk = FileSystem::readAll(chunkPath.c_str(), &chunkSize);
+    if (chunk && !isCompatibleBytecode(chunk, chunkSize) && chunkPath != script->_path && FileSystem::fileExists(script->_path.c_str()))
+    {
+        GP_WARN("Precompiled script '%s' was compiled for a different version of Lua or platform; loading the source instead.", chunkPath.c_str());
+        SAFE_DELETE_ARRAY(chunk);
+        chunk = FileSystem::readAll(script->_path.c_str(), &chunkSize);
+    }
+    std::string chunkName = "@" + script->_path;
+    int ret = chunk ? luaL_loadbuffer(_lua, chunk, chunkSize, chunkName.c_str()) : LUA_ERRFILE; // [chunk]
+    SAFE_DELETE_ARRAY(chunk);
+    if (ret == LUA_ERRFILE)
+        lua_pushstring(_lua, "Failed to read file");
 
     if (ret == LUA_OK)
     {
@@ -657,7 +688,8 @@ void ScriptController::print(const char* str1, const char* str2)
     gameplay::print("%s%s", str1, str2);
 }
 
-ScriptController::ScriptController() : _lua(NULL)
+ScriptController::ScriptController() : _lua(NULL), _gcBudget(0.0f), _gcCycleMemory(0), _memoryUsage(0),
+    _allocationCount(0), _allocatedBytes(0), _frameAllocationCount(0), _runningCoroutine(NULL), _coroutineBudget(0.0f)
 {
 }
 
@@ -719,13 +751,19 @@ void appendLuaPath(lua_State* state, const char* path)
 
 void ScriptController::initialize()
 {
-    _lua = luaL_newstate();
+    // Lua allocates through the controller, which counts the allocations for the script statistics.
+    _lua = lua_newstate(allocate, this);
     if (!_lua)
         GP_ERROR("Failed to initialize Lua scripting engine.");
+    lua_atpanic(_lua, panic);
     luaL_openlibs(_lua);
 
 #ifndef GP_NO_LUA_BINDINGS
+    // The bindings register with this controller, which the game only returns once it is initialized.
+    __registeringController = this;
     lua_RegisterAllBindings();
+    Scene::registerScriptFunctions(_lua);
+    __registeringController = NULL;
 #endif
 
     // Append to the LUA_PATH to allow scripts to be found in the resource folder on all platforms
@@ -757,6 +795,23 @@ void ScriptController::initialize()
         if (luaL_dostring(_lua, argsStr.c_str()))
             GP_ERROR("Failed to pass command-line arguments with error: '%s'.", lua_tostring(_lua, -1));
     }
+
+    // Register the script functions of the coroutine scheduler.
+    lua_register(_lua, "startCoroutine", luaStartCoroutine);
+    lua_register(_lua, "wait", luaWait);
+    lua_register(_lua, "waitFrames", luaWaitFrames);
+    lua_register(_lua, "waitFor", luaWaitFor);
+    lua_register(_lua, "notify", luaNotify);
+
+    // Dump an empty chunk to get the bytecode header of this version of Lua on this platform,
+    // which precompiled scripts must match to be loaded.
+    _bytecodeHeader.clear();
+    if (luaL_loadstring(_lua, "") == LUA_OK)
+        lua_dump(_lua, writeBytecodeHeader, &_bytecodeHeader);
+    lua_pop(_lua, 1);
+
+    // Apply a garbage collection budget set before initialization.
+    setGarbageCollectionBudget(_gcBudget);
 }
 
 void ScriptController::finalize()
@@ -768,6 +823,13 @@ void ScriptController::finalize()
     }
     _timeListeners.clear();
 
+    // Abandon the coroutines that have not completed.
+    while (!_coroutines.empty())
+        removeCoroutine(_coroutines.back());
+
+    // Metatables are released with the Lua state.
+    _userDataMatches.clear();
+
     if (_lua)
     {
         // Perform a full garbage collection cycle.
@@ -809,10 +871,31 @@ bool ScriptController::executeFunctionHelper(int resultCount, const char* func,
         return false;
     }
 
+    // Push the arguments to the Lua stack if there are any.
+    int argumentCount = pushArguments(args, list);
+
+    pushScript(script);
+
+    // Perform the function call.
+    // This will push 'resultCount' values onto the stack if it succeeds.
+    // Otherwise (if it fails) it will push an error string onto the stack.
+    bool success = pcall(script, argumentCount, resultCount);
+    if (!success)
+    {
+        GP_WARN("Failed to call function '%s' with error '%s'.", func, lua_tostring(_lua, -1));
+        lua_pop(_lua, 1); // pop the error
+    }
+
+    popScript();
+
+    return success;
+}
+
+int ScriptController::pushArguments(const char* args, va_list* list)
+{
     const char* sig = args;
     int argumentCount = 0;
 
-    // Push the arguments to the Lua stack if there are any.
     if (sig)
     {
         while (true)
@@ -909,23 +992,392 @@ bool ScriptController::executeFunctionHelper(int resultCount, const char* func,
         }
     }
 
-    pushScript(script);
+    return argumentCount;
+}
 
-    // Perform the function call.
-    // This will push 'resultCount' values onto the stack if it succeeds.
-    // Otherwise (if it fails) it will push an error string onto the stack.
-    bool success = lua_pcall(_lua, argumentCount, resultCount, 0) == 0;
+bool ScriptController::resolveFunction(const char* func, ScriptFunction* function, Script* script)
+{
+    GP_ASSERT(function);
+
+    function->reset();
+    if (!_lua || func == NULL)
+        return false;
+
+    // Resolve in the environment that executeFunctionHelper would call the function in.
+    if (!script && !_envStack.empty())
+        script = _envStack.back();
+
+    int top = lua_gettop(_lua);
+    if (!getNestedVariable(_lua, func, script ? script->_env : 0) || !lua_isfunction(_lua, -1))
+    {
+        lua_settop(_lua, top);
+        return false;
+    }
+
+    // luaL_ref pops the function.
+    function->_ref = luaL_ref(_lua, LUA_REGISTRYINDEX);
+    function->_script = script;
+    function->_name = func;
+    lua_settop(_lua, top);
+    return true;
+}
+
+bool ScriptController::executeFunction(const ScriptFunction& function, bool* out)
+{
+    if (!pushFunction(function))
+        return false;
+
+    return callFunction(function, 0, out);
+}
+
+bool ScriptController::executeFunction(const ScriptFunction& function, float arg, bool* out)
+{
+    if (!pushFunction(function))
+        return false;
+
+    lua_pushnumber(_lua, arg);
+    return callFunction(function, 1, out);
+}
+
+bool ScriptController::executeFunction(const ScriptFunction& function, int arg1, int arg2, bool* out)
+{
+    if (!pushFunction(function))
+        return false;
+
+    lua_pushinteger(_lua, arg1);
+    lua_pushinteger(_lua, arg2);
+    return callFunction(function, 2, out);
+}
+
+bool ScriptController::executeFunction(const ScriptFunction& function, const char* args, bool* out, va_list* list)
+{
+    if (!pushFunction(function))
+        return false;
+
+    int argumentCount = pushArguments(args, list);
+    return callFunction(function, argumentCount, out);
+}
+
+bool ScriptController::pushFunction(const ScriptFunction& function)
+{
+    if (!_lua || !function.isValid())
+        return false;
+
+    lua_rawgeti(_lua, LUA_REGISTRYINDEX, function._ref);
+    return true;
+}
+
+bool ScriptController::callFunction(const ScriptFunction& function, int argumentCount, bool* out)
+{
+    pushScript(function._script);
+
+    bool success = pcall(function._script, argumentCount, out ? 1 : 0);
     if (!success)
     {
-        GP_WARN("Failed to call function '%s' with error '%s'.", func, lua_tostring(_lua, -1));
+        GP_WARN("Failed to call function '%s' with error '%s'.", function._name.c_str(), lua_tostring(_lua, -1));
         lua_pop(_lua, 1); // pop the error
     }
+    else if (out)
+    {
+        *out = ScriptUtil::luaCheckBool(_lua, -1);
+        lua_pop(_lua, 1);
+    }
 
     popScript();
 
     return success;
 }
 
+bool ScriptController::pcall(Script* script, int argumentCount, int resultCount)
+{
+    if (!script)
+        return lua_pcall(_lua, argumentCount, resultCount, 0) == LUA_OK;
+
+    double start = Game::getAbsoluteTime();
+    unsigned int allocationCount = _allocationCount;
+    size_t allocatedBytes = _allocatedBytes;
+
+    bool success = lua_pcall(_lua, argumentCount, resultCount, 0) == LUA_OK;
+
+    script->_statistics.add(Game::getAbsoluteTime() - start, _allocationCount - allocationCount, _allocatedBytes - allocatedBytes);
+    return success;
+}
+
+bool ScriptController::startCoroutine(const char* func, Script* script)
+{
+    if (!_lua)
+        return false;
+
+    if (!getNestedVariable(_lua, func, script ? script->_env : 0))
+    {
+        GP_WARN("Failed to start coroutine '%s'.", func);
+        return false;
+    }
+
+    startCoroutine(_lua, 0, script);
+    return true;
+}
+
+void ScriptController::notifyCoroutines(const char* signal)
+{
+    for (std::list<Coroutine*>::iterator itr = _coroutines.begin(); itr != _coroutines.end(); ++itr)
+    {
+        if ((*itr)->signal == signal)
+            (*itr)->signal.clear();
+    }
+}
+
+unsigned int ScriptController::getCoroutineCount() const
+{
+    return (unsigned int)_coroutines.size();
+}
+
+void ScriptController::setCoroutineBudget(float milliseconds)
+{
+    _coroutineBudget = std::max(milliseconds, 0.0f);
+}
+
+float ScriptController::getCoroutineBudget() const
+{
+    return _coroutineBudget;
+}
+
+void ScriptController::startCoroutine(lua_State* state, int argumentCount, Script* script)
+{
+    Coroutine* coroutine = new Coroutine();
+    coroutine->thread = lua_newthread(state);
+    coroutine->ref = luaL_ref(state, LUA_REGISTRYINDEX);
+    coroutine->script = script;
+    coroutine->wakeTime = 0.0;
+    coroutine->wakeFrame = 0;
+    if (script)
+        script->addRef();
+
+    // Move the function and its arguments to the new thread.
+    lua_xmove(state, coroutine->thread, argumentCount + 1);
+
+    _coroutines.push_back(coroutine);
+    if (!resumeCoroutine(coroutine, argumentCount))
+        removeCoroutine(coroutine);
+}
+
+bool ScriptController::resumeCoroutine(Coroutine* coroutine, int argumentCount)
+{
+    // Without a wait, a yielding coroutine is ready again in the next frame.
+    coroutine->wakeTime = 0.0;
+    coroutine->wakeFrame = 0;
+    coroutine->signal.clear();
+
+    Coroutine* previous = _runningCoroutine;
+    _runningCoroutine = coroutine;
+    pushScript(coroutine->script);
+
+    int status = lua_resume(coroutine->thread, NULL, argumentCount);
+
+    popScript();
+    _runningCoroutine = previous;
+
+    if (status == LUA_YIELD)
+        return true;
+
+    if (status != LUA_OK)
+    {
+        luaL_traceback(_lua, coroutine->thread, lua_tostring(coroutine->thread, -1), 0);
+        GP_WARN("Coroutine failed with error '%s'.", lua_tostring(_lua, -1));
+        lua_pop(_lua, 1);
+    }
+    return false;
+}
+
+void ScriptController::removeCoroutine(Coroutine* coroutine)
+{
+    _coroutines.remove(coroutine);
+    luaL_unref(_lua, LUA_REGISTRYINDEX, coroutine->ref);
+    SAFE_RELEASE(coroutine->script);
+    SAFE_DELETE(coroutine);
+}
+
+ScriptController::Coroutine* ScriptController::getRunningCoroutine(lua_State* state, const char* function)
+{
+    if (!_runningCoroutine || _runningCoroutine->thread != state)
+        luaL_error(state, "%s must be called from a coroutine started with startCoroutine.", function);
+    return _runningCoroutine;
+}
+
+void ScriptController::updateCoroutines()
+{
+    if (_coroutines.empty())
+        return;
+
+    GP_PROFILE_SCOPE("ScriptController::updateCoroutines");
+
+    double gameTime = Game::getGameTime();
+    unsigned int frame = Game::getInstance()->getFrameNumber();
+    double end = Game::getAbsoluteTime() + _coroutineBudget;
+
+    // Visit each coroutine that was scheduled at the start of the frame once, moving it to
+    // the back of the list, so that the ready coroutines left over when the budget runs out
+    // are at the front in the next frame. Coroutines started meanwhile have already run.
+    for (size_t i = 0, count = _coroutines.size(); i < count && !_coroutines.empty(); ++i)
+    {
+        Coroutine* coroutine = _coroutines.front();
+        bool ready = coroutine->signal.empty() && gameTime >= coroutine->wakeTime && frame >= coroutine->wakeFrame;
+        if (ready && _coroutineBudget > 0.0f && Game::getAbsoluteTime() >= end)
+            break;
+
+        _coroutines.pop_front();
+        _coroutines.push_back(coroutine);
+        if (ready && !resumeCoroutine(coroutine, 0))
+            removeCoroutine(coroutine);
+    }
+}
+
+int ScriptController::luaStartCoroutine(lua_State* state)
+{
+    luaL_checktype(state, 1, LUA_TFUNCTION);
+
+    // The coroutine runs in the environment of the script starting it.
+    ScriptController* sc = Game::getInstance()->getScriptController();
+    sc->startCoroutine(state, lua_gettop(state) - 1, sc->getCurrentScript());
+    return 0;
+}
+
+int ScriptController::luaWait(lua_State* state)
+{
+    Coroutine* coroutine = Game::getInstance()->getScriptController()->getRunningCoroutine(state, "wait");
+    double seconds = luaL_checknumber(state, 1);
+    coroutine->wakeTime = Game::getGameTime() + seconds * 1000.0;
+    return lua_yield(state, 0);
+}
+
+int ScriptController::luaWaitFrames(lua_State* state)
+{
+    Coroutine* coroutine = Game::getInstance()->getScriptController()->getRunningCoroutine(state, "waitFrames");
+    int frames = luaL_checkint(state, 1);
+    coroutine->wakeFrame = Game::getInstance()->getFrameNumber() + (unsigned int)std::max(frames, 1);
+    return lua_yield(state, 0);
+}
+
+int ScriptController::luaWaitFor(lua_State* state)
+{
+    Coroutine* coroutine = Game::getInstance()->getScriptController()->getRunningCoroutine(state, "waitFor");
+    coroutine->signal = luaL_checkstring(state, 1);
+    return lua_yield(state, 0);
+}
+
+int ScriptController::luaNotify(lua_State* state)
+{
+    Game::getInstance()->getScriptController()->notifyCoroutines(luaL_checkstring(state, 1));
+    return 0;
+}
+
+void ScriptController::setGarbageCollectionBudget(float milliseconds)
+{
+    _gcBudget = std::max(milliseconds, 0.0f);
+    if (_lua)
+    {
+        // Collection only happens in the steps of each frame while there is a budget.
+        lua_gc(_lua, _gcBudget > 0.0f ? LUA_GCSTOP : LUA_GCRESTART, 0);
+        _gcCycleMemory = _memoryUsage;
+    }
+}
+
+float ScriptController::getGarbageCollectionBudget() const
+{
+    return _gcBudget;
+}
+
+size_t ScriptController::getMemoryUsage() const
+{
+    return _memoryUsage;
+}
+
+unsigned int ScriptController::getAllocationCount() const
+{
+    return _allocationCount;
+}
+
+size_t ScriptController::getAllocatedBytes() const
+{
+    return _allocatedBytes;
+}
+
+void ScriptController::collectGarbage()
+{
+    GP_PROFILE_COUNTER("Lua memory (KB)", _memoryUsage / 1024.0);
+    GP_PROFILE_COUNTER("Lua allocations", _allocationCount - _frameAllocationCount);
+    _frameAllocationCount = _allocationCount;
+
+    if (!_lua || _gcBudget <= 0.0f)
+        return;
+
+    GP_PROFILE_SCOPE("ScriptController::collectGarbage");
+
+    // Run the smallest incremental steps until the budget is spent or the cycle completes,
+    // unless collection has fallen so far behind that the cycle must be completed now.
+    bool behind = _memoryUsage > _gcCycleMemory * 2;
+    double end = Game::getAbsoluteTime() + _gcBudget;
+    while (true)
+    {
+        if (lua_gc(_lua, LUA_GCSTEP, 0))
+        {
+            _gcCycleMemory = _memoryUsage;
+            break;
+        }
+        if (!behind && Game::getAbsoluteTime() >= end)
+            break;
+    }
+}
+
+void* ScriptController::allocate(void* userData, void* ptr, size_t oldSize, size_t newSize)
+{
+    ScriptController* sc = (ScriptController*)userData;
+
+    // If ptr is NULL, oldSize is the kind of object being allocated rather than a size.
+    size_t size = ptr ? oldSize : 0;
+    if (newSize == 0)
+    {
+        sc->_memoryUsage -= size;
+        free(ptr);
+        return NULL;
+    }
+
+    void* result = realloc(ptr, newSize);
+    if (result)
+    {
+        sc->_memoryUsage += newSize - size;
+        if (newSize > size)
+        {
+            ++sc->_allocationCount;
+            sc->_allocatedBytes += newSize - size;
+        }
+    }
+    return result;
+}
+
+bool ScriptController::isCompatibleBytecode(const char* chunk, int size) const
+{
+    // Source text is always compatible.
+    if (size < 1 || chunk[0] != LUA_SIGNATURE[0])
+        return true;
+
+    return size >= (int)_bytecodeHeader.size() && memcmp(chunk, _bytecodeHeader.data(), _bytecodeHeader.size()) == 0;
+}
+
+int ScriptController::writeBytecodeHeader(lua_State* state, const void* data, size_t size, void* userData)
+{
+    std::string* header = (std::string*)userData;
+    size_t count = std::min(size, (size_t)SCRIPT_BYTECODE_HEADER_SIZE - header->size());
+    header->append((const char*)data, count);
+    return 0;
+}
+
+int ScriptController::panic(lua_State* state)
+{
+    GP_ERROR("Unprotected error in Lua: %s", lua_tostring(state, -1));
+    return 0;
+}
+
 void ScriptController::schedule(float timeOffset, const char* function)
 {
     // Get the currently execute script
@@ -1483,7 +1935,7 @@ template<> bool ScriptController::executeFunction<std::string>(Script* script, c
 
 void ScriptUtil::registerLibrary(const char* name, const luaL_Reg* functions)
 {
-    ScriptController* sc = Game::getInstance()->getScriptController();
+    ScriptController* sc = getRegisteringController();
     lua_newtable(sc->_lua);
 
     // Go through the list of functions and add them to the table.
@@ -1499,7 +1951,7 @@ void ScriptUtil::registerLibrary(const char* name, const luaL_Reg* functions)
 
 void ScriptUtil::registerConstantBool(const std::string& name, bool value, const std::vector<std::string>& scopePath)
 {
-    ScriptController* sc = Game::getInstance()->getScriptController();
+    ScriptController* sc = getRegisteringController();
 
     // If the constant is within a scope, get the correct parent 
     // table on the stack before setting its value.
@@ -1532,7 +1984,7 @@ void ScriptUtil::registerConstantBool(const std::string& name, bool value, const
 
 void ScriptUtil::registerConstantNumber(const std::string& name, double value, const std::vector<std::string>& scopePath)
 {
-    ScriptController* sc = Game::getInstance()->getScriptController();
+    ScriptController* sc = getRegisteringController();
 
     // If the constant is within a scope, get the correct parent 
     // table on the stack before setting its value.
@@ -1565,7 +2017,7 @@ void ScriptUtil::registerConstantNumber(const std::string& name, double value, c
 
 void ScriptUtil::registerConstantString(const std::string& name, const std::string& value, const std::vector<std::string>& scopePath)
 {
-    ScriptController* sc = Game::getInstance()->getScriptController();
+    ScriptController* sc = getRegisteringController();
 
     // If the constant is within a scope, get the correct parent 
     // table on the stack before setting its value.
@@ -1598,7 +2050,7 @@ void ScriptUtil::registerConstantString(const std::string& name, const std::stri
 
 void ScriptUtil::registerEnumValue(int enumValue, const std::string& enumValueString, const std::vector<std::string>& scopePath)
 {
-    ScriptController* sc = Game::getInstance()->getScriptController();
+    ScriptController* sc = getRegisteringController();
 
     // If the constant is within a scope, get the correct parent 
     // table on the stack before setting its value.
@@ -1632,7 +2084,7 @@ void ScriptUtil::registerEnumValue(int enumValue, const std::string& enumValueSt
 void ScriptUtil::registerClass(const char* name, const luaL_Reg* members, lua_CFunction newFunction,
     lua_CFunction deleteFunction, const luaL_Reg* statics, const std::vector<std::string>& scopePath)
 {
-    ScriptController* sc = Game::getInstance()->getScriptController();
+    ScriptController* sc = getRegisteringController();
 
     // If the type is an inner type, get the correct parent 
     // table on the stack before creating the table for the class.
@@ -1719,8 +2171,9 @@ void ScriptUtil::registerClass(const char* name, const luaL_Reg* members, lua_CF
 
 void ScriptUtil::registerFunction(const char* luaFunction, lua_CFunction cppFunction)
 {
-    lua_pushcfunction(Game::getInstance()->getScriptController()->_lua, cppFunction);
-    lua_setglobal(Game::getInstance()->getScriptController()->_lua, luaFunction);
+    ScriptController* sc = getRegisteringController();
+    lua_pushcfunction(sc->_lua, cppFunction);
+    lua_setglobal(sc->_lua, luaFunction);
 }
 
 ScriptUtil::LuaArray<bool> ScriptUtil::getBoolPointer(int index)
@@ -1795,45 +2248,57 @@ void* ScriptUtil::getUserDataObjectPointer(int index, const char* type)
     // Push metatable for the specified type.
     luaL_getmetatable(sc->_lua, type);
 
-    // If the metatables are equal, the object is exactly the type specified
+    // If the metatables are equal, the object is exactly the type specified.
     if (lua_rawequal(sc->_lua, -1, -2))
     {
-        // Found a match : pop both metatables.
         lua_pop(sc->_lua, 2);
-
-        // Return the address as-is
         return ((ScriptUtil::LuaObject*)p)->instance;
     }
 
-    // Pop metatable for the given type : instead, we'll check other types
-    // in the inheritance tree of the type.
+    // Pop metatable for the given type.
     lua_pop(sc->_lua, 1);
 
-    const std::vector<std::string>& types = luaGetClassRelatives(type);
-    for (size_t i = 0, count = types.size(); i < count; i++)
+    // Class metatables live in the registry until the state is closed, so the relation between
+    // an object's metatable and a related type only has to be resolved the first time it is checked.
+    ScriptController::UserDataKey key = { lua_topointer(sc->_lua, -1), type };
+    std::unordered_map<ScriptController::UserDataKey, ScriptController::UserDataMatch, ScriptController::UserDataKeyHash>::const_iterator itr =
+        sc->_userDataMatches.find(key);
+    if (itr == sc->_userDataMatches.end())
     {
-        const std::string& relatedType = types[i];
+        ScriptController::UserDataMatch match = { false, NULL };
 
-        // Push relative type metatable
-        luaL_getmetatable(sc->_lua, relatedType.c_str());
-
-        // Compare the object's metatable to this relative's metatable
-        if (lua_rawequal(sc->_lua, -1, -2))
+        // Check the other types in the inheritance tree of the type.
+        const std::vector<std::string>& types = luaGetClassRelatives(type);
+        for (size_t i = 0, count = types.size(); i < count; i++)
         {
-            // Found a match : pop both metatables.
-            lua_pop(sc->_lua, 2);
+            // Push relative type metatable
+            luaL_getmetatable(sc->_lua, types[i].c_str());
+
+            // Compare the object's metatable to this relative's metatable
+            bool equal = lua_rawequal(sc->_lua, -1, -2) != 0;
+
+            // Pop relative type metatable
+            lua_pop(sc->_lua, 1);
 
-            // Need to convert the raw userdata pointer to a valid object pointer of the given type
-            return luaConvertObjectPointer(((ScriptUtil::LuaObject*)p)->instance, relatedType.c_str(), type);
+            if (equal)
+            {
+                match.matches = true;
+                match.relatedType = types[i].c_str();
+                break;
+            }
         }
-        // Pop relative type metatable
-        lua_pop(sc->_lua, 1);
+
+        itr = sc->_userDataMatches.insert(std::make_pair(key, match)).first;
     }
 
     // Pop metatable of userdata object
     lua_pop(sc->_lua, 1);
 
-    return NULL;
+    if (!itr->second.matches)
+        return NULL;
+
+    // Convert the raw userdata pointer to a valid object pointer of the given type.
+    return luaConvertObjectPointer(((ScriptUtil::LuaObject*)p)->instance, itr->second.relatedType, type);
 }
 
 const char* ScriptUtil::getString(int index, bool isStdString)
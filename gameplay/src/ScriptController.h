@@ -2,6 +2,7 @@
 #define SCRIPTCONTROLLER_H_
 
 #include "Script.h"
+#include "ScriptFunction.h"
 #include "Game.h"
 
 namespace gameplay
@@ -17,6 +18,7 @@ class ScriptController
     friend class Script;
     friend class ScriptUtil;
     friend class ScriptTimeListener;
+    friend class ScriptFunction;
 
 public:
 
@@ -181,6 +183,73 @@ public:
      */
     template<typename T> bool executeFunction(Script* script, const char* func, const char* args, T* out, va_list* list);
 
+    /**
+     * Resolves a function by name into a handle that can be called without looking the name up again.
+     *
+     * @param func The name of the function, which may be a '.' separated path of nested tables.
+     * @param function The handle to populate.
+     * @param script Optional script to resolve the function in, or NULL for the global environment.
+     *      The script must outlive the handle.
+     *
+     * @return True if the function was found, false otherwise (in which case the handle is reset).
+     *
+     * @script{ignore}
+     */
+    bool resolveFunction(const char* func, ScriptFunction* function, Script* script = NULL);
+
+    /**
+     * Calls a resolved zero-parameter function.
+     *
+     * @param function The function to call.
+     * @param out Pointer to populate with the boolean return value if the function succeeds, or NULL.
+     *
+     * @return True if the function is successfully executed, false otherwise.
+     *
+     * @script{ignore}
+     */
+    bool executeFunction(const ScriptFunction& function, bool* out = NULL);
+
+    /**
+     * Calls a resolved function that takes a single number parameter.
+     *
+     * @param function The function to call.
+     * @param arg The argument to pass.
+     * @param out Pointer to populate with the boolean return value if the function succeeds, or NULL.
+     *
+     * @return True if the function is successfully executed, false otherwise.
+     *
+     * @script{ignore}
+     */
+    bool executeFunction(const ScriptFunction& function, float arg, bool* out = NULL);
+
+    /**
+     * Calls a resolved function that takes two integer parameters.
+     *
+     * @param function The function to call.
+     * @param arg1 The first argument to pass.
+     * @param arg2 The second argument to pass.
+     * @param out Pointer to populate with the boolean return value if the function succeeds, or NULL.
+     *
+     * @return True if the function is successfully executed, false otherwise.
+     *
+     * @script{ignore}
+     */
+    bool executeFunction(const ScriptFunction& function, int arg1, int arg2, bool* out = NULL);
+
+    /**
+     * Calls a resolved function using the given parameters.
+     *
+     * @param function The function to call.
+     * @param args The argument signature of the function (as in executeFunction(const char*, const char*, T*, ...)).
+     * @param out Pointer to populate with the boolean return value if the function succeeds, or NULL.
+     * @param list The variable argument list.
+     *
+     * @return True if the function is successfully executed, false otherwise.
+     *
+     * @script{ignore}
+     */
+    bool executeFunction(const ScriptFunction& function, const char* args, bool* out, va_list* list);
+
     /**
      * Gets the global boolean script variable with the given name.
      * 
@@ -525,6 +594,107 @@ public:
      */
     Script* getCurrentScript() const;
 
+    /**
+     * Starts a coroutine that runs a script function on the coroutine scheduler.
+     *
+     * The coroutine runs until it first waits. Coroutines started this way can suspend
+     * themselves by calling the global script functions wait(seconds), waitFrames(count)
+     * and waitFor(signal), after which the scheduler resumes them once per frame when
+     * they are ready. A plain coroutine.yield() resumes in the next frame. Scripts start
+     * coroutines with startCoroutine(function, ...), and raise signals with notify(signal).
+     *
+     * Coroutines are resumed after the script update event of each frame while the game
+     * is running, so waiting in game time stops while the game is paused.
+     *
+     * @param func The name of the function to run.
+     * @param script Optional script to run the function from, or NULL for the global environment.
+     *
+     * @return True if the coroutine was started, false if the function was not found.
+     *
+     * @script{ignore}
+     */
+    bool startCoroutine(const char* func, Script* script = NULL);
+
+    /**
+     * Raises a signal, making the coroutines that wait for it with waitFor ready to resume.
+     *
+     * @param signal The name of the signal.
+     */
+    void notifyCoroutines(const char* signal);
+
+    /**
+     * Gets the number of coroutines on the scheduler that have not completed.
+     *
+     * @return The number of coroutines.
+     */
+    unsigned int getCoroutineCount() const;
+
+    /**
+     * Sets the time budget for resuming coroutines in each frame.
+     *
+     * Once the budget is spent, ready coroutines that were not resumed in a frame are
+     * resumed first in the next one, so heavy script work spreads over several frames.
+     * A coroutine that is running is never interrupted, so the budget can be exceeded by
+     * the last one resumed.
+     *
+     * The budget can also be set with the scriptCoroutineBudget property of the game config.
+     *
+     * @param milliseconds The time budget in milliseconds, or zero to resume all ready coroutines.
+     */
+    void setCoroutineBudget(float milliseconds);
+
+    /**
+     * Gets the time budget for resuming coroutines in each frame.
+     *
+     * @return The time budget in milliseconds, or zero if all ready coroutines are resumed.
+     */
+    float getCoroutineBudget() const;
+
+    /**
+     * Sets the time budget for incremental garbage collection in each frame.
+     *
+     * By default Lua collects garbage as it allocates memory, so a large collection step
+     * can stall whichever script happens to trigger it in the middle of a frame. With a
+     * budget, automatic collection is stopped and the game instead runs incremental steps
+     * at the end of each frame, until the budget is spent or the collection cycle completes.
+     * If the steps fall far behind the allocations (the memory in use has doubled since the
+     * last completed cycle), the cycle is completed regardless of the budget.
+     *
+     * The budget can also be set with the scriptGarbageCollectionBudget property of the game config.
+     *
+     * @param milliseconds The time budget in milliseconds, or zero to collect garbage automatically.
+     */
+    void setGarbageCollectionBudget(float milliseconds);
+
+    /**
+     * Gets the time budget for incremental garbage collection in each frame.
+     *
+     * @return The time budget in milliseconds, or zero if garbage is collected automatically.
+     */
+    float getGarbageCollectionBudget() const;
+
+    /**
+     * Gets the number of bytes of memory currently allocated by Lua.
+     *
+     * @return The memory in use, in bytes.
+     */
+    size_t getMemoryUsage() const;
+
+    /**
+     * Gets the number of memory allocations made by Lua since scripting was initialized.
+     *
+     * @return The number of allocations.
+     */
+    unsigned int getAllocationCount() const;
+
+    /**
+     * Gets the number of bytes allocated by Lua since scripting was initialized,
+     * including memory that has since been freed.
+     *
+     * @return The number of bytes allocated.
+     */
+    size_t getAllocatedBytes() const;
+
     /**
      * Prints the string to the platform's output stream or log file.
      * Used for overriding Lua's print function.
@@ -655,6 +825,112 @@ private:
      */
     bool executeFunctionHelper(int resultCount, const char* func, const char* args, va_list* list, Script* script = NULL);
 
+    /**
+     * Pushes the arguments described by an argument signature onto the Lua stack.
+     *
+     * @param args The argument signature (see executeFunctionHelper).
+     * @param list The variable argument list.
+     *
+     * @return The number of arguments pushed.
+     */
+    int pushArguments(const char* args, va_list* list);
+
+    /**
+     * Pushes a resolved function onto the Lua stack.
+     *
+     * @param function The function to push.
+     *
+     * @return True if the function was pushed, false if the handle is invalid or scripting is finalized.
+     */
+    bool pushFunction(const ScriptFunction& function);
+
+    /**
+     * Calls a resolved function pushed by pushFunction along with its arguments, and pops the result.
+     *
+     * @param function The function being called.
+     * @param argumentCount The number of arguments pushed after the function.
+     * @param out Pointer to populate with the boolean return value if the function succeeds, or NULL.
+     *
+     * @return True if the function is successfully executed, false otherwise.
+     */
+    bool callFunction(const ScriptFunction& function, int argumentCount, bool* out);
+
+    /**
+     * Calls the function pushed with its arguments in protected mode, adding the
+     * execution time and allocations of the call to the script's statistics.
+     *
+     * @param script The script the function belongs to, or NULL.
+     * @param argumentCount The number of arguments pushed after the function.
+     * @param resultCount The number of results to keep on the stack.
+     *
+     * @return True if the call succeeded, false if it raised an error (which is left on the stack).
+     */
+    bool pcall(Script* script, int argumentCount, int resultCount);
+
+    /**
+     * Starts a coroutine running the function below its arguments on the top of the stack
+     * (which are popped), and runs it until it first waits.
+     */
+    void startCoroutine(lua_State* state, int argumentCount, Script* script);
+
+    /**
+     * Resumes a coroutine until it waits or completes.
+     *
+     * @return True if the coroutine is waiting, false if it completed or failed.
+     */
+    bool resumeCoroutine(Coroutine* coroutine, int argumentCount);
+
+    /**
+     * Removes a coroutine from the scheduler and frees it.
+     */
+    void removeCoroutine(Coroutine* coroutine);
+
+    /**
+     * Gets the scheduled coroutine running on the given thread, raising a Lua error from
+     * the calling function if the thread is not one.
+     */
+    Coroutine* getRunningCoroutine(lua_State* state, const char* function);
+
+    /**
+     * Resumes the ready coroutines within the budget. Called by Game each frame.
+     */
+    void updateCoroutines();
+
+    /**
+     * Script functions of the coroutine scheduler.
+     */
+    static int luaStartCoroutine(lua_State* state);
+    static int luaWait(lua_State* state);
+    static int luaWaitFrames(lua_State* state);
+    static int luaWaitFor(lua_State* state);
+    static int luaNotify(lua_State* state);
+
+    /**
+     * Runs the incremental garbage collection steps of a frame within the budget.
+     * Called by Game at the end of each frame.
+     */
+    void collectGarbage();
+
+    /**
+     * Allocates, resizes or frees memory for Lua, tracking the allocation counters.
+     */
+    static void* allocate(void* userData, void* ptr, size_t oldSize, size_t newSize);
+
+    /**
+     * Determines if a chunk is either source text or bytecode compiled for this version of Lua and platform.
+     */
+    bool isCompatibleBytecode(const char* chunk, int size) const;
+
+    /**
+     * Collects the bytecode header written by lua_dump into a string.
+     */
+    static int writeBytecodeHeader(lua_State* state, const void* data, size_t size, void* userData);
+
+    /**
+     * Reports errors raised outside of protected calls.
+     */
+    static int panic(lua_State* state);
+
     /**
      * Converts a Gameplay userdata value to the type with the given class name.
      * This function will change the metatable of the userdata value to the metatable that matches the given string.
@@ -695,11 +971,69 @@ private:
 
     void popScript();
 
+    /**
+     * A coroutine on the scheduler.
+     */
+    struct Coroutine
+    {
+        lua_State* thread;
+        int ref;                    // Registry reference keeping the thread alive
+        Script* script;             // Script environment the coroutine runs in, or NULL
+        double wakeTime;            // Game time to resume at, in milliseconds
+        unsigned int wakeFrame;     // Frame number to resume at
+        std::string signal;         // Signal the coroutine waits for, or empty
+    };
+
+    /**
+     * How the metatable of a userdata object relates to a requested type.
+     */
+    struct UserDataMatch
+    {
+        bool matches;               // Whether the object can be used as the requested type
+        const char* relatedType;    // The object's type if it must be converted to the requested type
+    };
+
+    /**
+     * Identifies a type check by the metatable of the object and the name of the requested type.
+     *
+     * Bindings request types with string literals, so the address of the name identifies it
+     * without comparing strings. A name at another address gets an entry of its own.
+     */
+    struct UserDataKey
+    {
+        const void* metatable;
+        const char* type;
+
+        bool operator==(const UserDataKey& key) const { return metatable == key.metatable && type == key.type; }
+    };
+
+    /**
+     * Hashes the keys of the type checks.
+     */
+    struct UserDataKeyHash
+    {
+        size_t operator()(const UserDataKey& key) const
+        {
+            return std::hash<const void*>()(key.metatable) ^ (std::hash<const void*>()(key.type) * 31);
+        }
+    };
+
     lua_State* _lua;
     unsigned int _returnCount;
     std::map<std::string, std::vector<Script*> > _scripts;
     std::vector<Script*> _envStack;
     std::list<ScriptTimeListener*> _timeListeners;
+    std::unordered_map<UserDataKey, UserDataMatch, UserDataKeyHash> _userDataMatches;  // Type checks of objects that are not exactly the requested type
+    float _gcBudget;                // Milliseconds of garbage collection per frame, or zero for automatic collection
+    size_t _gcCycleMemory;          // Memory in use when the last collection cycle completed
+    size_t _memoryUsage;
+    unsigned int _allocationCount;
+    size_t _allocatedBytes;
+    unsigned int _frameAllocationCount; // Allocation count at the end of the last frame
+    std::string _bytecodeHeader;        // Header that precompiled scripts must start with
+    std::list<Coroutine*> _coroutines;  // Scheduled coroutines, in the order they are resumed
+    Coroutine* _runningCoroutine;
+    float _coroutineBudget;             // Milliseconds of coroutine resumes per frame, or zero for no limit
 };
 
 /** Template specialization. */
@@ -1131,6 +1465,21 @@ public:
     template <typename T>
     static LuaArray<T> getObjectPointer(int index, const char* type, bool nonNull, bool* success);
 
+    /**
+     * Pushes a copy of an object onto the stack, stored inline in its userdata block.
+     *
+     * This is used for small value types such as vectors and matrices, so that returning
+     * them to Lua does not allocate a separate C++ object. The copy is released along with
+     * the userdata and its destructor is never called, so the type must not own any resources.
+     *
+     * @param type The type of the object (the name of its metatable).
+     * @param value The object to copy.
+     *
+     * @return A pointer to the copy of the object.
+     */
+    template <typename T>
+    static T* pushValueObject(const char* type, const T& value);
+
     /**
      * Gets a raw pointer that points to the correct address for the given type interface.
      *
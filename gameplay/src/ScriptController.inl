@@ -161,6 +161,23 @@ ScriptUtil::LuaArray<T> ScriptUtil::getObjectPointer(int index, const char* type
     return LuaArray<T>((T*)p);
 }
 
+template<typename T>
+T* ScriptUtil::pushValueObject(const char* type, const T& value)
+{
+    lua_State* state = Game::getInstance()->getScriptController()->_lua;
+
+    // Construct the copy directly after the LuaObject in the same userdata block.
+    // It is not owned, since there is nothing to delete when the userdata is collected.
+    LuaObject* object = (LuaObject*)lua_newuserdata(state, sizeof(LuaObject) + sizeof(T));
+    T* instance = new (object + 1) T(value);
+    object->instance = instance;
+    object->owns = false;
+    luaL_getmetatable(state, type);
+    lua_setmetatable(state, -2);
+
+    return instance;
+}
+
 template<typename T> bool ScriptController::executeFunction(const char* func, T* out)
 {
     return executeFunction<T>((Script*)NULL, func, out);
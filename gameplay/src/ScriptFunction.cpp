@@ -0,0 +1,62 @@
+#include "Base.h"
+#include "ScriptFunction.h"
+#include "ScriptController.h"
+
+namespace gameplay
+{
+
+ScriptFunction::ScriptFunction() : _ref(LUA_NOREF), _script(NULL)
+{
+}
+
+ScriptFunction::ScriptFunction(const ScriptFunction& copy) : _ref(LUA_NOREF), _script(NULL)
+{
+    *this = copy;
+}
+
+ScriptFunction::~ScriptFunction()
+{
+    reset();
+}
+
+ScriptFunction& ScriptFunction::operator=(const ScriptFunction& copy)
+{
+    if (this != &copy)
+    {
+        reset();
+
+        // Take a registry reference of our own so each handle can be released independently.
+        Game* game = Game::getInstance();
+        lua_State* lua = game && game->getScriptController() ? game->getScriptController()->_lua : NULL;
+        if (lua && copy.isValid())
+        {
+            lua_rawgeti(lua, LUA_REGISTRYINDEX, copy._ref);
+            _ref = luaL_ref(lua, LUA_REGISTRYINDEX);
+            _script = copy._script;
+            _name = copy._name;
+        }
+    }
+    return *this;
+}
+
+bool ScriptFunction::isValid() const
+{
+    return _ref != LUA_NOREF && _ref != LUA_REFNIL;
+}
+
+void ScriptFunction::reset()
+{
+    if (isValid())
+    {
+        // References die with the Lua state, so there is nothing to release once scripting is finalized.
+        Game* game = Game::getInstance();
+        lua_State* lua = game && game->getScriptController() ? game->getScriptController()->_lua : NULL;
+        if (lua)
+            luaL_unref(lua, LUA_REGISTRYINDEX, _ref);
+    }
+    _ref = LUA_NOREF;
+    _script = NULL;
+    _name.clear();
+}
+
+}
@@ -0,0 +1,75 @@
+#ifndef SCRIPTFUNCTION_H_
+#define SCRIPTFUNCTION_H_
+
+#include "Base.h"
+
+namespace gameplay
+{
+
+class Script;
+
+/**
+ * Defines a handle to a script function that has been resolved into a Lua registry reference.
+ *
+ * Calling a function through a handle skips the name lookup that is otherwise done on every
+ * call, so handles should be used for functions that are called frequently. A handle refers to
+ * the function that the name resolved to, so redefining the function in script afterwards does
+ * not affect it.
+ *
+ * @see ScriptController::resolveFunction
+ * @script{ignore}
+ */
+class ScriptFunction
+{
+    friend class ScriptController;
+
+public:
+
+    /**
+     * Constructor, which creates an unresolved handle.
+     */
+    ScriptFunction();
+
+    /**
+     * Copy constructor, which references the same function as the given handle.
+     *
+     * @param copy The handle to copy.
+     */
+    ScriptFunction(const ScriptFunction& copy);
+
+    /**
+     * Destructor.
+     */
+    ~ScriptFunction();
+
+    /**
+     * Assignment operator, which references the same function as the given handle.
+     *
+     * @param copy The handle to copy.
+     *
+     * @return This handle.
+     */
+    ScriptFunction& operator=(const ScriptFunction& copy);
+
+    /**
+     * Determines whether this handle refers to a function.
+     *
+     * @return True if the handle has been resolved to a function, false otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * Releases the function referenced by this handle.
+     */
+    void reset();
+
+private:
+
+    int _ref;
+    Script* _script;
+    std::string _name;
+};
+
+}
+
+#endif
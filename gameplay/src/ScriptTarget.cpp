@@ -19,6 +19,16 @@ const char* ScriptTarget::Event::getArgs() const
     return args.c_str();
 }
 
+const Script::Statistics& ScriptTarget::Event::getStatistics() const
+{
+    return statistics;
+}
+
+void ScriptTarget::Event::resetStatistics() const
+{
+    statistics = Script::Statistics();
+}
+
 ScriptTarget::EventRegistry::EventRegistry()
 {
 }
@@ -414,6 +424,48 @@ bool ScriptTarget::hasScriptListener(const Event* event) const
     return false;
 }
 
+bool ScriptTarget::executeCallback(ScriptController* sc, CallbackFunction& cb, const Event* event, bool* out, va_list list)
+{
+    GP_PROFILE_SCOPE(event->name.c_str());
+
+    double start = Game::getAbsoluteTime();
+    unsigned int allocationCount = sc->getAllocationCount();
+    size_t allocatedBytes = sc->getAllocatedBytes();
+
+    if (!cb.resolved.isValid())
+        sc->resolveFunction(cb.function.c_str(), &cb.resolved, cb.script);
+
+    // Each callback reads the arguments from the start, so it gets its own copy of the list.
+    va_list args;
+    va_copy(args, list);
+    bool success;
+    if (!cb.resolved.isValid())
+    {
+        // Fall back to calling by name, which reports the missing function.
+        if (out)
+            success = sc->executeFunction<bool>(cb.script, cb.function.c_str(), event->args.c_str(), out, &args);
+        else
+            success = sc->executeFunction<void>(cb.script, cb.function.c_str(), event->args.c_str(), NULL, &args);
+    }
+    else if (event->args.empty())
+    {
+        success = sc->executeFunction(cb.resolved, out);
+    }
+    else if (event->args == "f")
+    {
+        // The signature of the per-frame update and render events.
+        success = sc->executeFunction(cb.resolved, (float)va_arg(args, double), out);
+    }
+    else
+    {
+        success = sc->executeFunction(cb.resolved, event->args.c_str(), out, &args);
+    }
+    va_end(args);
+
+    event->statistics.add(Game::getAbsoluteTime() - start, sc->getAllocationCount() - allocationCount, sc->getAllocatedBytes() - allocatedBytes);
+    return success;
+}
+
 template<> void ScriptTarget::fireScriptEvent<void>(const Event* event, ...)
 {
     GP_ASSERT(event);
@@ -433,7 +485,7 @@ template<> void ScriptTarget::fireScriptEvent<void>(const Event* event, ...)
         for (size_t i = 0, count = callbacks.size(); i < count; ++i)
         {
             CallbackFunction& cb = callbacks[i];
-            sc->executeFunction<void>(cb.script, cb.function.c_str(), event->args.c_str(), NULL, &list);
+            executeCallback(sc, cb, event, NULL, list);
         }
     }
 
@@ -460,7 +512,7 @@ template<> bool ScriptTarget::fireScriptEvent<bool>(const Event* event, ...)
         {
             CallbackFunction& cb = callbacks[i];
             bool result = false;
-            if (sc->executeFunction<bool>(cb.script, cb.function.c_str(), event->args.c_str(), &result, &list) && result)
+            if (executeCallback(sc, cb, event, &result, list) && result)
             {
                 // Handled, break out early
                 va_end(list);
@@ -2,10 +2,13 @@
 #define SCRIPTTARGET_H_
 
 #include "Script.h"
+#include "ScriptFunction.h"
 
 namespace gameplay
 {
 
+class ScriptController;
+
 /**
  * Macro to indidate the start of script event definitions for a class.
  *
@@ -135,6 +138,19 @@ public:
          */
         const char* getArgs() const;
 
+        /**
+         * Gets the execution statistics of the script callbacks of this event,
+         * accumulated over all script targets that fire it.
+         *
+         * @return The execution statistics of this event.
+         */
+        const Script::Statistics& getStatistics() const;
+
+        /**
+         * Resets the execution statistics of this event.
+         */
+        void resetStatistics() const;
+
     private:
 
         /**
@@ -148,6 +164,11 @@ public:
          */
         std::string args;
 
+        /**
+         * The execution statistics of the callbacks of the event.
+         */
+        mutable Script::Statistics statistics;
+
     };
 
     /**
@@ -359,6 +380,8 @@ protected:
         Script* script;
         /** The function within the script to call. */
         std::string function;
+        /** The function resolved on first use, so later events skip the name lookup. */
+        ScriptFunction resolved;
 
         /**
          * The callback function to registry script function to.
@@ -406,6 +429,13 @@ protected:
     ScriptEntry* _scripts;
     /** Holds the list of callback functions registered for this ScriptTarget. */
     std::map<const Event*, std::vector<CallbackFunction> >* _scriptCallbacks;
+
+private:
+
+    /**
+     * Calls a callback function for an event, resolving it on first use.
+     */
+    bool executeCallback(ScriptController* sc, CallbackFunction& cb, const Event* event, bool* out, va_list list);
 };
 
 /**
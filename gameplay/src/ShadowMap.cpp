@@ -0,0 +1,580 @@
+#include "Base.h"
+#include "ShadowMap.h"
+#include "Camera.h"
+#include "Effect.h"
+#include "FrameStats.h"
+#include "Frustum.h"
+#include "Game.h"
+#include "GLStateCache.h"
+#include "Light.h"
+#include "MaterialParameter.h"
+#include "Mesh.h"
+#include "MeshPart.h"
+#include "MeshSkin.h"
+#include "Model.h"
+#include "Node.h"
+#include "Scene.h"
+#include "VertexAttributeBinding.h"
+
+// Most cascades of a directional light, which is the number of splits a vec4 holds.
+#define SHADOW_MAX_CASCADES 4
+
+// Fraction of the radius of its view that a cascade is grown by, so the camera can move
+// within it before the static casters have to be drawn again.
+#define SHADOW_CASCADE_MARGIN 0.25f
+
+// Weight of the logarithmic over the uniform split of the view into cascades.
+#define SHADOW_CASCADE_SPLIT_LAMBDA 0.75f
+
+// Number of frames a vertex attribute binding may be unused before it is released.
+#define SHADOW_BINDING_LIFETIME 60
+
+namespace gameplay
+{
+
+static unsigned int __shadowMapCount = 0;
+
+ShadowMap::ShadowMap(Light* light, unsigned int size, unsigned int cascadeCount)
+    : _light(light), _size(size), _cascadeCount(cascadeCount), _distance(100.0f), _casterDistance(50.0f), _bias(0.002f),
+      _lightRange(0.0f), _lightOuterAngle(0.0f), _staticCasterCount(0), _dynamicCasterCount(0),
+      _staticUpdateCount(0), _frame(0), _staticBuffer(NULL), _dynamicBuffer(NULL), _staticSampler(NULL), _dynamicSampler(NULL), _stateBlock(NULL)
+{
+    GP_ASSERT(_light);
+    _light->addRef();
+
+    _cascades.resize(_cascadeCount);
+    for (unsigned int i = 0; i < _cascadeCount; ++i)
+    {
+        _cascades[i].extent = 0.0f;
+        _cascades[i].valid = false;
+        _cascades[i].dirty = true;
+    }
+    _matrices.resize(_cascadeCount);
+    _parameters.set(1.0f / (_size * _cascadeCount), 1.0f / _size, _bias, (float)_cascadeCount);
+}
+
+ShadowMap::~ShadowMap()
+{
+    for (std::map<std::pair<Mesh*, Effect*>, Binding>::iterator itr = _bindings.begin(); itr != _bindings.end(); ++itr)
+    {
+        SAFE_RELEASE(itr->second.binding);
+    }
+    _bindings.clear();
+    for (std::map<unsigned int, Effect*>::iterator itr = _effects.begin(); itr != _effects.end(); ++itr)
+    {
+        SAFE_RELEASE(itr->second);
+    }
+    _effects.clear();
+
+    SAFE_RELEASE(_stateBlock);
+    SAFE_RELEASE(_staticSampler);
+    SAFE_RELEASE(_dynamicSampler);
+    SAFE_RELEASE(_staticBuffer);
+    SAFE_RELEASE(_dynamicBuffer);
+    SAFE_RELEASE(_light);
+}
+
+ShadowMap* ShadowMap::create(Light* light, unsigned int size, unsigned int cascadeCount)
+{
+    GP_ASSERT(light);
+    GP_ASSERT(size > 0);
+
+    if (light->getLightType() == Light::POINT)
+    {
+        GP_ERROR("Shadow maps are only supported for directional and spot lights.");
+        return NULL;
+    }
+    if (light->getLightType() == Light::SPOT)
+        cascadeCount = 1;
+    cascadeCount = std::min(std::max(cascadeCount, 1u), (unsigned int)SHADOW_MAX_CASCADES);
+
+    ShadowMap* shadowMap = new ShadowMap(light, size, cascadeCount);
+    if (!shadowMap->initialize())
+    {
+        GP_ERROR("Failed to initialize shadow map.");
+        SAFE_DELETE(shadowMap);
+    }
+    return shadowMap;
+}
+
+// Creates a frame buffer with a depth texture for the cascades of a shadow map laid out side by side.
+static FrameBuffer* createDepthBuffer(const char* name, unsigned int width, unsigned int height, Texture::Sampler** sampler)
+{
+    char id[64];
+    sprintf(id, "org.gameplay3d.shadowmap.%s.%u", name, __shadowMapCount);
+    FrameBuffer* frameBuffer = FrameBuffer::create(id, width, height, Texture::DEPTH);
+    if (frameBuffer == NULL)
+        return NULL;
+
+    RenderTarget* renderTarget = frameBuffer->getRenderTarget();
+    GP_ASSERT(renderTarget && renderTarget->getTexture());
+    *sampler = Texture::Sampler::create(renderTarget->getTexture());
+    (*sampler)->setFilterMode(Texture::NEAREST, Texture::NEAREST);
+    (*sampler)->setWrapMode(Texture::CLAMP, Texture::CLAMP);
+    return frameBuffer;
+}
+
+bool ShadowMap::initialize()
+{
+    ++__shadowMapCount;
+    _staticBuffer = createDepthBuffer("static", _size * _cascadeCount, _size, &_staticSampler);
+    _dynamicBuffer = createDepthBuffer("dynamic", _size * _cascadeCount, _size, &_dynamicSampler);
+    if (_staticBuffer == NULL || _dynamicBuffer == NULL)
+        return false;
+
+    _stateBlock = RenderState::StateBlock::create();
+    _stateBlock->setDepthTest(true);
+    _stateBlock->setDepthWrite(true);
+    _stateBlock->setDepthFunction(RenderState::DEPTH_LESS);
+    _stateBlock->setCullFace(true);
+    _stateBlock->setBlend(false);
+
+    return getEffect(0) != NULL;
+}
+
+Light* ShadowMap::getLight() const
+{
+    return _light;
+}
+
+unsigned int ShadowMap::getSize() const
+{
+    return _size;
+}
+
+unsigned int ShadowMap::getCascadeCount() const
+{
+    return _cascadeCount;
+}
+
+void ShadowMap::setDistance(float distance)
+{
+    _distance = std::max(distance, 0.0f);
+}
+
+float ShadowMap::getDistance() const
+{
+    return _distance;
+}
+
+void ShadowMap::setCasterDistance(float distance)
+{
+    if (distance != _casterDistance)
+    {
+        _casterDistance = std::max(distance, 0.0f);
+        invalidate();
+    }
+}
+
+float ShadowMap::getCasterDistance() const
+{
+    return _casterDistance;
+}
+
+void ShadowMap::setBias(float bias)
+{
+    _bias = bias;
+    _parameters.z = bias;
+}
+
+float ShadowMap::getBias() const
+{
+    return _bias;
+}
+
+void ShadowMap::invalidate()
+{
+    for (unsigned int i = 0; i < _cascadeCount; ++i)
+    {
+        _cascades[i].valid = false;
+        _cascades[i].dirty = true;
+    }
+}
+
+void ShadowMap::checkLight()
+{
+    Node* lightNode = _light->getNode();
+    GP_ASSERT(lightNode);
+
+    const Matrix& world = lightNode->getWorldMatrix();
+    float range = 0.0f;
+    float outerAngle = 0.0f;
+    if (_light->getLightType() == Light::SPOT)
+    {
+        range = _light->getRange();
+        outerAngle = _light->getOuterAngle();
+    }
+
+    if (memcmp(world.m, _lightWorldMatrix.m, sizeof(world.m)) != 0 || range != _lightRange || outerAngle != _lightOuterAngle)
+    {
+        _lightWorldMatrix = world;
+        _lightRange = range;
+        _lightOuterAngle = outerAngle;
+        invalidate();
+    }
+}
+
+void ShadowMap::updateDirectionalCascades(Camera* camera)
+{
+    Node* lightNode = _light->getNode();
+    Matrix lightView;
+    Matrix::createLookAt(Vector3::zero(), lightNode->getForwardVectorWorld(), lightNode->getUpVectorWorld(), &lightView);
+
+    const bool perspective = camera->getCameraType() == Camera::PERSPECTIVE;
+    const float tanHalfAngle = tan(MATH_DEG_TO_RAD(camera->getFieldOfView()) * 0.5f);
+    const float nearPlane = camera->getNearPlane();
+    const float farPlane = _distance > 0.0f ? std::min(_distance, camera->getFarPlane()) : camera->getFarPlane();
+    const Matrix& cameraWorld = camera->getNode()->getWorldMatrix();
+
+    float splits[SHADOW_MAX_CASCADES] = { farPlane, farPlane, farPlane, farPlane };
+    float sliceNear = nearPlane;
+    for (unsigned int i = 0; i < _cascadeCount; ++i)
+    {
+        // Blend a logarithmic and a uniform split, which keeps the texel density even
+        // without making the first cascades too small.
+        const float t = (float)(i + 1) / _cascadeCount;
+        const float uniformSplit = nearPlane + (farPlane - nearPlane) * t;
+        const float logSplit = nearPlane * pow(farPlane / nearPlane, t);
+        const float sliceFar = i + 1 == _cascadeCount ? farPlane : uniformSplit + (logSplit - uniformSplit) * SHADOW_CASCADE_SPLIT_LAMBDA;
+        splits[i] = sliceFar;
+
+        // The bounding sphere of the slice does not change as the camera turns, so the texels
+        // of the cascade keep their size. Its center is on the view axis, as close to being
+        // equally far from the corners of both planes of the slice as the slice allows.
+        float nearRadius2, farRadius2;
+        if (perspective)
+        {
+            const float aspect = camera->getAspectRatio();
+            nearRadius2 = sliceNear * sliceNear * tanHalfAngle * tanHalfAngle * (1.0f + aspect * aspect);
+            farRadius2 = sliceFar * sliceFar * tanHalfAngle * tanHalfAngle * (1.0f + aspect * aspect);
+        }
+        else
+        {
+            nearRadius2 = farRadius2 = (camera->getZoomX() * camera->getZoomX() + camera->getZoomY() * camera->getZoomY()) * 0.25f;
+        }
+        float centerDepth = (sliceFar * sliceFar + farRadius2 - sliceNear * sliceNear - nearRadius2) / (2.0f * (sliceFar - sliceNear));
+        centerDepth = std::min(std::max(centerDepth, sliceNear), sliceFar);
+        const float radius = sqrt(std::max((centerDepth - sliceNear) * (centerDepth - sliceNear) + nearRadius2,
+                                          (sliceFar - centerDepth) * (sliceFar - centerDepth) + farRadius2));
+        sliceNear = sliceFar;
+
+        Vector3 center;
+        cameraWorld.transformPoint(Vector3(0, 0, -centerDepth), &center);
+        lightView.transformPoint(&center);
+
+        // Keep the cascade while the view of the camera stays within it.
+        Cascade& cascade = _cascades[i];
+        if (cascade.valid &&
+            fabs(center.x - cascade.center.x) + radius <= cascade.extent &&
+            fabs(center.y - cascade.center.y) + radius <= cascade.extent &&
+            fabs(center.z - cascade.center.z) + radius <= cascade.extent)
+        {
+            continue;
+        }
+
+        // Snap the cascade to its texels so that the static shadows do not crawl when it moves.
+        const float extent = radius * (1.0f + SHADOW_CASCADE_MARGIN);
+        const float texelSize = 2.0f * extent / _size;
+        cascade.center.set(floor(center.x / texelSize) * texelSize, floor(center.y / texelSize) * texelSize, center.z);
+        cascade.extent = extent;
+        cascade.valid = true;
+        cascade.dirty = true;
+
+        // The light looks down its negative z axis, so casters nearer the light have larger z.
+        Matrix projection;
+        Matrix::createOrthographicOffCenter(cascade.center.x - extent, cascade.center.x + extent,
+                                            cascade.center.y - extent, cascade.center.y + extent,
+                                            -(cascade.center.z + extent + _casterDistance), -(cascade.center.z - extent), &projection);
+        Matrix::multiply(projection, lightView, &cascade.viewProjection);
+    }
+    _cascadeSplits.set(splits);
+}
+
+void ShadowMap::updateSpotCascade(Camera* camera)
+{
+    _cascadeSplits.x = camera->getFarPlane();
+
+    Cascade& cascade = _cascades[0];
+    if (cascade.valid)
+        return;
+
+    const float range = _light->getRange();
+    Matrix view;
+    _lightWorldMatrix.invert(&view);
+    Matrix projection;
+    Matrix::createPerspective(MATH_RAD_TO_DEG(_light->getOuterAngle()) * 2.0f, 1.0f, range * 0.01f, range, &projection);
+    Matrix::multiply(projection, view, &cascade.viewProjection);
+    cascade.valid = true;
+    cascade.dirty = true;
+}
+
+void ShadowMap::gatherCasters(Scene* scene, Cascade& cascade)
+{
+    _casters.clear();
+    _dynamicCasters.clear();
+    scene->findVisibleNodes(Frustum(cascade.viewProjection), _casters);
+
+    // The static casters are compared in order, since any change of them means drawing them again.
+    size_t staticIndex = 0;
+    bool changed = false;
+    for (size_t i = 0, count = _casters.size(); i < count; ++i)
+    {
+        Node* node = _casters[i];
+        if (dynamic_cast<Model*>(node->getDrawable()) == NULL)
+            continue;
+
+        if (node->isStatic())
+        {
+            if (staticIndex >= cascade.staticCasters.size() || cascade.staticCasters[staticIndex] != node)
+            {
+                if (!changed)
+                {
+                    cascade.staticCasters.resize(staticIndex);
+                    changed = true;
+                }
+                cascade.staticCasters.push_back(node);
+            }
+            ++staticIndex;
+        }
+        else
+        {
+            _dynamicCasters.push_back(node);
+        }
+    }
+    if (staticIndex != cascade.staticCasters.size())
+    {
+        cascade.staticCasters.resize(staticIndex);
+        changed = true;
+    }
+    if (changed)
+        cascade.dirty = true;
+}
+
+void ShadowMap::update(Scene* scene, Camera* camera)
+{
+    GP_ASSERT(scene);
+    GP_PROFILE_SCOPE("ShadowMap::update");
+
+    if (camera == NULL)
+        camera = scene->getActiveCamera();
+    if (camera == NULL || camera->getNode() == NULL || _light->getNode() == NULL)
+        return;
+
+    ++_frame;
+    _staticCasterCount = 0;
+    _staticUpdateCount = 0;
+    checkLight();
+    if (_light->getLightType() == Light::DIRECTIONAL)
+        updateDirectionalCascades(camera);
+    else
+        updateSpotCascade(camera);
+
+    Game* game = Game::getInstance();
+    const Rectangle viewport = game->getViewport();
+    FrameBuffer* previousFrameBuffer = FrameBuffer::getCurrent();
+    _stateBlock->bind();
+    GL_ASSERT( glEnable(GL_SCISSOR_TEST) );
+
+    unsigned int dynamicCasterCount = 0;
+    for (unsigned int i = 0; i < _cascadeCount; ++i)
+    {
+        Cascade& cascade = _cascades[i];
+        gatherCasters(scene, cascade);
+        _staticCasterCount += (unsigned int)cascade.staticCasters.size();
+        dynamicCasterCount += (unsigned int)_dynamicCasters.size();
+
+        // Each cascade only clears and draws its own region of the maps.
+        game->setViewport(Rectangle(i * _size, 0, _size, _size));
+        GL_ASSERT( glScissor(i * _size, 0, _size, _size) );
+        if (cascade.dirty)
+        {
+            _staticBuffer->bind();
+            GL_ASSERT( glClear(GL_DEPTH_BUFFER_BIT) );
+            drawCasters(cascade.staticCasters, i, true);
+            cascade.dirty = false;
+            ++_staticUpdateCount;
+        }
+        _dynamicBuffer->bind();
+        GL_ASSERT( glClear(GL_DEPTH_BUFFER_BIT) );
+        drawCasters(_dynamicCasters, i, false);
+
+        // Map view space positions of the camera to the region of the cascade in the maps.
+        Matrix toTexture(0.5f / _cascadeCount, 0, 0, (0.5f + i) / _cascadeCount,
+                         0, 0.5f, 0, 0.5f,
+                         0, 0, 0.5f, 0.5f,
+                         0, 0, 0, 1);
+        Matrix::multiply(toTexture, cascade.viewProjection, &_matrices[i]);
+        _matrices[i].multiply(camera->getInverseViewMatrix());
+    }
+    _dynamicCasterCount = dynamicCasterCount;
+
+    GL_ASSERT( glDisable(GL_SCISSOR_TEST) );
+    previousFrameBuffer->bind();
+    game->setViewport(viewport);
+
+    if (_frame % SHADOW_BINDING_LIFETIME == 0)
+        pruneBindings();
+}
+
+void ShadowMap::drawCasters(const std::vector<Node*>& casters, unsigned int cascadeIndex, bool baseMesh)
+{
+    const Matrix& viewProjection = _cascades[cascadeIndex].viewProjection;
+    for (size_t i = 0, count = casters.size(); i < count; ++i)
+    {
+        Node* node = casters[i];
+        Model* model = static_cast<Model*>(node->getDrawable());
+        Mesh* mesh = baseMesh ? model->getMesh() : model->getLodMesh(model->getLod());
+        MeshSkin* skin = model->getSkin();
+        Effect* effect = getEffect(skin ? skin->getJointCount() : 0);
+        VertexAttributeBinding* binding = effect ? getBinding(mesh, effect) : NULL;
+        if (binding == NULL)
+            continue;
+
+        effect->bind();
+        Matrix worldViewProjection;
+        Matrix::multiply(viewProjection, node->getWorldMatrix(), &worldViewProjection);
+        effect->setValue(effect->getUniform("u_worldViewProjectionMatrix"), worldViewProjection);
+        if (skin)
+            effect->setValue(effect->getUniform("u_matrixPalette"), skin->getMatrixPalette(), skin->getMatrixPaletteSize());
+
+        binding->bind();
+        const unsigned int partCount = mesh->getPartCount();
+        if (partCount == 0)
+        {
+            GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+            GL_ASSERT( glDrawArrays(mesh->getPrimitiveType(), 0, mesh->getVertexCount()) );
+            FrameStats::recordDraw(mesh->getPrimitiveType(), mesh->getVertexCount());
+        }
+        for (unsigned int j = 0; j < partCount; ++j)
+        {
+            MeshPart* part = mesh->getPart(j);
+            GP_ASSERT(part);
+            GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, part->getIndexBuffer());
+            GL_ASSERT( glDrawElements(part->getPrimitiveType(), part->getIndexCount(), part->getIndexFormat(), (const GLvoid*)part->getIndexOffset()) );
+            FrameStats::recordDraw(part->getPrimitiveType(), part->getIndexCount());
+        }
+        binding->unbind();
+    }
+}
+
+Effect* ShadowMap::getEffect(unsigned int jointCount)
+{
+    std::map<unsigned int, Effect*>::iterator itr = _effects.find(jointCount);
+    if (itr != _effects.end())
+        return itr->second;
+
+    Effect* effect;
+    if (jointCount == 0)
+    {
+        effect = Effect::createFromFile("res/shaders/shadow.vert", "res/shaders/shadow.frag");
+    }
+    else
+    {
+        char defines[64];
+        sprintf(defines, "SKINNING;SKINNING_JOINT_COUNT %u", jointCount);
+        effect = Effect::createFromFile("res/shaders/shadow.vert", "res/shaders/shadow.frag", defines);
+    }
+    if (effect == NULL)
+    {
+        GP_ERROR("Failed to create the shadow map effect for %u joints.", jointCount);
+    }
+
+    // The effect is remembered even when it failed, so that it is not created again each frame.
+    _effects[jointCount] = effect;
+    return effect;
+}
+
+VertexAttributeBinding* ShadowMap::getBinding(Mesh* mesh, Effect* effect)
+{
+    GP_ASSERT(mesh);
+
+    Binding& binding = _bindings[std::make_pair(mesh, effect)];
+    if (binding.lastUsedFrame == 0)
+        binding.binding = VertexAttributeBinding::create(mesh, effect);
+    binding.lastUsedFrame = _frame;
+    return binding.binding;
+}
+
+void ShadowMap::pruneBindings()
+{
+    std::map<std::pair<Mesh*, Effect*>, Binding>::iterator itr = _bindings.begin();
+    while (itr != _bindings.end())
+    {
+        if (itr->second.lastUsedFrame + SHADOW_BINDING_LIFETIME < _frame)
+        {
+            SAFE_RELEASE(itr->second.binding);
+            _bindings.erase(itr++);
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+}
+
+unsigned int ShadowMap::getStaticCasterCount() const
+{
+    return _staticCasterCount;
+}
+
+unsigned int ShadowMap::getDynamicCasterCount() const
+{
+    return _dynamicCasterCount;
+}
+
+unsigned int ShadowMap::getStaticUpdateCount() const
+{
+    return _staticUpdateCount;
+}
+
+Texture::Sampler* ShadowMap::getStaticSampler() const
+{
+    return _staticSampler;
+}
+
+Texture::Sampler* ShadowMap::getDynamicSampler() const
+{
+    return _dynamicSampler;
+}
+
+bool ShadowMap::resolveAutoBinding(const char* autoBinding, Node* node, MaterialParameter* parameter)
+{
+    GP_ASSERT(autoBinding);
+    GP_ASSERT(parameter);
+
+    if (strcmp(autoBinding, "SHADOW_MAP") == 0)
+        parameter->setValue(_staticSampler);
+    else if (strcmp(autoBinding, "SHADOW_DYNAMIC_MAP") == 0)
+        parameter->setValue(_dynamicSampler);
+    else if (strcmp(autoBinding, "SHADOW_MATRICES") == 0)
+        parameter->bindValue(this, &ShadowMap::getMatrices, &ShadowMap::getMatrixCount);
+    else if (strcmp(autoBinding, "SHADOW_CASCADE_SPLITS") == 0)
+        parameter->bindValue(this, &ShadowMap::getCascadeSplits);
+    else if (strcmp(autoBinding, "SHADOW_PARAMETERS") == 0)
+        parameter->bindValue(this, &ShadowMap::getParameters);
+    else
+        return false;
+    return true;
+}
+
+const Matrix* ShadowMap::getMatrices() const
+{
+    return &_matrices[0];
+}
+
+unsigned int ShadowMap::getMatrixCount() const
+{
+    return _cascadeCount;
+}
+
+const Vector4& ShadowMap::getCascadeSplits() const
+{
+    return _cascadeSplits;
+}
+
+const Vector4& ShadowMap::getParameters() const
+{
+    return _parameters;
+}
+
+}
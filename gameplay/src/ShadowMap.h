@@ -0,0 +1,327 @@
+#ifndef SHADOWMAP_H_
+#define SHADOWMAP_H_
+
+#include "RenderState.h"
+#include "FrameBuffer.h"
+#include "Texture.h"
+#include "Matrix.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+namespace gameplay
+{
+
+class Camera;
+class Effect;
+class Light;
+class Mesh;
+class Node;
+class Scene;
+class VertexAttributeBinding;
+
+/**
+ * Defines the shadow map of a directional or spot light.
+ *
+ * A shadow map holds the depth of the shadow casters of a scene as seen from a light, in
+ * which the shadowed pixels are the ones further from the light than the caster depth.
+ * Spot lights are given one perspective map, while directional lights split the view of
+ * the camera into cascades (up to 4), each with its own orthographic map, so that close
+ * shadows get more texels than distant ones.
+ *
+ * Most casters of a scene never move, so the depth of the static casters (the nodes for
+ * which Transform::isStatic() is true, such as those with static rigid bodies) is kept
+ * across frames in a map of its own. It is only drawn again when the light changes, when
+ * static casters are added to or removed from the view of the light, or when the camera
+ * leaves the region a cascade was drawn for, which is larger than the view for this reason.
+ * Only the dynamic casters are drawn each frame, into a second map, so the cost of
+ * shadows follows the motion in the scene rather than its size. The shader takes the
+ * nearer depth of the two maps.
+ *
+ * The cascades of a directional light are laid out side by side in the maps. Materials
+ * bind the maps through the following auto bindings, handled by the shadow map while it
+ * exists:
+ * <ul>
+ * <li>u_shadowMap = SHADOW_MAP
+ * <li>u_shadowDynamicMap = SHADOW_DYNAMIC_MAP
+ * <li>u_shadowMatrix = SHADOW_MATRICES
+ * <li>u_shadowCascadeSplits = SHADOW_CASCADE_SPLITS
+ * <li>u_shadowParameters = SHADOW_PARAMETERS
+ * </ul>
+ * The shadow matrices transform view space positions of the camera given to update() into
+ * the texture space of each cascade. The built-in colored and textured shaders shadow the
+ * first directional light (or the first spot light when there are no directional lights)
+ * when SHADOW is defined, with SHADOW_CASCADE_COUNT set to the cascade count of the map
+ * (but not together with BUMPED).
+ *
+ * Only models cast shadows. Shadow maps require depth textures, which on OpenGL ES 2.0
+ * are only available through the OES_depth_texture extension.
+ *
+ * @script{ignore}
+ */
+class ShadowMap : public RenderState::AutoBindingResolver
+{
+public:
+
+    /**
+     * Creates a new shadow map for a light.
+     *
+     * @param light The directional or spot light to create the shadow map for.
+     * @param size The width and height, in texels, of the map of each cascade.
+     * @param cascadeCount The number of cascades of a directional light, between 1 and 4.
+     *      Spot lights always have a single cascade.
+     *
+     * @return A new shadow map, or NULL if it could not be created.
+     */
+    static ShadowMap* create(Light* light, unsigned int size = 1024, unsigned int cascadeCount = 4);
+
+    /**
+     * Destructor.
+     */
+    ~ShadowMap();
+
+    /**
+     * Gets the light of the shadow map.
+     *
+     * @return The light.
+     */
+    Light* getLight() const;
+
+    /**
+     * Gets the width and height, in texels, of the map of each cascade.
+     *
+     * @return The size of a cascade.
+     */
+    unsigned int getSize() const;
+
+    /**
+     * Gets the number of cascades of the shadow map.
+     *
+     * @return The cascade count.
+     */
+    unsigned int getCascadeCount() const;
+
+    /**
+     * Sets the distance from the camera that the shadows of a directional light reach.
+     *
+     * The cascades split the view of the camera up to this distance, or up to its far plane
+     * when the distance is zero. The default is 100.
+     *
+     * @param distance The shadow distance.
+     */
+    void setDistance(float distance);
+
+    /**
+     * Gets the distance from the camera that the shadows of a directional light reach.
+     *
+     * @return The shadow distance.
+     */
+    float getDistance() const;
+
+    /**
+     * Sets how far towards a directional light, beyond the view of the camera, casters are drawn.
+     *
+     * Casters outside the view of the camera still shade it, so each cascade extends this
+     * distance towards the light. The default is 50.
+     *
+     * @param distance The caster distance.
+     */
+    void setCasterDistance(float distance);
+
+    /**
+     * Gets how far towards a directional light, beyond the view of the camera, casters are drawn.
+     *
+     * @return The caster distance.
+     */
+    float getCasterDistance() const;
+
+    /**
+     * Sets the depth bias that keeps surfaces from shadowing themselves.
+     *
+     * The bias is in the normalized depth of the shadow map. The default is 0.002.
+     *
+     * @param bias The depth bias.
+     */
+    void setBias(float bias);
+
+    /**
+     * Gets the depth bias that keeps surfaces from shadowing themselves.
+     *
+     * @return The depth bias.
+     */
+    float getBias() const;
+
+    /**
+     * Discards the cached depth of the static casters, so that the next update draws it again.
+     *
+     * Static casters are expected not to change, so this should be called when one of them
+     * changes in a way the shadow map cannot see, such as a new mesh or a different skin.
+     */
+    void invalidate();
+
+    /**
+     * Draws the shadow casters of a scene that changed since the last update into the maps.
+     *
+     * This must be called each frame before the scene is drawn from the camera.
+     *
+     * @param scene The scene to draw the casters of.
+     * @param camera The camera the scene is drawn from, or NULL for the active camera of the scene.
+     */
+    void update(Scene* scene, Camera* camera = NULL);
+
+    /**
+     * Gets the number of static casters in the view of the light at the last update.
+     *
+     * @return The number of static casters.
+     */
+    unsigned int getStaticCasterCount() const;
+
+    /**
+     * Gets the number of dynamic casters drawn by the last update.
+     *
+     * @return The number of dynamic casters.
+     */
+    unsigned int getDynamicCasterCount() const;
+
+    /**
+     * Gets the number of cascades whose static casters were drawn by the last update.
+     *
+     * @return The number of cascades, which is zero while the cached depth is reused.
+     */
+    unsigned int getStaticUpdateCount() const;
+
+    /**
+     * Gets the sampler of the map holding the depth of the static casters.
+     *
+     * @return The sampler of the static map.
+     */
+    Texture::Sampler* getStaticSampler() const;
+
+    /**
+     * Gets the sampler of the map holding the depth of the dynamic casters.
+     *
+     * @return The sampler of the dynamic map.
+     */
+    Texture::Sampler* getDynamicSampler() const;
+
+    /**
+     * @see RenderState::AutoBindingResolver::resolveAutoBinding
+     */
+    bool resolveAutoBinding(const char* autoBinding, Node* node, MaterialParameter* parameter);
+
+private:
+
+    struct Cascade
+    {
+        Matrix viewProjection;
+        Vector3 center;
+        float extent;
+        bool valid;
+        bool dirty;
+        std::vector<Node*> staticCasters;
+    };
+
+    struct Binding
+    {
+        VertexAttributeBinding* binding;
+        unsigned int lastUsedFrame;
+    };
+
+    /**
+     * Constructor.
+     */
+    ShadowMap(Light* light, unsigned int size, unsigned int cascadeCount);
+
+    /**
+     * Hidden copy constructor.
+     */
+    ShadowMap(const ShadowMap&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    ShadowMap& operator=(const ShadowMap&);
+
+    /**
+     * Creates the maps, the state and the effect used to draw the casters.
+     */
+    bool initialize();
+
+    /**
+     * Invalidates the cached depth when the light has moved or changed since it was drawn.
+     */
+    void checkLight();
+
+    /**
+     * Computes the view projection of each cascade of a directional light for the camera.
+     */
+    void updateDirectionalCascades(Camera* camera);
+
+    /**
+     * Computes the view projection of the cascade of a spot light.
+     */
+    void updateSpotCascade(Camera* camera);
+
+    /**
+     * Finds the casters in the view of a cascade, and marks it dirty if its static casters changed.
+     */
+    void gatherCasters(Scene* scene, Cascade& cascade);
+
+    /**
+     * Draws casters into the region of a cascade in the bound map.
+     */
+    void drawCasters(const std::vector<Node*>& casters, unsigned int cascadeIndex, bool baseMesh);
+
+    /**
+     * Gets the depth effect for a model with the given number of skin joints, or none.
+     */
+    Effect* getEffect(unsigned int jointCount);
+
+    /**
+     * Gets the vertex attribute binding of a mesh to a depth effect.
+     */
+    VertexAttributeBinding* getBinding(Mesh* mesh, Effect* effect);
+
+    /**
+     * Releases the vertex attribute bindings that have not been used for a while.
+     */
+    void pruneBindings();
+
+    const Matrix* getMatrices() const;
+
+    unsigned int getMatrixCount() const;
+
+    const Vector4& getCascadeSplits() const;
+
+    const Vector4& getParameters() const;
+
+    Light* _light;
+    unsigned int _size;
+    unsigned int _cascadeCount;
+    float _distance;
+    float _casterDistance;
+    float _bias;
+    std::vector<Cascade> _cascades;
+    std::vector<Matrix> _matrices;
+    Vector4 _cascadeSplits;
+    Vector4 _parameters;
+    Matrix _lightWorldMatrix;
+    float _lightRange;
+    float _lightOuterAngle;
+    std::vector<Node*> _casters;
+    std::vector<Node*> _dynamicCasters;
+    unsigned int _staticCasterCount;
+    unsigned int _dynamicCasterCount;
+    unsigned int _staticUpdateCount;
+    unsigned int _frame;
+    FrameBuffer* _staticBuffer;
+    FrameBuffer* _dynamicBuffer;
+    Texture::Sampler* _staticSampler;
+    Texture::Sampler* _dynamicSampler;
+    RenderState::StateBlock* _stateBlock;
+    std::map<unsigned int, Effect*> _effects;
+    std::map<std::pair<Mesh*, Effect*>, Binding> _bindings;
+};
+
+}
+
+#endif
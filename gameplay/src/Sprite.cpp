@@ -1,6 +1,7 @@
 #include "Base.h"
 #include "Sprite.h"
 #include "Scene.h"
+#include "TextureAtlas.h"
 
 namespace gameplay
 {
@@ -36,14 +37,28 @@ Sprite* Sprite::create(const char* imagePath, float width, float height,
     GP_ASSERT(source.width >= -1 && source.height >= -1);
     GP_ASSERT(frameCount > 0);
     
-    SpriteBatch* batch = SpriteBatch::create(imagePath, effect);
+    // Images packed into an atlas are drawn from their region of the atlas page.
+    unsigned int page;
+    Rectangle imageRegion;
+    SpriteBatch* batch = NULL;
+    TextureAtlas* atlas = TextureAtlas::find(imagePath, &page, &imageRegion);
+    if (atlas)
+    {
+        batch = SpriteBatch::create(atlas->getPage(page), effect);
+    }
+    else
+    {
+        batch = SpriteBatch::create(imagePath, effect);
+        Texture* texture = batch->getSampler()->getTexture();
+        imageRegion.set(0, 0, texture->getWidth(), texture->getHeight());
+    }
     batch->getSampler()->setWrapMode(Texture::CLAMP, Texture::CLAMP);
     batch->getSampler()->setFilterMode(Texture::Filter::LINEAR, Texture::Filter::LINEAR);
     batch->getStateBlock()->setDepthWrite(false);
     batch->getStateBlock()->setDepthTest(true);
     
-    unsigned int imageWidth = batch->getSampler()->getTexture()->getWidth();
-    unsigned int imageHeight = batch->getSampler()->getTexture()->getHeight();
+    unsigned int imageWidth = (unsigned int)imageRegion.width;
+    unsigned int imageHeight = (unsigned int)imageRegion.height;
     if (width == -1)
         width = imageWidth;
     if (height == -1)
@@ -53,6 +68,7 @@ Sprite* Sprite::create(const char* imagePath, float width, float height,
     sprite->_width = width;
     sprite->_height = height;
     sprite->_batch = batch;
+    sprite->_imageRegion = imageRegion;
     sprite->_frameCount = frameCount;
     sprite->_frames = new Rectangle[frameCount];
     sprite->_frames[0] = source;
@@ -429,8 +445,8 @@ void Sprite::computeFrames(unsigned int frameStride, unsigned int framePadding)
     
     if (_frameCount < 2)
         return;
-    unsigned int imageWidth = _batch->getSampler()->getTexture()->getWidth();
-    unsigned int imageHeight = _batch->getSampler()->getTexture()->getHeight();
+    unsigned int imageWidth = (unsigned int)_imageRegion.width;
+    unsigned int imageHeight = (unsigned int)_imageRegion.height;
     float textureWidthRatio = 1.0f / imageWidth;
     float textureHeightRatio = 1.0f / imageHeight;
     
@@ -637,8 +653,13 @@ unsigned int Sprite::draw(bool wireframe)
     }
     
     // TODO: Proper batching from cache based on batching rules (image, layers, etc)
+    // Frame sources are relative to the image, which may be packed into an atlas.
+    Rectangle source = _frames[_frameIndex];
+    source.x += _imageRegion.x;
+    source.y += _imageRegion.y;
+
     _batch->start();
-    _batch->draw(position, _frames[_frameIndex], scale, Vector4(_color.x, _color.y, _color.z, _color.w * _opacity),
+    _batch->draw(position, source, scale, Vector4(_color.x, _color.y, _color.z, _color.w * _opacity),
                  _anchor, rotationAngle);
     _batch->finish();
     
@@ -678,6 +699,7 @@ Drawable* Sprite::clone(NodeCloneContext& context)
     spriteClone->_framePadding = _framePadding;
     spriteClone->_frameIndex = _frameIndex;
     spriteClone->_batch = _batch;
+    spriteClone->_imageRegion = _imageRegion;
 
     return spriteClone;
 }
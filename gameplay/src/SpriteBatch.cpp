@@ -25,7 +25,7 @@ namespace gameplay
 static Effect* __spriteEffect = NULL;
 
 SpriteBatch::SpriteBatch()
-    : _batch(NULL), _sampler(NULL), _textureWidthRatio(0.0f), _textureHeightRatio(0.0f)
+    : _batch(NULL), _sampler(NULL), _textureWidthRatio(0.0f), _textureHeightRatio(0.0f), _sortMode(SORT_NONE)
 {
 }
 
@@ -143,6 +143,9 @@ SpriteBatch* SpriteBatch::create(Texture* texture,  Effect* effect, unsigned int
 void SpriteBatch::start()
 {
     _batch->start();
+    _commands.clear();
+    _commandVertices.clear();
+    _commandIndices.clear();
 }
 
 bool SpriteBatch::isStarted() const
@@ -232,7 +235,7 @@ void SpriteBatch::draw(float x, float y, float z, float width, float height, flo
     
     static unsigned short indices[4] = { 0, 1, 2, 3 };
 
-    _batch->add(v, 4, indices, 4);
+    submit(v, 4, indices, 4);
 }
 
 void SpriteBatch::draw(const Vector3& position, const Vector3& right, const Vector3& forward, float width, float height,
@@ -297,7 +300,7 @@ void SpriteBatch::draw(const Vector3& position, const Vector3& right, const Vect
     SPRITE_ADD_VERTEX(v[3], p3.x, p3.y, p3.z, u2, v2, color.x, color.y, color.z, color.w);
     
     static const unsigned short indices[4] = { 0, 1, 2, 3 };
-    _batch->add(v, 4, const_cast<unsigned short*>(indices), 4);
+    submit(v, 4, indices, 4);
 }
 
 void SpriteBatch::draw(float x, float y, float width, float height, float u1, float v1, float u2, float v2, const Vector4& color)
@@ -352,7 +355,33 @@ void SpriteBatch::draw(SpriteBatch::SpriteVertex* vertices, unsigned int vertexC
     GP_ASSERT(vertices);
     GP_ASSERT(indices);
 
-    _batch->add(vertices, vertexCount, indices, indexCount);
+    submit(vertices, vertexCount, indices, indexCount);
+}
+
+void SpriteBatch::submit(const SpriteVertex* vertices, unsigned int vertexCount, const unsigned short* indices, unsigned int indexCount)
+{
+    if (_sortMode == SORT_NONE)
+    {
+        _batch->add(vertices, vertexCount, indices, indexCount);
+        return;
+    }
+
+    Command command;
+    command.depth = 0.0f;
+    command.firstVertex = (unsigned int)_commandVertices.size();
+    command.vertexCount = vertexCount;
+    command.firstIndex = (unsigned int)_commandIndices.size();
+    command.indexCount = indexCount;
+    for (unsigned int i = 0; i < vertexCount; ++i)
+    {
+        command.depth += vertices[i].z;
+    }
+    if (vertexCount > 0)
+        command.depth /= (float)vertexCount;
+
+    _commandVertices.insert(_commandVertices.end(), vertices, vertices + vertexCount);
+    _commandIndices.insert(_commandIndices.end(), indices, indices + indexCount);
+    _commands.push_back(command);
 }
 
 void SpriteBatch::draw(float x, float y, float z, float width, float height, float u1, float v1, float u2, float v2, const Vector4& color, bool positionIsCenter)
@@ -375,11 +404,29 @@ void SpriteBatch::draw(float x, float y, float z, float width, float height, flo
 
     static unsigned short indices[4] = { 0, 1, 2, 3 };
 
-    _batch->add(v, 4, indices, 4);
+    submit(v, 4, indices, 4);
 }
 
 void SpriteBatch::finish()
 {
+    // Add the recorded sprites in sorted order. Sprites at the same depth keep the order they were drawn in.
+    if (!_commands.empty())
+    {
+        if (_sortMode == SORT_FRONT_TO_BACK)
+            std::stable_sort(_commands.begin(), _commands.end(), [](const Command& a, const Command& b) { return a.depth > b.depth; });
+        else
+            std::stable_sort(_commands.begin(), _commands.end(), [](const Command& a, const Command& b) { return a.depth < b.depth; });
+
+        for (size_t i = 0, count = _commands.size(); i < count; ++i)
+        {
+            const Command& command = _commands[i];
+            _batch->add(&_commandVertices[command.firstVertex], command.vertexCount, &_commandIndices[command.firstIndex], command.indexCount);
+        }
+        _commands.clear();
+        _commandVertices.clear();
+        _commandIndices.clear();
+    }
+
     // Finish and draw the batch
     _batch->finish();
     _batch->draw();
@@ -410,6 +457,16 @@ const Matrix& SpriteBatch::getProjectionMatrix() const
     return _projectionMatrix;
 }
 
+void SpriteBatch::setSortMode(SortMode mode)
+{
+    _sortMode = mode;
+}
+
+SpriteBatch::SortMode SpriteBatch::getSortMode() const
+{
+    return _sortMode;
+}
+
 bool SpriteBatch::clipSprite(const Rectangle& clip, float& x, float& y, float& width, float& height, float& u1, float& v1, float& u2, float& v2)
 {
     // Clip the rectangle given by { x, y, width, height } into clip.
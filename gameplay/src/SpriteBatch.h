@@ -30,6 +30,32 @@ class SpriteBatch
 
 public:
 
+    /**
+     * Defines the order in which the sprites drawn between start() and finish() are submitted.
+     *
+     * When sorting, draw() only records the vertices of each sprite, and the sprites are
+     * sorted and added to the batch in finish(). The depth of a sprite is the average z of
+     * its vertices, where larger z values are nearer the viewer as in view space.
+     */
+    enum SortMode
+    {
+        /**
+         * Sprites are added to the batch in the order they are drawn (the default).
+         */
+        SORT_NONE,
+
+        /**
+         * Sprites are submitted nearest first, so that opaque sprites drawn with depth
+         * testing reject the fragments they hide.
+         */
+        SORT_FRONT_TO_BACK,
+
+        /**
+         * Sprites are submitted farthest first, so that blended sprites composite correctly.
+         */
+        SORT_BACK_TO_FRONT
+    };
+
     /**
      * Creates a new SpriteBatch for drawing sprites with the given texture.
      *
@@ -303,7 +329,7 @@ public:
      * Finishes sprite drawing.
      *
      * This method flushes the batch and commits rendering of all sprites that were
-     * drawn since the last call to start().
+     * drawn since the last call to start(), in the order given by the sort mode.
      */
     void finish();
 
@@ -353,8 +379,36 @@ public:
      */
     const Matrix& getProjectionMatrix() const;
 
+    /**
+     * Sets the order in which sprites are submitted when the batch is finished.
+     *
+     * The sort mode should not be changed between start() and finish().
+     *
+     * @param mode The new sort mode.
+     */
+    void setSortMode(SortMode mode);
+
+    /**
+     * Gets the order in which sprites are submitted when the batch is finished.
+     *
+     * @return The sort mode.
+     */
+    SortMode getSortMode() const;
+
 private:
 
+    /**
+     * A group of vertices recorded by draw() while sorting.
+     */
+    struct Command
+    {
+        float depth;
+        unsigned int firstVertex;
+        unsigned int vertexCount;
+        unsigned int firstIndex;
+        unsigned int indexCount;
+    };
+
     /**
      * Constructor.
      */
@@ -402,12 +456,21 @@ private:
 
     bool clipSprite(const Rectangle& clip, float& x, float& y, float& width, float& height, float& u1, float& v1, float& u2, float& v2);
 
+    /**
+     * Adds vertices to the batch, or records them to be sorted when the batch is finished.
+     */
+    void submit(const SpriteVertex* vertices, unsigned int vertexCount, const unsigned short* indices, unsigned int indexCount);
+
     MeshBatch* _batch;
     Texture::Sampler* _sampler;
     bool _customEffect;
     float _textureWidthRatio;
     float _textureHeightRatio;
     mutable Matrix _projectionMatrix;
+    SortMode _sortMode;
+    std::vector<Command> _commands;
+    std::vector<SpriteVertex> _commandVertices;
+    std::vector<unsigned short> _commandIndices;
 };
 
 }
@@ -155,6 +155,19 @@ public:
      */
     virtual bool rewind() = 0;
 
+    /**
+     * Maps the next bytes of the stream into memory for reading, without copying them.
+     *
+     * The position of the stream advances past the mapped bytes, as if they had been read.
+     * The returned memory stays valid until the stream is closed. Streams that do not hold
+     * their contents in memory return NULL, and the bytes must be read instead.
+     *
+     * @param size The number of bytes to map.
+     *
+     * @return The read-only bytes, or NULL if the stream cannot map them.
+     */
+    virtual const void* map(size_t size) { return NULL; }
+
 protected:
     Stream() {};
 private:
@@ -0,0 +1,628 @@
+#include "Base.h"
+#include "StreamingTerrain.h"
+#include "JointTexture.h"
+#include "FileSystem.h"
+#include "Material.h"
+#include "Model.h"
+#include "MeshPart.h"
+#include "Node.h"
+#include "Scene.h"
+#include "Game.h"
+#include "GLStateCache.h"
+
+// Default streaming terrain material path
+#define STREAMING_TERRAIN_MATERIAL "res/materials/terrain-streaming.material"
+
+// The default number of megabytes of resident tiles.
+#define STREAMING_TERRAIN_MEMORY_BUDGET          64
+
+// The number of tiles uploaded to the GPU per frame, to spread out the cost of streaming.
+#define STREAMING_TERRAIN_UPLOADS_PER_FRAME      4
+
+// The part of the range of a level after which its vertices start morphing into the grid of the level above.
+#define STREAMING_TERRAIN_MORPH_START            0.7f
+
+namespace gameplay
+{
+
+// Gets the key of a tile in the tile map.
+static unsigned long long getTileKey(unsigned int level, unsigned int x, unsigned int z)
+{
+    return ((unsigned long long)level << 48) | ((unsigned long long)x << 24) | (unsigned long long)z;
+}
+
+// Gets the path of the file of a tile.
+static std::string getTilePath(const std::string& tilePath, unsigned int level, unsigned int x, unsigned int z)
+{
+    char suffix[48];
+    sprintf(suffix, "_%u_%u_%u.r16", level, x, z);
+    return tilePath + suffix;
+}
+
+// Reads the 16-bit heights of a tile into normalized heights. Runs on worker threads, so it only touches the tile.
+static void readTileHeights(const std::string& path, unsigned int sampleCount, std::vector<float>& heights, float* minHeight, float* maxHeight, bool* failed)
+{
+    std::unique_ptr<Stream> stream(FileSystem::open(path.c_str()));
+    std::vector<unsigned char> data(sampleCount * 2);
+    if (stream.get() == NULL || stream->read(&data[0], 1, data.size()) != data.size())
+    {
+        *failed = true;
+        return;
+    }
+
+    heights.resize(sampleCount);
+    *minHeight = 1.0f;
+    *maxHeight = 0.0f;
+    for (unsigned int i = 0; i < sampleCount; ++i)
+    {
+        // RAW heights use PC byte ordering (little endian).
+        const float height = (float)(data[i * 2] | (data[i * 2 + 1] << 8)) / 65535.0f;
+        heights[i] = height;
+        *minHeight = std::min(*minHeight, height);
+        *maxHeight = std::max(*maxHeight, height);
+    }
+}
+
+StreamingTerrain::Tile::Tile()
+    : level(0), x(0), z(0), minHeight(0.0f), maxHeight(0.0f), sampler(NULL), failed(false), lastUsedFrame(0)
+{
+}
+
+StreamingTerrain::Tile::~Tile()
+{
+    SAFE_RELEASE(sampler);
+}
+
+StreamingTerrain::StreamingTerrain() : Drawable(),
+    _tileSize(0), _levelCount(0), _lodDistance(0.0f), _memoryBudget(0), _memorySize(0), _residentTileCount(0),
+    _grid(NULL), _root(NULL), _frame(0)
+{
+}
+
+StreamingTerrain::~StreamingTerrain()
+{
+    // Tiles still being read are written to by their jobs, so the jobs are waited for.
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    for (size_t i = 0, count = _loadingTiles.size(); i < count; ++i)
+    {
+        if (jobSystem)
+            jobSystem->wait(&_loadingTiles[i]->loaded);
+    }
+    for (std::map<unsigned long long, Tile*>::iterator itr = _tiles.begin(); itr != _tiles.end(); ++itr)
+    {
+        SAFE_DELETE(itr->second);
+    }
+    SAFE_RELEASE(_grid);
+}
+
+StreamingTerrain* StreamingTerrain::create(const char* path)
+{
+    Properties* properties = Properties::create(path);
+    if (!properties)
+    {
+        GP_WARN("Failed to load properties for streaming terrain: %s", path);
+        return NULL;
+    }
+
+    StreamingTerrain* terrain = create(strlen(properties->getNamespace()) > 0 ? properties : properties->getNextNamespace());
+    SAFE_DELETE(properties);
+    return terrain;
+}
+
+StreamingTerrain* StreamingTerrain::create(Properties* properties)
+{
+    if (!properties || strcmp(properties->getNamespace(), "streamingTerrain") != 0)
+    {
+        GP_WARN("Properties object must be non-null and have namespace equal to 'streamingTerrain'.");
+        return NULL;
+    }
+
+    std::string tilePath;
+    if (!properties->getPath("tiles", &tilePath))
+    {
+        // The tiles do not exist as a single file, so the prefix is taken as it is.
+        const char* tiles = properties->getString("tiles");
+        if (!tiles)
+        {
+            GP_WARN("No 'tiles' property supplied in streaming terrain definition.");
+            return NULL;
+        }
+        tilePath = tiles;
+    }
+
+    Vector3 size;
+    if (!properties->getVector3("size", &size) || size.x <= 0.0f || size.z <= 0.0f)
+    {
+        GP_WARN("Invalid or missing 'size' property in streaming terrain definition.");
+        return NULL;
+    }
+    const int tileSize = properties->getInt("tileSize");
+    const int levelCount = properties->getInt("levels");
+    const float lodDistance = properties->exists("lodDistance") ? properties->getFloat("lodDistance") : size.x / (1 << std::max(levelCount - 1, 0));
+    const float memoryBudget = properties->exists("memoryBudget") ? properties->getFloat("memoryBudget") : (float)STREAMING_TERRAIN_MEMORY_BUDGET;
+    const char* materialPath = properties->getString("material");
+
+    return create(tilePath.c_str(), tileSize > 0 ? tileSize : 0, levelCount > 0 ? levelCount : 0, size,
+                  lodDistance, (size_t)(memoryBudget * 1024.0f * 1024.0f), materialPath);
+}
+
+StreamingTerrain* StreamingTerrain::create(const char* tilePath, unsigned int tileSize, unsigned int levelCount, const Vector3& size,
+                                           float lodDistance, size_t memoryBudget, const char* materialPath)
+{
+    GP_ASSERT(tilePath);
+
+    if (!isSupported())
+    {
+        GP_WARN("Streaming terrains are not supported on this platform.");
+        return NULL;
+    }
+    const unsigned int gridSize = tileSize - 1;
+    if (tileSize < 3 || (gridSize & (gridSize - 1)) != 0)
+    {
+        GP_WARN("The tile size of a streaming terrain must be a power of two plus one (%u).", tileSize);
+        return NULL;
+    }
+    if (levelCount == 0 || levelCount > 24)
+    {
+        GP_WARN("Invalid number of levels for a streaming terrain (%u).", levelCount);
+        return NULL;
+    }
+
+    StreamingTerrain* terrain = new StreamingTerrain();
+    terrain->_tilePath = tilePath;
+    terrain->_materialPath = (materialPath == NULL || strlen(materialPath) == 0) ? STREAMING_TERRAIN_MATERIAL : materialPath;
+    terrain->_tileSize = tileSize;
+    terrain->_levelCount = levelCount;
+    terrain->_size = size;
+    terrain->_lodDistance = std::max(lodDistance, 0.0f);
+    terrain->_memoryBudget = memoryBudget;
+
+    // The root tile is read up front, as it is drawn wherever no finer tile is resident.
+    Tile* root = new Tile();
+    terrain->_tiles[getTileKey(0, 0, 0)] = root;
+    terrain->_root = root;
+    readTileHeights(getTilePath(terrain->_tilePath, 0, 0, 0), tileSize * tileSize, root->heights, &root->minHeight, &root->maxHeight, &root->failed);
+    if (root->failed)
+    {
+        GP_WARN("Failed to read the root tile of streaming terrain: %s", getTilePath(terrain->_tilePath, 0, 0, 0).c_str());
+        SAFE_RELEASE(terrain);
+        return NULL;
+    }
+    terrain->uploadTile(root);
+
+    // Every tile is drawn with the same grid, whose vertices are positioned by the vertex shader.
+    const unsigned int vertexCount = tileSize * tileSize;
+    std::vector<float> vertices(vertexCount * 2);
+    for (unsigned int z = 0, index = 0; z < tileSize; ++z)
+    {
+        for (unsigned int x = 0; x < tileSize; ++x)
+        {
+            vertices[index++] = (float)x / gridSize;
+            vertices[index++] = (float)z / gridSize;
+        }
+    }
+    VertexFormat::Element elements[] = { VertexFormat::Element(VertexFormat::POSITION, 2) };
+    Mesh* mesh = Mesh::createMesh(VertexFormat(elements, 1), vertexCount);
+    mesh->setVertexData(&vertices[0]);
+    mesh->setBoundingBox(BoundingBox(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f));
+
+    const unsigned int indexCount = gridSize * gridSize * 6;
+    std::vector<unsigned int> indices(indexCount);
+    for (unsigned int z = 0, index = 0; z < gridSize; ++z)
+    {
+        for (unsigned int x = 0; x < gridSize; ++x)
+        {
+            const unsigned int a = z * tileSize + x;
+            const unsigned int b = a + tileSize;
+            indices[index++] = a;
+            indices[index++] = b;
+            indices[index++] = a + 1;
+            indices[index++] = a + 1;
+            indices[index++] = b;
+            indices[index++] = b + 1;
+        }
+    }
+    if (vertexCount <= USHRT_MAX + 1)
+    {
+        std::vector<unsigned short> shortIndices(indices.begin(), indices.end());
+        MeshPart* part = mesh->addPart(Mesh::TRIANGLES, Mesh::INDEX16, indexCount);
+        part->setIndexData(&shortIndices[0], 0, indexCount);
+    }
+    else
+    {
+        MeshPart* part = mesh->addPart(Mesh::TRIANGLES, Mesh::INDEX32, indexCount);
+        part->setIndexData(&indices[0], 0, indexCount);
+    }
+    terrain->_grid = Model::create(mesh);
+    SAFE_RELEASE(mesh);
+
+    Material* material = Material::create(terrain->_materialPath.c_str());
+    if (!material)
+    {
+        GP_WARN("Failed to load material for streaming terrain: %s", terrain->_materialPath.c_str());
+        SAFE_RELEASE(terrain);
+        return NULL;
+    }
+    material->getParameter("u_gridSize")->setValue((float)gridSize);
+    material->getParameter("u_terrainSize")->setValue(size);
+    terrain->_grid->setMaterial(material);
+    SAFE_RELEASE(material);
+
+    terrain->_boundingBox.set(-size.x * 0.5f, root->minHeight * size.y, -size.z * 0.5f, size.x * 0.5f, root->maxHeight * size.y, size.z * 0.5f);
+
+    return terrain;
+}
+
+bool StreamingTerrain::writeTiles(HeightField* heightfield, const char* tilePath, unsigned int tileSize, unsigned int levelCount)
+{
+    GP_ASSERT(heightfield);
+    GP_ASSERT(tilePath);
+
+    const unsigned int gridSize = tileSize - 1;
+    if (tileSize < 3 || (gridSize & (gridSize - 1)) != 0 || levelCount == 0 || levelCount > 24)
+    {
+        GP_WARN("Invalid tile size (%u) or number of levels (%u) for streaming terrain tiles.", tileSize, levelCount);
+        return false;
+    }
+    const unsigned int sampleCount = gridSize * (1 << (levelCount - 1)) + 1;
+    if (heightfield->getColumnCount() != sampleCount || heightfield->getRowCount() != sampleCount)
+    {
+        GP_WARN("A height field of %ux%u samples is required for %u levels of %u sample tiles.", sampleCount, sampleCount, levelCount, tileSize);
+        return false;
+    }
+
+    std::vector<unsigned char> data(tileSize * tileSize * 2);
+    for (unsigned int level = 0; level < levelCount; ++level)
+    {
+        // The tiles of each level keep every 'step' samples of the height field.
+        const unsigned int tileCount = 1 << level;
+        const unsigned int step = 1 << (levelCount - 1 - level);
+        for (unsigned int tileZ = 0; tileZ < tileCount; ++tileZ)
+        {
+            for (unsigned int tileX = 0; tileX < tileCount; ++tileX)
+            {
+                for (unsigned int z = 0, index = 0; z < tileSize; ++z)
+                {
+                    const unsigned int row = (tileZ * gridSize + z) * step;
+                    for (unsigned int x = 0; x < tileSize; ++x)
+                    {
+                        const unsigned int column = (tileX * gridSize + x) * step;
+                        const float height = MATH_CLAMP(heightfield->getSample(column, row), 0.0f, 1.0f);
+                        const unsigned int value = (unsigned int)(height * 65535.0f + 0.5f);
+                        data[index++] = (unsigned char)(value & 0xff);
+                        data[index++] = (unsigned char)(value >> 8);
+                    }
+                }
+
+                const std::string path = getTilePath(tilePath, level, tileX, tileZ);
+                std::unique_ptr<Stream> stream(FileSystem::open(path.c_str(), FileSystem::WRITE));
+                if (stream.get() == NULL || stream->write(&data[0], 1, data.size()) != data.size())
+                {
+                    GP_WARN("Failed to write streaming terrain tile: %s", path.c_str());
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool StreamingTerrain::isSupported()
+{
+#ifdef GP_USE_FLOAT_TEXTURES
+    return JointTexture::isSupported() && (GLEW_VERSION_3_0 || GLEW_ARB_texture_rg);
+#else
+    return false;
+#endif
+}
+
+const BoundingBox& StreamingTerrain::getBoundingBox() const
+{
+    return _boundingBox;
+}
+
+float StreamingTerrain::getHeight(float x, float z) const
+{
+    // The position is found in the local space of the terrain, where the world is centered on the origin.
+    Matrix inverseWorld;
+    if (_node)
+        _node->getWorldMatrix().invert(&inverseWorld);
+    Vector3 position = inverseWorld * Vector3(x, 0.0f, z);
+    const float u = MATH_CLAMP(position.x / _size.x + 0.5f, 0.0f, 1.0f);
+    const float v = MATH_CLAMP(position.z / _size.z + 0.5f, 0.0f, 1.0f);
+
+    // Descend to the finest resident tile that holds the position.
+    Tile* tile = _root;
+    for (unsigned int level = 1; level < _levelCount; ++level)
+    {
+        const unsigned int tileCount = 1 << level;
+        Tile* child = findResidentTile(level, std::min((unsigned int)(u * tileCount), tileCount - 1), std::min((unsigned int)(v * tileCount), tileCount - 1));
+        if (!child)
+            break;
+        tile = child;
+    }
+
+    // Interpolate the heights of the tile bilinearly.
+    const unsigned int tileCount = 1 << tile->level;
+    const unsigned int gridSize = _tileSize - 1;
+    const float column = MATH_CLAMP((u * tileCount - tile->x) * gridSize, 0.0f, (float)gridSize);
+    const float row = MATH_CLAMP((v * tileCount - tile->z) * gridSize, 0.0f, (float)gridSize);
+    const unsigned int x1 = std::min((unsigned int)column, gridSize - 1);
+    const unsigned int z1 = std::min((unsigned int)row, gridSize - 1);
+    const float xFactor = column - x1;
+    const float zFactor = row - z1;
+    const float* heights = &tile->heights[0];
+    const float top = heights[z1 * _tileSize + x1] * (1.0f - xFactor) + heights[z1 * _tileSize + x1 + 1] * xFactor;
+    const float bottom = heights[(z1 + 1) * _tileSize + x1] * (1.0f - xFactor) + heights[(z1 + 1) * _tileSize + x1 + 1] * xFactor;
+    position.y = (top * (1.0f - zFactor) + bottom * zFactor) * _size.y;
+
+    if (_node)
+        _node->getWorldMatrix().transformPoint(&position);
+    return position.y;
+}
+
+Material* StreamingTerrain::getMaterial() const
+{
+    return _grid->getMaterial();
+}
+
+void StreamingTerrain::setMemoryBudget(size_t memoryBudget)
+{
+    _memoryBudget = memoryBudget;
+}
+
+size_t StreamingTerrain::getMemoryBudget() const
+{
+    return _memoryBudget;
+}
+
+size_t StreamingTerrain::getMemorySize() const
+{
+    return _memorySize;
+}
+
+unsigned int StreamingTerrain::getResidentTileCount() const
+{
+    return _residentTileCount;
+}
+
+StreamingTerrain::Tile* StreamingTerrain::requestTile(unsigned int level, unsigned int x, unsigned int z)
+{
+    const unsigned long long key = getTileKey(level, x, z);
+    std::map<unsigned long long, Tile*>::iterator itr = _tiles.find(key);
+    if (itr != _tiles.end())
+        return itr->second;
+
+    Tile* tile = new Tile();
+    tile->level = level;
+    tile->x = x;
+    tile->z = z;
+    tile->lastUsedFrame = _frame;
+    _tiles[key] = tile;
+    _loadingTiles.push_back(tile);
+
+    // The heights are read straight into the tile, since worker threads must not create Ref objects.
+    const std::string path = getTilePath(_tilePath, level, x, z);
+    const unsigned int sampleCount = _tileSize * _tileSize;
+    JobSystem::Function read = [tile, path, sampleCount]()
+    {
+        readTileHeights(path, sampleCount, tile->heights, &tile->minHeight, &tile->maxHeight, &tile->failed);
+    };
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem)
+        jobSystem->run(read, &tile->loaded);
+    else
+        read();
+    return tile;
+}
+
+StreamingTerrain::Tile* StreamingTerrain::findResidentTile(unsigned int level, unsigned int x, unsigned int z) const
+{
+    std::map<unsigned long long, Tile*>::const_iterator itr = _tiles.find(getTileKey(level, x, z));
+    return (itr != _tiles.end() && itr->second->sampler) ? itr->second : NULL;
+}
+
+void StreamingTerrain::uploadTile(Tile* tile)
+{
+    GP_ASSERT(tile && !tile->failed && !tile->heights.empty());
+
+#ifdef GP_USE_FLOAT_TEXTURES
+    TextureHandle handle;
+    GL_ASSERT( glGenTextures(1, &handle) );
+    GLStateCache::bindTexture(GL_TEXTURE_2D, handle);
+    GL_ASSERT( glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, _tileSize, _tileSize, 0, GL_RED, GL_FLOAT, &tile->heights[0]) );
+    Texture* texture = Texture::create(handle, _tileSize, _tileSize);
+    tile->sampler = Texture::Sampler::create(texture);
+    SAFE_RELEASE(texture);
+    tile->sampler->setFilterMode(Texture::LINEAR, Texture::LINEAR);
+    tile->sampler->setWrapMode(Texture::CLAMP, Texture::CLAMP);
+
+    // The heights are kept alongside the texture, for getHeight() and the bounds of the tile.
+    _memorySize += _tileSize * _tileSize * sizeof(float) * 2;
+    ++_residentTileCount;
+#endif
+}
+
+void StreamingTerrain::updateTiles()
+{
+    // Upload a few of the tiles that have been read.
+    unsigned int uploadCount = 0;
+    for (size_t i = 0; i < _loadingTiles.size() && uploadCount < STREAMING_TERRAIN_UPLOADS_PER_FRAME;)
+    {
+        Tile* tile = _loadingTiles[i];
+        if (!tile->loaded.isDone())
+        {
+            ++i;
+            continue;
+        }
+        if (tile->failed)
+        {
+            // Failed tiles stay in the tile map, so they are not read again, and their parent is drawn instead.
+            GP_WARN("Failed to read streaming terrain tile: %s", getTilePath(_tilePath, tile->level, tile->x, tile->z).c_str());
+        }
+        else
+        {
+            uploadTile(tile);
+            ++uploadCount;
+        }
+        _loadingTiles.erase(_loadingTiles.begin() + i);
+    }
+
+    // Evict the least recently drawn tiles over the budget. Tiles are used whenever their
+    // subtree is walked, so a tile is never evicted before its descendants.
+    while (_memorySize > _memoryBudget)
+    {
+        std::map<unsigned long long, Tile*>::iterator evicted = _tiles.end();
+        for (std::map<unsigned long long, Tile*>::iterator itr = _tiles.begin(); itr != _tiles.end(); ++itr)
+        {
+            Tile* tile = itr->second;
+            if (tile != _root && tile->sampler && tile->lastUsedFrame + 1 < _frame &&
+                (evicted == _tiles.end() || tile->lastUsedFrame < evicted->second->lastUsedFrame))
+            {
+                evicted = itr;
+            }
+        }
+        if (evicted == _tiles.end())
+            break;
+
+        _memorySize -= _tileSize * _tileSize * sizeof(float) * 2;
+        --_residentTileCount;
+        SAFE_DELETE(evicted->second);
+        _tiles.erase(evicted);
+    }
+}
+
+void StreamingTerrain::getTileBounds(unsigned int level, unsigned int x, unsigned int z, BoundingBox* dst) const
+{
+    GP_ASSERT(dst);
+
+    // Tiles that are not resident take the height range of their closest resident ancestor.
+    const Tile* tile = NULL;
+    for (unsigned int i = 0; i <= level && !tile; ++i)
+    {
+        tile = findResidentTile(level - i, x >> i, z >> i);
+    }
+    GP_ASSERT(tile);
+
+    const float tileCount = (float)(1 << level);
+    const float extentX = _size.x / tileCount;
+    const float extentZ = _size.z / tileCount;
+    const float minX = -_size.x * 0.5f + x * extentX;
+    const float minZ = -_size.z * 0.5f + z * extentZ;
+    dst->set(minX, tile->minHeight * _size.y, minZ, minX + extentX, tile->maxHeight * _size.y, minZ + extentZ);
+}
+
+bool StreamingTerrain::selectTiles(Tile* tile, const Vector3& cameraPosition, Camera* camera)
+{
+    GP_ASSERT(tile && tile->sampler);
+
+    tile->lastUsedFrame = _frame;
+    BoundingBox bounds;
+    getTileBounds(tile->level, tile->x, tile->z, &bounds);
+
+    // Each level is drawn within a range that is half the range of the level above.
+    const float range = _lodDistance * (float)(1 << (_levelCount - 1 - tile->level));
+    if (!BoundingSphere(cameraPosition, range).intersects(bounds))
+        return false;
+
+    if (camera)
+    {
+        BoundingBox worldBounds(bounds);
+        if (_node)
+            worldBounds.transform(_node->getWorldMatrix());
+        if (!camera->getFrustum().intersects(worldBounds))
+            return true;
+    }
+
+    // Split the tile once the range of the level below reaches it and all its children are resident.
+    if (tile->level + 1 < _levelCount && BoundingSphere(cameraPosition, range * 0.5f).intersects(bounds))
+    {
+        Tile* children[4];
+        bool resident = true;
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            children[i] = requestTile(tile->level + 1, tile->x * 2 + (i & 1), tile->z * 2 + (i >> 1));
+            children[i]->lastUsedFrame = _frame;
+            resident = resident && children[i]->sampler != NULL;
+        }
+        if (resident)
+        {
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                // Children beyond their range are drawn fully morphed into the grid of this tile.
+                if (!selectTiles(children[i], cameraPosition, camera))
+                    _selectedTiles.push_back(children[i]);
+            }
+            return true;
+        }
+    }
+
+    _selectedTiles.push_back(tile);
+    return true;
+}
+
+unsigned int StreamingTerrain::drawTile(Tile* tile, bool wireframe)
+{
+    const float tileCount = (float)(1 << tile->level);
+    const float extentX = _size.x / tileCount;
+    const float extentZ = _size.z / tileCount;
+    const float range = _lodDistance * (float)(1 << (_levelCount - 1 - tile->level));
+
+    Material* material = _grid->getMaterial();
+    material->getParameter("u_tileOffset")->setValue(Vector4(-_size.x * 0.5f + tile->x * extentX, -_size.z * 0.5f + tile->z * extentZ, extentX, extentZ));
+    material->getParameter("u_morphRange")->setValue(Vector2(range * STREAMING_TERRAIN_MORPH_START, range));
+    material->getParameter("u_heightMap")->setValue(tile->sampler);
+    return _grid->draw(wireframe);
+}
+
+unsigned int StreamingTerrain::draw(bool wireframe)
+{
+    GP_PROFILE_GPU_SCOPE("StreamingTerrain::draw");
+
+    Scene* scene = _node ? _node->getScene() : NULL;
+    Camera* camera = scene ? scene->getActiveCamera() : NULL;
+    if (!camera || !camera->getNode())
+        return 0;
+
+    // Stream the tiles once per frame, however many times the terrain is drawn.
+    const unsigned int frame = Game::getInstance()->getFrameNumber();
+    if (frame != _frame)
+    {
+        _frame = frame;
+        updateTiles();
+    }
+
+    // Ranges are measured in the local space of the terrain.
+    Matrix inverseWorld;
+    _node->getWorldMatrix().invert(&inverseWorld);
+    Vector3 cameraPosition = camera->getNode()->getTranslationWorld();
+    inverseWorld.transformPoint(&cameraPosition);
+    _grid->getMaterial()->getParameter("u_cameraPosition")->setValue(cameraPosition);
+
+    _selectedTiles.clear();
+    if (!selectTiles(_root, cameraPosition, camera))
+        _selectedTiles.push_back(_root);
+
+    unsigned int drawCount = 0;
+    for (size_t i = 0, count = _selectedTiles.size(); i < count; ++i)
+    {
+        drawCount += drawTile(_selectedTiles[i], wireframe);
+    }
+    return drawCount;
+}
+
+Drawable* StreamingTerrain::clone(NodeCloneContext& context)
+{
+    return create(_tilePath.c_str(), _tileSize, _levelCount, _size, _lodDistance, _memoryBudget, _materialPath.c_str());
+}
+
+void StreamingTerrain::setNode(Node* node)
+{
+    if (_node != node)
+    {
+        Drawable::setNode(node);
+        _grid->getMaterial()->setNodeBinding(node);
+    }
+}
+
+}
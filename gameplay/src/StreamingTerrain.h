@@ -0,0 +1,295 @@
+#ifndef STREAMINGTERRAIN_H_
+#define STREAMINGTERRAIN_H_
+
+#include "Ref.h"
+#include "Drawable.h"
+#include "Properties.h"
+#include "HeightField.h"
+#include "Texture.h"
+#include "BoundingBox.h"
+#include "JobSystem.h"
+
+namespace gameplay
+{
+
+class Model;
+class Material;
+class Camera;
+
+/**
+ * Defines a terrain that streams its heights from disk, for worlds too large to keep resident.
+ *
+ * Terrain builds the geometry of every patch and every level of detail of its whole height
+ * field up front. A streaming terrain instead divides the world into a quadtree of height
+ * tiles: the root tile covers the whole world, and each level below splits the tiles of the
+ * level above into four, so that every tile holds the same number of height samples over a
+ * quarter of the area of its parent. The tiles are stored as files on disk, written from a
+ * height field by writeTiles().
+ *
+ * Rendering uses continuous distance-dependent level of detail (CDLOD). Every level has a
+ * range from the camera, which doubles from one level to the next coarser one. Each frame the
+ * quadtree is walked from the root: a tile that the range of the level below reaches is split
+ * into its children, and the others are drawn. Every tile is drawn with the same grid mesh,
+ * whose heights are read in the vertex shader from the height texture of the tile, and the
+ * vertices of a tile morph into the grid of its parent as they near the end of its range, so
+ * neither cracks nor pops appear between tiles of different levels.
+ *
+ * Tiles are paged in around the camera: a tile is requested when its parent is reached by
+ * the range of its level, read from disk on the JobSystem and uploaded on the main thread,
+ * and until all four children of a tile are resident, the tile itself is drawn in their place.
+ * Tiles that were not drawn for a while are evicted, least recently used first, once the
+ * resident tiles exceed the memory budget. The root tile is always resident.
+ *
+ * Height tiles are sampled in the vertex shader from float textures, which requires
+ * desktop OpenGL.
+ *
+ * @script{ignore}
+ */
+class StreamingTerrain : public Ref, public Drawable
+{
+    friend class Node;
+
+public:
+
+    /**
+     * Loads a streaming terrain from the given properties file.
+     *
+     * The properties file describes the tiles and the world they cover:
+     *
+     * @verbatim
+     streamingTerrain
+     {
+         tiles = res/terrain/world          // path prefix of the tiles written by writeTiles()
+         tileSize = 65                      // height samples along the edge of a tile
+         levels = 8                         // levels of the quadtree, including the root
+         size = 16384, 800, 16384           // size of the world
+         lodDistance = 128                  // range of the finest level
+         memoryBudget = 64                  // megabytes of resident tiles
+         material = res/materials/terrain-streaming.material
+     }
+     @endverbatim
+     *
+     * @param path Path to a properties file describing the terrain.
+     *
+     * @return A new streaming terrain, or NULL if it could not be created.
+     */
+    static StreamingTerrain* create(const char* path);
+
+    /**
+     * Creates a streaming terrain from properties.
+     *
+     * @param properties The properties of the terrain.
+     *
+     * @return A new streaming terrain, or NULL if it could not be created.
+     */
+    static StreamingTerrain* create(Properties* properties);
+
+    /**
+     * Creates a streaming terrain.
+     *
+     * @param tilePath The path prefix of the tiles written by writeTiles().
+     * @param tileSize The number of height samples along the edge of a tile, a power of two plus one.
+     * @param levelCount The number of levels of the quadtree, including the root.
+     * @param size The size of the world, whose heights range from 0 to size.y.
+     * @param lodDistance The range from the camera of the finest level.
+     * @param memoryBudget The number of bytes the resident tiles are kept within.
+     * @param materialPath The material to draw the tiles with, or NULL for the default material.
+     *
+     * @return A new streaming terrain, or NULL if it could not be created.
+     */
+    static StreamingTerrain* create(const char* tilePath, unsigned int tileSize, unsigned int levelCount, const Vector3& size,
+                                    float lodDistance, size_t memoryBudget, const char* materialPath = NULL);
+
+    /**
+     * Writes the tiles of every level of a streaming terrain from a height field.
+     *
+     * The height field must have (tileSize - 1) * 2^(levelCount - 1) + 1 rows and columns, and
+     * heights from 0 to 1. The tiles of each level keep every other sample of the level below,
+     * so that tiles of neighbouring levels agree where their samples meet. Each tile is written
+     * as a 16-bit RAW file named "<tilePath>_<level>_<x>_<z>.r16".
+     *
+     * @param heightfield The height field of the whole world.
+     * @param tilePath The path prefix of the tiles.
+     * @param tileSize The number of height samples along the edge of a tile, a power of two plus one.
+     * @param levelCount The number of levels of the quadtree, including the root.
+     *
+     * @return true if the tiles were written, false otherwise.
+     */
+    static bool writeTiles(HeightField* heightfield, const char* tilePath, unsigned int tileSize, unsigned int levelCount);
+
+    /**
+     * Determines whether streaming terrains are supported on this platform.
+     *
+     * @return true if streaming terrains are supported, false otherwise.
+     */
+    static bool isSupported();
+
+    /**
+     * Gets the local bounding box of the terrain.
+     *
+     * @return The bounding box of the terrain.
+     */
+    const BoundingBox& getBoundingBox() const;
+
+    /**
+     * Gets the world-space height of the terrain at the specified position on the X,Z plane.
+     *
+     * The height is read from the finest resident tile at the position.
+     *
+     * @param x The X coordinate, in world space.
+     * @param z The Z coordinate, in world space.
+     *
+     * @return The height at the specified position.
+     */
+    float getHeight(float x, float z) const;
+
+    /**
+     * Gets the material the tiles are drawn with.
+     *
+     * @return The material of the terrain.
+     */
+    Material* getMaterial() const;
+
+    /**
+     * Sets the number of bytes the resident tiles are kept within.
+     *
+     * @param memoryBudget The memory budget, in bytes.
+     */
+    void setMemoryBudget(size_t memoryBudget);
+
+    /**
+     * Gets the number of bytes the resident tiles are kept within.
+     *
+     * @return The memory budget, in bytes.
+     */
+    size_t getMemoryBudget() const;
+
+    /**
+     * Gets the number of bytes used by the resident tiles.
+     *
+     * @return The memory used by the tiles, in bytes.
+     */
+    size_t getMemorySize() const;
+
+    /**
+     * Gets the number of tiles that are resident.
+     *
+     * @return The number of resident tiles.
+     */
+    unsigned int getResidentTileCount() const;
+
+    /**
+     * @see Drawable::draw
+     */
+    unsigned int draw(bool wireframe = false);
+
+protected:
+
+    /**
+     * @see Drawable::clone
+     */
+    Drawable* clone(NodeCloneContext& context);
+
+    /**
+     * @see Drawable::setNode
+     */
+    void setNode(Node* node);
+
+private:
+
+    /**
+     * A tile of the quadtree, and its heights once they are read.
+     */
+    struct Tile
+    {
+        Tile();
+        ~Tile();
+
+        unsigned int level;
+        unsigned int x;
+        unsigned int z;
+        std::vector<float> heights;
+        float minHeight;
+        float maxHeight;
+        Texture::Sampler* sampler;
+        bool failed;
+        unsigned int lastUsedFrame;
+        JobSystem::Counter loaded;
+    };
+
+    /**
+     * Constructor.
+     */
+    StreamingTerrain();
+
+    /**
+     * Destructor.
+     */
+    ~StreamingTerrain();
+
+    /**
+     * Hidden copy constructor.
+     */
+    StreamingTerrain(const StreamingTerrain&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    StreamingTerrain& operator=(const StreamingTerrain&);
+
+    /**
+     * Gets a tile, and requests it to be read if it is not yet.
+     */
+    Tile* requestTile(unsigned int level, unsigned int x, unsigned int z);
+
+    /**
+     * Gets a tile if it is resident, or NULL.
+     */
+    Tile* findResidentTile(unsigned int level, unsigned int x, unsigned int z) const;
+
+    /**
+     * Uploads the heights of a tile that were read to its height texture.
+     */
+    void uploadTile(Tile* tile);
+
+    /**
+     * Uploads the tiles that finished reading and evicts the tiles over the memory budget.
+     */
+    void updateTiles();
+
+    /**
+     * Gets the local bounds of a tile, from its heights or from the heights of its resident ancestors.
+     */
+    void getTileBounds(unsigned int level, unsigned int x, unsigned int z, BoundingBox* dst) const;
+
+    /**
+     * Selects the tiles of a subtree to draw. Returns false if the range of the level does not reach the tile.
+     */
+    bool selectTiles(Tile* tile, const Vector3& cameraPosition, Camera* camera);
+
+    /**
+     * Draws a selected tile with the grid mesh.
+     */
+    unsigned int drawTile(Tile* tile, bool wireframe);
+
+    std::string _tilePath;
+    std::string _materialPath;
+    unsigned int _tileSize;
+    unsigned int _levelCount;
+    Vector3 _size;
+    float _lodDistance;
+    size_t _memoryBudget;
+    size_t _memorySize;
+    unsigned int _residentTileCount;
+    BoundingBox _boundingBox;
+    Model* _grid;
+    Tile* _root;
+    std::map<unsigned long long, Tile*> _tiles;
+    std::vector<Tile*> _loadingTiles;
+    std::vector<Tile*> _selectedTiles;
+    unsigned int _frame;
+};
+
+}
+
+#endif
@@ -0,0 +1,152 @@
+#include "Base.h"
+#include "StringTable.h"
+#include "MemoryArena.h"
+
+// The number of handles in each chunk of the handle table.
+#define STRING_TABLE_CHUNK_SIZE 1024
+
+// The maximum number of chunks of the handle table, which bounds the number of strings.
+#define STRING_TABLE_MAX_CHUNKS 4096
+
+namespace gameplay
+{
+
+struct StringHash
+{
+    size_t operator()(const char* str) const
+    {
+        // FNV-1a
+        size_t hash = 2166136261u;
+        for (; *str; ++str)
+        {
+            hash = (hash ^ (unsigned char)*str) * 16777619u;
+        }
+        return hash;
+    }
+};
+
+struct StringEqual
+{
+    bool operator()(const char* a, const char* b) const
+    {
+        return strcmp(a, b) == 0;
+    }
+};
+
+struct StringTableData
+{
+    std::mutex mutex;
+    std::unordered_map<const char*, unsigned int, StringHash, StringEqual> handles;
+    MemoryArena* storage;
+    unsigned int count;
+    bool full;
+
+    StringTableData() : storage(NULL), count(0), full(false)
+    {
+    }
+};
+
+// The strings of the handles, read without locking. A chunk is published before any of its
+// handles is returned, and its entries never change once written.
+static std::atomic<const char**> __chunks[STRING_TABLE_MAX_CHUNKS];
+
+static StringTableData& getStringTableData()
+{
+    static StringTableData data;
+    return data;
+}
+
+// Adds a string to the table. Must be called with the table locked.
+static unsigned int addString(StringTableData& data, const char* str)
+{
+    const unsigned int handle = data.count;
+    const unsigned int chunk = handle / STRING_TABLE_CHUNK_SIZE;
+    if (chunk >= STRING_TABLE_MAX_CHUNKS)
+    {
+        // Keep running with the string treated as empty, and warn only once rather than for every string.
+        if (!data.full)
+        {
+            GP_WARN("String table is full; interning string '%s' and later new strings as the empty string.", str);
+            data.full = true;
+        }
+        return 0;
+    }
+
+    const char** strings = __chunks[chunk].load(std::memory_order_relaxed);
+    if (!strings)
+    {
+        strings = new const char*[STRING_TABLE_CHUNK_SIZE];
+        __chunks[chunk].store(strings, std::memory_order_release);
+    }
+
+    if (!data.storage)
+        data.storage = new MemoryArena();
+    const size_t length = strlen(str);
+    char* copy = (char*)data.storage->allocate(length + 1, 1);
+    memcpy(copy, str, length + 1);
+    strings[handle % STRING_TABLE_CHUNK_SIZE] = copy;
+    data.handles.insert(std::make_pair(copy, handle));
+    ++data.count;
+    return handle;
+}
+
+unsigned int StringTable::intern(const char* str)
+{
+    if (!str || !*str)
+        return 0;
+
+    StringTableData& data = getStringTableData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    if (data.count == 0)
+        addString(data, "");
+
+    std::unordered_map<const char*, unsigned int, StringHash, StringEqual>::const_iterator itr = data.handles.find(str);
+    if (itr != data.handles.end())
+        return itr->second;
+    return addString(data, str);
+}
+
+unsigned int StringTable::find(const char* str)
+{
+    if (!str || !*str)
+        return 0;
+
+    StringTableData& data = getStringTableData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    std::unordered_map<const char*, unsigned int, StringHash, StringEqual>::const_iterator itr = data.handles.find(str);
+    return itr != data.handles.end() ? itr->second : STRING_TABLE_NOT_FOUND;
+}
+
+const char* StringTable::get(unsigned int handle)
+{
+    // The empty string is not stored until the first string is interned.
+    if (handle == 0)
+        return "";
+
+    const char** strings = __chunks[handle / STRING_TABLE_CHUNK_SIZE].load(std::memory_order_acquire);
+    GP_ASSERT(strings);
+    return strings[handle % STRING_TABLE_CHUNK_SIZE];
+}
+
+unsigned int StringTable::getCount()
+{
+    StringTableData& data = getStringTableData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    return data.count > 0 ? data.count : 1;
+}
+
+void StringTable::finalize()
+{
+    StringTableData& data = getStringTableData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    for (unsigned int i = 0, count = (data.count + STRING_TABLE_CHUNK_SIZE - 1) / STRING_TABLE_CHUNK_SIZE; i < count && i < STRING_TABLE_MAX_CHUNKS; ++i)
+    {
+        delete[] __chunks[i].exchange(NULL);
+    }
+    std::unordered_map<const char*, unsigned int, StringHash, StringEqual>().swap(data.handles);
+    SAFE_DELETE(data.storage);
+    data.count = 0;
+    data.full = false;
+}
+
+}
@@ -0,0 +1,78 @@
+#ifndef STRINGTABLE_H_
+#define STRINGTABLE_H_
+
+// The handle of a string that has not been interned.
+#define STRING_TABLE_NOT_FOUND 0xFFFFFFFF
+
+namespace gameplay
+{
+
+/**
+ * Defines a global table of interned strings, identified by 32-bit handles.
+ *
+ * Interning a string stores one copy of it for the life of the program and returns the
+ * same handle for every string with the same characters, so that strings used as
+ * identifiers, such as node IDs and tag names, are stored and compared as integers.
+ * The empty string always has the handle 0.
+ *
+ * Strings are not removed from the table until the game shuts down, so it should only hold
+ * identifiers from a bounded set rather than arbitrary values. The table can be used from
+ * any thread.
+ *
+ * @script{ignore}
+ */
+class StringTable
+{
+    friend class Game;
+
+public:
+
+    /**
+     * Interns a string, adding it to the table if it is not already in it.
+     *
+     * @param str The string to intern, or NULL for the empty string.
+     *
+     * @return The handle of the string, or 0 if the table is full and the string is not
+     *      already in it, in which case a warning is logged once.
+     */
+    static unsigned int intern(const char* str);
+
+    /**
+     * Finds the handle of a string without adding it to the table.
+     *
+     * @param str The string to find, or NULL for the empty string.
+     *
+     * @return The handle of the string, or STRING_TABLE_NOT_FOUND if it has not been interned,
+     *      in which case nothing carries it as an identifier.
+     */
+    static unsigned int find(const char* str);
+
+    /**
+     * Gets the string of a handle.
+     *
+     * @param handle A handle returned by intern().
+     *
+     * @return The interned string, which stays valid until the game shuts down.
+     */
+    static const char* get(unsigned int handle);
+
+    /**
+     * Gets the number of strings in the table.
+     *
+     * @return The string count, including the empty string.
+     */
+    static unsigned int getCount();
+
+private:
+
+    StringTable();
+
+    /**
+     * Frees the strings of the table. Called during game shutdown, once nothing uses their handles.
+     */
+    static void finalize();
+};
+
+}
+
+#endif
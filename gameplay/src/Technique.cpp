@@ -7,7 +7,7 @@ namespace gameplay
 {
 
 Technique::Technique(const char* id, Material* material)
-    : _id(id ? id : ""), _material(material)
+    : _id(id ? id : ""), _material(material), _depthPrepass(false)
 {
     RenderState::_parent = material;
 }
@@ -63,9 +63,20 @@ void Technique::setNodeBinding(Node* node)
     }
 }
 
+void Technique::setDepthPrepass(bool depthPrepass)
+{
+    _depthPrepass = depthPrepass;
+}
+
+bool Technique::isDepthPrepass() const
+{
+    return _depthPrepass;
+}
+
 Technique* Technique::clone(Material* material, NodeCloneContext &context) const
 {
     Technique* technique = new Technique(getId(), material);
+    technique->_depthPrepass = _depthPrepass;
     for (std::vector<Pass*>::const_iterator it = _passes.begin(); it != _passes.end(); ++it)
     {
         Pass* pass = *it;
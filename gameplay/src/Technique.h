@@ -60,6 +60,30 @@ public:
      */
     void setNodeBinding(Node* node);
 
+    /**
+     * Sets whether models drawn by a render queue with this technique are drawn with a depth pre-pass.
+     *
+     * With a depth pre-pass, the render queue first draws the depth of the opaque models
+     * that use such techniques with the depth effect of their first pass (see
+     * Pass::getDepthEffect()) and writes to the color buffer disabled. The passes of the
+     * technique are then drawn with the depth test set to equal and depth writes disabled,
+     * so that their fragment shaders only run once per visible pixel. This pays off for
+     * expensive shaders with a lot of overdraw, at the cost of drawing the geometry twice.
+     *
+     * This can also be set in a material file with the 'depthPrepass' property of a technique.
+     * It is disabled by default.
+     *
+     * @param depthPrepass true to draw the technique with a depth pre-pass.
+     */
+    void setDepthPrepass(bool depthPrepass);
+
+    /**
+     * Determines whether models drawn by a render queue with this technique are drawn with a depth pre-pass.
+     *
+     * @return true if the technique is drawn with a depth pre-pass.
+     */
+    bool isDepthPrepass() const;
+
 private:
 
     /**
@@ -87,6 +111,7 @@ private:
     std::string _id;
     Material* _material;
     std::vector<Pass*> _passes;
+    bool _depthPrepass;
 };
 
 }
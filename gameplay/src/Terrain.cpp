@@ -3,6 +3,11 @@
 #include "TerrainPatch.h"
 #include "Node.h"
 #include "FileSystem.h"
+#include "Scene.h"
+#include "GLStateCache.h"
+#include "Image.h"
+#include "Game.h"
+#include "Bundle.h"
 
 namespace gameplay
 {
@@ -25,20 +30,44 @@ static const float DEFAULT_TERRAIN_HEIGHT_RATIO = 0.3f;
 // Terrain dirty flags
 static const unsigned int DIRTY_FLAG_INVERSE_WORLD = 1;
 
+// The number of positions transformed together by getHeights, in arrays on the stack.
+static const unsigned int TERRAIN_HEIGHT_QUERY_BLOCK_SIZE = 64;
+
+// The number of positions from which getHeights splits its queries across the job system.
+static const unsigned int TERRAIN_PARALLEL_HEIGHT_QUERIES = 4096;
+
 static float getDefaultHeight(unsigned int width, unsigned int height);
 
+static HeightField::Storage parseHeightStorage(const char* storage);
+
+static int parseChannel(const char* channel);
+
+static void loadFoliage(Terrain* terrain, Properties* properties);
+
 Terrain::Terrain() : Drawable(),
-    _heightfield(NULL), _normalMap(NULL), _flags(FRUSTUM_CULLING | LEVEL_OF_DETAIL),
+    _heightfield(NULL), _normalMap(NULL), _splatLayers(NULL), _splatDirty(true), _flags(FRUSTUM_CULLING | LEVEL_OF_DETAIL),
     _dirtyFlags(DIRTY_FLAG_INVERSE_WORLD)
 {
 }
 
 Terrain::~Terrain()
 {
+    for (size_t i = 0, count = _foliage.size(); i < count; ++i)
+    {
+        SAFE_DELETE(_foliage[i]);
+    }
     for (size_t i = 0, count = _patches.size(); i < count; ++i)
     {
         SAFE_DELETE(_patches[i]);
     }
+    for (std::map<unsigned int, IndexBuffers>::iterator itr = _indexBuffers.begin(); itr != _indexBuffers.end(); ++itr)
+    {
+        for (unsigned int i = 0; i < TerrainPatch::EDGE_MASK_COUNT; ++i)
+        {
+            GLStateCache::deleteBuffer(itr->second.buffers[i]);
+        }
+    }
+    SAFE_RELEASE(_splatLayers);
     SAFE_RELEASE(_normalMap);
     SAFE_RELEASE(_heightfield);
 }
@@ -101,11 +130,13 @@ Terrain* Terrain::create(const char* path, Properties* properties)
             return NULL;
         }
 
+        HeightField::Storage storage = parseHeightStorage(pHeightmap->getString("storage"));
+
         std::string ext = FileSystem::getExtension(heightmap.c_str());
         if (ext == ".PNG")
         {
             // Read normalized height values from heightmap image
-            heightfield = HeightField::createFromImage(heightmap.c_str(), 0, 1);
+            heightfield = HeightField::createFromImage(heightmap.c_str(), 0, 1, storage);
         }
         else if (ext == ".RAW" || ext == ".R16")
         {
@@ -120,7 +151,7 @@ Terrain* Terrain::create(const char* path, Properties* properties)
             }
 
             // Read normalized height values from RAW file
-            heightfield = HeightField::createFromRAW(heightmap.c_str(), (unsigned int)imageSize.x, (unsigned int)imageSize.y, 0, 1);
+            heightfield = HeightField::createFromRAW(heightmap.c_str(), (unsigned int)imageSize.x, (unsigned int)imageSize.y, 0, 1, storage);
         }
         else
         {
@@ -282,13 +313,14 @@ Terrain* Terrain::create(HeightField* heightfield, const Vector3& scale,
         z1 = z;
         z2 = std::min(z1 + patchSize, height-1);
 
+        column = 0;
         for (unsigned int x = 0; x < width-1; x = x2, ++column)
         {
             x1 = x;
             x2 = std::min(x1 + patchSize, width-1);
 
             // Create this patch
-            TerrainPatch* patch = TerrainPatch::create(terrain, terrain->_patches.size(), row, column, heightfield->getArray(), width, height, x1, z1, x2, z2, -halfWidth, -halfHeight, maxStep, skirtScale);
+            TerrainPatch* patch = TerrainPatch::create(terrain, terrain->_patches.size(), row, column, heightfield, width, height, x1, z1, x2, z2, -halfWidth, -halfHeight, maxStep, skirtScale);
             terrain->_patches.push_back(patch);
 
             // Append the new patch's local bounds to the terrain local bounds
@@ -296,9 +328,22 @@ Terrain* Terrain::create(HeightField* heightfield, const Vector3& scale,
         }
     }
 
+    // Link each patch to its neighbors, whose levels its edges are stitched to
+    for (size_t i = 0, count = terrain->_patches.size(); i < count; ++i)
+    {
+        TerrainPatch* patch = terrain->_patches[i];
+        patch->_neighbors[TerrainPatch::EDGE_WEST] = patch->_column > 0 ? terrain->_patches[i - 1] : NULL;
+        patch->_neighbors[TerrainPatch::EDGE_EAST] = patch->_column + 1 < column ? terrain->_patches[i + 1] : NULL;
+        patch->_neighbors[TerrainPatch::EDGE_NORTH] = patch->_row > 0 ? terrain->_patches[i - column] : NULL;
+        patch->_neighbors[TerrainPatch::EDGE_SOUTH] = patch->_row + 1 < row ? terrain->_patches[i + column] : NULL;
+    }
+
     // Read additional layer information from properties (if specified)
     if (properties)
     {
+        if (properties->getBool("splatting"))
+            terrain->setFlag(TEXTURE_ARRAY_SPLATTING, true);
+
         // Parse terrain layers
         Properties* lp;
         int index = -1;
@@ -340,19 +385,7 @@ Terrain* Terrain::create(HeightField* heightfield, const Vector3& scale,
                     {
                         blendMapPtr = blendMap.c_str();
                     }
-                    const char* channel = b->getString("channel");
-                    if (channel && strlen(channel) > 0)
-                    {
-                        char c = std::toupper(channel[0]);
-                        if (c == 'R' || c == '0')
-                            blendChannel = 0;
-                        else if (c == 'G' || c == '1')
-                            blendChannel = 1;
-                        else if (c == 'B' || c == '2')
-                            blendChannel = 2;
-                        else if (c == 'A' || c == '3')
-                            blendChannel = 3;
-                    }
+                    blendChannel = parseChannel(b->getString("channel"));
                 }
 
                 // Get patch row/columns that this layer applies to.
@@ -366,6 +399,10 @@ Terrain* Terrain::create(HeightField* heightfield, const Vector3& scale,
                     GP_WARN("Failed to load terrain layer: %s", textureMap.c_str());
                 }
             }
+            else if (strcmp(lp->getNamespace(), "foliage") == 0)
+            {
+                loadFoliage(terrain, lp);
+            }
         }
     }
 
@@ -401,6 +438,17 @@ void Terrain::setNode(Node* node)
 void Terrain::transformChanged(Transform* transform, long cookie)
 {
     _dirtyFlags |= DIRTY_FLAG_INVERSE_WORLD;
+
+    // Foliage instances are scattered in world space
+    for (size_t i = 0, count = _foliage.size(); i < count; ++i)
+    {
+        _foliage[i]->invalidate();
+    }
+}
+
+void Terrain::transformsChanged(Transform* const* transforms, unsigned int count, long cookie)
+{
+    transformChanged(NULL, cookie);
 }
 
 const Matrix& Terrain::getInverseWorldMatrix() const
@@ -430,6 +478,16 @@ bool Terrain::setLayer(int index, const char* texturePath, const Vector2& textur
     if (!texturePath)
         return false;
 
+    // Repack the splatting layers, which every patch's material refers to
+    _splatDirty = true;
+    if (isFlagSet(TEXTURE_ARRAY_SPLATTING))
+    {
+        for (size_t i = 0, count = _patches.size(); i < count; ++i)
+        {
+            _patches[i]->setMaterialDirty();
+        }
+    }
+
     // Set layer on applicable patches
     bool result = true;
     for (size_t i = 0, count = _patches.size(); i < count; ++i)
@@ -471,9 +529,9 @@ void Terrain::setFlag(Flags flag, bool on)
         }
     }
 
-    if (flag == DEBUG_PATCHES && changed)
+    if ((flag == DEBUG_PATCHES || flag == TEXTURE_ARRAY_SPLATTING) && changed)
     {
-        // Dirty all materials since they need to be updated to support debug drawing
+        // Dirty all materials since they need to be updated to support debug drawing or splatting
         for (size_t i = 0, count = _patches.size(); i < count; ++i)
         {
             _patches[i]->setMaterialDirty();
@@ -529,16 +587,246 @@ float Terrain::getHeight(float x, float z) const
     return height;
 }
 
+void Terrain::getHeights(const float* positions, unsigned int count, float* heights, Vector3* normals) const
+{
+    GP_ASSERT(positions);
+    GP_ASSERT(heights);
+
+    // The inverse world matrix is cached lazily, so it is resolved here rather than by the jobs.
+    const Matrix& inverseWorld = getInverseWorldMatrix();
+    float heightScale = _localScale.y;
+    if (_node)
+    {
+        Vector3 worldScale;
+        _node->getWorldMatrix().getScale(&worldScale);
+        heightScale *= worldScale.y;
+    }
+
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem && count >= TERRAIN_PARALLEL_HEIGHT_QUERIES)
+    {
+        jobSystem->parallelFor(0, count, [this, &inverseWorld, heightScale, positions, heights, normals](unsigned int first, unsigned int last)
+        {
+            getHeights(inverseWorld, heightScale, positions, first, last, heights, normals);
+        }, TERRAIN_HEIGHT_QUERY_BLOCK_SIZE * 4);
+    }
+    else
+    {
+        getHeights(inverseWorld, heightScale, positions, 0, count, heights, normals);
+    }
+}
+
+void Terrain::getHeights(const Matrix& inverseWorld, float heightScale, const float* positions, unsigned int first, unsigned int last,
+                         float* heights, Vector3* normals) const
+{
+    GP_ASSERT(_heightfield);
+
+    const float* m = inverseWorld.m;
+    const float halfColumns = (_heightfield->getColumnCount() - 1) * 0.5f;
+    const float halfRows = (_heightfield->getRowCount() - 1) * 0.5f;
+    float columns[TERRAIN_HEIGHT_QUERY_BLOCK_SIZE];
+    float rows[TERRAIN_HEIGHT_QUERY_BLOCK_SIZE];
+    float neighbors[TERRAIN_HEIGHT_QUERY_BLOCK_SIZE];
+    float offsets[TERRAIN_HEIGHT_QUERY_BLOCK_SIZE];
+    float slopes[2][TERRAIN_HEIGHT_QUERY_BLOCK_SIZE];
+    for (unsigned int start = first; start < last; start += TERRAIN_HEIGHT_QUERY_BLOCK_SIZE)
+    {
+        const unsigned int blockCount = std::min(last - start, TERRAIN_HEIGHT_QUERY_BLOCK_SIZE);
+
+        // Transform the world x,z coords into local heightfield coordinates, as getHeight() does.
+        for (unsigned int i = 0; i < blockCount; ++i)
+        {
+            const float x = positions[(start + i) * 2];
+            const float z = positions[(start + i) * 2 + 1];
+            columns[i] = m[0] * x + m[8] * z + m[12] + halfColumns;
+            rows[i] = m[2] * x + m[10] * z + m[14] + halfRows;
+        }
+
+        float* blockHeights = heights + start;
+        _heightfield->getHeights(columns, rows, blockCount, blockHeights);
+
+        if (normals)
+        {
+            // The slopes of the unscaled heights along the columns and the rows, by central differences.
+            for (unsigned int axis = 0; axis < 2; ++axis)
+            {
+                float* coordinates = axis == 0 ? columns : rows;
+                float* slope = slopes[axis];
+                for (unsigned int i = 0; i < blockCount; ++i)
+                    offsets[i] = coordinates[i];
+                for (unsigned int i = 0; i < blockCount; ++i)
+                    coordinates[i] = offsets[i] + 1.0f;
+                _heightfield->getHeights(columns, rows, blockCount, slope);
+                for (unsigned int i = 0; i < blockCount; ++i)
+                    coordinates[i] = offsets[i] - 1.0f;
+                _heightfield->getHeights(columns, rows, blockCount, neighbors);
+                for (unsigned int i = 0; i < blockCount; ++i)
+                {
+                    slope[i] = (slope[i] - neighbors[i]) * 0.5f;
+                    coordinates[i] = offsets[i];
+                }
+            }
+
+            // Normals transform from local to world space by the transpose of the inverse world matrix.
+            for (unsigned int i = 0; i < blockCount; ++i)
+            {
+                const float nx = -slopes[0][i];
+                const float nz = -slopes[1][i];
+                Vector3& normal = normals[start + i];
+                normal.set(m[0] * nx + m[1] + m[2] * nz, m[4] * nx + m[5] + m[6] * nz, m[8] * nx + m[9] + m[10] * nz);
+                normal.normalize();
+            }
+        }
+
+        for (unsigned int i = 0; i < blockCount; ++i)
+            blockHeights[i] *= heightScale;
+    }
+}
+
 unsigned int Terrain::draw(bool wireframe)
 {
+    GP_PROFILE_GPU_SCOPE("Terrain::draw");
+
+    // Select the levels of all patches together, since each depends on its neighbors
+    Scene* scene = _node ? _node->getScene() : NULL;
+    Camera* camera = scene ? scene->getActiveCamera() : NULL;
+    if (camera)
+        TerrainPatch::updateLevels(_patches, camera);
+
     size_t visibleCount = 0;
     for (size_t i = 0, count = _patches.size(); i < count; ++i)
     {
         visibleCount += _patches[i]->draw(wireframe);
     }
+
+    // Foliage is drawn around the camera, and never as wireframe
+    if (camera && !wireframe)
+    {
+        for (size_t i = 0, count = _foliage.size(); i < count; ++i)
+        {
+            visibleCount += _foliage[i]->draw(camera);
+        }
+    }
     return visibleCount;
 }
 
+TerrainFoliage* Terrain::addFoliage(Model* model, const char* densityMapPath, int densityChannel, const TerrainFoliage::Parameters& parameters)
+{
+    GP_ASSERT(model);
+
+    Image* densityMap = NULL;
+    if (densityMapPath)
+    {
+        densityMap = Image::create(densityMapPath);
+        if (densityMap == NULL)
+        {
+            GP_WARN("Failed to load terrain foliage density map: %s", densityMapPath);
+            return NULL;
+        }
+    }
+
+    TerrainFoliage* foliage = new TerrainFoliage(this, model, densityMap, densityChannel, parameters);
+    SAFE_RELEASE(densityMap);
+    _foliage.push_back(foliage);
+    return foliage;
+}
+
+unsigned int Terrain::getFoliageCount() const
+{
+    return (unsigned int)_foliage.size();
+}
+
+TerrainFoliage* Terrain::getFoliage(unsigned int index) const
+{
+    GP_ASSERT(index < _foliage.size());
+    return _foliage[index];
+}
+
+void Terrain::removeFoliage(TerrainFoliage* foliage)
+{
+    std::vector<TerrainFoliage*>::iterator itr = std::find(_foliage.begin(), _foliage.end(), foliage);
+    if (itr != _foliage.end())
+    {
+        _foliage.erase(itr);
+        SAFE_DELETE(foliage);
+    }
+}
+
+bool Terrain::updateSplatting()
+{
+    if (!_splatDirty)
+        return _splatLayers != NULL;
+
+    _splatDirty = false;
+    SAFE_RELEASE(_splatLayers);
+    _splatPaths.clear();
+
+    if (!Texture::isArraySupported())
+    {
+        GP_WARN("Texture arrays are not supported; drawing terrain layers without splatting.");
+        return false;
+    }
+
+    // Pack the distinct textures of all patch layers into one texture array
+    std::vector<Image*> images;
+    bool loaded = true;
+    for (size_t i = 0, count = _patches.size(); i < count; ++i)
+    {
+        TerrainPatch* patch = _patches[i];
+        for (std::set<TerrainPatch::Layer*, TerrainPatch::LayerCompare>::iterator itr = patch->_layers.begin(); itr != patch->_layers.end(); ++itr)
+        {
+            const char* path = patch->_samplers[(*itr)->textureIndex]->getTexture()->getPath();
+            if (std::find(_splatPaths.begin(), _splatPaths.end(), path) != _splatPaths.end())
+                continue;
+
+            Image* image = Image::create(path);
+            if (!image)
+            {
+                loaded = false;
+                break;
+            }
+            _splatPaths.push_back(path);
+            images.push_back(image);
+        }
+    }
+
+    if (loaded && !images.empty())
+    {
+        Texture* texture = Texture::createArray(&images[0], images.size(), true);
+        if (texture)
+        {
+            _splatLayers = Texture::Sampler::create(texture);
+            _splatLayers->setWrapMode(Texture::REPEAT, Texture::REPEAT);
+            _splatLayers->setFilterMode(Texture::LINEAR_MIPMAP_LINEAR, Texture::LINEAR);
+            texture->release();
+        }
+    }
+    for (size_t i = 0, count = images.size(); i < count; ++i)
+    {
+        SAFE_RELEASE(images[i]);
+    }
+
+    if (!_splatLayers)
+    {
+        GP_WARN("Failed to pack terrain layers into a texture array; drawing them without splatting.");
+        _splatPaths.clear();
+        return false;
+    }
+
+    // Bake the splat map of each patch, loading each blend map only once
+    std::map<std::string, Image*> blendImages;
+    for (size_t i = 0, count = _patches.size(); i < count; ++i)
+    {
+        _patches[i]->updateSplatMap(blendImages);
+    }
+    for (std::map<std::string, Image*>::iterator itr = blendImages.begin(); itr != blendImages.end(); ++itr)
+    {
+        SAFE_RELEASE(itr->second);
+    }
+
+    return true;
+}
+
 Drawable* Terrain::clone(NodeCloneContext& context)
 {
     // TODO:
@@ -551,4 +839,92 @@ static float getDefaultHeight(unsigned int width, unsigned int height)
     return ((width + height) * 0.5f) * DEFAULT_TERRAIN_HEIGHT_RATIO;
 }
 
+static HeightField::Storage parseHeightStorage(const char* storage)
+{
+    if (storage == NULL || strcmp(storage, "FLOAT") == 0)
+        return HeightField::STORAGE_FLOAT;
+    if (strcmp(storage, "QUANTIZED") == 0)
+        return HeightField::STORAGE_QUANTIZED;
+    if (strcmp(storage, "MAPPED") == 0)
+        return HeightField::STORAGE_MAPPED;
+
+    GP_WARN("Unsupported heightmap storage ('%s'), using FLOAT.", storage);
+    return HeightField::STORAGE_FLOAT;
+}
+
+static int parseChannel(const char* channel)
+{
+    if (channel && strlen(channel) > 0)
+    {
+        char c = std::toupper(channel[0]);
+        if (c == 'G' || c == '1')
+            return 1;
+        else if (c == 'B' || c == '2')
+            return 2;
+        else if (c == 'A' || c == '3')
+            return 3;
+    }
+    return 0;
+}
+
+static void loadFoliage(Terrain* terrain, Properties* properties)
+{
+    // The mesh is given as a bundle url ("path#id")
+    std::string url = properties->getString("mesh", "");
+    size_t pos = url.rfind('#');
+    if (pos == std::string::npos)
+    {
+        GP_WARN("Missing or invalid 'mesh' url ('%s') in terrain foliage definition.", url.c_str());
+        return;
+    }
+    Bundle* bundle = Bundle::create(url.substr(0, pos).c_str());
+    Mesh* mesh = bundle ? bundle->loadMesh(url.substr(pos + 1).c_str()) : NULL;
+    SAFE_RELEASE(bundle);
+    if (mesh == NULL)
+    {
+        GP_WARN("Failed to load terrain foliage mesh: %s", url.c_str());
+        return;
+    }
+    Model* model = Model::create(mesh);
+    SAFE_RELEASE(mesh);
+
+    const char* materialPath = properties->getString("material");
+    if (materialPath == NULL || model->setMaterial(materialPath) == NULL)
+    {
+        GP_WARN("Failed to load terrain foliage material: %s", materialPath ? materialPath : "");
+        SAFE_RELEASE(model);
+        return;
+    }
+
+    std::string densityMap;
+    const char* densityMapPtr = NULL;
+    int densityChannel = 0;
+    Properties* d = properties->getNamespace("densityMap", true);
+    if (d)
+    {
+        if (d->getPath("path", &densityMap))
+            densityMapPtr = densityMap.c_str();
+        densityChannel = parseChannel(d->getString("channel"));
+    }
+
+    TerrainFoliage::Parameters parameters;
+    if (properties->exists("density"))
+        parameters.density = properties->getFloat("density");
+    if (properties->exists("viewDistance"))
+        parameters.viewDistance = properties->getFloat("viewDistance");
+    if (properties->exists("fadeDistance"))
+        parameters.fadeDistance = properties->getFloat("fadeDistance");
+    Vector2 scale;
+    if (properties->getVector2("scale", &scale))
+    {
+        parameters.minScale = scale.x;
+        parameters.maxScale = scale.y;
+    }
+    if (properties->exists("seed"))
+        parameters.seed = (unsigned int)properties->getInt("seed");
+
+    terrain->addFoliage(model, densityMapPtr, densityChannel, parameters);
+    SAFE_RELEASE(model);
+}
+
 }
@@ -9,6 +9,7 @@
 #include "Texture.h"
 #include "BoundingBox.h"
 #include "TerrainPatch.h"
+#include "TerrainFoliage.h"
 
 namespace gameplay
 {
@@ -29,6 +30,9 @@ class TerrainAutoBindingResolver;
  *    compatible with many external tools such as World Machine, Unity and more. The file
  *    extension must be either .raw or .r16 for RAW files.
  *
+ * The 'storage' property of a heightmap block selects how its heights are kept in memory:
+ * FLOAT (the default), QUANTIZED to 16 bits, or MAPPED from a RAW16 file (see HeightField::Storage).
+ *
  * Physics/collision is supported by setting a rigid body collision object on the Node that
  * the terrain is attached to. The collision shape should be specified using
  * PhysicsCollisionShape::heightfield(), which will utilize the internal height array of the
@@ -42,7 +46,10 @@ class TerrainAutoBindingResolver;
  * of supported layers depends on the target hardware, although typically 2-3 levels is
  * sufficient. Multiple blend maps for different layers can be packed into different channels
  * of a single texture for more efficient texture utilization. Levels can be applied across
- * the entire terrain, or in more complex cases, for individual patches only.
+ * the entire terrain, or in more complex cases, for individual patches only. On desktop
+ * platforms the TEXTURE_ARRAY_SPLATTING flag (or the "splatting" terrain property) draws any
+ * number of layers from a single texture array, with the blend weights of each patch baked
+ * into one splat map.
  *
  * Surface lighting is achieved with either vertex normals or with a normal map. If a
  * normal map is used, it should be an object-space normal map containing normal vectors for
@@ -67,26 +74,31 @@ class TerrainAutoBindingResolver;
  * Using too large a number for detailLevels can result in excessive popping in the distance
  * for very hilly terrains, so a smaller number (2-3) often works best in these cases.
  *
- * Finally, when LOD is enabled, cracks can begin to appear between terrain patches of
- * different LOD levels. If the cracks are only minor (depends on your terrain topology
- * and textures used), an acceptable approach might be to simply use a background clear
- * color that closely matches your terrain to make the cracks much less visible. However,
- * often that is not acceptable, so the Terrain class also supports a simple solution called
- * "vertical skirts". When enabled (via the skirtScale parameter in the terrain file), a vertical
- * edge will extend down along the sides of all terrain patches, which fills in the crack.
- * This is a very fast approach as it adds only a small number of triangles per patch and requires
- * zero extra CPU time or draw calls, which are often needed for more complex stitching
- * approaches. In practice, the skirts are often not noticeable at all unless the LOD variation
- * is very large and the terrain is excessively hilly on the edge of a LOD transition.
+ * Finally, when LOD is enabled, neighboring patches never differ by more than one LOD level,
+ * and the edges of a patch next to a coarser neighbor are stitched to the neighbor's vertices,
+ * so no cracks appear between patches. The stitched index buffers are shared by all patches
+ * of the same size. The levels of all patches are selected in one pass each time the terrain
+ * is drawn. Tiny gaps from rounding can still show along the stitched edges, so the Terrain
+ * class also supports "vertical skirts". When enabled (via the skirtScale parameter in the
+ * terrain file), a vertical edge will extend down along the sides of all terrain patches,
+ * which fills in any remaining gap. This adds only a small number of triangles per patch.
+ * In practice, the skirts are often not noticeable at all.
+ *
+ * Ground cover such as grass, rocks and trees can be scattered over the terrain with foliage
+ * layers (see TerrainFoliage), added with the addFoliage method or with "foliage" sections in
+ * terrain properties files. Foliage is scattered from density maps near the camera only, and
+ * drawn with one instanced draw per layer after the patches.
  *
  * @see http://gameplay3d.github.io/GamePlay/docs/file-formats.html#wiki-Terrain
  */
 class Terrain : public Ref, public Drawable, public Transform::Listener
 {
+    friend class NavigationMesh;
     friend class Node;
     friend class PhysicsController;
     friend class PhysicsRigidBody;
     friend class TerrainPatch;
+    friend class TerrainFoliage;
     friend class TerrainAutoBindingResolver;
 
 public:
@@ -116,7 +128,19 @@ public:
           * "detailLevels" was not set to a value greater than 1 in the terrain
           * properties file at creation time.
           */
-         LEVEL_OF_DETAIL = 8
+         LEVEL_OF_DETAIL = 8,
+
+         /**
+          * Draws all layers of a patch in one pass from a texture array (off by default).
+          *
+          * The textures of all layers are packed into one texture array and the blend
+          * weights of each patch are baked into a single RGBA splat map, so every patch
+          * uses the same shader permutation regardless of its layers. Each patch blends
+          * at most the four layers covering most of it. This flag is ignored, and the
+          * layers are drawn as usual, when texture arrays are not supported or when the
+          * layer textures do not all share the same size and format.
+          */
+         TEXTURE_ARRAY_SPLATTING = 16
     };
 
     /**
@@ -222,6 +246,22 @@ public:
      */
     float getHeight(float x, float z) const;
 
+    /**
+     * Gets the world-space heights of the terrain at an array of positions on the X,Z plane,
+     * as getHeight() does for each of them, and optionally the world-space normals there.
+     *
+     * The positions are transformed and interpolated in batches, and large batches are split
+     * across the job system, so this is much faster than calling getHeight() for many points,
+     * such as to place foliage or snap agents to the ground.
+     *
+     * @param positions The X and Z coordinates of each position, in world space.
+     * @param count The number of positions.
+     * @param heights Set to the height at each position.
+     * @param normals Set to the unit normal of the terrain at each position, or NULL.
+     * @script{ignore}
+     */
+    void getHeights(const float* positions, unsigned int count, float* heights, Vector3* normals = NULL) const;
+
     /**
      * Sets the detail textures information for a terrain layer.
      *
@@ -262,6 +302,54 @@ public:
                   const char* blendPath = NULL, int blendChannel = 0,
                   int row = -1, int column = -1);
 
+    /**
+     * Adds a foliage layer that scatters instances of a model over the terrain.
+     *
+     * The material of the model must be instanced (see TerrainFoliage). The terrain keeps a
+     * reference to the model and to the density map for as long as the layer exists.
+     *
+     * @param model The model to scatter.
+     * @param densityMapPath Path to the image whose channel gives the density of the instances
+     *      over the terrain, stretched over the entire terrain, or NULL for a uniform density.
+     * @param densityChannel Channel of the density map to sample (0 == R, 1 == G, 2 == B, 3 == A).
+     * @param parameters The parameters of the scattering.
+     *
+     * @return The new foliage layer, or NULL if the density map could not be loaded.
+     *
+     * @script{ignore}
+     */
+    TerrainFoliage* addFoliage(Model* model, const char* densityMapPath = NULL, int densityChannel = 0,
+                               const TerrainFoliage::Parameters& parameters = TerrainFoliage::Parameters());
+
+    /**
+     * Gets the number of foliage layers of the terrain.
+     *
+     * @return The number of foliage layers.
+     *
+     * @script{ignore}
+     */
+    unsigned int getFoliageCount() const;
+
+    /**
+     * Gets a foliage layer of the terrain.
+     *
+     * @param index The index of the foliage layer.
+     *
+     * @return The foliage layer.
+     *
+     * @script{ignore}
+     */
+    TerrainFoliage* getFoliage(unsigned int index) const;
+
+    /**
+     * Removes and destroys a foliage layer of the terrain.
+     *
+     * @param foliage The foliage layer to remove.
+     *
+     * @script{ignore}
+     */
+    void removeFoliage(TerrainFoliage* foliage);
+
     /**
      * @see Drawable#draw
      */
@@ -318,22 +406,54 @@ private:
      */
     void transformChanged(Transform* transform, long cookie);
 
+    /**
+     * @see Transform::Listener::transformsChanged.
+     */
+    void transformsChanged(Transform* const* transforms, unsigned int count, long cookie);
+
     /**
      * Returns the terrain's inverse world matrix, used for transforming world-space positions
      * to local positions for height lookups.
      */
     const Matrix& getInverseWorldMatrix() const;
 
+    /**
+     * Gets the heights and normals of a range of the positions of getHeights().
+     */
+    void getHeights(const Matrix& inverseWorld, float heightScale, const float* positions, unsigned int first, unsigned int last,
+                    float* heights, Vector3* normals) const;
+
     /**
      * Returns the local bounding box for this patch, at the base LOD level.
      */
     BoundingBox getBoundingBox(bool worldSpace) const;
 
+    /**
+     * Rebuilds the layer texture array and the patch splat maps when the layers changed.
+     *
+     * @return true if the terrain can be drawn with texture array splatting.
+     */
+    bool updateSplatting();
+
+    /**
+     * The index buffers shared by all patches of one vertex grid size, one per edge mask.
+     */
+    struct IndexBuffers
+    {
+        IndexBufferHandle buffers[TerrainPatch::EDGE_MASK_COUNT];
+        unsigned int indexCount;
+    };
+
     std::string _materialPath;
     HeightField* _heightfield;
     Vector3 _localScale;
     std::vector<TerrainPatch*> _patches;
+    std::vector<TerrainFoliage*> _foliage;
+    std::map<unsigned int, IndexBuffers> _indexBuffers;
     Texture::Sampler* _normalMap;
+    Texture::Sampler* _splatLayers;
+    std::vector<std::string> _splatPaths;
+    bool _splatDirty;
     unsigned int _flags;
     mutable Matrix _inverseWorldMatrix;
     mutable unsigned int _dirtyFlags;
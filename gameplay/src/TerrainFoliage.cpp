@@ -0,0 +1,317 @@
+#include "Base.h"
+#include "TerrainFoliage.h"
+#include "Terrain.h"
+#include "TerrainPatch.h"
+#include "Camera.h"
+#include "Node.h"
+#include "GLStateCache.h"
+#include "FrameCapture.h"
+
+namespace gameplay
+{
+
+// The largest number of instances scattered over a single patch.
+static const unsigned int TERRAIN_FOLIAGE_MAX_PATCH_INSTANCES = 16384;
+
+// The number of patches whose instances may be scattered by a single frame.
+static const unsigned int TERRAIN_FOLIAGE_PATCHES_PER_FRAME = 4;
+
+// The ratio of the view distance beyond which the instances of a patch are discarded.
+static const float TERRAIN_FOLIAGE_DISCARD_DISTANCE_RATIO = 1.5f;
+
+/**
+ * Returns the next value of a xorshift random sequence, from 0 to 1.
+ */
+static float nextRandom(unsigned int* state)
+{
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return (x >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * Returns the distance from a point to a box, which is 0 for points within it.
+ */
+static float distanceToBox(const Vector3& point, const BoundingBox& box)
+{
+    Vector3 closest;
+    Vector3::clamp(point, box.min, box.max, &closest);
+    return point.distance(closest);
+}
+
+TerrainFoliage::Parameters::Parameters()
+    : density(1.0f), viewDistance(100.0f), fadeDistance(20.0f), minScale(1.0f), maxScale(1.0f), seed(1)
+{
+}
+
+TerrainFoliage::PatchInstances::PatchInstances() : generated(false)
+{
+}
+
+TerrainFoliage::TerrainFoliage(Terrain* terrain, Model* model, Image* densityMap, int densityChannel, const Parameters& parameters)
+    : _terrain(terrain), _model(model), _densityMap(densityMap), _densityChannel(densityChannel), _parameters(parameters),
+    _extent(0.0f), _instanceBuffer(0), _bindingNode(NULL), _drawnInstanceCount(0)
+{
+    GP_ASSERT(_terrain);
+    GP_ASSERT(_model && _model->getMesh());
+
+    _model->addRef();
+    if (_densityMap)
+        _densityMap->addRef();
+    _patches.resize(_terrain->_patches.size());
+
+    // The bounds of each patch are expanded by the extent of the largest instance, so that
+    // instances over the edges of a patch are not culled with it.
+    const BoundingSphere& sphere = _model->getMesh()->getBoundingSphere();
+    _extent = (sphere.center.length() + sphere.radius) * std::max(_parameters.minScale, _parameters.maxScale);
+
+#ifdef GP_USE_INSTANCING
+    if (!(glVertexAttribDivisor && glDrawElementsInstanced && glDrawArraysInstanced))
+#endif
+    {
+        GP_WARN("Instancing is not supported; terrain foliage will not be drawn.");
+    }
+}
+
+TerrainFoliage::~TerrainFoliage()
+{
+    if (_instanceBuffer)
+    {
+        GLStateCache::deleteBuffer(_instanceBuffer);
+    }
+    SAFE_RELEASE(_densityMap);
+    SAFE_RELEASE(_model);
+}
+
+Model* TerrainFoliage::getModel() const
+{
+    return _model;
+}
+
+const TerrainFoliage::Parameters& TerrainFoliage::getParameters() const
+{
+    return _parameters;
+}
+
+void TerrainFoliage::setViewDistance(float viewDistance, float fadeDistance)
+{
+    _parameters.viewDistance = viewDistance;
+    _parameters.fadeDistance = fadeDistance;
+}
+
+void TerrainFoliage::invalidate()
+{
+    for (size_t i = 0, count = _patches.size(); i < count; ++i)
+    {
+        std::vector<float>().swap(_patches[i].instances);
+        _patches[i].generated = false;
+    }
+}
+
+unsigned int TerrainFoliage::getDrawnInstanceCount() const
+{
+    return _drawnInstanceCount;
+}
+
+float TerrainFoliage::getDensity(float u, float v) const
+{
+    if (_densityMap == NULL)
+        return 1.0f;
+
+    unsigned int pixelSize = _densityMap->getFormat() == Image::RGBA ? 4 : 3;
+    if ((unsigned int)_densityChannel >= pixelSize)
+        return 1.0f;
+
+    unsigned int column = (unsigned int)(std::min(std::max(u, 0.0f), 1.0f) * (_densityMap->getWidth() - 1) + 0.5f);
+    unsigned int row = (unsigned int)(std::min(std::max(v, 0.0f), 1.0f) * (_densityMap->getHeight() - 1) + 0.5f);
+    return _densityMap->getData()[(row * _densityMap->getWidth() + column) * pixelSize + _densityChannel] / 255.0f;
+}
+
+void TerrainFoliage::generate(const TerrainPatch* patch, PatchInstances* patchInstances)
+{
+    GP_PROFILE_SCOPE("TerrainFoliage::generate");
+
+    patchInstances->generated = true;
+    patchInstances->instances.clear();
+
+    const HeightField* heightfield = _terrain->_heightfield;
+    GP_ASSERT(heightfield);
+    const unsigned int columnCount = heightfield->getColumnCount();
+    const unsigned int rowCount = heightfield->getRowCount();
+
+    // The number of candidates follows the world area of the patch, so that the density does not
+    // depend on the scale of the terrain.
+    const BoundingBox& bounds = patch->getBoundingBox(true);
+    float area = (bounds.max.x - bounds.min.x) * (bounds.max.z - bounds.min.z);
+    unsigned int candidateCount = (unsigned int)std::min(area * _parameters.density, (float)TERRAIN_FOLIAGE_MAX_PATCH_INSTANCES);
+    if (candidateCount == 0)
+        return;
+
+    // Each patch has its own sequence, so that its instances are the same every time they are scattered.
+    unsigned int state = (_parameters.seed + 1) * 2654435761u ^ (patch->_index + 1) * 2246822519u;
+    if (state == 0)
+        state = 1;
+
+    std::vector<float> columns;
+    std::vector<float> rows;
+    std::vector<float> randoms;
+    columns.reserve(candidateCount);
+    rows.reserve(candidateCount);
+    randoms.reserve(candidateCount * 3);
+    const float width = (float)(patch->_x2 - patch->_x1);
+    const float height = (float)(patch->_z2 - patch->_z1);
+    for (unsigned int i = 0; i < candidateCount; ++i)
+    {
+        float column = patch->_x1 + nextRandom(&state) * width;
+        float row = patch->_z1 + nextRandom(&state) * height;
+        float accept = nextRandom(&state);
+        float rotation = nextRandom(&state);
+        float scale = nextRandom(&state);
+        float data = nextRandom(&state);
+        if (accept >= getDensity(column / (columnCount - 1), row / (rowCount - 1)))
+            continue;
+
+        columns.push_back(column);
+        rows.push_back(row);
+        randoms.push_back(rotation);
+        randoms.push_back(scale);
+        randoms.push_back(data);
+    }
+
+    const unsigned int count = (unsigned int)columns.size();
+    if (count == 0)
+        return;
+    std::vector<float> heights(count);
+    heightfield->getHeights(&columns[0], &rows[0], count, &heights[0]);
+
+    // Positions are transformed as the vertices of the patches are, but the instances keep
+    // their own scale and orientation rather than the terrain's.
+    Matrix world;
+    if (_terrain->_node)
+        world = _terrain->_node->getWorldMatrix();
+    world.scale(_terrain->_localScale);
+    const float halfColumns = (columnCount - 1) * 0.5f;
+    const float halfRows = (rowCount - 1) * 0.5f;
+
+    patchInstances->instances.resize(count * MODEL_INSTANCE_FLOATS);
+    float* instance = &patchInstances->instances[0];
+    for (unsigned int i = 0; i < count; ++i, instance += MODEL_INSTANCE_FLOATS)
+    {
+        Vector3 position(columns[i] - halfColumns, heights[i], rows[i] - halfRows);
+        world.transformPoint(&position);
+
+        Matrix matrix;
+        Matrix::createTranslation(position, &matrix);
+        matrix.rotateY(randoms[i * 3] * MATH_PIX2);
+        matrix.scale(_parameters.minScale + randoms[i * 3 + 1] * (_parameters.maxScale - _parameters.minScale));
+        memcpy(instance, matrix.m, sizeof(matrix.m));
+        instance[16] = 1.0f;
+        instance[17] = randoms[i * 3 + 2];
+        instance[18] = 0.0f;
+        instance[19] = 0.0f;
+    }
+}
+
+unsigned int TerrainFoliage::draw(Camera* camera)
+{
+    _drawnInstanceCount = 0;
+
+#ifdef GP_USE_INSTANCING
+    GP_ASSERT(camera);
+    if (!(glVertexAttribDivisor && glDrawElementsInstanced && glDrawArraysInstanced))
+        return 0;
+
+    GP_PROFILE_SCOPE("TerrainFoliage::draw");
+
+    Node* cameraNode = camera->getNode();
+    const Vector3 eye = cameraNode ? cameraNode->getTranslationWorld() : Vector3::zero();
+    const float viewDistance = _parameters.viewDistance;
+    const float fadeDistance = _parameters.fadeDistance;
+    const bool culling = _terrain->isFlagSet(Terrain::FRUSTUM_CULLING);
+
+    _instances.clear();
+    unsigned int generatedCount = 0;
+    for (size_t i = 0, count = _patches.size(); i < count; ++i)
+    {
+        PatchInstances& patchInstances = _patches[i];
+        const TerrainPatch* patch = _terrain->_patches[i];
+
+        BoundingBox bounds(patch->getBoundingBox(true));
+        bounds.min -= Vector3(_extent, _extent, _extent);
+        bounds.max += Vector3(_extent, _extent, _extent);
+        float distance = distanceToBox(eye, bounds);
+        if (distance > viewDistance)
+        {
+            if (patchInstances.generated && distance > viewDistance * TERRAIN_FOLIAGE_DISCARD_DISTANCE_RATIO)
+            {
+                std::vector<float>().swap(patchInstances.instances);
+                patchInstances.generated = false;
+            }
+            continue;
+        }
+        if (culling && !camera->getFrustum().intersects(bounds))
+            continue;
+
+        if (!patchInstances.generated)
+        {
+            if (generatedCount >= TERRAIN_FOLIAGE_PATCHES_PER_FRAME)
+                continue;
+            generate(patch, &patchInstances);
+            ++generatedCount;
+        }
+
+        // Copy the instances within the view distance, with the fade of their distance.
+        const float* instance = patchInstances.instances.empty() ? NULL : &patchInstances.instances[0];
+        for (size_t j = 0, instanceCount = patchInstances.instances.size() / MODEL_INSTANCE_FLOATS; j < instanceCount; ++j, instance += MODEL_INSTANCE_FLOATS)
+        {
+            float instanceDistance = eye.distance(Vector3(instance[12], instance[13], instance[14]));
+            float fade = fadeDistance > 0.0f ? (viewDistance - instanceDistance) / fadeDistance : viewDistance - instanceDistance;
+            if (fade <= 0.0f)
+                continue;
+
+            _instances.insert(_instances.end(), instance, instance + MODEL_INSTANCE_FLOATS);
+            _instances[_instances.size() - 4] = std::min(fade, 1.0f);
+        }
+    }
+
+    _drawnInstanceCount = (unsigned int)(_instances.size() / MODEL_INSTANCE_FLOATS);
+    if (_drawnInstanceCount == 0)
+        return 0;
+
+    if (_instanceBuffer == 0)
+    {
+        GL_ASSERT( glGenBuffers(1, &_instanceBuffer) );
+    }
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, _instanceBuffer);
+    GL_ASSERT( glBufferData(GL_ARRAY_BUFFER, _instances.size() * sizeof(float), &_instances[0], GL_STREAM_DRAW) );
+    FrameCapture::record(FrameCapture::UPLOAD_BUFFER, GL_ARRAY_BUFFER, _instanceBuffer, 0, (unsigned int)(_instances.size() * sizeof(float)));
+
+    // The instances are drawn in world space, with the view of the terrain's node.
+    Mesh* mesh = _model->getMesh();
+    const unsigned int partCount = mesh->getPartCount();
+    if (_bindingNode != _terrain->_node)
+    {
+        _bindingNode = _terrain->_node;
+        for (int i = -1; i < (int)partCount; ++i)
+        {
+            Material* material = _model->getMaterial(i);
+            if (material)
+                material->setNodeBinding(_bindingNode);
+        }
+    }
+
+    const unsigned int drawCount = std::max(partCount, 1u);
+    for (unsigned int i = 0; i < drawCount; ++i)
+    {
+        _model->drawPartInstanced(i, _instanceBuffer, 0, _drawnInstanceCount);
+    }
+    return drawCount;
+#else
+    return 0;
+#endif
+}
+
+}
@@ -0,0 +1,186 @@
+#ifndef TERRAINFOLIAGE_H_
+#define TERRAINFOLIAGE_H_
+
+#include "Model.h"
+#include "Image.h"
+
+namespace gameplay
+{
+
+class Terrain;
+class TerrainPatch;
+class Camera;
+
+/**
+ * Defines a layer of instanced models, such as grass, rocks or trees, scattered over a Terrain.
+ *
+ * The instances of a foliage layer are not nodes. They are scattered procedurally over each
+ * terrain patch, at random positions accepted with the probability given by a channel of a
+ * density map stretched over the entire terrain, with a random rotation about the vertical
+ * axis and a random scale. The instances of a patch are only generated once the patch comes
+ * within the view distance of the camera, a few patches per frame, and are discarded again
+ * once it is well beyond it.
+ *
+ * The patches within the view distance are culled against the view frustum, and the instances
+ * of the visible ones are drawn with a single instanced draw per mesh part. Each pass of the
+ * material of the model must therefore be instanced, binding a vertex attribute to
+ * RenderState::INSTANCE_WORLD_MATRIX. Over the fade distance before the view distance, the
+ * instances fade out: the x component of the vector bound to RenderState::INSTANCE_DATA goes
+ * from 1 to 0, which the built-in shaders use to dither out the instance when they are
+ * compiled with INSTANCE_FADE. Its y component is a random value from 0 to 1 for each instance.
+ *
+ * Foliage layers are added to a terrain with Terrain::addFoliage() or with 'foliage' sections
+ * in terrain files. The cost of the foliage scales with the view distance rather than with the
+ * size of the terrain. Foliage is only drawn on platforms that support instancing.
+ *
+ * @script{ignore}
+ */
+class TerrainFoliage
+{
+    friend class Terrain;
+
+public:
+
+    /**
+     * Defines the parameters of the scattering of a foliage layer.
+     */
+    struct Parameters
+    {
+        /**
+         * The number of instances per square world unit where the density map is at its maximum.
+         */
+        float density;
+
+        /**
+         * The distance from the camera beyond which no instances are drawn.
+         */
+        float viewDistance;
+
+        /**
+         * The distance before the view distance over which the instances fade out.
+         */
+        float fadeDistance;
+
+        /**
+         * The smallest random scale of the instances.
+         */
+        float minScale;
+
+        /**
+         * The largest random scale of the instances.
+         */
+        float maxScale;
+
+        /**
+         * The seed of the random positions, rotations and scales of the instances.
+         */
+        unsigned int seed;
+
+        /**
+         * Constructor.
+         */
+        Parameters();
+    };
+
+    /**
+     * Gets the model drawn for the instances of this layer.
+     *
+     * @return The model of the layer.
+     */
+    Model* getModel() const;
+
+    /**
+     * Gets the parameters of the scattering.
+     *
+     * @return The scattering parameters.
+     */
+    const Parameters& getParameters() const;
+
+    /**
+     * Sets the distance from the camera beyond which no instances are drawn, and over which they fade out.
+     *
+     * @param viewDistance The view distance.
+     * @param fadeDistance The distance before the view distance over which the instances fade out.
+     */
+    void setViewDistance(float viewDistance, float fadeDistance);
+
+    /**
+     * Discards the generated instances, which are scattered again as they come into view.
+     *
+     * Called when the terrain moves, and should be called when its heights are changed.
+     */
+    void invalidate();
+
+    /**
+     * Gets the number of instances drawn by the last frame.
+     *
+     * @return The number of instances drawn.
+     */
+    unsigned int getDrawnInstanceCount() const;
+
+private:
+
+    /**
+     * The instances generated for a terrain patch, in the layout of instance buffers.
+     */
+    struct PatchInstances
+    {
+        PatchInstances();
+
+        std::vector<float> instances;
+        bool generated;
+    };
+
+    /**
+     * Constructor.
+     */
+    TerrainFoliage(Terrain* terrain, Model* model, Image* densityMap, int densityChannel, const Parameters& parameters);
+
+    /**
+     * Destructor.
+     */
+    ~TerrainFoliage();
+
+    /**
+     * Hidden copy constructor.
+     */
+    TerrainFoliage(const TerrainFoliage&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    TerrainFoliage& operator=(const TerrainFoliage&);
+
+    /**
+     * Gets the density map value at a point of the heightfield, from 0 to 1.
+     */
+    float getDensity(float u, float v) const;
+
+    /**
+     * Scatters the instances over a patch.
+     */
+    void generate(const TerrainPatch* patch, PatchInstances* patchInstances);
+
+    /**
+     * Draws the instances within the view distance of the camera.
+     *
+     * @return The number of instanced draws.
+     */
+    unsigned int draw(Camera* camera);
+
+    Terrain* _terrain;
+    Model* _model;
+    Image* _densityMap;
+    int _densityChannel;
+    Parameters _parameters;
+    float _extent;
+    std::vector<PatchInstances> _patches;
+    std::vector<float> _instances;
+    VertexBufferHandle _instanceBuffer;
+    Node* _bindingNode;
+    unsigned int _drawnInstanceCount;
+};
+
+}
+
+#endif
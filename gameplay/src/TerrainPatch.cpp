@@ -4,6 +4,8 @@
 #include "MeshPart.h"
 #include "Scene.h"
 #include "Game.h"
+#include "GLStateCache.h"
+#include "Image.h"
 
 namespace gameplay
 {
@@ -29,9 +31,40 @@ class TerrainAutoBindingResolver : RenderState::AutoBindingResolver
 static TerrainAutoBindingResolver __autoBindingResolver;
 static int __currentPatchIndex = -1;
 
+/**
+ * Returns the index of the vertex that a vertex of a patch vertex grid is drawn with.
+ *
+ * Along an edge stitched to a coarser neighbor, every other vertex is moved onto the
+ * previous one, which collapses the triangles between them and leaves the edge running
+ * through only the vertices of the neighbor.
+ */
+static unsigned int stitchVertex(unsigned int x, unsigned int z, unsigned int patchWidth, unsigned int patchHeight, bool skirt,
+                                 bool west, bool east, bool north, bool south)
+{
+    // Position within the grid without skirts, where skirt vertices are at -1 and at the vertex count
+    int border = skirt ? 1 : 0;
+    int columns = (int)patchWidth - border * 2;
+    int rows = (int)patchHeight - border * 2;
+    int column = (int)x - border;
+    int row = (int)z - border;
+
+    // The last vertex of an edge is shared by both levels, even when the edge is not a multiple of the coarser step
+    if (column % 2 == 1 && column < columns - 1 && ((north && row <= 0) || (south && row >= rows - 1)))
+        --x;
+    if (row % 2 == 1 && row < rows - 1 && ((west && column <= 0) || (east && column >= columns - 1)))
+        --z;
+
+    return z * patchWidth + x;
+}
+
 TerrainPatch::TerrainPatch() :
-    _terrain(NULL), _row(0), _column(0), _camera(NULL), _level(0), _bits(TERRAINPATCH_DIRTY_ALL)
+    _terrain(NULL), _row(0), _column(0), _x1(0), _z1(0), _x2(0), _z2(0), _splatMap(NULL), _splatting(false),
+    _camera(NULL), _level(0), _targetLevel(0), _edgeMask(0), _bits(TERRAINPATCH_DIRTY_ALL)
 {
+    for (unsigned int i = 0; i < EDGE_COUNT; ++i)
+    {
+        _neighbors[i] = NULL;
+    }
 }
 
 TerrainPatch::~TerrainPatch()
@@ -48,6 +81,8 @@ TerrainPatch::~TerrainPatch()
     {
         deleteLayer(*_layers.begin());
     }
+
+    SAFE_RELEASE(_splatMap);
     
     if (_camera != NULL)
     {
@@ -58,7 +93,7 @@ TerrainPatch::~TerrainPatch()
 
 TerrainPatch* TerrainPatch::create(Terrain* terrain, unsigned int index,
                                    unsigned int row, unsigned int column,
-                                   float* heights, unsigned int width, unsigned int height,
+                                   const HeightField* heightfield, unsigned int width, unsigned int height,
                                    unsigned int x1, unsigned int z1, unsigned int x2, unsigned int z2,
                                    float xOffset, float zOffset,
                                    unsigned int maxStep, float verticalSkirtSize)
@@ -69,11 +104,15 @@ TerrainPatch* TerrainPatch::create(Terrain* terrain, unsigned int index,
     patch->_index = index;
     patch->_row = row;
     patch->_column = column;
+    patch->_x1 = x1;
+    patch->_z1 = z1;
+    patch->_x2 = x2;
+    patch->_z2 = z2;
 
     // Add patch lods
     for (unsigned int step = 1; step <= maxStep; step *= 2)
     {
-        patch->addLOD(heights, width, height, x1, z1, x2, z2, xOffset, zOffset, step, verticalSkirtSize);
+        patch->addLOD(heightfield, width, height, x1, z1, x2, z2, xOffset, zOffset, step, verticalSkirtSize);
     }
 
     // Set our bounding box using the base LOD mesh
@@ -92,22 +131,13 @@ Material* TerrainPatch::getMaterial(int index) const
 {
     if (index == -1)
     {
-        Scene* scene = _terrain->_node ? _terrain->_node->getScene() : NULL;
-        Camera* camera = scene ? scene->getActiveCamera() : NULL;
-        if (!camera)
-        {
-            _level = const_cast<TerrainPatch*>(this)->computeLOD(camera, getBoundingBox(true));
-        }
-        else
-        {
-            _level = 0;
-        }
+        // The level last selected for the scene camera by Terrain::draw
         return _levels[_level]->model->getMaterial();
     }
     return _levels[index]->model->getMaterial();
 }
 
-void TerrainPatch::addLOD(float* heights, unsigned int width, unsigned int height,
+void TerrainPatch::addLOD(const HeightField* heightfield, unsigned int width, unsigned int height,
                           unsigned int x1, unsigned int z1, unsigned int x2, unsigned int z2,
                           float xOffset, float zOffset,
                           unsigned int step, float verticalSkirtSize)
@@ -156,7 +186,7 @@ void TerrainPatch::addLOD(float* heights, unsigned int width, unsigned int heigh
 
             // Compute position - apply the local scale of the terrain into the vertex data
             v[0] = (x + xOffset) * _terrain->_localScale.x;
-            v[1] = computeHeight(heights, width, x, z);
+            v[1] = computeHeight(heightfield, x, z);
             if (xskirt || zskirt)
                 v[1] -= verticalSkirtSize * _terrain->_localScale.y;
             v[2] = (z + zOffset) * _terrain->_localScale.z;
@@ -181,11 +211,11 @@ void TerrainPatch::addLOD(float* heights, unsigned int width, unsigned int heigh
             // Compute normal
             if (!_terrain->_normalMap)
             {
-                Vector3 p(v[0], computeHeight(heights, width, x, z), v[2]);
-                Vector3 w(Vector3(x>=step ? v[0]-stepXScaled : v[0], computeHeight(heights, width, x>=step ? x-step : x, z), v[2]), p);
-                Vector3 e(Vector3(x<width-step ? v[0]+stepXScaled : v[0], computeHeight(heights, width, x<width-step ? x+step : x, z), v[2]), p);
-                Vector3 s(Vector3(v[0], computeHeight(heights, width, x, z>=step ? z-step : z), z>=step ? v[2]-stepZScaled : v[2]), p);
-                Vector3 n(Vector3(v[0], computeHeight(heights, width, x, z<height-step ? z+step : z), z<height-step ? v[2]+stepZScaled : v[2]), p);
+                Vector3 p(v[0], computeHeight(heightfield, x, z), v[2]);
+                Vector3 w(Vector3(x>=step ? v[0]-stepXScaled : v[0], computeHeight(heightfield, x>=step ? x-step : x, z), v[2]), p);
+                Vector3 e(Vector3(x<width-step ? v[0]+stepXScaled : v[0], computeHeight(heightfield, x<width-step ? x+step : x, z), v[2]), p);
+                Vector3 s(Vector3(v[0], computeHeight(heightfield, x, z>=step ? z-step : z), z>=step ? v[2]-stepZScaled : v[2]), p);
+                Vector3 n(Vector3(v[0], computeHeight(heightfield, x, z<height-step ? z+step : z), z<height-step ? v[2]+stepZScaled : v[2]), p);
                 Vector3 normals[4];
                 Vector3::cross(n, w, &normals[0]);
                 Vector3::cross(w, s, &normals[1]);
@@ -270,81 +300,116 @@ void TerrainPatch::addLOD(float* heights, unsigned int width, unsigned int heigh
     mesh->setBoundingBox(BoundingBox(min, max));
     mesh->setBoundingSphere(BoundingSphere(center, center.distance(max)));
 
-    // Add mesh part for indices
-    unsigned int indexCount =
+    // Add a mesh part for each edge mask, drawn with the index buffers shared by all patches of this size
+    unsigned int indexCount;
+    const IndexBufferHandle* indexBuffers = getIndexBuffers(patchWidth, patchHeight, verticalSkirtSize > 0.0f, &indexCount);
+    for (unsigned int i = 0; i < EDGE_MASK_COUNT; ++i)
+    {
+        mesh->addSharedPart(Mesh::TRIANGLE_STRIP, Mesh::INDEX16, indexCount, indexBuffers[i]);
+    }
+
+    SAFE_DELETE_ARRAY(vertices);
+
+    // Create model
+    Model* model = Model::create(mesh);
+    mesh->release();
+
+    // Add this level
+    Level* level = new Level();
+    level->model = model;
+    _levels.push_back(level);
+}
+
+const IndexBufferHandle* TerrainPatch::getIndexBuffers(unsigned int patchWidth, unsigned int patchHeight, bool skirt, unsigned int* indexCount)
+{
+    GP_ASSERT(indexCount);
+
+    // Patches with the same vertex grid share their index buffers. Skirts are the same for the whole terrain.
+    unsigned int key = (patchWidth << 16) | patchHeight;
+    std::map<unsigned int, Terrain::IndexBuffers>::iterator itr = _terrain->_indexBuffers.find(key);
+    if (itr != _terrain->_indexBuffers.end())
+    {
+        *indexCount = itr->second.indexCount;
+        return itr->second.buffers;
+    }
+
+    unsigned int count =
         (patchWidth * 2) *      // # indices per row of tris
         (patchHeight - 1) +     // # rows of tris
         (patchHeight-2) * 2;    // # degenerate tris
 
     // Support a maximum number of indices of USHRT_MAX. Any more indices we will require breaking up the
     // terrain into smaller patches.
-    if (indexCount > USHRT_MAX)
+    if (count > USHRT_MAX)
     {
-        GP_WARN("Index count of %d for terrain patch exceeds the limit of 65535. Please specifiy a smaller patch size.", indexCount);
-        GP_ASSERT(indexCount <= USHRT_MAX);
+        GP_WARN("Index count of %d for terrain patch exceeds the limit of 65535. Please specifiy a smaller patch size.", count);
+        GP_ASSERT(count <= USHRT_MAX);
     }
 
-    MeshPart* part = mesh->addPart(Mesh::TRIANGLE_STRIP, Mesh::INDEX16, indexCount);
-    unsigned short* indices = new unsigned short[indexCount];
-    index = 0;
-    for (unsigned int z = 0; z < patchHeight-1; ++z)
+    Terrain::IndexBuffers& indexBuffers = _terrain->_indexBuffers[key];
+    indexBuffers.indexCount = count;
+    unsigned short* indices = new unsigned short[count];
+    for (unsigned int mask = 0; mask < EDGE_MASK_COUNT; ++mask)
     {
-        unsigned int i1 = z * patchWidth;
-        unsigned int i2 = (z+1) * patchWidth;
+        bool west = (mask & (1 << EDGE_WEST)) != 0;
+        bool east = (mask & (1 << EDGE_EAST)) != 0;
+        bool north = (mask & (1 << EDGE_NORTH)) != 0;
+        bool south = (mask & (1 << EDGE_SOUTH)) != 0;
 
-        // Move left to right for even rows and right to left for odd rows.
-        // Note that this results in two degenerate triangles between rows
-        // for stitching purposes, but actually does not require any extra
-        // indices to achieve this.
-        if (z % 2 == 0)
+        unsigned int index = 0;
+        for (unsigned int z = 0; z < patchHeight-1; ++z)
         {
-            if (z > 0)
+            // Move left to right for even rows and right to left for odd rows.
+            // Note that this results in two degenerate triangles between rows
+            // for stitching purposes, but actually does not require any extra
+            // indices to achieve this.
+            if (z % 2 == 0)
             {
-                // Add degenerate indices to connect strips
-                indices[index] = indices[index-1];
-                ++index;
-                indices[index++] = i1;
-            }
+                if (z > 0)
+                {
+                    // Add degenerate indices to connect strips
+                    indices[index] = indices[index-1];
+                    ++index;
+                    indices[index++] = stitchVertex(0, z, patchWidth, patchHeight, skirt, west, east, north, south);
+                }
 
-            // Add row strip
-            for (unsigned int x = 0; x < patchWidth; ++x)
-            {
-                indices[index++] = i1 + x;
-                indices[index++] = i2 + x;
+                // Add row strip
+                for (unsigned int x = 0; x < patchWidth; ++x)
+                {
+                    indices[index++] = stitchVertex(x, z, patchWidth, patchHeight, skirt, west, east, north, south);
+                    indices[index++] = stitchVertex(x, z+1, patchWidth, patchHeight, skirt, west, east, north, south);
+                }
             }
-        }
-        else
-        {
-            // Add degenerate indices to connect strips
-            if (z > 0)
+            else
             {
-                indices[index] = indices[index-1];
-                ++index;
-                indices[index++] = i2 + ((int)patchWidth-1);
-            }
+                // Add degenerate indices to connect strips
+                if (z > 0)
+                {
+                    indices[index] = indices[index-1];
+                    ++index;
+                    indices[index++] = stitchVertex(patchWidth-1, z+1, patchWidth, patchHeight, skirt, west, east, north, south);
+                }
 
-            // Add row strip
-            for (int x = (int)patchWidth-1; x >= 0; --x)
-            {
-                indices[index++] = i2 + x;
-                indices[index++] = i1 + x;
+                // Add row strip
+                for (int x = (int)patchWidth-1; x >= 0; --x)
+                {
+                    indices[index++] = stitchVertex(x, z+1, patchWidth, patchHeight, skirt, west, east, north, south);
+                    indices[index++] = stitchVertex(x, z, patchWidth, patchHeight, skirt, west, east, north, south);
+                }
             }
         }
-    }
-    GP_ASSERT(index == indexCount);
-    part->setIndexData(indices, 0, indexCount);
+        GP_ASSERT(index == count);
 
-    SAFE_DELETE_ARRAY(vertices);
+        GLuint vbo;
+        GL_ASSERT( glGenBuffers(1, &vbo) );
+        GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, vbo);
+        GL_ASSERT( glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned short), indices, GL_STATIC_DRAW) );
+        indexBuffers.buffers[mask] = vbo;
+    }
     SAFE_DELETE_ARRAY(indices);
 
-    // Create model
-    Model* model = Model::create(mesh);
-    mesh->release();
-
-    // Add this level
-    Level* level = new Level();
-    level->model = model;
-    _levels.push_back(level);
+    *indexCount = count;
+    return indexBuffers.buffers;
 }
 
 void TerrainPatch::deleteLayer(Layer* layer)
@@ -489,8 +554,21 @@ std::string TerrainPatch::passCreated(Pass* pass)
     // non-constant array access in the shader. This is due to the fact that non-constant array access
     // in GLES is very slow on some hardware.
     std::ostringstream defines;
-    defines << "LAYER_COUNT " << _layers.size();
-    defines << ";SAMPLER_COUNT " << _samplers.size();
+    if (_splatting)
+    {
+        // All layers are sampled from the terrain's texture array, so the permutation is the same for every patch
+        defines << "LAYER_COUNT 0;SAMPLER_COUNT 0;SPLATTING";
+        pass->getParameter("u_splatLayerArray")->setSampler(_terrain->_splatLayers);
+        pass->getParameter("u_splatMap")->setSampler(_splatMap);
+        pass->getParameter("u_splatLayers")->setVector4(_splatLayers);
+        pass->getParameter("u_splatRepeat")->setVector2Array(_splatRepeat, 4, true);
+        pass->getParameter("u_splatTransform")->setVector4(_splatTransform);
+    }
+    else
+    {
+        defines << "LAYER_COUNT " << _layers.size();
+        defines << ";SAMPLER_COUNT " << _samplers.size();
+    }
 
     if (_terrain->isFlagSet(Terrain::DEBUG_PATCHES))
     {
@@ -510,7 +588,7 @@ std::string TerrainPatch::passCreated(Pass* pass)
     // Rebuild layer lists while we're at it.
     //
     int layerIndex = 0;
-    for (std::set<Layer*, LayerCompare>::iterator itr = _layers.begin(); itr != _layers.end(); ++itr, ++layerIndex)
+    for (std::set<Layer*, LayerCompare>::iterator itr = _layers.begin(); itr != _layers.end() && !_splatting; ++itr, ++layerIndex)
     {
         Layer* layer = *itr;
 
@@ -534,6 +612,9 @@ bool TerrainPatch::updateMaterial()
 
     _bits &= ~TERRAINPATCH_DIRTY_MATERIAL;
 
+    // Fall back to drawing the layers one by one when they can't be splatted from a texture array
+    _splatting = _terrain->isFlagSet(Terrain::TEXTURE_ARRAY_SPLATTING) && _terrain->updateSplatting() && _splatMap;
+
     __currentPatchIndex = _index;
 
     for (size_t i = 0, count = _levels.size(); i < count; ++i)
@@ -560,6 +641,157 @@ bool TerrainPatch::updateMaterial()
     return true;
 }
 
+bool TerrainPatch::updateSplatMap(std::map<std::string, Image*>& blendImages)
+{
+    SAFE_RELEASE(_splatMap);
+    if (_layers.empty())
+        return false;
+
+    // Load the blend map of each layer above the base layer, and bake the splat map at the blend map resolution
+    unsigned int width = _terrain->_heightfield->getColumnCount();
+    unsigned int height = _terrain->_heightfield->getRowCount();
+    unsigned int mapWidth = 2;
+    unsigned int mapHeight = 2;
+    std::vector<const Layer*> layers(_layers.begin(), _layers.end());
+    std::vector<Image*> images(layers.size(), NULL);
+    for (size_t i = 1, count = layers.size(); i < count; ++i)
+    {
+        if (layers[i]->blendIndex == -1)
+            continue;
+
+        std::string path = _samplers[layers[i]->blendIndex]->getTexture()->getPath();
+        std::map<std::string, Image*>::iterator itr = blendImages.find(path);
+        if (itr == blendImages.end())
+            itr = blendImages.insert(std::make_pair(path, Image::create(path.c_str()))).first;
+
+        Image* image = itr->second;
+        if (image)
+        {
+            mapWidth = std::max(mapWidth, image->getWidth() * (_x2 - _x1) / (width - 1) + 1);
+            mapHeight = std::max(mapHeight, image->getHeight() * (_z2 - _z1) / (height - 1) + 1);
+        }
+        images[i] = image;
+    }
+
+    // Accumulate the coverage of each layer to keep the four most visible ones
+    std::vector<float> weights(layers.size());
+    std::vector<float> coverage(layers.size(), 0.0f);
+    for (unsigned int t = 0; t < mapHeight; ++t)
+    {
+        for (unsigned int s = 0; s < mapWidth; ++s)
+        {
+            float x = _x1 + (float)(_x2 - _x1) * s / (mapWidth - 1);
+            float z = _z1 + (float)(_z2 - _z1) * t / (mapHeight - 1);
+            computeLayerWeights(images, x / (width - 1), 1.0f - z / (height - 1), &weights[0]);
+            for (size_t i = 0, count = layers.size(); i < count; ++i)
+            {
+                coverage[i] += weights[i];
+            }
+        }
+    }
+
+    std::vector<unsigned int> order;
+    for (unsigned int i = 0, count = layers.size(); i < count; ++i)
+    {
+        order.push_back(i);
+    }
+    for (size_t i = 0, count = std::min(order.size(), (size_t)4); i < count; ++i)
+    {
+        for (size_t j = i + 1; j < order.size(); ++j)
+        {
+            if (coverage[order[j]] > coverage[order[i]])
+                std::swap(order[i], order[j]);
+        }
+    }
+    if (order.size() > 4)
+    {
+        GP_WARN("Terrain patch (%d, %d) has %d layers; splatting blends only the 4 most visible ones.", _row, _column, (int)order.size());
+        order.resize(4);
+    }
+
+    // Look up the selected layers in the terrain's texture array
+    float layerIndices[4] = { 0, 0, 0, 0 };
+    for (size_t i = 0; i < 4; ++i)
+    {
+        _splatRepeat[i] = Vector2::one();
+        if (i < order.size())
+        {
+            const Layer* layer = layers[order[i]];
+            const char* path = _samplers[layer->textureIndex]->getTexture()->getPath();
+            layerIndices[i] = (float)(std::find(_terrain->_splatPaths.begin(), _terrain->_splatPaths.end(), path) - _terrain->_splatPaths.begin());
+            _splatRepeat[i] = layer->textureRepeat;
+        }
+    }
+    _splatLayers.set(layerIndices);
+
+    // Bake the renormalized weights of the selected layers, one per channel
+    unsigned char* data = new unsigned char[mapWidth * mapHeight * 4];
+    unsigned char* pixel = data;
+    for (unsigned int t = 0; t < mapHeight; ++t)
+    {
+        for (unsigned int s = 0; s < mapWidth; ++s, pixel += 4)
+        {
+            float x = _x1 + (float)(_x2 - _x1) * s / (mapWidth - 1);
+            float z = _z1 + (float)(_z2 - _z1) * t / (mapHeight - 1);
+            computeLayerWeights(images, x / (width - 1), 1.0f - z / (height - 1), &weights[0]);
+
+            float sum = 0.0f;
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                sum += weights[order[i]];
+            }
+            for (size_t i = 0; i < 4; ++i)
+            {
+                float weight = i < order.size() && sum > 0.0f ? weights[order[i]] / sum : (i == 0 ? 1.0f : 0.0f);
+                pixel[i] = (unsigned char)(clamp(weight, 0.0f, 1.0f) * 255.0f + 0.5f);
+            }
+        }
+    }
+
+    Texture* texture = Texture::create(Texture::RGBA, mapWidth, mapHeight, data);
+    SAFE_DELETE_ARRAY(data);
+    if (!texture)
+        return false;
+
+    _splatMap = Texture::Sampler::create(texture);
+    _splatMap->setWrapMode(Texture::CLAMP, Texture::CLAMP);
+    _splatMap->setFilterMode(Texture::LINEAR, Texture::LINEAR);
+    texture->release();
+
+    // Map the terrain texture coordinates of the patch corners onto the centers of the corner texels
+    float scaleX = (float)(width - 1) / (_x2 - _x1) * (mapWidth - 1) / mapWidth;
+    float scaleY = -(float)(height - 1) / (_z2 - _z1) * (mapHeight - 1) / mapHeight;
+    float u1 = (float)_x1 / (width - 1);
+    float v1 = 1.0f - (float)_z1 / (height - 1);
+    _splatTransform.set(scaleX, scaleY, 0.5f / mapWidth - u1 * scaleX, 0.5f / mapHeight - v1 * scaleY);
+
+    return true;
+}
+
+void TerrainPatch::computeLayerWeights(const std::vector<Image*>& blendImages, float u, float v, float* weights) const
+{
+    // Each layer is blended over the layers below it, as in the terrain shader
+    size_t i = 0;
+    for (std::set<Layer*, LayerCompare>::const_iterator itr = _layers.begin(); itr != _layers.end(); ++itr, ++i)
+    {
+        float blend = 1.0f;
+        Image* image = blendImages[i];
+        unsigned int pixelSize = image && image->getFormat() == Image::RGBA ? 4 : 3;
+        if (i > 0 && image && (unsigned int)(*itr)->blendChannel < pixelSize)
+        {
+            unsigned int column = (unsigned int)(clamp(u, 0.0f, 1.0f) * (image->getWidth() - 1) + 0.5f);
+            unsigned int row = (unsigned int)(clamp(v, 0.0f, 1.0f) * (image->getHeight() - 1) + 0.5f);
+            blend = image->getData()[(row * image->getWidth() + column) * pixelSize + (*itr)->blendChannel] / 255.0f;
+        }
+
+        for (size_t j = 0; j < i; ++j)
+        {
+            weights[j] *= 1.0f - blend;
+        }
+        weights[i] = blend;
+    }
+}
+
 void TerrainPatch::updateNodeBindings()
 {
     __currentPatchIndex = _index;
@@ -587,11 +819,9 @@ unsigned int TerrainPatch::draw(bool wireframe)
     if (!updateMaterial())
         return 0;
 
-    // Compute the LOD level from the camera's perspective
-    _level = computeLOD(camera, bounds);
-
-    // Draw the model for the current LOD
-    return _levels[_level]->model->draw(wireframe);
+    // Draw the model for the LOD level and edge stitching selected by Terrain::draw
+    _levels[_level]->model->drawPart(_edgeMask, wireframe);
+    return 1;
 }
 
 const BoundingBox& TerrainPatch::getBoundingBox(bool worldSpace) const
@@ -639,7 +869,7 @@ unsigned int TerrainPatch::computeLOD(Camera* camera, const BoundingBox& worldBo
         return 0;
 
     if (!(_bits & TERRAINPATCH_DIRTY_LEVEL))
-        return _level;
+        return _targetLevel;
 
     _bits &= ~TERRAINPATCH_DIRTY_LEVEL;
 
@@ -673,9 +903,64 @@ unsigned int TerrainPatch::computeLOD(Camera* camera, const BoundingBox& worldBo
     size_t lod = (size_t)error;
     lod = std::max(lod, (size_t)0);
     lod = std::min(lod, maxLod);
-    _level = lod;
 
-    return _level;
+    return lod;
+}
+
+void TerrainPatch::updateLevels(const std::vector<TerrainPatch*>& patches, Camera* camera)
+{
+    // Select the level each patch would be drawn at on its own
+    bool changed = false;
+    for (size_t i = 0, count = patches.size(); i < count; ++i)
+    {
+        TerrainPatch* patch = patches[i];
+        unsigned int level = patch->computeLOD(camera, patch->getBoundingBox(true));
+        if (level != patch->_targetLevel)
+        {
+            patch->_targetLevel = level;
+            changed = true;
+        }
+    }
+    if (!changed)
+        return;
+
+    for (size_t i = 0, count = patches.size(); i < count; ++i)
+    {
+        patches[i]->_level = patches[i]->_targetLevel;
+    }
+
+    // Stitching needs neighbors to be at most one level apart. Lower the coarser patch of any
+    // pair further apart, and repeat since that can leave it too far from its other neighbors.
+    do
+    {
+        changed = false;
+        for (size_t i = 0, count = patches.size(); i < count; ++i)
+        {
+            TerrainPatch* patch = patches[i];
+            for (unsigned int e = 0; e < EDGE_COUNT; ++e)
+            {
+                TerrainPatch* neighbor = patch->_neighbors[e];
+                if (neighbor && patch->_level > neighbor->_level + 1)
+                {
+                    patch->_level = neighbor->_level + 1;
+                    changed = true;
+                }
+            }
+        }
+    } while (changed);
+
+    // Stitch the edges shared with coarser neighbors
+    for (size_t i = 0, count = patches.size(); i < count; ++i)
+    {
+        TerrainPatch* patch = patches[i];
+        patch->_edgeMask = 0;
+        for (unsigned int e = 0; e < EDGE_COUNT; ++e)
+        {
+            TerrainPatch* neighbor = patch->_neighbors[e];
+            if (neighbor && neighbor->_level > patch->_level)
+                patch->_edgeMask |= 1 << e;
+        }
+    }
 }
 
 const Vector3& TerrainPatch::getAmbientColor() const
@@ -689,9 +974,9 @@ void TerrainPatch::setMaterialDirty()
     _bits |= TERRAINPATCH_DIRTY_MATERIAL;
 }
 
-float TerrainPatch::computeHeight(float* heights, unsigned int width, unsigned int x, unsigned int z)
+float TerrainPatch::computeHeight(const HeightField* heightfield, unsigned int x, unsigned int z)
 {
-    return heights[z * width + x] * _terrain->_localScale.y;
+    return heightfield->getSample(x, z) * _terrain->_localScale.y;
 }
 
 TerrainPatch::Layer::Layer() :
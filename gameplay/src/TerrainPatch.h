@@ -3,6 +3,7 @@
 
 #include "Model.h"
 #include "Camera.h"
+#include "HeightField.h"
 
 namespace gameplay
 {
@@ -16,6 +17,7 @@ class TerrainAutoBindingResolver;
 class TerrainPatch : public Camera::Listener
 {
     friend class Terrain;
+    friend class TerrainFoliage;
     friend class TerrainAutoBindingResolver;
 
 public:
@@ -105,17 +107,37 @@ private:
         bool operator() (const Layer* lhs, const Layer* rhs) const;
     };
 
+    /**
+     * The edges of a patch, which index its neighbors. An edge mask has the bit
+     * (1 << edge) set for each edge shared with a neighbor of a coarser level.
+     */
+    enum Edge
+    {
+        EDGE_WEST,
+        EDGE_EAST,
+        EDGE_NORTH,
+        EDGE_SOUTH,
+        EDGE_COUNT
+    };
+
+    /**
+     * The number of edge masks, and so of stitched index buffers for each vertex grid.
+     */
+    static const unsigned int EDGE_MASK_COUNT = 1 << EDGE_COUNT;
+
     static TerrainPatch* create(Terrain* terrain, unsigned int index,
                                 unsigned int row, unsigned int column,
-                                float* heights, unsigned int width, unsigned int height,
+                                const HeightField* heightfield, unsigned int width, unsigned int height,
                                 unsigned int x1, unsigned int z1, unsigned int x2, unsigned int z2,
                                 float xOffset, float zOffset, unsigned int maxStep, float verticalSkirtSize);
 
-    void addLOD(float* heights, unsigned int width, unsigned int height,
+    void addLOD(const HeightField* heightfield, unsigned int width, unsigned int height,
                 unsigned int x1, unsigned int z1, unsigned int x2, unsigned int z2,
                 float xOffset, float zOffset, unsigned int step, float verticalSkirtSize);
 
 
+    const IndexBufferHandle* getIndexBuffers(unsigned int patchWidth, unsigned int patchHeight, bool skirt, unsigned int* indexCount);
+
     bool setLayer(int index, const char* texturePath, const Vector2& textureRepeat, const char* blendPath, int blendChannel);
 
     void deleteLayer(Layer* layer);
@@ -126,13 +148,19 @@ private:
 
     bool updateMaterial();
 
+    bool updateSplatMap(std::map<std::string, Image*>& blendImages);
+
+    void computeLayerWeights(const std::vector<Image*>& blendImages, float u, float v, float* weights) const;
+
     unsigned int computeLOD(Camera* camera, const BoundingBox& worldBounds);
 
+    static void updateLevels(const std::vector<TerrainPatch*>& patches, Camera* camera);
+
     const Vector3& getAmbientColor() const;
 
     void setMaterialDirty();
 
-    float computeHeight(float* heights, unsigned int width, unsigned int x, unsigned int z);
+    float computeHeight(const HeightField* heightfield, unsigned int x, unsigned int z);
 
     void updateNodeBindings();
 
@@ -143,12 +171,21 @@ private:
     unsigned int _row;
     unsigned int _column;
     std::vector<Level*> _levels;
+    TerrainPatch* _neighbors[EDGE_COUNT];
     std::set<Layer*, LayerCompare> _layers;
     std::vector<Texture::Sampler*> _samplers;
+    unsigned int _x1, _z1, _x2, _z2;
+    Texture::Sampler* _splatMap;
+    Vector4 _splatLayers;
+    Vector2 _splatRepeat[4];
+    Vector4 _splatTransform;
+    bool _splatting;
     mutable BoundingBox _boundingBox;
     mutable BoundingBox _boundingBoxWorld;
     mutable Camera* _camera;
     mutable unsigned int _level;
+    unsigned int _targetLevel;
+    unsigned int _edgeMask;
     mutable int _bits;
 };
 
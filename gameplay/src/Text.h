@@ -256,6 +256,7 @@ private:
     Font* _font;
     Font* _drawFont;
     std::string _text;
+    Font::Layout _layout;
     unsigned int _size;
     float _width;
     float _height;
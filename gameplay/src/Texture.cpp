@@ -2,6 +2,10 @@
 #include "Image.h"
 #include "Texture.h"
 #include "FileSystem.h"
+#include "Game.h"
+#include "GLStateCache.h"
+#include "FrameCapture.h"
+#include "UploadThread.h"
 
 // PVRTC (GL_IMG_texture_compression_pvrtc) : Imagination based gpus
 #ifndef GL_COMPRESSED_RGB_PVRTC_2BPPV1_IMG
@@ -44,25 +48,254 @@
 #define ETC1_RGB8 0x8D64
 #endif
 
+// S3TC/DXT sRGB (GL_EXT_texture_sRGB) : Most desktop gpus
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT 0x8C4C
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT 0x8C4D
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT 0x8C4E
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
+// RGTC/BC4-5 (GL_ARB_texture_compression_rgtc) : Most desktop gpus
+#ifndef GL_COMPRESSED_RED_RGTC1
+#define GL_COMPRESSED_RED_RGTC1 0x8DBB
+#endif
+#ifndef GL_COMPRESSED_SIGNED_RED_RGTC1
+#define GL_COMPRESSED_SIGNED_RED_RGTC1 0x8DBC
+#endif
+#ifndef GL_COMPRESSED_RG_RGTC2
+#define GL_COMPRESSED_RG_RGTC2 0x8DBD
+#endif
+#ifndef GL_COMPRESSED_SIGNED_RG_RGTC2
+#define GL_COMPRESSED_SIGNED_RG_RGTC2 0x8DBE
+#endif
+
+// BPTC/BC6-7 (GL_ARB_texture_compression_bptc) : Most desktop gpus
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+#define GL_COMPRESSED_RGBA_BPTC_UNORM 0x8E8C
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM
+#define GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM 0x8E8D
+#endif
+#ifndef GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT
+#define GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT 0x8E8E
+#endif
+#ifndef GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT
+#define GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT 0x8E8F
+#endif
+
+// ETC2/EAC (OpenGL ES 3.0, GL_ARB_ES3_compatibility) : All OpenGL ES 3.0 chipsets
+#ifndef GL_COMPRESSED_R11_EAC
+#define GL_COMPRESSED_R11_EAC 0x9270
+#endif
+#ifndef GL_COMPRESSED_SIGNED_R11_EAC
+#define GL_COMPRESSED_SIGNED_R11_EAC 0x9271
+#endif
+#ifndef GL_COMPRESSED_RG11_EAC
+#define GL_COMPRESSED_RG11_EAC 0x9272
+#endif
+#ifndef GL_COMPRESSED_SIGNED_RG11_EAC
+#define GL_COMPRESSED_SIGNED_RG11_EAC 0x9273
+#endif
+#ifndef GL_COMPRESSED_RGB8_ETC2
+#define GL_COMPRESSED_RGB8_ETC2 0x9274
+#endif
+#ifndef GL_COMPRESSED_SRGB8_ETC2
+#define GL_COMPRESSED_SRGB8_ETC2 0x9275
+#endif
+#ifndef GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2
+#define GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2 0x9276
+#endif
+#ifndef GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2
+#define GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2 0x9277
+#endif
+#ifndef GL_COMPRESSED_RGBA8_ETC2_EAC
+#define GL_COMPRESSED_RGBA8_ETC2_EAC 0x9278
+#endif
+#ifndef GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC
+#define GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC 0x9279
+#endif
+
+// ASTC (GL_KHR_texture_compression_astc_ldr) : Most recent mobile gpus. The other block sizes follow 4x4 in order.
+#ifndef GL_COMPRESSED_RGBA_ASTC_4x4_KHR
+#define GL_COMPRESSED_RGBA_ASTC_4x4_KHR 0x93B0
+#endif
+#ifndef GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR
+#define GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR 0x93D0
+#endif
+
 namespace gameplay
 {
 
+struct Texture::PendingLoad
+{
+    PendingLoad() : texture(NULL), generateMipmaps(false), width(0), height(0), format(Image::RGBA), data(NULL), handle(0), uploadedRows(0) { }
+
+    Texture* texture;
+    std::string path;
+    bool generateMipmaps;
+    std::vector<LoadCallback> callbacks;
+    JobSystem::Counter decoded;
+    JobSystem::Counter uploaded;    // Outstanding upload of the image on the upload thread
+    unsigned int width;
+    unsigned int height;
+    Image::Format format;
+    unsigned char* data;
+    GLuint handle;
+    unsigned int uploadedRows;
+};
+
+// The number of pixel buffers that the updates of a dynamic texture are staged in, in turn.
+#define TEXTURE_DYNAMIC_BUFFER_COUNT 3
+
+struct Texture::DynamicData
+{
+    DynamicData() : index(0), reallocate(false)
+    {
+        for (unsigned int i = 0; i < TEXTURE_DYNAMIC_BUFFER_COUNT; ++i)
+        {
+            buffers[i] = 0;
+            sizes[i] = 0;
+#ifdef GP_USE_BUFFER_SYNC
+            fences[i] = 0;
+#endif
+        }
+    }
+
+    GLuint buffers[TEXTURE_DYNAMIC_BUFFER_COUNT];
+    size_t sizes[TEXTURE_DYNAMIC_BUFFER_COUNT];
+#ifdef GP_USE_BUFFER_SYNC
+    GLsync fences[TEXTURE_DYNAMIC_BUFFER_COUNT];    // Copies from the buffers still in flight
+#endif
+    unsigned int index;
+    bool reallocate;
+};
+
 static std::vector<Texture*> __textureCache;
-static TextureHandle __currentTextureId = 0;
-static Texture::Type __currentTextureType = Texture::TEXTURE_2D;
+
+// Every texture, for memory budgeting and residency reports.
+static std::vector<Texture*> __textures;
+static size_t __textureMemorySize = 0;
+static size_t __textureMemoryBudget = 0;
+static bool __textureMemoryBudgetLoaded = false;
+
+// Counts frames for the least recently used ordering of textures.
+static unsigned int __textureFrame = 0;
+
+// Textures are not reduced below this size by dropping mipmap levels.
+#define TEXTURE_MIN_DROP_SIZE 32
+
+std::vector<Texture::PendingLoad*> Texture::_pendingLoads;
+
+#ifdef GP_USE_PIXEL_BUFFERS
+// Pixel buffer that decoded rows are staged in for upload.
+static GLuint __uploadBuffer = 0;
+#endif
+
+#ifdef GP_USE_SAMPLER_OBJECTS
+// A sampler object shared by every sampler with the same state.
+struct SamplerObject
+{
+    GLenum minFilter;
+    GLenum magFilter;
+    GLenum wrapS;
+    GLenum wrapT;
+    GLenum wrapR;
+    GLuint handle;
+};
+static std::vector<SamplerObject> __samplerObjects;
+
+// Incremented whenever the sampler objects are deleted, so that samplers look theirs up again.
+static unsigned int __samplerObjectGeneration = 1;
+
+// Determines if sampler objects are supported by the context.
+static bool isSamplerObjectSupported()
+{
+    static int supported = -1;
+    if (supported < 0)
+        supported = (GLEW_VERSION_3_3 || GLEW_ARB_sampler_objects) && glBindSampler != NULL ? 1 : 0;
+    return supported != 0;
+}
+
+// Gets the sampler object with the given state, creating it the first time the state is used.
+static GLuint getSamplerObject(GLenum minFilter, GLenum magFilter, GLenum wrapS, GLenum wrapT, GLenum wrapR)
+{
+    for (size_t i = 0, count = __samplerObjects.size(); i < count; ++i)
+    {
+        const SamplerObject& object = __samplerObjects[i];
+        if (object.minFilter == minFilter && object.magFilter == magFilter && object.wrapS == wrapS && object.wrapT == wrapT && object.wrapR == wrapR)
+            return object.handle;
+    }
+
+    SamplerObject object;
+    object.minFilter = minFilter;
+    object.magFilter = magFilter;
+    object.wrapS = wrapS;
+    object.wrapT = wrapT;
+    object.wrapR = wrapR;
+    GL_ASSERT( glGenSamplers(1, &object.handle) );
+    GL_ASSERT( glSamplerParameteri(object.handle, GL_TEXTURE_MIN_FILTER, minFilter) );
+    GL_ASSERT( glSamplerParameteri(object.handle, GL_TEXTURE_MAG_FILTER, magFilter) );
+    GL_ASSERT( glSamplerParameteri(object.handle, GL_TEXTURE_WRAP_S, wrapS) );
+    GL_ASSERT( glSamplerParameteri(object.handle, GL_TEXTURE_WRAP_T, wrapT) );
+    GL_ASSERT( glSamplerParameteri(object.handle, GL_TEXTURE_WRAP_R, wrapR) );
+    __samplerObjects.push_back(object);
+    return object.handle;
+}
+#endif
+
+// Gets the number of bytes of decoded images that may be uploaded each frame.
+static size_t getUploadBudget()
+{
+    static size_t budget = 0;
+    if (budget == 0)
+    {
+        Properties* graphicsConfig = Game::getInstance()->getConfig()->getNamespace("graphics", true);
+        int kilobytes = graphicsConfig && graphicsConfig->exists("textureUploadBudget") ? graphicsConfig->getInt("textureUploadBudget") : 0;
+        budget = (size_t)(kilobytes > 0 ? kilobytes : 4096) * 1024;
+    }
+    return budget;
+}
 
 Texture::Texture() : _handle(0), _format(UNKNOWN), _type((Texture::Type)0), _width(0), _height(0), _mipmapped(false), _cached(false), _compressed(false),
-    _wrapS(Texture::REPEAT), _wrapT(Texture::REPEAT), _wrapR(Texture::REPEAT), _minFilter(Texture::NEAREST_MIPMAP_LINEAR), _magFilter(Texture::LINEAR)
+    _wrapS(Texture::REPEAT), _wrapT(Texture::REPEAT), _wrapR(Texture::REPEAT), _minFilter(Texture::NEAREST_MIPMAP_LINEAR), _magFilter(Texture::LINEAR),
+    _pendingLoad(NULL), _dynamic(NULL), _memorySize(0), _droppedLevels(0), _lastUsedFrame(__textureFrame), _retained(false)
 {
+    __textures.push_back(this);
 }
 
 Texture::~Texture()
 {
+    // The pending image is discarded once it has decoded.
+    if (_pendingLoad)
+    {
+        _pendingLoad->texture = NULL;
+        _pendingLoad = NULL;
+    }
+
+    setDynamic(false);
+
     if (_handle)
     {
-        GL_ASSERT( glDeleteTextures(1, &_handle) );
+        GLStateCache::deleteTexture(_handle);
         _handle = 0;
     }
+    setMemorySize(0);
+
+    std::vector<Texture*>::iterator textureItr = std::find(__textures.begin(), __textures.end(), this);
+    if (textureItr != __textures.end())
+    {
+        __textures.erase(textureItr);
+    }
 
     // Remove ourself from the texture cache.
     if (_cached)
@@ -75,6 +308,11 @@ Texture::~Texture()
     }
 }
 
+bool Texture::isDestroyedOnMainThread() const
+{
+    return true;
+}
+
 Texture* Texture::create(const char* path, bool generateMipmaps)
 {
     GP_ASSERT( path );
@@ -86,6 +324,9 @@ Texture* Texture::create(const char* path, bool generateMipmaps)
         GP_ASSERT( t );
         if (t->_path == path)
         {
+            // The caller expects the image, so don't return the placeholder of an asynchronous load.
+            t->finishLoading();
+
             // If 'generateMipmaps' is true, call Texture::generateMipamps() to force the
             // texture to generate its mipmap chain if it hasn't already done so.
             if (generateMipmaps)
@@ -109,7 +350,8 @@ Texture* Texture::create(const char* path, bool generateMipmaps)
         switch (strlen(ext))
         {
         case 4:
-            if (tolower(ext[1]) == 'p' && tolower(ext[2]) == 'n' && tolower(ext[3]) == 'g')
+            if ((tolower(ext[1]) == 'p' && tolower(ext[2]) == 'n' && tolower(ext[3]) == 'g') ||
+                (tolower(ext[1]) == 'q' && tolower(ext[2]) == 'o' && tolower(ext[3]) == 'i'))
             {
                 Image* image = Image::create(path);
                 if (image)
@@ -126,6 +368,18 @@ Texture* Texture::create(const char* path, bool generateMipmaps)
                 // DDS file format (DXT/S3TC) compressed textures
                 texture = createCompressedDDS(path);
             }
+            else if (tolower(ext[1]) == 'k' && tolower(ext[2]) == 't' && tolower(ext[3]) == 'x')
+            {
+                // KTX file format (ETC/ASTC/BC) compressed textures
+                texture = createCompressedKTX(path);
+            }
+            break;
+        case 5:
+            if (tolower(ext[1]) == 'k' && tolower(ext[2]) == 't' && tolower(ext[3]) == 'x' && ext[4] == '2')
+            {
+                // KTX2 file format (ETC/ASTC/BC) compressed textures
+                texture = createCompressedKTX(path);
+            }
             break;
         }
     }
@@ -138,6 +392,13 @@ Texture* Texture::create(const char* path, bool generateMipmaps)
         // Add to texture cache.
         __textureCache.push_back(texture);
 
+        // With a memory budget, the cache keeps the texture alive until it needs the memory back.
+        if (getMemoryBudget() > 0)
+        {
+            texture->addRef();
+            texture->_retained = true;
+        }
+
         return texture;
     }
 
@@ -145,6 +406,295 @@ Texture* Texture::create(const char* path, bool generateMipmaps)
     return NULL;
 }
 
+Texture* Texture::createAsync(const char* path, bool generateMipmaps, const LoadCallback& callback)
+{
+    GP_ASSERT( path );
+
+    // Search texture cache first.
+    for (size_t i = 0, count = __textureCache.size(); i < count; ++i)
+    {
+        Texture* t = __textureCache[i];
+        GP_ASSERT( t );
+        if (t->_path == path)
+        {
+            t->addRef();
+            if (t->_pendingLoad)
+            {
+                t->_pendingLoad->generateMipmaps |= generateMipmaps;
+                if (callback)
+                    t->_pendingLoad->callbacks.push_back(callback);
+            }
+            else
+            {
+                if (generateMipmaps)
+                    t->generateMipmaps();
+                if (callback)
+                    callback(t, true);
+            }
+            return t;
+        }
+    }
+
+    // Only PNG and QOI images are decoded in the background, the other formats are uploaded as they are read.
+    const char* ext = strrchr(FileSystem::resolvePath(path), '.');
+    if (ext == NULL || strlen(ext) != 4 ||
+        !((tolower(ext[1]) == 'p' && tolower(ext[2]) == 'n' && tolower(ext[3]) == 'g') ||
+          (tolower(ext[1]) == 'q' && tolower(ext[2]) == 'o' && tolower(ext[3]) == 'i')))
+    {
+        Texture* texture = create(path, generateMipmaps);
+        if (texture && callback)
+            callback(texture, true);
+        return texture;
+    }
+
+    // A single texel is mipmap complete, so the placeholder can be sampled with any filter.
+    static const unsigned char placeholder[] = { 255, 255, 255, 255 };
+    Texture* texture = create(Texture::RGBA, 1, 1, placeholder, false);
+    if (generateMipmaps)
+    {
+        texture->_minFilter = NEAREST_MIPMAP_LINEAR;
+        GL_ASSERT( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, texture->_minFilter) );
+    }
+    texture->_path = path;
+    texture->_cached = true;
+    __textureCache.push_back(texture);
+    if (getMemoryBudget() > 0)
+    {
+        texture->addRef();
+        texture->_retained = true;
+    }
+
+    PendingLoad* load = new PendingLoad();
+    load->texture = texture;
+    load->path = path;
+    load->generateMipmaps = generateMipmaps;
+    if (callback)
+        load->callbacks.push_back(callback);
+    texture->_pendingLoad = load;
+    _pendingLoads.push_back(load);
+
+    // The image is decoded straight into a buffer, since worker threads must not create Ref objects,
+    // and uploaded as soon as it has decoded when there is an upload thread.
+    UploadThread* uploadThread = Game::getInstance()->getUploadThread();
+    JobSystem::Function decode = [load, uploadThread]()
+    {
+        load->data = Image::read(load->path.c_str(), NULL, 0, &load->width, &load->height, &load->format);
+        if (load->data && uploadThread)
+            uploadThread->run([load]() { uploadImage(load); }, &load->uploaded);
+    };
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem)
+        jobSystem->run(decode, &load->decoded);
+    else
+        decode();
+
+    return texture;
+}
+
+size_t Texture::uploadPending(PendingLoad* load, size_t budget)
+{
+    GP_ASSERT( load );
+    GP_ASSERT( load->data );
+
+    GLenum format = load->format == Image::RGBA ? GL_RGBA : GL_RGB;
+    size_t stride = load->width * (load->format == Image::RGBA ? 4 : 3);
+
+    if (load->handle == 0)
+    {
+        // The image is uploaded to a texture of its own so that the placeholder is shown until all of its rows are in.
+        GL_ASSERT( glGenTextures(1, &load->handle) );
+        GLStateCache::bindTexture(GL_TEXTURE_2D, load->handle);
+        GL_ASSERT( glTexImage2D(GL_TEXTURE_2D, 0, format, load->width, load->height, 0, format, GL_UNSIGNED_BYTE, NULL) );
+    }
+    else
+    {
+        GLStateCache::bindTexture(GL_TEXTURE_2D, load->handle);
+    }
+    GL_ASSERT( glPixelStorei(GL_UNPACK_ALIGNMENT, 1) );
+
+    // Always upload at least one row so that images wider than the budget still make progress.
+    unsigned int rows = (unsigned int)std::min((size_t)(load->height - load->uploadedRows), std::max(budget / stride, (size_t)1));
+    const unsigned char* pixels = load->data + load->uploadedRows * stride;
+    size_t size = rows * stride;
+
+#ifdef GP_USE_PIXEL_BUFFERS
+    // Stage the rows in a pixel buffer so that the driver can copy them to the texture asynchronously.
+    bool staged = false;
+    if (glMapBuffer && glUnmapBuffer)
+    {
+        if (__uploadBuffer == 0)
+        {
+            GL_ASSERT( glGenBuffers(1, &__uploadBuffer) );
+        }
+        GL_ASSERT( glBindBuffer(GL_PIXEL_UNPACK_BUFFER, __uploadBuffer) );
+
+        // Orphan the previous contents so that mapping doesn't wait on the last upload.
+        GL_ASSERT( glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW) );
+        void* mapped = glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+        if (mapped)
+        {
+            memcpy(mapped, pixels, size);
+            staged = glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE;
+        }
+        if (staged)
+        {
+            GL_ASSERT( glTexSubImage2D(GL_TEXTURE_2D, 0, 0, load->uploadedRows, load->width, rows, format, GL_UNSIGNED_BYTE, (const GLvoid*)0) );
+        }
+
+        // Other uploads read from client memory.
+        GL_ASSERT( glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0) );
+    }
+    if (!staged)
+#endif
+    {
+        GL_ASSERT( glTexSubImage2D(GL_TEXTURE_2D, 0, 0, load->uploadedRows, load->width, rows, format, GL_UNSIGNED_BYTE, pixels) );
+    }
+
+    FrameCapture::record(FrameCapture::UPLOAD_TEXTURE, GL_TEXTURE_2D, load->handle, 0, (unsigned int)size);
+    load->uploadedRows += rows;
+    return size;
+}
+
+void Texture::uploadImage(PendingLoad* load)
+{
+    GP_ASSERT( load );
+    GP_ASSERT( load->data );
+
+    // The upload context has no state cache of its own, so its bindings are made directly.
+    GLenum format = load->format == Image::RGBA ? GL_RGBA : GL_RGB;
+    GL_ASSERT( glGenTextures(1, &load->handle) );
+    GL_ASSERT( glBindTexture(GL_TEXTURE_2D, load->handle) );
+    GL_ASSERT( glPixelStorei(GL_UNPACK_ALIGNMENT, 1) );
+    GL_ASSERT( glTexImage2D(GL_TEXTURE_2D, 0, format, load->width, load->height, 0, format, GL_UNSIGNED_BYTE, load->data) );
+    GL_ASSERT( glBindTexture(GL_TEXTURE_2D, 0) );
+    load->uploadedRows = load->height;
+}
+
+void Texture::completePending(PendingLoad* load)
+{
+    GP_ASSERT( load );
+
+    Texture* texture = load->texture;
+    bool loaded = texture && load->data && load->uploadedRows == load->height;
+    if (texture)
+    {
+        texture->_pendingLoad = NULL;
+        if (loaded)
+        {
+            // Replace the placeholder with the uploaded texture and carry its sampler state over.
+            GLStateCache::deleteTexture(texture->_handle);
+            texture->_handle = load->handle;
+            load->handle = 0;
+            texture->_format = load->format == Image::RGBA ? Texture::RGBA : Texture::RGB;
+            texture->_width = load->width;
+            texture->_height = load->height;
+            texture->_internalFormat = getFormatInternal(texture->_format);
+            texture->_texelType = getFormatTexel(texture->_format);
+            texture->_bpp = getFormatBPP(texture->_format);
+            texture->_mipmapped = false;
+            texture->setMemorySize(computeMemorySize(texture->_width, texture->_height, texture->_bpp, false, 1));
+
+            GLStateCache::bindTexture(GL_TEXTURE_2D, texture->_handle);
+            GL_ASSERT( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (GLenum)texture->_minFilter) );
+            GL_ASSERT( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, (GLenum)texture->_magFilter) );
+            GL_ASSERT( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, (GLenum)texture->_wrapS) );
+            GL_ASSERT( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, (GLenum)texture->_wrapT) );
+            if (load->generateMipmaps)
+                texture->generateMipmaps();
+        }
+    }
+
+    if (load->handle)
+    {
+        GLStateCache::deleteTexture(load->handle);
+    }
+    SAFE_DELETE_ARRAY(load->data);
+
+    // Keep the texture alive in case a callback releases it.
+    if (texture && !load->callbacks.empty())
+    {
+        texture->addRef();
+        for (size_t i = 0, count = load->callbacks.size(); i < count; ++i)
+        {
+            load->callbacks[i](texture, loaded);
+        }
+        SAFE_RELEASE(texture);
+    }
+    SAFE_DELETE(load);
+}
+
+void Texture::updatePending()
+{
+    ++__textureFrame;
+
+    size_t budget = getUploadBudget();
+    size_t uploaded = 0;
+    for (size_t i = 0; i < _pendingLoads.size() && uploaded < budget;)
+    {
+        PendingLoad* load = _pendingLoads[i];
+        if (!load->decoded.isDone() || !load->uploaded.isDone())
+        {
+            ++i;
+            continue;
+        }
+
+        if (load->texture && load->data && load->uploadedRows < load->height)
+        {
+            uploaded += uploadPending(load, budget - uploaded);
+            if (load->uploadedRows < load->height)
+            {
+                ++i;
+                continue;
+            }
+        }
+
+        // Callbacks may start other loads, so the load is removed before they are fired.
+        _pendingLoads.erase(_pendingLoads.begin() + i);
+        completePending(load);
+    }
+
+    updateResidency();
+}
+
+void Texture::finalize()
+{
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    for (size_t i = 0, count = _pendingLoads.size(); i < count; ++i)
+    {
+        PendingLoad* load = _pendingLoads[i];
+        if (jobSystem)
+        {
+            jobSystem->wait(&load->decoded);
+            jobSystem->wait(&load->uploaded);
+        }
+        if (load->texture)
+        {
+            load->texture->_pendingLoad = NULL;
+            load->texture = NULL;
+        }
+        completePending(load);
+    }
+    _pendingLoads.clear();
+
+    // Release the textures that only the cache was keeping alive.
+    releaseRetained();
+
+#ifdef GP_USE_PIXEL_BUFFERS
+    if (__uploadBuffer)
+    {
+        GL_ASSERT( glDeleteBuffers(1, &__uploadBuffer) );
+        __uploadBuffer = 0;
+    }
+#endif
+
+#ifdef GP_USE_SAMPLER_OBJECTS
+    for (size_t i = 0, count = __samplerObjects.size(); i < count; ++i)
+        GLStateCache::deleteSampler(__samplerObjects[i].handle);
+    __samplerObjects.clear();
+    ++__samplerObjectGeneration;
+#endif
+}
+
 Texture* Texture::create(Image* image, bool generateMipmaps)
 {
     GP_ASSERT( image );
@@ -244,7 +794,7 @@ Texture* Texture::create(Format format, unsigned int width, unsigned int height,
     // Create the texture.
     GLuint textureId;
     GL_ASSERT( glGenTextures(1, &textureId) );
-    GL_ASSERT( glBindTexture(target, textureId) );
+    GLStateCache::bindTexture(target, textureId);
     GL_ASSERT( glPixelStorei(GL_UNPACK_ALIGNMENT, 1) );
 #ifndef OPENGL_ES
     // glGenerateMipmap is new in OpenGL 3.0. For OpenGL 2.0 we must fallback to use glTexParameteri
@@ -266,7 +816,7 @@ Texture* Texture::create(Format format, unsigned int width, unsigned int height,
         unsigned int textureSize = width * height;
         if (bpp == 0)
         {
-            glDeleteTextures(1, &textureId);
+            GLStateCache::deleteTexture(textureId);
             GP_ERROR("Failed to determine texture size because format is UNKNOWN.");
             return NULL;
         }
@@ -308,13 +858,10 @@ Texture* Texture::create(Format format, unsigned int width, unsigned int height,
     texture->_internalFormat = internalFormat;
     texture->_texelType = texelType;
     texture->_bpp = bpp;
+    texture->setMemorySize(computeMemorySize(width, height, format == Texture::DEPTH ? 4 : bpp, false, type == Texture::TEXTURE_CUBE ? 6 : 1));
     if (generateMipmaps)
         texture->generateMipmaps();
 
-
-    // Restore the texture id
-    GL_ASSERT( glBindTexture((GLenum)__currentTextureType, __currentTextureId) );
-
     return texture;
 }
 
@@ -337,8 +884,8 @@ Texture* Texture::create(TextureHandle handle, int width, int height, Format for
             texture->_type = TEXTURE_2D;
         }
 
-        // Restore the texture id
-        GL_ASSERT( glBindTexture((GLenum)__currentTextureType, __currentTextureId) );
+        // The probe binds the texture without going through the state cache.
+        GLStateCache::invalidate();
     }
     texture->_handle = handle;
     texture->_format = format;
@@ -347,57 +894,274 @@ Texture* Texture::create(TextureHandle handle, int width, int height, Format for
     texture->_internalFormat = getFormatInternal(format);
     texture->_texelType = getFormatTexel(format);
     texture->_bpp = getFormatBPP(format);
+    texture->setMemorySize(computeMemorySize(width, height, texture->_bpp, false, texture->_type == TEXTURE_CUBE ? 6 : 1));
 
     return texture;
 }
 
-void Texture::setData(const unsigned char* data)
+Texture* Texture::createArray(Image** images, unsigned int count, bool generateMipmaps)
 {
-    // Don't work with any compressed or cached textures
-    GP_ASSERT( data );
-    GP_ASSERT( (!_compressed) );
-    GP_ASSERT( (!_cached) );
+    GP_ASSERT( images );
 
-    GL_ASSERT( glBindTexture((GLenum)_type, _handle) );
+#ifdef GP_USE_TEXTURE_ARRAYS
+    if (count == 0 || !isArraySupported())
+    {
+        GP_WARN("Texture arrays are not supported by the graphics driver.");
+        return NULL;
+    }
 
-    if (_type == Texture::TEXTURE_2D)
+    // Every layer must match the first.
+    Image* first = images[0];
+    GP_ASSERT( first );
+    Format format = first->getFormat() == Image::RGB ? RGB : (first->getFormat() == Image::RGBA ? RGBA : UNKNOWN);
+    if (format == UNKNOWN)
     {
-        GL_ASSERT( glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, _width, _height, _internalFormat, _texelType, data) );
+        GP_ERROR("Unsupported image format (%d).", first->getFormat());
+        return NULL;
     }
-    else
+    for (unsigned int i = 1; i < count; ++i)
     {
-        // Get texture size
-        unsigned int textureSize = _width * _height;
-        textureSize *= _bpp;
-        // Texture Cube
-        for (unsigned int i = 0; i < 6; i++)
+        GP_ASSERT( images[i] );
+        if (images[i]->getWidth() != first->getWidth() || images[i]->getHeight() != first->getHeight() || images[i]->getFormat() != first->getFormat())
         {
-            GL_ASSERT( glTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, 0, 0, _width, _height, _internalFormat, _texelType, &data[i * textureSize]) );
+            GP_WARN("All layers of a texture array must have the same size and format (layer %u differs).", i);
+            return NULL;
         }
     }
 
-    if (_mipmapped)
+    GLint internalFormat = getFormatInternal(format);
+    GLenum texelType = getFormatTexel(format);
+    unsigned int width = first->getWidth();
+    unsigned int height = first->getHeight();
+
+    // Create the texture and upload the layers.
+    GLuint textureId;
+    GL_ASSERT( glGenTextures(1, &textureId) );
+    GLStateCache::bindTexture(GL_TEXTURE_2D_ARRAY, textureId);
+    GL_ASSERT( glPixelStorei(GL_UNPACK_ALIGNMENT, 1) );
+    GL_ASSERT( glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, internalFormat, width, height, count, 0, internalFormat, texelType, NULL) );
+    for (unsigned int i = 0; i < count; ++i)
     {
-        generateMipmaps();
+        GL_ASSERT( glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, i, width, height, 1, internalFormat, texelType, images[i]->getData()) );
     }
 
-    // Restore the texture id
-    GL_ASSERT( glBindTexture((GLenum)__currentTextureType, __currentTextureId) );
+    Filter minFilter = generateMipmaps ? NEAREST_MIPMAP_LINEAR : LINEAR;
+    GL_ASSERT( glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, minFilter) );
+
+    Texture* texture = new Texture();
+    texture->_handle = textureId;
+    texture->_format = format;
+    texture->_type = TEXTURE_2D_ARRAY;
+    texture->_width = width;
+    texture->_height = height;
+    texture->_minFilter = minFilter;
+    texture->_internalFormat = internalFormat;
+    texture->_texelType = texelType;
+    texture->_bpp = getFormatBPP(format);
+    texture->setMemorySize(computeMemorySize(width, height, texture->_bpp, false, count));
+    if (generateMipmaps)
+        texture->generateMipmaps();
+
+    return texture;
+#else
+    GP_WARN("Texture arrays are not supported on this platform.");
+    return NULL;
+#endif
 }
 
-// Computes the size of a PVRTC data chunk for a mipmap level of the given size.
-static unsigned int computePVRTCDataSize(int width, int height, int bpp)
+bool Texture::isArraySupported()
 {
-    int blockSize;
-    int widthBlocks;
-    int heightBlocks;
+#ifdef GP_USE_TEXTURE_ARRAYS
+    return GLEW_VERSION_3_0 || GLEW_EXT_texture_array;
+#else
+    return false;
+#endif
+}
 
-    if (bpp == 4)
-    {
-        blockSize = 4 * 4; // Pixel by pixel block size for 4bpp
-        widthBlocks = std::max(width >> 2, 2);
-        heightBlocks = std::max(height >> 2, 2);
-    }
+void Texture::setData(const unsigned char* data)
+{
+    // Don't work with any compressed or cached textures
+    GP_ASSERT( data );
+    GP_ASSERT( (!_compressed) );
+    GP_ASSERT( (!_cached) );
+
+    GLStateCache::bindTexture((GLenum)_type, _handle);
+
+    // Get texture size
+    unsigned int textureSize = _width * _height;
+    textureSize *= _bpp;
+
+    // Staged data is read from the start of the bound pixel buffer rather than from client memory.
+    const bool staged = stageData(data, _type == Texture::TEXTURE_2D ? textureSize : textureSize * 6);
+    const unsigned char* pixels = staged ? NULL : data;
+    FrameCapture::record(FrameCapture::UPLOAD_TEXTURE, (GLenum)_type, _handle, 0, _type == Texture::TEXTURE_2D ? textureSize : textureSize * 6);
+
+    if (_type == Texture::TEXTURE_2D)
+    {
+        if (_dynamic && _dynamic->reallocate)
+        {
+            GL_ASSERT( glTexImage2D(GL_TEXTURE_2D, 0, _internalFormat, _width, _height, 0, _internalFormat, _texelType, pixels) );
+        }
+        else
+        {
+            GL_ASSERT( glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, _width, _height, _internalFormat, _texelType, pixels) );
+        }
+    }
+    else
+    {
+        // Texture Cube
+        for (unsigned int i = 0; i < 6; i++)
+        {
+            GLenum face = GL_TEXTURE_CUBE_MAP_POSITIVE_X + i;
+            if (_dynamic && _dynamic->reallocate)
+            {
+                GL_ASSERT( glTexImage2D(face, 0, _internalFormat, _width, _height, 0, _internalFormat, _texelType, pixels + i * textureSize) );
+            }
+            else
+            {
+                GL_ASSERT( glTexSubImage2D(face, 0, 0, 0, _width, _height, _internalFormat, _texelType, pixels + i * textureSize) );
+            }
+        }
+    }
+
+    if (staged)
+        endStaging();
+
+    if (_mipmapped)
+    {
+        generateMipmaps();
+    }
+}
+
+void Texture::setData(const unsigned char* data, unsigned int x, unsigned int y, unsigned int width, unsigned int height)
+{
+    // Don't work with any compressed or cached textures
+    GP_ASSERT( data );
+    GP_ASSERT( (!_compressed) );
+    GP_ASSERT( (!_cached) );
+    GP_ASSERT( _type == Texture::TEXTURE_2D );
+    GP_ASSERT( x + width <= _width && y + height <= _height );
+
+    GLStateCache::bindTexture((GLenum)_type, _handle);
+
+    const bool staged = stageData(data, width * height * _bpp);
+    FrameCapture::record(FrameCapture::UPLOAD_TEXTURE, GL_TEXTURE_2D, _handle, 0, width * height * _bpp);
+    GL_ASSERT( glPixelStorei(GL_UNPACK_ALIGNMENT, 1) );
+    GL_ASSERT( glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, _internalFormat, _texelType, staged ? NULL : data) );
+    if (staged)
+        endStaging();
+
+    if (_mipmapped)
+    {
+        generateMipmaps();
+    }
+}
+
+void Texture::setDynamic(bool dynamic, bool reallocate)
+{
+    if (dynamic)
+    {
+        GP_ASSERT( (!_compressed) );
+        GP_ASSERT( (!_cached) );
+        if (_dynamic == NULL)
+            _dynamic = new DynamicData();
+        _dynamic->reallocate = reallocate;
+        return;
+    }
+
+    if (_dynamic == NULL)
+        return;
+#ifdef GP_USE_PIXEL_BUFFERS
+    for (unsigned int i = 0; i < TEXTURE_DYNAMIC_BUFFER_COUNT; ++i)
+    {
+#ifdef GP_USE_BUFFER_SYNC
+        if (_dynamic->fences[i])
+            GL_ASSERT( glDeleteSync(_dynamic->fences[i]) );
+#endif
+        if (_dynamic->buffers[i])
+            GL_ASSERT( glDeleteBuffers(1, &_dynamic->buffers[i]) );
+    }
+#endif
+    SAFE_DELETE(_dynamic);
+}
+
+bool Texture::isDynamic() const
+{
+    return _dynamic != NULL;
+}
+
+bool Texture::stageData(const unsigned char* data, size_t size)
+{
+#ifdef GP_USE_PIXEL_BUFFERS
+    if (_dynamic == NULL || size == 0 || !(glMapBufferRange && glUnmapBuffer))
+        return false;
+
+    unsigned int index = _dynamic->index = (_dynamic->index + 1) % TEXTURE_DYNAMIC_BUFFER_COUNT;
+    GLuint& buffer = _dynamic->buffers[index];
+    if (buffer == 0)
+    {
+        GL_ASSERT( glGenBuffers(1, &buffer) );
+    }
+    GL_ASSERT( glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer) );
+
+    // The buffer is only written in place once the copy out of it has finished. Until then,
+    // it is orphaned, so that mapping it doesn't wait on the GPU.
+    bool idle = false;
+#ifdef GP_USE_BUFFER_SYNC
+    GLsync& fence = _dynamic->fences[index];
+    if (fence)
+    {
+        GLenum result = glClientWaitSync(fence, 0, 0);
+        idle = result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+        GL_ASSERT( glDeleteSync(fence) );
+        fence = 0;
+    }
+#endif
+    if (!idle || _dynamic->sizes[index] < size)
+    {
+        _dynamic->sizes[index] = std::max(_dynamic->sizes[index], size);
+        GL_ASSERT( glBufferData(GL_PIXEL_UNPACK_BUFFER, _dynamic->sizes[index], NULL, GL_STREAM_DRAW) );
+    }
+
+    void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (mapped)
+    {
+        memcpy(mapped, data, size);
+        if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE)
+            return true;
+    }
+
+    // Other uploads read from client memory.
+    GL_ASSERT( glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0) );
+#endif
+    return false;
+}
+
+void Texture::endStaging()
+{
+#ifdef GP_USE_PIXEL_BUFFERS
+    GP_ASSERT( _dynamic );
+#ifdef GP_USE_BUFFER_SYNC
+    if (glFenceSync && glClientWaitSync && glDeleteSync)
+        GL_ASSERT( _dynamic->fences[_dynamic->index] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) );
+#endif
+    GL_ASSERT( glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0) );
+#endif
+}
+
+// Computes the size of a PVRTC data chunk for a mipmap level of the given size.
+static unsigned int computePVRTCDataSize(int width, int height, int bpp)
+{
+    int blockSize;
+    int widthBlocks;
+    int heightBlocks;
+
+    if (bpp == 4)
+    {
+        blockSize = 4 * 4; // Pixel by pixel block size for 4bpp
+        widthBlocks = std::max(width >> 2, 2);
+        heightBlocks = std::max(height >> 2, 2);
+    }
     else
     {
         blockSize = 8 * 4; // Pixel by pixel block size for 2bpp
@@ -465,7 +1229,7 @@ Texture* Texture::createCompressedPVRTC(const char* path)
     GLenum target = faceCount > 1 ? GL_TEXTURE_CUBE_MAP : GL_TEXTURE_2D;
     GLuint textureId;
     GL_ASSERT( glGenTextures(1, &textureId) );
-    GL_ASSERT( glBindTexture(target, textureId) );
+    GLStateCache::bindTexture(target, textureId);
 
     Filter minFilter = mipMapCount > 1 ? NEAREST_MIPMAP_LINEAR : LINEAR;
     GL_ASSERT( glTexParameteri(target, GL_TEXTURE_MIN_FILTER, minFilter) );
@@ -481,9 +1245,11 @@ Texture* Texture::createCompressedPVRTC(const char* path)
 
     // Load the data for each level.
     GLubyte* ptr = data;
+    size_t memorySize = 0;
     for (unsigned int level = 0; level < mipMapCount; ++level)
     {
         unsigned int dataSize = computePVRTCDataSize(width, height, bpp);
+        memorySize += dataSize * faceCount;
 
         for (unsigned int face = 0; face < faceCount; ++face)
         {
@@ -495,13 +1261,11 @@ Texture* Texture::createCompressedPVRTC(const char* path)
         height = std::max(height >> 1, 1);
         ptr += dataSize * faceCount;
     }
+    texture->setMemorySize(memorySize);
 
     // Free data.
     SAFE_DELETE_ARRAY(data);
 
-    // Restore the texture id
-    GL_ASSERT( glBindTexture((GLenum)__currentTextureType, __currentTextureId) );
-
     return texture;
 }
 
@@ -832,6 +1596,7 @@ Texture* Texture::createCompressedDDS(const char* path)
         GLsizei width;
         GLsizei height;
         GLsizei size;
+        bool mapped;        // Whether the data points into the mapped file rather than being read into memory
     };
 
     Texture* texture = NULL;
@@ -951,16 +1716,28 @@ Texture* Texture::createCompressedDDS(const char* path)
                 level.width = width;
                 level.height = height;
                 level.size = std::max(1, (width + 3) >> 2) * std::max(1, (height + 3) >> 2) * bytesPerBlock;
-                level.data = new GLubyte[level.size];
 
-                if (stream->read(level.data, 1, level.size) != (unsigned int)level.size)
+                // Compressed levels are uploaded straight from the file when the stream can map it.
+                const void* mapped = stream->map(level.size);
+                if (mapped)
+                {
+                    level.data = const_cast<GLubyte*>((const GLubyte*)mapped);
+                    level.mapped = true;
+                }
+                else
+                {
+                    level.data = new GLubyte[level.size];
+                }
+
+                if (!level.mapped && stream->read(level.data, 1, level.size) != (unsigned int)level.size)
                 {
                     GP_ERROR("Failed to load dds compressed texture bytes for texture: %s", path);
 
                     // Cleanup mip data.
                     for (unsigned int face = 0; face < facecount; ++face)
                         for (unsigned int i = 0; i < header.dwMipMapCount; ++i)
-                            SAFE_DELETE_ARRAY(mipLevels[i + face * header.dwMipMapCount].data);
+                            if (!mipLevels[i + face * header.dwMipMapCount].mapped)
+                                SAFE_DELETE_ARRAY(mipLevels[i + face * header.dwMipMapCount].data);
                     SAFE_DELETE_ARRAY(mipLevels);
                     return texture;
                 }
@@ -1101,13 +1878,10 @@ Texture* Texture::createCompressedDDS(const char* path)
         return NULL;
     }
 
-    // Close file.
-    stream->close();
-
     // Generate GL texture.
     GLuint textureId;
     GL_ASSERT( glGenTextures(1, &textureId) );
-    GL_ASSERT( glBindTexture(target, textureId) );
+    GLStateCache::bindTexture(target, textureId);
 
     Filter minFilter = header.dwMipMapCount > 1 ? NEAREST_MIPMAP_LINEAR : LINEAR;
     GL_ASSERT( glTexParameteri(target, GL_TEXTURE_MIN_FILTER, minFilter ) );
@@ -1123,12 +1897,14 @@ Texture* Texture::createCompressedDDS(const char* path)
     texture->_minFilter = minFilter;
 
     // Load texture data.
+    size_t memorySize = 0;
     for (unsigned int face = 0; face < facecount; ++face)
     {
         GLenum texImageTarget = faces[face];
         for (unsigned int i = 0; i < header.dwMipMapCount; ++i)
         {
             dds_mip_level& level = mipLevels[i + face * header.dwMipMapCount];
+            memorySize += level.size;
             if (compressed)
             {
                 GL_ASSERT(glCompressedTexImage2D(texImageTarget, i, format, level.width, level.height, 0, level.size, level.data));
@@ -1139,15 +1915,381 @@ Texture* Texture::createCompressedDDS(const char* path)
             }
 
             // Clean up the texture data.
-            SAFE_DELETE_ARRAY(level.data);
+            if (!level.mapped)
+                SAFE_DELETE_ARRAY(level.data);
         }
     }
 
+    // Close file, which the mapped texture data points into.
+    stream->close();
+
+    texture->setMemorySize(memorySize);
+
     // Clean up mip levels structure.
     SAFE_DELETE_ARRAY(mipLevels);
 
-    // Restore the texture id
-    GL_ASSERT( glBindTexture((GLenum)__currentTextureType, __currentTextureId) );
+    return texture;
+}
+
+// Vulkan formats of KTX2 files and the GL formats they are uploaded as.
+static const struct
+{
+    unsigned int vkFormat;
+    GLenum internalFormat;
+} __ktx2Formats[] =
+{
+    { 131, GL_COMPRESSED_RGB_S3TC_DXT1_EXT },
+    { 132, GL_COMPRESSED_SRGB_S3TC_DXT1_EXT },
+    { 133, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT },
+    { 134, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT },
+    { 135, GL_COMPRESSED_RGBA_S3TC_DXT3_EXT },
+    { 136, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT },
+    { 137, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT },
+    { 138, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT },
+    { 139, GL_COMPRESSED_RED_RGTC1 },
+    { 140, GL_COMPRESSED_SIGNED_RED_RGTC1 },
+    { 141, GL_COMPRESSED_RG_RGTC2 },
+    { 142, GL_COMPRESSED_SIGNED_RG_RGTC2 },
+    { 143, GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT },
+    { 144, GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT },
+    { 145, GL_COMPRESSED_RGBA_BPTC_UNORM },
+    { 146, GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM },
+    { 147, GL_COMPRESSED_RGB8_ETC2 },
+    { 148, GL_COMPRESSED_SRGB8_ETC2 },
+    { 149, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2 },
+    { 150, GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2 },
+    { 151, GL_COMPRESSED_RGBA8_ETC2_EAC },
+    { 152, GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC },
+    { 153, GL_COMPRESSED_R11_EAC },
+    { 154, GL_COMPRESSED_SIGNED_R11_EAC },
+    { 155, GL_COMPRESSED_RG11_EAC },
+    { 156, GL_COMPRESSED_SIGNED_RG11_EAC }
+};
+
+// Gets the GL format of a KTX2 Vulkan format. The texel type is zero for compressed formats.
+static bool getKTX2Format(unsigned int vkFormat, GLenum* internalFormat, GLenum* format, GLenum* type)
+{
+    *format = 0;
+    *type = 0;
+    if (vkFormat == 23/*VK_FORMAT_R8G8B8_UNORM*/ || vkFormat == 37/*VK_FORMAT_R8G8B8A8_UNORM*/)
+    {
+        *internalFormat = *format = vkFormat == 23 ? GL_RGB : GL_RGBA;
+        *type = GL_UNSIGNED_BYTE;
+        return true;
+    }
+    if (vkFormat >= 157 && vkFormat <= 184)
+    {
+        // ASTC block sizes are in the same order in Vulkan and GL, where Vulkan alternates UNORM and SRGB.
+        GLenum first = ((vkFormat - 157) & 1) ? GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR : GL_COMPRESSED_RGBA_ASTC_4x4_KHR;
+        *internalFormat = first + ((vkFormat - 157) >> 1);
+        return true;
+    }
+    for (size_t i = 0; i < sizeof(__ktx2Formats) / sizeof(__ktx2Formats[0]); ++i)
+    {
+        if (__ktx2Formats[i].vkFormat == vkFormat)
+        {
+            *internalFormat = __ktx2Formats[i].internalFormat;
+            return true;
+        }
+    }
+    return false;
+}
+
+Texture* Texture::createCompressedKTX(const char* path)
+{
+    GP_ASSERT( path );
+
+    // KTX file structures.
+    struct ktx_header
+    {
+        unsigned int endianness;
+        unsigned int glType;
+        unsigned int glTypeSize;
+        unsigned int glFormat;
+        unsigned int glInternalFormat;
+        unsigned int glBaseInternalFormat;
+        unsigned int pixelWidth;
+        unsigned int pixelHeight;
+        unsigned int pixelDepth;
+        unsigned int numberOfArrayElements;
+        unsigned int numberOfFaces;
+        unsigned int numberOfMipmapLevels;
+        unsigned int bytesOfKeyValueData;
+    };
+
+    struct ktx2_header
+    {
+        unsigned int vkFormat;
+        unsigned int typeSize;
+        unsigned int pixelWidth;
+        unsigned int pixelHeight;
+        unsigned int pixelDepth;
+        unsigned int layerCount;
+        unsigned int faceCount;
+        unsigned int levelCount;
+        unsigned int supercompressionScheme;
+        unsigned int dfdByteOffset;
+        unsigned int dfdByteLength;
+        unsigned int kvdByteOffset;
+        unsigned int kvdByteLength;
+    };
+
+    struct ktx2_level
+    {
+        unsigned long long byteOffset;
+        unsigned long long byteLength;
+        unsigned long long uncompressedByteLength;
+    };
+
+    struct ktx_image
+    {
+        GLenum target;
+        GLint level;
+        GLsizei width;
+        GLsizei height;
+        GLsizei size;
+        const GLubyte* data;
+    };
+
+    static const unsigned char ktxIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+    static const unsigned char ktx2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+    // Map the whole KTX file, or read it when its stream cannot be mapped, the images are uploaded straight from it.
+    std::unique_ptr<Stream> stream(FileSystem::open(path));
+    if (stream.get() == NULL || !stream->canRead())
+    {
+        GP_ERROR("Failed to open file '%s'.", path);
+        return NULL;
+    }
+    size_t size = stream->length();
+    char* file = NULL;
+    const GLubyte* bytes = (const GLubyte*)stream->map(size);
+    if (bytes == NULL)
+    {
+        file = new char[size];
+        if (stream->read(file, 1, size) != size)
+        {
+            GP_ERROR("Failed to read file '%s'.", path);
+            SAFE_DELETE_ARRAY(file);
+            return NULL;
+        }
+        bytes = (const GLubyte*)file;
+    }
+
+    // Validate KTX identifier.
+    bool ktx2 = size >= 12 && memcmp(bytes, ktx2Identifier, 12) == 0;
+    if (!ktx2 && (size < 12 || memcmp(bytes, ktxIdentifier, 12) != 0))
+    {
+        GP_ERROR("Failed to read KTX file '%s': invalid KTX identifier.", path);
+        SAFE_DELETE_ARRAY(file);
+        return NULL;
+    }
+
+    GLenum internalFormat = 0;
+    GLenum format = 0;
+    GLenum type = 0;
+    unsigned int width = 0;
+    unsigned int height = 0;
+    unsigned int faceCount = 0;
+    unsigned int levelCount = 0;
+    std::vector<ktx_image> images;
+    bool truncated = false;
+
+    if (ktx2)
+    {
+        // Read KTX2 header, followed by the supercompression global data offsets and the level index.
+        ktx2_header header;
+        size_t levelIndex = 12 + sizeof(ktx2_header) + 2 * sizeof(unsigned long long);
+        if (size < levelIndex)
+        {
+            GP_ERROR("Failed to read header for KTX2 file '%s'.", path);
+            SAFE_DELETE_ARRAY(file);
+            return NULL;
+        }
+        memcpy(&header, bytes + 12, sizeof(ktx2_header));
+
+        if (header.supercompressionScheme != 0)
+        {
+            GP_ERROR("Failed to create texture from KTX2 file '%s': supercompressed files are unsupported.", path);
+            SAFE_DELETE_ARRAY(file);
+            return NULL;
+        }
+        if (header.pixelDepth > 1 || header.layerCount > 1)
+        {
+            GP_ERROR("Failed to create texture from KTX2 file '%s': volume and array textures are unsupported.", path);
+            SAFE_DELETE_ARRAY(file);
+            return NULL;
+        }
+        if (!getKTX2Format(header.vkFormat, &internalFormat, &format, &type))
+        {
+            GP_ERROR("Unsupported texture format (%u) for KTX2 file '%s'.", header.vkFormat, path);
+            SAFE_DELETE_ARRAY(file);
+            return NULL;
+        }
+
+        width = header.pixelWidth;
+        height = std::max(header.pixelHeight, 1u);
+        faceCount = header.faceCount;
+        levelCount = header.levelCount;
+
+        // Each level holds the images of all of its faces back to back.
+        for (unsigned int level = 0; level < std::max(levelCount, 1u) && !truncated && faceCount > 0; ++level)
+        {
+            ktx2_level index;
+            if (levelIndex + (level + 1) * sizeof(ktx2_level) > size)
+            {
+                truncated = true;
+                break;
+            }
+            memcpy(&index, bytes + levelIndex + level * sizeof(ktx2_level), sizeof(ktx2_level));
+            if (index.byteOffset + index.byteLength > size)
+            {
+                truncated = true;
+                break;
+            }
+
+            GLsizei faceSize = (GLsizei)(index.byteLength / faceCount);
+            for (unsigned int face = 0; face < faceCount; ++face)
+            {
+                ktx_image image;
+                image.target = faceCount == 6 ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + face : GL_TEXTURE_2D;
+                image.level = level;
+                image.width = std::max(width >> level, 1u);
+                image.height = std::max(height >> level, 1u);
+                image.size = faceSize;
+                image.data = bytes + index.byteOffset + face * faceSize;
+                images.push_back(image);
+            }
+        }
+    }
+    else
+    {
+        // Read KTX header.
+        ktx_header header;
+        if (size < 12 + sizeof(ktx_header))
+        {
+            GP_ERROR("Failed to read header for KTX file '%s'.", path);
+            SAFE_DELETE_ARRAY(file);
+            return NULL;
+        }
+        memcpy(&header, bytes + 12, sizeof(ktx_header));
+
+        if (header.endianness != 0x04030201)
+        {
+            GP_ERROR("Failed to create texture from KTX file '%s': files of the opposite endianness are unsupported.", path);
+            SAFE_DELETE_ARRAY(file);
+            return NULL;
+        }
+        if (header.pixelDepth > 1 || header.numberOfArrayElements > 0)
+        {
+            GP_ERROR("Failed to create texture from KTX file '%s': volume and array textures are unsupported.", path);
+            SAFE_DELETE_ARRAY(file);
+            return NULL;
+        }
+
+        // Compressed files have no texel type, uncompressed ones are uploaded with their unsized format.
+        type = header.glType;
+        format = header.glFormat;
+        internalFormat = type == 0 ? header.glInternalFormat : header.glBaseInternalFormat;
+        width = header.pixelWidth;
+        height = std::max(header.pixelHeight, 1u);
+        faceCount = header.numberOfFaces;
+        levelCount = header.numberOfMipmapLevels;
+
+        // Each level starts with the size of one face, and each face is padded to four bytes.
+        size_t offset = 12 + sizeof(ktx_header) + header.bytesOfKeyValueData;
+        for (unsigned int level = 0; level < std::max(levelCount, 1u) && !truncated; ++level)
+        {
+            unsigned int imageSize;
+            if (offset + sizeof(imageSize) > size)
+            {
+                truncated = true;
+                break;
+            }
+            memcpy(&imageSize, bytes + offset, sizeof(imageSize));
+            offset += sizeof(imageSize);
+
+            for (unsigned int face = 0; face < faceCount; ++face)
+            {
+                if (offset + imageSize > size)
+                {
+                    truncated = true;
+                    break;
+                }
+
+                ktx_image image;
+                image.target = faceCount == 6 ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + face : GL_TEXTURE_2D;
+                image.level = level;
+                image.width = std::max(width >> level, 1u);
+                image.height = std::max(height >> level, 1u);
+                image.size = imageSize;
+                image.data = bytes + offset;
+                images.push_back(image);
+
+                offset += (imageSize + 3) & ~3u;
+            }
+        }
+    }
+
+    if (faceCount != 1 && faceCount != 6)
+    {
+        GP_ERROR("Failed to create texture from KTX file '%s': invalid face count (%u).", path, faceCount);
+        SAFE_DELETE_ARRAY(file);
+        return NULL;
+    }
+    if (truncated)
+    {
+        GP_ERROR("Failed to load texture data for KTX file '%s'.", path);
+        SAFE_DELETE_ARRAY(file);
+        return NULL;
+    }
+
+    // Create the texture.
+    bool compressed = type == 0;
+    GLenum target = faceCount == 6 ? GL_TEXTURE_CUBE_MAP : GL_TEXTURE_2D;
+    GLuint textureId;
+    GL_ASSERT( glGenTextures(1, &textureId) );
+    GLStateCache::bindTexture(target, textureId);
+
+    // KTX rows are padded to four bytes, KTX2 rows are tightly packed.
+    GL_ASSERT( glPixelStorei(GL_UNPACK_ALIGNMENT, ktx2 ? 1 : 4) );
+
+    // Load texture data.
+    size_t memorySize = 0;
+    for (size_t i = 0, count = images.size(); i < count; ++i)
+    {
+        const ktx_image& image = images[i];
+        memorySize += image.size;
+        if (compressed)
+        {
+            GL_ASSERT( glCompressedTexImage2D(image.target, image.level, internalFormat, image.width, image.height, 0, image.size, image.data) );
+        }
+        else
+        {
+            GL_ASSERT( glTexImage2D(image.target, image.level, internalFormat, image.width, image.height, 0, format, type, image.data) );
+        }
+    }
+    SAFE_DELETE_ARRAY(file);
+
+    // A level count of zero asks for the mipmaps to be generated, which is only possible for uncompressed files.
+    bool generateMipmaps = levelCount == 0 && !compressed;
+    Filter minFilter = levelCount > 1 || generateMipmaps ? NEAREST_MIPMAP_LINEAR : LINEAR;
+    GL_ASSERT( glTexParameteri(target, GL_TEXTURE_MIN_FILTER, minFilter) );
+
+    // Create gameplay texture.
+    Texture* texture = new Texture();
+    texture->_handle = textureId;
+    texture->_type = (Type)target;
+    texture->_width = width;
+    texture->_height = height;
+    texture->_compressed = compressed;
+    texture->_mipmapped = levelCount > 1;
+    texture->_minFilter = minFilter;
+    if (!compressed && type == GL_UNSIGNED_BYTE && (format == GL_RGB || format == GL_RGBA))
+        texture->_format = format == GL_RGB ? Texture::RGB : Texture::RGBA;
+    texture->setMemorySize(memorySize);
+    if (generateMipmaps)
+        texture->generateMipmaps();
 
     return texture;
 }
@@ -1182,20 +2324,297 @@ TextureHandle Texture::getHandle() const
     return _handle;
 }
 
+bool Texture::isLoaded() const
+{
+    return _pendingLoad == NULL;
+}
+
+void Texture::finishLoading()
+{
+    PendingLoad* load = _pendingLoad;
+    if (load == NULL)
+        return;
+
+    JobSystem* jobSystem = Game::getInstance()->getJobSystem();
+    if (jobSystem)
+    {
+        jobSystem->wait(&load->decoded);
+        jobSystem->wait(&load->uploaded);
+    }
+
+    std::vector<PendingLoad*>::iterator itr = std::find(_pendingLoads.begin(), _pendingLoads.end(), load);
+    GP_ASSERT( itr != _pendingLoads.end() );
+    _pendingLoads.erase(itr);
+
+    if (load->data)
+    {
+        while (load->uploadedRows < load->height)
+        {
+            uploadPending(load, (size_t)-1);
+        }
+    }
+    completePending(load);
+}
+
+size_t Texture::getMemorySize() const
+{
+    return _memorySize;
+}
+
+size_t Texture::getTotalMemorySize()
+{
+    return __textureMemorySize;
+}
+
+unsigned int Texture::getTextureCount()
+{
+    return (unsigned int)__textures.size();
+}
+
+void Texture::setMemoryBudget(size_t bytes)
+{
+    __textureMemoryBudget = bytes;
+    __textureMemoryBudgetLoaded = true;
+
+    // Without a budget the cache no longer keeps released textures alive.
+    if (bytes == 0)
+        releaseRetained();
+}
+
+size_t Texture::getMemoryBudget()
+{
+    if (!__textureMemoryBudgetLoaded)
+    {
+        Properties* graphicsConfig = Game::getInstance()->getConfig()->getNamespace("graphics", true);
+        int kilobytes = graphicsConfig && graphicsConfig->exists("textureBudget") ? graphicsConfig->getInt("textureBudget") : 0;
+        __textureMemoryBudget = kilobytes > 0 ? (size_t)kilobytes * 1024 : 0;
+        __textureMemoryBudgetLoaded = true;
+    }
+    return __textureMemoryBudget;
+}
+
+size_t Texture::getResidency(std::vector<Texture::Residency>* residency)
+{
+    GP_ASSERT( residency );
+
+    std::vector<Texture*> textures(__textures);
+    std::stable_sort(textures.begin(), textures.end(), [](Texture* a, Texture* b) { return a->_lastUsedFrame > b->_lastUsedFrame; });
+
+    residency->clear();
+    residency->reserve(textures.size());
+    for (size_t i = 0, count = textures.size(); i < count; ++i)
+    {
+        Texture* texture = textures[i];
+        Residency entry;
+        entry.path = texture->_path;
+        entry.width = texture->_width;
+        entry.height = texture->_height;
+        entry.memorySize = texture->_memorySize;
+        entry.droppedLevels = texture->_droppedLevels;
+        entry.refCount = texture->getRefCount();
+        entry.idleFrames = __textureFrame - texture->_lastUsedFrame;
+        residency->push_back(entry);
+    }
+    return __textureMemorySize;
+}
+
+void Texture::printResidency()
+{
+    std::vector<Residency> residency;
+    size_t total = getResidency(&residency);
+    size_t budget = getMemoryBudget();
+    if (budget > 0)
+        print("[texture] %u textures using %u KB of a %u KB budget.\n", (unsigned int)residency.size(), (unsigned int)(total / 1024), (unsigned int)(budget / 1024));
+    else
+        print("[texture] %u textures using %u KB.\n", (unsigned int)residency.size(), (unsigned int)(total / 1024));
+
+    for (size_t i = 0, count = residency.size(); i < count; ++i)
+    {
+        const Residency& entry = residency[i];
+        print("[texture] %8u KB  %5ux%-5u  dropped:%u  refs:%u  idle:%u  %s\n", (unsigned int)(entry.memorySize / 1024), entry.width, entry.height,
+            entry.droppedLevels, entry.refCount, entry.idleFrames, entry.path.empty() ? "<unnamed>" : entry.path.c_str());
+    }
+}
+
+void Texture::updateResidency()
+{
+    size_t budget = getMemoryBudget();
+    if (budget > 0)
+        trimResidency(budget);
+}
+
+void Texture::trimResidency(size_t budget)
+{
+    if (__textureMemorySize <= budget)
+        return;
+
+    // Least recently used first. Textures bound in the current or the previous frame are left alone,
+    // since the frame counter is advanced before the residency is trimmed and before anything is drawn.
+    std::vector<Texture*> textures(__textures);
+    std::stable_sort(textures.begin(), textures.end(), [](Texture* a, Texture* b) { return a->_lastUsedFrame < b->_lastUsedFrame; });
+
+    // Destroy released textures that only the cache is keeping alive.
+    for (size_t i = 0, count = textures.size(); i < count && __textureMemorySize > budget; ++i)
+    {
+        Texture* texture = textures[i];
+        if (texture->_lastUsedFrame + 1 >= __textureFrame)
+            break;
+        if (texture->_retained && texture->getRefCount() == 1)
+        {
+            textures[i] = NULL;
+            texture->_retained = false;
+            texture->release();
+        }
+    }
+
+    // Then drop the top mipmap level of textures loaded from files, one level per texture each frame.
+    for (size_t i = 0, count = textures.size(); i < count && __textureMemorySize > budget; ++i)
+    {
+        Texture* texture = textures[i];
+        if (texture == NULL)
+            continue;
+        if (texture->_lastUsedFrame + 1 >= __textureFrame)
+            break;
+        if (texture->_cached)
+            texture->dropLevel();
+    }
+}
+
+void Texture::releaseRetained()
+{
+    std::vector<Texture*> cached(__textureCache);
+    for (size_t i = 0, count = cached.size(); i < count; ++i)
+    {
+        if (cached[i]->_retained)
+        {
+            cached[i]->_retained = false;
+            cached[i]->release();
+        }
+    }
+}
+
+bool Texture::dropLevel()
+{
+#ifdef OPENGL_ES
+    // OpenGL ES cannot read textures back, so their levels cannot be copied.
+    return false;
+#else
+    if (_type != TEXTURE_2D || !_mipmapped || _pendingLoad || _dynamic || !(_compressed || _format == RGB || _format == RGBA))
+        return false;
+
+    struct mip_level
+    {
+        GLint width;
+        GLint height;
+        std::vector<unsigned char> data;
+    };
+
+    GLStateCache::bindTexture(GL_TEXTURE_2D, _handle);
+    GLint internalFormat = 0;
+    GL_ASSERT( glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat) );
+    GLenum format = _format == RGB ? GL_RGB : GL_RGBA;
+
+    // Read back every level below the top one.
+    std::vector<mip_level> levels;
+    size_t memorySize = 0;
+    GL_ASSERT( glPixelStorei(GL_PACK_ALIGNMENT, 1) );
+    for (GLint i = 1; ; ++i)
+    {
+        mip_level level;
+        GL_ASSERT( glGetTexLevelParameteriv(GL_TEXTURE_2D, i, GL_TEXTURE_WIDTH, &level.width) );
+        GL_ASSERT( glGetTexLevelParameteriv(GL_TEXTURE_2D, i, GL_TEXTURE_HEIGHT, &level.height) );
+        if (level.width == 0 || level.height == 0)
+            break;
+        if (i == 1 && level.width < TEXTURE_MIN_DROP_SIZE && level.height < TEXTURE_MIN_DROP_SIZE)
+            return false;
+
+        levels.push_back(level);
+        mip_level& copy = levels.back();
+        if (_compressed)
+        {
+            GLint size = 0;
+            GL_ASSERT( glGetTexLevelParameteriv(GL_TEXTURE_2D, i, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size) );
+            copy.data.resize(size);
+            GL_ASSERT( glGetCompressedTexImage(GL_TEXTURE_2D, i, &copy.data[0]) );
+        }
+        else
+        {
+            copy.data.resize(copy.width * copy.height * (format == GL_RGB ? 3 : 4));
+            GL_ASSERT( glGetTexImage(GL_TEXTURE_2D, i, format, GL_UNSIGNED_BYTE, &copy.data[0]) );
+        }
+        memorySize += copy.data.size();
+
+        if (level.width == 1 && level.height == 1)
+            break;
+    }
+
+    // The copy must still have mipmaps for the filter of the texture.
+    if (levels.size() < 2)
+        return false;
+
+    GLuint textureId;
+    GL_ASSERT( glGenTextures(1, &textureId) );
+    GLStateCache::bindTexture(GL_TEXTURE_2D, textureId);
+    GL_ASSERT( glPixelStorei(GL_UNPACK_ALIGNMENT, 1) );
+    for (size_t i = 0, count = levels.size(); i < count; ++i)
+    {
+        const mip_level& level = levels[i];
+        if (_compressed)
+        {
+            GL_ASSERT( glCompressedTexImage2D(GL_TEXTURE_2D, (GLint)i, internalFormat, level.width, level.height, 0, (GLsizei)level.data.size(), &level.data[0]) );
+        }
+        else
+        {
+            GL_ASSERT( glTexImage2D(GL_TEXTURE_2D, (GLint)i, internalFormat, level.width, level.height, 0, format, GL_UNSIGNED_BYTE, &level.data[0]) );
+        }
+    }
+    GL_ASSERT( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (GLenum)_minFilter) );
+    GL_ASSERT( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, (GLenum)_magFilter) );
+    GL_ASSERT( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, (GLenum)_wrapS) );
+    GL_ASSERT( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, (GLenum)_wrapT) );
+
+    // The width and height stay those of the full texture, since source rectangles are measured against them.
+    GLStateCache::deleteTexture(_handle);
+    _handle = textureId;
+    ++_droppedLevels;
+    setMemorySize(memorySize);
+    return true;
+#endif
+}
+
+void Texture::setMemorySize(size_t size)
+{
+    __textureMemorySize = __textureMemorySize - _memorySize + size;
+    _memorySize = size;
+}
+
+size_t Texture::computeMemorySize(unsigned int width, unsigned int height, size_t bpp, bool mipmapped, unsigned int faceCount)
+{
+    size_t size = 0;
+    while (true)
+    {
+        size += (size_t)width * height * bpp;
+        if (!mipmapped || (width == 1 && height == 1))
+            break;
+        width = std::max(width >> 1, 1u);
+        height = std::max(height >> 1, 1u);
+    }
+    return size * faceCount;
+}
+
 void Texture::generateMipmaps()
 {
     if (!_mipmapped)
     {
         GLenum target = (GLenum)_type;
-        GL_ASSERT( glBindTexture(target, _handle) );
+        GLStateCache::bindTexture(target, _handle);
         GL_ASSERT( glHint(GL_GENERATE_MIPMAP_HINT, GL_NICEST) );
         if( std::addressof(glGenerateMipmap) )
             GL_ASSERT( glGenerateMipmap(target) );
 
+        // A full mipmap chain adds a third to the size of the top level.
         _mipmapped = true;
-
-        // Restore the texture id
-        GL_ASSERT( glBindTexture((GLenum)__currentTextureType, __currentTextureId) );
+        setMemorySize(_memorySize + _memorySize / 3);
     }
 }
 
@@ -1211,6 +2630,9 @@ bool Texture::isCompressed() const
 
 Texture::Sampler::Sampler(Texture* texture)
     : _texture(texture), _wrapS(Texture::REPEAT), _wrapT(Texture::REPEAT), _wrapR(Texture::REPEAT)
+#ifdef GP_USE_SAMPLER_OBJECTS
+    , _samplerObject(0), _samplerObjectGeneration(0)
+#endif
 {
     GP_ASSERT( texture );
     _minFilter = texture->_minFilter;
@@ -1241,12 +2663,18 @@ void Texture::Sampler::setWrapMode(Wrap wrapS, Wrap wrapT, Wrap wrapR)
     _wrapS = wrapS;
     _wrapT = wrapT;
     _wrapR = wrapR;
+#ifdef GP_USE_SAMPLER_OBJECTS
+    _samplerObject = 0;
+#endif
 }
 
 void Texture::Sampler::setFilterMode(Filter minificationFilter, Filter magnificationFilter)
 {
     _minFilter = minificationFilter;
     _magFilter = magnificationFilter;
+#ifdef GP_USE_SAMPLER_OBJECTS
+    _samplerObject = 0;
+#endif
 }
 
 Texture* Texture::Sampler::getTexture() const
@@ -1259,12 +2687,21 @@ void Texture::Sampler::bind()
     GP_ASSERT( _texture );
 
     GLenum target = (GLenum)_texture->_type;
-    if (__currentTextureId != _texture->_handle)
+    GLStateCache::bindTexture(target, _texture->_handle);
+    _texture->_lastUsedFrame = __textureFrame;
+
+#ifdef GP_USE_SAMPLER_OBJECTS
+    if (isSamplerObjectSupported())
     {
-        GL_ASSERT( glBindTexture(target, _texture->_handle) );
-        __currentTextureId = _texture->_handle;
-        __currentTextureType = _texture->_type;
+        if (!_samplerObject || _samplerObjectGeneration != __samplerObjectGeneration)
+        {
+            _samplerObject = getSamplerObject((GLenum)_minFilter, (GLenum)_magFilter, (GLenum)_wrapS, (GLenum)_wrapT, (GLenum)_wrapR);
+            _samplerObjectGeneration = __samplerObjectGeneration;
+        }
+        GLStateCache::bindSampler(_samplerObject);
+        return;
     }
+#endif
 
     if (_texture->_minFilter != _minFilter)
     {
@@ -14,7 +14,9 @@ class Image;
  */
 class Texture : public Ref
 {
+    friend class Game;
     friend class Sampler;
+    friend class ResourceManager;
 
 public:
 
@@ -63,7 +65,10 @@ public:
     enum Type
     {
         TEXTURE_2D = GL_TEXTURE_2D,
-        TEXTURE_CUBE = GL_TEXTURE_CUBE_MAP
+        TEXTURE_CUBE = GL_TEXTURE_CUBE_MAP,
+#ifdef GP_USE_TEXTURE_ARRAYS
+        TEXTURE_2D_ARRAY = GL_TEXTURE_2D_ARRAY
+#endif
     };
 
     /**
@@ -79,6 +84,50 @@ public:
         NEGATIVE_Z
     };
     
+    /**
+     * The function called once a texture created by createAsync has finished loading.
+     *
+     * The second parameter is true if the image was loaded, or false if the texture kept its placeholder.
+     */
+    typedef std::function<void(Texture*, bool)> LoadCallback;
+
+    /**
+     * Describes the GPU memory used by a texture, as reported by getResidency.
+     */
+    struct Residency
+    {
+        /**
+         * The path the texture was loaded from, or an empty string.
+         */
+        std::string path;
+
+        /**
+         * The width and height of the texture, before any mipmap levels were dropped.
+         */
+        unsigned int width;
+        unsigned int height;
+
+        /**
+         * The estimated number of bytes of GPU memory used by the texture, including its mipmaps.
+         */
+        size_t memorySize;
+
+        /**
+         * The number of top mipmap levels that were dropped to stay within the memory budget.
+         */
+        unsigned int droppedLevels;
+
+        /**
+         * The number of references to the texture, including the one held by the texture cache.
+         */
+        unsigned int refCount;
+
+        /**
+         * The number of frames since the texture was last bound by a sampler.
+         */
+        unsigned int idleFrames;
+    };
+
     /**
      * Defines a texture sampler.
      *
@@ -145,6 +194,11 @@ public:
 
         /**
          * Binds the texture of this sampler to the renderer and applies the sampler state.
+         *
+         * Where GL sampler objects are supported, the state is applied by binding a sampler
+         * object shared by every sampler with the same state, so that samplers of the same
+         * texture with different states do not rewrite the parameters of the texture.
+         * Otherwise the parameters of the texture are set where they differ from the state.
          */
         void bind();
 
@@ -166,6 +220,10 @@ public:
         Wrap _wrapR;
         Filter _minFilter;
         Filter _magFilter;
+#ifdef GP_USE_SAMPLER_OBJECTS
+        GLuint _samplerObject;
+        unsigned int _samplerObjectGeneration;
+#endif
     };
 
     /**
@@ -182,6 +240,25 @@ public:
      */
     static Texture* create(const char* path, bool generateMipmaps = false);
 
+    /**
+     * Creates a texture from the given image resource without waiting for it to load.
+     *
+     * The returned texture is a 1x1 white placeholder that can be used right away. PNG and QOI images
+     * are decoded on the job system and uploaded over the following frames, limited to the
+     * 'textureUploadBudget' (in kilobytes, 4096 by default) of the 'graphics' section of the
+     * game config. The texture handle changes once the upload completes. Other formats are
+     * loaded immediately, as with create(const char*, bool).
+     *
+     * @param path The image resource path.
+     * @param generateMipmaps true to auto-generate a full mipmap chain, false otherwise.
+     * @param callback An optional function to call once the texture has loaded. It is called on
+     *      the main thread, and not at all if the texture is destroyed before it has loaded.
+     *
+     * @return The new texture, or NULL if the texture could not be created.
+     * @script{ignore}
+     */
+    static Texture* createAsync(const char* path, bool generateMipmaps = false, const LoadCallback& callback = LoadCallback());
+
     /**
      * Creates a texture from the given image.
      *
@@ -232,6 +309,28 @@ public:
      */
     static Texture* create(TextureHandle handle, int width, int height, Format format = UNKNOWN);
 
+    /**
+     * Creates a 2D array texture with one layer for each of the given images.
+     *
+     * All images must have the same size and format. Array textures are sampled in shaders
+     * with sampler2DArray uniforms, through the GL_EXT_texture_array extension.
+     *
+     * @param images The images containing the data of each layer.
+     * @param count The number of images.
+     * @param generateMipmaps True to generate a full mipmap chain, false otherwise.
+     *
+     * @return The new texture, or NULL if the images differ or texture arrays are not supported.
+     * @script{ignore}
+     */
+    static Texture* createArray(Image** images, unsigned int count, bool generateMipmaps = false);
+
+    /**
+     * Determines whether 2D array textures are supported by the platform and the graphics driver.
+     *
+     * @return true if createArray can create textures.
+     */
+    static bool isArraySupported();
+
     /**
      * Set texture data to replace current texture image.
      * 
@@ -241,6 +340,48 @@ public:
      */
     void setData(const unsigned char* data);
 
+    /**
+     * Set texture data to replace a region of the current texture image.
+     *
+     * Only 2D textures can be updated by region.
+     *
+     * @param data Raw texture data of the region (expected to be tightly packed).
+     * @param x The x position of the region in pixels.
+     * @param y The y position of the region in pixels.
+     * @param width The width of the region in pixels.
+     * @param height The height of the region in pixels.
+     */
+    void setData(const unsigned char* data, unsigned int x, unsigned int y, unsigned int width, unsigned int height);
+
+    /**
+     * Sets whether the texture is dynamic, for textures whose data is set again every frame
+     * or so, such as video frames, minimaps or painted decals.
+     *
+     * The data set on a dynamic texture is staged in a ring of pixel buffers, from which the
+     * driver copies it to the texture asynchronously, so setData() returns without waiting
+     * for the GPU to finish drawing with the previous image. A pixel buffer the GPU is still
+     * copying from is reallocated rather than waited on.
+     *
+     * With reallocate set, updates of the whole image also reallocate the storage of the
+     * texture rather than overwriting it in place, so that draws still reading the old image
+     * don't hold up the update. Region updates always overwrite the texture in place.
+     *
+     * Where pixel buffers are not supported, the data is copied from client memory as it is
+     * for textures that are not dynamic. Dynamic textures never drop mipmap levels to stay
+     * within the memory budget.
+     *
+     * @param dynamic true to make the texture dynamic, false to release its pixel buffers.
+     * @param reallocate true to reallocate the storage of the texture on updates of the whole image.
+     */
+    void setDynamic(bool dynamic, bool reallocate = false);
+
+    /**
+     * Determines whether the texture is dynamic.
+     *
+     * @return true if the texture is dynamic, false otherwise.
+     */
+    bool isDynamic() const;
+
     /**
      * Returns the path that the texture was originally loaded from (if applicable).
      *
@@ -293,6 +434,70 @@ public:
      */
     bool isCompressed() const;
 
+    /**
+     * Determines if the image of this texture has been loaded.
+     *
+     * @return false while a texture created by createAsync still shows its placeholder, true otherwise.
+     */
+    bool isLoaded() const;
+
+    /**
+     * Waits for the image of a texture created by createAsync to decode and uploads it immediately.
+     *
+     * Does nothing if the texture is already loaded.
+     */
+    void finishLoading();
+
+    /**
+     * Gets the estimated number of bytes of GPU memory used by this texture, including its mipmaps.
+     *
+     * @return The memory size of the texture.
+     */
+    size_t getMemorySize() const;
+
+    /**
+     * Gets the estimated number of bytes of GPU memory used by all textures.
+     *
+     * @return The memory size of all textures.
+     */
+    static size_t getTotalMemorySize();
+
+    /**
+     * Sets the number of bytes of GPU memory that textures should stay within.
+     *
+     * While a budget is set, textures loaded from files stay in the texture cache after they
+     * are released. Whenever textures exceed the budget, the least recently used of those are
+     * destroyed first, then the top mipmap level of the least recently used textures loaded
+     * from files is dropped where the renderer supports reading textures back. Nothing used
+     * in the current frame is evicted. The initial budget is the 'textureBudget' (in kilobytes)
+     * of the 'graphics' section of the game config.
+     *
+     * @param bytes The memory budget, or zero for no budget.
+     */
+    static void setMemoryBudget(size_t bytes);
+
+    /**
+     * Gets the number of bytes of GPU memory that textures should stay within.
+     *
+     * @return The memory budget, or zero if there is no budget.
+     */
+    static size_t getMemoryBudget();
+
+    /**
+     * Gets the residency of every texture, such as for reporting memory use.
+     *
+     * @param residency Filled with the residency of each texture, most recently used first.
+     *
+     * @return The total memory size of all textures.
+     * @script{ignore}
+     */
+    static size_t getResidency(std::vector<Residency>* residency);
+
+    /**
+     * Prints the residency of every texture, and the memory budget, to the log.
+     */
+    static void printResidency();
+
     /**
      * Returns the texture handle.
      *
@@ -302,6 +507,9 @@ public:
 
 private:
 
+    struct PendingLoad;
+    struct DynamicData;
+
     /**
      * Constructor.
      */
@@ -317,6 +525,11 @@ private:
      */
     virtual ~Texture();
 
+    /**
+     * @see Ref::isDestroyedOnMainThread
+     */
+    bool isDestroyedOnMainThread() const;
+
     /**
      * Hidden copy assignment operator.
      */
@@ -326,6 +539,85 @@ private:
 
     static Texture* createCompressedDDS(const char* path);
 
+    static Texture* createCompressedKTX(const char* path);
+
+    /**
+     * Uploads rows of a decoded image, at least one and at most the given number of bytes.
+     *
+     * @return The number of bytes uploaded.
+     */
+    static size_t uploadPending(PendingLoad* load, size_t budget);
+
+    /**
+     * Copies the data of an update of a dynamic texture into its next pixel buffer, and leaves it bound.
+     *
+     * @return true if the data is to be read from the bound pixel buffer, false if from client memory.
+     */
+    bool stageData(const unsigned char* data, size_t size);
+
+    /**
+     * Fences and unbinds the pixel buffer of the update staged by stageData().
+     */
+    void endStaging();
+
+    /**
+     * Uploads the whole of a decoded image to a texture of its own, on the upload thread.
+     */
+    static void uploadImage(PendingLoad* load);
+
+    /**
+     * Replaces the placeholder of a texture with its uploaded image and fires its callbacks.
+     */
+    static void completePending(PendingLoad* load);
+
+    /**
+     * Called each frame to upload decoded images within the per-frame budget and to keep
+     * textures within the memory budget.
+     */
+    static void updatePending();
+
+    /**
+     * Evicts or drops mipmap levels of least recently used textures until they fit the memory budget.
+     */
+    static void updateResidency();
+
+    /**
+     * Evicts or drops mipmap levels of least recently used textures until they fit in the given number of bytes.
+     */
+    static void trimResidency(size_t budget);
+
+    /**
+     * Releases the textures that only the texture cache is keeping alive.
+     */
+    static void releaseRetained();
+
+    /**
+     * Gets the number of textures.
+     */
+    static unsigned int getTextureCount();
+
+    /**
+     * Replaces this texture with a copy that does not have its top mipmap level.
+     *
+     * @return true if a level was dropped, false if the texture cannot be reduced.
+     */
+    bool dropLevel();
+
+    /**
+     * Sets the memory size of this texture, updating the total of all textures.
+     */
+    void setMemorySize(size_t size);
+
+    /**
+     * Computes the memory size of an uncompressed texture.
+     */
+    static size_t computeMemorySize(unsigned int width, unsigned int height, size_t bpp, bool mipmapped, unsigned int faceCount);
+
+    /**
+     * Called during shutdown to wait for and discard any pending images.
+     */
+    static void finalize();
+
     static GLubyte* readCompressedPVRTC(const char* path, Stream* stream, GLsizei* width, GLsizei* height, GLenum* format, unsigned int* mipMapCount, unsigned int* faceCount, GLenum faces[6]);
 
     static GLubyte* readCompressedPVRTCLegacy(const char* path, Stream* stream, GLsizei* width, GLsizei* height, GLenum* format, unsigned int* mipMapCount, unsigned int* faceCount, GLenum faces[6]);
@@ -353,6 +645,14 @@ private:
     GLint _internalFormat;
     GLenum _texelType;
     size_t _bpp;
+    PendingLoad* _pendingLoad;
+    DynamicData* _dynamic;
+    size_t _memorySize;
+    unsigned int _droppedLevels;
+    unsigned int _lastUsedFrame;
+    bool _retained;
+
+    static std::vector<PendingLoad*> _pendingLoads;
 };
 
 }
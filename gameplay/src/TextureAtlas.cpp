@@ -0,0 +1,200 @@
+#include "Base.h"
+#include "TextureAtlas.h"
+#include "Image.h"
+#include "SpriteBatch.h"
+
+namespace gameplay
+{
+
+// Every live atlas, searched by path when sprites, image controls and themes are created.
+static std::vector<TextureAtlas*> __atlases;
+
+TextureAtlas::TextureAtlas()
+    : _pageWidth(0), _pageHeight(0), _padding(0)
+{
+}
+
+TextureAtlas::~TextureAtlas()
+{
+    for (size_t i = 0, count = _pages.size(); i < count; ++i)
+    {
+        Page* page = _pages[i];
+        SAFE_DELETE(page->batch);
+        SAFE_RELEASE(page->texture);
+        SAFE_DELETE_ARRAY(page->data);
+        SAFE_DELETE(page);
+    }
+
+    std::vector<TextureAtlas*>::iterator itr = std::find(__atlases.begin(), __atlases.end(), this);
+    if (itr != __atlases.end())
+    {
+        __atlases.erase(itr);
+    }
+}
+
+TextureAtlas* TextureAtlas::create(unsigned int pageWidth, unsigned int pageHeight, unsigned int padding)
+{
+    GP_ASSERT(pageWidth > 0 && pageHeight > 0);
+
+    TextureAtlas* atlas = new TextureAtlas();
+    atlas->_pageWidth = pageWidth;
+    atlas->_pageHeight = pageHeight;
+    atlas->_padding = padding;
+    __atlases.push_back(atlas);
+    return atlas;
+}
+
+TextureAtlas* TextureAtlas::find(const char* path, unsigned int* page, Rectangle* region)
+{
+    GP_ASSERT(path);
+
+    for (size_t i = 0, count = __atlases.size(); i < count; ++i)
+    {
+        if (__atlases[i]->getRegion(path, page, region))
+            return __atlases[i];
+    }
+    return NULL;
+}
+
+bool TextureAtlas::add(const char* path)
+{
+    GP_ASSERT(path);
+
+    if (_entries.find(path) != _entries.end())
+        return true;
+
+    Image* image = Image::create(path);
+    if (image == NULL)
+    {
+        GP_WARN("Failed to add image '%s' to texture atlas.", path);
+        return false;
+    }
+
+    const unsigned int width = image->getWidth();
+    const unsigned int height = image->getHeight();
+    const unsigned int paddedWidth = width + _padding * 2;
+    const unsigned int paddedHeight = height + _padding * 2;
+    if (paddedWidth > _pageWidth || paddedHeight > _pageHeight)
+    {
+        GP_WARN("Image '%s' (%ux%u) does not fit in a texture atlas page (%ux%u).", path, width, height, _pageWidth, _pageHeight);
+        SAFE_RELEASE(image);
+        return false;
+    }
+
+    unsigned int x, y;
+    unsigned int pageIndex = allocate(paddedWidth, paddedHeight, &x, &y);
+    Page* page = _pages[pageIndex];
+
+    // Both images and pages store their rows bottom up, while regions are measured from the top.
+    // The padding repeats the edge texels of the image.
+    const unsigned int pixelSize = image->getFormat() == Image::RGBA ? 4 : 3;
+    const unsigned char* source = image->getData();
+    for (unsigned int row = 0; row < paddedHeight; ++row)
+    {
+        unsigned int sourceRow = height - 1 - (unsigned int)MATH_CLAMP((int)row - (int)_padding, 0, (int)height - 1);
+        unsigned char* dst = page->data + ((_pageHeight - 1 - (y + row)) * _pageWidth + x) * 4;
+        for (unsigned int column = 0; column < paddedWidth; ++column, dst += 4)
+        {
+            unsigned int sourceColumn = (unsigned int)MATH_CLAMP((int)column - (int)_padding, 0, (int)width - 1);
+            const unsigned char* src = source + (sourceRow * width + sourceColumn) * pixelSize;
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            dst[3] = pixelSize == 4 ? src[3] : 255;
+        }
+    }
+    page->dirty = true;
+    SAFE_RELEASE(image);
+
+    Entry& entry = _entries[path];
+    entry.page = pageIndex;
+    entry.region.set((float)(x + _padding), (float)(y + _padding), (float)width, (float)height);
+
+    return true;
+}
+
+bool TextureAtlas::getRegion(const char* path, unsigned int* page, Rectangle* region) const
+{
+    GP_ASSERT(path);
+
+    std::map<std::string, Entry>::const_iterator itr = _entries.find(path);
+    if (itr == _entries.end())
+        return false;
+
+    if (page)
+        *page = itr->second.page;
+    if (region)
+        *region = itr->second.region;
+    return true;
+}
+
+unsigned int TextureAtlas::getPageCount() const
+{
+    return (unsigned int)_pages.size();
+}
+
+Texture* TextureAtlas::getPage(unsigned int index)
+{
+    GP_ASSERT(index < _pages.size());
+
+    Page* page = _pages[index];
+    if (page->texture == NULL)
+    {
+        page->texture = Texture::create(Texture::RGBA, _pageWidth, _pageHeight, page->data, true);
+    }
+    else if (page->dirty)
+    {
+        page->texture->setData(page->data);
+    }
+    page->dirty = false;
+    return page->texture;
+}
+
+SpriteBatch* TextureAtlas::getSpriteBatch(unsigned int index)
+{
+    GP_ASSERT(index < _pages.size());
+
+    Page* page = _pages[index];
+    Texture* texture = getPage(index);
+    if (page->batch == NULL)
+    {
+        page->batch = SpriteBatch::create(texture);
+    }
+    return page->batch;
+}
+
+unsigned int TextureAtlas::allocate(unsigned int width, unsigned int height, unsigned int* x, unsigned int* y)
+{
+    GP_ASSERT(x);
+    GP_ASSERT(y);
+
+    // Images are placed left to right on shelves as tall as their tallest image.
+    Page* page = _pages.empty() ? NULL : _pages.back();
+    if (page && page->shelfX + width > _pageWidth)
+    {
+        page->shelfY += page->shelfHeight;
+        page->shelfX = 0;
+        page->shelfHeight = 0;
+    }
+    if (page == NULL || page->shelfY + height > _pageHeight)
+    {
+        page = new Page();
+        page->data = new unsigned char[_pageWidth * _pageHeight * 4];
+        memset(page->data, 0, _pageWidth * _pageHeight * 4);
+        page->texture = NULL;
+        page->batch = NULL;
+        page->dirty = true;
+        page->shelfX = 0;
+        page->shelfY = 0;
+        page->shelfHeight = 0;
+        _pages.push_back(page);
+    }
+
+    *x = page->shelfX;
+    *y = page->shelfY;
+    page->shelfX += width;
+    page->shelfHeight = std::max(page->shelfHeight, height);
+    return (unsigned int)_pages.size() - 1;
+}
+
+}
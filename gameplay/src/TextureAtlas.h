@@ -0,0 +1,155 @@
+#ifndef TEXTUREATLAS_H_
+#define TEXTUREATLAS_H_
+
+#include "Ref.h"
+#include "Texture.h"
+#include "Rectangle.h"
+
+namespace gameplay
+{
+
+class SpriteBatch;
+
+/**
+ * Defines a set of shared textures that images are packed into at load time.
+ *
+ * Each image added to an atlas is copied into one of its pages, with its edge texels
+ * repeated into the surrounding padding so that filtering does not bleed between images.
+ * Sprite::create, ImageControl::setImage and Theme::create look their image paths up in
+ * every live atlas and, when an image has been packed, draw from the page the image is in
+ * with their source rectangles remapped into it. Image controls that use images of the same
+ * page also share the sprite batch of that page, so they are drawn with a single flush.
+ *
+ * Images must be added before the objects that use them are created.
+ *
+ * @script{ignore}
+ */
+class TextureAtlas : public Ref
+{
+public:
+
+    /**
+     * Creates an empty texture atlas.
+     *
+     * @param pageWidth The width of each page of the atlas.
+     * @param pageHeight The height of each page of the atlas.
+     * @param padding The number of texels to leave around each image.
+     *
+     * @return The new texture atlas.
+     */
+    static TextureAtlas* create(unsigned int pageWidth = 2048, unsigned int pageHeight = 2048, unsigned int padding = 2);
+
+    /**
+     * Finds the atlas that an image has been packed into.
+     *
+     * @param path The path of the image.
+     * @param page Set to the index of the page that holds the image, if found.
+     * @param region Set to the region of the page that holds the image, if found.
+     *
+     * @return The atlas holding the image, or NULL if the image is not in any atlas.
+     */
+    static TextureAtlas* find(const char* path, unsigned int* page, Rectangle* region);
+
+    /**
+     * Packs the PNG image at the given path into this atlas.
+     *
+     * @param path The path of the image.
+     *
+     * @return true if the image was packed or was already in the atlas, false if it could
+     *      not be loaded or is larger than a page.
+     */
+    bool add(const char* path);
+
+    /**
+     * Gets the region of a page that an image has been packed into.
+     *
+     * The region is in texels, with its origin at the top left of the page like the
+     * source rectangles of sprite batches.
+     *
+     * @param path The path of the image.
+     * @param page Set to the index of the page that holds the image, if found.
+     * @param region Set to the region of the page that holds the image, if found.
+     *
+     * @return true if the image is in this atlas, false otherwise.
+     */
+    bool getRegion(const char* path, unsigned int* page, Rectangle* region) const;
+
+    /**
+     * Gets the number of pages of this atlas.
+     *
+     * @return The number of pages.
+     */
+    unsigned int getPageCount() const;
+
+    /**
+     * Gets the texture of a page, uploading any images packed into it since it was last used.
+     *
+     * @param index The index of the page.
+     *
+     * @return The texture of the page.
+     */
+    Texture* getPage(unsigned int index);
+
+    /**
+     * Gets the sprite batch shared by the image controls that draw from a page.
+     *
+     * @param index The index of the page.
+     *
+     * @return The sprite batch of the page.
+     */
+    SpriteBatch* getSpriteBatch(unsigned int index);
+
+private:
+
+    struct Page
+    {
+        unsigned char* data;
+        Texture* texture;
+        SpriteBatch* batch;
+        bool dirty;
+        unsigned int shelfX;
+        unsigned int shelfY;
+        unsigned int shelfHeight;
+    };
+
+    struct Entry
+    {
+        unsigned int page;
+        Rectangle region;
+    };
+
+    /**
+     * Constructor.
+     */
+    TextureAtlas();
+
+    /**
+     * Destructor.
+     */
+    ~TextureAtlas();
+
+    /**
+     * Hidden copy constructor.
+     */
+    TextureAtlas(const TextureAtlas&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    TextureAtlas& operator=(const TextureAtlas&);
+
+    /**
+     * Reserves space for an image of the given size (padding included) on the last page, or on a new page.
+     */
+    unsigned int allocate(unsigned int width, unsigned int height, unsigned int* x, unsigned int* y);
+
+    unsigned int _pageWidth;
+    unsigned int _pageHeight;
+    unsigned int _padding;
+    std::vector<Page*> _pages;
+    std::map<std::string, Entry> _entries;
+};
+
+}
+
+#endif
@@ -3,14 +3,16 @@
 #include "ThemeStyle.h"
 #include "Game.h"
 #include "FileSystem.h"
+#include "TextureAtlas.h"
 
 namespace gameplay
 {
 
 static std::vector<Theme*> __themeCache;
 static Theme* __defaultTheme = NULL;
+static TextureAtlas* __atlas = NULL;
 
-Theme::Theme() : _texture(NULL), _spriteBatch(NULL), _emptyImage(NULL)
+Theme::Theme() : _texture(NULL), _spriteBatch(NULL), _atlas(NULL), _emptyImage(NULL)
 {
 }
 
@@ -41,7 +43,11 @@ Theme::~Theme()
         SAFE_RELEASE(skin);
     }
 
-    SAFE_DELETE(_spriteBatch);
+    // The sprite batch of an atlas page is owned by the atlas.
+    if (_atlas)
+        SAFE_RELEASE(_atlas);
+    else
+        SAFE_DELETE(_spriteBatch);
     SAFE_RELEASE(_texture);
 
     // Remove ourself from the theme cache.
@@ -93,6 +99,23 @@ Theme* Theme::getDefault()
 void Theme::finalize()
 {
     SAFE_RELEASE(__defaultTheme);
+    SAFE_RELEASE(__atlas);
+}
+
+void Theme::setAtlas(TextureAtlas* atlas)
+{
+    if (atlas != __atlas)
+    {
+        SAFE_RELEASE(__atlas);
+        __atlas = atlas;
+        if (__atlas)
+            __atlas->addRef();
+    }
+}
+
+TextureAtlas* Theme::getAtlas()
+{
+    return __atlas;
 }
 
 Theme* Theme::create(const char* url)
@@ -136,9 +159,30 @@ Theme* Theme::create(const char* url)
     // Parse the Properties object and set up the theme.
     std::string textureFile;
     themeProperties->getPath("texture", &textureFile);
-    theme->_texture = Texture::create(textureFile.c_str(), true);
-    GP_ASSERT(theme->_texture);
-    theme->_spriteBatch = SpriteBatch::create(theme->_texture);
+
+    // A theme texture packed into an atlas is drawn from the atlas page, with the regions of the theme file offset into it.
+    // The theme then draws through the batch of the page, which it shares with other themes and images of the page.
+    if (__atlas)
+        __atlas->add(textureFile.c_str());
+    Vector2 offset;
+    unsigned int page;
+    Rectangle atlasRegion;
+    TextureAtlas* atlas = TextureAtlas::find(textureFile.c_str(), &page, &atlasRegion);
+    if (atlas)
+    {
+        theme->_atlas = atlas;
+        theme->_atlas->addRef();
+        theme->_texture = atlas->getPage(page);
+        theme->_texture->addRef();
+        theme->_spriteBatch = atlas->getSpriteBatch(page);
+        offset.set(atlasRegion.x, atlasRegion.y);
+    }
+    else
+    {
+        theme->_texture = Texture::create(textureFile.c_str(), true);
+        GP_ASSERT(theme->_texture);
+        theme->_spriteBatch = SpriteBatch::create(theme->_texture);
+    }
     GP_ASSERT(theme->_spriteBatch);
     theme->_spriteBatch->getSampler()->setFilterMode(Texture::LINEAR_MIPMAP_LINEAR, Texture::LINEAR);
     theme->_spriteBatch->getSampler()->setWrapMode(Texture::CLAMP, Texture::CLAMP);
@@ -156,11 +200,11 @@ Theme* Theme::create(const char* url)
             
         if (strcmpnocase(spacename, "image") == 0)
         {
-            theme->_images.push_back(ThemeImage::create(tw, th, space, Vector4::one()));
+            theme->_images.push_back(ThemeImage::create(tw, th, space, Vector4::one(), offset));
         }
         else if (strcmpnocase(spacename, "imageList") == 0)
         {
-            theme->_imageLists.push_back(ImageList::create(tw, th, space));
+            theme->_imageLists.push_back(ImageList::create(tw, th, space, offset));
         }
         else if (strcmpnocase(spacename, "skin") == 0)
         {
@@ -180,7 +224,7 @@ Theme* Theme::create(const char* url)
 
             Vector4 regionVector;
             space->getVector4("region", &regionVector);
-            const Rectangle region(regionVector.x, regionVector.y, regionVector.z, regionVector.w);
+            const Rectangle region(regionVector.x + offset.x, regionVector.y + offset.y, regionVector.z, regionVector.w);
 
             Vector4 color(1, 1, 1, 1);
             if (space->exists("color"))
@@ -594,13 +638,13 @@ Theme::ThemeImage::~ThemeImage()
 {
 }
 
-Theme::ThemeImage* Theme::ThemeImage::create(float tw, float th, Properties* properties, const Vector4& defaultColor)
+Theme::ThemeImage* Theme::ThemeImage::create(float tw, float th, Properties* properties, const Vector4& defaultColor, const Vector2& offset)
 {
     GP_ASSERT(properties);
 
     Vector4 regionVector;                
     properties->getVector4("region", &regionVector);
-    const Rectangle region(regionVector.x, regionVector.y, regionVector.z, regionVector.w);
+    const Rectangle region(regionVector.x + offset.x, regionVector.y + offset.y, regionVector.z, regionVector.w);
 
     Vector4 color;
     if (properties->exists("color"))
@@ -671,7 +715,7 @@ Theme::ImageList::~ImageList()
     }
 }
 
-Theme::ImageList* Theme::ImageList::create(float tw, float th, Properties* properties)
+Theme::ImageList* Theme::ImageList::create(float tw, float th, Properties* properties, const Vector2& offset)
 {
     GP_ASSERT(properties);
 
@@ -692,7 +736,7 @@ Theme::ImageList* Theme::ImageList::create(float tw, float th, Properties* prope
     Properties* space = properties->getNextNamespace();
     while (space != NULL)
     {
-        ThemeImage* image = ThemeImage::create(tw, th, space, color);
+        ThemeImage* image = ThemeImage::create(tw, th, space, color, offset);
         GP_ASSERT(image);
         imageList->_images.push_back(image);
         space = properties->getNextNamespace();
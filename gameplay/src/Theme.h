@@ -11,6 +11,8 @@
 namespace gameplay
 {
 
+class TextureAtlas;
+
 /**
  * Defines a theme used to represent the look or appearance of controls.
  *
@@ -182,7 +184,7 @@ public:
 
         ~ThemeImage();
 
-        static ThemeImage* create(float tw, float th, Properties* properties, const Vector4& defaultColor);
+        static ThemeImage* create(float tw, float th, Properties* properties, const Vector4& defaultColor, const Vector2& offset);
 
         std::string _id;
         UVs _uvs;
@@ -207,6 +209,24 @@ public:
      */
     static Theme* getDefault();
 
+    /**
+     * Sets the atlas that theme textures and image control images are packed into as they are loaded.
+     *
+     * Themes and image controls drawing from the same atlas page share its sprite batch, so a form
+     * using them draws all of its skins and images with a single flush. Images that do not fit in a
+     * page are loaded as separate textures. Only objects created after this call are affected.
+     *
+     * @param atlas The atlas to pack UI images into, or NULL to stop packing them.
+     */
+    static void setAtlas(TextureAtlas* atlas);
+
+    /**
+     * Gets the atlas that theme textures and image control images are packed into as they are loaded.
+     *
+     * @return The UI atlas, or NULL if UI images are not packed automatically.
+     */
+    static TextureAtlas* getAtlas();
+
     /**
      * Get a style by its ID.
      *
@@ -265,7 +285,7 @@ private:
          */
         ImageList& operator=(const ImageList&);
 
-        static ImageList* create(float tw, float th, Properties* properties);
+        static ImageList* create(float tw, float th, Properties* properties, const Vector2& offset);
 
         std::string _id;
         std::vector<ThemeImage*> _images;
@@ -380,6 +400,7 @@ private:
     std::string _url;
     Texture* _texture;
     SpriteBatch* _spriteBatch;
+    TextureAtlas* _atlas;
     Theme::ThemeImage* _emptyImage;
     std::vector<Style*> _styles;
     std::vector<ThemeImage*> _images;
@@ -2,6 +2,15 @@
 #include "TileSet.h"
 #include "Matrix.h"
 #include "Scene.h"
+#include "MeshPart.h"
+#include "Technique.h"
+#include "Pass.h"
+#include "VertexAttributeBinding.h"
+#include "FrameStats.h"
+#include "GLStateCache.h"
+
+// The number of columns and rows of tiles in each baked chunk.
+#define TILESET_CHUNK_SIZE 16
 
 namespace gameplay
 {
@@ -9,12 +18,13 @@ namespace gameplay
 TileSet::TileSet() : Drawable(),
     _tiles(NULL), _tileWidth(0), _tileHeight(0),
     _rowCount(0), _columnCount(0), _width(0), _height(0),
-    _opacity(1.0f), _color(Vector4::one()), _batch(NULL)
+    _opacity(1.0f), _color(Vector4::one()), _batch(NULL), _chunkColumnCount(0), _chunkRowCount(0)
 {
 }
 
 TileSet::~TileSet()
 {
+    clearChunks();
     SAFE_DELETE_ARRAY(_tiles);
     SAFE_DELETE(_batch);
 }
@@ -151,7 +161,13 @@ void TileSet::setTileSource(unsigned int column, unsigned int row, const Vector2
     GP_ASSERT(column < _columnCount);
     GP_ASSERT(row < _rowCount);
     
-    _tiles[row * _columnCount + column] = source;
+    Vector2& tile = _tiles[row * _columnCount + column];
+    if (tile == source)
+        return;
+    tile = source;
+
+    if (!_chunks.empty())
+        _chunks[(row / TILESET_CHUNK_SIZE) * _chunkColumnCount + column / TILESET_CHUNK_SIZE].dirty = true;
 }
 
 void TileSet::getTileSource(unsigned int column, unsigned int row, Vector2* source)
@@ -196,7 +212,10 @@ float TileSet::getHeight() const
     
 void TileSet::setOpacity(float opacity)
 {
+    if (opacity == _opacity)
+        return;
     _opacity = opacity;
+    invalidateChunks();
 }
 
 float TileSet::getOpacity() const
@@ -206,7 +225,10 @@ float TileSet::getOpacity() const
 
 void TileSet::setColor(const Vector4& color)
 {
+    if (color == _color)
+        return;
     _color = color;
+    invalidateChunks();
 }
 
 const Vector4& TileSet::getColor() const
@@ -243,47 +265,203 @@ unsigned int TileSet::draw(bool wireframe)
         position.z += translation.z;
     }
     
-    // Draw each cell in the tile set
-    position.y += _tileHeight * (_rowCount - 1);
-    float xStart = position.x;
-    _batch->start();
-    for (unsigned int row = 0; row < _rowCount; row++)
+    if (_chunks.empty())
+    {
+        _chunkColumnCount = (_columnCount + TILESET_CHUNK_SIZE - 1) / TILESET_CHUNK_SIZE;
+        _chunkRowCount = (_rowCount + TILESET_CHUNK_SIZE - 1) / TILESET_CHUNK_SIZE;
+        Chunk chunk = { NULL, NULL, 0, true };
+        _chunks.resize(_chunkColumnCount * _chunkRowCount, chunk);
+    }
+
+    // The chunks are baked relative to the bottom left corner of the tile set, which the projection is offset to.
+    const Matrix projectionMatrix = _batch->getProjectionMatrix();
+    Matrix transform;
+    Matrix::createTranslation(position, &transform);
+    Matrix::multiply(projectionMatrix, transform, &transform);
+
+    // Under an orthographic projection, find the chunks under the viewport from the corners of clip space.
+    int firstColumn = 0;
+    int lastColumn = _chunkColumnCount;
+    int firstRow = 0;
+    int lastRow = _chunkRowCount;
+    Matrix inverse;
+    if (transform.m[3] == 0.0f && transform.m[7] == 0.0f && transform.m[11] == 0.0f && transform.invert(&inverse))
+    {
+        float minX = FLT_MAX;
+        float minY = FLT_MAX;
+        float maxX = -FLT_MAX;
+        float maxY = -FLT_MAX;
+        for (int i = 0; i < 4; ++i)
+        {
+            Vector3 corner((i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f, 0.0f);
+            inverse.transformPoint(&corner);
+            minX = std::min(minX, corner.x);
+            minY = std::min(minY, corner.y);
+            maxX = std::max(maxX, corner.x);
+            maxY = std::max(maxY, corner.y);
+        }
+
+        // Rows run down from the top of the tile set.
+        const float chunkWidth = _tileWidth * TILESET_CHUNK_SIZE;
+        const float chunkHeight = _tileHeight * TILESET_CHUNK_SIZE;
+        firstColumn = std::max((int)floor(minX / chunkWidth), 0);
+        lastColumn = std::min((int)ceil(maxX / chunkWidth), (int)_chunkColumnCount);
+        firstRow = std::max((int)floor((_height - maxY) / chunkHeight), 0);
+        lastRow = std::min((int)ceil((_height - minY) / chunkHeight), (int)_chunkRowCount);
+    }
+
+    // Bake the visible chunks that changed before any state is bound for drawing.
+    for (int row = firstRow; row < lastRow; ++row)
+    {
+        for (int column = firstColumn; column < lastColumn; ++column)
+        {
+            if (_chunks[row * _chunkColumnCount + column].dirty)
+                bakeChunk(column, row);
+        }
+    }
+
+    // Sprite batch materials have a single pass.
+    Pass* pass = _batch->getMaterial()->getTechnique()->getPassByIndex(0);
+    GP_ASSERT(pass);
+    _batch->setProjectionMatrix(transform);
+    pass->bind();
+    unsigned int drawCalls = 0;
+    for (int row = firstRow; row < lastRow; ++row)
+    {
+        for (int column = firstColumn; column < lastColumn; ++column)
+        {
+            const Chunk& chunk = _chunks[row * _chunkColumnCount + column];
+            if (!chunk.mesh)
+                continue;
+
+            chunk.binding->bind();
+            GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, chunk.mesh->getPart(0)->getIndexBuffer());
+            GL_ASSERT( glDrawElements(GL_TRIANGLES, chunk.indexCount, GL_UNSIGNED_SHORT, 0) );
+            FrameStats::recordDraw(GL_TRIANGLES, chunk.indexCount);
+            chunk.binding->unbind();
+            ++drawCalls;
+        }
+    }
+    pass->unbind();
+    _batch->setProjectionMatrix(projectionMatrix);
+    return drawCalls;
+}
+
+void TileSet::invalidateChunks()
+{
+    for (size_t i = 0, count = _chunks.size(); i < count; ++i)
+        _chunks[i].dirty = true;
+}
+
+void TileSet::bakeChunk(unsigned int chunkColumn, unsigned int chunkRow)
+{
+    Chunk& chunk = _chunks[chunkRow * _chunkColumnCount + chunkColumn];
+    chunk.dirty = false;
+    SAFE_RELEASE(chunk.binding);
+    SAFE_RELEASE(chunk.mesh);
+    chunk.indexCount = 0;
+
+    Texture* texture = _batch->getSampler()->getTexture();
+    GP_ASSERT(texture);
+    const float widthRatio = 1.0f / (float)texture->getWidth();
+    const float heightRatio = 1.0f / (float)texture->getHeight();
+    const Vector4 color(_color.x, _color.y, _color.z, _color.w * _opacity);
+
+    const unsigned int firstColumn = chunkColumn * TILESET_CHUNK_SIZE;
+    const unsigned int lastColumn = std::min(firstColumn + TILESET_CHUNK_SIZE, _columnCount);
+    const unsigned int firstRow = chunkRow * TILESET_CHUNK_SIZE;
+    const unsigned int lastRow = std::min(firstRow + TILESET_CHUNK_SIZE, _rowCount);
+    std::vector<SpriteBatch::SpriteVertex> vertices;
+    std::vector<unsigned short> indices;
+    vertices.reserve((lastColumn - firstColumn) * (lastRow - firstRow) * 4);
+    indices.reserve((lastColumn - firstColumn) * (lastRow - firstRow) * 6);
+    for (unsigned int row = firstRow; row < lastRow; ++row)
     {
-        for (unsigned int col = 0; col < _columnCount; col++)
+        for (unsigned int column = firstColumn; column < lastColumn; ++column)
         {
-            Vector2 scale = Vector2(_tileWidth, _tileHeight);
-            
             // Negative values are skipped to allow blank tiles
-            if (_tiles[row * _columnCount + col].x >= 0 &&
-                _tiles[row * _columnCount + col].y >= 0)
+            const Vector2& source = _tiles[row * _columnCount + column];
+            if (source.x < 0 || source.y < 0)
+                continue;
+
+            // The corners and texture coordinates are those SpriteBatch gives the sprite of a tile.
+            const float x = column * _tileWidth;
+            const float y = (_rowCount - 1 - row) * _tileHeight;
+            const float u1 = widthRatio * source.x;
+            const float v1 = 1.0f - heightRatio * source.y;
+            const float u2 = u1 + widthRatio * _tileWidth;
+            const float v2 = v1 - heightRatio * _tileHeight;
+            const SpriteBatch::SpriteVertex corners[4] =
             {
-                Rectangle source = Rectangle(_tiles[row * _columnCount + col].x,
-                                             _tiles[row * _columnCount + col].y, _tileWidth, _tileHeight);
-                _batch->draw(position, source, scale, Vector4(_color.x, _color.y, _color.z, _color.w * _opacity),
-                             Vector2(0.5f, 0.5f), 0);
-            }
-            
-            position.x += _tileWidth;
+                { x, y + _tileHeight, 0, u1, v1, color.x, color.y, color.z, color.w },
+                { x, y, 0, u1, v2, color.x, color.y, color.z, color.w },
+                { x + _tileWidth, y + _tileHeight, 0, u2, v1, color.x, color.y, color.z, color.w },
+                { x + _tileWidth, y, 0, u2, v2, color.x, color.y, color.z, color.w }
+            };
+            const unsigned short base = (unsigned short)vertices.size();
+            const unsigned short quad[6] = { base, (unsigned short)(base + 1), (unsigned short)(base + 2),
+                                             (unsigned short)(base + 2), (unsigned short)(base + 1), (unsigned short)(base + 3) };
+            vertices.insert(vertices.end(), corners, corners + 4);
+            indices.insert(indices.end(), quad, quad + 6);
         }
-        position.x = xStart;
-        position.y -= _tileHeight;
     }
-    _batch->finish();
-    return 1;
+    if (indices.empty())
+        return;
+
+    VertexFormat::Element vertexElements[] =
+    {
+        VertexFormat::Element(VertexFormat::POSITION, 3),
+        VertexFormat::Element(VertexFormat::TEXCOORD0, 2),
+        VertexFormat::Element(VertexFormat::COLOR, 4)
+    };
+    Mesh* mesh = Mesh::createMesh(VertexFormat(vertexElements, 3), (unsigned int)vertices.size(), false);
+    if (!mesh)
+    {
+        GP_WARN("Failed to create the mesh of a tile set chunk.");
+        return;
+    }
+    mesh->setVertexData(&vertices[0], 0, (unsigned int)vertices.size());
+    MeshPart* part = mesh->addPart(Mesh::TRIANGLES, Mesh::INDEX16, (unsigned int)indices.size(), false);
+    if (!part)
+    {
+        SAFE_RELEASE(mesh);
+        return;
+    }
+    part->setIndexData(&indices[0], 0, (unsigned int)indices.size());
+
+    Pass* pass = _batch->getMaterial()->getTechnique()->getPassByIndex(0);
+    GP_ASSERT(pass);
+    chunk.binding = VertexAttributeBinding::create(mesh, pass->getEffect());
+    if (!chunk.binding)
+    {
+        SAFE_RELEASE(mesh);
+        return;
+    }
+    chunk.mesh = mesh;
+    chunk.indexCount = (unsigned int)indices.size();
+}
+
+void TileSet::clearChunks()
+{
+    for (size_t i = 0, count = _chunks.size(); i < count; ++i)
+    {
+        SAFE_RELEASE(_chunks[i].binding);
+        SAFE_RELEASE(_chunks[i].mesh);
+    }
+    _chunks.clear();
 }
 
 Drawable* TileSet::clone(NodeCloneContext& context)
 {
     TileSet* tilesetClone = new TileSet();
 
-    // Clone properties
+    // Clone properties. The clone bakes chunks of its own when it is first drawn.
+    tilesetClone->_rowCount = _rowCount;
+    tilesetClone->_columnCount = _columnCount;
     tilesetClone->_tiles = new Vector2[tilesetClone->_rowCount * tilesetClone->_columnCount];
-    memset(tilesetClone->_tiles, -1, sizeof(float) * tilesetClone->_rowCount * tilesetClone->_columnCount * 2);
     memcpy(tilesetClone->_tiles, _tiles, sizeof(Vector2) * tilesetClone->_rowCount * tilesetClone->_columnCount);
     tilesetClone->_tileWidth = _tileWidth;
     tilesetClone->_tileHeight = _tileHeight;
-    tilesetClone->_rowCount = _rowCount;
-    tilesetClone->_columnCount = _columnCount;
     tilesetClone->_width = _tileWidth * _columnCount;
     tilesetClone->_height = _tileHeight * _rowCount;
     tilesetClone->_opacity = _opacity;
@@ -12,6 +12,9 @@
 namespace gameplay
 {
 
+class Mesh;
+class VertexAttributeBinding;
+
 /**
  * Defines a grid of tiles for rendering a 2D planer region.
  *
@@ -26,6 +29,11 @@ namespace gameplay
  * a gutter of duplicate pixels on each side of the region.
  *
  * The tile set does not support rotation or scaling.
+ *
+ * The tiles are baked into static meshes in chunks of 16 by 16 tiles, which are drawn with
+ * one draw call each. A chunk is only baked again after one of its tiles is changed with
+ * setTileSource(), or after the color or opacity changes. When the projection of the scene
+ * is orthographic, the chunks outside of the viewport are skipped.
  */
 class TileSet : public Ref, public Drawable
 {
@@ -176,6 +184,32 @@ protected:
 
 private:
 
+    /**
+     * A region of tiles baked into a static mesh.
+     */
+    struct Chunk
+    {
+        Mesh* mesh;
+        VertexAttributeBinding* binding;
+        unsigned int indexCount;
+        bool dirty;
+    };
+
+    /**
+     * Marks every chunk to be baked again before it is drawn.
+     */
+    void invalidateChunks();
+
+    /**
+     * Bakes the tiles of a chunk into its mesh.
+     */
+    void bakeChunk(unsigned int chunkColumn, unsigned int chunkRow);
+
+    /**
+     * Releases the meshes of the chunks.
+     */
+    void clearChunks();
+
     Vector2* _tiles;
     float _tileWidth;
     float _tileHeight;
@@ -186,6 +220,9 @@ private:
     SpriteBatch* _batch;
     float _opacity;
     Vector4 _color;
+    std::vector<Chunk> _chunks;
+    unsigned int _chunkColumnCount;
+    unsigned int _chunkRowCount;
 };
     
 }
@@ -9,6 +9,56 @@ namespace gameplay
 int Transform::_suspendTransformChanged(0);
 std::vector<Transform*> Transform::_transformsChanged;
 
+// A listener callback deferred while the suspended transform changes are being flushed.
+// The listener is cleared when the listener is removed from the transform or the transform
+// is destroyed before the callback is made.
+struct TransformChangedEvent
+{
+    Transform::Listener* listener;
+    long cookie;
+    Transform* transform;
+    unsigned int group;
+};
+
+// Orders deferred callbacks by group, the order in which their listener and cookie were first seen.
+static bool compareTransformChangedEvents(const TransformChangedEvent& a, const TransformChangedEvent& b)
+{
+    return a.group < b.group;
+}
+
+// True while resumeTransformChanged() is notifying the queued transforms.
+static bool __transformChangedFlushing = false;
+static std::vector<TransformChangedEvent> __transformChangedEvents;
+
+// The deferred callbacks being made by resumeTransformChanged(), if any.
+static std::vector<TransformChangedEvent>* __transformChangedDispatching = NULL;
+
+// Drops the deferred callbacks of a transform, for the given listener or for every listener if it is NULL.
+static void dropTransformChangedEvents(std::vector<TransformChangedEvent>& events, Transform::Listener* listener, Transform* transform)
+{
+    for (size_t i = 0, count = events.size(); i < count; ++i)
+    {
+        TransformChangedEvent& event = events[i];
+        if (event.transform == transform && (listener == NULL || event.listener == listener))
+            event.listener = NULL;
+    }
+}
+
+static void dropTransformChangedEvents(Transform::Listener* listener, Transform* transform)
+{
+    dropTransformChangedEvents(__transformChangedEvents, listener, transform);
+    if (__transformChangedDispatching)
+        dropTransformChangedEvents(*__transformChangedDispatching, listener, transform);
+}
+
+void Transform::Listener::transformsChanged(Transform* const* transforms, unsigned int count, long cookie)
+{
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        transformChanged(transforms[i], cookie);
+    }
+}
+
 Transform::Transform()
     : _matrixDirtyBits(0), _listeners(NULL)
 {
@@ -47,6 +97,7 @@ Transform::Transform(const Transform& copy)
 
 Transform::~Transform()
 {
+    dropTransformChangedEvents(NULL, this);
     SAFE_DELETE(_listeners);
 }
 
@@ -60,31 +111,83 @@ void Transform::resumeTransformChanged()
     if (_suspendTransformChanged == 0) // We haven't suspended transformChanged() calls, so do nothing.
         return;
     
-    if (_suspendTransformChanged == 1)
+    if (_suspendTransformChanged > 1)
     {
-        // Call transformChanged() on all transforms in the list
-        size_t transformCount = _transformsChanged.size();
-        for (size_t i = 0; i < transformCount; i++)
-        {
-            Transform* t = _transformsChanged.at(i);
-            GP_ASSERT(t);
-            t->transformChanged();
-        }
+        _suspendTransformChanged--;
+        return;
+    }
 
-        // Go through list and reset DIRTY_NOTIFY bit. The list could potentially be larger here if the 
-        // transforms we were delaying calls to transformChanged() have any child nodes.
-        transformCount = _transformsChanged.size();
-        for (size_t i = 0; i < transformCount; i++)
-        {
-            Transform* t = _transformsChanged.at(i);
-            GP_ASSERT(t);
-            t->_matrixDirtyBits &= ~DIRTY_NOTIFY;
-        }
+    // Call transformChanged() on all transforms in the list. Listener callbacks are
+    // collected rather than fired so that they can be dispatched in groups below.
+    __transformChangedFlushing = true;
+    size_t transformCount = _transformsChanged.size();
+    for (size_t i = 0; i < transformCount; i++)
+    {
+        Transform* t = _transformsChanged.at(i);
+        GP_ASSERT(t);
+        t->transformChanged();
+    }
 
-        // empty list for next frame.
-        _transformsChanged.clear();
+    // Go through list and reset DIRTY_NOTIFY bit. The list could potentially be larger here if the 
+    // transforms we were delaying calls to transformChanged() have any child nodes.
+    transformCount = _transformsChanged.size();
+    for (size_t i = 0; i < transformCount; i++)
+    {
+        Transform* t = _transformsChanged.at(i);
+        GP_ASSERT(t);
+        t->_matrixDirtyBits &= ~DIRTY_NOTIFY;
     }
+
+    // empty list for next frame.
+    _transformsChanged.clear();
+    __transformChangedFlushing = false;
     _suspendTransformChanged--;
+
+    if (__transformChangedEvents.empty())
+        return;
+
+    // Take the events in case a listener suspends and resumes transform changes itself.
+    std::vector<TransformChangedEvent> events;
+    events.swap(__transformChangedEvents);
+
+    // Group the events by listener and cookie, in the order the groups were first seen, so
+    // that the order of the callbacks is the same from run to run.
+    std::map<std::pair<Transform::Listener*, long>, unsigned int> groups;
+    for (size_t i = 0, count = events.size(); i < count; ++i)
+    {
+        TransformChangedEvent& event = events[i];
+        event.group = groups.insert(std::make_pair(std::make_pair(event.listener, event.cookie), (unsigned int)groups.size())).first->second;
+    }
+    std::stable_sort(events.begin(), events.end(), compareTransformChangedEvents);
+
+    // Callbacks that remove listeners or destroy transforms drop the events of the later groups.
+    std::vector<TransformChangedEvent>* dispatching = __transformChangedDispatching;
+    __transformChangedDispatching = &events;
+    std::vector<Transform*> transforms;
+    for (size_t first = 0, count = events.size(); first < count;)
+    {
+        size_t last = first;
+        Transform::Listener* listener = NULL;
+        transforms.clear();
+        while (last < count && events[last].group == events[first].group)
+        {
+            if (events[last].listener)
+            {
+                listener = events[last].listener;
+                transforms.push_back(events[last].transform);
+            }
+            ++last;
+        }
+        if (listener)
+            listener->transformsChanged(&transforms[0], (unsigned int)transforms.size(), events[first].cookie);
+        first = last;
+    }
+    __transformChangedDispatching = dispatching;
+
+    // Keep the allocation for the next flush.
+    events.clear();
+    if (__transformChangedEvents.empty())
+        events.swap(__transformChangedEvents);
 }
 
 bool Transform::isTransformChangedSuspended()
@@ -967,6 +1070,7 @@ void Transform::removeListener(Transform::Listener* listener)
             if ((*itr).listener == listener)
             {
                 _listeners->erase(itr);
+                dropTransformChangedEvents(listener, this);
                 break;
             }
         }
@@ -981,7 +1085,19 @@ void Transform::transformChanged()
         {
             TransformListener& l = *itr;
             GP_ASSERT(l.listener);
-            l.listener->transformChanged(this, l.cookie);
+            if (__transformChangedFlushing)
+            {
+                TransformChangedEvent event;
+                event.listener = l.listener;
+                event.cookie = l.cookie;
+                event.transform = this;
+                event.group = 0;
+                __transformChangedEvents.push_back(event);
+            }
+            else
+            {
+                l.listener->transformChanged(this, l.cookie);
+            }
         }
     }
     fireScriptEvent<void>(GP_GET_SCRIPT_EVENT(Transform, transformChanged), dynamic_cast<void*>(this));
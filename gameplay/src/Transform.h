@@ -108,6 +108,13 @@ public:
 
     /**
      * Globally suspends all transform changed events.
+     *
+     * While suspended, each changed transform is queued once. When the outermost suspension
+     * is resumed the queued transforms are notified and then the listeners are called
+     * once per listener and cookie with all of the transforms that changed, through
+     * Listener::transformsChanged(), in the order the listeners were first notified.
+     * The callbacks of a listener removed from a transform, or of a destroyed transform,
+     * are dropped if they have not been made yet.
      */
     static void suspendTransformChanged();
 
@@ -139,6 +146,19 @@ public:
          * @param cookie Cookie value that was specified when the listener was registered.
          */
         virtual void transformChanged(Transform* transform, long cookie) = 0;
+
+        /**
+         * Handles when a group of transforms registered with the same cookie have changed
+         * while transform changed events were suspended.
+         *
+         * The default implementation calls transformChanged() for each transform. Listeners
+         * that observe many transforms can override this to handle them together.
+         *
+         * @param transforms The Transform objects that were changed.
+         * @param count The number of transforms.
+         * @param cookie Cookie value that was specified when the listener was registered.
+         */
+        virtual void transformsChanged(Transform* const* transforms, unsigned int count, long cookie);
     };
 
     /**
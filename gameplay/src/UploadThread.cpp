@@ -0,0 +1,146 @@
+#include "Base.h"
+#include "UploadThread.h"
+#include "Platform.h"
+
+namespace gameplay
+{
+
+UploadThread::UploadThread(JobSystem* jobSystem)
+    : _jobSystem(jobSystem), _running(false), _started(false), _contextCurrent(false), _quit(false)
+{
+    GP_ASSERT(jobSystem);
+}
+
+UploadThread::~UploadThread()
+{
+    stop();
+}
+
+bool UploadThread::start()
+{
+    if (_running)
+        return true;
+
+    if (!Platform::createUploadContext())
+        return false;
+
+    // Wait for the thread to make the upload context current, which may still fail.
+    _started = false;
+    _contextCurrent = false;
+    _quit = false;
+    _thread = std::thread(&UploadThread::uploadMain, this);
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (!_started)
+            _condition.wait(lock);
+    }
+    if (!_contextCurrent)
+    {
+        _thread.join();
+        Platform::destroyUploadContext();
+        return false;
+    }
+
+    _running = true;
+    return true;
+}
+
+void UploadThread::stop()
+{
+    if (!_running)
+        return;
+
+    GP_ASSERT(std::this_thread::get_id() != _thread.get_id());
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _quit = true;
+    }
+    _condition.notify_all();
+    _thread.join();
+    _running = false;
+
+    Platform::destroyUploadContext();
+}
+
+void UploadThread::run(const JobSystem::Function& upload, JobSystem::Counter* counter)
+{
+    GP_ASSERT(upload);
+    GP_ASSERT(_running);
+
+    if (counter)
+        _jobSystem->acquire(counter);
+
+    Upload entry;
+    entry.function = upload;
+    entry.counter = counter;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _uploads.push_back(entry);
+    }
+    _condition.notify_all();
+}
+
+void UploadThread::uploadMain()
+{
+    bool current = Platform::makeUploadContextCurrent(true);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _started = true;
+        _contextCurrent = current;
+    }
+    _condition.notify_all();
+    if (!current)
+        return;
+
+    // The uploads queued while a batch runs are run in the next batch, behind a fence of their own.
+    std::vector<Upload> uploads;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (_uploads.empty() && !_quit)
+                _condition.wait(lock);
+            if (_uploads.empty())
+                break;
+            uploads.swap(_uploads);
+        }
+
+        for (size_t i = 0, count = uploads.size(); i < count; ++i)
+            uploads[i].function();
+        finishUploads();
+        for (size_t i = 0, count = uploads.size(); i < count; ++i)
+        {
+            if (uploads[i].counter)
+                _jobSystem->release(uploads[i].counter);
+        }
+        uploads.clear();
+    }
+
+    Platform::makeUploadContextCurrent(false);
+}
+
+void UploadThread::finishUploads()
+{
+#ifdef GP_USE_BUFFER_SYNC
+    if (glFenceSync && glClientWaitSync && glDeleteSync)
+    {
+        GLsync fence;
+        GL_ASSERT( fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) );
+        if (fence)
+        {
+            GLenum result;
+            do
+            {
+                result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            } while (result == GL_TIMEOUT_EXPIRED);
+            GL_ASSERT( glDeleteSync(fence) );
+            if (result != GL_WAIT_FAILED)
+                return;
+        }
+    }
+#endif
+
+    GL_ASSERT( glFinish() );
+}
+
+}
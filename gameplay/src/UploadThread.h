@@ -0,0 +1,115 @@
+#ifndef UPLOADTHREAD_H_
+#define UPLOADTHREAD_H_
+
+#include "JobSystem.h"
+
+namespace gameplay
+{
+
+/**
+ * Defines the thread that uploads graphics resources through a graphics context of its own.
+ *
+ * The upload context shares its textures, buffers and programs with the graphics context of
+ * the game, so objects that are created and filled on the upload thread can be used by the
+ * game once the GPU has finished the commands that filled them. The uploads queued on the
+ * thread are run in batches, and each batch is followed by a fence (or by glFinish where the
+ * GL has no sync objects). The counter of an upload is only released once its fence has
+ * signalled, so a counter that is done means that its objects are complete.
+ *
+ * Uploads may only create and fill textures and buffers, and must do so with plain GL calls:
+ * GLStateCache shadows the state of the context of the game, and vertex arrays and frame
+ * buffers are not shared between contexts. Objects created by an upload must be bound again
+ * on the context of the game before it uses them.
+ *
+ * When the upload thread is enabled, textures created by Texture::createAsync and the meshes
+ * of scenes loaded by Bundle::loadSceneAsync are uploaded on it straight after they are read,
+ * rather than within the upload budgets of each frame on the game thread. The upload thread
+ * is enabled by the uploadThread property of the graphics namespace of game.config, and is
+ * only available on platforms that can create a shared graphics context. Elsewhere resources
+ * are uploaded on the game thread as before.
+ *
+ * Game owns the upload thread.
+ *
+ * @script{ignore}
+ */
+class UploadThread
+{
+    friend class Game;
+
+public:
+
+    /**
+     * Queues a function to run on the upload thread with the upload context current.
+     *
+     * May be called from any thread.
+     *
+     * @param upload The function that creates and fills the graphics objects.
+     * @param counter An optional counter to increment now and decrement once the GPU has
+     *      finished the commands of the upload.
+     */
+    void run(const JobSystem::Function& upload, JobSystem::Counter* counter = NULL);
+
+private:
+
+    struct Upload
+    {
+        JobSystem::Function function;
+        JobSystem::Counter* counter;
+    };
+
+    /**
+     * Constructor.
+     */
+    UploadThread(JobSystem* jobSystem);
+
+    /**
+     * Destructor, which stops the thread.
+     */
+    ~UploadThread();
+
+    /**
+     * Hidden copy constructor.
+     */
+    UploadThread(const UploadThread&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    UploadThread& operator=(const UploadThread&);
+
+    /**
+     * Creates the upload context and starts the thread it is current on.
+     *
+     * @return false if the platform cannot create a shared graphics context.
+     */
+    bool start();
+
+    /**
+     * Runs the uploads still queued, stops the thread and destroys the upload context.
+     */
+    void stop();
+
+    /**
+     * The body of the upload thread.
+     */
+    void uploadMain();
+
+    /**
+     * Waits until the GPU has finished the commands of the uploads run so far.
+     */
+    void finishUploads();
+
+    JobSystem* _jobSystem;
+    bool _running;
+    bool _started;
+    bool _contextCurrent;
+    bool _quit;
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::vector<Upload> _uploads;
+};
+
+}
+
+#endif
@@ -8,6 +8,8 @@ class Matrix;
 
 /**
  * Defines a 2-element floating point vector.
+ *
+ * @script{value}
  */
 class Vector2
 {
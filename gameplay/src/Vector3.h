@@ -14,6 +14,8 @@ class Matrix;
  * Other uses of directional vectors may wish to leave
  * the magnitude of the vector intact. When used as a point,
  * the elements of the vector represent a position in 3D space.
+ *
+ * @script{value}
  */
 class Vector3
 {
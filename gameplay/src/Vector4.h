@@ -8,6 +8,8 @@ class Matrix;
 
 /**
  * Defines 4-element floating point vector.
+ *
+ * @script{value}
  */
 class Vector4
 {
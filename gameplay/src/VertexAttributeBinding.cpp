@@ -1,5 +1,6 @@
 #include "Base.h"
 #include "VertexAttributeBinding.h"
+#include "GLStateCache.h"
 #include "Mesh.h"
 #include "Effect.h"
 
@@ -7,31 +8,84 @@ namespace gameplay
 {
 
 static GLuint __maxVertexAttribs = 0;
-static std::vector<VertexAttributeBinding*> __vertexAttributeBindingCache;
+
+// Mesh bindings, keyed on their mesh and effect. The vertex format of a binding is that of its mesh.
+struct VertexAttributeBindingKey
+{
+    const Mesh* mesh;
+    const Effect* effect;
+
+    bool operator==(const VertexAttributeBindingKey& key) const
+    {
+        return mesh == key.mesh && effect == key.effect;
+    }
+};
+
+struct VertexAttributeBindingKeyHash
+{
+    size_t operator()(const VertexAttributeBindingKey& key) const
+    {
+        size_t hash = std::hash<const void*>()(key.mesh);
+        return hash ^ (std::hash<const void*>()(key.effect) + 0x9e3779b9 + (hash << 6) + (hash >> 2));
+    }
+};
+
+typedef std::unordered_map<VertexAttributeBindingKey, VertexAttributeBinding*, VertexAttributeBindingKeyHash> VertexAttributeBindingCache;
+static VertexAttributeBindingCache __vertexAttributeBindingCache;
+
+// Every binding, and the ones that keep their attributes in software, for resource statistics.
+static unsigned int __bindingCount = 0;
+static unsigned int __softwareBindingCount = 0;
+
+// Gets the GL type of the values of vertex elements of the given type.
+static GLenum getAttribType(VertexFormat::Type type)
+{
+#ifdef OPENGL_ES
+    // OpenGL ES 2 only has half float attributes through GL_OES_vertex_half_float, with its own enum.
+    if (type == VertexFormat::HALF_FLOAT)
+        return 0x8D61; // GL_HALF_FLOAT_OES
+#endif
+    return (GLenum)type;
+}
 
 VertexAttributeBinding::VertexAttributeBinding() :
-    _handle(0), _attributes(NULL), _mesh(NULL), _effect(NULL)
+    _handle(0), _attributes(NULL), _mesh(NULL), _effect(NULL), _vertexPointer(NULL), _vertexBuffer(0), _vertexOffset(0)
 {
+    ++__bindingCount;
 }
 
 VertexAttributeBinding::~VertexAttributeBinding()
 {
     // Delete from the vertex attribute binding cache.
-    std::vector<VertexAttributeBinding*>::iterator itr = std::find(__vertexAttributeBindingCache.begin(), __vertexAttributeBindingCache.end(), this);
-    if (itr != __vertexAttributeBindingCache.end())
+    if (_mesh)
     {
-        __vertexAttributeBindingCache.erase(itr);
+        VertexAttributeBindingKey key = { _mesh, _effect };
+        VertexAttributeBindingCache::iterator itr = __vertexAttributeBindingCache.find(key);
+        if (itr != __vertexAttributeBindingCache.end() && itr->second == this)
+        {
+            __vertexAttributeBindingCache.erase(itr);
+        }
     }
 
     SAFE_RELEASE(_mesh);
     SAFE_RELEASE(_effect);
+    if (_attributes)
+        --__softwareBindingCount;
     SAFE_DELETE_ARRAY(_attributes);
+    --__bindingCount;
 
+#ifdef GP_USE_VAO
     if (_handle)
     {
-        GL_ASSERT( glDeleteVertexArrays(1, &_handle) );
+        GLStateCache::deleteVertexArray(_handle);
         _handle = 0;
     }
+#endif
+}
+
+bool VertexAttributeBinding::isDestroyedOnMainThread() const
+{
+    return true;
 }
 
 VertexAttributeBinding* VertexAttributeBinding::create(Mesh* mesh, Effect* effect)
@@ -39,25 +93,23 @@ VertexAttributeBinding* VertexAttributeBinding::create(Mesh* mesh, Effect* effec
     GP_ASSERT(mesh);
 
     // Search for an existing vertex attribute binding that can be used.
-    VertexAttributeBinding* b;
-    for (size_t i = 0, count = __vertexAttributeBindingCache.size(); i < count; ++i)
+    VertexAttributeBindingKey key = { mesh, effect };
+    VertexAttributeBindingCache::iterator itr = __vertexAttributeBindingCache.find(key);
+    if (itr != __vertexAttributeBindingCache.end())
     {
-        b = __vertexAttributeBindingCache[i];
+        // Found a match!
+        VertexAttributeBinding* b = itr->second;
         GP_ASSERT(b);
-        if (b->_mesh == mesh && b->_effect == effect)
-        {
-            // Found a match!
-            b->addRef();
-            return b;
-        }
+        b->addRef();
+        return b;
     }
 
-    b = create(mesh, mesh->getVertexFormat(), 0, effect);
+    VertexAttributeBinding* b = create(mesh, mesh->getVertexFormat(), 0, effect);
 
     // Add the new vertex attribute binding to the cache.
     if (b)
     {
-        __vertexAttributeBindingCache.push_back(b);
+        __vertexAttributeBindingCache[key] = b;
     }
 
     return b;
@@ -92,8 +144,8 @@ VertexAttributeBinding* VertexAttributeBinding::create(Mesh* mesh, const VertexF
 #ifdef GP_USE_VAO
     if (mesh && glGenVertexArrays)
     {
-        GL_ASSERT( glBindBuffer(GL_ARRAY_BUFFER, 0) );
-        GL_ASSERT( glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0) );
+        GLStateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+        GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
         // Use hardware VAOs.
         GL_ASSERT( glGenVertexArrays(1, &b->_handle) );
@@ -106,10 +158,10 @@ VertexAttributeBinding* VertexAttributeBinding::create(Mesh* mesh, const VertexF
         }
 
         // Bind the new VAO.
-        GL_ASSERT( glBindVertexArray(b->_handle) );
+        GLStateCache::bindVertexArray(b->_handle);
 
         // Bind the Mesh VBO so our glVertexAttribPointer calls use it.
-        GL_ASSERT( glBindBuffer(GL_ARRAY_BUFFER, mesh->getVertexBuffer()) );
+        GLStateCache::bindBuffer(GL_ARRAY_BUFFER, mesh->getVertexBuffer());
     }
     else
 #endif
@@ -127,6 +179,7 @@ VertexAttributeBinding* VertexAttributeBinding::create(Mesh* mesh, const VertexF
             attribs[i].pointer = 0;
         }
         b->_attributes = attribs;
+        ++__softwareBindingCount;
     }
 
     if (mesh)
@@ -137,10 +190,12 @@ VertexAttributeBinding* VertexAttributeBinding::create(Mesh* mesh, const VertexF
     
     b->_effect = effect;
     effect->addRef();
+    b->_vertexPointer = vertexPointer;
 
     // Call setVertexAttribPointer for each vertex element.
+    // Pooled meshes start part of the way into a vertex buffer shared with other meshes.
     std::string name;
-    size_t offset = 0;
+    size_t offset = mesh ? mesh->getVertexOffset() : 0;
     for (size_t i = 0, count = vertexFormat.getElementCount(); i < count; ++i)
     {
         const VertexFormat::Element& e = vertexFormat.getElement(i);
@@ -198,16 +253,18 @@ VertexAttributeBinding* VertexAttributeBinding::create(Mesh* mesh, const VertexF
         else
         {
             void* pointer = vertexPointer ? (void*)(((unsigned char*)vertexPointer) + offset) : (void*)offset;
-            b->setVertexAttribPointer(attrib, (GLint)e.size, GL_FLOAT, GL_FALSE, (GLsizei)vertexFormat.getVertexSize(), pointer);
+            b->setVertexAttribPointer(attrib, (GLint)e.size, getAttribType(e.type), e.normalized ? GL_TRUE : GL_FALSE, (GLsizei)vertexFormat.getVertexSize(), pointer);
         }
 
-        offset += e.size * sizeof(float);
+        offset += e.getByteSize();
     }
 
+#ifdef GP_USE_VAO
     if (b->_handle)
     {
-        GL_ASSERT( glBindVertexArray(0) );
+        GLStateCache::bindVertexArray(0);
     }
+#endif
 
     return b;
 }
@@ -235,23 +292,38 @@ void VertexAttributeBinding::setVertexAttribPointer(GLuint indx, GLint size, GLe
     }
 }
 
+void VertexAttributeBinding::setVertexBuffer(GLuint buffer, size_t offset)
+{
+    GP_ASSERT(_mesh == NULL && _handle == 0);
+
+    _vertexBuffer = buffer;
+    _vertexOffset = offset;
+}
+
 void VertexAttributeBinding::bind()
 {
+#ifdef GP_USE_VAO
     if (_handle)
     {
         // Hardware mode
-        GL_ASSERT( glBindVertexArray(_handle) );
+        GLStateCache::bindVertexArray(_handle);
     }
     else
+#endif
     {
-        // Software mode
+        // Software mode. The attribute pointers must not be set on a vertex array object
+        // that a hardware mode binding has left bound.
+#ifdef GP_USE_VAO
+        if (glBindVertexArray)
+            GLStateCache::bindVertexArray(0);
+#endif
         if (_mesh)
         {
-            GL_ASSERT( glBindBuffer(GL_ARRAY_BUFFER, _mesh->getVertexBuffer()) );
+            GLStateCache::bindBuffer(GL_ARRAY_BUFFER, _mesh->getVertexBuffer());
         }
         else
         {
-            GL_ASSERT( glBindBuffer(GL_ARRAY_BUFFER, 0) );
+            GLStateCache::bindBuffer(GL_ARRAY_BUFFER, _vertexBuffer);
         }
 
         GP_ASSERT(_attributes);
@@ -260,7 +332,9 @@ void VertexAttributeBinding::bind()
             VertexAttribute& a = _attributes[i];
             if (a.enabled)
             {
-                GL_ASSERT( glVertexAttribPointer(i, a.size, a.type, a.normalized, a.stride, a.pointer) );
+                // Client array pointers become offsets into the vertex buffer the array was copied to.
+                void* pointer = _vertexBuffer ? (void*)((unsigned char*)a.pointer - (unsigned char*)_vertexPointer + _vertexOffset) : a.pointer;
+                GL_ASSERT( glVertexAttribPointer(i, a.size, a.type, a.normalized, a.stride, pointer) );
                 GL_ASSERT( glEnableVertexAttribArray(i) );
             }
         }
@@ -269,17 +343,14 @@ void VertexAttributeBinding::bind()
 
 void VertexAttributeBinding::unbind()
 {
-    if (_handle)
-    {
-        // Hardware mode
-        GL_ASSERT( glBindVertexArray(0) );
-    }
-    else
+    // In hardware mode the vertex array is left bound, so that binding it again
+    // for the next draw is skipped by the state cache.
+    if (_handle == 0)
     {
         // Software mode
-        if (_mesh)
+        if (_mesh || _vertexBuffer)
         {
-            GL_ASSERT( glBindBuffer(GL_ARRAY_BUFFER, 0) );
+            GLStateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
         }
 
         GP_ASSERT(_attributes);
@@ -293,4 +364,14 @@ void VertexAttributeBinding::unbind()
     }
 }
 
+unsigned int VertexAttributeBinding::getBindingCount()
+{
+    return __bindingCount;
+}
+
+size_t VertexAttributeBinding::getTotalMemorySize()
+{
+    return __bindingCount * sizeof(VertexAttributeBinding) + (size_t)__softwareBindingCount * __maxVertexAttribs * sizeof(VertexAttribute);
+}
+
 }
@@ -31,6 +31,9 @@ class Effect;
  */
 class VertexAttributeBinding : public Ref
 {
+    friend class ResourceManager;
+    friend class Model;
+
 public:
 
     /**
@@ -68,6 +71,18 @@ public:
      */
     static VertexAttributeBinding* create(const VertexFormat& vertexFormat, void* vertexPointer, Effect* effect);
 
+    /**
+     * Sources the vertices of a client-side binding from a vertex buffer instead of its client array.
+     *
+     * The vertices are read from the given offset of the buffer, laid out as they are in the
+     * client array. Pass a buffer of 0 to go back to the client array.
+     *
+     * @param buffer The vertex buffer holding a copy of the client array, or 0.
+     * @param offset The offset of the copy in the buffer.
+     * @script{ignore}
+     */
+    void setVertexBuffer(GLuint buffer, size_t offset);
+
     /**
      * Binds this vertex array object.
      */
@@ -101,6 +116,11 @@ private:
      */
     ~VertexAttributeBinding();
 
+    /**
+     * @see Ref::isDestroyedOnMainThread
+     */
+    bool isDestroyedOnMainThread() const;
+
     /**
      * Hidden copy assignment operator.
      */
@@ -110,10 +130,23 @@ private:
 
     void setVertexAttribPointer(GLuint indx, GLint size, GLenum type, GLboolean normalize, GLsizei stride, void* pointer);
 
+    /**
+     * Gets the number of vertex attribute bindings.
+     */
+    static unsigned int getBindingCount();
+
+    /**
+     * Gets the number of bytes used by all vertex attribute bindings, excluding the vertex arrays held by the driver.
+     */
+    static size_t getTotalMemorySize();
+
     GLuint _handle;
     VertexAttribute* _attributes;
     Mesh* _mesh;
     Effect* _effect;
+    void* _vertexPointer;
+    GLuint _vertexBuffer;
+    size_t _vertexOffset;
 };
 
 }
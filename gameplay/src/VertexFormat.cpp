@@ -4,6 +4,93 @@
 namespace gameplay
 {
 
+// Converts a float to the nearest half float.
+static unsigned short toHalf(float value)
+{
+    unsigned int bits;
+    memcpy(&bits, &value, sizeof(float));
+    unsigned int sign = (bits >> 16) & 0x8000;
+    unsigned int mantissa = bits & 0x7FFFFF;
+    int exponent = (int)((bits >> 23) & 0xFF) - 127 + 15;
+    if (((bits >> 23) & 0xFF) == 0xFF)
+        return (unsigned short)(sign | 0x7C00 | (mantissa ? 0x200 : 0));
+    if (exponent >= 31)
+        return (unsigned short)(sign | 0x7C00);
+    if (exponent <= 0)
+    {
+        // Values below the smallest normal half float become denormals or zero.
+        if (exponent < -10)
+            return (unsigned short)sign;
+        mantissa |= 0x800000;
+        unsigned int shift = (unsigned int)(14 - exponent);
+        unsigned int half = mantissa >> shift;
+        if ((mantissa >> (shift - 1)) & 1)
+            ++half;
+        return (unsigned short)(sign | half);
+    }
+    unsigned int half = sign | ((unsigned int)exponent << 10) | (mantissa >> 13);
+    if (mantissa & 0x1000)
+        ++half;
+    return (unsigned short)half;
+}
+
+// Converts a half float to a float.
+static float fromHalf(unsigned short value)
+{
+    unsigned int sign = (unsigned int)(value & 0x8000) << 16;
+    unsigned int exponent = (value >> 10) & 0x1F;
+    unsigned int mantissa = value & 0x3FF;
+    unsigned int bits;
+    if (exponent == 0)
+    {
+        if (mantissa == 0)
+        {
+            bits = sign;
+        }
+        else
+        {
+            // Normalize the denormal.
+            exponent = 127 - 15 + 1;
+            while ((mantissa & 0x400) == 0)
+            {
+                mantissa <<= 1;
+                --exponent;
+            }
+            bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+        }
+    }
+    else if (exponent == 31)
+    {
+        bits = sign | 0x7F800000 | (mantissa << 13);
+    }
+    else
+    {
+        bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    }
+    float result;
+    memcpy(&result, &bits, sizeof(float));
+    return result;
+}
+
+// Determines if the extension is supported by the current context.
+static bool hasExtension(const char* name)
+{
+    const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+    return extensions && strstr(extensions, name) != NULL;
+}
+
+#ifndef OPENGL_ES
+// Determines if the current context is of the given OpenGL version or later.
+static bool hasVersion(int major, int minor)
+{
+    const char* version = (const char*)glGetString(GL_VERSION);
+    int contextMajor = 0, contextMinor = 0;
+    if (!version || sscanf(version, "%d.%d", &contextMajor, &contextMinor) != 2)
+        return false;
+    return contextMajor > major || (contextMajor == major && contextMinor >= minor);
+}
+#endif
+
 VertexFormat::VertexFormat(const Element* elements, unsigned int elementCount)
     : _vertexSize(0)
 {
@@ -17,7 +104,7 @@ VertexFormat::VertexFormat(const Element* elements, unsigned int elementCount)
         memcpy(&element, &elements[i], sizeof(Element));
         _elements.push_back(element);
 
-        _vertexSize += element.size * sizeof(float);
+        _vertexSize += element.getByteSize();
     }
 }
 
@@ -62,18 +149,41 @@ bool VertexFormat::operator != (const VertexFormat& f) const
 }
 
 VertexFormat::Element::Element() :
-    usage(POSITION), size(0)
+    usage(POSITION), size(0), type(FLOAT), normalized(false)
 {
 }
 
 VertexFormat::Element::Element(Usage usage, unsigned int size) :
-    usage(usage), size(size)
+    usage(usage), size(size), type(FLOAT), normalized(false)
+{
+}
+
+VertexFormat::Element::Element(Usage usage, unsigned int size, Type type, bool normalized) :
+    usage(usage), size(size), type(type), normalized(normalized)
 {
 }
 
+unsigned int VertexFormat::Element::getByteSize() const
+{
+    switch (type)
+    {
+    case BYTE:
+    case UNSIGNED_BYTE:
+        return size;
+    case HALF_FLOAT:
+    case SHORT:
+    case UNSIGNED_SHORT:
+        return size * 2;
+    case INT_2_10_10_10_REV:
+        return 4;
+    default:
+        return size * sizeof(float);
+    }
+}
+
 bool VertexFormat::Element::operator == (const VertexFormat::Element& e) const
 {
-    return (size == e.size && usage == e.usage);
+    return (size == e.size && usage == e.usage && type == e.type && normalized == e.normalized);
 }
 
 bool VertexFormat::Element::operator != (const VertexFormat::Element& e) const
@@ -120,4 +230,174 @@ const char* VertexFormat::toString(Usage usage)
     }
 }
 
+const char* VertexFormat::toString(Type type)
+{
+    switch (type)
+    {
+    case FLOAT:
+        return "FLOAT";
+    case HALF_FLOAT:
+        return "HALF_FLOAT";
+    case BYTE:
+        return "BYTE";
+    case UNSIGNED_BYTE:
+        return "UNSIGNED_BYTE";
+    case SHORT:
+        return "SHORT";
+    case UNSIGNED_SHORT:
+        return "UNSIGNED_SHORT";
+    case INT_2_10_10_10_REV:
+        return "INT_2_10_10_10_REV";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+bool VertexFormat::isTypeSupported(Type type)
+{
+    static int halfFloatSupported = -1;
+    static int packedSupported = -1;
+    switch (type)
+    {
+    case HALF_FLOAT:
+        if (halfFloatSupported < 0)
+        {
+#ifdef OPENGL_ES
+            halfFloatSupported = hasExtension("GL_OES_vertex_half_float") ? 1 : 0;
+#else
+            halfFloatSupported = hasVersion(3, 0) || hasExtension("GL_ARB_half_float_vertex") ? 1 : 0;
+#endif
+        }
+        return halfFloatSupported == 1;
+    case INT_2_10_10_10_REV:
+        if (packedSupported < 0)
+        {
+#ifdef OPENGL_ES
+            packedSupported = 0;
+#else
+            packedSupported = hasVersion(3, 3) || hasExtension("GL_ARB_vertex_type_2_10_10_10_rev") ? 1 : 0;
+#endif
+        }
+        return packedSupported == 1;
+    default:
+        return true;
+    }
+}
+
+void VertexFormat::unpack(const Element& element, const void* src, float* dst)
+{
+    GP_ASSERT(src);
+    GP_ASSERT(dst);
+
+    switch (element.type)
+    {
+    case HALF_FLOAT:
+        for (unsigned int i = 0; i < element.size; ++i)
+            dst[i] = fromHalf(((const unsigned short*)src)[i]);
+        break;
+    case BYTE:
+        for (unsigned int i = 0; i < element.size; ++i)
+        {
+            float value = ((const signed char*)src)[i];
+            dst[i] = element.normalized ? std::max(value / 127.0f, -1.0f) : value;
+        }
+        break;
+    case UNSIGNED_BYTE:
+        for (unsigned int i = 0; i < element.size; ++i)
+        {
+            float value = ((const unsigned char*)src)[i];
+            dst[i] = element.normalized ? value / 255.0f : value;
+        }
+        break;
+    case SHORT:
+        for (unsigned int i = 0; i < element.size; ++i)
+        {
+            float value = ((const short*)src)[i];
+            dst[i] = element.normalized ? std::max(value / 32767.0f, -1.0f) : value;
+        }
+        break;
+    case UNSIGNED_SHORT:
+        for (unsigned int i = 0; i < element.size; ++i)
+        {
+            float value = ((const unsigned short*)src)[i];
+            dst[i] = element.normalized ? value / 65535.0f : value;
+        }
+        break;
+    case INT_2_10_10_10_REV:
+        {
+            // Sign extend the three 10 bit values and the 2 bit value.
+            int packed;
+            memcpy(&packed, src, sizeof(int));
+            int values[4] = { (packed << 22) >> 22, (packed << 12) >> 22, (packed << 2) >> 22, packed >> 30 };
+            for (unsigned int i = 0; i < element.size && i < 4; ++i)
+            {
+                float value = (float)values[i];
+                dst[i] = element.normalized ? std::max(value / (i < 3 ? 511.0f : 1.0f), -1.0f) : value;
+            }
+        }
+        break;
+    default:
+        memcpy(dst, src, element.size * sizeof(float));
+        break;
+    }
+}
+
+void VertexFormat::pack(const Element& element, const float* src, void* dst)
+{
+    GP_ASSERT(src);
+    GP_ASSERT(dst);
+
+    switch (element.type)
+    {
+    case HALF_FLOAT:
+        for (unsigned int i = 0; i < element.size; ++i)
+            ((unsigned short*)dst)[i] = toHalf(src[i]);
+        break;
+    case BYTE:
+        for (unsigned int i = 0; i < element.size; ++i)
+        {
+            float value = element.normalized ? src[i] * 127.0f : src[i];
+            ((signed char*)dst)[i] = (signed char)floorf(std::min(std::max(value, -128.0f), 127.0f) + 0.5f);
+        }
+        break;
+    case UNSIGNED_BYTE:
+        for (unsigned int i = 0; i < element.size; ++i)
+        {
+            float value = element.normalized ? src[i] * 255.0f : src[i];
+            ((unsigned char*)dst)[i] = (unsigned char)floorf(std::min(std::max(value, 0.0f), 255.0f) + 0.5f);
+        }
+        break;
+    case SHORT:
+        for (unsigned int i = 0; i < element.size; ++i)
+        {
+            float value = element.normalized ? src[i] * 32767.0f : src[i];
+            ((short*)dst)[i] = (short)floorf(std::min(std::max(value, -32768.0f), 32767.0f) + 0.5f);
+        }
+        break;
+    case UNSIGNED_SHORT:
+        for (unsigned int i = 0; i < element.size; ++i)
+        {
+            float value = element.normalized ? src[i] * 65535.0f : src[i];
+            ((unsigned short*)dst)[i] = (unsigned short)floorf(std::min(std::max(value, 0.0f), 65535.0f) + 0.5f);
+        }
+        break;
+    case INT_2_10_10_10_REV:
+        {
+            unsigned int packed = 0;
+            for (unsigned int i = 0; i < element.size && i < 4; ++i)
+            {
+                float limit = i < 3 ? 511.0f : 1.0f;
+                float value = element.normalized ? src[i] * limit : src[i];
+                int bits = (int)floorf(std::min(std::max(value, -limit - 1.0f), limit) + 0.5f);
+                packed |= ((unsigned int)bits & (i < 3 ? 0x3FF : 0x3)) << (i * 10);
+            }
+            memcpy(dst, &packed, sizeof(unsigned int));
+        }
+        break;
+    default:
+        memcpy(dst, src, element.size * sizeof(float));
+        break;
+    }
+}
+
 }
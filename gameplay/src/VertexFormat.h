@@ -35,17 +35,34 @@ public:
         TEXCOORD7 = 15
     };
 
+    /**
+     * Defines the types of the values of vertex elements.
+     */
+    enum Type
+    {
+        FLOAT = 0x1406,                 // GL_FLOAT
+        HALF_FLOAT = 0x140B,            // GL_HALF_FLOAT
+        BYTE = 0x1400,                  // GL_BYTE
+        UNSIGNED_BYTE = 0x1401,         // GL_UNSIGNED_BYTE
+        SHORT = 0x1402,                 // GL_SHORT
+        UNSIGNED_SHORT = 0x1403,        // GL_UNSIGNED_SHORT
+        INT_2_10_10_10_REV = 0x8D9F     // GL_INT_2_10_10_10_REV
+    };
+
     /**
      * Defines a single element within a vertex format.
      *
-     * All vertex elements are assumed to be of type float, but can
-     * have a varying number of float values (1-4), which is represented
-     * by the size attribute. Additionally, vertex elements are assumed
-     * to be tightly packed.
+     * Vertex elements have a varying number of values (1-4), which is represented
+     * by the size attribute, of float type unless another type is given. Values of
+     * integer types are either normalized to the [0, 1] range (or [-1, 1] for signed
+     * types) or converted to float as they are when the vertex is read by a shader.
+     * An INT_2_10_10_10_REV element packs 4 normalized values into 32 bits and always
+     * has a size of 4. Vertex elements are assumed to be tightly packed.
      */
     class Element
     {
     public:
+
         /**
          * The vertex element usage semantic.
          */
@@ -56,6 +73,16 @@ public:
          */
         unsigned int size;
 
+        /**
+         * The type of the values in the vertex element.
+         */
+        Type type;
+
+        /**
+         * Whether values of integer types are normalized.
+         */
+        bool normalized;
+
         /**
          * Constructor.
          */
@@ -69,6 +96,23 @@ public:
          */
         Element(Usage usage, unsigned int size);
 
+        /**
+         * Constructor.
+         *
+         * @param usage The vertex element usage semantic.
+         * @param size The number of values in the vertex element.
+         * @param type The type of the values in the vertex element.
+         * @param normalized Whether values of integer types are normalized.
+         */
+        Element(Usage usage, unsigned int size, Type type, bool normalized);
+
+        /**
+         * Gets the size of the vertex element in bytes.
+         *
+         * @return The number of bytes of the values of the vertex element.
+         */
+        unsigned int getByteSize() const;
+
         /**
          * Compares two vertex elements for equality.
          *
@@ -145,6 +189,41 @@ public:
      */
     static const char* toString(Usage usage);
 
+    /**
+     * Returns a string representation of a Type enumeration value.
+     */
+    static const char* toString(Type type);
+
+    /**
+     * Determines if vertex elements of the given type can be drawn on this platform.
+     *
+     * Half floats need OpenGL 3 or the GL_OES_vertex_half_float extension on OpenGL ES,
+     * and INT_2_10_10_10_REV elements need OpenGL 3.3. The other types are always supported.
+     *
+     * @param type The type of the values of vertex elements.
+     *
+     * @return true if the type is supported, false otherwise.
+     */
+    static bool isTypeSupported(Type type);
+
+    /**
+     * Reads the values of a vertex element as floats.
+     *
+     * @param element The vertex element.
+     * @param src The values of the vertex element, in its type.
+     * @param dst Filled with the element.size values of the vertex element.
+     */
+    static void unpack(const Element& element, const void* src, float* dst);
+
+    /**
+     * Writes float values into a vertex element, in its type.
+     *
+     * @param element The vertex element.
+     * @param src The element.size values of the vertex element.
+     * @param dst Filled with element.getByteSize() bytes.
+     */
+    static void pack(const Element& element, const float* src, void* dst);
+
 private:
 
     std::vector<Element> _elements;
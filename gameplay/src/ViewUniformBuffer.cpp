@@ -0,0 +1,125 @@
+#include "Base.h"
+#include "ViewUniformBuffer.h"
+#include "Camera.h"
+#include "Node.h"
+#include "Scene.h"
+#include "FrameCapture.h"
+
+// The name of the uniform block declared by res/shaders/view-uniforms.glsl.
+#define VIEW_UNIFORM_BLOCK_NAME "ViewUniforms"
+
+namespace gameplay
+{
+
+// The std140 layout of the ViewUniforms block.
+struct ViewUniformData
+{
+    float viewMatrix[16];
+    float projectionMatrix[16];
+    float viewProjectionMatrix[16];
+    float cameraWorldPosition[4];
+    float ambientColor[4];
+};
+
+// The values the buffer holds, to skip the uploads that would not change them.
+static ViewUniformData __data;
+
+GLuint ViewUniformBuffer::_buffer = 0;
+bool ViewUniformBuffer::_valid = false;
+
+bool ViewUniformBuffer::isSupported()
+{
+#ifdef GP_USE_UNIFORM_BUFFERS
+    return glBindBufferBase && glGetUniformBlockIndex && glUniformBlockBinding;
+#else
+    return false;
+#endif
+}
+
+void ViewUniformBuffer::update(Camera* camera, Scene* scene)
+{
+#ifdef GP_USE_UNIFORM_BUFFERS
+    if (!isSupported())
+        return;
+
+    ViewUniformData data;
+    memset(&data, 0, sizeof(data));
+    const Matrix& viewMatrix = camera ? camera->getViewMatrix() : Matrix::identity();
+    const Matrix& projectionMatrix = camera ? camera->getProjectionMatrix() : Matrix::identity();
+    const Matrix& viewProjectionMatrix = camera ? camera->getViewProjectionMatrix() : Matrix::identity();
+    memcpy(data.viewMatrix, viewMatrix.m, sizeof(data.viewMatrix));
+    memcpy(data.projectionMatrix, projectionMatrix.m, sizeof(data.projectionMatrix));
+    memcpy(data.viewProjectionMatrix, viewProjectionMatrix.m, sizeof(data.viewProjectionMatrix));
+    if (camera && camera->getNode())
+    {
+        Vector3 position = camera->getNode()->getTranslationWorld();
+        data.cameraWorldPosition[0] = position.x;
+        data.cameraWorldPosition[1] = position.y;
+        data.cameraWorldPosition[2] = position.z;
+    }
+    if (scene)
+    {
+        const Vector3& ambientColor = scene->getAmbientColor();
+        data.ambientColor[0] = ambientColor.x;
+        data.ambientColor[1] = ambientColor.y;
+        data.ambientColor[2] = ambientColor.z;
+    }
+    if (_valid && memcmp(&data, &__data, sizeof(data)) == 0)
+        return;
+
+    if (_buffer == 0)
+    {
+        GL_ASSERT( glGenBuffers(1, &_buffer) );
+        GL_ASSERT( glBindBuffer(GL_UNIFORM_BUFFER, _buffer) );
+        GL_ASSERT( glBufferData(GL_UNIFORM_BUFFER, sizeof(data), &data, GL_DYNAMIC_DRAW) );
+        GL_ASSERT( glBindBufferBase(GL_UNIFORM_BUFFER, BINDING, _buffer) );
+    }
+    else
+    {
+        GL_ASSERT( glBindBuffer(GL_UNIFORM_BUFFER, _buffer) );
+        GL_ASSERT( glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(data), &data) );
+    }
+    FrameCapture::record(FrameCapture::UPLOAD_BUFFER, GL_UNIFORM_BUFFER, _buffer, 0, sizeof(data));
+
+    __data = data;
+    _valid = true;
+#endif
+}
+
+void ViewUniformBuffer::bind(Node* node)
+{
+    if (node == NULL)
+        return;
+
+    Scene* scene = node->getScene();
+    update(scene ? scene->getActiveCamera() : NULL, scene);
+}
+
+void ViewUniformBuffer::attach(GLuint program)
+{
+#ifdef GP_USE_UNIFORM_BUFFERS
+    if (!isSupported())
+        return;
+
+    GLuint index;
+    GL_ASSERT( index = glGetUniformBlockIndex(program, VIEW_UNIFORM_BLOCK_NAME) );
+    if (index != GL_INVALID_INDEX)
+    {
+        GL_ASSERT( glUniformBlockBinding(program, index, BINDING) );
+    }
+#endif
+}
+
+void ViewUniformBuffer::finalize()
+{
+#ifdef GP_USE_UNIFORM_BUFFERS
+    if (_buffer)
+    {
+        GL_ASSERT( glDeleteBuffers(1, &_buffer) );
+        _buffer = 0;
+    }
+#endif
+    _valid = false;
+}
+
+}
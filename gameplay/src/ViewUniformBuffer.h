@@ -0,0 +1,89 @@
+#ifndef VIEWUNIFORMBUFFER_H_
+#define VIEWUNIFORMBUFFER_H_
+
+namespace gameplay
+{
+
+class Camera;
+class Node;
+class Scene;
+
+/**
+ * Defines the uniform buffer that holds the per-view values shared by every effect.
+ *
+ * Without uniform buffers, every material resolves the VIEW_MATRIX, PROJECTION_MATRIX,
+ * VIEW_PROJECTION_MATRIX, CAMERA_WORLD_POSITION and SCENE_AMBIENT_COLOR auto bindings
+ * itself and uploads them to its program with glUniform. Where uniform buffers are
+ * supported, shaders are instead compiled with UNIFORM_BUFFERS defined, and the
+ * "view-uniforms.glsl" shader include declares u_viewMatrix, u_projectionMatrix,
+ * u_viewProjectionMatrix, u_cameraWorldPosition and u_sceneAmbientColor in a ViewUniforms
+ * uniform block. The block of every effect is bound to this buffer, which is only
+ * uploaded again when the view changes. The u_ambientColor of the built-in shaders is
+ * not part of the block, since materials may set it to a constant.
+ *
+ * When a render state is bound for a node, the buffer is given the values of the active
+ * camera and scene of that node, and is only uploaded if they differ from the values it
+ * already holds, such as when the camera has moved or the ambient color has changed.
+ *
+ * Materials can declare the auto bindings either way, which keeps them working on
+ * platforms without uniform buffers, such as OpenGL ES 2.
+ *
+ * @script{ignore}
+ */
+class ViewUniformBuffer
+{
+    friend class Game;
+    friend class Effect;
+    friend class RenderState;
+
+public:
+
+    /**
+     * The uniform buffer binding point that the ViewUniforms block of every effect is bound to.
+     */
+    static const unsigned int BINDING = 0;
+
+    /**
+     * Determines if uniform buffers are supported, in which case shaders are compiled with UNIFORM_BUFFERS defined.
+     *
+     * @return true if uniform buffers are supported.
+     */
+    static bool isSupported();
+
+    /**
+     * Updates the buffer with the values of a camera and scene, if they differ from the values it holds.
+     *
+     * @param camera The camera to update the view and projection values from, or NULL for identity matrices.
+     * @param scene The scene to update the ambient color from, or NULL for black.
+     */
+    static void update(Camera* camera, Scene* scene);
+
+private:
+
+    /**
+     * Hidden constructor.
+     */
+    ViewUniformBuffer();
+
+    /**
+     * Makes the buffer hold the values of the active camera and scene of a node, for a render state bound for it.
+     */
+    static void bind(Node* node);
+
+    /**
+     * Binds the ViewUniforms block of a program, if it has one, to the buffer.
+     */
+    static void attach(GLuint program);
+
+    /**
+     * Deletes the buffer. Called during game shutdown.
+     */
+    static void finalize();
+
+    static GLuint _buffer;
+    static bool _valid;
+};
+
+}
+
+#endif
@@ -0,0 +1,325 @@
+#include "Base.h"
+#include "WorldStreamer.h"
+#include "Camera.h"
+#include "MeshPart.h"
+#include "Model.h"
+#include "Node.h"
+#include "Properties.h"
+#include "Scene.h"
+
+// The default distance from the focus within which cells are loaded.
+#define WORLD_LOAD_RADIUS 200.0f
+
+// The default distance between the load radius and the radius beyond which cells are unloaded.
+#define WORLD_UNLOAD_MARGIN 50.0f
+
+// The default maximum number of cells loading at once.
+#define WORLD_MAX_PENDING_LOADS 2
+
+namespace gameplay
+{
+
+/**
+ * Gets the size of the vertex and index data of the models of a node and its children.
+ */
+static size_t getMemorySize(Node* node)
+{
+    size_t size = 0;
+    Model* model = dynamic_cast<Model*>(node->getDrawable());
+    if (model && model->getMesh())
+    {
+        Mesh* mesh = model->getMesh();
+        size += (size_t)mesh->getVertexCount() * mesh->getVertexSize();
+        for (unsigned int i = 0, count = mesh->getPartCount(); i < count; ++i)
+        {
+            MeshPart* part = mesh->getPart(i);
+            size_t indexSize = part->getIndexFormat() == Mesh::INDEX8 ? 1 : (part->getIndexFormat() == Mesh::INDEX16 ? 2 : 4);
+            size += (size_t)part->getIndexCount() * indexSize;
+        }
+    }
+    for (Node* child = node->getFirstChild(); child; child = child->getNextSibling())
+    {
+        size += getMemorySize(child);
+    }
+    return size;
+}
+
+WorldStreamer::WorldStreamer(Scene* scene)
+    : _scene(scene), _focus(NULL), _loadRadius(WORLD_LOAD_RADIUS), _unloadRadius(WORLD_LOAD_RADIUS + WORLD_UNLOAD_MARGIN),
+      _memoryBudget(0), _memoryUsage(0), _maxPendingLoads(WORLD_MAX_PENDING_LOADS), _pendingLoads(0)
+{
+    GP_ASSERT(_scene);
+    _scene->addRef();
+}
+
+WorldStreamer::~WorldStreamer()
+{
+    // Pending loads hold a reference to the streamer, so every cell is unloaded or loaded here.
+    for (size_t i = 0, count = _cells.size(); i < count; ++i)
+    {
+        unloadCell(_cells[i]);
+        SAFE_DELETE(_cells[i]);
+    }
+    SAFE_RELEASE(_focus);
+    SAFE_RELEASE(_scene);
+}
+
+WorldStreamer* WorldStreamer::create(Scene* scene)
+{
+    return new WorldStreamer(scene);
+}
+
+WorldStreamer* WorldStreamer::create(Scene* scene, const char* url)
+{
+    Properties* properties = Properties::create(url);
+    if (properties == NULL)
+    {
+        GP_WARN("Failed to load world file '%s'.", url);
+        return NULL;
+    }
+    Properties* world = (strlen(properties->getNamespace()) > 0) ? properties : properties->getNextNamespace();
+    if (!world || strcmp(world->getNamespace(), "world") != 0)
+    {
+        GP_WARN("Failed to load world from '%s': the namespace must be 'world'.", url);
+        SAFE_DELETE(properties);
+        return NULL;
+    }
+
+    WorldStreamer* streamer = new WorldStreamer(scene);
+    if (world->exists("loadRadius"))
+        streamer->_loadRadius = world->getFloat("loadRadius");
+    streamer->setUnloadRadius(world->exists("unloadRadius") ? world->getFloat("unloadRadius") : streamer->_loadRadius + WORLD_UNLOAD_MARGIN);
+    if (world->exists("memoryBudget"))
+        streamer->_memoryBudget = (size_t)world->getInt("memoryBudget") * 1024;
+    if (world->exists("maxPendingLoads"))
+        streamer->setMaxPendingLoads((unsigned int)world->getInt("maxPendingLoads"));
+
+    world->rewind();
+    Properties* cell;
+    while ((cell = world->getNextNamespace()) != NULL)
+    {
+        if (strcmp(cell->getNamespace(), "cell") != 0)
+            continue;
+        std::string path;
+        Vector3 center;
+        if (!cell->getPath("path", &path))
+        {
+            GP_WARN("Cell without a path in world file '%s'.", url);
+            continue;
+        }
+        cell->getVector3("center", &center);
+        streamer->addCell(path.c_str(), center, cell->getFloat("radius"));
+    }
+
+    SAFE_DELETE(properties);
+    return streamer;
+}
+
+unsigned int WorldStreamer::addCell(const char* path, const Vector3& center, float radius)
+{
+    GP_ASSERT(path);
+
+    Cell* cell = new Cell();
+    cell->path = path;
+    cell->center = center;
+    cell->radius = radius;
+    cell->state = CELL_UNLOADED;
+    cell->memory = 0;
+    cell->distance = 0.0f;
+    _cells.push_back(cell);
+    return (unsigned int)_cells.size() - 1;
+}
+
+unsigned int WorldStreamer::getCellCount() const
+{
+    return (unsigned int)_cells.size();
+}
+
+WorldStreamer::CellState WorldStreamer::getCellState(unsigned int index) const
+{
+    GP_ASSERT(index < _cells.size());
+    return _cells[index]->state;
+}
+
+void WorldStreamer::setFocus(Node* node)
+{
+    if (_focus != node)
+    {
+        SAFE_RELEASE(_focus);
+        _focus = node;
+        if (_focus)
+            _focus->addRef();
+    }
+}
+
+Node* WorldStreamer::getFocus() const
+{
+    return _focus;
+}
+
+void WorldStreamer::setLoadRadius(float radius)
+{
+    _loadRadius = radius;
+    _unloadRadius = std::max(_unloadRadius, _loadRadius);
+}
+
+float WorldStreamer::getLoadRadius() const
+{
+    return _loadRadius;
+}
+
+void WorldStreamer::setUnloadRadius(float radius)
+{
+    _unloadRadius = std::max(radius, _loadRadius);
+}
+
+float WorldStreamer::getUnloadRadius() const
+{
+    return _unloadRadius;
+}
+
+void WorldStreamer::setMemoryBudget(size_t budget)
+{
+    _memoryBudget = budget;
+}
+
+size_t WorldStreamer::getMemoryBudget() const
+{
+    return _memoryBudget;
+}
+
+size_t WorldStreamer::getMemoryUsage() const
+{
+    return _memoryUsage;
+}
+
+void WorldStreamer::setMaxPendingLoads(unsigned int count)
+{
+    _maxPendingLoads = std::max(count, 1u);
+}
+
+unsigned int WorldStreamer::getMaxPendingLoads() const
+{
+    return _maxPendingLoads;
+}
+
+void WorldStreamer::update()
+{
+    // Find the focus, which is the active camera unless one was set.
+    Node* focus = _focus;
+    if (!focus)
+    {
+        Camera* camera = _scene->getActiveCamera();
+        focus = camera ? camera->getNode() : NULL;
+        if (!focus)
+            return;
+    }
+    Vector3 position = focus->getTranslationWorld();
+
+    // Unload the cells that left the unload radius, and collect the cells to load.
+    std::vector<Cell*> loads;
+    std::vector<Cell*> loaded;
+    for (size_t i = 0, count = _cells.size(); i < count; ++i)
+    {
+        Cell* cell = _cells[i];
+        cell->distance = std::max(position.distance(cell->center) - cell->radius, 0.0f);
+        if (cell->state == CELL_LOADED)
+        {
+            if (cell->distance > _unloadRadius)
+                unloadCell(cell);
+            else
+                loaded.push_back(cell);
+        }
+        else if (cell->state == CELL_UNLOADED && cell->distance <= _loadRadius)
+        {
+            loads.push_back(cell);
+        }
+    }
+
+    // Load the nearest cells first.
+    std::sort(loads.begin(), loads.end(), [](const Cell* a, const Cell* b) { return a->distance < b->distance; });
+    std::sort(loaded.begin(), loaded.end(), [](const Cell* a, const Cell* b) { return a->distance > b->distance; });
+    for (size_t i = 0, count = loads.size(); i < count && _pendingLoads < _maxPendingLoads; ++i)
+    {
+        // Make room in the budget by unloading the farthest cells outside of the load radius. The size of
+        // a cell is only known once it has been loaded, so a cell that was never loaded is counted as empty.
+        Cell* cell = loads[i];
+        if (_memoryBudget > 0)
+        {
+            while (_memoryUsage + cell->memory > _memoryBudget && !loaded.empty() && loaded.front()->distance > _loadRadius)
+            {
+                unloadCell(loaded.front());
+                loaded.erase(loaded.begin());
+            }
+            if (_memoryUsage + cell->memory > _memoryBudget || (_memoryUsage >= _memoryBudget && cell->memory == 0))
+                break;
+        }
+        loadCell(cell);
+    }
+}
+
+void WorldStreamer::loadCell(Cell* cell)
+{
+    GP_ASSERT(cell && cell->state == CELL_UNLOADED);
+
+    // The load holds a reference to the streamer so that it outlives the callback.
+    cell->state = CELL_LOADING;
+    ++_pendingLoads;
+    addRef();
+    Scene::loadAsync(cell->path.c_str(), [this, cell](Scene* scene)
+    {
+        --_pendingLoads;
+        completeCell(cell, scene);
+        release();
+    });
+}
+
+void WorldStreamer::completeCell(Cell* cell, Scene* scene)
+{
+    GP_ASSERT(cell && cell->state == CELL_LOADING);
+
+    cell->state = CELL_UNLOADED;
+    if (!scene)
+    {
+        GP_WARN("Failed to load world cell '%s'.", cell->path.c_str());
+        return;
+    }
+
+    // Discard the cell if the focus moved away from it while it was loading, or if the streamer is being released.
+    if (cell->distance <= _unloadRadius && getRefCount() > 1)
+    {
+        cell->memory = 0;
+        Node* node = scene->getFirstNode();
+        while (node)
+        {
+            Node* next = node->getNextSibling();
+            node->addRef();
+            scene->removeNode(node);
+            _scene->addNode(node);
+            cell->nodes.push_back(node);
+            cell->memory += getMemorySize(node);
+            node = next;
+        }
+        cell->state = CELL_LOADED;
+        _memoryUsage += cell->memory;
+    }
+    SAFE_RELEASE(scene);
+}
+
+void WorldStreamer::unloadCell(Cell* cell)
+{
+    GP_ASSERT(cell);
+
+    if (cell->state != CELL_LOADED)
+        return;
+    for (size_t i = 0, count = cell->nodes.size(); i < count; ++i)
+    {
+        _scene->removeNode(cell->nodes[i]);
+        SAFE_RELEASE(cell->nodes[i]);
+    }
+    cell->nodes.clear();
+    _memoryUsage -= cell->memory;
+    cell->state = CELL_UNLOADED;
+}
+
+}
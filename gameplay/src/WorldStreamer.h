@@ -0,0 +1,251 @@
+#ifndef WORLDSTREAMER_H_
+#define WORLDSTREAMER_H_
+
+#include "Ref.h"
+#include "Vector3.h"
+
+namespace gameplay
+{
+
+class Node;
+class Scene;
+
+/**
+ * Defines a streamer that loads the cells of a large world around the camera.
+ *
+ * A world is partitioned into cells, each a '.gpb' or '.scene' file containing the nodes
+ * of one region and bounded by a sphere. The streamer loads the cells whose bounds come
+ * within the load radius of the focus (the active camera of the scene by default) with
+ * Scene::loadAsync(), and moves the root nodes of each loaded cell into the world scene.
+ * Cells whose bounds leave the unload radius, which should be larger than the load radius
+ * so that cells on the edge are not loaded and unloaded repeatedly, are removed from the
+ * scene and released.
+ *
+ * The size of the vertex and index data of each loaded cell is counted against a memory
+ * budget. While the budget is exceeded, loaded cells beyond the load radius are unloaded
+ * farthest first, and no more cells are loaded until there is room.
+ *
+ * Cells can be added with addCell(), or read from a properties file:
+ *
+ * @code
+ * world
+ * {
+ *     loadRadius = 200
+ *     unloadRadius = 250
+ *     memoryBudget = 262144       // In kilobytes
+ *
+ *     cell
+ *     {
+ *         path = res/world/cell_0_0.gpb
+ *         center = 50, 0, 50
+ *         radius = 75
+ *     }
+ * }
+ * @endcode
+ *
+ * @script{ignore}
+ */
+class WorldStreamer : public Ref
+{
+public:
+
+    /**
+     * The loading state of a cell.
+     */
+    enum CellState
+    {
+        CELL_UNLOADED,
+        CELL_LOADING,
+        CELL_LOADED
+    };
+
+    /**
+     * Creates a streamer without any cells.
+     *
+     * @param scene The world scene that the nodes of loaded cells are added to.
+     *
+     * @return The new streamer.
+     */
+    static WorldStreamer* create(Scene* scene);
+
+    /**
+     * Creates a streamer from the 'world' namespace of a properties file.
+     *
+     * @param scene The world scene that the nodes of loaded cells are added to.
+     * @param url The URL of the properties file.
+     *
+     * @return The new streamer, or NULL if the file could not be read.
+     */
+    static WorldStreamer* create(Scene* scene, const char* url);
+
+    /**
+     * Adds a cell to the world.
+     *
+     * @param path The path of the '.gpb' or '.scene' file of the cell.
+     * @param center The center of the bounds of the cell.
+     * @param radius The radius of the bounds of the cell.
+     *
+     * @return The index of the cell.
+     */
+    unsigned int addCell(const char* path, const Vector3& center, float radius);
+
+    /**
+     * Gets the number of cells in the world.
+     *
+     * @return The number of cells.
+     */
+    unsigned int getCellCount() const;
+
+    /**
+     * Gets the loading state of a cell.
+     *
+     * @param index The index of the cell.
+     *
+     * @return The state of the cell.
+     */
+    CellState getCellState(unsigned int index) const;
+
+    /**
+     * Sets the node that cells are loaded around.
+     *
+     * @param node The node, or NULL to load cells around the active camera of the scene.
+     */
+    void setFocus(Node* node);
+
+    /**
+     * Gets the node that cells are loaded around.
+     *
+     * @return The node, or NULL if cells are loaded around the active camera of the scene.
+     */
+    Node* getFocus() const;
+
+    /**
+     * Sets the distance from the focus within which cells are loaded.
+     *
+     * @param radius The load radius.
+     */
+    void setLoadRadius(float radius);
+
+    /**
+     * Gets the distance from the focus within which cells are loaded.
+     *
+     * @return The load radius.
+     */
+    float getLoadRadius() const;
+
+    /**
+     * Sets the distance from the focus beyond which cells are unloaded.
+     *
+     * @param radius The unload radius, which is at least the load radius.
+     */
+    void setUnloadRadius(float radius);
+
+    /**
+     * Gets the distance from the focus beyond which cells are unloaded.
+     *
+     * @return The unload radius.
+     */
+    float getUnloadRadius() const;
+
+    /**
+     * Sets the memory budget of the loaded cells.
+     *
+     * @param budget The budget for the vertex and index data of the loaded cells, in bytes, or zero for no budget.
+     */
+    void setMemoryBudget(size_t budget);
+
+    /**
+     * Gets the memory budget of the loaded cells.
+     *
+     * @return The memory budget, in bytes.
+     */
+    size_t getMemoryBudget() const;
+
+    /**
+     * Gets the size of the vertex and index data of the loaded cells.
+     *
+     * @return The memory used by the loaded cells, in bytes.
+     */
+    size_t getMemoryUsage() const;
+
+    /**
+     * Sets the maximum number of cells loading at once.
+     *
+     * @param count The maximum number of cells loading at once, which is at least one.
+     */
+    void setMaxPendingLoads(unsigned int count);
+
+    /**
+     * Gets the maximum number of cells loading at once.
+     *
+     * @return The maximum number of cells loading at once.
+     */
+    unsigned int getMaxPendingLoads() const;
+
+    /**
+     * Loads and unloads cells around the focus. This should be called once per frame.
+     */
+    void update();
+
+private:
+
+    struct Cell
+    {
+        std::string path;
+        Vector3 center;
+        float radius;
+        CellState state;
+        std::vector<Node*> nodes;   // The root nodes of the cell, while it is loaded
+        size_t memory;              // The size of the vertex and index data of the cell, as of the last time it was loaded
+        float distance;             // The distance from the focus to the bounds of the cell, as of the last update
+    };
+
+    /**
+     * Constructor.
+     */
+    WorldStreamer(Scene* scene);
+
+    /**
+     * Destructor.
+     */
+    ~WorldStreamer();
+
+    /**
+     * Hidden copy constructor.
+     */
+    WorldStreamer(const WorldStreamer&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    WorldStreamer& operator=(const WorldStreamer&);
+
+    /**
+     * Starts loading a cell.
+     */
+    void loadCell(Cell* cell);
+
+    /**
+     * Moves the root nodes of a loaded cell scene into the world scene.
+     */
+    void completeCell(Cell* cell, Scene* scene);
+
+    /**
+     * Removes the nodes of a cell from the world scene and releases them.
+     */
+    void unloadCell(Cell* cell);
+
+    Scene* _scene;
+    Node* _focus;
+    std::vector<Cell*> _cells;
+    float _loadRadius;
+    float _unloadRadius;
+    size_t _memoryBudget;
+    size_t _memoryUsage;
+    unsigned int _maxPendingLoads;
+    unsigned int _pendingLoads;
+};
+
+}
+
+#endif
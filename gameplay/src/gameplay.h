@@ -7,10 +7,20 @@
 #include "Touch.h"
 #include "Gesture.h"
 #include "Gamepad.h"
+#include "InputRecorder.h"
 #include "FileSystem.h"
 #include "Bundle.h"
 #include "MathUtil.h"
 #include "Logger.h"
+#include "JobSystem.h"
+#include "MemoryArena.h"
+#include "ObjectPool.h"
+#include "FrameStats.h"
+#include "FrameCapture.h"
+#include "ResourceStats.h"
+#include "GLStateCache.h"
+#include "ViewUniformBuffer.h"
+#include "JointTexture.h"
 
 // Math
 #include "Rectangle.h"
@@ -25,38 +35,65 @@
 #include "Frustum.h"
 #include "BoundingSphere.h"
 #include "BoundingBox.h"
+#include "BoundingVolumeTree.h"
 #include "Curve.h"
 
 // Graphics
 #include "Image.h"
 #include "Texture.h"
+#include "TextureAtlas.h"
 #include "Mesh.h"
 #include "MeshPart.h"
+#include "MeshBufferPool.h"
 #include "Effect.h"
 #include "Material.h"
+#include "MaterialParameterBlock.h"
 #include "RenderState.h"
+#include "RenderQueue.h"
+#include "OcclusionCuller.h"
 #include "VertexFormat.h"
 #include "VertexAttributeBinding.h"
+#include "DynamicBuffer.h"
 #include "Drawable.h"
 #include "Model.h"
 #include "Camera.h"
 #include "Light.h"
+#include "ClusteredLighting.h"
+#include "ShadowMap.h"
 #include "Node.h"
 #include "Joint.h"
 #include "Scene.h"
+#include "Prefab.h"
+#include "SceneSnapshot.h"
+#include "WorldStreamer.h"
 #include "Font.h"
 #include "SpriteBatch.h"
 #include "Sprite.h"
 #include "Text.h"
 #include "TileSet.h"
 #include "ParticleEmitter.h"
+#include "ParticleSimulator.h"
+#include "ParticleRenderer.h"
+#include "ParticleEmitterPool.h"
+#include "ParticleSystem.h"
+#include "PerformanceHud.h"
+#include "PerformanceGovernor.h"
 #include "FrameBuffer.h"
 #include "RenderTarget.h"
 #include "DepthStencilTarget.h"
+#include "RenderTargetPool.h"
+#include "ResourceManager.h"
+#include "DynamicResolution.h"
+#include "FramePacer.h"
+#include "RenderThread.h"
+#include "UploadThread.h"
 #include "ScreenDisplayer.h"
 #include "HeightField.h"
 #include "Terrain.h"
+#include "StreamingTerrain.h"
+#include "StringTable.h"
 #include "TerrainPatch.h"
+#include "TerrainFoliage.h"
 
 // Audio
 #include "AudioController.h"
@@ -70,6 +107,8 @@
 #include "AnimationValue.h"
 #include "Animation.h"
 #include "AnimationClip.h"
+#include "AnimationPose.h"
+#include "AnimationTexture.h"
 
 // Physics
 #include "PhysicsController.h"
@@ -92,6 +131,7 @@
 #include "AIAgent.h"
 #include "AIState.h"
 #include "AIStateMachine.h"
+#include "NavigationMesh.h"
 
 // UI
 #include "Theme.h"
@@ -107,6 +147,8 @@
 #include "Slider.h"
 #include "ImageControl.h"
 #include "JoystickControl.h"
+#include "ListView.h"
+#include "LoadingScreen.h"
 #include "Layout.h"
 #include "AbsoluteLayout.h"
 #include "VerticalLayout.h"
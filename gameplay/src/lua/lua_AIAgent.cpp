@@ -14,24 +14,33 @@ namespace gameplay
 
 extern void luaGlobal_Register_Conversion_Function(const char* className, void*(*func)(void*, const char*));
 
+extern int lua_Ref_addRef(lua_State* state);
+extern int lua_Ref_getRefCount(lua_State* state);
+extern int lua_Ref_release(lua_State* state);
+
 static AIAgent* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "AIAgent");
-    luaL_argcheck(state, userdata != NULL, 1, "'AIAgent' expected.");
-    return (AIAgent*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "AIAgent");
+    luaL_argcheck(state, instance != NULL, 1, "'AIAgent' expected.");
+    return (AIAgent*)instance;
 }
 
-static int lua_AIAgent__gc(lua_State* state)
+int lua_AIAgent__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "AIAgent");
                 luaL_argcheck(state, userdata != NULL, 1, "'AIAgent' expected.");
@@ -59,49 +68,22 @@ static int lua_AIAgent__gc(lua_State* state)
     return 0;
 }
 
-static int lua_AIAgent_addRef(lua_State* state)
+int lua_AIAgent_getId(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AIAgent* instance = getInstance(state);
-                instance->addRef();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_AIAgent_addRef - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AIAgent_getId(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AIAgent* instance = getInstance(state);
                 const char* result = instance->getId();
@@ -126,17 +108,22 @@ static int lua_AIAgent_getId(lua_State* state)
     return 0;
 }
 
-static int lua_AIAgent_getNode(lua_State* state)
+int lua_AIAgent_getNode(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AIAgent* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getNode());
@@ -170,52 +157,22 @@ static int lua_AIAgent_getNode(lua_State* state)
     return 0;
 }
 
-static int lua_AIAgent_getRefCount(lua_State* state)
+int lua_AIAgent_getStateMachine(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AIAgent* instance = getInstance(state);
-                unsigned int result = instance->getRefCount();
-
-                // Push the return value onto the stack.
-                lua_pushunsigned(state, result);
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_AIAgent_getRefCount - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AIAgent_getStateMachine(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AIAgent* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getStateMachine());
@@ -249,17 +206,22 @@ static int lua_AIAgent_getStateMachine(lua_State* state)
     return 0;
 }
 
-static int lua_AIAgent_isEnabled(lua_State* state)
+int lua_AIAgent_isEnabled(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AIAgent* instance = getInstance(state);
                 bool result = instance->isEnabled();
@@ -284,50 +246,23 @@ static int lua_AIAgent_isEnabled(lua_State* state)
     return 0;
 }
 
-static int lua_AIAgent_release(lua_State* state)
+int lua_AIAgent_setEnabled(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AIAgent* instance = getInstance(state);
-                instance->release();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_AIAgent_release - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AIAgent_setEnabled(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TBOOLEAN)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TBOOLEAN)
             {
                 // Get parameter 1 off the stack.
                 bool param1 = gameplay::ScriptUtil::luaCheckBool(state, 2);
@@ -352,18 +287,23 @@ static int lua_AIAgent_setEnabled(lua_State* state)
     return 0;
 }
 
-static int lua_AIAgent_setListener(lua_State* state)
+int lua_AIAgent_setListener(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -394,7 +334,7 @@ static int lua_AIAgent_setListener(lua_State* state)
     return 0;
 }
 
-static int lua_AIAgent_static_create(lua_State* state)
+int lua_AIAgent_static_create(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -479,15 +419,15 @@ void luaRegister_AIAgent()
 {
     const luaL_Reg lua_members[] = 
     {
-        {"addRef", lua_AIAgent_addRef},
         {"getId", lua_AIAgent_getId},
         {"getNode", lua_AIAgent_getNode},
-        {"getRefCount", lua_AIAgent_getRefCount},
         {"getStateMachine", lua_AIAgent_getStateMachine},
         {"isEnabled", lua_AIAgent_isEnabled},
-        {"release", lua_AIAgent_release},
         {"setEnabled", lua_AIAgent_setEnabled},
         {"setListener", lua_AIAgent_setListener},
+        {"addRef", lua_Ref_addRef},
+        {"getRefCount", lua_Ref_getRefCount},
+        {"release", lua_Ref_release},
         {"to", lua_AIAgent_to},
         {NULL, NULL}
     };
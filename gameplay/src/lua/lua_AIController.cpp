@@ -11,23 +11,28 @@ namespace gameplay
 
 static AIController* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "AIController");
-    luaL_argcheck(state, userdata != NULL, 1, "'AIController' expected.");
-    return (AIController*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "AIController");
+    luaL_argcheck(state, instance != NULL, 1, "'AIController' expected.");
+    return (AIController*)instance;
 }
 
-static int lua_AIController_findAgent(lua_State* state)
+int lua_AIController_findAgent(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -64,18 +69,23 @@ static int lua_AIController_findAgent(lua_State* state)
     return 0;
 }
 
-static int lua_AIController_sendMessage(lua_State* state)
+int lua_AIController_sendMessage(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -98,9 +108,9 @@ static int lua_AIController_sendMessage(lua_State* state)
         }
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL) &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
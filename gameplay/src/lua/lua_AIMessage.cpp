@@ -10,23 +10,28 @@ namespace gameplay
 
 static AIMessage* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "AIMessage");
-    luaL_argcheck(state, userdata != NULL, 1, "'AIMessage' expected.");
-    return (AIMessage*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "AIMessage");
+    luaL_argcheck(state, instance != NULL, 1, "'AIMessage' expected.");
+    return (AIMessage*)instance;
 }
 
-static int lua_AIMessage_getBoolean(lua_State* state)
+int lua_AIMessage_getBoolean(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -54,18 +59,23 @@ static int lua_AIMessage_getBoolean(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_getDouble(lua_State* state)
+int lua_AIMessage_getDouble(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -93,18 +103,23 @@ static int lua_AIMessage_getDouble(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_getFloat(lua_State* state)
+int lua_AIMessage_getFloat(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -132,17 +147,22 @@ static int lua_AIMessage_getFloat(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_getId(lua_State* state)
+int lua_AIMessage_getId(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AIMessage* instance = getInstance(state);
                 unsigned int result = instance->getId();
@@ -167,18 +187,23 @@ static int lua_AIMessage_getId(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_getInt(lua_State* state)
+int lua_AIMessage_getInt(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -206,18 +231,23 @@ static int lua_AIMessage_getInt(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_getLong(lua_State* state)
+int lua_AIMessage_getLong(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -245,17 +275,22 @@ static int lua_AIMessage_getLong(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_getParameterCount(lua_State* state)
+int lua_AIMessage_getParameterCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AIMessage* instance = getInstance(state);
                 unsigned int result = instance->getParameterCount();
@@ -280,18 +315,23 @@ static int lua_AIMessage_getParameterCount(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_getParameterType(lua_State* state)
+int lua_AIMessage_getParameterType(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -319,17 +359,22 @@ static int lua_AIMessage_getParameterType(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_getReceiver(lua_State* state)
+int lua_AIMessage_getReceiver(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AIMessage* instance = getInstance(state);
                 const char* result = instance->getReceiver();
@@ -354,17 +399,22 @@ static int lua_AIMessage_getReceiver(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_getSender(lua_State* state)
+int lua_AIMessage_getSender(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AIMessage* instance = getInstance(state);
                 const char* result = instance->getSender();
@@ -389,18 +439,23 @@ static int lua_AIMessage_getSender(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_getString(lua_State* state)
+int lua_AIMessage_getString(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -428,19 +483,24 @@ static int lua_AIMessage_getString(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_setBoolean(lua_State* state)
+int lua_AIMessage_setBoolean(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TBOOLEAN)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TBOOLEAN)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -468,19 +528,24 @@ static int lua_AIMessage_setBoolean(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_setDouble(lua_State* state)
+int lua_AIMessage_setDouble(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -508,19 +573,24 @@ static int lua_AIMessage_setDouble(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_setFloat(lua_State* state)
+int lua_AIMessage_setFloat(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -548,19 +618,24 @@ static int lua_AIMessage_setFloat(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_setInt(lua_State* state)
+int lua_AIMessage_setInt(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -588,19 +663,24 @@ static int lua_AIMessage_setInt(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_setLong(lua_State* state)
+int lua_AIMessage_setLong(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -628,19 +708,24 @@ static int lua_AIMessage_setLong(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_setString(lua_State* state)
+int lua_AIMessage_setString(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                (lua_type(state, 3) == LUA_TSTRING || lua_type(state, 3) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                (paramTypes[2] == LUA_TSTRING || paramTypes[2] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -668,20 +753,25 @@ static int lua_AIMessage_setString(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_static_create(lua_State* state)
+int lua_AIMessage_static_create(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 4:
         {
-            if (lua_type(state, 1) == LUA_TNUMBER &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL) &&
-                (lua_type(state, 3) == LUA_TSTRING || lua_type(state, 3) == LUA_TNIL) &&
-                lua_type(state, 4) == LUA_TNUMBER)
+            if (paramTypes[0] == LUA_TNUMBER &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL) &&
+                (paramTypes[2] == LUA_TSTRING || paramTypes[2] == LUA_TNIL) &&
+                paramTypes[3] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 1);
@@ -726,17 +816,22 @@ static int lua_AIMessage_static_create(lua_State* state)
     return 0;
 }
 
-static int lua_AIMessage_static_destroy(lua_State* state)
+int lua_AIMessage_static_destroy(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TTABLE || lua_type(state, 1) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TTABLE || paramTypes[0] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
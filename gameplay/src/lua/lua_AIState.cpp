@@ -16,24 +16,33 @@ namespace gameplay
 
 extern void luaGlobal_Register_Conversion_Function(const char* className, void*(*func)(void*, const char*));
 
+extern int lua_Ref_addRef(lua_State* state);
+extern int lua_Ref_getRefCount(lua_State* state);
+extern int lua_Ref_release(lua_State* state);
+
 static AIState* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "AIState");
-    luaL_argcheck(state, userdata != NULL, 1, "'AIState' expected.");
-    return (AIState*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "AIState");
+    luaL_argcheck(state, instance != NULL, 1, "'AIState' expected.");
+    return (AIState*)instance;
 }
 
-static int lua_AIState__gc(lua_State* state)
+int lua_AIState__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "AIState");
                 luaL_argcheck(state, userdata != NULL, 1, "'AIState' expected.");
@@ -61,49 +70,22 @@ static int lua_AIState__gc(lua_State* state)
     return 0;
 }
 
-static int lua_AIState_addRef(lua_State* state)
+int lua_AIState_getId(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AIState* instance = getInstance(state);
-                instance->addRef();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_AIState_addRef - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AIState_getId(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AIState* instance = getInstance(state);
                 const char* result = instance->getId();
@@ -128,85 +110,23 @@ static int lua_AIState_getId(lua_State* state)
     return 0;
 }
 
-static int lua_AIState_getRefCount(lua_State* state)
+int lua_AIState_setListener(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AIState* instance = getInstance(state);
-                unsigned int result = instance->getRefCount();
-
-                // Push the return value onto the stack.
-                lua_pushunsigned(state, result);
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_AIState_getRefCount - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AIState_release(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AIState* instance = getInstance(state);
-                instance->release();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_AIState_release - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AIState_setListener(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -237,17 +157,22 @@ static int lua_AIState_setListener(lua_State* state)
     return 0;
 }
 
-static int lua_AIState_static_create(lua_State* state)
+int lua_AIState_static_create(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TSTRING || lua_type(state, 1) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TSTRING || paramTypes[0] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(1, false);
@@ -331,11 +256,11 @@ void luaRegister_AIState()
 {
     const luaL_Reg lua_members[] = 
     {
-        {"addRef", lua_AIState_addRef},
         {"getId", lua_AIState_getId},
-        {"getRefCount", lua_AIState_getRefCount},
-        {"release", lua_AIState_release},
         {"setListener", lua_AIState_setListener},
+        {"addRef", lua_Ref_addRef},
+        {"getRefCount", lua_Ref_getRefCount},
+        {"release", lua_Ref_release},
         {"to", lua_AIState_to},
         {NULL, NULL}
     };
@@ -15,22 +15,27 @@ namespace gameplay
 
 static AIState::Listener* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "AIStateListener");
-    luaL_argcheck(state, userdata != NULL, 1, "'AIStateListener' expected.");
-    return (AIState::Listener*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "AIStateListener");
+    luaL_argcheck(state, instance != NULL, 1, "'AIStateListener' expected.");
+    return (AIState::Listener*)instance;
 }
 
-static int lua_AIStateListener__gc(lua_State* state)
+int lua_AIStateListener__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "AIStateListener");
                 luaL_argcheck(state, userdata != NULL, 1, "'AIStateListener' expected.");
@@ -58,7 +63,7 @@ static int lua_AIStateListener__gc(lua_State* state)
     return 0;
 }
 
-static int lua_AIStateListener__init(lua_State* state)
+int lua_AIStateListener__init(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -95,19 +100,24 @@ static int lua_AIStateListener__init(lua_State* state)
     return 0;
 }
 
-static int lua_AIStateListener_stateEnter(lua_State* state)
+int lua_AIStateListener_stateEnter(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TTABLE || lua_type(state, 3) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL) &&
+                (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TTABLE || paramTypes[2] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -147,19 +157,24 @@ static int lua_AIStateListener_stateEnter(lua_State* state)
     return 0;
 }
 
-static int lua_AIStateListener_stateExit(lua_State* state)
+int lua_AIStateListener_stateExit(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TTABLE || lua_type(state, 3) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL) &&
+                (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TTABLE || paramTypes[2] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -199,20 +214,25 @@ static int lua_AIStateListener_stateExit(lua_State* state)
     return 0;
 }
 
-static int lua_AIStateListener_stateUpdate(lua_State* state)
+int lua_AIStateListener_stateUpdate(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 4:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TTABLE || lua_type(state, 3) == LUA_TNIL) &&
-                lua_type(state, 4) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL) &&
+                (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TTABLE || paramTypes[2] == LUA_TNIL) &&
+                paramTypes[3] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
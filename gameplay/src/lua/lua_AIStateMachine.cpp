@@ -13,16 +13,21 @@ namespace gameplay
 
 static AIStateMachine* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "AIStateMachine");
-    luaL_argcheck(state, userdata != NULL, 1, "'AIStateMachine' expected.");
-    return (AIStateMachine*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "AIStateMachine");
+    luaL_argcheck(state, instance != NULL, 1, "'AIStateMachine' expected.");
+    return (AIStateMachine*)instance;
 }
 
-static int lua_AIStateMachine_addState(lua_State* state)
+int lua_AIStateMachine_addState(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -30,8 +35,8 @@ static int lua_AIStateMachine_addState(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -57,8 +62,8 @@ static int lua_AIStateMachine_addState(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -87,17 +92,22 @@ static int lua_AIStateMachine_addState(lua_State* state)
     return 0;
 }
 
-static int lua_AIStateMachine_getActiveState(lua_State* state)
+int lua_AIStateMachine_getActiveState(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AIStateMachine* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getActiveState());
@@ -131,17 +141,22 @@ static int lua_AIStateMachine_getActiveState(lua_State* state)
     return 0;
 }
 
-static int lua_AIStateMachine_getAgent(lua_State* state)
+int lua_AIStateMachine_getAgent(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AIStateMachine* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getAgent());
@@ -175,18 +190,23 @@ static int lua_AIStateMachine_getAgent(lua_State* state)
     return 0;
 }
 
-static int lua_AIStateMachine_getState(lua_State* state)
+int lua_AIStateMachine_getState(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -223,18 +243,23 @@ static int lua_AIStateMachine_getState(lua_State* state)
     return 0;
 }
 
-static int lua_AIStateMachine_removeState(lua_State* state)
+int lua_AIStateMachine_removeState(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -265,11 +290,16 @@ static int lua_AIStateMachine_removeState(lua_State* state)
     return 0;
 }
 
-static int lua_AIStateMachine_setState(lua_State* state)
+int lua_AIStateMachine_setState(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -277,8 +307,8 @@ static int lua_AIStateMachine_setState(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -304,8 +334,8 @@ static int lua_AIStateMachine_setState(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -18,22 +18,27 @@ extern void luaGlobal_Register_Conversion_Function(const char* className, void*(
 
 static AbsoluteLayout* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "AbsoluteLayout");
-    luaL_argcheck(state, userdata != NULL, 1, "'AbsoluteLayout' expected.");
-    return (AbsoluteLayout*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "AbsoluteLayout");
+    luaL_argcheck(state, instance != NULL, 1, "'AbsoluteLayout' expected.");
+    return (AbsoluteLayout*)instance;
 }
 
-static int lua_AbsoluteLayout__gc(lua_State* state)
+int lua_AbsoluteLayout__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "AbsoluteLayout");
                 luaL_argcheck(state, userdata != NULL, 1, "'AbsoluteLayout' expected.");
@@ -61,17 +66,22 @@ static int lua_AbsoluteLayout__gc(lua_State* state)
     return 0;
 }
 
-static int lua_AbsoluteLayout_addRef(lua_State* state)
+int lua_AbsoluteLayout_addRef(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AbsoluteLayout* instance = getInstance(state);
                 instance->addRef();
@@ -93,17 +103,22 @@ static int lua_AbsoluteLayout_addRef(lua_State* state)
     return 0;
 }
 
-static int lua_AbsoluteLayout_getRefCount(lua_State* state)
+int lua_AbsoluteLayout_getRefCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AbsoluteLayout* instance = getInstance(state);
                 unsigned int result = instance->getRefCount();
@@ -128,17 +143,22 @@ static int lua_AbsoluteLayout_getRefCount(lua_State* state)
     return 0;
 }
 
-static int lua_AbsoluteLayout_getType(lua_State* state)
+int lua_AbsoluteLayout_getType(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AbsoluteLayout* instance = getInstance(state);
                 Layout::Type result = instance->getType();
@@ -163,17 +183,22 @@ static int lua_AbsoluteLayout_getType(lua_State* state)
     return 0;
 }
 
-static int lua_AbsoluteLayout_release(lua_State* state)
+int lua_AbsoluteLayout_release(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AbsoluteLayout* instance = getInstance(state);
                 instance->release();
@@ -18,24 +18,33 @@ namespace gameplay
 
 extern void luaGlobal_Register_Conversion_Function(const char* className, void*(*func)(void*, const char*));
 
+extern int lua_Ref_addRef(lua_State* state);
+extern int lua_Ref_getRefCount(lua_State* state);
+extern int lua_Ref_release(lua_State* state);
+
 static Animation* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "Animation");
-    luaL_argcheck(state, userdata != NULL, 1, "'Animation' expected.");
-    return (Animation*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "Animation");
+    luaL_argcheck(state, instance != NULL, 1, "'Animation' expected.");
+    return (Animation*)instance;
 }
 
-static int lua_Animation__gc(lua_State* state)
+int lua_Animation__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "Animation");
                 luaL_argcheck(state, userdata != NULL, 1, "'Animation' expected.");
@@ -63,52 +72,25 @@ static int lua_Animation__gc(lua_State* state)
     return 0;
 }
 
-static int lua_Animation_addRef(lua_State* state)
+int lua_Animation_createClip(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                Animation* instance = getInstance(state);
-                instance->addRef();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_Animation_addRef - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_Animation_createClip(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 4:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL) &&
-                lua_type(state, 3) == LUA_TNUMBER &&
-                lua_type(state, 4) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL) &&
+                paramTypes[2] == LUA_TNUMBER &&
+                paramTypes[3] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -151,18 +133,23 @@ static int lua_Animation_createClip(lua_State* state)
     return 0;
 }
 
-static int lua_Animation_createClips(lua_State* state)
+int lua_Animation_createClips(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -187,11 +174,16 @@ static int lua_Animation_createClips(lua_State* state)
     return 0;
 }
 
-static int lua_Animation_getClip(lua_State* state)
+int lua_Animation_getClip(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -199,7 +191,7 @@ static int lua_Animation_getClip(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA))
+                if ((paramTypes[0] == LUA_TUSERDATA))
                 {
                     Animation* instance = getInstance(state);
                     void* returnPtr = ((void*)instance->getClip());
@@ -228,8 +220,8 @@ static int lua_Animation_getClip(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -255,8 +247,8 @@ static int lua_Animation_getClip(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    lua_type(state, 2) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    paramTypes[1] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -294,17 +286,22 @@ static int lua_Animation_getClip(lua_State* state)
     return 0;
 }
 
-static int lua_Animation_getClipCount(lua_State* state)
+int lua_Animation_getClipCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Animation* instance = getInstance(state);
                 unsigned int result = instance->getClipCount();
@@ -329,17 +326,22 @@ static int lua_Animation_getClipCount(lua_State* state)
     return 0;
 }
 
-static int lua_Animation_getDuration(lua_State* state)
+int lua_Animation_getDuration(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Animation* instance = getInstance(state);
                 unsigned long result = instance->getDuration();
@@ -364,17 +366,22 @@ static int lua_Animation_getDuration(lua_State* state)
     return 0;
 }
 
-static int lua_Animation_getId(lua_State* state)
+int lua_Animation_getId(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Animation* instance = getInstance(state);
                 const char* result = instance->getId();
@@ -399,52 +406,22 @@ static int lua_Animation_getId(lua_State* state)
     return 0;
 }
 
-static int lua_Animation_getRefCount(lua_State* state)
+int lua_Animation_pause(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                Animation* instance = getInstance(state);
-                unsigned int result = instance->getRefCount();
-
-                // Push the return value onto the stack.
-                lua_pushunsigned(state, result);
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_Animation_getRefCount - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_Animation_pause(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Animation* instance = getInstance(state);
                 instance->pause();
@@ -458,8 +435,8 @@ static int lua_Animation_pause(lua_State* state)
         }
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -484,17 +461,22 @@ static int lua_Animation_pause(lua_State* state)
     return 0;
 }
 
-static int lua_Animation_play(lua_State* state)
+int lua_Animation_play(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Animation* instance = getInstance(state);
                 instance->play();
@@ -508,8 +490,8 @@ static int lua_Animation_play(lua_State* state)
         }
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -534,49 +516,22 @@ static int lua_Animation_play(lua_State* state)
     return 0;
 }
 
-static int lua_Animation_release(lua_State* state)
+int lua_Animation_stop(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                Animation* instance = getInstance(state);
-                instance->release();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_Animation_release - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_Animation_stop(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Animation* instance = getInstance(state);
                 instance->stop();
@@ -590,8 +545,8 @@ static int lua_Animation_stop(lua_State* state)
         }
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -616,18 +571,23 @@ static int lua_Animation_stop(lua_State* state)
     return 0;
 }
 
-static int lua_Animation_targets(lua_State* state)
+int lua_Animation_targets(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -709,19 +669,19 @@ void luaRegister_Animation()
 {
     const luaL_Reg lua_members[] = 
     {
-        {"addRef", lua_Animation_addRef},
         {"createClip", lua_Animation_createClip},
         {"createClips", lua_Animation_createClips},
         {"getClip", lua_Animation_getClip},
         {"getClipCount", lua_Animation_getClipCount},
         {"getDuration", lua_Animation_getDuration},
         {"getId", lua_Animation_getId},
-        {"getRefCount", lua_Animation_getRefCount},
         {"pause", lua_Animation_pause},
         {"play", lua_Animation_play},
-        {"release", lua_Animation_release},
         {"stop", lua_Animation_stop},
         {"targets", lua_Animation_targets},
+        {"addRef", lua_Ref_addRef},
+        {"getRefCount", lua_Ref_getRefCount},
+        {"release", lua_Ref_release},
         {"to", lua_Animation_to},
         {NULL, NULL}
     };
@@ -19,24 +19,40 @@ namespace gameplay
 
 extern void luaGlobal_Register_Conversion_Function(const char* className, void*(*func)(void*, const char*));
 
+extern int lua_Ref_addRef(lua_State* state);
+extern int lua_ScriptTarget_addScript(lua_State* state);
+extern int lua_ScriptTarget_addScriptCallback(lua_State* state);
+extern int lua_ScriptTarget_clearScripts(lua_State* state);
+extern int lua_Ref_getRefCount(lua_State* state);
+extern int lua_ScriptTarget_getScriptEvent(lua_State* state);
+extern int lua_ScriptTarget_hasScriptListener(lua_State* state);
+extern int lua_Ref_release(lua_State* state);
+extern int lua_ScriptTarget_removeScript(lua_State* state);
+extern int lua_ScriptTarget_removeScriptCallback(lua_State* state);
+
 static AnimationClip* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "AnimationClip");
-    luaL_argcheck(state, userdata != NULL, 1, "'AnimationClip' expected.");
-    return (AnimationClip*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "AnimationClip");
+    luaL_argcheck(state, instance != NULL, 1, "'AnimationClip' expected.");
+    return (AnimationClip*)instance;
 }
 
-static int lua_AnimationClip__gc(lua_State* state)
+int lua_AnimationClip__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "AnimationClip");
                 luaL_argcheck(state, userdata != NULL, 1, "'AnimationClip' expected.");
@@ -64,18 +80,23 @@ static int lua_AnimationClip__gc(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_addBeginListener(lua_State* state)
+int lua_AnimationClip_addBeginListener(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -106,18 +127,23 @@ static int lua_AnimationClip_addBeginListener(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_addEndListener(lua_State* state)
+int lua_AnimationClip_addEndListener(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -148,19 +174,24 @@ static int lua_AnimationClip_addEndListener(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_addListener(lua_State* state)
+int lua_AnimationClip_addListener(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL) &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -194,177 +225,24 @@ static int lua_AnimationClip_addListener(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_addRef(lua_State* state)
+int lua_AnimationClip_crossFade(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AnimationClip* instance = getInstance(state);
-                instance->addRef();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_AnimationClip_addRef - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AnimationClip_addScript(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                const char* param1 = gameplay::ScriptUtil::getString(2, false);
-
-                AnimationClip* instance = getInstance(state);
-                void* returnPtr = ((void*)instance->addScript(param1));
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = false;
-                    luaL_getmetatable(state, "Script");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_AnimationClip_addScript - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AnimationClip_addScriptCallback(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                (lua_type(state, 3) == LUA_TSTRING || lua_type(state, 3) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                bool param1Valid;
-                gameplay::ScriptUtil::LuaArray<ScriptTarget::Event> param1 = gameplay::ScriptUtil::getObjectPointer<ScriptTarget::Event>(2, "ScriptTargetEvent", false, &param1Valid);
-                if (!param1Valid)
-                {
-                    lua_pushstring(state, "Failed to convert parameter 1 to type 'ScriptTarget::Event'.");
-                    lua_error(state);
-                }
-
-                // Get parameter 2 off the stack.
-                const char* param2 = gameplay::ScriptUtil::getString(3, false);
-
-                AnimationClip* instance = getInstance(state);
-                instance->addScriptCallback(param1, param2);
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_AnimationClip_addScriptCallback - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 3).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AnimationClip_clearScripts(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AnimationClip* instance = getInstance(state);
-                instance->clearScripts();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_AnimationClip_clearScripts - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AnimationClip_crossFade(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 3:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL) &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -398,17 +276,22 @@ static int lua_AnimationClip_crossFade(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_getActiveDuration(lua_State* state)
+int lua_AnimationClip_getActiveDuration(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 unsigned long result = instance->getActiveDuration();
@@ -433,17 +316,22 @@ static int lua_AnimationClip_getActiveDuration(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_getAnimation(lua_State* state)
+int lua_AnimationClip_getAnimation(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getAnimation());
@@ -477,17 +365,22 @@ static int lua_AnimationClip_getAnimation(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_getBlendWeight(lua_State* state)
+int lua_AnimationClip_getBlendWeight(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 float result = instance->getBlendWeight();
@@ -512,17 +405,22 @@ static int lua_AnimationClip_getBlendWeight(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_getDuration(lua_State* state)
+int lua_AnimationClip_getDuration(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 unsigned long result = instance->getDuration();
@@ -547,17 +445,22 @@ static int lua_AnimationClip_getDuration(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_getElapsedTime(lua_State* state)
+int lua_AnimationClip_getElapsedTime(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 float result = instance->getElapsedTime();
@@ -582,17 +485,22 @@ static int lua_AnimationClip_getElapsedTime(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_getEndTime(lua_State* state)
+int lua_AnimationClip_getEndTime(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 unsigned long result = instance->getEndTime();
@@ -617,17 +525,22 @@ static int lua_AnimationClip_getEndTime(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_getId(lua_State* state)
+int lua_AnimationClip_getId(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 const char* result = instance->getId();
@@ -652,17 +565,22 @@ static int lua_AnimationClip_getId(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_getLoopBlendTime(lua_State* state)
+int lua_AnimationClip_getLoopBlendTime(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 float result = instance->getLoopBlendTime();
@@ -687,52 +605,22 @@ static int lua_AnimationClip_getLoopBlendTime(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_getRefCount(lua_State* state)
+int lua_AnimationClip_getRepeatCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AnimationClip* instance = getInstance(state);
-                unsigned int result = instance->getRefCount();
-
-                // Push the return value onto the stack.
-                lua_pushunsigned(state, result);
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_AnimationClip_getRefCount - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AnimationClip_getRepeatCount(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 float result = instance->getRepeatCount();
@@ -757,65 +645,22 @@ static int lua_AnimationClip_getRepeatCount(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_getScriptEvent(lua_State* state)
+int lua_AnimationClip_getSpeed(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                const char* param1 = gameplay::ScriptUtil::getString(2, false);
-
-                AnimationClip* instance = getInstance(state);
-                void* returnPtr = ((void*)instance->getScriptEvent(param1));
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = false;
-                    luaL_getmetatable(state, "ScriptTargetEvent");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_AnimationClip_getScriptEvent - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AnimationClip_getSpeed(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 float result = instance->getSpeed();
@@ -840,17 +685,22 @@ static int lua_AnimationClip_getSpeed(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_getStartTime(lua_State* state)
+int lua_AnimationClip_getStartTime(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 unsigned long result = instance->getStartTime();
@@ -875,17 +725,22 @@ static int lua_AnimationClip_getStartTime(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_getTypeName(lua_State* state)
+int lua_AnimationClip_getTypeName(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 const char* result = instance->getTypeName();
@@ -910,80 +765,22 @@ static int lua_AnimationClip_getTypeName(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_hasScriptListener(lua_State* state)
+int lua_AnimationClip_isPlaying(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            do
-            {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
-                {
-                    // Get parameter 1 off the stack.
-                    const char* param1 = gameplay::ScriptUtil::getString(2, false);
-
-                    AnimationClip* instance = getInstance(state);
-                    bool result = instance->hasScriptListener(param1);
-
-                    // Push the return value onto the stack.
-                    lua_pushboolean(state, result);
-
-                    return 1;
-                }
-            } while (0);
-
-            do
-            {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
-                {
-                    // Get parameter 1 off the stack.
-                    bool param1Valid;
-                    gameplay::ScriptUtil::LuaArray<ScriptTarget::Event> param1 = gameplay::ScriptUtil::getObjectPointer<ScriptTarget::Event>(2, "ScriptTargetEvent", false, &param1Valid);
-                    if (!param1Valid)
-                        break;
-
-                    AnimationClip* instance = getInstance(state);
-                    bool result = instance->hasScriptListener(param1);
-
-                    // Push the return value onto the stack.
-                    lua_pushboolean(state, result);
-
-                    return 1;
-                }
-            } while (0);
-
-            lua_pushstring(state, "lua_AnimationClip_hasScriptListener - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AnimationClip_isPlaying(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 bool result = instance->isPlaying();
@@ -1008,17 +805,22 @@ static int lua_AnimationClip_isPlaying(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_pause(lua_State* state)
+int lua_AnimationClip_pause(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 instance->pause();
@@ -1040,17 +842,22 @@ static int lua_AnimationClip_pause(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_play(lua_State* state)
+int lua_AnimationClip_play(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 instance->play();
@@ -1072,50 +879,23 @@ static int lua_AnimationClip_play(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_release(lua_State* state)
+int lua_AnimationClip_removeBeginListener(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AnimationClip* instance = getInstance(state);
-                instance->release();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_AnimationClip_release - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AnimationClip_removeBeginListener(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -1146,18 +926,23 @@ static int lua_AnimationClip_removeBeginListener(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_removeEndListener(lua_State* state)
+int lua_AnimationClip_removeEndListener(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -1188,19 +973,24 @@ static int lua_AnimationClip_removeEndListener(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_removeListener(lua_State* state)
+int lua_AnimationClip_removeListener(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL) &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -1234,103 +1024,23 @@ static int lua_AnimationClip_removeListener(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_removeScript(lua_State* state)
+int lua_AnimationClip_setActiveDuration(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                const char* param1 = gameplay::ScriptUtil::getString(2, false);
-
-                AnimationClip* instance = getInstance(state);
-                bool result = instance->removeScript(param1);
-
-                // Push the return value onto the stack.
-                lua_pushboolean(state, result);
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_AnimationClip_removeScript - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AnimationClip_removeScriptCallback(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 3:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                (lua_type(state, 3) == LUA_TSTRING || lua_type(state, 3) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                bool param1Valid;
-                gameplay::ScriptUtil::LuaArray<ScriptTarget::Event> param1 = gameplay::ScriptUtil::getObjectPointer<ScriptTarget::Event>(2, "ScriptTargetEvent", false, &param1Valid);
-                if (!param1Valid)
-                {
-                    lua_pushstring(state, "Failed to convert parameter 1 to type 'ScriptTarget::Event'.");
-                    lua_error(state);
-                }
-
-                // Get parameter 2 off the stack.
-                const char* param2 = gameplay::ScriptUtil::getString(3, false);
-
-                AnimationClip* instance = getInstance(state);
-                instance->removeScriptCallback(param1, param2);
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_AnimationClip_removeScriptCallback - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 3).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AnimationClip_setActiveDuration(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned long param1 = (unsigned long)luaL_checkunsigned(state, 2);
@@ -1355,18 +1065,23 @@ static int lua_AnimationClip_setActiveDuration(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_setBlendWeight(lua_State* state)
+int lua_AnimationClip_setBlendWeight(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -1391,18 +1106,23 @@ static int lua_AnimationClip_setBlendWeight(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_setLoopBlendTime(lua_State* state)
+int lua_AnimationClip_setLoopBlendTime(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -1427,18 +1147,23 @@ static int lua_AnimationClip_setLoopBlendTime(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_setRepeatCount(lua_State* state)
+int lua_AnimationClip_setRepeatCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -1463,18 +1188,23 @@ static int lua_AnimationClip_setRepeatCount(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_setSpeed(lua_State* state)
+int lua_AnimationClip_setSpeed(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -1499,7 +1229,7 @@ static int lua_AnimationClip_setSpeed(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationClip_static_REPEAT_INDEFINITE(lua_State* state)
+int lua_AnimationClip_static_REPEAT_INDEFINITE(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 0)
@@ -1516,17 +1246,22 @@ static int lua_AnimationClip_static_REPEAT_INDEFINITE(lua_State* state)
     return 1;
 }
 
-static int lua_AnimationClip_stop(lua_State* state)
+int lua_AnimationClip_stop(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationClip* instance = getInstance(state);
                 instance->stop();
@@ -1603,10 +1338,6 @@ void luaRegister_AnimationClip()
         {"addBeginListener", lua_AnimationClip_addBeginListener},
         {"addEndListener", lua_AnimationClip_addEndListener},
         {"addListener", lua_AnimationClip_addListener},
-        {"addRef", lua_AnimationClip_addRef},
-        {"addScript", lua_AnimationClip_addScript},
-        {"addScriptCallback", lua_AnimationClip_addScriptCallback},
-        {"clearScripts", lua_AnimationClip_clearScripts},
         {"crossFade", lua_AnimationClip_crossFade},
         {"getActiveDuration", lua_AnimationClip_getActiveDuration},
         {"getAnimation", lua_AnimationClip_getAnimation},
@@ -1616,28 +1347,32 @@ void luaRegister_AnimationClip()
         {"getEndTime", lua_AnimationClip_getEndTime},
         {"getId", lua_AnimationClip_getId},
         {"getLoopBlendTime", lua_AnimationClip_getLoopBlendTime},
-        {"getRefCount", lua_AnimationClip_getRefCount},
         {"getRepeatCount", lua_AnimationClip_getRepeatCount},
-        {"getScriptEvent", lua_AnimationClip_getScriptEvent},
         {"getSpeed", lua_AnimationClip_getSpeed},
         {"getStartTime", lua_AnimationClip_getStartTime},
         {"getTypeName", lua_AnimationClip_getTypeName},
-        {"hasScriptListener", lua_AnimationClip_hasScriptListener},
         {"isPlaying", lua_AnimationClip_isPlaying},
         {"pause", lua_AnimationClip_pause},
         {"play", lua_AnimationClip_play},
-        {"release", lua_AnimationClip_release},
         {"removeBeginListener", lua_AnimationClip_removeBeginListener},
         {"removeEndListener", lua_AnimationClip_removeEndListener},
         {"removeListener", lua_AnimationClip_removeListener},
-        {"removeScript", lua_AnimationClip_removeScript},
-        {"removeScriptCallback", lua_AnimationClip_removeScriptCallback},
         {"setActiveDuration", lua_AnimationClip_setActiveDuration},
         {"setBlendWeight", lua_AnimationClip_setBlendWeight},
         {"setLoopBlendTime", lua_AnimationClip_setLoopBlendTime},
         {"setRepeatCount", lua_AnimationClip_setRepeatCount},
         {"setSpeed", lua_AnimationClip_setSpeed},
         {"stop", lua_AnimationClip_stop},
+        {"addRef", lua_Ref_addRef},
+        {"addScript", lua_ScriptTarget_addScript},
+        {"addScriptCallback", lua_ScriptTarget_addScriptCallback},
+        {"clearScripts", lua_ScriptTarget_clearScripts},
+        {"getRefCount", lua_Ref_getRefCount},
+        {"getScriptEvent", lua_ScriptTarget_getScriptEvent},
+        {"hasScriptListener", lua_ScriptTarget_hasScriptListener},
+        {"release", lua_Ref_release},
+        {"removeScript", lua_ScriptTarget_removeScript},
+        {"removeScriptCallback", lua_ScriptTarget_removeScriptCallback},
         {"to", lua_AnimationClip_to},
         {NULL, NULL}
     };
@@ -12,22 +12,27 @@ namespace gameplay
 
 static AnimationController* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "AnimationController");
-    luaL_argcheck(state, userdata != NULL, 1, "'AnimationController' expected.");
-    return (AnimationController*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "AnimationController");
+    luaL_argcheck(state, instance != NULL, 1, "'AnimationController' expected.");
+    return (AnimationController*)instance;
 }
 
-static int lua_AnimationController_stopAllAnimations(lua_State* state)
+int lua_AnimationController_stopAllAnimations(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationController* instance = getInstance(state);
                 instance->stopAllAnimations();
@@ -36,16 +36,21 @@ extern void luaGlobal_Register_Conversion_Function(const char* className, void*(
 
 static AnimationTarget* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "AnimationTarget");
-    luaL_argcheck(state, userdata != NULL, 1, "'AnimationTarget' expected.");
-    return (AnimationTarget*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "AnimationTarget");
+    luaL_argcheck(state, instance != NULL, 1, "'AnimationTarget' expected.");
+    return (AnimationTarget*)instance;
 }
 
-static int lua_AnimationTarget_createAnimation(lua_State* state)
+int lua_AnimationTarget_createAnimation(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[9];
+    for (int i = 0; i < paramCount && i < 9; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -53,9 +58,9 @@ static int lua_AnimationTarget_createAnimation(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL) &&
-                    (lua_type(state, 3) == LUA_TSTRING || lua_type(state, 3) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL) &&
+                    (paramTypes[2] == LUA_TSTRING || paramTypes[2] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -84,9 +89,9 @@ static int lua_AnimationTarget_createAnimation(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL) &&
-                    (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TTABLE || lua_type(state, 3) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL) &&
+                    (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TTABLE || paramTypes[2] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -124,13 +129,13 @@ static int lua_AnimationTarget_createAnimation(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL) &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER &&
-                    (lua_type(state, 5) == LUA_TTABLE || lua_type(state, 5) == LUA_TLIGHTUSERDATA) &&
-                    (lua_type(state, 6) == LUA_TTABLE || lua_type(state, 6) == LUA_TLIGHTUSERDATA) &&
-                    lua_type(state, 7) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL) &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER &&
+                    (paramTypes[4] == LUA_TTABLE || paramTypes[4] == LUA_TLIGHTUSERDATA) &&
+                    (paramTypes[5] == LUA_TTABLE || paramTypes[5] == LUA_TLIGHTUSERDATA) &&
+                    paramTypes[6] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -177,15 +182,15 @@ static int lua_AnimationTarget_createAnimation(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL) &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER &&
-                    (lua_type(state, 5) == LUA_TTABLE || lua_type(state, 5) == LUA_TLIGHTUSERDATA) &&
-                    (lua_type(state, 6) == LUA_TTABLE || lua_type(state, 6) == LUA_TLIGHTUSERDATA) &&
-                    (lua_type(state, 7) == LUA_TTABLE || lua_type(state, 7) == LUA_TLIGHTUSERDATA) &&
-                    (lua_type(state, 8) == LUA_TTABLE || lua_type(state, 8) == LUA_TLIGHTUSERDATA) &&
-                    lua_type(state, 9) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL) &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER &&
+                    (paramTypes[4] == LUA_TTABLE || paramTypes[4] == LUA_TLIGHTUSERDATA) &&
+                    (paramTypes[5] == LUA_TTABLE || paramTypes[5] == LUA_TLIGHTUSERDATA) &&
+                    (paramTypes[6] == LUA_TTABLE || paramTypes[6] == LUA_TLIGHTUSERDATA) &&
+                    (paramTypes[7] == LUA_TTABLE || paramTypes[7] == LUA_TLIGHTUSERDATA) &&
+                    paramTypes[8] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -244,23 +249,28 @@ static int lua_AnimationTarget_createAnimation(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationTarget_createAnimationFromBy(lua_State* state)
+int lua_AnimationTarget_createAnimationFromBy(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[7];
+    for (int i = 0; i < paramCount && i < 7; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 7:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL) &&
-                lua_type(state, 3) == LUA_TNUMBER &&
-                (lua_type(state, 4) == LUA_TTABLE || lua_type(state, 4) == LUA_TLIGHTUSERDATA) &&
-                (lua_type(state, 5) == LUA_TTABLE || lua_type(state, 5) == LUA_TLIGHTUSERDATA) &&
-                lua_type(state, 6) == LUA_TNUMBER &&
-                lua_type(state, 7) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL) &&
+                paramTypes[2] == LUA_TNUMBER &&
+                (paramTypes[3] == LUA_TTABLE || paramTypes[3] == LUA_TLIGHTUSERDATA) &&
+                (paramTypes[4] == LUA_TTABLE || paramTypes[4] == LUA_TLIGHTUSERDATA) &&
+                paramTypes[5] == LUA_TNUMBER &&
+                paramTypes[6] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -312,23 +322,28 @@ static int lua_AnimationTarget_createAnimationFromBy(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationTarget_createAnimationFromTo(lua_State* state)
+int lua_AnimationTarget_createAnimationFromTo(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[7];
+    for (int i = 0; i < paramCount && i < 7; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 7:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL) &&
-                lua_type(state, 3) == LUA_TNUMBER &&
-                (lua_type(state, 4) == LUA_TTABLE || lua_type(state, 4) == LUA_TLIGHTUSERDATA) &&
-                (lua_type(state, 5) == LUA_TTABLE || lua_type(state, 5) == LUA_TLIGHTUSERDATA) &&
-                lua_type(state, 6) == LUA_TNUMBER &&
-                lua_type(state, 7) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL) &&
+                paramTypes[2] == LUA_TNUMBER &&
+                (paramTypes[3] == LUA_TTABLE || paramTypes[3] == LUA_TLIGHTUSERDATA) &&
+                (paramTypes[4] == LUA_TTABLE || paramTypes[4] == LUA_TLIGHTUSERDATA) &&
+                paramTypes[5] == LUA_TNUMBER &&
+                paramTypes[6] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -380,17 +395,22 @@ static int lua_AnimationTarget_createAnimationFromTo(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationTarget_destroyAnimation(lua_State* state)
+int lua_AnimationTarget_destroyAnimation(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationTarget* instance = getInstance(state);
                 instance->destroyAnimation();
@@ -404,8 +424,8 @@ static int lua_AnimationTarget_destroyAnimation(lua_State* state)
         }
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -430,17 +450,22 @@ static int lua_AnimationTarget_destroyAnimation(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationTarget_getAnimation(lua_State* state)
+int lua_AnimationTarget_getAnimation(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AnimationTarget* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getAnimation());
@@ -466,8 +491,8 @@ static int lua_AnimationTarget_getAnimation(lua_State* state)
         }
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -504,18 +529,23 @@ static int lua_AnimationTarget_getAnimation(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationTarget_getAnimationPropertyComponentCount(lua_State* state)
+int lua_AnimationTarget_getAnimationPropertyComponentCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 int param1 = (int)luaL_checkint(state, 2);
@@ -543,19 +573,24 @@ static int lua_AnimationTarget_getAnimationPropertyComponentCount(lua_State* sta
     return 0;
 }
 
-static int lua_AnimationTarget_getAnimationPropertyValue(lua_State* state)
+int lua_AnimationTarget_getAnimationPropertyValue(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TTABLE || lua_type(state, 3) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TTABLE || paramTypes[2] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 int param1 = (int)luaL_checkint(state, 2);
@@ -589,19 +624,24 @@ static int lua_AnimationTarget_getAnimationPropertyValue(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationTarget_setAnimationPropertyValue(lua_State* state)
+int lua_AnimationTarget_setAnimationPropertyValue(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TTABLE || lua_type(state, 3) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TTABLE || paramTypes[2] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 int param1 = (int)luaL_checkint(state, 2);
@@ -627,10 +667,10 @@ static int lua_AnimationTarget_setAnimationPropertyValue(lua_State* state)
         }
         case 4:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TTABLE || lua_type(state, 3) == LUA_TNIL) &&
-                lua_type(state, 4) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TTABLE || paramTypes[2] == LUA_TNIL) &&
+                paramTypes[3] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 int param1 = (int)luaL_checkint(state, 2);
@@ -10,23 +10,28 @@ namespace gameplay
 
 static AnimationValue* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "AnimationValue");
-    luaL_argcheck(state, userdata != NULL, 1, "'AnimationValue' expected.");
-    return (AnimationValue*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "AnimationValue");
+    luaL_argcheck(state, instance != NULL, 1, "'AnimationValue' expected.");
+    return (AnimationValue*)instance;
 }
 
-static int lua_AnimationValue_getFloat(lua_State* state)
+int lua_AnimationValue_getFloat(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -54,20 +59,25 @@ static int lua_AnimationValue_getFloat(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationValue_getFloats(lua_State* state)
+int lua_AnimationValue_getFloats(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 4:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                (lua_type(state, 3) == LUA_TTABLE || lua_type(state, 3) == LUA_TLIGHTUSERDATA) &&
-                lua_type(state, 4) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                (paramTypes[2] == LUA_TTABLE || paramTypes[2] == LUA_TLIGHTUSERDATA) &&
+                paramTypes[3] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -98,19 +108,24 @@ static int lua_AnimationValue_getFloats(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationValue_setFloat(lua_State* state)
+int lua_AnimationValue_setFloat(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -138,20 +153,25 @@ static int lua_AnimationValue_setFloat(lua_State* state)
     return 0;
 }
 
-static int lua_AnimationValue_setFloats(lua_State* state)
+int lua_AnimationValue_setFloats(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 4:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                (lua_type(state, 3) == LUA_TTABLE || lua_type(state, 3) == LUA_TLIGHTUSERDATA) &&
-                lua_type(state, 4) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                (paramTypes[2] == LUA_TTABLE || paramTypes[2] == LUA_TLIGHTUSERDATA) &&
+                paramTypes[3] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
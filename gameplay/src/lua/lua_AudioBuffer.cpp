@@ -14,24 +14,33 @@ namespace gameplay
 
 extern void luaGlobal_Register_Conversion_Function(const char* className, void*(*func)(void*, const char*));
 
+extern int lua_Ref_addRef(lua_State* state);
+extern int lua_Ref_getRefCount(lua_State* state);
+extern int lua_Ref_release(lua_State* state);
+
 static AudioBuffer* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "AudioBuffer");
-    luaL_argcheck(state, userdata != NULL, 1, "'AudioBuffer' expected.");
-    return (AudioBuffer*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "AudioBuffer");
+    luaL_argcheck(state, instance != NULL, 1, "'AudioBuffer' expected.");
+    return (AudioBuffer*)instance;
 }
 
-static int lua_AudioBuffer__gc(lua_State* state)
+int lua_AudioBuffer__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "AudioBuffer");
                 luaL_argcheck(state, userdata != NULL, 1, "'AudioBuffer' expected.");
@@ -59,105 +68,6 @@ static int lua_AudioBuffer__gc(lua_State* state)
     return 0;
 }
 
-static int lua_AudioBuffer_addRef(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AudioBuffer* instance = getInstance(state);
-                instance->addRef();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_AudioBuffer_addRef - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AudioBuffer_getRefCount(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AudioBuffer* instance = getInstance(state);
-                unsigned int result = instance->getRefCount();
-
-                // Push the return value onto the stack.
-                lua_pushunsigned(state, result);
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_AudioBuffer_getRefCount - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AudioBuffer_release(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AudioBuffer* instance = getInstance(state);
-                instance->release();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_AudioBuffer_release - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
 // Provides support for conversion to all known relative types of AudioBuffer
 static void* __convertTo(void* ptr, const char* typeName)
 {
@@ -206,9 +116,9 @@ void luaRegister_AudioBuffer()
 {
     const luaL_Reg lua_members[] = 
     {
-        {"addRef", lua_AudioBuffer_addRef},
-        {"getRefCount", lua_AudioBuffer_getRefCount},
-        {"release", lua_AudioBuffer_release},
+        {"addRef", lua_Ref_addRef},
+        {"getRefCount", lua_Ref_getRefCount},
+        {"release", lua_Ref_release},
         {"to", lua_AudioBuffer_to},
         {NULL, NULL}
     };
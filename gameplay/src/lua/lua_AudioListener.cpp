@@ -17,22 +17,27 @@ extern void luaGlobal_Register_Conversion_Function(const char* className, void*(
 
 static AudioListener* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "AudioListener");
-    luaL_argcheck(state, userdata != NULL, 1, "'AudioListener' expected.");
-    return (AudioListener*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "AudioListener");
+    luaL_argcheck(state, instance != NULL, 1, "'AudioListener' expected.");
+    return (AudioListener*)instance;
 }
 
-static int lua_AudioListener_getCamera(lua_State* state)
+int lua_AudioListener_getCamera(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioListener* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getCamera());
@@ -66,17 +71,22 @@ static int lua_AudioListener_getCamera(lua_State* state)
     return 0;
 }
 
-static int lua_AudioListener_getGain(lua_State* state)
+int lua_AudioListener_getGain(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioListener* instance = getInstance(state);
                 float result = instance->getGain();
@@ -101,17 +111,22 @@ static int lua_AudioListener_getGain(lua_State* state)
     return 0;
 }
 
-static int lua_AudioListener_getOrientationForward(lua_State* state)
+int lua_AudioListener_getOrientationForward(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioListener* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getOrientationForward());
@@ -145,17 +160,22 @@ static int lua_AudioListener_getOrientationForward(lua_State* state)
     return 0;
 }
 
-static int lua_AudioListener_getOrientationUp(lua_State* state)
+int lua_AudioListener_getOrientationUp(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioListener* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getOrientationUp());
@@ -189,17 +209,22 @@ static int lua_AudioListener_getOrientationUp(lua_State* state)
     return 0;
 }
 
-static int lua_AudioListener_getPosition(lua_State* state)
+int lua_AudioListener_getPosition(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioListener* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getPosition());
@@ -233,17 +258,22 @@ static int lua_AudioListener_getPosition(lua_State* state)
     return 0;
 }
 
-static int lua_AudioListener_getVelocity(lua_State* state)
+int lua_AudioListener_getVelocity(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioListener* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getVelocity());
@@ -277,18 +307,23 @@ static int lua_AudioListener_getVelocity(lua_State* state)
     return 0;
 }
 
-static int lua_AudioListener_setCamera(lua_State* state)
+int lua_AudioListener_setCamera(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -319,18 +354,23 @@ static int lua_AudioListener_setCamera(lua_State* state)
     return 0;
 }
 
-static int lua_AudioListener_setGain(lua_State* state)
+int lua_AudioListener_setGain(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -355,11 +395,16 @@ static int lua_AudioListener_setGain(lua_State* state)
     return 0;
 }
 
-static int lua_AudioListener_setOrientation(lua_State* state)
+int lua_AudioListener_setOrientation(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[7];
+    for (int i = 0; i < paramCount && i < 7; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -367,9 +412,9 @@ static int lua_AudioListener_setOrientation(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL) &&
-                    (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL) &&
+                    (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -398,13 +443,13 @@ static int lua_AudioListener_setOrientation(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER &&
-                    lua_type(state, 5) == LUA_TNUMBER &&
-                    lua_type(state, 6) == LUA_TNUMBER &&
-                    lua_type(state, 7) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER &&
+                    paramTypes[4] == LUA_TNUMBER &&
+                    paramTypes[5] == LUA_TNUMBER &&
+                    paramTypes[6] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 2);
@@ -445,11 +490,16 @@ static int lua_AudioListener_setOrientation(lua_State* state)
     return 0;
 }
 
-static int lua_AudioListener_setPosition(lua_State* state)
+int lua_AudioListener_setPosition(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -457,8 +507,8 @@ static int lua_AudioListener_setPosition(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -481,10 +531,10 @@ static int lua_AudioListener_setPosition(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 2);
@@ -516,11 +566,16 @@ static int lua_AudioListener_setPosition(lua_State* state)
     return 0;
 }
 
-static int lua_AudioListener_setVelocity(lua_State* state)
+int lua_AudioListener_setVelocity(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -528,8 +583,8 @@ static int lua_AudioListener_setVelocity(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -552,10 +607,10 @@ static int lua_AudioListener_setVelocity(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 2);
@@ -587,7 +642,7 @@ static int lua_AudioListener_setVelocity(lua_State* state)
     return 0;
 }
 
-static int lua_AudioListener_static_getInstance(lua_State* state)
+int lua_AudioListener_static_getInstance(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
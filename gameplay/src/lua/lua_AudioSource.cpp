@@ -23,24 +23,33 @@ namespace gameplay
 
 extern void luaGlobal_Register_Conversion_Function(const char* className, void*(*func)(void*, const char*));
 
+extern int lua_Ref_addRef(lua_State* state);
+extern int lua_Ref_getRefCount(lua_State* state);
+extern int lua_Ref_release(lua_State* state);
+
 static AudioSource* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "AudioSource");
-    luaL_argcheck(state, userdata != NULL, 1, "'AudioSource' expected.");
-    return (AudioSource*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "AudioSource");
+    luaL_argcheck(state, instance != NULL, 1, "'AudioSource' expected.");
+    return (AudioSource*)instance;
 }
 
-static int lua_AudioSource__gc(lua_State* state)
+int lua_AudioSource__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "AudioSource");
                 luaL_argcheck(state, userdata != NULL, 1, "'AudioSource' expected.");
@@ -68,49 +77,22 @@ static int lua_AudioSource__gc(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_addRef(lua_State* state)
+int lua_AudioSource_getGain(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AudioSource* instance = getInstance(state);
-                instance->addRef();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_AudioSource_addRef - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AudioSource_getGain(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioSource* instance = getInstance(state);
                 float result = instance->getGain();
@@ -135,17 +117,22 @@ static int lua_AudioSource_getGain(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_getNode(lua_State* state)
+int lua_AudioSource_getNode(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioSource* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getNode());
@@ -179,17 +166,22 @@ static int lua_AudioSource_getNode(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_getPitch(lua_State* state)
+int lua_AudioSource_getPitch(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioSource* instance = getInstance(state);
                 float result = instance->getPitch();
@@ -214,52 +206,22 @@ static int lua_AudioSource_getPitch(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_getRefCount(lua_State* state)
+int lua_AudioSource_getState(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AudioSource* instance = getInstance(state);
-                unsigned int result = instance->getRefCount();
-
-                // Push the return value onto the stack.
-                lua_pushunsigned(state, result);
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_AudioSource_getRefCount - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AudioSource_getState(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioSource* instance = getInstance(state);
                 AudioSource::State result = instance->getState();
@@ -284,17 +246,22 @@ static int lua_AudioSource_getState(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_getVelocity(lua_State* state)
+int lua_AudioSource_getVelocity(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioSource* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getVelocity());
@@ -328,17 +295,22 @@ static int lua_AudioSource_getVelocity(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_isLooped(lua_State* state)
+int lua_AudioSource_isLooped(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioSource* instance = getInstance(state);
                 bool result = instance->isLooped();
@@ -363,17 +335,22 @@ static int lua_AudioSource_isLooped(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_isStreamed(lua_State* state)
+int lua_AudioSource_isStreamed(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioSource* instance = getInstance(state);
                 bool result = instance->isStreamed();
@@ -398,17 +375,22 @@ static int lua_AudioSource_isStreamed(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_pause(lua_State* state)
+int lua_AudioSource_pause(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioSource* instance = getInstance(state);
                 instance->pause();
@@ -430,17 +412,22 @@ static int lua_AudioSource_pause(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_play(lua_State* state)
+int lua_AudioSource_play(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioSource* instance = getInstance(state);
                 instance->play();
@@ -462,49 +449,22 @@ static int lua_AudioSource_play(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_release(lua_State* state)
+int lua_AudioSource_resume(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                AudioSource* instance = getInstance(state);
-                instance->release();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_AudioSource_release - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_AudioSource_resume(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioSource* instance = getInstance(state);
                 instance->resume();
@@ -526,17 +486,22 @@ static int lua_AudioSource_resume(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_rewind(lua_State* state)
+int lua_AudioSource_rewind(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioSource* instance = getInstance(state);
                 instance->rewind();
@@ -558,18 +523,23 @@ static int lua_AudioSource_rewind(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_setGain(lua_State* state)
+int lua_AudioSource_setGain(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -594,18 +564,23 @@ static int lua_AudioSource_setGain(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_setLooped(lua_State* state)
+int lua_AudioSource_setLooped(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TBOOLEAN)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TBOOLEAN)
             {
                 // Get parameter 1 off the stack.
                 bool param1 = gameplay::ScriptUtil::luaCheckBool(state, 2);
@@ -630,18 +605,23 @@ static int lua_AudioSource_setLooped(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_setPitch(lua_State* state)
+int lua_AudioSource_setPitch(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -666,11 +646,16 @@ static int lua_AudioSource_setPitch(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_setVelocity(lua_State* state)
+int lua_AudioSource_setVelocity(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -678,8 +663,8 @@ static int lua_AudioSource_setVelocity(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -702,10 +687,10 @@ static int lua_AudioSource_setVelocity(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 2);
@@ -737,11 +722,16 @@ static int lua_AudioSource_setVelocity(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_static_create(lua_State* state)
+int lua_AudioSource_static_create(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -749,7 +739,7 @@ static int lua_AudioSource_static_create(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TSTRING || lua_type(state, 1) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TSTRING || paramTypes[0] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(1, false);
@@ -774,7 +764,7 @@ static int lua_AudioSource_static_create(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TTABLE || lua_type(state, 1) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TTABLE || paramTypes[0] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -808,8 +798,8 @@ static int lua_AudioSource_static_create(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TSTRING || lua_type(state, 1) == LUA_TNIL) &&
-                    lua_type(state, 2) == LUA_TBOOLEAN)
+                if ((paramTypes[0] == LUA_TSTRING || paramTypes[0] == LUA_TNIL) &&
+                    paramTypes[1] == LUA_TBOOLEAN)
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(1, false);
@@ -849,17 +839,22 @@ static int lua_AudioSource_static_create(lua_State* state)
     return 0;
 }
 
-static int lua_AudioSource_stop(lua_State* state)
+int lua_AudioSource_stop(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 AudioSource* instance = getInstance(state);
                 instance->stop();
@@ -933,18 +928,15 @@ void luaRegister_AudioSource()
 {
     const luaL_Reg lua_members[] = 
     {
-        {"addRef", lua_AudioSource_addRef},
         {"getGain", lua_AudioSource_getGain},
         {"getNode", lua_AudioSource_getNode},
         {"getPitch", lua_AudioSource_getPitch},
-        {"getRefCount", lua_AudioSource_getRefCount},
         {"getState", lua_AudioSource_getState},
         {"getVelocity", lua_AudioSource_getVelocity},
         {"isLooped", lua_AudioSource_isLooped},
         {"isStreamed", lua_AudioSource_isStreamed},
         {"pause", lua_AudioSource_pause},
         {"play", lua_AudioSource_play},
-        {"release", lua_AudioSource_release},
         {"resume", lua_AudioSource_resume},
         {"rewind", lua_AudioSource_rewind},
         {"setGain", lua_AudioSource_setGain},
@@ -952,6 +944,9 @@ void luaRegister_AudioSource()
         {"setPitch", lua_AudioSource_setPitch},
         {"setVelocity", lua_AudioSource_setVelocity},
         {"stop", lua_AudioSource_stop},
+        {"addRef", lua_Ref_addRef},
+        {"getRefCount", lua_Ref_getRefCount},
+        {"release", lua_Ref_release},
         {"to", lua_AudioSource_to},
         {NULL, NULL}
     };
@@ -12,22 +12,27 @@ namespace gameplay
 
 static BoundingBox* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "BoundingBox");
-    luaL_argcheck(state, userdata != NULL, 1, "'BoundingBox' expected.");
-    return (BoundingBox*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "BoundingBox");
+    luaL_argcheck(state, instance != NULL, 1, "'BoundingBox' expected.");
+    return (BoundingBox*)instance;
 }
 
-static int lua_BoundingBox__gc(lua_State* state)
+int lua_BoundingBox__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "BoundingBox");
                 luaL_argcheck(state, userdata != NULL, 1, "'BoundingBox' expected.");
@@ -55,11 +60,16 @@ static int lua_BoundingBox__gc(lua_State* state)
     return 0;
 }
 
-static int lua_BoundingBox__init(lua_State* state)
+int lua_BoundingBox__init(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[6];
+    for (int i = 0; i < paramCount && i < 6; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -86,7 +96,7 @@ static int lua_BoundingBox__init(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -120,8 +130,8 @@ static int lua_BoundingBox__init(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TNIL) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TNIL) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -161,12 +171,12 @@ static int lua_BoundingBox__init(lua_State* state)
         {
             do
             {
-                if (lua_type(state, 1) == LUA_TNUMBER &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER &&
-                    lua_type(state, 5) == LUA_TNUMBER &&
-                    lua_type(state, 6) == LUA_TNUMBER)
+                if (paramTypes[0] == LUA_TNUMBER &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER &&
+                    paramTypes[4] == LUA_TNUMBER &&
+                    paramTypes[5] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 1);
@@ -218,11 +228,16 @@ static int lua_BoundingBox__init(lua_State* state)
     return 0;
 }
 
-static int lua_BoundingBox_getCenter(lua_State* state)
+int lua_BoundingBox_getCenter(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -230,22 +245,11 @@ static int lua_BoundingBox_getCenter(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA))
+                if ((paramTypes[0] == LUA_TUSERDATA))
                 {
                     BoundingBox* instance = getInstance(state);
-                    void* returnPtr = (void*)new Vector3(instance->getCenter());
-                    if (returnPtr)
-                    {
-                        gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                        object->instance = returnPtr;
-                        object->owns = true;
-                        luaL_getmetatable(state, "Vector3");
-                        lua_setmetatable(state, -2);
-                    }
-                    else
-                    {
-                        lua_pushnil(state);
-                    }
+                    gameplay::ScriptUtil::pushValueObject<Vector3>("Vector3", instance->getCenter());
+                    // The object was pushed onto the stack when it was created.
 
                     return 1;
                 }
@@ -259,8 +263,8 @@ static int lua_BoundingBox_getCenter(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -289,18 +293,23 @@ static int lua_BoundingBox_getCenter(lua_State* state)
     return 0;
 }
 
-static int lua_BoundingBox_getCorners(lua_State* state)
+int lua_BoundingBox_getCorners(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -331,11 +340,16 @@ static int lua_BoundingBox_getCorners(lua_State* state)
     return 0;
 }
 
-static int lua_BoundingBox_intersects(lua_State* state)
+int lua_BoundingBox_intersects(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -343,8 +357,8 @@ static int lua_BoundingBox_intersects(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -364,8 +378,8 @@ static int lua_BoundingBox_intersects(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -385,8 +399,8 @@ static int lua_BoundingBox_intersects(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -406,8 +420,8 @@ static int lua_BoundingBox_intersects(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -427,8 +441,8 @@ static int lua_BoundingBox_intersects(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -460,17 +474,22 @@ static int lua_BoundingBox_intersects(lua_State* state)
     return 0;
 }
 
-static int lua_BoundingBox_isEmpty(lua_State* state)
+int lua_BoundingBox_isEmpty(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 BoundingBox* instance = getInstance(state);
                 bool result = instance->isEmpty();
@@ -495,7 +514,7 @@ static int lua_BoundingBox_isEmpty(lua_State* state)
     return 0;
 }
 
-static int lua_BoundingBox_max(lua_State* state)
+int lua_BoundingBox_max(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -521,29 +540,23 @@ static int lua_BoundingBox_max(lua_State* state)
     }
     else
     {
-        void* returnPtr = (void*)new Vector3(instance->max);
-        if (returnPtr)
-        {
-            gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-            object->instance = returnPtr;
-            object->owns = true;
-            luaL_getmetatable(state, "Vector3");
-            lua_setmetatable(state, -2);
-        }
-        else
-        {
-            lua_pushnil(state);
-        }
+        gameplay::ScriptUtil::pushValueObject<Vector3>("Vector3", instance->max);
+        // The object was pushed onto the stack when it was created.
 
         return 1;
     }
 }
 
-static int lua_BoundingBox_merge(lua_State* state)
+int lua_BoundingBox_merge(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -551,8 +564,8 @@ static int lua_BoundingBox_merge(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -569,8 +582,8 @@ static int lua_BoundingBox_merge(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -599,7 +612,7 @@ static int lua_BoundingBox_merge(lua_State* state)
     return 0;
 }
 
-static int lua_BoundingBox_min(lua_State* state)
+int lua_BoundingBox_min(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -625,29 +638,23 @@ static int lua_BoundingBox_min(lua_State* state)
     }
     else
     {
-        void* returnPtr = (void*)new Vector3(instance->min);
-        if (returnPtr)
-        {
-            gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-            object->instance = returnPtr;
-            object->owns = true;
-            luaL_getmetatable(state, "Vector3");
-            lua_setmetatable(state, -2);
-        }
-        else
-        {
-            lua_pushnil(state);
-        }
+        gameplay::ScriptUtil::pushValueObject<Vector3>("Vector3", instance->min);
+        // The object was pushed onto the stack when it was created.
 
         return 1;
     }
 }
 
-static int lua_BoundingBox_set(lua_State* state)
+int lua_BoundingBox_set(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[7];
+    for (int i = 0; i < paramCount && i < 7; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -655,8 +662,8 @@ static int lua_BoundingBox_set(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -673,8 +680,8 @@ static int lua_BoundingBox_set(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -697,9 +704,9 @@ static int lua_BoundingBox_set(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL) &&
-                    (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL) &&
+                    (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -728,13 +735,13 @@ static int lua_BoundingBox_set(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER &&
-                    lua_type(state, 5) == LUA_TNUMBER &&
-                    lua_type(state, 6) == LUA_TNUMBER &&
-                    lua_type(state, 7) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER &&
+                    paramTypes[4] == LUA_TNUMBER &&
+                    paramTypes[5] == LUA_TNUMBER &&
+                    paramTypes[6] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 2);
@@ -775,7 +782,7 @@ static int lua_BoundingBox_set(lua_State* state)
     return 0;
 }
 
-static int lua_BoundingBox_static_empty(lua_State* state)
+int lua_BoundingBox_static_empty(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -812,18 +819,23 @@ static int lua_BoundingBox_static_empty(lua_State* state)
     return 0;
 }
 
-static int lua_BoundingBox_transform(lua_State* state)
+int lua_BoundingBox_transform(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -24,24 +24,33 @@ namespace gameplay
 
 extern void luaGlobal_Register_Conversion_Function(const char* className, void*(*func)(void*, const char*));
 
+extern int lua_Ref_addRef(lua_State* state);
+extern int lua_Ref_getRefCount(lua_State* state);
+extern int lua_Ref_release(lua_State* state);
+
 static Camera* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "Camera");
-    luaL_argcheck(state, userdata != NULL, 1, "'Camera' expected.");
-    return (Camera*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "Camera");
+    luaL_argcheck(state, instance != NULL, 1, "'Camera' expected.");
+    return (Camera*)instance;
 }
 
-static int lua_Camera__gc(lua_State* state)
+int lua_Camera__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "Camera");
                 luaL_argcheck(state, userdata != NULL, 1, "'Camera' expected.");
@@ -69,18 +78,23 @@ static int lua_Camera__gc(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_addListener(lua_State* state)
+int lua_Camera_addListener(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -111,49 +125,22 @@ static int lua_Camera_addListener(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_addRef(lua_State* state)
+int lua_Camera_getAspectRatio(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                Camera* instance = getInstance(state);
-                instance->addRef();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_Camera_addRef - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_Camera_getAspectRatio(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 float result = instance->getAspectRatio();
@@ -178,17 +165,22 @@ static int lua_Camera_getAspectRatio(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_getCameraType(lua_State* state)
+int lua_Camera_getCameraType(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 Camera::Type result = instance->getCameraType();
@@ -213,17 +205,22 @@ static int lua_Camera_getCameraType(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_getFarPlane(lua_State* state)
+int lua_Camera_getFarPlane(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 float result = instance->getFarPlane();
@@ -248,17 +245,22 @@ static int lua_Camera_getFarPlane(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_getFieldOfView(lua_State* state)
+int lua_Camera_getFieldOfView(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 float result = instance->getFieldOfView();
@@ -283,17 +285,22 @@ static int lua_Camera_getFieldOfView(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_getFrustum(lua_State* state)
+int lua_Camera_getFrustum(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getFrustum());
@@ -327,17 +334,22 @@ static int lua_Camera_getFrustum(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_getInverseViewMatrix(lua_State* state)
+int lua_Camera_getInverseViewMatrix(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getInverseViewMatrix());
@@ -371,17 +383,22 @@ static int lua_Camera_getInverseViewMatrix(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_getInverseViewProjectionMatrix(lua_State* state)
+int lua_Camera_getInverseViewProjectionMatrix(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getInverseViewProjectionMatrix());
@@ -415,17 +432,22 @@ static int lua_Camera_getInverseViewProjectionMatrix(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_getNearPlane(lua_State* state)
+int lua_Camera_getNearPlane(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 float result = instance->getNearPlane();
@@ -450,17 +472,22 @@ static int lua_Camera_getNearPlane(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_getNode(lua_State* state)
+int lua_Camera_getNode(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getNode());
@@ -494,17 +521,22 @@ static int lua_Camera_getNode(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_getProjectionMatrix(lua_State* state)
+int lua_Camera_getProjectionMatrix(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getProjectionMatrix());
@@ -538,52 +570,22 @@ static int lua_Camera_getProjectionMatrix(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_getRefCount(lua_State* state)
+int lua_Camera_getViewMatrix(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                Camera* instance = getInstance(state);
-                unsigned int result = instance->getRefCount();
-
-                // Push the return value onto the stack.
-                lua_pushunsigned(state, result);
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_Camera_getRefCount - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_Camera_getViewMatrix(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getViewMatrix());
@@ -617,17 +619,22 @@ static int lua_Camera_getViewMatrix(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_getViewProjectionMatrix(lua_State* state)
+int lua_Camera_getViewProjectionMatrix(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getViewProjectionMatrix());
@@ -661,17 +668,22 @@ static int lua_Camera_getViewProjectionMatrix(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_getZoomX(lua_State* state)
+int lua_Camera_getZoomX(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 float result = instance->getZoomX();
@@ -696,17 +708,22 @@ static int lua_Camera_getZoomX(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_getZoomY(lua_State* state)
+int lua_Camera_getZoomY(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 float result = instance->getZoomY();
@@ -731,21 +748,26 @@ static int lua_Camera_getZoomY(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_pickRay(lua_State* state)
+int lua_Camera_pickRay(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[5];
+    for (int i = 0; i < paramCount && i < 5; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 5:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL) &&
-                lua_type(state, 3) == LUA_TNUMBER &&
-                lua_type(state, 4) == LUA_TNUMBER &&
-                (lua_type(state, 5) == LUA_TUSERDATA || lua_type(state, 5) == LUA_TTABLE || lua_type(state, 5) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL) &&
+                paramTypes[2] == LUA_TNUMBER &&
+                paramTypes[3] == LUA_TNUMBER &&
+                (paramTypes[4] == LUA_TUSERDATA || paramTypes[4] == LUA_TTABLE || paramTypes[4] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -791,11 +813,16 @@ static int lua_Camera_pickRay(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_project(lua_State* state)
+int lua_Camera_project(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -803,10 +830,10 @@ static int lua_Camera_project(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL) &&
-                    (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TNIL) &&
-                    (lua_type(state, 4) == LUA_TUSERDATA || lua_type(state, 4) == LUA_TTABLE || lua_type(state, 4) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL) &&
+                    (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TNIL) &&
+                    (paramTypes[3] == LUA_TUSERDATA || paramTypes[3] == LUA_TTABLE || paramTypes[3] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -835,10 +862,10 @@ static int lua_Camera_project(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL) &&
-                    (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TNIL) &&
-                    (lua_type(state, 4) == LUA_TUSERDATA || lua_type(state, 4) == LUA_TTABLE || lua_type(state, 4) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL) &&
+                    (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TNIL) &&
+                    (paramTypes[3] == LUA_TUSERDATA || paramTypes[3] == LUA_TTABLE || paramTypes[3] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -879,50 +906,23 @@ static int lua_Camera_project(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_release(lua_State* state)
+int lua_Camera_removeListener(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                Camera* instance = getInstance(state);
-                instance->release();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_Camera_release - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_Camera_removeListener(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -953,17 +953,22 @@ static int lua_Camera_removeListener(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_resetProjectionMatrix(lua_State* state)
+int lua_Camera_resetProjectionMatrix(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Camera* instance = getInstance(state);
                 instance->resetProjectionMatrix();
@@ -985,18 +990,23 @@ static int lua_Camera_resetProjectionMatrix(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_setAspectRatio(lua_State* state)
+int lua_Camera_setAspectRatio(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -1021,18 +1031,23 @@ static int lua_Camera_setAspectRatio(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_setFarPlane(lua_State* state)
+int lua_Camera_setFarPlane(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -1057,18 +1072,23 @@ static int lua_Camera_setFarPlane(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_setFieldOfView(lua_State* state)
+int lua_Camera_setFieldOfView(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -1093,18 +1113,23 @@ static int lua_Camera_setFieldOfView(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_setNearPlane(lua_State* state)
+int lua_Camera_setNearPlane(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -1129,18 +1154,23 @@ static int lua_Camera_setNearPlane(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_setProjectionMatrix(lua_State* state)
+int lua_Camera_setProjectionMatrix(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -1171,18 +1201,23 @@ static int lua_Camera_setProjectionMatrix(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_setZoomX(lua_State* state)
+int lua_Camera_setZoomX(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -1207,18 +1242,23 @@ static int lua_Camera_setZoomX(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_setZoomY(lua_State* state)
+int lua_Camera_setZoomY(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -1243,17 +1283,22 @@ static int lua_Camera_setZoomY(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_static_create(lua_State* state)
+int lua_Camera_static_create(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TTABLE || lua_type(state, 1) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TTABLE || paramTypes[0] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -1295,21 +1340,26 @@ static int lua_Camera_static_create(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_static_createOrthographic(lua_State* state)
+int lua_Camera_static_createOrthographic(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[5];
+    for (int i = 0; i < paramCount && i < 5; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 5:
         {
-            if (lua_type(state, 1) == LUA_TNUMBER &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TNUMBER &&
-                lua_type(state, 4) == LUA_TNUMBER &&
-                lua_type(state, 5) == LUA_TNUMBER)
+            if (paramTypes[0] == LUA_TNUMBER &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TNUMBER &&
+                paramTypes[3] == LUA_TNUMBER &&
+                paramTypes[4] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 1);
@@ -1357,20 +1407,25 @@ static int lua_Camera_static_createOrthographic(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_static_createPerspective(lua_State* state)
+int lua_Camera_static_createPerspective(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 4:
         {
-            if (lua_type(state, 1) == LUA_TNUMBER &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TNUMBER &&
-                lua_type(state, 4) == LUA_TNUMBER)
+            if (paramTypes[0] == LUA_TNUMBER &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TNUMBER &&
+                paramTypes[3] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 1);
@@ -1415,22 +1470,27 @@ static int lua_Camera_static_createPerspective(lua_State* state)
     return 0;
 }
 
-static int lua_Camera_unproject(lua_State* state)
+int lua_Camera_unproject(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[6];
+    for (int i = 0; i < paramCount && i < 6; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 6:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL) &&
-                lua_type(state, 3) == LUA_TNUMBER &&
-                lua_type(state, 4) == LUA_TNUMBER &&
-                lua_type(state, 5) == LUA_TNUMBER &&
-                (lua_type(state, 6) == LUA_TUSERDATA || lua_type(state, 6) == LUA_TTABLE || lua_type(state, 6) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL) &&
+                paramTypes[2] == LUA_TNUMBER &&
+                paramTypes[3] == LUA_TNUMBER &&
+                paramTypes[4] == LUA_TNUMBER &&
+                (paramTypes[5] == LUA_TUSERDATA || paramTypes[5] == LUA_TTABLE || paramTypes[5] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -1532,7 +1592,6 @@ void luaRegister_Camera()
     const luaL_Reg lua_members[] = 
     {
         {"addListener", lua_Camera_addListener},
-        {"addRef", lua_Camera_addRef},
         {"getAspectRatio", lua_Camera_getAspectRatio},
         {"getCameraType", lua_Camera_getCameraType},
         {"getFarPlane", lua_Camera_getFarPlane},
@@ -1543,14 +1602,12 @@ void luaRegister_Camera()
         {"getNearPlane", lua_Camera_getNearPlane},
         {"getNode", lua_Camera_getNode},
         {"getProjectionMatrix", lua_Camera_getProjectionMatrix},
-        {"getRefCount", lua_Camera_getRefCount},
         {"getViewMatrix", lua_Camera_getViewMatrix},
         {"getViewProjectionMatrix", lua_Camera_getViewProjectionMatrix},
         {"getZoomX", lua_Camera_getZoomX},
         {"getZoomY", lua_Camera_getZoomY},
         {"pickRay", lua_Camera_pickRay},
         {"project", lua_Camera_project},
-        {"release", lua_Camera_release},
         {"removeListener", lua_Camera_removeListener},
         {"resetProjectionMatrix", lua_Camera_resetProjectionMatrix},
         {"setAspectRatio", lua_Camera_setAspectRatio},
@@ -1561,6 +1618,9 @@ void luaRegister_Camera()
         {"setZoomX", lua_Camera_setZoomX},
         {"setZoomY", lua_Camera_setZoomY},
         {"unproject", lua_Camera_unproject},
+        {"addRef", lua_Ref_addRef},
+        {"getRefCount", lua_Ref_getRefCount},
+        {"release", lua_Ref_release},
         {"to", lua_Camera_to},
         {NULL, NULL}
     };
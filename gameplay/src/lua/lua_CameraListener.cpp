@@ -26,22 +26,27 @@ extern void luaGlobal_Register_Conversion_Function(const char* className, void*(
 
 static Camera::Listener* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "CameraListener");
-    luaL_argcheck(state, userdata != NULL, 1, "'CameraListener' expected.");
-    return (Camera::Listener*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "CameraListener");
+    luaL_argcheck(state, instance != NULL, 1, "'CameraListener' expected.");
+    return (Camera::Listener*)instance;
 }
 
-static int lua_CameraListener__gc(lua_State* state)
+int lua_CameraListener__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "CameraListener");
                 luaL_argcheck(state, userdata != NULL, 1, "'CameraListener' expected.");
@@ -69,18 +74,23 @@ static int lua_CameraListener__gc(lua_State* state)
     return 0;
 }
 
-static int lua_CameraListener_cameraChanged(lua_State* state)
+int lua_CameraListener_cameraChanged(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
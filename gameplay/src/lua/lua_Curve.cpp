@@ -14,24 +14,33 @@ namespace gameplay
 
 extern void luaGlobal_Register_Conversion_Function(const char* className, void*(*func)(void*, const char*));
 
+extern int lua_Ref_addRef(lua_State* state);
+extern int lua_Ref_getRefCount(lua_State* state);
+extern int lua_Ref_release(lua_State* state);
+
 static Curve* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "Curve");
-    luaL_argcheck(state, userdata != NULL, 1, "'Curve' expected.");
-    return (Curve*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "Curve");
+    luaL_argcheck(state, instance != NULL, 1, "'Curve' expected.");
+    return (Curve*)instance;
 }
 
-static int lua_Curve__gc(lua_State* state)
+int lua_Curve__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "Curve");
                 luaL_argcheck(state, userdata != NULL, 1, "'Curve' expected.");
@@ -59,42 +68,15 @@ static int lua_Curve__gc(lua_State* state)
     return 0;
 }
 
-static int lua_Curve_addRef(lua_State* state)
+int lua_Curve_evaluate(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                Curve* instance = getInstance(state);
-                instance->addRef();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_Curve_addRef - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_Curve_evaluate(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[6];
+    for (int i = 0; i < paramCount && i < 6; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
@@ -103,9 +85,9 @@ static int lua_Curve_evaluate(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    (lua_type(state, 3) == LUA_TTABLE || lua_type(state, 3) == LUA_TLIGHTUSERDATA))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    (paramTypes[2] == LUA_TTABLE || paramTypes[2] == LUA_TLIGHTUSERDATA))
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 2);
@@ -128,12 +110,12 @@ static int lua_Curve_evaluate(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER &&
-                    lua_type(state, 5) == LUA_TNUMBER &&
-                    (lua_type(state, 6) == LUA_TTABLE || lua_type(state, 6) == LUA_TLIGHTUSERDATA))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER &&
+                    paramTypes[4] == LUA_TNUMBER &&
+                    (paramTypes[5] == LUA_TTABLE || paramTypes[5] == LUA_TLIGHTUSERDATA))
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 2);
@@ -171,17 +153,22 @@ static int lua_Curve_evaluate(lua_State* state)
     return 0;
 }
 
-static int lua_Curve_getComponentCount(lua_State* state)
+int lua_Curve_getComponentCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Curve* instance = getInstance(state);
                 unsigned int result = instance->getComponentCount();
@@ -206,17 +193,22 @@ static int lua_Curve_getComponentCount(lua_State* state)
     return 0;
 }
 
-static int lua_Curve_getEndTime(lua_State* state)
+int lua_Curve_getEndTime(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Curve* instance = getInstance(state);
                 float result = instance->getEndTime();
@@ -241,17 +233,22 @@ static int lua_Curve_getEndTime(lua_State* state)
     return 0;
 }
 
-static int lua_Curve_getPointCount(lua_State* state)
+int lua_Curve_getPointCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Curve* instance = getInstance(state);
                 unsigned int result = instance->getPointCount();
@@ -276,18 +273,23 @@ static int lua_Curve_getPointCount(lua_State* state)
     return 0;
 }
 
-static int lua_Curve_getPointInterpolation(lua_State* state)
+int lua_Curve_getPointInterpolation(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -315,18 +317,23 @@ static int lua_Curve_getPointInterpolation(lua_State* state)
     return 0;
 }
 
-static int lua_Curve_getPointTime(lua_State* state)
+int lua_Curve_getPointTime(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -354,21 +361,26 @@ static int lua_Curve_getPointTime(lua_State* state)
     return 0;
 }
 
-static int lua_Curve_getPointValues(lua_State* state)
+int lua_Curve_getPointValues(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[5];
+    for (int i = 0; i < paramCount && i < 5; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 5:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                (lua_type(state, 3) == LUA_TTABLE || lua_type(state, 3) == LUA_TLIGHTUSERDATA) &&
-                (lua_type(state, 4) == LUA_TTABLE || lua_type(state, 4) == LUA_TLIGHTUSERDATA) &&
-                (lua_type(state, 5) == LUA_TTABLE || lua_type(state, 5) == LUA_TLIGHTUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                (paramTypes[2] == LUA_TTABLE || paramTypes[2] == LUA_TLIGHTUSERDATA) &&
+                (paramTypes[3] == LUA_TTABLE || paramTypes[3] == LUA_TLIGHTUSERDATA) &&
+                (paramTypes[4] == LUA_TTABLE || paramTypes[4] == LUA_TLIGHTUSERDATA))
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -402,52 +414,22 @@ static int lua_Curve_getPointValues(lua_State* state)
     return 0;
 }
 
-static int lua_Curve_getRefCount(lua_State* state)
+int lua_Curve_getStartTime(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                Curve* instance = getInstance(state);
-                unsigned int result = instance->getRefCount();
-
-                // Push the return value onto the stack.
-                lua_pushunsigned(state, result);
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_Curve_getRefCount - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_Curve_getStartTime(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Curve* instance = getInstance(state);
                 float result = instance->getStartTime();
@@ -472,42 +454,15 @@ static int lua_Curve_getStartTime(lua_State* state)
     return 0;
 }
 
-static int lua_Curve_release(lua_State* state)
+int lua_Curve_setPoint(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                Curve* instance = getInstance(state);
-                instance->release();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_Curve_release - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_Curve_setPoint(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[7];
+    for (int i = 0; i < paramCount && i < 7; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
@@ -516,11 +471,11 @@ static int lua_Curve_setPoint(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    (lua_type(state, 4) == LUA_TTABLE || lua_type(state, 4) == LUA_TLIGHTUSERDATA) &&
-                    lua_type(state, 5) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    (paramTypes[3] == LUA_TTABLE || paramTypes[3] == LUA_TLIGHTUSERDATA) &&
+                    paramTypes[4] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -549,13 +504,13 @@ static int lua_Curve_setPoint(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    (lua_type(state, 4) == LUA_TTABLE || lua_type(state, 4) == LUA_TLIGHTUSERDATA) &&
-                    lua_type(state, 5) == LUA_TNUMBER &&
-                    (lua_type(state, 6) == LUA_TTABLE || lua_type(state, 6) == LUA_TLIGHTUSERDATA) &&
-                    (lua_type(state, 7) == LUA_TTABLE || lua_type(state, 7) == LUA_TLIGHTUSERDATA))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    (paramTypes[3] == LUA_TTABLE || paramTypes[3] == LUA_TLIGHTUSERDATA) &&
+                    paramTypes[4] == LUA_TNUMBER &&
+                    (paramTypes[5] == LUA_TTABLE || paramTypes[5] == LUA_TLIGHTUSERDATA) &&
+                    (paramTypes[6] == LUA_TTABLE || paramTypes[6] == LUA_TLIGHTUSERDATA))
                 {
                     // Get parameter 1 off the stack.
                     unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -596,21 +551,26 @@ static int lua_Curve_setPoint(lua_State* state)
     return 0;
 }
 
-static int lua_Curve_setTangent(lua_State* state)
+int lua_Curve_setTangent(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[5];
+    for (int i = 0; i < paramCount && i < 5; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 5:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TNUMBER &&
-                (lua_type(state, 4) == LUA_TTABLE || lua_type(state, 4) == LUA_TLIGHTUSERDATA) &&
-                (lua_type(state, 5) == LUA_TTABLE || lua_type(state, 5) == LUA_TLIGHTUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TNUMBER &&
+                (paramTypes[3] == LUA_TTABLE || paramTypes[3] == LUA_TLIGHTUSERDATA) &&
+                (paramTypes[4] == LUA_TTABLE || paramTypes[4] == LUA_TLIGHTUSERDATA))
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -644,18 +604,23 @@ static int lua_Curve_setTangent(lua_State* state)
     return 0;
 }
 
-static int lua_Curve_static_create(lua_State* state)
+int lua_Curve_static_create(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if (lua_type(state, 1) == LUA_TNUMBER &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if (paramTypes[0] == LUA_TNUMBER &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 1);
@@ -694,19 +659,24 @@ static int lua_Curve_static_create(lua_State* state)
     return 0;
 }
 
-static int lua_Curve_static_lerp(lua_State* state)
+int lua_Curve_static_lerp(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if (lua_type(state, 1) == LUA_TNUMBER &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if (paramTypes[0] == LUA_TNUMBER &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 1);
@@ -787,7 +757,6 @@ void luaRegister_Curve()
 {
     const luaL_Reg lua_members[] = 
     {
-        {"addRef", lua_Curve_addRef},
         {"evaluate", lua_Curve_evaluate},
         {"getComponentCount", lua_Curve_getComponentCount},
         {"getEndTime", lua_Curve_getEndTime},
@@ -795,11 +764,12 @@ void luaRegister_Curve()
         {"getPointInterpolation", lua_Curve_getPointInterpolation},
         {"getPointTime", lua_Curve_getPointTime},
         {"getPointValues", lua_Curve_getPointValues},
-        {"getRefCount", lua_Curve_getRefCount},
         {"getStartTime", lua_Curve_getStartTime},
-        {"release", lua_Curve_release},
         {"setPoint", lua_Curve_setPoint},
         {"setTangent", lua_Curve_setTangent},
+        {"addRef", lua_Ref_addRef},
+        {"getRefCount", lua_Ref_getRefCount},
+        {"release", lua_Ref_release},
         {"to", lua_Curve_to},
         {NULL, NULL}
     };
@@ -27,22 +27,27 @@ extern void luaGlobal_Register_Conversion_Function(const char* className, void*(
 
 static Drawable* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "Drawable");
-    luaL_argcheck(state, userdata != NULL, 1, "'Drawable' expected.");
-    return (Drawable*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "Drawable");
+    luaL_argcheck(state, instance != NULL, 1, "'Drawable' expected.");
+    return (Drawable*)instance;
 }
 
-static int lua_Drawable__gc(lua_State* state)
+int lua_Drawable__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "Drawable");
                 luaL_argcheck(state, userdata != NULL, 1, "'Drawable' expected.");
@@ -70,17 +75,22 @@ static int lua_Drawable__gc(lua_State* state)
     return 0;
 }
 
-static int lua_Drawable_draw(lua_State* state)
+int lua_Drawable_draw(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Drawable* instance = getInstance(state);
                 unsigned int result = instance->draw();
@@ -97,8 +107,8 @@ static int lua_Drawable_draw(lua_State* state)
         }
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TBOOLEAN)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TBOOLEAN)
             {
                 // Get parameter 1 off the stack.
                 bool param1 = gameplay::ScriptUtil::luaCheckBool(state, 2);
@@ -126,17 +136,22 @@ static int lua_Drawable_draw(lua_State* state)
     return 0;
 }
 
-static int lua_Drawable_getNode(lua_State* state)
+int lua_Drawable_getNode(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Drawable* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getNode());
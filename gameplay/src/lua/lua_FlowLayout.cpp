@@ -18,22 +18,27 @@ extern void luaGlobal_Register_Conversion_Function(const char* className, void*(
 
 static FlowLayout* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "FlowLayout");
-    luaL_argcheck(state, userdata != NULL, 1, "'FlowLayout' expected.");
-    return (FlowLayout*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "FlowLayout");
+    luaL_argcheck(state, instance != NULL, 1, "'FlowLayout' expected.");
+    return (FlowLayout*)instance;
 }
 
-static int lua_FlowLayout__gc(lua_State* state)
+int lua_FlowLayout__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "FlowLayout");
                 luaL_argcheck(state, userdata != NULL, 1, "'FlowLayout' expected.");
@@ -61,17 +66,22 @@ static int lua_FlowLayout__gc(lua_State* state)
     return 0;
 }
 
-static int lua_FlowLayout_addRef(lua_State* state)
+int lua_FlowLayout_addRef(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 FlowLayout* instance = getInstance(state);
                 instance->addRef();
@@ -93,17 +103,22 @@ static int lua_FlowLayout_addRef(lua_State* state)
     return 0;
 }
 
-static int lua_FlowLayout_getHorizontalSpacing(lua_State* state)
+int lua_FlowLayout_getHorizontalSpacing(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 FlowLayout* instance = getInstance(state);
                 int result = instance->getHorizontalSpacing();
@@ -128,17 +143,22 @@ static int lua_FlowLayout_getHorizontalSpacing(lua_State* state)
     return 0;
 }
 
-static int lua_FlowLayout_getRefCount(lua_State* state)
+int lua_FlowLayout_getRefCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 FlowLayout* instance = getInstance(state);
                 unsigned int result = instance->getRefCount();
@@ -163,17 +183,22 @@ static int lua_FlowLayout_getRefCount(lua_State* state)
     return 0;
 }
 
-static int lua_FlowLayout_getType(lua_State* state)
+int lua_FlowLayout_getType(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 FlowLayout* instance = getInstance(state);
                 Layout::Type result = instance->getType();
@@ -198,17 +223,22 @@ static int lua_FlowLayout_getType(lua_State* state)
     return 0;
 }
 
-static int lua_FlowLayout_getVerticalSpacing(lua_State* state)
+int lua_FlowLayout_getVerticalSpacing(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 FlowLayout* instance = getInstance(state);
                 int result = instance->getVerticalSpacing();
@@ -233,17 +263,22 @@ static int lua_FlowLayout_getVerticalSpacing(lua_State* state)
     return 0;
 }
 
-static int lua_FlowLayout_release(lua_State* state)
+int lua_FlowLayout_release(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 FlowLayout* instance = getInstance(state);
                 instance->release();
@@ -265,19 +300,24 @@ static int lua_FlowLayout_release(lua_State* state)
     return 0;
 }
 
-static int lua_FlowLayout_setSpacing(lua_State* state)
+int lua_FlowLayout_setSpacing(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 int param1 = (int)luaL_checkint(state, 2);
@@ -13,24 +13,33 @@ namespace gameplay
 
 extern void luaGlobal_Register_Conversion_Function(const char* className, void*(*func)(void*, const char*));
 
+extern int lua_Ref_addRef(lua_State* state);
+extern int lua_Ref_getRefCount(lua_State* state);
+extern int lua_Ref_release(lua_State* state);
+
 static FrameBuffer* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "FrameBuffer");
-    luaL_argcheck(state, userdata != NULL, 1, "'FrameBuffer' expected.");
-    return (FrameBuffer*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "FrameBuffer");
+    luaL_argcheck(state, instance != NULL, 1, "'FrameBuffer' expected.");
+    return (FrameBuffer*)instance;
 }
 
-static int lua_FrameBuffer__gc(lua_State* state)
+int lua_FrameBuffer__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "FrameBuffer");
                 luaL_argcheck(state, userdata != NULL, 1, "'FrameBuffer' expected.");
@@ -58,49 +67,22 @@ static int lua_FrameBuffer__gc(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_addRef(lua_State* state)
+int lua_FrameBuffer_bind(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                FrameBuffer* instance = getInstance(state);
-                instance->addRef();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_FrameBuffer_addRef - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_FrameBuffer_bind(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 FrameBuffer* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->bind());
@@ -126,8 +108,8 @@ static int lua_FrameBuffer_bind(lua_State* state)
         }
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNONE)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNONE)
             {
                 // Get parameter 1 off the stack.
                 GP_WARN("Attempting to get parameter 1 with unrecognized type GLenum as an unsigned integer.");
@@ -165,17 +147,22 @@ static int lua_FrameBuffer_bind(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_getDepthStencilTarget(lua_State* state)
+int lua_FrameBuffer_getDepthStencilTarget(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 FrameBuffer* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getDepthStencilTarget());
@@ -209,17 +196,22 @@ static int lua_FrameBuffer_getDepthStencilTarget(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_getHeight(lua_State* state)
+int lua_FrameBuffer_getHeight(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 FrameBuffer* instance = getInstance(state);
                 unsigned int result = instance->getHeight();
@@ -244,17 +236,22 @@ static int lua_FrameBuffer_getHeight(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_getId(lua_State* state)
+int lua_FrameBuffer_getId(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 FrameBuffer* instance = getInstance(state);
                 const char* result = instance->getId();
@@ -279,52 +276,22 @@ static int lua_FrameBuffer_getId(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_getRefCount(lua_State* state)
+int lua_FrameBuffer_getRenderTarget(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                FrameBuffer* instance = getInstance(state);
-                unsigned int result = instance->getRefCount();
-
-                // Push the return value onto the stack.
-                lua_pushunsigned(state, result);
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_FrameBuffer_getRefCount - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_FrameBuffer_getRenderTarget(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 FrameBuffer* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getRenderTarget());
@@ -350,8 +317,8 @@ static int lua_FrameBuffer_getRenderTarget(lua_State* state)
         }
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -388,17 +355,22 @@ static int lua_FrameBuffer_getRenderTarget(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_getRenderTargetCount(lua_State* state)
+int lua_FrameBuffer_getRenderTargetCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 FrameBuffer* instance = getInstance(state);
                 unsigned int result = instance->getRenderTargetCount();
@@ -423,17 +395,22 @@ static int lua_FrameBuffer_getRenderTargetCount(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_getWidth(lua_State* state)
+int lua_FrameBuffer_getWidth(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 FrameBuffer* instance = getInstance(state);
                 unsigned int result = instance->getWidth();
@@ -458,17 +435,22 @@ static int lua_FrameBuffer_getWidth(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_isDefault(lua_State* state)
+int lua_FrameBuffer_isDefault(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 FrameBuffer* instance = getInstance(state);
                 bool result = instance->isDefault();
@@ -493,50 +475,23 @@ static int lua_FrameBuffer_isDefault(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_release(lua_State* state)
+int lua_FrameBuffer_setDepthStencilTarget(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                FrameBuffer* instance = getInstance(state);
-                instance->release();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_FrameBuffer_release - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_FrameBuffer_setDepthStencilTarget(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -567,11 +522,16 @@ static int lua_FrameBuffer_setDepthStencilTarget(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_setRenderTarget(lua_State* state)
+int lua_FrameBuffer_setRenderTarget(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -579,8 +539,8 @@ static int lua_FrameBuffer_setRenderTarget(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -603,9 +563,9 @@ static int lua_FrameBuffer_setRenderTarget(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                    lua_type(state, 3) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL) &&
+                    paramTypes[2] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -625,9 +585,9 @@ static int lua_FrameBuffer_setRenderTarget(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                    lua_type(state, 3) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL) &&
+                    paramTypes[2] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -653,10 +613,10 @@ static int lua_FrameBuffer_setRenderTarget(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL) &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -691,11 +651,16 @@ static int lua_FrameBuffer_setRenderTarget(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_static_bindDefault(lua_State* state)
+int lua_FrameBuffer_static_bindDefault(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -720,7 +685,7 @@ static int lua_FrameBuffer_static_bindDefault(lua_State* state)
         }
         case 1:
         {
-            if (lua_type(state, 1) == LUA_TNONE)
+            if (paramTypes[0] == LUA_TNONE)
             {
                 // Get parameter 1 off the stack.
                 GP_WARN("Attempting to get parameter 1 with unrecognized type GLenum as an unsigned integer.");
@@ -757,11 +722,16 @@ static int lua_FrameBuffer_static_bindDefault(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_static_create(lua_State* state)
+int lua_FrameBuffer_static_create(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -769,7 +739,7 @@ static int lua_FrameBuffer_static_create(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TSTRING || lua_type(state, 1) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TSTRING || paramTypes[0] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(1, false);
@@ -800,9 +770,9 @@ static int lua_FrameBuffer_static_create(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TSTRING || lua_type(state, 1) == LUA_TNIL) &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TSTRING || paramTypes[0] == LUA_TNIL) &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(1, false);
@@ -839,10 +809,10 @@ static int lua_FrameBuffer_static_create(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TSTRING || lua_type(state, 1) == LUA_TNIL) &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TSTRING || paramTypes[0] == LUA_TNIL) &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(1, false);
@@ -888,11 +858,16 @@ static int lua_FrameBuffer_static_create(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_static_createScreenshot(lua_State* state)
+int lua_FrameBuffer_static_createScreenshot(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -917,7 +892,7 @@ static int lua_FrameBuffer_static_createScreenshot(lua_State* state)
         }
         case 1:
         {
-            if (lua_type(state, 1) == LUA_TNUMBER)
+            if (paramTypes[0] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 Image::Format param1 = (Image::Format)luaL_checkint(state, 1);
@@ -953,7 +928,7 @@ static int lua_FrameBuffer_static_createScreenshot(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_static_getCurrent(lua_State* state)
+int lua_FrameBuffer_static_getCurrent(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -990,17 +965,22 @@ static int lua_FrameBuffer_static_getCurrent(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_static_getFrameBuffer(lua_State* state)
+int lua_FrameBuffer_static_getFrameBuffer(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TSTRING || lua_type(state, 1) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TSTRING || paramTypes[0] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(1, false);
@@ -1036,7 +1016,7 @@ static int lua_FrameBuffer_static_getFrameBuffer(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_static_getMaxRenderTargets(lua_State* state)
+int lua_FrameBuffer_static_getMaxRenderTargets(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -1064,17 +1044,22 @@ static int lua_FrameBuffer_static_getMaxRenderTargets(lua_State* state)
     return 0;
 }
 
-static int lua_FrameBuffer_static_getScreenshot(lua_State* state)
+int lua_FrameBuffer_static_getScreenshot(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TTABLE || lua_type(state, 1) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TTABLE || paramTypes[0] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -1152,19 +1137,19 @@ void luaRegister_FrameBuffer()
 {
     const luaL_Reg lua_members[] = 
     {
-        {"addRef", lua_FrameBuffer_addRef},
         {"bind", lua_FrameBuffer_bind},
         {"getDepthStencilTarget", lua_FrameBuffer_getDepthStencilTarget},
         {"getHeight", lua_FrameBuffer_getHeight},
         {"getId", lua_FrameBuffer_getId},
-        {"getRefCount", lua_FrameBuffer_getRefCount},
         {"getRenderTarget", lua_FrameBuffer_getRenderTarget},
         {"getRenderTargetCount", lua_FrameBuffer_getRenderTargetCount},
         {"getWidth", lua_FrameBuffer_getWidth},
         {"isDefault", lua_FrameBuffer_isDefault},
-        {"release", lua_FrameBuffer_release},
         {"setDepthStencilTarget", lua_FrameBuffer_setDepthStencilTarget},
         {"setRenderTarget", lua_FrameBuffer_setRenderTarget},
+        {"addRef", lua_Ref_addRef},
+        {"getRefCount", lua_Ref_getRefCount},
+        {"release", lua_Ref_release},
         {"to", lua_FrameBuffer_to},
         {NULL, NULL}
     };
@@ -15,22 +15,27 @@ namespace gameplay
 
 static Gamepad* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "Gamepad");
-    luaL_argcheck(state, userdata != NULL, 1, "'Gamepad' expected.");
-    return (Gamepad*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "Gamepad");
+    luaL_argcheck(state, instance != NULL, 1, "'Gamepad' expected.");
+    return (Gamepad*)instance;
 }
 
-static int lua_Gamepad_draw(lua_State* state)
+int lua_Gamepad_draw(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Gamepad* instance = getInstance(state);
                 instance->draw();
@@ -52,17 +57,22 @@ static int lua_Gamepad_draw(lua_State* state)
     return 0;
 }
 
-static int lua_Gamepad_getButtonCount(lua_State* state)
+int lua_Gamepad_getButtonCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Gamepad* instance = getInstance(state);
                 unsigned int result = instance->getButtonCount();
@@ -87,17 +97,22 @@ static int lua_Gamepad_getButtonCount(lua_State* state)
     return 0;
 }
 
-static int lua_Gamepad_getForm(lua_State* state)
+int lua_Gamepad_getForm(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Gamepad* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getForm());
@@ -131,17 +146,22 @@ static int lua_Gamepad_getForm(lua_State* state)
     return 0;
 }
 
-static int lua_Gamepad_getJoystickCount(lua_State* state)
+int lua_Gamepad_getJoystickCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Gamepad* instance = getInstance(state);
                 unsigned int result = instance->getJoystickCount();
@@ -166,19 +186,24 @@ static int lua_Gamepad_getJoystickCount(lua_State* state)
     return 0;
 }
 
-static int lua_Gamepad_getJoystickValues(lua_State* state)
+int lua_Gamepad_getJoystickValues(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TTABLE || lua_type(state, 3) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TTABLE || paramTypes[2] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -212,17 +237,22 @@ static int lua_Gamepad_getJoystickValues(lua_State* state)
     return 0;
 }
 
-static int lua_Gamepad_getName(lua_State* state)
+int lua_Gamepad_getName(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Gamepad* instance = getInstance(state);
                 const char* result = instance->getName();
@@ -247,17 +277,22 @@ static int lua_Gamepad_getName(lua_State* state)
     return 0;
 }
 
-static int lua_Gamepad_getTriggerCount(lua_State* state)
+int lua_Gamepad_getTriggerCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Gamepad* instance = getInstance(state);
                 unsigned int result = instance->getTriggerCount();
@@ -282,18 +317,23 @@ static int lua_Gamepad_getTriggerCount(lua_State* state)
     return 0;
 }
 
-static int lua_Gamepad_getTriggerValue(lua_State* state)
+int lua_Gamepad_getTriggerValue(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -321,18 +361,23 @@ static int lua_Gamepad_getTriggerValue(lua_State* state)
     return 0;
 }
 
-static int lua_Gamepad_isButtonDown(lua_State* state)
+int lua_Gamepad_isButtonDown(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 Gamepad::ButtonMapping param1 = (Gamepad::ButtonMapping)luaL_checkint(state, 2);
@@ -360,17 +405,22 @@ static int lua_Gamepad_isButtonDown(lua_State* state)
     return 0;
 }
 
-static int lua_Gamepad_isVirtual(lua_State* state)
+int lua_Gamepad_isVirtual(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Gamepad* instance = getInstance(state);
                 bool result = instance->isVirtual();
@@ -395,18 +445,23 @@ static int lua_Gamepad_isVirtual(lua_State* state)
     return 0;
 }
 
-static int lua_Gamepad_update(lua_State* state)
+int lua_Gamepad_update(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
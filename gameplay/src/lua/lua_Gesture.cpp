@@ -9,22 +9,27 @@ namespace gameplay
 
 static Gesture* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "Gesture");
-    luaL_argcheck(state, userdata != NULL, 1, "'Gesture' expected.");
-    return (Gesture*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "Gesture");
+    luaL_argcheck(state, instance != NULL, 1, "'Gesture' expected.");
+    return (Gesture*)instance;
 }
 
-static int lua_Gesture__gc(lua_State* state)
+int lua_Gesture__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "Gesture");
                 luaL_argcheck(state, userdata != NULL, 1, "'Gesture' expected.");
@@ -52,7 +57,7 @@ static int lua_Gesture__gc(lua_State* state)
     return 0;
 }
 
-static int lua_Gesture_static_SWIPE_DIRECTION_DOWN(lua_State* state)
+int lua_Gesture_static_SWIPE_DIRECTION_DOWN(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 0)
@@ -69,7 +74,7 @@ static int lua_Gesture_static_SWIPE_DIRECTION_DOWN(lua_State* state)
     return 1;
 }
 
-static int lua_Gesture_static_SWIPE_DIRECTION_LEFT(lua_State* state)
+int lua_Gesture_static_SWIPE_DIRECTION_LEFT(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 0)
@@ -86,7 +91,7 @@ static int lua_Gesture_static_SWIPE_DIRECTION_LEFT(lua_State* state)
     return 1;
 }
 
-static int lua_Gesture_static_SWIPE_DIRECTION_RIGHT(lua_State* state)
+int lua_Gesture_static_SWIPE_DIRECTION_RIGHT(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 0)
@@ -103,7 +108,7 @@ static int lua_Gesture_static_SWIPE_DIRECTION_RIGHT(lua_State* state)
     return 1;
 }
 
-static int lua_Gesture_static_SWIPE_DIRECTION_UP(lua_State* state)
+int lua_Gesture_static_SWIPE_DIRECTION_UP(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 0)
@@ -473,6 +473,16 @@ void luaRegister_lua_Global()
         gameplay::ScriptUtil::registerEnumValue(Game::CLEAR_COLOR_DEPTH_STENCIL, "CLEAR_COLOR_DEPTH_STENCIL", scopePath);
     }
 
+    // Register enumeration Game::PerformanceLevel.
+    {
+        std::vector<std::string> scopePath;
+        scopePath.push_back("Game");
+        gameplay::ScriptUtil::registerEnumValue(Game::PERFORMANCE_FULL, "PERFORMANCE_FULL", scopePath);
+        gameplay::ScriptUtil::registerEnumValue(Game::PERFORMANCE_SUSTAINED, "PERFORMANCE_SUSTAINED", scopePath);
+        gameplay::ScriptUtil::registerEnumValue(Game::PERFORMANCE_REDUCED, "PERFORMANCE_REDUCED", scopePath);
+        gameplay::ScriptUtil::registerEnumValue(Game::PERFORMANCE_MINIMAL, "PERFORMANCE_MINIMAL", scopePath);
+    }
+
     // Register enumeration Game::State.
     {
         std::vector<std::string> scopePath;
@@ -1114,13 +1124,18 @@ int lua__strcmpnocase(lua_State* state)
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TSTRING || lua_type(state, 1) == LUA_TNIL) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TSTRING || paramTypes[0] == LUA_TNIL) &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(1, false);
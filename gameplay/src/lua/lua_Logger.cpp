@@ -12,22 +12,27 @@ namespace gameplay
 
 static Logger* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "Logger");
-    luaL_argcheck(state, userdata != NULL, 1, "'Logger' expected.");
-    return (Logger*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "Logger");
+    luaL_argcheck(state, instance != NULL, 1, "'Logger' expected.");
+    return (Logger*)instance;
 }
 
-static int lua_Logger_static_isEnabled(lua_State* state)
+int lua_Logger_static_isEnabled(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if (lua_type(state, 1) == LUA_TNUMBER)
+            if (paramTypes[0] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 Logger::Level param1 = (Logger::Level)luaL_checkint(state, 1);
@@ -54,18 +59,23 @@ static int lua_Logger_static_isEnabled(lua_State* state)
     return 0;
 }
 
-static int lua_Logger_static_log(lua_State* state)
+int lua_Logger_static_log(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if (lua_type(state, 1) == LUA_TNUMBER &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+            if (paramTypes[0] == LUA_TNUMBER &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 Logger::Level param1 = (Logger::Level)luaL_checkint(state, 1);
@@ -92,18 +102,23 @@ static int lua_Logger_static_log(lua_State* state)
     return 0;
 }
 
-static int lua_Logger_static_set(lua_State* state)
+int lua_Logger_static_set(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if (lua_type(state, 1) == LUA_TNUMBER &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+            if (paramTypes[0] == LUA_TNUMBER &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 Logger::Level param1 = (Logger::Level)luaL_checkint(state, 1);
@@ -130,18 +145,23 @@ static int lua_Logger_static_set(lua_State* state)
     return 0;
 }
 
-static int lua_Logger_static_setEnabled(lua_State* state)
+int lua_Logger_static_setEnabled(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if (lua_type(state, 1) == LUA_TNUMBER &&
-                lua_type(state, 2) == LUA_TBOOLEAN)
+            if (paramTypes[0] == LUA_TNUMBER &&
+                paramTypes[1] == LUA_TBOOLEAN)
             {
                 // Get parameter 1 off the stack.
                 Logger::Level param1 = (Logger::Level)luaL_checkint(state, 1);
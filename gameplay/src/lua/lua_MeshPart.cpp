@@ -10,22 +10,27 @@ namespace gameplay
 
 static MeshPart* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "MeshPart");
-    luaL_argcheck(state, userdata != NULL, 1, "'MeshPart' expected.");
-    return (MeshPart*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "MeshPart");
+    luaL_argcheck(state, instance != NULL, 1, "'MeshPart' expected.");
+    return (MeshPart*)instance;
 }
 
-static int lua_MeshPart__gc(lua_State* state)
+int lua_MeshPart__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "MeshPart");
                 luaL_argcheck(state, userdata != NULL, 1, "'MeshPart' expected.");
@@ -53,17 +58,22 @@ static int lua_MeshPart__gc(lua_State* state)
     return 0;
 }
 
-static int lua_MeshPart_getIndexBuffer(lua_State* state)
+int lua_MeshPart_getIndexBuffer(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 MeshPart* instance = getInstance(state);
                 void* returnPtr = (void*)new GLuint(instance->getIndexBuffer());
@@ -97,17 +107,22 @@ static int lua_MeshPart_getIndexBuffer(lua_State* state)
     return 0;
 }
 
-static int lua_MeshPart_getIndexCount(lua_State* state)
+int lua_MeshPart_getIndexCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 MeshPart* instance = getInstance(state);
                 unsigned int result = instance->getIndexCount();
@@ -132,17 +147,22 @@ static int lua_MeshPart_getIndexCount(lua_State* state)
     return 0;
 }
 
-static int lua_MeshPart_getIndexFormat(lua_State* state)
+int lua_MeshPart_getIndexFormat(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 MeshPart* instance = getInstance(state);
                 Mesh::IndexFormat result = instance->getIndexFormat();
@@ -167,17 +187,22 @@ static int lua_MeshPart_getIndexFormat(lua_State* state)
     return 0;
 }
 
-static int lua_MeshPart_getMeshIndex(lua_State* state)
+int lua_MeshPart_getMeshIndex(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 MeshPart* instance = getInstance(state);
                 unsigned int result = instance->getMeshIndex();
@@ -202,17 +227,22 @@ static int lua_MeshPart_getMeshIndex(lua_State* state)
     return 0;
 }
 
-static int lua_MeshPart_getPrimitiveType(lua_State* state)
+int lua_MeshPart_getPrimitiveType(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 MeshPart* instance = getInstance(state);
                 Mesh::PrimitiveType result = instance->getPrimitiveType();
@@ -237,17 +267,22 @@ static int lua_MeshPart_getPrimitiveType(lua_State* state)
     return 0;
 }
 
-static int lua_MeshPart_isDynamic(lua_State* state)
+int lua_MeshPart_isDynamic(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 MeshPart* instance = getInstance(state);
                 bool result = instance->isDynamic();
@@ -23,22 +23,27 @@ extern void luaGlobal_Register_Conversion_Function(const char* className, void*(
 
 static MeshSkin* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "MeshSkin");
-    luaL_argcheck(state, userdata != NULL, 1, "'MeshSkin' expected.");
-    return (MeshSkin*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "MeshSkin");
+    luaL_argcheck(state, instance != NULL, 1, "'MeshSkin' expected.");
+    return (MeshSkin*)instance;
 }
 
-static int lua_MeshSkin_getBindShape(lua_State* state)
+int lua_MeshSkin_getBindShape(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 MeshSkin* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getBindShape());
@@ -72,11 +77,16 @@ static int lua_MeshSkin_getBindShape(lua_State* state)
     return 0;
 }
 
-static int lua_MeshSkin_getJoint(lua_State* state)
+int lua_MeshSkin_getJoint(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -84,8 +94,8 @@ static int lua_MeshSkin_getJoint(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    lua_type(state, 2) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    paramTypes[1] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -111,8 +121,8 @@ static int lua_MeshSkin_getJoint(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -150,17 +160,22 @@ static int lua_MeshSkin_getJoint(lua_State* state)
     return 0;
 }
 
-static int lua_MeshSkin_getJointCount(lua_State* state)
+int lua_MeshSkin_getJointCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 MeshSkin* instance = getInstance(state);
                 unsigned int result = instance->getJointCount();
@@ -185,18 +200,23 @@ static int lua_MeshSkin_getJointCount(lua_State* state)
     return 0;
 }
 
-static int lua_MeshSkin_getJointIndex(lua_State* state)
+int lua_MeshSkin_getJointIndex(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -230,17 +250,22 @@ static int lua_MeshSkin_getJointIndex(lua_State* state)
     return 0;
 }
 
-static int lua_MeshSkin_getMatrixPalette(lua_State* state)
+int lua_MeshSkin_getMatrixPalette(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 MeshSkin* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getMatrixPalette());
@@ -274,17 +299,22 @@ static int lua_MeshSkin_getMatrixPalette(lua_State* state)
     return 0;
 }
 
-static int lua_MeshSkin_getMatrixPaletteSize(lua_State* state)
+int lua_MeshSkin_getMatrixPaletteSize(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 MeshSkin* instance = getInstance(state);
                 unsigned int result = instance->getMatrixPaletteSize();
@@ -309,17 +339,22 @@ static int lua_MeshSkin_getMatrixPaletteSize(lua_State* state)
     return 0;
 }
 
-static int lua_MeshSkin_getModel(lua_State* state)
+int lua_MeshSkin_getModel(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 MeshSkin* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getModel());
@@ -353,17 +388,22 @@ static int lua_MeshSkin_getModel(lua_State* state)
     return 0;
 }
 
-static int lua_MeshSkin_getRootJoint(lua_State* state)
+int lua_MeshSkin_getRootJoint(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 MeshSkin* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getRootJoint());
@@ -397,18 +437,23 @@ static int lua_MeshSkin_getRootJoint(lua_State* state)
     return 0;
 }
 
-static int lua_MeshSkin_setBindShape(lua_State* state)
+int lua_MeshSkin_setBindShape(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TLIGHTUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TLIGHTUSERDATA))
             {
                 // Get parameter 1 off the stack.
                 gameplay::ScriptUtil::LuaArray<float> param1 = gameplay::ScriptUtil::getFloatPointer(2);
@@ -433,18 +478,23 @@ static int lua_MeshSkin_setBindShape(lua_State* state)
     return 0;
 }
 
-static int lua_MeshSkin_setRootJoint(lua_State* state)
+int lua_MeshSkin_setRootJoint(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -475,19 +525,24 @@ static int lua_MeshSkin_setRootJoint(lua_State* state)
     return 0;
 }
 
-static int lua_MeshSkin_transformChanged(lua_State* state)
+int lua_MeshSkin_transformChanged(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL) &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
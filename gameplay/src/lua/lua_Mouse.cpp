@@ -9,22 +9,27 @@ namespace gameplay
 
 static Mouse* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "Mouse");
-    luaL_argcheck(state, userdata != NULL, 1, "'Mouse' expected.");
-    return (Mouse*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "Mouse");
+    luaL_argcheck(state, instance != NULL, 1, "'Mouse' expected.");
+    return (Mouse*)instance;
 }
 
-static int lua_Mouse__gc(lua_State* state)
+int lua_Mouse__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "Mouse");
                 luaL_argcheck(state, userdata != NULL, 1, "'Mouse' expected.");
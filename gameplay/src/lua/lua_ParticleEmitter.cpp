@@ -19,24 +19,34 @@ namespace gameplay
 
 extern void luaGlobal_Register_Conversion_Function(const char* className, void*(*func)(void*, const char*));
 
+extern int lua_Ref_addRef(lua_State* state);
+extern int lua_Drawable_getNode(lua_State* state);
+extern int lua_Ref_getRefCount(lua_State* state);
+extern int lua_Ref_release(lua_State* state);
+
 static ParticleEmitter* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "ParticleEmitter");
-    luaL_argcheck(state, userdata != NULL, 1, "'ParticleEmitter' expected.");
-    return (ParticleEmitter*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "ParticleEmitter");
+    luaL_argcheck(state, instance != NULL, 1, "'ParticleEmitter' expected.");
+    return (ParticleEmitter*)instance;
 }
 
-static int lua_ParticleEmitter__gc(lua_State* state)
+int lua_ParticleEmitter__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "ParticleEmitter");
                 luaL_argcheck(state, userdata != NULL, 1, "'ParticleEmitter' expected.");
@@ -64,49 +74,22 @@ static int lua_ParticleEmitter__gc(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_addRef(lua_State* state)
+int lua_ParticleEmitter_draw(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                ParticleEmitter* instance = getInstance(state);
-                instance->addRef();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_ParticleEmitter_addRef - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_ParticleEmitter_draw(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 unsigned int result = instance->draw();
@@ -123,8 +106,8 @@ static int lua_ParticleEmitter_draw(lua_State* state)
         }
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TBOOLEAN)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TBOOLEAN)
             {
                 // Get parameter 1 off the stack.
                 bool param1 = gameplay::ScriptUtil::luaCheckBool(state, 2);
@@ -152,18 +135,23 @@ static int lua_ParticleEmitter_draw(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_emitOnce(lua_State* state)
+int lua_ParticleEmitter_emitOnce(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -188,17 +176,22 @@ static int lua_ParticleEmitter_emitOnce(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getAcceleration(lua_State* state)
+int lua_ParticleEmitter_getAcceleration(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getAcceleration());
@@ -232,17 +225,22 @@ static int lua_ParticleEmitter_getAcceleration(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getAccelerationVariance(lua_State* state)
+int lua_ParticleEmitter_getAccelerationVariance(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getAccelerationVariance());
@@ -276,17 +274,22 @@ static int lua_ParticleEmitter_getAccelerationVariance(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getBlendMode(lua_State* state)
+int lua_ParticleEmitter_getBlendMode(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 ParticleEmitter::BlendMode result = instance->getBlendMode();
@@ -311,17 +314,22 @@ static int lua_ParticleEmitter_getBlendMode(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getColorEnd(lua_State* state)
+int lua_ParticleEmitter_getColorEnd(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getColorEnd());
@@ -355,17 +363,22 @@ static int lua_ParticleEmitter_getColorEnd(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getColorEndVariance(lua_State* state)
+int lua_ParticleEmitter_getColorEndVariance(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getColorEndVariance());
@@ -399,17 +412,22 @@ static int lua_ParticleEmitter_getColorEndVariance(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getColorStart(lua_State* state)
+int lua_ParticleEmitter_getColorStart(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getColorStart());
@@ -443,17 +461,22 @@ static int lua_ParticleEmitter_getColorStart(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getColorStartVariance(lua_State* state)
+int lua_ParticleEmitter_getColorStartVariance(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getColorStartVariance());
@@ -487,17 +510,22 @@ static int lua_ParticleEmitter_getColorStartVariance(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getEmissionRate(lua_State* state)
+int lua_ParticleEmitter_getEmissionRate(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 unsigned int result = instance->getEmissionRate();
@@ -522,17 +550,22 @@ static int lua_ParticleEmitter_getEmissionRate(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getEnergyMax(lua_State* state)
+int lua_ParticleEmitter_getEnergyMax(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 long result = instance->getEnergyMax();
@@ -557,17 +590,22 @@ static int lua_ParticleEmitter_getEnergyMax(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getEnergyMin(lua_State* state)
+int lua_ParticleEmitter_getEnergyMin(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 long result = instance->getEnergyMin();
@@ -592,61 +630,22 @@ static int lua_ParticleEmitter_getEnergyMin(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getNode(lua_State* state)
+int lua_ParticleEmitter_getOrbitAcceleration(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                ParticleEmitter* instance = getInstance(state);
-                void* returnPtr = ((void*)instance->getNode());
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = false;
-                    luaL_getmetatable(state, "Node");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_ParticleEmitter_getNode - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_ParticleEmitter_getOrbitAcceleration(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 bool result = instance->getOrbitAcceleration();
@@ -671,17 +670,22 @@ static int lua_ParticleEmitter_getOrbitAcceleration(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getOrbitPosition(lua_State* state)
+int lua_ParticleEmitter_getOrbitPosition(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 bool result = instance->getOrbitPosition();
@@ -706,17 +710,22 @@ static int lua_ParticleEmitter_getOrbitPosition(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getOrbitVelocity(lua_State* state)
+int lua_ParticleEmitter_getOrbitVelocity(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 bool result = instance->getOrbitVelocity();
@@ -741,17 +750,22 @@ static int lua_ParticleEmitter_getOrbitVelocity(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getParticleCountMax(lua_State* state)
+int lua_ParticleEmitter_getParticleCountMax(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 unsigned int result = instance->getParticleCountMax();
@@ -776,17 +790,22 @@ static int lua_ParticleEmitter_getParticleCountMax(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getParticlesCount(lua_State* state)
+int lua_ParticleEmitter_getParticlesCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 unsigned int result = instance->getParticlesCount();
@@ -811,17 +830,22 @@ static int lua_ParticleEmitter_getParticlesCount(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getPosition(lua_State* state)
+int lua_ParticleEmitter_getPosition(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getPosition());
@@ -855,17 +879,22 @@ static int lua_ParticleEmitter_getPosition(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getPositionVariance(lua_State* state)
+int lua_ParticleEmitter_getPositionVariance(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getPositionVariance());
@@ -899,52 +928,22 @@ static int lua_ParticleEmitter_getPositionVariance(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getRefCount(lua_State* state)
+int lua_ParticleEmitter_getRotationAxis(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                ParticleEmitter* instance = getInstance(state);
-                unsigned int result = instance->getRefCount();
-
-                // Push the return value onto the stack.
-                lua_pushunsigned(state, result);
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_ParticleEmitter_getRefCount - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_ParticleEmitter_getRotationAxis(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getRotationAxis());
@@ -978,17 +977,22 @@ static int lua_ParticleEmitter_getRotationAxis(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getRotationAxisVariance(lua_State* state)
+int lua_ParticleEmitter_getRotationAxisVariance(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getRotationAxisVariance());
@@ -1022,17 +1026,22 @@ static int lua_ParticleEmitter_getRotationAxisVariance(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getRotationPerParticleSpeedMax(lua_State* state)
+int lua_ParticleEmitter_getRotationPerParticleSpeedMax(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 float result = instance->getRotationPerParticleSpeedMax();
@@ -1057,17 +1066,22 @@ static int lua_ParticleEmitter_getRotationPerParticleSpeedMax(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getRotationPerParticleSpeedMin(lua_State* state)
+int lua_ParticleEmitter_getRotationPerParticleSpeedMin(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 float result = instance->getRotationPerParticleSpeedMin();
@@ -1092,17 +1106,22 @@ static int lua_ParticleEmitter_getRotationPerParticleSpeedMin(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getRotationSpeedMax(lua_State* state)
+int lua_ParticleEmitter_getRotationSpeedMax(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 float result = instance->getRotationSpeedMax();
@@ -1127,17 +1146,22 @@ static int lua_ParticleEmitter_getRotationSpeedMax(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getRotationSpeedMin(lua_State* state)
+int lua_ParticleEmitter_getRotationSpeedMin(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 float result = instance->getRotationSpeedMin();
@@ -1162,17 +1186,22 @@ static int lua_ParticleEmitter_getRotationSpeedMin(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getSizeEndMax(lua_State* state)
+int lua_ParticleEmitter_getSizeEndMax(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 float result = instance->getSizeEndMax();
@@ -1197,17 +1226,22 @@ static int lua_ParticleEmitter_getSizeEndMax(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getSizeEndMin(lua_State* state)
+int lua_ParticleEmitter_getSizeEndMin(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 float result = instance->getSizeEndMin();
@@ -1232,17 +1266,22 @@ static int lua_ParticleEmitter_getSizeEndMin(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getSizeStartMax(lua_State* state)
+int lua_ParticleEmitter_getSizeStartMax(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 float result = instance->getSizeStartMax();
@@ -1267,17 +1306,22 @@ static int lua_ParticleEmitter_getSizeStartMax(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getSizeStartMin(lua_State* state)
+int lua_ParticleEmitter_getSizeStartMin(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 float result = instance->getSizeStartMin();
@@ -1302,17 +1346,22 @@ static int lua_ParticleEmitter_getSizeStartMin(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getSpriteFrameCount(lua_State* state)
+int lua_ParticleEmitter_getSpriteFrameCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 unsigned int result = instance->getSpriteFrameCount();
@@ -1337,17 +1386,22 @@ static int lua_ParticleEmitter_getSpriteFrameCount(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getSpriteFrameDuration(lua_State* state)
+int lua_ParticleEmitter_getSpriteFrameDuration(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 long result = instance->getSpriteFrameDuration();
@@ -1372,17 +1426,22 @@ static int lua_ParticleEmitter_getSpriteFrameDuration(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getSpriteFrameRandomOffset(lua_State* state)
+int lua_ParticleEmitter_getSpriteFrameRandomOffset(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 int result = instance->getSpriteFrameRandomOffset();
@@ -1407,17 +1466,22 @@ static int lua_ParticleEmitter_getSpriteFrameRandomOffset(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getSpriteHeight(lua_State* state)
+int lua_ParticleEmitter_getSpriteHeight(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 unsigned int result = instance->getSpriteHeight();
@@ -1442,17 +1506,22 @@ static int lua_ParticleEmitter_getSpriteHeight(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getSpriteWidth(lua_State* state)
+int lua_ParticleEmitter_getSpriteWidth(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 unsigned int result = instance->getSpriteWidth();
@@ -1477,17 +1546,22 @@ static int lua_ParticleEmitter_getSpriteWidth(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getTexture(lua_State* state)
+int lua_ParticleEmitter_getTexture(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getTexture());
@@ -1521,17 +1595,22 @@ static int lua_ParticleEmitter_getTexture(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getVelocity(lua_State* state)
+int lua_ParticleEmitter_getVelocity(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getVelocity());
@@ -1565,17 +1644,22 @@ static int lua_ParticleEmitter_getVelocity(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_getVelocityVariance(lua_State* state)
+int lua_ParticleEmitter_getVelocityVariance(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getVelocityVariance());
@@ -1609,17 +1693,22 @@ static int lua_ParticleEmitter_getVelocityVariance(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_isActive(lua_State* state)
+int lua_ParticleEmitter_isActive(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 bool result = instance->isActive();
@@ -1644,17 +1733,22 @@ static int lua_ParticleEmitter_isActive(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_isEllipsoid(lua_State* state)
+int lua_ParticleEmitter_isEllipsoid(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 bool result = instance->isEllipsoid();
@@ -1679,17 +1773,22 @@ static int lua_ParticleEmitter_isEllipsoid(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_isSpriteAnimated(lua_State* state)
+int lua_ParticleEmitter_isSpriteAnimated(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 bool result = instance->isSpriteAnimated();
@@ -1714,17 +1813,22 @@ static int lua_ParticleEmitter_isSpriteAnimated(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_isSpriteLooped(lua_State* state)
+int lua_ParticleEmitter_isSpriteLooped(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 bool result = instance->isSpriteLooped();
@@ -1749,17 +1853,22 @@ static int lua_ParticleEmitter_isSpriteLooped(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_isStarted(lua_State* state)
+int lua_ParticleEmitter_isStarted(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 bool result = instance->isStarted();
@@ -1784,51 +1893,24 @@ static int lua_ParticleEmitter_isStarted(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_release(lua_State* state)
+int lua_ParticleEmitter_setAcceleration(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                ParticleEmitter* instance = getInstance(state);
-                instance->release();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_ParticleEmitter_release - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_ParticleEmitter_setAcceleration(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL) &&
-                (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL) &&
+                (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -1868,18 +1950,23 @@ static int lua_ParticleEmitter_setAcceleration(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setBlendMode(lua_State* state)
+int lua_ParticleEmitter_setBlendMode(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 ParticleEmitter::BlendMode param1 = (ParticleEmitter::BlendMode)luaL_checkint(state, 2);
@@ -1904,21 +1991,26 @@ static int lua_ParticleEmitter_setBlendMode(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setColor(lua_State* state)
+int lua_ParticleEmitter_setColor(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[5];
+    for (int i = 0; i < paramCount && i < 5; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 5:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL) &&
-                (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TNIL) &&
-                (lua_type(state, 4) == LUA_TUSERDATA || lua_type(state, 4) == LUA_TNIL) &&
-                (lua_type(state, 5) == LUA_TUSERDATA || lua_type(state, 5) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL) &&
+                (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TNIL) &&
+                (paramTypes[3] == LUA_TUSERDATA || paramTypes[3] == LUA_TNIL) &&
+                (paramTypes[4] == LUA_TUSERDATA || paramTypes[4] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -1976,18 +2068,23 @@ static int lua_ParticleEmitter_setColor(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setEllipsoid(lua_State* state)
+int lua_ParticleEmitter_setEllipsoid(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TBOOLEAN)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TBOOLEAN)
             {
                 // Get parameter 1 off the stack.
                 bool param1 = gameplay::ScriptUtil::luaCheckBool(state, 2);
@@ -2012,18 +2109,23 @@ static int lua_ParticleEmitter_setEllipsoid(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setEmissionRate(lua_State* state)
+int lua_ParticleEmitter_setEmissionRate(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -2048,19 +2150,24 @@ static int lua_ParticleEmitter_setEmissionRate(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setEnergy(lua_State* state)
+int lua_ParticleEmitter_setEnergy(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 long param1 = (long)luaL_checklong(state, 2);
@@ -2088,20 +2195,25 @@ static int lua_ParticleEmitter_setEnergy(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setOrbit(lua_State* state)
+int lua_ParticleEmitter_setOrbit(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 4:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TBOOLEAN &&
-                lua_type(state, 3) == LUA_TBOOLEAN &&
-                lua_type(state, 4) == LUA_TBOOLEAN)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TBOOLEAN &&
+                paramTypes[2] == LUA_TBOOLEAN &&
+                paramTypes[3] == LUA_TBOOLEAN)
             {
                 // Get parameter 1 off the stack.
                 bool param1 = gameplay::ScriptUtil::luaCheckBool(state, 2);
@@ -2132,18 +2244,23 @@ static int lua_ParticleEmitter_setOrbit(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setParticleCountMax(lua_State* state)
+int lua_ParticleEmitter_setParticleCountMax(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -2168,19 +2285,24 @@ static int lua_ParticleEmitter_setParticleCountMax(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setPosition(lua_State* state)
+int lua_ParticleEmitter_setPosition(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL) &&
-                (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL) &&
+                (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -2220,21 +2342,26 @@ static int lua_ParticleEmitter_setPosition(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setRotation(lua_State* state)
+int lua_ParticleEmitter_setRotation(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[5];
+    for (int i = 0; i < paramCount && i < 5; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 5:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TNUMBER &&
-                (lua_type(state, 4) == LUA_TUSERDATA || lua_type(state, 4) == LUA_TNIL) &&
-                (lua_type(state, 5) == LUA_TUSERDATA || lua_type(state, 5) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TNUMBER &&
+                (paramTypes[3] == LUA_TUSERDATA || paramTypes[3] == LUA_TNIL) &&
+                (paramTypes[4] == LUA_TUSERDATA || paramTypes[4] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -2280,19 +2407,24 @@ static int lua_ParticleEmitter_setRotation(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setRotationPerParticle(lua_State* state)
+int lua_ParticleEmitter_setRotationPerParticle(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -2320,21 +2452,26 @@ static int lua_ParticleEmitter_setRotationPerParticle(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setSize(lua_State* state)
+int lua_ParticleEmitter_setSize(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[5];
+    for (int i = 0; i < paramCount && i < 5; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 5:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                lua_type(state, 3) == LUA_TNUMBER &&
-                lua_type(state, 4) == LUA_TNUMBER &&
-                lua_type(state, 5) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                paramTypes[2] == LUA_TNUMBER &&
+                paramTypes[3] == LUA_TNUMBER &&
+                paramTypes[4] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -2368,18 +2505,23 @@ static int lua_ParticleEmitter_setSize(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setSpriteAnimated(lua_State* state)
+int lua_ParticleEmitter_setSpriteAnimated(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TBOOLEAN)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TBOOLEAN)
             {
                 // Get parameter 1 off the stack.
                 bool param1 = gameplay::ScriptUtil::luaCheckBool(state, 2);
@@ -2404,11 +2546,16 @@ static int lua_ParticleEmitter_setSpriteAnimated(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setSpriteFrameCoords(lua_State* state)
+int lua_ParticleEmitter_setSpriteFrameCoords(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -2416,9 +2563,9 @@ static int lua_ParticleEmitter_setSpriteFrameCoords(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TTABLE || lua_type(state, 3) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TTABLE || paramTypes[2] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -2444,10 +2591,10 @@ static int lua_ParticleEmitter_setSpriteFrameCoords(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -2479,18 +2626,23 @@ static int lua_ParticleEmitter_setSpriteFrameCoords(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setSpriteFrameDuration(lua_State* state)
+int lua_ParticleEmitter_setSpriteFrameDuration(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 long param1 = (long)luaL_checklong(state, 2);
@@ -2515,18 +2667,23 @@ static int lua_ParticleEmitter_setSpriteFrameDuration(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setSpriteFrameRandomOffset(lua_State* state)
+int lua_ParticleEmitter_setSpriteFrameRandomOffset(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 int param1 = (int)luaL_checkint(state, 2);
@@ -2551,18 +2708,23 @@ static int lua_ParticleEmitter_setSpriteFrameRandomOffset(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setSpriteLooped(lua_State* state)
+int lua_ParticleEmitter_setSpriteLooped(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TBOOLEAN)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TBOOLEAN)
             {
                 // Get parameter 1 off the stack.
                 bool param1 = gameplay::ScriptUtil::luaCheckBool(state, 2);
@@ -2587,19 +2749,24 @@ static int lua_ParticleEmitter_setSpriteLooped(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setSpriteTexCoords(lua_State* state)
+int lua_ParticleEmitter_setSpriteTexCoords(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER &&
-                (lua_type(state, 3) == LUA_TTABLE || lua_type(state, 3) == LUA_TLIGHTUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER &&
+                (paramTypes[2] == LUA_TTABLE || paramTypes[2] == LUA_TLIGHTUSERDATA))
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -2627,11 +2794,16 @@ static int lua_ParticleEmitter_setSpriteTexCoords(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setTexture(lua_State* state)
+int lua_ParticleEmitter_setTexture(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -2639,9 +2811,9 @@ static int lua_ParticleEmitter_setTexture(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL) &&
-                    lua_type(state, 3) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL) &&
+                    paramTypes[2] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -2658,9 +2830,9 @@ static int lua_ParticleEmitter_setTexture(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                    lua_type(state, 3) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL) &&
+                    paramTypes[2] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -2692,19 +2864,24 @@ static int lua_ParticleEmitter_setTexture(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_setVelocity(lua_State* state)
+int lua_ParticleEmitter_setVelocity(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL) &&
-                (lua_type(state, 3) == LUA_TUSERDATA || lua_type(state, 3) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL) &&
+                (paramTypes[2] == LUA_TUSERDATA || paramTypes[2] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -2744,17 +2921,22 @@ static int lua_ParticleEmitter_setVelocity(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_start(lua_State* state)
+int lua_ParticleEmitter_start(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 instance->start();
@@ -2776,11 +2958,16 @@ static int lua_ParticleEmitter_start(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_static_create(lua_State* state)
+int lua_ParticleEmitter_static_create(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -2788,7 +2975,7 @@ static int lua_ParticleEmitter_static_create(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TSTRING || lua_type(state, 1) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TSTRING || paramTypes[0] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(1, false);
@@ -2813,7 +3000,7 @@ static int lua_ParticleEmitter_static_create(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TTABLE || lua_type(state, 1) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TTABLE || paramTypes[0] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -2847,9 +3034,9 @@ static int lua_ParticleEmitter_static_create(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TSTRING || lua_type(state, 1) == LUA_TNIL) &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TSTRING || paramTypes[0] == LUA_TNIL) &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(1, false);
@@ -2892,17 +3079,22 @@ static int lua_ParticleEmitter_static_create(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_stop(lua_State* state)
+int lua_ParticleEmitter_stop(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ParticleEmitter* instance = getInstance(state);
                 instance->stop();
@@ -2924,18 +3116,23 @@ static int lua_ParticleEmitter_stop(lua_State* state)
     return 0;
 }
 
-static int lua_ParticleEmitter_update(lua_State* state)
+int lua_ParticleEmitter_update(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -3012,7 +3209,6 @@ void luaRegister_ParticleEmitter()
 {
     const luaL_Reg lua_members[] = 
     {
-        {"addRef", lua_ParticleEmitter_addRef},
         {"draw", lua_ParticleEmitter_draw},
         {"emitOnce", lua_ParticleEmitter_emitOnce},
         {"getAcceleration", lua_ParticleEmitter_getAcceleration},
@@ -3025,7 +3221,6 @@ void luaRegister_ParticleEmitter()
         {"getEmissionRate", lua_ParticleEmitter_getEmissionRate},
         {"getEnergyMax", lua_ParticleEmitter_getEnergyMax},
         {"getEnergyMin", lua_ParticleEmitter_getEnergyMin},
-        {"getNode", lua_ParticleEmitter_getNode},
         {"getOrbitAcceleration", lua_ParticleEmitter_getOrbitAcceleration},
         {"getOrbitPosition", lua_ParticleEmitter_getOrbitPosition},
         {"getOrbitVelocity", lua_ParticleEmitter_getOrbitVelocity},
@@ -3033,7 +3228,6 @@ void luaRegister_ParticleEmitter()
         {"getParticlesCount", lua_ParticleEmitter_getParticlesCount},
         {"getPosition", lua_ParticleEmitter_getPosition},
         {"getPositionVariance", lua_ParticleEmitter_getPositionVariance},
-        {"getRefCount", lua_ParticleEmitter_getRefCount},
         {"getRotationAxis", lua_ParticleEmitter_getRotationAxis},
         {"getRotationAxisVariance", lua_ParticleEmitter_getRotationAxisVariance},
         {"getRotationPerParticleSpeedMax", lua_ParticleEmitter_getRotationPerParticleSpeedMax},
@@ -3057,7 +3251,6 @@ void luaRegister_ParticleEmitter()
         {"isSpriteAnimated", lua_ParticleEmitter_isSpriteAnimated},
         {"isSpriteLooped", lua_ParticleEmitter_isSpriteLooped},
         {"isStarted", lua_ParticleEmitter_isStarted},
-        {"release", lua_ParticleEmitter_release},
         {"setAcceleration", lua_ParticleEmitter_setAcceleration},
         {"setBlendMode", lua_ParticleEmitter_setBlendMode},
         {"setColor", lua_ParticleEmitter_setColor},
@@ -3081,6 +3274,10 @@ void luaRegister_ParticleEmitter()
         {"start", lua_ParticleEmitter_start},
         {"stop", lua_ParticleEmitter_stop},
         {"update", lua_ParticleEmitter_update},
+        {"addRef", lua_Ref_addRef},
+        {"getNode", lua_Drawable_getNode},
+        {"getRefCount", lua_Ref_getRefCount},
+        {"release", lua_Ref_release},
         {"to", lua_ParticleEmitter_to},
         {NULL, NULL}
     };
@@ -18,22 +18,27 @@ namespace gameplay
 
 static PhysicsCollisionShape::Definition* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "PhysicsCollisionShapeDefinition");
-    luaL_argcheck(state, userdata != NULL, 1, "'PhysicsCollisionShapeDefinition' expected.");
-    return (PhysicsCollisionShape::Definition*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "PhysicsCollisionShapeDefinition");
+    luaL_argcheck(state, instance != NULL, 1, "'PhysicsCollisionShapeDefinition' expected.");
+    return (PhysicsCollisionShape::Definition*)instance;
 }
 
-static int lua_PhysicsCollisionShapeDefinition__gc(lua_State* state)
+int lua_PhysicsCollisionShapeDefinition__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "PhysicsCollisionShapeDefinition");
                 luaL_argcheck(state, userdata != NULL, 1, "'PhysicsCollisionShapeDefinition' expected.");
@@ -61,11 +66,16 @@ static int lua_PhysicsCollisionShapeDefinition__gc(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsCollisionShapeDefinition__init(lua_State* state)
+int lua_PhysicsCollisionShapeDefinition__init(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -92,7 +102,7 @@ static int lua_PhysicsCollisionShapeDefinition__init(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     bool param1Valid;
@@ -132,17 +142,22 @@ static int lua_PhysicsCollisionShapeDefinition__init(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsCollisionShapeDefinition_isEmpty(lua_State* state)
+int lua_PhysicsCollisionShapeDefinition_isEmpty(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 PhysicsCollisionShape::Definition* instance = getInstance(state);
                 bool result = instance->isEmpty();
@@ -18,22 +18,27 @@ namespace gameplay
 
 static PhysicsController::HitResult* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "PhysicsControllerHitResult");
-    luaL_argcheck(state, userdata != NULL, 1, "'PhysicsControllerHitResult' expected.");
-    return (PhysicsController::HitResult*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "PhysicsControllerHitResult");
+    luaL_argcheck(state, instance != NULL, 1, "'PhysicsControllerHitResult' expected.");
+    return (PhysicsController::HitResult*)instance;
 }
 
-static int lua_PhysicsControllerHitResult__gc(lua_State* state)
+int lua_PhysicsControllerHitResult__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "PhysicsControllerHitResult");
                 luaL_argcheck(state, userdata != NULL, 1, "'PhysicsControllerHitResult' expected.");
@@ -61,7 +66,7 @@ static int lua_PhysicsControllerHitResult__gc(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsControllerHitResult__init(lua_State* state)
+int lua_PhysicsControllerHitResult__init(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -98,7 +103,7 @@ static int lua_PhysicsControllerHitResult__init(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsControllerHitResult_fraction(lua_State* state)
+int lua_PhysicsControllerHitResult_fraction(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -127,7 +132,7 @@ static int lua_PhysicsControllerHitResult_fraction(lua_State* state)
     }
 }
 
-static int lua_PhysicsControllerHitResult_normal(lua_State* state)
+int lua_PhysicsControllerHitResult_normal(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -153,25 +158,14 @@ static int lua_PhysicsControllerHitResult_normal(lua_State* state)
     }
     else
     {
-        void* returnPtr = (void*)new Vector3(instance->normal);
-        if (returnPtr)
-        {
-            gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-            object->instance = returnPtr;
-            object->owns = true;
-            luaL_getmetatable(state, "Vector3");
-            lua_setmetatable(state, -2);
-        }
-        else
-        {
-            lua_pushnil(state);
-        }
+        gameplay::ScriptUtil::pushValueObject<Vector3>("Vector3", instance->normal);
+        // The object was pushed onto the stack when it was created.
 
         return 1;
     }
 }
 
-static int lua_PhysicsControllerHitResult_object(lua_State* state)
+int lua_PhysicsControllerHitResult_object(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -215,7 +209,7 @@ static int lua_PhysicsControllerHitResult_object(lua_State* state)
     }
 }
 
-static int lua_PhysicsControllerHitResult_point(lua_State* state)
+int lua_PhysicsControllerHitResult_point(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -241,19 +235,8 @@ static int lua_PhysicsControllerHitResult_point(lua_State* state)
     }
     else
     {
-        void* returnPtr = (void*)new Vector3(instance->point);
-        if (returnPtr)
-        {
-            gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-            object->instance = returnPtr;
-            object->owns = true;
-            luaL_getmetatable(state, "Vector3");
-            lua_setmetatable(state, -2);
-        }
-        else
-        {
-            lua_pushnil(state);
-        }
+        gameplay::ScriptUtil::pushValueObject<Vector3>("Vector3", instance->point);
+        // The object was pushed onto the stack when it was created.
 
         return 1;
     }
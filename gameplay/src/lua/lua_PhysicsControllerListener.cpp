@@ -18,23 +18,28 @@ namespace gameplay
 
 static PhysicsController::Listener* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "PhysicsControllerListener");
-    luaL_argcheck(state, userdata != NULL, 1, "'PhysicsControllerListener' expected.");
-    return (PhysicsController::Listener*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "PhysicsControllerListener");
+    luaL_argcheck(state, instance != NULL, 1, "'PhysicsControllerListener' expected.");
+    return (PhysicsController::Listener*)instance;
 }
 
-static int lua_PhysicsControllerListener_statusEvent(lua_State* state)
+int lua_PhysicsControllerListener_statusEvent(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 PhysicsController::Listener::EventType param1 = (PhysicsController::Listener::EventType)luaL_checkint(state, 2);
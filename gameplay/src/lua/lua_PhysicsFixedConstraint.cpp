@@ -16,24 +16,38 @@ namespace gameplay
 
 extern void luaGlobal_Register_Conversion_Function(const char* className, void*(*func)(void*, const char*));
 
+extern int lua_PhysicsGenericConstraint_getRotationOffsetA(lua_State* state);
+extern int lua_PhysicsGenericConstraint_getRotationOffsetB(lua_State* state);
+extern int lua_PhysicsGenericConstraint_getTranslationOffsetA(lua_State* state);
+extern int lua_PhysicsGenericConstraint_getTranslationOffsetB(lua_State* state);
+extern int lua_PhysicsGenericConstraint_setRotationOffsetA(lua_State* state);
+extern int lua_PhysicsGenericConstraint_setRotationOffsetB(lua_State* state);
+extern int lua_PhysicsGenericConstraint_setTranslationOffsetA(lua_State* state);
+extern int lua_PhysicsGenericConstraint_setTranslationOffsetB(lua_State* state);
+
 static PhysicsFixedConstraint* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "PhysicsFixedConstraint");
-    luaL_argcheck(state, userdata != NULL, 1, "'PhysicsFixedConstraint' expected.");
-    return (PhysicsFixedConstraint*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "PhysicsFixedConstraint");
+    luaL_argcheck(state, instance != NULL, 1, "'PhysicsFixedConstraint' expected.");
+    return (PhysicsFixedConstraint*)instance;
 }
 
-static int lua_PhysicsFixedConstraint_getBreakingImpulse(lua_State* state)
+int lua_PhysicsFixedConstraint_getBreakingImpulse(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 PhysicsFixedConstraint* instance = getInstance(state);
                 float result = instance->getBreakingImpulse();
@@ -58,193 +72,22 @@ static int lua_PhysicsFixedConstraint_getBreakingImpulse(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsFixedConstraint_getRotationOffsetA(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                PhysicsFixedConstraint* instance = getInstance(state);
-                void* returnPtr = (void*)&(instance->getRotationOffsetA());
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = false;
-                    luaL_getmetatable(state, "Quaternion");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_PhysicsFixedConstraint_getRotationOffsetA - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsFixedConstraint_getRotationOffsetB(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                PhysicsFixedConstraint* instance = getInstance(state);
-                void* returnPtr = (void*)&(instance->getRotationOffsetB());
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = false;
-                    luaL_getmetatable(state, "Quaternion");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_PhysicsFixedConstraint_getRotationOffsetB - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsFixedConstraint_getTranslationOffsetA(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                PhysicsFixedConstraint* instance = getInstance(state);
-                void* returnPtr = (void*)&(instance->getTranslationOffsetA());
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = false;
-                    luaL_getmetatable(state, "Vector3");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_PhysicsFixedConstraint_getTranslationOffsetA - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsFixedConstraint_getTranslationOffsetB(lua_State* state)
+int lua_PhysicsFixedConstraint_isEnabled(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                PhysicsFixedConstraint* instance = getInstance(state);
-                void* returnPtr = (void*)&(instance->getTranslationOffsetB());
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = false;
-                    luaL_getmetatable(state, "Vector3");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_PhysicsFixedConstraint_getTranslationOffsetB - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsFixedConstraint_isEnabled(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 PhysicsFixedConstraint* instance = getInstance(state);
                 bool result = instance->isEnabled();
@@ -269,18 +112,23 @@ static int lua_PhysicsFixedConstraint_isEnabled(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsFixedConstraint_setBreakingImpulse(lua_State* state)
+int lua_PhysicsFixedConstraint_setBreakingImpulse(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -305,18 +153,23 @@ static int lua_PhysicsFixedConstraint_setBreakingImpulse(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsFixedConstraint_setEnabled(lua_State* state)
+int lua_PhysicsFixedConstraint_setEnabled(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TBOOLEAN)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TBOOLEAN)
             {
                 // Get parameter 1 off the stack.
                 bool param1 = gameplay::ScriptUtil::luaCheckBool(state, 2);
@@ -341,186 +194,23 @@ static int lua_PhysicsFixedConstraint_setEnabled(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsFixedConstraint_setRotationOffsetA(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                bool param1Valid;
-                gameplay::ScriptUtil::LuaArray<Quaternion> param1 = gameplay::ScriptUtil::getObjectPointer<Quaternion>(2, "Quaternion", true, &param1Valid);
-                if (!param1Valid)
-                {
-                    lua_pushstring(state, "Failed to convert parameter 1 to type 'Quaternion'.");
-                    lua_error(state);
-                }
-
-                PhysicsFixedConstraint* instance = getInstance(state);
-                instance->setRotationOffsetA(*param1);
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_PhysicsFixedConstraint_setRotationOffsetA - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsFixedConstraint_setRotationOffsetB(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                bool param1Valid;
-                gameplay::ScriptUtil::LuaArray<Quaternion> param1 = gameplay::ScriptUtil::getObjectPointer<Quaternion>(2, "Quaternion", true, &param1Valid);
-                if (!param1Valid)
-                {
-                    lua_pushstring(state, "Failed to convert parameter 1 to type 'Quaternion'.");
-                    lua_error(state);
-                }
-
-                PhysicsFixedConstraint* instance = getInstance(state);
-                instance->setRotationOffsetB(*param1);
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_PhysicsFixedConstraint_setRotationOffsetB - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsFixedConstraint_setTranslationOffsetA(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                bool param1Valid;
-                gameplay::ScriptUtil::LuaArray<Vector3> param1 = gameplay::ScriptUtil::getObjectPointer<Vector3>(2, "Vector3", true, &param1Valid);
-                if (!param1Valid)
-                {
-                    lua_pushstring(state, "Failed to convert parameter 1 to type 'Vector3'.");
-                    lua_error(state);
-                }
-
-                PhysicsFixedConstraint* instance = getInstance(state);
-                instance->setTranslationOffsetA(*param1);
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_PhysicsFixedConstraint_setTranslationOffsetA - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsFixedConstraint_setTranslationOffsetB(lua_State* state)
+int lua_PhysicsFixedConstraint_static_centerOfMassMidpoint(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                bool param1Valid;
-                gameplay::ScriptUtil::LuaArray<Vector3> param1 = gameplay::ScriptUtil::getObjectPointer<Vector3>(2, "Vector3", true, &param1Valid);
-                if (!param1Valid)
-                {
-                    lua_pushstring(state, "Failed to convert parameter 1 to type 'Vector3'.");
-                    lua_error(state);
-                }
-
-                PhysicsFixedConstraint* instance = getInstance(state);
-                instance->setTranslationOffsetB(*param1);
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_PhysicsFixedConstraint_setTranslationOffsetB - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsFixedConstraint_static_centerOfMassMidpoint(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TTABLE || lua_type(state, 1) == LUA_TNIL) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TTABLE || paramTypes[0] == LUA_TNIL) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -540,19 +230,8 @@ static int lua_PhysicsFixedConstraint_static_centerOfMassMidpoint(lua_State* sta
                     lua_error(state);
                 }
 
-                void* returnPtr = (void*)new Vector3(PhysicsFixedConstraint::centerOfMassMidpoint(param1, param2));
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = true;
-                    luaL_getmetatable(state, "Vector3");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
+                gameplay::ScriptUtil::pushValueObject<Vector3>("Vector3", PhysicsFixedConstraint::centerOfMassMidpoint(param1, param2));
+                // The object was pushed onto the stack when it was created.
 
                 return 1;
             }
@@ -571,18 +250,23 @@ static int lua_PhysicsFixedConstraint_static_centerOfMassMidpoint(lua_State* sta
     return 0;
 }
 
-static int lua_PhysicsFixedConstraint_static_getRotationOffset(lua_State* state)
+int lua_PhysicsFixedConstraint_static_getRotationOffset(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TTABLE || lua_type(state, 1) == LUA_TNIL) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TTABLE || paramTypes[0] == LUA_TNIL) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -602,19 +286,8 @@ static int lua_PhysicsFixedConstraint_static_getRotationOffset(lua_State* state)
                     lua_error(state);
                 }
 
-                void* returnPtr = (void*)new Quaternion(PhysicsFixedConstraint::getRotationOffset(param1, *param2));
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = true;
-                    luaL_getmetatable(state, "Quaternion");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
+                gameplay::ScriptUtil::pushValueObject<Quaternion>("Quaternion", PhysicsFixedConstraint::getRotationOffset(param1, *param2));
+                // The object was pushed onto the stack when it was created.
 
                 return 1;
             }
@@ -633,18 +306,23 @@ static int lua_PhysicsFixedConstraint_static_getRotationOffset(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsFixedConstraint_static_getTranslationOffset(lua_State* state)
+int lua_PhysicsFixedConstraint_static_getTranslationOffset(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TTABLE || lua_type(state, 1) == LUA_TNIL) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TTABLE || paramTypes[0] == LUA_TNIL) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -664,19 +342,8 @@ static int lua_PhysicsFixedConstraint_static_getTranslationOffset(lua_State* sta
                     lua_error(state);
                 }
 
-                void* returnPtr = (void*)new Vector3(PhysicsFixedConstraint::getTranslationOffset(param1, *param2));
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = true;
-                    luaL_getmetatable(state, "Vector3");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
+                gameplay::ScriptUtil::pushValueObject<Vector3>("Vector3", PhysicsFixedConstraint::getTranslationOffset(param1, *param2));
+                // The object was pushed onto the stack when it was created.
 
                 return 1;
             }
@@ -744,17 +411,17 @@ void luaRegister_PhysicsFixedConstraint()
     const luaL_Reg lua_members[] = 
     {
         {"getBreakingImpulse", lua_PhysicsFixedConstraint_getBreakingImpulse},
-        {"getRotationOffsetA", lua_PhysicsFixedConstraint_getRotationOffsetA},
-        {"getRotationOffsetB", lua_PhysicsFixedConstraint_getRotationOffsetB},
-        {"getTranslationOffsetA", lua_PhysicsFixedConstraint_getTranslationOffsetA},
-        {"getTranslationOffsetB", lua_PhysicsFixedConstraint_getTranslationOffsetB},
         {"isEnabled", lua_PhysicsFixedConstraint_isEnabled},
         {"setBreakingImpulse", lua_PhysicsFixedConstraint_setBreakingImpulse},
         {"setEnabled", lua_PhysicsFixedConstraint_setEnabled},
-        {"setRotationOffsetA", lua_PhysicsFixedConstraint_setRotationOffsetA},
-        {"setRotationOffsetB", lua_PhysicsFixedConstraint_setRotationOffsetB},
-        {"setTranslationOffsetA", lua_PhysicsFixedConstraint_setTranslationOffsetA},
-        {"setTranslationOffsetB", lua_PhysicsFixedConstraint_setTranslationOffsetB},
+        {"getRotationOffsetA", lua_PhysicsGenericConstraint_getRotationOffsetA},
+        {"getRotationOffsetB", lua_PhysicsGenericConstraint_getRotationOffsetB},
+        {"getTranslationOffsetA", lua_PhysicsGenericConstraint_getTranslationOffsetA},
+        {"getTranslationOffsetB", lua_PhysicsGenericConstraint_getTranslationOffsetB},
+        {"setRotationOffsetA", lua_PhysicsGenericConstraint_setRotationOffsetA},
+        {"setRotationOffsetB", lua_PhysicsGenericConstraint_setRotationOffsetB},
+        {"setTranslationOffsetA", lua_PhysicsGenericConstraint_setTranslationOffsetA},
+        {"setTranslationOffsetB", lua_PhysicsGenericConstraint_setTranslationOffsetB},
         {"to", lua_PhysicsFixedConstraint_to},
         {NULL, NULL}
     };
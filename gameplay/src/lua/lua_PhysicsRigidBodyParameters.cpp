@@ -27,22 +27,27 @@ namespace gameplay
 
 static PhysicsRigidBody::Parameters* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "PhysicsRigidBodyParameters");
-    luaL_argcheck(state, userdata != NULL, 1, "'PhysicsRigidBodyParameters' expected.");
-    return (PhysicsRigidBody::Parameters*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "PhysicsRigidBodyParameters");
+    luaL_argcheck(state, instance != NULL, 1, "'PhysicsRigidBodyParameters' expected.");
+    return (PhysicsRigidBody::Parameters*)instance;
 }
 
-static int lua_PhysicsRigidBodyParameters__gc(lua_State* state)
+int lua_PhysicsRigidBodyParameters__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "PhysicsRigidBodyParameters");
                 luaL_argcheck(state, userdata != NULL, 1, "'PhysicsRigidBodyParameters' expected.");
@@ -70,11 +75,16 @@ static int lua_PhysicsRigidBodyParameters__gc(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsRigidBodyParameters__init(lua_State* state)
+int lua_PhysicsRigidBodyParameters__init(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[9];
+    for (int i = 0; i < paramCount && i < 9; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -101,7 +111,7 @@ static int lua_PhysicsRigidBodyParameters__init(lua_State* state)
         {
             do
             {
-                if (lua_type(state, 1) == LUA_TNUMBER)
+                if (paramTypes[0] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 1);
@@ -132,8 +142,8 @@ static int lua_PhysicsRigidBodyParameters__init(lua_State* state)
         {
             do
             {
-                if (lua_type(state, 1) == LUA_TNUMBER &&
-                    lua_type(state, 2) == LUA_TNUMBER)
+                if (paramTypes[0] == LUA_TNUMBER &&
+                    paramTypes[1] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 1);
@@ -167,9 +177,9 @@ static int lua_PhysicsRigidBodyParameters__init(lua_State* state)
         {
             do
             {
-                if (lua_type(state, 1) == LUA_TNUMBER &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER)
+                if (paramTypes[0] == LUA_TNUMBER &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 1);
@@ -206,10 +216,10 @@ static int lua_PhysicsRigidBodyParameters__init(lua_State* state)
         {
             do
             {
-                if (lua_type(state, 1) == LUA_TNUMBER &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER)
+                if (paramTypes[0] == LUA_TNUMBER &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 1);
@@ -249,11 +259,11 @@ static int lua_PhysicsRigidBodyParameters__init(lua_State* state)
         {
             do
             {
-                if (lua_type(state, 1) == LUA_TNUMBER &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER &&
-                    lua_type(state, 5) == LUA_TNUMBER)
+                if (paramTypes[0] == LUA_TNUMBER &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER &&
+                    paramTypes[4] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 1);
@@ -296,12 +306,12 @@ static int lua_PhysicsRigidBodyParameters__init(lua_State* state)
         {
             do
             {
-                if (lua_type(state, 1) == LUA_TNUMBER &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER &&
-                    lua_type(state, 5) == LUA_TNUMBER &&
-                    lua_type(state, 6) == LUA_TBOOLEAN)
+                if (paramTypes[0] == LUA_TNUMBER &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER &&
+                    paramTypes[4] == LUA_TNUMBER &&
+                    paramTypes[5] == LUA_TBOOLEAN)
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 1);
@@ -347,13 +357,13 @@ static int lua_PhysicsRigidBodyParameters__init(lua_State* state)
         {
             do
             {
-                if (lua_type(state, 1) == LUA_TNUMBER &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER &&
-                    lua_type(state, 5) == LUA_TNUMBER &&
-                    lua_type(state, 6) == LUA_TBOOLEAN &&
-                    (lua_type(state, 7) == LUA_TUSERDATA || lua_type(state, 7) == LUA_TNIL))
+                if (paramTypes[0] == LUA_TNUMBER &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER &&
+                    paramTypes[4] == LUA_TNUMBER &&
+                    paramTypes[5] == LUA_TBOOLEAN &&
+                    (paramTypes[6] == LUA_TUSERDATA || paramTypes[6] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 1);
@@ -405,14 +415,14 @@ static int lua_PhysicsRigidBodyParameters__init(lua_State* state)
         {
             do
             {
-                if (lua_type(state, 1) == LUA_TNUMBER &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER &&
-                    lua_type(state, 5) == LUA_TNUMBER &&
-                    lua_type(state, 6) == LUA_TBOOLEAN &&
-                    (lua_type(state, 7) == LUA_TUSERDATA || lua_type(state, 7) == LUA_TNIL) &&
-                    (lua_type(state, 8) == LUA_TUSERDATA || lua_type(state, 8) == LUA_TNIL))
+                if (paramTypes[0] == LUA_TNUMBER &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER &&
+                    paramTypes[4] == LUA_TNUMBER &&
+                    paramTypes[5] == LUA_TBOOLEAN &&
+                    (paramTypes[6] == LUA_TUSERDATA || paramTypes[6] == LUA_TNIL) &&
+                    (paramTypes[7] == LUA_TUSERDATA || paramTypes[7] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 1);
@@ -470,15 +480,15 @@ static int lua_PhysicsRigidBodyParameters__init(lua_State* state)
         {
             do
             {
-                if (lua_type(state, 1) == LUA_TNUMBER &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER &&
-                    lua_type(state, 5) == LUA_TNUMBER &&
-                    lua_type(state, 6) == LUA_TBOOLEAN &&
-                    (lua_type(state, 7) == LUA_TUSERDATA || lua_type(state, 7) == LUA_TNIL) &&
-                    (lua_type(state, 8) == LUA_TUSERDATA || lua_type(state, 8) == LUA_TNIL) &&
-                    (lua_type(state, 9) == LUA_TUSERDATA || lua_type(state, 9) == LUA_TNIL))
+                if (paramTypes[0] == LUA_TNUMBER &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER &&
+                    paramTypes[4] == LUA_TNUMBER &&
+                    paramTypes[5] == LUA_TBOOLEAN &&
+                    (paramTypes[6] == LUA_TUSERDATA || paramTypes[6] == LUA_TNIL) &&
+                    (paramTypes[7] == LUA_TUSERDATA || paramTypes[7] == LUA_TNIL) &&
+                    (paramTypes[8] == LUA_TUSERDATA || paramTypes[8] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 1);
@@ -548,7 +558,7 @@ static int lua_PhysicsRigidBodyParameters__init(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsRigidBodyParameters_angularDamping(lua_State* state)
+int lua_PhysicsRigidBodyParameters_angularDamping(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -577,7 +587,7 @@ static int lua_PhysicsRigidBodyParameters_angularDamping(lua_State* state)
     }
 }
 
-static int lua_PhysicsRigidBodyParameters_angularFactor(lua_State* state)
+int lua_PhysicsRigidBodyParameters_angularFactor(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -603,25 +613,14 @@ static int lua_PhysicsRigidBodyParameters_angularFactor(lua_State* state)
     }
     else
     {
-        void* returnPtr = (void*)new Vector3(instance->angularFactor);
-        if (returnPtr)
-        {
-            gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-            object->instance = returnPtr;
-            object->owns = true;
-            luaL_getmetatable(state, "Vector3");
-            lua_setmetatable(state, -2);
-        }
-        else
-        {
-            lua_pushnil(state);
-        }
+        gameplay::ScriptUtil::pushValueObject<Vector3>("Vector3", instance->angularFactor);
+        // The object was pushed onto the stack when it was created.
 
         return 1;
     }
 }
 
-static int lua_PhysicsRigidBodyParameters_anisotropicFriction(lua_State* state)
+int lua_PhysicsRigidBodyParameters_anisotropicFriction(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -647,25 +646,14 @@ static int lua_PhysicsRigidBodyParameters_anisotropicFriction(lua_State* state)
     }
     else
     {
-        void* returnPtr = (void*)new Vector3(instance->anisotropicFriction);
-        if (returnPtr)
-        {
-            gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-            object->instance = returnPtr;
-            object->owns = true;
-            luaL_getmetatable(state, "Vector3");
-            lua_setmetatable(state, -2);
-        }
-        else
-        {
-            lua_pushnil(state);
-        }
+        gameplay::ScriptUtil::pushValueObject<Vector3>("Vector3", instance->anisotropicFriction);
+        // The object was pushed onto the stack when it was created.
 
         return 1;
     }
 }
 
-static int lua_PhysicsRigidBodyParameters_friction(lua_State* state)
+int lua_PhysicsRigidBodyParameters_friction(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -694,7 +682,7 @@ static int lua_PhysicsRigidBodyParameters_friction(lua_State* state)
     }
 }
 
-static int lua_PhysicsRigidBodyParameters_kinematic(lua_State* state)
+int lua_PhysicsRigidBodyParameters_kinematic(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -723,7 +711,7 @@ static int lua_PhysicsRigidBodyParameters_kinematic(lua_State* state)
     }
 }
 
-static int lua_PhysicsRigidBodyParameters_linearDamping(lua_State* state)
+int lua_PhysicsRigidBodyParameters_linearDamping(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -752,7 +740,7 @@ static int lua_PhysicsRigidBodyParameters_linearDamping(lua_State* state)
     }
 }
 
-static int lua_PhysicsRigidBodyParameters_linearFactor(lua_State* state)
+int lua_PhysicsRigidBodyParameters_linearFactor(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -778,25 +766,14 @@ static int lua_PhysicsRigidBodyParameters_linearFactor(lua_State* state)
     }
     else
     {
-        void* returnPtr = (void*)new Vector3(instance->linearFactor);
-        if (returnPtr)
-        {
-            gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-            object->instance = returnPtr;
-            object->owns = true;
-            luaL_getmetatable(state, "Vector3");
-            lua_setmetatable(state, -2);
-        }
-        else
-        {
-            lua_pushnil(state);
-        }
+        gameplay::ScriptUtil::pushValueObject<Vector3>("Vector3", instance->linearFactor);
+        // The object was pushed onto the stack when it was created.
 
         return 1;
     }
 }
 
-static int lua_PhysicsRigidBodyParameters_mass(lua_State* state)
+int lua_PhysicsRigidBodyParameters_mass(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -825,7 +802,7 @@ static int lua_PhysicsRigidBodyParameters_mass(lua_State* state)
     }
 }
 
-static int lua_PhysicsRigidBodyParameters_restitution(lua_State* state)
+int lua_PhysicsRigidBodyParameters_restitution(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -16,24 +16,42 @@ namespace gameplay
 
 extern void luaGlobal_Register_Conversion_Function(const char* className, void*(*func)(void*, const char*));
 
+extern int lua_PhysicsGenericConstraint_getRotationOffsetA(lua_State* state);
+extern int lua_PhysicsGenericConstraint_getRotationOffsetB(lua_State* state);
+extern int lua_PhysicsGenericConstraint_getTranslationOffsetA(lua_State* state);
+extern int lua_PhysicsGenericConstraint_getTranslationOffsetB(lua_State* state);
+extern int lua_PhysicsGenericConstraint_setAngularLowerLimit(lua_State* state);
+extern int lua_PhysicsGenericConstraint_setAngularUpperLimit(lua_State* state);
+extern int lua_PhysicsGenericConstraint_setLinearLowerLimit(lua_State* state);
+extern int lua_PhysicsGenericConstraint_setLinearUpperLimit(lua_State* state);
+extern int lua_PhysicsGenericConstraint_setRotationOffsetA(lua_State* state);
+extern int lua_PhysicsGenericConstraint_setRotationOffsetB(lua_State* state);
+extern int lua_PhysicsGenericConstraint_setTranslationOffsetA(lua_State* state);
+extern int lua_PhysicsGenericConstraint_setTranslationOffsetB(lua_State* state);
+
 static PhysicsSpringConstraint* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "PhysicsSpringConstraint");
-    luaL_argcheck(state, userdata != NULL, 1, "'PhysicsSpringConstraint' expected.");
-    return (PhysicsSpringConstraint*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "PhysicsSpringConstraint");
+    luaL_argcheck(state, instance != NULL, 1, "'PhysicsSpringConstraint' expected.");
+    return (PhysicsSpringConstraint*)instance;
 }
 
-static int lua_PhysicsSpringConstraint_getBreakingImpulse(lua_State* state)
+int lua_PhysicsSpringConstraint_getBreakingImpulse(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 PhysicsSpringConstraint* instance = getInstance(state);
                 float result = instance->getBreakingImpulse();
@@ -58,193 +76,22 @@ static int lua_PhysicsSpringConstraint_getBreakingImpulse(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_getRotationOffsetA(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                PhysicsSpringConstraint* instance = getInstance(state);
-                void* returnPtr = (void*)&(instance->getRotationOffsetA());
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = false;
-                    luaL_getmetatable(state, "Quaternion");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_PhysicsSpringConstraint_getRotationOffsetA - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsSpringConstraint_getRotationOffsetB(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                PhysicsSpringConstraint* instance = getInstance(state);
-                void* returnPtr = (void*)&(instance->getRotationOffsetB());
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = false;
-                    luaL_getmetatable(state, "Quaternion");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_PhysicsSpringConstraint_getRotationOffsetB - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsSpringConstraint_getTranslationOffsetA(lua_State* state)
+int lua_PhysicsSpringConstraint_isEnabled(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                PhysicsSpringConstraint* instance = getInstance(state);
-                void* returnPtr = (void*)&(instance->getTranslationOffsetA());
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = false;
-                    luaL_getmetatable(state, "Vector3");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_PhysicsSpringConstraint_getTranslationOffsetA - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsSpringConstraint_getTranslationOffsetB(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                PhysicsSpringConstraint* instance = getInstance(state);
-                void* returnPtr = (void*)&(instance->getTranslationOffsetB());
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = false;
-                    luaL_getmetatable(state, "Vector3");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_PhysicsSpringConstraint_getTranslationOffsetB - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsSpringConstraint_isEnabled(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 PhysicsSpringConstraint* instance = getInstance(state);
                 bool result = instance->isEnabled();
@@ -269,18 +116,23 @@ static int lua_PhysicsSpringConstraint_isEnabled(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setAngularDampingX(lua_State* state)
+int lua_PhysicsSpringConstraint_setAngularDampingX(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -305,18 +157,23 @@ static int lua_PhysicsSpringConstraint_setAngularDampingX(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setAngularDampingY(lua_State* state)
+int lua_PhysicsSpringConstraint_setAngularDampingY(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -341,18 +198,23 @@ static int lua_PhysicsSpringConstraint_setAngularDampingY(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setAngularDampingZ(lua_State* state)
+int lua_PhysicsSpringConstraint_setAngularDampingZ(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -377,60 +239,23 @@ static int lua_PhysicsSpringConstraint_setAngularDampingZ(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setAngularLowerLimit(lua_State* state)
+int lua_PhysicsSpringConstraint_setAngularStrengthX(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                bool param1Valid;
-                gameplay::ScriptUtil::LuaArray<Vector3> param1 = gameplay::ScriptUtil::getObjectPointer<Vector3>(2, "Vector3", true, &param1Valid);
-                if (!param1Valid)
-                {
-                    lua_pushstring(state, "Failed to convert parameter 1 to type 'Vector3'.");
-                    lua_error(state);
-                }
-
-                PhysicsSpringConstraint* instance = getInstance(state);
-                instance->setAngularLowerLimit(*param1);
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_PhysicsSpringConstraint_setAngularLowerLimit - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsSpringConstraint_setAngularStrengthX(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -455,18 +280,23 @@ static int lua_PhysicsSpringConstraint_setAngularStrengthX(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setAngularStrengthY(lua_State* state)
+int lua_PhysicsSpringConstraint_setAngularStrengthY(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -491,18 +321,23 @@ static int lua_PhysicsSpringConstraint_setAngularStrengthY(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setAngularStrengthZ(lua_State* state)
+int lua_PhysicsSpringConstraint_setAngularStrengthZ(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -527,60 +362,23 @@ static int lua_PhysicsSpringConstraint_setAngularStrengthZ(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setAngularUpperLimit(lua_State* state)
+int lua_PhysicsSpringConstraint_setBreakingImpulse(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                bool param1Valid;
-                gameplay::ScriptUtil::LuaArray<Vector3> param1 = gameplay::ScriptUtil::getObjectPointer<Vector3>(2, "Vector3", true, &param1Valid);
-                if (!param1Valid)
-                {
-                    lua_pushstring(state, "Failed to convert parameter 1 to type 'Vector3'.");
-                    lua_error(state);
-                }
-
-                PhysicsSpringConstraint* instance = getInstance(state);
-                instance->setAngularUpperLimit(*param1);
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_PhysicsSpringConstraint_setAngularUpperLimit - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsSpringConstraint_setBreakingImpulse(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -605,18 +403,23 @@ static int lua_PhysicsSpringConstraint_setBreakingImpulse(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setEnabled(lua_State* state)
+int lua_PhysicsSpringConstraint_setEnabled(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TBOOLEAN)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TBOOLEAN)
             {
                 // Get parameter 1 off the stack.
                 bool param1 = gameplay::ScriptUtil::luaCheckBool(state, 2);
@@ -641,18 +444,23 @@ static int lua_PhysicsSpringConstraint_setEnabled(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setLinearDampingX(lua_State* state)
+int lua_PhysicsSpringConstraint_setLinearDampingX(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -677,18 +485,23 @@ static int lua_PhysicsSpringConstraint_setLinearDampingX(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setLinearDampingY(lua_State* state)
+int lua_PhysicsSpringConstraint_setLinearDampingY(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -713,18 +526,23 @@ static int lua_PhysicsSpringConstraint_setLinearDampingY(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setLinearDampingZ(lua_State* state)
+int lua_PhysicsSpringConstraint_setLinearDampingZ(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -749,60 +567,23 @@ static int lua_PhysicsSpringConstraint_setLinearDampingZ(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setLinearLowerLimit(lua_State* state)
+int lua_PhysicsSpringConstraint_setLinearStrengthX(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                bool param1Valid;
-                gameplay::ScriptUtil::LuaArray<Vector3> param1 = gameplay::ScriptUtil::getObjectPointer<Vector3>(2, "Vector3", true, &param1Valid);
-                if (!param1Valid)
-                {
-                    lua_pushstring(state, "Failed to convert parameter 1 to type 'Vector3'.");
-                    lua_error(state);
-                }
-
-                PhysicsSpringConstraint* instance = getInstance(state);
-                instance->setLinearLowerLimit(*param1);
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_PhysicsSpringConstraint_setLinearLowerLimit - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsSpringConstraint_setLinearStrengthX(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -827,18 +608,23 @@ static int lua_PhysicsSpringConstraint_setLinearStrengthX(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setLinearStrengthY(lua_State* state)
+int lua_PhysicsSpringConstraint_setLinearStrengthY(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -863,18 +649,23 @@ static int lua_PhysicsSpringConstraint_setLinearStrengthY(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setLinearStrengthZ(lua_State* state)
+int lua_PhysicsSpringConstraint_setLinearStrengthZ(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 float param1 = (float)luaL_checknumber(state, 2);
@@ -899,228 +690,23 @@ static int lua_PhysicsSpringConstraint_setLinearStrengthZ(lua_State* state)
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_setLinearUpperLimit(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                bool param1Valid;
-                gameplay::ScriptUtil::LuaArray<Vector3> param1 = gameplay::ScriptUtil::getObjectPointer<Vector3>(2, "Vector3", true, &param1Valid);
-                if (!param1Valid)
-                {
-                    lua_pushstring(state, "Failed to convert parameter 1 to type 'Vector3'.");
-                    lua_error(state);
-                }
-
-                PhysicsSpringConstraint* instance = getInstance(state);
-                instance->setLinearUpperLimit(*param1);
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_PhysicsSpringConstraint_setLinearUpperLimit - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsSpringConstraint_setRotationOffsetA(lua_State* state)
+int lua_PhysicsSpringConstraint_static_centerOfMassMidpoint(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                bool param1Valid;
-                gameplay::ScriptUtil::LuaArray<Quaternion> param1 = gameplay::ScriptUtil::getObjectPointer<Quaternion>(2, "Quaternion", true, &param1Valid);
-                if (!param1Valid)
-                {
-                    lua_pushstring(state, "Failed to convert parameter 1 to type 'Quaternion'.");
-                    lua_error(state);
-                }
-
-                PhysicsSpringConstraint* instance = getInstance(state);
-                instance->setRotationOffsetA(*param1);
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_PhysicsSpringConstraint_setRotationOffsetA - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsSpringConstraint_setRotationOffsetB(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                bool param1Valid;
-                gameplay::ScriptUtil::LuaArray<Quaternion> param1 = gameplay::ScriptUtil::getObjectPointer<Quaternion>(2, "Quaternion", true, &param1Valid);
-                if (!param1Valid)
-                {
-                    lua_pushstring(state, "Failed to convert parameter 1 to type 'Quaternion'.");
-                    lua_error(state);
-                }
-
-                PhysicsSpringConstraint* instance = getInstance(state);
-                instance->setRotationOffsetB(*param1);
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_PhysicsSpringConstraint_setRotationOffsetB - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsSpringConstraint_setTranslationOffsetA(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                bool param1Valid;
-                gameplay::ScriptUtil::LuaArray<Vector3> param1 = gameplay::ScriptUtil::getObjectPointer<Vector3>(2, "Vector3", true, &param1Valid);
-                if (!param1Valid)
-                {
-                    lua_pushstring(state, "Failed to convert parameter 1 to type 'Vector3'.");
-                    lua_error(state);
-                }
-
-                PhysicsSpringConstraint* instance = getInstance(state);
-                instance->setTranslationOffsetA(*param1);
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_PhysicsSpringConstraint_setTranslationOffsetA - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsSpringConstraint_setTranslationOffsetB(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
-            {
-                // Get parameter 1 off the stack.
-                bool param1Valid;
-                gameplay::ScriptUtil::LuaArray<Vector3> param1 = gameplay::ScriptUtil::getObjectPointer<Vector3>(2, "Vector3", true, &param1Valid);
-                if (!param1Valid)
-                {
-                    lua_pushstring(state, "Failed to convert parameter 1 to type 'Vector3'.");
-                    lua_error(state);
-                }
-
-                PhysicsSpringConstraint* instance = getInstance(state);
-                instance->setTranslationOffsetB(*param1);
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_PhysicsSpringConstraint_setTranslationOffsetB - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 2).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_PhysicsSpringConstraint_static_centerOfMassMidpoint(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 2:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TTABLE || lua_type(state, 1) == LUA_TNIL) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TTABLE || paramTypes[0] == LUA_TNIL) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -1140,19 +726,8 @@ static int lua_PhysicsSpringConstraint_static_centerOfMassMidpoint(lua_State* st
                     lua_error(state);
                 }
 
-                void* returnPtr = (void*)new Vector3(PhysicsSpringConstraint::centerOfMassMidpoint(param1, param2));
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = true;
-                    luaL_getmetatable(state, "Vector3");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
+                gameplay::ScriptUtil::pushValueObject<Vector3>("Vector3", PhysicsSpringConstraint::centerOfMassMidpoint(param1, param2));
+                // The object was pushed onto the stack when it was created.
 
                 return 1;
             }
@@ -1171,18 +746,23 @@ static int lua_PhysicsSpringConstraint_static_centerOfMassMidpoint(lua_State* st
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_static_getRotationOffset(lua_State* state)
+int lua_PhysicsSpringConstraint_static_getRotationOffset(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TTABLE || lua_type(state, 1) == LUA_TNIL) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TTABLE || paramTypes[0] == LUA_TNIL) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -1202,19 +782,8 @@ static int lua_PhysicsSpringConstraint_static_getRotationOffset(lua_State* state
                     lua_error(state);
                 }
 
-                void* returnPtr = (void*)new Quaternion(PhysicsSpringConstraint::getRotationOffset(param1, *param2));
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = true;
-                    luaL_getmetatable(state, "Quaternion");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
+                gameplay::ScriptUtil::pushValueObject<Quaternion>("Quaternion", PhysicsSpringConstraint::getRotationOffset(param1, *param2));
+                // The object was pushed onto the stack when it was created.
 
                 return 1;
             }
@@ -1233,18 +802,23 @@ static int lua_PhysicsSpringConstraint_static_getRotationOffset(lua_State* state
     return 0;
 }
 
-static int lua_PhysicsSpringConstraint_static_getTranslationOffset(lua_State* state)
+int lua_PhysicsSpringConstraint_static_getTranslationOffset(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TTABLE || lua_type(state, 1) == LUA_TNIL) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TTABLE || paramTypes[0] == LUA_TNIL) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -1264,19 +838,8 @@ static int lua_PhysicsSpringConstraint_static_getTranslationOffset(lua_State* st
                     lua_error(state);
                 }
 
-                void* returnPtr = (void*)new Vector3(PhysicsSpringConstraint::getTranslationOffset(param1, *param2));
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = true;
-                    luaL_getmetatable(state, "Vector3");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
+                gameplay::ScriptUtil::pushValueObject<Vector3>("Vector3", PhysicsSpringConstraint::getTranslationOffset(param1, *param2));
+                // The object was pushed onto the stack when it was created.
 
                 return 1;
             }
@@ -1344,33 +907,33 @@ void luaRegister_PhysicsSpringConstraint()
     const luaL_Reg lua_members[] = 
     {
         {"getBreakingImpulse", lua_PhysicsSpringConstraint_getBreakingImpulse},
-        {"getRotationOffsetA", lua_PhysicsSpringConstraint_getRotationOffsetA},
-        {"getRotationOffsetB", lua_PhysicsSpringConstraint_getRotationOffsetB},
-        {"getTranslationOffsetA", lua_PhysicsSpringConstraint_getTranslationOffsetA},
-        {"getTranslationOffsetB", lua_PhysicsSpringConstraint_getTranslationOffsetB},
         {"isEnabled", lua_PhysicsSpringConstraint_isEnabled},
         {"setAngularDampingX", lua_PhysicsSpringConstraint_setAngularDampingX},
         {"setAngularDampingY", lua_PhysicsSpringConstraint_setAngularDampingY},
         {"setAngularDampingZ", lua_PhysicsSpringConstraint_setAngularDampingZ},
-        {"setAngularLowerLimit", lua_PhysicsSpringConstraint_setAngularLowerLimit},
         {"setAngularStrengthX", lua_PhysicsSpringConstraint_setAngularStrengthX},
         {"setAngularStrengthY", lua_PhysicsSpringConstraint_setAngularStrengthY},
         {"setAngularStrengthZ", lua_PhysicsSpringConstraint_setAngularStrengthZ},
-        {"setAngularUpperLimit", lua_PhysicsSpringConstraint_setAngularUpperLimit},
         {"setBreakingImpulse", lua_PhysicsSpringConstraint_setBreakingImpulse},
         {"setEnabled", lua_PhysicsSpringConstraint_setEnabled},
         {"setLinearDampingX", lua_PhysicsSpringConstraint_setLinearDampingX},
         {"setLinearDampingY", lua_PhysicsSpringConstraint_setLinearDampingY},
         {"setLinearDampingZ", lua_PhysicsSpringConstraint_setLinearDampingZ},
-        {"setLinearLowerLimit", lua_PhysicsSpringConstraint_setLinearLowerLimit},
         {"setLinearStrengthX", lua_PhysicsSpringConstraint_setLinearStrengthX},
         {"setLinearStrengthY", lua_PhysicsSpringConstraint_setLinearStrengthY},
         {"setLinearStrengthZ", lua_PhysicsSpringConstraint_setLinearStrengthZ},
-        {"setLinearUpperLimit", lua_PhysicsSpringConstraint_setLinearUpperLimit},
-        {"setRotationOffsetA", lua_PhysicsSpringConstraint_setRotationOffsetA},
-        {"setRotationOffsetB", lua_PhysicsSpringConstraint_setRotationOffsetB},
-        {"setTranslationOffsetA", lua_PhysicsSpringConstraint_setTranslationOffsetA},
-        {"setTranslationOffsetB", lua_PhysicsSpringConstraint_setTranslationOffsetB},
+        {"getRotationOffsetA", lua_PhysicsGenericConstraint_getRotationOffsetA},
+        {"getRotationOffsetB", lua_PhysicsGenericConstraint_getRotationOffsetB},
+        {"getTranslationOffsetA", lua_PhysicsGenericConstraint_getTranslationOffsetA},
+        {"getTranslationOffsetB", lua_PhysicsGenericConstraint_getTranslationOffsetB},
+        {"setAngularLowerLimit", lua_PhysicsGenericConstraint_setAngularLowerLimit},
+        {"setAngularUpperLimit", lua_PhysicsGenericConstraint_setAngularUpperLimit},
+        {"setLinearLowerLimit", lua_PhysicsGenericConstraint_setLinearLowerLimit},
+        {"setLinearUpperLimit", lua_PhysicsGenericConstraint_setLinearUpperLimit},
+        {"setRotationOffsetA", lua_PhysicsGenericConstraint_setRotationOffsetA},
+        {"setRotationOffsetB", lua_PhysicsGenericConstraint_setRotationOffsetB},
+        {"setTranslationOffsetA", lua_PhysicsGenericConstraint_setTranslationOffsetA},
+        {"setTranslationOffsetB", lua_PhysicsGenericConstraint_setTranslationOffsetB},
         {"to", lua_PhysicsSpringConstraint_to},
         {NULL, NULL}
     };
@@ -13,22 +13,27 @@ namespace gameplay
 
 static Platform* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "Platform");
-    luaL_argcheck(state, userdata != NULL, 1, "'Platform' expected.");
-    return (Platform*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "Platform");
+    luaL_argcheck(state, instance != NULL, 1, "'Platform' expected.");
+    return (Platform*)instance;
 }
 
-static int lua_Platform__gc(lua_State* state)
+int lua_Platform__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "Platform");
                 luaL_argcheck(state, userdata != NULL, 1, "'Platform' expected.");
@@ -56,17 +61,22 @@ static int lua_Platform__gc(lua_State* state)
     return 0;
 }
 
-static int lua_Platform_enterMessagePump(lua_State* state)
+int lua_Platform_enterMessagePump(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Platform* instance = getInstance(state);
                 int result = instance->enterMessagePump();
@@ -91,7 +101,7 @@ static int lua_Platform_enterMessagePump(lua_State* state)
     return 0;
 }
 
-static int lua_Platform_static_swapBuffers(lua_State* state)
+int lua_Platform_static_swapBuffers(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -103,22 +103,27 @@ extern void luaGlobal_Register_Conversion_Function(const char* className, void*(
 
 static Ref* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "Ref");
-    luaL_argcheck(state, userdata != NULL, 1, "'Ref' expected.");
-    return (Ref*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "Ref");
+    luaL_argcheck(state, instance != NULL, 1, "'Ref' expected.");
+    return (Ref*)instance;
 }
 
-static int lua_Ref_addRef(lua_State* state)
+int lua_Ref_addRef(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Ref* instance = getInstance(state);
                 instance->addRef();
@@ -140,17 +145,22 @@ static int lua_Ref_addRef(lua_State* state)
     return 0;
 }
 
-static int lua_Ref_getRefCount(lua_State* state)
+int lua_Ref_getRefCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Ref* instance = getInstance(state);
                 unsigned int result = instance->getRefCount();
@@ -175,17 +185,22 @@ static int lua_Ref_getRefCount(lua_State* state)
     return 0;
 }
 
-static int lua_Ref_release(lua_State* state)
+int lua_Ref_release(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Ref* instance = getInstance(state);
                 instance->release();
@@ -0,0 +1,501 @@
+// Autogenerated by gameplay-luagen
+#include "Base.h"
+#include "ScriptController.h"
+#include "lua_ResourceStats.h"
+#include "Base.h"
+#include "ResourceStats.h"
+
+namespace gameplay
+{
+
+static ResourceStats* getInstance(lua_State* state)
+{
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "ResourceStats");
+    luaL_argcheck(state, instance != NULL, 1, "'ResourceStats' expected.");
+    return (ResourceStats*)instance;
+}
+
+int lua_ResourceStats__gc(lua_State* state)
+{
+    // Get the number of parameters.
+    int paramCount = lua_gettop(state);
+
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
+    // Attempt to match the parameters to a valid binding.
+    switch (paramCount)
+    {
+        case 1:
+        {
+            if ((paramTypes[0] == LUA_TUSERDATA))
+            {
+                void* userdata = luaL_checkudata(state, 1, "ResourceStats");
+                luaL_argcheck(state, userdata != NULL, 1, "'ResourceStats' expected.");
+                gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)userdata;
+                if (object->owns)
+                {
+                    ResourceStats* instance = (ResourceStats*)object->instance;
+                    SAFE_DELETE(instance);
+                }
+                
+                return 0;
+            }
+
+            lua_pushstring(state, "lua_ResourceStats__gc - Failed to match the given parameters to a valid function signature.");
+            lua_error(state);
+            break;
+        }
+        default:
+        {
+            lua_pushstring(state, "Invalid number of parameters (expected 1).");
+            lua_error(state);
+            break;
+        }
+    }
+    return 0;
+}
+
+int lua_ResourceStats__init(lua_State* state)
+{
+    // Get the number of parameters.
+    int paramCount = lua_gettop(state);
+
+    // Attempt to match the parameters to a valid binding.
+    switch (paramCount)
+    {
+        case 0:
+        {
+            void* returnPtr = ((void*)new ResourceStats());
+            if (returnPtr)
+            {
+                gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
+                object->instance = returnPtr;
+                object->owns = true;
+                luaL_getmetatable(state, "ResourceStats");
+                lua_setmetatable(state, -2);
+            }
+            else
+            {
+                lua_pushnil(state);
+            }
+
+            return 1;
+            break;
+        }
+        default:
+        {
+            lua_pushstring(state, "Invalid number of parameters (expected 0).");
+            lua_error(state);
+            break;
+        }
+    }
+    return 0;
+}
+
+int lua_ResourceStats_audioBufferCount(lua_State* state)
+{
+    // Validate the number of parameters.
+    if (lua_gettop(state) > 2)
+    {
+        lua_pushstring(state, "Invalid number of parameters (expected 1 or 2).");
+        lua_error(state);
+    }
+
+    ResourceStats* instance = getInstance(state);
+    if (lua_gettop(state) == 2)
+    {
+        // Get parameter 2 off the stack.
+        unsigned int param2 = (unsigned int)luaL_checkunsigned(state, 2);
+
+        instance->audioBufferCount = param2;
+        return 0;
+    }
+    else
+    {
+        unsigned int result = instance->audioBufferCount;
+
+        // Push the return value onto the stack.
+        lua_pushunsigned(state, result);
+
+        return 1;
+    }
+}
+
+int lua_ResourceStats_audioBufferMemory(lua_State* state)
+{
+    // Validate the number of parameters.
+    if (lua_gettop(state) > 2)
+    {
+        lua_pushstring(state, "Invalid number of parameters (expected 1 or 2).");
+        lua_error(state);
+    }
+
+    ResourceStats* instance = getInstance(state);
+    if (lua_gettop(state) == 2)
+    {
+        // Get parameter 2 off the stack.
+        unsigned long param2 = (unsigned long)luaL_checkunsigned(state, 2);
+
+        instance->audioBufferMemory = param2;
+        return 0;
+    }
+    else
+    {
+        unsigned long result = instance->audioBufferMemory;
+
+        // Push the return value onto the stack.
+        lua_pushunsigned(state, result);
+
+        return 1;
+    }
+}
+
+int lua_ResourceStats_effectCount(lua_State* state)
+{
+    // Validate the number of parameters.
+    if (lua_gettop(state) > 2)
+    {
+        lua_pushstring(state, "Invalid number of parameters (expected 1 or 2).");
+        lua_error(state);
+    }
+
+    ResourceStats* instance = getInstance(state);
+    if (lua_gettop(state) == 2)
+    {
+        // Get parameter 2 off the stack.
+        unsigned int param2 = (unsigned int)luaL_checkunsigned(state, 2);
+
+        instance->effectCount = param2;
+        return 0;
+    }
+    else
+    {
+        unsigned int result = instance->effectCount;
+
+        // Push the return value onto the stack.
+        lua_pushunsigned(state, result);
+
+        return 1;
+    }
+}
+
+int lua_ResourceStats_effectMemory(lua_State* state)
+{
+    // Validate the number of parameters.
+    if (lua_gettop(state) > 2)
+    {
+        lua_pushstring(state, "Invalid number of parameters (expected 1 or 2).");
+        lua_error(state);
+    }
+
+    ResourceStats* instance = getInstance(state);
+    if (lua_gettop(state) == 2)
+    {
+        // Get parameter 2 off the stack.
+        unsigned long param2 = (unsigned long)luaL_checkunsigned(state, 2);
+
+        instance->effectMemory = param2;
+        return 0;
+    }
+    else
+    {
+        unsigned long result = instance->effectMemory;
+
+        // Push the return value onto the stack.
+        lua_pushunsigned(state, result);
+
+        return 1;
+    }
+}
+
+int lua_ResourceStats_frameBufferCount(lua_State* state)
+{
+    // Validate the number of parameters.
+    if (lua_gettop(state) > 2)
+    {
+        lua_pushstring(state, "Invalid number of parameters (expected 1 or 2).");
+        lua_error(state);
+    }
+
+    ResourceStats* instance = getInstance(state);
+    if (lua_gettop(state) == 2)
+    {
+        // Get parameter 2 off the stack.
+        unsigned int param2 = (unsigned int)luaL_checkunsigned(state, 2);
+
+        instance->frameBufferCount = param2;
+        return 0;
+    }
+    else
+    {
+        unsigned int result = instance->frameBufferCount;
+
+        // Push the return value onto the stack.
+        lua_pushunsigned(state, result);
+
+        return 1;
+    }
+}
+
+int lua_ResourceStats_frameBufferMemory(lua_State* state)
+{
+    // Validate the number of parameters.
+    if (lua_gettop(state) > 2)
+    {
+        lua_pushstring(state, "Invalid number of parameters (expected 1 or 2).");
+        lua_error(state);
+    }
+
+    ResourceStats* instance = getInstance(state);
+    if (lua_gettop(state) == 2)
+    {
+        // Get parameter 2 off the stack.
+        unsigned long param2 = (unsigned long)luaL_checkunsigned(state, 2);
+
+        instance->frameBufferMemory = param2;
+        return 0;
+    }
+    else
+    {
+        unsigned long result = instance->frameBufferMemory;
+
+        // Push the return value onto the stack.
+        lua_pushunsigned(state, result);
+
+        return 1;
+    }
+}
+
+int lua_ResourceStats_meshCount(lua_State* state)
+{
+    // Validate the number of parameters.
+    if (lua_gettop(state) > 2)
+    {
+        lua_pushstring(state, "Invalid number of parameters (expected 1 or 2).");
+        lua_error(state);
+    }
+
+    ResourceStats* instance = getInstance(state);
+    if (lua_gettop(state) == 2)
+    {
+        // Get parameter 2 off the stack.
+        unsigned int param2 = (unsigned int)luaL_checkunsigned(state, 2);
+
+        instance->meshCount = param2;
+        return 0;
+    }
+    else
+    {
+        unsigned int result = instance->meshCount;
+
+        // Push the return value onto the stack.
+        lua_pushunsigned(state, result);
+
+        return 1;
+    }
+}
+
+int lua_ResourceStats_meshMemory(lua_State* state)
+{
+    // Validate the number of parameters.
+    if (lua_gettop(state) > 2)
+    {
+        lua_pushstring(state, "Invalid number of parameters (expected 1 or 2).");
+        lua_error(state);
+    }
+
+    ResourceStats* instance = getInstance(state);
+    if (lua_gettop(state) == 2)
+    {
+        // Get parameter 2 off the stack.
+        unsigned long param2 = (unsigned long)luaL_checkunsigned(state, 2);
+
+        instance->meshMemory = param2;
+        return 0;
+    }
+    else
+    {
+        unsigned long result = instance->meshMemory;
+
+        // Push the return value onto the stack.
+        lua_pushunsigned(state, result);
+
+        return 1;
+    }
+}
+
+int lua_ResourceStats_textureCount(lua_State* state)
+{
+    // Validate the number of parameters.
+    if (lua_gettop(state) > 2)
+    {
+        lua_pushstring(state, "Invalid number of parameters (expected 1 or 2).");
+        lua_error(state);
+    }
+
+    ResourceStats* instance = getInstance(state);
+    if (lua_gettop(state) == 2)
+    {
+        // Get parameter 2 off the stack.
+        unsigned int param2 = (unsigned int)luaL_checkunsigned(state, 2);
+
+        instance->textureCount = param2;
+        return 0;
+    }
+    else
+    {
+        unsigned int result = instance->textureCount;
+
+        // Push the return value onto the stack.
+        lua_pushunsigned(state, result);
+
+        return 1;
+    }
+}
+
+int lua_ResourceStats_textureMemory(lua_State* state)
+{
+    // Validate the number of parameters.
+    if (lua_gettop(state) > 2)
+    {
+        lua_pushstring(state, "Invalid number of parameters (expected 1 or 2).");
+        lua_error(state);
+    }
+
+    ResourceStats* instance = getInstance(state);
+    if (lua_gettop(state) == 2)
+    {
+        // Get parameter 2 off the stack.
+        unsigned long param2 = (unsigned long)luaL_checkunsigned(state, 2);
+
+        instance->textureMemory = param2;
+        return 0;
+    }
+    else
+    {
+        unsigned long result = instance->textureMemory;
+
+        // Push the return value onto the stack.
+        lua_pushunsigned(state, result);
+
+        return 1;
+    }
+}
+
+int lua_ResourceStats_totalMemory(lua_State* state)
+{
+    // Validate the number of parameters.
+    if (lua_gettop(state) > 2)
+    {
+        lua_pushstring(state, "Invalid number of parameters (expected 1 or 2).");
+        lua_error(state);
+    }
+
+    ResourceStats* instance = getInstance(state);
+    if (lua_gettop(state) == 2)
+    {
+        // Get parameter 2 off the stack.
+        unsigned long param2 = (unsigned long)luaL_checkunsigned(state, 2);
+
+        instance->totalMemory = param2;
+        return 0;
+    }
+    else
+    {
+        unsigned long result = instance->totalMemory;
+
+        // Push the return value onto the stack.
+        lua_pushunsigned(state, result);
+
+        return 1;
+    }
+}
+
+int lua_ResourceStats_vertexAttributeBindingCount(lua_State* state)
+{
+    // Validate the number of parameters.
+    if (lua_gettop(state) > 2)
+    {
+        lua_pushstring(state, "Invalid number of parameters (expected 1 or 2).");
+        lua_error(state);
+    }
+
+    ResourceStats* instance = getInstance(state);
+    if (lua_gettop(state) == 2)
+    {
+        // Get parameter 2 off the stack.
+        unsigned int param2 = (unsigned int)luaL_checkunsigned(state, 2);
+
+        instance->vertexAttributeBindingCount = param2;
+        return 0;
+    }
+    else
+    {
+        unsigned int result = instance->vertexAttributeBindingCount;
+
+        // Push the return value onto the stack.
+        lua_pushunsigned(state, result);
+
+        return 1;
+    }
+}
+
+int lua_ResourceStats_vertexAttributeBindingMemory(lua_State* state)
+{
+    // Validate the number of parameters.
+    if (lua_gettop(state) > 2)
+    {
+        lua_pushstring(state, "Invalid number of parameters (expected 1 or 2).");
+        lua_error(state);
+    }
+
+    ResourceStats* instance = getInstance(state);
+    if (lua_gettop(state) == 2)
+    {
+        // Get parameter 2 off the stack.
+        unsigned long param2 = (unsigned long)luaL_checkunsigned(state, 2);
+
+        instance->vertexAttributeBindingMemory = param2;
+        return 0;
+    }
+    else
+    {
+        unsigned long result = instance->vertexAttributeBindingMemory;
+
+        // Push the return value onto the stack.
+        lua_pushunsigned(state, result);
+
+        return 1;
+    }
+}
+
+void luaRegister_ResourceStats()
+{
+    const luaL_Reg lua_members[] = 
+    {
+        {"audioBufferCount", lua_ResourceStats_audioBufferCount},
+        {"audioBufferMemory", lua_ResourceStats_audioBufferMemory},
+        {"effectCount", lua_ResourceStats_effectCount},
+        {"effectMemory", lua_ResourceStats_effectMemory},
+        {"frameBufferCount", lua_ResourceStats_frameBufferCount},
+        {"frameBufferMemory", lua_ResourceStats_frameBufferMemory},
+        {"meshCount", lua_ResourceStats_meshCount},
+        {"meshMemory", lua_ResourceStats_meshMemory},
+        {"textureCount", lua_ResourceStats_textureCount},
+        {"textureMemory", lua_ResourceStats_textureMemory},
+        {"totalMemory", lua_ResourceStats_totalMemory},
+        {"vertexAttributeBindingCount", lua_ResourceStats_vertexAttributeBindingCount},
+        {"vertexAttributeBindingMemory", lua_ResourceStats_vertexAttributeBindingMemory},
+        {NULL, NULL}
+    };
+    const luaL_Reg* lua_statics = NULL;
+    std::vector<std::string> scopePath;
+
+    gameplay::ScriptUtil::registerClass("ResourceStats", lua_members, lua_ResourceStats__init, lua_ResourceStats__gc, lua_statics, scopePath);
+
+}
+
+}
@@ -0,0 +1,12 @@
+// Autogenerated by gameplay-luagen
+#ifndef LUA_RESOURCESTATS_H_
+#define LUA_RESOURCESTATS_H_
+
+namespace gameplay
+{
+
+void luaRegister_ResourceStats();
+
+}
+
+#endif
@@ -10,22 +10,27 @@ namespace gameplay
 
 static ScreenDisplayer* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "ScreenDisplayer");
-    luaL_argcheck(state, userdata != NULL, 1, "'ScreenDisplayer' expected.");
-    return (ScreenDisplayer*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "ScreenDisplayer");
+    luaL_argcheck(state, instance != NULL, 1, "'ScreenDisplayer' expected.");
+    return (ScreenDisplayer*)instance;
 }
 
-static int lua_ScreenDisplayer__gc(lua_State* state)
+int lua_ScreenDisplayer__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "ScreenDisplayer");
                 luaL_argcheck(state, userdata != NULL, 1, "'ScreenDisplayer' expected.");
@@ -53,7 +58,7 @@ static int lua_ScreenDisplayer__gc(lua_State* state)
     return 0;
 }
 
-static int lua_ScreenDisplayer__init(lua_State* state)
+int lua_ScreenDisplayer__init(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -90,7 +95,7 @@ static int lua_ScreenDisplayer__init(lua_State* state)
     return 0;
 }
 
-static int lua_ScreenDisplayer_static_finish(lua_State* state)
+int lua_ScreenDisplayer_static_finish(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -115,18 +120,23 @@ static int lua_ScreenDisplayer_static_finish(lua_State* state)
     return 0;
 }
 
-static int lua_ScreenDisplayer_static_start(lua_State* state)
+int lua_ScreenDisplayer_static_start(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TSTRING || lua_type(state, 1) == LUA_TNIL) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TSTRING || paramTypes[0] == LUA_TNIL) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(1, false);
@@ -27,22 +27,27 @@ namespace gameplay
 
 static ScriptTarget::Event* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "ScriptTargetEvent");
-    luaL_argcheck(state, userdata != NULL, 1, "'ScriptTargetEvent' expected.");
-    return (ScriptTarget::Event*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "ScriptTargetEvent");
+    luaL_argcheck(state, instance != NULL, 1, "'ScriptTargetEvent' expected.");
+    return (ScriptTarget::Event*)instance;
 }
 
-static int lua_ScriptTargetEvent__gc(lua_State* state)
+int lua_ScriptTargetEvent__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "ScriptTargetEvent");
                 luaL_argcheck(state, userdata != NULL, 1, "'ScriptTargetEvent' expected.");
@@ -70,7 +75,7 @@ static int lua_ScriptTargetEvent__gc(lua_State* state)
     return 0;
 }
 
-static int lua_ScriptTargetEvent__init(lua_State* state)
+int lua_ScriptTargetEvent__init(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -107,17 +112,22 @@ static int lua_ScriptTargetEvent__init(lua_State* state)
     return 0;
 }
 
-static int lua_ScriptTargetEvent_getArgs(lua_State* state)
+int lua_ScriptTargetEvent_getArgs(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ScriptTarget::Event* instance = getInstance(state);
                 const char* result = instance->getArgs();
@@ -142,17 +152,22 @@ static int lua_ScriptTargetEvent_getArgs(lua_State* state)
     return 0;
 }
 
-static int lua_ScriptTargetEvent_getName(lua_State* state)
+int lua_ScriptTargetEvent_getName(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ScriptTarget::Event* instance = getInstance(state);
                 const char* result = instance->getName();
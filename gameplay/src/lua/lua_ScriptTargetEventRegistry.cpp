@@ -27,22 +27,27 @@ namespace gameplay
 
 static ScriptTarget::EventRegistry* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "ScriptTargetEventRegistry");
-    luaL_argcheck(state, userdata != NULL, 1, "'ScriptTargetEventRegistry' expected.");
-    return (ScriptTarget::EventRegistry*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "ScriptTargetEventRegistry");
+    luaL_argcheck(state, instance != NULL, 1, "'ScriptTargetEventRegistry' expected.");
+    return (ScriptTarget::EventRegistry*)instance;
 }
 
-static int lua_ScriptTargetEventRegistry__gc(lua_State* state)
+int lua_ScriptTargetEventRegistry__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "ScriptTargetEventRegistry");
                 luaL_argcheck(state, userdata != NULL, 1, "'ScriptTargetEventRegistry' expected.");
@@ -70,7 +75,7 @@ static int lua_ScriptTargetEventRegistry__gc(lua_State* state)
     return 0;
 }
 
-static int lua_ScriptTargetEventRegistry__init(lua_State* state)
+int lua_ScriptTargetEventRegistry__init(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -107,18 +112,23 @@ static int lua_ScriptTargetEventRegistry__init(lua_State* state)
     return 0;
 }
 
-static int lua_ScriptTargetEventRegistry_addEvent(lua_State* state)
+int lua_ScriptTargetEventRegistry_addEvent(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -147,9 +157,9 @@ static int lua_ScriptTargetEventRegistry_addEvent(lua_State* state)
         }
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL) &&
-                (lua_type(state, 3) == LUA_TSTRING || lua_type(state, 3) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL) &&
+                (paramTypes[2] == LUA_TSTRING || paramTypes[2] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -189,11 +199,16 @@ static int lua_ScriptTargetEventRegistry_addEvent(lua_State* state)
     return 0;
 }
 
-static int lua_ScriptTargetEventRegistry_getEvent(lua_State* state)
+int lua_ScriptTargetEventRegistry_getEvent(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -201,8 +216,8 @@ static int lua_ScriptTargetEventRegistry_getEvent(lua_State* state)
         {
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    lua_type(state, 2) == LUA_TNUMBER)
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    paramTypes[1] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -228,8 +243,8 @@ static int lua_ScriptTargetEventRegistry_getEvent(lua_State* state)
 
             do
             {
-                if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                    (lua_type(state, 2) == LUA_TSTRING || lua_type(state, 2) == LUA_TNIL))
+                if ((paramTypes[0] == LUA_TUSERDATA) &&
+                    (paramTypes[1] == LUA_TSTRING || paramTypes[1] == LUA_TNIL))
                 {
                     // Get parameter 1 off the stack.
                     const char* param1 = gameplay::ScriptUtil::getString(2, false);
@@ -267,17 +282,22 @@ static int lua_ScriptTargetEventRegistry_getEvent(lua_State* state)
     return 0;
 }
 
-static int lua_ScriptTargetEventRegistry_getEventCount(lua_State* state)
+int lua_ScriptTargetEventRegistry_getEventCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 ScriptTarget::EventRegistry* instance = getInstance(state);
                 unsigned int result = instance->getEventCount();
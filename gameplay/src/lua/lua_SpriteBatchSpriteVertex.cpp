@@ -12,22 +12,27 @@ namespace gameplay
 
 static SpriteBatch::SpriteVertex* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "SpriteBatchSpriteVertex");
-    luaL_argcheck(state, userdata != NULL, 1, "'SpriteBatchSpriteVertex' expected.");
-    return (SpriteBatch::SpriteVertex*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "SpriteBatchSpriteVertex");
+    luaL_argcheck(state, instance != NULL, 1, "'SpriteBatchSpriteVertex' expected.");
+    return (SpriteBatch::SpriteVertex*)instance;
 }
 
-static int lua_SpriteBatchSpriteVertex__gc(lua_State* state)
+int lua_SpriteBatchSpriteVertex__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "SpriteBatchSpriteVertex");
                 luaL_argcheck(state, userdata != NULL, 1, "'SpriteBatchSpriteVertex' expected.");
@@ -55,7 +60,7 @@ static int lua_SpriteBatchSpriteVertex__gc(lua_State* state)
     return 0;
 }
 
-static int lua_SpriteBatchSpriteVertex__init(lua_State* state)
+int lua_SpriteBatchSpriteVertex__init(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -92,7 +97,7 @@ static int lua_SpriteBatchSpriteVertex__init(lua_State* state)
     return 0;
 }
 
-static int lua_SpriteBatchSpriteVertex_a(lua_State* state)
+int lua_SpriteBatchSpriteVertex_a(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -121,7 +126,7 @@ static int lua_SpriteBatchSpriteVertex_a(lua_State* state)
     }
 }
 
-static int lua_SpriteBatchSpriteVertex_b(lua_State* state)
+int lua_SpriteBatchSpriteVertex_b(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -150,7 +155,7 @@ static int lua_SpriteBatchSpriteVertex_b(lua_State* state)
     }
 }
 
-static int lua_SpriteBatchSpriteVertex_g(lua_State* state)
+int lua_SpriteBatchSpriteVertex_g(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -179,7 +184,7 @@ static int lua_SpriteBatchSpriteVertex_g(lua_State* state)
     }
 }
 
-static int lua_SpriteBatchSpriteVertex_r(lua_State* state)
+int lua_SpriteBatchSpriteVertex_r(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -208,7 +213,7 @@ static int lua_SpriteBatchSpriteVertex_r(lua_State* state)
     }
 }
 
-static int lua_SpriteBatchSpriteVertex_u(lua_State* state)
+int lua_SpriteBatchSpriteVertex_u(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -237,7 +242,7 @@ static int lua_SpriteBatchSpriteVertex_u(lua_State* state)
     }
 }
 
-static int lua_SpriteBatchSpriteVertex_v(lua_State* state)
+int lua_SpriteBatchSpriteVertex_v(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -266,7 +271,7 @@ static int lua_SpriteBatchSpriteVertex_v(lua_State* state)
     }
 }
 
-static int lua_SpriteBatchSpriteVertex_x(lua_State* state)
+int lua_SpriteBatchSpriteVertex_x(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -295,7 +300,7 @@ static int lua_SpriteBatchSpriteVertex_x(lua_State* state)
     }
 }
 
-static int lua_SpriteBatchSpriteVertex_y(lua_State* state)
+int lua_SpriteBatchSpriteVertex_y(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -324,7 +329,7 @@ static int lua_SpriteBatchSpriteVertex_y(lua_State* state)
     }
 }
 
-static int lua_SpriteBatchSpriteVertex_z(lua_State* state)
+int lua_SpriteBatchSpriteVertex_z(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
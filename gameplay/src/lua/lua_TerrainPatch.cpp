@@ -20,23 +20,28 @@ extern void luaGlobal_Register_Conversion_Function(const char* className, void*(
 
 static TerrainPatch* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "TerrainPatch");
-    luaL_argcheck(state, userdata != NULL, 1, "'TerrainPatch' expected.");
-    return (TerrainPatch*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "TerrainPatch");
+    luaL_argcheck(state, instance != NULL, 1, "'TerrainPatch' expected.");
+    return (TerrainPatch*)instance;
 }
 
-static int lua_TerrainPatch_cameraChanged(lua_State* state)
+int lua_TerrainPatch_cameraChanged(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL))
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL))
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -67,18 +72,23 @@ static int lua_TerrainPatch_cameraChanged(lua_State* state)
     return 0;
 }
 
-static int lua_TerrainPatch_getBoundingBox(lua_State* state)
+int lua_TerrainPatch_getBoundingBox(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TBOOLEAN)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TBOOLEAN)
             {
                 // Get parameter 1 off the stack.
                 bool param1 = gameplay::ScriptUtil::luaCheckBool(state, 2);
@@ -115,17 +125,22 @@ static int lua_TerrainPatch_getBoundingBox(lua_State* state)
     return 0;
 }
 
-static int lua_TerrainPatch_getMaterial(lua_State* state)
+int lua_TerrainPatch_getMaterial(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 TerrainPatch* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getMaterial());
@@ -151,8 +166,8 @@ static int lua_TerrainPatch_getMaterial(lua_State* state)
         }
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 int param1 = (int)luaL_checkint(state, 2);
@@ -189,17 +204,22 @@ static int lua_TerrainPatch_getMaterial(lua_State* state)
     return 0;
 }
 
-static int lua_TerrainPatch_getMaterialCount(lua_State* state)
+int lua_TerrainPatch_getMaterialCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 TerrainPatch* instance = getInstance(state);
                 unsigned int result = instance->getMaterialCount();
@@ -14,22 +14,27 @@ namespace gameplay
 
 static Theme::SideRegions* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "ThemeSideRegions");
-    luaL_argcheck(state, userdata != NULL, 1, "'ThemeSideRegions' expected.");
-    return (Theme::SideRegions*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "ThemeSideRegions");
+    luaL_argcheck(state, instance != NULL, 1, "'ThemeSideRegions' expected.");
+    return (Theme::SideRegions*)instance;
 }
 
-static int lua_ThemeSideRegions__gc(lua_State* state)
+int lua_ThemeSideRegions__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "ThemeSideRegions");
                 luaL_argcheck(state, userdata != NULL, 1, "'ThemeSideRegions' expected.");
@@ -57,7 +62,7 @@ static int lua_ThemeSideRegions__gc(lua_State* state)
     return 0;
 }
 
-static int lua_ThemeSideRegions__init(lua_State* state)
+int lua_ThemeSideRegions__init(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -94,7 +99,7 @@ static int lua_ThemeSideRegions__init(lua_State* state)
     return 0;
 }
 
-static int lua_ThemeSideRegions_bottom(lua_State* state)
+int lua_ThemeSideRegions_bottom(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -123,7 +128,7 @@ static int lua_ThemeSideRegions_bottom(lua_State* state)
     }
 }
 
-static int lua_ThemeSideRegions_left(lua_State* state)
+int lua_ThemeSideRegions_left(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -152,7 +157,7 @@ static int lua_ThemeSideRegions_left(lua_State* state)
     }
 }
 
-static int lua_ThemeSideRegions_right(lua_State* state)
+int lua_ThemeSideRegions_right(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -181,7 +186,7 @@ static int lua_ThemeSideRegions_right(lua_State* state)
     }
 }
 
-static int lua_ThemeSideRegions_static_empty(lua_State* state)
+int lua_ThemeSideRegions_static_empty(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -218,7 +223,7 @@ static int lua_ThemeSideRegions_static_empty(lua_State* state)
     return 0;
 }
 
-static int lua_ThemeSideRegions_top(lua_State* state)
+int lua_ThemeSideRegions_top(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -9,22 +9,27 @@ namespace gameplay
 
 static Theme::Style* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "ThemeStyle");
-    luaL_argcheck(state, userdata != NULL, 1, "'ThemeStyle' expected.");
-    return (Theme::Style*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "ThemeStyle");
+    luaL_argcheck(state, instance != NULL, 1, "'ThemeStyle' expected.");
+    return (Theme::Style*)instance;
 }
 
-static int lua_ThemeStyle_getTheme(lua_State* state)
+int lua_ThemeStyle_getTheme(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Theme::Style* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getTheme());
@@ -15,24 +15,33 @@ namespace gameplay
 
 extern void luaGlobal_Register_Conversion_Function(const char* className, void*(*func)(void*, const char*));
 
+extern int lua_Ref_addRef(lua_State* state);
+extern int lua_Ref_getRefCount(lua_State* state);
+extern int lua_Ref_release(lua_State* state);
+
 static Theme::ThemeImage* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "ThemeThemeImage");
-    luaL_argcheck(state, userdata != NULL, 1, "'ThemeThemeImage' expected.");
-    return (Theme::ThemeImage*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "ThemeThemeImage");
+    luaL_argcheck(state, instance != NULL, 1, "'ThemeThemeImage' expected.");
+    return (Theme::ThemeImage*)instance;
 }
 
-static int lua_ThemeThemeImage__gc(lua_State* state)
+int lua_ThemeThemeImage__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "ThemeThemeImage");
                 luaL_argcheck(state, userdata != NULL, 1, "'ThemeThemeImage' expected.");
@@ -60,49 +69,22 @@ static int lua_ThemeThemeImage__gc(lua_State* state)
     return 0;
 }
 
-static int lua_ThemeThemeImage_addRef(lua_State* state)
+int lua_ThemeThemeImage_getColor(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                Theme::ThemeImage* instance = getInstance(state);
-                instance->addRef();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_ThemeThemeImage_addRef - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_ThemeThemeImage_getColor(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Theme::ThemeImage* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getColor());
@@ -136,17 +118,22 @@ static int lua_ThemeThemeImage_getColor(lua_State* state)
     return 0;
 }
 
-static int lua_ThemeThemeImage_getId(lua_State* state)
+int lua_ThemeThemeImage_getId(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Theme::ThemeImage* instance = getInstance(state);
                 const char* result = instance->getId();
@@ -171,52 +158,22 @@ static int lua_ThemeThemeImage_getId(lua_State* state)
     return 0;
 }
 
-static int lua_ThemeThemeImage_getRefCount(lua_State* state)
+int lua_ThemeThemeImage_getRegion(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                Theme::ThemeImage* instance = getInstance(state);
-                unsigned int result = instance->getRefCount();
-
-                // Push the return value onto the stack.
-                lua_pushunsigned(state, result);
-
-                return 1;
-            }
-
-            lua_pushstring(state, "lua_ThemeThemeImage_getRefCount - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
-static int lua_ThemeThemeImage_getRegion(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
 
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Theme::ThemeImage* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getRegion());
@@ -250,17 +207,22 @@ static int lua_ThemeThemeImage_getRegion(lua_State* state)
     return 0;
 }
 
-static int lua_ThemeThemeImage_getUVs(lua_State* state)
+int lua_ThemeThemeImage_getUVs(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Theme::ThemeImage* instance = getInstance(state);
                 void* returnPtr = (void*)&(instance->getUVs());
@@ -294,38 +256,6 @@ static int lua_ThemeThemeImage_getUVs(lua_State* state)
     return 0;
 }
 
-static int lua_ThemeThemeImage_release(lua_State* state)
-{
-    // Get the number of parameters.
-    int paramCount = lua_gettop(state);
-
-    // Attempt to match the parameters to a valid binding.
-    switch (paramCount)
-    {
-        case 1:
-        {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
-            {
-                Theme::ThemeImage* instance = getInstance(state);
-                instance->release();
-                
-                return 0;
-            }
-
-            lua_pushstring(state, "lua_ThemeThemeImage_release - Failed to match the given parameters to a valid function signature.");
-            lua_error(state);
-            break;
-        }
-        default:
-        {
-            lua_pushstring(state, "Invalid number of parameters (expected 1).");
-            lua_error(state);
-            break;
-        }
-    }
-    return 0;
-}
-
 // Provides support for conversion to all known relative types of Theme::ThemeImage
 static void* __convertTo(void* ptr, const char* typeName)
 {
@@ -374,13 +304,13 @@ void luaRegister_ThemeThemeImage()
 {
     const luaL_Reg lua_members[] = 
     {
-        {"addRef", lua_ThemeThemeImage_addRef},
         {"getColor", lua_ThemeThemeImage_getColor},
         {"getId", lua_ThemeThemeImage_getId},
-        {"getRefCount", lua_ThemeThemeImage_getRefCount},
         {"getRegion", lua_ThemeThemeImage_getRegion},
         {"getUVs", lua_ThemeThemeImage_getUVs},
-        {"release", lua_ThemeThemeImage_release},
+        {"addRef", lua_Ref_addRef},
+        {"getRefCount", lua_Ref_getRefCount},
+        {"release", lua_Ref_release},
         {"to", lua_ThemeThemeImage_to},
         {NULL, NULL}
     };
@@ -14,22 +14,27 @@ namespace gameplay
 
 static Theme::UVs* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "ThemeUVs");
-    luaL_argcheck(state, userdata != NULL, 1, "'ThemeUVs' expected.");
-    return (Theme::UVs*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "ThemeUVs");
+    luaL_argcheck(state, instance != NULL, 1, "'ThemeUVs' expected.");
+    return (Theme::UVs*)instance;
 }
 
-static int lua_ThemeUVs__gc(lua_State* state)
+int lua_ThemeUVs__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "ThemeUVs");
                 luaL_argcheck(state, userdata != NULL, 1, "'ThemeUVs' expected.");
@@ -57,11 +62,16 @@ static int lua_ThemeUVs__gc(lua_State* state)
     return 0;
 }
 
-static int lua_ThemeUVs__init(lua_State* state)
+int lua_ThemeUVs__init(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[4];
+    for (int i = 0; i < paramCount && i < 4; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -88,10 +98,10 @@ static int lua_ThemeUVs__init(lua_State* state)
         {
             do
             {
-                if (lua_type(state, 1) == LUA_TNUMBER &&
-                    lua_type(state, 2) == LUA_TNUMBER &&
-                    lua_type(state, 3) == LUA_TNUMBER &&
-                    lua_type(state, 4) == LUA_TNUMBER)
+                if (paramTypes[0] == LUA_TNUMBER &&
+                    paramTypes[1] == LUA_TNUMBER &&
+                    paramTypes[2] == LUA_TNUMBER &&
+                    paramTypes[3] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     float param1 = (float)luaL_checknumber(state, 1);
@@ -137,7 +147,7 @@ static int lua_ThemeUVs__init(lua_State* state)
     return 0;
 }
 
-static int lua_ThemeUVs_static_empty(lua_State* state)
+int lua_ThemeUVs_static_empty(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -174,7 +184,7 @@ static int lua_ThemeUVs_static_empty(lua_State* state)
     return 0;
 }
 
-static int lua_ThemeUVs_static_full(lua_State* state)
+int lua_ThemeUVs_static_full(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
@@ -211,7 +221,7 @@ static int lua_ThemeUVs_static_full(lua_State* state)
     return 0;
 }
 
-static int lua_ThemeUVs_u1(lua_State* state)
+int lua_ThemeUVs_u1(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -240,7 +250,7 @@ static int lua_ThemeUVs_u1(lua_State* state)
     }
 }
 
-static int lua_ThemeUVs_u2(lua_State* state)
+int lua_ThemeUVs_u2(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -269,7 +279,7 @@ static int lua_ThemeUVs_u2(lua_State* state)
     }
 }
 
-static int lua_ThemeUVs_v1(lua_State* state)
+int lua_ThemeUVs_v1(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -298,7 +308,7 @@ static int lua_ThemeUVs_v1(lua_State* state)
     }
 }
 
-static int lua_ThemeUVs_v2(lua_State* state)
+int lua_ThemeUVs_v2(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -9,22 +9,27 @@ namespace gameplay
 
 static Touch* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "Touch");
-    luaL_argcheck(state, userdata != NULL, 1, "'Touch' expected.");
-    return (Touch*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "Touch");
+    luaL_argcheck(state, instance != NULL, 1, "'Touch' expected.");
+    return (Touch*)instance;
 }
 
-static int lua_Touch__gc(lua_State* state)
+int lua_Touch__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "Touch");
                 luaL_argcheck(state, userdata != NULL, 1, "'Touch' expected.");
@@ -52,7 +57,7 @@ static int lua_Touch__gc(lua_State* state)
     return 0;
 }
 
-static int lua_Touch_static_MAX_TOUCH_POINTS(lua_State* state)
+int lua_Touch_static_MAX_TOUCH_POINTS(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 0)
@@ -33,22 +33,27 @@ extern void luaGlobal_Register_Conversion_Function(const char* className, void*(
 
 static Transform::Listener* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "TransformListener");
-    luaL_argcheck(state, userdata != NULL, 1, "'TransformListener' expected.");
-    return (Transform::Listener*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "TransformListener");
+    luaL_argcheck(state, instance != NULL, 1, "'TransformListener' expected.");
+    return (Transform::Listener*)instance;
 }
 
-static int lua_TransformListener__gc(lua_State* state)
+int lua_TransformListener__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "TransformListener");
                 luaL_argcheck(state, userdata != NULL, 1, "'TransformListener' expected.");
@@ -76,19 +81,24 @@ static int lua_TransformListener__gc(lua_State* state)
     return 0;
 }
 
-static int lua_TransformListener_transformChanged(lua_State* state)
+int lua_TransformListener_transformChanged(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[3];
+    for (int i = 0; i < paramCount && i < 3; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 3:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                (lua_type(state, 2) == LUA_TUSERDATA || lua_type(state, 2) == LUA_TTABLE || lua_type(state, 2) == LUA_TNIL) &&
-                lua_type(state, 3) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                (paramTypes[1] == LUA_TUSERDATA || paramTypes[1] == LUA_TTABLE || paramTypes[1] == LUA_TNIL) &&
+                paramTypes[2] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -13,22 +13,27 @@ namespace gameplay
 
 static Uniform* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "Uniform");
-    luaL_argcheck(state, userdata != NULL, 1, "'Uniform' expected.");
-    return (Uniform*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "Uniform");
+    luaL_argcheck(state, instance != NULL, 1, "'Uniform' expected.");
+    return (Uniform*)instance;
 }
 
-static int lua_Uniform_getEffect(lua_State* state)
+int lua_Uniform_getEffect(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Uniform* instance = getInstance(state);
                 void* returnPtr = ((void*)instance->getEffect());
@@ -62,17 +67,22 @@ static int lua_Uniform_getEffect(lua_State* state)
     return 0;
 }
 
-static int lua_Uniform_getName(lua_State* state)
+int lua_Uniform_getName(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Uniform* instance = getInstance(state);
                 const char* result = instance->getName();
@@ -97,17 +107,22 @@ static int lua_Uniform_getName(lua_State* state)
     return 0;
 }
 
-static int lua_Uniform_getType(lua_State* state)
+int lua_Uniform_getType(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 Uniform* instance = getInstance(state);
                 GLenum result = instance->getType();
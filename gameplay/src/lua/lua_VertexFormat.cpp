@@ -10,22 +10,27 @@ namespace gameplay
 
 static VertexFormat* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "VertexFormat");
-    luaL_argcheck(state, userdata != NULL, 1, "'VertexFormat' expected.");
-    return (VertexFormat*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "VertexFormat");
+    luaL_argcheck(state, instance != NULL, 1, "'VertexFormat' expected.");
+    return (VertexFormat*)instance;
 }
 
-static int lua_VertexFormat__gc(lua_State* state)
+int lua_VertexFormat__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "VertexFormat");
                 luaL_argcheck(state, userdata != NULL, 1, "'VertexFormat' expected.");
@@ -53,18 +58,23 @@ static int lua_VertexFormat__gc(lua_State* state)
     return 0;
 }
 
-static int lua_VertexFormat__init(lua_State* state)
+int lua_VertexFormat__init(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA || lua_type(state, 1) == LUA_TTABLE || lua_type(state, 1) == LUA_TNIL) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA || paramTypes[0] == LUA_TTABLE || paramTypes[0] == LUA_TNIL) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 bool param1Valid;
@@ -109,18 +119,23 @@ static int lua_VertexFormat__init(lua_State* state)
     return 0;
 }
 
-static int lua_VertexFormat_getElement(lua_State* state)
+int lua_VertexFormat_getElement(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 unsigned int param1 = (unsigned int)luaL_checkunsigned(state, 2);
@@ -157,17 +172,22 @@ static int lua_VertexFormat_getElement(lua_State* state)
     return 0;
 }
 
-static int lua_VertexFormat_getElementCount(lua_State* state)
+int lua_VertexFormat_getElementCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 VertexFormat* instance = getInstance(state);
                 unsigned int result = instance->getElementCount();
@@ -192,17 +212,22 @@ static int lua_VertexFormat_getElementCount(lua_State* state)
     return 0;
 }
 
-static int lua_VertexFormat_getVertexSize(lua_State* state)
+int lua_VertexFormat_getVertexSize(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 VertexFormat* instance = getInstance(state);
                 unsigned int result = instance->getVertexSize();
@@ -227,17 +252,22 @@ static int lua_VertexFormat_getVertexSize(lua_State* state)
     return 0;
 }
 
-static int lua_VertexFormat_static_toString(lua_State* state)
+int lua_VertexFormat_static_toString(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if (lua_type(state, 1) == LUA_TNUMBER)
+            if (paramTypes[0] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 VertexFormat::Usage param1 = (VertexFormat::Usage)luaL_checkint(state, 1);
@@ -10,22 +10,27 @@ namespace gameplay
 
 static VertexFormat::Element* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "VertexFormatElement");
-    luaL_argcheck(state, userdata != NULL, 1, "'VertexFormatElement' expected.");
-    return (VertexFormat::Element*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "VertexFormatElement");
+    luaL_argcheck(state, instance != NULL, 1, "'VertexFormatElement' expected.");
+    return (VertexFormat::Element*)instance;
 }
 
-static int lua_VertexFormatElement__gc(lua_State* state)
+int lua_VertexFormatElement__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "VertexFormatElement");
                 luaL_argcheck(state, userdata != NULL, 1, "'VertexFormatElement' expected.");
@@ -53,11 +58,16 @@ static int lua_VertexFormatElement__gc(lua_State* state)
     return 0;
 }
 
-static int lua_VertexFormatElement__init(lua_State* state)
+int lua_VertexFormatElement__init(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
@@ -84,8 +94,8 @@ static int lua_VertexFormatElement__init(lua_State* state)
         {
             do
             {
-                if (lua_type(state, 1) == LUA_TNUMBER &&
-                    lua_type(state, 2) == LUA_TNUMBER)
+                if (paramTypes[0] == LUA_TNUMBER &&
+                    paramTypes[1] == LUA_TNUMBER)
                 {
                     // Get parameter 1 off the stack.
                     VertexFormat::Usage param1 = (VertexFormat::Usage)luaL_checkint(state, 1);
@@ -125,7 +135,7 @@ static int lua_VertexFormatElement__init(lua_State* state)
     return 0;
 }
 
-static int lua_VertexFormatElement_size(lua_State* state)
+int lua_VertexFormatElement_size(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -154,7 +164,7 @@ static int lua_VertexFormatElement_size(lua_State* state)
     }
 }
 
-static int lua_VertexFormatElement_usage(lua_State* state)
+int lua_VertexFormatElement_usage(lua_State* state)
 {
     // Validate the number of parameters.
     if (lua_gettop(state) > 2)
@@ -18,22 +18,27 @@ extern void luaGlobal_Register_Conversion_Function(const char* className, void*(
 
 static VerticalLayout* getInstance(lua_State* state)
 {
-    void* userdata = luaL_checkudata(state, 1, "VerticalLayout");
-    luaL_argcheck(state, userdata != NULL, 1, "'VerticalLayout' expected.");
-    return (VerticalLayout*)((gameplay::ScriptUtil::LuaObject*)userdata)->instance;
+    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, "VerticalLayout");
+    luaL_argcheck(state, instance != NULL, 1, "'VerticalLayout' expected.");
+    return (VerticalLayout*)instance;
 }
 
-static int lua_VerticalLayout__gc(lua_State* state)
+int lua_VerticalLayout__gc(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 void* userdata = luaL_checkudata(state, 1, "VerticalLayout");
                 luaL_argcheck(state, userdata != NULL, 1, "'VerticalLayout' expected.");
@@ -61,17 +66,22 @@ static int lua_VerticalLayout__gc(lua_State* state)
     return 0;
 }
 
-static int lua_VerticalLayout_addRef(lua_State* state)
+int lua_VerticalLayout_addRef(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 VerticalLayout* instance = getInstance(state);
                 instance->addRef();
@@ -93,17 +103,22 @@ static int lua_VerticalLayout_addRef(lua_State* state)
     return 0;
 }
 
-static int lua_VerticalLayout_getBottomToTop(lua_State* state)
+int lua_VerticalLayout_getBottomToTop(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 VerticalLayout* instance = getInstance(state);
                 bool result = instance->getBottomToTop();
@@ -128,17 +143,22 @@ static int lua_VerticalLayout_getBottomToTop(lua_State* state)
     return 0;
 }
 
-static int lua_VerticalLayout_getRefCount(lua_State* state)
+int lua_VerticalLayout_getRefCount(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 VerticalLayout* instance = getInstance(state);
                 unsigned int result = instance->getRefCount();
@@ -163,17 +183,22 @@ static int lua_VerticalLayout_getRefCount(lua_State* state)
     return 0;
 }
 
-static int lua_VerticalLayout_getSpacing(lua_State* state)
+int lua_VerticalLayout_getSpacing(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 VerticalLayout* instance = getInstance(state);
                 int result = instance->getSpacing();
@@ -198,17 +223,22 @@ static int lua_VerticalLayout_getSpacing(lua_State* state)
     return 0;
 }
 
-static int lua_VerticalLayout_getType(lua_State* state)
+int lua_VerticalLayout_getType(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 VerticalLayout* instance = getInstance(state);
                 Layout::Type result = instance->getType();
@@ -233,17 +263,22 @@ static int lua_VerticalLayout_getType(lua_State* state)
     return 0;
 }
 
-static int lua_VerticalLayout_release(lua_State* state)
+int lua_VerticalLayout_release(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[1];
+    for (int i = 0; i < paramCount && i < 1; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 1:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA))
+            if ((paramTypes[0] == LUA_TUSERDATA))
             {
                 VerticalLayout* instance = getInstance(state);
                 instance->release();
@@ -265,18 +300,23 @@ static int lua_VerticalLayout_release(lua_State* state)
     return 0;
 }
 
-static int lua_VerticalLayout_setBottomToTop(lua_State* state)
+int lua_VerticalLayout_setBottomToTop(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TBOOLEAN)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TBOOLEAN)
             {
                 // Get parameter 1 off the stack.
                 bool param1 = gameplay::ScriptUtil::luaCheckBool(state, 2);
@@ -301,18 +341,23 @@ static int lua_VerticalLayout_setBottomToTop(lua_State* state)
     return 0;
 }
 
-static int lua_VerticalLayout_setSpacing(lua_State* state)
+int lua_VerticalLayout_setSpacing(lua_State* state)
 {
     // Get the number of parameters.
     int paramCount = lua_gettop(state);
 
+    // Get the types of the parameters.
+    int paramTypes[2];
+    for (int i = 0; i < paramCount && i < 2; i++)
+        paramTypes[i] = lua_type(state, i + 1);
+
     // Attempt to match the parameters to a valid binding.
     switch (paramCount)
     {
         case 2:
         {
-            if ((lua_type(state, 1) == LUA_TUSERDATA) &&
-                lua_type(state, 2) == LUA_TNUMBER)
+            if ((paramTypes[0] == LUA_TUSERDATA) &&
+                paramTypes[1] == LUA_TNUMBER)
             {
                 // Get parameter 1 off the stack.
                 int param1 = (int)luaL_checkint(state, 2);
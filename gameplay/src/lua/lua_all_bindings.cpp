@@ -104,6 +104,7 @@ void lua_RegisterAllBindings()
     luaRegister_RenderState();
     luaRegister_RenderStateStateBlock();
     luaRegister_RenderTarget();
+    luaRegister_ResourceStats();
     luaRegister_Scene();
     luaRegister_ScreenDisplayer();
     luaRegister_Script();
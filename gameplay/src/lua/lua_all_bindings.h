@@ -99,6 +99,7 @@
 #include "lua_RenderState.h"
 #include "lua_RenderStateStateBlock.h"
 #include "lua_RenderTarget.h"
+#include "lua_ResourceStats.h"
 #include "lua_Scene.h"
 #include "lua_ScreenDisplayer.h"
 #include "lua_Script.h"
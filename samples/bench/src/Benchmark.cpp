@@ -0,0 +1,103 @@
+#include "Benchmark.h"
+
+// The most iterations a sample is calibrated to.
+#define BENCHMARK_MAX_ITERATIONS (1 << 24)
+
+Benchmark::Benchmark(unsigned int samples, double minSampleTime, const char* filter)
+    : _samples(samples > 0 ? samples : 1), _minSampleTime(minSampleTime), _filter(filter ? filter : "")
+{
+}
+
+bool Benchmark::isSelected(const char* name) const
+{
+    return _filter.empty() || strstr(name, _filter.c_str()) != NULL;
+}
+
+double Benchmark::time(const std::function<void()>& body, unsigned int iterations) const
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; ++i)
+    {
+        body();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+void Benchmark::run(const char* name, const std::function<void()>& body, unsigned int operations)
+{
+    GP_ASSERT(name);
+    GP_ASSERT(operations > 0);
+
+    if (!isSelected(name))
+        return;
+
+    // Warm up the caches, then double the iterations until a sample lasts long enough to time reliably.
+    body();
+    unsigned int iterations = 1;
+    while (iterations < BENCHMARK_MAX_ITERATIONS && time(body, iterations) < _minSampleTime * 1000000.0)
+    {
+        iterations *= 2;
+    }
+
+    std::vector<double> samples(_samples);
+    double total = 0.0;
+    for (unsigned int i = 0; i < _samples; ++i)
+    {
+        samples[i] = time(body, iterations) / ((double)iterations * operations);
+        total += samples[i];
+    }
+    std::sort(samples.begin(), samples.end());
+
+    Result result;
+    result.name = name;
+    result.iterations = iterations;
+    result.samples = _samples;
+    result.operations = operations;
+    result.minNs = samples.front();
+    result.medianNs = (_samples % 2) ? samples[_samples / 2] : (samples[_samples / 2 - 1] + samples[_samples / 2]) * 0.5;
+    result.meanNs = total / _samples;
+    _results.push_back(result);
+
+    print("%-32s %12.1f ns/op (min %.1f, mean %.1f, %u x %u iterations)\n",
+        name, result.medianNs, result.minNs, result.meanNs, _samples, iterations);
+}
+
+const std::vector<Benchmark::Result>& Benchmark::getResults() const
+{
+    return _results;
+}
+
+bool Benchmark::writeJson(const char* path) const
+{
+    GP_ASSERT(path);
+
+    std::ostringstream json;
+    json << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0, count = _results.size(); i < count; ++i)
+    {
+        const Result& result = _results[i];
+        json << "    { \"name\": \"" << result.name << "\""
+             << ", \"iterations\": " << result.iterations
+             << ", \"samples\": " << result.samples
+             << ", \"operations\": " << result.operations
+             << ", \"min_ns\": " << result.minNs
+             << ", \"median_ns\": " << result.medianNs
+             << ", \"mean_ns\": " << result.meanNs
+             << " }" << (i + 1 < count ? "," : "") << "\n";
+    }
+    json << "  ]\n}\n";
+
+    std::unique_ptr<Stream> stream(FileSystem::open(path, FileSystem::WRITE));
+    if (!stream.get())
+    {
+        GP_ERROR("Failed to open benchmark results file '%s' for writing.", path);
+        return false;
+    }
+    const std::string text = json.str();
+    if (stream->write(text.c_str(), 1, text.size()) != text.size())
+    {
+        GP_ERROR("Failed to write benchmark results to '%s'.", path);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,88 @@
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include "gameplay.h"
+
+using namespace gameplay;
+
+/**
+ * Runs microbenchmarks and records their timings.
+ *
+ * Each benchmark is calibrated to a number of iterations that takes at least the
+ * minimum sample time, then timed over a fixed number of samples of that many
+ * iterations. The minimum, median and mean time of an operation are recorded, where
+ * one iteration may perform several operations, so that results stay comparable
+ * between runs and machines of different speeds.
+ */
+class Benchmark
+{
+public:
+
+    /**
+     * The timings of a benchmark.
+     */
+    struct Result
+    {
+        std::string name;
+        unsigned int iterations;
+        unsigned int samples;
+        unsigned int operations;
+        double minNs;
+        double medianNs;
+        double meanNs;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param samples The number of timed samples of each benchmark.
+     * @param minSampleTime The minimum duration of a sample, in milliseconds.
+     * @param filter Only benchmarks whose name contains this string are run, or all if it is NULL or empty.
+     */
+    Benchmark(unsigned int samples, double minSampleTime, const char* filter);
+
+    /**
+     * Runs a benchmark.
+     *
+     * @param name The name of the benchmark.
+     * @param body The function to time, which performs one iteration.
+     * @param operations The number of operations performed by one iteration.
+     */
+    void run(const char* name, const std::function<void()>& body, unsigned int operations = 1);
+
+    /**
+     * Returns whether a benchmark is selected by the filter.
+     *
+     * @param name The name of the benchmark.
+     *
+     * @return true if the benchmark should run.
+     */
+    bool isSelected(const char* name) const;
+
+    /**
+     * Gets the results of the benchmarks that have run.
+     *
+     * @return The results, in the order the benchmarks ran.
+     */
+    const std::vector<Result>& getResults() const;
+
+    /**
+     * Writes the results as JSON.
+     *
+     * @param path The path of the file to write.
+     *
+     * @return true if the file was written.
+     */
+    bool writeJson(const char* path) const;
+
+private:
+
+    double time(const std::function<void()>& body, unsigned int iterations) const;
+
+    unsigned int _samples;
+    double _minSampleTime;
+    std::string _filter;
+    std::vector<Result> _results;
+};
+
+#endif
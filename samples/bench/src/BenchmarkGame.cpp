@@ -0,0 +1,342 @@
+#include "BenchmarkGame.h"
+
+// The number of top level nodes of the transform benchmarks, each the root of a chain of children.
+#define BENCHMARK_NODE_ROOTS 64
+
+// The length of the chain of children under each top level node.
+#define BENCHMARK_NODE_DEPTH 16
+
+// The number of animation clips played at once by the animation benchmark.
+#define BENCHMARK_ANIMATION_CLIPS 256
+
+// The number of sprites or quads drawn in a batch by the batching benchmarks.
+#define BENCHMARK_BATCH_SIZE 1000
+
+// The number of rays cast in an iteration of the physics benchmark.
+#define BENCHMARK_RAYS 100
+
+// The scene loaded by the bundle benchmark.
+#define BENCHMARK_BUNDLE_PATH "res/common/duck.gpb"
+
+// The file parsed by the properties benchmark.
+#define BENCHMARK_PROPERTIES_PATH "res/ui/default.theme"
+
+// Declare our game instance
+gameplay::BenchmarkGame game;
+
+namespace gameplay
+{
+
+// Returns a repeatable pseudo-random number in [0, 1), so that every run does the same work.
+static float nextRandom(unsigned int& seed)
+{
+    seed = seed * 1664525u + 1013904223u;
+    return (seed >> 8) * (1.0f / 16777216.0f);
+}
+
+BenchmarkGame::BenchmarkGame()
+{
+}
+
+void BenchmarkGame::initialize()
+{
+    Properties* config = getConfig() ? getConfig()->getNamespace("benchmark", true) : NULL;
+    const unsigned int samples = config && config->exists("samples") ? (unsigned int)config->getInt("samples") : 15;
+    const float minSampleTime = config && config->exists("minSampleTime") ? config->getFloat("minSampleTime") : 10.0f;
+    const char* filter = config ? config->getString("filter") : NULL;
+    const char* output = config && config->exists("output") ? config->getString("output") : "bench.json";
+
+    Benchmark benchmark(samples, minSampleTime, filter);
+    benchmarkNodeTransforms(benchmark);
+    benchmarkCurve(benchmark);
+    benchmarkAnimation(benchmark);
+    benchmarkSpriteBatch(benchmark);
+    benchmarkMeshBatch(benchmark);
+    benchmarkFont(benchmark);
+    benchmarkBundle(benchmark);
+    benchmarkProperties(benchmark);
+    benchmarkPhysics(benchmark);
+
+    if (benchmark.writeJson(output))
+        print("Wrote %u benchmark results to '%s'.\n", (unsigned int)benchmark.getResults().size(), output);
+
+    exit();
+}
+
+void BenchmarkGame::finalize()
+{
+}
+
+void BenchmarkGame::update(float elapsedTime)
+{
+}
+
+void BenchmarkGame::render(float elapsedTime)
+{
+    clear(CLEAR_COLOR_DEPTH, Vector4::zero(), 1.0f, 0);
+}
+
+void BenchmarkGame::benchmarkNodeTransforms(Benchmark& benchmark)
+{
+    if (!benchmark.isSelected("node_world_matrix") && !benchmark.isSelected("scene_update_transforms"))
+        return;
+
+    Scene* scene = Scene::create();
+    std::vector<Node*> roots;
+    std::vector<Node*> leaves;
+    for (unsigned int i = 0; i < BENCHMARK_NODE_ROOTS; ++i)
+    {
+        Node* node = scene->addNode();
+        node->setTranslation((float)i, 0.0f, 0.0f);
+        roots.push_back(node);
+        for (unsigned int j = 0; j < BENCHMARK_NODE_DEPTH; ++j)
+        {
+            Node* child = Node::create();
+            child->setTranslation(0.0f, 1.0f, 0.0f);
+            child->setRotation(Vector3::unitZ(), 0.1f);
+            node->addChild(child);
+            child->release();
+            node = child;
+        }
+        leaves.push_back(node);
+    }
+
+    const unsigned int nodeCount = BENCHMARK_NODE_ROOTS * (BENCHMARK_NODE_DEPTH + 1);
+
+    // Moving the roots dirties every node below them, which resolving the leaves then updates.
+    benchmark.run("node_world_matrix", [&]()
+    {
+        for (size_t i = 0; i < roots.size(); ++i)
+            roots[i]->rotateY(0.01f);
+        for (size_t i = 0; i < leaves.size(); ++i)
+            leaves[i]->getWorldMatrix();
+    }, nodeCount);
+
+    benchmark.run("scene_update_transforms", [&]()
+    {
+        for (size_t i = 0; i < roots.size(); ++i)
+            roots[i]->rotateY(0.01f);
+        scene->updateTransforms();
+    }, nodeCount);
+
+    SAFE_RELEASE(scene);
+}
+
+void BenchmarkGame::benchmarkCurve(Benchmark& benchmark)
+{
+    const unsigned int pointCount = 32;
+    Curve* curve = Curve::create(pointCount, 4);
+    unsigned int seed = 1;
+    for (unsigned int i = 0; i < pointCount; ++i)
+    {
+        float value[4] = { nextRandom(seed), nextRandom(seed), nextRandom(seed), nextRandom(seed) };
+        curve->setPoint(i, (float)i / (pointCount - 1), value, Curve::LINEAR);
+    }
+
+    float times[BENCHMARK_BATCH_SIZE];
+    for (unsigned int i = 0; i < BENCHMARK_BATCH_SIZE; ++i)
+        times[i] = nextRandom(seed);
+
+    float result[4];
+    benchmark.run("curve_evaluate", [&]()
+    {
+        for (unsigned int i = 0; i < BENCHMARK_BATCH_SIZE; ++i)
+            curve->evaluate(times[i], result);
+    }, BENCHMARK_BATCH_SIZE);
+
+    SAFE_RELEASE(curve);
+}
+
+void BenchmarkGame::benchmarkAnimation(Benchmark& benchmark)
+{
+    if (!benchmark.isSelected("animation_controller_update"))
+        return;
+
+    unsigned int keyTimes[] = { 0, 250, 500, 1000 };
+    float keyValues[] =
+    {
+        0.0f, 0.0f, 0.0f,
+        1.0f, 2.0f, 0.0f,
+        2.0f, 0.0f, 1.0f,
+        0.0f, 0.0f, 0.0f
+    };
+
+    std::vector<Node*> nodes;
+    for (unsigned int i = 0; i < BENCHMARK_ANIMATION_CLIPS; ++i)
+    {
+        Node* node = Node::create();
+        Animation* animation = node->createAnimation("move", Transform::ANIMATE_TRANSLATE, 4, keyTimes, keyValues, Curve::LINEAR);
+        AnimationClip* clip = animation->getClip();
+        clip->setRepeatCount(AnimationClip::REPEAT_INDEFINITE);
+        clip->play();
+        animation->release();
+        nodes.push_back(node);
+    }
+
+    AnimationController* controller = getAnimationController();
+    benchmark.run("animation_controller_update", [&]()
+    {
+        controller->advance(16.0f);
+    }, BENCHMARK_ANIMATION_CLIPS);
+
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        nodes[i]->getAnimation("move")->stop();
+        SAFE_RELEASE(nodes[i]);
+    }
+}
+
+void BenchmarkGame::benchmarkSpriteBatch(Benchmark& benchmark)
+{
+    if (!benchmark.isSelected("sprite_batch_fill"))
+        return;
+
+    unsigned char pixels[16 * 16 * 4];
+    memset(pixels, 0xff, sizeof(pixels));
+    Texture* texture = Texture::create(Texture::RGBA, 16, 16, pixels);
+    SpriteBatch* batch = SpriteBatch::create(texture, NULL, BENCHMARK_BATCH_SIZE);
+    SAFE_RELEASE(texture);
+
+    const Vector4 color(1.0f, 1.0f, 1.0f, 1.0f);
+    benchmark.run("sprite_batch_fill", [&]()
+    {
+        batch->start();
+        for (unsigned int i = 0; i < BENCHMARK_BATCH_SIZE; ++i)
+            batch->draw((float)(i % 40) * 16.0f, (float)(i / 40) * 16.0f, 16.0f, 16.0f, 0.0f, 0.0f, 1.0f, 1.0f, color);
+        batch->finish();
+    }, BENCHMARK_BATCH_SIZE);
+
+    SAFE_DELETE(batch);
+}
+
+void BenchmarkGame::benchmarkMeshBatch(Benchmark& benchmark)
+{
+    if (!benchmark.isSelected("mesh_batch_fill"))
+        return;
+
+    struct Vertex
+    {
+        float x, y, z;
+        float r, g, b;
+    };
+
+    VertexFormat::Element elements[] =
+    {
+        VertexFormat::Element(VertexFormat::POSITION, 3),
+        VertexFormat::Element(VertexFormat::COLOR, 3)
+    };
+    Material* material = Material::create("res/shaders/colored.vert", "res/shaders/colored.frag", "VERTEX_COLOR");
+    MeshBatch* batch = MeshBatch::create(VertexFormat(elements, 2), Mesh::TRIANGLES, material, true, BENCHMARK_BATCH_SIZE * 4, BENCHMARK_BATCH_SIZE * 4);
+    SAFE_RELEASE(material);
+
+    Vertex vertices[4] =
+    {
+        { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f },
+        { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f },
+        { 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f },
+        { 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f }
+    };
+    unsigned short indices[6] = { 0, 1, 2, 0, 2, 3 };
+
+    benchmark.run("mesh_batch_fill", [&]()
+    {
+        batch->start();
+        for (unsigned int i = 0; i < BENCHMARK_BATCH_SIZE; ++i)
+            batch->add(vertices, 4, indices, 6);
+        batch->finish();
+    }, BENCHMARK_BATCH_SIZE);
+
+    SAFE_DELETE(batch);
+}
+
+void BenchmarkGame::benchmarkFont(Benchmark& benchmark)
+{
+    if (!benchmark.isSelected("font_draw_text"))
+        return;
+
+    Font* font = Font::create("res/ui/arial.gpb");
+    if (!font)
+        return;
+
+    const char* text =
+        "The quick brown fox jumps over the lazy dog.\n"
+        "Pack my box with five dozen liquor jugs.\n"
+        "How vexingly quick daft zebras jump!\n"
+        "Sphinx of black quartz, judge my vow.";
+    const unsigned int characters = (unsigned int)strlen(text);
+    const Vector4 color(1.0f, 1.0f, 1.0f, 1.0f);
+
+    benchmark.run("font_draw_text", [&]()
+    {
+        font->start();
+        font->drawText(text, 0, 0, color, 18);
+        font->finish();
+    }, characters);
+
+    SAFE_RELEASE(font);
+}
+
+void BenchmarkGame::benchmarkBundle(Benchmark& benchmark)
+{
+    if (!benchmark.isSelected("bundle_load_scene"))
+        return;
+
+    benchmark.run("bundle_load_scene", [&]()
+    {
+        Bundle* bundle = Bundle::create(BENCHMARK_BUNDLE_PATH);
+        if (bundle)
+        {
+            Scene* scene = bundle->loadScene();
+            SAFE_RELEASE(scene);
+            SAFE_RELEASE(bundle);
+        }
+    });
+}
+
+void BenchmarkGame::benchmarkProperties(Benchmark& benchmark)
+{
+    if (!benchmark.isSelected("properties_parse"))
+        return;
+
+    // Parsed files are cached, so the cache is emptied for every file to be parsed again.
+    benchmark.run("properties_parse", [&]()
+    {
+        Properties::clearCache();
+        Properties* properties = Properties::create(BENCHMARK_PROPERTIES_PATH);
+        SAFE_DELETE(properties);
+    });
+}
+
+void BenchmarkGame::benchmarkPhysics(Benchmark& benchmark)
+{
+    if (!benchmark.isSelected("physics_ray_test"))
+        return;
+
+    // A grid of static boxes, for rays cast straight down onto it.
+    const unsigned int gridSize = 16;
+    Scene* scene = Scene::create();
+    PhysicsRigidBody::Parameters parameters(0.0f);
+    for (unsigned int i = 0; i < gridSize * gridSize; ++i)
+    {
+        Node* node = scene->addNode();
+        node->setTranslation((float)(i % gridSize) * 2.0f, 0.0f, (float)(i / gridSize) * 2.0f);
+        node->setCollisionObject(PhysicsCollisionObject::RIGID_BODY, PhysicsCollisionShape::box(), &parameters);
+    }
+
+    std::vector<Ray> rays;
+    unsigned int seed = 1;
+    for (unsigned int i = 0; i < BENCHMARK_RAYS; ++i)
+        rays.push_back(Ray(Vector3(nextRandom(seed) * gridSize * 2.0f, 10.0f, nextRandom(seed) * gridSize * 2.0f), Vector3(0.0f, -1.0f, 0.0f)));
+
+    PhysicsController* physics = getPhysicsController();
+    PhysicsController::HitResult result;
+    benchmark.run("physics_ray_test", [&]()
+    {
+        for (size_t i = 0; i < rays.size(); ++i)
+            physics->rayTest(rays[i], 100.0f, &result);
+    }, BENCHMARK_RAYS);
+
+    SAFE_RELEASE(scene);
+}
+
+}
@@ -0,0 +1,75 @@
+#ifndef BENCHMARKGAME_H_
+#define BENCHMARKGAME_H_
+
+#include "gameplay.h"
+#include "Benchmark.h"
+
+namespace gameplay
+{
+
+/**
+ * Runs the engine microbenchmarks and exits.
+ *
+ * The benchmarks run once the game is initialized, so that the ones that need a
+ * graphics context have one, and their results are written as JSON to the file named
+ * by the output property of the benchmark namespace of game.config. The samples,
+ * minSampleTime and filter properties of the namespace configure the runs.
+ *
+ * It is declared in the gameplay namespace so that the engine can let it call the
+ * update methods of its controllers, which only Game otherwise calls.
+ */
+class BenchmarkGame : public Game
+{
+public:
+
+    /**
+     * Constructor.
+     */
+    BenchmarkGame();
+
+protected:
+
+    /**
+     * @see Game::initialize
+     */
+    void initialize();
+
+    /**
+     * @see Game::finalize
+     */
+    void finalize();
+
+    /**
+     * @see Game::update
+     */
+    void update(float elapsedTime);
+
+    /**
+     * @see Game::render
+     */
+    void render(float elapsedTime);
+
+private:
+
+    void benchmarkNodeTransforms(Benchmark& benchmark);
+
+    void benchmarkCurve(Benchmark& benchmark);
+
+    void benchmarkAnimation(Benchmark& benchmark);
+
+    void benchmarkSpriteBatch(Benchmark& benchmark);
+
+    void benchmarkMeshBatch(Benchmark& benchmark);
+
+    void benchmarkFont(Benchmark& benchmark);
+
+    void benchmarkBundle(Benchmark& benchmark);
+
+    void benchmarkProperties(Benchmark& benchmark);
+
+    void benchmarkPhysics(Benchmark& benchmark);
+};
+
+}
+
+#endif
@@ -20,7 +20,7 @@ CharacterGame game;
 #define BUTTON_2 1
 
 CharacterGame::CharacterGame()
-    : _font(NULL), _scene(NULL), _character(NULL), _characterNode(NULL), _characterMeshNode(NULL), _characterShadowNode(NULL), _basketballNode(NULL),
+    : _font(NULL), _splash(NULL), _scene(NULL), _character(NULL), _characterNode(NULL), _characterMeshNode(NULL), _characterShadowNode(NULL), _basketballNode(NULL),
       _animation(NULL), _currentClip(NULL), _jumpClip(NULL), _kickClip(NULL), _rotateX(0), _materialParameterAlpha(NULL),
       _keyFlags(0), _physicsDebug(false), _wireframe(false), _hasBall(false), _applyKick(false), _gamepad(NULL)
 {
@@ -32,14 +32,21 @@ void CharacterGame::initialize()
     // Enable multi-touch (only affects devices that support multi-touch).
     setMultiTouch(true);
 
-    // Display the gameplay splash screen for at least 1 second.
-    displayScreen(this, &CharacterGame::drawSplash, NULL, 1000L);
-
     // Load the font.
     _font = Font::create("res/ui/arial.gpb");
 
-    // Load scene.
-    _scene = Scene::load("res/common/sample.scene");
+    // Display the gameplay splash screen for at least 1 second, while the scene loads in the background.
+    _splash = SpriteBatch::create("res/logo_powered_white.png");
+    LoadingScreen::start(std::bind(&CharacterGame::drawSplash, this, std::placeholders::_1), [this]() { SAFE_DELETE(_splash); }, 1000L);
+    LoadingScreen::loadScene("res/common/sample.scene", std::bind(&CharacterGame::initializeLoadedScene, this, std::placeholders::_1));
+
+    _gamepad = getGamepad(0);
+}
+
+void CharacterGame::initializeLoadedScene(Scene* scene)
+{
+    _scene = scene;
+    GP_ASSERT(_scene);
 
     // Update the aspect ratio for our scene's camera to match the current device resolution.
     _scene->getActiveCamera()->setAspectRatio(getAspectRatio());
@@ -60,8 +67,6 @@ void CharacterGame::initialize()
 
     // Initialize scene.
     _scene->visit(this, &CharacterGame::initializeScene);
-
-    _gamepad = getGamepad(0);
 }
 
 bool CharacterGame::initializeScene(Node* node)
@@ -129,18 +134,23 @@ void CharacterGame::initializeCharacter()
 void CharacterGame::finalize()
 {
     SAFE_RELEASE(_scene);
+    SAFE_DELETE(_splash);
     SAFE_RELEASE(_font);
     SAFE_DELETE_ARRAY(_buttonPressed);
 }
 
-void CharacterGame::drawSplash(void* param)
+void CharacterGame::drawSplash(float progress)
 {
     clear(CLEAR_COLOR_DEPTH, Vector4(0, 0, 0, 1), 1.0f, 0);
-    SpriteBatch* batch = SpriteBatch::create("res/logo_powered_white.png");
-    batch->start();
-    batch->draw(getWidth() * 0.5f, getHeight() * 0.5f, 0.0f, 512.0f, 512.0f, 0.0f, 1.0f, 1.0f, 0.0f, Vector4::one(), true);
-    batch->finish();
-    SAFE_DELETE(batch);
+    _splash->start();
+    _splash->draw(getWidth() * 0.5f, getHeight() * 0.5f, 0.0f, 512.0f, 512.0f, 0.0f, 1.0f, 1.0f, 0.0f, Vector4::one(), true);
+    _splash->finish();
+
+    char text[32];
+    sprintf(text, "Loading %d%%", (int)(progress * 100.0f));
+    _font->start();
+    _font->drawText(text, 5, getHeight() - 25, Vector4::one(), 20);
+    _font->finish();
 }
 
 bool CharacterGame::drawScene(Node* node, bool transparent)
@@ -396,6 +406,10 @@ void CharacterGame::render(float elapsedTime)
 
 void CharacterGame::keyEvent(Keyboard::KeyEvent evt, int key)
 {
+    // The character only exists once the scene has loaded.
+    if (_scene == NULL && key != Keyboard::KEY_ESCAPE)
+        return;
+
     if (evt == Keyboard::KEY_PRESS)
     {
         switch (key)
@@ -471,6 +485,9 @@ void CharacterGame::keyEvent(Keyboard::KeyEvent evt, int key)
 
 void CharacterGame::touchEvent(Touch::TouchEvent evt, int x, int y, unsigned int contactIndex)
 {
+    if (_scene == NULL)
+        return;
+
     // This should only be called if the gamepad did not handle the touch event.
     switch (evt)
     {
@@ -498,6 +515,9 @@ void CharacterGame::touchEvent(Touch::TouchEvent evt, int x, int y, unsigned int
 
 bool CharacterGame::mouseEvent(Mouse::MouseEvent evt, int x, int y, int wheelDelta)
 {
+    if (_scene == NULL)
+        return false;
+
     if (evt == Mouse::MOUSE_PRESS_RIGHT_BUTTON)
     {
         kick();
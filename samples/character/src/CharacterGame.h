@@ -75,7 +75,8 @@ private:
     bool initializeScene(Node* node);
     void initializeMaterial(Scene* scene, Node* node, Material* material);
     void initializeCharacter();
-    void drawSplash(void* param);
+    void initializeLoadedScene(Scene* scene);
+    void drawSplash(float progress);
     bool drawScene(Node* node, bool transparent);
     void play(const char* id, bool repeat, float speed = 1.0f);
     void jump();
@@ -87,6 +88,7 @@ private:
     void releaseBall();
 
     Font* _font;
+    SpriteBatch* _splash;
     Scene* _scene;
     PhysicsCharacter* _character;
     Node* _characterNode;
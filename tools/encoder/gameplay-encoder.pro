@@ -17,8 +17,10 @@ SOURCES += src/Mesh.cpp \
     src/Animations.cpp \
     src/Base.cpp \
     src/BoundingVolume.cpp \
+    src/BuildCache.cpp \
     src/Camera.cpp \
     src/Constants.cpp \
+    src/ConvexHull.cpp \
     src/Curve.cpp \
     src/edtaa3func.c \
     src/Effect.cpp \
@@ -33,11 +35,16 @@ SOURCES += src/Mesh.cpp \
     src/Heightmap.cpp \
     src/Image.cpp \
     src/Light.cpp \
+    src/LuaEncoder.cpp \
+    src/ArchiveEncoder.cpp \
+    src/PropertiesEncoder.cpp \
     src/main.cpp \
     src/Material.cpp \
     src/MaterialParameter.cpp \
     src/Matrix.cpp \
+    src/MeshOptimizer.cpp \
     src/MeshPart.cpp \
+    src/MeshSimplifier.cpp \
     src/MeshSkin.cpp \
     src/MeshSubSet.cpp \
     src/Model.cpp \
@@ -52,6 +59,8 @@ SOURCES += src/Mesh.cpp \
     src/StringUtil.cpp \
     src/Transform.cpp \
     src/TTFFontEncoder.cpp \
+    src/TextureEncoder.cpp \
+    src/ThreadPool.cpp \
     src/TMXSceneEncoder.cpp \
     src/TMXTypes.cpp \
     src/Vector2.cpp \
@@ -66,8 +75,10 @@ HEADERS += src/AnimationChannel.h \
     src/Animations.h \
     src/Base.h \
     src/BoundingVolume.h \
+    src/BuildCache.h \
     src/Camera.h \
     src/Constants.h \
+    src/ConvexHull.h \
     src/Curve.h \
     src/Curve.inl \
     src/edtaa3func.h \
@@ -83,11 +94,16 @@ HEADERS += src/AnimationChannel.h \
     src/Heightmap.h \
     src/Image.h \
     src/Light.h \
+    src/LuaEncoder.h \
+    src/ArchiveEncoder.h \
+    src/PropertiesEncoder.h \
     src/Material.h \
     src/MaterialParameter.h \
     src/Matrix.h \
     src/Mesh.h \
+    src/MeshOptimizer.h \
     src/MeshPart.h \
+    src/MeshSimplifier.h \
     src/MeshSkin.h \
     src/MeshSubSet.h \
     src/Model.h \
@@ -101,7 +117,9 @@ HEADERS += src/AnimationChannel.h \
     src/Sampler.h \
     src/Scene.h \
     src/StringUtil.h \
+    src/TextureEncoder.h \
     src/Thread.h \
+    src/ThreadPool.h \
     src/Transform.h \
     src/TTFFontEncoder.h \
     src/TMXSceneEncoder.h \
@@ -5,8 +5,47 @@
 namespace gameplay
 {
 
+// Largest magnitude of the three smallest components of a unit quaternion.
+#define QUATERNION_COMPONENT_MAX 0.70710678f
+
+static unsigned short quantizeRotationComponent(float value)
+{
+    float s = (value / QUATERNION_COMPONENT_MAX) * 0.5f + 0.5f;
+    s = std::min(std::max(s, 0.0f), 1.0f);
+    return (unsigned short)(s * 32767.0f + 0.5f);
+}
+
+/**
+ * Quantizes a quaternion to its three smallest components, after flipping its sign so that its
+ * largest component is positive. The index of the largest component is kept in the top bits of
+ * the first two values.
+ */
+static void quantizeQuaternion(const float* q, unsigned short* dst)
+{
+    float length = sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    if (length <= 0.0f)
+        length = 1.0f;
+
+    unsigned int largest = 0;
+    for (unsigned int i = 1; i < 4; ++i)
+    {
+        if (fabs(q[i]) > fabs(q[largest]))
+            largest = i;
+    }
+    const float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+
+    unsigned int j = 0;
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        if (i != largest)
+            dst[j++] = quantizeRotationComponent(q[i] * sign / length);
+    }
+    dst[0] |= (unsigned short)((largest >> 1) << 15);
+    dst[1] |= (unsigned short)((largest & 1) << 15);
+}
+
 AnimationChannel::AnimationChannel(void) :
-    _targetAttrib(0)
+    _targetAttrib(0), _compressed(false)
 {
 }
 
@@ -28,17 +67,78 @@ void AnimationChannel::writeBinary(FILE* file)
     Object::writeBinary(file);
     write(_targetId, file);
     write(_targetAttrib, file);
+    const bool quantized = _compressed && isLinear() && Transform::getPropertySize(_targetAttrib) > 0;
+    write((unsigned int)(quantized ? QUANTIZED_KEYFRAMES : FLOAT_KEYFRAMES), file);
     write((unsigned int)_keytimes.size(), file);
     for (std::vector<float>::const_iterator i = _keytimes.begin(); i != _keytimes.end(); ++i)
     {
         write((unsigned int)*i, file);
     }
-    write(_keyValues, file);
-    write(_tangentsIn, file);
-    write(_tangentsOut, file);
+    if (quantized)
+    {
+        writeQuantizedValues(file);
+    }
+    else
+    {
+        write(_keyValues, file);
+        write(_tangentsIn, file);
+        write(_tangentsOut, file);
+    }
     write(_interpolations, file);
 }
 
+void AnimationChannel::writeQuantizedValues(FILE* file)
+{
+    const unsigned int propSize = Transform::getPropertySize(_targetAttrib);
+    const int rotationOffset = Transform::getRotationOffset(_targetAttrib);
+    const size_t keyCount = _keyValues.size() / propSize;
+
+    write(propSize, file);
+    write(rotationOffset < 0 ? propSize : (unsigned int)rotationOffset, file);
+
+    // Each scalar component is quantized within its own range, stored as its minimum and step.
+    std::vector<float> ranges;
+    for (unsigned int c = 0; c < propSize; ++c)
+    {
+        if (rotationOffset >= 0 && c >= (unsigned int)rotationOffset && c < (unsigned int)rotationOffset + 4)
+            continue;
+        float minValue = FLT_MAX;
+        float maxValue = -FLT_MAX;
+        for (size_t k = 0; k < keyCount; ++k)
+        {
+            minValue = std::min(minValue, _keyValues[k * propSize + c]);
+            maxValue = std::max(maxValue, _keyValues[k * propSize + c]);
+        }
+        ranges.push_back(minValue);
+        ranges.push_back((maxValue - minValue) / 65535.0f);
+    }
+
+    std::vector<unsigned short> values;
+    for (size_t k = 0; k < keyCount; ++k)
+    {
+        const float* key = &_keyValues[k * propSize];
+        unsigned int range = 0;
+        for (unsigned int c = 0; c < propSize; ++c)
+        {
+            if (rotationOffset >= 0 && c >= (unsigned int)rotationOffset && c < (unsigned int)rotationOffset + 4)
+                continue;
+            const float step = ranges[range * 2 + 1];
+            const float q = step > 0.0f ? (key[c] - ranges[range * 2]) / step : 0.0f;
+            values.push_back((unsigned short)std::min(std::max(q + 0.5f, 0.0f), 65535.0f));
+            ++range;
+        }
+        if (rotationOffset >= 0)
+        {
+            unsigned short rotation[3];
+            quantizeQuaternion(key + rotationOffset, rotation);
+            values.insert(values.end(), rotation, rotation + 3);
+        }
+    }
+
+    write(ranges, file);
+    write(values, file);
+}
+
 void AnimationChannel::writeText(FILE* file)
 {
     fprintElementStart(file);
@@ -49,6 +149,8 @@ void AnimationChannel::writeText(FILE* file)
     fprintfElement(file, "%f ", "tangentsIn", _tangentsIn);
     fprintfElement(file, "%f ", "tangentsOut", _tangentsOut);
     fprintfElement(file, "%u ", "interpolations", _interpolations);
+    if (_compressed)
+        fprintfElement(file, "compressed", (unsigned int)1);
     fprintElementEnd(file);
 }
 
@@ -175,6 +277,79 @@ void AnimationChannel::removeDuplicates()
     LOG(3, "      Removed %d duplicate keyframes from channel.\n", startCount- _keytimes.size());
 }
 
+void AnimationChannel::reduceKeyframes(float tolerance)
+{
+    const size_t propSize = Transform::getPropertySize(_targetAttrib);
+    const size_t keyCount = _keytimes.size();
+    if (propSize == 0 || keyCount < 3 || !isLinear() || _keyValues.size() != keyCount * propSize)
+        return;
+
+    LOG(3, "      Reducing keyframes for channel with target attribute: %u.\n", _targetAttrib);
+
+    const int rotationOffset = Transform::getRotationOffset(_targetAttrib);
+
+    // Extend each segment from the last kept key frame for as long as interpolating it
+    // reproduces all of the key frames it skips.
+    std::vector<size_t> kept;
+    kept.push_back(0);
+    size_t anchor = 0;
+    for (size_t last = 2; last < keyCount; ++last)
+    {
+        if (!isInterpolated(anchor, last, tolerance, propSize, rotationOffset))
+        {
+            anchor = last - 1;
+            kept.push_back(anchor);
+        }
+    }
+    kept.push_back(keyCount - 1);
+
+    if (kept.size() == keyCount)
+        return;
+
+    std::vector<float> keytimes;
+    std::vector<float> keyValues;
+    std::vector<unsigned int> interpolations;
+    std::vector<float> tangentsIn;
+    std::vector<float> tangentsOut;
+    for (size_t i = 0; i < kept.size(); ++i)
+    {
+        const size_t k = kept[i];
+        keytimes.push_back(_keytimes[k]);
+        keyValues.insert(keyValues.end(), _keyValues.begin() + k * propSize, _keyValues.begin() + (k + 1) * propSize);
+        if (_interpolations.size() == keyCount)
+            interpolations.push_back(_interpolations[k]);
+        if (_tangentsIn.size() == keyCount * propSize)
+            tangentsIn.insert(tangentsIn.end(), _tangentsIn.begin() + k * propSize, _tangentsIn.begin() + (k + 1) * propSize);
+        if (_tangentsOut.size() == keyCount * propSize)
+            tangentsOut.insert(tangentsOut.end(), _tangentsOut.begin() + k * propSize, _tangentsOut.begin() + (k + 1) * propSize);
+    }
+    _keytimes.swap(keytimes);
+    _keyValues.swap(keyValues);
+    if (_interpolations.size() == keyCount)
+        _interpolations.swap(interpolations);
+    if (_tangentsIn.size() == keyCount * propSize)
+        _tangentsIn.swap(tangentsIn);
+    if (_tangentsOut.size() == keyCount * propSize)
+        _tangentsOut.swap(tangentsOut);
+
+    LOG(3, "      Removed %d keyframes from channel.\n", (int)(keyCount - _keytimes.size()));
+}
+
+void AnimationChannel::setCompressed(bool compressed)
+{
+    _compressed = compressed;
+}
+
+bool AnimationChannel::isLinear() const
+{
+    for (std::vector<unsigned int>::const_iterator i = _interpolations.begin(); i != _interpolations.end(); ++i)
+    {
+        if (*i != LINEAR)
+            return false;
+    }
+    return true;
+}
+
 unsigned int AnimationChannel::getInterpolationType(const char* str)
 {
     unsigned int value = 0;
@@ -245,4 +420,49 @@ void AnimationChannel::deleteRange(size_t begin, size_t end, size_t propSize)
     // TODO: also remove key frames from _tangentsIn and _tangentsOut once other curve types are supported.
 }
 
+bool AnimationChannel::isInterpolated(size_t first, size_t last, float tolerance, size_t propSize, int rotationOffset) const
+{
+    const float* from = &_keyValues[first * propSize];
+    const float* to = &_keyValues[last * propSize];
+    const float duration = _keytimes[last] - _keytimes[first];
+
+    for (size_t k = first + 1; k < last; ++k)
+    {
+        const float s = duration > 0.0f ? (_keytimes[k] - _keytimes[first]) / duration : 0.0f;
+        const float* key = &_keyValues[k * propSize];
+        for (size_t c = 0; c < propSize; ++c)
+        {
+            if (rotationOffset >= 0 && c == (size_t)rotationOffset)
+            {
+                // Interpolate the quaternion along the shorter arc and normalize it.
+                const float* q0 = from + c;
+                const float* q1 = to + c;
+                const float* q = key + c;
+                const float dot = q0[0] * q1[0] + q0[1] * q1[1] + q0[2] * q1[2] + q0[3] * q1[3];
+                const float sign = dot < 0.0f ? -1.0f : 1.0f;
+                float r[4];
+                float length = 0.0f;
+                for (unsigned int i = 0; i < 4; ++i)
+                {
+                    r[i] = q0[i] + (q1[i] * sign - q0[i]) * s;
+                    length += r[i] * r[i];
+                }
+                length = length > 0.0f ? sqrt(length) : 1.0f;
+                const float keySign = (r[0] * q[0] + r[1] * q[1] + r[2] * q[2] + r[3] * q[3]) < 0.0f ? -1.0f : 1.0f;
+                for (unsigned int i = 0; i < 4; ++i)
+                {
+                    if (fabs(r[i] / length - q[i] * keySign) > tolerance)
+                        return false;
+                }
+                c += 3;
+            }
+            else if (fabs(from[c] + (to[c] - from[c]) * s - key[c]) > tolerance)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 }
@@ -20,6 +20,15 @@ public:
         STEP = 6
     };
 
+    /**
+     * Encodings of the key values of an animation channel in a GPB file.
+     */
+    enum Encoding
+    {
+        FLOAT_KEYFRAMES = 0,
+        QUANTIZED_KEYFRAMES = 1
+    };
+
     /**
      * Constructor.
      */
@@ -65,6 +74,33 @@ public:
      */
     void removeDuplicates();
 
+    /**
+     * Removes the key frames that linearly interpolating between the key frames around them
+     * reproduces within the given tolerance.
+     *
+     * Rotations are compared component by component after interpolating the quaternions.
+     * Only channels with linear interpolation are reduced.
+     * 
+     * @param tolerance The largest error allowed in any component of a removed key frame.
+     */
+    void reduceKeyframes(float tolerance);
+
+    /**
+     * Sets whether the key values of the channel are written quantized.
+     *
+     * Quantized channels store rotations as the smallest three components of their quaternion
+     * in 15 bits each and the other values as 16-bit fixed point within the range of each
+     * component. Only channels with linear interpolation are written quantized.
+     * 
+     * @param compressed true to write quantized key values.
+     */
+    void setCompressed(bool compressed);
+
+    /**
+     * Returns true if every key frame of the channel interpolates linearly.
+     */
+    bool isLinear() const;
+
     /**
      * Returns the interpolation type value for the given string or zero if not valid.
      * Example: "LINEAR" returns AnimationChannel::LINEAR
@@ -86,6 +122,17 @@ private:
      */
     void deleteRange(size_t begin, size_t end, size_t propSize);
 
+    /**
+     * Returns true if interpolating between the key frames first and last reproduces every
+     * key frame between them within the tolerance.
+     */
+    bool isInterpolated(size_t first, size_t last, float tolerance, size_t propSize, int rotationOffset) const;
+
+    /**
+     * Writes the key values as quantized data.
+     */
+    void writeQuantizedValues(FILE* file);
+
 private:
 
     std::string _targetId;
@@ -95,6 +142,7 @@ private:
     std::vector<float> _tangentsIn;
     std::vector<float> _tangentsOut;
     std::vector<unsigned int> _interpolations;
+    bool _compressed;
 };
 
 }
@@ -0,0 +1,207 @@
+#include "ArchiveEncoder.h"
+#include "FileIO.h"
+#include "ThreadPool.h"
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+
+// Archive identifier and version, matching FileSystem::mountArchive.
+#define ARCHIVE_IDENTIFIER "GPAK"
+#define ARCHIVE_VERSION 1
+// Size of the identifier and header, after which the file table starts.
+#define ARCHIVE_HEADER_SIZE 20
+
+using namespace gameplay;
+
+/**
+ * Appends an unsigned int to the file table.
+ */
+static void appendUint(std::vector<unsigned char>* table, unsigned int value)
+{
+    const unsigned char* bytes = (const unsigned char*)&value;
+    table->insert(table->end(), bytes, bytes + sizeof(value));
+}
+
+ArchiveEncoder::ArchiveEncoder()
+{
+}
+
+ArchiveEncoder::~ArchiveEncoder()
+{
+}
+
+bool ArchiveEncoder::write(const EncoderArguments& arguments)
+{
+    const std::string& directory = arguments.getFilePath();
+    std::string outputFilePath = arguments.getOutputFilePath();
+    bool compress = arguments.compressSectionsEnabled();
+
+    std::vector<std::string> paths;
+    listFiles(directory, "", &paths);
+    std::sort(paths.begin(), paths.end());
+
+    // Read the files.
+    std::vector<File> files;
+    files.reserve(paths.size());
+    size_t totalSize = 0;
+    size_t totalStoredSize = 0;
+    for (size_t i = 0, count = paths.size(); i < count; ++i)
+    {
+        std::string filePath = directory + "/" + paths[i];
+        if (filePath == outputFilePath)
+            continue;
+
+        FILE* input = fopen(filePath.c_str(), "rb");
+        if (!input)
+        {
+            LOG(1, "Error: Failed to open file: %s\n", filePath.c_str());
+            return false;
+        }
+        fseek(input, 0, SEEK_END);
+        long size = ftell(input);
+        fseek(input, 0, SEEK_SET);
+
+        File file;
+        file.path = paths[i];
+        file.size = (unsigned int)size;
+        file.data.resize(size);
+        if (size > 0 && fread(&file.data[0], 1, size, input) != (size_t)size)
+        {
+            LOG(1, "Error: Failed to read file: %s\n", filePath.c_str());
+            fclose(input);
+            return false;
+        }
+        fclose(input);
+        files.push_back(file);
+    }
+
+    // Compress the files in parallel, keeping the ones that get smaller.
+    if (compress)
+    {
+        parallelFor((unsigned int)files.size(), [&files](unsigned int i)
+        {
+            std::vector<unsigned char> compressed;
+            if (compressLZ4(files[i].data.empty() ? NULL : &files[i].data[0], files[i].data.size(), &compressed))
+                files[i].data.swap(compressed);
+        });
+    }
+    for (size_t i = 0, count = files.size(); i < count; ++i)
+    {
+        totalSize += files[i].size;
+        totalStoredSize += files[i].data.size();
+    }
+
+    // The offsets of the files are in the table that precedes them, so the space reserved
+    // for a compressed table grows until the table compressed with its offsets fits in it.
+    std::vector<unsigned char> table;
+    std::vector<unsigned char> storedTable;
+    size_t reservedSize = 0;
+    for (;;)
+    {
+        table.clear();
+        unsigned int offset = (unsigned int)(ARCHIVE_HEADER_SIZE + reservedSize);
+        for (size_t i = 0, count = files.size(); i < count; ++i)
+        {
+            const File& file = files[i];
+            appendUint(&table, (unsigned int)file.path.length());
+            table.insert(table.end(), file.path.begin(), file.path.end());
+            appendUint(&table, offset);
+            appendUint(&table, file.size);
+            appendUint(&table, (unsigned int)file.data.size());
+            offset += (unsigned int)file.data.size();
+        }
+
+        storedTable.clear();
+        if (!compress || !compressLZ4(table.empty() ? NULL : &table[0], table.size(), &storedTable))
+            storedTable = table;
+        if (storedTable.size() <= reservedSize)
+            break;
+        reservedSize = storedTable.size();
+    }
+
+    FILE* output = fopen(outputFilePath.c_str(), "wb");
+    if (!output)
+    {
+        LOG(1, "Error: Failed to open file: %s\n", outputFilePath.c_str());
+        return false;
+    }
+
+    // Identifier and header.
+    fwrite(ARCHIVE_IDENTIFIER, 1, 4, output);
+    gameplay::write((unsigned int)ARCHIVE_VERSION, output);
+    gameplay::write((unsigned int)files.size(), output);
+    gameplay::write((unsigned int)table.size(), output);
+    gameplay::write((unsigned int)storedTable.size(), output);
+
+    // File table, padded to the space reserved for it.
+    if (!storedTable.empty())
+        fwrite(&storedTable[0], 1, storedTable.size(), output);
+    for (size_t i = storedTable.size(); i < reservedSize; ++i)
+        fputc(0, output);
+
+    // File data.
+    for (size_t i = 0, count = files.size(); i < count; ++i)
+    {
+        if (!files[i].data.empty())
+            fwrite(&files[i].data[0], 1, files[i].data.size(), output);
+    }
+
+    bool written = ferror(output) == 0;
+    fclose(output);
+    if (!written)
+    {
+        LOG(1, "Error: Failed to write file: %s\n", outputFilePath.c_str());
+        return false;
+    }
+
+    LOG(1, "Packed %u files (%u bytes) into %s (%u bytes).\n", (unsigned int)files.size(), (unsigned int)totalSize,
+        outputFilePath.c_str(), (unsigned int)(ARCHIVE_HEADER_SIZE + reservedSize + totalStoredSize));
+    return true;
+}
+
+void ArchiveEncoder::listFiles(const std::string& directory, const std::string& relativePath, std::vector<std::string>* paths)
+{
+    std::string path = relativePath.empty() ? directory : directory + "/" + relativePath;
+#ifdef WIN32
+    WIN32_FIND_DATAA data;
+    HANDLE handle = FindFirstFileA((path + "/*").c_str(), &data);
+    if (handle == INVALID_HANDLE_VALUE)
+        return;
+    do
+    {
+        std::string name = data.cFileName;
+        if (name == "." || name == "..")
+            continue;
+        std::string entryPath = relativePath.empty() ? name : relativePath + "/" + name;
+        if ((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+            listFiles(directory, entryPath, paths);
+        else
+            paths->push_back(entryPath);
+    }
+    while (FindNextFileA(handle, &data));
+    FindClose(handle);
+#else
+    DIR* dir = opendir(path.c_str());
+    if (!dir)
+        return;
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        std::string name = entry->d_name;
+        if (name == "." || name == "..")
+            continue;
+        std::string entryPath = relativePath.empty() ? name : relativePath + "/" + name;
+        struct stat status;
+        if (stat((directory + "/" + entryPath).c_str(), &status) != 0)
+            continue;
+        if ((status.st_mode & S_IFDIR) != 0)
+            listFiles(directory, entryPath, paths);
+        else
+            paths->push_back(entryPath);
+    }
+    closedir(dir);
+#endif
+}
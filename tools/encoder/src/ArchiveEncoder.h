@@ -0,0 +1,59 @@
+#ifndef ARCHIVEENCODER_H_
+#define ARCHIVEENCODER_H_
+
+#include "Base.h"
+#include "EncoderArguments.h"
+
+/**
+ * Class for packing the files of a directory into a resource archive.
+ *
+ * The engine mounts the archive with FileSystem::mountArchive() and reads the files
+ * in it by their paths relative to the directory, which replaces opening many small
+ * files with one mapping. Files are stored raw, or with -cs LZ4 compressed wherever
+ * that makes them smaller.
+ *
+ * The archive starts with the identifier "GPAK" and four unsigned ints: the version,
+ * the number of files, and the size and stored size of the file table that follows.
+ * The table is LZ4 compressed when its stored size is smaller than its size, and holds
+ * for each file the length of its path, its path, and the offset in the archive, size
+ * and stored size of its data.
+ */
+class ArchiveEncoder
+{
+public:
+
+    /**
+     * Constructor.
+     */
+    ArchiveEncoder();
+
+    /**
+     * Destructor.
+     */
+    ~ArchiveEncoder();
+
+    /**
+     * Packs the files of the input directory and writes out the archive.
+     *
+     * @param arguments The encoder arguments.
+     *
+     * @return True if the archive was written, false otherwise.
+     */
+    bool write(const gameplay::EncoderArguments& arguments);
+
+private:
+
+    struct File
+    {
+        std::string path;
+        unsigned int size;
+        std::vector<unsigned char> data;
+    };
+
+    /**
+     * Lists the files of a directory and its subdirectories, as paths relative to the input directory.
+     */
+    static void listFiles(const std::string& directory, const std::string& relativePath, std::vector<std::string>* paths);
+};
+
+#endif
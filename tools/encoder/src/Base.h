@@ -92,6 +92,17 @@ enum VertexUsage
     TEXCOORD7 = 15
 };
 
+enum VertexType
+{
+    VERTEX_FLOAT = 0x1406,                  // GL_FLOAT
+    VERTEX_HALF_FLOAT = 0x140B,             // GL_HALF_FLOAT
+    VERTEX_BYTE = 0x1400,                   // GL_BYTE
+    VERTEX_UNSIGNED_BYTE = 0x1401,          // GL_UNSIGNED_BYTE
+    VERTEX_SHORT = 0x1402,                  // GL_SHORT
+    VERTEX_UNSIGNED_SHORT = 0x1403,         // GL_UNSIGNED_SHORT
+    VERTEX_INT_2_10_10_10_REV = 0x8D9F      // GL_INT_2_10_10_10_REV
+};
+
 void fillArray(float values[], float value, size_t length);
 
 /**
@@ -0,0 +1,320 @@
+#include "BuildCache.h"
+#include <mutex>
+
+#ifdef WIN32
+#include <direct.h>
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+// Identifier and version of the manifests, which is part of every key.
+#define BUILDCACHE_MANIFEST_IDENTIFIER "GPCACHE"
+#define BUILDCACHE_MANIFEST_VERSION 1
+
+// The hash recorded for a dependency that did not exist, so that creating it invalidates the entry.
+#define BUILDCACHE_MISSING_HASH "missing"
+
+using namespace gameplay;
+
+static std::mutex __mutex;
+static std::vector<std::string> __dependencies;
+static std::vector<std::string> __outputs;
+
+/**
+ * Hashes bytes with 64-bit FNV-1a, continuing from a previous hash.
+ */
+static unsigned long long hashBytes(const void* data, size_t size, unsigned long long hash = 14695981039346656037ULL)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static std::string toHex(unsigned long long hash)
+{
+    char buffer[17];
+    sprintf(buffer, "%016llx", hash);
+    return buffer;
+}
+
+/**
+ * Hashes the contents of a file.
+ *
+ * @return True if the file was read, false if it could not be opened.
+ */
+static bool hashFile(const std::string& path, std::string* hash)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+    unsigned long long value = hashBytes(NULL, 0);
+    char buffer[65536];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        value = hashBytes(buffer, size, value);
+    bool read = ferror(file) == 0;
+    fclose(file);
+    *hash = toHex(value);
+    return read;
+}
+
+/**
+ * Moves a file over another, which rename() does not do on every platform.
+ */
+static bool replaceFile(const std::string& source, const std::string& destination)
+{
+    remove(destination.c_str());
+    return rename(source.c_str(), destination.c_str()) == 0;
+}
+
+/**
+ * Copies a file through a temporary file next to the destination, so that the destination is never seen partially written.
+ */
+static bool copyFile(const std::string& source, const std::string& destination)
+{
+    FILE* input = fopen(source.c_str(), "rb");
+    if (!input)
+        return false;
+    std::ostringstream temporaryPath;
+    temporaryPath << destination << "." << getpid() << ".tmp";
+    FILE* output = fopen(temporaryPath.str().c_str(), "wb");
+    if (!output)
+    {
+        fclose(input);
+        return false;
+    }
+    bool copied = true;
+    char buffer[65536];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), input)) > 0 && copied)
+        copied = fwrite(buffer, 1, size, output) == size;
+    copied = copied && ferror(input) == 0;
+    fclose(input);
+    copied = fclose(output) == 0 && copied;
+    if (!copied || !replaceFile(temporaryPath.str(), destination))
+    {
+        remove(temporaryPath.str().c_str());
+        return false;
+    }
+    return true;
+}
+
+static void makeDirectory(const std::string& path)
+{
+#ifdef WIN32
+    _mkdir(path.c_str());
+#else
+    mkdir(path.c_str(), 0777);
+#endif
+}
+
+BuildCache::BuildCache(const char* directory, const EncoderArguments& arguments)
+    : _directory(directory), _outputFilePath(arguments.getOutputFilePath()), _startTime(time(NULL))
+{
+    while (_directory.length() > 1 && (_directory[_directory.length() - 1] == '/' || _directory[_directory.length() - 1] == '\\'))
+        _directory.erase(_directory.length() - 1);
+    makeDirectory(_directory);
+    makeDirectory(_directory + "/objects");
+
+    // The verbosity and the cache itself do not change the outputs, the other options do.
+    std::string inputHash;
+    if (!hashFile(arguments.getFilePath(), &inputHash))
+        return;
+    char version[16];
+    sprintf(version, "%d", BUILDCACHE_MANIFEST_VERSION);
+    std::vector<std::string> values;
+    values.push_back(BUILDCACHE_MANIFEST_IDENTIFIER);
+    values.push_back(version);
+    values.push_back(EncoderArguments::getVersion());
+    values.push_back(arguments.getFilePath());
+    values.push_back(_outputFilePath);
+    const std::vector<std::string>& options = arguments.getOptions();
+    for (size_t i = 0, count = options.size(); i < count; ++i)
+    {
+        if ((options[i] == "-cache" || options[i] == "-v") && i + 1 < count)
+        {
+            ++i;
+            continue;
+        }
+        values.push_back(options[i]);
+    }
+    values.push_back(inputHash);
+
+    unsigned long long key = hashBytes(NULL, 0);
+    for (size_t i = 0, count = values.size(); i < count; ++i)
+        key = hashBytes(values[i].c_str(), values[i].length() + 1, key);
+    _key = toHex(key);
+}
+
+BuildCache::~BuildCache()
+{
+}
+
+bool BuildCache::isCacheable(const EncoderArguments& arguments)
+{
+    switch (arguments.getFileFormat())
+    {
+    case EncoderArguments::FILEFORMAT_DIRECTORY:
+    case EncoderArguments::FILEFORMAT_UNKNOWN:
+        return false;
+    case EncoderArguments::FILEFORMAT_TTF:
+    case EncoderArguments::FILEFORMAT_OTF:
+        return arguments.getFontFormat() != Font::BITMAP || arguments.getFontSizes().size() > 0;
+    default:
+        return true;
+    }
+}
+
+bool BuildCache::restore()
+{
+    if (_key.empty())
+        return false;
+
+    std::ifstream manifest(getManifestPath().c_str());
+    std::string identifier;
+    int version = 0;
+    if (!(manifest >> identifier >> version) || identifier != BUILDCACHE_MANIFEST_IDENTIFIER || version != BUILDCACHE_MANIFEST_VERSION)
+        return false;
+
+    // Each line is the kind of the file and the hash of its contents, followed by its path.
+    std::vector<Entry> dependencies;
+    std::vector<Entry> outputs;
+    std::string kind;
+    while (manifest >> kind)
+    {
+        Entry entry;
+        manifest >> entry.hash;
+        manifest.get();
+        std::getline(manifest, entry.path);
+        if (kind == "dependency")
+            dependencies.push_back(entry);
+        else if (kind == "output")
+            outputs.push_back(entry);
+    }
+    if (outputs.empty())
+        return false;
+
+    for (size_t i = 0, count = dependencies.size(); i < count; ++i)
+    {
+        std::string hash;
+        if (!hashFile(dependencies[i].path, &hash))
+            hash = BUILDCACHE_MISSING_HASH;
+        if (hash != dependencies[i].hash)
+        {
+            LOG(2, "Dependency changed: %s\n", dependencies[i].path.c_str());
+            return false;
+        }
+    }
+
+    unsigned int copyCount = 0;
+    for (size_t i = 0, count = outputs.size(); i < count; ++i)
+    {
+        std::string hash;
+        if (hashFile(outputs[i].path, &hash) && hash == outputs[i].hash)
+            continue;
+        if (!copyFile(getObjectPath(outputs[i].hash), outputs[i].path))
+            return false;
+        ++copyCount;
+    }
+
+    if (copyCount > 0)
+    {
+        LOG(1, "Restored %u file(s) from the cache for: %s\n", copyCount, _outputFilePath.c_str());
+    }
+    else
+    {
+        LOG(1, "Up to date: %s\n", _outputFilePath.c_str());
+    }
+    return true;
+}
+
+void BuildCache::store()
+{
+    if (_key.empty())
+        return;
+
+    std::vector<std::string> dependencies;
+    std::vector<std::string> outputs;
+    {
+        std::lock_guard<std::mutex> lock(__mutex);
+        dependencies = __dependencies;
+        outputs = __outputs;
+    }
+    outputs.insert(outputs.begin(), _outputFilePath);
+
+    std::ostringstream manifest;
+    manifest << BUILDCACHE_MANIFEST_IDENTIFIER << " " << BUILDCACHE_MANIFEST_VERSION << "\n";
+    for (size_t i = 0, count = dependencies.size(); i < count; ++i)
+    {
+        std::string hash;
+        if (!hashFile(dependencies[i], &hash))
+            hash = BUILDCACHE_MISSING_HASH;
+        manifest << "dependency " << hash << " " << dependencies[i] << "\n";
+    }
+
+    // The output file is left out if this encoding did not write it, such as the binary file when -t writes text instead.
+    unsigned int outputCount = 0;
+    for (size_t i = 0, count = outputs.size(); i < count; ++i)
+    {
+        struct stat status;
+        if (std::find(outputs.begin(), outputs.begin() + i, outputs[i]) != outputs.begin() + i ||
+            stat(outputs[i].c_str(), &status) != 0 || (i == 0 && status.st_mtime < _startTime))
+            continue;
+        std::string hash;
+        if (!hashFile(outputs[i], &hash))
+            continue;
+        std::string objectPath = getObjectPath(hash);
+        if (stat(objectPath.c_str(), &status) != 0 && !copyFile(outputs[i], objectPath))
+        {
+            LOG(1, "Warning: Failed to store file in the cache: %s\n", outputs[i].c_str());
+            return;
+        }
+        manifest << "output " << hash << " " << outputs[i] << "\n";
+        ++outputCount;
+    }
+    if (outputCount == 0)
+        return;
+
+    std::ostringstream temporaryPath;
+    temporaryPath << getManifestPath() << "." << getpid() << ".tmp";
+    std::string contents = manifest.str();
+    FILE* file = fopen(temporaryPath.str().c_str(), "wb");
+    bool written = file && fwrite(contents.c_str(), 1, contents.length(), file) == contents.length();
+    if (file)
+        written = fclose(file) == 0 && written;
+    if (!written || !replaceFile(temporaryPath.str(), getManifestPath()))
+    {
+        remove(temporaryPath.str().c_str());
+        LOG(1, "Warning: Failed to write cache manifest: %s\n", getManifestPath().c_str());
+    }
+}
+
+void BuildCache::addDependency(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(__mutex);
+    if (std::find(__dependencies.begin(), __dependencies.end(), path) == __dependencies.end())
+        __dependencies.push_back(path);
+}
+
+void BuildCache::addOutput(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(__mutex);
+    if (std::find(__outputs.begin(), __outputs.end(), path) == __outputs.end())
+        __outputs.push_back(path);
+}
+
+std::string BuildCache::getManifestPath() const
+{
+    return _directory + "/" + _key + ".manifest";
+}
+
+std::string BuildCache::getObjectPath(const std::string& hash) const
+{
+    return _directory + "/objects/" + hash;
+}
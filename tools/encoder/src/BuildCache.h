@@ -0,0 +1,100 @@
+#ifndef BUILDCACHE_H_
+#define BUILDCACHE_H_
+
+#include "Base.h"
+#include "EncoderArguments.h"
+
+/**
+ * Class for skipping the encoding of files whose outputs are already known.
+ *
+ * Each encoding is keyed on the encoder version, the input and output paths, the options
+ * that change the output and the contents of the input file. The manifest of a key lists
+ * the files that the encoders read besides the input, such as tile sets and their images,
+ * and the files that they wrote, each with a hash of its contents. While the contents of
+ * the dependencies are unchanged, the outputs are left alone if they are up to date, or
+ * are copied from the cache, where outputs are stored by the hash of their contents.
+ *
+ * The cache directory holds a '<key>.manifest' file for each encoding and an 'objects'
+ * directory of the outputs. Encodings of the same file by processes running at once
+ * each write their files under a temporary name and rename them into place.
+ */
+class BuildCache
+{
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param directory The directory of the cache, which is created if it does not exist.
+     * @param arguments The encoder arguments of the file.
+     */
+    BuildCache(const char* directory, const gameplay::EncoderArguments& arguments);
+
+    /**
+     * Destructor.
+     */
+    ~BuildCache();
+
+    /**
+     * Returns true if the outputs of the file only depend on its arguments and the files it reads.
+     *
+     * Directories are not cached, since the files in them are only known by listing them, and
+     * neither are bitmap fonts without sizes, whose sizes are prompted for.
+     */
+    static bool isCacheable(const gameplay::EncoderArguments& arguments);
+
+    /**
+     * Brings the outputs of the file up to date from the cache.
+     *
+     * @return True if the outputs are up to date, false if the file must be encoded.
+     */
+    bool restore();
+
+    /**
+     * Stores the outputs of the file, once it has been encoded, along with its dependencies.
+     */
+    void store();
+
+    /**
+     * Records that a file other than the input was read while encoding.
+     *
+     * @param path The path of the file.
+     */
+    static void addDependency(const std::string& path);
+
+    /**
+     * Records that a file other than the output was written while encoding.
+     *
+     * @param path The path of the file.
+     */
+    static void addOutput(const std::string& path);
+
+private:
+
+    struct Entry
+    {
+        std::string path;
+        std::string hash;
+    };
+
+    /**
+     * Hidden copy constructor.
+     */
+    BuildCache(const BuildCache&);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    BuildCache& operator=(const BuildCache&);
+
+    std::string getManifestPath() const;
+
+    std::string getObjectPath(const std::string& hash) const;
+
+    std::string _directory;
+    std::string _key;
+    std::string _outputFilePath;
+    time_t _startTime;
+};
+
+#endif
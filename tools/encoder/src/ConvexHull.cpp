@@ -0,0 +1,128 @@
+#include "Base.h"
+#include "ConvexHull.h"
+
+namespace gameplay
+{
+
+// Number of directions the hull vertices are sampled along, as done by Bullet's btShapeHull.
+#define HULL_DIRECTION_COUNT 42
+
+// Fills the given array with the 42 vertices of an icosahedron subdivided once, on the unit sphere.
+static void getHullDirections(Vector3* directions)
+{
+    // The 12 vertices of the icosahedron are the cyclic permutations of (0, +-1, +-phi).
+    const float phi = 1.6180339887f;
+    Vector3 vertices[12];
+    unsigned int count = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        float a = (i & 1) ? -1.0f : 1.0f;
+        float b = (i & 2) ? -phi : phi;
+        vertices[count++].set(0.0f, a, b);
+        vertices[count++].set(a, b, 0.0f);
+        vertices[count++].set(b, 0.0f, a);
+    }
+
+    unsigned int index = 0;
+    for (unsigned int i = 0; i < 12; ++i)
+    {
+        directions[index] = vertices[i];
+        directions[index++].normalize();
+    }
+
+    // The 30 edges join the vertices that are 2 apart, and their midpoints complete the sphere.
+    for (unsigned int i = 0; i < 12; ++i)
+    {
+        for (unsigned int j = i + 1; j < 12; ++j)
+        {
+            if (fabs(vertices[i].distanceSquared(vertices[j]) - 4.0f) < 0.001f)
+            {
+                directions[index] = vertices[i] + vertices[j];
+                directions[index++].normalize();
+            }
+        }
+    }
+    assert(index == HULL_DIRECTION_COUNT);
+}
+
+ConvexHull::ConvexHull(void)
+{
+}
+
+ConvexHull::~ConvexHull(void)
+{
+}
+
+unsigned int ConvexHull::getTypeId(void) const
+{
+    return CONVEXHULL_ID;
+}
+
+const char* ConvexHull::getElementName(void) const
+{
+    return "ConvexHull";
+}
+
+void ConvexHull::writeBinary(FILE* file)
+{
+    Object::writeBinary(file);
+    write((unsigned int)_vertices.size(), file);
+    for (std::vector<Vector3>::const_iterator i = _vertices.begin(); i != _vertices.end(); ++i)
+    {
+        write(&i->x, 3, file);
+    }
+}
+
+void ConvexHull::writeText(FILE* file)
+{
+    fprintElementStart(file);
+    fprintf(file, "<vertices count=\"%lu\">\n", _vertices.size());
+    for (std::vector<Vector3>::const_iterator i = _vertices.begin(); i != _vertices.end(); ++i)
+    {
+        writeVectorText(*i, file);
+    }
+    fprintf(file, "</vertices>\n");
+    fprintElementEnd(file);
+}
+
+bool ConvexHull::build(const Mesh* mesh)
+{
+    assert(mesh);
+    _vertices.clear();
+    if (mesh->vertices.empty())
+        return false;
+
+    Vector3 directions[HULL_DIRECTION_COUNT];
+    getHullDirections(directions);
+
+    // Keep the vertex farthest along each direction, once.
+    std::vector<size_t> hull;
+    for (unsigned int i = 0; i < HULL_DIRECTION_COUNT; ++i)
+    {
+        size_t best = 0;
+        float bestDistance = -FLT_MAX;
+        for (size_t j = 0, count = mesh->vertices.size(); j < count; ++j)
+        {
+            float distance = directions[i].dot(mesh->vertices[j].position);
+            if (distance > bestDistance)
+            {
+                bestDistance = distance;
+                best = j;
+            }
+        }
+
+        if (std::find(hull.begin(), hull.end(), best) == hull.end())
+        {
+            hull.push_back(best);
+            _vertices.push_back(mesh->vertices[best].position);
+        }
+    }
+    return true;
+}
+
+unsigned int ConvexHull::getVertexCount() const
+{
+    return (unsigned int)_vertices.size();
+}
+
+}
@@ -0,0 +1,60 @@
+#ifndef CONVEXHULL_H_
+#define CONVEXHULL_H_
+
+#include "Object.h"
+#include "Mesh.h"
+
+namespace gameplay
+{
+
+/**
+ * A convex hull cooked from the vertices of a mesh, for dynamic mesh collision shapes.
+ *
+ * The hull is written with the id of its mesh followed by "_hull" and is loaded by the
+ * runtime in place of building the hull of the mesh when the physics shape is created.
+ */
+class ConvexHull : public Object
+{
+public:
+
+    /**
+     * Constructor.
+     */
+    ConvexHull(void);
+
+    /**
+     * Destructor.
+     */
+    virtual ~ConvexHull(void);
+
+    virtual unsigned int getTypeId(void) const;
+    virtual const char* getElementName(void) const;
+    virtual void writeBinary(FILE* file);
+    virtual void writeText(FILE* file);
+
+    /**
+     * Builds the hull of the given mesh.
+     *
+     * Like the runtime, the hull is reduced to the vertices of the mesh that are farthest
+     * along 42 directions spread evenly over the sphere, so that hulls of dense meshes stay
+     * small.
+     *
+     * @param mesh The mesh to build the hull of.
+     *
+     * @return True if the hull was built, false if the mesh has no vertices.
+     */
+    bool build(const Mesh* mesh);
+
+    /**
+     * Returns the number of vertices in the hull.
+     */
+    unsigned int getVertexCount() const;
+
+private:
+
+    std::vector<Vector3> _vertices;
+};
+
+}
+
+#endif
@@ -22,14 +22,29 @@ extern int __logVerbosity = 1;
 
 EncoderArguments::EncoderArguments(size_t argc, const char** argv) :
     _normalMap(false),
+    _textureFormat(TEXTUREFORMAT_RGBA),
+    _textureSRGB(false),
+    _textureMipmaps(true),
     _parseError(false),
     _fontPreview(false),
     _fontFormat(Font::BITMAP),
+    _fontFastDistanceField(false),
     _textOutput(false),
     _optimizeAnimations(false),
+    _compressAnimations(false),
+    _optimizeMeshes(true),
+    _packVertices(true),
+    _lodCount(0),
+    _lodRatio(0.5f),
+    _lodError(0.0f),
+    _animationTolerance(0.0f),
+    _compressSections(false),
     _animationGrouping(ANIMATIONGROUP_PROMPT),
     _outputMaterial(false),
-    _generateTextureGutter(false)
+    _generateTextureGutter(false),
+    _tileChunkSize(0),
+    _workerCount(0),
+    _multipleInputs(false)
 {
     __instance = this;
 
@@ -48,11 +63,21 @@ EncoderArguments::EncoderArguments(size_t argc, const char** argv) :
         {
             if (arguments[i][0] == '-')
             {
+                // Keep the options, except for the worker count, to pass on when encoding each of many inputs.
+                size_t start = i;
                 readOption(arguments, &i);
                 index = i + 1;
+                if (arguments[start].compare("-j") != 0)
+                    _options.insert(_options.end(), arguments.begin() + start, arguments.begin() + std::min(index, arguments.size()));
             }
         }
-        if (arguments.size() - index == 2)
+        if (_multipleInputs && arguments.size() > index)
+        {
+            // Every file after the options is an input, each written to its default output path.
+            _inputFilePaths.assign(arguments.begin() + index, arguments.end());
+            setInputfilePath(_inputFilePaths[0]);
+        }
+        else if (arguments.size() - index == 2)
         {
             setInputfilePath(arguments[index]);
             setOutputfilePath(arguments[index + 1]);
@@ -82,6 +107,21 @@ const std::string& EncoderArguments::getFilePath() const
     return _filePath;
 }
 
+const std::vector<std::string>& EncoderArguments::getInputFilePaths() const
+{
+    return _inputFilePaths;
+}
+
+const std::vector<std::string>& EncoderArguments::getOptions() const
+{
+    return _options;
+}
+
+unsigned int EncoderArguments::getWorkerCount() const
+{
+    return _workerCount;
+}
+
 const std::string EncoderArguments::getFileDirPath() const
 {
     int pos = _filePath.find_last_of('/');
@@ -119,7 +159,19 @@ std::string EncoderArguments::getOutputFileExtension() const
     {
     case FILEFORMAT_TMX:
         return ".scene";
+    case FILEFORMAT_LUA:
+        return ".luac";
+    case FILEFORMAT_DIRECTORY:
+        return ".pak";
+    case FILEFORMAT_PROPERTIES:
+        {
+            // The binary encoding is written next to the file, with a 'b' appended to its extension
+            size_t pos = _filePath.find_last_of('.');
+            return _filePath.substr(pos) + "b";
+        }
     case FILEFORMAT_PNG:
+        // Images that are not heightmaps are encoded as textures
+        return _normalMap ? ".png" : ".ktx";
     case FILEFORMAT_RAW:
         if (_normalMap)
             return ".png";
@@ -139,6 +191,11 @@ std::string EncoderArguments::getOutputFilePath() const
     else
     {
         // Generate an output file path
+        if (getFileFormat() == FILEFORMAT_DIRECTORY)
+        {
+            // The archive of a directory is written next to it
+            return _filePath + getOutputFileExtension();
+        }
         int pos = _filePath.find_last_of('.');
         std::string outputFilePath(pos > 0 ? _filePath.substr(0, pos) : _filePath);
 
@@ -200,6 +257,11 @@ bool EncoderArguments::isGenerateTangentBinormalId(const std::string& id) const
     return _tangentBinormalId.find(id) != _tangentBinormalId.end();
 }
 
+bool EncoderArguments::isGenerateConvexHullId(const std::string& id) const
+{
+    return _convexHullId.find(id) != _convexHullId.end();
+}
+
 bool EncoderArguments::normalMapGeneration() const
 {
     return _normalMap;
@@ -259,6 +321,14 @@ void EncoderArguments::printUsage() const
     "\n" \
     "General options:\n" \
     "  -v <verbosity>\tVerbosity level (0-4).\n" \
+    "  -j <count>\tEncodes with the given number of worker threads, or one per core if 0.\n" \
+        "\t\tEvery file given after the options is then an input, and the inputs are\n" \
+        "\t\tencoded in parallel, each to its default output path.\n" \
+    "  -cache <directory>\n" \
+        "\t\tKeeps the outputs of each encoding in the directory. A file whose\n" \
+        "\t\tcontents, options, encoder version and the files it reads, such as\n" \
+        "\t\ttile set images, are unchanged is skipped if its outputs are up to\n" \
+        "\t\tdate, or its outputs are copied from the cache.\n" \
     "\n" \
     "FBX file options:\n" \
     "  -i <id>\tFilter by node ID.\n" \
@@ -276,6 +346,39 @@ void EncoderArguments::printUsage() const
         "\t\tremoving any channels that contain default/identity values\n" \
         "\t\tand removing any duplicate contiguous keyframes, which are \n" \
         "\t\tcommon when exporting baked animation data.\n" \
+    "  -om:none\n" \
+        "\t\tDoes not optimize meshes. By default the triangles of each mesh part\n" \
+        "\t\tare reordered for the GPU vertex cache and to reduce overdraw, and\n" \
+        "\t\tthe vertices are reordered by first use for vertex fetch.\n" \
+    "  -pv:none\n" \
+        "\t\tWrites vertices as floats. By default normals, tangents, texture\n" \
+        "\t\tcoordinates, colors and blend weights and indices are packed into\n" \
+        "\t\tnormalized integers or half floats where their values allow.\n" \
+    "  -lod <count>\n" \
+        "\t\tGenerates the given number of levels of detail for each model\n" \
+        "\t\tthat has none, by simplifying its mesh. Each level is used at\n" \
+        "\t\ta smaller screen size than the previous one.\n" \
+    "  -lodRatio <ratio>\n" \
+        "\t\tThe ratio of the triangles of each generated level of detail\n" \
+        "\t\tto the triangles of the previous level. The default is 0.5.\n" \
+    "  -lodError <error>\n" \
+        "\t\tThe largest error that simplifying a generated level of\n" \
+        "\t\tdetail may introduce, as a fraction of the radius of the\n" \
+        "\t\tmesh. Levels stop early when the limit is reached. The\n" \
+        "\t\tdefault of 0 has no limit.\n" \
+    "  -ca <tolerance>\n" \
+        "\t\tCompresses linear animation channels by removing the keyframes\n" \
+        "\t\tthat interpolating their neighbours reproduces within the\n" \
+        "\t\ttolerance, and by storing rotations as smallest-three quantized\n" \
+        "\t\tquaternions and other values as 16-bit fixed point.\n" \
+    "  -cs\n" \
+        "\t\tCompresses the mesh and animation data of the bundle, or the\n" \
+        "\t\tfiles of an archive, with LZ4, which makes it smaller to read\n" \
+        "\t\tfrom storage at the cost of decompressing it when it is loaded.\n" \
+    "  -ch <node id>\n" \
+        "\t\tCooks the convex hull of the mesh of the given node into the\n" \
+        "\t\tbundle, which is used for dynamic mesh collision shapes instead\n" \
+        "\t\tof building the hull at runtime.\n" \
     "  -h <size> \"<node ids>\" <filename>\n" \
         "\t\tGenerates a single heightmap image using meshes from the \n" \
         "\t\tspecified nodes. \n" \
@@ -289,7 +392,11 @@ void EncoderArguments::printUsage() const
     "TMX file options:\n" \
     "  -tg\tEnable texture gutter's around tiles. This will modify any referenced\n" \
     "  \ttile sets to add a 1px border around it to prevent seams.\n"
-    "  -tg:none\tDo not priduce a texture gutter.\n"
+    "  -tg:none\tDo not priduce a texture gutter.\n" \
+    "  -tc <tiles>\tBake the tile layers into static meshes of chunks of\n" \
+    "  \t\t<tiles> x <tiles> tiles, written to a .gpb file and a .material\n" \
+    "  \t\tfile next to the scene, instead of tile sets that are drawn\n" \
+    "  \t\ttile by tile. The chunks are culled and drawn with one call each.\n"
     "\n" \
     "Normal map options:\n" \
         "  -n\t\tGenerate normal map (requires input file of type PNG or RAW)\n" \
@@ -306,10 +413,41 @@ void EncoderArguments::printUsage() const
         "  \t\t(8 or 16-bit), which is a common headerless format supported by most \n" \
         "  \t\tterrain generation tools.\n" \
     "\n" \
+    "Texture options:\n" \
+        "  -tf <format>\tFormat of the texture. rgba (default), bc1, bc3, etc2 or\n" \
+        "\t\tetc2a. BC1 and BC3 (S3TC/DXT) are for desktop GPUs, ETC2 for\n" \
+        "\t\tOpenGL ES 3.0 GPUs. bc1 and etc2 drop the alpha channel.\n" \
+        "  -tsrgb\tThe colors of the texture are in sRGB. Mipmaps are filtered\n" \
+        "\t\tin linear space and the texture is written in an sRGB format.\n" \
+        "  -tm:none\tDoes not generate mipmaps.\n" \
+        "\n" \
+        "  \t\tPNG images, other than heightmaps given with -n, are encoded into\n" \
+        "  \t\tKTX textures (.ktx) with their full mipmap chain, which the engine\n" \
+        "  \t\tloads without decoding or generating mipmaps at runtime.\n" \
+    "\n" \
+    "LUA file options:\n" \
+        "  \t\tLua scripts are compiled into precompiled bytecode (.luac), which\n" \
+        "  \t\tthe engine loads instead of the script next to it. Compile them\n" \
+        "  \t\twith an encoder built for the target's architecture.\n" \
+    "\n" \
+    "Properties file options:\n" \
+        "  \t\tProperties files (.material, .scene, .physics, .particle,\n" \
+        "  \t\t.animation, .audio, .form, .theme, .terrain and .config) are\n" \
+        "  \t\tencoded into a binary file next to them, with a 'b' appended to\n" \
+        "  \t\ttheir extension, which the engine reads in place of the text.\n" \
+    "\n" \
+    "Directory options:\n" \
+        "  -cs\t\tCompresses the files of the archive with LZ4.\n" \
+        "  \t\tDirectories are packed into a resource archive (.pak) that the\n" \
+        "  \t\tengine mounts with FileSystem::mountArchive() or the 'archives'\n" \
+        "  \t\tsection of game.config.\n" \
+    "\n" \
     "TTF file options:\n" \
     "  -s <sizes>\tComma-separated list of font sizes (in pixels).\n" \
     "  -p\t\tOutput font preview.\n" \
     "  -f\t\tFormat of font. -f:b (BITMAP), -f:d (DISTANCE_FIELD).\n" \
+    "  \t\t-f:df makes a DISTANCE_FIELD with a faster, exact Euclidean\n" \
+    "  \t\tdistance transform in place of the antialiased edtaa3 one.\n" \
     "\n");
     exit(8);
 }
@@ -324,6 +462,11 @@ Font::FontFormat EncoderArguments::getFontFormat() const
     return _fontFormat;
 }
 
+bool EncoderArguments::fontFastDistanceFieldEnabled() const
+{
+    return _fontFastDistanceField;
+}
+
 bool EncoderArguments::textOutputEnabled() const
 {
     return _textOutput;
@@ -334,6 +477,61 @@ bool EncoderArguments::optimizeAnimationsEnabled() const
     return _optimizeAnimations;
 }
 
+bool EncoderArguments::compressAnimationsEnabled() const
+{
+    return _compressAnimations;
+}
+
+EncoderArguments::TextureFormat EncoderArguments::getTextureFormat() const
+{
+    return _textureFormat;
+}
+
+bool EncoderArguments::textureSRGBEnabled() const
+{
+    return _textureSRGB;
+}
+
+bool EncoderArguments::textureMipmapsEnabled() const
+{
+    return _textureMipmaps;
+}
+
+bool EncoderArguments::optimizeMeshesEnabled() const
+{
+    return _optimizeMeshes;
+}
+
+bool EncoderArguments::packVerticesEnabled() const
+{
+    return _packVertices;
+}
+
+unsigned int EncoderArguments::getLodCount() const
+{
+    return _lodCount;
+}
+
+float EncoderArguments::getLodRatio() const
+{
+    return _lodRatio;
+}
+
+float EncoderArguments::getLodError() const
+{
+    return _lodError;
+}
+
+bool EncoderArguments::compressSectionsEnabled() const
+{
+    return _compressSections;
+}
+
+float EncoderArguments::getAnimationTolerance() const
+{
+    return _animationTolerance;
+}
+
 bool EncoderArguments::outputMaterialEnabled() const
 {
     return _outputMaterial;
@@ -344,6 +542,11 @@ bool EncoderArguments::generateTextureGutter() const
     return _generateTextureGutter;
 }
 
+unsigned int EncoderArguments::getTileChunkSize() const
+{
+    return _tileChunkSize;
+}
+
 const char* EncoderArguments::getNodeId() const
 {
     if (_nodeId.length() == 0)
@@ -353,6 +556,20 @@ const char* EncoderArguments::getNodeId() const
     return _nodeId.c_str();
 }
 
+const char* EncoderArguments::getCacheDirectory() const
+{
+    if (_cacheDirectory.length() == 0)
+    {
+        return NULL;
+    }
+    return _cacheDirectory.c_str();
+}
+
+const char* EncoderArguments::getVersion()
+{
+    return ENCODER_VERSION;
+}
+
 std::vector<unsigned int> EncoderArguments::getFontSizes() const
 {
     return _fontSizes;
@@ -360,6 +577,12 @@ std::vector<unsigned int> EncoderArguments::getFontSizes() const
 
 EncoderArguments::FileFormat EncoderArguments::getFileFormat() const
 {
+    // Directories are packed into archives
+    struct stat status;
+    if (_filePath.length() > 0 && stat(_filePath.c_str(), &status) == 0 && (status.st_mode & S_IFDIR) != 0)
+    {
+        return FILEFORMAT_DIRECTORY;
+    }
     if (_filePath.length() < 5)
     {
         return FILEFORMAT_UNKNOWN;
@@ -403,6 +626,17 @@ EncoderArguments::FileFormat EncoderArguments::getFileFormat() const
     {
         return FILEFORMAT_RAW;
     }
+    if (ext.compare("lua") == 0)
+    {
+        return FILEFORMAT_LUA;
+    }
+    if (ext.compare("material") == 0 || ext.compare("scene") == 0 || ext.compare("physics") == 0 ||
+        ext.compare("particle") == 0 || ext.compare("animation") == 0 || ext.compare("audio") == 0 ||
+        ext.compare("form") == 0 || ext.compare("theme") == 0 || ext.compare("terrain") == 0 ||
+        ext.compare("config") == 0)
+    {
+        return FILEFORMAT_PROPERTIES;
+    }
 
     return FILEFORMAT_UNKNOWN;
 }
@@ -425,6 +659,63 @@ void EncoderArguments::readOption(const std::vector<std::string>& options, size_
         {
             _fontFormat = Font::DISTANCE_FIELD;
         }
+        else if (str.compare("-f:df") == 0)
+        {
+            _fontFormat = Font::DISTANCE_FIELD;
+            _fontFastDistanceField = true;
+        }
+        break;
+    case 'c':
+        if (str.compare("-ch") == 0)
+        {
+            if ((*index + 1) >= options.size())
+            {
+                LOG(1, "Error: -ch requires 1 argument.\n");
+                _parseError = true;
+                return;
+            }
+            (*index)++;
+            std::string nodeId = options[*index];
+            if (nodeId.length() > 0)
+            {
+                _convexHullId.insert(nodeId);
+            }
+        }
+        else if (str.compare("-cache") == 0)
+        {
+            (*index)++;
+            if (*index >= options.size())
+            {
+                LOG(1, "Error: -cache requires 1 argument.\n");
+                _parseError = true;
+                return;
+            }
+            _cacheDirectory = options[*index];
+        }
+        else if (str.compare("-cs") == 0)
+        {
+            // Compress the mesh and animation sections of the bundle
+            _compressSections = true;
+        }
+        else if (str.compare("-ca") == 0)
+        {
+            // Compress animations with the given keyframe reduction tolerance
+            (*index)++;
+            if (*index >= options.size())
+            {
+                LOG(1, "Error: missing tolerance argument for -ca.\n");
+                _parseError = true;
+                return;
+            }
+            _compressAnimations = true;
+            _animationTolerance = (float)atof(options[*index].c_str());
+            if (_animationTolerance < 0.0f)
+            {
+                LOG(1, "Error: tolerance argument for -ca must not be negative.\n");
+                _parseError = true;
+                return;
+            }
+        }
         break;
     case 'g':
         if (str.compare("-groupAnimations:auto") == 0 || str.compare("-g:auto") == 0)
@@ -471,6 +762,11 @@ void EncoderArguments::readOption(const std::vector<std::string>& options, size_
             // Optimize animations
             _optimizeAnimations = true;
         }
+        else if (str == "-optimizeMeshes:none" || str == "-om:none")
+        {
+            // Keep the triangle and vertex order of meshes
+            _optimizeMeshes = false;
+        }
         break;
     case 'h':
         {
@@ -538,6 +834,60 @@ void EncoderArguments::readOption(const std::vector<std::string>& options, size_
             }
         }
         break;
+    case 'j':
+        if (str.compare("-j") == 0)
+        {
+            (*index)++;
+            if (*index >= options.size())
+            {
+                LOG(1, "Error: -j requires 1 argument.\n");
+                _parseError = true;
+                return;
+            }
+            int count = atoi(options[*index].c_str());
+            _workerCount = count > 0 ? (unsigned int)count : 0;
+            _multipleInputs = true;
+        }
+        break;
+    case 'l':
+        if (str.compare("-lod") == 0 || str.compare("-lodRatio") == 0 || str.compare("-lodError") == 0)
+        {
+            (*index)++;
+            if (*index >= options.size())
+            {
+                LOG(1, "Error: %s requires 1 argument.\n", str.c_str());
+                _parseError = true;
+                return;
+            }
+            const char* value = options[*index].c_str();
+            if (str.compare("-lod") == 0)
+            {
+                // Generate levels of detail
+                int count = atoi(value);
+                _lodCount = count > 0 ? (unsigned int)count : 0;
+            }
+            else if (str.compare("-lodRatio") == 0)
+            {
+                _lodRatio = (float)atof(value);
+                if (_lodRatio <= 0.0f || _lodRatio >= 1.0f)
+                {
+                    LOG(1, "Error: ratio argument for -lodRatio must be between 0 and 1.\n");
+                    _parseError = true;
+                    return;
+                }
+            }
+            else
+            {
+                _lodError = (float)atof(value);
+                if (_lodError < 0.0f)
+                {
+                    LOG(1, "Error: error argument for -lodError must not be negative.\n");
+                    _parseError = true;
+                    return;
+                }
+            }
+        }
+        break;
     case 'm':
         if (str.compare("-m") == 0)
         {
@@ -578,7 +928,15 @@ void EncoderArguments::readOption(const std::vector<std::string>& options, size_
         }
         break;
     case 'p':
-        _fontPreview = true;
+        if (str == "-packVertices:none" || str == "-pv:none")
+        {
+            // Write every vertex element as floats
+            _packVertices = false;
+        }
+        else
+        {
+            _fontPreview = true;
+        }
         break;
     case 's':
         if (_normalMap)
@@ -681,6 +1039,53 @@ void EncoderArguments::readOption(const std::vector<std::string>& options, size_
                 _tangentBinormalId.insert(nodeId);
             }
         }
+        else if (str.compare("-tc") == 0)
+        {
+            (*index)++;
+            if (*index >= options.size() || atoi(options[*index].c_str()) <= 0)
+            {
+                LOG(1, "Error: -tc requires a positive number of tiles.\n");
+                _parseError = true;
+                return;
+            }
+            _tileChunkSize = (unsigned int)atoi(options[*index].c_str());
+        }
+        else if (str.compare("-tf") == 0)
+        {
+            (*index)++;
+            if (*index >= options.size())
+            {
+                LOG(1, "Error: -tf requires 1 argument.\n");
+                _parseError = true;
+                return;
+            }
+            const std::string& format = options[*index];
+            if (format == "rgba")
+                _textureFormat = TEXTUREFORMAT_RGBA;
+            else if (format == "bc1")
+                _textureFormat = TEXTUREFORMAT_BC1;
+            else if (format == "bc3")
+                _textureFormat = TEXTUREFORMAT_BC3;
+            else if (format == "etc2")
+                _textureFormat = TEXTUREFORMAT_ETC2;
+            else if (format == "etc2a")
+                _textureFormat = TEXTUREFORMAT_ETC2_EAC;
+            else
+            {
+                LOG(1, "Error: unknown texture format '%s' for -tf.\n", format.c_str());
+                _parseError = true;
+                return;
+            }
+        }
+        else if (str.compare("-tsrgb") == 0)
+        {
+            _textureSRGB = true;
+        }
+        else if (str.compare("-tm:none") == 0)
+        {
+            // Only write the base level of textures
+            _textureMipmaps = false;
+        }
         else if (str.compare("-textureGutter:none") == 0 || str.compare("-tg:none") == 0)
         {
             _generateTextureGutter = false;
@@ -709,6 +1114,10 @@ void EncoderArguments::readOption(const std::vector<std::string>& options, size_
 void EncoderArguments::setInputfilePath(const std::string& inputPath)
 {
     _filePath.assign(getRealPath(inputPath));
+
+    // Strip the trailing separator of a directory, which is packed into an archive named after it
+    while (_filePath.length() > 1 && _filePath[_filePath.length() - 1] == '/')
+        _filePath.erase(_filePath.length() - 1);
 }
 
 void EncoderArguments::setOutputfilePath(const std::string& outputPath)
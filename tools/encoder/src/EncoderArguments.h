@@ -24,7 +24,10 @@ public:
         FILEFORMAT_OTF,
         FILEFORMAT_GPB,
         FILEFORMAT_PNG,
-        FILEFORMAT_RAW
+        FILEFORMAT_RAW,
+        FILEFORMAT_LUA,
+        FILEFORMAT_PROPERTIES,
+        FILEFORMAT_DIRECTORY
     };
 
     struct HeightmapOption
@@ -49,6 +52,18 @@ public:
         ANIMATIONGROUP_AUTO,
         ANIMATIONGROUP_OFF
     };
+
+    /**
+     * The formats that textures are encoded in.
+     */
+    enum TextureFormat
+    {
+        TEXTUREFORMAT_RGBA,
+        TEXTUREFORMAT_BC1,
+        TEXTUREFORMAT_BC3,
+        TEXTUREFORMAT_ETC2,
+        TEXTUREFORMAT_ETC2_EAC
+    };
     
     /**
      * Constructor.
@@ -128,6 +143,11 @@ public:
      */
     bool isGenerateTangentBinormalId(const std::string& id) const;
 
+    /**
+     * Returns true if the given node ID was marked as needing a cooked convex hull for its mesh.
+     */
+    bool isGenerateConvexHullId(const std::string& id) const;
+
     /**
      * Returns true if normal map generation is turned on.
      */
@@ -146,6 +166,22 @@ public:
      * This option is only applicable for normal map generation.
      */
     const Vector3& getHeightmapWorldSize() const;
+
+    /**
+     * Returns the format that textures are encoded in, which is RGBA by default.
+     */
+    TextureFormat getTextureFormat() const;
+
+    /**
+     * Returns true if the colors of textures are in sRGB, in which case their mipmaps are
+     * filtered in linear space and they are written in an sRGB format.
+     */
+    bool textureSRGBEnabled() const;
+
+    /**
+     * Returns true if the mipmaps of textures should be generated, which is the default.
+     */
+    bool textureMipmapsEnabled() const;
     
     /**
      * Returns true if an error occurred while parsing the command line arguments.
@@ -170,18 +206,96 @@ public:
 
     Font::FontFormat getFontFormat() const;
 
+    /**
+     * Returns true if distance field fonts should be generated with the fast exact distance transform.
+     */
+    bool fontFastDistanceFieldEnabled() const;
+
     bool textOutputEnabled() const;
 
     bool optimizeAnimationsEnabled() const;
 
+    bool compressAnimationsEnabled() const;
+
+    /**
+     * Returns true if the triangles and vertices of meshes should be reordered for the
+     * vertex cache, overdraw and vertex fetch, which is the default.
+     */
+    bool optimizeMeshesEnabled() const;
+
+    /**
+     * Returns true if vertex elements should be written in packed types, such as normalized
+     * integers and half floats, where their values allow, which is the default.
+     */
+    bool packVerticesEnabled() const;
+
+    /**
+     * Returns the number of levels of detail to generate for each model without any,
+     * or zero (the default) to not generate any.
+     */
+    unsigned int getLodCount() const;
+
+    /**
+     * Returns the ratio of the triangles of each generated level of detail to the
+     * triangles of the previous level.
+     */
+    float getLodRatio() const;
+
+    /**
+     * Returns the largest error that simplifying a generated level of detail may
+     * introduce, as a fraction of the radius of the mesh, or zero for no limit.
+     */
+    float getLodError() const;
+
+    /**
+     * Returns the error tolerance of keyframe reduction when compressing animations.
+     */
+    float getAnimationTolerance() const;
+
+    /**
+     * Returns true if the mesh and animation sections of the bundle, or the files
+     * of an archive, should be LZ4 compressed.
+     */
+    bool compressSectionsEnabled() const;
+
     bool outputMaterialEnabled() const;
 
     bool generateTextureGutter() const;
 
+    /**
+     * Returns the number of tiles along each side of the static meshes that tile layers are baked into, or zero to write tile sets.
+     */
+    unsigned int getTileChunkSize() const;
+
     const char* getNodeId() const;
 
+    /**
+     * Returns the directory of the build cache given with -cache, or NULL if files are always encoded.
+     */
+    const char* getCacheDirectory() const;
+
+    /**
+     * Returns the version of the encoder.
+     */
+    static const char* getVersion();
+
     static std::string getRealPath(const std::string& filepath);
 
+    /**
+     * Returns the paths of the input files when -j was given, as they were given.
+     */
+    const std::vector<std::string>& getInputFilePaths() const;
+
+    /**
+     * Returns the options that were given, other than -j.
+     */
+    const std::vector<std::string>& getOptions() const;
+
+    /**
+     * Returns the number of worker threads given with -j, or zero to use one per core.
+     */
+    unsigned int getWorkerCount() const;
+
 private:
 
     /**
@@ -211,25 +325,46 @@ private:
     std::string _filePath;
     std::string _fileOutputPath;
     std::string _nodeId;
+    std::string _cacheDirectory;
 
     bool _normalMap;
     Vector3 _heightmapWorldSize;
     int _heightmapResolution[2];
 
+    TextureFormat _textureFormat;
+    bool _textureSRGB;
+    bool _textureMipmaps;
+
     bool _parseError;
     std::vector<unsigned int> _fontSizes;
     bool _fontPreview;
     Font::FontFormat _fontFormat;
+    bool _fontFastDistanceField;
     bool _textOutput;
     bool _optimizeAnimations;
+    bool _compressAnimations;
+    bool _optimizeMeshes;
+    bool _packVertices;
+    unsigned int _lodCount;
+    float _lodRatio;
+    float _lodError;
+    float _animationTolerance;
+    bool _compressSections;
     AnimationGroupOption _animationGrouping;
     bool _outputMaterial;
     bool _generateTextureGutter;
+    unsigned int _tileChunkSize;
 
     std::vector<std::string> _groupAnimationNodeId;
     std::vector<std::string> _groupAnimationAnimationId;
     std::vector<HeightmapOption> _heightmaps;
     std::set<std::string> _tangentBinormalId;
+    std::set<std::string> _convexHullId;
+
+    unsigned int _workerCount;
+    bool _multipleInputs;
+    std::vector<std::string> _inputFilePaths;
+    std::vector<std::string> _options;
 
 };
 
@@ -3,6 +3,7 @@
 #include <sstream>
 
 #include "FBXSceneEncoder.h"
+#include "BuildCache.h"
 #include "FBXUtil.h"
 #include "Sampler.h"
 
@@ -114,6 +115,7 @@ void FBXSceneEncoder::write(const string& filepath, const EncoderArguments& argu
 
 bool FBXSceneEncoder::writeMaterial(const string& filepath)
 {
+    BuildCache::addOutput(filepath);
     FILE* file = fopen(filepath.c_str(), "w");
     if (!file)
     {
@@ -491,6 +493,15 @@ Node* FBXSceneEncoder::loadNode(FbxNode* fbxNode)
     loadLight(fbxNode, node);
     loadModel(fbxNode, node);
 
+    // The children of an LOD group are its levels, not nodes of their own.
+    FbxNodeAttribute* nodeAttribute = fbxNode->GetNodeAttribute();
+    if (nodeAttribute && nodeAttribute->GetAttributeType() == FbxNodeAttribute::eLODGroup)
+    {
+        loadLodGroup(fbxNode, node);
+        _nodeMap[fbxNode] = node;
+        return node;
+    }
+
     if (fbxNode->GetSkeleton())
     {
         // Indicate that this is a joint node for the purpose of debugging.
@@ -874,6 +885,53 @@ void FBXSceneEncoder::loadModel(FbxNode* fbxNode, Node* node)
     }
 }
 
+void FBXSceneEncoder::loadLodGroup(FbxNode* fbxNode, Node* node)
+{
+    FbxLODGroup* lodGroup = FbxCast<FbxLODGroup>(fbxNode->GetNodeAttribute());
+    assert(lodGroup);
+
+    const bool percentage = lodGroup->ThresholdsUsedAsPercentage.Get();
+    if (!percentage)
+    {
+        LOG(1, "Warning: LOD group '%s' uses distance thresholds; each level is used at half the screen size of the previous one instead.\n", fbxNode->GetName());
+    }
+
+    Model* model = NULL;
+    float screenSize = 1.0f;
+    const int childCount = fbxNode->GetChildCount();
+    for (int i = 0; i < childCount; ++i)
+    {
+        FbxNode* child = fbxNode->GetChild(i);
+        FbxMesh* fbxMesh = child->GetMesh();
+        if (!fbxMesh || fbxMesh->GetPolygonVertexCount() == 0 || !fbxMesh->IsTriangleMesh())
+        {
+            LOG(1, "Warning: Level %d of LOD group '%s' is not a triangle mesh and is ignored.\n", i, fbxNode->GetName());
+            continue;
+        }
+
+        if (model == NULL)
+        {
+            // The materials of the first level are the materials of the model.
+            loadModel(child, node);
+            model = node->getModel();
+            _nodeMap[child] = node;
+            continue;
+        }
+
+        // Threshold i - 1 separates level i - 1 from level i.
+        FbxDistance threshold;
+        if (percentage && lodGroup->GetThreshold(i - 1, threshold))
+        {
+            screenSize = threshold.value() / 100.0f;
+        }
+        else
+        {
+            screenSize *= 0.5f;
+        }
+        model->addLod(loadMesh(fbxMesh), screenSize);
+    }
+}
+
 void FBXSceneEncoder::loadMaterials(FbxScene* fbxScene)
 {
     FbxNode* rootNode = fbxScene->GetRootNode();
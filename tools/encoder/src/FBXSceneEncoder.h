@@ -133,6 +133,17 @@ private:
      */
     void loadModel(FbxNode* fbxNode, Node* node);
 
+    /**
+     * Loads the levels of an FBX LOD group as the model of the given GamePlay node.
+     *
+     * The first level becomes the model of the node and the meshes of the other
+     * levels are added to it as levels of detail.
+     *
+     * @param fbxNode The FBX LOD group node to load from.
+     * @param node The GamePlay node to add to.
+     */
+    void loadLodGroup(FbxNode* fbxNode, Node* node);
+
     /**
      * Loads materials for each node in the scene.
      */
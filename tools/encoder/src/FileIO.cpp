@@ -205,4 +205,77 @@ bool promptUserGroupAnimations()
     }
 }
 
+static void writeLZ4Length(size_t length, std::vector<unsigned char>* compressed)
+{
+    while (length >= 255)
+    {
+        compressed->push_back(255);
+        length -= 255;
+    }
+    compressed->push_back((unsigned char)length);
+}
+
+bool compressLZ4(const unsigned char* data, size_t size, std::vector<unsigned char>* compressed)
+{
+    // The last match must start 12 bytes before the end of the data, and the last 5 bytes must be literals.
+    const size_t MIN_MATCH = 4;
+    const size_t MATCH_START_LIMIT = 12;
+    const size_t LAST_LITERALS = 5;
+    const size_t MAX_DISTANCE = 65535;
+    const unsigned int HASH_BITS = 16;
+
+    compressed->clear();
+    compressed->reserve(size);
+    std::vector<long> table(1 << HASH_BITS, -1);
+    size_t anchor = 0;
+    size_t position = 0;
+    while (size >= MATCH_START_LIMIT && position <= size - MATCH_START_LIMIT)
+    {
+        unsigned int sequence;
+        memcpy(&sequence, data + position, 4);
+        unsigned int hash = (sequence * 2654435761U) >> (32 - HASH_BITS);
+        long candidate = table[hash];
+        table[hash] = (long)position;
+
+        unsigned int candidateSequence = 0;
+        if (candidate >= 0)
+            memcpy(&candidateSequence, data + candidate, 4);
+        if (candidate < 0 || position - candidate > MAX_DISTANCE || candidateSequence != sequence)
+        {
+            ++position;
+            continue;
+        }
+
+        size_t matchLength = MIN_MATCH;
+        while (position + matchLength < size - LAST_LITERALS && data[candidate + matchLength] == data[position + matchLength])
+            ++matchLength;
+
+        // Write the literals since the last match, then the match.
+        size_t literalLength = position - anchor;
+        size_t extraMatchLength = matchLength - MIN_MATCH;
+        compressed->push_back((unsigned char)((std::min(literalLength, (size_t)15) << 4) | std::min(extraMatchLength, (size_t)15)));
+        if (literalLength >= 15)
+            writeLZ4Length(literalLength - 15, compressed);
+        compressed->insert(compressed->end(), data + anchor, data + position);
+        size_t distance = position - candidate;
+        compressed->push_back((unsigned char)(distance & 0xFF));
+        compressed->push_back((unsigned char)(distance >> 8));
+        if (extraMatchLength >= 15)
+            writeLZ4Length(extraMatchLength - 15, compressed);
+
+        position += matchLength;
+        anchor = position;
+        if (compressed->size() >= size)
+            return false;
+    }
+
+    // The remaining data is written as the literals of the last sequence.
+    size_t literalLength = size - anchor;
+    compressed->push_back((unsigned char)(std::min(literalLength, (size_t)15) << 4));
+    if (literalLength >= 15)
+        writeLZ4Length(literalLength - 15, compressed);
+    compressed->insert(compressed->end(), data + anchor, data + size);
+    return compressed->size() < size;
+}
+
 }
@@ -150,6 +150,17 @@ void writeIndent(unsigned int indentLevel, FILE* file);
  */
 bool promptUserGroupAnimations();
 
+/**
+ * Compresses data into an LZ4 block, which the engine decompresses with FileSystem::decompress().
+ *
+ * @param data The data to compress.
+ * @param size The size of the data.
+ * @param compressed The output compressed data.
+ *
+ * @return true if the data compressed to fewer bytes, false otherwise.
+ */
+bool compressLZ4(const unsigned char* data, size_t size, std::vector<unsigned char>* compressed);
+
 }
 
 #endif
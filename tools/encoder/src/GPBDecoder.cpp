@@ -1,5 +1,6 @@
 #include "Base.h"
 #include "GPBDecoder.h"
+#include "BuildCache.h"
 
 namespace gameplay
 {
@@ -19,6 +20,7 @@ void GPBDecoder::readBinary(const std::string& filepath)
     _file = fopen(filepath.c_str(), "rb");
     std::string outfilePath = filepath;
     outfilePath += ".xml";
+    BuildCache::addOutput(outfilePath);
     _outFile = fopen(outfilePath.c_str(), "w");
 
     // read and write files
@@ -1,12 +1,23 @@
 #include "Base.h"
 #include "GPBFile.h"
+#include "BuildCache.h"
 #include "Transform.h"
 #include "StringUtil.h"
 #include "EncoderArguments.h"
 #include "Heightmap.h"
+#include "ConvexHull.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "ThreadPool.h"
 
 #define EPSILON 1.2e-7f;
 
+// Sections smaller than this are not worth decompressing, so they are stored uncompressed.
+#define GPB_MIN_COMPRESSED_SECTION_SIZE 4096
+
+// Largest bundle the 32-bit offsets and sizes of the ref and section tables can address.
+#define GPB_MAX_FILE_SIZE 0xFFFFFFFFull
+
 namespace gameplay
 {
 
@@ -41,6 +52,11 @@ static Node* getCommonNodeAncestor(const std::vector<Node*>& nodes);
  */
 static void getNodeAncestors(Node* node, std::list<Node*>& ancestors);
 
+/**
+ * Gets the number of triangles of the parts of a mesh.
+ */
+static unsigned int getTriangleCount(const Mesh* mesh);
+
 
 GPBFile::GPBFile(void)
     : _file(NULL), _animationsAdded(false)
@@ -88,28 +104,130 @@ bool GPBFile::saveBinary(const std::string& filepath)
     // write refs
     _refTable.writeBinary(_file);
 
+    // Section table, which lists the mesh and animation data that may be compressed.
+    // The entries are filled in once the file has been written.
+    bool compress = EncoderArguments::getInstance()->compressSectionsEnabled();
+    unsigned int sectionCount = 0;
+    if (compress)
+    {
+        sectionCount = (unsigned int)_geometry.size();
+        for (std::list<Object*>::const_iterator i = _objects.begin(); i != _objects.end(); ++i)
+        {
+            if ((*i)->getTypeId() == Object::ANIMATIONS_ID)
+                ++sectionCount;
+        }
+    }
+    write(sectionCount, _file);
+    long sectionTable = ftell(_file);
+    for (unsigned int i = 0; i < sectionCount * 3; ++i)
+    {
+        write((unsigned int)0, _file);
+    }
+    std::vector<std::pair<long, long> > sections;
+
     // meshes
     write((unsigned int)_geometry.size(), _file);
     for (std::list<Mesh*>::const_iterator i = _geometry.begin(); i != _geometry.end(); ++i)
     {
+        long start = ftell(_file);
         (*i)->writeBinary(_file);
+        if (compress)
+            sections.push_back(std::make_pair(start, ftell(_file) - start));
     }
 
     // Objects
     write((unsigned int)_objects.size(), _file);
     for (std::list<Object*>::const_iterator i = _objects.begin(); i != _objects.end(); ++i)
     {
+        long start = ftell(_file);
         (*i)->writeBinary(_file);
+        if (compress && (*i)->getTypeId() == Object::ANIMATIONS_ID)
+            sections.push_back(std::make_pair(start, ftell(_file) - start));
     }
 
     _refTable.updateOffsets(_file);
-    
+
+    // The ref and section tables store 32-bit offsets, which would wrap silently past 4 GB.
+    long size = ftell(_file);
     fclose(_file);
+    if (size < 0 || (unsigned long long)size > GPB_MAX_FILE_SIZE)
+    {
+        LOG(1, "Error: Bundle '%s' is larger than the 4 GB the GPB format can address.\n", filepath.c_str());
+        return false;
+    }
+
+    if (compress)
+        return compressSections(filepath, sectionTable, sections);
     return true;
 }
 
+bool GPBFile::compressSections(const std::string& filepath, long sectionTable, const std::vector<std::pair<long, long> >& sections)
+{
+    // Read back the uncompressed file, whose offsets are the ones the bundle is read at.
+    FILE* file = fopen(filepath.c_str(), "rb");
+    if (!file)
+    {
+        return false;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    std::vector<unsigned char> data(size);
+    size_t n = size > 0 ? fread(&data[0], 1, size, file) : 0;
+    fclose(file);
+    if (n != (size_t)size)
+    {
+        return false;
+    }
+
+    // Compress the sections in parallel, then fill in their entries of the section table.
+    std::vector<std::vector<unsigned char> > compressed(sections.size());
+    parallelFor((unsigned int)sections.size(), [&](unsigned int i)
+    {
+        if (sections[i].second < GPB_MIN_COMPRESSED_SECTION_SIZE ||
+            !compressLZ4(&data[sections[i].first], sections[i].second, &compressed[i]))
+        {
+            compressed[i].clear();
+        }
+    });
+    size_t storedSize = size;
+    for (size_t i = 0; i < sections.size(); ++i)
+    {
+        unsigned int entry[3] = { (unsigned int)sections[i].first, (unsigned int)sections[i].second, (unsigned int)sections[i].second };
+        if (!compressed[i].empty())
+        {
+            entry[2] = (unsigned int)compressed[i].size();
+            storedSize -= sections[i].second - compressed[i].size();
+        }
+        memcpy(&data[sectionTable + i * sizeof(entry)], entry, sizeof(entry));
+    }
+
+    // Write the sections that compressed in place of their data.
+    file = fopen(filepath.c_str(), "wb");
+    if (!file)
+    {
+        return false;
+    }
+    long position = 0;
+    size_t written = 0;
+    for (size_t i = 0; i < sections.size(); ++i)
+    {
+        if (compressed[i].empty())
+            continue;
+        written += fwrite(&data[position], 1, sections[i].first - position, file);
+        written += fwrite(&compressed[i][0], 1, compressed[i].size(), file);
+        position = sections[i].first + sections[i].second;
+    }
+    written += fwrite(&data[position], 1, size - position, file);
+    fclose(file);
+
+    LOG(2, "Compressed bundle sections from %ld to %u bytes.\n", size, (unsigned int)storedSize);
+    return written == storedSize;
+}
+
 bool GPBFile::saveText(const std::string& filepath)
 {
+    BuildCache::addOutput(filepath);
     _file = fopen(filepath.c_str(), "w");
     if (!_file)
     {
@@ -315,9 +433,48 @@ void GPBFile::adjust()
         }
     }
 
+    // Levels of detail are generated first so that they are optimized and packed with the other meshes.
+    EncoderArguments* arguments = EncoderArguments::getInstance();
+    if (arguments->getLodCount() > 0)
+    {
+        LOG(1, "Generating levels of detail.\n");
+        generateLods(arguments->getLodCount(), arguments->getLodRatio(), arguments->getLodError());
+    }
+
+    // The bounds of skinned meshes are found by posing their shared joints, so only the others are computed in parallel.
+    std::vector<Mesh*> meshes;
+    std::vector<Mesh*> skinnedMeshes;
     for (std::list<Node*>::const_iterator i = _nodes.begin(); i != _nodes.end(); ++i)
     {
-        computeBounds(*i);
+        getMeshes(*i, &meshes, &skinnedMeshes);
+    }
+    if (EncoderArguments::getInstance()->optimizeMeshesEnabled())
+    {
+        LOG(1, "Optimizing meshes.\n");
+        std::vector<Mesh*> allMeshes(meshes);
+        allMeshes.insert(allMeshes.end(), skinnedMeshes.begin(), skinnedMeshes.end());
+        parallelFor((unsigned int)allMeshes.size(), [&allMeshes](unsigned int i)
+        {
+            MeshOptimizer::optimize(allMeshes[i]);
+        });
+    }
+    parallelFor((unsigned int)meshes.size(), [&meshes](unsigned int i)
+    {
+        meshes[i]->computeBounds();
+    });
+    for (size_t i = 0, count = skinnedMeshes.size(); i < count; ++i)
+    {
+        skinnedMeshes[i]->computeBounds();
+    }
+
+    // Vertices are packed once the bounds are found, since skinned bounds are posed with the blend weights.
+    if (EncoderArguments::getInstance()->packVerticesEnabled())
+    {
+        meshes.insert(meshes.end(), skinnedMeshes.begin(), skinnedMeshes.end());
+        parallelFor((unsigned int)meshes.size(), [&meshes](unsigned int i)
+        {
+            meshes[i]->packVertexFormat();
+        });
     }
 
     if (EncoderArguments::getInstance()->optimizeAnimationsEnabled())
@@ -326,6 +483,12 @@ void GPBFile::adjust()
         optimizeAnimations();
     }
 
+    if (EncoderArguments::getInstance()->compressAnimationsEnabled())
+    {
+        LOG(1, "Compressing animations.\n");
+        compressAnimations(EncoderArguments::getInstance()->getAnimationTolerance());
+    }
+
     // TODO:
     // remove ambient _lights
     // for each node
@@ -339,6 +502,48 @@ void GPBFile::adjust()
     //   Blender will output a simple translation animation to 3 separate animations with the same key times but targeting X, Y and Z.
     //   This can be merged into one animation. Same for scale animations.
 
+    // Cook the convex hulls of the meshes of the flagged nodes.
+    std::vector<Node*> hullNodes;
+    std::vector<ConvexHull*> hulls;
+    std::set<std::string> hullIds;
+    for (std::list<Node*>::const_iterator i = _nodes.begin(); i != _nodes.end(); ++i)
+    {
+        Node* node = *i;
+        Model* model = node->getModel();
+        if (!model || !model->getMesh() || !EncoderArguments::getInstance()->isGenerateConvexHullId(node->getId()))
+            continue;
+
+        std::string id = model->getMesh()->getId() + "_hull";
+        if (idExists(id) || !hullIds.insert(id).second)
+            continue;
+
+        ConvexHull* hull = new ConvexHull();
+        hull->setId(id);
+        hullNodes.push_back(node);
+        hulls.push_back(hull);
+    }
+    std::vector<char> built(hulls.size());
+    parallelFor((unsigned int)hulls.size(), [&](unsigned int i)
+    {
+        built[i] = hulls[i]->build(hullNodes[i]->getModel()->getMesh()) ? 1 : 0;
+    });
+    for (size_t i = 0, count = hulls.size(); i < count; ++i)
+    {
+        ConvexHull* hull = hulls[i];
+        if (built[i])
+        {
+            LOG(2, "Cooked convex hull '%s' with %u vertices.\n", hull->getId().c_str(), hull->getVertexCount());
+            addToRefTable(hull);
+            add(hull);
+        }
+        else
+        {
+            LOG(1, "Warning: Mesh '%s' of node '%s' has no vertices to cook a convex hull from.\n",
+                hullNodes[i]->getModel()->getMesh()->getId().c_str(), hullNodes[i]->getId().c_str());
+            delete hull;
+        }
+    }
+
     // Generate heightmaps
     const std::vector<EncoderArguments::HeightmapOption>& heightmaps = EncoderArguments::getInstance()->getHeightmapOptions();
     for (unsigned int i = 0, count = heightmaps.size(); i < count; ++i)
@@ -386,14 +591,98 @@ void GPBFile::renameAnimations(std::vector<std::string>& animationIds, const cha
     }
 }
 
-void GPBFile::computeBounds(Node* node)
+void GPBFile::getMeshes(Node* node, std::vector<Mesh*>* meshes, std::vector<Mesh*>* skinnedMeshes)
 {
     assert(node);
     if (Model* model = node->getModel())
     {
+        std::vector<Mesh*> modelMeshes;
         if (Mesh* mesh = model->getMesh())
         {
-            mesh->computeBounds();
+            modelMeshes.push_back(mesh);
+        }
+        for (unsigned int i = 0; i < model->getLodCount(); ++i)
+        {
+            modelMeshes.push_back(model->getLodMesh(i));
+        }
+
+        // Meshes shared by several nodes are only computed once.
+        for (size_t i = 0, count = modelMeshes.size(); i < count; ++i)
+        {
+            Mesh* mesh = modelMeshes[i];
+            std::vector<Mesh*>* list = mesh->model && mesh->model->getSkin() ? skinnedMeshes : meshes;
+            if (std::find(list->begin(), list->end(), mesh) == list->end())
+                list->push_back(mesh);
+        }
+    }
+}
+
+void GPBFile::generateLods(unsigned int count, float ratio, float maxError)
+{
+    // Find the meshes of the models without levels of detail, once for the models that share a mesh.
+    std::vector<Model*> models;
+    std::vector<Mesh*> meshes;
+    for (std::list<Node*>::const_iterator i = _nodes.begin(); i != _nodes.end(); ++i)
+    {
+        Model* model = (*i)->getModel();
+        if (!model || !model->getMesh() || model->getLodCount() > 0)
+            continue;
+        models.push_back(model);
+        if (std::find(meshes.begin(), meshes.end(), model->getMesh()) == meshes.end())
+            meshes.push_back(model->getMesh());
+    }
+
+    // Each level is simplified from the mesh itself rather than from the previous level, so that errors do not accumulate.
+    // The levels stop at the first one that is no smaller than the previous one.
+    std::vector<std::vector<Mesh*> > lods(meshes.size());
+    parallelFor((unsigned int)meshes.size(), [&](unsigned int i)
+    {
+        unsigned int previousCount = getTriangleCount(meshes[i]);
+        float levelRatio = 1.0f;
+        for (unsigned int level = 0; level < count; ++level)
+        {
+            levelRatio *= ratio;
+            Mesh* lod = MeshSimplifier::simplify(meshes[i], levelRatio, maxError);
+            if (!lod)
+                break;
+            unsigned int triangleCount = getTriangleCount(lod);
+            if (triangleCount >= previousCount)
+            {
+                delete lod;
+                break;
+            }
+            previousCount = triangleCount;
+            lods[i].push_back(lod);
+        }
+    });
+
+    for (size_t i = 0, meshCount = meshes.size(); i < meshCount; ++i)
+    {
+        for (size_t level = 0, levelCount = lods[i].size(); level < levelCount; ++level)
+        {
+            Mesh* lod = lods[i][level];
+            char suffix[16];
+            sprintf(suffix, "_lod%u", (unsigned int)level + 1);
+            std::string id = meshes[i]->getId() + suffix;
+            while (idExists(id))
+                id += "_";
+            lod->setId(id);
+            addMesh(lod);
+        }
+        LOG(2, "Generated %u level(s) of detail for mesh '%s'.\n", (unsigned int)lods[i].size(), meshes[i]->getId().c_str());
+    }
+
+    // A level with a fraction of the triangles keeps roughly the same triangle density on screen at the square root of the screen size.
+    const float screenRatio = sqrt(ratio);
+    for (size_t i = 0, modelCount = models.size(); i < modelCount; ++i)
+    {
+        Model* model = models[i];
+        const std::vector<Mesh*>& levels = lods[std::find(meshes.begin(), meshes.end(), model->getMesh()) - meshes.begin()];
+        float screenSize = 1.0f;
+        for (size_t level = 0, levelCount = levels.size(); level < levelCount; ++level)
+        {
+            screenSize *= screenRatio;
+            model->addLod(levels[level], screenSize);
         }
     }
 }
@@ -432,6 +721,35 @@ void GPBFile::optimizeAnimations()
     }
 }
 
+void GPBFile::compressAnimations(float tolerance)
+{
+    std::vector<AnimationChannel*> channels;
+    const unsigned int animationCount = _animations.getAnimationCount();
+    for (unsigned int animationIndex = 0; animationIndex < animationCount; ++animationIndex)
+    {
+        Animation* animation = _animations.getAnimation(animationIndex);
+        assert(animation);
+
+        const unsigned int channelCount = animation->getAnimationChannelCount();
+
+        LOG(2, "Compressing %u channel(s) in animation '%s'.\n", channelCount, animation->getId().c_str());
+
+        for (unsigned int channelIndex = 0; channelIndex < channelCount; ++channelIndex)
+        {
+            AnimationChannel* channel = animation->getAnimationChannel(channelIndex);
+            assert(channel);
+            channels.push_back(channel);
+        }
+    }
+
+    // The keyframes of each channel are reduced independently of the others.
+    parallelFor((unsigned int)channels.size(), [&channels, tolerance](unsigned int i)
+    {
+        channels[i]->reduceKeyframes(tolerance);
+        channels[i]->setCompressed(true);
+    });
+}
+
 void GPBFile::decomposeTransformAnimationChannel(Animation* animation, AnimationChannel* channel, int channelIndex)
 {
     LOG(2, "  Optimizing animaton channel %s:%d.\n", animation->getId().c_str(), channelIndex+1);
@@ -618,4 +936,14 @@ void getNodeAncestors(Node* node, std::list<Node*>& ancestors)
     }
 }
 
+unsigned int getTriangleCount(const Mesh* mesh)
+{
+    unsigned int count = 0;
+    for (size_t i = 0, partCount = mesh->parts.size(); i < partCount; ++i)
+    {
+        count += (unsigned int)mesh->parts[i]->getIndicesCount() / 3;
+    }
+    return count;
+}
+
 }
@@ -21,7 +21,7 @@ namespace gameplay
  * Increment the version number when making a change that break binary compatibility.
  * [0] is major, [1] is minor.
  */
-const unsigned char GPB_VERSION[2] = {1, 5};
+const unsigned char GPB_VERSION[2] = {1, 10};
 
 /**
  * The GamePlay Binary file class handles writing the GamePlay Binary file.
@@ -123,15 +123,29 @@ public:
 private:
 
     /**
-     * Computes the bounds of all meshes in the node hierarchy.
+     * Collects the meshes of the model of a node that are not yet in the lists, the skinned ones separately.
      */
-    void computeBounds(Node* node);
+    static void getMeshes(Node* node, std::vector<Mesh*>* meshes, std::vector<Mesh*>* skinnedMeshes);
+
+    /**
+     * Adds levels of detail, simplified from the mesh of each model that has none, to the models.
+     *
+     * @param count The number of levels of detail to generate for each model.
+     * @param ratio The ratio of the triangles of each level to the triangles of the previous level.
+     * @param maxError The largest error of each level, as a fraction of the radius of the mesh, or zero for no limit.
+     */
+    void generateLods(unsigned int count, float ratio, float maxError);
 
     /**
      * Optimizes animation data by removing unneccessary channels and keyframes.
      */
     void optimizeAnimations();
 
+    /**
+     * Reduces the keyframes of the animation channels within the tolerance and marks them to be written quantized.
+     */
+    void compressAnimations(float tolerance);
+
     /**
      * Decomposes an ANIMATE_SCALE_ROTATE_TRANSLATE channel into 3 new channels. (Scale, Rotate and Translate)
      * 
@@ -149,6 +163,17 @@ private:
      */
     void moveAnimationChannels(Node* node, Animation* animation);
 
+    /**
+     * Rewrites a saved binary file with the sections that compress LZ4 compressed.
+     *
+     * @param filepath The path of the binary file.
+     * @param sectionTable The file position of the entries of the section table.
+     * @param sections The file position and size of each section listed in the section table.
+     *
+     * @return true if the file was rewritten, false if it could not be read or written.
+     */
+    bool compressSections(const std::string& filepath, long sectionTable, const std::vector<std::pair<long, long> >& sections);
+
 private:
 
     FILE* _file;
@@ -1,55 +1,42 @@
 #include "Base.h"
 #include "Heightmap.h"
+#include "BuildCache.h"
 #include "GPBFile.h"
-#include "Thread.h"
+#include "ThreadPool.h"
 
 namespace gameplay
 {
 
-// Number of threads to spawn for the heightmap generator
-#define THREAD_COUNT 8
+// Largest number of cells along each axis of the triangle grid of a mesh
+#define TRIANGLE_GRID_MAX_CELLS 1024
 
-// Thread data structure
-struct HeightmapThreadData
+/**
+ * The triangles of a mesh binned by their extent on the XZ plane, so that a ray cast straight
+ * down only tests the triangles of the cell that it falls in.
+ */
+struct TriangleGrid
 {
-    float rayHeight;                    // [in]
-    const Vector3* rayDirection;        // [in]
-    const std::vector<Mesh*>* meshes;   // [in]
-    const BoundingVolume* bounds;       // [in]
-    float minX;                         // [in]
-    float maxX;                         // [in]
-    float minZ;                         // [in]
-    float maxZ;                         // [in]
-    float stepX;                        // [in]
-    float stepZ;                        // [in]
-    float minHeight;                    // [out]
-    float maxHeight;                    // [out]
-    float* heights;                     // [in][out]
-    int width;                          // [in]
-    int height;                         // [in]
-    int heightIndex;                    // [in]
+    float minX;
+    float minZ;
+    float cellScaleX;
+    float cellScaleZ;
+    int cellsX;
+    int cellsZ;
+    std::vector<float> positions;           // Three positions for each triangle
+    std::vector<unsigned int> cellStarts;   // Index into cellTriangles of each cell, and one past the last cell
+    std::vector<unsigned int> cellTriangles;
 };
 
-// Globals used by thread
-int __processedHeightmapScanLines = 0;
-int __totalHeightmapScanlines = 0;
-int __failedRayCasts = 0;
-
 // Forward declarations
-int generateHeightmapChunk(void* threadData);
+static void buildTriangleGrid(const Mesh* mesh, TriangleGrid* grid);
+static bool intersect(const Vector3& rayOrigin, const Vector3& rayDirection, const TriangleGrid& grid, Vector3* point);
 bool intersect(const Vector3& rayOrigin, const Vector3& rayDirection, const Vector3& boxMin, const Vector3& boxMax, float* distance = NULL);
 int intersect_triangle(const float orig[3], const float dir[3], const float vert0[3], const float vert1[3], const float vert2[3], float *t, float *u, float *v);
-bool intersect(const Vector3& rayOrigin, const Vector3& rayDirection, const std::vector<Vertex>& vertices, const std::vector<MeshPart*>& parts, Vector3* point);
 
 void Heightmap::generate(const std::vector<std::string>& nodeIds, int width, int height, const char* filename, bool highP)
 {
     LOG(1, "Generating heightmap: %s...\n", filename);
 
-    // Initialize state variables
-    __processedHeightmapScanLines = 0;
-    __totalHeightmapScanlines = 0;
-    __failedRayCasts = 0;
-
     GPBFile* gpbFile = GPBFile::getInstance();
 
     // Lookup nodes in GPB file and compute a single bounding volume that encapsulates all meshes
@@ -106,64 +93,85 @@ void Heightmap::generate(const std::vector<std::string>& nodeIds, int width, int
     float minHeight = FLT_MAX;
     float maxHeight = -FLT_MAX;
 
-    __totalHeightmapScanlines = height;
-
-    // Determine # of threads to spawn
-    int threadCount = min(THREAD_COUNT, height);
-
-    // Split the work into separate threads to make max use of available cpu cores and speed up computation.
-    HeightmapThreadData* threadData = new HeightmapThreadData[threadCount];
-    THREAD_HANDLE* threads = new THREAD_HANDLE[threadCount];
-    int stepSize = height / threadCount;
-    for (int i = 0, remaining = height; i < threadCount; ++i, remaining -= stepSize)
+    // Bin the triangles of each mesh, since every ray is cast straight down.
+    std::vector<TriangleGrid> grids(meshes.size());
+    parallelFor((unsigned int)meshes.size(), [&](unsigned int i)
+    {
+        buildTriangleGrid(meshes[i], &grids[i]);
+    });
+
+    // Cast the rays of each scan line on the worker threads, a band of lines at a time to report progress.
+    float stepX = (maxX - minX) / width;
+    float stepZ = (maxZ - minZ) / height;
+    std::vector<float> rowMinHeights(height);
+    std::vector<float> rowMaxHeights(height);
+    std::vector<int> rowFailedRayCasts(height);
+    int bandSize = max(height / 100, 1);
+    for (int band = 0; band < height; band += bandSize)
     {
-        HeightmapThreadData& data = threadData[i];
-        data.rayHeight = rayOrigin.y;
-        data.rayDirection = &rayDirection;
-        data.bounds = &bounds;
-        data.meshes = &meshes;
-        data.minX = minX;
-        data.maxX = maxX;
-        data.minZ = minZ + (stepSize * i);
-        data.maxZ = data.minZ + stepSize - 1;
-        if (i == threadCount - 1)
-            data.maxZ = maxZ;
-        data.stepX = (maxX - minX) / width;
-        data.stepZ = (maxZ - minZ) / height;
-        data.heights = heights;
-        data.width = width;
-        data.height = remaining > stepSize ? stepSize : remaining;
-        data.heightIndex = width * (stepSize * i);
-
-        // Start the processing thread
-        if (!createThread(&threads[i], &generateHeightmapChunk, &data))
+        LOG(1, "\r\t%d%%", (int)(((float)band / height) * 100.0f));
+
+        parallelFor((unsigned int)min(bandSize, height - band), [&](unsigned int bandRow)
         {
-            LOG(1, "ERROR: Failed to spawn worker thread for generation of heightmap: %s\n", filename);
-            return;
-        }
-    }
+            int zi = band + (int)bandRow;
+            Vector3 origin(rayOrigin.x, rayOrigin.y, minZ + zi * stepZ);
+            Vector3 intersectionPoint;
+            float rowMinHeight = FLT_MAX;
+            float rowMaxHeight = -FLT_MAX;
+            int failedRayCasts = 0;
+            for (int xi = 0; xi < width; ++xi)
+            {
+                float h = -FLT_MAX;
+                origin.x = minX + xi * stepX;
+
+                for (unsigned int i = 0, count = meshes.size(); i < count; ++i)
+                {
+                    // Pick the highest intersecting Y value of all meshes
+                    Mesh* mesh = meshes[i];
 
-    // Wait for all threads to terminate
-    waitForThreads(threadCount, threads);
+                    // Perform a quick ray/bounding box test to quick-out
+                    if (!intersect(origin, rayDirection, mesh->bounds.min, mesh->bounds.max))
+                        continue;
 
-    // Close all thread handles and free memory allocations.
-    for (int i = 0; i < threadCount; ++i)
-        closeThread(threads[i]);
+                    // Compute the intersection point of ray with mesh
+                    if (intersect(origin, rayDirection, grids[i], &intersectionPoint) && intersectionPoint.y > h)
+                        h = intersectionPoint.y;
+                }
 
-    // Update min/max height from all completed threads
-    for (int i = 0; i < threadCount; ++i)
+                heights[zi * width + xi] = h;
+                if (h == -FLT_MAX)
+                {
+                    ++failedRayCasts;
+                }
+                else
+                {
+                    if (h < rowMinHeight)
+                        rowMinHeight = h;
+                    if (h > rowMaxHeight)
+                        rowMaxHeight = h;
+                }
+            }
+            rowMinHeights[zi] = rowMinHeight;
+            rowMaxHeights[zi] = rowMaxHeight;
+            rowFailedRayCasts[zi] = failedRayCasts;
+        });
+    }
+
+    int failedRayCasts = 0;
+    for (int i = 0; i < height; ++i)
     {
-        if (threadData[i].minHeight < minHeight)
-            minHeight = threadData[i].minHeight;
-        if (threadData[i].maxHeight > maxHeight)
-            maxHeight = threadData[i].maxHeight;
+        if (rowMinHeights[i] < minHeight)
+            minHeight = rowMinHeights[i];
+        if (rowMaxHeights[i] > maxHeight)
+            maxHeight = rowMaxHeights[i];
+        failedRayCasts += rowFailedRayCasts[i];
     }
 
     LOG(1, "\r\tDone.\n");
 
-    if (__failedRayCasts)
+    if (failedRayCasts)
     {
-        LOG(2, "Warning: %d triangle intersections failed for heightmap: %s\n", __failedRayCasts, filename);
+        LOG(2, "Warning: %d triangle intersections failed for heightmap: %s\n", failedRayCasts, filename);
 
         // Go through and clamp any height values that are set to -FLT_MAX to the min recorded height value
         // (otherwise the range of height values will be far too large).
@@ -181,6 +189,7 @@ void Heightmap::generate(const std::vector<std::string>& nodeIds, int width, int
     png_infop info_ptr = NULL;
     png_bytep row = NULL;
 
+    BuildCache::addOutput(filename);
     FILE* fp = fopen(filename, "wb");
     if (fp == NULL)
     {
@@ -244,10 +253,6 @@ void Heightmap::generate(const std::vector<std::string>& nodeIds, int width, int
     LOG(1, "Saved heightmap: %s\n", filename);
 
 error:
-    if (threadData)
-        delete[] threadData;
-    if (threads)
-        delete[] threads;
     if (heights)
         delete[] heights;
     if (fp)
@@ -260,75 +265,6 @@ error:
         png_destroy_write_struct(&png_ptr, (png_infopp)NULL);
 }
 
-int generateHeightmapChunk(void* threadData)
-{
-    HeightmapThreadData* data = (HeightmapThreadData*)threadData;
-
-    Vector3 rayOrigin(0, data->rayHeight, 0);
-    const Vector3& rayDirection = *data->rayDirection;
-    const std::vector<Mesh*>& meshes = *data->meshes;
-    float* heights = data->heights;
-
-    Vector3 intersectionPoint;
-    float minHeight = FLT_MAX;
-    float maxHeight = -FLT_MAX;
-    int index = data->heightIndex;
-
-    int zi = 0;
-    for (float z = data->minZ; zi < data->height; z += data->stepZ, ++zi)
-    {
-        LOG(1, "\r\t%d%%", (int)(((float)__processedHeightmapScanLines / __totalHeightmapScanlines) * 100.0f));
-
-        rayOrigin.z = z;
-
-        int xi = 0;
-        for (float x = data->minX; xi < data->width; x += data->stepX, ++xi)
-        {
-            float h = -FLT_MAX;
-            rayOrigin.x = x;
-
-            for (unsigned int i = 0, count = meshes.size(); i < count; ++i)
-            {
-                // Pick the highest intersecting Y value of all meshes
-                Mesh* mesh = meshes[i];
-
-                // Perform a quick ray/bounding box test to quick-out
-                if (!intersect(rayOrigin, rayDirection, mesh->bounds.min, mesh->bounds.max))
-                    continue;
-
-                // Compute the intersection point of ray with mesh
-                if (intersect(rayOrigin, rayDirection, mesh->vertices, mesh->parts, &intersectionPoint))
-                {
-                    if (intersectionPoint.y > h)
-                    {
-                        h = intersectionPoint.y;
-
-                        // Update min/max height values
-                        if (h < minHeight)
-                            minHeight = h;
-                        if (h > maxHeight)
-                            maxHeight = h;
-                    }
-                }
-            }
-
-            // Update the glboal height array
-            heights[index++] = h;
-
-            if (h == -FLT_MAX)
-                ++__failedRayCasts;
-        }
-
-        ++__processedHeightmapScanLines;
-    }
-
-    // Update min/max height for this thread data
-    data->minHeight = minHeight;
-    data->maxHeight = maxHeight;
-
-    return 0;
-}
-
 /////////////////////////////////////////////////////////////
 // 
 // Fast, Minimum Storage Ray-Triangle Intersection
@@ -393,55 +329,129 @@ int intersect_triangle(const float orig[3], const float dir[3], const float vert
    return 1;
 }
 
-// Performs an intersection test between a ray and the given mesh part and stores the result in "point".
-bool intersect(const Vector3& rayOrigin, const Vector3& rayDirection, const std::vector<Vertex>& vertices, const std::vector<MeshPart*>& parts, Vector3* point)
+// Bins the triangles of a mesh into a grid of roughly as many cells as triangles.
+static void buildTriangleGrid(const Mesh* mesh, TriangleGrid* grid)
+{
+    const std::vector<Vertex>& vertices = mesh->vertices;
+    std::vector<float>& positions = grid->positions;
+    for (unsigned int i = 0, partCount = mesh->parts.size(); i < partCount; ++i)
+    {
+        MeshPart* part = mesh->parts[i];
+        for (unsigned int j = 0, indexCount = part->getIndicesCount(); j + 2 < indexCount; j += 3)
+        {
+            for (unsigned int k = 0; k < 3; ++k)
+            {
+                const Vector3& position = vertices[part->getIndex(j + k)].position;
+                positions.push_back(position.x);
+                positions.push_back(position.y);
+                positions.push_back(position.z);
+            }
+        }
+    }
+    unsigned int triangleCount = positions.size() / 9;
+
+    float sizeX = max(mesh->bounds.max.x - mesh->bounds.min.x, FLT_EPSILON);
+    float sizeZ = max(mesh->bounds.max.z - mesh->bounds.min.z, FLT_EPSILON);
+    float cellSize = sqrt(sizeX * sizeZ / max(triangleCount, 1u));
+    grid->minX = mesh->bounds.min.x;
+    grid->minZ = mesh->bounds.min.z;
+    grid->cellsX = max(min((int)(sizeX / cellSize), TRIANGLE_GRID_MAX_CELLS), 1);
+    grid->cellsZ = max(min((int)(sizeZ / cellSize), TRIANGLE_GRID_MAX_CELLS), 1);
+    grid->cellScaleX = grid->cellsX / sizeX;
+    grid->cellScaleZ = grid->cellsZ / sizeZ;
+
+    // Count the triangles of each cell, then fill them in, so that the cells are stored back to back.
+    std::vector<int> ranges(triangleCount * 4);
+    grid->cellStarts.assign(grid->cellsX * grid->cellsZ + 1, 0);
+    for (unsigned int pass = 0; pass < 2; ++pass)
+    {
+        for (unsigned int i = 0; i < triangleCount; ++i)
+        {
+            int* range = &ranges[i * 4];
+            if (pass == 0)
+            {
+                const float* v = &positions[i * 9];
+                float xmin = min(min(v[0], v[3]), v[6]);
+                float xmax = max(max(v[0], v[3]), v[6]);
+                float zmin = min(min(v[2], v[5]), v[8]);
+                float zmax = max(max(v[2], v[5]), v[8]);
+                range[0] = max(min((int)((xmin - grid->minX) * grid->cellScaleX), grid->cellsX - 1), 0);
+                range[1] = max(min((int)((xmax - grid->minX) * grid->cellScaleX), grid->cellsX - 1), 0);
+                range[2] = max(min((int)((zmin - grid->minZ) * grid->cellScaleZ), grid->cellsZ - 1), 0);
+                range[3] = max(min((int)((zmax - grid->minZ) * grid->cellScaleZ), grid->cellsZ - 1), 0);
+            }
+            for (int z = range[2]; z <= range[3]; ++z)
+            {
+                for (int x = range[0]; x <= range[1]; ++x)
+                {
+                    if (pass == 0)
+                        ++grid->cellStarts[z * grid->cellsX + x + 1];
+                    else
+                        grid->cellTriangles[grid->cellStarts[z * grid->cellsX + x]++] = i;
+                }
+            }
+        }
+        if (pass == 0)
+        {
+            for (size_t i = 1, count = grid->cellStarts.size(); i < count; ++i)
+                grid->cellStarts[i] += grid->cellStarts[i - 1];
+            grid->cellTriangles.resize(grid->cellStarts.back());
+        }
+        else
+        {
+            // Filling the cells moved each start to the start of the next cell.
+            for (size_t i = grid->cellStarts.size() - 1; i > 0; --i)
+                grid->cellStarts[i] = grid->cellStarts[i - 1];
+            grid->cellStarts[0] = 0;
+        }
+    }
+}
+
+// Performs an intersection test between a vertical ray and the triangles of a mesh and stores the result in "point".
+static bool intersect(const Vector3& rayOrigin, const Vector3& rayDirection, const TriangleGrid& grid, Vector3* point)
 {
     const float* orig = &rayOrigin.x;
     const float* dir = &rayDirection.x;
 
+    int cellX = (int)((orig[0] - grid.minX) * grid.cellScaleX);
+    int cellZ = (int)((orig[2] - grid.minZ) * grid.cellScaleZ);
+    cellX = max(min(cellX, grid.cellsX - 1), 0);
+    cellZ = max(min(cellZ, grid.cellsZ - 1), 0);
+    unsigned int cell = cellZ * grid.cellsX + cellX;
+
     float minT = FLT_MAX;
 
-    for (unsigned int i = 0, partCount = parts.size(); i < partCount; ++i)
+    for (unsigned int i = grid.cellStarts[cell], end = grid.cellStarts[cell + 1]; i < end; ++i)
     {
-        MeshPart* part = parts[i];
-
-        for (unsigned int j = 0, indexCount = part->getIndicesCount(); j < indexCount; j += 3)
+        const float* v0 = &grid.positions[grid.cellTriangles[i] * 9];
+        const float* v1 = v0 + 3;
+        const float* v2 = v0 + 6;
+
+        // Perform a quick check (in 2D) to determine if the point is definitely NOT in the triangle
+        float xmin, xmax, zmin, zmax;
+        xmin = v0[0] < v1[0] ? v0[0] : v1[0]; xmin = xmin < v2[0] ? xmin : v2[0];
+        xmax = v0[0] > v1[0] ? v0[0] : v1[0]; xmax = xmax > v2[0] ? xmax : v2[0];
+        zmin = v0[2] < v1[2] ? v0[2] : v1[2]; zmin = zmin < v2[2] ? zmin : v2[2];
+        zmax = v0[2] > v1[2] ? v0[2] : v1[2]; zmax = zmax > v2[2] ? zmax : v2[2];
+        if (orig[0] < xmin || orig[0] > xmax || orig[2] < zmin || orig[2] > zmax)
+            continue;
+
+        // Perform a full ray/traingle intersection test in 3D to get the intersection point
+        float t, u, v;
+        if (intersect_triangle(orig, dir, v0, v1, v2, &t, &u, &v) && t < minT)
         {
-            const float* v0 = &vertices[part->getIndex( j )].position.x;
-            const float* v1 = &vertices[part->getIndex(j+1)].position.x;
-            const float* v2 = &vertices[part->getIndex(j+2)].position.x;
-
-            // Perform a quick check (in 2D) to determine if the point is definitely NOT in the triangle
-            float xmin, xmax, zmin, zmax;
-            xmin = v0[0] < v1[0] ? v0[0] : v1[0]; xmin = xmin < v2[0] ? xmin : v2[0];
-            xmax = v0[0] > v1[0] ? v0[0] : v1[0]; xmax = xmax > v2[0] ? xmax : v2[0];
-            zmin = v0[2] < v1[2] ? v0[2] : v1[2]; zmin = zmin < v2[2] ? zmin : v2[2];
-            zmax = v0[2] > v1[2] ? v0[2] : v1[2]; zmax = zmax > v2[2] ? zmax : v2[2];
-            if (orig[0] < xmin || orig[0] > xmax || orig[2] < zmin || orig[2] > zmax)
-                continue;
-
-            // Perform a full ray/traingle intersection test in 3D to get the intersection point
-            float t, u, v;
-            if (intersect_triangle(orig, dir, v0, v1, v2, &t, &u, &v))
+            minT = t;
+
+            if (point)
             {
-                // Found an intersection!
-                if (t < minT)
-                {
-                    minT = t;
-
-                    if (point)
-                    {
-                        Vector3 rd(rayDirection);
-                        rd.scale(t);
-                        Vector3::add(rayOrigin, rd, point);
-                    }
-                }
-                //return true;
+                Vector3 rd(rayDirection);
+                rd.scale(t);
+                Vector3::add(rayOrigin, rd, point);
             }
         }
     }
 
-    return (minT != FLT_MAX);//false;
+    return (minT != FLT_MAX);
 }
 
 // Ray/Box intersection test.
@@ -1,5 +1,6 @@
 #include "Image.h"
 #include "Base.h"
+#include "BuildCache.h"
 
 namespace gameplay
 {
@@ -16,6 +17,8 @@ Image::~Image()
 
 Image* Image::create(const char* path)
 {
+    BuildCache::addDependency(path);
+
     // Open the file.
     FILE* fp = fopen(path, "rb");
     if (fp == NULL)
@@ -206,6 +209,8 @@ void Image::save(const char* path)
     unsigned int stride;
     int index;
 
+    BuildCache::addOutput(path);
+
     FILE* fp = fopen(path, "wb");
     if (fp == NULL)
     {
@@ -0,0 +1,54 @@
+#include <lua/lua.hpp>
+
+#include "LuaEncoder.h"
+
+using namespace gameplay;
+
+LuaEncoder::LuaEncoder()
+{
+}
+
+LuaEncoder::~LuaEncoder()
+{
+}
+
+bool LuaEncoder::write(const EncoderArguments& arguments)
+{
+    lua_State* state = luaL_newstate();
+    if (!state)
+    {
+        LOG(1, "Error: Failed to create a Lua state.\n");
+        return false;
+    }
+
+    // Compile the script without running it.
+    if (luaL_loadfile(state, arguments.getFilePath().c_str()) != LUA_OK)
+    {
+        LOG(1, "Error: Failed to compile Lua script: %s\n", lua_tostring(state, -1));
+        lua_close(state);
+        return false;
+    }
+
+    std::string outputFilePath = arguments.getOutputFilePath();
+    FILE* file = fopen(outputFilePath.c_str(), "wb");
+    if (!file)
+    {
+        LOG(1, "Error: Failed to open file: %s\n", outputFilePath.c_str());
+        lua_close(state);
+        return false;
+    }
+
+    LOG(2, "Writing precompiled Lua script: %s\n", outputFilePath.c_str());
+    bool success = lua_dump(state, writeChunk, file) == 0;
+    if (!success)
+        LOG(1, "Error: Failed to write file: %s\n", outputFilePath.c_str());
+
+    fclose(file);
+    lua_close(state);
+    return success;
+}
+
+int LuaEncoder::writeChunk(lua_State* state, const void* data, size_t size, void* userData)
+{
+    return fwrite(data, 1, size, (FILE*)userData) == size ? 0 : 1;
+}
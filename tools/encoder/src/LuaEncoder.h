@@ -0,0 +1,46 @@
+#ifndef LUAENCODER_H_
+#define LUAENCODER_H_
+
+#include "Base.h"
+#include "EncoderArguments.h"
+
+struct lua_State;
+
+/**
+ * Class for compiling a Lua script into a precompiled bytecode chunk.
+ *
+ * The engine loads the chunk in place of the script source it was compiled from
+ * (script.luac next to script.lua), which skips parsing and compiling the script
+ * on the device. Bytecode depends on the Lua version and on the sizes and byte
+ * order of the target's types, so scripts must be compiled for each target
+ * architecture; the engine falls back to the source if the chunk doesn't match.
+ */
+class LuaEncoder
+{
+public:
+
+    /**
+     * Constructor.
+     */
+    LuaEncoder();
+
+    /**
+     * Destructor.
+     */
+    ~LuaEncoder();
+
+    /**
+     * Compiles the Lua script and writes out its bytecode.
+     *
+     * @param arguments The encoder arguments.
+     *
+     * @return True if the script was compiled and written, false otherwise.
+     */
+    bool write(const gameplay::EncoderArguments& arguments);
+
+private:
+
+    static int writeChunk(lua_State* state, const void* data, size_t size, void* userData);
+};
+
+#endif
@@ -44,14 +44,23 @@ void Mesh::writeBinaryVertices(FILE* file)
     {
         // Assumes that all vertices are the same size.
         // Write the number of bytes for the vertex data
-        const Vertex& vertex = vertices.front();
-        write((unsigned int)(vertices.size() * vertex.byteSize()), file); // (vertex count) * (vertex size)
+        unsigned int vertexSize = 0;
+        for (std::vector<VertexElement>::const_iterator i = _vertexFormat.begin(); i != _vertexFormat.end(); ++i)
+        {
+            vertexSize += i->byteSize();
+        }
+        write((unsigned int)(vertices.size() * vertexSize), file); // (vertex count) * (vertex size)
 
-        // for each vertex
+        // for each vertex, write the values of each element in the type of the element
+        float values[4];
         for (std::vector<Vertex>::const_iterator i = vertices.begin(); i != vertices.end(); ++i)
         {
-            // Write this vertex
-            i->writeBinary(file);
+            for (std::vector<VertexElement>::const_iterator j = _vertexFormat.begin(); j != _vertexFormat.end(); ++j)
+            {
+                memset(values, 0, sizeof(values));
+                i->getValues(j->usage, values);
+                j->writeBinaryValues(values, file);
+            }
         }
     }
     else
@@ -230,4 +239,94 @@ void Mesh::computeBounds()
     bounds.radius = sqrt(bounds.radius);
 }
 
+void Mesh::packVertexFormat()
+{
+    if (vertices.empty())
+        return;
+
+    float values[4];
+    for (std::vector<VertexElement>::iterator i = _vertexFormat.begin(); i != _vertexFormat.end(); ++i)
+    {
+        VertexElement& element = *i;
+        if (element.type != VERTEX_FLOAT)
+            continue;
+
+        // Find the range of the values of the element, which decides the types that can hold them.
+        float minValue = FLT_MAX;
+        float maxValue = -FLT_MAX;
+        for (std::vector<Vertex>::const_iterator j = vertices.begin(); j != vertices.end(); ++j)
+        {
+            memset(values, 0, sizeof(values));
+            j->getValues(element.usage, values);
+            for (unsigned int k = 0; k < element.size && k < 4; ++k)
+            {
+                minValue = std::min(minValue, values[k]);
+                maxValue = std::max(maxValue, values[k]);
+            }
+        }
+
+        switch (element.usage)
+        {
+        case NORMAL:
+        case TANGENT:
+        case BINORMAL:
+            // 10-10-10-2 elements always have 4 values, and the W of zero is ignored by shaders that read 3.
+            if (minValue >= -1.0f && maxValue <= 1.0f)
+                element = VertexElement(element.usage, 4, VERTEX_INT_2_10_10_10_REV, true);
+            break;
+        case COLOR:
+            if (minValue >= 0.0f && maxValue <= 1.0f)
+                element = VertexElement(element.usage, element.size, VERTEX_UNSIGNED_BYTE, true);
+            else
+                element = VertexElement(element.usage, element.size, VERTEX_HALF_FLOAT, false);
+            break;
+        case BLENDWEIGHTS:
+            if (minValue >= 0.0f && maxValue <= 1.0f)
+            {
+                element = VertexElement(element.usage, element.size, VERTEX_UNSIGNED_BYTE, true);
+
+                // Round the weights of each vertex so that the bytes still add up to the same total,
+                // giving the remainder to the largest weight.
+                for (std::vector<Vertex>::iterator j = vertices.begin(); j != vertices.end(); ++j)
+                {
+                    float* weights = &j->blendWeights.x;
+                    int total = (int)floorf((weights[0] + weights[1] + weights[2] + weights[3]) * 255.0f + 0.5f);
+                    int sum = 0;
+                    int largest = 0;
+                    int quantized[4];
+                    for (int k = 0; k < 4; ++k)
+                    {
+                        quantized[k] = (int)floorf(weights[k] * 255.0f + 0.5f);
+                        sum += quantized[k];
+                        if (weights[k] > weights[largest])
+                            largest = k;
+                    }
+                    quantized[largest] = std::min(std::max(quantized[largest] + total - sum, 0), 255);
+                    for (int k = 0; k < 4; ++k)
+                    {
+                        weights[k] = quantized[k] / 255.0f;
+                    }
+                }
+            }
+            break;
+        case BLENDINDICES:
+            if (minValue >= 0.0f && maxValue < 256.0f)
+                element = VertexElement(element.usage, element.size, VERTEX_UNSIGNED_BYTE, false);
+            else if (minValue >= 0.0f && maxValue < 65536.0f)
+                element = VertexElement(element.usage, element.size, VERTEX_UNSIGNED_SHORT, false);
+            break;
+        default:
+            if (element.usage >= TEXCOORD0 && element.usage <= TEXCOORD7)
+            {
+                // Texture coordinates that repeat beyond [-1, 1] would lose too much precision as half floats.
+                if (minValue >= 0.0f && maxValue <= 1.0f)
+                    element = VertexElement(element.usage, element.size, VERTEX_UNSIGNED_SHORT, true);
+                else if (minValue >= -1.0f && maxValue <= 1.0f)
+                    element = VertexElement(element.usage, element.size, VERTEX_SHORT, true);
+            }
+            break;
+        }
+    }
+}
+
 }
@@ -65,6 +65,15 @@ public:
 
     void computeBounds();
 
+    /**
+     * Packs the vertex elements into smaller types where the values of the vertices allow,
+     * which are written in place of floats: normals, tangents and binormals as 10-10-10-2
+     * normalized integers, texture coordinates as normalized shorts, colors as normalized
+     * bytes (or half floats for values beyond 1), blend weights as normalized bytes and
+     * blend indices as bytes. Positions stay floats.
+     */
+    void packVertexFormat();
+
     Model* model;
     std::vector<Vertex> vertices;
     std::vector<MeshPart*> parts;
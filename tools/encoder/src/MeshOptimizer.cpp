@@ -0,0 +1,370 @@
+#include "Base.h"
+#include "MeshOptimizer.h"
+#include <limits>
+
+namespace gameplay
+{
+
+// Number of vertices of the simulated post-transform vertex cache.
+#define VERTEX_CACHE_SIZE 32
+
+// Score of the vertices of the last triangle added, which are kept below the score of the next
+// most recent vertices so that the following triangle is not always a neighbour of the last one.
+#define VERTEX_CACHE_LAST_TRIANGLE_SCORE 0.75f
+
+// Power of the decay of the score of a vertex as it moves back in the cache.
+#define VERTEX_CACHE_DECAY_POWER 1.5f
+
+// Scale and power of the boost of the vertices with few triangles left, so that they are finished off.
+#define VERTEX_VALENCE_BOOST_SCALE 2.0f
+#define VERTEX_VALENCE_BOOST_POWER 0.5f
+
+/**
+ * Gets the score of a vertex from its position in the cache (or -1 if it is not in the cache)
+ * and the number of triangles that have yet to be added that use it.
+ */
+static float getVertexScore(int cachePosition, unsigned int remainingTriangles)
+{
+    if (remainingTriangles == 0)
+        return -1.0f;
+
+    float score = 0.0f;
+    if (cachePosition >= 0)
+    {
+        if (cachePosition < 3)
+            score = VERTEX_CACHE_LAST_TRIANGLE_SCORE;
+        else
+            score = powf(1.0f - (float)(cachePosition - 3) / (VERTEX_CACHE_SIZE - 3), VERTEX_CACHE_DECAY_POWER);
+    }
+    return score + VERTEX_VALENCE_BOOST_SCALE * powf((float)remainingTriangles, -VERTEX_VALENCE_BOOST_POWER);
+}
+
+/**
+ * Reorders a triangle list for the post-transform vertex cache.
+ *
+ * The vertices are scored by their position in a simulated LRU cache and by the number of their
+ * triangles that are left, and the triangle with the highest score is added next. Only the
+ * triangles of the vertices in the cache are rescored after each triangle, so this is linear.
+ */
+static void optimizeVertexCache(std::vector<unsigned int>& indices, unsigned int vertexCount)
+{
+    unsigned int triangleCount = (unsigned int)(indices.size() / 3);
+
+    // Find the triangles of each vertex.
+    std::vector<unsigned int> remaining(vertexCount, 0);
+    for (size_t i = 0, count = indices.size(); i < count; ++i)
+    {
+        remaining[indices[i]]++;
+    }
+    std::vector<unsigned int> offsets(vertexCount + 1, 0);
+    for (unsigned int v = 0; v < vertexCount; ++v)
+    {
+        offsets[v + 1] = offsets[v] + remaining[v];
+    }
+    std::vector<unsigned int> adjacency(indices.size());
+    std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+    for (unsigned int t = 0; t < triangleCount; ++t)
+    {
+        for (unsigned int k = 0; k < 3; ++k)
+        {
+            adjacency[fill[indices[t * 3 + k]]++] = t;
+        }
+    }
+
+    std::vector<float> vertexScores(vertexCount);
+    for (unsigned int v = 0; v < vertexCount; ++v)
+    {
+        vertexScores[v] = getVertexScore(-1, remaining[v]);
+    }
+    std::vector<float> triangleScores(triangleCount);
+    int best = -1;
+    for (unsigned int t = 0; t < triangleCount; ++t)
+    {
+        triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+        if (best < 0 || triangleScores[t] > triangleScores[best])
+            best = (int)t;
+    }
+
+    std::vector<bool> added(triangleCount, false);
+    std::vector<unsigned int> result;
+    result.reserve(indices.size());
+    std::vector<unsigned int> cache;
+    std::vector<unsigned int> newCache;
+    unsigned int cursor = 0;
+    while (best >= 0)
+    {
+        added[best] = true;
+
+        // Remove the triangle from its vertices and move them to the front of the cache.
+        newCache.clear();
+        for (unsigned int k = 0; k < 3; ++k)
+        {
+            unsigned int v = indices[best * 3 + k];
+            result.push_back(v);
+            unsigned int* triangles = &adjacency[offsets[v]];
+            for (unsigned int j = 0; j < remaining[v]; ++j)
+            {
+                if (triangles[j] == (unsigned int)best)
+                {
+                    triangles[j] = triangles[remaining[v] - 1];
+                    break;
+                }
+            }
+            remaining[v]--;
+            if (std::find(newCache.begin(), newCache.end(), v) == newCache.end())
+                newCache.push_back(v);
+        }
+        size_t front = newCache.size();
+        for (size_t i = 0, count = cache.size(); i < count; ++i)
+        {
+            if (std::find(newCache.begin(), newCache.begin() + front, cache[i]) == newCache.begin() + front)
+                newCache.push_back(cache[i]);
+        }
+
+        // Rescore the vertices that were pushed out of the cache and the ones in it, along with their triangles.
+        for (size_t i = 0, count = newCache.size(); i < count; ++i)
+        {
+            unsigned int v = newCache[i];
+            int position = i < VERTEX_CACHE_SIZE ? (int)i : -1;
+            float score = getVertexScore(position, remaining[v]);
+            float delta = score - vertexScores[v];
+            vertexScores[v] = score;
+            for (unsigned int j = offsets[v], end = offsets[v] + remaining[v]; j < end; ++j)
+            {
+                triangleScores[adjacency[j]] += delta;
+            }
+        }
+        if (newCache.size() > VERTEX_CACHE_SIZE)
+            newCache.resize(VERTEX_CACHE_SIZE);
+        cache.swap(newCache);
+
+        // Add the best triangle of the vertices in the cache next.
+        best = -1;
+        for (size_t i = 0, count = cache.size(); i < count; ++i)
+        {
+            unsigned int v = cache[i];
+            for (unsigned int j = offsets[v], end = offsets[v] + remaining[v]; j < end; ++j)
+            {
+                unsigned int t = adjacency[j];
+                if (best < 0 || triangleScores[t] > triangleScores[best])
+                    best = (int)t;
+            }
+        }
+
+        // Otherwise continue with the next triangle that has yet to be added.
+        if (best < 0)
+        {
+            while (cursor < triangleCount && added[cursor])
+                ++cursor;
+            if (cursor < triangleCount)
+                best = (int)cursor;
+        }
+    }
+    indices.swap(result);
+}
+
+/**
+ * Reorders the clusters of a triangle list that was ordered for the vertex cache to reduce overdraw.
+ *
+ * A cluster ends where a triangle misses the cache for all three of its vertices, so moving the
+ * clusters around keeps the vertex cache order within them. The clusters are then sorted by how far
+ * they face away from the center of the triangles, since the outermost surfaces are the ones that
+ * occlude the others from most points of view.
+ */
+static void optimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<Vector3>& positions)
+{
+    unsigned int triangleCount = (unsigned int)(indices.size() / 3);
+
+    // Find the clusters by simulating a FIFO cache.
+    std::vector<unsigned int> clusters;
+    std::vector<unsigned int> timestamps(positions.size(), 0);
+    unsigned int time = VERTEX_CACHE_SIZE + 1;
+    for (unsigned int t = 0; t < triangleCount; ++t)
+    {
+        unsigned int misses = 0;
+        for (unsigned int k = 0; k < 3; ++k)
+        {
+            unsigned int v = indices[t * 3 + k];
+            if (time - timestamps[v] > VERTEX_CACHE_SIZE)
+            {
+                timestamps[v] = time++;
+                ++misses;
+            }
+        }
+        if (t == 0 || misses == 3)
+            clusters.push_back(t);
+    }
+    if (clusters.size() < 2)
+        return;
+    clusters.push_back(triangleCount);
+
+    // Find the center and the area weighted normal of each cluster, and the center of all of them.
+    unsigned int clusterCount = (unsigned int)clusters.size() - 1;
+    std::vector<Vector3> centers(clusterCount);
+    std::vector<Vector3> normals(clusterCount);
+    Vector3 meshCenter;
+    float meshArea = 0.0f;
+    for (unsigned int c = 0; c < clusterCount; ++c)
+    {
+        Vector3 center;
+        Vector3 normal;
+        float area = 0.0f;
+        for (unsigned int t = clusters[c]; t < clusters[c + 1]; ++t)
+        {
+            const Vector3& p0 = positions[indices[t * 3]];
+            const Vector3& p1 = positions[indices[t * 3 + 1]];
+            const Vector3& p2 = positions[indices[t * 3 + 2]];
+            Vector3 n;
+            Vector3::cross(Vector3(p1.x - p0.x, p1.y - p0.y, p1.z - p0.z), Vector3(p2.x - p0.x, p2.y - p0.y, p2.z - p0.z), &n);
+            float triangleArea = n.length();
+            normal.set(normal.x + n.x, normal.y + n.y, normal.z + n.z);
+            center.set(center.x + (p0.x + p1.x + p2.x) * triangleArea,
+                       center.y + (p0.y + p1.y + p2.y) * triangleArea,
+                       center.z + (p0.z + p1.z + p2.z) * triangleArea);
+            area += triangleArea;
+        }
+        meshCenter.set(meshCenter.x + center.x, meshCenter.y + center.y, meshCenter.z + center.z);
+        meshArea += area;
+        float scale = area > 0.0f ? 1.0f / (area * 3.0f) : 0.0f;
+        centers[c].set(center.x * scale, center.y * scale, center.z * scale);
+        normal.normalize(&normals[c]);
+    }
+    float scale = meshArea > 0.0f ? 1.0f / (meshArea * 3.0f) : 0.0f;
+    meshCenter.set(meshCenter.x * scale, meshCenter.y * scale, meshCenter.z * scale);
+
+    std::vector<float> sortKeys(clusterCount);
+    std::vector<unsigned int> order(clusterCount);
+    for (unsigned int c = 0; c < clusterCount; ++c)
+    {
+        Vector3 offset(centers[c].x - meshCenter.x, centers[c].y - meshCenter.y, centers[c].z - meshCenter.z);
+        sortKeys[c] = Vector3::dot(offset, normals[c]);
+        order[c] = c;
+    }
+    std::stable_sort(order.begin(), order.end(), [&sortKeys](unsigned int a, unsigned int b) { return sortKeys[a] > sortKeys[b]; });
+
+    std::vector<unsigned int> result;
+    result.reserve(indices.size());
+    for (unsigned int i = 0; i < clusterCount; ++i)
+    {
+        unsigned int c = order[i];
+        result.insert(result.end(), indices.begin() + clusters[c] * 3, indices.begin() + clusters[c + 1] * 3);
+    }
+    indices.swap(result);
+}
+
+/**
+ * Reorders the vertices of a mesh by the first use of their index in its parts.
+ */
+static void optimizeVertexFetch(Mesh* mesh)
+{
+    const unsigned int unused = std::numeric_limits<unsigned int>::max();
+    size_t vertexCount = mesh->vertices.size();
+    std::vector<unsigned int> remap(vertexCount, unused);
+    std::vector<Vertex> vertices;
+    vertices.reserve(vertexCount);
+    for (size_t i = 0, count = mesh->parts.size(); i < count; ++i)
+    {
+        MeshPart* part = mesh->parts[i];
+        for (unsigned int j = 0, indexCount = (unsigned int)part->getIndicesCount(); j < indexCount; ++j)
+        {
+            unsigned int index = part->getIndex(j);
+            if (index < vertexCount && remap[index] == unused)
+            {
+                remap[index] = (unsigned int)vertices.size();
+                vertices.push_back(mesh->vertices[index]);
+            }
+        }
+    }
+
+    // Keep the vertices that no part uses after the others.
+    for (size_t i = 0; i < vertexCount; ++i)
+    {
+        if (remap[i] == unused)
+        {
+            remap[i] = (unsigned int)vertices.size();
+            vertices.push_back(mesh->vertices[i]);
+        }
+    }
+
+    std::vector<unsigned int> indices;
+    for (size_t i = 0, count = mesh->parts.size(); i < count; ++i)
+    {
+        MeshPart* part = mesh->parts[i];
+        indices.resize(part->getIndicesCount());
+        for (unsigned int j = 0, indexCount = (unsigned int)indices.size(); j < indexCount; ++j)
+        {
+            unsigned int index = part->getIndex(j);
+            indices[j] = index < vertexCount ? remap[index] : index;
+        }
+        part->setIndices(indices);
+    }
+
+    mesh->vertices.swap(vertices);
+    mesh->vertexLookupTable.clear();
+    for (size_t i = 0, count = mesh->vertices.size(); i < count; ++i)
+    {
+        mesh->vertexLookupTable.insert(std::make_pair(mesh->vertices[i], (unsigned int)i));
+    }
+}
+
+void MeshOptimizer::optimize(Mesh* mesh)
+{
+    assert(mesh);
+
+    size_t vertexCount = mesh->vertices.size();
+    std::vector<unsigned int> remap(vertexCount, 0);
+    std::vector<unsigned int> partVertices;
+    std::vector<Vector3> positions;
+    std::vector<unsigned int> indices;
+    for (size_t i = 0, count = mesh->parts.size(); i < count; ++i)
+    {
+        MeshPart* part = mesh->parts[i];
+        unsigned int indexCount = (unsigned int)part->getIndicesCount();
+        if (part->getPrimitiveType() != MeshPart::TRIANGLES || indexCount < 6 || indexCount % 3 != 0)
+            continue;
+
+        // Number the vertices that the part uses from zero so that the working data is sized by the part.
+        partVertices.clear();
+        positions.clear();
+        indices.resize(indexCount);
+        bool valid = true;
+        for (unsigned int j = 0; j < indexCount && valid; ++j)
+        {
+            unsigned int index = part->getIndex(j);
+            if (index >= vertexCount)
+            {
+                valid = false;
+                break;
+            }
+            if (remap[index] == 0)
+            {
+                partVertices.push_back(index);
+                positions.push_back(mesh->vertices[index].position);
+                remap[index] = (unsigned int)partVertices.size();
+            }
+            indices[j] = remap[index] - 1;
+        }
+        for (size_t j = 0, partVertexCount = partVertices.size(); j < partVertexCount; ++j)
+        {
+            remap[partVertices[j]] = 0;
+        }
+        if (!valid)
+        {
+            LOG(1, "Warning: Mesh '%s' has indices beyond its vertices and was not optimized.\n", mesh->getId().c_str());
+            return;
+        }
+
+        optimizeVertexCache(indices, (unsigned int)partVertices.size());
+        optimizeOverdraw(indices, positions);
+
+        for (unsigned int j = 0; j < indexCount; ++j)
+        {
+            indices[j] = partVertices[indices[j]];
+        }
+        part->setIndices(indices);
+    }
+
+    optimizeVertexFetch(mesh);
+}
+
+}
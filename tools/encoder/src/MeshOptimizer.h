@@ -0,0 +1,34 @@
+#ifndef MESHOPTIMIZER_H_
+#define MESHOPTIMIZER_H_
+
+#include "Mesh.h"
+
+namespace gameplay
+{
+
+/**
+ * Reorders the triangles and vertices of meshes so that the GPU draws them faster.
+ *
+ * The triangles of each triangle list are reordered for the post-transform vertex cache
+ * with Tom Forsyth's linear-speed algorithm, then the runs of triangles that the cache
+ * order separates are sorted so that the ones facing away from the center of the part,
+ * which are the most likely to occlude the rest, are drawn first to reduce overdraw.
+ * Finally the vertices are reordered by the first use of their index so that they are
+ * fetched from memory in order. What is drawn is the same, only the order changes.
+ */
+class MeshOptimizer
+{
+public:
+
+    /**
+     * Optimizes the triangle lists and the vertices of the given mesh.
+     *
+     * @param mesh The mesh to optimize.
+     */
+    static void optimize(Mesh* mesh);
+
+};
+
+}
+
+#endif
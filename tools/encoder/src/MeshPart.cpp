@@ -86,6 +86,22 @@ unsigned int MeshPart::getIndex(unsigned int i) const
     return _indices[i];
 }
 
+unsigned int MeshPart::getPrimitiveType() const
+{
+    return _primitiveType;
+}
+
+void MeshPart::setIndices(const std::vector<unsigned int>& indices)
+{
+    _indexFormat = INDEX16;
+    _indices.clear();
+    _indices.reserve(indices.size());
+    for (size_t i = 0, count = indices.size(); i < count; ++i)
+    {
+        addIndex(indices[i]);
+    }
+}
+
 void MeshPart::writeBinaryIndex(unsigned int index, FILE* file)
 {
     switch (_indexFormat)
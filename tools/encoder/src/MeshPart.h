@@ -62,6 +62,16 @@ public:
      */
     unsigned int getIndex(unsigned int i) const;
 
+    /**
+     * Returns the primitive type of the indices.
+     */
+    unsigned int getPrimitiveType() const;
+
+    /**
+     * Replaces the list of indices, such as with the same primitives in another order.
+     */
+    void setIndices(const std::vector<unsigned int>& indices);
+
 private:
 
     /**
@@ -0,0 +1,479 @@
+#include "Base.h"
+#include "MeshSimplifier.h"
+#include <limits>
+#include <unordered_set>
+
+namespace gameplay
+{
+
+// The kinds of vertices, which decide the edges that a vertex can be collapsed along.
+enum VertexKind
+{
+    VERTEX_MANIFOLD,    // Inside the surface, with a single set of attributes
+    VERTEX_BORDER,      // On an open border of the surface
+    VERTEX_SEAM,        // On a seam between two sets of attributes
+    VERTEX_LOCKED       // On a corner of a border or seam, or shared by several parts
+};
+
+// Marks a vertex without a border or seam edge, or a collapse without a second vertex to move.
+#define NO_VERTEX 0xFFFFFFFF
+
+/**
+ * The sum of the squared distances to a set of planes, as a symmetric 4x4 matrix.
+ */
+struct Quadric
+{
+    Quadric()
+    {
+        memset(a, 0, sizeof(a));
+    }
+
+    void addPlane(float nx, float ny, float nz, float d)
+    {
+        a[0] += nx * nx; a[1] += nx * ny; a[2] += nx * nz; a[3] += nx * d;
+        a[4] += ny * ny; a[5] += ny * nz; a[6] += ny * d;
+        a[7] += nz * nz; a[8] += nz * d;
+        a[9] += d * d;
+    }
+
+    void add(const Quadric& q)
+    {
+        for (int i = 0; i < 10; ++i)
+            a[i] += q.a[i];
+    }
+
+    double evaluate(const Vector3& p) const
+    {
+        double x = p.x, y = p.y, z = p.z;
+        return a[0] * x * x + 2.0 * a[1] * x * y + 2.0 * a[2] * x * z + 2.0 * a[3] * x +
+               a[4] * y * y + 2.0 * a[5] * y * z + 2.0 * a[6] * y +
+               a[7] * z * z + 2.0 * a[8] * z +
+               a[9];
+    }
+
+    double a[10];
+};
+
+/**
+ * A candidate edge collapse, which moves a vertex (and the other vertex at its position on a seam) onto another.
+ */
+struct Collapse
+{
+    unsigned int from;
+    unsigned int to;
+    unsigned int seamFrom;
+    unsigned int seamTo;
+    double cost;
+};
+
+static unsigned long long getEdgeKey(unsigned int a, unsigned int b)
+{
+    return ((unsigned long long)a << 32) | b;
+}
+
+static void getNormal(const Vector3& p0, const Vector3& p1, const Vector3& p2, Vector3* normal)
+{
+    Vector3::cross(Vector3(p1.x - p0.x, p1.y - p0.y, p1.z - p0.z), Vector3(p2.x - p0.x, p2.y - p0.y, p2.z - p0.z), normal);
+}
+
+Mesh* MeshSimplifier::simplify(const Mesh* mesh, float ratio, float maxError)
+{
+    assert(mesh);
+
+    const std::vector<Vertex>& vertices = mesh->vertices;
+    unsigned int vertexCount = (unsigned int)vertices.size();
+    unsigned int partCount = (unsigned int)mesh->parts.size();
+
+    // Gather the triangles of every part.
+    std::vector<unsigned int> indices;
+    std::vector<unsigned int> triangleParts;
+    for (unsigned int p = 0; p < partCount; ++p)
+    {
+        const MeshPart* part = mesh->parts[p];
+        if (part->getPrimitiveType() != MeshPart::TRIANGLES)
+            return NULL;
+        unsigned int indexCount = (unsigned int)part->getIndicesCount() / 3 * 3;
+        for (unsigned int i = 0; i < indexCount; ++i)
+        {
+            unsigned int index = part->getIndex(i);
+            if (index >= vertexCount)
+                return NULL;
+            indices.push_back(index);
+        }
+        triangleParts.insert(triangleParts.end(), indexCount / 3, p);
+    }
+    unsigned int triangleCount = (unsigned int)triangleParts.size();
+    unsigned int targetCount = (unsigned int)(triangleCount * std::min(std::max(ratio, 0.0f), 1.0f));
+    if (triangleCount == 0 || targetCount >= triangleCount)
+        return NULL;
+    const unsigned int originalCount = triangleCount;
+
+    // Find the vertices at the same position. The first vertex at each position is the one that represents the position,
+    // and the others are linked in a ring of wedges.
+    std::vector<unsigned int> positions(vertexCount);
+    std::vector<unsigned int> wedges(vertexCount);
+    std::map<Vector3, unsigned int> positionMap;
+    Vector3 minPosition(FLT_MAX, FLT_MAX, FLT_MAX);
+    Vector3 maxPosition(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (unsigned int v = 0; v < vertexCount; ++v)
+    {
+        const Vector3& position = vertices[v].position;
+        unsigned int first = positionMap.insert(std::make_pair(position, v)).first->second;
+        positions[v] = first;
+        wedges[v] = v;
+        if (first != v)
+        {
+            wedges[v] = wedges[first];
+            wedges[first] = v;
+        }
+        minPosition.set(std::min(minPosition.x, position.x), std::min(minPosition.y, position.y), std::min(minPosition.z, position.z));
+        maxPosition.set(std::max(maxPosition.x, position.x), std::max(maxPosition.y, position.y), std::max(maxPosition.z, position.z));
+    }
+    float radius = 0.5f * minPosition.distance(maxPosition);
+    double errorLimit = maxError > 0.0f ? (double)(maxError * radius) * (maxError * radius) : std::numeric_limits<double>::max();
+
+    // Positions that are used by several parts are locked so that the parts keep their shared edges.
+    std::vector<bool> locked(vertexCount, false);
+    std::vector<unsigned int> positionParts(vertexCount, NO_VERTEX);
+    for (unsigned int i = 0, count = (unsigned int)indices.size(); i < count; ++i)
+    {
+        unsigned int position = positions[indices[i]];
+        unsigned int part = triangleParts[i / 3];
+        if (positionParts[position] == NO_VERTEX)
+            positionParts[position] = part;
+        else if (positionParts[position] != part)
+            locked[position] = true;
+    }
+
+    // Sum the planes of the triangles around each position, and planes perpendicular to the triangles along borders and seams.
+    std::vector<Quadric> quadrics(vertexCount);
+    std::unordered_set<unsigned long long> edges;
+    for (unsigned int i = 0, count = (unsigned int)indices.size(); i < count; i += 3)
+    {
+        for (unsigned int k = 0; k < 3; ++k)
+            edges.insert(getEdgeKey(indices[i + k], indices[i + (k + 1) % 3]));
+    }
+    for (unsigned int t = 0; t < triangleCount; ++t)
+    {
+        const Vector3& p0 = vertices[indices[t * 3]].position;
+        const Vector3& p1 = vertices[indices[t * 3 + 1]].position;
+        const Vector3& p2 = vertices[indices[t * 3 + 2]].position;
+        Vector3 normal;
+        getNormal(p0, p1, p2, &normal);
+        if (normal.isZero())
+            continue;
+        normal.normalize();
+        float d = -Vector3::dot(normal, p0);
+        for (unsigned int k = 0; k < 3; ++k)
+        {
+            quadrics[positions[indices[t * 3 + k]]].addPlane(normal.x, normal.y, normal.z, d);
+        }
+        for (unsigned int k = 0; k < 3; ++k)
+        {
+            unsigned int a = indices[t * 3 + k];
+            unsigned int b = indices[t * 3 + (k + 1) % 3];
+            if (edges.count(getEdgeKey(b, a)))
+                continue;
+            const Vector3& pa = vertices[a].position;
+            const Vector3& pb = vertices[b].position;
+            Vector3 edgeNormal;
+            Vector3::cross(Vector3(pb.x - pa.x, pb.y - pa.y, pb.z - pa.z), normal, &edgeNormal);
+            if (edgeNormal.isZero())
+                continue;
+            edgeNormal.normalize();
+            float edgeD = -Vector3::dot(edgeNormal, pa);
+            quadrics[positions[a]].addPlane(edgeNormal.x, edgeNormal.y, edgeNormal.z, edgeD);
+            quadrics[positions[b]].addPlane(edgeNormal.x, edgeNormal.y, edgeNormal.z, edgeD);
+        }
+    }
+
+    std::vector<unsigned char> kinds(vertexCount);
+    std::vector<unsigned int> openOut(vertexCount);
+    std::vector<unsigned int> openIn(vertexCount);
+    std::vector<unsigned int> openOutCount(vertexCount);
+    std::vector<unsigned int> openInCount(vertexCount);
+    std::vector<bool> used(vertexCount);
+    std::vector<unsigned int> offsets(vertexCount + 1);
+    std::vector<unsigned int> adjacency;
+    std::vector<unsigned int> remap(vertexCount);
+    std::vector<bool> collapseLocked(vertexCount);
+    std::vector<unsigned int> partTriangles(partCount);
+    std::vector<unsigned int> removedTriangles(partCount);
+    std::vector<Collapse> collapses;
+
+    // Collapse the cheapest edges in passes, where each position is moved or moved onto at most once,
+    // until there are few enough triangles or no edge can be collapsed within the error limit.
+    while (triangleCount > targetCount)
+    {
+        // Find the open edges of each vertex, which have no opposite edge between the same vertices.
+        edges.clear();
+        for (unsigned int i = 0, count = (unsigned int)indices.size(); i < count; i += 3)
+        {
+            for (unsigned int k = 0; k < 3; ++k)
+                edges.insert(getEdgeKey(indices[i + k], indices[i + (k + 1) % 3]));
+        }
+        std::fill(openOut.begin(), openOut.end(), NO_VERTEX);
+        std::fill(openIn.begin(), openIn.end(), NO_VERTEX);
+        std::fill(openOutCount.begin(), openOutCount.end(), 0);
+        std::fill(openInCount.begin(), openInCount.end(), 0);
+        std::fill(used.begin(), used.end(), false);
+        for (unsigned int i = 0, count = (unsigned int)indices.size(); i < count; i += 3)
+        {
+            for (unsigned int k = 0; k < 3; ++k)
+            {
+                unsigned int a = indices[i + k];
+                unsigned int b = indices[i + (k + 1) % 3];
+                used[a] = true;
+                if (!edges.count(getEdgeKey(b, a)))
+                {
+                    openOut[a] = b;
+                    openOutCount[a]++;
+                    openIn[b] = a;
+                    openInCount[b]++;
+                }
+            }
+        }
+
+        // Classify the vertices from the wedges at their position that are still used.
+        for (unsigned int v = 0; v < vertexCount; ++v)
+        {
+            if (!used[v])
+                continue;
+            unsigned int other = NO_VERTEX;
+            unsigned int wedgeCount = 1;
+            for (unsigned int w = wedges[v]; w != v; w = wedges[w])
+            {
+                if (used[w])
+                {
+                    other = w;
+                    ++wedgeCount;
+                }
+            }
+
+            unsigned char kind = VERTEX_LOCKED;
+            if (locked[positions[v]])
+            {
+                kind = VERTEX_LOCKED;
+            }
+            else if (wedgeCount == 1)
+            {
+                if (openOutCount[v] == 0 && openInCount[v] == 0)
+                    kind = VERTEX_MANIFOLD;
+                else if (openOutCount[v] == 1 && openInCount[v] == 1)
+                    kind = VERTEX_BORDER;
+            }
+            else if (wedgeCount == 2)
+            {
+                // Both sides of a seam have one open edge in and out, along the same positions in opposite directions.
+                if (openOutCount[v] == 1 && openInCount[v] == 1 && openOutCount[other] == 1 && openInCount[other] == 1 &&
+                    positions[openOut[v]] == positions[openIn[other]] && positions[openIn[v]] == positions[openOut[other]])
+                {
+                    kind = VERTEX_SEAM;
+                }
+            }
+            kinds[v] = kind;
+        }
+
+        // Find the triangles around each position.
+        std::fill(offsets.begin(), offsets.end(), 0);
+        for (unsigned int i = 0, count = (unsigned int)indices.size(); i < count; ++i)
+        {
+            offsets[positions[indices[i]] + 1]++;
+        }
+        for (unsigned int v = 0; v < vertexCount; ++v)
+        {
+            offsets[v + 1] += offsets[v];
+        }
+        adjacency.resize(indices.size());
+        std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+        for (unsigned int i = 0, count = (unsigned int)indices.size(); i < count; ++i)
+        {
+            adjacency[fill[positions[indices[i]]]++] = i / 3;
+        }
+
+        // Find the collapses allowed along each edge, keeping the cheaper direction.
+        collapses.clear();
+        for (unsigned int i = 0, count = (unsigned int)indices.size(); i < count; ++i)
+        {
+            unsigned int a = indices[i];
+            unsigned int b = indices[i - i % 3 + (i % 3 + 1) % 3];
+            if (positions[a] == positions[b])
+                continue;
+
+            Collapse best;
+            best.from = NO_VERTEX;
+            best.cost = std::numeric_limits<double>::max();
+            for (unsigned int direction = 0; direction < 2; ++direction)
+            {
+                unsigned int from = direction == 0 ? a : b;
+                unsigned int to = direction == 0 ? b : a;
+                unsigned int seamFrom = NO_VERTEX;
+                unsigned int seamTo = NO_VERTEX;
+                switch (kinds[from])
+                {
+                case VERTEX_MANIFOLD:
+                    break;
+                case VERTEX_BORDER:
+                    if (kinds[to] != VERTEX_BORDER || (openOut[from] != to && openIn[from] != to))
+                        continue;
+                    break;
+                case VERTEX_SEAM:
+                    {
+                        // The other side of the seam is moved onto the vertex at the same position on its side.
+                        if (kinds[to] != VERTEX_SEAM || (openOut[from] != to && openIn[from] != to))
+                            continue;
+                        for (unsigned int w = wedges[from]; w != from; w = wedges[w])
+                        {
+                            if (used[w])
+                                seamFrom = w;
+                        }
+                        seamTo = openOut[from] == to ? openIn[seamFrom] : openOut[seamFrom];
+                        if (seamTo == NO_VERTEX || positions[seamTo] != positions[to])
+                            continue;
+                    }
+                    break;
+                default:
+                    continue;
+                }
+                double cost = quadrics[positions[from]].evaluate(vertices[to].position);
+                if (cost < best.cost)
+                {
+                    best.from = from;
+                    best.to = to;
+                    best.seamFrom = seamFrom;
+                    best.seamTo = seamTo;
+                    best.cost = cost;
+                }
+            }
+            if (best.from != NO_VERTEX && best.cost <= errorLimit)
+                collapses.push_back(best);
+        }
+        if (collapses.empty())
+            break;
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& c0, const Collapse& c1) { return c0.cost < c1.cost; });
+
+        std::fill(partTriangles.begin(), partTriangles.end(), 0);
+        for (unsigned int t = 0; t < triangleCount; ++t)
+        {
+            partTriangles[triangleParts[t]]++;
+        }
+        for (unsigned int v = 0; v < vertexCount; ++v)
+        {
+            remap[v] = v;
+        }
+        std::fill(collapseLocked.begin(), collapseLocked.end(), false);
+        unsigned int remainingCount = triangleCount;
+        unsigned int collapseCount = 0;
+        for (size_t c = 0, count = collapses.size(); c < count && remainingCount > targetCount; ++c)
+        {
+            const Collapse& collapse = collapses[c];
+            unsigned int from = positions[collapse.from];
+            unsigned int to = positions[collapse.to];
+            if (collapseLocked[from] || collapseLocked[to])
+                continue;
+
+            // Reject collapses that flip a triangle or remove the last triangles of a part.
+            bool valid = true;
+            std::fill(removedTriangles.begin(), removedTriangles.end(), 0);
+            const Vector3& target = vertices[collapse.to].position;
+            for (unsigned int j = offsets[from]; j < offsets[from + 1] && valid; ++j)
+            {
+                unsigned int t = adjacency[j];
+                unsigned int corners[3] = { positions[indices[t * 3]], positions[indices[t * 3 + 1]], positions[indices[t * 3 + 2]] };
+                if (corners[0] == to || corners[1] == to || corners[2] == to)
+                {
+                    unsigned int part = triangleParts[t];
+                    valid = ++removedTriangles[part] < partTriangles[part];
+                    continue;
+                }
+                Vector3 before;
+                Vector3 after;
+                const Vector3* p[3] = { &vertices[indices[t * 3]].position, &vertices[indices[t * 3 + 1]].position, &vertices[indices[t * 3 + 2]].position };
+                getNormal(*p[0], *p[1], *p[2], &before);
+                for (unsigned int k = 0; k < 3; ++k)
+                {
+                    if (corners[k] == from)
+                        p[k] = &target;
+                }
+                getNormal(*p[0], *p[1], *p[2], &after);
+                valid = Vector3::dot(before, after) > 0.0f;
+            }
+            if (!valid)
+                continue;
+
+            remap[collapse.from] = collapse.to;
+            if (collapse.seamFrom != NO_VERTEX)
+                remap[collapse.seamFrom] = collapse.seamTo;
+            quadrics[to].add(quadrics[from]);
+
+            // Lock the positions around the moved vertex, whose triangles change, for the rest of the pass.
+            for (unsigned int j = offsets[from]; j < offsets[from + 1]; ++j)
+            {
+                unsigned int t = adjacency[j];
+                for (unsigned int k = 0; k < 3; ++k)
+                    collapseLocked[positions[indices[t * 3 + k]]] = true;
+            }
+            for (unsigned int p = 0; p < partCount; ++p)
+            {
+                partTriangles[p] -= removedTriangles[p];
+                remainingCount -= removedTriangles[p];
+            }
+            ++collapseCount;
+        }
+        if (collapseCount == 0)
+            break;
+
+        // Move the collapsed vertices and remove the triangles that became degenerate.
+        unsigned int kept = 0;
+        for (unsigned int t = 0; t < triangleCount; ++t)
+        {
+            unsigned int i0 = remap[indices[t * 3]];
+            unsigned int i1 = remap[indices[t * 3 + 1]];
+            unsigned int i2 = remap[indices[t * 3 + 2]];
+            if (positions[i0] == positions[i1] || positions[i1] == positions[i2] || positions[i0] == positions[i2])
+                continue;
+            indices[kept * 3] = i0;
+            indices[kept * 3 + 1] = i1;
+            indices[kept * 3 + 2] = i2;
+            triangleParts[kept] = triangleParts[t];
+            ++kept;
+        }
+        if (kept == triangleCount)
+            break;
+        triangleCount = kept;
+        indices.resize(triangleCount * 3);
+        triangleParts.resize(triangleCount);
+    }
+    if (triangleCount == originalCount)
+        return NULL;
+
+    // Build the mesh from the vertices that the remaining triangles use.
+    Mesh* simplified = new Mesh();
+    for (unsigned int i = 0, count = (unsigned int)mesh->getVertexElementCount(); i < count; ++i)
+    {
+        const VertexElement& element = mesh->getVertexElement(i);
+        simplified->addVetexAttribute(element.usage, element.size);
+    }
+    std::vector<unsigned int> newIndices(vertexCount, NO_VERTEX);
+    std::vector<std::vector<unsigned int> > partIndices(partCount);
+    for (unsigned int i = 0, count = (unsigned int)indices.size(); i < count; ++i)
+    {
+        unsigned int index = indices[i];
+        if (newIndices[index] == NO_VERTEX)
+        {
+            newIndices[index] = (unsigned int)simplified->vertices.size();
+            simplified->vertices.push_back(vertices[index]);
+            simplified->vertexLookupTable.insert(std::make_pair(vertices[index], newIndices[index]));
+        }
+        partIndices[triangleParts[i / 3]].push_back(newIndices[index]);
+    }
+    for (unsigned int p = 0; p < partCount; ++p)
+    {
+        MeshPart* part = new MeshPart();
+        part->setIndices(partIndices[p]);
+        simplified->addMeshPart(part);
+    }
+    return simplified;
+}
+
+}
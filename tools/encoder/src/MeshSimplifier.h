@@ -0,0 +1,44 @@
+#ifndef MESHSIMPLIFIER_H_
+#define MESHSIMPLIFIER_H_
+
+#include "Mesh.h"
+
+namespace gameplay
+{
+
+/**
+ * Generates simplified versions of meshes for levels of detail.
+ *
+ * Triangles are removed by collapsing edges in the order of the quadric error metric of
+ * Garland and Heckbert. Each collapse moves one vertex onto a neighbouring vertex and keeps
+ * the attributes of the vertex it moves onto, so the blend weights and indices of skinned
+ * meshes and the texture coordinates of the vertices that remain are those of the original
+ * mesh. Vertices on the open borders of the mesh and on attribute seams, where vertices at
+ * the same position have different attributes, only collapse along the border or seam so
+ * that the borders and seams keep their shape, and vertices shared by several mesh parts
+ * do not move at all.
+ */
+class MeshSimplifier
+{
+public:
+
+    /**
+     * Creates a simplified copy of the given mesh.
+     *
+     * The copy has the same vertex format and parts as the mesh, and every part keeps at
+     * least one triangle.
+     *
+     * @param mesh The mesh to simplify, whose parts must all be triangle lists.
+     * @param ratio The fraction of the triangles of the mesh to keep.
+     * @param maxError The largest distance the surface may move, as a fraction of the radius
+     *      of the mesh, or zero to simplify until the ratio is reached.
+     *
+     * @return The new mesh, or NULL if no triangle could be removed.
+     */
+    static Mesh* simplify(const Mesh* mesh, float ratio, float maxError);
+
+};
+
+}
+
+#endif
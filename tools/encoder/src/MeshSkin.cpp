@@ -47,8 +47,7 @@ void MeshSkin::writeBinary(FILE* file)
         write(i->m, 16, file);
     }
 
-    /*
-    // Write joint bounding spheres
+    // Write joint bounding spheres, which are empty when the bounds of the skin were not computed
     write((unsigned int)_jointBounds.size(), file);
     for (unsigned int i = 0; i < _jointBounds.size(); ++i)
     {
@@ -58,7 +57,6 @@ void MeshSkin::writeBinary(FILE* file)
         write(v.center.z, file);
         write(v.radius, file);
     }
-    */
 }
 
 void MeshSkin::writeText(FILE* file)
@@ -72,6 +72,13 @@ void Model::writeBinary(FILE* file)
             }
         }
     }
+    // Write the levels of detail as a mesh xref and a screen size each
+    write((unsigned int)_lodMeshes.size(), file);
+    for (unsigned int i = 0; i < _lodMeshes.size(); ++i)
+    {
+        _lodMeshes[i]->writeBinaryXref(file);
+        write(_lodScreenSizes[i], file);
+    }
 }
 
 void Model::writeText(FILE* file)
@@ -98,6 +105,11 @@ void Model::writeText(FILE* file)
             fprintfElement(file, "material", mat->getId().c_str());
         }
     }
+    for (unsigned int i = 0; i < _lodMeshes.size(); ++i)
+    {
+        fprintfElement(file, "lod", _lodMeshes[i]->getId());
+        fprintfElement(file, "lodScreenSize", _lodScreenSizes[i]);
+    }
     fprintElementEnd(file);
 }
 
@@ -136,6 +148,24 @@ void Model::setSkin(MeshSkin* skin)
     }
 }
 
+void Model::addLod(Mesh* mesh, float screenSize)
+{
+    assert(mesh);
+    _lodMeshes.push_back(mesh);
+    _lodScreenSizes.push_back(screenSize);
+}
+
+unsigned int Model::getLodCount() const
+{
+    return _lodMeshes.size();
+}
+
+Mesh* Model::getLodMesh(unsigned int index)
+{
+    assert(index < _lodMeshes.size());
+    return _lodMeshes[index];
+}
+
 void Model::setMaterial(Material* material, int partIndex)
 {
     if (partIndex < 0)
@@ -34,12 +34,22 @@ public:
     void setSkin(MeshSkin* skin);
     void setMaterial(Material* material, int partIndex = -1);
 
+    /**
+     * Adds a level of detail mesh, drawn when the model covers less than the
+     * given fraction of the height of the screen.
+     */
+    void addLod(Mesh* mesh, float screenSize);
+    unsigned int getLodCount() const;
+    Mesh* getLodMesh(unsigned int index);
+
 private:
 
     Mesh* _mesh;
     MeshSkin* _meshSkin;
     std::vector<Material*> _materials;
     Material* _material;
+    std::vector<Mesh*> _lodMeshes;
+    std::vector<float> _lodScreenSizes;
 };
 
 }
@@ -1,6 +1,7 @@
 #include "NormalMapGenerator.h"
 #include "Image.h"
 #include "Base.h"
+#include "ThreadPool.h"
 
 namespace gameplay
 {
@@ -30,34 +31,98 @@ bool equalsIgnoreCase(const std::string& s1, const std::string& s2)
     return true;
 }
 
-float getHeight(float* heights, int width, int height, int x, int y)
+///////////////////////////////////////////////////////////////////////////////////////////////
+//
+// NOTE: The normals assume that the heightmap geometry is generated as follows.
+//
+//   -----------
+//  | / | / | / |
+//  |-----------|
+//  | / | / | / |
+//  |-----------|
+//  | / | / | / |
+//   -----------
+//
+// The upper left triangle of the cell with the top left height e, top right height f, bottom
+// left height g and bottom right height h has the face normal (sz*(e-f), sx*sz, sx*(e-g)) and
+// the lower right one has (sz*(g-h), sx*sz, sx*(f-h)), where sx and sz are the distances
+// between the heights. The normal of a vertex is the sum of the face normals of the triangles
+// around it, which can be written out for a vertex with heights on all sides.
+//
+// We don't have to worry about weighting the normals by the surface area of the triangles
+// since a heightmap guarantees that all triangles have the same surface area.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+static void packNormal(float x, float y, float z, unsigned char* pixel)
 {
-    if (x < 0)
-        x = 0;
-    else if (x >= width)
-        x = width-1;
-    if (y < 0)
-        y = 0;
-    else if (y >= height)
-        y = height-1;
-    return heights[y*width+x];
+    float length = sqrt(x * x + y * y + z * z);
+    float scale = length > 0.0f ? 1.0f / length : 0.0f;
+    pixel[0] = (unsigned char)((x * scale + 1.0f) * 0.5f * 255.0f);
+    pixel[1] = (unsigned char)((y * scale + 1.0f) * 0.5f * 255.0f);
+    pixel[2] = (unsigned char)((z * scale + 1.0f) * 0.5f * 255.0f);
 }
 
-void calculateNormal(
-    float x1, float y1, float z1,
-    float x2, float y2, float z2,
-    float x3, float y3, float z3,
-    Vector3* normal)
+/**
+ * Calculates the normals of the vertices [first, last) of a row with rows above and below it,
+ * into RGB pixels. The loop has no branches, so that the compiler can vectorize it.
+ */
+static void calculateVertexNormals(const float* heights, int width, int z, int first, int last, const Vector2& scale, unsigned char* pixels)
 {
-    Vector3 E(x1, y1, z1);
-    Vector3 F(x2, y2, z2);
-    Vector3 G(x3, y3, z3);
-
-    Vector3 P, Q;
-    Vector3::subtract(F, E, &P);
-    Vector3::subtract(G, E, &Q);
+    const float* above = heights + (z - 1) * width;
+    const float* row = heights + z * width;
+    const float* below = heights + (z + 1) * width;
+    const float ny = 6.0f * scale.x * scale.y;
+    for (int x = first; x < last; ++x)
+    {
+        // Top left, bottom left (two), top right (two) and bottom right faces.
+        float nx = (row[x-1] - row[x]) + (row[x-1] - row[x]) + (below[x-1] - below[x])
+                 + (above[x] - above[x+1]) + (row[x] - row[x+1]) + (row[x] - row[x+1]);
+        float nz = (above[x] - row[x]) + (row[x-1] - below[x-1]) + (row[x] - below[x])
+                 + (above[x] - row[x]) + (above[x+1] - row[x+1]) + (row[x] - below[x]);
+        packNormal(nx * scale.y, ny, nz * scale.x, pixels + x * 3);
+    }
+}
 
-    Vector3::cross(Q, P, normal);
+/**
+ * Calculates the normal of a vertex that may be on the edge of the heightmap, into an RGB pixel.
+ */
+static void calculateEdgeVertexNormal(const float* heights, int width, int height, int x, int z, const Vector2& scale, unsigned char* pixel)
+{
+    float nx = 0, nz = 0;
+    int faceCount = 0;
+    for (int cz = z - 1; cz <= z; ++cz)
+    {
+        for (int cx = x - 1; cx <= x; ++cx)
+        {
+            if (cx < 0 || cz < 0 || cx >= width - 1 || cz >= height - 1)
+                continue;
+            float e = heights[cz * width + cx];
+            float f = heights[cz * width + cx + 1];
+            float g = heights[(cz + 1) * width + cx];
+            float h = heights[(cz + 1) * width + cx + 1];
+
+            // The vertex is in both triangles of the cells below and to the left of it and above
+            // and to the right of it. It is the top left corner of the cell below and to the right,
+            // which is only in its upper left triangle, and the bottom right corner of the cell
+            // above and to the left, which is only in its lower right triangle.
+            bool upper = !(cx == x - 1 && cz == z - 1);
+            bool lower = !(cx == x && cz == z);
+            if (upper)
+            {
+                nx += e - f;
+                nz += e - g;
+                ++faceCount;
+            }
+            if (lower)
+            {
+                nx += g - h;
+                nz += f - h;
+                ++faceCount;
+            }
+        }
+    }
+    packNormal(nx * scale.y, faceCount * scale.x * scale.y, nz * scale.x, pixel);
 }
 
 float normalizedHeightPacked(float r, float g, float b)
@@ -188,130 +253,44 @@ void NormalMapGenerator::generate()
         return;
     }
 
-    ///////////////////////////////////////////////////////////////////////////////////////////////
-    //
-    // NOTE: This method assumes the heightmap geometry is generated as follows.
-    //
-    //   -----------
-    //  | / | / | / |
-    //  |-----------|
-    //  | / | / | / |
-    //  |-----------|
-    //  | / | / | / |
-    //   -----------
-    //
-    ///////////////////////////////////////////////////////////////////////////////////////////////
-
     struct NormalPixel
     {
         unsigned char r, g, b;
     };
     NormalPixel* normalPixels = new NormalPixel[_resolutionX * _resolutionY];
 
-    struct Face
-    {
-        Vector3 normal1;
-        Vector3 normal2;
-    };
-
-    int progressMax = (_resolutionX-1) * (_resolutionY-1) + _resolutionX * _resolutionY;
-    int progress = 0;
-
     Vector2 scale(_worldSize.x / (_resolutionX-1), _worldSize.z / (_resolutionY-1));
 
-    // First calculate all face normals for the heightmap
+    // Smooth normals by taking an average for each vertex, of the normals of the faces around it.
+    // The rows are computed on the worker threads, a band of rows at a time to report progress.
     LOG(1, "Calculating normals... 0%%");
-    Face* faceNormals = new Face[(_resolutionX - 1) * (_resolutionY - 1)];
-    Vector3 v1, v2;
-    for (int z = 0; z < _resolutionY-1; z++)
+    int bandSize = std::max(_resolutionY / 100, 1);
+    for (int band = 0; band < _resolutionY; band += bandSize)
     {
-        for (int x = 0; x < _resolutionX-1; x++)
+        parallelFor((unsigned int)std::min(bandSize, _resolutionY - band), [&](unsigned int bandRow)
         {
-            float topLeftHeight = getHeight(heights, _resolutionX, _resolutionY, x, z);
-            float bottomLeftHeight = getHeight(heights, _resolutionX, _resolutionY, x, z + 1);
-            float bottomRightHeight = getHeight(heights, _resolutionX, _resolutionY, x + 1, z + 1);
-            float topRightHeight = getHeight(heights, _resolutionX, _resolutionY, x + 1, z);
-
-            // Triangle 1
-            calculateNormal(
-                (float)x*scale.x, bottomLeftHeight, (float)(z + 1)*scale.y,
-                (float)x*scale.x, topLeftHeight, (float)z*scale.y,
-                (float)(x + 1)*scale.x, topRightHeight, (float)z*scale.y,
-                &faceNormals[z*(_resolutionX-1)+x].normal1);
-
-            // Triangle 2
-            calculateNormal(
-                (float)x*scale.x, bottomLeftHeight, (float)(z + 1)*scale.y,
-                (float)(x + 1)*scale.x, topRightHeight, (float)z*scale.y,
-                (float)(x + 1)*scale.x, bottomRightHeight, (float)(z + 1)*scale.y,
-                &faceNormals[z*(_resolutionX-1)+x].normal2);
-
-            ++progress;
-            LOG(1, "\rCalculating normals... %d%%", (int)(((float)progress / progressMax) * 100));
-        }
-    }
-
-    // Free height array
-    delete[] heights;
-    heights = NULL;
-
-    // Smooth normals by taking an average for each vertex
-    Vector3 normal;
-    for (int z = 0; z < _resolutionY; z++)
-    {
-        for (int x = 0; x < _resolutionX; x++)
-        {
-            // Reset normal sum
-            normal.set(0, 0, 0);
-
-            if (x > 0)
+            int z = band + (int)bandRow;
+            NormalPixel* row = normalPixels + z * _resolutionX;
+            if (z > 0 && z < _resolutionY - 1)
             {
-                if (z > 0)
-                {
-                    // Top left
-                    normal.add(faceNormals[(z-1)*(_resolutionX-1) + (x-1)].normal2);
-                }
-
-                if (z < (_resolutionY - 1))
-                {
-                    // Bottom left
-                    normal.add(faceNormals[z*(_resolutionX-1) + (x - 1)].normal1);
-                    normal.add(faceNormals[z*(_resolutionX-1) + (x - 1)].normal2);
-                }
+                calculateVertexNormals(heights, _resolutionX, z, 1, _resolutionX - 1, scale, &row->r);
+                calculateEdgeVertexNormal(heights, _resolutionX, _resolutionY, 0, z, scale, &row[0].r);
+                calculateEdgeVertexNormal(heights, _resolutionX, _resolutionY, _resolutionX - 1, z, scale, &row[_resolutionX - 1].r);
             }
-
-            if (x < (_resolutionX - 1))
+            else
             {
-                if (z > 0)
-                {
-                    // Top right
-                    normal.add(faceNormals[(z-1)*(_resolutionX-1) + x].normal1);
-                    normal.add(faceNormals[(z-1)*(_resolutionX-1) + x].normal2);
-                }
-
-                if (z < (_resolutionY - 1))
-                {
-                    // Bottom right
-                    normal.add(faceNormals[z*(_resolutionX-1) + x].normal1);
-                }
+                for (int x = 0; x < _resolutionX; x++)
+                    calculateEdgeVertexNormal(heights, _resolutionX, _resolutionY, x, z, scale, &row[x].r);
             }
+        });
 
-            // We don't have to worry about weighting the normals by
-            // the surface area of the triangles since a heightmap 
-            // guarantees that all triangles have the same surface area.
-            normal.normalize();
-
-            // Store this vertex normal
-            NormalPixel& pixel = normalPixels[z*_resolutionX + x];
-            pixel.r = (unsigned char)((normal.x + 1.0f) * 0.5f * 255.0f);
-            pixel.g = (unsigned char)((normal.y + 1.0f) * 0.5f * 255.0f);
-            pixel.b = (unsigned char)((normal.z + 1.0f) * 0.5f * 255.0f);
-
-            ++progress;
-            LOG(1, "\rCalculating normals... %d%%", (int)(((float)progress / progressMax) * 100));
-        }
+        LOG(1, "\rCalculating normals... %d%%", (int)(((float)std::min(band + bandSize, _resolutionY) / _resolutionY) * 100));
     }
 
+    // Free height array
+    delete[] heights;
+    heights = NULL;
+
     LOG(1, "\rCalculating normals... Done.\n");
 
     // Create and save an image for the normal map
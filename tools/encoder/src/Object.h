@@ -31,6 +31,7 @@ public:
         MESH_ID = 34,
         MESHPART_ID = 35,
         MESHSKIN_ID = 36,
+        CONVEXHULL_ID = 37,
         FONT_ID = 128,
     };
 
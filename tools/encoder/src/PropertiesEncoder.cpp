@@ -0,0 +1,331 @@
+#include "PropertiesEncoder.h"
+#include "FileIO.h"
+
+// Identifier and version of the binary encoding, matching Properties::create.
+#define PROPERTIES_BINARY_IDENTIFIER "GPPR"
+#define PROPERTIES_BINARY_VERSION 1
+
+using namespace gameplay;
+
+/**
+ * Determines if the end of the file has been reached.
+ */
+static bool isEnd(FILE* file)
+{
+    int c = fgetc(file);
+    if (c == EOF)
+        return true;
+    ungetc(c, file);
+    return false;
+}
+
+/**
+ * Reads the next character from the file. Returns EOF if the end of the file is reached.
+ */
+static signed char readChar(FILE* file)
+{
+    if (isEnd(file))
+        return EOF;
+    return (signed char)fgetc(file);
+}
+
+static bool skipWhiteSpace(FILE* file)
+{
+    signed char c;
+    do
+    {
+        c = readChar(file);
+    } while (isspace(c) && c != EOF);
+
+    // Put the cursor back in front of the non-whitespace character.
+    return c == EOF || fseek(file, -1, SEEK_CUR) == 0;
+}
+
+static char* trimWhiteSpace(char* str)
+{
+    if (str == NULL)
+        return str;
+
+    while (isspace(*str))
+        str++;
+    if (*str == 0)
+        return str;
+
+    char* end = str + strlen(str) - 1;
+    while (end > str && isspace(*end))
+        end--;
+    *(end + 1) = 0;
+    return str;
+}
+
+static bool isVariable(const char* str, std::string* name)
+{
+    size_t len = strlen(str);
+    if (len > 3 && str[0] == '$' && str[1] == '{' && str[len - 1] == '}')
+    {
+        name->assign(str + 2, len - 3);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Moves the cursor back from the end of a line to right before its last '}' character.
+ */
+static bool seekBeforeClosingBrace(FILE* file)
+{
+    if (fseek(file, -1, SEEK_CUR) != 0)
+        return false;
+    while (readChar(file) != '}')
+    {
+        if (fseek(file, -2, SEEK_CUR) != 0)
+            return false;
+    }
+    return fseek(file, -1, SEEK_CUR) == 0;
+}
+
+PropertiesEncoder::Namespace::~Namespace()
+{
+    for (size_t i = 0, count = namespaces.size(); i < count; ++i)
+        delete namespaces[i];
+}
+
+PropertiesEncoder::PropertiesEncoder()
+{
+}
+
+PropertiesEncoder::~PropertiesEncoder()
+{
+}
+
+bool PropertiesEncoder::write(const EncoderArguments& arguments)
+{
+    FILE* input = fopen(arguments.getFilePath().c_str(), "rb");
+    if (!input)
+    {
+        LOG(1, "Error: Failed to open file: %s\n", arguments.getFilePath().c_str());
+        return false;
+    }
+    Namespace root(NULL);
+    bool parsed = readNamespace(input, &root);
+    fclose(input);
+    if (!parsed)
+    {
+        LOG(1, "Error: Failed to parse properties file: %s\n", arguments.getFilePath().c_str());
+        return false;
+    }
+
+    std::string outputFilePath = arguments.getOutputFilePath();
+    FILE* output = fopen(outputFilePath.c_str(), "wb");
+    if (!output)
+    {
+        LOG(1, "Error: Failed to open file: %s\n", outputFilePath.c_str());
+        return false;
+    }
+    fwrite(PROPERTIES_BINARY_IDENTIFIER, 1, 4, output);
+    gameplay::write((unsigned int)PROPERTIES_BINARY_VERSION, output);
+    writeNamespace(&root, output);
+
+    bool written = ferror(output) == 0;
+    fclose(output);
+    if (!written)
+    {
+        LOG(1, "Error: Failed to write file: %s\n", outputFilePath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool PropertiesEncoder::readNamespace(FILE* file, Namespace* space)
+{
+    char line[2048];
+    std::string variable;
+    bool comment = false;
+
+    while (true)
+    {
+        // Skip whitespace at the start of lines
+        if (!skipWhiteSpace(file))
+            return false;
+
+        // Stop when we have reached the end of the file.
+        if (isEnd(file))
+            break;
+
+        if (fgets(line, 2048, file) == NULL)
+            return false;
+
+        // Ignore comments
+        if (comment)
+        {
+            // Check for end of multi-line comment at either start or end of line
+            if (strncmp(line, "*/", 2) == 0)
+            {
+                comment = false;
+            }
+            else
+            {
+                trimWhiteSpace(line);
+                const size_t len = strlen(line);
+                if (len >= 2 && strncmp(line + (len - 2), "*/", 2) == 0)
+                    comment = false;
+            }
+        }
+        else if (strncmp(line, "/*", 2) == 0)
+        {
+            // Start of multi-line comment (must be at start of line)
+            comment = true;
+        }
+        else if (strncmp(line, "//", 2) != 0)
+        {
+            // If an '=' appears on this line, parse it as a name/value pair.
+            if (strchr(line, '=') != NULL)
+            {
+                char* name = strtok(line, "=");
+                if (name == NULL)
+                {
+                    LOG(1, "Error: Attribute without name.\n");
+                    return false;
+                }
+                name = trimWhiteSpace(name);
+
+                char* value = strtok(NULL, "");
+                if (value == NULL)
+                {
+                    LOG(1, "Error: Attribute with name ('%s') but no value.\n", name);
+                    return false;
+                }
+                value = trimWhiteSpace(value);
+
+                if (isVariable(name, &variable))
+                    setVariable(space, variable.c_str(), value);
+                else
+                    space->properties.push_back(Property(name, value));
+            }
+            else
+            {
+                char* parentID = NULL;
+
+                // Get the last character on the line (ignoring whitespace).
+                const char* lineEnd = trimWhiteSpace(line) + (strlen(trimWhiteSpace(line)) - 1);
+
+                // This line might begin or end a namespace,
+                // or it might be a key/value pair without '='.
+                char* rc = strchr(line, '{');
+                char* rcc = strchr(line, ':');
+                char* rccc = strchr(line, '}');
+                bool endsOnLine = rccc && rccc == lineEnd;
+
+                char* name = strtok(line, " \t\n{");
+                name = trimWhiteSpace(name);
+                if (name == NULL)
+                {
+                    LOG(1, "Error: Failed to determine a valid token for line '%s'.\n", line);
+                    return false;
+                }
+                else if (name[0] == '}')
+                {
+                    // End of namespace.
+                    return true;
+                }
+
+                char* value = strtok(NULL, ":{");
+                value = trimWhiteSpace(value);
+                if (rcc != NULL)
+                {
+                    parentID = strtok(NULL, "{");
+                    parentID = trimWhiteSpace(parentID);
+                }
+
+                bool withoutID = value != NULL && value[0] == '{';
+                if (withoutID || rc != NULL)
+                {
+                    // If the namespace ends on this line, read it from right before the '}' character.
+                    if (endsOnLine && !seekBeforeClosingBrace(file))
+                        return false;
+
+                    Namespace* child = new Namespace(space);
+                    child->name = name;
+                    if (!withoutID && value)
+                        child->id = value;
+                    if (parentID)
+                        child->parentID = parentID;
+                    space->namespaces.push_back(child);
+                    if (!readNamespace(file, child))
+                        return false;
+
+                    if (endsOnLine && fseek(file, 1, SEEK_CUR) != 0)
+                        return false;
+                }
+                else
+                {
+                    // Find out if the next line starts with "{"
+                    if (!skipWhiteSpace(file))
+                        return false;
+                    if (readChar(file) == '{')
+                    {
+                        Namespace* child = new Namespace(space);
+                        child->name = name;
+                        if (value)
+                            child->id = value;
+                        if (parentID)
+                            child->parentID = parentID;
+                        space->namespaces.push_back(child);
+                        if (!readNamespace(file, child))
+                            return false;
+                    }
+                    else
+                    {
+                        if (fseek(file, -1, SEEK_CUR) != 0)
+                            return false;
+
+                        // Store "name value" as a name/value pair, or even just "name".
+                        space->properties.push_back(Property(name, value ? value : ""));
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+void PropertiesEncoder::setVariable(Namespace* space, const char* name, const char* value)
+{
+    for (Namespace* current = space; current; current = current->parent)
+    {
+        for (size_t i = 0, count = current->variables.size(); i < count; ++i)
+        {
+            if (current->variables[i].name == name)
+            {
+                current->variables[i].value = value;
+                return;
+            }
+        }
+    }
+    space->variables.push_back(Property(name, value));
+}
+
+void PropertiesEncoder::writeNamespace(const Namespace* space, FILE* file)
+{
+    gameplay::write(space->name, file);
+    gameplay::write(space->id, file);
+    gameplay::write(space->parentID, file);
+
+    gameplay::write((unsigned int)space->properties.size(), file);
+    for (size_t i = 0, count = space->properties.size(); i < count; ++i)
+    {
+        gameplay::write(space->properties[i].name, file);
+        gameplay::write(space->properties[i].value, file);
+    }
+
+    gameplay::write((unsigned int)space->variables.size(), file);
+    for (size_t i = 0, count = space->variables.size(); i < count; ++i)
+    {
+        gameplay::write(space->variables[i].name, file);
+        gameplay::write(space->variables[i].value, file);
+    }
+
+    gameplay::write((unsigned int)space->namespaces.size(), file);
+    for (size_t i = 0, count = space->namespaces.size(); i < count; ++i)
+        writeNamespace(space->namespaces[i], file);
+}
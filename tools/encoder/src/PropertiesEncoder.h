@@ -0,0 +1,81 @@
+#ifndef PROPERTIESENCODER_H_
+#define PROPERTIESENCODER_H_
+
+#include "Base.h"
+#include "EncoderArguments.h"
+
+/**
+ * Class for encoding a properties file (.material, .scene, .physics, ...) into
+ * the binary encoding that the engine reads in place of its text.
+ *
+ * The engine's Properties::create() reads the binary file written next to the text
+ * file it was encoded from (box.materialb next to box.material), which replaces
+ * tokenizing the text on the device with reading length-prefixed strings.
+ *
+ * The binary file starts with the identifier "GPPR" and an unsigned int version,
+ * followed by the root namespace. Each namespace is its name, ID and parent ID,
+ * followed by its properties, its variables and its nested namespaces, each preceded
+ * by their count. Strings are an unsigned int length followed by their characters.
+ * Inheritance is left to the engine to resolve when it reads the file.
+ */
+class PropertiesEncoder
+{
+public:
+
+    /**
+     * Constructor.
+     */
+    PropertiesEncoder();
+
+    /**
+     * Destructor.
+     */
+    ~PropertiesEncoder();
+
+    /**
+     * Parses the properties file and writes out its binary encoding.
+     *
+     * @param arguments The encoder arguments.
+     *
+     * @return True if the file was parsed and written, false otherwise.
+     */
+    bool write(const gameplay::EncoderArguments& arguments);
+
+private:
+
+    struct Property
+    {
+        std::string name;
+        std::string value;
+
+        Property(const std::string& name, const std::string& value) : name(name), value(value) { }
+    };
+
+    struct Namespace
+    {
+        std::string name;
+        std::string id;
+        std::string parentID;
+        std::vector<Property> properties;
+        std::vector<Property> variables;
+        std::vector<Namespace*> namespaces;
+        Namespace* parent;
+
+        Namespace(Namespace* parent) : parent(parent) { }
+        ~Namespace();
+    };
+
+    /**
+     * Reads the properties and nested namespaces of a namespace, the same way as Properties::readProperties.
+     */
+    static bool readNamespace(FILE* file, Namespace* space);
+
+    /**
+     * Sets a variable in the nearest namespace that defines it, or adds it to the namespace.
+     */
+    static void setVariable(Namespace* space, const char* name, const char* value);
+
+    static void writeNamespace(const Namespace* space, FILE* file);
+};
+
+#endif
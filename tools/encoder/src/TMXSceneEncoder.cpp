@@ -3,6 +3,7 @@
 #include <zlib.h>
 
 #include "TMXSceneEncoder.h"
+#include "BuildCache.h"
 
 using namespace gameplay;
 using namespace tinyxml2;
@@ -21,12 +22,16 @@ using std::string;
 #endif
 
 TMXSceneEncoder::TMXSceneEncoder() :
-    _tabCount(0)
+    _tabCount(0), _tileChunkSize(0)
 {
 }
 
 TMXSceneEncoder::~TMXSceneEncoder()
 {
+    for (size_t i = 0, count = _tileChunkMaterials.size(); i < count; ++i)
+    {
+        delete _tileChunkMaterials[i];
+    }
 }
 
 void TMXSceneEncoder::write(const EncoderArguments& arguments)
@@ -60,9 +65,21 @@ void TMXSceneEncoder::write(const EncoderArguments& arguments)
     // Write the tile map
     string fileName = arguments.getFileName();
     int pos = fileName.find_last_of('.');
+    string sceneName = (pos == -1 ? fileName : fileName.substr(0, pos));
+
+    // Baked tile layers are written next to the scene, which refers to them by file name like it does to images
+    _tileChunkSize = arguments.getTileChunkSize();
+    _tileChunkBundlePath = sceneName + ".gpb";
+    _tileChunkMaterialPath = sceneName + ".material";
 
     LOG(2, "Writing .scene file.\n");
-    writeScene(map, arguments.getOutputFilePath(), (pos == -1 ? fileName : fileName.substr(0, pos)));
+    writeScene(map, arguments.getOutputFilePath(), sceneName);
+
+    if (_tileChunkSize > 0 && !_tileChunkMaterials.empty())
+    {
+        LOG(2, "Writing tile chunk files.\n");
+        writeTileChunkFiles(arguments.getOutputDirPath() + "/" + _tileChunkBundlePath, arguments.getOutputDirPath() + "/" + _tileChunkMaterialPath);
+    }
 }
 
 bool TMXSceneEncoder::parseTmx(const XMLDocument& xmlDoc, TMXMap& map, const string& inputDirectory) const
@@ -111,6 +128,7 @@ bool TMXSceneEncoder::parseTmx(const XMLDocument& xmlDoc, TMXMap& map, const str
         {
             XMLError err;
             string tsxLocation = buildFilePath(inputDirectory, attValue);
+            BuildCache::addDependency(tsxLocation);
             if ((err = sourceXmlDoc.LoadFile(tsxLocation.c_str())) != XML_NO_ERROR)
             {
                 LOG(1, "Could not load tileset's source TSX.\n");
@@ -640,7 +658,15 @@ void TMXSceneEncoder::writeTileset(const TMXMap& map, const TMXLayer* tileset, s
             WRITE_PROPERTY_BLOCK_START(buffer);
 
             const TMXTileSet& tmxTileset = map.getTileSet(*it);
-            writeSoloTileset(map, tmxTileset, *tileset, file, *it);
+            if (_tileChunkSize > 0)
+            {
+                snprintf(buffer, BUFFER_SIZE, "%s_tileset_%d", tileset->getName().c_str(), i);
+                writeTileChunks(map, tmxTileset, *tileset, buffer, file, *it);
+            }
+            else
+            {
+                writeSoloTileset(map, tmxTileset, *tileset, file, *it);
+            }
 
             const Vector2& tileOffset = tmxTileset.getOffset();
             if (!(tileOffset == Vector2::zero()))
@@ -661,7 +687,14 @@ void TMXSceneEncoder::writeTileset(const TMXMap& map, const TMXLayer* tileset, s
     else
     {
         const TMXTileSet& tmxTileset = map.getTileSet(*(tilesets.begin()));
-        writeSoloTileset(map, tmxTileset, *tileset, file);
+        if (_tileChunkSize > 0)
+        {
+            writeTileChunks(map, tmxTileset, *tileset, tileset->getName(), file);
+        }
+        else
+        {
+            writeSoloTileset(map, tmxTileset, *tileset, file);
+        }
 
         const Vector2& tileOffset = tmxTileset.getOffset();
         if (!(tileOffset == Vector2::zero()))
@@ -739,6 +772,117 @@ void TMXSceneEncoder::writeSoloTileset(const TMXMap& map, const gameplay::TMXTil
     WRITE_PROPERTY_BLOCK_END();
 }
 
+void TMXSceneEncoder::writeTileChunks(const TMXMap& map, const gameplay::TMXTileSet& tmxTileset, const TMXLayer& tileset, const string& id, std::ofstream& file, unsigned int resultOnlyForTileset)
+{
+    // The chunks of a tile set share a material for the image and the opacity of the layer, drawn like TileSet draws through SpriteBatch
+    char buffer[BUFFER_SIZE];
+    Material* material = new Material(id);
+    material->setUniform("u_worldViewProjectionMatrix", WORLD_VIEW_PROJECTION_MATRIX);
+    if (tileset.getOpacity() < 1.0f)
+    {
+        material->addDefine("MODULATE_ALPHA");
+        snprintf(buffer, BUFFER_SIZE, "%f", tileset.getOpacity());
+        material->setUniform("u_modulateAlpha", buffer);
+    }
+    Sampler* sampler = material->createSampler(u_diffuseTexture);
+    sampler->set("path", tmxTileset.getImagePath());
+    sampler->set("mipmap", "false");
+    sampler->set(MIN_FILTER, "NEAREST");
+    sampler->set(MAG_FILTER, "NEAREST");
+    material->setRenderState("cullFace", "false");
+    material->setRenderState("depthTest", "true");
+    material->setRenderState("depthWrite", "false");
+    material->setRenderState("blend", "true");
+    material->setRenderState("blendSrc", "SRC_ALPHA");
+    material->setRenderState("blendDst", "ONE_MINUS_SRC_ALPHA");
+    material->setVertexShader("res/shaders/textured.vert");
+    material->setFragmentShader("res/shaders/textured.frag");
+    _tileChunkMaterials.push_back(material);
+
+    float tileWidth = static_cast<float>(tmxTileset.getMaxTileWidth());
+    float tileHeight = static_cast<float>(tmxTileset.getMaxTileHeight());
+    float imageWidth = static_cast<float>(tmxTileset.getImageWidth());
+    float imageHeight = static_cast<float>(tmxTileset.getImageHeight());
+    unsigned int tilesetHeight = tileset.getHeight();
+    unsigned int tilesetWidth = tileset.getWidth();
+    bool chunksWritten = false;
+    for (unsigned int chunkY = 0; chunkY * _tileChunkSize < tilesetHeight; chunkY++)
+    {
+        for (unsigned int chunkX = 0; chunkX * _tileChunkSize < tilesetWidth; chunkX++)
+        {
+            Mesh* mesh = NULL;
+            MeshPart* part = NULL;
+            for (unsigned int y = chunkY * _tileChunkSize; y < std::min((chunkY + 1) * _tileChunkSize, tilesetHeight); y++)
+            {
+                for (unsigned int x = chunkX * _tileChunkSize; x < std::min((chunkX + 1) * _tileChunkSize, tilesetWidth); x++)
+                {
+                    Vector2 startPos = tileset.getTileStart(x, y, map, resultOnlyForTileset);
+                    if (startPos.x < 0 || startPos.y < 0)
+                    {
+                        continue;
+                    }
+                    if (!mesh)
+                    {
+                        mesh = new Mesh();
+                        part = new MeshPart();
+                    }
+
+                    // The first row is at the top, and each tile has the corners and texture coordinates of a SpriteBatch sprite
+                    float left = x * tileWidth;
+                    float bottom = (tilesetHeight - 1 - y) * tileHeight;
+                    float u1 = startPos.x / imageWidth;
+                    float v1 = 1.0f - startPos.y / imageHeight;
+                    float u2 = u1 + tileWidth / imageWidth;
+                    float v2 = v1 - tileHeight / imageHeight;
+                    unsigned int first = (unsigned int)mesh->getVertexCount();
+                    for (unsigned int corner = 0; corner < 4; corner++)
+                    {
+                        Vertex vertex;
+                        vertex.position.set(left + (corner & 2 ? tileWidth : 0.0f), bottom + (corner & 1 ? tileHeight : 0.0f), 0.0f);
+                        vertex.texCoord[0].set(corner & 2 ? u2 : u1, corner & 1 ? v2 : v1);
+                        vertex.hasTexCoord[0] = true;
+                        mesh->addVertex(vertex);
+                    }
+                    part->addIndex(first);
+                    part->addIndex(first + 2);
+                    part->addIndex(first + 3);
+                    part->addIndex(first);
+                    part->addIndex(first + 3);
+                    part->addIndex(first + 1);
+                }
+            }
+            if (!mesh)
+            {
+                continue;
+            }
+
+            snprintf(buffer, BUFFER_SIZE, "%s_chunk_%u_%u", id.c_str(), chunkX, chunkY);
+            string chunkId = buffer;
+            mesh->addMeshPart(part);
+            mesh->addVetexAttribute(POSITION, Vertex::POSITION_COUNT);
+            mesh->addVetexAttribute(TEXCOORD0, Vertex::TEXCOORD_COUNT);
+            mesh->setId(chunkId + "_Mesh");
+            Model* model = new Model();
+            model->setMesh(mesh);
+            Node* node = new Node();
+            node->setId(chunkId);
+            node->setModel(model);
+            _tileChunkFile.addMesh(mesh);
+            _tileChunkFile.addScenelessNode(node);
+
+            if (chunksWritten)
+            {
+                WRITE_PROPERTY_NEWLINE();
+            }
+            chunksWritten = true;
+            WRITE_PROPERTY_BLOCK_START("node " + chunkId);
+            WRITE_PROPERTY_BLOCK_VALUE("url", _tileChunkBundlePath + "#" + chunkId);
+            WRITE_PROPERTY_BLOCK_VALUE("material", _tileChunkMaterialPath + "#" + id);
+            WRITE_PROPERTY_BLOCK_END();
+        }
+    }
+}
+
 void TMXSceneEncoder::writeSprite(const gameplay::TMXImageLayer* imageLayer, std::ofstream& file)
 {
     if (!imageLayer)
@@ -801,6 +945,33 @@ void TMXSceneEncoder::writeNodeProperties(bool enabled, const Vector2& pos, cons
 #undef WRITE_PROPERTY_BLOCK_END
 #undef WRITE_PROPERTY_BLOCK_START
 
+bool TMXSceneEncoder::writeTileChunkFiles(const string& bundleFilepath, const string& materialFilepath)
+{
+    // The bounds of the chunks are computed here, and their vertices are optimized and packed like those of other meshes
+    _tileChunkFile.adjust();
+    BuildCache::addOutput(bundleFilepath);
+    if (!_tileChunkFile.saveBinary(bundleFilepath))
+    {
+        LOG(1, "Error writing tile chunks: %s\n", bundleFilepath.c_str());
+        return false;
+    }
+
+    BuildCache::addOutput(materialFilepath);
+    FILE* file = fopen(materialFilepath.c_str(), "w");
+    if (!file)
+    {
+        LOG(1, "Error writing tile chunk materials: %s\n", materialFilepath.c_str());
+        return false;
+    }
+    for (size_t i = 0, count = _tileChunkMaterials.size(); i < count; ++i)
+    {
+        _tileChunkMaterials[i]->writeMaterial(file);
+        fprintf(file, "\n");
+    }
+    fclose(file);
+    return true;
+}
+
 void TMXSceneEncoder::writeLine(std::ofstream& file, const string& line) const
 {
     file << TAB_STRING(_tabCount) << line << std::endl;
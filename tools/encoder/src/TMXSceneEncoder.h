@@ -10,6 +10,8 @@
 #include "TMXTypes.h"
 #include "EncoderArguments.h"
 #include "Image.h"
+#include "GPBFile.h"
+#include "Material.h"
 
 /**
  * Class for encoding an TMX file.
@@ -52,6 +54,8 @@ private:
 
     void writeTileset(const gameplay::TMXMap& map, const gameplay::TMXLayer* layer, std::ofstream& file);
     void writeSoloTileset(const gameplay::TMXMap& map, const gameplay::TMXTileSet& tmxTileset, const gameplay::TMXLayer& tileset, std::ofstream& file, unsigned int resultOnlyForTileset = TMX_INVALID_ID);
+    void writeTileChunks(const gameplay::TMXMap& map, const gameplay::TMXTileSet& tmxTileset, const gameplay::TMXLayer& tileset, const std::string& id, std::ofstream& file, unsigned int resultOnlyForTileset = TMX_INVALID_ID);
+    bool writeTileChunkFiles(const std::string& bundleFilepath, const std::string& materialFilepath);
 
     void writeSprite(const gameplay::TMXImageLayer* imageLayer, std::ofstream& file);
 
@@ -63,6 +67,13 @@ private:
     void writeLine(std::ofstream& file, const std::string& line) const;
 
     unsigned int _tabCount;
+
+    // Tile chunks
+    unsigned int _tileChunkSize;
+    std::string _tileChunkBundlePath;
+    std::string _tileChunkMaterialPath;
+    gameplay::GPBFile _tileChunkFile;
+    std::vector<gameplay::Material*> _tileChunkMaterials;
 };
 
 inline void TMXSceneEncoder::writeNodeProperties(bool enabled, std::ofstream& file, bool seperatorLineWritten)
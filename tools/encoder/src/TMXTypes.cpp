@@ -234,6 +234,16 @@ void TMXTileSet::setImageHeight(unsigned int value)
     _vertTileCount = (value - (_margin * 2) + (_spacing ? _spacing : 0)) / (_maxTileHeight + _spacing);
 }
 
+unsigned int TMXTileSet::getImageWidth() const
+{
+    return _imgWidth;
+}
+
+unsigned int TMXTileSet::getImageHeight() const
+{
+    return _imgHeight;
+}
+
 unsigned int TMXTileSet::getHorizontalTileCount() const
 {
     return _horzTileCount;
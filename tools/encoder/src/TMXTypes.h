@@ -44,6 +44,8 @@ public:
     // If any of those change, this needs to be recalled.
     void setImageWidth(unsigned int value);
     void setImageHeight(unsigned int value);
+    unsigned int getImageWidth() const;
+    unsigned int getImageHeight() const;
     unsigned int getHorizontalTileCount() const;
     unsigned int getVerticalTileCount() const;
 
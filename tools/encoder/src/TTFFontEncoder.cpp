@@ -1,7 +1,12 @@
 #include "Base.h"
 #include "TTFFontEncoder.h"
+#include "BuildCache.h"
 #include "GPBFile.h"
 #include "StringUtil.h"
+#include "ThreadPool.h"
+
+// The squared distance of pixels that are not on a side of the edge, for the fast distance transform.
+#define DISTANCE_FIELD_INFINITY 1e20f
 
 namespace gameplay
 {
@@ -34,13 +39,33 @@ static void writeString(FILE* fp, const char* str)
     }
 }
 
-unsigned char* createDistanceFields(unsigned char* img, unsigned int width, unsigned int height)
+/**
+ * Computes the distance of each pixel to the edge of the image's shape with edtaa3, which
+ * finds the edge to a fraction of a pixel from the antialiased coverage.
+ */
+static void computeDistances(double* data, unsigned int width, unsigned int height, double* distances)
 {
     short* xDistance = (short*)malloc(width * height * sizeof(short));
     short* yDistance = (short*)malloc(width * height * sizeof(short));
     double* gx = (double*)calloc(width * height, sizeof(double));
     double* gy = (double*)calloc(width * height, sizeof(double));
+    computegradient(data, width, height, gx, gy);
+    edtaa3(data, gx, gy, height, width, xDistance, yDistance, distances);
+    for (unsigned int i = 0; i < width * height; ++i)
+    {
+        if (distances[i] < 0)
+            distances[i] = 0.0;
+    }
+    free(xDistance);
+    free(yDistance);
+    free(gx);
+    free(gy);
+}
+
+unsigned char* createDistanceFields(unsigned char* img, unsigned int width, unsigned int height)
+{
     double* data = (double*)calloc(width * height, sizeof(double));
+    double* inverse = (double*)calloc(width * height, sizeof(double));
     double* outside = (double*)calloc(width * height, sizeof(double));
     double* inside = (double*)calloc(width * height, sizeof(double));
     unsigned int i;
@@ -61,29 +86,17 @@ unsigned char* createDistanceFields(unsigned char* img, unsigned int width, unsi
     for (i = 0; i < width * height; ++i)
     {
         data[i] = (img[i] - imgMin) / imgMax;
+        inverse[i] = 1 - data[i];
     }
     // Compute outside = edtaa3(bitmap); % Transform background (0's)
-    computegradient(data, width, height, gx, gy);
-    edtaa3(data, gx, gy, height, width, xDistance, yDistance, outside);
-    for (i = 0; i < width * height; ++i)
-    {
-        if (outside[i] < 0 )
-            outside[i] = 0.0;
-    }
-    // Compute inside = edtaa3(1-bitmap); % Transform foreground (1's)
-    memset(gx, 0, sizeof(double) * width * height);
-    memset(gy, 0, sizeof(double) * width * height);
-    for (i = 0; i < width * height; ++i)
+    // and inside = edtaa3(1-bitmap); % Transform foreground (1's)
+    parallelFor(2, [&](unsigned int pass)
     {
-        data[i] = 1 - data[i];
-    }
-    computegradient(data, width, height, gx, gy);
-    edtaa3(data, gx, gy, height, width, xDistance, yDistance, inside);
-    for (i = 0; i < width * height; ++i)
-    {
-        if( inside[i] < 0 )
-            inside[i] = 0.0;
-    }
+        if (pass == 0)
+            computeDistances(data, width, height, outside);
+        else
+            computeDistances(inverse, width, height, inside);
+    });
     // distmap = outside - inside; % Bipolar distance field
     unsigned char* out = (unsigned char*)malloc(sizeof(unsigned char) * width * height);
     for (i = 0; i < width * height; ++i)
@@ -96,17 +109,125 @@ unsigned char* createDistanceFields(unsigned char* img, unsigned int width, unsi
             outside[i] = 255;
         out[i] = 255 - (unsigned char) outside[i];
     }
-    free(xDistance);
-    free(yDistance);
-    free(gx);
-    free(gy);
     free(data);
+    free(inverse);
     free(outside);
     free(inside);
 
     return out;
 }
 
+/**
+ * Replaces the squared distances of a row or column with the squared distances to the
+ * nearest of their points, with the lower envelope of parabolas of Felzenszwalb and Huttenlocher.
+ */
+static void transformLine(float* values, unsigned int count, unsigned int stride)
+{
+    std::vector<float> line(count);
+    std::vector<unsigned int> vertices(count);
+    std::vector<float> bounds(count + 1);
+    for (unsigned int i = 0; i < count; ++i)
+        line[i] = values[i * stride];
+
+    unsigned int k = 0;
+    vertices[0] = 0;
+    bounds[0] = -FLT_MAX;
+    bounds[1] = FLT_MAX;
+    for (unsigned int q = 1; q < count; ++q)
+    {
+        float s;
+        for (;;)
+        {
+            unsigned int r = vertices[k];
+            s = ((line[q] + (float)(q * q)) - (line[r] + (float)(r * r))) / (float)(2 * (q - r));
+            if (s > bounds[k] || k == 0)
+                break;
+            --k;
+        }
+        if (s <= bounds[k])
+            s = bounds[k];
+        ++k;
+        vertices[k] = q;
+        bounds[k] = s;
+        bounds[k + 1] = FLT_MAX;
+    }
+
+    k = 0;
+    for (unsigned int q = 0; q < count; ++q)
+    {
+        while (bounds[k + 1] < (float)q)
+            ++k;
+        float d = (float)q - (float)vertices[k];
+        values[q * stride] = d * d + line[vertices[k]];
+    }
+}
+
+/**
+ * Replaces the squared distances of an image with the squared distances to the nearest of its points.
+ */
+static void transformImage(float* values, unsigned int width, unsigned int height)
+{
+    parallelFor(width, [&](unsigned int x)
+    {
+        transformLine(values + x, height, width);
+    });
+    parallelFor(height, [&](unsigned int y)
+    {
+        transformLine(values + y * width, width, 1);
+    });
+}
+
+/**
+ * Creates the same bipolar distance field as createDistanceFields() with an exact Euclidean
+ * distance transform, which runs in linear time and in parallel over the rows and columns.
+ *
+ * The edges are placed to a fraction of a pixel from the coverage of the pixels that they
+ * cross, which is less accurate on curves than edtaa3 but much faster for large textures.
+ */
+unsigned char* createDistanceFieldsFast(unsigned char* img, unsigned int width, unsigned int height)
+{
+    const unsigned int size = width * height;
+    std::vector<float> outside(size);
+    std::vector<float> inside(size);
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        float coverage = img[i] / 255.0f;
+        if (coverage >= 1.0f)
+        {
+            outside[i] = 0.0f;
+            inside[i] = DISTANCE_FIELD_INFINITY;
+        }
+        else if (coverage <= 0.0f)
+        {
+            outside[i] = DISTANCE_FIELD_INFINITY;
+            inside[i] = 0.0f;
+        }
+        else
+        {
+            // A partly covered pixel is on the edge, which is offset from its center by its coverage.
+            float offset = 0.5f - coverage;
+            outside[i] = offset > 0.0f ? offset * offset : 0.0f;
+            inside[i] = offset < 0.0f ? offset * offset : 0.0f;
+        }
+    }
+    parallelFor(2, [&](unsigned int pass)
+    {
+        transformImage(pass == 0 ? &outside[0] : &inside[0], width, height);
+    });
+
+    unsigned char* out = (unsigned char*)malloc(sizeof(unsigned char) * size);
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        float value = 128 + (sqrt(outside[i]) - sqrt(inside[i])) * 16;
+        if (value < 0)
+            value = 0;
+        if (value > 255)
+            value = 255;
+        out[i] = 255 - (unsigned char)value;
+    }
+    return out;
+}
+
 // Stores a single genreated font size to be written into the GPB
 struct FontData
 {
@@ -135,190 +256,106 @@ struct FontData
     }
 };
  
-int writeFont(const char* inFilePath, const char* outFilePath, std::vector<unsigned int>& fontSizes, const char* id, bool fontpreview = false, Font::FontFormat fontFormat = Font::BITMAP)
+/**
+ * Renders the glyphs of a font size into a texture, at the largest size of the face that fits the pixel size.
+ *
+ * @return True if the glyphs were rendered, false if the size could not be generated.
+ */
+static bool rasterizeFont(FT_Face face, FontData* font)
 {
-    // Initialize freetype library.
-    FT_Library library;
-    FT_Error error = FT_Init_FreeType(&library);
-    if (error)
-    {
-        LOG(1, "FT_Init_FreeType error: %d \n", error);
-        return -1;
-    }
+    unsigned int fontSize = font->fontSize;
+    FT_Error error;
 
-    // Initialize font face.
-    FT_Face face;
-    error = FT_New_Face(library, inFilePath, 0, &face);
-    if (error)
-    {
-        LOG(1, "FT_New_Face error: %d \n", error);
-        return -1;
-    }
+    TTFGlyph* glyphArray = font->glyphArray;
 
-    std::vector<FontData*> fonts;
+    int rowSize = 0;
+    int glyphSize = 0;
+    int actualfontHeight = 0;
 
-    for (size_t fontIndex = 0, count = fontSizes.size(); fontIndex < count; ++fontIndex)
-    {
-        unsigned int fontSize = fontSizes[fontIndex];
-
-        FontData* font = new FontData();
-        font->fontSize = fontSize;
+    FT_GlyphSlot slot = NULL;
+    FT_Int32 loadFlags = FT_LOAD_RENDER | FT_LOAD_FORCE_AUTOHINT;
 
-        TTFGlyph* glyphArray = font->glyphArray;
+    // We want to generate fonts that fit exactly the requested pixels size.
+    // Since free type (due to modern fonts) does not directly correlate requested
+    // size to glyph size, we'll brute-force attempt to set the largest font size
+    // possible that will fit within the requested pixel size.
+    for (unsigned int requestedSize = fontSize; requestedSize > 0; --requestedSize)
+    {
+        // Set the pixel size.
+        error = FT_Set_Char_Size( face, 0, requestedSize * 64, 0, 0 );
+        if (error)
+        {
+            LOG(1, "FT_Set_Pixel_Sizes error: %d \n", error);
+            return false;
+        }
 
-        int rowSize = 0;
-        int glyphSize = 0;
-        int actualfontHeight = 0;
+        // Save glyph information (slot contains the actual glyph bitmap).
+        slot = face->glyph;
 
-        FT_GlyphSlot slot = NULL;
-        FT_Int32 loadFlags = FT_LOAD_RENDER | FT_LOAD_FORCE_AUTOHINT;
+        rowSize = 0;
+        glyphSize = 0;
+        actualfontHeight = 0;
 
-        // We want to generate fonts that fit exactly the requested pixels size.
-        // Since free type (due to modern fonts) does not directly correlate requested
-        // size to glyph size, we'll brute-force attempt to set the largest font size
-        // possible that will fit within the requested pixel size.
-        for (unsigned int requestedSize = fontSize; requestedSize > 0; --requestedSize)
+        // Find the width of the image.
+        for (unsigned char ascii = START_INDEX; ascii < END_INDEX; ++ascii)
         {
-            // Set the pixel size.
-            error = FT_Set_Char_Size( face, 0, requestedSize * 64, 0, 0 );
+            // Load glyph image into the slot (erase previous one)
+            error = FT_Load_Char(face, ascii, loadFlags);
             if (error)
             {
-                LOG(1, "FT_Set_Pixel_Sizes error: %d \n", error);
-                return -1;
+                LOG(1, "FT_Load_Char error : %d \n", error);
             }
 
-            // Save glyph information (slot contains the actual glyph bitmap).
-            slot = face->glyph;
-
-            rowSize = 0;
-            glyphSize = 0;
-            actualfontHeight = 0;
+            int bitmapRows = slot->bitmap.rows;
+            actualfontHeight = (actualfontHeight < bitmapRows) ? bitmapRows : actualfontHeight;
 
-            // Find the width of the image.
-            for (unsigned char ascii = START_INDEX; ascii < END_INDEX; ++ascii)
+            if (slot->bitmap.rows > slot->bitmap_top)
             {
-                // Load glyph image into the slot (erase previous one)
-                error = FT_Load_Char(face, ascii, loadFlags);
-                if (error)
-                {
-                    LOG(1, "FT_Load_Char error : %d \n", error);
-                }
-
-                int bitmapRows = slot->bitmap.rows;
-                actualfontHeight = (actualfontHeight < bitmapRows) ? bitmapRows : actualfontHeight;
-
-                if (slot->bitmap.rows > slot->bitmap_top)
-                {
-                    bitmapRows += (slot->bitmap.rows - slot->bitmap_top);
-                }
-                rowSize = (rowSize < bitmapRows) ? bitmapRows : rowSize;
-            }
-
-            // Have we found a pixel size that fits?
-            if (rowSize <= (int)fontSize)
-            {
-                glyphSize = rowSize;
-                rowSize = fontSize;
-                break;
+                bitmapRows += (slot->bitmap.rows - slot->bitmap_top);
             }
+            rowSize = (rowSize < bitmapRows) ? bitmapRows : rowSize;
         }
 
-        if (slot == NULL || glyphSize == 0)
+        // Have we found a pixel size that fits?
+        if (rowSize <= (int)fontSize)
         {
-            LOG(1, "Cannot generate a font of the requested size: %d\n", fontSize);
-            return -1;
+            glyphSize = rowSize;
+            rowSize = fontSize;
+            break;
         }
+    }
 
-        // Include padding in the rowSize.
-        rowSize += GLYPH_PADDING;
-
-        // Initialize with padding.
-        int penX = 0;
-        int penY = 0;
-        int row = 0;
-
-        double powerOf2 = 2;
-        unsigned int imageWidth = 0;
-        unsigned int imageHeight = 0;
-        bool textureSizeFound = false;
-
-        int advance;
-        int i;
-
-        while (textureSizeFound == false)
-        {
-            imageWidth =  (unsigned int)pow(2.0, powerOf2);
-            imageHeight = (unsigned int)pow(2.0, powerOf2);
-            penX = 0;
-            penY = 0;
-            row = 0;
-
-            // Find out the squared texture size that would fit all the require font glyphs.
-            i = 0;
-            for (unsigned char ascii = START_INDEX; ascii < END_INDEX; ++ascii)
-            {
-                // Load glyph image into the slot (erase the previous one).
-                error = FT_Load_Char(face, ascii, loadFlags);
-                if (error)
-                {
-                    LOG(1, "FT_Load_Char error : %d \n", error);
-                }
-                // Glyph image.
-                int glyphWidth = slot->bitmap.pitch;
-                int glyphHeight = slot->bitmap.rows;
-
-                advance = glyphWidth + GLYPH_PADDING; 
-
-                // If we reach the end of the image wrap aroud to the next row.
-                if ((penX + advance) > (int)imageWidth)
-                {
-                    penX = 0;
-                    row += 1;
-                    penY = row * rowSize;
-                    if (penY + rowSize > (int)imageHeight)
-                    {
-                        powerOf2++;
-                        break;
-                    }
-                }
+    if (slot == NULL || glyphSize == 0)
+    {
+        LOG(1, "Cannot generate a font of the requested size: %d\n", fontSize);
+        return false;
+    }
 
-                // penY should include the glyph offsets.
-                penY += (actualfontHeight - glyphHeight) + (glyphHeight - slot->bitmap_top);
+    // Include padding in the rowSize.
+    rowSize += GLYPH_PADDING;
 
-                // Set the pen position for the next glyph
-                penX += advance; // Move X to next glyph position
-                // Move Y back to the top of the row.
-                penY = row * rowSize;
+    // Initialize with padding.
+    int penX = 0;
+    int penY = 0;
+    int row = 0;
 
-                if (ascii == (END_INDEX - 1))
-                {
-                    textureSizeFound = true;
-                }
-                i++;
-            }
-        }
+    double powerOf2 = 2;
+    unsigned int imageWidth = 0;
+    unsigned int imageHeight = 0;
+    bool textureSizeFound = false;
 
-        // Try further to find a tighter texture size.
-        powerOf2 = 1;
-        for (;;)
-        {
-            if ((penY + rowSize) >= pow(2.0, powerOf2))
-            {
-                powerOf2++;
-            }
-            else
-            {
-                imageHeight = (int)pow(2.0, powerOf2);
-                break;
-            }
-        }
+    int advance;
+    int i;
 
-        // Allocate temporary image buffer to draw the glyphs into.
-        unsigned char* imageBuffer = (unsigned char*)malloc(imageWidth * imageHeight);
-        memset(imageBuffer, 0, imageWidth * imageHeight);
-        penX = 1;
+    while (textureSizeFound == false)
+    {
+        imageWidth =  (unsigned int)pow(2.0, powerOf2);
+        imageHeight = (unsigned int)pow(2.0, powerOf2);
+        penX = 0;
         penY = 0;
         row = 0;
+
+        // Find out the squared texture size that would fit all the require font glyphs.
         i = 0;
         for (unsigned char ascii = START_INDEX; ascii < END_INDEX; ++ascii)
         {
@@ -328,58 +365,191 @@ int writeFont(const char* inFilePath, const char* outFilePath, std::vector<unsig
             {
                 LOG(1, "FT_Load_Char error : %d \n", error);
             }
-
             // Glyph image.
-            unsigned char* glyphBuffer =  slot->bitmap.buffer;
             int glyphWidth = slot->bitmap.pitch;
             int glyphHeight = slot->bitmap.rows;
 
-            advance = glyphWidth + GLYPH_PADDING;
+            advance = glyphWidth + GLYPH_PADDING; 
 
             // If we reach the end of the image wrap aroud to the next row.
             if ((penX + advance) > (int)imageWidth)
             {
-                penX = 1;
+                penX = 0;
                 row += 1;
                 penY = row * rowSize;
                 if (penY + rowSize > (int)imageHeight)
                 {
-                    free(imageBuffer);
-                    LOG(1, "Image size exceeded!");
-                    return -1;
+                    powerOf2++;
+                    break;
                 }
             }
 
             // penY should include the glyph offsets.
             penY += (actualfontHeight - glyphHeight) + (glyphHeight - slot->bitmap_top);
 
-            // Draw the glyph to the bitmap with a one pixel padding.
-            drawBitmap(imageBuffer, penX, penY, imageWidth, glyphBuffer, glyphWidth, glyphHeight);
-
+            // Set the pen position for the next glyph
+            penX += advance; // Move X to next glyph position
             // Move Y back to the top of the row.
             penY = row * rowSize;
 
-            glyphArray[i].index = ascii;
-            glyphArray[i].width = advance - GLYPH_PADDING;
-            glyphArray[i].bearingX = slot->metrics.horiBearingX >> 6;
-            glyphArray[i].advance = slot->metrics.horiAdvance >> 6;
+            if (ascii == (END_INDEX - 1))
+            {
+                textureSizeFound = true;
+            }
+            i++;
+        }
+    }
+
+    // Try further to find a tighter texture size.
+    powerOf2 = 1;
+    for (;;)
+    {
+        if ((penY + rowSize) >= pow(2.0, powerOf2))
+        {
+            powerOf2++;
+        }
+        else
+        {
+            imageHeight = (int)pow(2.0, powerOf2);
+            break;
+        }
+    }
 
-            // Generate UV coords.
-            glyphArray[i].uvCoords[0] = (float)penX / (float)imageWidth;
-            glyphArray[i].uvCoords[1] = (float)penY / (float)imageHeight;
-            glyphArray[i].uvCoords[2] = (float)(penX + advance - GLYPH_PADDING) / (float)imageWidth;
-            glyphArray[i].uvCoords[3] = (float)(penY + rowSize - GLYPH_PADDING) / (float)imageHeight;
+    // Allocate temporary image buffer to draw the glyphs into.
+    unsigned char* imageBuffer = (unsigned char*)malloc(imageWidth * imageHeight);
+    memset(imageBuffer, 0, imageWidth * imageHeight);
+    penX = 1;
+    penY = 0;
+    row = 0;
+    i = 0;
+    for (unsigned char ascii = START_INDEX; ascii < END_INDEX; ++ascii)
+    {
+        // Load glyph image into the slot (erase the previous one).
+        error = FT_Load_Char(face, ascii, loadFlags);
+        if (error)
+        {
+            LOG(1, "FT_Load_Char error : %d \n", error);
+        }
 
-            // Set the pen position for the next glyph
-            penX += advance;
-            i++;
+        // Glyph image.
+        unsigned char* glyphBuffer =  slot->bitmap.buffer;
+        int glyphWidth = slot->bitmap.pitch;
+        int glyphHeight = slot->bitmap.rows;
+
+        advance = glyphWidth + GLYPH_PADDING;
+
+        // If we reach the end of the image wrap aroud to the next row.
+        if ((penX + advance) > (int)imageWidth)
+        {
+            penX = 1;
+            row += 1;
+            penY = row * rowSize;
+            if (penY + rowSize > (int)imageHeight)
+            {
+                free(imageBuffer);
+                LOG(1, "Image size exceeded!");
+                return false;
+            }
         }
 
-        font->glyphSize = glyphSize;
-        font->imageBuffer = imageBuffer;
-        font->imageWidth = imageWidth;
-        font->imageHeight = imageHeight;
-        fonts.push_back(font);
+        // penY should include the glyph offsets.
+        penY += (actualfontHeight - glyphHeight) + (glyphHeight - slot->bitmap_top);
+
+        // Draw the glyph to the bitmap with a one pixel padding.
+        drawBitmap(imageBuffer, penX, penY, imageWidth, glyphBuffer, glyphWidth, glyphHeight);
+
+        // Move Y back to the top of the row.
+        penY = row * rowSize;
+
+        glyphArray[i].index = ascii;
+        glyphArray[i].width = advance - GLYPH_PADDING;
+        glyphArray[i].bearingX = slot->metrics.horiBearingX >> 6;
+        glyphArray[i].advance = slot->metrics.horiAdvance >> 6;
+
+        // Generate UV coords.
+        glyphArray[i].uvCoords[0] = (float)penX / (float)imageWidth;
+        glyphArray[i].uvCoords[1] = (float)penY / (float)imageHeight;
+        glyphArray[i].uvCoords[2] = (float)(penX + advance - GLYPH_PADDING) / (float)imageWidth;
+        glyphArray[i].uvCoords[3] = (float)(penY + rowSize - GLYPH_PADDING) / (float)imageHeight;
+
+        // Set the pen position for the next glyph
+        penX += advance;
+        i++;
+    }
+
+    font->glyphSize = glyphSize;
+    font->imageBuffer = imageBuffer;
+    font->imageWidth = imageWidth;
+    font->imageHeight = imageHeight;
+    return true;
+}
+
+int writeFont(const char* inFilePath, const char* outFilePath, std::vector<unsigned int>& fontSizes, const char* id, bool fontpreview = false, Font::FontFormat fontFormat = Font::BITMAP, bool fastDistanceField = false)
+{
+    // Initialize freetype library.
+    FT_Library library;
+    FT_Error error = FT_Init_FreeType(&library);
+    if (error)
+    {
+        LOG(1, "FT_Init_FreeType error: %d \n", error);
+        return -1;
+    }
+
+    // Initialize font face.
+    FT_Face face;
+    error = FT_New_Face(library, inFilePath, 0, &face);
+    if (error)
+    {
+        LOG(1, "FT_New_Face error: %d \n", error);
+        return -1;
+    }
+
+    // FreeType objects must not be used by more than one thread at a time, so each size loads its own face.
+    std::vector<FontData*> fonts(fontSizes.size(), NULL);
+    parallelFor((unsigned int)fontSizes.size(), [&](unsigned int fontIndex)
+    {
+        FT_Library sizeLibrary;
+        if (FT_Init_FreeType(&sizeLibrary))
+            return;
+        FT_Face sizeFace;
+        if (FT_New_Face(sizeLibrary, inFilePath, 0, &sizeFace) == 0)
+        {
+            FontData* font = new FontData();
+            font->fontSize = fontSizes[fontIndex];
+            if (rasterizeFont(sizeFace, font))
+            {
+                if (fontFormat == Font::DISTANCE_FIELD)
+                {
+                    // Flip height and width for edtaa3 since its distance field map generator is column-wise.
+                    unsigned char* distanceFieldBuffer = fastDistanceField ?
+                        createDistanceFieldsFast(font->imageBuffer, font->imageWidth, font->imageHeight) :
+                        createDistanceFields(font->imageBuffer, font->imageHeight, font->imageWidth);
+                    free(font->imageBuffer);
+                    font->imageBuffer = distanceFieldBuffer;
+                }
+                fonts[fontIndex] = font;
+            }
+            else
+            {
+                delete font;
+            }
+            FT_Done_Face(sizeFace);
+        }
+        FT_Done_FreeType(sizeLibrary);
+    });
+
+    for (size_t i = 0, count = fonts.size(); i < count; ++i)
+    {
+        if (fonts[i] == NULL)
+        {
+            for (size_t j = 0; j < count; ++j)
+            {
+                delete fonts[j];
+            }
+            FT_Done_Face(face);
+            FT_Done_FreeType(library);
+            return -1;
+        }
     }
 
     // File header and version.
@@ -440,40 +610,18 @@ int writeFont(const char* inFilePath, const char* outFilePath, std::vector<unsig
             std::ostringstream pgmFilePathStream;
             pgmFilePathStream << getFilenameNoExt(outFilePath) << "-" << font->fontSize << ".pgm";
             pgmFilePath = pgmFilePathStream.str();
+            BuildCache::addOutput(pgmFilePath);
             previewFp = fopen(pgmFilePath.c_str(), "wb");
             fprintf(previewFp, "P5 %u %u 255\n", font->imageWidth, font->imageHeight);
         }
 
-        if (fontFormat == Font::DISTANCE_FIELD)
-        {
-            // Flip height and width since the distance field map generator is column-wise.
-            unsigned char* distanceFieldBuffer = createDistanceFields(font->imageBuffer, font->imageHeight, font->imageWidth);
-
-            fwrite(distanceFieldBuffer, sizeof(unsigned char), imageSize, gpbFp);
-            writeUint(gpbFp, Font::DISTANCE_FIELD);
-
-            if (previewFp)
-            {
-                fwrite((const char*)distanceFieldBuffer, sizeof(unsigned char), imageSize, previewFp);
-                fclose(previewFp);
-            }
-
-            free(distanceFieldBuffer);
-        }
-        else
-        {
-            fwrite(font->imageBuffer, sizeof(unsigned char), imageSize, gpbFp);
-            writeUint(gpbFp, Font::BITMAP);
-
-            if (previewFp)
-            {
-                fwrite((const char*)font->imageBuffer, sizeof(unsigned char), font->imageWidth * font->imageHeight, previewFp);
-                fclose(previewFp);
-            }
-        }
+        // The image of a distance field font was replaced by its distance field when it was generated.
+        fwrite(font->imageBuffer, sizeof(unsigned char), imageSize, gpbFp);
+        writeUint(gpbFp, fontFormat);
 
         if (previewFp)
         {
+            fwrite((const char*)font->imageBuffer, sizeof(unsigned char), imageSize, previewFp);
             fclose(previewFp);
             LOG(1, "%s.pgm preview image created successfully. \n", getBaseName(pgmFilePath).c_str());
         }
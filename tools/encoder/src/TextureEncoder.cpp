@@ -0,0 +1,679 @@
+#include "TextureEncoder.h"
+#include "FileIO.h"
+#include "Image.h"
+#include "ThreadPool.h"
+
+// GL formats of the KTX header, matching the formats that Texture::createCompressedKTX uploads.
+#define GL_UNSIGNED_BYTE 0x1401
+#define GL_RGB 0x1907
+#define GL_RGBA 0x1908
+#define GL_RGBA8 0x8058
+#define GL_SRGB8_ALPHA8 0x8C43
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT 0x8C4C
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#define GL_COMPRESSED_RGB8_ETC2 0x9274
+#define GL_COMPRESSED_SRGB8_ETC2 0x9275
+#define GL_COMPRESSED_RGBA8_ETC2_EAC 0x9278
+#define GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC 0x9279
+
+using namespace gameplay;
+
+// The modifiers of the ETC1 subblock tables, for the pixel indices +a, +b, -a and -b.
+static const int __etcModifiers[8][4] =
+{
+    { 2, 8, -2, -8 },
+    { 5, 17, -5, -17 },
+    { 9, 29, -9, -29 },
+    { 13, 42, -13, -42 },
+    { 18, 60, -18, -60 },
+    { 24, 80, -24, -80 },
+    { 33, 106, -33, -106 },
+    { 47, 183, -47, -183 }
+};
+
+// The modifiers of the EAC alpha tables.
+static const int __eacModifiers[16][8] =
+{
+    { -3, -6, -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5, -8, -13, 1, 4, 7, 12 },
+    { -2, -4, -6, -13, 1, 3, 5, 12 },
+    { -3, -6, -8, -12, 2, 5, 7, 11 },
+    { -3, -7, -9, -11, 2, 6, 8, 10 },
+    { -4, -7, -8, -11, 3, 6, 7, 10 },
+    { -3, -5, -8, -11, 2, 4, 7, 10 },
+    { -2, -6, -8, -10, 1, 5, 7, 9 },
+    { -2, -5, -8, -10, 1, 4, 7, 9 },
+    { -2, -4, -8, -10, 1, 3, 7, 9 },
+    { -2, -5, -7, -10, 1, 4, 6, 9 },
+    { -3, -4, -7, -10, 2, 3, 6, 9 },
+    { -1, -2, -3, -10, 0, 1, 2, 9 },
+    { -4, -6, -8, -9, 3, 5, 7, 8 },
+    { -3, -5, -7, -9, 2, 4, 6, 8 }
+};
+
+static float toLinear(float value)
+{
+    return value <= 0.04045f ? value / 12.92f : pow((value + 0.055f) / 1.055f, 2.4f);
+}
+
+static float fromLinear(float value)
+{
+    return value <= 0.0031308f ? value * 12.92f : 1.055f * pow(value, 1.0f / 2.4f) - 0.055f;
+}
+
+static int clampByte(int value)
+{
+    return value < 0 ? 0 : (value > 255 ? 255 : value);
+}
+
+static int getDistance(const unsigned char* color, int r, int g, int b)
+{
+    int dr = color[0] - r;
+    int dg = color[1] - g;
+    int db = color[2] - b;
+    return dr * dr + dg * dg + db * db;
+}
+
+/**
+ * Reads the 4x4 block of RGBA8 texels at the given block coordinates, repeating the edge texels past the image.
+ */
+static void getBlock(const std::vector<unsigned char>& texels, unsigned int width, unsigned int height, unsigned int bx, unsigned int by, unsigned char block[64])
+{
+    for (unsigned int y = 0; y < 4; ++y)
+    {
+        for (unsigned int x = 0; x < 4; ++x)
+        {
+            unsigned int sx = std::min(bx * 4 + x, width - 1);
+            unsigned int sy = std::min(by * 4 + y, height - 1);
+            memcpy(block + (y * 4 + x) * 4, &texels[(sy * width + sx) * 4], 4);
+        }
+    }
+}
+
+static unsigned short toRGB565(float r, float g, float b)
+{
+    int r5 = (int)(std::min(std::max(r, 0.0f), 255.0f) * 31.0f / 255.0f + 0.5f);
+    int g6 = (int)(std::min(std::max(g, 0.0f), 255.0f) * 63.0f / 255.0f + 0.5f);
+    int b5 = (int)(std::min(std::max(b, 0.0f), 255.0f) * 31.0f / 255.0f + 0.5f);
+    return (unsigned short)((r5 << 11) | (g6 << 5) | b5);
+}
+
+static void fromRGB565(unsigned short color, int rgb[3])
+{
+    int r5 = (color >> 11) & 31;
+    int g6 = (color >> 5) & 63;
+    int b5 = color & 31;
+    rgb[0] = (r5 << 3) | (r5 >> 2);
+    rgb[1] = (g6 << 2) | (g6 >> 4);
+    rgb[2] = (b5 << 3) | (b5 >> 2);
+}
+
+/**
+ * Encodes the colors of a block into a BC1 block in four color mode, with the endpoints along their principal axis.
+ */
+static void encodeBC1(const unsigned char block[64], unsigned char* output)
+{
+    // Find the principal axis of the colors by power iteration on their covariance.
+    float mean[3] = { 0.0f, 0.0f, 0.0f };
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+            mean[c] += block[i * 4 + c] / 16.0f;
+    }
+    float covariance[6] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        float r = block[i * 4] - mean[0];
+        float g = block[i * 4 + 1] - mean[1];
+        float b = block[i * 4 + 2] - mean[2];
+        covariance[0] += r * r; covariance[1] += r * g; covariance[2] += r * b;
+        covariance[3] += g * g; covariance[4] += g * b;
+        covariance[5] += b * b;
+    }
+    float axis[3] = { 1.0f, 1.0f, 1.0f };
+    for (unsigned int iteration = 0; iteration < 8; ++iteration)
+    {
+        float x = covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2];
+        float y = covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2];
+        float z = covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2];
+        float length = std::max(std::max(fabs(x), fabs(y)), fabs(z));
+        if (length <= 0.0f)
+            break;
+        axis[0] = x / length;
+        axis[1] = y / length;
+        axis[2] = z / length;
+    }
+
+    // The endpoints are the extents of the colors along the axis, inset slightly since the extremes are rarely hit exactly.
+    float minProjection = FLT_MAX;
+    float maxProjection = -FLT_MAX;
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        float projection = (block[i * 4] - mean[0]) * axis[0] + (block[i * 4 + 1] - mean[1]) * axis[1] + (block[i * 4 + 2] - mean[2]) * axis[2];
+        minProjection = std::min(minProjection, projection);
+        maxProjection = std::max(maxProjection, projection);
+    }
+    float axisLength = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+    if (axisLength > 0.0f)
+    {
+        float inset = (maxProjection - minProjection) / 16.0f;
+        minProjection = (minProjection + inset) / axisLength;
+        maxProjection = (maxProjection - inset) / axisLength;
+    }
+    unsigned short color0 = toRGB565(mean[0] + axis[0] * maxProjection, mean[1] + axis[1] * maxProjection, mean[2] + axis[2] * maxProjection);
+    unsigned short color1 = toRGB565(mean[0] + axis[0] * minProjection, mean[1] + axis[1] * minProjection, mean[2] + axis[2] * minProjection);
+    if (color0 < color1)
+        std::swap(color0, color1);
+
+    // Pick the nearest of the four colors for each texel. Equal endpoints are decoded as the first color everywhere.
+    unsigned int indices = 0;
+    if (color0 != color1)
+    {
+        int palette[4][3];
+        fromRGB565(color0, palette[0]);
+        fromRGB565(color1, palette[1]);
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+        for (unsigned int i = 0; i < 16; ++i)
+        {
+            unsigned int best = 0;
+            int bestDistance = INT_MAX;
+            for (unsigned int k = 0; k < 4; ++k)
+            {
+                int distance = getDistance(block + i * 4, palette[k][0], palette[k][1], palette[k][2]);
+                if (distance < bestDistance)
+                {
+                    best = k;
+                    bestDistance = distance;
+                }
+            }
+            indices |= best << (i * 2);
+        }
+    }
+
+    output[0] = (unsigned char)(color0 & 0xFF);
+    output[1] = (unsigned char)(color0 >> 8);
+    output[2] = (unsigned char)(color1 & 0xFF);
+    output[3] = (unsigned char)(color1 >> 8);
+    for (unsigned int i = 0; i < 4; ++i)
+        output[4 + i] = (unsigned char)(indices >> (i * 8));
+}
+
+/**
+ * Encodes the alpha of a block into the alpha block of BC3, interpolating eight values between the extremes.
+ */
+static void encodeBC3Alpha(const unsigned char block[64], unsigned char* output)
+{
+    int minAlpha = 255;
+    int maxAlpha = 0;
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        minAlpha = std::min(minAlpha, (int)block[i * 4 + 3]);
+        maxAlpha = std::max(maxAlpha, (int)block[i * 4 + 3]);
+    }
+
+    unsigned long long indices = 0;
+    if (maxAlpha > minAlpha)
+    {
+        int palette[8];
+        palette[0] = maxAlpha;
+        palette[1] = minAlpha;
+        for (int k = 2; k < 8; ++k)
+            palette[k] = ((8 - k) * maxAlpha + (k - 1) * minAlpha + 3) / 7;
+        for (unsigned int i = 0; i < 16; ++i)
+        {
+            unsigned int best = 0;
+            int bestDistance = INT_MAX;
+            for (unsigned int k = 0; k < 8; ++k)
+            {
+                int distance = abs(block[i * 4 + 3] - palette[k]);
+                if (distance < bestDistance)
+                {
+                    best = k;
+                    bestDistance = distance;
+                }
+            }
+            indices |= (unsigned long long)best << (i * 3);
+        }
+    }
+
+    output[0] = (unsigned char)maxAlpha;
+    output[1] = (unsigned char)minAlpha;
+    for (unsigned int i = 0; i < 6; ++i)
+        output[2 + i] = (unsigned char)(indices >> (i * 8));
+}
+
+/**
+ * Finds the table of an ETC1 subblock with the given base color that fits its texels best.
+ *
+ * @return The error of the subblock.
+ */
+static int fitETCSubblock(const unsigned char block[64], const unsigned int texels[8], const int base[3], unsigned int* table, unsigned int indices[8])
+{
+    int bestError = INT_MAX;
+    for (unsigned int t = 0; t < 8; ++t)
+    {
+        int error = 0;
+        unsigned int tableIndices[8];
+        for (unsigned int i = 0; i < 8; ++i)
+        {
+            const unsigned char* color = block + texels[i] * 4;
+            int bestDistance = INT_MAX;
+            for (unsigned int k = 0; k < 4; ++k)
+            {
+                int modifier = __etcModifiers[t][k];
+                int distance = getDistance(color, clampByte(base[0] + modifier), clampByte(base[1] + modifier), clampByte(base[2] + modifier));
+                if (distance < bestDistance)
+                {
+                    bestDistance = distance;
+                    tableIndices[i] = k;
+                }
+            }
+            error += bestDistance;
+        }
+        if (error < bestError)
+        {
+            bestError = error;
+            *table = t;
+            memcpy(indices, tableIndices, sizeof(tableIndices));
+        }
+    }
+    return bestError;
+}
+
+/**
+ * Encodes the colors of a block into an ETC1 block, which ETC2 RGB8 decodes the same way.
+ *
+ * Both orientations of the subblocks are tried, each in the individual and the differential
+ * mode, with the base colors at the average of the subblocks. Differential base colors are
+ * kept within range, which is what ETC2 tells the other modes apart by.
+ */
+static void encodeETC(const unsigned char block[64], unsigned char* output)
+{
+    int bestError = INT_MAX;
+    unsigned int high = 0;
+    unsigned int low = 0;
+    for (unsigned int flip = 0; flip < 2; ++flip)
+    {
+        // The subblocks are the left and right halves, or the top and bottom ones when flipped.
+        unsigned int texels[2][8];
+        unsigned int counts[2] = { 0, 0 };
+        float averages[2][3] = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } };
+        for (unsigned int y = 0; y < 4; ++y)
+        {
+            for (unsigned int x = 0; x < 4; ++x)
+            {
+                unsigned int subblock = flip ? (y >= 2) : (x >= 2);
+                texels[subblock][counts[subblock]++] = y * 4 + x;
+                for (unsigned int c = 0; c < 3; ++c)
+                    averages[subblock][c] += block[(y * 4 + x) * 4 + c] / 8.0f;
+            }
+        }
+
+        for (unsigned int differential = 0; differential < 2; ++differential)
+        {
+            int codes[2][3];
+            int bases[2][3];
+            for (unsigned int s = 0; s < 2; ++s)
+            {
+                for (unsigned int c = 0; c < 3; ++c)
+                {
+                    if (differential)
+                    {
+                        codes[s][c] = (int)(averages[s][c] * 31.0f / 255.0f + 0.5f);
+                        bases[s][c] = (codes[s][c] << 3) | (codes[s][c] >> 2);
+                    }
+                    else
+                    {
+                        codes[s][c] = (int)(averages[s][c] * 15.0f / 255.0f + 0.5f);
+                        bases[s][c] = (codes[s][c] << 4) | codes[s][c];
+                    }
+                }
+            }
+            if (differential)
+            {
+                bool fits = true;
+                for (unsigned int c = 0; c < 3; ++c)
+                {
+                    int delta = codes[1][c] - codes[0][c];
+                    fits = fits && delta >= -4 && delta <= 3;
+                }
+                if (!fits)
+                    continue;
+            }
+
+            unsigned int tables[2];
+            unsigned int indices[2][8];
+            int error = fitETCSubblock(block, texels[0], bases[0], &tables[0], indices[0]) +
+                        fitETCSubblock(block, texels[1], bases[1], &tables[1], indices[1]);
+            if (error >= bestError)
+                continue;
+            bestError = error;
+
+            if (differential)
+            {
+                high = (codes[0][0] << 27) | (((codes[1][0] - codes[0][0]) & 7) << 24) |
+                       (codes[0][1] << 19) | (((codes[1][1] - codes[0][1]) & 7) << 16) |
+                       (codes[0][2] << 11) | (((codes[1][2] - codes[0][2]) & 7) << 8);
+            }
+            else
+            {
+                high = (codes[0][0] << 28) | (codes[1][0] << 24) | (codes[0][1] << 20) | (codes[1][1] << 16) |
+                       (codes[0][2] << 12) | (codes[1][2] << 8);
+            }
+            high |= (tables[0] << 5) | (tables[1] << 2) | (differential << 1) | flip;
+
+            // The indices are stored column by column, with the most significant bits of all texels first.
+            low = 0;
+            for (unsigned int s = 0; s < 2; ++s)
+            {
+                for (unsigned int i = 0; i < 8; ++i)
+                {
+                    unsigned int texel = texels[s][i];
+                    unsigned int bit = (texel % 4) * 4 + texel / 4;
+                    low |= ((indices[s][i] >> 1) << (bit + 16)) | ((indices[s][i] & 1) << bit);
+                }
+            }
+        }
+    }
+
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        output[i] = (unsigned char)(high >> (24 - i * 8));
+        output[4 + i] = (unsigned char)(low >> (24 - i * 8));
+    }
+}
+
+/**
+ * Encodes the alpha of a block into an EAC block, searching every table and multiplier with the base centered on the alpha range.
+ */
+static void encodeEAC(const unsigned char block[64], unsigned char* output)
+{
+    int minAlpha = 255;
+    int maxAlpha = 0;
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        minAlpha = std::min(minAlpha, (int)block[i * 4 + 3]);
+        maxAlpha = std::max(maxAlpha, (int)block[i * 4 + 3]);
+    }
+
+    int bestError = INT_MAX;
+    int bestBase = 0;
+    unsigned int bestMultiplier = 1;
+    unsigned int bestTable = 0;
+    unsigned long long bestIndices = 0;
+    for (unsigned int t = 0; t < 16 && bestError > 0; ++t)
+    {
+        const int* modifiers = __eacModifiers[t];
+        for (unsigned int multiplier = 1; multiplier < 16 && bestError > 0; ++multiplier)
+        {
+            int base = clampByte((int)((minAlpha + maxAlpha) * 0.5f - (modifiers[3] + modifiers[7]) * (int)multiplier * 0.5f + 0.5f));
+            int error = 0;
+            unsigned long long indices = 0;
+            for (unsigned int i = 0; i < 16 && error < bestError; ++i)
+            {
+                int alpha = block[i * 4 + 3];
+                unsigned int best = 0;
+                int bestDistance = INT_MAX;
+                for (unsigned int k = 0; k < 8; ++k)
+                {
+                    int distance = abs(clampByte(base + modifiers[k] * (int)multiplier) - alpha);
+                    if (distance < bestDistance)
+                    {
+                        best = k;
+                        bestDistance = distance;
+                    }
+                }
+                error += bestDistance * bestDistance;
+                unsigned int bit = 45 - ((i % 4) * 4 + i / 4) * 3;
+                indices |= (unsigned long long)best << bit;
+            }
+            if (error < bestError)
+            {
+                bestError = error;
+                bestBase = base;
+                bestMultiplier = multiplier;
+                bestTable = t;
+                bestIndices = indices;
+            }
+        }
+    }
+
+    output[0] = (unsigned char)bestBase;
+    output[1] = (unsigned char)((bestMultiplier << 4) | bestTable);
+    for (unsigned int i = 0; i < 6; ++i)
+        output[2 + i] = (unsigned char)(bestIndices >> (40 - i * 8));
+}
+
+TextureEncoder::TextureEncoder()
+{
+}
+
+TextureEncoder::~TextureEncoder()
+{
+}
+
+bool TextureEncoder::write(const EncoderArguments& arguments)
+{
+    const std::string& filePath = arguments.getFilePath();
+    std::string outputFilePath = arguments.getOutputFilePath();
+    EncoderArguments::TextureFormat format = arguments.getTextureFormat();
+    bool srgb = arguments.textureSRGBEnabled();
+
+    Image* image = Image::create(filePath.c_str());
+    if (!image)
+        return false;
+
+    // Convert the image into the base level.
+    std::vector<Level> levels(1);
+    Level& base = levels[0];
+    base.width = image->getWidth();
+    base.height = image->getHeight();
+    base.texels.resize(base.width * base.height * 4);
+    const unsigned char* data = (const unsigned char*)image->getData();
+    unsigned int bpp = image->getBpp();
+    for (unsigned int i = 0, count = base.width * base.height; i < count; ++i)
+    {
+        const unsigned char* texel = data + i * bpp;
+        float alpha = image->getFormat() == Image::RGBA ? texel[3] / 255.0f : 1.0f;
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            float value = (image->getFormat() == Image::LUMINANCE ? texel[0] : texel[c]) / 255.0f;
+            base.texels[i * 4 + c] = (srgb ? toLinear(value) : value) * alpha;
+        }
+        base.texels[i * 4 + 3] = alpha;
+    }
+    delete image;
+
+    // Generate the mipmap chain down to a single texel.
+    if (arguments.textureMipmapsEnabled())
+    {
+        while (levels.back().width > 1 || levels.back().height > 1)
+        {
+            levels.push_back(Level());
+            downsample(levels[levels.size() - 2], &levels.back());
+        }
+    }
+
+    // Encode the levels, each split across the workers by rows of blocks.
+    std::vector<std::vector<unsigned char> > images(levels.size());
+    for (size_t i = 0, count = levels.size(); i < count; ++i)
+    {
+        std::vector<unsigned char> texels;
+        getTexels(levels[i], srgb, &texels);
+        encode(texels, levels[i].width, levels[i].height, format, &images[i]);
+    }
+
+    unsigned int glType = 0;
+    unsigned int glFormat = 0;
+    unsigned int glInternalFormat = 0;
+    unsigned int glBaseInternalFormat = GL_RGBA;
+    switch (format)
+    {
+    case EncoderArguments::TEXTUREFORMAT_BC1:
+        glInternalFormat = srgb ? GL_COMPRESSED_SRGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        glBaseInternalFormat = GL_RGB;
+        break;
+    case EncoderArguments::TEXTUREFORMAT_BC3:
+        glInternalFormat = srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        break;
+    case EncoderArguments::TEXTUREFORMAT_ETC2:
+        glInternalFormat = srgb ? GL_COMPRESSED_SRGB8_ETC2 : GL_COMPRESSED_RGB8_ETC2;
+        glBaseInternalFormat = GL_RGB;
+        break;
+    case EncoderArguments::TEXTUREFORMAT_ETC2_EAC:
+        glInternalFormat = srgb ? GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC : GL_COMPRESSED_RGBA8_ETC2_EAC;
+        break;
+    default:
+        glType = GL_UNSIGNED_BYTE;
+        glFormat = GL_RGBA;
+        glInternalFormat = srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+        break;
+    }
+
+    FILE* file = fopen(outputFilePath.c_str(), "wb");
+    if (!file)
+    {
+        LOG(1, "Error: Failed to open file: %s\n", outputFilePath.c_str());
+        return false;
+    }
+
+    // Write the KTX header, without any key and value data.
+    static const unsigned char identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+    fwrite(identifier, 1, sizeof(identifier), file);
+    gameplay::write((unsigned int)0x04030201, file);
+    gameplay::write(glType, file);
+    gameplay::write((unsigned int)1, file);
+    gameplay::write(glFormat, file);
+    gameplay::write(glInternalFormat, file);
+    gameplay::write(glBaseInternalFormat, file);
+    gameplay::write(levels[0].width, file);
+    gameplay::write(levels[0].height, file);
+    gameplay::write((unsigned int)0, file);
+    gameplay::write((unsigned int)0, file);
+    gameplay::write((unsigned int)1, file);
+    gameplay::write((unsigned int)levels.size(), file);
+    gameplay::write((unsigned int)0, file);
+
+    // Each level is its size followed by its data, which is always a multiple of four bytes.
+    size_t size = 0;
+    for (size_t i = 0, count = images.size(); i < count; ++i)
+    {
+        gameplay::write((unsigned int)images[i].size(), file);
+        fwrite(&images[i][0], 1, images[i].size(), file);
+        size += images[i].size();
+    }
+    bool written = ferror(file) == 0;
+    if (fclose(file) != 0 || !written)
+    {
+        LOG(1, "Error: Failed to write file: %s\n", outputFilePath.c_str());
+        return false;
+    }
+
+    LOG(1, "Wrote %u level(s) of %ux%u texture data (%u bytes).\n", (unsigned int)levels.size(), levels[0].width, levels[0].height, (unsigned int)size);
+    return true;
+}
+
+void TextureEncoder::downsample(const Level& source, Level* destination)
+{
+    destination->width = std::max(source.width / 2, 1u);
+    destination->height = std::max(source.height / 2, 1u);
+
+    // Filter horizontally, then vertically, with the taps past the edges clamped.
+    static const float weights[4] = { 1.0f / 8.0f, 3.0f / 8.0f, 3.0f / 8.0f, 1.0f / 8.0f };
+    std::vector<float> rows(destination->width * source.height * 4, 0.0f);
+    for (unsigned int y = 0; y < source.height; ++y)
+    {
+        for (unsigned int x = 0; x < destination->width; ++x)
+        {
+            float* texel = &rows[(y * destination->width + x) * 4];
+            for (int k = 0; k < 4; ++k)
+            {
+                int sx = std::min(std::max((int)(x * 2) - 1 + k, 0), (int)source.width - 1);
+                const float* sourceTexel = &source.texels[(y * source.width + sx) * 4];
+                for (unsigned int c = 0; c < 4; ++c)
+                    texel[c] += sourceTexel[c] * weights[k];
+            }
+        }
+    }
+    destination->texels.assign(destination->width * destination->height * 4, 0.0f);
+    for (unsigned int y = 0; y < destination->height; ++y)
+    {
+        for (unsigned int x = 0; x < destination->width; ++x)
+        {
+            float* texel = &destination->texels[(y * destination->width + x) * 4];
+            for (int k = 0; k < 4; ++k)
+            {
+                int sy = std::min(std::max((int)(y * 2) - 1 + k, 0), (int)source.height - 1);
+                const float* rowTexel = &rows[(sy * destination->width + x) * 4];
+                for (unsigned int c = 0; c < 4; ++c)
+                    texel[c] += rowTexel[c] * weights[k];
+            }
+        }
+    }
+}
+
+void TextureEncoder::getTexels(const Level& level, bool srgb, std::vector<unsigned char>* texels)
+{
+    texels->resize(level.width * level.height * 4);
+    for (unsigned int i = 0, count = level.width * level.height; i < count; ++i)
+    {
+        const float* texel = &level.texels[i * 4];
+        float alpha = texel[3];
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            float value = alpha > 0.0f ? std::min(texel[c] / alpha, 1.0f) : 0.0f;
+            if (srgb)
+                value = fromLinear(value);
+            (*texels)[i * 4 + c] = (unsigned char)clampByte((int)(value * 255.0f + 0.5f));
+        }
+        (*texels)[i * 4 + 3] = (unsigned char)clampByte((int)(alpha * 255.0f + 0.5f));
+    }
+}
+
+void TextureEncoder::encode(const std::vector<unsigned char>& texels, unsigned int width, unsigned int height,
+                            EncoderArguments::TextureFormat format, std::vector<unsigned char>* data)
+{
+    if (format == EncoderArguments::TEXTUREFORMAT_RGBA)
+    {
+        *data = texels;
+        return;
+    }
+
+    unsigned int blockSize = format == EncoderArguments::TEXTUREFORMAT_BC1 || format == EncoderArguments::TEXTUREFORMAT_ETC2 ? 8 : 16;
+    unsigned int blocksWide = (width + 3) / 4;
+    unsigned int blocksHigh = (height + 3) / 4;
+    data->resize(blocksWide * blocksHigh * blockSize);
+    parallelFor(blocksHigh, [&](unsigned int by)
+    {
+        unsigned char block[64];
+        for (unsigned int bx = 0; bx < blocksWide; ++bx)
+        {
+            getBlock(texels, width, height, bx, by, block);
+            unsigned char* output = &(*data)[(by * blocksWide + bx) * blockSize];
+            switch (format)
+            {
+            case EncoderArguments::TEXTUREFORMAT_BC1:
+                encodeBC1(block, output);
+                break;
+            case EncoderArguments::TEXTUREFORMAT_BC3:
+                encodeBC3Alpha(block, output);
+                encodeBC1(block, output + 8);
+                break;
+            case EncoderArguments::TEXTUREFORMAT_ETC2:
+                encodeETC(block, output);
+                break;
+            default:
+                encodeEAC(block, output);
+                encodeETC(block, output + 8);
+                break;
+            }
+        }
+    });
+}
@@ -0,0 +1,71 @@
+#ifndef TEXTUREENCODER_H_
+#define TEXTUREENCODER_H_
+
+#include "Base.h"
+#include "EncoderArguments.h"
+
+/**
+ * Class for encoding a PNG image into a KTX texture with its mipmap chain.
+ *
+ * The engine's Texture::create() loads a '.ktx' file by uploading its levels straight from
+ * the file, which replaces decoding the PNG and generating the mipmaps on the device.
+ *
+ * Each mipmap level is filtered from the previous one with a [1 3 3 1] kernel, with the
+ * colors weighted by their alpha so that transparent texels do not bleed into their
+ * neighbours, and in linear space when the image is in sRGB. The levels are written as
+ * RGBA8 or compressed to BC1, BC3, ETC2 RGB8 or ETC2 RGBA8 EAC blocks, and the file is a
+ * KTX 1.1 file of the matching GL internal format.
+ */
+class TextureEncoder
+{
+public:
+
+    /**
+     * Constructor.
+     */
+    TextureEncoder();
+
+    /**
+     * Destructor.
+     */
+    ~TextureEncoder();
+
+    /**
+     * Reads the image, generates its mipmaps and writes out the texture.
+     *
+     * @param arguments The encoder arguments.
+     *
+     * @return True if the texture was written, false otherwise.
+     */
+    bool write(const gameplay::EncoderArguments& arguments);
+
+private:
+
+    /**
+     * A level of the mipmap chain, as linear RGBA with the colors multiplied by alpha.
+     */
+    struct Level
+    {
+        unsigned int width;
+        unsigned int height;
+        std::vector<float> texels;
+    };
+
+    /**
+     * Filters the next smaller level of the mipmap chain from a level.
+     */
+    static void downsample(const Level& source, Level* destination);
+
+    /**
+     * Converts a level into RGBA8 texels in the color space of the image.
+     */
+    static void getTexels(const Level& level, bool srgb, std::vector<unsigned char>* texels);
+
+    /**
+     * Encodes RGBA8 texels into the blocks or texels of the texture format.
+     */
+    static void encode(const std::vector<unsigned char>& texels, unsigned int width, unsigned int height,
+                       gameplay::EncoderArguments::TextureFormat format, std::vector<unsigned char>* data);
+};
+
+#endif
@@ -0,0 +1,48 @@
+#include "Base.h"
+#include "ThreadPool.h"
+#include "EncoderArguments.h"
+
+#include <atomic>
+#include <thread>
+
+namespace gameplay
+{
+
+unsigned int getWorkerCount()
+{
+    EncoderArguments* arguments = EncoderArguments::getInstance();
+    if (arguments && arguments->getWorkerCount() > 0)
+        return arguments->getWorkerCount();
+    unsigned int count = std::thread::hardware_concurrency();
+    return count > 0 ? count : 1;
+}
+
+void parallelFor(unsigned int count, const std::function<void(unsigned int)>& function)
+{
+    unsigned int threadCount = std::min(getWorkerCount(), count);
+    if (threadCount <= 1)
+    {
+        for (unsigned int i = 0; i < count; ++i)
+            function(i);
+        return;
+    }
+
+    // Each thread takes the next index until all have been taken, so uneven work is balanced.
+    std::atomic<unsigned int> next(0);
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (unsigned int i = 1; i < threadCount; ++i)
+    {
+        threads.push_back(std::thread([&]()
+        {
+            for (unsigned int index = next++; index < count; index = next++)
+                function(index);
+        }));
+    }
+    for (unsigned int index = next++; index < count; index = next++)
+        function(index);
+    for (size_t i = 0; i < threads.size(); ++i)
+        threads[i].join();
+}
+
+}
@@ -0,0 +1,27 @@
+#ifndef THREADPOOL_H_
+#define THREADPOOL_H_
+
+#include <functional>
+
+namespace gameplay
+{
+
+/**
+ * Returns the number of threads that parallelFor() runs on, which is the count of the -j
+ * option or the number of hardware threads.
+ */
+unsigned int getWorkerCount();
+
+/**
+ * Calls the function for each index of [0, count) on the worker threads, and waits for all of the calls to return.
+ *
+ * The calls for different indices may run at the same time, so the function must only modify what belongs to its index.
+ *
+ * @param count The number of indices.
+ * @param function The function to call with each index.
+ */
+void parallelFor(unsigned int count, const std::function<void(unsigned int)>& function);
+
+}
+
+#endif
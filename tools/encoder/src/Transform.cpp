@@ -67,4 +67,19 @@ unsigned int Transform::getPropertySize(unsigned int prop)
     }
 }
 
-}
\ No newline at end of file
+int Transform::getRotationOffset(unsigned int prop)
+{
+    switch (prop)
+    {
+        case ANIMATE_ROTATE:
+        case ANIMATE_ROTATE_TRANSLATE:
+            return 0;
+        case ANIMATE_SCALE_ROTATE:
+        case ANIMATE_SCALE_ROTATE_TRANSLATE:
+            return 3;
+        default:
+            return -1;
+    }
+}
+
+}
@@ -62,6 +62,12 @@ public:
      */
     static unsigned int getPropertySize(unsigned int prop);
 
+    /**
+     * Returns the offset of the rotation quaternion within the floats of the given property
+     * or -1 if the property has no rotation.
+     */
+    static int getRotationOffset(unsigned int prop);
+
 };
 
 }
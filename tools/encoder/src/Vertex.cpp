@@ -69,6 +69,38 @@ void Vertex::writeBinary(FILE* file) const
     }
 }
 
+void Vertex::getValues(unsigned int usage, float* values) const
+{
+    switch (usage)
+    {
+    case POSITION:
+        memcpy(values, &position.x, sizeof(float) * POSITION_COUNT);
+        break;
+    case NORMAL:
+        memcpy(values, &normal.x, sizeof(float) * NORMAL_COUNT);
+        break;
+    case TANGENT:
+        memcpy(values, &tangent.x, sizeof(float) * TANGENT_COUNT);
+        break;
+    case BINORMAL:
+        memcpy(values, &binormal.x, sizeof(float) * BINORMAL_COUNT);
+        break;
+    case COLOR:
+        memcpy(values, &diffuse.x, sizeof(float) * DIFFUSE_COUNT);
+        break;
+    case BLENDWEIGHTS:
+        memcpy(values, &blendWeights.x, sizeof(float) * BLEND_WEIGHTS_COUNT);
+        break;
+    case BLENDINDICES:
+        memcpy(values, &blendIndices.x, sizeof(float) * BLEND_INDICES_COUNT);
+        break;
+    default:
+        if (usage >= TEXCOORD0 && usage <= TEXCOORD7)
+            memcpy(values, &texCoord[usage - TEXCOORD0].x, sizeof(float) * TEXCOORD_COUNT);
+        break;
+    }
+}
+
 void Vertex::writeText(FILE* file) const
 {
     write("// position\n", file);
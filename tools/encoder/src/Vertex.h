@@ -106,6 +106,14 @@ public:
      */
     void writeBinary(FILE* file) const;
 
+    /**
+     * Gets the values of this vertex for the given vertex element usage.
+     *
+     * @param usage The VertexUsage of the values.
+     * @param values Filled with up to 4 values, the rest of which are left as they are.
+     */
+    void getValues(unsigned int usage, float* values) const;
+
     /**
      * Writes this vertex to a text file stream.
      */
@@ -4,9 +4,55 @@
 namespace gameplay
 {
 
+// Converts a float to the nearest half float.
+static unsigned short toHalf(float value)
+{
+    unsigned int bits;
+    memcpy(&bits, &value, sizeof(float));
+    unsigned int sign = (bits >> 16) & 0x8000;
+    unsigned int mantissa = bits & 0x7FFFFF;
+    int exponent = (int)((bits >> 23) & 0xFF) - 127 + 15;
+    if (((bits >> 23) & 0xFF) == 0xFF)
+        return (unsigned short)(sign | 0x7C00 | (mantissa ? 0x200 : 0));
+    if (exponent >= 31)
+        return (unsigned short)(sign | 0x7C00);
+    if (exponent <= 0)
+    {
+        // Values below the smallest normal half float become denormals or zero.
+        if (exponent < -10)
+            return (unsigned short)sign;
+        mantissa |= 0x800000;
+        unsigned int shift = (unsigned int)(14 - exponent);
+        unsigned int half = mantissa >> shift;
+        if ((mantissa >> (shift - 1)) & 1)
+            ++half;
+        return (unsigned short)(sign | half);
+    }
+    unsigned int half = sign | ((unsigned int)exponent << 10) | (mantissa >> 13);
+    if (mantissa & 0x1000)
+        ++half;
+    return (unsigned short)half;
+}
+
+// Rounds a value to the nearest integer within the given range.
+static int quantize(float value, float minValue, float maxValue)
+{
+    return (int)floorf(std::min(std::max(value, minValue), maxValue) + 0.5f);
+}
+
 VertexElement::VertexElement(unsigned int t, unsigned int c) :
     usage(t),
-    size(c)
+    size(c),
+    type(VERTEX_FLOAT),
+    normalized(false)
+{
+}
+
+VertexElement::VertexElement(unsigned int t, unsigned int c, unsigned int type, bool normalized) :
+    usage(t),
+    size(c),
+    type(type),
+    normalized(normalized)
 {
 }
 
@@ -23,12 +69,16 @@ void VertexElement::writeBinary(FILE* file)
     Object::writeBinary(file);
     write(usage, file);
     write(size, file);
+    write(type, file);
+    write(normalized, file);
 }
 void VertexElement::writeText(FILE* file)
 {
     fprintElementStart(file);
     fprintfElement(file, "usage", usageStr(usage));
     fprintfElement(file, "size", size);
+    fprintfElement(file, "type", typeStr(type));
+    fprintfElement(file, "normalized", normalized ? "true" : "false");
     fprintElementEnd(file);
 }
 
@@ -73,4 +123,88 @@ const char* VertexElement::usageStr(unsigned int usage)
     }
 }
 
+const char* VertexElement::typeStr(unsigned int type)
+{
+    switch (type)
+    {
+        case VERTEX_FLOAT:
+            return "FLOAT";
+        case VERTEX_HALF_FLOAT:
+            return "HALF_FLOAT";
+        case VERTEX_BYTE:
+            return "BYTE";
+        case VERTEX_UNSIGNED_BYTE:
+            return "UNSIGNED_BYTE";
+        case VERTEX_SHORT:
+            return "SHORT";
+        case VERTEX_UNSIGNED_SHORT:
+            return "UNSIGNED_SHORT";
+        case VERTEX_INT_2_10_10_10_REV:
+            return "INT_2_10_10_10_REV";
+        default:
+            return "";
+    }
+}
+
+unsigned int VertexElement::byteSize() const
+{
+    switch (type)
+    {
+        case VERTEX_BYTE:
+        case VERTEX_UNSIGNED_BYTE:
+            return size;
+        case VERTEX_HALF_FLOAT:
+        case VERTEX_SHORT:
+        case VERTEX_UNSIGNED_SHORT:
+            return size * 2;
+        case VERTEX_INT_2_10_10_10_REV:
+            return 4;
+        default:
+            return size * sizeof(float);
+    }
+}
+
+void VertexElement::writeBinaryValues(const float* values, FILE* file) const
+{
+    switch (type)
+    {
+        case VERTEX_HALF_FLOAT:
+            for (unsigned int i = 0; i < size; ++i)
+                write(toHalf(values[i]), file);
+            break;
+        case VERTEX_BYTE:
+            for (unsigned int i = 0; i < size; ++i)
+                write((char)quantize(normalized ? values[i] * 127.0f : values[i], -128.0f, 127.0f), file);
+            break;
+        case VERTEX_UNSIGNED_BYTE:
+            for (unsigned int i = 0; i < size; ++i)
+                write((unsigned char)quantize(normalized ? values[i] * 255.0f : values[i], 0.0f, 255.0f), file);
+            break;
+        case VERTEX_SHORT:
+            for (unsigned int i = 0; i < size; ++i)
+                write((unsigned short)(short)quantize(normalized ? values[i] * 32767.0f : values[i], -32768.0f, 32767.0f), file);
+            break;
+        case VERTEX_UNSIGNED_SHORT:
+            for (unsigned int i = 0; i < size; ++i)
+                write((unsigned short)quantize(normalized ? values[i] * 65535.0f : values[i], 0.0f, 65535.0f), file);
+            break;
+        case VERTEX_INT_2_10_10_10_REV:
+            {
+                // X, Y and Z in the low 30 bits and W in the high 2 bits, as signed values.
+                unsigned int packed = 0;
+                for (unsigned int i = 0; i < size && i < 4; ++i)
+                {
+                    float limit = i < 3 ? 511.0f : 1.0f;
+                    int bits = quantize(normalized ? values[i] * limit : values[i], -limit - 1.0f, limit);
+                    packed |= ((unsigned int)bits & (i < 3 ? 0x3FF : 0x3)) << (i * 10);
+                }
+                write(packed, file);
+            }
+            break;
+        default:
+            write(values, (int)size, file);
+            break;
+    }
+}
+
 }
@@ -15,6 +15,16 @@ public:
      */
     VertexElement(unsigned int t, unsigned int c);
 
+    /**
+     * Constructor.
+     *
+     * @param t The usage of the element.
+     * @param c The number of values of the element.
+     * @param type The VertexType of the values.
+     * @param normalized Whether values of integer types are normalized.
+     */
+    VertexElement(unsigned int t, unsigned int c, unsigned int type, bool normalized);
+
     /**
      * Destructor.
      */
@@ -26,8 +36,22 @@ public:
 
     static const char* usageStr(unsigned int usage);
 
+    static const char* typeStr(unsigned int type);
+
+    /**
+     * Returns the size of the element in bytes.
+     */
+    unsigned int byteSize() const;
+
+    /**
+     * Writes the values of the element, converted to its type, to the binary file stream.
+     */
+    void writeBinaryValues(const float* values, FILE* file) const;
+
     unsigned int usage;
     unsigned int size;
+    unsigned int type;
+    bool normalized;
 };
 
 }
@@ -2,10 +2,18 @@
 #include "FBXSceneEncoder.h"
 #include "TMXSceneEncoder.h"
 #include "TTFFontEncoder.h"
+#include "LuaEncoder.h"
+#include "ArchiveEncoder.h"
+#include "BuildCache.h"
+#include "PropertiesEncoder.h"
+#include "TextureEncoder.h"
 #include "GPBDecoder.h"
 #include "EncoderArguments.h"
 #include "NormalMapGenerator.h"
 #include "Font.h"
+#include "ThreadPool.h"
+
+#include <atomic>
 
 using namespace gameplay;
 
@@ -65,39 +73,83 @@ static std::vector<unsigned int> promptUserFontSize()
     return fontSizes;
 }
 
+/**
+ * Quotes a command line argument for the shell.
+ */
+static std::string quoteArgument(const std::string& argument)
+{
+#ifdef WIN32
+    std::string quoted("\"");
+    for (size_t i = 0; i < argument.length(); ++i)
+    {
+        if (argument[i] == '"')
+            quoted += '\\';
+        quoted += argument[i];
+    }
+    return quoted + "\"";
+#else
+    std::string quoted("'");
+    for (size_t i = 0; i < argument.length(); ++i)
+    {
+        if (argument[i] == '\'')
+            quoted += "'\\''";
+        else
+            quoted += argument[i];
+    }
+    return quoted + "'";
+#endif
+}
 
 /**
- * Main application entry point.
- *
- * @param argc The number of command line arguments
- * @param argv The array of command line arguments.
+ * Encodes each of many input files in a process of its own, running as many of them at once as there are worker threads.
  *
- * usage:   gameplay-encoder[options] <file_list>
- * example: gameplay-encoder C:/assets/duck.fbx
- * example: gameplay-encoder -i boy duck.fbx
+ * Every encoder keeps its state in singletons, and the FBX SDK is not safe to use from
+ * several threads, so the inputs are encoded by separate processes rather than threads.
  *
- * @stod: Improve argument parsing.
+ * @return 0 if every file was encoded, -1 otherwise.
  */
-int main(int argc, const char** argv)
+static int encodeFiles(const char* executable, const EncoderArguments& arguments)
 {
-    EncoderArguments arguments(argc, argv);
+    const std::vector<std::string>& paths = arguments.getInputFilePaths();
+    unsigned int workerCount = getWorkerCount();
+    unsigned int processCount = std::min(workerCount, (unsigned int)paths.size());
 
-    if (arguments.parseErrorOccured())
+    // The worker threads are shared between the processes running at once.
+    std::string options;
+    for (size_t i = 0, count = arguments.getOptions().size(); i < count; ++i)
     {
-        arguments.printUsage();
-        return 0;
+        options += " ";
+        options += quoteArgument(arguments.getOptions()[i]);
     }
+    std::ostringstream threads;
+    threads << " -j " << std::max(workerCount / processCount, 1u);
+    options += threads.str();
 
-    // Check if the file exists.
-    if (!arguments.fileExists())
+    LOG(1, "Encoding %u files with %u processes.\n", (unsigned int)paths.size(), processCount);
+    std::atomic<unsigned int> failures(0);
+    parallelFor((unsigned int)paths.size(), [&](unsigned int i)
     {
-        LOG(1, "Error: File not found: %s\n", arguments.getFilePathPointer());
-        return -1;
-    }
-
-    // File exists
-    LOG(1, "Encoding file: %s\n", arguments.getFilePathPointer());
+        std::string command = quoteArgument(executable) + options + " " + quoteArgument(paths[i]);
+#ifdef WIN32
+        // cmd.exe strips the outer quotes of a command that starts with a quoted path.
+        command = "\"" + command + "\"";
+#endif
+        if (system(command.c_str()) != 0)
+        {
+            LOG(1, "Error: Failed to encode file: %s\n", paths[i].c_str());
+            ++failures;
+        }
+    });
+    return failures > 0 ? -1 : 0;
+}
 
+/**
+ * Encodes the input file with the encoder of its format.
+ *
+ * @return 0 if the file was encoded, -1 otherwise.
+ */
+static int encodeFile(const EncoderArguments& arguments)
+{
     switch (arguments.getFileFormat())
     {
     case EncoderArguments::FILEFORMAT_FBX:
@@ -135,7 +187,7 @@ int main(int argc, const char** argv)
                 }
             }
             std::string id = getBaseName(arguments.getFilePath());
-            writeFont(arguments.getFilePath().c_str(), arguments.getOutputFilePath().c_str(), fontSizes, id.c_str(), arguments.fontPreviewEnabled(), fontFormat);
+            writeFont(arguments.getFilePath().c_str(), arguments.getOutputFilePath().c_str(), fontSizes, id.c_str(), arguments.fontPreviewEnabled(), fontFormat, arguments.fontFastDistanceFieldEnabled());
             break;
         }
     case EncoderArguments::FILEFORMAT_GPB:
@@ -155,6 +207,12 @@ int main(int argc, const char** argv)
                 NormalMapGenerator generator(arguments.getFilePath().c_str(), arguments.getOutputFilePath().c_str(), x, y, arguments.getHeightmapWorldSize());
                 generator.generate();
             }
+            else if (arguments.getFileFormat() == EncoderArguments::FILEFORMAT_PNG)
+            {
+                TextureEncoder textureEncoder;
+                if (!textureEncoder.write(arguments))
+                    return -1;
+            }
             else
             {
                 LOG(1, "Error: Nothing to do for specified file format. Did you forget an option?\n");
@@ -162,6 +220,27 @@ int main(int argc, const char** argv)
             }
             break;
         }
+    case EncoderArguments::FILEFORMAT_LUA:
+        {
+            LuaEncoder luaEncoder;
+            if (!luaEncoder.write(arguments))
+                return -1;
+            break;
+        }
+    case EncoderArguments::FILEFORMAT_PROPERTIES:
+        {
+            PropertiesEncoder propertiesEncoder;
+            if (!propertiesEncoder.write(arguments))
+                return -1;
+            break;
+        }
+    case EncoderArguments::FILEFORMAT_DIRECTORY:
+        {
+            ArchiveEncoder archiveEncoder;
+            if (!archiveEncoder.write(arguments))
+                return -1;
+            break;
+        }
    default:
         {
             LOG(1, "Error: Unsupported file format: %s\n", arguments.getFilePathPointer());
@@ -171,3 +250,62 @@ int main(int argc, const char** argv)
 
     return 0;
 }
+
+/**
+ * Main application entry point.
+ *
+ * @param argc The number of command line arguments
+ * @param argv The array of command line arguments.
+ *
+ * usage:   gameplay-encoder[options] <file_list>
+ * example: gameplay-encoder C:/assets/duck.fbx
+ * example: gameplay-encoder -i boy duck.fbx
+ *
+ * @stod: Improve argument parsing.
+ */
+int main(int argc, const char** argv)
+{
+    EncoderArguments arguments(argc, argv);
+
+    if (arguments.parseErrorOccured())
+    {
+        arguments.printUsage();
+        return 0;
+    }
+
+    if (arguments.getInputFilePaths().size() > 1)
+    {
+        return encodeFiles(argv[0], arguments);
+    }
+
+    // Check if the file exists.
+    if (!arguments.fileExists())
+    {
+        LOG(1, "Error: File not found: %s\n", arguments.getFilePathPointer());
+        return -1;
+    }
+
+    // Skip the file if the cache holds its outputs for the same input, dependencies and arguments.
+    BuildCache* cache = NULL;
+    if (arguments.getCacheDirectory() && BuildCache::isCacheable(arguments))
+    {
+        cache = new BuildCache(arguments.getCacheDirectory(), arguments);
+        if (cache->restore())
+        {
+            delete cache;
+            return 0;
+        }
+    }
+
+    // File exists
+    LOG(1, "Encoding file: %s\n", arguments.getFilePathPointer());
+
+    int result = encodeFile(arguments);
+    if (cache)
+    {
+        if (result == 0)
+            cache->store();
+        delete cache;
+    }
+    return result;
+}
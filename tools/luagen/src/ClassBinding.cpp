@@ -5,9 +5,11 @@ static void generateInstanceGetter(ostream& o, const string& classname, const st
 {
     o << "static " << classname << "* getInstance(lua_State* state)\n";
     o << "{\n";
-    o << "    void* userdata = luaL_checkudata(state, 1, \"" << uniquename << "\");\n";
-    o << "    luaL_argcheck(state, userdata != NULL, 1, \"\'" << uniquename << "\' expected.\");\n";
-    o << "    return (" << classname << "*)((" << LUA_OBJECT << "*)userdata)->instance;\n";
+    // Accept instances of derived classes too, so that derived classes can register this
+    // class's binding functions for the members they inherit instead of duplicating them.
+    o << "    void* instance = gameplay::ScriptUtil::getUserDataObjectPointer(1, \"" << uniquename << "\");\n";
+    o << "    luaL_argcheck(state, instance != NULL, 1, \"\'" << uniquename << "\' expected.\");\n";
+    o << "    return (" << classname << "*)instance;\n";
     o << "}\n\n";
 }
 
@@ -177,6 +179,14 @@ void ClassBinding::write(string dir, const set<string>& includes, string* bindin
             hasMembers = true;
         }
 
+        // Declare the binding functions of base classes that this class shares.
+        if (inherited.size() > 0)
+        {
+            for (iter = inherited.begin(); iter != inherited.end(); iter++)
+                o << "extern int " << iter->second[0].getFunctionName() << "(lua_State* state);\n";
+            o << "\n";
+        }
+
         // Write out the function used to get the instance for
         // calling member functions and variables.
         generateInstanceGetter(o, classname, uniquename);
@@ -260,6 +270,12 @@ void ClassBinding::write(string dir, const set<string>& includes, string* bindin
             if (hasMembers)
                 break;
         }
+        for (iter = inherited.begin(); iter != inherited.end() && !hasMembers; iter++)
+        {
+            hasMembers = (iter->second[0].type == FunctionBinding::MEMBER_FUNCTION ||
+                iter->second[0].type == FunctionBinding::MEMBER_CONSTANT ||
+                iter->second[0].type == FunctionBinding::MEMBER_VARIABLE);
+        }
         if (hasMembers)
         {
             o << "    const luaL_Reg lua_members[] = \n";
@@ -280,6 +296,15 @@ void ClassBinding::write(string dir, const set<string>& includes, string* bindin
                     }
                 }
             }
+            for (iter = inherited.begin(); iter != inherited.end(); iter++)
+            {
+                if (iter->second[0].type == FunctionBinding::MEMBER_FUNCTION ||
+                    iter->second[0].type == FunctionBinding::MEMBER_CONSTANT ||
+                    iter->second[0].type == FunctionBinding::MEMBER_VARIABLE)
+                {
+                    o << "        {\"" << iter->second[0].name << "\", " << iter->second[0].getFunctionName() << "},\n";
+                }
+            }
             if (relatives.size() > 0)
             {
                 // Register 'to' conversion function
@@ -312,6 +337,12 @@ void ClassBinding::write(string dir, const set<string>& includes, string* bindin
             if (hasStatics)
                 break;
         }
+        for (iter = inherited.begin(); iter != inherited.end() && !hasStatics; iter++)
+        {
+            hasStatics = (iter->second[0].type == FunctionBinding::STATIC_FUNCTION ||
+                iter->second[0].type == FunctionBinding::STATIC_CONSTANT ||
+                iter->second[0].type == FunctionBinding::STATIC_VARIABLE);
+        }
         if (hasStatics)
         {
             o << "    const luaL_Reg lua_statics[] = \n";
@@ -330,6 +361,15 @@ void ClassBinding::write(string dir, const set<string>& includes, string* bindin
                     }
                 }
             }
+            for (iter = inherited.begin(); iter != inherited.end(); iter++)
+            {
+                if (iter->second[0].type == FunctionBinding::STATIC_FUNCTION ||
+                    iter->second[0].type == FunctionBinding::STATIC_CONSTANT ||
+                    iter->second[0].type == FunctionBinding::STATIC_VARIABLE)
+                {
+                    o << "        {\"" << iter->second[0].name << "\", " << iter->second[0].getFunctionName() << "},\n";
+                }
+            }
             o << "        {NULL, NULL}\n";
             o << "    };\n";
         }
@@ -28,6 +28,8 @@ struct ClassBinding
 
     /** Holds all the public function bindings of the class. */
     map<string, vector<FunctionBinding> > bindings;
+    /** Holds the bindings of base class functions that the class registers as they are, by the class's function name. */
+    map<string, vector<FunctionBinding> > inherited;
     /** Holds bindings for hidden functions of the class (protected/private). */
     map<string, vector<FunctionBinding> > hidden;
     /** Holds the name(s) of the derived class(es). */
@@ -11,6 +11,8 @@ static inline void outputBindingInvocation(ostream& o, const FunctionBinding& b,
 static inline void outputGetParam(ostream& o, const FunctionBinding::Param& p, int i, int indentLevel, bool offsetIndex, int numBindings);
 static inline void outputMatchedBinding(ostream& o, const FunctionBinding& b, unsigned int paramCount, unsigned int indentLevel, int numBindings);
 static inline void outputReturnValue(ostream& o, const FunctionBinding& b, int indentLevel);
+static inline bool isValueObject(const FunctionBinding::Param& p);
+static inline void outputNewObject(ostream& o, const FunctionBinding::Param& p);
 static inline std::string getTypeName(const FunctionBinding::Param& param);
 
 FunctionBinding::Param::Param(FunctionBinding::Param::Type type, Kind kind, const string& info) : 
@@ -77,7 +79,8 @@ void FunctionBinding::write(ostream& o, const vector<FunctionBinding>& bindings)
     GP_ASSERT(bindings.size() > 0);
 
     // Print the function signature.
-    o << "static int " << bindings[0].getFunctionName() << "(lua_State* state)\n";
+    // Binding functions have external linkage so that derived classes can share them.
+    o << "int " << bindings[0].getFunctionName() << "(lua_State* state)\n";
     o << "{\n";
 
     if (bindings.size() == 1 && bindings[0].type == FunctionBinding::MEMBER_VARIABLE)
@@ -128,7 +131,9 @@ void FunctionBinding::write(ostream& o, const vector<FunctionBinding>& bindings)
                 o << "        void* returnPtr = (void*)instance->" << bindings[0].name << ";\n";
                 break;
             case FunctionBinding::Param::KIND_VALUE:
-                o << "        void* returnPtr = (void*)new " << bindings[0].returnParam << "(instance->" << bindings[0].name << ");\n";
+                o << "        ";
+                outputNewObject(o, bindings[0].returnParam);
+                o << "instance->" << bindings[0].name << ");\n";
                 break;
             case FunctionBinding::Param::KIND_REFERENCE:
                 o << "        void* returnPtr = (void*)&(instance->" << bindings[0].name << ");\n";
@@ -202,7 +207,9 @@ void FunctionBinding::write(ostream& o, const vector<FunctionBinding>& bindings)
                 o << bindings[0].name << ");\n";
                 break;
             case FunctionBinding::Param::KIND_VALUE:
-                o << "        void* returnPtr = (void*)new " << bindings[0].returnParam << "(";
+                o << "        ";
+                outputNewObject(o, bindings[0].returnParam);
+                o << "";
                 if (bindings[0].classname.size() > 0)
                     o << bindings[0].classname << "::";
                 o << bindings[0].name << ");\n";
@@ -248,7 +255,9 @@ void FunctionBinding::write(ostream& o, const vector<FunctionBinding>& bindings)
                 o << "    void* returnPtr = (void*)instance->" << bindings[0].name << ";\n";
                 break;
             case FunctionBinding::Param::KIND_VALUE:
-                o << "    void* returnPtr = (void*)new " << bindings[0].returnParam << "(instance->" << bindings[0].name << ");\n";
+                o << "    ";
+                outputNewObject(o, bindings[0].returnParam);
+                o << "instance->" << bindings[0].name << ");\n";
                 break;
             case FunctionBinding::Param::KIND_REFERENCE:
                 o << "    void* returnPtr = (void*)&(instance->" << bindings[0].name << ");\n";
@@ -288,7 +297,9 @@ void FunctionBinding::write(ostream& o, const vector<FunctionBinding>& bindings)
                 o << bindings[0].name << ");\n";
                 break;
             case FunctionBinding::Param::KIND_VALUE:
-                o << "    void* returnPtr = (void*)new " << bindings[0].returnParam << "(";
+                o << "    ";
+                outputNewObject(o, bindings[0].returnParam);
+                o << "";
                 if (bindings[0].classname.size() > 0)
                     o << bindings[0].classname << "::";
                 o << bindings[0].name << ");\n";
@@ -337,6 +348,17 @@ void FunctionBinding::write(ostream& o, const vector<FunctionBinding>& bindings)
         o << "    // Get the number of parameters.\n";
         o << "    int paramCount = lua_gettop(state);\n\n";
 
+        // Get the Lua type of each parameter once, so that matching
+        // the overloads only compares the cached types.
+        unsigned int maxParamCount = paramCounts.rbegin()->first;
+        if (maxParamCount > 0)
+        {
+            o << "    // Get the types of the parameters.\n";
+            o << "    int paramTypes[" << maxParamCount << "];\n";
+            o << "    for (int i = 0; i < paramCount && i < " << maxParamCount << "; i++)\n";
+            o << "        paramTypes[i] = lua_type(state, i + 1);\n\n";
+        }
+
         // Retrieve all the parameters and attempt to match them to a valid binding,
         // notifying the user if the number of parameters is invalid.
         o << "    // Attempt to match the parameters to a valid binding.\n";
@@ -501,9 +523,11 @@ ostream& operator<<(ostream& o, const FunctionBinding::Param& param)
 
 static inline void outputLuaTypeCheckInstance(ostream& o)
 {
-    o << "(lua_type(state, 1) == LUA_TUSERDATA)";
+    o << "(paramTypes[0] == LUA_TUSERDATA)";
 }
 
+// Checks the type of a parameter against the types that the binding
+// read off the stack once, for the 1-based stack index of the parameter.
 static inline void outputLuaTypeCheck(ostream& o, int index, const FunctionBinding::Param& p)
 {
     switch (p.type)
@@ -511,12 +535,12 @@ static inline void outputLuaTypeCheck(ostream& o, int index, const FunctionBindi
     case FunctionBinding::Param::TYPE_BOOL:
         if (p.kind == FunctionBinding::Param::KIND_POINTER) 
         {
-            o << "(lua_type(state, " << index << ") == LUA_TTABLE || ";
-            o << "lua_type(state, " << index << ") == LUA_TLIGHTUSERDATA)";
+            o << "(paramTypes[" << index - 1 << "] == LUA_TTABLE || ";
+            o << "paramTypes[" << index - 1 << "] == LUA_TLIGHTUSERDATA)";
         }
         else
         {
-            o << "lua_type(state, " << index << ") == LUA_TBOOLEAN";
+            o << "paramTypes[" << index - 1 << "] == LUA_TBOOLEAN";
         }
         break;
     case FunctionBinding::Param::TYPE_CHAR:
@@ -531,33 +555,33 @@ static inline void outputLuaTypeCheck(ostream& o, int index, const FunctionBindi
     case FunctionBinding::Param::TYPE_DOUBLE:
         if (p.kind == FunctionBinding::Param::KIND_POINTER) 
         {
-            o << "(lua_type(state, " << index << ") == LUA_TTABLE || ";
-            o << "lua_type(state, " << index << ") == LUA_TLIGHTUSERDATA)";
+            o << "(paramTypes[" << index - 1 << "] == LUA_TTABLE || ";
+            o << "paramTypes[" << index - 1 << "] == LUA_TLIGHTUSERDATA)";
         }
         else
         {
-            o << "lua_type(state, " << index << ") == LUA_TNUMBER";
+            o << "paramTypes[" << index - 1 << "] == LUA_TNUMBER";
         }
         break;
     case FunctionBinding::Param::TYPE_STRING:
-        o << "(lua_type(state, " << index << ") == LUA_TSTRING || ";
-        o << "lua_type(state, " << index << ") == LUA_TNIL)";
+        o << "(paramTypes[" << index - 1 << "] == LUA_TSTRING || ";
+        o << "paramTypes[" << index - 1 << "] == LUA_TNIL)";
         break;
     case FunctionBinding::Param::TYPE_ENUM:
-        o << "lua_type(state, " << index << ") == LUA_TNUMBER";
+        o << "paramTypes[" << index - 1 << "] == LUA_TNUMBER";
         break;
     case FunctionBinding::Param::TYPE_OBJECT:
-        o << "(lua_type(state, " << index << ") == LUA_TUSERDATA || ";
+        o << "(paramTypes[" << index - 1 << "] == LUA_TUSERDATA || ";
         if (p.kind == FunctionBinding::Param::KIND_POINTER)
-            o << "lua_type(state, " << index << ") == LUA_TTABLE || ";
-        o << "lua_type(state, " << index << ") == LUA_TNIL)";
+            o << "paramTypes[" << index - 1 << "] == LUA_TTABLE || ";
+        o << "paramTypes[" << index - 1 << "] == LUA_TNIL)";
         break;
     case FunctionBinding::Param::TYPE_CONSTRUCTOR:
     case FunctionBinding::Param::TYPE_DESTRUCTOR:
     case FunctionBinding::Param::TYPE_VOID:
     case FunctionBinding::Param::TYPE_VARARGS:
     default:
-        o << "lua_type(state, " << index << ") == LUA_TNONE";
+        o << "paramTypes[" << index - 1 << "] == LUA_TNONE";
     }
 }
 
@@ -630,13 +654,19 @@ static inline void outputBindingInvocation(ostream& o, const FunctionBinding& b,
         {
             needsExtraClosingBrace = true;
             indent(o, indentLevel);
-            switch (b.returnParam.kind)
+            if (b.returnParam.type == FunctionBinding::Param::TYPE_CONSTRUCTOR && isValueObject(b.returnParam))
+            {
+                string identifier = Generator::getInstance()->getIdentifier(b.returnParam.info);
+                o << "gameplay::ScriptUtil::pushValueObject<" << identifier << ">(\"";
+                o << Generator::getInstance()->getUniqueNameFromRef(b.returnParam.info) << "\", ";
+            }
+            else switch (b.returnParam.kind)
             {
             case FunctionBinding::Param::KIND_POINTER:
                 o << "void* returnPtr = ((void*)";
                 break;
             case FunctionBinding::Param::KIND_VALUE:
-                o << "void* returnPtr = (void*)new " << b.returnParam << "(";
+                outputNewObject(o, b.returnParam);
                 break;
             case FunctionBinding::Param::KIND_REFERENCE:
                 o << "void* returnPtr = (void*)&(";
@@ -663,7 +693,9 @@ static inline void outputBindingInvocation(ostream& o, const FunctionBinding& b,
         {
             if (b.returnParam.type == FunctionBinding::Param::TYPE_CONSTRUCTOR)
             {
-                o << "new " << Generator::getInstance()->getIdentifier(b.returnParam.info) << "(";
+                if (!isValueObject(b.returnParam))
+                    o << "new ";
+                o << Generator::getInstance()->getIdentifier(b.returnParam.info) << "(";
             }
             else
             {
@@ -694,6 +726,31 @@ static inline void outputBindingInvocation(ostream& o, const FunctionBinding& b,
     outputReturnValue(o, b, indentLevel);
 }
 
+static inline bool isValueObject(const FunctionBinding::Param& p)
+{
+    // Constructed objects and objects returned by value of classes marked with
+    // @script{value} are stored inline in their userdata instead of on the heap.
+    if ((p.type == FunctionBinding::Param::TYPE_OBJECT && p.kind == FunctionBinding::Param::KIND_VALUE) ||
+        p.type == FunctionBinding::Param::TYPE_CONSTRUCTOR)
+    {
+        return Generator::getInstance()->isValueType(Generator::getInstance()->getIdentifier(p.info));
+    }
+    return false;
+}
+
+static inline void outputNewObject(ostream& o, const FunctionBinding::Param& p)
+{
+    if (isValueObject(p))
+    {
+        o << "gameplay::ScriptUtil::pushValueObject<" << p << ">(\"";
+        o << Generator::getInstance()->getUniqueNameFromRef(p.info) << "\", ";
+    }
+    else
+    {
+        o << "void* returnPtr = (void*)new " << p << "(";
+    }
+}
+
 void writeObjectTemplateType(ostream& o, const FunctionBinding::Param& p)
 {
     o << getTypeName(p);
@@ -984,6 +1041,12 @@ static inline void outputReturnValue(ostream& o, const FunctionBinding& b, int i
         break;
     case FunctionBinding::Param::TYPE_OBJECT:
     case FunctionBinding::Param::TYPE_CONSTRUCTOR:
+        if (isValueObject(b.returnParam))
+        {
+            // Value objects are pushed by pushValueObject as they are created.
+            o << "// The object was pushed onto the stack when it was created.\n";
+            break;
+        }
         o << "if (returnPtr)\n";
         indent(o, indentLevel);
         o << "{\n";
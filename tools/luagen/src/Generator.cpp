@@ -150,6 +150,11 @@ bool Generator::isRef(string classname)
     return classname == REF_CLASS_NAME;
 }
 
+bool Generator::isValueType(string classname)
+{
+    return _valueTypes.find(classname) != _valueTypes.end();
+}
+
 string Generator::getCompoundName(XMLElement* node)
 {
     // Get the name of the namespace, class, struct, or file that we are processing.
@@ -435,6 +440,10 @@ void Generator::getClass(XMLElement* classNode, const string& name)
     // Store the mapping between the ref id and the class's fully qualified name.
     Generator::getInstance()->setIdentifier(refId, classBinding.classname);
 
+    // Check if instances of the class should be stored inline in their userdata.
+    if (getScriptFlag(classNode) == "value")
+        _valueTypes.insert(classBinding.classname);
+
     // Get the include header for the original class declaration.
     XMLElement* includeElement = classNode->FirstChildElement("includes");
     if (includeElement)
@@ -1048,7 +1057,7 @@ FunctionBinding::Param Generator::getParam(XMLElement* e, bool isVariable, strin
         {
             p = FunctionBinding::Param(FunctionBinding::Param::TYPE_UINT, kind);
         }
-        else if (typeStr == "unsigned long")
+        else if (typeStr == "unsigned long" || typeStr == "size_t")
         {
             p = FunctionBinding::Param(FunctionBinding::Param::TYPE_ULONG, kind);
         }
@@ -1142,94 +1151,131 @@ void Generator::resolveMembers(const ClassBinding& c)
 
         cb = &_classes[derivedClassName];
 
-        // Go through this class' bindings and add them to the current
-        // derived class if they are not already there (excluding constructors and destructors).
+        // Go through this class' bindings (including the ones it shares with its own
+        // base classes) and add them to the current derived class. Objects are only
+        // converted to the types of their direct base classes, so the bindings shared
+        // from further up the hierarchy are copied rather than shared again.
         for (iter = c.bindings.begin(); iter != c.bindings.end(); iter++)
         {
-            FunctionBinding b(cb->classname, cb->uniquename);
-            b.type = iter->second[0].type;
-            b.name = iter->second[0].name;
+            resolveMember(cb, iter->second, true);
+        }
+        for (iter = c.inherited.begin(); iter != c.inherited.end(); iter++)
+        {
+            resolveMember(cb, iter->second, false);
+        }
+
+        derived.push_back(cb);
+    }
+
+    // Go through the derived classes' bindings and resolve the members for their derived classes.
+    for (unsigned int i = 0; i < derived.size(); i++)
+    {
+        resolveMembers(*derived[i]);
+    }
+}
 
-            map<string, vector<FunctionBinding> >::iterator findIter = cb->bindings.find(b.getFunctionName());
-            map<string, vector<FunctionBinding> >::iterator hiddenIter = cb->hidden.find(b.getFunctionName());
-            if (findIter == cb->bindings.end() && hiddenIter == cb->hidden.end())
+void Generator::resolveMember(ClassBinding* cb, const vector<FunctionBinding>& bindings, bool share)
+{
+    FunctionBinding b(cb->classname, cb->uniquename);
+    b.type = bindings[0].type;
+    b.name = bindings[0].name;
+
+    // If another base class already shares a function with this name, the
+    // derived class needs its own binding to choose between them.
+    map<string, vector<FunctionBinding> >::iterator inheritedIter = cb->inherited.find(b.getFunctionName());
+    if (inheritedIter != cb->inherited.end())
+    {
+        for (unsigned int i = 0, iCount = inheritedIter->second.size(); i < iCount; i++)
+        {
+            FunctionBinding copy = inheritedIter->second[i];
+            copy.functionName = "";
+            copy.classname = cb->classname;
+            copy.uniquename = cb->uniquename;
+
+            cb->bindings[copy.getFunctionName()].push_back(copy);
+        }
+        cb->inherited.erase(inheritedIter);
+    }
+
+    map<string, vector<FunctionBinding> >::iterator findIter = cb->bindings.find(b.getFunctionName());
+    map<string, vector<FunctionBinding> >::iterator hiddenIter = cb->hidden.find(b.getFunctionName());
+    if (findIter == cb->bindings.end() && hiddenIter == cb->hidden.end())
+    {
+        // The derived class doesn't declare a function with this name, so it can
+        // register the base class's binding function as is (excluding constructors and destructors).
+        if (bindings[0].returnParam.type != FunctionBinding::Param::TYPE_CONSTRUCTOR &&
+            bindings[0].returnParam.type != FunctionBinding::Param::TYPE_DESTRUCTOR)
+        {
+            if (share)
             {
-                for (unsigned int i = 0, iCount = iter->second.size(); i < iCount; i++)
-                {
-                    if (iter->second[i].returnParam.type != FunctionBinding::Param::TYPE_CONSTRUCTOR &&
-                        iter->second[i].returnParam.type != FunctionBinding::Param::TYPE_DESTRUCTOR)
-                    {
-                        // Copy the binding, but set its function name to 
-                        // empty so that it is regenerated correctly.
-                        b = iter->second[i];
-                        b.functionName = "";
-                        b.classname = cb->classname;
-                        b.uniquename = cb->uniquename;
-
-                        cb->bindings[b.getFunctionName()].push_back(b);
-                    }
-                }
+                cb->inherited[b.getFunctionName()] = bindings;
             }
             else
             {
-                bool addBinding;
-                for (unsigned int i = 0, iCount = iter->second.size(); i < iCount; i++)
+                // Copy the bindings, but set their function name to
+                // empty so that they are regenerated correctly.
+                for (unsigned int i = 0, iCount = bindings.size(); i < iCount; i++)
                 {
-                    string name = iter->second[i].name;
+                    FunctionBinding copy = bindings[i];
+                    copy.functionName = "";
+                    copy.classname = cb->classname;
+                    copy.uniquename = cb->uniquename;
 
-                    addBinding = true;
-                    if (findIter != cb->bindings.end())
-                    {
-                        for (unsigned int j = 0, jCount = findIter->second.size(); j < jCount; j++)
-                        {
-                            if (FunctionBinding::signaturesMatch(iter->second[i], findIter->second[j]))
-                            {
-                                addBinding = false;
-                                break;
-                            }
-                        }
+                    cb->bindings[copy.getFunctionName()].push_back(copy);
+                }
+            }
+        }
+    }
+    else
+    {
+        bool addBinding;
+        for (unsigned int i = 0, iCount = bindings.size(); i < iCount; i++)
+        {
+            string name = bindings[i].name;
 
-                        // To call the base function, we have to qualify the call since
-                        // the derived class has a function with the same name and different parameters.
-                        if (addBinding)
-                            name = iter->second[i].classname + string("::") + iter->second[i].name;
-                    }
-                    if (hiddenIter != cb->hidden.end())
+            addBinding = true;
+            if (findIter != cb->bindings.end())
+            {
+                for (unsigned int j = 0, jCount = findIter->second.size(); j < jCount; j++)
+                {
+                    if (FunctionBinding::signaturesMatch(bindings[i], findIter->second[j]))
                     {
-                        for (unsigned int j = 0, jCount = hiddenIter->second.size(); j < jCount; j++)
-                        {
-                            if (FunctionBinding::signaturesMatch(iter->second[i], hiddenIter->second[j]))
-                            {
-                                addBinding = false;
-                                break;
-                            }
-                        }
+                        addBinding = false;
+                        break;
                     }
+                }
 
-                    if (addBinding)
+                // To call the base function, we have to qualify the call since
+                // the derived class has a function with the same name and different parameters.
+                if (addBinding)
+                    name = bindings[i].classname + string("::") + bindings[i].name;
+            }
+            if (hiddenIter != cb->hidden.end())
+            {
+                for (unsigned int j = 0, jCount = hiddenIter->second.size(); j < jCount; j++)
+                {
+                    if (FunctionBinding::signaturesMatch(bindings[i], hiddenIter->second[j]))
                     {
-                        FunctionBinding b = iter->second[i];
-                        b.name = name;
-                        b.functionName = findIter->first;
-                        b.classname = cb->classname;
-                        b.uniquename = getUniqueName(cb->classname);
-
-                        if (findIter != cb->bindings.end())
-                            findIter->second.push_back(b);
-                        else
-                            cb->bindings[b.getFunctionName()].push_back(b);
+                        addBinding = false;
+                        break;
                     }
                 }
             }
-        }
-
-        derived.push_back(cb);
-    }
 
-    // Go through the derived classes' bindings and resolve the members for their derived classes.
-    for (unsigned int i = 0; i < derived.size(); i++)
-    {
-        resolveMembers(*derived[i]);
+            if (addBinding)
+            {
+                FunctionBinding b = bindings[i];
+                b.name = name;
+                b.functionName = findIter->first;
+                b.classname = cb->classname;
+                b.uniquename = getUniqueName(cb->classname);
+
+                if (findIter != cb->bindings.end())
+                    findIter->second.push_back(b);
+                else
+                    cb->bindings[b.getFunctionName()].push_back(b);
+            }
+        }
     }
 }
 
@@ -108,6 +108,15 @@ public:
      */
     bool isRef(string classname);
 
+    /**
+     * Retrieves whether the given class is a value type (marked with @script{value}),
+     * whose instances are copied into the Lua userdata that holds them.
+     * 
+     * @param classname The name of the class.
+     * @return True if the class is a value type; false otherwise.
+     */
+    bool isValueType(string classname);
+
     /**
      * Checks whether the given class ref ID has any public derived classes.
      *
@@ -203,6 +212,9 @@ private:
     // Resolves members for all classes' derived from class 'c'.
     void resolveMembers(const ClassBinding& c);
 
+    // Adds the bindings of a base class function to derived class 'cb', sharing them if it doesn't declare the function and 'share' is set.
+    void resolveMember(ClassBinding* cb, const vector<FunctionBinding>& bindings, bool share);
+
     // Resolves the inheritance.
     void resolveInheritance();
 
@@ -241,6 +253,7 @@ private:
     map<string, ClassBinding> _classes;
     map<string, set<string>> _classHierarchyPairs;
     vector<string> _topLevelBaseClasses;
+    set<string> _valueTypes;
     map<string, set<string> > _includes;
     map<string, vector<FunctionBinding> > _functions;
     map<string, EnumBinding> _enums;